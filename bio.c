@@ -12,21 +12,32 @@
 // * Do not use the buffer after calling brelse.
 // * Only one process at a time can use a buffer,
 //     so do not keep them longer than necessary.
-// 
-// The implementation uses three state flags internally:
-// * B_BUSY: the block has been returned from bread
-//     and has not been passed back to brelse.  
+//
+// Each buffer has a sleep lock, held from bread to brelse, and
+// a count of the processes holding or waiting for it; only a
+// buffer whose count is zero can be recycled for another block.
+//
+// The implementation uses these state flags internally:
+// * B_BUSY: the buffer's lock is held; the block has been
+//     returned from bread and not passed back to brelse.
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+// * B_DELWRI: the buffer holds file data that bdwrite()
+//     changed outside the log; bflush() or the flusher
+//     thread writes it back later.  bget() writes such a
+//     buffer back before recycling it.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
 #include "spinlock.h"
+#include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
 
+#define FLUSHTICKS 100  // how often the flusher writes back data
+
 struct {
   struct spinlock lock;
   struct buf buf[NBUF];
@@ -51,11 +62,32 @@ binit(void)
     b->next = bcache.head.next;
     b->prev = &bcache.head;
     b->dev = -1;
+    initsleeplock(&b->lock, "buffer");
     bcache.head.next->prev = b;
     bcache.head.next = b;
   }
 }
 
+// Write back delayed-write buffer b, waiting for its lock,
+// unless by then it is clean or pinned by the log.
+// Caller holds bcache.lock; releases it while writing.
+static void
+writeback(struct buf *b)
+{
+  b->refcnt++;
+  release(&bcache.lock);
+  acquiresleep(&b->lock);
+  b->flags |= B_BUSY;
+  if((b->flags & (B_DELWRI|B_DIRTY)) == B_DELWRI){
+    b->flags &= ~B_DELWRI;
+    bwrite(b);
+  }
+  b->flags &= ~B_BUSY;
+  releasesleep(&b->lock);
+  acquire(&bcache.lock);
+  b->refcnt--;
+}
+
 // Look through buffer cache for block on device dev.
 // If not found, allocate a buffer.
 // In either case, return B_BUSY buffer.
@@ -70,28 +102,38 @@ bget(uint dev, uint blockno)
   // Is the block already cached?
   for(b = bcache.head.next; b != &bcache.head; b = b->next){
     if(b->dev == dev && b->blockno == blockno){
-      if(!(b->flags & B_BUSY)){
-        b->flags |= B_BUSY;
-        release(&bcache.lock);
-        return b;
-      }
-      sleep(b, &bcache.lock);
-      goto loop;
+      b->refcnt++;
+      release(&bcache.lock);
+      acquiresleep(&b->lock);
+      b->flags |= B_BUSY;
+      return b;
     }
   }
 
-  // Not cached; recycle some non-busy and clean buffer.
-  // "clean" because B_DIRTY and !B_BUSY means log.c
+  // Not cached; recycle some unused and clean buffer.
+  // "clean" because B_DIRTY and refcnt == 0 means log.c
   // hasn't yet committed the changes to the buffer.
   for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if((b->flags & B_BUSY) == 0 && (b->flags & B_DIRTY) == 0){
+    if(b->refcnt == 0 && (b->flags & (B_DIRTY|B_DELWRI)) == 0){
       b->dev = dev;
       b->blockno = blockno;
-      b->flags = B_BUSY;
+      b->flags = 0;
+      b->refcnt = 1;
       release(&bcache.lock);
+      acquiresleep(&b->lock);
+      b->flags |= B_BUSY;
       return b;
     }
   }
+
+  // None clean: write back the least recently used
+  // delayed write, then look again.
+  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
+    if(b->refcnt == 0 && (b->flags & (B_DIRTY|B_DELWRI)) == B_DELWRI){
+      writeback(b);
+      goto loop;
+    }
+  }
   panic("bget: no buffers");
 }
 
@@ -118,6 +160,55 @@ bwrite(struct buf *b)
   iderw(b);
 }
 
+// Mark b's contents, data of file inum, to be written back
+// later instead of through the log.  Must be B_BUSY.
+void
+bdwrite(struct buf *b, uint inum)
+{
+  if((b->flags & B_BUSY) == 0)
+    panic("bdwrite");
+  b->flags |= B_DELWRI;
+  b->inum = inum;
+}
+
+// Write back the delayed writes of file inum on dev,
+// or all of them if inum is 0.  Buffers pinned by the log
+// are left for the log to write.
+void
+bflush(uint dev, uint inum)
+{
+  struct buf *b;
+
+  acquire(&bcache.lock);
+ loop:
+  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
+    if(!(b->flags & B_DELWRI) || (b->flags & B_DIRTY))
+      continue;
+    if(inum != 0 && (b->dev != dev || b->inum != inum))
+      continue;
+    writeback(b);
+    goto loop;
+  }
+  release(&bcache.lock);
+}
+
+// The flusher thread: write back delayed writes
+// every FLUSHTICKS ticks.
+void
+bflusher(void)
+{
+  uint ticks0;
+
+  for(;;){
+    acquire(&tickslock);
+    ticks0 = ticks;
+    while(ticks - ticks0 < FLUSHTICKS)
+      sleep(&ticks, &tickslock);
+    release(&tickslock);
+    bflush(0, 0);
+  }
+}
+
 // Release a B_BUSY buffer.
 // Move to the head of the MRU list.
 void
@@ -125,8 +216,11 @@ brelse(struct buf *b)
 {
   if((b->flags & B_BUSY) == 0)
     panic("brelse");
+  b->flags &= ~B_BUSY;
+  releasesleep(&b->lock);
 
   acquire(&bcache.lock);
+  b->refcnt--;
 
   b->next->prev = b->prev;
   b->prev->next = b->next;
@@ -135,9 +229,6 @@ brelse(struct buf *b)
   bcache.head.next->prev = b;
   bcache.head.next = b;
 
-  b->flags &= ~B_BUSY;
-  wakeup(b);
-
   release(&bcache.lock);
 }
 //PAGEBREAK!
@@ -1,13 +1,17 @@
 struct buf {
   int flags;
   uint dev;
+  struct sleeplock lock;
+  uint refcnt;       // processes holding or waiting for lock
   uint blockno;
   struct buf *prev; // LRU cache list
   struct buf *next;
   struct buf *qnext; // disk queue
+  uint inum;         // file whose data is in a B_DELWRI buffer
   uchar data[BSIZE];
 };
-#define B_BUSY  0x1  // buffer is locked by some process
+#define B_BUSY  0x1  // lock is held by some process
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
+#define B_DELWRI 0x8 // file data to be written back, outside the log
 
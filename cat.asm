@@ -0,0 +1,2693 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <cat>:
+
+char buf[512];
+
+void
+cat(int fd)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 18             	sub    $0x18,%esp
+  int n;
+
+  // If one side is a pipe and the other a file,
+  // let the kernel move the data without copying it here.
+  while((n = splice(fd, 1, 4096)) > 0)
+       6:	90                   	nop
+       7:	83 ec 04             	sub    $0x4,%esp
+       a:	68 00 10 00 00       	push   $0x1000
+       f:	6a 01                	push   $0x1
+      11:	ff 75 08             	push   0x8(%ebp)
+      14:	e8 7e 08 00 00       	call   897 <splice>
+      19:	83 c4 10             	add    $0x10,%esp
+      1c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      1f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+      23:	7f e2                	jg     7 <cat+0x7>
+    ;
+  if(n == 0)
+      25:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+      29:	74 55                	je     80 <cat+0x80>
+    return;
+
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+      2b:	eb 15                	jmp    42 <cat+0x42>
+    write(1, buf, n);
+      2d:	83 ec 04             	sub    $0x4,%esp
+      30:	ff 75 f4             	push   -0xc(%ebp)
+      33:	68 c0 19 00 00       	push   $0x19c0
+      38:	6a 01                	push   $0x1
+      3a:	e8 1d 07 00 00       	call   75c <write>
+      3f:	83 c4 10             	add    $0x10,%esp
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+      42:	83 ec 04             	sub    $0x4,%esp
+      45:	68 00 02 00 00       	push   $0x200
+      4a:	68 c0 19 00 00       	push   $0x19c0
+      4f:	ff 75 08             	push   0x8(%ebp)
+      52:	e8 f6 06 00 00       	call   74d <read>
+      57:	83 c4 10             	add    $0x10,%esp
+      5a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      5d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+      61:	7f ca                	jg     2d <cat+0x2d>
+  if(n < 0){
+      63:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+      67:	79 18                	jns    81 <cat+0x81>
+    printf(1, "cat: read error\n");
+      69:	83 ec 08             	sub    $0x8,%esp
+      6c:	68 b6 14 00 00       	push   $0x14b6
+      71:	6a 01                	push   $0x1
+      73:	e8 2a 09 00 00       	call   9a2 <printf>
+      78:	83 c4 10             	add    $0x10,%esp
+    exit();
+      7b:	e8 be 13 00 00       	call   143e <exit>
+    return;
+      80:	90                   	nop
+  }
+}
+      81:	c9                   	leave
+      82:	c3                   	ret
+
+00000083 <main>:
+
+int
+main(int argc, char *argv[])
+{
+      83:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+      87:	83 e4 f0             	and    $0xfffffff0,%esp
+      8a:	ff 71 fc             	push   -0x4(%ecx)
+      8d:	55                   	push   %ebp
+      8e:	89 e5                	mov    %esp,%ebp
+      90:	53                   	push   %ebx
+      91:	51                   	push   %ecx
+      92:	83 ec 10             	sub    $0x10,%esp
+      95:	89 cb                	mov    %ecx,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+      97:	83 3b 01             	cmpl   $0x1,(%ebx)
+      9a:	7f 12                	jg     ae <main+0x2b>
+    cat(0);
+      9c:	83 ec 0c             	sub    $0xc,%esp
+      9f:	6a 00                	push   $0x0
+      a1:	e8 5a ff ff ff       	call   0 <cat>
+      a6:	83 c4 10             	add    $0x10,%esp
+    exit();
+      a9:	e8 90 13 00 00       	call   143e <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+      ae:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+      b5:	eb 71                	jmp    128 <main+0xa5>
+    if((fd = open(argv[i], 0)) < 0){
+      b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      ba:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+      c1:	8b 43 04             	mov    0x4(%ebx),%eax
+      c4:	01 d0                	add    %edx,%eax
+      c6:	8b 00                	mov    (%eax),%eax
+      c8:	83 ec 08             	sub    $0x8,%esp
+      cb:	6a 00                	push   $0x0
+      cd:	50                   	push   %eax
+      ce:	e8 c5 06 00 00       	call   798 <open>
+      d3:	83 c4 10             	add    $0x10,%esp
+      d6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+      d9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+      dd:	79 29                	jns    108 <main+0x85>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      e2:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+      e9:	8b 43 04             	mov    0x4(%ebx),%eax
+      ec:	01 d0                	add    %edx,%eax
+      ee:	8b 00                	mov    (%eax),%eax
+      f0:	83 ec 04             	sub    $0x4,%esp
+      f3:	50                   	push   %eax
+      f4:	68 c7 14 00 00       	push   $0x14c7
+      f9:	6a 01                	push   $0x1
+      fb:	e8 a2 08 00 00       	call   9a2 <printf>
+     100:	83 c4 10             	add    $0x10,%esp
+      exit();
+     103:	e8 36 13 00 00       	call   143e <exit>
+    }
+    cat(fd);
+     108:	83 ec 0c             	sub    $0xc,%esp
+     10b:	ff 75 f0             	push   -0x10(%ebp)
+     10e:	e8 ed fe ff ff       	call   0 <cat>
+     113:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+     116:	83 ec 0c             	sub    $0xc,%esp
+     119:	ff 75 f0             	push   -0x10(%ebp)
+     11c:	e8 35 13 00 00       	call   1456 <close>
+     121:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++){
+     124:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     128:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     12b:	3b 03                	cmp    (%ebx),%eax
+     12d:	7c 88                	jl     b7 <main+0x34>
+  }
+  exit();
+     12f:	e8 0a 13 00 00       	call   143e <exit>
+
+00000134 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+     134:	55                   	push   %ebp
+     135:	89 e5                	mov    %esp,%ebp
+     137:	57                   	push   %edi
+     138:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+     139:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     13c:	8b 55 10             	mov    0x10(%ebp),%edx
+     13f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     142:	89 cb                	mov    %ecx,%ebx
+     144:	89 df                	mov    %ebx,%edi
+     146:	89 d1                	mov    %edx,%ecx
+     148:	fc                   	cld
+     149:	f3 aa                	rep stos %al,%es:(%edi)
+     14b:	89 ca                	mov    %ecx,%edx
+     14d:	89 fb                	mov    %edi,%ebx
+     14f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     152:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     155:	90                   	nop
+     156:	5b                   	pop    %ebx
+     157:	5f                   	pop    %edi
+     158:	5d                   	pop    %ebp
+     159:	c3                   	ret
+
+0000015a <stosl>:
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+     15a:	55                   	push   %ebp
+     15b:	89 e5                	mov    %esp,%ebp
+     15d:	57                   	push   %edi
+     15e:	53                   	push   %ebx
+  asm volatile("cld; rep stosl" :
+     15f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     162:	8b 55 10             	mov    0x10(%ebp),%edx
+     165:	8b 45 0c             	mov    0xc(%ebp),%eax
+     168:	89 cb                	mov    %ecx,%ebx
+     16a:	89 df                	mov    %ebx,%edi
+     16c:	89 d1                	mov    %edx,%ecx
+     16e:	fc                   	cld
+     16f:	f3 ab                	rep stos %eax,%es:(%edi)
+     171:	89 ca                	mov    %ecx,%edx
+     173:	89 fb                	mov    %edi,%ebx
+     175:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     178:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     17b:	90                   	nop
+     17c:	5b                   	pop    %ebx
+     17d:	5f                   	pop    %edi
+     17e:	5d                   	pop    %ebp
+     17f:	c3                   	ret
+
+00000180 <movsb>:
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+     180:	55                   	push   %ebp
+     181:	89 e5                	mov    %esp,%ebp
+     183:	57                   	push   %edi
+     184:	56                   	push   %esi
+     185:	53                   	push   %ebx
+  asm volatile("cld; rep movsb" :
+     186:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     189:	8b 55 0c             	mov    0xc(%ebp),%edx
+     18c:	8b 45 10             	mov    0x10(%ebp),%eax
+     18f:	89 cb                	mov    %ecx,%ebx
+     191:	89 df                	mov    %ebx,%edi
+     193:	89 d6                	mov    %edx,%esi
+     195:	89 c1                	mov    %eax,%ecx
+     197:	fc                   	cld
+     198:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     19a:	89 c8                	mov    %ecx,%eax
+     19c:	89 f2                	mov    %esi,%edx
+     19e:	89 fb                	mov    %edi,%ebx
+     1a0:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     1a3:	89 55 0c             	mov    %edx,0xc(%ebp)
+     1a6:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     1a9:	90                   	nop
+     1aa:	5b                   	pop    %ebx
+     1ab:	5e                   	pop    %esi
+     1ac:	5f                   	pop    %edi
+     1ad:	5d                   	pop    %ebp
+     1ae:	c3                   	ret
+
+000001af <movsl>:
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+     1af:	55                   	push   %ebp
+     1b0:	89 e5                	mov    %esp,%ebp
+     1b2:	57                   	push   %edi
+     1b3:	56                   	push   %esi
+     1b4:	53                   	push   %ebx
+  asm volatile("cld; rep movsl" :
+     1b5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     1b8:	8b 55 0c             	mov    0xc(%ebp),%edx
+     1bb:	8b 45 10             	mov    0x10(%ebp),%eax
+     1be:	89 cb                	mov    %ecx,%ebx
+     1c0:	89 df                	mov    %ebx,%edi
+     1c2:	89 d6                	mov    %edx,%esi
+     1c4:	89 c1                	mov    %eax,%ecx
+     1c6:	fc                   	cld
+     1c7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     1c9:	89 c8                	mov    %ecx,%eax
+     1cb:	89 f2                	mov    %esi,%edx
+     1cd:	89 fb                	mov    %edi,%ebx
+     1cf:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     1d2:	89 55 0c             	mov    %edx,0xc(%ebp)
+     1d5:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     1d8:	90                   	nop
+     1d9:	5b                   	pop    %ebx
+     1da:	5e                   	pop    %esi
+     1db:	5f                   	pop    %edi
+     1dc:	5d                   	pop    %ebp
+     1dd:	c3                   	ret
+
+000001de <strcpy>:
+#define ONES        0x01010101
+#define HASZERO(x)  (((x) - ONES) & ~(x) & (ONES << 7))
+
+char*
+strcpy(char *s, char *t)
+{
+     1de:	55                   	push   %ebp
+     1df:	89 e5                	mov    %esp,%ebp
+     1e1:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+     1e4:	8b 45 08             	mov    0x8(%ebp),%eax
+     1e7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     1ea:	90                   	nop
+     1eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+     1ee:	8d 42 01             	lea    0x1(%edx),%eax
+     1f1:	89 45 0c             	mov    %eax,0xc(%ebp)
+     1f4:	8b 45 08             	mov    0x8(%ebp),%eax
+     1f7:	8d 48 01             	lea    0x1(%eax),%ecx
+     1fa:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     1fd:	0f b6 12             	movzbl (%edx),%edx
+     200:	88 10                	mov    %dl,(%eax)
+     202:	0f b6 00             	movzbl (%eax),%eax
+     205:	84 c0                	test   %al,%al
+     207:	75 e2                	jne    1eb <strcpy+0xd>
+    ;
+  return os;
+     209:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     20c:	c9                   	leave
+     20d:	c3                   	ret
+
+0000020e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     20e:	55                   	push   %ebp
+     20f:	89 e5                	mov    %esp,%ebp
+  // Aligned words never straddle a page, so reading
+  // whole ones past the end of a string is safe.
+  if((((uint)p | (uint)q) & 3) == 0)
+     211:	8b 55 08             	mov    0x8(%ebp),%edx
+     214:	8b 45 0c             	mov    0xc(%ebp),%eax
+     217:	09 d0                	or     %edx,%eax
+     219:	83 e0 03             	and    $0x3,%eax
+     21c:	85 c0                	test   %eax,%eax
+     21e:	75 3f                	jne    25f <strcmp+0x51>
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     220:	eb 08                	jmp    22a <strcmp+0x1c>
+      p += 4, q += 4;
+     222:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     226:	83 45 0c 04          	addl   $0x4,0xc(%ebp)
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     22a:	8b 45 08             	mov    0x8(%ebp),%eax
+     22d:	8b 10                	mov    (%eax),%edx
+     22f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     232:	8b 00                	mov    (%eax),%eax
+     234:	39 c2                	cmp    %eax,%edx
+     236:	75 27                	jne    25f <strcmp+0x51>
+     238:	8b 45 08             	mov    0x8(%ebp),%eax
+     23b:	8b 00                	mov    (%eax),%eax
+     23d:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     243:	8b 45 08             	mov    0x8(%ebp),%eax
+     246:	8b 00                	mov    (%eax),%eax
+     248:	f7 d0                	not    %eax
+     24a:	21 d0                	and    %edx,%eax
+     24c:	25 80 80 80 80       	and    $0x80808080,%eax
+     251:	85 c0                	test   %eax,%eax
+     253:	74 cd                	je     222 <strcmp+0x14>
+  while(*p && *p == *q)
+     255:	eb 08                	jmp    25f <strcmp+0x51>
+    p++, q++;
+     257:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     25b:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     25f:	8b 45 08             	mov    0x8(%ebp),%eax
+     262:	0f b6 00             	movzbl (%eax),%eax
+     265:	84 c0                	test   %al,%al
+     267:	74 10                	je     279 <strcmp+0x6b>
+     269:	8b 45 08             	mov    0x8(%ebp),%eax
+     26c:	0f b6 10             	movzbl (%eax),%edx
+     26f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     272:	0f b6 00             	movzbl (%eax),%eax
+     275:	38 c2                	cmp    %al,%dl
+     277:	74 de                	je     257 <strcmp+0x49>
+  return (uchar)*p - (uchar)*q;
+     279:	8b 45 08             	mov    0x8(%ebp),%eax
+     27c:	0f b6 00             	movzbl (%eax),%eax
+     27f:	0f b6 d0             	movzbl %al,%edx
+     282:	8b 45 0c             	mov    0xc(%ebp),%eax
+     285:	0f b6 00             	movzbl (%eax),%eax
+     288:	0f b6 c0             	movzbl %al,%eax
+     28b:	29 c2                	sub    %eax,%edx
+     28d:	89 d0                	mov    %edx,%eax
+}
+     28f:	5d                   	pop    %ebp
+     290:	c3                   	ret
+
+00000291 <strlen>:
+
+uint
+strlen(char *s)
+{
+     291:	55                   	push   %ebp
+     292:	89 e5                	mov    %esp,%ebp
+     294:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; ((uint)(s+n) & 3) && s[n]; n++)
+     297:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     29e:	eb 04                	jmp    2a4 <strlen+0x13>
+     2a0:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     2a4:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     2a7:	8b 45 08             	mov    0x8(%ebp),%eax
+     2aa:	01 d0                	add    %edx,%eax
+     2ac:	83 e0 03             	and    $0x3,%eax
+     2af:	85 c0                	test   %eax,%eax
+     2b1:	74 0f                	je     2c2 <strlen+0x31>
+     2b3:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     2b6:	8b 45 08             	mov    0x8(%ebp),%eax
+     2b9:	01 d0                	add    %edx,%eax
+     2bb:	0f b6 00             	movzbl (%eax),%eax
+     2be:	84 c0                	test   %al,%al
+     2c0:	75 de                	jne    2a0 <strlen+0xf>
+    ;
+  if(s[n])
+     2c2:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     2c5:	8b 45 08             	mov    0x8(%ebp),%eax
+     2c8:	01 d0                	add    %edx,%eax
+     2ca:	0f b6 00             	movzbl (%eax),%eax
+     2cd:	84 c0                	test   %al,%al
+     2cf:	74 33                	je     304 <strlen+0x73>
+    while(!HASZERO(*(uint*)(s+n)))
+     2d1:	eb 04                	jmp    2d7 <strlen+0x46>
+      n += 4;
+     2d3:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+    while(!HASZERO(*(uint*)(s+n)))
+     2d7:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     2da:	8b 45 08             	mov    0x8(%ebp),%eax
+     2dd:	01 d0                	add    %edx,%eax
+     2df:	8b 00                	mov    (%eax),%eax
+     2e1:	8d 88 ff fe fe fe    	lea    -0x1010101(%eax),%ecx
+     2e7:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     2ea:	8b 45 08             	mov    0x8(%ebp),%eax
+     2ed:	01 d0                	add    %edx,%eax
+     2ef:	8b 00                	mov    (%eax),%eax
+     2f1:	f7 d0                	not    %eax
+     2f3:	21 c8                	and    %ecx,%eax
+     2f5:	25 80 80 80 80       	and    $0x80808080,%eax
+     2fa:	85 c0                	test   %eax,%eax
+     2fc:	74 d5                	je     2d3 <strlen+0x42>
+  for(; s[n]; n++)
+     2fe:	eb 04                	jmp    304 <strlen+0x73>
+     300:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     304:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     307:	8b 45 08             	mov    0x8(%ebp),%eax
+     30a:	01 d0                	add    %edx,%eax
+     30c:	0f b6 00             	movzbl (%eax),%eax
+     30f:	84 c0                	test   %al,%al
+     311:	75 ed                	jne    300 <strlen+0x6f>
+    ;
+  return n;
+     313:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     316:	c9                   	leave
+     317:	c3                   	ret
+
+00000318 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     318:	55                   	push   %ebp
+     319:	89 e5                	mov    %esp,%ebp
+     31b:	83 ec 10             	sub    $0x10,%esp
+  char *d;
+  uint k;
+
+  d = dst;
+     31e:	8b 45 08             	mov    0x8(%ebp),%eax
+     321:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c &= 0xFF;
+     324:	81 65 0c ff 00 00 00 	andl   $0xff,0xc(%ebp)
+  if(n >= 16){
+     32b:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     32f:	76 54                	jbe    385 <memset+0x6d>
+    k = -(uint)d & 3;  // bytes up to a word boundary
+     331:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     334:	f7 d8                	neg    %eax
+     336:	83 e0 03             	and    $0x3,%eax
+     339:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    stosb(d, c, k);
+     33c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     33f:	50                   	push   %eax
+     340:	ff 75 0c             	push   0xc(%ebp)
+     343:	ff 75 fc             	push   -0x4(%ebp)
+     346:	e8 e9 fd ff ff       	call   134 <stosb>
+     34b:	83 c4 0c             	add    $0xc,%esp
+    d += k;
+     34e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     351:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n -= k;
+     354:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     357:	29 45 10             	sub    %eax,0x10(%ebp)
+    stosl(d, c*ONES, n/4);
+     35a:	8b 45 10             	mov    0x10(%ebp),%eax
+     35d:	c1 e8 02             	shr    $0x2,%eax
+     360:	89 c2                	mov    %eax,%edx
+     362:	8b 45 0c             	mov    0xc(%ebp),%eax
+     365:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     36b:	52                   	push   %edx
+     36c:	50                   	push   %eax
+     36d:	ff 75 fc             	push   -0x4(%ebp)
+     370:	e8 e5 fd ff ff       	call   15a <stosl>
+     375:	83 c4 0c             	add    $0xc,%esp
+    d += n & ~3;
+     378:	8b 45 10             	mov    0x10(%ebp),%eax
+     37b:	83 e0 fc             	and    $0xfffffffc,%eax
+     37e:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n &= 3;
+     381:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+  }
+  stosb(d, c, n);
+     385:	8b 45 10             	mov    0x10(%ebp),%eax
+     388:	50                   	push   %eax
+     389:	ff 75 0c             	push   0xc(%ebp)
+     38c:	ff 75 fc             	push   -0x4(%ebp)
+     38f:	e8 a0 fd ff ff       	call   134 <stosb>
+     394:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     397:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     39a:	c9                   	leave
+     39b:	c3                   	ret
+
+0000039c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     39c:	55                   	push   %ebp
+     39d:	89 e5                	mov    %esp,%ebp
+     39f:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s1, *s2;
+
+  s1 = v1;
+     3a2:	8b 45 08             	mov    0x8(%ebp),%eax
+     3a5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s2 = v2;
+     3a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3ab:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     3ae:	eb 0c                	jmp    3bc <memcmp+0x20>
+    s1 += 4, s2 += 4, n -= 4;
+     3b0:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+     3b4:	83 45 f8 04          	addl   $0x4,-0x8(%ebp)
+     3b8:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     3bc:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     3c0:	76 3e                	jbe    400 <memcmp+0x64>
+     3c2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     3c5:	8b 10                	mov    (%eax),%edx
+     3c7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3ca:	8b 00                	mov    (%eax),%eax
+     3cc:	39 c2                	cmp    %eax,%edx
+     3ce:	74 e0                	je     3b0 <memcmp+0x14>
+  while(n-- > 0){
+     3d0:	eb 2e                	jmp    400 <memcmp+0x64>
+    if(*s1 != *s2)
+     3d2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     3d5:	0f b6 10             	movzbl (%eax),%edx
+     3d8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3db:	0f b6 00             	movzbl (%eax),%eax
+     3de:	38 c2                	cmp    %al,%dl
+     3e0:	74 16                	je     3f8 <memcmp+0x5c>
+      return *s1 - *s2;
+     3e2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     3e5:	0f b6 00             	movzbl (%eax),%eax
+     3e8:	0f b6 d0             	movzbl %al,%edx
+     3eb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3ee:	0f b6 00             	movzbl (%eax),%eax
+     3f1:	0f b6 c0             	movzbl %al,%eax
+     3f4:	29 c2                	sub    %eax,%edx
+     3f6:	eb 1a                	jmp    412 <memcmp+0x76>
+    s1++, s2++;
+     3f8:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     3fc:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+  while(n-- > 0){
+     400:	8b 45 10             	mov    0x10(%ebp),%eax
+     403:	8d 50 ff             	lea    -0x1(%eax),%edx
+     406:	89 55 10             	mov    %edx,0x10(%ebp)
+     409:	85 c0                	test   %eax,%eax
+     40b:	75 c5                	jne    3d2 <memcmp+0x36>
+  }
+  return 0;
+     40d:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+     412:	89 d0                	mov    %edx,%eax
+     414:	c9                   	leave
+     415:	c3                   	ret
+
+00000416 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     416:	55                   	push   %ebp
+     417:	89 e5                	mov    %esp,%ebp
+     419:	83 ec 14             	sub    $0x14,%esp
+     41c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     41f:	88 45 ec             	mov    %al,-0x14(%ebp)
+  uint w, cc;
+
+  // Skip whole words holding neither c nor the terminator.
+  for(; ((uint)s & 3) && *s; s++)
+     422:	eb 17                	jmp    43b <strchr+0x25>
+    if(*s == c)
+     424:	8b 45 08             	mov    0x8(%ebp),%eax
+     427:	0f b6 00             	movzbl (%eax),%eax
+     42a:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     42d:	75 08                	jne    437 <strchr+0x21>
+      return (char*)s;
+     42f:	8b 45 08             	mov    0x8(%ebp),%eax
+     432:	e9 ad 00 00 00       	jmp    4e4 <strchr+0xce>
+  for(; ((uint)s & 3) && *s; s++)
+     437:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     43b:	8b 45 08             	mov    0x8(%ebp),%eax
+     43e:	83 e0 03             	and    $0x3,%eax
+     441:	85 c0                	test   %eax,%eax
+     443:	74 0a                	je     44f <strchr+0x39>
+     445:	8b 45 08             	mov    0x8(%ebp),%eax
+     448:	0f b6 00             	movzbl (%eax),%eax
+     44b:	84 c0                	test   %al,%al
+     44d:	75 d5                	jne    424 <strchr+0xe>
+  cc = (uchar)c * ONES;
+     44f:	0f b6 45 ec          	movzbl -0x14(%ebp),%eax
+     453:	0f b6 c0             	movzbl %al,%eax
+     456:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     45c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(*s)
+     45f:	8b 45 08             	mov    0x8(%ebp),%eax
+     462:	0f b6 00             	movzbl (%eax),%eax
+     465:	84 c0                	test   %al,%al
+     467:	74 6c                	je     4d5 <strchr+0xbf>
+    for(; w = *(uint*)s, !HASZERO(w) && !HASZERO(w ^ cc); s += 4)
+     469:	eb 04                	jmp    46f <strchr+0x59>
+     46b:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     46f:	8b 45 08             	mov    0x8(%ebp),%eax
+     472:	8b 00                	mov    (%eax),%eax
+     474:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     477:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     47a:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     480:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     483:	f7 d0                	not    %eax
+     485:	21 d0                	and    %edx,%eax
+     487:	25 80 80 80 80       	and    $0x80808080,%eax
+     48c:	85 c0                	test   %eax,%eax
+     48e:	75 26                	jne    4b6 <strchr+0xa0>
+     490:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     493:	33 45 fc             	xor    -0x4(%ebp),%eax
+     496:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     49c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     49f:	33 45 fc             	xor    -0x4(%ebp),%eax
+     4a2:	f7 d0                	not    %eax
+     4a4:	21 d0                	and    %edx,%eax
+     4a6:	25 80 80 80 80       	and    $0x80808080,%eax
+     4ab:	85 c0                	test   %eax,%eax
+     4ad:	75 07                	jne    4b6 <strchr+0xa0>
+     4af:	b8 01 00 00 00       	mov    $0x1,%eax
+     4b4:	eb 05                	jmp    4bb <strchr+0xa5>
+     4b6:	b8 00 00 00 00       	mov    $0x0,%eax
+     4bb:	85 c0                	test   %eax,%eax
+     4bd:	75 ac                	jne    46b <strchr+0x55>
+      ;
+  for(; *s; s++)
+     4bf:	eb 14                	jmp    4d5 <strchr+0xbf>
+    if(*s == c)
+     4c1:	8b 45 08             	mov    0x8(%ebp),%eax
+     4c4:	0f b6 00             	movzbl (%eax),%eax
+     4c7:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     4ca:	75 05                	jne    4d1 <strchr+0xbb>
+      return (char*)s;
+     4cc:	8b 45 08             	mov    0x8(%ebp),%eax
+     4cf:	eb 13                	jmp    4e4 <strchr+0xce>
+  for(; *s; s++)
+     4d1:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     4d5:	8b 45 08             	mov    0x8(%ebp),%eax
+     4d8:	0f b6 00             	movzbl (%eax),%eax
+     4db:	84 c0                	test   %al,%al
+     4dd:	75 e2                	jne    4c1 <strchr+0xab>
+  return 0;
+     4df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     4e4:	c9                   	leave
+     4e5:	c3                   	ret
+
+000004e6 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     4e6:	55                   	push   %ebp
+     4e7:	89 e5                	mov    %esp,%ebp
+     4e9:	83 ec 18             	sub    $0x18,%esp
+  int i, c;
+
+  for(i=0; i+1 < max; ){
+     4ec:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     4f3:	eb 37                	jmp    52c <gets+0x46>
+    c = fgetc(0);
+     4f5:	83 ec 0c             	sub    $0xc,%esp
+     4f8:	6a 00                	push   $0x0
+     4fa:	e8 2e 0e 00 00       	call   132d <fgetc>
+     4ff:	83 c4 10             	add    $0x10,%esp
+     502:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(c < 0)
+     505:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     509:	78 2e                	js     539 <gets+0x53>
+      break;
+    buf[i++] = c;
+     50b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     50e:	8d 50 01             	lea    0x1(%eax),%edx
+     511:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     514:	89 c2                	mov    %eax,%edx
+     516:	8b 45 08             	mov    0x8(%ebp),%eax
+     519:	01 d0                	add    %edx,%eax
+     51b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     51e:	88 10                	mov    %dl,(%eax)
+    if(c == '\n' || c == '\r')
+     520:	83 7d f0 0a          	cmpl   $0xa,-0x10(%ebp)
+     524:	74 14                	je     53a <gets+0x54>
+     526:	83 7d f0 0d          	cmpl   $0xd,-0x10(%ebp)
+     52a:	74 0e                	je     53a <gets+0x54>
+  for(i=0; i+1 < max; ){
+     52c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     52f:	83 c0 01             	add    $0x1,%eax
+     532:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     535:	7f be                	jg     4f5 <gets+0xf>
+     537:	eb 01                	jmp    53a <gets+0x54>
+      break;
+     539:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     53a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     53d:	8b 45 08             	mov    0x8(%ebp),%eax
+     540:	01 d0                	add    %edx,%eax
+     542:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     545:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     548:	c9                   	leave
+     549:	c3                   	ret
+
+0000054a <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     54a:	55                   	push   %ebp
+     54b:	89 e5                	mov    %esp,%ebp
+     54d:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     550:	83 ec 08             	sub    $0x8,%esp
+     553:	6a 00                	push   $0x0
+     555:	ff 75 08             	push   0x8(%ebp)
+     558:	e8 3b 02 00 00       	call   798 <open>
+     55d:	83 c4 10             	add    $0x10,%esp
+     560:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     563:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     567:	79 07                	jns    570 <stat+0x26>
+    return -1;
+     569:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     56e:	eb 25                	jmp    595 <stat+0x4b>
+  r = fstat(fd, st);
+     570:	83 ec 08             	sub    $0x8,%esp
+     573:	ff 75 0c             	push   0xc(%ebp)
+     576:	ff 75 f4             	push   -0xc(%ebp)
+     579:	e8 47 02 00 00       	call   7c5 <fstat>
+     57e:	83 c4 10             	add    $0x10,%esp
+     581:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     584:	83 ec 0c             	sub    $0xc,%esp
+     587:	ff 75 f4             	push   -0xc(%ebp)
+     58a:	e8 c7 0e 00 00       	call   1456 <close>
+     58f:	83 c4 10             	add    $0x10,%esp
+  return r;
+     592:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     595:	c9                   	leave
+     596:	c3                   	ret
+
+00000597 <atoi>:
+
+int
+atoi(const char *s)
+{
+     597:	55                   	push   %ebp
+     598:	89 e5                	mov    %esp,%ebp
+     59a:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     59d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     5a4:	eb 25                	jmp    5cb <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     5a6:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     5a9:	89 d0                	mov    %edx,%eax
+     5ab:	c1 e0 02             	shl    $0x2,%eax
+     5ae:	01 d0                	add    %edx,%eax
+     5b0:	01 c0                	add    %eax,%eax
+     5b2:	89 c1                	mov    %eax,%ecx
+     5b4:	8b 45 08             	mov    0x8(%ebp),%eax
+     5b7:	8d 50 01             	lea    0x1(%eax),%edx
+     5ba:	89 55 08             	mov    %edx,0x8(%ebp)
+     5bd:	0f b6 00             	movzbl (%eax),%eax
+     5c0:	0f be c0             	movsbl %al,%eax
+     5c3:	01 c8                	add    %ecx,%eax
+     5c5:	83 e8 30             	sub    $0x30,%eax
+     5c8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     5cb:	8b 45 08             	mov    0x8(%ebp),%eax
+     5ce:	0f b6 00             	movzbl (%eax),%eax
+     5d1:	3c 2f                	cmp    $0x2f,%al
+     5d3:	7e 0a                	jle    5df <atoi+0x48>
+     5d5:	8b 45 08             	mov    0x8(%ebp),%eax
+     5d8:	0f b6 00             	movzbl (%eax),%eax
+     5db:	3c 39                	cmp    $0x39,%al
+     5dd:	7e c7                	jle    5a6 <atoi+0xf>
+  return n;
+     5df:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     5e2:	c9                   	leave
+     5e3:	c3                   	ret
+
+000005e4 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     5e4:	55                   	push   %ebp
+     5e5:	89 e5                	mov    %esp,%ebp
+     5e7:	83 ec 10             	sub    $0x10,%esp
+  char *d, *s;
+  int k;
+
+  if(n <= 0)
+     5ea:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     5ee:	7f 08                	jg     5f8 <memmove+0x14>
+    return vdst;
+     5f0:	8b 45 08             	mov    0x8(%ebp),%eax
+     5f3:	e9 17 01 00 00       	jmp    70f <memmove+0x12b>
+  d = vdst;
+     5f8:	8b 45 08             	mov    0x8(%ebp),%eax
+     5fb:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s = vsrc;
+     5fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+     601:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  if(s < d && s + n > d){
+     604:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     607:	3b 45 fc             	cmp    -0x4(%ebp),%eax
+     60a:	0f 83 84 00 00 00    	jae    694 <memmove+0xb0>
+     610:	8b 55 10             	mov    0x10(%ebp),%edx
+     613:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     616:	01 d0                	add    %edx,%eax
+     618:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     61b:	73 77                	jae    694 <memmove+0xb0>
+    s += n;
+     61d:	8b 45 10             	mov    0x10(%ebp),%eax
+     620:	01 45 f8             	add    %eax,-0x8(%ebp)
+    d += n;
+     623:	8b 45 10             	mov    0x10(%ebp),%eax
+     626:	01 45 fc             	add    %eax,-0x4(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     629:	eb 17                	jmp    642 <memmove+0x5e>
+      *--d = *--s, n--;
+     62b:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     62f:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     633:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     636:	0f b6 10             	movzbl (%eax),%edx
+     639:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     63c:	88 10                	mov    %dl,(%eax)
+     63e:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     642:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     646:	7e 22                	jle    66a <memmove+0x86>
+     648:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     64b:	83 e0 03             	and    $0x3,%eax
+     64e:	85 c0                	test   %eax,%eax
+     650:	75 d9                	jne    62b <memmove+0x47>
+    for(; n >= 4; n -= 4){
+     652:	eb 16                	jmp    66a <memmove+0x86>
+      d -= 4;
+     654:	83 6d fc 04          	subl   $0x4,-0x4(%ebp)
+      s -= 4;
+     658:	83 6d f8 04          	subl   $0x4,-0x8(%ebp)
+      *(uint*)d = *(uint*)s;
+     65c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     65f:	8b 10                	mov    (%eax),%edx
+     661:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     664:	89 10                	mov    %edx,(%eax)
+    for(; n >= 4; n -= 4){
+     666:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+     66a:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     66e:	7f e4                	jg     654 <memmove+0x70>
+    }
+    while(n-- > 0)
+     670:	eb 13                	jmp    685 <memmove+0xa1>
+      *--d = *--s;
+     672:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     676:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     67a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     67d:	0f b6 10             	movzbl (%eax),%edx
+     680:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     683:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+     685:	8b 45 10             	mov    0x10(%ebp),%eax
+     688:	8d 50 ff             	lea    -0x1(%eax),%edx
+     68b:	89 55 10             	mov    %edx,0x10(%ebp)
+     68e:	85 c0                	test   %eax,%eax
+     690:	7f e0                	jg     672 <memmove+0x8e>
+  if(s < d && s + n > d){
+     692:	eb 78                	jmp    70c <memmove+0x128>
+  } else {
+    if(n >= 16){
+     694:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     698:	7e 61                	jle    6fb <memmove+0x117>
+      k = -(uint)d & 3;
+     69a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     69d:	f7 d8                	neg    %eax
+     69f:	83 e0 03             	and    $0x3,%eax
+     6a2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      movsb(d, s, k);
+     6a5:	ff 75 f4             	push   -0xc(%ebp)
+     6a8:	ff 75 f8             	push   -0x8(%ebp)
+     6ab:	ff 75 fc             	push   -0x4(%ebp)
+     6ae:	e8 cd fa ff ff       	call   180 <movsb>
+     6b3:	83 c4 0c             	add    $0xc,%esp
+      d += k;
+     6b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6b9:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += k;
+     6bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6bf:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n -= k;
+     6c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6c5:	29 45 10             	sub    %eax,0x10(%ebp)
+      movsl(d, s, n/4);
+     6c8:	8b 45 10             	mov    0x10(%ebp),%eax
+     6cb:	8d 50 03             	lea    0x3(%eax),%edx
+     6ce:	85 c0                	test   %eax,%eax
+     6d0:	0f 48 c2             	cmovs  %edx,%eax
+     6d3:	c1 f8 02             	sar    $0x2,%eax
+     6d6:	50                   	push   %eax
+     6d7:	ff 75 f8             	push   -0x8(%ebp)
+     6da:	ff 75 fc             	push   -0x4(%ebp)
+     6dd:	e8 cd fa ff ff       	call   1af <movsl>
+     6e2:	83 c4 0c             	add    $0xc,%esp
+      d += n & ~3;
+     6e5:	8b 45 10             	mov    0x10(%ebp),%eax
+     6e8:	83 e0 fc             	and    $0xfffffffc,%eax
+     6eb:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += n & ~3;
+     6ee:	8b 45 10             	mov    0x10(%ebp),%eax
+     6f1:	83 e0 fc             	and    $0xfffffffc,%eax
+     6f4:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n &= 3;
+     6f7:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+    }
+    movsb(d, s, n);
+     6fb:	ff 75 10             	push   0x10(%ebp)
+     6fe:	ff 75 f8             	push   -0x8(%ebp)
+     701:	ff 75 fc             	push   -0x4(%ebp)
+     704:	e8 77 fa ff ff       	call   180 <movsb>
+     709:	83 c4 0c             	add    $0xc,%esp
+  }
+  return vdst;
+     70c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     70f:	c9                   	leave
+     710:	c3                   	ret
+
+00000711 <_fork>:
+    movl %esp, %ecx; \
+    movl $1f, %edx; \
+    sysenter; \
+  1: ret
+
+RAWSYSCALL(fork)
+     711:	b8 01 00 00 00       	mov    $0x1,%eax
+     716:	89 e1                	mov    %esp,%ecx
+     718:	ba 1f 07 00 00       	mov    $0x71f,%edx
+     71d:	0f 34                	sysenter
+     71f:	c3                   	ret
+
+00000720 <_exit>:
+RAWSYSCALL(exit)
+     720:	b8 02 00 00 00       	mov    $0x2,%eax
+     725:	89 e1                	mov    %esp,%ecx
+     727:	ba 2e 07 00 00       	mov    $0x72e,%edx
+     72c:	0f 34                	sysenter
+     72e:	c3                   	ret
+
+0000072f <wait>:
+SYSCALL(wait)
+     72f:	b8 03 00 00 00       	mov    $0x3,%eax
+     734:	89 e1                	mov    %esp,%ecx
+     736:	ba 3d 07 00 00       	mov    $0x73d,%edx
+     73b:	0f 34                	sysenter
+     73d:	c3                   	ret
+
+0000073e <pipe>:
+SYSCALL(pipe)
+     73e:	b8 04 00 00 00       	mov    $0x4,%eax
+     743:	89 e1                	mov    %esp,%ecx
+     745:	ba 4c 07 00 00       	mov    $0x74c,%edx
+     74a:	0f 34                	sysenter
+     74c:	c3                   	ret
+
+0000074d <read>:
+SYSCALL(read)
+     74d:	b8 05 00 00 00       	mov    $0x5,%eax
+     752:	89 e1                	mov    %esp,%ecx
+     754:	ba 5b 07 00 00       	mov    $0x75b,%edx
+     759:	0f 34                	sysenter
+     75b:	c3                   	ret
+
+0000075c <write>:
+SYSCALL(write)
+     75c:	b8 10 00 00 00       	mov    $0x10,%eax
+     761:	89 e1                	mov    %esp,%ecx
+     763:	ba 6a 07 00 00       	mov    $0x76a,%edx
+     768:	0f 34                	sysenter
+     76a:	c3                   	ret
+
+0000076b <_close>:
+RAWSYSCALL(close)
+     76b:	b8 15 00 00 00       	mov    $0x15,%eax
+     770:	89 e1                	mov    %esp,%ecx
+     772:	ba 79 07 00 00       	mov    $0x779,%edx
+     777:	0f 34                	sysenter
+     779:	c3                   	ret
+
+0000077a <kill>:
+SYSCALL(kill)
+     77a:	b8 06 00 00 00       	mov    $0x6,%eax
+     77f:	89 e1                	mov    %esp,%ecx
+     781:	ba 88 07 00 00       	mov    $0x788,%edx
+     786:	0f 34                	sysenter
+     788:	c3                   	ret
+
+00000789 <_exec>:
+RAWSYSCALL(exec)
+     789:	b8 07 00 00 00       	mov    $0x7,%eax
+     78e:	89 e1                	mov    %esp,%ecx
+     790:	ba 97 07 00 00       	mov    $0x797,%edx
+     795:	0f 34                	sysenter
+     797:	c3                   	ret
+
+00000798 <open>:
+SYSCALL(open)
+     798:	b8 0f 00 00 00       	mov    $0xf,%eax
+     79d:	89 e1                	mov    %esp,%ecx
+     79f:	ba a6 07 00 00       	mov    $0x7a6,%edx
+     7a4:	0f 34                	sysenter
+     7a6:	c3                   	ret
+
+000007a7 <mknod>:
+SYSCALL(mknod)
+     7a7:	b8 11 00 00 00       	mov    $0x11,%eax
+     7ac:	89 e1                	mov    %esp,%ecx
+     7ae:	ba b5 07 00 00       	mov    $0x7b5,%edx
+     7b3:	0f 34                	sysenter
+     7b5:	c3                   	ret
+
+000007b6 <unlink>:
+SYSCALL(unlink)
+     7b6:	b8 12 00 00 00       	mov    $0x12,%eax
+     7bb:	89 e1                	mov    %esp,%ecx
+     7bd:	ba c4 07 00 00       	mov    $0x7c4,%edx
+     7c2:	0f 34                	sysenter
+     7c4:	c3                   	ret
+
+000007c5 <fstat>:
+SYSCALL(fstat)
+     7c5:	b8 08 00 00 00       	mov    $0x8,%eax
+     7ca:	89 e1                	mov    %esp,%ecx
+     7cc:	ba d3 07 00 00       	mov    $0x7d3,%edx
+     7d1:	0f 34                	sysenter
+     7d3:	c3                   	ret
+
+000007d4 <link>:
+SYSCALL(link)
+     7d4:	b8 13 00 00 00       	mov    $0x13,%eax
+     7d9:	89 e1                	mov    %esp,%ecx
+     7db:	ba e2 07 00 00       	mov    $0x7e2,%edx
+     7e0:	0f 34                	sysenter
+     7e2:	c3                   	ret
+
+000007e3 <mkdir>:
+SYSCALL(mkdir)
+     7e3:	b8 14 00 00 00       	mov    $0x14,%eax
+     7e8:	89 e1                	mov    %esp,%ecx
+     7ea:	ba f1 07 00 00       	mov    $0x7f1,%edx
+     7ef:	0f 34                	sysenter
+     7f1:	c3                   	ret
+
+000007f2 <chdir>:
+SYSCALL(chdir)
+     7f2:	b8 09 00 00 00       	mov    $0x9,%eax
+     7f7:	89 e1                	mov    %esp,%ecx
+     7f9:	ba 00 08 00 00       	mov    $0x800,%edx
+     7fe:	0f 34                	sysenter
+     800:	c3                   	ret
+
+00000801 <dup>:
+SYSCALL(dup)
+     801:	b8 0a 00 00 00       	mov    $0xa,%eax
+     806:	89 e1                	mov    %esp,%ecx
+     808:	ba 0f 08 00 00       	mov    $0x80f,%edx
+     80d:	0f 34                	sysenter
+     80f:	c3                   	ret
+
+00000810 <getpid>:
+SYSCALL(getpid)
+     810:	b8 0b 00 00 00       	mov    $0xb,%eax
+     815:	89 e1                	mov    %esp,%ecx
+     817:	ba 1e 08 00 00       	mov    $0x81e,%edx
+     81c:	0f 34                	sysenter
+     81e:	c3                   	ret
+
+0000081f <sbrk>:
+SYSCALL(sbrk)
+     81f:	b8 0c 00 00 00       	mov    $0xc,%eax
+     824:	89 e1                	mov    %esp,%ecx
+     826:	ba 2d 08 00 00       	mov    $0x82d,%edx
+     82b:	0f 34                	sysenter
+     82d:	c3                   	ret
+
+0000082e <sleep>:
+SYSCALL(sleep)
+     82e:	b8 0d 00 00 00       	mov    $0xd,%eax
+     833:	89 e1                	mov    %esp,%ecx
+     835:	ba 3c 08 00 00       	mov    $0x83c,%edx
+     83a:	0f 34                	sysenter
+     83c:	c3                   	ret
+
+0000083d <uptime>:
+SYSCALL(uptime)
+     83d:	b8 0e 00 00 00       	mov    $0xe,%eax
+     842:	89 e1                	mov    %esp,%ecx
+     844:	ba 4b 08 00 00       	mov    $0x84b,%edx
+     849:	0f 34                	sysenter
+     84b:	c3                   	ret
+
+0000084c <getproc>:
+SYSCALL(getproc)
+     84c:	b8 16 00 00 00       	mov    $0x16,%eax
+     851:	89 e1                	mov    %esp,%ecx
+     853:	ba 5a 08 00 00       	mov    $0x85a,%edx
+     858:	0f 34                	sysenter
+     85a:	c3                   	ret
+
+0000085b <getpgs>:
+SYSCALL(getpgs)
+     85b:	b8 17 00 00 00       	mov    $0x17,%eax
+     860:	89 e1                	mov    %esp,%ecx
+     862:	ba 69 08 00 00       	mov    $0x869,%edx
+     867:	0f 34                	sysenter
+     869:	c3                   	ret
+
+0000086a <loadproc>:
+SYSCALL(loadproc)
+     86a:	b8 18 00 00 00       	mov    $0x18,%eax
+     86f:	89 e1                	mov    %esp,%ecx
+     871:	ba 78 08 00 00       	mov    $0x878,%edx
+     876:	0f 34                	sysenter
+     878:	c3                   	ret
+
+00000879 <iosubmit>:
+SYSCALL(iosubmit)
+     879:	b8 19 00 00 00       	mov    $0x19,%eax
+     87e:	89 e1                	mov    %esp,%ecx
+     880:	ba 87 08 00 00       	mov    $0x887,%edx
+     885:	0f 34                	sysenter
+     887:	c3                   	ret
+
+00000888 <sysstat>:
+SYSCALL(sysstat)
+     888:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     88d:	89 e1                	mov    %esp,%ecx
+     88f:	ba 96 08 00 00       	mov    $0x896,%edx
+     894:	0f 34                	sysenter
+     896:	c3                   	ret
+
+00000897 <splice>:
+SYSCALL(splice)
+     897:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     89c:	89 e1                	mov    %esp,%ecx
+     89e:	ba a5 08 00 00       	mov    $0x8a5,%edx
+     8a3:	0f 34                	sysenter
+     8a5:	c3                   	ret
+
+000008a6 <fsync>:
+SYSCALL(fsync)
+     8a6:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     8ab:	89 e1                	mov    %esp,%ecx
+     8ad:	ba b4 08 00 00       	mov    $0x8b4,%edx
+     8b2:	0f 34                	sysenter
+     8b4:	c3                   	ret
+
+000008b5 <fdatasync>:
+SYSCALL(fdatasync)
+     8b5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     8ba:	89 e1                	mov    %esp,%ecx
+     8bc:	ba c3 08 00 00       	mov    $0x8c3,%edx
+     8c1:	0f 34                	sysenter
+     8c3:	c3                   	ret
+
+000008c4 <lseek>:
+SYSCALL(lseek)
+     8c4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     8c9:	89 e1                	mov    %esp,%ecx
+     8cb:	ba d2 08 00 00       	mov    $0x8d2,%edx
+     8d0:	0f 34                	sysenter
+     8d2:	c3                   	ret
+
+000008d3 <dmesg>:
+SYSCALL(dmesg)
+     8d3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     8d8:	89 e1                	mov    %esp,%ecx
+     8da:	ba e1 08 00 00       	mov    $0x8e1,%edx
+     8df:	0f 34                	sysenter
+     8e1:	c3                   	ret
+
+000008e2 <lockstat>:
+SYSCALL(lockstat)
+     8e2:	b8 20 00 00 00       	mov    $0x20,%eax
+     8e7:	89 e1                	mov    %esp,%ecx
+     8e9:	ba f0 08 00 00       	mov    $0x8f0,%edx
+     8ee:	0f 34                	sysenter
+     8f0:	c3                   	ret
+
+000008f1 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     8f1:	55                   	push   %ebp
+     8f2:	89 e5                	mov    %esp,%ebp
+     8f4:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     8f7:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     8fe:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     902:	74 17                	je     91b <printint+0x2a>
+     904:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     908:	79 11                	jns    91b <printint+0x2a>
+    neg = 1;
+     90a:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     911:	8b 45 0c             	mov    0xc(%ebp),%eax
+     914:	f7 d8                	neg    %eax
+     916:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     919:	eb 06                	jmp    921 <printint+0x30>
+  } else {
+    x = xx;
+     91b:	8b 45 0c             	mov    0xc(%ebp),%eax
+     91e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     921:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     928:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     92b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     92e:	ba 00 00 00 00       	mov    $0x0,%edx
+     933:	f7 f1                	div    %ecx
+     935:	89 d1                	mov    %edx,%ecx
+     937:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     93a:	8d 50 01             	lea    0x1(%eax),%edx
+     93d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     940:	0f b6 91 a8 19 00 00 	movzbl 0x19a8(%ecx),%edx
+     947:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     94b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     94e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     951:	ba 00 00 00 00       	mov    $0x0,%edx
+     956:	f7 f1                	div    %ecx
+     958:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     95b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     95f:	75 c7                	jne    928 <printint+0x37>
+  if(neg)
+     961:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     965:	74 2d                	je     994 <printint+0xa3>
+    buf[i++] = '-';
+     967:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     96a:	8d 50 01             	lea    0x1(%eax),%edx
+     96d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     970:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+     975:	eb 1d                	jmp    994 <printint+0xa3>
+    fputc(fd, buf[i]);
+     977:	8d 55 dc             	lea    -0x24(%ebp),%edx
+     97a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     97d:	01 d0                	add    %edx,%eax
+     97f:	0f b6 00             	movzbl (%eax),%eax
+     982:	0f be c0             	movsbl %al,%eax
+     985:	83 ec 08             	sub    $0x8,%esp
+     988:	50                   	push   %eax
+     989:	ff 75 08             	push   0x8(%ebp)
+     98c:	e8 f8 08 00 00       	call   1289 <fputc>
+     991:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+     994:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     998:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     99c:	79 d9                	jns    977 <printint+0x86>
+}
+     99e:	90                   	nop
+     99f:	90                   	nop
+     9a0:	c9                   	leave
+     9a1:	c3                   	ret
+
+000009a2 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     9a2:	55                   	push   %ebp
+     9a3:	89 e5                	mov    %esp,%ebp
+     9a5:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+     9a8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     9af:	8d 45 0c             	lea    0xc(%ebp),%eax
+     9b2:	83 c0 04             	add    $0x4,%eax
+     9b5:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+     9b8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     9bf:	e9 4a 01 00 00       	jmp    b0e <printf+0x16c>
+    c = fmt[i] & 0xff;
+     9c4:	8b 55 0c             	mov    0xc(%ebp),%edx
+     9c7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     9ca:	01 d0                	add    %edx,%eax
+     9cc:	0f b6 00             	movzbl (%eax),%eax
+     9cf:	0f be c0             	movsbl %al,%eax
+     9d2:	25 ff 00 00 00       	and    $0xff,%eax
+     9d7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+     9da:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     9de:	75 28                	jne    a08 <printf+0x66>
+      if(c == '%'){
+     9e0:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     9e4:	75 0c                	jne    9f2 <printf+0x50>
+        state = '%';
+     9e6:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+     9ed:	e9 18 01 00 00       	jmp    b0a <printf+0x168>
+      } else {
+        fputc(fd, c);
+     9f2:	83 ec 08             	sub    $0x8,%esp
+     9f5:	ff 75 e4             	push   -0x1c(%ebp)
+     9f8:	ff 75 08             	push   0x8(%ebp)
+     9fb:	e8 89 08 00 00       	call   1289 <fputc>
+     a00:	83 c4 10             	add    $0x10,%esp
+     a03:	e9 02 01 00 00       	jmp    b0a <printf+0x168>
+      }
+    } else if(state == '%'){
+     a08:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+     a0c:	0f 85 f8 00 00 00    	jne    b0a <printf+0x168>
+      if(c == 'd'){
+     a12:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+     a16:	75 1e                	jne    a36 <printf+0x94>
+        printint(fd, *ap, 10, 1);
+     a18:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     a1b:	8b 00                	mov    (%eax),%eax
+     a1d:	6a 01                	push   $0x1
+     a1f:	6a 0a                	push   $0xa
+     a21:	50                   	push   %eax
+     a22:	ff 75 08             	push   0x8(%ebp)
+     a25:	e8 c7 fe ff ff       	call   8f1 <printint>
+     a2a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     a2d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     a31:	e9 cd 00 00 00       	jmp    b03 <printf+0x161>
+      } else if(c == 'x' || c == 'p'){
+     a36:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+     a3a:	74 06                	je     a42 <printf+0xa0>
+     a3c:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+     a40:	75 1e                	jne    a60 <printf+0xbe>
+        printint(fd, *ap, 16, 0);
+     a42:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     a45:	8b 00                	mov    (%eax),%eax
+     a47:	6a 00                	push   $0x0
+     a49:	6a 10                	push   $0x10
+     a4b:	50                   	push   %eax
+     a4c:	ff 75 08             	push   0x8(%ebp)
+     a4f:	e8 9d fe ff ff       	call   8f1 <printint>
+     a54:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     a57:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     a5b:	e9 a3 00 00 00       	jmp    b03 <printf+0x161>
+      } else if(c == 's'){
+     a60:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+     a64:	75 43                	jne    aa9 <printf+0x107>
+        s = (char*)*ap;
+     a66:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     a69:	8b 00                	mov    (%eax),%eax
+     a6b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     a6e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+     a72:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     a76:	75 25                	jne    a9d <printf+0xfb>
+          s = "(null)";
+     a78:	c7 45 f4 dc 14 00 00 	movl   $0x14dc,-0xc(%ebp)
+        while(*s != 0){
+     a7f:	eb 1c                	jmp    a9d <printf+0xfb>
+          fputc(fd, *s);
+     a81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a84:	0f b6 00             	movzbl (%eax),%eax
+     a87:	0f be c0             	movsbl %al,%eax
+     a8a:	83 ec 08             	sub    $0x8,%esp
+     a8d:	50                   	push   %eax
+     a8e:	ff 75 08             	push   0x8(%ebp)
+     a91:	e8 f3 07 00 00       	call   1289 <fputc>
+     a96:	83 c4 10             	add    $0x10,%esp
+          s++;
+     a99:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+     a9d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     aa0:	0f b6 00             	movzbl (%eax),%eax
+     aa3:	84 c0                	test   %al,%al
+     aa5:	75 da                	jne    a81 <printf+0xdf>
+     aa7:	eb 5a                	jmp    b03 <printf+0x161>
+        }
+      } else if(c == 'c'){
+     aa9:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+     aad:	75 1a                	jne    ac9 <printf+0x127>
+        fputc(fd, *ap);
+     aaf:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     ab2:	8b 00                	mov    (%eax),%eax
+     ab4:	83 ec 08             	sub    $0x8,%esp
+     ab7:	50                   	push   %eax
+     ab8:	ff 75 08             	push   0x8(%ebp)
+     abb:	e8 c9 07 00 00       	call   1289 <fputc>
+     ac0:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     ac3:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     ac7:	eb 3a                	jmp    b03 <printf+0x161>
+      } else if(c == '%'){
+     ac9:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     acd:	75 13                	jne    ae2 <printf+0x140>
+        fputc(fd, c);
+     acf:	83 ec 08             	sub    $0x8,%esp
+     ad2:	ff 75 e4             	push   -0x1c(%ebp)
+     ad5:	ff 75 08             	push   0x8(%ebp)
+     ad8:	e8 ac 07 00 00       	call   1289 <fputc>
+     add:	83 c4 10             	add    $0x10,%esp
+     ae0:	eb 21                	jmp    b03 <printf+0x161>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        fputc(fd, '%');
+     ae2:	83 ec 08             	sub    $0x8,%esp
+     ae5:	6a 25                	push   $0x25
+     ae7:	ff 75 08             	push   0x8(%ebp)
+     aea:	e8 9a 07 00 00       	call   1289 <fputc>
+     aef:	83 c4 10             	add    $0x10,%esp
+        fputc(fd, c);
+     af2:	83 ec 08             	sub    $0x8,%esp
+     af5:	ff 75 e4             	push   -0x1c(%ebp)
+     af8:	ff 75 08             	push   0x8(%ebp)
+     afb:	e8 89 07 00 00       	call   1289 <fputc>
+     b00:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     b03:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     b0a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     b0e:	8b 55 0c             	mov    0xc(%ebp),%edx
+     b11:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b14:	01 d0                	add    %edx,%eax
+     b16:	0f b6 00             	movzbl (%eax),%eax
+     b19:	84 c0                	test   %al,%al
+     b1b:	0f 85 a3 fe ff ff    	jne    9c4 <printf+0x22>
+    }
+  }
+}
+     b21:	90                   	nop
+     b22:	90                   	nop
+     b23:	c9                   	leave
+     b24:	c3                   	ret
+
+00000b25 <binof>:
+static struct chunk *bins[NBIN];       // free large chunks
+static struct chunk *top;              // end marker of newest heap segment
+
+static int
+binof(uint size)
+{
+     b25:	55                   	push   %ebp
+     b26:	89 e5                	mov    %esp,%ebp
+     b28:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  i = 0;
+     b2b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     b32:	c1 6d 08 05          	shrl   $0x5,0x8(%ebp)
+     b36:	eb 07                	jmp    b3f <binof+0x1a>
+    i++;
+     b38:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     b3c:	d1 6d 08             	shrl   0x8(%ebp)
+     b3f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     b43:	74 06                	je     b4b <binof+0x26>
+     b45:	83 7d fc 19          	cmpl   $0x19,-0x4(%ebp)
+     b49:	7e ed                	jle    b38 <binof+0x13>
+  return i;
+     b4b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     b4e:	c9                   	leave
+     b4f:	c3                   	ret
+
+00000b50 <bininsert>:
+
+static void
+bininsert(struct chunk *c)
+{
+     b50:	55                   	push   %ebp
+     b51:	89 e5                	mov    %esp,%ebp
+     b53:	83 ec 10             	sub    $0x10,%esp
+  struct chunk **b;
+
+  b = &bins[binof(CSIZE(c))];
+     b56:	8b 45 08             	mov    0x8(%ebp),%eax
+     b59:	8b 00                	mov    (%eax),%eax
+     b5b:	83 e0 f8             	and    $0xfffffff8,%eax
+     b5e:	50                   	push   %eax
+     b5f:	e8 c1 ff ff ff       	call   b25 <binof>
+     b64:	83 c4 04             	add    $0x4,%esp
+     b67:	c1 e0 02             	shl    $0x2,%eax
+     b6a:	05 e0 1b 00 00       	add    $0x1be0,%eax
+     b6f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c->prev = 0;
+     b72:	8b 45 08             	mov    0x8(%ebp),%eax
+     b75:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  c->next = *b;
+     b7c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     b7f:	8b 10                	mov    (%eax),%edx
+     b81:	8b 45 08             	mov    0x8(%ebp),%eax
+     b84:	89 50 08             	mov    %edx,0x8(%eax)
+  if(*b)
+     b87:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     b8a:	8b 00                	mov    (%eax),%eax
+     b8c:	85 c0                	test   %eax,%eax
+     b8e:	74 0b                	je     b9b <bininsert+0x4b>
+    (*b)->prev = c;
+     b90:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     b93:	8b 00                	mov    (%eax),%eax
+     b95:	8b 55 08             	mov    0x8(%ebp),%edx
+     b98:	89 50 0c             	mov    %edx,0xc(%eax)
+  *b = c;
+     b9b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     b9e:	8b 55 08             	mov    0x8(%ebp),%edx
+     ba1:	89 10                	mov    %edx,(%eax)
+}
+     ba3:	90                   	nop
+     ba4:	c9                   	leave
+     ba5:	c3                   	ret
+
+00000ba6 <binremove>:
+
+static void
+binremove(struct chunk *c)
+{
+     ba6:	55                   	push   %ebp
+     ba7:	89 e5                	mov    %esp,%ebp
+  if(c->prev)
+     ba9:	8b 45 08             	mov    0x8(%ebp),%eax
+     bac:	8b 40 0c             	mov    0xc(%eax),%eax
+     baf:	85 c0                	test   %eax,%eax
+     bb1:	74 11                	je     bc4 <binremove+0x1e>
+    c->prev->next = c->next;
+     bb3:	8b 45 08             	mov    0x8(%ebp),%eax
+     bb6:	8b 40 0c             	mov    0xc(%eax),%eax
+     bb9:	8b 55 08             	mov    0x8(%ebp),%edx
+     bbc:	8b 52 08             	mov    0x8(%edx),%edx
+     bbf:	89 50 08             	mov    %edx,0x8(%eax)
+     bc2:	eb 1e                	jmp    be2 <binremove+0x3c>
+  else
+    bins[binof(CSIZE(c))] = c->next;
+     bc4:	8b 45 08             	mov    0x8(%ebp),%eax
+     bc7:	8b 00                	mov    (%eax),%eax
+     bc9:	83 e0 f8             	and    $0xfffffff8,%eax
+     bcc:	50                   	push   %eax
+     bcd:	e8 53 ff ff ff       	call   b25 <binof>
+     bd2:	83 c4 04             	add    $0x4,%esp
+     bd5:	8b 55 08             	mov    0x8(%ebp),%edx
+     bd8:	8b 52 08             	mov    0x8(%edx),%edx
+     bdb:	89 14 85 e0 1b 00 00 	mov    %edx,0x1be0(,%eax,4)
+  if(c->next)
+     be2:	8b 45 08             	mov    0x8(%ebp),%eax
+     be5:	8b 40 08             	mov    0x8(%eax),%eax
+     be8:	85 c0                	test   %eax,%eax
+     bea:	74 0f                	je     bfb <binremove+0x55>
+    c->next->prev = c->prev;
+     bec:	8b 45 08             	mov    0x8(%ebp),%eax
+     bef:	8b 40 08             	mov    0x8(%eax),%eax
+     bf2:	8b 55 08             	mov    0x8(%ebp),%edx
+     bf5:	8b 52 0c             	mov    0xc(%edx),%edx
+     bf8:	89 50 0c             	mov    %edx,0xc(%eax)
+}
+     bfb:	90                   	nop
+     bfc:	c9                   	leave
+     bfd:	c3                   	ret
+
+00000bfe <freechunk>:
+
+// Free chunk c, merging it with free neighbors.  If trim is
+// set and the result is big and at the break, give it back.
+static void
+freechunk(struct chunk *c, int trim)
+{
+     bfe:	55                   	push   %ebp
+     bff:	89 e5                	mov    %esp,%ebp
+     c01:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *p, *n;
+  uint size;
+
+  size = CSIZE(c);
+     c04:	8b 45 08             	mov    0x8(%ebp),%eax
+     c07:	8b 00                	mov    (%eax),%eax
+     c09:	83 e0 f8             	and    $0xfffffff8,%eax
+     c0c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  n = NEXTC(c);
+     c0f:	8b 45 08             	mov    0x8(%ebp),%eax
+     c12:	8b 00                	mov    (%eax),%eax
+     c14:	83 e0 f8             	and    $0xfffffff8,%eax
+     c17:	89 c2                	mov    %eax,%edx
+     c19:	8b 45 08             	mov    0x8(%ebp),%eax
+     c1c:	01 d0                	add    %edx,%eax
+     c1e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(!(c->size & PREVUSED)){
+     c21:	8b 45 08             	mov    0x8(%ebp),%eax
+     c24:	8b 00                	mov    (%eax),%eax
+     c26:	83 e0 02             	and    $0x2,%eax
+     c29:	85 c0                	test   %eax,%eax
+     c2b:	75 30                	jne    c5d <freechunk+0x5f>
+    p = (struct chunk*)((char*)c - *((uint*)c - 1));
+     c2d:	8b 45 08             	mov    0x8(%ebp),%eax
+     c30:	83 e8 04             	sub    $0x4,%eax
+     c33:	8b 00                	mov    (%eax),%eax
+     c35:	f7 d8                	neg    %eax
+     c37:	89 c2                	mov    %eax,%edx
+     c39:	8b 45 08             	mov    0x8(%ebp),%eax
+     c3c:	01 d0                	add    %edx,%eax
+     c3e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    binremove(p);
+     c41:	ff 75 ec             	push   -0x14(%ebp)
+     c44:	e8 5d ff ff ff       	call   ba6 <binremove>
+     c49:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(p);
+     c4c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     c4f:	8b 00                	mov    (%eax),%eax
+     c51:	83 e0 f8             	and    $0xfffffff8,%eax
+     c54:	01 45 f4             	add    %eax,-0xc(%ebp)
+    c = p;
+     c57:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     c5a:	89 45 08             	mov    %eax,0x8(%ebp)
+  }
+  if(!(n->size & USED)){
+     c5d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c60:	8b 00                	mov    (%eax),%eax
+     c62:	83 e0 01             	and    $0x1,%eax
+     c65:	85 c0                	test   %eax,%eax
+     c67:	75 16                	jne    c7f <freechunk+0x81>
+    binremove(n);
+     c69:	ff 75 f0             	push   -0x10(%ebp)
+     c6c:	e8 35 ff ff ff       	call   ba6 <binremove>
+     c71:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(n);
+     c74:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c77:	8b 00                	mov    (%eax),%eax
+     c79:	83 e0 f8             	and    $0xfffffff8,%eax
+     c7c:	01 45 f4             	add    %eax,-0xc(%ebp)
+  }
+  // Free chunks are never adjacent, so the one below is in use.
+  c->size = size | PREVUSED;
+     c7f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c82:	83 c8 02             	or     $0x2,%eax
+     c85:	89 c2                	mov    %eax,%edx
+     c87:	8b 45 08             	mov    0x8(%ebp),%eax
+     c8a:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+     c8c:	8b 45 08             	mov    0x8(%ebp),%eax
+     c8f:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  FOOTER(c) = size;
+     c96:	8b 45 08             	mov    0x8(%ebp),%eax
+     c99:	8b 00                	mov    (%eax),%eax
+     c9b:	83 e0 f8             	and    $0xfffffff8,%eax
+     c9e:	8d 50 fc             	lea    -0x4(%eax),%edx
+     ca1:	8b 45 08             	mov    0x8(%ebp),%eax
+     ca4:	01 c2                	add    %eax,%edx
+     ca6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ca9:	89 02                	mov    %eax,(%edx)
+  n = NEXTC(c);
+     cab:	8b 45 08             	mov    0x8(%ebp),%eax
+     cae:	8b 00                	mov    (%eax),%eax
+     cb0:	83 e0 f8             	and    $0xfffffff8,%eax
+     cb3:	89 c2                	mov    %eax,%edx
+     cb5:	8b 45 08             	mov    0x8(%ebp),%eax
+     cb8:	01 d0                	add    %edx,%eax
+     cba:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  n->size &= ~PREVUSED;
+     cbd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     cc0:	8b 00                	mov    (%eax),%eax
+     cc2:	83 e0 fd             	and    $0xfffffffd,%eax
+     cc5:	89 c2                	mov    %eax,%edx
+     cc7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     cca:	89 10                	mov    %edx,(%eax)
+
+  if(trim && n == top && size >= TRIMSIZE && sbrk(0) == (char*)top + HDRSIZE){
+     ccc:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     cd0:	74 51                	je     d23 <freechunk+0x125>
+     cd2:	a1 4c 1c 00 00       	mov    0x1c4c,%eax
+     cd7:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     cda:	75 47                	jne    d23 <freechunk+0x125>
+     cdc:	81 7d f4 ff 7f 00 00 	cmpl   $0x7fff,-0xc(%ebp)
+     ce3:	76 3e                	jbe    d23 <freechunk+0x125>
+     ce5:	83 ec 0c             	sub    $0xc,%esp
+     ce8:	6a 00                	push   $0x0
+     cea:	e8 30 fb ff ff       	call   81f <sbrk>
+     cef:	83 c4 10             	add    $0x10,%esp
+     cf2:	8b 15 4c 1c 00 00    	mov    0x1c4c,%edx
+     cf8:	83 c2 08             	add    $0x8,%edx
+     cfb:	39 d0                	cmp    %edx,%eax
+     cfd:	75 24                	jne    d23 <freechunk+0x125>
+    c->size = USED | PREVUSED;
+     cff:	8b 45 08             	mov    0x8(%ebp),%eax
+     d02:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+    top = c;
+     d08:	8b 45 08             	mov    0x8(%ebp),%eax
+     d0b:	a3 4c 1c 00 00       	mov    %eax,0x1c4c
+    sbrk(-size);
+     d10:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d13:	f7 d8                	neg    %eax
+     d15:	83 ec 0c             	sub    $0xc,%esp
+     d18:	50                   	push   %eax
+     d19:	e8 01 fb ff ff       	call   81f <sbrk>
+     d1e:	83 c4 10             	add    $0x10,%esp
+    return;
+     d21:	eb 0e                	jmp    d31 <freechunk+0x133>
+  }
+  bininsert(c);
+     d23:	83 ec 0c             	sub    $0xc,%esp
+     d26:	ff 75 08             	push   0x8(%ebp)
+     d29:	e8 22 fe ff ff       	call   b50 <bininsert>
+     d2e:	83 c4 10             	add    $0x10,%esp
+}
+     d31:	c9                   	leave
+     d32:	c3                   	ret
+
+00000d33 <morecore>:
+
+// Grow the heap by at least need bytes.
+static int
+morecore(uint need)
+{
+     d33:	55                   	push   %ebp
+     d34:	89 e5                	mov    %esp,%ebp
+     d36:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+  char *p;
+  uint n, pad;
+
+  n = need + MINCHUNK;
+     d39:	8b 45 08             	mov    0x8(%ebp),%eax
+     d3c:	83 c0 18             	add    $0x18,%eax
+     d3f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(n < MINCORE)
+     d42:	81 7d ec ff 3f 00 00 	cmpl   $0x3fff,-0x14(%ebp)
+     d49:	77 07                	ja     d52 <morecore+0x1f>
+    n = MINCORE;
+     d4b:	c7 45 ec 00 40 00 00 	movl   $0x4000,-0x14(%ebp)
+  // Keep the break 8-aligned, with the end marker just below it.
+  pad = (8 - ((uint)sbrk(0) & 7)) & 7;
+     d52:	83 ec 0c             	sub    $0xc,%esp
+     d55:	6a 00                	push   $0x0
+     d57:	e8 c3 fa ff ff       	call   81f <sbrk>
+     d5c:	83 c4 10             	add    $0x10,%esp
+     d5f:	83 e0 07             	and    $0x7,%eax
+     d62:	ba 08 00 00 00       	mov    $0x8,%edx
+     d67:	29 c2                	sub    %eax,%edx
+     d69:	89 d0                	mov    %edx,%eax
+     d6b:	83 e0 07             	and    $0x7,%eax
+     d6e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if((p = sbrk(pad + n)) == (char*)-1){
+     d71:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     d74:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     d77:	01 d0                	add    %edx,%eax
+     d79:	83 ec 0c             	sub    $0xc,%esp
+     d7c:	50                   	push   %eax
+     d7d:	e8 9d fa ff ff       	call   81f <sbrk>
+     d82:	83 c4 10             	add    $0x10,%esp
+     d85:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     d88:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     d8c:	75 30                	jne    dbe <morecore+0x8b>
+    n = need + MINCHUNK;
+     d8e:	8b 45 08             	mov    0x8(%ebp),%eax
+     d91:	83 c0 18             	add    $0x18,%eax
+     d94:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((p = sbrk(pad + n)) == (char*)-1)
+     d97:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     d9a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     d9d:	01 d0                	add    %edx,%eax
+     d9f:	83 ec 0c             	sub    $0xc,%esp
+     da2:	50                   	push   %eax
+     da3:	e8 77 fa ff ff       	call   81f <sbrk>
+     da8:	83 c4 10             	add    $0x10,%esp
+     dab:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     dae:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     db2:	75 0a                	jne    dbe <morecore+0x8b>
+      return -1;
+     db4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     db9:	e9 8e 00 00 00       	jmp    e4c <morecore+0x119>
+  }
+  p += pad;
+     dbe:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     dc1:	01 45 f0             	add    %eax,-0x10(%ebp)
+  if(top && p == (char*)top + HDRSIZE){
+     dc4:	a1 4c 1c 00 00       	mov    0x1c4c,%eax
+     dc9:	85 c0                	test   %eax,%eax
+     dcb:	74 29                	je     df6 <morecore+0xc3>
+     dcd:	a1 4c 1c 00 00       	mov    0x1c4c,%eax
+     dd2:	83 c0 08             	add    $0x8,%eax
+     dd5:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     dd8:	75 1c                	jne    df6 <morecore+0xc3>
+    // Contiguous: the old end marker heads the new chunk.
+    c = top;
+     dda:	a1 4c 1c 00 00       	mov    0x1c4c,%eax
+     ddf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = n | (c->size & PREVUSED);
+     de2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     de5:	8b 00                	mov    (%eax),%eax
+     de7:	83 e0 02             	and    $0x2,%eax
+     dea:	0b 45 ec             	or     -0x14(%ebp),%eax
+     ded:	89 c2                	mov    %eax,%edx
+     def:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     df2:	89 10                	mov    %edx,(%eax)
+     df4:	eb 16                	jmp    e0c <morecore+0xd9>
+  } else {
+    // Someone else moved the break: start a new segment.
+    c = (struct chunk*)p;
+     df6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     df9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = (n - HDRSIZE) | PREVUSED;
+     dfc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     dff:	83 e8 08             	sub    $0x8,%eax
+     e02:	83 c8 02             	or     $0x2,%eax
+     e05:	89 c2                	mov    %eax,%edx
+     e07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e0a:	89 10                	mov    %edx,(%eax)
+  }
+  top = NEXTC(c);
+     e0c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e0f:	8b 00                	mov    (%eax),%eax
+     e11:	83 e0 f8             	and    $0xfffffff8,%eax
+     e14:	89 c2                	mov    %eax,%edx
+     e16:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e19:	01 d0                	add    %edx,%eax
+     e1b:	a3 4c 1c 00 00       	mov    %eax,0x1c4c
+  top->size = USED;
+     e20:	a1 4c 1c 00 00       	mov    0x1c4c,%eax
+     e25:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  top->tag = LARGE;
+     e2b:	a1 4c 1c 00 00       	mov    0x1c4c,%eax
+     e30:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  freechunk(c, 0);
+     e37:	83 ec 08             	sub    $0x8,%esp
+     e3a:	6a 00                	push   $0x0
+     e3c:	ff 75 f4             	push   -0xc(%ebp)
+     e3f:	e8 ba fd ff ff       	call   bfe <freechunk>
+     e44:	83 c4 10             	add    $0x10,%esp
+  return 0;
+     e47:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     e4c:	c9                   	leave
+     e4d:	c3                   	ret
+
+00000e4e <largealloc>:
+
+static void*
+largealloc(uint nbytes)
+{
+     e4e:	55                   	push   %ebp
+     e4f:	89 e5                	mov    %esp,%ebp
+     e51:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c, *r;
+  uint need;
+  int i;
+
+  if(nbytes > 0x7fffffff)
+     e54:	8b 45 08             	mov    0x8(%ebp),%eax
+     e57:	85 c0                	test   %eax,%eax
+     e59:	79 0a                	jns    e65 <largealloc+0x17>
+    return 0;
+     e5b:	b8 00 00 00 00       	mov    $0x0,%eax
+     e60:	e9 43 01 00 00       	jmp    fa8 <largealloc+0x15a>
+  need = (nbytes + HDRSIZE + 7) & ~7;
+     e65:	8b 45 08             	mov    0x8(%ebp),%eax
+     e68:	83 c0 0f             	add    $0xf,%eax
+     e6b:	83 e0 f8             	and    $0xfffffff8,%eax
+     e6e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(need < MINCHUNK)
+     e71:	83 7d f0 17          	cmpl   $0x17,-0x10(%ebp)
+     e75:	77 07                	ja     e7e <largealloc+0x30>
+    need = MINCHUNK;
+     e77:	c7 45 f0 18 00 00 00 	movl   $0x18,-0x10(%ebp)
+  for(;;){
+    for(i = binof(need); i < NBIN; i++)
+     e7e:	ff 75 f0             	push   -0x10(%ebp)
+     e81:	e8 9f fc ff ff       	call   b25 <binof>
+     e86:	83 c4 04             	add    $0x4,%esp
+     e89:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     e8c:	eb 2f                	jmp    ebd <largealloc+0x6f>
+      for(c = bins[i]; c; c = c->next)
+     e8e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     e91:	8b 04 85 e0 1b 00 00 	mov    0x1be0(,%eax,4),%eax
+     e98:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     e9b:	eb 16                	jmp    eb3 <largealloc+0x65>
+        if(CSIZE(c) >= need)
+     e9d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ea0:	8b 00                	mov    (%eax),%eax
+     ea2:	83 e0 f8             	and    $0xfffffff8,%eax
+     ea5:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     ea8:	73 35                	jae    edf <largealloc+0x91>
+      for(c = bins[i]; c; c = c->next)
+     eaa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ead:	8b 40 08             	mov    0x8(%eax),%eax
+     eb0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     eb3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     eb7:	75 e4                	jne    e9d <largealloc+0x4f>
+    for(i = binof(need); i < NBIN; i++)
+     eb9:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     ebd:	83 7d ec 1a          	cmpl   $0x1a,-0x14(%ebp)
+     ec1:	7e cb                	jle    e8e <largealloc+0x40>
+          goto found;
+    if(morecore(need) < 0)
+     ec3:	83 ec 0c             	sub    $0xc,%esp
+     ec6:	ff 75 f0             	push   -0x10(%ebp)
+     ec9:	e8 65 fe ff ff       	call   d33 <morecore>
+     ece:	83 c4 10             	add    $0x10,%esp
+     ed1:	85 c0                	test   %eax,%eax
+     ed3:	79 a9                	jns    e7e <largealloc+0x30>
+      return 0;
+     ed5:	b8 00 00 00 00       	mov    $0x0,%eax
+     eda:	e9 c9 00 00 00       	jmp    fa8 <largealloc+0x15a>
+          goto found;
+     edf:	90                   	nop
+  }
+
+found:
+  binremove(c);
+     ee0:	83 ec 0c             	sub    $0xc,%esp
+     ee3:	ff 75 f4             	push   -0xc(%ebp)
+     ee6:	e8 bb fc ff ff       	call   ba6 <binremove>
+     eeb:	83 c4 10             	add    $0x10,%esp
+  if(CSIZE(c) - need >= MINCHUNK){
+     eee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ef1:	8b 00                	mov    (%eax),%eax
+     ef3:	83 e0 f8             	and    $0xfffffff8,%eax
+     ef6:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     ef9:	83 f8 17             	cmp    $0x17,%eax
+     efc:	76 66                	jbe    f64 <largealloc+0x116>
+    r = (struct chunk*)((char*)c + need);
+     efe:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     f01:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f04:	01 d0                	add    %edx,%eax
+     f06:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    r->size = (CSIZE(c) - need) | PREVUSED;
+     f09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f0c:	8b 00                	mov    (%eax),%eax
+     f0e:	83 e0 f8             	and    $0xfffffff8,%eax
+     f11:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     f14:	83 c8 02             	or     $0x2,%eax
+     f17:	89 c2                	mov    %eax,%edx
+     f19:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f1c:	89 10                	mov    %edx,(%eax)
+    r->tag = LARGE;
+     f1e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f21:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+    FOOTER(r) = CSIZE(r);
+     f28:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f2b:	8b 10                	mov    (%eax),%edx
+     f2d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f30:	8b 00                	mov    (%eax),%eax
+     f32:	83 e0 f8             	and    $0xfffffff8,%eax
+     f35:	8d 48 fc             	lea    -0x4(%eax),%ecx
+     f38:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f3b:	01 c8                	add    %ecx,%eax
+     f3d:	83 e2 f8             	and    $0xfffffff8,%edx
+     f40:	89 10                	mov    %edx,(%eax)
+    bininsert(r);
+     f42:	83 ec 0c             	sub    $0xc,%esp
+     f45:	ff 75 e8             	push   -0x18(%ebp)
+     f48:	e8 03 fc ff ff       	call   b50 <bininsert>
+     f4d:	83 c4 10             	add    $0x10,%esp
+    c->size = need | (c->size & PREVUSED);
+     f50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f53:	8b 00                	mov    (%eax),%eax
+     f55:	83 e0 02             	and    $0x2,%eax
+     f58:	0b 45 f0             	or     -0x10(%ebp),%eax
+     f5b:	89 c2                	mov    %eax,%edx
+     f5d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f60:	89 10                	mov    %edx,(%eax)
+     f62:	eb 25                	jmp    f89 <largealloc+0x13b>
+  } else
+    NEXTC(c)->size |= PREVUSED;
+     f64:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f67:	8b 00                	mov    (%eax),%eax
+     f69:	83 e0 f8             	and    $0xfffffff8,%eax
+     f6c:	89 c2                	mov    %eax,%edx
+     f6e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f71:	01 d0                	add    %edx,%eax
+     f73:	8b 10                	mov    (%eax),%edx
+     f75:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f78:	8b 00                	mov    (%eax),%eax
+     f7a:	83 e0 f8             	and    $0xfffffff8,%eax
+     f7d:	89 c1                	mov    %eax,%ecx
+     f7f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f82:	01 c8                	add    %ecx,%eax
+     f84:	83 ca 02             	or     $0x2,%edx
+     f87:	89 10                	mov    %edx,(%eax)
+  c->size |= USED;
+     f89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f8c:	8b 00                	mov    (%eax),%eax
+     f8e:	83 c8 01             	or     $0x1,%eax
+     f91:	89 c2                	mov    %eax,%edx
+     f93:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f96:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+     f98:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f9b:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  return (char*)c + HDRSIZE;
+     fa2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fa5:	83 c0 08             	add    $0x8,%eax
+}
+     fa8:	c9                   	leave
+     fa9:	c3                   	ret
+
+00000faa <refill>:
+
+// Carve a slab into free blocks of class k.
+static int
+refill(int k)
+{
+     faa:	55                   	push   %ebp
+     fab:	89 e5                	mov    %esp,%ebp
+     fad:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  char *p;
+  uint bs, i;
+
+  if((p = largealloc(SLABSIZE)) == 0)
+     fb0:	83 ec 0c             	sub    $0xc,%esp
+     fb3:	68 00 20 00 00       	push   $0x2000
+     fb8:	e8 91 fe ff ff       	call   e4e <largealloc>
+     fbd:	83 c4 10             	add    $0x10,%esp
+     fc0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     fc3:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     fc7:	75 07                	jne    fd0 <refill+0x26>
+    return -1;
+     fc9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     fce:	eb 75                	jmp    1045 <refill+0x9b>
+  bs = HDRSIZE + (MINSMALL << k);
+     fd0:	8b 45 08             	mov    0x8(%ebp),%eax
+     fd3:	ba 10 00 00 00       	mov    $0x10,%edx
+     fd8:	89 c1                	mov    %eax,%ecx
+     fda:	d3 e2                	shl    %cl,%edx
+     fdc:	89 d0                	mov    %edx,%eax
+     fde:	83 c0 08             	add    $0x8,%eax
+     fe1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+     fe4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     feb:	eb 44                	jmp    1031 <refill+0x87>
+    b = (struct chunk*)(p + i);
+     fed:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     ff0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ff3:	01 d0                	add    %edx,%eax
+     ff5:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    b->size = bs | USED;
+     ff8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     ffb:	83 c8 01             	or     $0x1,%eax
+     ffe:	89 c2                	mov    %eax,%edx
+    1000:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1003:	89 10                	mov    %edx,(%eax)
+    b->tag = k;
+    1005:	8b 55 08             	mov    0x8(%ebp),%edx
+    1008:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    100b:	89 50 04             	mov    %edx,0x4(%eax)
+    b->next = classes[k];
+    100e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1011:	8b 14 85 c0 1b 00 00 	mov    0x1bc0(,%eax,4),%edx
+    1018:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    101b:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[k] = b;
+    101e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1021:	8b 55 e8             	mov    -0x18(%ebp),%edx
+    1024:	89 14 85 c0 1b 00 00 	mov    %edx,0x1bc0(,%eax,4)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+    102b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    102e:	01 45 f4             	add    %eax,-0xc(%ebp)
+    1031:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1034:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1037:	01 d0                	add    %edx,%eax
+    1039:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    103e:	76 ad                	jbe    fed <refill+0x43>
+  }
+  return 0;
+    1040:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1045:	c9                   	leave
+    1046:	c3                   	ret
+
+00001047 <free>:
+
+void
+free(void *ap)
+{
+    1047:	55                   	push   %ebp
+    1048:	89 e5                	mov    %esp,%ebp
+    104a:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+
+  if(ap == 0)
+    104d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1051:	74 4b                	je     109e <free+0x57>
+    return;
+  c = (struct chunk*)((char*)ap - HDRSIZE);
+    1053:	8b 45 08             	mov    0x8(%ebp),%eax
+    1056:	83 e8 08             	sub    $0x8,%eax
+    1059:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(c->tag != LARGE){
+    105c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    105f:	8b 40 04             	mov    0x4(%eax),%eax
+    1062:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1065:	74 25                	je     108c <free+0x45>
+    c->next = classes[c->tag];
+    1067:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    106a:	8b 40 04             	mov    0x4(%eax),%eax
+    106d:	8b 14 85 c0 1b 00 00 	mov    0x1bc0(,%eax,4),%edx
+    1074:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1077:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[c->tag] = c;
+    107a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    107d:	8b 40 04             	mov    0x4(%eax),%eax
+    1080:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1083:	89 14 85 c0 1b 00 00 	mov    %edx,0x1bc0(,%eax,4)
+    return;
+    108a:	eb 13                	jmp    109f <free+0x58>
+  }
+  freechunk(c, 1);
+    108c:	83 ec 08             	sub    $0x8,%esp
+    108f:	6a 01                	push   $0x1
+    1091:	ff 75 f4             	push   -0xc(%ebp)
+    1094:	e8 65 fb ff ff       	call   bfe <freechunk>
+    1099:	83 c4 10             	add    $0x10,%esp
+    109c:	eb 01                	jmp    109f <free+0x58>
+    return;
+    109e:	90                   	nop
+}
+    109f:	c9                   	leave
+    10a0:	c3                   	ret
+
+000010a1 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    10a1:	55                   	push   %ebp
+    10a2:	89 e5                	mov    %esp,%ebp
+    10a4:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  int k;
+
+  if(nbytes > MAXSMALL)
+    10a7:	81 7d 08 00 08 00 00 	cmpl   $0x800,0x8(%ebp)
+    10ae:	76 10                	jbe    10c0 <malloc+0x1f>
+    return largealloc(nbytes);
+    10b0:	83 ec 0c             	sub    $0xc,%esp
+    10b3:	ff 75 08             	push   0x8(%ebp)
+    10b6:	e8 93 fd ff ff       	call   e4e <largealloc>
+    10bb:	83 c4 10             	add    $0x10,%esp
+    10be:	eb 6a                	jmp    112a <malloc+0x89>
+  for(k = 0; (MINSMALL << k) < nbytes; k++)
+    10c0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    10c7:	eb 04                	jmp    10cd <malloc+0x2c>
+    10c9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    10cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10d0:	ba 10 00 00 00       	mov    $0x10,%edx
+    10d5:	89 c1                	mov    %eax,%ecx
+    10d7:	d3 e2                	shl    %cl,%edx
+    10d9:	89 d0                	mov    %edx,%eax
+    10db:	3b 45 08             	cmp    0x8(%ebp),%eax
+    10de:	72 e9                	jb     10c9 <malloc+0x28>
+    ;
+  if(classes[k] == 0 && refill(k) < 0)
+    10e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10e3:	8b 04 85 c0 1b 00 00 	mov    0x1bc0(,%eax,4),%eax
+    10ea:	85 c0                	test   %eax,%eax
+    10ec:	75 19                	jne    1107 <malloc+0x66>
+    10ee:	83 ec 0c             	sub    $0xc,%esp
+    10f1:	ff 75 f4             	push   -0xc(%ebp)
+    10f4:	e8 b1 fe ff ff       	call   faa <refill>
+    10f9:	83 c4 10             	add    $0x10,%esp
+    10fc:	85 c0                	test   %eax,%eax
+    10fe:	79 07                	jns    1107 <malloc+0x66>
+    return 0;
+    1100:	b8 00 00 00 00       	mov    $0x0,%eax
+    1105:	eb 23                	jmp    112a <malloc+0x89>
+  b = classes[k];
+    1107:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    110a:	8b 04 85 c0 1b 00 00 	mov    0x1bc0(,%eax,4),%eax
+    1111:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  classes[k] = b->next;
+    1114:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1117:	8b 50 08             	mov    0x8(%eax),%edx
+    111a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    111d:	89 14 85 c0 1b 00 00 	mov    %edx,0x1bc0(,%eax,4)
+  return (char*)b + HDRSIZE;
+    1124:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1127:	83 c0 08             	add    $0x8,%eax
+}
+    112a:	c9                   	leave
+    112b:	c3                   	ret
+
+0000112c <stream>:
+
+// Return the stream for fd, deciding on first use how
+// its output is buffered.  Returns 0 if fd is not open.
+static struct stream*
+stream(int fd)
+{
+    112c:	55                   	push   %ebp
+    112d:	89 e5                	mov    %esp,%ebp
+    112f:	83 ec 28             	sub    $0x28,%esp
+  struct stream *s;
+  struct stat st;
+
+  if(fd < 0 || fd >= NOFILE)
+    1132:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1136:	78 06                	js     113e <stream+0x12>
+    1138:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    113c:	7e 07                	jle    1145 <stream+0x19>
+    return 0;
+    113e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1143:	eb 55                	jmp    119a <stream+0x6e>
+  s = &streams[fd];
+    1145:	8b 45 08             	mov    0x8(%ebp),%eax
+    1148:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    114e:	05 60 1c 00 00       	add    $0x1c60,%eax
+    1153:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(s->mode == UNKNOWN){
+    1156:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1159:	8b 00                	mov    (%eax),%eax
+    115b:	85 c0                	test   %eax,%eax
+    115d:	75 38                	jne    1197 <stream+0x6b>
+    if(fstat(fd, &st) < 0)
+    115f:	83 ec 08             	sub    $0x8,%esp
+    1162:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1165:	50                   	push   %eax
+    1166:	ff 75 08             	push   0x8(%ebp)
+    1169:	e8 57 f6 ff ff       	call   7c5 <fstat>
+    116e:	83 c4 10             	add    $0x10,%esp
+    1171:	85 c0                	test   %eax,%eax
+    1173:	79 07                	jns    117c <stream+0x50>
+      return 0;
+    1175:	b8 00 00 00 00       	mov    $0x0,%eax
+    117a:	eb 1e                	jmp    119a <stream+0x6e>
+    s->mode = st.type == T_DEV ? LINEBUF : FULLBUF;
+    117c:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+    1180:	66 83 f8 03          	cmp    $0x3,%ax
+    1184:	75 07                	jne    118d <stream+0x61>
+    1186:	ba 01 00 00 00       	mov    $0x1,%edx
+    118b:	eb 05                	jmp    1192 <stream+0x66>
+    118d:	ba 02 00 00 00       	mov    $0x2,%edx
+    1192:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1195:	89 10                	mov    %edx,(%eax)
+  }
+  return s;
+    1197:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    119a:	c9                   	leave
+    119b:	c3                   	ret
+
+0000119c <fflush>:
+
+int
+fflush(int fd)
+{
+    119c:	55                   	push   %ebp
+    119d:	89 e5                	mov    %esp,%ebp
+    119f:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  int i, n;
+
+  if(fd < 0 || fd >= NOFILE)
+    11a2:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    11a6:	78 06                	js     11ae <fflush+0x12>
+    11a8:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    11ac:	7e 07                	jle    11b5 <fflush+0x19>
+    return -1;
+    11ae:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    11b3:	eb 78                	jmp    122d <fflush+0x91>
+  s = &streams[fd];
+    11b5:	8b 45 08             	mov    0x8(%ebp),%eax
+    11b8:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    11be:	05 60 1c 00 00       	add    $0x1c60,%eax
+    11c3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < s->nout; i += n){
+    11c6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    11cd:	eb 44                	jmp    1213 <fflush+0x77>
+    if((n = write(fd, s->out + i, s->nout - i)) <= 0){
+    11cf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    11d2:	8b 40 04             	mov    0x4(%eax),%eax
+    11d5:	2b 45 f4             	sub    -0xc(%ebp),%eax
+    11d8:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    11db:	8d 4a 10             	lea    0x10(%edx),%ecx
+    11de:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    11e1:	01 ca                	add    %ecx,%edx
+    11e3:	83 ec 04             	sub    $0x4,%esp
+    11e6:	50                   	push   %eax
+    11e7:	52                   	push   %edx
+    11e8:	ff 75 08             	push   0x8(%ebp)
+    11eb:	e8 6c f5 ff ff       	call   75c <write>
+    11f0:	83 c4 10             	add    $0x10,%esp
+    11f3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    11f6:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    11fa:	7f 11                	jg     120d <fflush+0x71>
+      s->nout = 0;
+    11fc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    11ff:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+      return -1;
+    1206:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    120b:	eb 20                	jmp    122d <fflush+0x91>
+  for(i = 0; i < s->nout; i += n){
+    120d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1210:	01 45 f4             	add    %eax,-0xc(%ebp)
+    1213:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1216:	8b 40 04             	mov    0x4(%eax),%eax
+    1219:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    121c:	7c b1                	jl     11cf <fflush+0x33>
+    }
+  }
+  s->nout = 0;
+    121e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1221:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  return 0;
+    1228:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    122d:	c9                   	leave
+    122e:	c3                   	ret
+
+0000122f <flushall>:
+
+// Flush every stream, or only line-buffered ones.
+static void
+flushall(int lineonly)
+{
+    122f:	55                   	push   %ebp
+    1230:	89 e5                	mov    %esp,%ebp
+    1232:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+    1235:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    123c:	eb 41                	jmp    127f <flushall+0x50>
+    if(streams[fd].nout > 0 && (!lineonly || streams[fd].mode == LINEBUF))
+    123e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1241:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1247:	05 64 1c 00 00       	add    $0x1c64,%eax
+    124c:	8b 00                	mov    (%eax),%eax
+    124e:	85 c0                	test   %eax,%eax
+    1250:	7e 29                	jle    127b <flushall+0x4c>
+    1252:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1256:	74 15                	je     126d <flushall+0x3e>
+    1258:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    125b:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1261:	05 60 1c 00 00       	add    $0x1c60,%eax
+    1266:	8b 00                	mov    (%eax),%eax
+    1268:	83 f8 01             	cmp    $0x1,%eax
+    126b:	75 0e                	jne    127b <flushall+0x4c>
+      fflush(fd);
+    126d:	83 ec 0c             	sub    $0xc,%esp
+    1270:	ff 75 f4             	push   -0xc(%ebp)
+    1273:	e8 24 ff ff ff       	call   119c <fflush>
+    1278:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++)
+    127b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    127f:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+    1283:	7e b9                	jle    123e <flushall+0xf>
+}
+    1285:	90                   	nop
+    1286:	90                   	nop
+    1287:	c9                   	leave
+    1288:	c3                   	ret
+
+00001289 <fputc>:
+
+int
+fputc(int fd, int c)
+{
+    1289:	55                   	push   %ebp
+    128a:	89 e5                	mov    %esp,%ebp
+    128c:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  char ch;
+
+  if((s = stream(fd)) == 0){
+    128f:	83 ec 0c             	sub    $0xc,%esp
+    1292:	ff 75 08             	push   0x8(%ebp)
+    1295:	e8 92 fe ff ff       	call   112c <stream>
+    129a:	83 c4 10             	add    $0x10,%esp
+    129d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    12a0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    12a4:	75 2e                	jne    12d4 <fputc+0x4b>
+    ch = c;
+    12a6:	8b 45 0c             	mov    0xc(%ebp),%eax
+    12a9:	88 45 f3             	mov    %al,-0xd(%ebp)
+    return write(fd, &ch, 1) == 1 ? (uchar)c : -1;
+    12ac:	83 ec 04             	sub    $0x4,%esp
+    12af:	6a 01                	push   $0x1
+    12b1:	8d 45 f3             	lea    -0xd(%ebp),%eax
+    12b4:	50                   	push   %eax
+    12b5:	ff 75 08             	push   0x8(%ebp)
+    12b8:	e8 9f f4 ff ff       	call   75c <write>
+    12bd:	83 c4 10             	add    $0x10,%esp
+    12c0:	83 f8 01             	cmp    $0x1,%eax
+    12c3:	75 08                	jne    12cd <fputc+0x44>
+    12c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+    12c8:	0f b6 c0             	movzbl %al,%eax
+    12cb:	eb 5e                	jmp    132b <fputc+0xa2>
+    12cd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12d2:	eb 57                	jmp    132b <fputc+0xa2>
+  }
+  s->out[s->nout++] = c;
+    12d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12d7:	8b 40 04             	mov    0x4(%eax),%eax
+    12da:	8d 48 01             	lea    0x1(%eax),%ecx
+    12dd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    12e0:	89 4a 04             	mov    %ecx,0x4(%edx)
+    12e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+    12e6:	89 d1                	mov    %edx,%ecx
+    12e8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    12eb:	88 4c 02 10          	mov    %cl,0x10(%edx,%eax,1)
+  if(s->nout == BUFSZ || (s->mode == LINEBUF && c == '\n'))
+    12ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12f2:	8b 40 04             	mov    0x4(%eax),%eax
+    12f5:	3d 00 02 00 00       	cmp    $0x200,%eax
+    12fa:	74 10                	je     130c <fputc+0x83>
+    12fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12ff:	8b 00                	mov    (%eax),%eax
+    1301:	83 f8 01             	cmp    $0x1,%eax
+    1304:	75 1f                	jne    1325 <fputc+0x9c>
+    1306:	83 7d 0c 0a          	cmpl   $0xa,0xc(%ebp)
+    130a:	75 19                	jne    1325 <fputc+0x9c>
+    if(fflush(fd) < 0)
+    130c:	83 ec 0c             	sub    $0xc,%esp
+    130f:	ff 75 08             	push   0x8(%ebp)
+    1312:	e8 85 fe ff ff       	call   119c <fflush>
+    1317:	83 c4 10             	add    $0x10,%esp
+    131a:	85 c0                	test   %eax,%eax
+    131c:	79 07                	jns    1325 <fputc+0x9c>
+      return -1;
+    131e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1323:	eb 06                	jmp    132b <fputc+0xa2>
+  return (uchar)c;
+    1325:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1328:	0f b6 c0             	movzbl %al,%eax
+}
+    132b:	c9                   	leave
+    132c:	c3                   	ret
+
+0000132d <fgetc>:
+
+// Return the next byte read from fd, or -1 at end of file.
+int
+fgetc(int fd)
+{
+    132d:	55                   	push   %ebp
+    132e:	89 e5                	mov    %esp,%ebp
+    1330:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  uchar c;
+  int n;
+
+  if((s = stream(fd)) == 0){
+    1333:	83 ec 0c             	sub    $0xc,%esp
+    1336:	ff 75 08             	push   0x8(%ebp)
+    1339:	e8 ee fd ff ff       	call   112c <stream>
+    133e:	83 c4 10             	add    $0x10,%esp
+    1341:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1344:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1348:	75 39                	jne    1383 <fgetc+0x56>
+    flushall(1);
+    134a:	83 ec 0c             	sub    $0xc,%esp
+    134d:	6a 01                	push   $0x1
+    134f:	e8 db fe ff ff       	call   122f <flushall>
+    1354:	83 c4 10             	add    $0x10,%esp
+    return read(fd, &c, 1) == 1 ? c : -1;
+    1357:	83 ec 04             	sub    $0x4,%esp
+    135a:	6a 01                	push   $0x1
+    135c:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    135f:	50                   	push   %eax
+    1360:	ff 75 08             	push   0x8(%ebp)
+    1363:	e8 e5 f3 ff ff       	call   74d <read>
+    1368:	83 c4 10             	add    $0x10,%esp
+    136b:	83 f8 01             	cmp    $0x1,%eax
+    136e:	75 0c                	jne    137c <fgetc+0x4f>
+    1370:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    1374:	0f b6 c0             	movzbl %al,%eax
+    1377:	e9 80 00 00 00       	jmp    13fc <fgetc+0xcf>
+    137c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1381:	eb 79                	jmp    13fc <fgetc+0xcf>
+  }
+  if(s->rpos == s->rend){
+    1383:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1386:	8b 50 08             	mov    0x8(%eax),%edx
+    1389:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    138c:	8b 40 0c             	mov    0xc(%eax),%eax
+    138f:	39 c2                	cmp    %eax,%edx
+    1391:	75 4c                	jne    13df <fgetc+0xb2>
+    flushall(1);
+    1393:	83 ec 0c             	sub    $0xc,%esp
+    1396:	6a 01                	push   $0x1
+    1398:	e8 92 fe ff ff       	call   122f <flushall>
+    139d:	83 c4 10             	add    $0x10,%esp
+    if((n = read(fd, s->in, BUFSZ)) <= 0)
+    13a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13a3:	05 10 02 00 00       	add    $0x210,%eax
+    13a8:	83 ec 04             	sub    $0x4,%esp
+    13ab:	68 00 02 00 00       	push   $0x200
+    13b0:	50                   	push   %eax
+    13b1:	ff 75 08             	push   0x8(%ebp)
+    13b4:	e8 94 f3 ff ff       	call   74d <read>
+    13b9:	83 c4 10             	add    $0x10,%esp
+    13bc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    13bf:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    13c3:	7f 07                	jg     13cc <fgetc+0x9f>
+      return -1;
+    13c5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    13ca:	eb 30                	jmp    13fc <fgetc+0xcf>
+    s->rpos = 0;
+    13cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13cf:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+    s->rend = n;
+    13d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13d9:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    13dc:	89 50 0c             	mov    %edx,0xc(%eax)
+  }
+  return (uchar)s->in[s->rpos++];
+    13df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13e2:	8b 40 08             	mov    0x8(%eax),%eax
+    13e5:	8d 48 01             	lea    0x1(%eax),%ecx
+    13e8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    13eb:	89 4a 08             	mov    %ecx,0x8(%edx)
+    13ee:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    13f1:	0f b6 84 02 10 02 00 	movzbl 0x210(%edx,%eax,1),%eax
+    13f8:	00 
+    13f9:	0f b6 c0             	movzbl %al,%eax
+}
+    13fc:	c9                   	leave
+    13fd:	c3                   	ret
+
+000013fe <fork>:
+
+int
+fork(void)
+{
+    13fe:	55                   	push   %ebp
+    13ff:	89 e5                	mov    %esp,%ebp
+    1401:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1404:	83 ec 0c             	sub    $0xc,%esp
+    1407:	6a 00                	push   $0x0
+    1409:	e8 21 fe ff ff       	call   122f <flushall>
+    140e:	83 c4 10             	add    $0x10,%esp
+  return _fork();
+    1411:	e8 fb f2 ff ff       	call   711 <_fork>
+}
+    1416:	c9                   	leave
+    1417:	c3                   	ret
+
+00001418 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+    1418:	55                   	push   %ebp
+    1419:	89 e5                	mov    %esp,%ebp
+    141b:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    141e:	83 ec 0c             	sub    $0xc,%esp
+    1421:	6a 00                	push   $0x0
+    1423:	e8 07 fe ff ff       	call   122f <flushall>
+    1428:	83 c4 10             	add    $0x10,%esp
+  return _exec(path, argv);
+    142b:	83 ec 08             	sub    $0x8,%esp
+    142e:	ff 75 0c             	push   0xc(%ebp)
+    1431:	ff 75 08             	push   0x8(%ebp)
+    1434:	e8 50 f3 ff ff       	call   789 <_exec>
+    1439:	83 c4 10             	add    $0x10,%esp
+}
+    143c:	c9                   	leave
+    143d:	c3                   	ret
+
+0000143e <exit>:
+
+int
+exit(void)
+{
+    143e:	55                   	push   %ebp
+    143f:	89 e5                	mov    %esp,%ebp
+    1441:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1444:	83 ec 0c             	sub    $0xc,%esp
+    1447:	6a 00                	push   $0x0
+    1449:	e8 e1 fd ff ff       	call   122f <flushall>
+    144e:	83 c4 10             	add    $0x10,%esp
+  _exit();
+    1451:	e8 ca f2 ff ff       	call   720 <_exit>
+
+00001456 <close>:
+}
+
+int
+close(int fd)
+{
+    1456:	55                   	push   %ebp
+    1457:	89 e5                	mov    %esp,%ebp
+    1459:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+
+  if(fd >= 0 && fd < NOFILE){
+    145c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1460:	78 44                	js     14a6 <close+0x50>
+    1462:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    1466:	7f 3e                	jg     14a6 <close+0x50>
+    fflush(fd);
+    1468:	83 ec 0c             	sub    $0xc,%esp
+    146b:	ff 75 08             	push   0x8(%ebp)
+    146e:	e8 29 fd ff ff       	call   119c <fflush>
+    1473:	83 c4 10             	add    $0x10,%esp
+    s = &streams[fd];
+    1476:	8b 45 08             	mov    0x8(%ebp),%eax
+    1479:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    147f:	05 60 1c 00 00       	add    $0x1c60,%eax
+    1484:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    s->mode = UNKNOWN;
+    1487:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    148a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    s->rpos = s->rend = 0;
+    1490:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1493:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    149a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    149d:	8b 50 0c             	mov    0xc(%eax),%edx
+    14a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14a3:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  return _close(fd);
+    14a6:	83 ec 0c             	sub    $0xc,%esp
+    14a9:	ff 75 08             	push   0x8(%ebp)
+    14ac:	e8 ba f2 ff ff       	call   76b <_close>
+    14b1:	83 c4 10             	add    $0x10,%esp
+}
+    14b4:	c9                   	leave
+    14b5:	c3                   	ret
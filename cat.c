@@ -9,6 +9,13 @@ cat(int fd)
 {
   int n;
 
+  // If one side is a pipe and the other a file,
+  // let the kernel move the data without copying it here.
+  while((n = splice(fd, 1, 4096)) > 0)
+    ;
+  if(n == 0)
+    return;
+
   while((n = read(fd, buf, sizeof(buf))) > 0)
     write(1, buf, n);
   if(n < 0){
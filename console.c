@@ -7,6 +7,7 @@
 #include "param.h"
 #include "traps.h"
 #include "spinlock.h"
+#include "sleeplock.h"
 #include "fs.h"
 #include "file.h"
 #include "memlayout.h"
@@ -23,8 +24,127 @@ static struct {
   int locking;
 } cons;
 
+//PAGEBREAK: 50
+// Kernel message log.  cprintf appends its text as records to
+// a ring owned by the current CPU, without taking a lock.
+// klogd copies new records to the console in sequence order;
+// dmesg reads back whatever the rings still hold.  Until klogd
+// runs, and during a panic, cprintf writes to the console itself.
+//
+// A message too long for one record fills several consecutive
+// records of its CPU's ring, all with the message's sequence
+// number, so readers merging the rings take them in one run.
+// klogd also waits for the last piece before copying any.
+
+#define NKLOG     64  // records per CPU
+#define KLOGTEXT  57  // text bytes per record
+
+struct klogrec {
+  uint seq;
+  ushort len;
+  uchar more;  // the message continues in the next record
+  char text[KLOGTEXT];
+};
+
+static struct {
+  struct klogrec rec[NKLOG];
+  volatile uint w;  // records written; only this CPU advances it
+  volatile uint d;  // records copied to the console
+} klog[NCPU];
+
+static uint klogseq;  // next record sequence number
+static int klogon;    // klogd is running
+
+// Text being formatted by one cprintf call.
+struct kline {
+  int direct;  // also write straight to the console
+  int log;     // keep a record in the ring
+  int nrec;    // records logged so far
+  uint seq;    // the message's sequence number, once nrec > 0
+  int n;
+  char text[KLOGTEXT];
+};
+
+// Copy undrained records of all CPUs to the console, oldest
+// first.  The caller holds cons.lock unless locking is 0.
+// Stops at a message whose last piece isn't written yet,
+// unless force is set.
+static void
+klogdrain(int locking, int force)
+{
+  struct klogrec *r, *min;
+  int i, j, c;
+
+  if(locking)
+    acquire(&cons.lock);
+  for(;;){
+    min = 0;
+    c = 0;
+    for(i = 0; i < NCPU; i++){
+      if(klog[i].d == klog[i].w)
+        continue;
+      r = &klog[i].rec[klog[i].d % NKLOG];
+      if(min == 0 || (int)(r->seq - min->seq) < 0){
+        min = r;
+        c = i;
+      }
+    }
+    if(min == 0)
+      break;
+    if(min->more && klog[c].d + 1 == klog[c].w && !force)
+      break;
+    for(j = 0; j < min->len; j++)
+      consputc(min->text[j] & 0xff);
+    klog[c].d++;
+  }
+  if(locking)
+    release(&cons.lock);
+}
+
+// Append l's text as one record to this CPU's ring.
+// more says that another record of the message follows.
 static void
-printint(int xx, int base, int sign)
+klogput(struct kline *l, int more)
+{
+  struct klogrec *r;
+  int c;
+
+  pushcli();
+  c = cpu - cpus;
+  // Rather than drop text, drain a full ring here.
+  if(klog[c].w - klog[c].d == NKLOG)
+    klogdrain(!l->direct, 1);
+  if(l->nrec++ == 0)
+    l->seq = __sync_fetch_and_add(&klogseq, 1);
+  r = &klog[c].rec[klog[c].w % NKLOG];
+  r->seq = l->seq;
+  r->len = l->n;
+  r->more = more;
+  memmove(r->text, l->text, l->n);
+  __sync_synchronize();  // record before index
+  klog[c].w++;
+  if(l->direct)
+    klog[c].d = klog[c].w;  // already on the console
+  popcli();
+  l->n = 0;
+}
+
+static void
+kputc(struct kline *l, int c)
+{
+  if(l->direct)
+    consputc(c);
+  if(!l->log)
+    return;
+  // Flush a full record only once more text arrives, so the
+  // last record of a message is always the one with more clear.
+  if(l->n == KLOGTEXT)
+    klogput(l, 1);
+  l->text[l->n++] = c;
+}
+
+static void
+printint(struct kline *l, int xx, int base, int sign)
 {
   static char digits[] = "0123456789abcdef";
   char buf[16];
@@ -45,7 +165,7 @@ printint(int xx, int base, int sign)
     buf[i++] = '-';
 
   while(--i >= 0)
-    consputc(buf[i]);
+    kputc(l, buf[i]);
 }
 //PAGEBREAK: 50
 
@@ -56,9 +176,14 @@ cprintf(char *fmt, ...)
   int i, c, locking;
   uint *argp;
   char *s;
+  struct kline l;
 
   locking = cons.locking;
-  if(locking)
+  l.direct = !klogon || !locking;
+  l.log = locking;  // not while panicking, nor before consoleinit
+  l.nrec = 0;
+  l.n = 0;
+  if(l.direct && locking)
     acquire(&cons.lock);
 
   if (fmt == 0)
@@ -67,7 +192,7 @@ cprintf(char *fmt, ...)
   argp = (uint*)(void*)(&fmt + 1);
   for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
     if(c != '%'){
-      consputc(c);
+      kputc(&l, c);
       continue;
     }
     c = fmt[++i] & 0xff;
@@ -75,33 +200,85 @@ cprintf(char *fmt, ...)
       break;
     switch(c){
     case 'd':
-      printint(*argp++, 10, 1);
+      printint(&l, *argp++, 10, 1);
       break;
     case 'x':
     case 'p':
-      printint(*argp++, 16, 0);
+      printint(&l, *argp++, 16, 0);
       break;
     case 's':
       if((s = (char*)*argp++) == 0)
         s = "(null)";
       for(; *s; s++)
-        consputc(*s);
+        kputc(&l, *s);
       break;
     case '%':
-      consputc('%');
+      kputc(&l, '%');
       break;
     default:
       // Print unknown % sequence to draw attention.
-      consputc('%');
-      consputc(c);
+      kputc(&l, '%');
+      kputc(&l, c);
       break;
     }
   }
 
-  if(locking)
+  if(l.n > 0)
+    klogput(&l, 0);
+  if(l.direct && locking)
     release(&cons.lock);
 }
 
+// Kernel thread that copies logged messages to the console.
+void
+klogd(void)
+{
+  klogon = 1;
+  for(;;){
+    klogdrain(1, 0);
+    acquire(&tickslock);
+    sleep(&ticks, &tickslock);
+    release(&tickslock);
+  }
+}
+
+// Copy up to n bytes of the logged messages, oldest first,
+// to dst.  Records overwritten while being read are skipped.
+int
+klogread(char *dst, int n)
+{
+  struct klogrec *r, *min, rec;
+  uint pos[NCPU];
+  int i, c, m, tot;
+
+  for(i = 0; i < NCPU; i++)
+    pos[i] = klog[i].w < NKLOG ? 0 : klog[i].w - NKLOG + 1;
+  for(tot = 0; tot < n; ){
+    min = 0;
+    c = 0;
+    for(i = 0; i < NCPU; i++){
+      if(pos[i] == klog[i].w)
+        continue;
+      r = &klog[i].rec[pos[i] % NKLOG];
+      if(min == 0 || (int)(r->seq - min->seq) < 0){
+        min = r;
+        c = i;
+      }
+    }
+    if(min == 0)
+      break;
+    rec = *min;
+    __sync_synchronize();
+    if(klog[c].w - pos[c] < NKLOG && rec.len <= KLOGTEXT){
+      m = rec.len < n - tot ? rec.len : n - tot;
+      memmove(dst + tot, rec.text, m);
+      tot += m;
+    }
+    pos[c]++;
+  }
+  return tot;
+}
+
 void
 panic(char *s)
 {
@@ -110,12 +287,14 @@ panic(char *s)
   
   cli();
   cons.locking = 0;
+  klogdrain(0, 1);
   cprintf("cpu%d: panic: ", cpu->id);
   cprintf(s);
   cprintf("\n");
   getcallerpcs(&s, pcs);
   for(i=0; i<10; i++)
     cprintf(" %p", pcs[i]);
+  uartflush();
   panicked = 1; // freeze other CPU
   for(;;)
     ;
@@ -4,24 +4,32 @@ struct buf;
 struct context;
 struct file;
 struct inode;
+struct lockstat;
 struct pipe;
 struct proc;
 struct rtcdate;
+struct sleeplock;
 struct spinlock;
 struct stat;
 struct superblock;
+struct sysstat;
 
 // bio.c
 void            binit(void);
 struct buf*     bread(uint, uint);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
+void            bdwrite(struct buf*, uint);
+void            bflush(uint, uint);
+void            bflusher(void);
 
 // console.c
 void            consoleinit(void);
 void            cprintf(char*, ...);
 void            consoleintr(int(*)(void));
 void            panic(char*) __attribute__((noreturn));
+void            klogd(void);
+int             klogread(char*, int);
 
 // exec.c
 int             exec(char*, char**);
@@ -33,16 +41,22 @@ struct file*    filedup(struct file*);
 void            fileinit(void);
 int             fileread(struct file*, char*, int n);
 int             filestat(struct file*, struct stat*);
+int             fileseek(struct file*, int, int);
 int             filewrite(struct file*, char*, int n);
+int             filesplice(struct file*, struct file*, int n);
 
 // fs.c
 void            readsb(int dev, struct superblock *sb);
+void            bmapclose(void);
+void            bmapcommit(void);
+void            dcacheforget(struct inode*, char*);
 int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
 void            iinit(int dev);
 void            ilock(struct inode*);
+void            ilockshared(struct inode*);
 void            iput(struct inode*);
 void            iunlock(struct inode*);
 void            iunlockput(struct inode*);
@@ -51,6 +65,7 @@ int             namecmp(const char*, const char*);
 struct inode*   namei(char*);
 struct inode*   nameiparent(char*, char*);
 int             readi(struct inode*, char*, uint, uint);
+int             splicei(struct inode*, struct pipe*, uint, uint, int);
 void            stati(struct inode*, struct stat*);
 int             writei(struct inode*, char*, uint, uint);
 
@@ -70,6 +85,18 @@ void            kfree(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
 
+// sleeplock.c
+void            acquiresleep(struct sleeplock*);
+void            acquiresleepshared(struct sleeplock*);
+void            releasesleep(struct sleeplock*);
+int             holdingsleep(struct sleeplock*);
+void            initsleeplock(struct sleeplock*, char*);
+
+// slab.c
+void            slabinit(void);
+void*           kmalloc(uint);
+void            kmfree(void*);
+
 // kbd.c
 void            kbdintr(void);
 
@@ -86,7 +113,12 @@ void            microdelay(int);
 void            initlog(int dev);
 void            log_write(struct buf*);
 void            begin_op();
+void            begin_opn(int);
 void            end_op();
+int             log_space(void);
+void            log_sync(void);
+void            log_wait(uint);
+uint            log_seq(void);
 
 // mp.c
 extern int      ismp;
@@ -103,6 +135,10 @@ int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
 int             piperead(struct pipe*, char*, int);
 int             pipewrite(struct pipe*, char*, int);
+int             pipewait(struct pipe*, int);
+int             pipeput(struct pipe*, char*, int);
+int             pipeget(struct pipe*, char*, int);
+void            pipestat(struct pipe*, struct stat*);
 
 //PAGEBREAK: 16
 // proc.c
@@ -119,10 +155,12 @@ void            sleep(void*, struct spinlock*);
 void            userinit(void);
 int             wait(void);
 void            wakeup(void*);
+void            wakeproc(struct proc*, void*);
 void            yield(void);
 int             getproc(struct proc*);
 int             getpgs(char*);
 int             loadproc(struct proc*, char*);
+struct proc*    kproc(char*, void (*)(void));
 
 // swtch.S
 void            swtch(struct context**, struct context*);
@@ -132,6 +170,7 @@ void            acquire(struct spinlock*);
 void            getcallerpcs(void*, uint*);
 int             holding(struct spinlock*);
 void            initlock(struct spinlock*, char*);
+int             getlockstat(struct lockstat*, int);
 void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
@@ -151,6 +190,7 @@ int             argptr(int, char**, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
+void            getsysstat(struct sysstat*);
 void            syscall(void);
 
 // timer.c
@@ -158,6 +198,8 @@ void            timerinit(void);
 
 // trap.c
 void            idtinit(void);
+extern int      havesysenter;
+void            sysenterinit(void);
 extern uint     ticks;
 void            tvinit(void);
 extern struct spinlock tickslock;
@@ -166,6 +208,7 @@ extern struct spinlock tickslock;
 void            uartinit(void);
 void            uartintr(void);
 void            uartputc(int);
+void            uartflush(void);
 
 // vm.c
 void            seginit(void);
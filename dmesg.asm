@@ -0,0 +1,2590 @@
+
+_dmesg:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char buf[32768];
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 14             	sub    $0x14,%esp
+  int n;
+
+  if((n = dmesg(buf, sizeof(buf))) < 0){
+      11:	83 ec 08             	sub    $0x8,%esp
+      14:	68 00 80 00 00       	push   $0x8000
+      19:	68 c0 18 00 00       	push   $0x18c0
+      1e:	e8 dc 07 00 00       	call   7ff <dmesg>
+      23:	83 c4 10             	add    $0x10,%esp
+      26:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      29:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+      2d:	79 17                	jns    46 <main+0x46>
+    printf(2, "dmesg: failed\n");
+      2f:	83 ec 08             	sub    $0x8,%esp
+      32:	68 e2 13 00 00       	push   $0x13e2
+      37:	6a 02                	push   $0x2
+      39:	e8 90 08 00 00       	call   8ce <printf>
+      3e:	83 c4 10             	add    $0x10,%esp
+    exit();
+      41:	e8 24 13 00 00       	call   136a <exit>
+  }
+  write(1, buf, n);
+      46:	83 ec 04             	sub    $0x4,%esp
+      49:	ff 75 f4             	push   -0xc(%ebp)
+      4c:	68 c0 18 00 00       	push   $0x18c0
+      51:	6a 01                	push   $0x1
+      53:	e8 30 06 00 00       	call   688 <write>
+      58:	83 c4 10             	add    $0x10,%esp
+  exit();
+      5b:	e8 0a 13 00 00       	call   136a <exit>
+
+00000060 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+      60:	55                   	push   %ebp
+      61:	89 e5                	mov    %esp,%ebp
+      63:	57                   	push   %edi
+      64:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+      65:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      68:	8b 55 10             	mov    0x10(%ebp),%edx
+      6b:	8b 45 0c             	mov    0xc(%ebp),%eax
+      6e:	89 cb                	mov    %ecx,%ebx
+      70:	89 df                	mov    %ebx,%edi
+      72:	89 d1                	mov    %edx,%ecx
+      74:	fc                   	cld
+      75:	f3 aa                	rep stos %al,%es:(%edi)
+      77:	89 ca                	mov    %ecx,%edx
+      79:	89 fb                	mov    %edi,%ebx
+      7b:	89 5d 08             	mov    %ebx,0x8(%ebp)
+      7e:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+      81:	90                   	nop
+      82:	5b                   	pop    %ebx
+      83:	5f                   	pop    %edi
+      84:	5d                   	pop    %ebp
+      85:	c3                   	ret
+
+00000086 <stosl>:
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+      86:	55                   	push   %ebp
+      87:	89 e5                	mov    %esp,%ebp
+      89:	57                   	push   %edi
+      8a:	53                   	push   %ebx
+  asm volatile("cld; rep stosl" :
+      8b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      8e:	8b 55 10             	mov    0x10(%ebp),%edx
+      91:	8b 45 0c             	mov    0xc(%ebp),%eax
+      94:	89 cb                	mov    %ecx,%ebx
+      96:	89 df                	mov    %ebx,%edi
+      98:	89 d1                	mov    %edx,%ecx
+      9a:	fc                   	cld
+      9b:	f3 ab                	rep stos %eax,%es:(%edi)
+      9d:	89 ca                	mov    %ecx,%edx
+      9f:	89 fb                	mov    %edi,%ebx
+      a1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+      a4:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+      a7:	90                   	nop
+      a8:	5b                   	pop    %ebx
+      a9:	5f                   	pop    %edi
+      aa:	5d                   	pop    %ebp
+      ab:	c3                   	ret
+
+000000ac <movsb>:
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+      ac:	55                   	push   %ebp
+      ad:	89 e5                	mov    %esp,%ebp
+      af:	57                   	push   %edi
+      b0:	56                   	push   %esi
+      b1:	53                   	push   %ebx
+  asm volatile("cld; rep movsb" :
+      b2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      b5:	8b 55 0c             	mov    0xc(%ebp),%edx
+      b8:	8b 45 10             	mov    0x10(%ebp),%eax
+      bb:	89 cb                	mov    %ecx,%ebx
+      bd:	89 df                	mov    %ebx,%edi
+      bf:	89 d6                	mov    %edx,%esi
+      c1:	89 c1                	mov    %eax,%ecx
+      c3:	fc                   	cld
+      c4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+      c6:	89 c8                	mov    %ecx,%eax
+      c8:	89 f2                	mov    %esi,%edx
+      ca:	89 fb                	mov    %edi,%ebx
+      cc:	89 5d 08             	mov    %ebx,0x8(%ebp)
+      cf:	89 55 0c             	mov    %edx,0xc(%ebp)
+      d2:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+      d5:	90                   	nop
+      d6:	5b                   	pop    %ebx
+      d7:	5e                   	pop    %esi
+      d8:	5f                   	pop    %edi
+      d9:	5d                   	pop    %ebp
+      da:	c3                   	ret
+
+000000db <movsl>:
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+      db:	55                   	push   %ebp
+      dc:	89 e5                	mov    %esp,%ebp
+      de:	57                   	push   %edi
+      df:	56                   	push   %esi
+      e0:	53                   	push   %ebx
+  asm volatile("cld; rep movsl" :
+      e1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      e4:	8b 55 0c             	mov    0xc(%ebp),%edx
+      e7:	8b 45 10             	mov    0x10(%ebp),%eax
+      ea:	89 cb                	mov    %ecx,%ebx
+      ec:	89 df                	mov    %ebx,%edi
+      ee:	89 d6                	mov    %edx,%esi
+      f0:	89 c1                	mov    %eax,%ecx
+      f2:	fc                   	cld
+      f3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+      f5:	89 c8                	mov    %ecx,%eax
+      f7:	89 f2                	mov    %esi,%edx
+      f9:	89 fb                	mov    %edi,%ebx
+      fb:	89 5d 08             	mov    %ebx,0x8(%ebp)
+      fe:	89 55 0c             	mov    %edx,0xc(%ebp)
+     101:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     104:	90                   	nop
+     105:	5b                   	pop    %ebx
+     106:	5e                   	pop    %esi
+     107:	5f                   	pop    %edi
+     108:	5d                   	pop    %ebp
+     109:	c3                   	ret
+
+0000010a <strcpy>:
+#define ONES        0x01010101
+#define HASZERO(x)  (((x) - ONES) & ~(x) & (ONES << 7))
+
+char*
+strcpy(char *s, char *t)
+{
+     10a:	55                   	push   %ebp
+     10b:	89 e5                	mov    %esp,%ebp
+     10d:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+     110:	8b 45 08             	mov    0x8(%ebp),%eax
+     113:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     116:	90                   	nop
+     117:	8b 55 0c             	mov    0xc(%ebp),%edx
+     11a:	8d 42 01             	lea    0x1(%edx),%eax
+     11d:	89 45 0c             	mov    %eax,0xc(%ebp)
+     120:	8b 45 08             	mov    0x8(%ebp),%eax
+     123:	8d 48 01             	lea    0x1(%eax),%ecx
+     126:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     129:	0f b6 12             	movzbl (%edx),%edx
+     12c:	88 10                	mov    %dl,(%eax)
+     12e:	0f b6 00             	movzbl (%eax),%eax
+     131:	84 c0                	test   %al,%al
+     133:	75 e2                	jne    117 <strcpy+0xd>
+    ;
+  return os;
+     135:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     138:	c9                   	leave
+     139:	c3                   	ret
+
+0000013a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     13a:	55                   	push   %ebp
+     13b:	89 e5                	mov    %esp,%ebp
+  // Aligned words never straddle a page, so reading
+  // whole ones past the end of a string is safe.
+  if((((uint)p | (uint)q) & 3) == 0)
+     13d:	8b 55 08             	mov    0x8(%ebp),%edx
+     140:	8b 45 0c             	mov    0xc(%ebp),%eax
+     143:	09 d0                	or     %edx,%eax
+     145:	83 e0 03             	and    $0x3,%eax
+     148:	85 c0                	test   %eax,%eax
+     14a:	75 3f                	jne    18b <strcmp+0x51>
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     14c:	eb 08                	jmp    156 <strcmp+0x1c>
+      p += 4, q += 4;
+     14e:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     152:	83 45 0c 04          	addl   $0x4,0xc(%ebp)
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     156:	8b 45 08             	mov    0x8(%ebp),%eax
+     159:	8b 10                	mov    (%eax),%edx
+     15b:	8b 45 0c             	mov    0xc(%ebp),%eax
+     15e:	8b 00                	mov    (%eax),%eax
+     160:	39 c2                	cmp    %eax,%edx
+     162:	75 27                	jne    18b <strcmp+0x51>
+     164:	8b 45 08             	mov    0x8(%ebp),%eax
+     167:	8b 00                	mov    (%eax),%eax
+     169:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     16f:	8b 45 08             	mov    0x8(%ebp),%eax
+     172:	8b 00                	mov    (%eax),%eax
+     174:	f7 d0                	not    %eax
+     176:	21 d0                	and    %edx,%eax
+     178:	25 80 80 80 80       	and    $0x80808080,%eax
+     17d:	85 c0                	test   %eax,%eax
+     17f:	74 cd                	je     14e <strcmp+0x14>
+  while(*p && *p == *q)
+     181:	eb 08                	jmp    18b <strcmp+0x51>
+    p++, q++;
+     183:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     187:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     18b:	8b 45 08             	mov    0x8(%ebp),%eax
+     18e:	0f b6 00             	movzbl (%eax),%eax
+     191:	84 c0                	test   %al,%al
+     193:	74 10                	je     1a5 <strcmp+0x6b>
+     195:	8b 45 08             	mov    0x8(%ebp),%eax
+     198:	0f b6 10             	movzbl (%eax),%edx
+     19b:	8b 45 0c             	mov    0xc(%ebp),%eax
+     19e:	0f b6 00             	movzbl (%eax),%eax
+     1a1:	38 c2                	cmp    %al,%dl
+     1a3:	74 de                	je     183 <strcmp+0x49>
+  return (uchar)*p - (uchar)*q;
+     1a5:	8b 45 08             	mov    0x8(%ebp),%eax
+     1a8:	0f b6 00             	movzbl (%eax),%eax
+     1ab:	0f b6 d0             	movzbl %al,%edx
+     1ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+     1b1:	0f b6 00             	movzbl (%eax),%eax
+     1b4:	0f b6 c0             	movzbl %al,%eax
+     1b7:	29 c2                	sub    %eax,%edx
+     1b9:	89 d0                	mov    %edx,%eax
+}
+     1bb:	5d                   	pop    %ebp
+     1bc:	c3                   	ret
+
+000001bd <strlen>:
+
+uint
+strlen(char *s)
+{
+     1bd:	55                   	push   %ebp
+     1be:	89 e5                	mov    %esp,%ebp
+     1c0:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; ((uint)(s+n) & 3) && s[n]; n++)
+     1c3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     1ca:	eb 04                	jmp    1d0 <strlen+0x13>
+     1cc:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     1d0:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     1d3:	8b 45 08             	mov    0x8(%ebp),%eax
+     1d6:	01 d0                	add    %edx,%eax
+     1d8:	83 e0 03             	and    $0x3,%eax
+     1db:	85 c0                	test   %eax,%eax
+     1dd:	74 0f                	je     1ee <strlen+0x31>
+     1df:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     1e2:	8b 45 08             	mov    0x8(%ebp),%eax
+     1e5:	01 d0                	add    %edx,%eax
+     1e7:	0f b6 00             	movzbl (%eax),%eax
+     1ea:	84 c0                	test   %al,%al
+     1ec:	75 de                	jne    1cc <strlen+0xf>
+    ;
+  if(s[n])
+     1ee:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     1f1:	8b 45 08             	mov    0x8(%ebp),%eax
+     1f4:	01 d0                	add    %edx,%eax
+     1f6:	0f b6 00             	movzbl (%eax),%eax
+     1f9:	84 c0                	test   %al,%al
+     1fb:	74 33                	je     230 <strlen+0x73>
+    while(!HASZERO(*(uint*)(s+n)))
+     1fd:	eb 04                	jmp    203 <strlen+0x46>
+      n += 4;
+     1ff:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+    while(!HASZERO(*(uint*)(s+n)))
+     203:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     206:	8b 45 08             	mov    0x8(%ebp),%eax
+     209:	01 d0                	add    %edx,%eax
+     20b:	8b 00                	mov    (%eax),%eax
+     20d:	8d 88 ff fe fe fe    	lea    -0x1010101(%eax),%ecx
+     213:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     216:	8b 45 08             	mov    0x8(%ebp),%eax
+     219:	01 d0                	add    %edx,%eax
+     21b:	8b 00                	mov    (%eax),%eax
+     21d:	f7 d0                	not    %eax
+     21f:	21 c8                	and    %ecx,%eax
+     221:	25 80 80 80 80       	and    $0x80808080,%eax
+     226:	85 c0                	test   %eax,%eax
+     228:	74 d5                	je     1ff <strlen+0x42>
+  for(; s[n]; n++)
+     22a:	eb 04                	jmp    230 <strlen+0x73>
+     22c:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     230:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     233:	8b 45 08             	mov    0x8(%ebp),%eax
+     236:	01 d0                	add    %edx,%eax
+     238:	0f b6 00             	movzbl (%eax),%eax
+     23b:	84 c0                	test   %al,%al
+     23d:	75 ed                	jne    22c <strlen+0x6f>
+    ;
+  return n;
+     23f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     242:	c9                   	leave
+     243:	c3                   	ret
+
+00000244 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     244:	55                   	push   %ebp
+     245:	89 e5                	mov    %esp,%ebp
+     247:	83 ec 10             	sub    $0x10,%esp
+  char *d;
+  uint k;
+
+  d = dst;
+     24a:	8b 45 08             	mov    0x8(%ebp),%eax
+     24d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c &= 0xFF;
+     250:	81 65 0c ff 00 00 00 	andl   $0xff,0xc(%ebp)
+  if(n >= 16){
+     257:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     25b:	76 54                	jbe    2b1 <memset+0x6d>
+    k = -(uint)d & 3;  // bytes up to a word boundary
+     25d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     260:	f7 d8                	neg    %eax
+     262:	83 e0 03             	and    $0x3,%eax
+     265:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    stosb(d, c, k);
+     268:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     26b:	50                   	push   %eax
+     26c:	ff 75 0c             	push   0xc(%ebp)
+     26f:	ff 75 fc             	push   -0x4(%ebp)
+     272:	e8 e9 fd ff ff       	call   60 <stosb>
+     277:	83 c4 0c             	add    $0xc,%esp
+    d += k;
+     27a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     27d:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n -= k;
+     280:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     283:	29 45 10             	sub    %eax,0x10(%ebp)
+    stosl(d, c*ONES, n/4);
+     286:	8b 45 10             	mov    0x10(%ebp),%eax
+     289:	c1 e8 02             	shr    $0x2,%eax
+     28c:	89 c2                	mov    %eax,%edx
+     28e:	8b 45 0c             	mov    0xc(%ebp),%eax
+     291:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     297:	52                   	push   %edx
+     298:	50                   	push   %eax
+     299:	ff 75 fc             	push   -0x4(%ebp)
+     29c:	e8 e5 fd ff ff       	call   86 <stosl>
+     2a1:	83 c4 0c             	add    $0xc,%esp
+    d += n & ~3;
+     2a4:	8b 45 10             	mov    0x10(%ebp),%eax
+     2a7:	83 e0 fc             	and    $0xfffffffc,%eax
+     2aa:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n &= 3;
+     2ad:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+  }
+  stosb(d, c, n);
+     2b1:	8b 45 10             	mov    0x10(%ebp),%eax
+     2b4:	50                   	push   %eax
+     2b5:	ff 75 0c             	push   0xc(%ebp)
+     2b8:	ff 75 fc             	push   -0x4(%ebp)
+     2bb:	e8 a0 fd ff ff       	call   60 <stosb>
+     2c0:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     2c3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     2c6:	c9                   	leave
+     2c7:	c3                   	ret
+
+000002c8 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     2c8:	55                   	push   %ebp
+     2c9:	89 e5                	mov    %esp,%ebp
+     2cb:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s1, *s2;
+
+  s1 = v1;
+     2ce:	8b 45 08             	mov    0x8(%ebp),%eax
+     2d1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s2 = v2;
+     2d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2d7:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     2da:	eb 0c                	jmp    2e8 <memcmp+0x20>
+    s1 += 4, s2 += 4, n -= 4;
+     2dc:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+     2e0:	83 45 f8 04          	addl   $0x4,-0x8(%ebp)
+     2e4:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     2e8:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     2ec:	76 3e                	jbe    32c <memcmp+0x64>
+     2ee:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     2f1:	8b 10                	mov    (%eax),%edx
+     2f3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     2f6:	8b 00                	mov    (%eax),%eax
+     2f8:	39 c2                	cmp    %eax,%edx
+     2fa:	74 e0                	je     2dc <memcmp+0x14>
+  while(n-- > 0){
+     2fc:	eb 2e                	jmp    32c <memcmp+0x64>
+    if(*s1 != *s2)
+     2fe:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     301:	0f b6 10             	movzbl (%eax),%edx
+     304:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     307:	0f b6 00             	movzbl (%eax),%eax
+     30a:	38 c2                	cmp    %al,%dl
+     30c:	74 16                	je     324 <memcmp+0x5c>
+      return *s1 - *s2;
+     30e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     311:	0f b6 00             	movzbl (%eax),%eax
+     314:	0f b6 d0             	movzbl %al,%edx
+     317:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     31a:	0f b6 00             	movzbl (%eax),%eax
+     31d:	0f b6 c0             	movzbl %al,%eax
+     320:	29 c2                	sub    %eax,%edx
+     322:	eb 1a                	jmp    33e <memcmp+0x76>
+    s1++, s2++;
+     324:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     328:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+  while(n-- > 0){
+     32c:	8b 45 10             	mov    0x10(%ebp),%eax
+     32f:	8d 50 ff             	lea    -0x1(%eax),%edx
+     332:	89 55 10             	mov    %edx,0x10(%ebp)
+     335:	85 c0                	test   %eax,%eax
+     337:	75 c5                	jne    2fe <memcmp+0x36>
+  }
+  return 0;
+     339:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+     33e:	89 d0                	mov    %edx,%eax
+     340:	c9                   	leave
+     341:	c3                   	ret
+
+00000342 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     342:	55                   	push   %ebp
+     343:	89 e5                	mov    %esp,%ebp
+     345:	83 ec 14             	sub    $0x14,%esp
+     348:	8b 45 0c             	mov    0xc(%ebp),%eax
+     34b:	88 45 ec             	mov    %al,-0x14(%ebp)
+  uint w, cc;
+
+  // Skip whole words holding neither c nor the terminator.
+  for(; ((uint)s & 3) && *s; s++)
+     34e:	eb 17                	jmp    367 <strchr+0x25>
+    if(*s == c)
+     350:	8b 45 08             	mov    0x8(%ebp),%eax
+     353:	0f b6 00             	movzbl (%eax),%eax
+     356:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     359:	75 08                	jne    363 <strchr+0x21>
+      return (char*)s;
+     35b:	8b 45 08             	mov    0x8(%ebp),%eax
+     35e:	e9 ad 00 00 00       	jmp    410 <strchr+0xce>
+  for(; ((uint)s & 3) && *s; s++)
+     363:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     367:	8b 45 08             	mov    0x8(%ebp),%eax
+     36a:	83 e0 03             	and    $0x3,%eax
+     36d:	85 c0                	test   %eax,%eax
+     36f:	74 0a                	je     37b <strchr+0x39>
+     371:	8b 45 08             	mov    0x8(%ebp),%eax
+     374:	0f b6 00             	movzbl (%eax),%eax
+     377:	84 c0                	test   %al,%al
+     379:	75 d5                	jne    350 <strchr+0xe>
+  cc = (uchar)c * ONES;
+     37b:	0f b6 45 ec          	movzbl -0x14(%ebp),%eax
+     37f:	0f b6 c0             	movzbl %al,%eax
+     382:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     388:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(*s)
+     38b:	8b 45 08             	mov    0x8(%ebp),%eax
+     38e:	0f b6 00             	movzbl (%eax),%eax
+     391:	84 c0                	test   %al,%al
+     393:	74 6c                	je     401 <strchr+0xbf>
+    for(; w = *(uint*)s, !HASZERO(w) && !HASZERO(w ^ cc); s += 4)
+     395:	eb 04                	jmp    39b <strchr+0x59>
+     397:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     39b:	8b 45 08             	mov    0x8(%ebp),%eax
+     39e:	8b 00                	mov    (%eax),%eax
+     3a0:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     3a3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3a6:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     3ac:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3af:	f7 d0                	not    %eax
+     3b1:	21 d0                	and    %edx,%eax
+     3b3:	25 80 80 80 80       	and    $0x80808080,%eax
+     3b8:	85 c0                	test   %eax,%eax
+     3ba:	75 26                	jne    3e2 <strchr+0xa0>
+     3bc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3bf:	33 45 fc             	xor    -0x4(%ebp),%eax
+     3c2:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     3c8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3cb:	33 45 fc             	xor    -0x4(%ebp),%eax
+     3ce:	f7 d0                	not    %eax
+     3d0:	21 d0                	and    %edx,%eax
+     3d2:	25 80 80 80 80       	and    $0x80808080,%eax
+     3d7:	85 c0                	test   %eax,%eax
+     3d9:	75 07                	jne    3e2 <strchr+0xa0>
+     3db:	b8 01 00 00 00       	mov    $0x1,%eax
+     3e0:	eb 05                	jmp    3e7 <strchr+0xa5>
+     3e2:	b8 00 00 00 00       	mov    $0x0,%eax
+     3e7:	85 c0                	test   %eax,%eax
+     3e9:	75 ac                	jne    397 <strchr+0x55>
+      ;
+  for(; *s; s++)
+     3eb:	eb 14                	jmp    401 <strchr+0xbf>
+    if(*s == c)
+     3ed:	8b 45 08             	mov    0x8(%ebp),%eax
+     3f0:	0f b6 00             	movzbl (%eax),%eax
+     3f3:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     3f6:	75 05                	jne    3fd <strchr+0xbb>
+      return (char*)s;
+     3f8:	8b 45 08             	mov    0x8(%ebp),%eax
+     3fb:	eb 13                	jmp    410 <strchr+0xce>
+  for(; *s; s++)
+     3fd:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     401:	8b 45 08             	mov    0x8(%ebp),%eax
+     404:	0f b6 00             	movzbl (%eax),%eax
+     407:	84 c0                	test   %al,%al
+     409:	75 e2                	jne    3ed <strchr+0xab>
+  return 0;
+     40b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     410:	c9                   	leave
+     411:	c3                   	ret
+
+00000412 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     412:	55                   	push   %ebp
+     413:	89 e5                	mov    %esp,%ebp
+     415:	83 ec 18             	sub    $0x18,%esp
+  int i, c;
+
+  for(i=0; i+1 < max; ){
+     418:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     41f:	eb 37                	jmp    458 <gets+0x46>
+    c = fgetc(0);
+     421:	83 ec 0c             	sub    $0xc,%esp
+     424:	6a 00                	push   $0x0
+     426:	e8 2e 0e 00 00       	call   1259 <fgetc>
+     42b:	83 c4 10             	add    $0x10,%esp
+     42e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(c < 0)
+     431:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     435:	78 2e                	js     465 <gets+0x53>
+      break;
+    buf[i++] = c;
+     437:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     43a:	8d 50 01             	lea    0x1(%eax),%edx
+     43d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     440:	89 c2                	mov    %eax,%edx
+     442:	8b 45 08             	mov    0x8(%ebp),%eax
+     445:	01 d0                	add    %edx,%eax
+     447:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     44a:	88 10                	mov    %dl,(%eax)
+    if(c == '\n' || c == '\r')
+     44c:	83 7d f0 0a          	cmpl   $0xa,-0x10(%ebp)
+     450:	74 14                	je     466 <gets+0x54>
+     452:	83 7d f0 0d          	cmpl   $0xd,-0x10(%ebp)
+     456:	74 0e                	je     466 <gets+0x54>
+  for(i=0; i+1 < max; ){
+     458:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     45b:	83 c0 01             	add    $0x1,%eax
+     45e:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     461:	7f be                	jg     421 <gets+0xf>
+     463:	eb 01                	jmp    466 <gets+0x54>
+      break;
+     465:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     466:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     469:	8b 45 08             	mov    0x8(%ebp),%eax
+     46c:	01 d0                	add    %edx,%eax
+     46e:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     471:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     474:	c9                   	leave
+     475:	c3                   	ret
+
+00000476 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     476:	55                   	push   %ebp
+     477:	89 e5                	mov    %esp,%ebp
+     479:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     47c:	83 ec 08             	sub    $0x8,%esp
+     47f:	6a 00                	push   $0x0
+     481:	ff 75 08             	push   0x8(%ebp)
+     484:	e8 3b 02 00 00       	call   6c4 <open>
+     489:	83 c4 10             	add    $0x10,%esp
+     48c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     48f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     493:	79 07                	jns    49c <stat+0x26>
+    return -1;
+     495:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     49a:	eb 25                	jmp    4c1 <stat+0x4b>
+  r = fstat(fd, st);
+     49c:	83 ec 08             	sub    $0x8,%esp
+     49f:	ff 75 0c             	push   0xc(%ebp)
+     4a2:	ff 75 f4             	push   -0xc(%ebp)
+     4a5:	e8 47 02 00 00       	call   6f1 <fstat>
+     4aa:	83 c4 10             	add    $0x10,%esp
+     4ad:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     4b0:	83 ec 0c             	sub    $0xc,%esp
+     4b3:	ff 75 f4             	push   -0xc(%ebp)
+     4b6:	e8 c7 0e 00 00       	call   1382 <close>
+     4bb:	83 c4 10             	add    $0x10,%esp
+  return r;
+     4be:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     4c1:	c9                   	leave
+     4c2:	c3                   	ret
+
+000004c3 <atoi>:
+
+int
+atoi(const char *s)
+{
+     4c3:	55                   	push   %ebp
+     4c4:	89 e5                	mov    %esp,%ebp
+     4c6:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     4c9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     4d0:	eb 25                	jmp    4f7 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     4d2:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     4d5:	89 d0                	mov    %edx,%eax
+     4d7:	c1 e0 02             	shl    $0x2,%eax
+     4da:	01 d0                	add    %edx,%eax
+     4dc:	01 c0                	add    %eax,%eax
+     4de:	89 c1                	mov    %eax,%ecx
+     4e0:	8b 45 08             	mov    0x8(%ebp),%eax
+     4e3:	8d 50 01             	lea    0x1(%eax),%edx
+     4e6:	89 55 08             	mov    %edx,0x8(%ebp)
+     4e9:	0f b6 00             	movzbl (%eax),%eax
+     4ec:	0f be c0             	movsbl %al,%eax
+     4ef:	01 c8                	add    %ecx,%eax
+     4f1:	83 e8 30             	sub    $0x30,%eax
+     4f4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     4f7:	8b 45 08             	mov    0x8(%ebp),%eax
+     4fa:	0f b6 00             	movzbl (%eax),%eax
+     4fd:	3c 2f                	cmp    $0x2f,%al
+     4ff:	7e 0a                	jle    50b <atoi+0x48>
+     501:	8b 45 08             	mov    0x8(%ebp),%eax
+     504:	0f b6 00             	movzbl (%eax),%eax
+     507:	3c 39                	cmp    $0x39,%al
+     509:	7e c7                	jle    4d2 <atoi+0xf>
+  return n;
+     50b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     50e:	c9                   	leave
+     50f:	c3                   	ret
+
+00000510 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     510:	55                   	push   %ebp
+     511:	89 e5                	mov    %esp,%ebp
+     513:	83 ec 10             	sub    $0x10,%esp
+  char *d, *s;
+  int k;
+
+  if(n <= 0)
+     516:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     51a:	7f 08                	jg     524 <memmove+0x14>
+    return vdst;
+     51c:	8b 45 08             	mov    0x8(%ebp),%eax
+     51f:	e9 17 01 00 00       	jmp    63b <memmove+0x12b>
+  d = vdst;
+     524:	8b 45 08             	mov    0x8(%ebp),%eax
+     527:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s = vsrc;
+     52a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     52d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  if(s < d && s + n > d){
+     530:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     533:	3b 45 fc             	cmp    -0x4(%ebp),%eax
+     536:	0f 83 84 00 00 00    	jae    5c0 <memmove+0xb0>
+     53c:	8b 55 10             	mov    0x10(%ebp),%edx
+     53f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     542:	01 d0                	add    %edx,%eax
+     544:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     547:	73 77                	jae    5c0 <memmove+0xb0>
+    s += n;
+     549:	8b 45 10             	mov    0x10(%ebp),%eax
+     54c:	01 45 f8             	add    %eax,-0x8(%ebp)
+    d += n;
+     54f:	8b 45 10             	mov    0x10(%ebp),%eax
+     552:	01 45 fc             	add    %eax,-0x4(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     555:	eb 17                	jmp    56e <memmove+0x5e>
+      *--d = *--s, n--;
+     557:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     55b:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     55f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     562:	0f b6 10             	movzbl (%eax),%edx
+     565:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     568:	88 10                	mov    %dl,(%eax)
+     56a:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     56e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     572:	7e 22                	jle    596 <memmove+0x86>
+     574:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     577:	83 e0 03             	and    $0x3,%eax
+     57a:	85 c0                	test   %eax,%eax
+     57c:	75 d9                	jne    557 <memmove+0x47>
+    for(; n >= 4; n -= 4){
+     57e:	eb 16                	jmp    596 <memmove+0x86>
+      d -= 4;
+     580:	83 6d fc 04          	subl   $0x4,-0x4(%ebp)
+      s -= 4;
+     584:	83 6d f8 04          	subl   $0x4,-0x8(%ebp)
+      *(uint*)d = *(uint*)s;
+     588:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     58b:	8b 10                	mov    (%eax),%edx
+     58d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     590:	89 10                	mov    %edx,(%eax)
+    for(; n >= 4; n -= 4){
+     592:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+     596:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     59a:	7f e4                	jg     580 <memmove+0x70>
+    }
+    while(n-- > 0)
+     59c:	eb 13                	jmp    5b1 <memmove+0xa1>
+      *--d = *--s;
+     59e:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     5a2:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     5a6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     5a9:	0f b6 10             	movzbl (%eax),%edx
+     5ac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     5af:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+     5b1:	8b 45 10             	mov    0x10(%ebp),%eax
+     5b4:	8d 50 ff             	lea    -0x1(%eax),%edx
+     5b7:	89 55 10             	mov    %edx,0x10(%ebp)
+     5ba:	85 c0                	test   %eax,%eax
+     5bc:	7f e0                	jg     59e <memmove+0x8e>
+  if(s < d && s + n > d){
+     5be:	eb 78                	jmp    638 <memmove+0x128>
+  } else {
+    if(n >= 16){
+     5c0:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     5c4:	7e 61                	jle    627 <memmove+0x117>
+      k = -(uint)d & 3;
+     5c6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     5c9:	f7 d8                	neg    %eax
+     5cb:	83 e0 03             	and    $0x3,%eax
+     5ce:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      movsb(d, s, k);
+     5d1:	ff 75 f4             	push   -0xc(%ebp)
+     5d4:	ff 75 f8             	push   -0x8(%ebp)
+     5d7:	ff 75 fc             	push   -0x4(%ebp)
+     5da:	e8 cd fa ff ff       	call   ac <movsb>
+     5df:	83 c4 0c             	add    $0xc,%esp
+      d += k;
+     5e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5e5:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += k;
+     5e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5eb:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n -= k;
+     5ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5f1:	29 45 10             	sub    %eax,0x10(%ebp)
+      movsl(d, s, n/4);
+     5f4:	8b 45 10             	mov    0x10(%ebp),%eax
+     5f7:	8d 50 03             	lea    0x3(%eax),%edx
+     5fa:	85 c0                	test   %eax,%eax
+     5fc:	0f 48 c2             	cmovs  %edx,%eax
+     5ff:	c1 f8 02             	sar    $0x2,%eax
+     602:	50                   	push   %eax
+     603:	ff 75 f8             	push   -0x8(%ebp)
+     606:	ff 75 fc             	push   -0x4(%ebp)
+     609:	e8 cd fa ff ff       	call   db <movsl>
+     60e:	83 c4 0c             	add    $0xc,%esp
+      d += n & ~3;
+     611:	8b 45 10             	mov    0x10(%ebp),%eax
+     614:	83 e0 fc             	and    $0xfffffffc,%eax
+     617:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += n & ~3;
+     61a:	8b 45 10             	mov    0x10(%ebp),%eax
+     61d:	83 e0 fc             	and    $0xfffffffc,%eax
+     620:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n &= 3;
+     623:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+    }
+    movsb(d, s, n);
+     627:	ff 75 10             	push   0x10(%ebp)
+     62a:	ff 75 f8             	push   -0x8(%ebp)
+     62d:	ff 75 fc             	push   -0x4(%ebp)
+     630:	e8 77 fa ff ff       	call   ac <movsb>
+     635:	83 c4 0c             	add    $0xc,%esp
+  }
+  return vdst;
+     638:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     63b:	c9                   	leave
+     63c:	c3                   	ret
+
+0000063d <_fork>:
+    movl %esp, %ecx; \
+    movl $1f, %edx; \
+    sysenter; \
+  1: ret
+
+RAWSYSCALL(fork)
+     63d:	b8 01 00 00 00       	mov    $0x1,%eax
+     642:	89 e1                	mov    %esp,%ecx
+     644:	ba 4b 06 00 00       	mov    $0x64b,%edx
+     649:	0f 34                	sysenter
+     64b:	c3                   	ret
+
+0000064c <_exit>:
+RAWSYSCALL(exit)
+     64c:	b8 02 00 00 00       	mov    $0x2,%eax
+     651:	89 e1                	mov    %esp,%ecx
+     653:	ba 5a 06 00 00       	mov    $0x65a,%edx
+     658:	0f 34                	sysenter
+     65a:	c3                   	ret
+
+0000065b <wait>:
+SYSCALL(wait)
+     65b:	b8 03 00 00 00       	mov    $0x3,%eax
+     660:	89 e1                	mov    %esp,%ecx
+     662:	ba 69 06 00 00       	mov    $0x669,%edx
+     667:	0f 34                	sysenter
+     669:	c3                   	ret
+
+0000066a <pipe>:
+SYSCALL(pipe)
+     66a:	b8 04 00 00 00       	mov    $0x4,%eax
+     66f:	89 e1                	mov    %esp,%ecx
+     671:	ba 78 06 00 00       	mov    $0x678,%edx
+     676:	0f 34                	sysenter
+     678:	c3                   	ret
+
+00000679 <read>:
+SYSCALL(read)
+     679:	b8 05 00 00 00       	mov    $0x5,%eax
+     67e:	89 e1                	mov    %esp,%ecx
+     680:	ba 87 06 00 00       	mov    $0x687,%edx
+     685:	0f 34                	sysenter
+     687:	c3                   	ret
+
+00000688 <write>:
+SYSCALL(write)
+     688:	b8 10 00 00 00       	mov    $0x10,%eax
+     68d:	89 e1                	mov    %esp,%ecx
+     68f:	ba 96 06 00 00       	mov    $0x696,%edx
+     694:	0f 34                	sysenter
+     696:	c3                   	ret
+
+00000697 <_close>:
+RAWSYSCALL(close)
+     697:	b8 15 00 00 00       	mov    $0x15,%eax
+     69c:	89 e1                	mov    %esp,%ecx
+     69e:	ba a5 06 00 00       	mov    $0x6a5,%edx
+     6a3:	0f 34                	sysenter
+     6a5:	c3                   	ret
+
+000006a6 <kill>:
+SYSCALL(kill)
+     6a6:	b8 06 00 00 00       	mov    $0x6,%eax
+     6ab:	89 e1                	mov    %esp,%ecx
+     6ad:	ba b4 06 00 00       	mov    $0x6b4,%edx
+     6b2:	0f 34                	sysenter
+     6b4:	c3                   	ret
+
+000006b5 <_exec>:
+RAWSYSCALL(exec)
+     6b5:	b8 07 00 00 00       	mov    $0x7,%eax
+     6ba:	89 e1                	mov    %esp,%ecx
+     6bc:	ba c3 06 00 00       	mov    $0x6c3,%edx
+     6c1:	0f 34                	sysenter
+     6c3:	c3                   	ret
+
+000006c4 <open>:
+SYSCALL(open)
+     6c4:	b8 0f 00 00 00       	mov    $0xf,%eax
+     6c9:	89 e1                	mov    %esp,%ecx
+     6cb:	ba d2 06 00 00       	mov    $0x6d2,%edx
+     6d0:	0f 34                	sysenter
+     6d2:	c3                   	ret
+
+000006d3 <mknod>:
+SYSCALL(mknod)
+     6d3:	b8 11 00 00 00       	mov    $0x11,%eax
+     6d8:	89 e1                	mov    %esp,%ecx
+     6da:	ba e1 06 00 00       	mov    $0x6e1,%edx
+     6df:	0f 34                	sysenter
+     6e1:	c3                   	ret
+
+000006e2 <unlink>:
+SYSCALL(unlink)
+     6e2:	b8 12 00 00 00       	mov    $0x12,%eax
+     6e7:	89 e1                	mov    %esp,%ecx
+     6e9:	ba f0 06 00 00       	mov    $0x6f0,%edx
+     6ee:	0f 34                	sysenter
+     6f0:	c3                   	ret
+
+000006f1 <fstat>:
+SYSCALL(fstat)
+     6f1:	b8 08 00 00 00       	mov    $0x8,%eax
+     6f6:	89 e1                	mov    %esp,%ecx
+     6f8:	ba ff 06 00 00       	mov    $0x6ff,%edx
+     6fd:	0f 34                	sysenter
+     6ff:	c3                   	ret
+
+00000700 <link>:
+SYSCALL(link)
+     700:	b8 13 00 00 00       	mov    $0x13,%eax
+     705:	89 e1                	mov    %esp,%ecx
+     707:	ba 0e 07 00 00       	mov    $0x70e,%edx
+     70c:	0f 34                	sysenter
+     70e:	c3                   	ret
+
+0000070f <mkdir>:
+SYSCALL(mkdir)
+     70f:	b8 14 00 00 00       	mov    $0x14,%eax
+     714:	89 e1                	mov    %esp,%ecx
+     716:	ba 1d 07 00 00       	mov    $0x71d,%edx
+     71b:	0f 34                	sysenter
+     71d:	c3                   	ret
+
+0000071e <chdir>:
+SYSCALL(chdir)
+     71e:	b8 09 00 00 00       	mov    $0x9,%eax
+     723:	89 e1                	mov    %esp,%ecx
+     725:	ba 2c 07 00 00       	mov    $0x72c,%edx
+     72a:	0f 34                	sysenter
+     72c:	c3                   	ret
+
+0000072d <dup>:
+SYSCALL(dup)
+     72d:	b8 0a 00 00 00       	mov    $0xa,%eax
+     732:	89 e1                	mov    %esp,%ecx
+     734:	ba 3b 07 00 00       	mov    $0x73b,%edx
+     739:	0f 34                	sysenter
+     73b:	c3                   	ret
+
+0000073c <getpid>:
+SYSCALL(getpid)
+     73c:	b8 0b 00 00 00       	mov    $0xb,%eax
+     741:	89 e1                	mov    %esp,%ecx
+     743:	ba 4a 07 00 00       	mov    $0x74a,%edx
+     748:	0f 34                	sysenter
+     74a:	c3                   	ret
+
+0000074b <sbrk>:
+SYSCALL(sbrk)
+     74b:	b8 0c 00 00 00       	mov    $0xc,%eax
+     750:	89 e1                	mov    %esp,%ecx
+     752:	ba 59 07 00 00       	mov    $0x759,%edx
+     757:	0f 34                	sysenter
+     759:	c3                   	ret
+
+0000075a <sleep>:
+SYSCALL(sleep)
+     75a:	b8 0d 00 00 00       	mov    $0xd,%eax
+     75f:	89 e1                	mov    %esp,%ecx
+     761:	ba 68 07 00 00       	mov    $0x768,%edx
+     766:	0f 34                	sysenter
+     768:	c3                   	ret
+
+00000769 <uptime>:
+SYSCALL(uptime)
+     769:	b8 0e 00 00 00       	mov    $0xe,%eax
+     76e:	89 e1                	mov    %esp,%ecx
+     770:	ba 77 07 00 00       	mov    $0x777,%edx
+     775:	0f 34                	sysenter
+     777:	c3                   	ret
+
+00000778 <getproc>:
+SYSCALL(getproc)
+     778:	b8 16 00 00 00       	mov    $0x16,%eax
+     77d:	89 e1                	mov    %esp,%ecx
+     77f:	ba 86 07 00 00       	mov    $0x786,%edx
+     784:	0f 34                	sysenter
+     786:	c3                   	ret
+
+00000787 <getpgs>:
+SYSCALL(getpgs)
+     787:	b8 17 00 00 00       	mov    $0x17,%eax
+     78c:	89 e1                	mov    %esp,%ecx
+     78e:	ba 95 07 00 00       	mov    $0x795,%edx
+     793:	0f 34                	sysenter
+     795:	c3                   	ret
+
+00000796 <loadproc>:
+SYSCALL(loadproc)
+     796:	b8 18 00 00 00       	mov    $0x18,%eax
+     79b:	89 e1                	mov    %esp,%ecx
+     79d:	ba a4 07 00 00       	mov    $0x7a4,%edx
+     7a2:	0f 34                	sysenter
+     7a4:	c3                   	ret
+
+000007a5 <iosubmit>:
+SYSCALL(iosubmit)
+     7a5:	b8 19 00 00 00       	mov    $0x19,%eax
+     7aa:	89 e1                	mov    %esp,%ecx
+     7ac:	ba b3 07 00 00       	mov    $0x7b3,%edx
+     7b1:	0f 34                	sysenter
+     7b3:	c3                   	ret
+
+000007b4 <sysstat>:
+SYSCALL(sysstat)
+     7b4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     7b9:	89 e1                	mov    %esp,%ecx
+     7bb:	ba c2 07 00 00       	mov    $0x7c2,%edx
+     7c0:	0f 34                	sysenter
+     7c2:	c3                   	ret
+
+000007c3 <splice>:
+SYSCALL(splice)
+     7c3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     7c8:	89 e1                	mov    %esp,%ecx
+     7ca:	ba d1 07 00 00       	mov    $0x7d1,%edx
+     7cf:	0f 34                	sysenter
+     7d1:	c3                   	ret
+
+000007d2 <fsync>:
+SYSCALL(fsync)
+     7d2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     7d7:	89 e1                	mov    %esp,%ecx
+     7d9:	ba e0 07 00 00       	mov    $0x7e0,%edx
+     7de:	0f 34                	sysenter
+     7e0:	c3                   	ret
+
+000007e1 <fdatasync>:
+SYSCALL(fdatasync)
+     7e1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     7e6:	89 e1                	mov    %esp,%ecx
+     7e8:	ba ef 07 00 00       	mov    $0x7ef,%edx
+     7ed:	0f 34                	sysenter
+     7ef:	c3                   	ret
+
+000007f0 <lseek>:
+SYSCALL(lseek)
+     7f0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     7f5:	89 e1                	mov    %esp,%ecx
+     7f7:	ba fe 07 00 00       	mov    $0x7fe,%edx
+     7fc:	0f 34                	sysenter
+     7fe:	c3                   	ret
+
+000007ff <dmesg>:
+SYSCALL(dmesg)
+     7ff:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     804:	89 e1                	mov    %esp,%ecx
+     806:	ba 0d 08 00 00       	mov    $0x80d,%edx
+     80b:	0f 34                	sysenter
+     80d:	c3                   	ret
+
+0000080e <lockstat>:
+SYSCALL(lockstat)
+     80e:	b8 20 00 00 00       	mov    $0x20,%eax
+     813:	89 e1                	mov    %esp,%ecx
+     815:	ba 1c 08 00 00       	mov    $0x81c,%edx
+     81a:	0f 34                	sysenter
+     81c:	c3                   	ret
+
+0000081d <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     81d:	55                   	push   %ebp
+     81e:	89 e5                	mov    %esp,%ebp
+     820:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     823:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     82a:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     82e:	74 17                	je     847 <printint+0x2a>
+     830:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     834:	79 11                	jns    847 <printint+0x2a>
+    neg = 1;
+     836:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     83d:	8b 45 0c             	mov    0xc(%ebp),%eax
+     840:	f7 d8                	neg    %eax
+     842:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     845:	eb 06                	jmp    84d <printint+0x30>
+  } else {
+    x = xx;
+     847:	8b 45 0c             	mov    0xc(%ebp),%eax
+     84a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     84d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     854:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     857:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     85a:	ba 00 00 00 00       	mov    $0x0,%edx
+     85f:	f7 f1                	div    %ecx
+     861:	89 d1                	mov    %edx,%ecx
+     863:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     866:	8d 50 01             	lea    0x1(%eax),%edx
+     869:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     86c:	0f b6 91 98 18 00 00 	movzbl 0x1898(%ecx),%edx
+     873:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     877:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     87a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     87d:	ba 00 00 00 00       	mov    $0x0,%edx
+     882:	f7 f1                	div    %ecx
+     884:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     887:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     88b:	75 c7                	jne    854 <printint+0x37>
+  if(neg)
+     88d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     891:	74 2d                	je     8c0 <printint+0xa3>
+    buf[i++] = '-';
+     893:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     896:	8d 50 01             	lea    0x1(%eax),%edx
+     899:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     89c:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+     8a1:	eb 1d                	jmp    8c0 <printint+0xa3>
+    fputc(fd, buf[i]);
+     8a3:	8d 55 dc             	lea    -0x24(%ebp),%edx
+     8a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8a9:	01 d0                	add    %edx,%eax
+     8ab:	0f b6 00             	movzbl (%eax),%eax
+     8ae:	0f be c0             	movsbl %al,%eax
+     8b1:	83 ec 08             	sub    $0x8,%esp
+     8b4:	50                   	push   %eax
+     8b5:	ff 75 08             	push   0x8(%ebp)
+     8b8:	e8 f8 08 00 00       	call   11b5 <fputc>
+     8bd:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+     8c0:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     8c4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     8c8:	79 d9                	jns    8a3 <printint+0x86>
+}
+     8ca:	90                   	nop
+     8cb:	90                   	nop
+     8cc:	c9                   	leave
+     8cd:	c3                   	ret
+
+000008ce <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     8ce:	55                   	push   %ebp
+     8cf:	89 e5                	mov    %esp,%ebp
+     8d1:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+     8d4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     8db:	8d 45 0c             	lea    0xc(%ebp),%eax
+     8de:	83 c0 04             	add    $0x4,%eax
+     8e1:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+     8e4:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     8eb:	e9 4a 01 00 00       	jmp    a3a <printf+0x16c>
+    c = fmt[i] & 0xff;
+     8f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+     8f3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     8f6:	01 d0                	add    %edx,%eax
+     8f8:	0f b6 00             	movzbl (%eax),%eax
+     8fb:	0f be c0             	movsbl %al,%eax
+     8fe:	25 ff 00 00 00       	and    $0xff,%eax
+     903:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+     906:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     90a:	75 28                	jne    934 <printf+0x66>
+      if(c == '%'){
+     90c:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     910:	75 0c                	jne    91e <printf+0x50>
+        state = '%';
+     912:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+     919:	e9 18 01 00 00       	jmp    a36 <printf+0x168>
+      } else {
+        fputc(fd, c);
+     91e:	83 ec 08             	sub    $0x8,%esp
+     921:	ff 75 e4             	push   -0x1c(%ebp)
+     924:	ff 75 08             	push   0x8(%ebp)
+     927:	e8 89 08 00 00       	call   11b5 <fputc>
+     92c:	83 c4 10             	add    $0x10,%esp
+     92f:	e9 02 01 00 00       	jmp    a36 <printf+0x168>
+      }
+    } else if(state == '%'){
+     934:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+     938:	0f 85 f8 00 00 00    	jne    a36 <printf+0x168>
+      if(c == 'd'){
+     93e:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+     942:	75 1e                	jne    962 <printf+0x94>
+        printint(fd, *ap, 10, 1);
+     944:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     947:	8b 00                	mov    (%eax),%eax
+     949:	6a 01                	push   $0x1
+     94b:	6a 0a                	push   $0xa
+     94d:	50                   	push   %eax
+     94e:	ff 75 08             	push   0x8(%ebp)
+     951:	e8 c7 fe ff ff       	call   81d <printint>
+     956:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     959:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     95d:	e9 cd 00 00 00       	jmp    a2f <printf+0x161>
+      } else if(c == 'x' || c == 'p'){
+     962:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+     966:	74 06                	je     96e <printf+0xa0>
+     968:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+     96c:	75 1e                	jne    98c <printf+0xbe>
+        printint(fd, *ap, 16, 0);
+     96e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     971:	8b 00                	mov    (%eax),%eax
+     973:	6a 00                	push   $0x0
+     975:	6a 10                	push   $0x10
+     977:	50                   	push   %eax
+     978:	ff 75 08             	push   0x8(%ebp)
+     97b:	e8 9d fe ff ff       	call   81d <printint>
+     980:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     983:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     987:	e9 a3 00 00 00       	jmp    a2f <printf+0x161>
+      } else if(c == 's'){
+     98c:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+     990:	75 43                	jne    9d5 <printf+0x107>
+        s = (char*)*ap;
+     992:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     995:	8b 00                	mov    (%eax),%eax
+     997:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     99a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+     99e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     9a2:	75 25                	jne    9c9 <printf+0xfb>
+          s = "(null)";
+     9a4:	c7 45 f4 f1 13 00 00 	movl   $0x13f1,-0xc(%ebp)
+        while(*s != 0){
+     9ab:	eb 1c                	jmp    9c9 <printf+0xfb>
+          fputc(fd, *s);
+     9ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9b0:	0f b6 00             	movzbl (%eax),%eax
+     9b3:	0f be c0             	movsbl %al,%eax
+     9b6:	83 ec 08             	sub    $0x8,%esp
+     9b9:	50                   	push   %eax
+     9ba:	ff 75 08             	push   0x8(%ebp)
+     9bd:	e8 f3 07 00 00       	call   11b5 <fputc>
+     9c2:	83 c4 10             	add    $0x10,%esp
+          s++;
+     9c5:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+     9c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9cc:	0f b6 00             	movzbl (%eax),%eax
+     9cf:	84 c0                	test   %al,%al
+     9d1:	75 da                	jne    9ad <printf+0xdf>
+     9d3:	eb 5a                	jmp    a2f <printf+0x161>
+        }
+      } else if(c == 'c'){
+     9d5:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+     9d9:	75 1a                	jne    9f5 <printf+0x127>
+        fputc(fd, *ap);
+     9db:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     9de:	8b 00                	mov    (%eax),%eax
+     9e0:	83 ec 08             	sub    $0x8,%esp
+     9e3:	50                   	push   %eax
+     9e4:	ff 75 08             	push   0x8(%ebp)
+     9e7:	e8 c9 07 00 00       	call   11b5 <fputc>
+     9ec:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     9ef:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     9f3:	eb 3a                	jmp    a2f <printf+0x161>
+      } else if(c == '%'){
+     9f5:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     9f9:	75 13                	jne    a0e <printf+0x140>
+        fputc(fd, c);
+     9fb:	83 ec 08             	sub    $0x8,%esp
+     9fe:	ff 75 e4             	push   -0x1c(%ebp)
+     a01:	ff 75 08             	push   0x8(%ebp)
+     a04:	e8 ac 07 00 00       	call   11b5 <fputc>
+     a09:	83 c4 10             	add    $0x10,%esp
+     a0c:	eb 21                	jmp    a2f <printf+0x161>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        fputc(fd, '%');
+     a0e:	83 ec 08             	sub    $0x8,%esp
+     a11:	6a 25                	push   $0x25
+     a13:	ff 75 08             	push   0x8(%ebp)
+     a16:	e8 9a 07 00 00       	call   11b5 <fputc>
+     a1b:	83 c4 10             	add    $0x10,%esp
+        fputc(fd, c);
+     a1e:	83 ec 08             	sub    $0x8,%esp
+     a21:	ff 75 e4             	push   -0x1c(%ebp)
+     a24:	ff 75 08             	push   0x8(%ebp)
+     a27:	e8 89 07 00 00       	call   11b5 <fputc>
+     a2c:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     a2f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     a36:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     a3a:	8b 55 0c             	mov    0xc(%ebp),%edx
+     a3d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a40:	01 d0                	add    %edx,%eax
+     a42:	0f b6 00             	movzbl (%eax),%eax
+     a45:	84 c0                	test   %al,%al
+     a47:	0f 85 a3 fe ff ff    	jne    8f0 <printf+0x22>
+    }
+  }
+}
+     a4d:	90                   	nop
+     a4e:	90                   	nop
+     a4f:	c9                   	leave
+     a50:	c3                   	ret
+
+00000a51 <binof>:
+static struct chunk *bins[NBIN];       // free large chunks
+static struct chunk *top;              // end marker of newest heap segment
+
+static int
+binof(uint size)
+{
+     a51:	55                   	push   %ebp
+     a52:	89 e5                	mov    %esp,%ebp
+     a54:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  i = 0;
+     a57:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     a5e:	c1 6d 08 05          	shrl   $0x5,0x8(%ebp)
+     a62:	eb 07                	jmp    a6b <binof+0x1a>
+    i++;
+     a64:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     a68:	d1 6d 08             	shrl   0x8(%ebp)
+     a6b:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     a6f:	74 06                	je     a77 <binof+0x26>
+     a71:	83 7d fc 19          	cmpl   $0x19,-0x4(%ebp)
+     a75:	7e ed                	jle    a64 <binof+0x13>
+  return i;
+     a77:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     a7a:	c9                   	leave
+     a7b:	c3                   	ret
+
+00000a7c <bininsert>:
+
+static void
+bininsert(struct chunk *c)
+{
+     a7c:	55                   	push   %ebp
+     a7d:	89 e5                	mov    %esp,%ebp
+     a7f:	83 ec 10             	sub    $0x10,%esp
+  struct chunk **b;
+
+  b = &bins[binof(CSIZE(c))];
+     a82:	8b 45 08             	mov    0x8(%ebp),%eax
+     a85:	8b 00                	mov    (%eax),%eax
+     a87:	83 e0 f8             	and    $0xfffffff8,%eax
+     a8a:	50                   	push   %eax
+     a8b:	e8 c1 ff ff ff       	call   a51 <binof>
+     a90:	83 c4 04             	add    $0x4,%esp
+     a93:	c1 e0 02             	shl    $0x2,%eax
+     a96:	05 e0 98 00 00       	add    $0x98e0,%eax
+     a9b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c->prev = 0;
+     a9e:	8b 45 08             	mov    0x8(%ebp),%eax
+     aa1:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  c->next = *b;
+     aa8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     aab:	8b 10                	mov    (%eax),%edx
+     aad:	8b 45 08             	mov    0x8(%ebp),%eax
+     ab0:	89 50 08             	mov    %edx,0x8(%eax)
+  if(*b)
+     ab3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ab6:	8b 00                	mov    (%eax),%eax
+     ab8:	85 c0                	test   %eax,%eax
+     aba:	74 0b                	je     ac7 <bininsert+0x4b>
+    (*b)->prev = c;
+     abc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     abf:	8b 00                	mov    (%eax),%eax
+     ac1:	8b 55 08             	mov    0x8(%ebp),%edx
+     ac4:	89 50 0c             	mov    %edx,0xc(%eax)
+  *b = c;
+     ac7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     aca:	8b 55 08             	mov    0x8(%ebp),%edx
+     acd:	89 10                	mov    %edx,(%eax)
+}
+     acf:	90                   	nop
+     ad0:	c9                   	leave
+     ad1:	c3                   	ret
+
+00000ad2 <binremove>:
+
+static void
+binremove(struct chunk *c)
+{
+     ad2:	55                   	push   %ebp
+     ad3:	89 e5                	mov    %esp,%ebp
+  if(c->prev)
+     ad5:	8b 45 08             	mov    0x8(%ebp),%eax
+     ad8:	8b 40 0c             	mov    0xc(%eax),%eax
+     adb:	85 c0                	test   %eax,%eax
+     add:	74 11                	je     af0 <binremove+0x1e>
+    c->prev->next = c->next;
+     adf:	8b 45 08             	mov    0x8(%ebp),%eax
+     ae2:	8b 40 0c             	mov    0xc(%eax),%eax
+     ae5:	8b 55 08             	mov    0x8(%ebp),%edx
+     ae8:	8b 52 08             	mov    0x8(%edx),%edx
+     aeb:	89 50 08             	mov    %edx,0x8(%eax)
+     aee:	eb 1e                	jmp    b0e <binremove+0x3c>
+  else
+    bins[binof(CSIZE(c))] = c->next;
+     af0:	8b 45 08             	mov    0x8(%ebp),%eax
+     af3:	8b 00                	mov    (%eax),%eax
+     af5:	83 e0 f8             	and    $0xfffffff8,%eax
+     af8:	50                   	push   %eax
+     af9:	e8 53 ff ff ff       	call   a51 <binof>
+     afe:	83 c4 04             	add    $0x4,%esp
+     b01:	8b 55 08             	mov    0x8(%ebp),%edx
+     b04:	8b 52 08             	mov    0x8(%edx),%edx
+     b07:	89 14 85 e0 98 00 00 	mov    %edx,0x98e0(,%eax,4)
+  if(c->next)
+     b0e:	8b 45 08             	mov    0x8(%ebp),%eax
+     b11:	8b 40 08             	mov    0x8(%eax),%eax
+     b14:	85 c0                	test   %eax,%eax
+     b16:	74 0f                	je     b27 <binremove+0x55>
+    c->next->prev = c->prev;
+     b18:	8b 45 08             	mov    0x8(%ebp),%eax
+     b1b:	8b 40 08             	mov    0x8(%eax),%eax
+     b1e:	8b 55 08             	mov    0x8(%ebp),%edx
+     b21:	8b 52 0c             	mov    0xc(%edx),%edx
+     b24:	89 50 0c             	mov    %edx,0xc(%eax)
+}
+     b27:	90                   	nop
+     b28:	c9                   	leave
+     b29:	c3                   	ret
+
+00000b2a <freechunk>:
+
+// Free chunk c, merging it with free neighbors.  If trim is
+// set and the result is big and at the break, give it back.
+static void
+freechunk(struct chunk *c, int trim)
+{
+     b2a:	55                   	push   %ebp
+     b2b:	89 e5                	mov    %esp,%ebp
+     b2d:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *p, *n;
+  uint size;
+
+  size = CSIZE(c);
+     b30:	8b 45 08             	mov    0x8(%ebp),%eax
+     b33:	8b 00                	mov    (%eax),%eax
+     b35:	83 e0 f8             	and    $0xfffffff8,%eax
+     b38:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  n = NEXTC(c);
+     b3b:	8b 45 08             	mov    0x8(%ebp),%eax
+     b3e:	8b 00                	mov    (%eax),%eax
+     b40:	83 e0 f8             	and    $0xfffffff8,%eax
+     b43:	89 c2                	mov    %eax,%edx
+     b45:	8b 45 08             	mov    0x8(%ebp),%eax
+     b48:	01 d0                	add    %edx,%eax
+     b4a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(!(c->size & PREVUSED)){
+     b4d:	8b 45 08             	mov    0x8(%ebp),%eax
+     b50:	8b 00                	mov    (%eax),%eax
+     b52:	83 e0 02             	and    $0x2,%eax
+     b55:	85 c0                	test   %eax,%eax
+     b57:	75 30                	jne    b89 <freechunk+0x5f>
+    p = (struct chunk*)((char*)c - *((uint*)c - 1));
+     b59:	8b 45 08             	mov    0x8(%ebp),%eax
+     b5c:	83 e8 04             	sub    $0x4,%eax
+     b5f:	8b 00                	mov    (%eax),%eax
+     b61:	f7 d8                	neg    %eax
+     b63:	89 c2                	mov    %eax,%edx
+     b65:	8b 45 08             	mov    0x8(%ebp),%eax
+     b68:	01 d0                	add    %edx,%eax
+     b6a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    binremove(p);
+     b6d:	ff 75 ec             	push   -0x14(%ebp)
+     b70:	e8 5d ff ff ff       	call   ad2 <binremove>
+     b75:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(p);
+     b78:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b7b:	8b 00                	mov    (%eax),%eax
+     b7d:	83 e0 f8             	and    $0xfffffff8,%eax
+     b80:	01 45 f4             	add    %eax,-0xc(%ebp)
+    c = p;
+     b83:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b86:	89 45 08             	mov    %eax,0x8(%ebp)
+  }
+  if(!(n->size & USED)){
+     b89:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b8c:	8b 00                	mov    (%eax),%eax
+     b8e:	83 e0 01             	and    $0x1,%eax
+     b91:	85 c0                	test   %eax,%eax
+     b93:	75 16                	jne    bab <freechunk+0x81>
+    binremove(n);
+     b95:	ff 75 f0             	push   -0x10(%ebp)
+     b98:	e8 35 ff ff ff       	call   ad2 <binremove>
+     b9d:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(n);
+     ba0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ba3:	8b 00                	mov    (%eax),%eax
+     ba5:	83 e0 f8             	and    $0xfffffff8,%eax
+     ba8:	01 45 f4             	add    %eax,-0xc(%ebp)
+  }
+  // Free chunks are never adjacent, so the one below is in use.
+  c->size = size | PREVUSED;
+     bab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     bae:	83 c8 02             	or     $0x2,%eax
+     bb1:	89 c2                	mov    %eax,%edx
+     bb3:	8b 45 08             	mov    0x8(%ebp),%eax
+     bb6:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+     bb8:	8b 45 08             	mov    0x8(%ebp),%eax
+     bbb:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  FOOTER(c) = size;
+     bc2:	8b 45 08             	mov    0x8(%ebp),%eax
+     bc5:	8b 00                	mov    (%eax),%eax
+     bc7:	83 e0 f8             	and    $0xfffffff8,%eax
+     bca:	8d 50 fc             	lea    -0x4(%eax),%edx
+     bcd:	8b 45 08             	mov    0x8(%ebp),%eax
+     bd0:	01 c2                	add    %eax,%edx
+     bd2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     bd5:	89 02                	mov    %eax,(%edx)
+  n = NEXTC(c);
+     bd7:	8b 45 08             	mov    0x8(%ebp),%eax
+     bda:	8b 00                	mov    (%eax),%eax
+     bdc:	83 e0 f8             	and    $0xfffffff8,%eax
+     bdf:	89 c2                	mov    %eax,%edx
+     be1:	8b 45 08             	mov    0x8(%ebp),%eax
+     be4:	01 d0                	add    %edx,%eax
+     be6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  n->size &= ~PREVUSED;
+     be9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bec:	8b 00                	mov    (%eax),%eax
+     bee:	83 e0 fd             	and    $0xfffffffd,%eax
+     bf1:	89 c2                	mov    %eax,%edx
+     bf3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bf6:	89 10                	mov    %edx,(%eax)
+
+  if(trim && n == top && size >= TRIMSIZE && sbrk(0) == (char*)top + HDRSIZE){
+     bf8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     bfc:	74 51                	je     c4f <freechunk+0x125>
+     bfe:	a1 4c 99 00 00       	mov    0x994c,%eax
+     c03:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     c06:	75 47                	jne    c4f <freechunk+0x125>
+     c08:	81 7d f4 ff 7f 00 00 	cmpl   $0x7fff,-0xc(%ebp)
+     c0f:	76 3e                	jbe    c4f <freechunk+0x125>
+     c11:	83 ec 0c             	sub    $0xc,%esp
+     c14:	6a 00                	push   $0x0
+     c16:	e8 30 fb ff ff       	call   74b <sbrk>
+     c1b:	83 c4 10             	add    $0x10,%esp
+     c1e:	8b 15 4c 99 00 00    	mov    0x994c,%edx
+     c24:	83 c2 08             	add    $0x8,%edx
+     c27:	39 d0                	cmp    %edx,%eax
+     c29:	75 24                	jne    c4f <freechunk+0x125>
+    c->size = USED | PREVUSED;
+     c2b:	8b 45 08             	mov    0x8(%ebp),%eax
+     c2e:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+    top = c;
+     c34:	8b 45 08             	mov    0x8(%ebp),%eax
+     c37:	a3 4c 99 00 00       	mov    %eax,0x994c
+    sbrk(-size);
+     c3c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c3f:	f7 d8                	neg    %eax
+     c41:	83 ec 0c             	sub    $0xc,%esp
+     c44:	50                   	push   %eax
+     c45:	e8 01 fb ff ff       	call   74b <sbrk>
+     c4a:	83 c4 10             	add    $0x10,%esp
+    return;
+     c4d:	eb 0e                	jmp    c5d <freechunk+0x133>
+  }
+  bininsert(c);
+     c4f:	83 ec 0c             	sub    $0xc,%esp
+     c52:	ff 75 08             	push   0x8(%ebp)
+     c55:	e8 22 fe ff ff       	call   a7c <bininsert>
+     c5a:	83 c4 10             	add    $0x10,%esp
+}
+     c5d:	c9                   	leave
+     c5e:	c3                   	ret
+
+00000c5f <morecore>:
+
+// Grow the heap by at least need bytes.
+static int
+morecore(uint need)
+{
+     c5f:	55                   	push   %ebp
+     c60:	89 e5                	mov    %esp,%ebp
+     c62:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+  char *p;
+  uint n, pad;
+
+  n = need + MINCHUNK;
+     c65:	8b 45 08             	mov    0x8(%ebp),%eax
+     c68:	83 c0 18             	add    $0x18,%eax
+     c6b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(n < MINCORE)
+     c6e:	81 7d ec ff 3f 00 00 	cmpl   $0x3fff,-0x14(%ebp)
+     c75:	77 07                	ja     c7e <morecore+0x1f>
+    n = MINCORE;
+     c77:	c7 45 ec 00 40 00 00 	movl   $0x4000,-0x14(%ebp)
+  // Keep the break 8-aligned, with the end marker just below it.
+  pad = (8 - ((uint)sbrk(0) & 7)) & 7;
+     c7e:	83 ec 0c             	sub    $0xc,%esp
+     c81:	6a 00                	push   $0x0
+     c83:	e8 c3 fa ff ff       	call   74b <sbrk>
+     c88:	83 c4 10             	add    $0x10,%esp
+     c8b:	83 e0 07             	and    $0x7,%eax
+     c8e:	ba 08 00 00 00       	mov    $0x8,%edx
+     c93:	29 c2                	sub    %eax,%edx
+     c95:	89 d0                	mov    %edx,%eax
+     c97:	83 e0 07             	and    $0x7,%eax
+     c9a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if((p = sbrk(pad + n)) == (char*)-1){
+     c9d:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     ca0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     ca3:	01 d0                	add    %edx,%eax
+     ca5:	83 ec 0c             	sub    $0xc,%esp
+     ca8:	50                   	push   %eax
+     ca9:	e8 9d fa ff ff       	call   74b <sbrk>
+     cae:	83 c4 10             	add    $0x10,%esp
+     cb1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     cb4:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     cb8:	75 30                	jne    cea <morecore+0x8b>
+    n = need + MINCHUNK;
+     cba:	8b 45 08             	mov    0x8(%ebp),%eax
+     cbd:	83 c0 18             	add    $0x18,%eax
+     cc0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((p = sbrk(pad + n)) == (char*)-1)
+     cc3:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     cc6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     cc9:	01 d0                	add    %edx,%eax
+     ccb:	83 ec 0c             	sub    $0xc,%esp
+     cce:	50                   	push   %eax
+     ccf:	e8 77 fa ff ff       	call   74b <sbrk>
+     cd4:	83 c4 10             	add    $0x10,%esp
+     cd7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     cda:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     cde:	75 0a                	jne    cea <morecore+0x8b>
+      return -1;
+     ce0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     ce5:	e9 8e 00 00 00       	jmp    d78 <morecore+0x119>
+  }
+  p += pad;
+     cea:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     ced:	01 45 f0             	add    %eax,-0x10(%ebp)
+  if(top && p == (char*)top + HDRSIZE){
+     cf0:	a1 4c 99 00 00       	mov    0x994c,%eax
+     cf5:	85 c0                	test   %eax,%eax
+     cf7:	74 29                	je     d22 <morecore+0xc3>
+     cf9:	a1 4c 99 00 00       	mov    0x994c,%eax
+     cfe:	83 c0 08             	add    $0x8,%eax
+     d01:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     d04:	75 1c                	jne    d22 <morecore+0xc3>
+    // Contiguous: the old end marker heads the new chunk.
+    c = top;
+     d06:	a1 4c 99 00 00       	mov    0x994c,%eax
+     d0b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = n | (c->size & PREVUSED);
+     d0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d11:	8b 00                	mov    (%eax),%eax
+     d13:	83 e0 02             	and    $0x2,%eax
+     d16:	0b 45 ec             	or     -0x14(%ebp),%eax
+     d19:	89 c2                	mov    %eax,%edx
+     d1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d1e:	89 10                	mov    %edx,(%eax)
+     d20:	eb 16                	jmp    d38 <morecore+0xd9>
+  } else {
+    // Someone else moved the break: start a new segment.
+    c = (struct chunk*)p;
+     d22:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d25:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = (n - HDRSIZE) | PREVUSED;
+     d28:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     d2b:	83 e8 08             	sub    $0x8,%eax
+     d2e:	83 c8 02             	or     $0x2,%eax
+     d31:	89 c2                	mov    %eax,%edx
+     d33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d36:	89 10                	mov    %edx,(%eax)
+  }
+  top = NEXTC(c);
+     d38:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d3b:	8b 00                	mov    (%eax),%eax
+     d3d:	83 e0 f8             	and    $0xfffffff8,%eax
+     d40:	89 c2                	mov    %eax,%edx
+     d42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d45:	01 d0                	add    %edx,%eax
+     d47:	a3 4c 99 00 00       	mov    %eax,0x994c
+  top->size = USED;
+     d4c:	a1 4c 99 00 00       	mov    0x994c,%eax
+     d51:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  top->tag = LARGE;
+     d57:	a1 4c 99 00 00       	mov    0x994c,%eax
+     d5c:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  freechunk(c, 0);
+     d63:	83 ec 08             	sub    $0x8,%esp
+     d66:	6a 00                	push   $0x0
+     d68:	ff 75 f4             	push   -0xc(%ebp)
+     d6b:	e8 ba fd ff ff       	call   b2a <freechunk>
+     d70:	83 c4 10             	add    $0x10,%esp
+  return 0;
+     d73:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     d78:	c9                   	leave
+     d79:	c3                   	ret
+
+00000d7a <largealloc>:
+
+static void*
+largealloc(uint nbytes)
+{
+     d7a:	55                   	push   %ebp
+     d7b:	89 e5                	mov    %esp,%ebp
+     d7d:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c, *r;
+  uint need;
+  int i;
+
+  if(nbytes > 0x7fffffff)
+     d80:	8b 45 08             	mov    0x8(%ebp),%eax
+     d83:	85 c0                	test   %eax,%eax
+     d85:	79 0a                	jns    d91 <largealloc+0x17>
+    return 0;
+     d87:	b8 00 00 00 00       	mov    $0x0,%eax
+     d8c:	e9 43 01 00 00       	jmp    ed4 <largealloc+0x15a>
+  need = (nbytes + HDRSIZE + 7) & ~7;
+     d91:	8b 45 08             	mov    0x8(%ebp),%eax
+     d94:	83 c0 0f             	add    $0xf,%eax
+     d97:	83 e0 f8             	and    $0xfffffff8,%eax
+     d9a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(need < MINCHUNK)
+     d9d:	83 7d f0 17          	cmpl   $0x17,-0x10(%ebp)
+     da1:	77 07                	ja     daa <largealloc+0x30>
+    need = MINCHUNK;
+     da3:	c7 45 f0 18 00 00 00 	movl   $0x18,-0x10(%ebp)
+  for(;;){
+    for(i = binof(need); i < NBIN; i++)
+     daa:	ff 75 f0             	push   -0x10(%ebp)
+     dad:	e8 9f fc ff ff       	call   a51 <binof>
+     db2:	83 c4 04             	add    $0x4,%esp
+     db5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     db8:	eb 2f                	jmp    de9 <largealloc+0x6f>
+      for(c = bins[i]; c; c = c->next)
+     dba:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     dbd:	8b 04 85 e0 98 00 00 	mov    0x98e0(,%eax,4),%eax
+     dc4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     dc7:	eb 16                	jmp    ddf <largealloc+0x65>
+        if(CSIZE(c) >= need)
+     dc9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     dcc:	8b 00                	mov    (%eax),%eax
+     dce:	83 e0 f8             	and    $0xfffffff8,%eax
+     dd1:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     dd4:	73 35                	jae    e0b <largealloc+0x91>
+      for(c = bins[i]; c; c = c->next)
+     dd6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     dd9:	8b 40 08             	mov    0x8(%eax),%eax
+     ddc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     ddf:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     de3:	75 e4                	jne    dc9 <largealloc+0x4f>
+    for(i = binof(need); i < NBIN; i++)
+     de5:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     de9:	83 7d ec 1a          	cmpl   $0x1a,-0x14(%ebp)
+     ded:	7e cb                	jle    dba <largealloc+0x40>
+          goto found;
+    if(morecore(need) < 0)
+     def:	83 ec 0c             	sub    $0xc,%esp
+     df2:	ff 75 f0             	push   -0x10(%ebp)
+     df5:	e8 65 fe ff ff       	call   c5f <morecore>
+     dfa:	83 c4 10             	add    $0x10,%esp
+     dfd:	85 c0                	test   %eax,%eax
+     dff:	79 a9                	jns    daa <largealloc+0x30>
+      return 0;
+     e01:	b8 00 00 00 00       	mov    $0x0,%eax
+     e06:	e9 c9 00 00 00       	jmp    ed4 <largealloc+0x15a>
+          goto found;
+     e0b:	90                   	nop
+  }
+
+found:
+  binremove(c);
+     e0c:	83 ec 0c             	sub    $0xc,%esp
+     e0f:	ff 75 f4             	push   -0xc(%ebp)
+     e12:	e8 bb fc ff ff       	call   ad2 <binremove>
+     e17:	83 c4 10             	add    $0x10,%esp
+  if(CSIZE(c) - need >= MINCHUNK){
+     e1a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e1d:	8b 00                	mov    (%eax),%eax
+     e1f:	83 e0 f8             	and    $0xfffffff8,%eax
+     e22:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     e25:	83 f8 17             	cmp    $0x17,%eax
+     e28:	76 66                	jbe    e90 <largealloc+0x116>
+    r = (struct chunk*)((char*)c + need);
+     e2a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     e2d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e30:	01 d0                	add    %edx,%eax
+     e32:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    r->size = (CSIZE(c) - need) | PREVUSED;
+     e35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e38:	8b 00                	mov    (%eax),%eax
+     e3a:	83 e0 f8             	and    $0xfffffff8,%eax
+     e3d:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     e40:	83 c8 02             	or     $0x2,%eax
+     e43:	89 c2                	mov    %eax,%edx
+     e45:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e48:	89 10                	mov    %edx,(%eax)
+    r->tag = LARGE;
+     e4a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e4d:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+    FOOTER(r) = CSIZE(r);
+     e54:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e57:	8b 10                	mov    (%eax),%edx
+     e59:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e5c:	8b 00                	mov    (%eax),%eax
+     e5e:	83 e0 f8             	and    $0xfffffff8,%eax
+     e61:	8d 48 fc             	lea    -0x4(%eax),%ecx
+     e64:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e67:	01 c8                	add    %ecx,%eax
+     e69:	83 e2 f8             	and    $0xfffffff8,%edx
+     e6c:	89 10                	mov    %edx,(%eax)
+    bininsert(r);
+     e6e:	83 ec 0c             	sub    $0xc,%esp
+     e71:	ff 75 e8             	push   -0x18(%ebp)
+     e74:	e8 03 fc ff ff       	call   a7c <bininsert>
+     e79:	83 c4 10             	add    $0x10,%esp
+    c->size = need | (c->size & PREVUSED);
+     e7c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e7f:	8b 00                	mov    (%eax),%eax
+     e81:	83 e0 02             	and    $0x2,%eax
+     e84:	0b 45 f0             	or     -0x10(%ebp),%eax
+     e87:	89 c2                	mov    %eax,%edx
+     e89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e8c:	89 10                	mov    %edx,(%eax)
+     e8e:	eb 25                	jmp    eb5 <largealloc+0x13b>
+  } else
+    NEXTC(c)->size |= PREVUSED;
+     e90:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e93:	8b 00                	mov    (%eax),%eax
+     e95:	83 e0 f8             	and    $0xfffffff8,%eax
+     e98:	89 c2                	mov    %eax,%edx
+     e9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e9d:	01 d0                	add    %edx,%eax
+     e9f:	8b 10                	mov    (%eax),%edx
+     ea1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ea4:	8b 00                	mov    (%eax),%eax
+     ea6:	83 e0 f8             	and    $0xfffffff8,%eax
+     ea9:	89 c1                	mov    %eax,%ecx
+     eab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eae:	01 c8                	add    %ecx,%eax
+     eb0:	83 ca 02             	or     $0x2,%edx
+     eb3:	89 10                	mov    %edx,(%eax)
+  c->size |= USED;
+     eb5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eb8:	8b 00                	mov    (%eax),%eax
+     eba:	83 c8 01             	or     $0x1,%eax
+     ebd:	89 c2                	mov    %eax,%edx
+     ebf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ec2:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+     ec4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ec7:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  return (char*)c + HDRSIZE;
+     ece:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ed1:	83 c0 08             	add    $0x8,%eax
+}
+     ed4:	c9                   	leave
+     ed5:	c3                   	ret
+
+00000ed6 <refill>:
+
+// Carve a slab into free blocks of class k.
+static int
+refill(int k)
+{
+     ed6:	55                   	push   %ebp
+     ed7:	89 e5                	mov    %esp,%ebp
+     ed9:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  char *p;
+  uint bs, i;
+
+  if((p = largealloc(SLABSIZE)) == 0)
+     edc:	83 ec 0c             	sub    $0xc,%esp
+     edf:	68 00 20 00 00       	push   $0x2000
+     ee4:	e8 91 fe ff ff       	call   d7a <largealloc>
+     ee9:	83 c4 10             	add    $0x10,%esp
+     eec:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     eef:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     ef3:	75 07                	jne    efc <refill+0x26>
+    return -1;
+     ef5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     efa:	eb 75                	jmp    f71 <refill+0x9b>
+  bs = HDRSIZE + (MINSMALL << k);
+     efc:	8b 45 08             	mov    0x8(%ebp),%eax
+     eff:	ba 10 00 00 00       	mov    $0x10,%edx
+     f04:	89 c1                	mov    %eax,%ecx
+     f06:	d3 e2                	shl    %cl,%edx
+     f08:	89 d0                	mov    %edx,%eax
+     f0a:	83 c0 08             	add    $0x8,%eax
+     f0d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+     f10:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     f17:	eb 44                	jmp    f5d <refill+0x87>
+    b = (struct chunk*)(p + i);
+     f19:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     f1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f1f:	01 d0                	add    %edx,%eax
+     f21:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    b->size = bs | USED;
+     f24:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f27:	83 c8 01             	or     $0x1,%eax
+     f2a:	89 c2                	mov    %eax,%edx
+     f2c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f2f:	89 10                	mov    %edx,(%eax)
+    b->tag = k;
+     f31:	8b 55 08             	mov    0x8(%ebp),%edx
+     f34:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f37:	89 50 04             	mov    %edx,0x4(%eax)
+    b->next = classes[k];
+     f3a:	8b 45 08             	mov    0x8(%ebp),%eax
+     f3d:	8b 14 85 c0 98 00 00 	mov    0x98c0(,%eax,4),%edx
+     f44:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f47:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[k] = b;
+     f4a:	8b 45 08             	mov    0x8(%ebp),%eax
+     f4d:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     f50:	89 14 85 c0 98 00 00 	mov    %edx,0x98c0(,%eax,4)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+     f57:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f5a:	01 45 f4             	add    %eax,-0xc(%ebp)
+     f5d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     f60:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f63:	01 d0                	add    %edx,%eax
+     f65:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     f6a:	76 ad                	jbe    f19 <refill+0x43>
+  }
+  return 0;
+     f6c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     f71:	c9                   	leave
+     f72:	c3                   	ret
+
+00000f73 <free>:
+
+void
+free(void *ap)
+{
+     f73:	55                   	push   %ebp
+     f74:	89 e5                	mov    %esp,%ebp
+     f76:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+
+  if(ap == 0)
+     f79:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     f7d:	74 4b                	je     fca <free+0x57>
+    return;
+  c = (struct chunk*)((char*)ap - HDRSIZE);
+     f7f:	8b 45 08             	mov    0x8(%ebp),%eax
+     f82:	83 e8 08             	sub    $0x8,%eax
+     f85:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(c->tag != LARGE){
+     f88:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f8b:	8b 40 04             	mov    0x4(%eax),%eax
+     f8e:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f91:	74 25                	je     fb8 <free+0x45>
+    c->next = classes[c->tag];
+     f93:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f96:	8b 40 04             	mov    0x4(%eax),%eax
+     f99:	8b 14 85 c0 98 00 00 	mov    0x98c0(,%eax,4),%edx
+     fa0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fa3:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[c->tag] = c;
+     fa6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fa9:	8b 40 04             	mov    0x4(%eax),%eax
+     fac:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     faf:	89 14 85 c0 98 00 00 	mov    %edx,0x98c0(,%eax,4)
+    return;
+     fb6:	eb 13                	jmp    fcb <free+0x58>
+  }
+  freechunk(c, 1);
+     fb8:	83 ec 08             	sub    $0x8,%esp
+     fbb:	6a 01                	push   $0x1
+     fbd:	ff 75 f4             	push   -0xc(%ebp)
+     fc0:	e8 65 fb ff ff       	call   b2a <freechunk>
+     fc5:	83 c4 10             	add    $0x10,%esp
+     fc8:	eb 01                	jmp    fcb <free+0x58>
+    return;
+     fca:	90                   	nop
+}
+     fcb:	c9                   	leave
+     fcc:	c3                   	ret
+
+00000fcd <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     fcd:	55                   	push   %ebp
+     fce:	89 e5                	mov    %esp,%ebp
+     fd0:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  int k;
+
+  if(nbytes > MAXSMALL)
+     fd3:	81 7d 08 00 08 00 00 	cmpl   $0x800,0x8(%ebp)
+     fda:	76 10                	jbe    fec <malloc+0x1f>
+    return largealloc(nbytes);
+     fdc:	83 ec 0c             	sub    $0xc,%esp
+     fdf:	ff 75 08             	push   0x8(%ebp)
+     fe2:	e8 93 fd ff ff       	call   d7a <largealloc>
+     fe7:	83 c4 10             	add    $0x10,%esp
+     fea:	eb 6a                	jmp    1056 <malloc+0x89>
+  for(k = 0; (MINSMALL << k) < nbytes; k++)
+     fec:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     ff3:	eb 04                	jmp    ff9 <malloc+0x2c>
+     ff5:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     ff9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ffc:	ba 10 00 00 00       	mov    $0x10,%edx
+    1001:	89 c1                	mov    %eax,%ecx
+    1003:	d3 e2                	shl    %cl,%edx
+    1005:	89 d0                	mov    %edx,%eax
+    1007:	3b 45 08             	cmp    0x8(%ebp),%eax
+    100a:	72 e9                	jb     ff5 <malloc+0x28>
+    ;
+  if(classes[k] == 0 && refill(k) < 0)
+    100c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    100f:	8b 04 85 c0 98 00 00 	mov    0x98c0(,%eax,4),%eax
+    1016:	85 c0                	test   %eax,%eax
+    1018:	75 19                	jne    1033 <malloc+0x66>
+    101a:	83 ec 0c             	sub    $0xc,%esp
+    101d:	ff 75 f4             	push   -0xc(%ebp)
+    1020:	e8 b1 fe ff ff       	call   ed6 <refill>
+    1025:	83 c4 10             	add    $0x10,%esp
+    1028:	85 c0                	test   %eax,%eax
+    102a:	79 07                	jns    1033 <malloc+0x66>
+    return 0;
+    102c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1031:	eb 23                	jmp    1056 <malloc+0x89>
+  b = classes[k];
+    1033:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1036:	8b 04 85 c0 98 00 00 	mov    0x98c0(,%eax,4),%eax
+    103d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  classes[k] = b->next;
+    1040:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1043:	8b 50 08             	mov    0x8(%eax),%edx
+    1046:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1049:	89 14 85 c0 98 00 00 	mov    %edx,0x98c0(,%eax,4)
+  return (char*)b + HDRSIZE;
+    1050:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1053:	83 c0 08             	add    $0x8,%eax
+}
+    1056:	c9                   	leave
+    1057:	c3                   	ret
+
+00001058 <stream>:
+
+// Return the stream for fd, deciding on first use how
+// its output is buffered.  Returns 0 if fd is not open.
+static struct stream*
+stream(int fd)
+{
+    1058:	55                   	push   %ebp
+    1059:	89 e5                	mov    %esp,%ebp
+    105b:	83 ec 28             	sub    $0x28,%esp
+  struct stream *s;
+  struct stat st;
+
+  if(fd < 0 || fd >= NOFILE)
+    105e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1062:	78 06                	js     106a <stream+0x12>
+    1064:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    1068:	7e 07                	jle    1071 <stream+0x19>
+    return 0;
+    106a:	b8 00 00 00 00       	mov    $0x0,%eax
+    106f:	eb 55                	jmp    10c6 <stream+0x6e>
+  s = &streams[fd];
+    1071:	8b 45 08             	mov    0x8(%ebp),%eax
+    1074:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    107a:	05 60 99 00 00       	add    $0x9960,%eax
+    107f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(s->mode == UNKNOWN){
+    1082:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1085:	8b 00                	mov    (%eax),%eax
+    1087:	85 c0                	test   %eax,%eax
+    1089:	75 38                	jne    10c3 <stream+0x6b>
+    if(fstat(fd, &st) < 0)
+    108b:	83 ec 08             	sub    $0x8,%esp
+    108e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1091:	50                   	push   %eax
+    1092:	ff 75 08             	push   0x8(%ebp)
+    1095:	e8 57 f6 ff ff       	call   6f1 <fstat>
+    109a:	83 c4 10             	add    $0x10,%esp
+    109d:	85 c0                	test   %eax,%eax
+    109f:	79 07                	jns    10a8 <stream+0x50>
+      return 0;
+    10a1:	b8 00 00 00 00       	mov    $0x0,%eax
+    10a6:	eb 1e                	jmp    10c6 <stream+0x6e>
+    s->mode = st.type == T_DEV ? LINEBUF : FULLBUF;
+    10a8:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+    10ac:	66 83 f8 03          	cmp    $0x3,%ax
+    10b0:	75 07                	jne    10b9 <stream+0x61>
+    10b2:	ba 01 00 00 00       	mov    $0x1,%edx
+    10b7:	eb 05                	jmp    10be <stream+0x66>
+    10b9:	ba 02 00 00 00       	mov    $0x2,%edx
+    10be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10c1:	89 10                	mov    %edx,(%eax)
+  }
+  return s;
+    10c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    10c6:	c9                   	leave
+    10c7:	c3                   	ret
+
+000010c8 <fflush>:
+
+int
+fflush(int fd)
+{
+    10c8:	55                   	push   %ebp
+    10c9:	89 e5                	mov    %esp,%ebp
+    10cb:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  int i, n;
+
+  if(fd < 0 || fd >= NOFILE)
+    10ce:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    10d2:	78 06                	js     10da <fflush+0x12>
+    10d4:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    10d8:	7e 07                	jle    10e1 <fflush+0x19>
+    return -1;
+    10da:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    10df:	eb 78                	jmp    1159 <fflush+0x91>
+  s = &streams[fd];
+    10e1:	8b 45 08             	mov    0x8(%ebp),%eax
+    10e4:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    10ea:	05 60 99 00 00       	add    $0x9960,%eax
+    10ef:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < s->nout; i += n){
+    10f2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    10f9:	eb 44                	jmp    113f <fflush+0x77>
+    if((n = write(fd, s->out + i, s->nout - i)) <= 0){
+    10fb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    10fe:	8b 40 04             	mov    0x4(%eax),%eax
+    1101:	2b 45 f4             	sub    -0xc(%ebp),%eax
+    1104:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    1107:	8d 4a 10             	lea    0x10(%edx),%ecx
+    110a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    110d:	01 ca                	add    %ecx,%edx
+    110f:	83 ec 04             	sub    $0x4,%esp
+    1112:	50                   	push   %eax
+    1113:	52                   	push   %edx
+    1114:	ff 75 08             	push   0x8(%ebp)
+    1117:	e8 6c f5 ff ff       	call   688 <write>
+    111c:	83 c4 10             	add    $0x10,%esp
+    111f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1122:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1126:	7f 11                	jg     1139 <fflush+0x71>
+      s->nout = 0;
+    1128:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    112b:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+      return -1;
+    1132:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1137:	eb 20                	jmp    1159 <fflush+0x91>
+  for(i = 0; i < s->nout; i += n){
+    1139:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    113c:	01 45 f4             	add    %eax,-0xc(%ebp)
+    113f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1142:	8b 40 04             	mov    0x4(%eax),%eax
+    1145:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    1148:	7c b1                	jl     10fb <fflush+0x33>
+    }
+  }
+  s->nout = 0;
+    114a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    114d:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  return 0;
+    1154:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1159:	c9                   	leave
+    115a:	c3                   	ret
+
+0000115b <flushall>:
+
+// Flush every stream, or only line-buffered ones.
+static void
+flushall(int lineonly)
+{
+    115b:	55                   	push   %ebp
+    115c:	89 e5                	mov    %esp,%ebp
+    115e:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+    1161:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1168:	eb 41                	jmp    11ab <flushall+0x50>
+    if(streams[fd].nout > 0 && (!lineonly || streams[fd].mode == LINEBUF))
+    116a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    116d:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1173:	05 64 99 00 00       	add    $0x9964,%eax
+    1178:	8b 00                	mov    (%eax),%eax
+    117a:	85 c0                	test   %eax,%eax
+    117c:	7e 29                	jle    11a7 <flushall+0x4c>
+    117e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1182:	74 15                	je     1199 <flushall+0x3e>
+    1184:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1187:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    118d:	05 60 99 00 00       	add    $0x9960,%eax
+    1192:	8b 00                	mov    (%eax),%eax
+    1194:	83 f8 01             	cmp    $0x1,%eax
+    1197:	75 0e                	jne    11a7 <flushall+0x4c>
+      fflush(fd);
+    1199:	83 ec 0c             	sub    $0xc,%esp
+    119c:	ff 75 f4             	push   -0xc(%ebp)
+    119f:	e8 24 ff ff ff       	call   10c8 <fflush>
+    11a4:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++)
+    11a7:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    11ab:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+    11af:	7e b9                	jle    116a <flushall+0xf>
+}
+    11b1:	90                   	nop
+    11b2:	90                   	nop
+    11b3:	c9                   	leave
+    11b4:	c3                   	ret
+
+000011b5 <fputc>:
+
+int
+fputc(int fd, int c)
+{
+    11b5:	55                   	push   %ebp
+    11b6:	89 e5                	mov    %esp,%ebp
+    11b8:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  char ch;
+
+  if((s = stream(fd)) == 0){
+    11bb:	83 ec 0c             	sub    $0xc,%esp
+    11be:	ff 75 08             	push   0x8(%ebp)
+    11c1:	e8 92 fe ff ff       	call   1058 <stream>
+    11c6:	83 c4 10             	add    $0x10,%esp
+    11c9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    11cc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    11d0:	75 2e                	jne    1200 <fputc+0x4b>
+    ch = c;
+    11d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11d5:	88 45 f3             	mov    %al,-0xd(%ebp)
+    return write(fd, &ch, 1) == 1 ? (uchar)c : -1;
+    11d8:	83 ec 04             	sub    $0x4,%esp
+    11db:	6a 01                	push   $0x1
+    11dd:	8d 45 f3             	lea    -0xd(%ebp),%eax
+    11e0:	50                   	push   %eax
+    11e1:	ff 75 08             	push   0x8(%ebp)
+    11e4:	e8 9f f4 ff ff       	call   688 <write>
+    11e9:	83 c4 10             	add    $0x10,%esp
+    11ec:	83 f8 01             	cmp    $0x1,%eax
+    11ef:	75 08                	jne    11f9 <fputc+0x44>
+    11f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11f4:	0f b6 c0             	movzbl %al,%eax
+    11f7:	eb 5e                	jmp    1257 <fputc+0xa2>
+    11f9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    11fe:	eb 57                	jmp    1257 <fputc+0xa2>
+  }
+  s->out[s->nout++] = c;
+    1200:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1203:	8b 40 04             	mov    0x4(%eax),%eax
+    1206:	8d 48 01             	lea    0x1(%eax),%ecx
+    1209:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    120c:	89 4a 04             	mov    %ecx,0x4(%edx)
+    120f:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1212:	89 d1                	mov    %edx,%ecx
+    1214:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1217:	88 4c 02 10          	mov    %cl,0x10(%edx,%eax,1)
+  if(s->nout == BUFSZ || (s->mode == LINEBUF && c == '\n'))
+    121b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    121e:	8b 40 04             	mov    0x4(%eax),%eax
+    1221:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1226:	74 10                	je     1238 <fputc+0x83>
+    1228:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    122b:	8b 00                	mov    (%eax),%eax
+    122d:	83 f8 01             	cmp    $0x1,%eax
+    1230:	75 1f                	jne    1251 <fputc+0x9c>
+    1232:	83 7d 0c 0a          	cmpl   $0xa,0xc(%ebp)
+    1236:	75 19                	jne    1251 <fputc+0x9c>
+    if(fflush(fd) < 0)
+    1238:	83 ec 0c             	sub    $0xc,%esp
+    123b:	ff 75 08             	push   0x8(%ebp)
+    123e:	e8 85 fe ff ff       	call   10c8 <fflush>
+    1243:	83 c4 10             	add    $0x10,%esp
+    1246:	85 c0                	test   %eax,%eax
+    1248:	79 07                	jns    1251 <fputc+0x9c>
+      return -1;
+    124a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    124f:	eb 06                	jmp    1257 <fputc+0xa2>
+  return (uchar)c;
+    1251:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1254:	0f b6 c0             	movzbl %al,%eax
+}
+    1257:	c9                   	leave
+    1258:	c3                   	ret
+
+00001259 <fgetc>:
+
+// Return the next byte read from fd, or -1 at end of file.
+int
+fgetc(int fd)
+{
+    1259:	55                   	push   %ebp
+    125a:	89 e5                	mov    %esp,%ebp
+    125c:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  uchar c;
+  int n;
+
+  if((s = stream(fd)) == 0){
+    125f:	83 ec 0c             	sub    $0xc,%esp
+    1262:	ff 75 08             	push   0x8(%ebp)
+    1265:	e8 ee fd ff ff       	call   1058 <stream>
+    126a:	83 c4 10             	add    $0x10,%esp
+    126d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1270:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1274:	75 39                	jne    12af <fgetc+0x56>
+    flushall(1);
+    1276:	83 ec 0c             	sub    $0xc,%esp
+    1279:	6a 01                	push   $0x1
+    127b:	e8 db fe ff ff       	call   115b <flushall>
+    1280:	83 c4 10             	add    $0x10,%esp
+    return read(fd, &c, 1) == 1 ? c : -1;
+    1283:	83 ec 04             	sub    $0x4,%esp
+    1286:	6a 01                	push   $0x1
+    1288:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    128b:	50                   	push   %eax
+    128c:	ff 75 08             	push   0x8(%ebp)
+    128f:	e8 e5 f3 ff ff       	call   679 <read>
+    1294:	83 c4 10             	add    $0x10,%esp
+    1297:	83 f8 01             	cmp    $0x1,%eax
+    129a:	75 0c                	jne    12a8 <fgetc+0x4f>
+    129c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    12a0:	0f b6 c0             	movzbl %al,%eax
+    12a3:	e9 80 00 00 00       	jmp    1328 <fgetc+0xcf>
+    12a8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12ad:	eb 79                	jmp    1328 <fgetc+0xcf>
+  }
+  if(s->rpos == s->rend){
+    12af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12b2:	8b 50 08             	mov    0x8(%eax),%edx
+    12b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12b8:	8b 40 0c             	mov    0xc(%eax),%eax
+    12bb:	39 c2                	cmp    %eax,%edx
+    12bd:	75 4c                	jne    130b <fgetc+0xb2>
+    flushall(1);
+    12bf:	83 ec 0c             	sub    $0xc,%esp
+    12c2:	6a 01                	push   $0x1
+    12c4:	e8 92 fe ff ff       	call   115b <flushall>
+    12c9:	83 c4 10             	add    $0x10,%esp
+    if((n = read(fd, s->in, BUFSZ)) <= 0)
+    12cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12cf:	05 10 02 00 00       	add    $0x210,%eax
+    12d4:	83 ec 04             	sub    $0x4,%esp
+    12d7:	68 00 02 00 00       	push   $0x200
+    12dc:	50                   	push   %eax
+    12dd:	ff 75 08             	push   0x8(%ebp)
+    12e0:	e8 94 f3 ff ff       	call   679 <read>
+    12e5:	83 c4 10             	add    $0x10,%esp
+    12e8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    12eb:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    12ef:	7f 07                	jg     12f8 <fgetc+0x9f>
+      return -1;
+    12f1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12f6:	eb 30                	jmp    1328 <fgetc+0xcf>
+    s->rpos = 0;
+    12f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12fb:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+    s->rend = n;
+    1302:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1305:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    1308:	89 50 0c             	mov    %edx,0xc(%eax)
+  }
+  return (uchar)s->in[s->rpos++];
+    130b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    130e:	8b 40 08             	mov    0x8(%eax),%eax
+    1311:	8d 48 01             	lea    0x1(%eax),%ecx
+    1314:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1317:	89 4a 08             	mov    %ecx,0x8(%edx)
+    131a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    131d:	0f b6 84 02 10 02 00 	movzbl 0x210(%edx,%eax,1),%eax
+    1324:	00 
+    1325:	0f b6 c0             	movzbl %al,%eax
+}
+    1328:	c9                   	leave
+    1329:	c3                   	ret
+
+0000132a <fork>:
+
+int
+fork(void)
+{
+    132a:	55                   	push   %ebp
+    132b:	89 e5                	mov    %esp,%ebp
+    132d:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1330:	83 ec 0c             	sub    $0xc,%esp
+    1333:	6a 00                	push   $0x0
+    1335:	e8 21 fe ff ff       	call   115b <flushall>
+    133a:	83 c4 10             	add    $0x10,%esp
+  return _fork();
+    133d:	e8 fb f2 ff ff       	call   63d <_fork>
+}
+    1342:	c9                   	leave
+    1343:	c3                   	ret
+
+00001344 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+    1344:	55                   	push   %ebp
+    1345:	89 e5                	mov    %esp,%ebp
+    1347:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    134a:	83 ec 0c             	sub    $0xc,%esp
+    134d:	6a 00                	push   $0x0
+    134f:	e8 07 fe ff ff       	call   115b <flushall>
+    1354:	83 c4 10             	add    $0x10,%esp
+  return _exec(path, argv);
+    1357:	83 ec 08             	sub    $0x8,%esp
+    135a:	ff 75 0c             	push   0xc(%ebp)
+    135d:	ff 75 08             	push   0x8(%ebp)
+    1360:	e8 50 f3 ff ff       	call   6b5 <_exec>
+    1365:	83 c4 10             	add    $0x10,%esp
+}
+    1368:	c9                   	leave
+    1369:	c3                   	ret
+
+0000136a <exit>:
+
+int
+exit(void)
+{
+    136a:	55                   	push   %ebp
+    136b:	89 e5                	mov    %esp,%ebp
+    136d:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1370:	83 ec 0c             	sub    $0xc,%esp
+    1373:	6a 00                	push   $0x0
+    1375:	e8 e1 fd ff ff       	call   115b <flushall>
+    137a:	83 c4 10             	add    $0x10,%esp
+  _exit();
+    137d:	e8 ca f2 ff ff       	call   64c <_exit>
+
+00001382 <close>:
+}
+
+int
+close(int fd)
+{
+    1382:	55                   	push   %ebp
+    1383:	89 e5                	mov    %esp,%ebp
+    1385:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+
+  if(fd >= 0 && fd < NOFILE){
+    1388:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    138c:	78 44                	js     13d2 <close+0x50>
+    138e:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    1392:	7f 3e                	jg     13d2 <close+0x50>
+    fflush(fd);
+    1394:	83 ec 0c             	sub    $0xc,%esp
+    1397:	ff 75 08             	push   0x8(%ebp)
+    139a:	e8 29 fd ff ff       	call   10c8 <fflush>
+    139f:	83 c4 10             	add    $0x10,%esp
+    s = &streams[fd];
+    13a2:	8b 45 08             	mov    0x8(%ebp),%eax
+    13a5:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    13ab:	05 60 99 00 00       	add    $0x9960,%eax
+    13b0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    s->mode = UNKNOWN;
+    13b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13b6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    s->rpos = s->rend = 0;
+    13bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13bf:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    13c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13c9:	8b 50 0c             	mov    0xc(%eax),%edx
+    13cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13cf:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  return _close(fd);
+    13d2:	83 ec 0c             	sub    $0xc,%esp
+    13d5:	ff 75 08             	push   0x8(%ebp)
+    13d8:	e8 ba f2 ff ff       	call   697 <_close>
+    13dd:	83 c4 10             	add    $0x10,%esp
+}
+    13e0:	c9                   	leave
+    13e1:	c3                   	ret
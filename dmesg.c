@@ -0,0 +1,20 @@
+// Print the kernel message log.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+char buf[32768];
+
+int
+main(void)
+{
+  int n;
+
+  if((n = dmesg(buf, sizeof(buf))) < 0){
+    printf(2, "dmesg: failed\n");
+    exit();
+  }
+  write(1, buf, n);
+  exit();
+}
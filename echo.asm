@@ -0,0 +1,2594 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	53                   	push   %ebx
+       e:	51                   	push   %ecx
+       f:	83 ec 10             	sub    $0x10,%esp
+      12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  for(i = 1; i < argc; i++)
+      14:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+      1b:	eb 3c                	jmp    59 <main+0x59>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+      1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      20:	83 c0 01             	add    $0x1,%eax
+      23:	39 03                	cmp    %eax,(%ebx)
+      25:	7e 07                	jle    2e <main+0x2e>
+      27:	b9 e7 13 00 00       	mov    $0x13e7,%ecx
+      2c:	eb 05                	jmp    33 <main+0x33>
+      2e:	b9 e9 13 00 00       	mov    $0x13e9,%ecx
+      33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      36:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+      3d:	8b 43 04             	mov    0x4(%ebx),%eax
+      40:	01 d0                	add    %edx,%eax
+      42:	8b 00                	mov    (%eax),%eax
+      44:	51                   	push   %ecx
+      45:	50                   	push   %eax
+      46:	68 eb 13 00 00       	push   $0x13eb
+      4b:	6a 01                	push   $0x1
+      4d:	e8 81 08 00 00       	call   8d3 <printf>
+      52:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++)
+      55:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+      59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      5c:	3b 03                	cmp    (%ebx),%eax
+      5e:	7c bd                	jl     1d <main+0x1d>
+  exit();
+      60:	e8 0a 13 00 00       	call   136f <exit>
+
+00000065 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+      65:	55                   	push   %ebp
+      66:	89 e5                	mov    %esp,%ebp
+      68:	57                   	push   %edi
+      69:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+      6a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      6d:	8b 55 10             	mov    0x10(%ebp),%edx
+      70:	8b 45 0c             	mov    0xc(%ebp),%eax
+      73:	89 cb                	mov    %ecx,%ebx
+      75:	89 df                	mov    %ebx,%edi
+      77:	89 d1                	mov    %edx,%ecx
+      79:	fc                   	cld
+      7a:	f3 aa                	rep stos %al,%es:(%edi)
+      7c:	89 ca                	mov    %ecx,%edx
+      7e:	89 fb                	mov    %edi,%ebx
+      80:	89 5d 08             	mov    %ebx,0x8(%ebp)
+      83:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+      86:	90                   	nop
+      87:	5b                   	pop    %ebx
+      88:	5f                   	pop    %edi
+      89:	5d                   	pop    %ebp
+      8a:	c3                   	ret
+
+0000008b <stosl>:
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+      8b:	55                   	push   %ebp
+      8c:	89 e5                	mov    %esp,%ebp
+      8e:	57                   	push   %edi
+      8f:	53                   	push   %ebx
+  asm volatile("cld; rep stosl" :
+      90:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      93:	8b 55 10             	mov    0x10(%ebp),%edx
+      96:	8b 45 0c             	mov    0xc(%ebp),%eax
+      99:	89 cb                	mov    %ecx,%ebx
+      9b:	89 df                	mov    %ebx,%edi
+      9d:	89 d1                	mov    %edx,%ecx
+      9f:	fc                   	cld
+      a0:	f3 ab                	rep stos %eax,%es:(%edi)
+      a2:	89 ca                	mov    %ecx,%edx
+      a4:	89 fb                	mov    %edi,%ebx
+      a6:	89 5d 08             	mov    %ebx,0x8(%ebp)
+      a9:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+      ac:	90                   	nop
+      ad:	5b                   	pop    %ebx
+      ae:	5f                   	pop    %edi
+      af:	5d                   	pop    %ebp
+      b0:	c3                   	ret
+
+000000b1 <movsb>:
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+      b1:	55                   	push   %ebp
+      b2:	89 e5                	mov    %esp,%ebp
+      b4:	57                   	push   %edi
+      b5:	56                   	push   %esi
+      b6:	53                   	push   %ebx
+  asm volatile("cld; rep movsb" :
+      b7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+      bd:	8b 45 10             	mov    0x10(%ebp),%eax
+      c0:	89 cb                	mov    %ecx,%ebx
+      c2:	89 df                	mov    %ebx,%edi
+      c4:	89 d6                	mov    %edx,%esi
+      c6:	89 c1                	mov    %eax,%ecx
+      c8:	fc                   	cld
+      c9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+      cb:	89 c8                	mov    %ecx,%eax
+      cd:	89 f2                	mov    %esi,%edx
+      cf:	89 fb                	mov    %edi,%ebx
+      d1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+      d4:	89 55 0c             	mov    %edx,0xc(%ebp)
+      d7:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+      da:	90                   	nop
+      db:	5b                   	pop    %ebx
+      dc:	5e                   	pop    %esi
+      dd:	5f                   	pop    %edi
+      de:	5d                   	pop    %ebp
+      df:	c3                   	ret
+
+000000e0 <movsl>:
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+      e0:	55                   	push   %ebp
+      e1:	89 e5                	mov    %esp,%ebp
+      e3:	57                   	push   %edi
+      e4:	56                   	push   %esi
+      e5:	53                   	push   %ebx
+  asm volatile("cld; rep movsl" :
+      e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      e9:	8b 55 0c             	mov    0xc(%ebp),%edx
+      ec:	8b 45 10             	mov    0x10(%ebp),%eax
+      ef:	89 cb                	mov    %ecx,%ebx
+      f1:	89 df                	mov    %ebx,%edi
+      f3:	89 d6                	mov    %edx,%esi
+      f5:	89 c1                	mov    %eax,%ecx
+      f7:	fc                   	cld
+      f8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+      fa:	89 c8                	mov    %ecx,%eax
+      fc:	89 f2                	mov    %esi,%edx
+      fe:	89 fb                	mov    %edi,%ebx
+     100:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     103:	89 55 0c             	mov    %edx,0xc(%ebp)
+     106:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     109:	90                   	nop
+     10a:	5b                   	pop    %ebx
+     10b:	5e                   	pop    %esi
+     10c:	5f                   	pop    %edi
+     10d:	5d                   	pop    %ebp
+     10e:	c3                   	ret
+
+0000010f <strcpy>:
+#define ONES        0x01010101
+#define HASZERO(x)  (((x) - ONES) & ~(x) & (ONES << 7))
+
+char*
+strcpy(char *s, char *t)
+{
+     10f:	55                   	push   %ebp
+     110:	89 e5                	mov    %esp,%ebp
+     112:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+     115:	8b 45 08             	mov    0x8(%ebp),%eax
+     118:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     11b:	90                   	nop
+     11c:	8b 55 0c             	mov    0xc(%ebp),%edx
+     11f:	8d 42 01             	lea    0x1(%edx),%eax
+     122:	89 45 0c             	mov    %eax,0xc(%ebp)
+     125:	8b 45 08             	mov    0x8(%ebp),%eax
+     128:	8d 48 01             	lea    0x1(%eax),%ecx
+     12b:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     12e:	0f b6 12             	movzbl (%edx),%edx
+     131:	88 10                	mov    %dl,(%eax)
+     133:	0f b6 00             	movzbl (%eax),%eax
+     136:	84 c0                	test   %al,%al
+     138:	75 e2                	jne    11c <strcpy+0xd>
+    ;
+  return os;
+     13a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     13d:	c9                   	leave
+     13e:	c3                   	ret
+
+0000013f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     13f:	55                   	push   %ebp
+     140:	89 e5                	mov    %esp,%ebp
+  // Aligned words never straddle a page, so reading
+  // whole ones past the end of a string is safe.
+  if((((uint)p | (uint)q) & 3) == 0)
+     142:	8b 55 08             	mov    0x8(%ebp),%edx
+     145:	8b 45 0c             	mov    0xc(%ebp),%eax
+     148:	09 d0                	or     %edx,%eax
+     14a:	83 e0 03             	and    $0x3,%eax
+     14d:	85 c0                	test   %eax,%eax
+     14f:	75 3f                	jne    190 <strcmp+0x51>
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     151:	eb 08                	jmp    15b <strcmp+0x1c>
+      p += 4, q += 4;
+     153:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     157:	83 45 0c 04          	addl   $0x4,0xc(%ebp)
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     15b:	8b 45 08             	mov    0x8(%ebp),%eax
+     15e:	8b 10                	mov    (%eax),%edx
+     160:	8b 45 0c             	mov    0xc(%ebp),%eax
+     163:	8b 00                	mov    (%eax),%eax
+     165:	39 c2                	cmp    %eax,%edx
+     167:	75 27                	jne    190 <strcmp+0x51>
+     169:	8b 45 08             	mov    0x8(%ebp),%eax
+     16c:	8b 00                	mov    (%eax),%eax
+     16e:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     174:	8b 45 08             	mov    0x8(%ebp),%eax
+     177:	8b 00                	mov    (%eax),%eax
+     179:	f7 d0                	not    %eax
+     17b:	21 d0                	and    %edx,%eax
+     17d:	25 80 80 80 80       	and    $0x80808080,%eax
+     182:	85 c0                	test   %eax,%eax
+     184:	74 cd                	je     153 <strcmp+0x14>
+  while(*p && *p == *q)
+     186:	eb 08                	jmp    190 <strcmp+0x51>
+    p++, q++;
+     188:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     18c:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     190:	8b 45 08             	mov    0x8(%ebp),%eax
+     193:	0f b6 00             	movzbl (%eax),%eax
+     196:	84 c0                	test   %al,%al
+     198:	74 10                	je     1aa <strcmp+0x6b>
+     19a:	8b 45 08             	mov    0x8(%ebp),%eax
+     19d:	0f b6 10             	movzbl (%eax),%edx
+     1a0:	8b 45 0c             	mov    0xc(%ebp),%eax
+     1a3:	0f b6 00             	movzbl (%eax),%eax
+     1a6:	38 c2                	cmp    %al,%dl
+     1a8:	74 de                	je     188 <strcmp+0x49>
+  return (uchar)*p - (uchar)*q;
+     1aa:	8b 45 08             	mov    0x8(%ebp),%eax
+     1ad:	0f b6 00             	movzbl (%eax),%eax
+     1b0:	0f b6 d0             	movzbl %al,%edx
+     1b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+     1b6:	0f b6 00             	movzbl (%eax),%eax
+     1b9:	0f b6 c0             	movzbl %al,%eax
+     1bc:	29 c2                	sub    %eax,%edx
+     1be:	89 d0                	mov    %edx,%eax
+}
+     1c0:	5d                   	pop    %ebp
+     1c1:	c3                   	ret
+
+000001c2 <strlen>:
+
+uint
+strlen(char *s)
+{
+     1c2:	55                   	push   %ebp
+     1c3:	89 e5                	mov    %esp,%ebp
+     1c5:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; ((uint)(s+n) & 3) && s[n]; n++)
+     1c8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     1cf:	eb 04                	jmp    1d5 <strlen+0x13>
+     1d1:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     1d5:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     1d8:	8b 45 08             	mov    0x8(%ebp),%eax
+     1db:	01 d0                	add    %edx,%eax
+     1dd:	83 e0 03             	and    $0x3,%eax
+     1e0:	85 c0                	test   %eax,%eax
+     1e2:	74 0f                	je     1f3 <strlen+0x31>
+     1e4:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     1e7:	8b 45 08             	mov    0x8(%ebp),%eax
+     1ea:	01 d0                	add    %edx,%eax
+     1ec:	0f b6 00             	movzbl (%eax),%eax
+     1ef:	84 c0                	test   %al,%al
+     1f1:	75 de                	jne    1d1 <strlen+0xf>
+    ;
+  if(s[n])
+     1f3:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     1f6:	8b 45 08             	mov    0x8(%ebp),%eax
+     1f9:	01 d0                	add    %edx,%eax
+     1fb:	0f b6 00             	movzbl (%eax),%eax
+     1fe:	84 c0                	test   %al,%al
+     200:	74 33                	je     235 <strlen+0x73>
+    while(!HASZERO(*(uint*)(s+n)))
+     202:	eb 04                	jmp    208 <strlen+0x46>
+      n += 4;
+     204:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+    while(!HASZERO(*(uint*)(s+n)))
+     208:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     20b:	8b 45 08             	mov    0x8(%ebp),%eax
+     20e:	01 d0                	add    %edx,%eax
+     210:	8b 00                	mov    (%eax),%eax
+     212:	8d 88 ff fe fe fe    	lea    -0x1010101(%eax),%ecx
+     218:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     21b:	8b 45 08             	mov    0x8(%ebp),%eax
+     21e:	01 d0                	add    %edx,%eax
+     220:	8b 00                	mov    (%eax),%eax
+     222:	f7 d0                	not    %eax
+     224:	21 c8                	and    %ecx,%eax
+     226:	25 80 80 80 80       	and    $0x80808080,%eax
+     22b:	85 c0                	test   %eax,%eax
+     22d:	74 d5                	je     204 <strlen+0x42>
+  for(; s[n]; n++)
+     22f:	eb 04                	jmp    235 <strlen+0x73>
+     231:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     235:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     238:	8b 45 08             	mov    0x8(%ebp),%eax
+     23b:	01 d0                	add    %edx,%eax
+     23d:	0f b6 00             	movzbl (%eax),%eax
+     240:	84 c0                	test   %al,%al
+     242:	75 ed                	jne    231 <strlen+0x6f>
+    ;
+  return n;
+     244:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     247:	c9                   	leave
+     248:	c3                   	ret
+
+00000249 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     249:	55                   	push   %ebp
+     24a:	89 e5                	mov    %esp,%ebp
+     24c:	83 ec 10             	sub    $0x10,%esp
+  char *d;
+  uint k;
+
+  d = dst;
+     24f:	8b 45 08             	mov    0x8(%ebp),%eax
+     252:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c &= 0xFF;
+     255:	81 65 0c ff 00 00 00 	andl   $0xff,0xc(%ebp)
+  if(n >= 16){
+     25c:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     260:	76 54                	jbe    2b6 <memset+0x6d>
+    k = -(uint)d & 3;  // bytes up to a word boundary
+     262:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     265:	f7 d8                	neg    %eax
+     267:	83 e0 03             	and    $0x3,%eax
+     26a:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    stosb(d, c, k);
+     26d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     270:	50                   	push   %eax
+     271:	ff 75 0c             	push   0xc(%ebp)
+     274:	ff 75 fc             	push   -0x4(%ebp)
+     277:	e8 e9 fd ff ff       	call   65 <stosb>
+     27c:	83 c4 0c             	add    $0xc,%esp
+    d += k;
+     27f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     282:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n -= k;
+     285:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     288:	29 45 10             	sub    %eax,0x10(%ebp)
+    stosl(d, c*ONES, n/4);
+     28b:	8b 45 10             	mov    0x10(%ebp),%eax
+     28e:	c1 e8 02             	shr    $0x2,%eax
+     291:	89 c2                	mov    %eax,%edx
+     293:	8b 45 0c             	mov    0xc(%ebp),%eax
+     296:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     29c:	52                   	push   %edx
+     29d:	50                   	push   %eax
+     29e:	ff 75 fc             	push   -0x4(%ebp)
+     2a1:	e8 e5 fd ff ff       	call   8b <stosl>
+     2a6:	83 c4 0c             	add    $0xc,%esp
+    d += n & ~3;
+     2a9:	8b 45 10             	mov    0x10(%ebp),%eax
+     2ac:	83 e0 fc             	and    $0xfffffffc,%eax
+     2af:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n &= 3;
+     2b2:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+  }
+  stosb(d, c, n);
+     2b6:	8b 45 10             	mov    0x10(%ebp),%eax
+     2b9:	50                   	push   %eax
+     2ba:	ff 75 0c             	push   0xc(%ebp)
+     2bd:	ff 75 fc             	push   -0x4(%ebp)
+     2c0:	e8 a0 fd ff ff       	call   65 <stosb>
+     2c5:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     2c8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     2cb:	c9                   	leave
+     2cc:	c3                   	ret
+
+000002cd <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     2cd:	55                   	push   %ebp
+     2ce:	89 e5                	mov    %esp,%ebp
+     2d0:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s1, *s2;
+
+  s1 = v1;
+     2d3:	8b 45 08             	mov    0x8(%ebp),%eax
+     2d6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s2 = v2;
+     2d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2dc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     2df:	eb 0c                	jmp    2ed <memcmp+0x20>
+    s1 += 4, s2 += 4, n -= 4;
+     2e1:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+     2e5:	83 45 f8 04          	addl   $0x4,-0x8(%ebp)
+     2e9:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     2ed:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     2f1:	76 3e                	jbe    331 <memcmp+0x64>
+     2f3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     2f6:	8b 10                	mov    (%eax),%edx
+     2f8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     2fb:	8b 00                	mov    (%eax),%eax
+     2fd:	39 c2                	cmp    %eax,%edx
+     2ff:	74 e0                	je     2e1 <memcmp+0x14>
+  while(n-- > 0){
+     301:	eb 2e                	jmp    331 <memcmp+0x64>
+    if(*s1 != *s2)
+     303:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     306:	0f b6 10             	movzbl (%eax),%edx
+     309:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     30c:	0f b6 00             	movzbl (%eax),%eax
+     30f:	38 c2                	cmp    %al,%dl
+     311:	74 16                	je     329 <memcmp+0x5c>
+      return *s1 - *s2;
+     313:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     316:	0f b6 00             	movzbl (%eax),%eax
+     319:	0f b6 d0             	movzbl %al,%edx
+     31c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     31f:	0f b6 00             	movzbl (%eax),%eax
+     322:	0f b6 c0             	movzbl %al,%eax
+     325:	29 c2                	sub    %eax,%edx
+     327:	eb 1a                	jmp    343 <memcmp+0x76>
+    s1++, s2++;
+     329:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     32d:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+  while(n-- > 0){
+     331:	8b 45 10             	mov    0x10(%ebp),%eax
+     334:	8d 50 ff             	lea    -0x1(%eax),%edx
+     337:	89 55 10             	mov    %edx,0x10(%ebp)
+     33a:	85 c0                	test   %eax,%eax
+     33c:	75 c5                	jne    303 <memcmp+0x36>
+  }
+  return 0;
+     33e:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+     343:	89 d0                	mov    %edx,%eax
+     345:	c9                   	leave
+     346:	c3                   	ret
+
+00000347 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     347:	55                   	push   %ebp
+     348:	89 e5                	mov    %esp,%ebp
+     34a:	83 ec 14             	sub    $0x14,%esp
+     34d:	8b 45 0c             	mov    0xc(%ebp),%eax
+     350:	88 45 ec             	mov    %al,-0x14(%ebp)
+  uint w, cc;
+
+  // Skip whole words holding neither c nor the terminator.
+  for(; ((uint)s & 3) && *s; s++)
+     353:	eb 17                	jmp    36c <strchr+0x25>
+    if(*s == c)
+     355:	8b 45 08             	mov    0x8(%ebp),%eax
+     358:	0f b6 00             	movzbl (%eax),%eax
+     35b:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     35e:	75 08                	jne    368 <strchr+0x21>
+      return (char*)s;
+     360:	8b 45 08             	mov    0x8(%ebp),%eax
+     363:	e9 ad 00 00 00       	jmp    415 <strchr+0xce>
+  for(; ((uint)s & 3) && *s; s++)
+     368:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     36c:	8b 45 08             	mov    0x8(%ebp),%eax
+     36f:	83 e0 03             	and    $0x3,%eax
+     372:	85 c0                	test   %eax,%eax
+     374:	74 0a                	je     380 <strchr+0x39>
+     376:	8b 45 08             	mov    0x8(%ebp),%eax
+     379:	0f b6 00             	movzbl (%eax),%eax
+     37c:	84 c0                	test   %al,%al
+     37e:	75 d5                	jne    355 <strchr+0xe>
+  cc = (uchar)c * ONES;
+     380:	0f b6 45 ec          	movzbl -0x14(%ebp),%eax
+     384:	0f b6 c0             	movzbl %al,%eax
+     387:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     38d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(*s)
+     390:	8b 45 08             	mov    0x8(%ebp),%eax
+     393:	0f b6 00             	movzbl (%eax),%eax
+     396:	84 c0                	test   %al,%al
+     398:	74 6c                	je     406 <strchr+0xbf>
+    for(; w = *(uint*)s, !HASZERO(w) && !HASZERO(w ^ cc); s += 4)
+     39a:	eb 04                	jmp    3a0 <strchr+0x59>
+     39c:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     3a0:	8b 45 08             	mov    0x8(%ebp),%eax
+     3a3:	8b 00                	mov    (%eax),%eax
+     3a5:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     3a8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3ab:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     3b1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3b4:	f7 d0                	not    %eax
+     3b6:	21 d0                	and    %edx,%eax
+     3b8:	25 80 80 80 80       	and    $0x80808080,%eax
+     3bd:	85 c0                	test   %eax,%eax
+     3bf:	75 26                	jne    3e7 <strchr+0xa0>
+     3c1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3c4:	33 45 fc             	xor    -0x4(%ebp),%eax
+     3c7:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     3cd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3d0:	33 45 fc             	xor    -0x4(%ebp),%eax
+     3d3:	f7 d0                	not    %eax
+     3d5:	21 d0                	and    %edx,%eax
+     3d7:	25 80 80 80 80       	and    $0x80808080,%eax
+     3dc:	85 c0                	test   %eax,%eax
+     3de:	75 07                	jne    3e7 <strchr+0xa0>
+     3e0:	b8 01 00 00 00       	mov    $0x1,%eax
+     3e5:	eb 05                	jmp    3ec <strchr+0xa5>
+     3e7:	b8 00 00 00 00       	mov    $0x0,%eax
+     3ec:	85 c0                	test   %eax,%eax
+     3ee:	75 ac                	jne    39c <strchr+0x55>
+      ;
+  for(; *s; s++)
+     3f0:	eb 14                	jmp    406 <strchr+0xbf>
+    if(*s == c)
+     3f2:	8b 45 08             	mov    0x8(%ebp),%eax
+     3f5:	0f b6 00             	movzbl (%eax),%eax
+     3f8:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     3fb:	75 05                	jne    402 <strchr+0xbb>
+      return (char*)s;
+     3fd:	8b 45 08             	mov    0x8(%ebp),%eax
+     400:	eb 13                	jmp    415 <strchr+0xce>
+  for(; *s; s++)
+     402:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     406:	8b 45 08             	mov    0x8(%ebp),%eax
+     409:	0f b6 00             	movzbl (%eax),%eax
+     40c:	84 c0                	test   %al,%al
+     40e:	75 e2                	jne    3f2 <strchr+0xab>
+  return 0;
+     410:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     415:	c9                   	leave
+     416:	c3                   	ret
+
+00000417 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     417:	55                   	push   %ebp
+     418:	89 e5                	mov    %esp,%ebp
+     41a:	83 ec 18             	sub    $0x18,%esp
+  int i, c;
+
+  for(i=0; i+1 < max; ){
+     41d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     424:	eb 37                	jmp    45d <gets+0x46>
+    c = fgetc(0);
+     426:	83 ec 0c             	sub    $0xc,%esp
+     429:	6a 00                	push   $0x0
+     42b:	e8 2e 0e 00 00       	call   125e <fgetc>
+     430:	83 c4 10             	add    $0x10,%esp
+     433:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(c < 0)
+     436:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     43a:	78 2e                	js     46a <gets+0x53>
+      break;
+    buf[i++] = c;
+     43c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     43f:	8d 50 01             	lea    0x1(%eax),%edx
+     442:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     445:	89 c2                	mov    %eax,%edx
+     447:	8b 45 08             	mov    0x8(%ebp),%eax
+     44a:	01 d0                	add    %edx,%eax
+     44c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     44f:	88 10                	mov    %dl,(%eax)
+    if(c == '\n' || c == '\r')
+     451:	83 7d f0 0a          	cmpl   $0xa,-0x10(%ebp)
+     455:	74 14                	je     46b <gets+0x54>
+     457:	83 7d f0 0d          	cmpl   $0xd,-0x10(%ebp)
+     45b:	74 0e                	je     46b <gets+0x54>
+  for(i=0; i+1 < max; ){
+     45d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     460:	83 c0 01             	add    $0x1,%eax
+     463:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     466:	7f be                	jg     426 <gets+0xf>
+     468:	eb 01                	jmp    46b <gets+0x54>
+      break;
+     46a:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     46b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     46e:	8b 45 08             	mov    0x8(%ebp),%eax
+     471:	01 d0                	add    %edx,%eax
+     473:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     476:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     479:	c9                   	leave
+     47a:	c3                   	ret
+
+0000047b <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     47b:	55                   	push   %ebp
+     47c:	89 e5                	mov    %esp,%ebp
+     47e:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     481:	83 ec 08             	sub    $0x8,%esp
+     484:	6a 00                	push   $0x0
+     486:	ff 75 08             	push   0x8(%ebp)
+     489:	e8 3b 02 00 00       	call   6c9 <open>
+     48e:	83 c4 10             	add    $0x10,%esp
+     491:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     494:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     498:	79 07                	jns    4a1 <stat+0x26>
+    return -1;
+     49a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     49f:	eb 25                	jmp    4c6 <stat+0x4b>
+  r = fstat(fd, st);
+     4a1:	83 ec 08             	sub    $0x8,%esp
+     4a4:	ff 75 0c             	push   0xc(%ebp)
+     4a7:	ff 75 f4             	push   -0xc(%ebp)
+     4aa:	e8 47 02 00 00       	call   6f6 <fstat>
+     4af:	83 c4 10             	add    $0x10,%esp
+     4b2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     4b5:	83 ec 0c             	sub    $0xc,%esp
+     4b8:	ff 75 f4             	push   -0xc(%ebp)
+     4bb:	e8 c7 0e 00 00       	call   1387 <close>
+     4c0:	83 c4 10             	add    $0x10,%esp
+  return r;
+     4c3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     4c6:	c9                   	leave
+     4c7:	c3                   	ret
+
+000004c8 <atoi>:
+
+int
+atoi(const char *s)
+{
+     4c8:	55                   	push   %ebp
+     4c9:	89 e5                	mov    %esp,%ebp
+     4cb:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     4ce:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     4d5:	eb 25                	jmp    4fc <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     4d7:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     4da:	89 d0                	mov    %edx,%eax
+     4dc:	c1 e0 02             	shl    $0x2,%eax
+     4df:	01 d0                	add    %edx,%eax
+     4e1:	01 c0                	add    %eax,%eax
+     4e3:	89 c1                	mov    %eax,%ecx
+     4e5:	8b 45 08             	mov    0x8(%ebp),%eax
+     4e8:	8d 50 01             	lea    0x1(%eax),%edx
+     4eb:	89 55 08             	mov    %edx,0x8(%ebp)
+     4ee:	0f b6 00             	movzbl (%eax),%eax
+     4f1:	0f be c0             	movsbl %al,%eax
+     4f4:	01 c8                	add    %ecx,%eax
+     4f6:	83 e8 30             	sub    $0x30,%eax
+     4f9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     4fc:	8b 45 08             	mov    0x8(%ebp),%eax
+     4ff:	0f b6 00             	movzbl (%eax),%eax
+     502:	3c 2f                	cmp    $0x2f,%al
+     504:	7e 0a                	jle    510 <atoi+0x48>
+     506:	8b 45 08             	mov    0x8(%ebp),%eax
+     509:	0f b6 00             	movzbl (%eax),%eax
+     50c:	3c 39                	cmp    $0x39,%al
+     50e:	7e c7                	jle    4d7 <atoi+0xf>
+  return n;
+     510:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     513:	c9                   	leave
+     514:	c3                   	ret
+
+00000515 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     515:	55                   	push   %ebp
+     516:	89 e5                	mov    %esp,%ebp
+     518:	83 ec 10             	sub    $0x10,%esp
+  char *d, *s;
+  int k;
+
+  if(n <= 0)
+     51b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     51f:	7f 08                	jg     529 <memmove+0x14>
+    return vdst;
+     521:	8b 45 08             	mov    0x8(%ebp),%eax
+     524:	e9 17 01 00 00       	jmp    640 <memmove+0x12b>
+  d = vdst;
+     529:	8b 45 08             	mov    0x8(%ebp),%eax
+     52c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s = vsrc;
+     52f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     532:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  if(s < d && s + n > d){
+     535:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     538:	3b 45 fc             	cmp    -0x4(%ebp),%eax
+     53b:	0f 83 84 00 00 00    	jae    5c5 <memmove+0xb0>
+     541:	8b 55 10             	mov    0x10(%ebp),%edx
+     544:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     547:	01 d0                	add    %edx,%eax
+     549:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     54c:	73 77                	jae    5c5 <memmove+0xb0>
+    s += n;
+     54e:	8b 45 10             	mov    0x10(%ebp),%eax
+     551:	01 45 f8             	add    %eax,-0x8(%ebp)
+    d += n;
+     554:	8b 45 10             	mov    0x10(%ebp),%eax
+     557:	01 45 fc             	add    %eax,-0x4(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     55a:	eb 17                	jmp    573 <memmove+0x5e>
+      *--d = *--s, n--;
+     55c:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     560:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     564:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     567:	0f b6 10             	movzbl (%eax),%edx
+     56a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     56d:	88 10                	mov    %dl,(%eax)
+     56f:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     573:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     577:	7e 22                	jle    59b <memmove+0x86>
+     579:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     57c:	83 e0 03             	and    $0x3,%eax
+     57f:	85 c0                	test   %eax,%eax
+     581:	75 d9                	jne    55c <memmove+0x47>
+    for(; n >= 4; n -= 4){
+     583:	eb 16                	jmp    59b <memmove+0x86>
+      d -= 4;
+     585:	83 6d fc 04          	subl   $0x4,-0x4(%ebp)
+      s -= 4;
+     589:	83 6d f8 04          	subl   $0x4,-0x8(%ebp)
+      *(uint*)d = *(uint*)s;
+     58d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     590:	8b 10                	mov    (%eax),%edx
+     592:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     595:	89 10                	mov    %edx,(%eax)
+    for(; n >= 4; n -= 4){
+     597:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+     59b:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     59f:	7f e4                	jg     585 <memmove+0x70>
+    }
+    while(n-- > 0)
+     5a1:	eb 13                	jmp    5b6 <memmove+0xa1>
+      *--d = *--s;
+     5a3:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     5a7:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     5ab:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     5ae:	0f b6 10             	movzbl (%eax),%edx
+     5b1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     5b4:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+     5b6:	8b 45 10             	mov    0x10(%ebp),%eax
+     5b9:	8d 50 ff             	lea    -0x1(%eax),%edx
+     5bc:	89 55 10             	mov    %edx,0x10(%ebp)
+     5bf:	85 c0                	test   %eax,%eax
+     5c1:	7f e0                	jg     5a3 <memmove+0x8e>
+  if(s < d && s + n > d){
+     5c3:	eb 78                	jmp    63d <memmove+0x128>
+  } else {
+    if(n >= 16){
+     5c5:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     5c9:	7e 61                	jle    62c <memmove+0x117>
+      k = -(uint)d & 3;
+     5cb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     5ce:	f7 d8                	neg    %eax
+     5d0:	83 e0 03             	and    $0x3,%eax
+     5d3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      movsb(d, s, k);
+     5d6:	ff 75 f4             	push   -0xc(%ebp)
+     5d9:	ff 75 f8             	push   -0x8(%ebp)
+     5dc:	ff 75 fc             	push   -0x4(%ebp)
+     5df:	e8 cd fa ff ff       	call   b1 <movsb>
+     5e4:	83 c4 0c             	add    $0xc,%esp
+      d += k;
+     5e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5ea:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += k;
+     5ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5f0:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n -= k;
+     5f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5f6:	29 45 10             	sub    %eax,0x10(%ebp)
+      movsl(d, s, n/4);
+     5f9:	8b 45 10             	mov    0x10(%ebp),%eax
+     5fc:	8d 50 03             	lea    0x3(%eax),%edx
+     5ff:	85 c0                	test   %eax,%eax
+     601:	0f 48 c2             	cmovs  %edx,%eax
+     604:	c1 f8 02             	sar    $0x2,%eax
+     607:	50                   	push   %eax
+     608:	ff 75 f8             	push   -0x8(%ebp)
+     60b:	ff 75 fc             	push   -0x4(%ebp)
+     60e:	e8 cd fa ff ff       	call   e0 <movsl>
+     613:	83 c4 0c             	add    $0xc,%esp
+      d += n & ~3;
+     616:	8b 45 10             	mov    0x10(%ebp),%eax
+     619:	83 e0 fc             	and    $0xfffffffc,%eax
+     61c:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += n & ~3;
+     61f:	8b 45 10             	mov    0x10(%ebp),%eax
+     622:	83 e0 fc             	and    $0xfffffffc,%eax
+     625:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n &= 3;
+     628:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+    }
+    movsb(d, s, n);
+     62c:	ff 75 10             	push   0x10(%ebp)
+     62f:	ff 75 f8             	push   -0x8(%ebp)
+     632:	ff 75 fc             	push   -0x4(%ebp)
+     635:	e8 77 fa ff ff       	call   b1 <movsb>
+     63a:	83 c4 0c             	add    $0xc,%esp
+  }
+  return vdst;
+     63d:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     640:	c9                   	leave
+     641:	c3                   	ret
+
+00000642 <_fork>:
+    movl %esp, %ecx; \
+    movl $1f, %edx; \
+    sysenter; \
+  1: ret
+
+RAWSYSCALL(fork)
+     642:	b8 01 00 00 00       	mov    $0x1,%eax
+     647:	89 e1                	mov    %esp,%ecx
+     649:	ba 50 06 00 00       	mov    $0x650,%edx
+     64e:	0f 34                	sysenter
+     650:	c3                   	ret
+
+00000651 <_exit>:
+RAWSYSCALL(exit)
+     651:	b8 02 00 00 00       	mov    $0x2,%eax
+     656:	89 e1                	mov    %esp,%ecx
+     658:	ba 5f 06 00 00       	mov    $0x65f,%edx
+     65d:	0f 34                	sysenter
+     65f:	c3                   	ret
+
+00000660 <wait>:
+SYSCALL(wait)
+     660:	b8 03 00 00 00       	mov    $0x3,%eax
+     665:	89 e1                	mov    %esp,%ecx
+     667:	ba 6e 06 00 00       	mov    $0x66e,%edx
+     66c:	0f 34                	sysenter
+     66e:	c3                   	ret
+
+0000066f <pipe>:
+SYSCALL(pipe)
+     66f:	b8 04 00 00 00       	mov    $0x4,%eax
+     674:	89 e1                	mov    %esp,%ecx
+     676:	ba 7d 06 00 00       	mov    $0x67d,%edx
+     67b:	0f 34                	sysenter
+     67d:	c3                   	ret
+
+0000067e <read>:
+SYSCALL(read)
+     67e:	b8 05 00 00 00       	mov    $0x5,%eax
+     683:	89 e1                	mov    %esp,%ecx
+     685:	ba 8c 06 00 00       	mov    $0x68c,%edx
+     68a:	0f 34                	sysenter
+     68c:	c3                   	ret
+
+0000068d <write>:
+SYSCALL(write)
+     68d:	b8 10 00 00 00       	mov    $0x10,%eax
+     692:	89 e1                	mov    %esp,%ecx
+     694:	ba 9b 06 00 00       	mov    $0x69b,%edx
+     699:	0f 34                	sysenter
+     69b:	c3                   	ret
+
+0000069c <_close>:
+RAWSYSCALL(close)
+     69c:	b8 15 00 00 00       	mov    $0x15,%eax
+     6a1:	89 e1                	mov    %esp,%ecx
+     6a3:	ba aa 06 00 00       	mov    $0x6aa,%edx
+     6a8:	0f 34                	sysenter
+     6aa:	c3                   	ret
+
+000006ab <kill>:
+SYSCALL(kill)
+     6ab:	b8 06 00 00 00       	mov    $0x6,%eax
+     6b0:	89 e1                	mov    %esp,%ecx
+     6b2:	ba b9 06 00 00       	mov    $0x6b9,%edx
+     6b7:	0f 34                	sysenter
+     6b9:	c3                   	ret
+
+000006ba <_exec>:
+RAWSYSCALL(exec)
+     6ba:	b8 07 00 00 00       	mov    $0x7,%eax
+     6bf:	89 e1                	mov    %esp,%ecx
+     6c1:	ba c8 06 00 00       	mov    $0x6c8,%edx
+     6c6:	0f 34                	sysenter
+     6c8:	c3                   	ret
+
+000006c9 <open>:
+SYSCALL(open)
+     6c9:	b8 0f 00 00 00       	mov    $0xf,%eax
+     6ce:	89 e1                	mov    %esp,%ecx
+     6d0:	ba d7 06 00 00       	mov    $0x6d7,%edx
+     6d5:	0f 34                	sysenter
+     6d7:	c3                   	ret
+
+000006d8 <mknod>:
+SYSCALL(mknod)
+     6d8:	b8 11 00 00 00       	mov    $0x11,%eax
+     6dd:	89 e1                	mov    %esp,%ecx
+     6df:	ba e6 06 00 00       	mov    $0x6e6,%edx
+     6e4:	0f 34                	sysenter
+     6e6:	c3                   	ret
+
+000006e7 <unlink>:
+SYSCALL(unlink)
+     6e7:	b8 12 00 00 00       	mov    $0x12,%eax
+     6ec:	89 e1                	mov    %esp,%ecx
+     6ee:	ba f5 06 00 00       	mov    $0x6f5,%edx
+     6f3:	0f 34                	sysenter
+     6f5:	c3                   	ret
+
+000006f6 <fstat>:
+SYSCALL(fstat)
+     6f6:	b8 08 00 00 00       	mov    $0x8,%eax
+     6fb:	89 e1                	mov    %esp,%ecx
+     6fd:	ba 04 07 00 00       	mov    $0x704,%edx
+     702:	0f 34                	sysenter
+     704:	c3                   	ret
+
+00000705 <link>:
+SYSCALL(link)
+     705:	b8 13 00 00 00       	mov    $0x13,%eax
+     70a:	89 e1                	mov    %esp,%ecx
+     70c:	ba 13 07 00 00       	mov    $0x713,%edx
+     711:	0f 34                	sysenter
+     713:	c3                   	ret
+
+00000714 <mkdir>:
+SYSCALL(mkdir)
+     714:	b8 14 00 00 00       	mov    $0x14,%eax
+     719:	89 e1                	mov    %esp,%ecx
+     71b:	ba 22 07 00 00       	mov    $0x722,%edx
+     720:	0f 34                	sysenter
+     722:	c3                   	ret
+
+00000723 <chdir>:
+SYSCALL(chdir)
+     723:	b8 09 00 00 00       	mov    $0x9,%eax
+     728:	89 e1                	mov    %esp,%ecx
+     72a:	ba 31 07 00 00       	mov    $0x731,%edx
+     72f:	0f 34                	sysenter
+     731:	c3                   	ret
+
+00000732 <dup>:
+SYSCALL(dup)
+     732:	b8 0a 00 00 00       	mov    $0xa,%eax
+     737:	89 e1                	mov    %esp,%ecx
+     739:	ba 40 07 00 00       	mov    $0x740,%edx
+     73e:	0f 34                	sysenter
+     740:	c3                   	ret
+
+00000741 <getpid>:
+SYSCALL(getpid)
+     741:	b8 0b 00 00 00       	mov    $0xb,%eax
+     746:	89 e1                	mov    %esp,%ecx
+     748:	ba 4f 07 00 00       	mov    $0x74f,%edx
+     74d:	0f 34                	sysenter
+     74f:	c3                   	ret
+
+00000750 <sbrk>:
+SYSCALL(sbrk)
+     750:	b8 0c 00 00 00       	mov    $0xc,%eax
+     755:	89 e1                	mov    %esp,%ecx
+     757:	ba 5e 07 00 00       	mov    $0x75e,%edx
+     75c:	0f 34                	sysenter
+     75e:	c3                   	ret
+
+0000075f <sleep>:
+SYSCALL(sleep)
+     75f:	b8 0d 00 00 00       	mov    $0xd,%eax
+     764:	89 e1                	mov    %esp,%ecx
+     766:	ba 6d 07 00 00       	mov    $0x76d,%edx
+     76b:	0f 34                	sysenter
+     76d:	c3                   	ret
+
+0000076e <uptime>:
+SYSCALL(uptime)
+     76e:	b8 0e 00 00 00       	mov    $0xe,%eax
+     773:	89 e1                	mov    %esp,%ecx
+     775:	ba 7c 07 00 00       	mov    $0x77c,%edx
+     77a:	0f 34                	sysenter
+     77c:	c3                   	ret
+
+0000077d <getproc>:
+SYSCALL(getproc)
+     77d:	b8 16 00 00 00       	mov    $0x16,%eax
+     782:	89 e1                	mov    %esp,%ecx
+     784:	ba 8b 07 00 00       	mov    $0x78b,%edx
+     789:	0f 34                	sysenter
+     78b:	c3                   	ret
+
+0000078c <getpgs>:
+SYSCALL(getpgs)
+     78c:	b8 17 00 00 00       	mov    $0x17,%eax
+     791:	89 e1                	mov    %esp,%ecx
+     793:	ba 9a 07 00 00       	mov    $0x79a,%edx
+     798:	0f 34                	sysenter
+     79a:	c3                   	ret
+
+0000079b <loadproc>:
+SYSCALL(loadproc)
+     79b:	b8 18 00 00 00       	mov    $0x18,%eax
+     7a0:	89 e1                	mov    %esp,%ecx
+     7a2:	ba a9 07 00 00       	mov    $0x7a9,%edx
+     7a7:	0f 34                	sysenter
+     7a9:	c3                   	ret
+
+000007aa <iosubmit>:
+SYSCALL(iosubmit)
+     7aa:	b8 19 00 00 00       	mov    $0x19,%eax
+     7af:	89 e1                	mov    %esp,%ecx
+     7b1:	ba b8 07 00 00       	mov    $0x7b8,%edx
+     7b6:	0f 34                	sysenter
+     7b8:	c3                   	ret
+
+000007b9 <sysstat>:
+SYSCALL(sysstat)
+     7b9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     7be:	89 e1                	mov    %esp,%ecx
+     7c0:	ba c7 07 00 00       	mov    $0x7c7,%edx
+     7c5:	0f 34                	sysenter
+     7c7:	c3                   	ret
+
+000007c8 <splice>:
+SYSCALL(splice)
+     7c8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     7cd:	89 e1                	mov    %esp,%ecx
+     7cf:	ba d6 07 00 00       	mov    $0x7d6,%edx
+     7d4:	0f 34                	sysenter
+     7d6:	c3                   	ret
+
+000007d7 <fsync>:
+SYSCALL(fsync)
+     7d7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     7dc:	89 e1                	mov    %esp,%ecx
+     7de:	ba e5 07 00 00       	mov    $0x7e5,%edx
+     7e3:	0f 34                	sysenter
+     7e5:	c3                   	ret
+
+000007e6 <fdatasync>:
+SYSCALL(fdatasync)
+     7e6:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     7eb:	89 e1                	mov    %esp,%ecx
+     7ed:	ba f4 07 00 00       	mov    $0x7f4,%edx
+     7f2:	0f 34                	sysenter
+     7f4:	c3                   	ret
+
+000007f5 <lseek>:
+SYSCALL(lseek)
+     7f5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     7fa:	89 e1                	mov    %esp,%ecx
+     7fc:	ba 03 08 00 00       	mov    $0x803,%edx
+     801:	0f 34                	sysenter
+     803:	c3                   	ret
+
+00000804 <dmesg>:
+SYSCALL(dmesg)
+     804:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     809:	89 e1                	mov    %esp,%ecx
+     80b:	ba 12 08 00 00       	mov    $0x812,%edx
+     810:	0f 34                	sysenter
+     812:	c3                   	ret
+
+00000813 <lockstat>:
+SYSCALL(lockstat)
+     813:	b8 20 00 00 00       	mov    $0x20,%eax
+     818:	89 e1                	mov    %esp,%ecx
+     81a:	ba 21 08 00 00       	mov    $0x821,%edx
+     81f:	0f 34                	sysenter
+     821:	c3                   	ret
+
+00000822 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     822:	55                   	push   %ebp
+     823:	89 e5                	mov    %esp,%ebp
+     825:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     828:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     82f:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     833:	74 17                	je     84c <printint+0x2a>
+     835:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     839:	79 11                	jns    84c <printint+0x2a>
+    neg = 1;
+     83b:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     842:	8b 45 0c             	mov    0xc(%ebp),%eax
+     845:	f7 d8                	neg    %eax
+     847:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     84a:	eb 06                	jmp    852 <printint+0x30>
+  } else {
+    x = xx;
+     84c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     84f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     852:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     859:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     85c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     85f:	ba 00 00 00 00       	mov    $0x0,%edx
+     864:	f7 f1                	div    %ecx
+     866:	89 d1                	mov    %edx,%ecx
+     868:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     86b:	8d 50 01             	lea    0x1(%eax),%edx
+     86e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     871:	0f b6 91 9c 18 00 00 	movzbl 0x189c(%ecx),%edx
+     878:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     87c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     87f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     882:	ba 00 00 00 00       	mov    $0x0,%edx
+     887:	f7 f1                	div    %ecx
+     889:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     88c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     890:	75 c7                	jne    859 <printint+0x37>
+  if(neg)
+     892:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     896:	74 2d                	je     8c5 <printint+0xa3>
+    buf[i++] = '-';
+     898:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     89b:	8d 50 01             	lea    0x1(%eax),%edx
+     89e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     8a1:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+     8a6:	eb 1d                	jmp    8c5 <printint+0xa3>
+    fputc(fd, buf[i]);
+     8a8:	8d 55 dc             	lea    -0x24(%ebp),%edx
+     8ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8ae:	01 d0                	add    %edx,%eax
+     8b0:	0f b6 00             	movzbl (%eax),%eax
+     8b3:	0f be c0             	movsbl %al,%eax
+     8b6:	83 ec 08             	sub    $0x8,%esp
+     8b9:	50                   	push   %eax
+     8ba:	ff 75 08             	push   0x8(%ebp)
+     8bd:	e8 f8 08 00 00       	call   11ba <fputc>
+     8c2:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+     8c5:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     8c9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     8cd:	79 d9                	jns    8a8 <printint+0x86>
+}
+     8cf:	90                   	nop
+     8d0:	90                   	nop
+     8d1:	c9                   	leave
+     8d2:	c3                   	ret
+
+000008d3 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     8d3:	55                   	push   %ebp
+     8d4:	89 e5                	mov    %esp,%ebp
+     8d6:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+     8d9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     8e0:	8d 45 0c             	lea    0xc(%ebp),%eax
+     8e3:	83 c0 04             	add    $0x4,%eax
+     8e6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+     8e9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     8f0:	e9 4a 01 00 00       	jmp    a3f <printf+0x16c>
+    c = fmt[i] & 0xff;
+     8f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+     8f8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     8fb:	01 d0                	add    %edx,%eax
+     8fd:	0f b6 00             	movzbl (%eax),%eax
+     900:	0f be c0             	movsbl %al,%eax
+     903:	25 ff 00 00 00       	and    $0xff,%eax
+     908:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+     90b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     90f:	75 28                	jne    939 <printf+0x66>
+      if(c == '%'){
+     911:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     915:	75 0c                	jne    923 <printf+0x50>
+        state = '%';
+     917:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+     91e:	e9 18 01 00 00       	jmp    a3b <printf+0x168>
+      } else {
+        fputc(fd, c);
+     923:	83 ec 08             	sub    $0x8,%esp
+     926:	ff 75 e4             	push   -0x1c(%ebp)
+     929:	ff 75 08             	push   0x8(%ebp)
+     92c:	e8 89 08 00 00       	call   11ba <fputc>
+     931:	83 c4 10             	add    $0x10,%esp
+     934:	e9 02 01 00 00       	jmp    a3b <printf+0x168>
+      }
+    } else if(state == '%'){
+     939:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+     93d:	0f 85 f8 00 00 00    	jne    a3b <printf+0x168>
+      if(c == 'd'){
+     943:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+     947:	75 1e                	jne    967 <printf+0x94>
+        printint(fd, *ap, 10, 1);
+     949:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     94c:	8b 00                	mov    (%eax),%eax
+     94e:	6a 01                	push   $0x1
+     950:	6a 0a                	push   $0xa
+     952:	50                   	push   %eax
+     953:	ff 75 08             	push   0x8(%ebp)
+     956:	e8 c7 fe ff ff       	call   822 <printint>
+     95b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     95e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     962:	e9 cd 00 00 00       	jmp    a34 <printf+0x161>
+      } else if(c == 'x' || c == 'p'){
+     967:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+     96b:	74 06                	je     973 <printf+0xa0>
+     96d:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+     971:	75 1e                	jne    991 <printf+0xbe>
+        printint(fd, *ap, 16, 0);
+     973:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     976:	8b 00                	mov    (%eax),%eax
+     978:	6a 00                	push   $0x0
+     97a:	6a 10                	push   $0x10
+     97c:	50                   	push   %eax
+     97d:	ff 75 08             	push   0x8(%ebp)
+     980:	e8 9d fe ff ff       	call   822 <printint>
+     985:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     988:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     98c:	e9 a3 00 00 00       	jmp    a34 <printf+0x161>
+      } else if(c == 's'){
+     991:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+     995:	75 43                	jne    9da <printf+0x107>
+        s = (char*)*ap;
+     997:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     99a:	8b 00                	mov    (%eax),%eax
+     99c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     99f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+     9a3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     9a7:	75 25                	jne    9ce <printf+0xfb>
+          s = "(null)";
+     9a9:	c7 45 f4 f0 13 00 00 	movl   $0x13f0,-0xc(%ebp)
+        while(*s != 0){
+     9b0:	eb 1c                	jmp    9ce <printf+0xfb>
+          fputc(fd, *s);
+     9b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9b5:	0f b6 00             	movzbl (%eax),%eax
+     9b8:	0f be c0             	movsbl %al,%eax
+     9bb:	83 ec 08             	sub    $0x8,%esp
+     9be:	50                   	push   %eax
+     9bf:	ff 75 08             	push   0x8(%ebp)
+     9c2:	e8 f3 07 00 00       	call   11ba <fputc>
+     9c7:	83 c4 10             	add    $0x10,%esp
+          s++;
+     9ca:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+     9ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9d1:	0f b6 00             	movzbl (%eax),%eax
+     9d4:	84 c0                	test   %al,%al
+     9d6:	75 da                	jne    9b2 <printf+0xdf>
+     9d8:	eb 5a                	jmp    a34 <printf+0x161>
+        }
+      } else if(c == 'c'){
+     9da:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+     9de:	75 1a                	jne    9fa <printf+0x127>
+        fputc(fd, *ap);
+     9e0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     9e3:	8b 00                	mov    (%eax),%eax
+     9e5:	83 ec 08             	sub    $0x8,%esp
+     9e8:	50                   	push   %eax
+     9e9:	ff 75 08             	push   0x8(%ebp)
+     9ec:	e8 c9 07 00 00       	call   11ba <fputc>
+     9f1:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     9f4:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     9f8:	eb 3a                	jmp    a34 <printf+0x161>
+      } else if(c == '%'){
+     9fa:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     9fe:	75 13                	jne    a13 <printf+0x140>
+        fputc(fd, c);
+     a00:	83 ec 08             	sub    $0x8,%esp
+     a03:	ff 75 e4             	push   -0x1c(%ebp)
+     a06:	ff 75 08             	push   0x8(%ebp)
+     a09:	e8 ac 07 00 00       	call   11ba <fputc>
+     a0e:	83 c4 10             	add    $0x10,%esp
+     a11:	eb 21                	jmp    a34 <printf+0x161>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        fputc(fd, '%');
+     a13:	83 ec 08             	sub    $0x8,%esp
+     a16:	6a 25                	push   $0x25
+     a18:	ff 75 08             	push   0x8(%ebp)
+     a1b:	e8 9a 07 00 00       	call   11ba <fputc>
+     a20:	83 c4 10             	add    $0x10,%esp
+        fputc(fd, c);
+     a23:	83 ec 08             	sub    $0x8,%esp
+     a26:	ff 75 e4             	push   -0x1c(%ebp)
+     a29:	ff 75 08             	push   0x8(%ebp)
+     a2c:	e8 89 07 00 00       	call   11ba <fputc>
+     a31:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     a34:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     a3b:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     a3f:	8b 55 0c             	mov    0xc(%ebp),%edx
+     a42:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a45:	01 d0                	add    %edx,%eax
+     a47:	0f b6 00             	movzbl (%eax),%eax
+     a4a:	84 c0                	test   %al,%al
+     a4c:	0f 85 a3 fe ff ff    	jne    8f5 <printf+0x22>
+    }
+  }
+}
+     a52:	90                   	nop
+     a53:	90                   	nop
+     a54:	c9                   	leave
+     a55:	c3                   	ret
+
+00000a56 <binof>:
+static struct chunk *bins[NBIN];       // free large chunks
+static struct chunk *top;              // end marker of newest heap segment
+
+static int
+binof(uint size)
+{
+     a56:	55                   	push   %ebp
+     a57:	89 e5                	mov    %esp,%ebp
+     a59:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  i = 0;
+     a5c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     a63:	c1 6d 08 05          	shrl   $0x5,0x8(%ebp)
+     a67:	eb 07                	jmp    a70 <binof+0x1a>
+    i++;
+     a69:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     a6d:	d1 6d 08             	shrl   0x8(%ebp)
+     a70:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     a74:	74 06                	je     a7c <binof+0x26>
+     a76:	83 7d fc 19          	cmpl   $0x19,-0x4(%ebp)
+     a7a:	7e ed                	jle    a69 <binof+0x13>
+  return i;
+     a7c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     a7f:	c9                   	leave
+     a80:	c3                   	ret
+
+00000a81 <bininsert>:
+
+static void
+bininsert(struct chunk *c)
+{
+     a81:	55                   	push   %ebp
+     a82:	89 e5                	mov    %esp,%ebp
+     a84:	83 ec 10             	sub    $0x10,%esp
+  struct chunk **b;
+
+  b = &bins[binof(CSIZE(c))];
+     a87:	8b 45 08             	mov    0x8(%ebp),%eax
+     a8a:	8b 00                	mov    (%eax),%eax
+     a8c:	83 e0 f8             	and    $0xfffffff8,%eax
+     a8f:	50                   	push   %eax
+     a90:	e8 c1 ff ff ff       	call   a56 <binof>
+     a95:	83 c4 04             	add    $0x4,%esp
+     a98:	c1 e0 02             	shl    $0x2,%eax
+     a9b:	05 e0 18 00 00       	add    $0x18e0,%eax
+     aa0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c->prev = 0;
+     aa3:	8b 45 08             	mov    0x8(%ebp),%eax
+     aa6:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  c->next = *b;
+     aad:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ab0:	8b 10                	mov    (%eax),%edx
+     ab2:	8b 45 08             	mov    0x8(%ebp),%eax
+     ab5:	89 50 08             	mov    %edx,0x8(%eax)
+  if(*b)
+     ab8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     abb:	8b 00                	mov    (%eax),%eax
+     abd:	85 c0                	test   %eax,%eax
+     abf:	74 0b                	je     acc <bininsert+0x4b>
+    (*b)->prev = c;
+     ac1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ac4:	8b 00                	mov    (%eax),%eax
+     ac6:	8b 55 08             	mov    0x8(%ebp),%edx
+     ac9:	89 50 0c             	mov    %edx,0xc(%eax)
+  *b = c;
+     acc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     acf:	8b 55 08             	mov    0x8(%ebp),%edx
+     ad2:	89 10                	mov    %edx,(%eax)
+}
+     ad4:	90                   	nop
+     ad5:	c9                   	leave
+     ad6:	c3                   	ret
+
+00000ad7 <binremove>:
+
+static void
+binremove(struct chunk *c)
+{
+     ad7:	55                   	push   %ebp
+     ad8:	89 e5                	mov    %esp,%ebp
+  if(c->prev)
+     ada:	8b 45 08             	mov    0x8(%ebp),%eax
+     add:	8b 40 0c             	mov    0xc(%eax),%eax
+     ae0:	85 c0                	test   %eax,%eax
+     ae2:	74 11                	je     af5 <binremove+0x1e>
+    c->prev->next = c->next;
+     ae4:	8b 45 08             	mov    0x8(%ebp),%eax
+     ae7:	8b 40 0c             	mov    0xc(%eax),%eax
+     aea:	8b 55 08             	mov    0x8(%ebp),%edx
+     aed:	8b 52 08             	mov    0x8(%edx),%edx
+     af0:	89 50 08             	mov    %edx,0x8(%eax)
+     af3:	eb 1e                	jmp    b13 <binremove+0x3c>
+  else
+    bins[binof(CSIZE(c))] = c->next;
+     af5:	8b 45 08             	mov    0x8(%ebp),%eax
+     af8:	8b 00                	mov    (%eax),%eax
+     afa:	83 e0 f8             	and    $0xfffffff8,%eax
+     afd:	50                   	push   %eax
+     afe:	e8 53 ff ff ff       	call   a56 <binof>
+     b03:	83 c4 04             	add    $0x4,%esp
+     b06:	8b 55 08             	mov    0x8(%ebp),%edx
+     b09:	8b 52 08             	mov    0x8(%edx),%edx
+     b0c:	89 14 85 e0 18 00 00 	mov    %edx,0x18e0(,%eax,4)
+  if(c->next)
+     b13:	8b 45 08             	mov    0x8(%ebp),%eax
+     b16:	8b 40 08             	mov    0x8(%eax),%eax
+     b19:	85 c0                	test   %eax,%eax
+     b1b:	74 0f                	je     b2c <binremove+0x55>
+    c->next->prev = c->prev;
+     b1d:	8b 45 08             	mov    0x8(%ebp),%eax
+     b20:	8b 40 08             	mov    0x8(%eax),%eax
+     b23:	8b 55 08             	mov    0x8(%ebp),%edx
+     b26:	8b 52 0c             	mov    0xc(%edx),%edx
+     b29:	89 50 0c             	mov    %edx,0xc(%eax)
+}
+     b2c:	90                   	nop
+     b2d:	c9                   	leave
+     b2e:	c3                   	ret
+
+00000b2f <freechunk>:
+
+// Free chunk c, merging it with free neighbors.  If trim is
+// set and the result is big and at the break, give it back.
+static void
+freechunk(struct chunk *c, int trim)
+{
+     b2f:	55                   	push   %ebp
+     b30:	89 e5                	mov    %esp,%ebp
+     b32:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *p, *n;
+  uint size;
+
+  size = CSIZE(c);
+     b35:	8b 45 08             	mov    0x8(%ebp),%eax
+     b38:	8b 00                	mov    (%eax),%eax
+     b3a:	83 e0 f8             	and    $0xfffffff8,%eax
+     b3d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  n = NEXTC(c);
+     b40:	8b 45 08             	mov    0x8(%ebp),%eax
+     b43:	8b 00                	mov    (%eax),%eax
+     b45:	83 e0 f8             	and    $0xfffffff8,%eax
+     b48:	89 c2                	mov    %eax,%edx
+     b4a:	8b 45 08             	mov    0x8(%ebp),%eax
+     b4d:	01 d0                	add    %edx,%eax
+     b4f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(!(c->size & PREVUSED)){
+     b52:	8b 45 08             	mov    0x8(%ebp),%eax
+     b55:	8b 00                	mov    (%eax),%eax
+     b57:	83 e0 02             	and    $0x2,%eax
+     b5a:	85 c0                	test   %eax,%eax
+     b5c:	75 30                	jne    b8e <freechunk+0x5f>
+    p = (struct chunk*)((char*)c - *((uint*)c - 1));
+     b5e:	8b 45 08             	mov    0x8(%ebp),%eax
+     b61:	83 e8 04             	sub    $0x4,%eax
+     b64:	8b 00                	mov    (%eax),%eax
+     b66:	f7 d8                	neg    %eax
+     b68:	89 c2                	mov    %eax,%edx
+     b6a:	8b 45 08             	mov    0x8(%ebp),%eax
+     b6d:	01 d0                	add    %edx,%eax
+     b6f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    binremove(p);
+     b72:	ff 75 ec             	push   -0x14(%ebp)
+     b75:	e8 5d ff ff ff       	call   ad7 <binremove>
+     b7a:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(p);
+     b7d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b80:	8b 00                	mov    (%eax),%eax
+     b82:	83 e0 f8             	and    $0xfffffff8,%eax
+     b85:	01 45 f4             	add    %eax,-0xc(%ebp)
+    c = p;
+     b88:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b8b:	89 45 08             	mov    %eax,0x8(%ebp)
+  }
+  if(!(n->size & USED)){
+     b8e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b91:	8b 00                	mov    (%eax),%eax
+     b93:	83 e0 01             	and    $0x1,%eax
+     b96:	85 c0                	test   %eax,%eax
+     b98:	75 16                	jne    bb0 <freechunk+0x81>
+    binremove(n);
+     b9a:	ff 75 f0             	push   -0x10(%ebp)
+     b9d:	e8 35 ff ff ff       	call   ad7 <binremove>
+     ba2:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(n);
+     ba5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ba8:	8b 00                	mov    (%eax),%eax
+     baa:	83 e0 f8             	and    $0xfffffff8,%eax
+     bad:	01 45 f4             	add    %eax,-0xc(%ebp)
+  }
+  // Free chunks are never adjacent, so the one below is in use.
+  c->size = size | PREVUSED;
+     bb0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     bb3:	83 c8 02             	or     $0x2,%eax
+     bb6:	89 c2                	mov    %eax,%edx
+     bb8:	8b 45 08             	mov    0x8(%ebp),%eax
+     bbb:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+     bbd:	8b 45 08             	mov    0x8(%ebp),%eax
+     bc0:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  FOOTER(c) = size;
+     bc7:	8b 45 08             	mov    0x8(%ebp),%eax
+     bca:	8b 00                	mov    (%eax),%eax
+     bcc:	83 e0 f8             	and    $0xfffffff8,%eax
+     bcf:	8d 50 fc             	lea    -0x4(%eax),%edx
+     bd2:	8b 45 08             	mov    0x8(%ebp),%eax
+     bd5:	01 c2                	add    %eax,%edx
+     bd7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     bda:	89 02                	mov    %eax,(%edx)
+  n = NEXTC(c);
+     bdc:	8b 45 08             	mov    0x8(%ebp),%eax
+     bdf:	8b 00                	mov    (%eax),%eax
+     be1:	83 e0 f8             	and    $0xfffffff8,%eax
+     be4:	89 c2                	mov    %eax,%edx
+     be6:	8b 45 08             	mov    0x8(%ebp),%eax
+     be9:	01 d0                	add    %edx,%eax
+     beb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  n->size &= ~PREVUSED;
+     bee:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bf1:	8b 00                	mov    (%eax),%eax
+     bf3:	83 e0 fd             	and    $0xfffffffd,%eax
+     bf6:	89 c2                	mov    %eax,%edx
+     bf8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bfb:	89 10                	mov    %edx,(%eax)
+
+  if(trim && n == top && size >= TRIMSIZE && sbrk(0) == (char*)top + HDRSIZE){
+     bfd:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     c01:	74 51                	je     c54 <freechunk+0x125>
+     c03:	a1 4c 19 00 00       	mov    0x194c,%eax
+     c08:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     c0b:	75 47                	jne    c54 <freechunk+0x125>
+     c0d:	81 7d f4 ff 7f 00 00 	cmpl   $0x7fff,-0xc(%ebp)
+     c14:	76 3e                	jbe    c54 <freechunk+0x125>
+     c16:	83 ec 0c             	sub    $0xc,%esp
+     c19:	6a 00                	push   $0x0
+     c1b:	e8 30 fb ff ff       	call   750 <sbrk>
+     c20:	83 c4 10             	add    $0x10,%esp
+     c23:	8b 15 4c 19 00 00    	mov    0x194c,%edx
+     c29:	83 c2 08             	add    $0x8,%edx
+     c2c:	39 d0                	cmp    %edx,%eax
+     c2e:	75 24                	jne    c54 <freechunk+0x125>
+    c->size = USED | PREVUSED;
+     c30:	8b 45 08             	mov    0x8(%ebp),%eax
+     c33:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+    top = c;
+     c39:	8b 45 08             	mov    0x8(%ebp),%eax
+     c3c:	a3 4c 19 00 00       	mov    %eax,0x194c
+    sbrk(-size);
+     c41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c44:	f7 d8                	neg    %eax
+     c46:	83 ec 0c             	sub    $0xc,%esp
+     c49:	50                   	push   %eax
+     c4a:	e8 01 fb ff ff       	call   750 <sbrk>
+     c4f:	83 c4 10             	add    $0x10,%esp
+    return;
+     c52:	eb 0e                	jmp    c62 <freechunk+0x133>
+  }
+  bininsert(c);
+     c54:	83 ec 0c             	sub    $0xc,%esp
+     c57:	ff 75 08             	push   0x8(%ebp)
+     c5a:	e8 22 fe ff ff       	call   a81 <bininsert>
+     c5f:	83 c4 10             	add    $0x10,%esp
+}
+     c62:	c9                   	leave
+     c63:	c3                   	ret
+
+00000c64 <morecore>:
+
+// Grow the heap by at least need bytes.
+static int
+morecore(uint need)
+{
+     c64:	55                   	push   %ebp
+     c65:	89 e5                	mov    %esp,%ebp
+     c67:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+  char *p;
+  uint n, pad;
+
+  n = need + MINCHUNK;
+     c6a:	8b 45 08             	mov    0x8(%ebp),%eax
+     c6d:	83 c0 18             	add    $0x18,%eax
+     c70:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(n < MINCORE)
+     c73:	81 7d ec ff 3f 00 00 	cmpl   $0x3fff,-0x14(%ebp)
+     c7a:	77 07                	ja     c83 <morecore+0x1f>
+    n = MINCORE;
+     c7c:	c7 45 ec 00 40 00 00 	movl   $0x4000,-0x14(%ebp)
+  // Keep the break 8-aligned, with the end marker just below it.
+  pad = (8 - ((uint)sbrk(0) & 7)) & 7;
+     c83:	83 ec 0c             	sub    $0xc,%esp
+     c86:	6a 00                	push   $0x0
+     c88:	e8 c3 fa ff ff       	call   750 <sbrk>
+     c8d:	83 c4 10             	add    $0x10,%esp
+     c90:	83 e0 07             	and    $0x7,%eax
+     c93:	ba 08 00 00 00       	mov    $0x8,%edx
+     c98:	29 c2                	sub    %eax,%edx
+     c9a:	89 d0                	mov    %edx,%eax
+     c9c:	83 e0 07             	and    $0x7,%eax
+     c9f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if((p = sbrk(pad + n)) == (char*)-1){
+     ca2:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     ca5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     ca8:	01 d0                	add    %edx,%eax
+     caa:	83 ec 0c             	sub    $0xc,%esp
+     cad:	50                   	push   %eax
+     cae:	e8 9d fa ff ff       	call   750 <sbrk>
+     cb3:	83 c4 10             	add    $0x10,%esp
+     cb6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     cb9:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     cbd:	75 30                	jne    cef <morecore+0x8b>
+    n = need + MINCHUNK;
+     cbf:	8b 45 08             	mov    0x8(%ebp),%eax
+     cc2:	83 c0 18             	add    $0x18,%eax
+     cc5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((p = sbrk(pad + n)) == (char*)-1)
+     cc8:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     ccb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     cce:	01 d0                	add    %edx,%eax
+     cd0:	83 ec 0c             	sub    $0xc,%esp
+     cd3:	50                   	push   %eax
+     cd4:	e8 77 fa ff ff       	call   750 <sbrk>
+     cd9:	83 c4 10             	add    $0x10,%esp
+     cdc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     cdf:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     ce3:	75 0a                	jne    cef <morecore+0x8b>
+      return -1;
+     ce5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     cea:	e9 8e 00 00 00       	jmp    d7d <morecore+0x119>
+  }
+  p += pad;
+     cef:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     cf2:	01 45 f0             	add    %eax,-0x10(%ebp)
+  if(top && p == (char*)top + HDRSIZE){
+     cf5:	a1 4c 19 00 00       	mov    0x194c,%eax
+     cfa:	85 c0                	test   %eax,%eax
+     cfc:	74 29                	je     d27 <morecore+0xc3>
+     cfe:	a1 4c 19 00 00       	mov    0x194c,%eax
+     d03:	83 c0 08             	add    $0x8,%eax
+     d06:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     d09:	75 1c                	jne    d27 <morecore+0xc3>
+    // Contiguous: the old end marker heads the new chunk.
+    c = top;
+     d0b:	a1 4c 19 00 00       	mov    0x194c,%eax
+     d10:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = n | (c->size & PREVUSED);
+     d13:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d16:	8b 00                	mov    (%eax),%eax
+     d18:	83 e0 02             	and    $0x2,%eax
+     d1b:	0b 45 ec             	or     -0x14(%ebp),%eax
+     d1e:	89 c2                	mov    %eax,%edx
+     d20:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d23:	89 10                	mov    %edx,(%eax)
+     d25:	eb 16                	jmp    d3d <morecore+0xd9>
+  } else {
+    // Someone else moved the break: start a new segment.
+    c = (struct chunk*)p;
+     d27:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d2a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = (n - HDRSIZE) | PREVUSED;
+     d2d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     d30:	83 e8 08             	sub    $0x8,%eax
+     d33:	83 c8 02             	or     $0x2,%eax
+     d36:	89 c2                	mov    %eax,%edx
+     d38:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d3b:	89 10                	mov    %edx,(%eax)
+  }
+  top = NEXTC(c);
+     d3d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d40:	8b 00                	mov    (%eax),%eax
+     d42:	83 e0 f8             	and    $0xfffffff8,%eax
+     d45:	89 c2                	mov    %eax,%edx
+     d47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d4a:	01 d0                	add    %edx,%eax
+     d4c:	a3 4c 19 00 00       	mov    %eax,0x194c
+  top->size = USED;
+     d51:	a1 4c 19 00 00       	mov    0x194c,%eax
+     d56:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  top->tag = LARGE;
+     d5c:	a1 4c 19 00 00       	mov    0x194c,%eax
+     d61:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  freechunk(c, 0);
+     d68:	83 ec 08             	sub    $0x8,%esp
+     d6b:	6a 00                	push   $0x0
+     d6d:	ff 75 f4             	push   -0xc(%ebp)
+     d70:	e8 ba fd ff ff       	call   b2f <freechunk>
+     d75:	83 c4 10             	add    $0x10,%esp
+  return 0;
+     d78:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     d7d:	c9                   	leave
+     d7e:	c3                   	ret
+
+00000d7f <largealloc>:
+
+static void*
+largealloc(uint nbytes)
+{
+     d7f:	55                   	push   %ebp
+     d80:	89 e5                	mov    %esp,%ebp
+     d82:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c, *r;
+  uint need;
+  int i;
+
+  if(nbytes > 0x7fffffff)
+     d85:	8b 45 08             	mov    0x8(%ebp),%eax
+     d88:	85 c0                	test   %eax,%eax
+     d8a:	79 0a                	jns    d96 <largealloc+0x17>
+    return 0;
+     d8c:	b8 00 00 00 00       	mov    $0x0,%eax
+     d91:	e9 43 01 00 00       	jmp    ed9 <largealloc+0x15a>
+  need = (nbytes + HDRSIZE + 7) & ~7;
+     d96:	8b 45 08             	mov    0x8(%ebp),%eax
+     d99:	83 c0 0f             	add    $0xf,%eax
+     d9c:	83 e0 f8             	and    $0xfffffff8,%eax
+     d9f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(need < MINCHUNK)
+     da2:	83 7d f0 17          	cmpl   $0x17,-0x10(%ebp)
+     da6:	77 07                	ja     daf <largealloc+0x30>
+    need = MINCHUNK;
+     da8:	c7 45 f0 18 00 00 00 	movl   $0x18,-0x10(%ebp)
+  for(;;){
+    for(i = binof(need); i < NBIN; i++)
+     daf:	ff 75 f0             	push   -0x10(%ebp)
+     db2:	e8 9f fc ff ff       	call   a56 <binof>
+     db7:	83 c4 04             	add    $0x4,%esp
+     dba:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     dbd:	eb 2f                	jmp    dee <largealloc+0x6f>
+      for(c = bins[i]; c; c = c->next)
+     dbf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     dc2:	8b 04 85 e0 18 00 00 	mov    0x18e0(,%eax,4),%eax
+     dc9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     dcc:	eb 16                	jmp    de4 <largealloc+0x65>
+        if(CSIZE(c) >= need)
+     dce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     dd1:	8b 00                	mov    (%eax),%eax
+     dd3:	83 e0 f8             	and    $0xfffffff8,%eax
+     dd6:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     dd9:	73 35                	jae    e10 <largealloc+0x91>
+      for(c = bins[i]; c; c = c->next)
+     ddb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     dde:	8b 40 08             	mov    0x8(%eax),%eax
+     de1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     de4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     de8:	75 e4                	jne    dce <largealloc+0x4f>
+    for(i = binof(need); i < NBIN; i++)
+     dea:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     dee:	83 7d ec 1a          	cmpl   $0x1a,-0x14(%ebp)
+     df2:	7e cb                	jle    dbf <largealloc+0x40>
+          goto found;
+    if(morecore(need) < 0)
+     df4:	83 ec 0c             	sub    $0xc,%esp
+     df7:	ff 75 f0             	push   -0x10(%ebp)
+     dfa:	e8 65 fe ff ff       	call   c64 <morecore>
+     dff:	83 c4 10             	add    $0x10,%esp
+     e02:	85 c0                	test   %eax,%eax
+     e04:	79 a9                	jns    daf <largealloc+0x30>
+      return 0;
+     e06:	b8 00 00 00 00       	mov    $0x0,%eax
+     e0b:	e9 c9 00 00 00       	jmp    ed9 <largealloc+0x15a>
+          goto found;
+     e10:	90                   	nop
+  }
+
+found:
+  binremove(c);
+     e11:	83 ec 0c             	sub    $0xc,%esp
+     e14:	ff 75 f4             	push   -0xc(%ebp)
+     e17:	e8 bb fc ff ff       	call   ad7 <binremove>
+     e1c:	83 c4 10             	add    $0x10,%esp
+  if(CSIZE(c) - need >= MINCHUNK){
+     e1f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e22:	8b 00                	mov    (%eax),%eax
+     e24:	83 e0 f8             	and    $0xfffffff8,%eax
+     e27:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     e2a:	83 f8 17             	cmp    $0x17,%eax
+     e2d:	76 66                	jbe    e95 <largealloc+0x116>
+    r = (struct chunk*)((char*)c + need);
+     e2f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     e32:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e35:	01 d0                	add    %edx,%eax
+     e37:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    r->size = (CSIZE(c) - need) | PREVUSED;
+     e3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e3d:	8b 00                	mov    (%eax),%eax
+     e3f:	83 e0 f8             	and    $0xfffffff8,%eax
+     e42:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     e45:	83 c8 02             	or     $0x2,%eax
+     e48:	89 c2                	mov    %eax,%edx
+     e4a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e4d:	89 10                	mov    %edx,(%eax)
+    r->tag = LARGE;
+     e4f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e52:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+    FOOTER(r) = CSIZE(r);
+     e59:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e5c:	8b 10                	mov    (%eax),%edx
+     e5e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e61:	8b 00                	mov    (%eax),%eax
+     e63:	83 e0 f8             	and    $0xfffffff8,%eax
+     e66:	8d 48 fc             	lea    -0x4(%eax),%ecx
+     e69:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e6c:	01 c8                	add    %ecx,%eax
+     e6e:	83 e2 f8             	and    $0xfffffff8,%edx
+     e71:	89 10                	mov    %edx,(%eax)
+    bininsert(r);
+     e73:	83 ec 0c             	sub    $0xc,%esp
+     e76:	ff 75 e8             	push   -0x18(%ebp)
+     e79:	e8 03 fc ff ff       	call   a81 <bininsert>
+     e7e:	83 c4 10             	add    $0x10,%esp
+    c->size = need | (c->size & PREVUSED);
+     e81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e84:	8b 00                	mov    (%eax),%eax
+     e86:	83 e0 02             	and    $0x2,%eax
+     e89:	0b 45 f0             	or     -0x10(%ebp),%eax
+     e8c:	89 c2                	mov    %eax,%edx
+     e8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e91:	89 10                	mov    %edx,(%eax)
+     e93:	eb 25                	jmp    eba <largealloc+0x13b>
+  } else
+    NEXTC(c)->size |= PREVUSED;
+     e95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e98:	8b 00                	mov    (%eax),%eax
+     e9a:	83 e0 f8             	and    $0xfffffff8,%eax
+     e9d:	89 c2                	mov    %eax,%edx
+     e9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ea2:	01 d0                	add    %edx,%eax
+     ea4:	8b 10                	mov    (%eax),%edx
+     ea6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ea9:	8b 00                	mov    (%eax),%eax
+     eab:	83 e0 f8             	and    $0xfffffff8,%eax
+     eae:	89 c1                	mov    %eax,%ecx
+     eb0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eb3:	01 c8                	add    %ecx,%eax
+     eb5:	83 ca 02             	or     $0x2,%edx
+     eb8:	89 10                	mov    %edx,(%eax)
+  c->size |= USED;
+     eba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ebd:	8b 00                	mov    (%eax),%eax
+     ebf:	83 c8 01             	or     $0x1,%eax
+     ec2:	89 c2                	mov    %eax,%edx
+     ec4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ec7:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+     ec9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ecc:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  return (char*)c + HDRSIZE;
+     ed3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ed6:	83 c0 08             	add    $0x8,%eax
+}
+     ed9:	c9                   	leave
+     eda:	c3                   	ret
+
+00000edb <refill>:
+
+// Carve a slab into free blocks of class k.
+static int
+refill(int k)
+{
+     edb:	55                   	push   %ebp
+     edc:	89 e5                	mov    %esp,%ebp
+     ede:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  char *p;
+  uint bs, i;
+
+  if((p = largealloc(SLABSIZE)) == 0)
+     ee1:	83 ec 0c             	sub    $0xc,%esp
+     ee4:	68 00 20 00 00       	push   $0x2000
+     ee9:	e8 91 fe ff ff       	call   d7f <largealloc>
+     eee:	83 c4 10             	add    $0x10,%esp
+     ef1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     ef4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     ef8:	75 07                	jne    f01 <refill+0x26>
+    return -1;
+     efa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     eff:	eb 75                	jmp    f76 <refill+0x9b>
+  bs = HDRSIZE + (MINSMALL << k);
+     f01:	8b 45 08             	mov    0x8(%ebp),%eax
+     f04:	ba 10 00 00 00       	mov    $0x10,%edx
+     f09:	89 c1                	mov    %eax,%ecx
+     f0b:	d3 e2                	shl    %cl,%edx
+     f0d:	89 d0                	mov    %edx,%eax
+     f0f:	83 c0 08             	add    $0x8,%eax
+     f12:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+     f15:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     f1c:	eb 44                	jmp    f62 <refill+0x87>
+    b = (struct chunk*)(p + i);
+     f1e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     f21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f24:	01 d0                	add    %edx,%eax
+     f26:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    b->size = bs | USED;
+     f29:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f2c:	83 c8 01             	or     $0x1,%eax
+     f2f:	89 c2                	mov    %eax,%edx
+     f31:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f34:	89 10                	mov    %edx,(%eax)
+    b->tag = k;
+     f36:	8b 55 08             	mov    0x8(%ebp),%edx
+     f39:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f3c:	89 50 04             	mov    %edx,0x4(%eax)
+    b->next = classes[k];
+     f3f:	8b 45 08             	mov    0x8(%ebp),%eax
+     f42:	8b 14 85 c0 18 00 00 	mov    0x18c0(,%eax,4),%edx
+     f49:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f4c:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[k] = b;
+     f4f:	8b 45 08             	mov    0x8(%ebp),%eax
+     f52:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     f55:	89 14 85 c0 18 00 00 	mov    %edx,0x18c0(,%eax,4)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+     f5c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f5f:	01 45 f4             	add    %eax,-0xc(%ebp)
+     f62:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     f65:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f68:	01 d0                	add    %edx,%eax
+     f6a:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     f6f:	76 ad                	jbe    f1e <refill+0x43>
+  }
+  return 0;
+     f71:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     f76:	c9                   	leave
+     f77:	c3                   	ret
+
+00000f78 <free>:
+
+void
+free(void *ap)
+{
+     f78:	55                   	push   %ebp
+     f79:	89 e5                	mov    %esp,%ebp
+     f7b:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+
+  if(ap == 0)
+     f7e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     f82:	74 4b                	je     fcf <free+0x57>
+    return;
+  c = (struct chunk*)((char*)ap - HDRSIZE);
+     f84:	8b 45 08             	mov    0x8(%ebp),%eax
+     f87:	83 e8 08             	sub    $0x8,%eax
+     f8a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(c->tag != LARGE){
+     f8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f90:	8b 40 04             	mov    0x4(%eax),%eax
+     f93:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f96:	74 25                	je     fbd <free+0x45>
+    c->next = classes[c->tag];
+     f98:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f9b:	8b 40 04             	mov    0x4(%eax),%eax
+     f9e:	8b 14 85 c0 18 00 00 	mov    0x18c0(,%eax,4),%edx
+     fa5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fa8:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[c->tag] = c;
+     fab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fae:	8b 40 04             	mov    0x4(%eax),%eax
+     fb1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     fb4:	89 14 85 c0 18 00 00 	mov    %edx,0x18c0(,%eax,4)
+    return;
+     fbb:	eb 13                	jmp    fd0 <free+0x58>
+  }
+  freechunk(c, 1);
+     fbd:	83 ec 08             	sub    $0x8,%esp
+     fc0:	6a 01                	push   $0x1
+     fc2:	ff 75 f4             	push   -0xc(%ebp)
+     fc5:	e8 65 fb ff ff       	call   b2f <freechunk>
+     fca:	83 c4 10             	add    $0x10,%esp
+     fcd:	eb 01                	jmp    fd0 <free+0x58>
+    return;
+     fcf:	90                   	nop
+}
+     fd0:	c9                   	leave
+     fd1:	c3                   	ret
+
+00000fd2 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     fd2:	55                   	push   %ebp
+     fd3:	89 e5                	mov    %esp,%ebp
+     fd5:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  int k;
+
+  if(nbytes > MAXSMALL)
+     fd8:	81 7d 08 00 08 00 00 	cmpl   $0x800,0x8(%ebp)
+     fdf:	76 10                	jbe    ff1 <malloc+0x1f>
+    return largealloc(nbytes);
+     fe1:	83 ec 0c             	sub    $0xc,%esp
+     fe4:	ff 75 08             	push   0x8(%ebp)
+     fe7:	e8 93 fd ff ff       	call   d7f <largealloc>
+     fec:	83 c4 10             	add    $0x10,%esp
+     fef:	eb 6a                	jmp    105b <malloc+0x89>
+  for(k = 0; (MINSMALL << k) < nbytes; k++)
+     ff1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     ff8:	eb 04                	jmp    ffe <malloc+0x2c>
+     ffa:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     ffe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1001:	ba 10 00 00 00       	mov    $0x10,%edx
+    1006:	89 c1                	mov    %eax,%ecx
+    1008:	d3 e2                	shl    %cl,%edx
+    100a:	89 d0                	mov    %edx,%eax
+    100c:	3b 45 08             	cmp    0x8(%ebp),%eax
+    100f:	72 e9                	jb     ffa <malloc+0x28>
+    ;
+  if(classes[k] == 0 && refill(k) < 0)
+    1011:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1014:	8b 04 85 c0 18 00 00 	mov    0x18c0(,%eax,4),%eax
+    101b:	85 c0                	test   %eax,%eax
+    101d:	75 19                	jne    1038 <malloc+0x66>
+    101f:	83 ec 0c             	sub    $0xc,%esp
+    1022:	ff 75 f4             	push   -0xc(%ebp)
+    1025:	e8 b1 fe ff ff       	call   edb <refill>
+    102a:	83 c4 10             	add    $0x10,%esp
+    102d:	85 c0                	test   %eax,%eax
+    102f:	79 07                	jns    1038 <malloc+0x66>
+    return 0;
+    1031:	b8 00 00 00 00       	mov    $0x0,%eax
+    1036:	eb 23                	jmp    105b <malloc+0x89>
+  b = classes[k];
+    1038:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    103b:	8b 04 85 c0 18 00 00 	mov    0x18c0(,%eax,4),%eax
+    1042:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  classes[k] = b->next;
+    1045:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1048:	8b 50 08             	mov    0x8(%eax),%edx
+    104b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    104e:	89 14 85 c0 18 00 00 	mov    %edx,0x18c0(,%eax,4)
+  return (char*)b + HDRSIZE;
+    1055:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1058:	83 c0 08             	add    $0x8,%eax
+}
+    105b:	c9                   	leave
+    105c:	c3                   	ret
+
+0000105d <stream>:
+
+// Return the stream for fd, deciding on first use how
+// its output is buffered.  Returns 0 if fd is not open.
+static struct stream*
+stream(int fd)
+{
+    105d:	55                   	push   %ebp
+    105e:	89 e5                	mov    %esp,%ebp
+    1060:	83 ec 28             	sub    $0x28,%esp
+  struct stream *s;
+  struct stat st;
+
+  if(fd < 0 || fd >= NOFILE)
+    1063:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1067:	78 06                	js     106f <stream+0x12>
+    1069:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    106d:	7e 07                	jle    1076 <stream+0x19>
+    return 0;
+    106f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1074:	eb 55                	jmp    10cb <stream+0x6e>
+  s = &streams[fd];
+    1076:	8b 45 08             	mov    0x8(%ebp),%eax
+    1079:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    107f:	05 60 19 00 00       	add    $0x1960,%eax
+    1084:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(s->mode == UNKNOWN){
+    1087:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    108a:	8b 00                	mov    (%eax),%eax
+    108c:	85 c0                	test   %eax,%eax
+    108e:	75 38                	jne    10c8 <stream+0x6b>
+    if(fstat(fd, &st) < 0)
+    1090:	83 ec 08             	sub    $0x8,%esp
+    1093:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1096:	50                   	push   %eax
+    1097:	ff 75 08             	push   0x8(%ebp)
+    109a:	e8 57 f6 ff ff       	call   6f6 <fstat>
+    109f:	83 c4 10             	add    $0x10,%esp
+    10a2:	85 c0                	test   %eax,%eax
+    10a4:	79 07                	jns    10ad <stream+0x50>
+      return 0;
+    10a6:	b8 00 00 00 00       	mov    $0x0,%eax
+    10ab:	eb 1e                	jmp    10cb <stream+0x6e>
+    s->mode = st.type == T_DEV ? LINEBUF : FULLBUF;
+    10ad:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+    10b1:	66 83 f8 03          	cmp    $0x3,%ax
+    10b5:	75 07                	jne    10be <stream+0x61>
+    10b7:	ba 01 00 00 00       	mov    $0x1,%edx
+    10bc:	eb 05                	jmp    10c3 <stream+0x66>
+    10be:	ba 02 00 00 00       	mov    $0x2,%edx
+    10c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10c6:	89 10                	mov    %edx,(%eax)
+  }
+  return s;
+    10c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    10cb:	c9                   	leave
+    10cc:	c3                   	ret
+
+000010cd <fflush>:
+
+int
+fflush(int fd)
+{
+    10cd:	55                   	push   %ebp
+    10ce:	89 e5                	mov    %esp,%ebp
+    10d0:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  int i, n;
+
+  if(fd < 0 || fd >= NOFILE)
+    10d3:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    10d7:	78 06                	js     10df <fflush+0x12>
+    10d9:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    10dd:	7e 07                	jle    10e6 <fflush+0x19>
+    return -1;
+    10df:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    10e4:	eb 78                	jmp    115e <fflush+0x91>
+  s = &streams[fd];
+    10e6:	8b 45 08             	mov    0x8(%ebp),%eax
+    10e9:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    10ef:	05 60 19 00 00       	add    $0x1960,%eax
+    10f4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < s->nout; i += n){
+    10f7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    10fe:	eb 44                	jmp    1144 <fflush+0x77>
+    if((n = write(fd, s->out + i, s->nout - i)) <= 0){
+    1100:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1103:	8b 40 04             	mov    0x4(%eax),%eax
+    1106:	2b 45 f4             	sub    -0xc(%ebp),%eax
+    1109:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    110c:	8d 4a 10             	lea    0x10(%edx),%ecx
+    110f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1112:	01 ca                	add    %ecx,%edx
+    1114:	83 ec 04             	sub    $0x4,%esp
+    1117:	50                   	push   %eax
+    1118:	52                   	push   %edx
+    1119:	ff 75 08             	push   0x8(%ebp)
+    111c:	e8 6c f5 ff ff       	call   68d <write>
+    1121:	83 c4 10             	add    $0x10,%esp
+    1124:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1127:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    112b:	7f 11                	jg     113e <fflush+0x71>
+      s->nout = 0;
+    112d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1130:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+      return -1;
+    1137:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    113c:	eb 20                	jmp    115e <fflush+0x91>
+  for(i = 0; i < s->nout; i += n){
+    113e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1141:	01 45 f4             	add    %eax,-0xc(%ebp)
+    1144:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1147:	8b 40 04             	mov    0x4(%eax),%eax
+    114a:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    114d:	7c b1                	jl     1100 <fflush+0x33>
+    }
+  }
+  s->nout = 0;
+    114f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1152:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  return 0;
+    1159:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    115e:	c9                   	leave
+    115f:	c3                   	ret
+
+00001160 <flushall>:
+
+// Flush every stream, or only line-buffered ones.
+static void
+flushall(int lineonly)
+{
+    1160:	55                   	push   %ebp
+    1161:	89 e5                	mov    %esp,%ebp
+    1163:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+    1166:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    116d:	eb 41                	jmp    11b0 <flushall+0x50>
+    if(streams[fd].nout > 0 && (!lineonly || streams[fd].mode == LINEBUF))
+    116f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1172:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1178:	05 64 19 00 00       	add    $0x1964,%eax
+    117d:	8b 00                	mov    (%eax),%eax
+    117f:	85 c0                	test   %eax,%eax
+    1181:	7e 29                	jle    11ac <flushall+0x4c>
+    1183:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1187:	74 15                	je     119e <flushall+0x3e>
+    1189:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    118c:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1192:	05 60 19 00 00       	add    $0x1960,%eax
+    1197:	8b 00                	mov    (%eax),%eax
+    1199:	83 f8 01             	cmp    $0x1,%eax
+    119c:	75 0e                	jne    11ac <flushall+0x4c>
+      fflush(fd);
+    119e:	83 ec 0c             	sub    $0xc,%esp
+    11a1:	ff 75 f4             	push   -0xc(%ebp)
+    11a4:	e8 24 ff ff ff       	call   10cd <fflush>
+    11a9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++)
+    11ac:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    11b0:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+    11b4:	7e b9                	jle    116f <flushall+0xf>
+}
+    11b6:	90                   	nop
+    11b7:	90                   	nop
+    11b8:	c9                   	leave
+    11b9:	c3                   	ret
+
+000011ba <fputc>:
+
+int
+fputc(int fd, int c)
+{
+    11ba:	55                   	push   %ebp
+    11bb:	89 e5                	mov    %esp,%ebp
+    11bd:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  char ch;
+
+  if((s = stream(fd)) == 0){
+    11c0:	83 ec 0c             	sub    $0xc,%esp
+    11c3:	ff 75 08             	push   0x8(%ebp)
+    11c6:	e8 92 fe ff ff       	call   105d <stream>
+    11cb:	83 c4 10             	add    $0x10,%esp
+    11ce:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    11d1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    11d5:	75 2e                	jne    1205 <fputc+0x4b>
+    ch = c;
+    11d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11da:	88 45 f3             	mov    %al,-0xd(%ebp)
+    return write(fd, &ch, 1) == 1 ? (uchar)c : -1;
+    11dd:	83 ec 04             	sub    $0x4,%esp
+    11e0:	6a 01                	push   $0x1
+    11e2:	8d 45 f3             	lea    -0xd(%ebp),%eax
+    11e5:	50                   	push   %eax
+    11e6:	ff 75 08             	push   0x8(%ebp)
+    11e9:	e8 9f f4 ff ff       	call   68d <write>
+    11ee:	83 c4 10             	add    $0x10,%esp
+    11f1:	83 f8 01             	cmp    $0x1,%eax
+    11f4:	75 08                	jne    11fe <fputc+0x44>
+    11f6:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11f9:	0f b6 c0             	movzbl %al,%eax
+    11fc:	eb 5e                	jmp    125c <fputc+0xa2>
+    11fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1203:	eb 57                	jmp    125c <fputc+0xa2>
+  }
+  s->out[s->nout++] = c;
+    1205:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1208:	8b 40 04             	mov    0x4(%eax),%eax
+    120b:	8d 48 01             	lea    0x1(%eax),%ecx
+    120e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1211:	89 4a 04             	mov    %ecx,0x4(%edx)
+    1214:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1217:	89 d1                	mov    %edx,%ecx
+    1219:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    121c:	88 4c 02 10          	mov    %cl,0x10(%edx,%eax,1)
+  if(s->nout == BUFSZ || (s->mode == LINEBUF && c == '\n'))
+    1220:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1223:	8b 40 04             	mov    0x4(%eax),%eax
+    1226:	3d 00 02 00 00       	cmp    $0x200,%eax
+    122b:	74 10                	je     123d <fputc+0x83>
+    122d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1230:	8b 00                	mov    (%eax),%eax
+    1232:	83 f8 01             	cmp    $0x1,%eax
+    1235:	75 1f                	jne    1256 <fputc+0x9c>
+    1237:	83 7d 0c 0a          	cmpl   $0xa,0xc(%ebp)
+    123b:	75 19                	jne    1256 <fputc+0x9c>
+    if(fflush(fd) < 0)
+    123d:	83 ec 0c             	sub    $0xc,%esp
+    1240:	ff 75 08             	push   0x8(%ebp)
+    1243:	e8 85 fe ff ff       	call   10cd <fflush>
+    1248:	83 c4 10             	add    $0x10,%esp
+    124b:	85 c0                	test   %eax,%eax
+    124d:	79 07                	jns    1256 <fputc+0x9c>
+      return -1;
+    124f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1254:	eb 06                	jmp    125c <fputc+0xa2>
+  return (uchar)c;
+    1256:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1259:	0f b6 c0             	movzbl %al,%eax
+}
+    125c:	c9                   	leave
+    125d:	c3                   	ret
+
+0000125e <fgetc>:
+
+// Return the next byte read from fd, or -1 at end of file.
+int
+fgetc(int fd)
+{
+    125e:	55                   	push   %ebp
+    125f:	89 e5                	mov    %esp,%ebp
+    1261:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  uchar c;
+  int n;
+
+  if((s = stream(fd)) == 0){
+    1264:	83 ec 0c             	sub    $0xc,%esp
+    1267:	ff 75 08             	push   0x8(%ebp)
+    126a:	e8 ee fd ff ff       	call   105d <stream>
+    126f:	83 c4 10             	add    $0x10,%esp
+    1272:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1275:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1279:	75 39                	jne    12b4 <fgetc+0x56>
+    flushall(1);
+    127b:	83 ec 0c             	sub    $0xc,%esp
+    127e:	6a 01                	push   $0x1
+    1280:	e8 db fe ff ff       	call   1160 <flushall>
+    1285:	83 c4 10             	add    $0x10,%esp
+    return read(fd, &c, 1) == 1 ? c : -1;
+    1288:	83 ec 04             	sub    $0x4,%esp
+    128b:	6a 01                	push   $0x1
+    128d:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    1290:	50                   	push   %eax
+    1291:	ff 75 08             	push   0x8(%ebp)
+    1294:	e8 e5 f3 ff ff       	call   67e <read>
+    1299:	83 c4 10             	add    $0x10,%esp
+    129c:	83 f8 01             	cmp    $0x1,%eax
+    129f:	75 0c                	jne    12ad <fgetc+0x4f>
+    12a1:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    12a5:	0f b6 c0             	movzbl %al,%eax
+    12a8:	e9 80 00 00 00       	jmp    132d <fgetc+0xcf>
+    12ad:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12b2:	eb 79                	jmp    132d <fgetc+0xcf>
+  }
+  if(s->rpos == s->rend){
+    12b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12b7:	8b 50 08             	mov    0x8(%eax),%edx
+    12ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12bd:	8b 40 0c             	mov    0xc(%eax),%eax
+    12c0:	39 c2                	cmp    %eax,%edx
+    12c2:	75 4c                	jne    1310 <fgetc+0xb2>
+    flushall(1);
+    12c4:	83 ec 0c             	sub    $0xc,%esp
+    12c7:	6a 01                	push   $0x1
+    12c9:	e8 92 fe ff ff       	call   1160 <flushall>
+    12ce:	83 c4 10             	add    $0x10,%esp
+    if((n = read(fd, s->in, BUFSZ)) <= 0)
+    12d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12d4:	05 10 02 00 00       	add    $0x210,%eax
+    12d9:	83 ec 04             	sub    $0x4,%esp
+    12dc:	68 00 02 00 00       	push   $0x200
+    12e1:	50                   	push   %eax
+    12e2:	ff 75 08             	push   0x8(%ebp)
+    12e5:	e8 94 f3 ff ff       	call   67e <read>
+    12ea:	83 c4 10             	add    $0x10,%esp
+    12ed:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    12f0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    12f4:	7f 07                	jg     12fd <fgetc+0x9f>
+      return -1;
+    12f6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12fb:	eb 30                	jmp    132d <fgetc+0xcf>
+    s->rpos = 0;
+    12fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1300:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+    s->rend = n;
+    1307:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    130a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    130d:	89 50 0c             	mov    %edx,0xc(%eax)
+  }
+  return (uchar)s->in[s->rpos++];
+    1310:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1313:	8b 40 08             	mov    0x8(%eax),%eax
+    1316:	8d 48 01             	lea    0x1(%eax),%ecx
+    1319:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    131c:	89 4a 08             	mov    %ecx,0x8(%edx)
+    131f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1322:	0f b6 84 02 10 02 00 	movzbl 0x210(%edx,%eax,1),%eax
+    1329:	00 
+    132a:	0f b6 c0             	movzbl %al,%eax
+}
+    132d:	c9                   	leave
+    132e:	c3                   	ret
+
+0000132f <fork>:
+
+int
+fork(void)
+{
+    132f:	55                   	push   %ebp
+    1330:	89 e5                	mov    %esp,%ebp
+    1332:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1335:	83 ec 0c             	sub    $0xc,%esp
+    1338:	6a 00                	push   $0x0
+    133a:	e8 21 fe ff ff       	call   1160 <flushall>
+    133f:	83 c4 10             	add    $0x10,%esp
+  return _fork();
+    1342:	e8 fb f2 ff ff       	call   642 <_fork>
+}
+    1347:	c9                   	leave
+    1348:	c3                   	ret
+
+00001349 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+    1349:	55                   	push   %ebp
+    134a:	89 e5                	mov    %esp,%ebp
+    134c:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    134f:	83 ec 0c             	sub    $0xc,%esp
+    1352:	6a 00                	push   $0x0
+    1354:	e8 07 fe ff ff       	call   1160 <flushall>
+    1359:	83 c4 10             	add    $0x10,%esp
+  return _exec(path, argv);
+    135c:	83 ec 08             	sub    $0x8,%esp
+    135f:	ff 75 0c             	push   0xc(%ebp)
+    1362:	ff 75 08             	push   0x8(%ebp)
+    1365:	e8 50 f3 ff ff       	call   6ba <_exec>
+    136a:	83 c4 10             	add    $0x10,%esp
+}
+    136d:	c9                   	leave
+    136e:	c3                   	ret
+
+0000136f <exit>:
+
+int
+exit(void)
+{
+    136f:	55                   	push   %ebp
+    1370:	89 e5                	mov    %esp,%ebp
+    1372:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1375:	83 ec 0c             	sub    $0xc,%esp
+    1378:	6a 00                	push   $0x0
+    137a:	e8 e1 fd ff ff       	call   1160 <flushall>
+    137f:	83 c4 10             	add    $0x10,%esp
+  _exit();
+    1382:	e8 ca f2 ff ff       	call   651 <_exit>
+
+00001387 <close>:
+}
+
+int
+close(int fd)
+{
+    1387:	55                   	push   %ebp
+    1388:	89 e5                	mov    %esp,%ebp
+    138a:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+
+  if(fd >= 0 && fd < NOFILE){
+    138d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1391:	78 44                	js     13d7 <close+0x50>
+    1393:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    1397:	7f 3e                	jg     13d7 <close+0x50>
+    fflush(fd);
+    1399:	83 ec 0c             	sub    $0xc,%esp
+    139c:	ff 75 08             	push   0x8(%ebp)
+    139f:	e8 29 fd ff ff       	call   10cd <fflush>
+    13a4:	83 c4 10             	add    $0x10,%esp
+    s = &streams[fd];
+    13a7:	8b 45 08             	mov    0x8(%ebp),%eax
+    13aa:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    13b0:	05 60 19 00 00       	add    $0x1960,%eax
+    13b5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    s->mode = UNKNOWN;
+    13b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13bb:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    s->rpos = s->rend = 0;
+    13c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13c4:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    13cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13ce:	8b 50 0c             	mov    0xc(%eax),%edx
+    13d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13d4:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  return _close(fd);
+    13d7:	83 ec 0c             	sub    $0xc,%esp
+    13da:	ff 75 08             	push   0x8(%ebp)
+    13dd:	e8 ba f2 ff ff       	call   69c <_close>
+    13e2:	83 c4 10             	add    $0x10,%esp
+}
+    13e5:	c9                   	leave
+    13e6:	c3                   	ret
@@ -5,14 +5,34 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "stat.h"
+#include "spinlock.h"
+#include "sleeplock.h"
 #include "fs.h"
 #include "file.h"
-#include "spinlock.h"
+#include "fcntl.h"
+
+// Most bytes one transaction may write to a file,
+// leaving the other half of the log to other writers.
+// initlog() refuses logs too small for this to be positive.
+static int
+maxwrite(void)
+{
+  int n;
+
+  if((n = (log_space()/2 - WRITEBLOCKS(0)) * BSIZE) <= 0)
+    panic("maxwrite");
+  return n;
+}
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
 
 struct devsw devsw[NDEV];
+
+// File structures come from kmalloc(); the lock
+// guards their reference counts.
 struct {
   struct spinlock lock;
-  struct file file[NFILE];
 } ftable;
 
 void
@@ -27,16 +47,11 @@ filealloc(void)
 {
   struct file *f;
 
-  acquire(&ftable.lock);
-  for(f = ftable.file; f < ftable.file + NFILE; f++){
-    if(f->ref == 0){
-      f->ref = 1;
-      release(&ftable.lock);
-      return f;
-    }
-  }
-  release(&ftable.lock);
-  return 0;
+  if((f = kmalloc(sizeof(*f))) == 0)
+    return 0;
+  memset(f, 0, sizeof(*f));
+  f->ref = 1;
+  return f;
 }
 
 // Increment ref count for file f.
@@ -68,6 +83,7 @@ fileclose(struct file *f)
   f->ref = 0;
   f->type = FD_NONE;
   release(&ftable.lock);
+  kmfree(f);
   
   if(ff.type == FD_PIPE)
     pipeclose(ff.pipe, ff.writable);
@@ -83,14 +99,43 @@ int
 filestat(struct file *f, struct stat *st)
 {
   if(f->type == FD_INODE){
-    ilock(f->ip);
+    ilockshared(f->ip);
     stati(f->ip, st);
     iunlock(f->ip);
     return 0;
   }
+  if(f->type == FD_PIPE){
+    pipestat(f->pipe, st);
+    return 0;
+  }
   return -1;
 }
 
+// Set the offset of file f.  Seeking past the end is
+// allowed; writing there leaves a hole.
+int
+fileseek(struct file *f, int off, int whence)
+{
+  uint base;
+
+  if(f->type != FD_INODE)
+    return -1;
+  if(whence == SEEK_SET)
+    base = 0;
+  else if(whence == SEEK_CUR)
+    base = f->off;
+  else if(whence == SEEK_END){
+    ilock(f->ip);
+    base = f->ip->size;
+    iunlock(f->ip);
+  } else
+    return -1;
+  if((int)(base + off) < 0 || base + off > MAXFILE*BSIZE)
+    return -1;
+  f->off = base + off;
+  return f->off;
+}
+
 // Read from file f.
 int
 fileread(struct file *f, char *addr, int n)
@@ -102,7 +147,12 @@ fileread(struct file *f, char *addr, int n)
   if(f->type == FD_PIPE)
     return piperead(f->pipe, addr, n);
   if(f->type == FD_INODE){
-    ilock(f->ip);
+    // Readers of the inode may share it, unless they
+    // could race on f->off through another reference.
+    if(f->ref == 1)
+      ilockshared(f->ip);
+    else
+      ilock(f->ip);
     if((r = readi(f->ip, addr, f->off, n)) > 0)
       f->off += r;
     iunlock(f->ip);
@@ -124,19 +174,17 @@ filewrite(struct file *f, char *addr, int n)
     return pipewrite(f->pipe, addr, n);
   if(f->type == FD_INODE){
     // write a few blocks at a time to avoid exceeding
-    // the maximum log transaction size, including
-    // i-node, indirect block, allocation blocks,
-    // and 2 blocks of slop for non-aligned writes.
+    // the maximum log transaction size (see maxwrite).
     // this really belongs lower down, since writei()
     // might be writing a device like the console.
-    int max = ((LOGSIZE-1-1-2) / 2) * 512;
+    int max = maxwrite();
     int i = 0;
     while(i < n){
       int n1 = n - i;
       if(n1 > max)
         n1 = max;
 
-      begin_op();
+      begin_opn(WRITEBLOCKS(n1));
       ilock(f->ip);
       if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
         f->off += r;
@@ -154,3 +202,63 @@ filewrite(struct file *f, char *addr, int n)
   panic("filewrite");
 }
 
+//PAGEBREAK!
+// Move up to n bytes from file in to file out inside the
+// kernel, between the buffer cache and a pipe buffer.
+// One file must be a pipe and the other an inode.
+// Returns the number of bytes moved, 0 at end of file.
+int
+filesplice(struct file *in, struct file *out, int n)
+{
+  int r, m, tot, eof;
+
+  if(in->readable == 0 || out->writable == 0 || n < 0)
+    return -1;
+
+  if(in->type == FD_INODE && out->type == FD_PIPE){
+    for(tot = 0; tot < n; tot += r){
+      // Wait for room before locking anything, since a
+      // reader of the pipe may need the same blocks.
+      if(pipewait(out->pipe, 1) < 0)
+        return tot > 0 ? tot : -1;
+      r = 0;
+      ilock(in->ip);
+      if(in->ip->type != T_FILE && in->ip->type != T_DIR){
+        // A device has no size to read up to: let
+        // the caller fall back to read().
+        iunlock(in->ip);
+        return tot > 0 ? tot : -1;
+      }
+      eof = in->off >= in->ip->size;
+      if(!eof && (r = splicei(in->ip, out->pipe, in->off, n - tot, 0)) > 0)
+        in->off += r;
+      iunlock(in->ip);
+      if(r < 0)
+        return tot > 0 ? tot : -1;
+      if(eof)
+        break;
+    }
+    return tot;
+  }
+
+  if(in->type == FD_PIPE && out->type == FD_INODE){
+    for(tot = 0; tot < n; tot += r){
+      if((r = pipewait(in->pipe, 0)) <= 0)
+        return tot > 0 ? tot : r;
+      if(out->off >= MAXFILE*BSIZE)
+        return tot > 0 ? tot : -1;
+      m = min(n - tot, maxwrite());
+      begin_opn(WRITEBLOCKS(m));
+      ilock(out->ip);
+      if((r = splicei(out->ip, in->pipe, out->off, m, 1)) > 0)
+        out->off += r;
+      iunlock(out->ip);
+      end_op();
+      if(r < 0)
+        return tot > 0 ? tot : -1;
+    }
+    return tot;
+  }
+
+  return -1;
+}
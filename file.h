@@ -14,16 +14,23 @@ struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
-  int flags;          // I_BUSY, I_VALID
+  struct sleeplock lock; // protects everything below here
+  int flags;          // I_VALID
+  uint lastb;         // block most recently allocated to it
+  uint logseq;        // log transaction that last changed it on disk
 
   short type;         // copy of disk inode
   short major;
   short minor;
   short nlink;
   uint size;
-  uint addrs[NDIRECT+1];
+  uint dflags;        // DI_ flags
+  uint addrs[NDIRECT+NLEVEL];
+
+  struct inode *hnext;  // icache hash chain
+  struct inode *prev;   // icache LRU list of unreferenced inodes
+  struct inode *next;
 };
-#define I_BUSY 0x1
 #define I_VALID 0x2
 
 // table mapping major device number to
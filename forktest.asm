@@ -0,0 +1,1678 @@
+
+_forktest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <printf>:
+
+#define N  1000
+
+void
+printf(int fd, char *s, ...)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 08             	sub    $0x8,%esp
+  write(fd, s, strlen(s));
+   6:	83 ec 0c             	sub    $0xc,%esp
+   9:	ff 75 0c             	push   0xc(%ebp)
+   c:	e8 54 02 00 00       	call   265 <strlen>
+  11:	83 c4 10             	add    $0x10,%esp
+  14:	83 ec 04             	sub    $0x4,%esp
+  17:	50                   	push   %eax
+  18:	ff 75 0c             	push   0xc(%ebp)
+  1b:	ff 75 08             	push   0x8(%ebp)
+  1e:	e8 0d 07 00 00       	call   730 <write>
+  23:	83 c4 10             	add    $0x10,%esp
+}
+  26:	90                   	nop
+  27:	c9                   	leave
+  28:	c3                   	ret
+
+00000029 <forktest>:
+
+void
+forktest(void)
+{
+  29:	55                   	push   %ebp
+  2a:	89 e5                	mov    %esp,%ebp
+  2c:	83 ec 18             	sub    $0x18,%esp
+  int n, pid;
+
+  printf(1, "fork test\n");
+  2f:	83 ec 08             	sub    $0x8,%esp
+  32:	68 50 0c 00 00       	push   $0xc50
+  37:	6a 01                	push   $0x1
+  39:	e8 c2 ff ff ff       	call   0 <printf>
+  3e:	83 c4 10             	add    $0x10,%esp
+
+  for(n=0; n<N; n++){
+  41:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  48:	eb 1d                	jmp    67 <forktest+0x3e>
+    pid = fork();
+  4a:	e8 48 0b 00 00       	call   b97 <fork>
+  4f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pid < 0)
+  52:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  56:	78 1a                	js     72 <forktest+0x49>
+      break;
+    if(pid == 0)
+  58:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  5c:	75 05                	jne    63 <forktest+0x3a>
+      exit();
+  5e:	e8 74 0b 00 00       	call   bd7 <exit>
+  for(n=0; n<N; n++){
+  63:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  67:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+  6e:	7e da                	jle    4a <forktest+0x21>
+  70:	eb 01                	jmp    73 <forktest+0x4a>
+      break;
+  72:	90                   	nop
+  }
+  
+  if(n == N){
+  73:	81 7d f4 e8 03 00 00 	cmpl   $0x3e8,-0xc(%ebp)
+  7a:	75 40                	jne    bc <forktest+0x93>
+    printf(1, "fork claimed to work N times!\n", N);
+  7c:	83 ec 04             	sub    $0x4,%esp
+  7f:	68 e8 03 00 00       	push   $0x3e8
+  84:	68 5c 0c 00 00       	push   $0xc5c
+  89:	6a 01                	push   $0x1
+  8b:	e8 70 ff ff ff       	call   0 <printf>
+  90:	83 c4 10             	add    $0x10,%esp
+    exit();
+  93:	e8 3f 0b 00 00       	call   bd7 <exit>
+  }
+  
+  for(; n > 0; n--){
+    if(wait() < 0){
+  98:	e8 66 06 00 00       	call   703 <wait>
+  9d:	85 c0                	test   %eax,%eax
+  9f:	79 17                	jns    b8 <forktest+0x8f>
+      printf(1, "wait stopped early\n");
+  a1:	83 ec 08             	sub    $0x8,%esp
+  a4:	68 7b 0c 00 00       	push   $0xc7b
+  a9:	6a 01                	push   $0x1
+  ab:	e8 50 ff ff ff       	call   0 <printf>
+  b0:	83 c4 10             	add    $0x10,%esp
+      exit();
+  b3:	e8 1f 0b 00 00       	call   bd7 <exit>
+  for(; n > 0; n--){
+  b8:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+  bc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  c0:	7f d6                	jg     98 <forktest+0x6f>
+    }
+  }
+  
+  if(wait() != -1){
+  c2:	e8 3c 06 00 00       	call   703 <wait>
+  c7:	83 f8 ff             	cmp    $0xffffffff,%eax
+  ca:	74 17                	je     e3 <forktest+0xba>
+    printf(1, "wait got too many\n");
+  cc:	83 ec 08             	sub    $0x8,%esp
+  cf:	68 8f 0c 00 00       	push   $0xc8f
+  d4:	6a 01                	push   $0x1
+  d6:	e8 25 ff ff ff       	call   0 <printf>
+  db:	83 c4 10             	add    $0x10,%esp
+    exit();
+  de:	e8 f4 0a 00 00       	call   bd7 <exit>
+  }
+  
+  printf(1, "fork test OK\n");
+  e3:	83 ec 08             	sub    $0x8,%esp
+  e6:	68 a2 0c 00 00       	push   $0xca2
+  eb:	6a 01                	push   $0x1
+  ed:	e8 0e ff ff ff       	call   0 <printf>
+  f2:	83 c4 10             	add    $0x10,%esp
+}
+  f5:	90                   	nop
+  f6:	c9                   	leave
+  f7:	c3                   	ret
+
+000000f8 <main>:
+
+int
+main(void)
+{
+  f8:	55                   	push   %ebp
+  f9:	89 e5                	mov    %esp,%ebp
+  fb:	83 e4 f0             	and    $0xfffffff0,%esp
+  forktest();
+  fe:	e8 26 ff ff ff       	call   29 <forktest>
+  exit();
+ 103:	e8 cf 0a 00 00       	call   bd7 <exit>
+
+00000108 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 108:	55                   	push   %ebp
+ 109:	89 e5                	mov    %esp,%ebp
+ 10b:	57                   	push   %edi
+ 10c:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 10d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 110:	8b 55 10             	mov    0x10(%ebp),%edx
+ 113:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 116:	89 cb                	mov    %ecx,%ebx
+ 118:	89 df                	mov    %ebx,%edi
+ 11a:	89 d1                	mov    %edx,%ecx
+ 11c:	fc                   	cld
+ 11d:	f3 aa                	rep stos %al,%es:(%edi)
+ 11f:	89 ca                	mov    %ecx,%edx
+ 121:	89 fb                	mov    %edi,%ebx
+ 123:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 126:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 129:	90                   	nop
+ 12a:	5b                   	pop    %ebx
+ 12b:	5f                   	pop    %edi
+ 12c:	5d                   	pop    %ebp
+ 12d:	c3                   	ret
+
+0000012e <stosl>:
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+ 12e:	55                   	push   %ebp
+ 12f:	89 e5                	mov    %esp,%ebp
+ 131:	57                   	push   %edi
+ 132:	53                   	push   %ebx
+  asm volatile("cld; rep stosl" :
+ 133:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 136:	8b 55 10             	mov    0x10(%ebp),%edx
+ 139:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 13c:	89 cb                	mov    %ecx,%ebx
+ 13e:	89 df                	mov    %ebx,%edi
+ 140:	89 d1                	mov    %edx,%ecx
+ 142:	fc                   	cld
+ 143:	f3 ab                	rep stos %eax,%es:(%edi)
+ 145:	89 ca                	mov    %ecx,%edx
+ 147:	89 fb                	mov    %edi,%ebx
+ 149:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 14c:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 14f:	90                   	nop
+ 150:	5b                   	pop    %ebx
+ 151:	5f                   	pop    %edi
+ 152:	5d                   	pop    %ebp
+ 153:	c3                   	ret
+
+00000154 <movsb>:
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+ 154:	55                   	push   %ebp
+ 155:	89 e5                	mov    %esp,%ebp
+ 157:	57                   	push   %edi
+ 158:	56                   	push   %esi
+ 159:	53                   	push   %ebx
+  asm volatile("cld; rep movsb" :
+ 15a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 15d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 160:	8b 45 10             	mov    0x10(%ebp),%eax
+ 163:	89 cb                	mov    %ecx,%ebx
+ 165:	89 df                	mov    %ebx,%edi
+ 167:	89 d6                	mov    %edx,%esi
+ 169:	89 c1                	mov    %eax,%ecx
+ 16b:	fc                   	cld
+ 16c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+ 16e:	89 c8                	mov    %ecx,%eax
+ 170:	89 f2                	mov    %esi,%edx
+ 172:	89 fb                	mov    %edi,%ebx
+ 174:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 177:	89 55 0c             	mov    %edx,0xc(%ebp)
+ 17a:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+ 17d:	90                   	nop
+ 17e:	5b                   	pop    %ebx
+ 17f:	5e                   	pop    %esi
+ 180:	5f                   	pop    %edi
+ 181:	5d                   	pop    %ebp
+ 182:	c3                   	ret
+
+00000183 <movsl>:
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+ 183:	55                   	push   %ebp
+ 184:	89 e5                	mov    %esp,%ebp
+ 186:	57                   	push   %edi
+ 187:	56                   	push   %esi
+ 188:	53                   	push   %ebx
+  asm volatile("cld; rep movsl" :
+ 189:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 18c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 18f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 192:	89 cb                	mov    %ecx,%ebx
+ 194:	89 df                	mov    %ebx,%edi
+ 196:	89 d6                	mov    %edx,%esi
+ 198:	89 c1                	mov    %eax,%ecx
+ 19a:	fc                   	cld
+ 19b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+ 19d:	89 c8                	mov    %ecx,%eax
+ 19f:	89 f2                	mov    %esi,%edx
+ 1a1:	89 fb                	mov    %edi,%ebx
+ 1a3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 1a6:	89 55 0c             	mov    %edx,0xc(%ebp)
+ 1a9:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+ 1ac:	90                   	nop
+ 1ad:	5b                   	pop    %ebx
+ 1ae:	5e                   	pop    %esi
+ 1af:	5f                   	pop    %edi
+ 1b0:	5d                   	pop    %ebp
+ 1b1:	c3                   	ret
+
+000001b2 <strcpy>:
+#define ONES        0x01010101
+#define HASZERO(x)  (((x) - ONES) & ~(x) & (ONES << 7))
+
+char*
+strcpy(char *s, char *t)
+{
+ 1b2:	55                   	push   %ebp
+ 1b3:	89 e5                	mov    %esp,%ebp
+ 1b5:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 1b8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1bb:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 1be:	90                   	nop
+ 1bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1c2:	8d 42 01             	lea    0x1(%edx),%eax
+ 1c5:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 1c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1cb:	8d 48 01             	lea    0x1(%eax),%ecx
+ 1ce:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 1d1:	0f b6 12             	movzbl (%edx),%edx
+ 1d4:	88 10                	mov    %dl,(%eax)
+ 1d6:	0f b6 00             	movzbl (%eax),%eax
+ 1d9:	84 c0                	test   %al,%al
+ 1db:	75 e2                	jne    1bf <strcpy+0xd>
+    ;
+  return os;
+ 1dd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1e0:	c9                   	leave
+ 1e1:	c3                   	ret
+
+000001e2 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1e2:	55                   	push   %ebp
+ 1e3:	89 e5                	mov    %esp,%ebp
+  // Aligned words never straddle a page, so reading
+  // whole ones past the end of a string is safe.
+  if((((uint)p | (uint)q) & 3) == 0)
+ 1e5:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1eb:	09 d0                	or     %edx,%eax
+ 1ed:	83 e0 03             	and    $0x3,%eax
+ 1f0:	85 c0                	test   %eax,%eax
+ 1f2:	75 3f                	jne    233 <strcmp+0x51>
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+ 1f4:	eb 08                	jmp    1fe <strcmp+0x1c>
+      p += 4, q += 4;
+ 1f6:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+ 1fa:	83 45 0c 04          	addl   $0x4,0xc(%ebp)
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+ 1fe:	8b 45 08             	mov    0x8(%ebp),%eax
+ 201:	8b 10                	mov    (%eax),%edx
+ 203:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 206:	8b 00                	mov    (%eax),%eax
+ 208:	39 c2                	cmp    %eax,%edx
+ 20a:	75 27                	jne    233 <strcmp+0x51>
+ 20c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 20f:	8b 00                	mov    (%eax),%eax
+ 211:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+ 217:	8b 45 08             	mov    0x8(%ebp),%eax
+ 21a:	8b 00                	mov    (%eax),%eax
+ 21c:	f7 d0                	not    %eax
+ 21e:	21 d0                	and    %edx,%eax
+ 220:	25 80 80 80 80       	and    $0x80808080,%eax
+ 225:	85 c0                	test   %eax,%eax
+ 227:	74 cd                	je     1f6 <strcmp+0x14>
+  while(*p && *p == *q)
+ 229:	eb 08                	jmp    233 <strcmp+0x51>
+    p++, q++;
+ 22b:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 22f:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 233:	8b 45 08             	mov    0x8(%ebp),%eax
+ 236:	0f b6 00             	movzbl (%eax),%eax
+ 239:	84 c0                	test   %al,%al
+ 23b:	74 10                	je     24d <strcmp+0x6b>
+ 23d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 240:	0f b6 10             	movzbl (%eax),%edx
+ 243:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 246:	0f b6 00             	movzbl (%eax),%eax
+ 249:	38 c2                	cmp    %al,%dl
+ 24b:	74 de                	je     22b <strcmp+0x49>
+  return (uchar)*p - (uchar)*q;
+ 24d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 250:	0f b6 00             	movzbl (%eax),%eax
+ 253:	0f b6 d0             	movzbl %al,%edx
+ 256:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 259:	0f b6 00             	movzbl (%eax),%eax
+ 25c:	0f b6 c0             	movzbl %al,%eax
+ 25f:	29 c2                	sub    %eax,%edx
+ 261:	89 d0                	mov    %edx,%eax
+}
+ 263:	5d                   	pop    %ebp
+ 264:	c3                   	ret
+
+00000265 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 265:	55                   	push   %ebp
+ 266:	89 e5                	mov    %esp,%ebp
+ 268:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; ((uint)(s+n) & 3) && s[n]; n++)
+ 26b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 272:	eb 04                	jmp    278 <strlen+0x13>
+ 274:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 278:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 27b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 27e:	01 d0                	add    %edx,%eax
+ 280:	83 e0 03             	and    $0x3,%eax
+ 283:	85 c0                	test   %eax,%eax
+ 285:	74 0f                	je     296 <strlen+0x31>
+ 287:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 28a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28d:	01 d0                	add    %edx,%eax
+ 28f:	0f b6 00             	movzbl (%eax),%eax
+ 292:	84 c0                	test   %al,%al
+ 294:	75 de                	jne    274 <strlen+0xf>
+    ;
+  if(s[n])
+ 296:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 299:	8b 45 08             	mov    0x8(%ebp),%eax
+ 29c:	01 d0                	add    %edx,%eax
+ 29e:	0f b6 00             	movzbl (%eax),%eax
+ 2a1:	84 c0                	test   %al,%al
+ 2a3:	74 33                	je     2d8 <strlen+0x73>
+    while(!HASZERO(*(uint*)(s+n)))
+ 2a5:	eb 04                	jmp    2ab <strlen+0x46>
+      n += 4;
+ 2a7:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+    while(!HASZERO(*(uint*)(s+n)))
+ 2ab:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2ae:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b1:	01 d0                	add    %edx,%eax
+ 2b3:	8b 00                	mov    (%eax),%eax
+ 2b5:	8d 88 ff fe fe fe    	lea    -0x1010101(%eax),%ecx
+ 2bb:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2be:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c1:	01 d0                	add    %edx,%eax
+ 2c3:	8b 00                	mov    (%eax),%eax
+ 2c5:	f7 d0                	not    %eax
+ 2c7:	21 c8                	and    %ecx,%eax
+ 2c9:	25 80 80 80 80       	and    $0x80808080,%eax
+ 2ce:	85 c0                	test   %eax,%eax
+ 2d0:	74 d5                	je     2a7 <strlen+0x42>
+  for(; s[n]; n++)
+ 2d2:	eb 04                	jmp    2d8 <strlen+0x73>
+ 2d4:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 2d8:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2db:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2de:	01 d0                	add    %edx,%eax
+ 2e0:	0f b6 00             	movzbl (%eax),%eax
+ 2e3:	84 c0                	test   %al,%al
+ 2e5:	75 ed                	jne    2d4 <strlen+0x6f>
+    ;
+  return n;
+ 2e7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2ea:	c9                   	leave
+ 2eb:	c3                   	ret
+
+000002ec <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2ec:	55                   	push   %ebp
+ 2ed:	89 e5                	mov    %esp,%ebp
+ 2ef:	83 ec 10             	sub    $0x10,%esp
+  char *d;
+  uint k;
+
+  d = dst;
+ 2f2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c &= 0xFF;
+ 2f8:	81 65 0c ff 00 00 00 	andl   $0xff,0xc(%ebp)
+  if(n >= 16){
+ 2ff:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+ 303:	76 54                	jbe    359 <memset+0x6d>
+    k = -(uint)d & 3;  // bytes up to a word boundary
+ 305:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 308:	f7 d8                	neg    %eax
+ 30a:	83 e0 03             	and    $0x3,%eax
+ 30d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    stosb(d, c, k);
+ 310:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 313:	50                   	push   %eax
+ 314:	ff 75 0c             	push   0xc(%ebp)
+ 317:	ff 75 fc             	push   -0x4(%ebp)
+ 31a:	e8 e9 fd ff ff       	call   108 <stosb>
+ 31f:	83 c4 0c             	add    $0xc,%esp
+    d += k;
+ 322:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 325:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n -= k;
+ 328:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 32b:	29 45 10             	sub    %eax,0x10(%ebp)
+    stosl(d, c*ONES, n/4);
+ 32e:	8b 45 10             	mov    0x10(%ebp),%eax
+ 331:	c1 e8 02             	shr    $0x2,%eax
+ 334:	89 c2                	mov    %eax,%edx
+ 336:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 339:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+ 33f:	52                   	push   %edx
+ 340:	50                   	push   %eax
+ 341:	ff 75 fc             	push   -0x4(%ebp)
+ 344:	e8 e5 fd ff ff       	call   12e <stosl>
+ 349:	83 c4 0c             	add    $0xc,%esp
+    d += n & ~3;
+ 34c:	8b 45 10             	mov    0x10(%ebp),%eax
+ 34f:	83 e0 fc             	and    $0xfffffffc,%eax
+ 352:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n &= 3;
+ 355:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+  }
+  stosb(d, c, n);
+ 359:	8b 45 10             	mov    0x10(%ebp),%eax
+ 35c:	50                   	push   %eax
+ 35d:	ff 75 0c             	push   0xc(%ebp)
+ 360:	ff 75 fc             	push   -0x4(%ebp)
+ 363:	e8 a0 fd ff ff       	call   108 <stosb>
+ 368:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 36b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 36e:	c9                   	leave
+ 36f:	c3                   	ret
+
+00000370 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s1, *s2;
+
+  s1 = v1;
+ 376:	8b 45 08             	mov    0x8(%ebp),%eax
+ 379:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s2 = v2;
+ 37c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 37f:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+ 382:	eb 0c                	jmp    390 <memcmp+0x20>
+    s1 += 4, s2 += 4, n -= 4;
+ 384:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+ 388:	83 45 f8 04          	addl   $0x4,-0x8(%ebp)
+ 38c:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+ 390:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+ 394:	76 3e                	jbe    3d4 <memcmp+0x64>
+ 396:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 399:	8b 10                	mov    (%eax),%edx
+ 39b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 39e:	8b 00                	mov    (%eax),%eax
+ 3a0:	39 c2                	cmp    %eax,%edx
+ 3a2:	74 e0                	je     384 <memcmp+0x14>
+  while(n-- > 0){
+ 3a4:	eb 2e                	jmp    3d4 <memcmp+0x64>
+    if(*s1 != *s2)
+ 3a6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 3a9:	0f b6 10             	movzbl (%eax),%edx
+ 3ac:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 3af:	0f b6 00             	movzbl (%eax),%eax
+ 3b2:	38 c2                	cmp    %al,%dl
+ 3b4:	74 16                	je     3cc <memcmp+0x5c>
+      return *s1 - *s2;
+ 3b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 3b9:	0f b6 00             	movzbl (%eax),%eax
+ 3bc:	0f b6 d0             	movzbl %al,%edx
+ 3bf:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 3c2:	0f b6 00             	movzbl (%eax),%eax
+ 3c5:	0f b6 c0             	movzbl %al,%eax
+ 3c8:	29 c2                	sub    %eax,%edx
+ 3ca:	eb 1a                	jmp    3e6 <memcmp+0x76>
+    s1++, s2++;
+ 3cc:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 3d0:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+  while(n-- > 0){
+ 3d4:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3d7:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 3da:	89 55 10             	mov    %edx,0x10(%ebp)
+ 3dd:	85 c0                	test   %eax,%eax
+ 3df:	75 c5                	jne    3a6 <memcmp+0x36>
+  }
+  return 0;
+ 3e1:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+ 3e6:	89 d0                	mov    %edx,%eax
+ 3e8:	c9                   	leave
+ 3e9:	c3                   	ret
+
+000003ea <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3ea:	55                   	push   %ebp
+ 3eb:	89 e5                	mov    %esp,%ebp
+ 3ed:	83 ec 14             	sub    $0x14,%esp
+ 3f0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3f3:	88 45 ec             	mov    %al,-0x14(%ebp)
+  uint w, cc;
+
+  // Skip whole words holding neither c nor the terminator.
+  for(; ((uint)s & 3) && *s; s++)
+ 3f6:	eb 17                	jmp    40f <strchr+0x25>
+    if(*s == c)
+ 3f8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3fb:	0f b6 00             	movzbl (%eax),%eax
+ 3fe:	38 45 ec             	cmp    %al,-0x14(%ebp)
+ 401:	75 08                	jne    40b <strchr+0x21>
+      return (char*)s;
+ 403:	8b 45 08             	mov    0x8(%ebp),%eax
+ 406:	e9 ad 00 00 00       	jmp    4b8 <strchr+0xce>
+  for(; ((uint)s & 3) && *s; s++)
+ 40b:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 40f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 412:	83 e0 03             	and    $0x3,%eax
+ 415:	85 c0                	test   %eax,%eax
+ 417:	74 0a                	je     423 <strchr+0x39>
+ 419:	8b 45 08             	mov    0x8(%ebp),%eax
+ 41c:	0f b6 00             	movzbl (%eax),%eax
+ 41f:	84 c0                	test   %al,%al
+ 421:	75 d5                	jne    3f8 <strchr+0xe>
+  cc = (uchar)c * ONES;
+ 423:	0f b6 45 ec          	movzbl -0x14(%ebp),%eax
+ 427:	0f b6 c0             	movzbl %al,%eax
+ 42a:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+ 430:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(*s)
+ 433:	8b 45 08             	mov    0x8(%ebp),%eax
+ 436:	0f b6 00             	movzbl (%eax),%eax
+ 439:	84 c0                	test   %al,%al
+ 43b:	74 6c                	je     4a9 <strchr+0xbf>
+    for(; w = *(uint*)s, !HASZERO(w) && !HASZERO(w ^ cc); s += 4)
+ 43d:	eb 04                	jmp    443 <strchr+0x59>
+ 43f:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+ 443:	8b 45 08             	mov    0x8(%ebp),%eax
+ 446:	8b 00                	mov    (%eax),%eax
+ 448:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 44b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 44e:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+ 454:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 457:	f7 d0                	not    %eax
+ 459:	21 d0                	and    %edx,%eax
+ 45b:	25 80 80 80 80       	and    $0x80808080,%eax
+ 460:	85 c0                	test   %eax,%eax
+ 462:	75 26                	jne    48a <strchr+0xa0>
+ 464:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 467:	33 45 fc             	xor    -0x4(%ebp),%eax
+ 46a:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+ 470:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 473:	33 45 fc             	xor    -0x4(%ebp),%eax
+ 476:	f7 d0                	not    %eax
+ 478:	21 d0                	and    %edx,%eax
+ 47a:	25 80 80 80 80       	and    $0x80808080,%eax
+ 47f:	85 c0                	test   %eax,%eax
+ 481:	75 07                	jne    48a <strchr+0xa0>
+ 483:	b8 01 00 00 00       	mov    $0x1,%eax
+ 488:	eb 05                	jmp    48f <strchr+0xa5>
+ 48a:	b8 00 00 00 00       	mov    $0x0,%eax
+ 48f:	85 c0                	test   %eax,%eax
+ 491:	75 ac                	jne    43f <strchr+0x55>
+      ;
+  for(; *s; s++)
+ 493:	eb 14                	jmp    4a9 <strchr+0xbf>
+    if(*s == c)
+ 495:	8b 45 08             	mov    0x8(%ebp),%eax
+ 498:	0f b6 00             	movzbl (%eax),%eax
+ 49b:	38 45 ec             	cmp    %al,-0x14(%ebp)
+ 49e:	75 05                	jne    4a5 <strchr+0xbb>
+      return (char*)s;
+ 4a0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a3:	eb 13                	jmp    4b8 <strchr+0xce>
+  for(; *s; s++)
+ 4a5:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 4a9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4ac:	0f b6 00             	movzbl (%eax),%eax
+ 4af:	84 c0                	test   %al,%al
+ 4b1:	75 e2                	jne    495 <strchr+0xab>
+  return 0;
+ 4b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 4b8:	c9                   	leave
+ 4b9:	c3                   	ret
+
+000004ba <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 4ba:	55                   	push   %ebp
+ 4bb:	89 e5                	mov    %esp,%ebp
+ 4bd:	83 ec 18             	sub    $0x18,%esp
+  int i, c;
+
+  for(i=0; i+1 < max; ){
+ 4c0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 4c7:	eb 37                	jmp    500 <gets+0x46>
+    c = fgetc(0);
+ 4c9:	83 ec 0c             	sub    $0xc,%esp
+ 4cc:	6a 00                	push   $0x0
+ 4ce:	e8 f3 05 00 00       	call   ac6 <fgetc>
+ 4d3:	83 c4 10             	add    $0x10,%esp
+ 4d6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(c < 0)
+ 4d9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 4dd:	78 2e                	js     50d <gets+0x53>
+      break;
+    buf[i++] = c;
+ 4df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4e2:	8d 50 01             	lea    0x1(%eax),%edx
+ 4e5:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4e8:	89 c2                	mov    %eax,%edx
+ 4ea:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4ed:	01 d0                	add    %edx,%eax
+ 4ef:	8b 55 f0             	mov    -0x10(%ebp),%edx
+ 4f2:	88 10                	mov    %dl,(%eax)
+    if(c == '\n' || c == '\r')
+ 4f4:	83 7d f0 0a          	cmpl   $0xa,-0x10(%ebp)
+ 4f8:	74 14                	je     50e <gets+0x54>
+ 4fa:	83 7d f0 0d          	cmpl   $0xd,-0x10(%ebp)
+ 4fe:	74 0e                	je     50e <gets+0x54>
+  for(i=0; i+1 < max; ){
+ 500:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 503:	83 c0 01             	add    $0x1,%eax
+ 506:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 509:	7f be                	jg     4c9 <gets+0xf>
+ 50b:	eb 01                	jmp    50e <gets+0x54>
+      break;
+ 50d:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 50e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 511:	8b 45 08             	mov    0x8(%ebp),%eax
+ 514:	01 d0                	add    %edx,%eax
+ 516:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 519:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 51c:	c9                   	leave
+ 51d:	c3                   	ret
+
+0000051e <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 51e:	55                   	push   %ebp
+ 51f:	89 e5                	mov    %esp,%ebp
+ 521:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 524:	83 ec 08             	sub    $0x8,%esp
+ 527:	6a 00                	push   $0x0
+ 529:	ff 75 08             	push   0x8(%ebp)
+ 52c:	e8 3b 02 00 00       	call   76c <open>
+ 531:	83 c4 10             	add    $0x10,%esp
+ 534:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 537:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 53b:	79 07                	jns    544 <stat+0x26>
+    return -1;
+ 53d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 542:	eb 25                	jmp    569 <stat+0x4b>
+  r = fstat(fd, st);
+ 544:	83 ec 08             	sub    $0x8,%esp
+ 547:	ff 75 0c             	push   0xc(%ebp)
+ 54a:	ff 75 f4             	push   -0xc(%ebp)
+ 54d:	e8 47 02 00 00       	call   799 <fstat>
+ 552:	83 c4 10             	add    $0x10,%esp
+ 555:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 558:	83 ec 0c             	sub    $0xc,%esp
+ 55b:	ff 75 f4             	push   -0xc(%ebp)
+ 55e:	e8 8c 06 00 00       	call   bef <close>
+ 563:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 566:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 569:	c9                   	leave
+ 56a:	c3                   	ret
+
+0000056b <atoi>:
+
+int
+atoi(const char *s)
+{
+ 56b:	55                   	push   %ebp
+ 56c:	89 e5                	mov    %esp,%ebp
+ 56e:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 571:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 578:	eb 25                	jmp    59f <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 57a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 57d:	89 d0                	mov    %edx,%eax
+ 57f:	c1 e0 02             	shl    $0x2,%eax
+ 582:	01 d0                	add    %edx,%eax
+ 584:	01 c0                	add    %eax,%eax
+ 586:	89 c1                	mov    %eax,%ecx
+ 588:	8b 45 08             	mov    0x8(%ebp),%eax
+ 58b:	8d 50 01             	lea    0x1(%eax),%edx
+ 58e:	89 55 08             	mov    %edx,0x8(%ebp)
+ 591:	0f b6 00             	movzbl (%eax),%eax
+ 594:	0f be c0             	movsbl %al,%eax
+ 597:	01 c8                	add    %ecx,%eax
+ 599:	83 e8 30             	sub    $0x30,%eax
+ 59c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 59f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a2:	0f b6 00             	movzbl (%eax),%eax
+ 5a5:	3c 2f                	cmp    $0x2f,%al
+ 5a7:	7e 0a                	jle    5b3 <atoi+0x48>
+ 5a9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5ac:	0f b6 00             	movzbl (%eax),%eax
+ 5af:	3c 39                	cmp    $0x39,%al
+ 5b1:	7e c7                	jle    57a <atoi+0xf>
+  return n;
+ 5b3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 5b6:	c9                   	leave
+ 5b7:	c3                   	ret
+
+000005b8 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 5b8:	55                   	push   %ebp
+ 5b9:	89 e5                	mov    %esp,%ebp
+ 5bb:	83 ec 10             	sub    $0x10,%esp
+  char *d, *s;
+  int k;
+
+  if(n <= 0)
+ 5be:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 5c2:	7f 08                	jg     5cc <memmove+0x14>
+    return vdst;
+ 5c4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5c7:	e9 17 01 00 00       	jmp    6e3 <memmove+0x12b>
+  d = vdst;
+ 5cc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5cf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s = vsrc;
+ 5d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5d5:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  if(s < d && s + n > d){
+ 5d8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 5db:	3b 45 fc             	cmp    -0x4(%ebp),%eax
+ 5de:	0f 83 84 00 00 00    	jae    668 <memmove+0xb0>
+ 5e4:	8b 55 10             	mov    0x10(%ebp),%edx
+ 5e7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 5ea:	01 d0                	add    %edx,%eax
+ 5ec:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 5ef:	73 77                	jae    668 <memmove+0xb0>
+    s += n;
+ 5f1:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5f4:	01 45 f8             	add    %eax,-0x8(%ebp)
+    d += n;
+ 5f7:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5fa:	01 45 fc             	add    %eax,-0x4(%ebp)
+    while(n > 0 && ((uint)d & 3))
+ 5fd:	eb 17                	jmp    616 <memmove+0x5e>
+      *--d = *--s, n--;
+ 5ff:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+ 603:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+ 607:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 60a:	0f b6 10             	movzbl (%eax),%edx
+ 60d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 610:	88 10                	mov    %dl,(%eax)
+ 612:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+    while(n > 0 && ((uint)d & 3))
+ 616:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+ 61a:	7e 22                	jle    63e <memmove+0x86>
+ 61c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 61f:	83 e0 03             	and    $0x3,%eax
+ 622:	85 c0                	test   %eax,%eax
+ 624:	75 d9                	jne    5ff <memmove+0x47>
+    for(; n >= 4; n -= 4){
+ 626:	eb 16                	jmp    63e <memmove+0x86>
+      d -= 4;
+ 628:	83 6d fc 04          	subl   $0x4,-0x4(%ebp)
+      s -= 4;
+ 62c:	83 6d f8 04          	subl   $0x4,-0x8(%ebp)
+      *(uint*)d = *(uint*)s;
+ 630:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 633:	8b 10                	mov    (%eax),%edx
+ 635:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 638:	89 10                	mov    %edx,(%eax)
+    for(; n >= 4; n -= 4){
+ 63a:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+ 63e:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+ 642:	7f e4                	jg     628 <memmove+0x70>
+    }
+    while(n-- > 0)
+ 644:	eb 13                	jmp    659 <memmove+0xa1>
+      *--d = *--s;
+ 646:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+ 64a:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+ 64e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 651:	0f b6 10             	movzbl (%eax),%edx
+ 654:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 657:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+ 659:	8b 45 10             	mov    0x10(%ebp),%eax
+ 65c:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 65f:	89 55 10             	mov    %edx,0x10(%ebp)
+ 662:	85 c0                	test   %eax,%eax
+ 664:	7f e0                	jg     646 <memmove+0x8e>
+  if(s < d && s + n > d){
+ 666:	eb 78                	jmp    6e0 <memmove+0x128>
+  } else {
+    if(n >= 16){
+ 668:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+ 66c:	7e 61                	jle    6cf <memmove+0x117>
+      k = -(uint)d & 3;
+ 66e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 671:	f7 d8                	neg    %eax
+ 673:	83 e0 03             	and    $0x3,%eax
+ 676:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      movsb(d, s, k);
+ 679:	ff 75 f4             	push   -0xc(%ebp)
+ 67c:	ff 75 f8             	push   -0x8(%ebp)
+ 67f:	ff 75 fc             	push   -0x4(%ebp)
+ 682:	e8 cd fa ff ff       	call   154 <movsb>
+ 687:	83 c4 0c             	add    $0xc,%esp
+      d += k;
+ 68a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 68d:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += k;
+ 690:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 693:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n -= k;
+ 696:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 699:	29 45 10             	sub    %eax,0x10(%ebp)
+      movsl(d, s, n/4);
+ 69c:	8b 45 10             	mov    0x10(%ebp),%eax
+ 69f:	8d 50 03             	lea    0x3(%eax),%edx
+ 6a2:	85 c0                	test   %eax,%eax
+ 6a4:	0f 48 c2             	cmovs  %edx,%eax
+ 6a7:	c1 f8 02             	sar    $0x2,%eax
+ 6aa:	50                   	push   %eax
+ 6ab:	ff 75 f8             	push   -0x8(%ebp)
+ 6ae:	ff 75 fc             	push   -0x4(%ebp)
+ 6b1:	e8 cd fa ff ff       	call   183 <movsl>
+ 6b6:	83 c4 0c             	add    $0xc,%esp
+      d += n & ~3;
+ 6b9:	8b 45 10             	mov    0x10(%ebp),%eax
+ 6bc:	83 e0 fc             	and    $0xfffffffc,%eax
+ 6bf:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += n & ~3;
+ 6c2:	8b 45 10             	mov    0x10(%ebp),%eax
+ 6c5:	83 e0 fc             	and    $0xfffffffc,%eax
+ 6c8:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n &= 3;
+ 6cb:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+    }
+    movsb(d, s, n);
+ 6cf:	ff 75 10             	push   0x10(%ebp)
+ 6d2:	ff 75 f8             	push   -0x8(%ebp)
+ 6d5:	ff 75 fc             	push   -0x4(%ebp)
+ 6d8:	e8 77 fa ff ff       	call   154 <movsb>
+ 6dd:	83 c4 0c             	add    $0xc,%esp
+  }
+  return vdst;
+ 6e0:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 6e3:	c9                   	leave
+ 6e4:	c3                   	ret
+
+000006e5 <_fork>:
+    movl %esp, %ecx; \
+    movl $1f, %edx; \
+    sysenter; \
+  1: ret
+
+RAWSYSCALL(fork)
+ 6e5:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6ea:	89 e1                	mov    %esp,%ecx
+ 6ec:	ba f3 06 00 00       	mov    $0x6f3,%edx
+ 6f1:	0f 34                	sysenter
+ 6f3:	c3                   	ret
+
+000006f4 <_exit>:
+RAWSYSCALL(exit)
+ 6f4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6f9:	89 e1                	mov    %esp,%ecx
+ 6fb:	ba 02 07 00 00       	mov    $0x702,%edx
+ 700:	0f 34                	sysenter
+ 702:	c3                   	ret
+
+00000703 <wait>:
+SYSCALL(wait)
+ 703:	b8 03 00 00 00       	mov    $0x3,%eax
+ 708:	89 e1                	mov    %esp,%ecx
+ 70a:	ba 11 07 00 00       	mov    $0x711,%edx
+ 70f:	0f 34                	sysenter
+ 711:	c3                   	ret
+
+00000712 <pipe>:
+SYSCALL(pipe)
+ 712:	b8 04 00 00 00       	mov    $0x4,%eax
+ 717:	89 e1                	mov    %esp,%ecx
+ 719:	ba 20 07 00 00       	mov    $0x720,%edx
+ 71e:	0f 34                	sysenter
+ 720:	c3                   	ret
+
+00000721 <read>:
+SYSCALL(read)
+ 721:	b8 05 00 00 00       	mov    $0x5,%eax
+ 726:	89 e1                	mov    %esp,%ecx
+ 728:	ba 2f 07 00 00       	mov    $0x72f,%edx
+ 72d:	0f 34                	sysenter
+ 72f:	c3                   	ret
+
+00000730 <write>:
+SYSCALL(write)
+ 730:	b8 10 00 00 00       	mov    $0x10,%eax
+ 735:	89 e1                	mov    %esp,%ecx
+ 737:	ba 3e 07 00 00       	mov    $0x73e,%edx
+ 73c:	0f 34                	sysenter
+ 73e:	c3                   	ret
+
+0000073f <_close>:
+RAWSYSCALL(close)
+ 73f:	b8 15 00 00 00       	mov    $0x15,%eax
+ 744:	89 e1                	mov    %esp,%ecx
+ 746:	ba 4d 07 00 00       	mov    $0x74d,%edx
+ 74b:	0f 34                	sysenter
+ 74d:	c3                   	ret
+
+0000074e <kill>:
+SYSCALL(kill)
+ 74e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 753:	89 e1                	mov    %esp,%ecx
+ 755:	ba 5c 07 00 00       	mov    $0x75c,%edx
+ 75a:	0f 34                	sysenter
+ 75c:	c3                   	ret
+
+0000075d <_exec>:
+RAWSYSCALL(exec)
+ 75d:	b8 07 00 00 00       	mov    $0x7,%eax
+ 762:	89 e1                	mov    %esp,%ecx
+ 764:	ba 6b 07 00 00       	mov    $0x76b,%edx
+ 769:	0f 34                	sysenter
+ 76b:	c3                   	ret
+
+0000076c <open>:
+SYSCALL(open)
+ 76c:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 771:	89 e1                	mov    %esp,%ecx
+ 773:	ba 7a 07 00 00       	mov    $0x77a,%edx
+ 778:	0f 34                	sysenter
+ 77a:	c3                   	ret
+
+0000077b <mknod>:
+SYSCALL(mknod)
+ 77b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 780:	89 e1                	mov    %esp,%ecx
+ 782:	ba 89 07 00 00       	mov    $0x789,%edx
+ 787:	0f 34                	sysenter
+ 789:	c3                   	ret
+
+0000078a <unlink>:
+SYSCALL(unlink)
+ 78a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 78f:	89 e1                	mov    %esp,%ecx
+ 791:	ba 98 07 00 00       	mov    $0x798,%edx
+ 796:	0f 34                	sysenter
+ 798:	c3                   	ret
+
+00000799 <fstat>:
+SYSCALL(fstat)
+ 799:	b8 08 00 00 00       	mov    $0x8,%eax
+ 79e:	89 e1                	mov    %esp,%ecx
+ 7a0:	ba a7 07 00 00       	mov    $0x7a7,%edx
+ 7a5:	0f 34                	sysenter
+ 7a7:	c3                   	ret
+
+000007a8 <link>:
+SYSCALL(link)
+ 7a8:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7ad:	89 e1                	mov    %esp,%ecx
+ 7af:	ba b6 07 00 00       	mov    $0x7b6,%edx
+ 7b4:	0f 34                	sysenter
+ 7b6:	c3                   	ret
+
+000007b7 <mkdir>:
+SYSCALL(mkdir)
+ 7b7:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7bc:	89 e1                	mov    %esp,%ecx
+ 7be:	ba c5 07 00 00       	mov    $0x7c5,%edx
+ 7c3:	0f 34                	sysenter
+ 7c5:	c3                   	ret
+
+000007c6 <chdir>:
+SYSCALL(chdir)
+ 7c6:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7cb:	89 e1                	mov    %esp,%ecx
+ 7cd:	ba d4 07 00 00       	mov    $0x7d4,%edx
+ 7d2:	0f 34                	sysenter
+ 7d4:	c3                   	ret
+
+000007d5 <dup>:
+SYSCALL(dup)
+ 7d5:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7da:	89 e1                	mov    %esp,%ecx
+ 7dc:	ba e3 07 00 00       	mov    $0x7e3,%edx
+ 7e1:	0f 34                	sysenter
+ 7e3:	c3                   	ret
+
+000007e4 <getpid>:
+SYSCALL(getpid)
+ 7e4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7e9:	89 e1                	mov    %esp,%ecx
+ 7eb:	ba f2 07 00 00       	mov    $0x7f2,%edx
+ 7f0:	0f 34                	sysenter
+ 7f2:	c3                   	ret
+
+000007f3 <sbrk>:
+SYSCALL(sbrk)
+ 7f3:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 7f8:	89 e1                	mov    %esp,%ecx
+ 7fa:	ba 01 08 00 00       	mov    $0x801,%edx
+ 7ff:	0f 34                	sysenter
+ 801:	c3                   	ret
+
+00000802 <sleep>:
+SYSCALL(sleep)
+ 802:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 807:	89 e1                	mov    %esp,%ecx
+ 809:	ba 10 08 00 00       	mov    $0x810,%edx
+ 80e:	0f 34                	sysenter
+ 810:	c3                   	ret
+
+00000811 <uptime>:
+SYSCALL(uptime)
+ 811:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 816:	89 e1                	mov    %esp,%ecx
+ 818:	ba 1f 08 00 00       	mov    $0x81f,%edx
+ 81d:	0f 34                	sysenter
+ 81f:	c3                   	ret
+
+00000820 <getproc>:
+SYSCALL(getproc)
+ 820:	b8 16 00 00 00       	mov    $0x16,%eax
+ 825:	89 e1                	mov    %esp,%ecx
+ 827:	ba 2e 08 00 00       	mov    $0x82e,%edx
+ 82c:	0f 34                	sysenter
+ 82e:	c3                   	ret
+
+0000082f <getpgs>:
+SYSCALL(getpgs)
+ 82f:	b8 17 00 00 00       	mov    $0x17,%eax
+ 834:	89 e1                	mov    %esp,%ecx
+ 836:	ba 3d 08 00 00       	mov    $0x83d,%edx
+ 83b:	0f 34                	sysenter
+ 83d:	c3                   	ret
+
+0000083e <loadproc>:
+SYSCALL(loadproc)
+ 83e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 843:	89 e1                	mov    %esp,%ecx
+ 845:	ba 4c 08 00 00       	mov    $0x84c,%edx
+ 84a:	0f 34                	sysenter
+ 84c:	c3                   	ret
+
+0000084d <iosubmit>:
+SYSCALL(iosubmit)
+ 84d:	b8 19 00 00 00       	mov    $0x19,%eax
+ 852:	89 e1                	mov    %esp,%ecx
+ 854:	ba 5b 08 00 00       	mov    $0x85b,%edx
+ 859:	0f 34                	sysenter
+ 85b:	c3                   	ret
+
+0000085c <sysstat>:
+SYSCALL(sysstat)
+ 85c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 861:	89 e1                	mov    %esp,%ecx
+ 863:	ba 6a 08 00 00       	mov    $0x86a,%edx
+ 868:	0f 34                	sysenter
+ 86a:	c3                   	ret
+
+0000086b <splice>:
+SYSCALL(splice)
+ 86b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 870:	89 e1                	mov    %esp,%ecx
+ 872:	ba 79 08 00 00       	mov    $0x879,%edx
+ 877:	0f 34                	sysenter
+ 879:	c3                   	ret
+
+0000087a <fsync>:
+SYSCALL(fsync)
+ 87a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 87f:	89 e1                	mov    %esp,%ecx
+ 881:	ba 88 08 00 00       	mov    $0x888,%edx
+ 886:	0f 34                	sysenter
+ 888:	c3                   	ret
+
+00000889 <fdatasync>:
+SYSCALL(fdatasync)
+ 889:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 88e:	89 e1                	mov    %esp,%ecx
+ 890:	ba 97 08 00 00       	mov    $0x897,%edx
+ 895:	0f 34                	sysenter
+ 897:	c3                   	ret
+
+00000898 <lseek>:
+SYSCALL(lseek)
+ 898:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 89d:	89 e1                	mov    %esp,%ecx
+ 89f:	ba a6 08 00 00       	mov    $0x8a6,%edx
+ 8a4:	0f 34                	sysenter
+ 8a6:	c3                   	ret
+
+000008a7 <dmesg>:
+SYSCALL(dmesg)
+ 8a7:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 8ac:	89 e1                	mov    %esp,%ecx
+ 8ae:	ba b5 08 00 00       	mov    $0x8b5,%edx
+ 8b3:	0f 34                	sysenter
+ 8b5:	c3                   	ret
+
+000008b6 <lockstat>:
+SYSCALL(lockstat)
+ 8b6:	b8 20 00 00 00       	mov    $0x20,%eax
+ 8bb:	89 e1                	mov    %esp,%ecx
+ 8bd:	ba c4 08 00 00       	mov    $0x8c4,%edx
+ 8c2:	0f 34                	sysenter
+ 8c4:	c3                   	ret
+
+000008c5 <stream>:
+
+// Return the stream for fd, deciding on first use how
+// its output is buffered.  Returns 0 if fd is not open.
+static struct stream*
+stream(int fd)
+{
+ 8c5:	55                   	push   %ebp
+ 8c6:	89 e5                	mov    %esp,%ebp
+ 8c8:	83 ec 28             	sub    $0x28,%esp
+  struct stream *s;
+  struct stat st;
+
+  if(fd < 0 || fd >= NOFILE)
+ 8cb:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 8cf:	78 06                	js     8d7 <stream+0x12>
+ 8d1:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+ 8d5:	7e 07                	jle    8de <stream+0x19>
+    return 0;
+ 8d7:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8dc:	eb 55                	jmp    933 <stream+0x6e>
+  s = &streams[fd];
+ 8de:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8e1:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+ 8e7:	05 40 10 00 00       	add    $0x1040,%eax
+ 8ec:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(s->mode == UNKNOWN){
+ 8ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8f2:	8b 00                	mov    (%eax),%eax
+ 8f4:	85 c0                	test   %eax,%eax
+ 8f6:	75 38                	jne    930 <stream+0x6b>
+    if(fstat(fd, &st) < 0)
+ 8f8:	83 ec 08             	sub    $0x8,%esp
+ 8fb:	8d 45 e0             	lea    -0x20(%ebp),%eax
+ 8fe:	50                   	push   %eax
+ 8ff:	ff 75 08             	push   0x8(%ebp)
+ 902:	e8 92 fe ff ff       	call   799 <fstat>
+ 907:	83 c4 10             	add    $0x10,%esp
+ 90a:	85 c0                	test   %eax,%eax
+ 90c:	79 07                	jns    915 <stream+0x50>
+      return 0;
+ 90e:	b8 00 00 00 00       	mov    $0x0,%eax
+ 913:	eb 1e                	jmp    933 <stream+0x6e>
+    s->mode = st.type == T_DEV ? LINEBUF : FULLBUF;
+ 915:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+ 919:	66 83 f8 03          	cmp    $0x3,%ax
+ 91d:	75 07                	jne    926 <stream+0x61>
+ 91f:	ba 01 00 00 00       	mov    $0x1,%edx
+ 924:	eb 05                	jmp    92b <stream+0x66>
+ 926:	ba 02 00 00 00       	mov    $0x2,%edx
+ 92b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 92e:	89 10                	mov    %edx,(%eax)
+  }
+  return s;
+ 930:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 933:	c9                   	leave
+ 934:	c3                   	ret
+
+00000935 <fflush>:
+
+int
+fflush(int fd)
+{
+ 935:	55                   	push   %ebp
+ 936:	89 e5                	mov    %esp,%ebp
+ 938:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  int i, n;
+
+  if(fd < 0 || fd >= NOFILE)
+ 93b:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 93f:	78 06                	js     947 <fflush+0x12>
+ 941:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+ 945:	7e 07                	jle    94e <fflush+0x19>
+    return -1;
+ 947:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 94c:	eb 78                	jmp    9c6 <fflush+0x91>
+  s = &streams[fd];
+ 94e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 951:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+ 957:	05 40 10 00 00       	add    $0x1040,%eax
+ 95c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < s->nout; i += n){
+ 95f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 966:	eb 44                	jmp    9ac <fflush+0x77>
+    if((n = write(fd, s->out + i, s->nout - i)) <= 0){
+ 968:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 96b:	8b 40 04             	mov    0x4(%eax),%eax
+ 96e:	2b 45 f4             	sub    -0xc(%ebp),%eax
+ 971:	8b 55 f0             	mov    -0x10(%ebp),%edx
+ 974:	8d 4a 10             	lea    0x10(%edx),%ecx
+ 977:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 97a:	01 ca                	add    %ecx,%edx
+ 97c:	83 ec 04             	sub    $0x4,%esp
+ 97f:	50                   	push   %eax
+ 980:	52                   	push   %edx
+ 981:	ff 75 08             	push   0x8(%ebp)
+ 984:	e8 a7 fd ff ff       	call   730 <write>
+ 989:	83 c4 10             	add    $0x10,%esp
+ 98c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 98f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 993:	7f 11                	jg     9a6 <fflush+0x71>
+      s->nout = 0;
+ 995:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 998:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+      return -1;
+ 99f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 9a4:	eb 20                	jmp    9c6 <fflush+0x91>
+  for(i = 0; i < s->nout; i += n){
+ 9a6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 9a9:	01 45 f4             	add    %eax,-0xc(%ebp)
+ 9ac:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9af:	8b 40 04             	mov    0x4(%eax),%eax
+ 9b2:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 9b5:	7c b1                	jl     968 <fflush+0x33>
+    }
+  }
+  s->nout = 0;
+ 9b7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9ba:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  return 0;
+ 9c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 9c6:	c9                   	leave
+ 9c7:	c3                   	ret
+
+000009c8 <flushall>:
+
+// Flush every stream, or only line-buffered ones.
+static void
+flushall(int lineonly)
+{
+ 9c8:	55                   	push   %ebp
+ 9c9:	89 e5                	mov    %esp,%ebp
+ 9cb:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+ 9ce:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 9d5:	eb 41                	jmp    a18 <flushall+0x50>
+    if(streams[fd].nout > 0 && (!lineonly || streams[fd].mode == LINEBUF))
+ 9d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9da:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+ 9e0:	05 44 10 00 00       	add    $0x1044,%eax
+ 9e5:	8b 00                	mov    (%eax),%eax
+ 9e7:	85 c0                	test   %eax,%eax
+ 9e9:	7e 29                	jle    a14 <flushall+0x4c>
+ 9eb:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 9ef:	74 15                	je     a06 <flushall+0x3e>
+ 9f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9f4:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+ 9fa:	05 40 10 00 00       	add    $0x1040,%eax
+ 9ff:	8b 00                	mov    (%eax),%eax
+ a01:	83 f8 01             	cmp    $0x1,%eax
+ a04:	75 0e                	jne    a14 <flushall+0x4c>
+      fflush(fd);
+ a06:	83 ec 0c             	sub    $0xc,%esp
+ a09:	ff 75 f4             	push   -0xc(%ebp)
+ a0c:	e8 24 ff ff ff       	call   935 <fflush>
+ a11:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++)
+ a14:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ a18:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+ a1c:	7e b9                	jle    9d7 <flushall+0xf>
+}
+ a1e:	90                   	nop
+ a1f:	90                   	nop
+ a20:	c9                   	leave
+ a21:	c3                   	ret
+
+00000a22 <fputc>:
+
+int
+fputc(int fd, int c)
+{
+ a22:	55                   	push   %ebp
+ a23:	89 e5                	mov    %esp,%ebp
+ a25:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  char ch;
+
+  if((s = stream(fd)) == 0){
+ a28:	83 ec 0c             	sub    $0xc,%esp
+ a2b:	ff 75 08             	push   0x8(%ebp)
+ a2e:	e8 92 fe ff ff       	call   8c5 <stream>
+ a33:	83 c4 10             	add    $0x10,%esp
+ a36:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a39:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a3d:	75 2e                	jne    a6d <fputc+0x4b>
+    ch = c;
+ a3f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a42:	88 45 f3             	mov    %al,-0xd(%ebp)
+    return write(fd, &ch, 1) == 1 ? (uchar)c : -1;
+ a45:	83 ec 04             	sub    $0x4,%esp
+ a48:	6a 01                	push   $0x1
+ a4a:	8d 45 f3             	lea    -0xd(%ebp),%eax
+ a4d:	50                   	push   %eax
+ a4e:	ff 75 08             	push   0x8(%ebp)
+ a51:	e8 da fc ff ff       	call   730 <write>
+ a56:	83 c4 10             	add    $0x10,%esp
+ a59:	83 f8 01             	cmp    $0x1,%eax
+ a5c:	75 08                	jne    a66 <fputc+0x44>
+ a5e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a61:	0f b6 c0             	movzbl %al,%eax
+ a64:	eb 5e                	jmp    ac4 <fputc+0xa2>
+ a66:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ a6b:	eb 57                	jmp    ac4 <fputc+0xa2>
+  }
+  s->out[s->nout++] = c;
+ a6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a70:	8b 40 04             	mov    0x4(%eax),%eax
+ a73:	8d 48 01             	lea    0x1(%eax),%ecx
+ a76:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ a79:	89 4a 04             	mov    %ecx,0x4(%edx)
+ a7c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ a7f:	89 d1                	mov    %edx,%ecx
+ a81:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ a84:	88 4c 02 10          	mov    %cl,0x10(%edx,%eax,1)
+  if(s->nout == BUFSZ || (s->mode == LINEBUF && c == '\n'))
+ a88:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a8b:	8b 40 04             	mov    0x4(%eax),%eax
+ a8e:	3d 00 02 00 00       	cmp    $0x200,%eax
+ a93:	74 10                	je     aa5 <fputc+0x83>
+ a95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a98:	8b 00                	mov    (%eax),%eax
+ a9a:	83 f8 01             	cmp    $0x1,%eax
+ a9d:	75 1f                	jne    abe <fputc+0x9c>
+ a9f:	83 7d 0c 0a          	cmpl   $0xa,0xc(%ebp)
+ aa3:	75 19                	jne    abe <fputc+0x9c>
+    if(fflush(fd) < 0)
+ aa5:	83 ec 0c             	sub    $0xc,%esp
+ aa8:	ff 75 08             	push   0x8(%ebp)
+ aab:	e8 85 fe ff ff       	call   935 <fflush>
+ ab0:	83 c4 10             	add    $0x10,%esp
+ ab3:	85 c0                	test   %eax,%eax
+ ab5:	79 07                	jns    abe <fputc+0x9c>
+      return -1;
+ ab7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ abc:	eb 06                	jmp    ac4 <fputc+0xa2>
+  return (uchar)c;
+ abe:	8b 45 0c             	mov    0xc(%ebp),%eax
+ ac1:	0f b6 c0             	movzbl %al,%eax
+}
+ ac4:	c9                   	leave
+ ac5:	c3                   	ret
+
+00000ac6 <fgetc>:
+
+// Return the next byte read from fd, or -1 at end of file.
+int
+fgetc(int fd)
+{
+ ac6:	55                   	push   %ebp
+ ac7:	89 e5                	mov    %esp,%ebp
+ ac9:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  uchar c;
+  int n;
+
+  if((s = stream(fd)) == 0){
+ acc:	83 ec 0c             	sub    $0xc,%esp
+ acf:	ff 75 08             	push   0x8(%ebp)
+ ad2:	e8 ee fd ff ff       	call   8c5 <stream>
+ ad7:	83 c4 10             	add    $0x10,%esp
+ ada:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ add:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ae1:	75 39                	jne    b1c <fgetc+0x56>
+    flushall(1);
+ ae3:	83 ec 0c             	sub    $0xc,%esp
+ ae6:	6a 01                	push   $0x1
+ ae8:	e8 db fe ff ff       	call   9c8 <flushall>
+ aed:	83 c4 10             	add    $0x10,%esp
+    return read(fd, &c, 1) == 1 ? c : -1;
+ af0:	83 ec 04             	sub    $0x4,%esp
+ af3:	6a 01                	push   $0x1
+ af5:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ af8:	50                   	push   %eax
+ af9:	ff 75 08             	push   0x8(%ebp)
+ afc:	e8 20 fc ff ff       	call   721 <read>
+ b01:	83 c4 10             	add    $0x10,%esp
+ b04:	83 f8 01             	cmp    $0x1,%eax
+ b07:	75 0c                	jne    b15 <fgetc+0x4f>
+ b09:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ b0d:	0f b6 c0             	movzbl %al,%eax
+ b10:	e9 80 00 00 00       	jmp    b95 <fgetc+0xcf>
+ b15:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ b1a:	eb 79                	jmp    b95 <fgetc+0xcf>
+  }
+  if(s->rpos == s->rend){
+ b1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b1f:	8b 50 08             	mov    0x8(%eax),%edx
+ b22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b25:	8b 40 0c             	mov    0xc(%eax),%eax
+ b28:	39 c2                	cmp    %eax,%edx
+ b2a:	75 4c                	jne    b78 <fgetc+0xb2>
+    flushall(1);
+ b2c:	83 ec 0c             	sub    $0xc,%esp
+ b2f:	6a 01                	push   $0x1
+ b31:	e8 92 fe ff ff       	call   9c8 <flushall>
+ b36:	83 c4 10             	add    $0x10,%esp
+    if((n = read(fd, s->in, BUFSZ)) <= 0)
+ b39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b3c:	05 10 02 00 00       	add    $0x210,%eax
+ b41:	83 ec 04             	sub    $0x4,%esp
+ b44:	68 00 02 00 00       	push   $0x200
+ b49:	50                   	push   %eax
+ b4a:	ff 75 08             	push   0x8(%ebp)
+ b4d:	e8 cf fb ff ff       	call   721 <read>
+ b52:	83 c4 10             	add    $0x10,%esp
+ b55:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b58:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ b5c:	7f 07                	jg     b65 <fgetc+0x9f>
+      return -1;
+ b5e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ b63:	eb 30                	jmp    b95 <fgetc+0xcf>
+    s->rpos = 0;
+ b65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b68:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+    s->rend = n;
+ b6f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b72:	8b 55 f0             	mov    -0x10(%ebp),%edx
+ b75:	89 50 0c             	mov    %edx,0xc(%eax)
+  }
+  return (uchar)s->in[s->rpos++];
+ b78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b7b:	8b 40 08             	mov    0x8(%eax),%eax
+ b7e:	8d 48 01             	lea    0x1(%eax),%ecx
+ b81:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ b84:	89 4a 08             	mov    %ecx,0x8(%edx)
+ b87:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ b8a:	0f b6 84 02 10 02 00 	movzbl 0x210(%edx,%eax,1),%eax
+ b91:	00 
+ b92:	0f b6 c0             	movzbl %al,%eax
+}
+ b95:	c9                   	leave
+ b96:	c3                   	ret
+
+00000b97 <fork>:
+
+int
+fork(void)
+{
+ b97:	55                   	push   %ebp
+ b98:	89 e5                	mov    %esp,%ebp
+ b9a:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+ b9d:	83 ec 0c             	sub    $0xc,%esp
+ ba0:	6a 00                	push   $0x0
+ ba2:	e8 21 fe ff ff       	call   9c8 <flushall>
+ ba7:	83 c4 10             	add    $0x10,%esp
+  return _fork();
+ baa:	e8 36 fb ff ff       	call   6e5 <_fork>
+}
+ baf:	c9                   	leave
+ bb0:	c3                   	ret
+
+00000bb1 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+ bb1:	55                   	push   %ebp
+ bb2:	89 e5                	mov    %esp,%ebp
+ bb4:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+ bb7:	83 ec 0c             	sub    $0xc,%esp
+ bba:	6a 00                	push   $0x0
+ bbc:	e8 07 fe ff ff       	call   9c8 <flushall>
+ bc1:	83 c4 10             	add    $0x10,%esp
+  return _exec(path, argv);
+ bc4:	83 ec 08             	sub    $0x8,%esp
+ bc7:	ff 75 0c             	push   0xc(%ebp)
+ bca:	ff 75 08             	push   0x8(%ebp)
+ bcd:	e8 8b fb ff ff       	call   75d <_exec>
+ bd2:	83 c4 10             	add    $0x10,%esp
+}
+ bd5:	c9                   	leave
+ bd6:	c3                   	ret
+
+00000bd7 <exit>:
+
+int
+exit(void)
+{
+ bd7:	55                   	push   %ebp
+ bd8:	89 e5                	mov    %esp,%ebp
+ bda:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+ bdd:	83 ec 0c             	sub    $0xc,%esp
+ be0:	6a 00                	push   $0x0
+ be2:	e8 e1 fd ff ff       	call   9c8 <flushall>
+ be7:	83 c4 10             	add    $0x10,%esp
+  _exit();
+ bea:	e8 05 fb ff ff       	call   6f4 <_exit>
+
+00000bef <close>:
+}
+
+int
+close(int fd)
+{
+ bef:	55                   	push   %ebp
+ bf0:	89 e5                	mov    %esp,%ebp
+ bf2:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+
+  if(fd >= 0 && fd < NOFILE){
+ bf5:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ bf9:	78 44                	js     c3f <close+0x50>
+ bfb:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+ bff:	7f 3e                	jg     c3f <close+0x50>
+    fflush(fd);
+ c01:	83 ec 0c             	sub    $0xc,%esp
+ c04:	ff 75 08             	push   0x8(%ebp)
+ c07:	e8 29 fd ff ff       	call   935 <fflush>
+ c0c:	83 c4 10             	add    $0x10,%esp
+    s = &streams[fd];
+ c0f:	8b 45 08             	mov    0x8(%ebp),%eax
+ c12:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+ c18:	05 40 10 00 00       	add    $0x1040,%eax
+ c1d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    s->mode = UNKNOWN;
+ c20:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c23:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    s->rpos = s->rend = 0;
+ c29:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c2c:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+ c33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c36:	8b 50 0c             	mov    0xc(%eax),%edx
+ c39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c3c:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  return _close(fd);
+ c3f:	83 ec 0c             	sub    $0xc,%esp
+ c42:	ff 75 08             	push   0x8(%ebp)
+ c45:	e8 f5 fa ff ff       	call   73f <_close>
+ c4a:	83 c4 10             	add    $0x10,%esp
+}
+ c4d:	c9                   	leave
+ c4e:	c3                   	ret
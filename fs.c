@@ -15,7 +15,9 @@
 #include "stat.h"
 #include "mmu.h"
 #include "proc.h"
+#include "x86.h"
 #include "spinlock.h"
+#include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
 #include "file.h"
@@ -48,30 +50,129 @@ bzero(int dev, int bno)
 }
 
 // Blocks. 
+//
+// balloc() and bfree() keep an in-memory copy of the free
+// bitmap, with the same bit layout as on disk, and a count of
+// the free blocks in each group of BPG blocks.  balloc()
+// searches the copy, skipping full groups and full words,
+// and only reads the one bitmap block it has to change.
+// It takes the first free block at or after a goal, which
+// bmap() sets just past the file's previous block, so files
+// are laid out contiguously when space allows.
+//
+// bfree() does not put a block back in the copy at once: it
+// stays in use, in a pending set, until the transaction that
+// freed it commits.  Otherwise balloc() could give it to
+// another file whose data bflush() writes in place before
+// that commit, and a crash would leave the file that freed
+// it, still on disk, holding the other file's bytes.
+// close_trans() calls bmapclose() and logflush() calls
+// bmapcommit(), with the two pending sets taking turns.
+
+#define BPG       256   // blocks per group in fsmap.gfree
+#define BPP       (PGSIZE*8)  // blocks per page of fsmap.map
+#define NBMAPPAGE 8     // supports file systems up to NBMAPPAGE*BPP blocks
 
-// Allocate a zeroed disk block.
-static uint
-balloc(uint dev)
+struct {
+  struct spinlock lock;
+  uint *map[NBMAPPAGE];   // bit set if block is in use
+  ushort gfree[NBMAPPAGE*BPP/BPG];
+  uint rotor;             // goal when the caller has none
+  uint *pend[2][NBMAPPAGE];  // bit set if freed but not committed
+  uint npend[2];
+  int cur;                // pend[cur] is the open transaction's
+} fsmap;
+
+#define MAPWORD(b) (fsmap.map[(b)/BPP][((b)%BPP)/32])
+#define MAPBIT(b)  (1U << ((b)%32))
+#define PENDWORD(i, b) (fsmap.pend[i][(b)/BPP][((b)%BPP)/32])
+
+// Read the free bitmap of dev into fsmap.
+static void
+bmapinit(int dev)
 {
-  int b, bi, m;
   struct buf *bp;
-
-  bp = 0;
+  uint b, n;
+
+  initlock(&fsmap.lock, "fsmap");
+  n = (sb.size + BPP - 1) / BPP;
+  if(n > NBMAPPAGE)
+    panic("bmapinit: file system too big");
+  for(b = 0; b < n; b++){
+    if((fsmap.map[b] = (uint*)kalloc()) == 0 ||
+       (fsmap.pend[0][b] = (uint*)kalloc()) == 0 ||
+       (fsmap.pend[1][b] = (uint*)kalloc()) == 0)
+      panic("bmapinit: kalloc");
+    memset(fsmap.map[b], 0xff, PGSIZE);
+    memset(fsmap.pend[0][b], 0, PGSIZE);
+    memset(fsmap.pend[1][b], 0, PGSIZE);
+  }
   for(b = 0; b < sb.size; b += BPB){
     bp = bread(dev, BBLOCK(b, sb));
-    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
-      m = 1 << (bi % 8);
-      if((bp->data[bi/8] & m) == 0){  // Is block free?
-        bp->data[bi/8] |= m;  // Mark block in use.
-        log_write(bp);
-        brelse(bp);
-        bzero(dev, b + bi);
-        return b + bi;
-      }
-    }
+    memmove((char*)fsmap.map[b/BPP] + (b%BPP)/8, bp->data, BSIZE);
     brelse(bp);
   }
-  panic("balloc: out of blocks");
+  // Bits past the end of the file system are never free.
+  for(b = sb.size; b < n*BPP; b++)
+    MAPWORD(b) |= MAPBIT(b);
+  for(b = 0; b < sb.size; b++)
+    if(!(MAPWORD(b) & MAPBIT(b)))
+      fsmap.gfree[b/BPG]++;
+  fsmap.rotor = 0;
+}
+
+// Find a free block at or after goal, wrapping around.
+// Returns 0 if there is none; block 0 is never free.
+// Caller must hold fsmap.lock.
+static uint
+bmapfind(uint goal)
+{
+  uint b, i, n;
+
+  b = goal < sb.size ? goal : fsmap.rotor;
+  for(i = 0; i < sb.size; i += n, b += n){
+    if(b >= sb.size)
+      b = 0;
+    if(fsmap.gfree[b/BPG] == 0)
+      n = BPG - b%BPG;
+    else if(MAPWORD(b) == ~0)
+      n = 32 - b%32;
+    else if(MAPWORD(b) & MAPBIT(b))
+      n = 1;
+    else
+      return b;
+    // The last group or word may run past the end; count
+    // only real blocks, so the wrap covers every one.
+    if(n > sb.size - b)
+      n = sb.size - b;
+  }
+  return 0;
+}
+
+// Allocate a disk block, preferably goal.
+static uint
+balloc(uint dev, uint goal)
+{
+  int b, bi, m;
+  struct buf *bp;
+
+  acquire(&fsmap.lock);
+  if((b = bmapfind(goal)) == 0)
+    panic("balloc: out of blocks");
+  MAPWORD(b) |= MAPBIT(b);
+  fsmap.gfree[b/BPG]--;
+  fsmap.rotor = b + 1;
+  release(&fsmap.lock);
+
+  bp = bread(dev, BBLOCK(b, sb));
+  bi = b % BPB;
+  m = 1 << (bi % 8);
+  if(bp->data[bi/8] & m)
+    panic("balloc: bitmap");
+  bp->data[bi/8] |= m;  // Mark block in use.
+  log_write(bp);
+  brelse(bp);
+  return b;
 }
 
 // Free a disk block.
@@ -90,6 +191,48 @@ bfree(int dev, uint b)
   bp->data[bi/8] &= ~m;
   log_write(bp);
   brelse(bp);
+
+  acquire(&fsmap.lock);
+  PENDWORD(fsmap.cur, b) |= MAPBIT(b);
+  fsmap.npend[fsmap.cur]++;
+  release(&fsmap.lock);
+}
+
+// The open transaction is being closed: blocks it freed now
+// wait for the closed one to commit.  No operation is active.
+void
+bmapclose(void)
+{
+  acquire(&fsmap.lock);
+  if(fsmap.npend[!fsmap.cur] != 0)
+    panic("bmapclose");
+  fsmap.cur = !fsmap.cur;
+  release(&fsmap.lock);
+}
+
+// The closed transaction has committed: the blocks it freed
+// may be allocated again.
+void
+bmapcommit(void)
+{
+  uint b, w, j;
+  int i;
+
+  acquire(&fsmap.lock);
+  i = !fsmap.cur;
+  for(b = 0; b < sb.size && fsmap.npend[i] > 0; b += 32){
+    if((w = PENDWORD(i, b)) == 0)
+      continue;
+    PENDWORD(i, b) = 0;
+    MAPWORD(b) &= ~w;
+    for(j = 0; j < 32; j++){
+      if(w & (1U << j)){
+        fsmap.gfree[b/BPG]++;  // a word never spans groups
+        fsmap.npend[i]--;
+      }
+    }
+  }
+  release(&fsmap.lock);
 }
 
 // Inodes.
@@ -117,24 +260,28 @@ bfree(int dev, uint b)
 //   is non-zero. ialloc() allocates, iput() frees if
 //   the link count has fallen to zero.
 //
-// * Referencing in cache: an entry in the inode cache
-//   is free if ip->ref is zero. Otherwise ip->ref tracks
-//   the number of in-memory pointers to the entry (open
-//   files and current directories). iget() to find or
-//   create a cache entry and increment its ref, iput()
-//   to decrement ref.
+// * Referencing in cache: ip->ref tracks the number of
+//   in-memory pointers to a cache entry (open files and
+//   current directories). iget() to find or create a cache
+//   entry and increment its ref, iput() to decrement ref.
+//   An entry whose ref is zero keeps its identity and
+//   contents on an LRU list, so a later iget() of the same
+//   inode finds it still valid; iget() recycles the least
+//   recently used such entry when it needs a new one.
 //
 // * Valid: the information (type, size, &c) in an inode
 //   cache entry is only correct when the I_VALID bit
 //   is set in ip->flags. ilock() reads the inode from
 //   the disk and sets I_VALID, while iput() clears
-//   I_VALID if ip->ref has fallen to zero.
+//   I_VALID if it frees the inode on disk.
 //
 // * Locked: file system code may only examine and modify
 //   the information in an inode and its content if it
-//   has first locked the inode. The I_BUSY flag indicates
-//   that the inode is locked. ilock() sets I_BUSY,
-//   while iunlock clears it.
+//   has first locked the inode with ilock(), which takes
+//   its sleep lock, and iunlock() releases it.  Code that
+//   only examines an inode, as read() and path lookup do,
+//   may lock it with ilockshared() instead, so that any
+//   number of such readers can hold it at once.
 //
 // Thus a typical sequence is:
 //   ip = iget(dev, inum)
@@ -154,21 +301,52 @@ bfree(int dev, uint b)
 // have locked the inodes involved; this lets callers create
 // multi-step atomic operations.
 
+#define NIHASH 127
+#define IHASH(dev, inum) (((dev)*31 + (inum)) % NIHASH)
+
 struct {
   struct spinlock lock;
-  struct inode inode[NINODE];
+  int ninode;   // entries allocated so far
+  int max;      // allocate up to this many, then recycle
+  struct inode *hash[NIHASH];
+
+  // Linked list of entries with ref == 0, through prev/next.
+  // lru.next is most recently used.
+  struct inode lru;
 } icache;
 
+static void dcacheinit(void);
+
+// Inode cache entries come from kmalloc() as they are needed,
+// up to one for every inode in the file system, within
+// [NINODE, NINODEMAX]; after that iget recycles old ones.
+static void
+icacheinit(void)
+{
+  initlock(&icache.lock, "icache");
+  icache.lru.prev = &icache.lru;
+  icache.lru.next = &icache.lru;
+
+  icache.max = sb.ninodes;
+  if(icache.max < NINODE)
+    icache.max = NINODE;
+  if(icache.max > NINODEMAX)
+    icache.max = NINODEMAX;
+}
+
 void
 iinit(int dev)
 {
-  initlock(&icache.lock, "icache");
   readsb(dev, &sb);
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d inodestart %d bmap start %d\n", sb.size,
           sb.nblocks, sb.ninodes, sb.nlog, sb.logstart, sb.inodestart, sb.bmapstart);
+  bmapinit(dev);
+  icacheinit();
+  dcacheinit();
 }
 
 static struct inode* iget(uint dev, uint inum);
+static void dcachepurge(uint dev, uint dinum);
 
 //PAGEBREAK!
 // Allocate a new inode with the given type on device dev.
@@ -186,6 +364,8 @@ ialloc(uint dev, short type)
     if(dip->type == 0){  // a free inode
       memset(dip, 0, sizeof(*dip));
       dip->type = type;
+      if(type != T_DEV)
+        dip->flags = DI_INLINE;  // until it outgrows INLINESIZE
       log_write(bp);   // mark it allocated on the disk
       brelse(bp);
       return iget(dev, inum);
@@ -209,9 +389,11 @@ iupdate(struct inode *ip)
   dip->minor = ip->minor;
   dip->nlink = ip->nlink;
   dip->size = ip->size;
+  dip->flags = ip->dflags;
   memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
   log_write(bp);
   brelse(bp);
+  ip->logseq = log_seq();
 }
 
 // Find the inode with number inum on device dev
@@ -220,31 +402,54 @@ iupdate(struct inode *ip)
 static struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
+  struct inode *ip, **pp;
 
   acquire(&icache.lock);
 
   // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-      ip->ref++;
+  for(ip = icache.hash[IHASH(dev, inum)]; ip; ip = ip->hnext){
+    if(ip->dev == dev && ip->inum == inum){
+      if(ip->ref++ == 0){
+        // Take it off the LRU list; its contents are still good.
+        ip->next->prev = ip->prev;
+        ip->prev->next = ip->next;
+      }
       release(&icache.lock);
       return ip;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
   }
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
+  // Grow the cache, or recycle its least recently
+  // used unreferenced entry.
+  if(icache.ninode < icache.max && (ip = kmalloc(sizeof(*ip))) != 0){
+    memset(ip, 0, sizeof(*ip));
+    initsleeplock(&ip->lock, "inode");
+    icache.ninode++;
+    goto found;
+  }
+  ip = icache.lru.prev;
+  if(ip == &icache.lru)
     panic("iget: no inodes");
+  ip->next->prev = ip->prev;
+  ip->prev->next = ip->next;
+  if(ip->inum != 0){
+    for(pp = &icache.hash[IHASH(ip->dev, ip->inum)]; *pp; pp = &(*pp)->hnext){
+      if(*pp == ip){
+        *pp = ip->hnext;
+        break;
+      }
+    }
+  }
 
-  ip = empty;
+found:
   ip->dev = dev;
   ip->inum = inum;
   ip->ref = 1;
   ip->flags = 0;
+  ip->lastb = 0;
+  ip->logseq = ~0;  // unknown: may still be in the log
+  ip->hnext = icache.hash[IHASH(dev, inum)];
+  icache.hash[IHASH(dev, inum)] = ip;
   release(&icache.lock);
 
   return ip;
@@ -272,11 +477,7 @@ ilock(struct inode *ip)
   if(ip == 0 || ip->ref < 1)
     panic("ilock");
 
-  acquire(&icache.lock);
-  while(ip->flags & I_BUSY)
-    sleep(ip, &icache.lock);
-  ip->flags |= I_BUSY;
-  release(&icache.lock);
+  acquiresleep(&ip->lock);
 
   if(!(ip->flags & I_VALID)){
     bp = bread(ip->dev, IBLOCK(ip->inum, sb));
@@ -286,6 +487,7 @@ ilock(struct inode *ip)
     ip->minor = dip->minor;
     ip->nlink = dip->nlink;
     ip->size = dip->size;
+    ip->dflags = dip->flags;
     memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
     brelse(bp);
     ip->flags |= I_VALID;
@@ -294,17 +496,34 @@ ilock(struct inode *ip)
   }
 }
 
-// Unlock the given inode.
+// Lock the given inode shared with other readers, which
+// may examine but not modify it.
+// Reads the inode from disk if necessary.
+void
+ilockshared(struct inode *ip)
+{
+  if(ip == 0 || ip->ref < 1)
+    panic("ilockshared");
+
+  acquiresleepshared(&ip->lock);
+  if(!(ip->flags & I_VALID)){
+    // Reading it in changes it: do that exclusively.
+    // It stays valid while we hold a reference.
+    releasesleep(&ip->lock);
+    ilock(ip);
+    releasesleep(&ip->lock);
+    acquiresleepshared(&ip->lock);
+  }
+}
+
+// Unlock the given inode, locked exclusively or shared.
 void
 iunlock(struct inode *ip)
 {
-  if(ip == 0 || !(ip->flags & I_BUSY) || ip->ref < 1)
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
     panic("iunlock");
 
-  acquire(&icache.lock);
-  ip->flags &= ~I_BUSY;
-  wakeup(ip);
-  release(&icache.lock);
+  releasesleep(&ip->lock);
 }
 
 // Drop a reference to an in-memory inode.
@@ -320,18 +539,26 @@ iput(struct inode *ip)
   acquire(&icache.lock);
   if(ip->ref == 1 && (ip->flags & I_VALID) && ip->nlink == 0){
     // inode has no links and no other references: truncate and free.
-    if(ip->flags & I_BUSY)
+    if(holdingsleep(&ip->lock))
       panic("iput busy");
-    ip->flags |= I_BUSY;
     release(&icache.lock);
+    acquiresleep(&ip->lock);
     itrunc(ip);
+    if(ip->type == T_DIR)
+      dcachepurge(ip->dev, ip->inum);
     ip->type = 0;
     iupdate(ip);
-    acquire(&icache.lock);
     ip->flags = 0;
-    wakeup(ip);
+    releasesleep(&ip->lock);
+    acquire(&icache.lock);
+  }
+  if(--ip->ref == 0){
+    // Keep it cached, most recently used first.
+    ip->next = icache.lru.next;
+    ip->prev = &icache.lru;
+    icache.lru.next->prev = ip;
+    icache.lru.next = ip;
   }
-  ip->ref--;
   release(&icache.lock);
 }
 
@@ -349,38 +576,143 @@ iunlockput(struct inode *ip)
 // The content (data) associated with each inode is stored
 // in blocks on the disk. The first NDIRECT block numbers
 // are listed in ip->addrs[].  The next NINDIRECT blocks are 
-// listed in block ip->addrs[NDIRECT].
+// listed in block ip->addrs[NDIRECT], the next NINDIRECT^2
+// in the blocks listed in the double indirect block
+// ip->addrs[NDIRECT+1], and the next NINDIRECT^3 below the
+// triple indirect block ip->addrs[NDIRECT+2].
+//
+// A block number of 0 is a hole: it reads as zeros, and
+// gets a block only when written, so a file written at
+// scattered offsets (see lseek) uses no blocks in between.
+//
+// Files and directories start out with DI_INLINE set: their
+// first INLINESIZE bytes are kept in ip->addrs[] itself, so a
+// small file needs no data block.  writei() moves the data
+// out to a block when the file grows past INLINESIZE.
+
+// Allocate a zeroed block for ip, next to the last one it got.
+// A regular file's data block is zeroed in the cache and
+// written back later; anything else is zeroed through the log.
+static uint
+ballocnear(struct inode *ip, int data)
+{
+  struct buf *bp;
+
+  ip->lastb = balloc(ip->dev, ip->lastb ? ip->lastb + 1 : 0);
+  ip->logseq = log_seq();
+  if(data && ip->type == T_FILE){
+    bp = bread(ip->dev, ip->lastb);
+    memset(bp->data, 0, BSIZE);
+    bdwrite(bp, ip->inum);
+    brelse(bp);
+  } else
+    bzero(ip->dev, ip->lastb);
+  return ip->lastb;
+}
 
 // Return the disk block address of the nth block in inode ip.
-// If there is no such block, bmap allocates one.
+// If there is no such block, bmap allocates one if alloc
+// is set, and otherwise returns 0 (a hole).
 static uint
-bmap(struct inode *ip, uint bn)
+bmap(struct inode *ip, uint bn, int alloc)
 {
-  uint addr, *a;
+  uint addr, *a, level, n;
   struct buf *bp;
 
+  if(ip->dflags & DI_INLINE)
+    panic("bmap: inline");
+
   if(bn < NDIRECT){
-    if((addr = ip->addrs[bn]) == 0)
-      ip->addrs[bn] = addr = balloc(ip->dev);
+    if((addr = ip->addrs[bn]) == 0 && alloc){
+      ip->addrs[bn] = addr = ballocnear(ip, 1);
+      iupdate(ip);
+    }
     return addr;
   }
   bn -= NDIRECT;
 
-  if(bn < NINDIRECT){
-    // Load indirect block, allocating if necessary.
-    if((addr = ip->addrs[NDIRECT]) == 0)
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+  // Find the level of indirection; each entry of the top
+  // block covers n blocks.
+  for(level = 0, n = 1; bn >= n*NINDIRECT; level++, n *= NINDIRECT){
+    bn -= n*NINDIRECT;
+    if(level == NLEVEL-1)
+      panic("bmap: out of range");
+  }
+
+  if((addr = ip->addrs[NDIRECT+level]) == 0){
+    if(!alloc)
+      return 0;
+    ip->addrs[NDIRECT+level] = addr = ballocnear(ip, 0);
+    iupdate(ip);
+  }
+
+  // Walk down the indirect blocks, allocating if necessary.
+  for(;; n /= NINDIRECT){
     bp = bread(ip->dev, addr);
     a = (uint*)bp->data;
-    if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
+    if((addr = a[bn/n]) == 0 && alloc){
+      a[bn/n] = addr = ballocnear(ip, n == 1);
       log_write(bp);
     }
     brelse(bp);
-    return addr;
+    if(n == 1 || addr == 0)
+      return addr;
+    bn %= n;
   }
+}
+
+// Record a change to data block bp of ip.  File data is
+// written back later; directory contents go through the log.
+static void
+dwrite(struct inode *ip, struct buf *bp)
+{
+  if(ip->type == T_FILE)
+    bdwrite(bp, ip->inum);
+  else
+    log_write(bp);
+}
+
+// Move ip's inline data out to its first data block,
+// so that it can grow past INLINESIZE.
+static void
+iuninline(struct inode *ip)
+{
+  char data[INLINESIZE];
+  struct buf *bp;
+
+  memmove(data, ip->addrs, INLINESIZE);
+  memset(ip->addrs, 0, sizeof(ip->addrs));
+  ip->dflags &= ~DI_INLINE;
+  if(ip->size > 0){
+    bp = bread(ip->dev, bmap(ip, 0, 1));
+    memmove(bp->data, data, ip->size);
+    dwrite(ip, bp);
+    brelse(bp);
+  }
+  iupdate(ip);
+}
+
+// Free indirect block addr at the given level of
+// indirection (0 for single) and every block below it.
+static void
+itruncind(struct inode *ip, uint addr, int level)
+{
+  struct buf *bp;
+  uint *a;
+  int j;
 
-  panic("bmap: out of range");
+  bp = bread(ip->dev, addr);
+  a = (uint*)bp->data;
+  for(j = 0; j < NINDIRECT; j++){
+    if(a[j] == 0)
+      continue;
+    if(level > 0)
+      itruncind(ip, a[j], level-1);
+    else
+      bfree(ip->dev, a[j]);
+  }
+  brelse(bp);
+  bfree(ip->dev, addr);
 }
 
 // Truncate inode (discard contents).
@@ -391,9 +723,14 @@ bmap(struct inode *ip, uint bn)
 static void
 itrunc(struct inode *ip)
 {
-  int i, j;
-  struct buf *bp;
-  uint *a;
+  int i;
+
+  if(ip->dflags & DI_INLINE){
+    memset(ip->addrs, 0, sizeof(ip->addrs));
+    ip->size = 0;
+    iupdate(ip);
+    return;
+  }
 
   for(i = 0; i < NDIRECT; i++){
     if(ip->addrs[i]){
@@ -402,16 +739,11 @@ itrunc(struct inode *ip)
     }
   }
   
-  if(ip->addrs[NDIRECT]){
-    bp = bread(ip->dev, ip->addrs[NDIRECT]);
-    a = (uint*)bp->data;
-    for(j = 0; j < NINDIRECT; j++){
-      if(a[j])
-        bfree(ip->dev, a[j]);
+  for(i = 0; i < NLEVEL; i++){
+    if(ip->addrs[NDIRECT+i]){
+      itruncind(ip, ip->addrs[NDIRECT+i], i);
+      ip->addrs[NDIRECT+i] = 0;
     }
-    brelse(bp);
-    bfree(ip->dev, ip->addrs[NDIRECT]);
-    ip->addrs[NDIRECT] = 0;
   }
 
   ip->size = 0;
@@ -434,7 +766,7 @@ stati(struct inode *ip, struct stat *st)
 int
 readi(struct inode *ip, char *dst, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, addr;
   struct buf *bp;
 
   if(ip->type == T_DEV){
@@ -443,14 +775,25 @@ readi(struct inode *ip, char *dst, uint off, uint n)
     return devsw[ip->major].read(ip, dst, n);
   }
 
-  if(off > ip->size || off + n < off)
+  if(off + n < off)
     return -1;
+  if(off >= ip->size)
+    return 0;
   if(off + n > ip->size)
     n = ip->size - off;
 
+  if(ip->dflags & DI_INLINE){
+    memmove(dst, (char*)ip->addrs + off, n);
+    return n;
+  }
+
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
+    if((addr = bmap(ip, off/BSIZE, 0)) == 0){
+      memset(dst, 0, m);  // hole
+      continue;
+    }
+    bp = bread(ip->dev, addr);
     memmove(dst, bp->data + off%BSIZE, m);
     brelse(bp);
   }
@@ -471,16 +814,28 @@ writei(struct inode *ip, char *src, uint off, uint n)
     return devsw[ip->major].write(ip, src, n);
   }
 
-  if(off > ip->size || off + n < off)
+  // Writing past the end leaves a hole.
+  if(off + n < off)
     return -1;
   if(off + n > MAXFILE*BSIZE)
     return -1;
 
+  if(ip->dflags & DI_INLINE){
+    if(off + n <= INLINESIZE){
+      memmove((char*)ip->addrs + off, src, n);
+      if(off + n > ip->size)
+        ip->size = off + n;
+      iupdate(ip);
+      return n;
+    }
+    iuninline(ip);
+  }
+
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    bp = bread(ip->dev, bmap(ip, off/BSIZE, 1));
     m = min(n - tot, BSIZE - off%BSIZE);
     memmove(bp->data + off%BSIZE, src, m);
-    log_write(bp);
+    dwrite(ip, bp);
     brelse(bp);
   }
 
@@ -491,6 +846,68 @@ writei(struct inode *ip, char *src, uint off, uint n)
   return n;
 }
 
+// Move data between inode ip and pipe p without going
+// through user space: each block is copied straight between
+// the buffer cache and the pipe buffer.  If toip, copy up
+// to n bytes from p into ip at off; otherwise copy up to n
+// bytes of ip from off into p.  Never sleeps on the pipe,
+// so it may move less than asked if p fills or empties.
+// Caller must hold ip's lock, and be in a transaction if toip.
+int
+splicei(struct inode *ip, struct pipe *p, uint off, uint n, int toip)
+{
+  static char zeroes[BSIZE];
+  uint tot, m, r, addr;
+  struct buf *bp;
+
+  if(ip->type == T_DEV)
+    return -1;
+  if((!toip && off > ip->size) || off + n < off)
+    return -1;
+  if(toip){
+    if(off + n > MAXFILE*BSIZE)
+      n = MAXFILE*BSIZE - off;
+  } else if(off + n > ip->size)
+    n = ip->size - off;
+
+  if(ip->dflags & DI_INLINE){
+    if(!toip)
+      return pipeput(p, (char*)ip->addrs + off, n);
+    iuninline(ip);
+  }
+
+  for(tot=0; tot<n; tot+=r, off+=r){
+    m = min(n - tot, BSIZE - off%BSIZE);
+    if(!toip && (addr = bmap(ip, off/BSIZE, 0)) == 0){
+      // hole
+      if((r = pipeput(p, zeroes, m)) < m){
+        tot += r;
+        off += r;
+        break;
+      }
+      continue;
+    }
+    bp = bread(ip->dev, toip ? bmap(ip, off/BSIZE, 1) : addr);
+    if(toip){
+      if((r = pipeget(p, (char*)bp->data + off%BSIZE, m)) > 0)
+        dwrite(ip, bp);
+    } else
+      r = pipeput(p, (char*)bp->data + off%BSIZE, m);
+    brelse(bp);
+    if(r < m){
+      tot += r;
+      off += r;
+      break;
+    }
+  }
+
+  if(toip && tot > 0 && off > ip->size){
+    ip->size = off;
+    iupdate(ip);
+  }
+  return tot;
+}
+
 //PAGEBREAK!
 // Directories
 
@@ -500,16 +917,241 @@ namecmp(const char *s, const char *t)
   return strncmp(s, t, DIRSIZ);
 }
 
-// Look for a directory entry in a directory.
-// If found, set *poff to byte offset of entry.
-struct inode*
-dirlookup(struct inode *dp, char *name, uint *poff)
+// Directory name lookup cache.
+//
+// Remembers what dirlookup() found for (directory, name):
+// the entry's inode number and offset, or that there is no
+// such entry (inum 0).  Entries are only made or changed
+// while the directory is locked, by dirlookup(), dirlink()
+// and dcacheforget() (for unlink), so a cached answer is
+// current for any caller that holds the directory's lock.
+// When a directory is freed, iput() drops its entries so a
+// reused inode number cannot inherit them.
+//
+// namex() first tries to walk a path through the cache alone,
+// without dcache.lock or any inode lock.  dcache.seq is odd
+// while an entry's name or answer is being changed and is
+// bumped again after, so the walk knows its answers were all
+// current at once if seq was even and unchanged throughout.
+// Since only directories have entries, finding one for an
+// inode number also says that it is a directory.
+
+#define NDHASH 61
+
+struct dentry {
+  uint dev;
+  uint dinum;            // inode number of the directory
+  char name[DIRSIZ];
+  uint inum;             // 0 if name is not in the directory
+  uint off;              // byte offset of the entry
+  struct dentry *hnext;  // hash chain
+  struct dentry *prev;   // LRU list
+  struct dentry *next;
+};
+
+struct {
+  struct spinlock lock;
+  uint seq;              // odd while hash chains or answers change
+  struct dentry entry[NDCACHE];
+  struct dentry *hash[NDHASH];
+
+  // Linked list of all entries, through prev/next.
+  // lru.next is most recently used.
+  struct dentry lru;
+} dcache;
+
+static void
+dcacheinit(void)
 {
-  uint off, inum;
-  struct dirent de;
+  struct dentry *d;
+
+  initlock(&dcache.lock, "dcache");
+  dcache.lru.prev = &dcache.lru;
+  dcache.lru.next = &dcache.lru;
+  for(d = dcache.entry; d < dcache.entry+NDCACHE; d++){
+    d->dev = -1;
+    d->next = dcache.lru.next;
+    d->prev = &dcache.lru;
+    dcache.lru.next->prev = d;
+    dcache.lru.next = d;
+  }
+}
 
-  if(dp->type != T_DIR)
-    panic("dirlookup not DIR");
+static uint
+dhash(uint dev, uint dinum, char *name)
+{
+  uint h;
+  int i;
+
+  h = dev*31 + dinum;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = h*31 + (uchar)name[i];
+  return h % NDHASH;
+}
+
+// Find the entry for name in directory (dev, dinum).
+// Caller must hold dcache.lock.
+static struct dentry*
+dfind(uint dev, uint dinum, char *name)
+{
+  struct dentry *d;
+
+  for(d = dcache.hash[dhash(dev, dinum, name)]; d; d = d->hnext)
+    if(d->dev == dev && d->dinum == dinum && namecmp(d->name, name) == 0)
+      return d;
+  return 0;
+}
+
+// Take d off its hash chain.  Caller must hold dcache.lock.
+static void
+dunhash(struct dentry *d)
+{
+  struct dentry **pp;
+
+  if(d->dev == -1)
+    return;
+  for(pp = &dcache.hash[dhash(d->dev, d->dinum, d->name)]; *pp; pp = &(*pp)->hnext){
+    if(*pp == d){
+      *pp = d->hnext;
+      break;
+    }
+  }
+  d->dev = -1;
+}
+
+// Move d to the head of the MRU list.  Caller must hold dcache.lock.
+static void
+dtouch(struct dentry *d)
+{
+  d->next->prev = d->prev;
+  d->prev->next = d->next;
+  d->next = dcache.lru.next;
+  d->prev = &dcache.lru;
+  dcache.lru.next->prev = d;
+  dcache.lru.next = d;
+}
+
+// Look up name in the cache for locked directory dp.
+// Returns 1 and fills in *inum and *off on a hit.
+static int
+dcacheget(struct inode *dp, char *name, uint *inum, uint *off)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  if((d = dfind(dp->dev, dp->inum, name)) == 0){
+    release(&dcache.lock);
+    return 0;
+  }
+  dtouch(d);
+  *inum = d->inum;
+  *off = d->off;
+  release(&dcache.lock);
+  return 1;
+}
+
+// Record that name in locked directory dp is inum at off
+// (or absent, if inum is 0), recycling the LRU entry.
+static void
+dcacheput(struct inode *dp, char *name, uint inum, uint off)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  dcache.seq++;
+  __sync_synchronize();
+  if((d = dfind(dp->dev, dp->inum, name)) == 0){
+    d = dcache.lru.prev;
+    dunhash(d);
+    d->dev = dp->dev;
+    d->dinum = dp->inum;
+    strncpy(d->name, name, DIRSIZ);
+    d->hnext = dcache.hash[dhash(d->dev, d->dinum, d->name)];
+    dcache.hash[dhash(d->dev, d->dinum, d->name)] = d;
+  }
+  d->inum = inum;
+  d->off = off;
+  __sync_synchronize();
+  dcache.seq++;
+  dtouch(d);
+  release(&dcache.lock);
+}
+
+// Record that name has been removed from locked directory dp.
+void
+dcacheforget(struct inode *dp, char *name)
+{
+  dcacheput(dp, name, 0, 0);
+}
+
+// Drop every entry for directory (dev, dinum), which is being freed.
+static void
+dcachepurge(uint dev, uint dinum)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  dcache.seq++;
+  __sync_synchronize();
+  for(d = dcache.entry; d < dcache.entry+NDCACHE; d++)
+    if(d->dev == dev && d->dinum == dinum)
+      dunhash(d);
+  __sync_synchronize();
+  dcache.seq++;
+  release(&dcache.lock);
+}
+
+// Begin a lockless read of the cache: wait out any change
+// in progress and return the sequence number to check
+// against with dseqchanged().
+static uint
+dseqbegin(void)
+{
+  uint seq;
+
+  for(;;){
+    seq = *(volatile uint*)&dcache.seq;
+    if((seq & 1) == 0)
+      break;
+    pause();
+  }
+  __sync_synchronize();
+  return seq;
+}
+
+// Has the cache changed since dseqbegin() returned seq?
+static int
+dseqchanged(uint seq)
+{
+  __sync_synchronize();
+  return *(volatile uint*)&dcache.seq != seq;
+}
+
+// Look up name in directory (dev, dinum) without dcache.lock,
+// returning its inode number or 0, or -1 on a miss.
+// The answer may be garbage unless dseqchanged() says no.
+static int
+dpeek(uint dev, uint dinum, char *name)
+{
+  struct dentry *d;
+  int n;
+
+  // A chain being changed may lead anywhere in dcache.entry,
+  // but never out of it; don't follow it forever.
+  n = 0;
+  for(d = dcache.hash[dhash(dev, dinum, name)]; d && n < NDCACHE; d = d->hnext, n++)
+    if(d->dev == dev && d->dinum == dinum && namecmp(d->name, name) == 0)
+      return d->inum;
+  return -1;
+}
+
+// Find name in a linear directory: scan every entry.
+// Returns its inode number and sets *poff, or returns 0.
+static uint
+lineardirfind(struct inode *dp, char *name, uint *poff)
+{
+  uint off;
+  struct dirent de;
 
   for(off = 0; off < dp->size; off += sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
@@ -518,21 +1160,320 @@ dirlookup(struct inode *dp, char *name, uint *poff)
       continue;
     if(namecmp(name, de.name) == 0){
       // entry matches path element
-      if(poff)
-        *poff = off;
-      inum = de.inum;
-      return iget(dp->dev, inum);
+      *poff = off;
+      return de.inum;
     }
   }
+  return 0;
+}
 
+// Read block bn of directory dp, which must exist.
+static struct buf*
+dirbread(struct inode *dp, uint bn)
+{
+  uint addr;
+
+  if((addr = bmap(dp, bn, 0)) == 0)
+    panic("hashed dir hole");
+  return bread(dp->dev, addr);
+}
+
+// Append an empty block to hashed directory dp.
+// Returns its block number.
+static uint
+dirgrow(struct inode *dp)
+{
+  static char zeroes[BSIZE];
+  uint bn;
+
+  bn = dp->size / BSIZE;
+  if(bn > 0xffff)
+    panic("hashed dir too big");
+  if(writei(dp, zeroes, bn*BSIZE, BSIZE) != BSIZE)
+    panic("hashed dir grow");
+  return bn;
+}
+
+// Word k of hashed directory dp's header.
+static uint
+hdrget(struct inode *dp, uint k)
+{
+  struct buf *bp;
+  uint w;
+
+  bp = dirbread(dp, 0);
+  w = HDRWORD((struct dirhdr*)bp->data, k);
+  brelse(bp);
+  return w;
+}
+
+static void
+hdrset(struct inode *dp, uint k, uint w)
+{
+  struct buf *bp;
+
+  bp = dirbread(dp, 0);
+  HDRWORD((struct dirhdr*)bp->data, k) = w;
+  log_write(bp);
+  brelse(bp);
+}
+
+// The bucket that the last of n buckets is split off from.
+static uint
+splitsrc(uint n)
+{
+  uint l;
+
+  for(l = 1; l*2 <= n-1; l *= 2)
+    ;
+  return n-1 - l;
+}
+
+// First block of the chain for name in hashed directory dp.
+// If name's bucket is still being split off, set *old to the
+// first block of the chain it is split off from, else to 0.
+static uint
+hashdirstart(struct inode *dp, char *name, uint *old)
+{
+  uint n, b;
+
+  n = hdrget(dp, HDRNBUCKET);
+  if(n == 0 || n > MAXDIRBUCKET)
+    panic("hashed dir nbuckets");
+  b = dirbucket(dirhash(name), n);
+  *old = 0;
+  if(b == n-1 && hdrget(dp, HDRSPLIT) != 0)
+    *old = hdrget(dp, HDRBUCKET(splitsrc(n)));
+  return hdrget(dp, HDRBUCKET(b));
+}
+
+// Find name in the chain of blocks of dp starting at bn.
+static uint
+hashchainfind(struct inode *dp, uint bn, char *name, uint *poff)
+{
+  struct buf *bp;
+  struct dirent *de;
+  uint i, inum;
+
+  while(bn != 0){
+    bp = dirbread(dp, bn);
+    de = (struct dirent*)bp->data;
+    for(i = 0; i < DPB-1; i++){
+      if(de[i].inum != 0 && namecmp(name, de[i].name) == 0){
+        *poff = bn*BSIZE + i*sizeof(de[0]);
+        inum = de[i].inum;
+        brelse(bp);
+        return inum;
+      }
+    }
+    bn = ((struct dirchain*)&de[DPB-1])->next;
+    brelse(bp);
+  }
   return 0;
 }
 
+// Find name in a hashed directory: scan only its chain,
+// and the one it is being split off from.
+static uint
+hashdirfind(struct inode *dp, char *name, uint *poff)
+{
+  uint bn, old, inum;
+
+  bn = hashdirstart(dp, name, &old);
+  if((inum = hashchainfind(dp, bn, name, poff)) == 0 && old != 0)
+    inum = hashchainfind(dp, old, name, poff);
+  return inum;
+}
+
+// Look for a directory entry in a directory.
+// If found, set *poff to byte offset of entry.
+// Caller must hold dp's lock.
+struct inode*
+dirlookup(struct inode *dp, char *name, uint *poff)
+{
+  uint off, inum;
+
+  if(dp->type != T_DIR)
+    panic("dirlookup not DIR");
+
+  if(!dcacheget(dp, name, &inum, &off)){
+    if(dp->dflags & DI_HASHED)
+      inum = hashdirfind(dp, name, &off);
+    else
+      inum = lineardirfind(dp, name, &off);
+    dcacheput(dp, name, inum, off);
+  }
+  if(inum == 0)
+    return 0;
+  if(poff)
+    *poff = off;
+  return iget(dp->dev, inum);
+}
+
+// Take a step of the split in progress in hashed directory
+// dp, starting a split that adds a bucket if there is none
+// and the table is not full.  A step moves the entries that
+// belong in the new bucket out of at most SPLITCHAIN blocks
+// of the old bucket's chain, to the end of the new one.
+static void
+hashdirsplit(struct inode *dp)
+{
+  struct buf *bp, *np;
+  struct dirent *de, *nde;
+  uint n, bn, nb, next, i, j, k;
+  int dirty;
+
+  n = hdrget(dp, HDRNBUCKET);
+  if((bn = hdrget(dp, HDRSPLIT)) == 0){
+    if(n >= MAXDIRBUCKET)
+      return;
+    hdrset(dp, HDRBUCKET(n), dirgrow(dp));
+    hdrset(dp, HDRNBUCKET, ++n);
+    bn = hdrget(dp, HDRBUCKET(splitsrc(n)));
+  }
+
+  // Find the last block of the new bucket's chain.
+  nb = hdrget(dp, HDRBUCKET(n-1));
+  for(;;){
+    np = dirbread(dp, nb);
+    nde = (struct dirent*)np->data;
+    if((next = ((struct dirchain*)&nde[DPB-1])->next) == 0)
+      break;
+    brelse(np);
+    nb = next;
+  }
+
+  j = 0;
+  for(k = 0; k < SPLITCHAIN && bn != 0; k++){
+    bp = dirbread(dp, bn);
+    de = (struct dirent*)bp->data;
+    dirty = 0;
+    for(i = 0; i < DPB-1; i++){
+      if(de[i].inum == 0 || dirbucket(dirhash(de[i].name), n) != n-1)
+        continue;
+      while(j < DPB-1 && nde[j].inum != 0)
+        j++;
+      if(j == DPB-1){
+        nb = dirgrow(dp);
+        ((struct dirchain*)&nde[DPB-1])->next = nb;
+        log_write(np);
+        brelse(np);
+        np = dirbread(dp, nb);
+        nde = (struct dirent*)np->data;
+        j = 0;
+      }
+      nde[j++] = de[i];
+      memset(&de[i], 0, sizeof(de[i]));
+      dirty = 1;
+    }
+    bn = ((struct dirchain*)&de[DPB-1])->next;
+    if(dirty)
+      log_write(bp);
+    brelse(bp);
+  }
+  log_write(np);
+  brelse(np);
+  hdrset(dp, HDRSPLIT, bn);
+  dcachepurge(dp->dev, dp->inum);  // offsets have changed
+}
+
+// Find a free slot for name in hashed directory dp.  If
+// cansplit, first take a step of any split in progress; or
+// if name's chain is full, start a split and try again.
+// Failing that, append an overflow block to the chain.
+static uint
+hashdirslot(struct inode *dp, char *name, int cansplit)
+{
+  struct buf *bp;
+  struct dirent *de;
+  struct dirchain *dc;
+  uint bn, old, nb, i;
+
+  if(cansplit && hdrget(dp, HDRSPLIT) != 0){
+    hashdirsplit(dp);
+    cansplit = 0;
+  }
+
+ again:
+  bn = hashdirstart(dp, name, &old);
+  for(;;){
+    bp = dirbread(dp, bn);
+    de = (struct dirent*)bp->data;
+    for(i = 0; i < DPB-1; i++){
+      if(de[i].inum == 0){
+        brelse(bp);
+        return bn*BSIZE + i*sizeof(de[0]);
+      }
+    }
+    dc = (struct dirchain*)&de[DPB-1];
+    if(dc->next == 0)
+      break;
+    bn = dc->next;
+    brelse(bp);
+  }
+  if(cansplit){
+    brelse(bp);
+    hashdirsplit(dp);
+    cansplit = 0;
+    goto again;
+  }
+
+  nb = dirgrow(dp);
+  dc->next = nb;
+  log_write(bp);
+  brelse(bp);
+  return nb*BSIZE;
+}
+
+// Turn linear directory dp into a hash table, with buckets
+// for about twice the entries it has.
+static void
+hashdirconvert(struct inode *dp)
+{
+  struct dirent *old;
+  uint size, n, nb, i, off;
+
+  size = dp->size;
+  if(size > PGSIZE || (old = (struct dirent*)kalloc()) == 0)
+    panic("hashdirconvert");
+  if(readi(dp, (char*)old, 0, size) != size)
+    panic("hashdirconvert read");
+  n = 0;
+  for(i = 0; i < size/sizeof(old[0]); i++)
+    if(old[i].inum != 0)
+      n++;
+  nb = (2*(n+1) + DPB-2) / (DPB-1);
+  if(nb < size/BSIZE)
+    nb = size/BSIZE;  // reuse every old block
+
+  // The header and empty buckets overwrite the old blocks.
+  for(i = 0; i <= nb; i++){
+    dp->size = i*BSIZE;
+    dirgrow(dp);
+  }
+  dp->dflags |= DI_HASHED;
+  iupdate(dp);
+  hdrset(dp, HDRNBUCKET, nb);
+  for(i = 0; i < nb; i++)
+    hdrset(dp, HDRBUCKET(i), 1 + i);
+
+  for(i = 0; i < size/sizeof(old[0]); i++){
+    if(old[i].inum == 0)
+      continue;
+    off = hashdirslot(dp, old[i].name, 0);
+    if(writei(dp, (char*)&old[i], off, sizeof(old[i])) != sizeof(old[i]))
+      panic("hashdirconvert");
+  }
+  kfree((char*)old);
+  dcachepurge(dp->dev, dp->inum);
+}
+
 // Write a new directory entry (name, inum) into the directory dp.
+// Callers reserve DIRGROWBLOCKS extra log blocks for it.
 int
 dirlink(struct inode *dp, char *name, uint inum)
 {
-  int off;
+  int off, cansplit;
   struct dirent de;
   struct inode *ip;
 
@@ -542,18 +1483,28 @@ dirlink(struct inode *dp, char *name, uint inum)
     return -1;
   }
 
-  // Look for an empty dirent.
-  for(off = 0; off < dp->size; off += sizeof(de)){
-    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-      panic("dirlink read");
-    if(de.inum == 0)
-      break;
+  cansplit = 1;
+  if(!(dp->dflags & DI_HASHED)){
+    // Look for an empty dirent.
+    for(off = 0; off < dp->size; off += sizeof(de)){
+      if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+        panic("dirlink read");
+      if(de.inum == 0)
+        break;
+    }
+    if(off >= HASHDIRMIN*BSIZE){
+      hashdirconvert(dp);
+      cansplit = 0;  // that was this operation's growth
+    }
   }
+  if(dp->dflags & DI_HASHED)
+    off = hashdirslot(dp, name, cansplit);
 
   strncpy(de.name, name, DIRSIZ);
   de.inum = inum;
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
     panic("dirlink");
+  dcacheput(dp, name, inum, off);
   
   return 0;
 }
@@ -598,22 +1549,83 @@ skipelem(char *path, char *name)
   return path;
 }
 
+// The lockless half of namex: resolve path from cached
+// directory entries only.  Returns 1 and sets *ipp (to 0 if
+// the path does not exist), or returns 0 if some component
+// is not cached or the cache changed under the walk.
+static int
+namefast(char *path, int nameiparent, char *name, struct inode **ipp)
+{
+  struct inode *ip;
+  uint dev, inum, seq;
+  int r, isdir;
+
+  if(*path == '/'){
+    dev = ROOTDEV;
+    inum = ROOTINO;
+  } else {
+    dev = proc->cwd->dev;
+    inum = proc->cwd->inum;
+  }
+  isdir = 1;
+  seq = dseqbegin();
+  while((path = skipelem(path, name)) != 0){
+    if(nameiparent && *path == '\0')
+      break;
+    if((r = dpeek(dev, inum, name)) < 0)
+      return 0;
+    inum = r;
+    isdir = 0;  // until we find an entry in it
+    if(inum == 0)
+      break;
+  }
+  if(dseqchanged(seq))
+    return 0;
+  if(inum == 0 || (nameiparent && path == 0)){
+    *ipp = 0;
+    return 1;
+  }
+
+  // Take the reference before checking seq again, so an
+  // unlink that races with us either shows in seq or finds
+  // the inode referenced and leaves it alone.
+  ip = iget(dev, inum);
+  if(dseqchanged(seq)){
+    iput(ip);
+    return 0;
+  }
+  if(nameiparent && !isdir && (!(ip->flags & I_VALID) || ip->type != T_DIR)){
+    // The parent has no entries to show that it is a
+    // directory, nor a valid type, which can't change
+    // while we hold a reference: let the locked walk see.
+    iput(ip);
+    return 0;
+  }
+  *ipp = ip;
+  return 1;
+}
+
 // Look up and return the inode for a path name.
 // If parent != 0, return the inode for the parent and copy the final
 // path element into name, which must have room for DIRSIZ bytes.
+// Paths whose every component is in the directory name cache
+// are resolved by namefast() without locking any inode.
 // Must be called inside a transaction since it calls iput().
 static struct inode*
 namex(char *path, int nameiparent, char *name)
 {
   struct inode *ip, *next;
 
+  if(namefast(path, nameiparent, name, &ip))
+    return ip;
+
   if(*path == '/')
     ip = iget(ROOTDEV, ROOTINO);
   else
     ip = idup(proc->cwd);
 
   while((path = skipelem(path, name)) != 0){
-    ilock(ip);
+    ilockshared(ip);
     if(ip->type != T_DIR){
       iunlockput(ip);
       return 0;
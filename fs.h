@@ -20,9 +20,23 @@ struct superblock {
   uint bmapstart;    // Block number of first free map block
 };
 
-#define NDIRECT 12
+#define NDIRECT 9
 #define NINDIRECT (BSIZE / sizeof(uint))
-#define MAXFILE (NDIRECT + NINDIRECT)
+#define NLEVEL 3        // single, double and triple indirect blocks
+#define MAXFILE (NDIRECT + NINDIRECT + NINDIRECT*NINDIRECT + \
+                 NINDIRECT*NINDIRECT*NINDIRECT)
+
+// Log blocks to reserve for writing n bytes to a file: the
+// data, 2 blocks of slop for non-aligned writes, the i-node,
+// 2 indirect blocks at each level, and 2 allocation bitmap
+// blocks.
+#define WRITEBLOCKS(n) ((n)/BSIZE + 2 + 1 + 2*NLEVEL + 2)
+
+// Fewest data blocks the log may have (nlog - 1): room for
+// any one operation, including one that grows a directory,
+// and for a write of at least a block in half the log.
+#define MINLOGSIZE (MAXOPBLOCKS+DIRGROWBLOCKS > 2*(WRITEBLOCKS(0)+1) ? \
+                    MAXOPBLOCKS+DIRGROWBLOCKS : 2*(WRITEBLOCKS(0)+1))
 
 // On-disk inode structure
 struct dinode {
@@ -31,9 +45,16 @@ struct dinode {
   short minor;          // Minor device number (T_DEV only)
   short nlink;          // Number of links to inode in file system
   uint size;            // Size of file (bytes)
-  uint addrs[NDIRECT+1];   // Data block addresses
+  uint flags;           // DI_ flags
+  uint addrs[NDIRECT+NLEVEL];   // Data block addresses
 };
 
+#define DI_HASHED 0x1   // directory is a hash table (see below)
+#define DI_INLINE 0x2   // data is kept in addrs[] itself
+
+// Bytes of data an inode can hold inline.
+#define INLINESIZE ((NDIRECT+NLEVEL)*sizeof(uint))
+
 // Inodes per block.
 #define IPB           (BSIZE / sizeof(struct dinode))
 
@@ -54,3 +75,87 @@ struct dirent {
   char name[DIRSIZ];
 };
 
+// Directory entries per block.
+#define DPB           (BSIZE / sizeof(struct dirent))
+
+// A directory that outgrows HASHDIRMIN blocks becomes a hash
+// table and gets DI_HASHED.  Block 0 is a header of ushort
+// words: the number of buckets n, the split in progress, and
+// the first block of each bucket's chain.  The entry for name
+// is in bucket dirbucket(dirhash(name), n).  Blocks are added
+// to the end of the directory as chains grow.  When a chain
+// fills up, the table grows by one bucket instead if it can
+// (linear hashing): the next bucket in turn is split between
+// itself and the new one.
+//
+// A split moves entries out of at most SPLITCHAIN blocks of
+// the old bucket's chain per operation, so a long chain takes
+// several operations to split.  Until it is done, the header
+// holds the next block of that chain to look at, and names
+// that belong in the new bucket may still be in the old one.
+//
+// The last slot of every other block holds a struct dirchain
+// instead of a dirent.  The first field of header slots and of
+// dirchains overlays inum and is always 0, so programs that
+// read directories skip them.
+#define HASHDIRMIN   2    // blocks a linear directory may fill
+#define HDRWORDS     7    // header words per slot
+#define MAXDIRBUCKET (DPB*HDRWORDS - 2)
+#define SPLITCHAIN   3    // chain blocks a split step rewrites
+
+struct dirhdr {
+  ushort zero;          // always 0
+  ushort w[HDRWORDS];
+};
+
+#define HDRWORD(hdr, k) ((hdr)[(k)/HDRWORDS].w[(k)%HDRWORDS])
+#define HDRNBUCKET   0          // header word: number of buckets
+#define HDRSPLIT     1          // next block to split, 0 if none
+#define HDRBUCKET(i) (2 + (i))  // first block of bucket i
+
+struct dirchain {
+  ushort zero;          // always 0
+  ushort pad;
+  uint next;            // next block of this chain, 0 if none
+  uint pad1[2];
+};
+
+// Log blocks beyond MAXOPBLOCKS to reserve for an operation
+// that adds a directory entry, in case dirlink() splits a
+// bucket: a split step's chain blocks, as many new blocks and
+// the block they fill first, the header, the chain block and
+// overflow block for the entry itself, the i-node, 2 bitmap
+// blocks and 2 indirect blocks per level.  Converting a
+// directory to a hash table takes fewer.
+#define DIRGROWBLOCKS (2*SPLITCHAIN + 1 + 1 + 2 + 1 + 2 + 2*NLEVEL)
+
+static inline uint
+dirhash(const char *name)
+{
+  uint h;
+  int i;
+
+  h = 0;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = h*31 + (uchar)name[i];
+  // Mix the high bits into the low ones dirbucket() uses.
+  h ^= h >> 16;
+  h *= 0x45d9f3b;
+  h ^= h >> 16;
+  return h;
+}
+
+// Bucket for hash h in a table of n buckets: h mod 2l, where
+// l is the largest power of two <= n, less l if that bucket
+// has not been split off yet.
+static inline uint
+dirbucket(uint h, uint n)
+{
+  uint l;
+
+  for(l = 1; l*2 <= n; l *= 2)
+    ;
+  h %= 2*l;
+  return h < n ? h : h - l;
+}
+
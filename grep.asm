@@ -0,0 +1,2927 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <grep>:
+char buf[1024];
+int match(char*, char*);
+
+void
+grep(char *pattern, int fd)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 18             	sub    $0x18,%esp
+  int n, m;
+  char *p, *q;
+  
+  m = 0;
+       6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+       d:	e9 ae 00 00 00       	jmp    c0 <grep+0xc0>
+    m += n;
+      12:	8b 45 ec             	mov    -0x14(%ebp),%eax
+      15:	01 45 f4             	add    %eax,-0xc(%ebp)
+    buf[m] = '\0';
+      18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      1b:	05 40 1c 00 00       	add    $0x1c40,%eax
+      20:	c6 00 00             	movb   $0x0,(%eax)
+    p = buf;
+      23:	c7 45 f0 40 1c 00 00 	movl   $0x1c40,-0x10(%ebp)
+    while((q = strchr(p, '\n')) != 0){
+      2a:	eb 44                	jmp    70 <grep+0x70>
+      *q = 0;
+      2c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      2f:	c6 00 00             	movb   $0x0,(%eax)
+      if(match(pattern, p)){
+      32:	83 ec 08             	sub    $0x8,%esp
+      35:	ff 75 f0             	push   -0x10(%ebp)
+      38:	ff 75 08             	push   0x8(%ebp)
+      3b:	e8 8f 01 00 00       	call   1cf <match>
+      40:	83 c4 10             	add    $0x10,%esp
+      43:	85 c0                	test   %eax,%eax
+      45:	74 20                	je     67 <grep+0x67>
+        *q = '\n';
+      47:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      4a:	c6 00 0a             	movb   $0xa,(%eax)
+        write(1, p, q+1 - p);
+      4d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      50:	83 c0 01             	add    $0x1,%eax
+      53:	2b 45 f0             	sub    -0x10(%ebp),%eax
+      56:	83 ec 04             	sub    $0x4,%esp
+      59:	50                   	push   %eax
+      5a:	ff 75 f0             	push   -0x10(%ebp)
+      5d:	6a 01                	push   $0x1
+      5f:	e8 ef 08 00 00       	call   953 <write>
+      64:	83 c4 10             	add    $0x10,%esp
+      }
+      p = q+1;
+      67:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      6a:	83 c0 01             	add    $0x1,%eax
+      6d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    while((q = strchr(p, '\n')) != 0){
+      70:	83 ec 08             	sub    $0x8,%esp
+      73:	6a 0a                	push   $0xa
+      75:	ff 75 f0             	push   -0x10(%ebp)
+      78:	e8 90 05 00 00       	call   60d <strchr>
+      7d:	83 c4 10             	add    $0x10,%esp
+      80:	89 45 e8             	mov    %eax,-0x18(%ebp)
+      83:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+      87:	75 a3                	jne    2c <grep+0x2c>
+    }
+    if(p == buf)
+      89:	81 7d f0 40 1c 00 00 	cmpl   $0x1c40,-0x10(%ebp)
+      90:	75 07                	jne    99 <grep+0x99>
+      m = 0;
+      92:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(m > 0){
+      99:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+      9d:	7e 21                	jle    c0 <grep+0xc0>
+      m -= p - buf;
+      9f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+      a2:	2d 40 1c 00 00       	sub    $0x1c40,%eax
+      a7:	29 45 f4             	sub    %eax,-0xc(%ebp)
+      memmove(buf, p, m);
+      aa:	83 ec 04             	sub    $0x4,%esp
+      ad:	ff 75 f4             	push   -0xc(%ebp)
+      b0:	ff 75 f0             	push   -0x10(%ebp)
+      b3:	68 40 1c 00 00       	push   $0x1c40
+      b8:	e8 1e 07 00 00       	call   7db <memmove>
+      bd:	83 c4 10             	add    $0x10,%esp
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+      c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      c3:	ba ff 03 00 00       	mov    $0x3ff,%edx
+      c8:	29 c2                	sub    %eax,%edx
+      ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      cd:	05 40 1c 00 00       	add    $0x1c40,%eax
+      d2:	83 ec 04             	sub    $0x4,%esp
+      d5:	52                   	push   %edx
+      d6:	50                   	push   %eax
+      d7:	ff 75 0c             	push   0xc(%ebp)
+      da:	e8 65 08 00 00       	call   944 <read>
+      df:	83 c4 10             	add    $0x10,%esp
+      e2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      e5:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+      e9:	0f 8f 23 ff ff ff    	jg     12 <grep+0x12>
+    }
+  }
+}
+      ef:	90                   	nop
+      f0:	90                   	nop
+      f1:	c9                   	leave
+      f2:	c3                   	ret
+
+000000f3 <main>:
+
+int
+main(int argc, char *argv[])
+{
+      f3:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+      f7:	83 e4 f0             	and    $0xfffffff0,%esp
+      fa:	ff 71 fc             	push   -0x4(%ecx)
+      fd:	55                   	push   %ebp
+      fe:	89 e5                	mov    %esp,%ebp
+     100:	53                   	push   %ebx
+     101:	51                   	push   %ecx
+     102:	83 ec 10             	sub    $0x10,%esp
+     105:	89 cb                	mov    %ecx,%ebx
+  int fd, i;
+  char *pattern;
+  
+  if(argc <= 1){
+     107:	83 3b 01             	cmpl   $0x1,(%ebx)
+     10a:	7f 17                	jg     123 <main+0x30>
+    printf(2, "usage: grep pattern [file ...]\n");
+     10c:	83 ec 08             	sub    $0x8,%esp
+     10f:	68 b0 16 00 00       	push   $0x16b0
+     114:	6a 02                	push   $0x2
+     116:	e8 7e 0a 00 00       	call   b99 <printf>
+     11b:	83 c4 10             	add    $0x10,%esp
+    exit();
+     11e:	e8 12 15 00 00       	call   1635 <exit>
+  }
+  pattern = argv[1];
+     123:	8b 43 04             	mov    0x4(%ebx),%eax
+     126:	8b 40 04             	mov    0x4(%eax),%eax
+     129:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  
+  if(argc <= 2){
+     12c:	83 3b 02             	cmpl   $0x2,(%ebx)
+     12f:	7f 15                	jg     146 <main+0x53>
+    grep(pattern, 0);
+     131:	83 ec 08             	sub    $0x8,%esp
+     134:	6a 00                	push   $0x0
+     136:	ff 75 f0             	push   -0x10(%ebp)
+     139:	e8 c2 fe ff ff       	call   0 <grep>
+     13e:	83 c4 10             	add    $0x10,%esp
+    exit();
+     141:	e8 ef 14 00 00       	call   1635 <exit>
+  }
+
+  for(i = 2; i < argc; i++){
+     146:	c7 45 f4 02 00 00 00 	movl   $0x2,-0xc(%ebp)
+     14d:	eb 74                	jmp    1c3 <main+0xd0>
+    if((fd = open(argv[i], 0)) < 0){
+     14f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     152:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     159:	8b 43 04             	mov    0x4(%ebx),%eax
+     15c:	01 d0                	add    %edx,%eax
+     15e:	8b 00                	mov    (%eax),%eax
+     160:	83 ec 08             	sub    $0x8,%esp
+     163:	6a 00                	push   $0x0
+     165:	50                   	push   %eax
+     166:	e8 24 08 00 00       	call   98f <open>
+     16b:	83 c4 10             	add    $0x10,%esp
+     16e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     171:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     175:	79 29                	jns    1a0 <main+0xad>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+     177:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     17a:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     181:	8b 43 04             	mov    0x4(%ebx),%eax
+     184:	01 d0                	add    %edx,%eax
+     186:	8b 00                	mov    (%eax),%eax
+     188:	83 ec 04             	sub    $0x4,%esp
+     18b:	50                   	push   %eax
+     18c:	68 d0 16 00 00       	push   $0x16d0
+     191:	6a 01                	push   $0x1
+     193:	e8 01 0a 00 00       	call   b99 <printf>
+     198:	83 c4 10             	add    $0x10,%esp
+      exit();
+     19b:	e8 95 14 00 00       	call   1635 <exit>
+    }
+    grep(pattern, fd);
+     1a0:	83 ec 08             	sub    $0x8,%esp
+     1a3:	ff 75 ec             	push   -0x14(%ebp)
+     1a6:	ff 75 f0             	push   -0x10(%ebp)
+     1a9:	e8 52 fe ff ff       	call   0 <grep>
+     1ae:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+     1b1:	83 ec 0c             	sub    $0xc,%esp
+     1b4:	ff 75 ec             	push   -0x14(%ebp)
+     1b7:	e8 91 14 00 00       	call   164d <close>
+     1bc:	83 c4 10             	add    $0x10,%esp
+  for(i = 2; i < argc; i++){
+     1bf:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     1c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     1c6:	3b 03                	cmp    (%ebx),%eax
+     1c8:	7c 85                	jl     14f <main+0x5c>
+  }
+  exit();
+     1ca:	e8 66 14 00 00       	call   1635 <exit>
+
+000001cf <match>:
+int matchhere(char*, char*);
+int matchstar(int, char*, char*);
+
+int
+match(char *re, char *text)
+{
+     1cf:	55                   	push   %ebp
+     1d0:	89 e5                	mov    %esp,%ebp
+     1d2:	83 ec 08             	sub    $0x8,%esp
+  if(re[0] == '^')
+     1d5:	8b 45 08             	mov    0x8(%ebp),%eax
+     1d8:	0f b6 00             	movzbl (%eax),%eax
+     1db:	3c 5e                	cmp    $0x5e,%al
+     1dd:	75 17                	jne    1f6 <match+0x27>
+    return matchhere(re+1, text);
+     1df:	8b 45 08             	mov    0x8(%ebp),%eax
+     1e2:	83 c0 01             	add    $0x1,%eax
+     1e5:	83 ec 08             	sub    $0x8,%esp
+     1e8:	ff 75 0c             	push   0xc(%ebp)
+     1eb:	50                   	push   %eax
+     1ec:	e8 38 00 00 00       	call   229 <matchhere>
+     1f1:	83 c4 10             	add    $0x10,%esp
+     1f4:	eb 31                	jmp    227 <match+0x58>
+  do{  // must look at empty string
+    if(matchhere(re, text))
+     1f6:	83 ec 08             	sub    $0x8,%esp
+     1f9:	ff 75 0c             	push   0xc(%ebp)
+     1fc:	ff 75 08             	push   0x8(%ebp)
+     1ff:	e8 25 00 00 00       	call   229 <matchhere>
+     204:	83 c4 10             	add    $0x10,%esp
+     207:	85 c0                	test   %eax,%eax
+     209:	74 07                	je     212 <match+0x43>
+      return 1;
+     20b:	b8 01 00 00 00       	mov    $0x1,%eax
+     210:	eb 15                	jmp    227 <match+0x58>
+  }while(*text++ != '\0');
+     212:	8b 45 0c             	mov    0xc(%ebp),%eax
+     215:	8d 50 01             	lea    0x1(%eax),%edx
+     218:	89 55 0c             	mov    %edx,0xc(%ebp)
+     21b:	0f b6 00             	movzbl (%eax),%eax
+     21e:	84 c0                	test   %al,%al
+     220:	75 d4                	jne    1f6 <match+0x27>
+  return 0;
+     222:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     227:	c9                   	leave
+     228:	c3                   	ret
+
+00000229 <matchhere>:
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+     229:	55                   	push   %ebp
+     22a:	89 e5                	mov    %esp,%ebp
+     22c:	83 ec 08             	sub    $0x8,%esp
+  if(re[0] == '\0')
+     22f:	8b 45 08             	mov    0x8(%ebp),%eax
+     232:	0f b6 00             	movzbl (%eax),%eax
+     235:	84 c0                	test   %al,%al
+     237:	75 0a                	jne    243 <matchhere+0x1a>
+    return 1;
+     239:	b8 01 00 00 00       	mov    $0x1,%eax
+     23e:	e9 99 00 00 00       	jmp    2dc <matchhere+0xb3>
+  if(re[1] == '*')
+     243:	8b 45 08             	mov    0x8(%ebp),%eax
+     246:	83 c0 01             	add    $0x1,%eax
+     249:	0f b6 00             	movzbl (%eax),%eax
+     24c:	3c 2a                	cmp    $0x2a,%al
+     24e:	75 21                	jne    271 <matchhere+0x48>
+    return matchstar(re[0], re+2, text);
+     250:	8b 45 08             	mov    0x8(%ebp),%eax
+     253:	8d 50 02             	lea    0x2(%eax),%edx
+     256:	8b 45 08             	mov    0x8(%ebp),%eax
+     259:	0f b6 00             	movzbl (%eax),%eax
+     25c:	0f be c0             	movsbl %al,%eax
+     25f:	83 ec 04             	sub    $0x4,%esp
+     262:	ff 75 0c             	push   0xc(%ebp)
+     265:	52                   	push   %edx
+     266:	50                   	push   %eax
+     267:	e8 72 00 00 00       	call   2de <matchstar>
+     26c:	83 c4 10             	add    $0x10,%esp
+     26f:	eb 6b                	jmp    2dc <matchhere+0xb3>
+  if(re[0] == '$' && re[1] == '\0')
+     271:	8b 45 08             	mov    0x8(%ebp),%eax
+     274:	0f b6 00             	movzbl (%eax),%eax
+     277:	3c 24                	cmp    $0x24,%al
+     279:	75 1d                	jne    298 <matchhere+0x6f>
+     27b:	8b 45 08             	mov    0x8(%ebp),%eax
+     27e:	83 c0 01             	add    $0x1,%eax
+     281:	0f b6 00             	movzbl (%eax),%eax
+     284:	84 c0                	test   %al,%al
+     286:	75 10                	jne    298 <matchhere+0x6f>
+    return *text == '\0';
+     288:	8b 45 0c             	mov    0xc(%ebp),%eax
+     28b:	0f b6 00             	movzbl (%eax),%eax
+     28e:	84 c0                	test   %al,%al
+     290:	0f 94 c0             	sete   %al
+     293:	0f b6 c0             	movzbl %al,%eax
+     296:	eb 44                	jmp    2dc <matchhere+0xb3>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+     298:	8b 45 0c             	mov    0xc(%ebp),%eax
+     29b:	0f b6 00             	movzbl (%eax),%eax
+     29e:	84 c0                	test   %al,%al
+     2a0:	74 35                	je     2d7 <matchhere+0xae>
+     2a2:	8b 45 08             	mov    0x8(%ebp),%eax
+     2a5:	0f b6 00             	movzbl (%eax),%eax
+     2a8:	3c 2e                	cmp    $0x2e,%al
+     2aa:	74 10                	je     2bc <matchhere+0x93>
+     2ac:	8b 45 08             	mov    0x8(%ebp),%eax
+     2af:	0f b6 10             	movzbl (%eax),%edx
+     2b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2b5:	0f b6 00             	movzbl (%eax),%eax
+     2b8:	38 c2                	cmp    %al,%dl
+     2ba:	75 1b                	jne    2d7 <matchhere+0xae>
+    return matchhere(re+1, text+1);
+     2bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2bf:	8d 50 01             	lea    0x1(%eax),%edx
+     2c2:	8b 45 08             	mov    0x8(%ebp),%eax
+     2c5:	83 c0 01             	add    $0x1,%eax
+     2c8:	83 ec 08             	sub    $0x8,%esp
+     2cb:	52                   	push   %edx
+     2cc:	50                   	push   %eax
+     2cd:	e8 57 ff ff ff       	call   229 <matchhere>
+     2d2:	83 c4 10             	add    $0x10,%esp
+     2d5:	eb 05                	jmp    2dc <matchhere+0xb3>
+  return 0;
+     2d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     2dc:	c9                   	leave
+     2dd:	c3                   	ret
+
+000002de <matchstar>:
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+{
+     2de:	55                   	push   %ebp
+     2df:	89 e5                	mov    %esp,%ebp
+     2e1:	83 ec 08             	sub    $0x8,%esp
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+     2e4:	83 ec 08             	sub    $0x8,%esp
+     2e7:	ff 75 10             	push   0x10(%ebp)
+     2ea:	ff 75 0c             	push   0xc(%ebp)
+     2ed:	e8 37 ff ff ff       	call   229 <matchhere>
+     2f2:	83 c4 10             	add    $0x10,%esp
+     2f5:	85 c0                	test   %eax,%eax
+     2f7:	74 07                	je     300 <matchstar+0x22>
+      return 1;
+     2f9:	b8 01 00 00 00       	mov    $0x1,%eax
+     2fe:	eb 29                	jmp    329 <matchstar+0x4b>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+     300:	8b 45 10             	mov    0x10(%ebp),%eax
+     303:	0f b6 00             	movzbl (%eax),%eax
+     306:	84 c0                	test   %al,%al
+     308:	74 1a                	je     324 <matchstar+0x46>
+     30a:	8b 45 10             	mov    0x10(%ebp),%eax
+     30d:	8d 50 01             	lea    0x1(%eax),%edx
+     310:	89 55 10             	mov    %edx,0x10(%ebp)
+     313:	0f b6 00             	movzbl (%eax),%eax
+     316:	0f be c0             	movsbl %al,%eax
+     319:	39 45 08             	cmp    %eax,0x8(%ebp)
+     31c:	74 c6                	je     2e4 <matchstar+0x6>
+     31e:	83 7d 08 2e          	cmpl   $0x2e,0x8(%ebp)
+     322:	74 c0                	je     2e4 <matchstar+0x6>
+  return 0;
+     324:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     329:	c9                   	leave
+     32a:	c3                   	ret
+
+0000032b <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+     32b:	55                   	push   %ebp
+     32c:	89 e5                	mov    %esp,%ebp
+     32e:	57                   	push   %edi
+     32f:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+     330:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     333:	8b 55 10             	mov    0x10(%ebp),%edx
+     336:	8b 45 0c             	mov    0xc(%ebp),%eax
+     339:	89 cb                	mov    %ecx,%ebx
+     33b:	89 df                	mov    %ebx,%edi
+     33d:	89 d1                	mov    %edx,%ecx
+     33f:	fc                   	cld
+     340:	f3 aa                	rep stos %al,%es:(%edi)
+     342:	89 ca                	mov    %ecx,%edx
+     344:	89 fb                	mov    %edi,%ebx
+     346:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     349:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     34c:	90                   	nop
+     34d:	5b                   	pop    %ebx
+     34e:	5f                   	pop    %edi
+     34f:	5d                   	pop    %ebp
+     350:	c3                   	ret
+
+00000351 <stosl>:
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+     351:	55                   	push   %ebp
+     352:	89 e5                	mov    %esp,%ebp
+     354:	57                   	push   %edi
+     355:	53                   	push   %ebx
+  asm volatile("cld; rep stosl" :
+     356:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     359:	8b 55 10             	mov    0x10(%ebp),%edx
+     35c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     35f:	89 cb                	mov    %ecx,%ebx
+     361:	89 df                	mov    %ebx,%edi
+     363:	89 d1                	mov    %edx,%ecx
+     365:	fc                   	cld
+     366:	f3 ab                	rep stos %eax,%es:(%edi)
+     368:	89 ca                	mov    %ecx,%edx
+     36a:	89 fb                	mov    %edi,%ebx
+     36c:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     36f:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     372:	90                   	nop
+     373:	5b                   	pop    %ebx
+     374:	5f                   	pop    %edi
+     375:	5d                   	pop    %ebp
+     376:	c3                   	ret
+
+00000377 <movsb>:
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+     377:	55                   	push   %ebp
+     378:	89 e5                	mov    %esp,%ebp
+     37a:	57                   	push   %edi
+     37b:	56                   	push   %esi
+     37c:	53                   	push   %ebx
+  asm volatile("cld; rep movsb" :
+     37d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     380:	8b 55 0c             	mov    0xc(%ebp),%edx
+     383:	8b 45 10             	mov    0x10(%ebp),%eax
+     386:	89 cb                	mov    %ecx,%ebx
+     388:	89 df                	mov    %ebx,%edi
+     38a:	89 d6                	mov    %edx,%esi
+     38c:	89 c1                	mov    %eax,%ecx
+     38e:	fc                   	cld
+     38f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     391:	89 c8                	mov    %ecx,%eax
+     393:	89 f2                	mov    %esi,%edx
+     395:	89 fb                	mov    %edi,%ebx
+     397:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     39a:	89 55 0c             	mov    %edx,0xc(%ebp)
+     39d:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     3a0:	90                   	nop
+     3a1:	5b                   	pop    %ebx
+     3a2:	5e                   	pop    %esi
+     3a3:	5f                   	pop    %edi
+     3a4:	5d                   	pop    %ebp
+     3a5:	c3                   	ret
+
+000003a6 <movsl>:
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+     3a6:	55                   	push   %ebp
+     3a7:	89 e5                	mov    %esp,%ebp
+     3a9:	57                   	push   %edi
+     3aa:	56                   	push   %esi
+     3ab:	53                   	push   %ebx
+  asm volatile("cld; rep movsl" :
+     3ac:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     3af:	8b 55 0c             	mov    0xc(%ebp),%edx
+     3b2:	8b 45 10             	mov    0x10(%ebp),%eax
+     3b5:	89 cb                	mov    %ecx,%ebx
+     3b7:	89 df                	mov    %ebx,%edi
+     3b9:	89 d6                	mov    %edx,%esi
+     3bb:	89 c1                	mov    %eax,%ecx
+     3bd:	fc                   	cld
+     3be:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     3c0:	89 c8                	mov    %ecx,%eax
+     3c2:	89 f2                	mov    %esi,%edx
+     3c4:	89 fb                	mov    %edi,%ebx
+     3c6:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     3c9:	89 55 0c             	mov    %edx,0xc(%ebp)
+     3cc:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     3cf:	90                   	nop
+     3d0:	5b                   	pop    %ebx
+     3d1:	5e                   	pop    %esi
+     3d2:	5f                   	pop    %edi
+     3d3:	5d                   	pop    %ebp
+     3d4:	c3                   	ret
+
+000003d5 <strcpy>:
+#define ONES        0x01010101
+#define HASZERO(x)  (((x) - ONES) & ~(x) & (ONES << 7))
+
+char*
+strcpy(char *s, char *t)
+{
+     3d5:	55                   	push   %ebp
+     3d6:	89 e5                	mov    %esp,%ebp
+     3d8:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+     3db:	8b 45 08             	mov    0x8(%ebp),%eax
+     3de:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     3e1:	90                   	nop
+     3e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+     3e5:	8d 42 01             	lea    0x1(%edx),%eax
+     3e8:	89 45 0c             	mov    %eax,0xc(%ebp)
+     3eb:	8b 45 08             	mov    0x8(%ebp),%eax
+     3ee:	8d 48 01             	lea    0x1(%eax),%ecx
+     3f1:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     3f4:	0f b6 12             	movzbl (%edx),%edx
+     3f7:	88 10                	mov    %dl,(%eax)
+     3f9:	0f b6 00             	movzbl (%eax),%eax
+     3fc:	84 c0                	test   %al,%al
+     3fe:	75 e2                	jne    3e2 <strcpy+0xd>
+    ;
+  return os;
+     400:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     403:	c9                   	leave
+     404:	c3                   	ret
+
+00000405 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     405:	55                   	push   %ebp
+     406:	89 e5                	mov    %esp,%ebp
+  // Aligned words never straddle a page, so reading
+  // whole ones past the end of a string is safe.
+  if((((uint)p | (uint)q) & 3) == 0)
+     408:	8b 55 08             	mov    0x8(%ebp),%edx
+     40b:	8b 45 0c             	mov    0xc(%ebp),%eax
+     40e:	09 d0                	or     %edx,%eax
+     410:	83 e0 03             	and    $0x3,%eax
+     413:	85 c0                	test   %eax,%eax
+     415:	75 3f                	jne    456 <strcmp+0x51>
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     417:	eb 08                	jmp    421 <strcmp+0x1c>
+      p += 4, q += 4;
+     419:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     41d:	83 45 0c 04          	addl   $0x4,0xc(%ebp)
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     421:	8b 45 08             	mov    0x8(%ebp),%eax
+     424:	8b 10                	mov    (%eax),%edx
+     426:	8b 45 0c             	mov    0xc(%ebp),%eax
+     429:	8b 00                	mov    (%eax),%eax
+     42b:	39 c2                	cmp    %eax,%edx
+     42d:	75 27                	jne    456 <strcmp+0x51>
+     42f:	8b 45 08             	mov    0x8(%ebp),%eax
+     432:	8b 00                	mov    (%eax),%eax
+     434:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     43a:	8b 45 08             	mov    0x8(%ebp),%eax
+     43d:	8b 00                	mov    (%eax),%eax
+     43f:	f7 d0                	not    %eax
+     441:	21 d0                	and    %edx,%eax
+     443:	25 80 80 80 80       	and    $0x80808080,%eax
+     448:	85 c0                	test   %eax,%eax
+     44a:	74 cd                	je     419 <strcmp+0x14>
+  while(*p && *p == *q)
+     44c:	eb 08                	jmp    456 <strcmp+0x51>
+    p++, q++;
+     44e:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     452:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     456:	8b 45 08             	mov    0x8(%ebp),%eax
+     459:	0f b6 00             	movzbl (%eax),%eax
+     45c:	84 c0                	test   %al,%al
+     45e:	74 10                	je     470 <strcmp+0x6b>
+     460:	8b 45 08             	mov    0x8(%ebp),%eax
+     463:	0f b6 10             	movzbl (%eax),%edx
+     466:	8b 45 0c             	mov    0xc(%ebp),%eax
+     469:	0f b6 00             	movzbl (%eax),%eax
+     46c:	38 c2                	cmp    %al,%dl
+     46e:	74 de                	je     44e <strcmp+0x49>
+  return (uchar)*p - (uchar)*q;
+     470:	8b 45 08             	mov    0x8(%ebp),%eax
+     473:	0f b6 00             	movzbl (%eax),%eax
+     476:	0f b6 d0             	movzbl %al,%edx
+     479:	8b 45 0c             	mov    0xc(%ebp),%eax
+     47c:	0f b6 00             	movzbl (%eax),%eax
+     47f:	0f b6 c0             	movzbl %al,%eax
+     482:	29 c2                	sub    %eax,%edx
+     484:	89 d0                	mov    %edx,%eax
+}
+     486:	5d                   	pop    %ebp
+     487:	c3                   	ret
+
+00000488 <strlen>:
+
+uint
+strlen(char *s)
+{
+     488:	55                   	push   %ebp
+     489:	89 e5                	mov    %esp,%ebp
+     48b:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; ((uint)(s+n) & 3) && s[n]; n++)
+     48e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     495:	eb 04                	jmp    49b <strlen+0x13>
+     497:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     49b:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     49e:	8b 45 08             	mov    0x8(%ebp),%eax
+     4a1:	01 d0                	add    %edx,%eax
+     4a3:	83 e0 03             	and    $0x3,%eax
+     4a6:	85 c0                	test   %eax,%eax
+     4a8:	74 0f                	je     4b9 <strlen+0x31>
+     4aa:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     4ad:	8b 45 08             	mov    0x8(%ebp),%eax
+     4b0:	01 d0                	add    %edx,%eax
+     4b2:	0f b6 00             	movzbl (%eax),%eax
+     4b5:	84 c0                	test   %al,%al
+     4b7:	75 de                	jne    497 <strlen+0xf>
+    ;
+  if(s[n])
+     4b9:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     4bc:	8b 45 08             	mov    0x8(%ebp),%eax
+     4bf:	01 d0                	add    %edx,%eax
+     4c1:	0f b6 00             	movzbl (%eax),%eax
+     4c4:	84 c0                	test   %al,%al
+     4c6:	74 33                	je     4fb <strlen+0x73>
+    while(!HASZERO(*(uint*)(s+n)))
+     4c8:	eb 04                	jmp    4ce <strlen+0x46>
+      n += 4;
+     4ca:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+    while(!HASZERO(*(uint*)(s+n)))
+     4ce:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     4d1:	8b 45 08             	mov    0x8(%ebp),%eax
+     4d4:	01 d0                	add    %edx,%eax
+     4d6:	8b 00                	mov    (%eax),%eax
+     4d8:	8d 88 ff fe fe fe    	lea    -0x1010101(%eax),%ecx
+     4de:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     4e1:	8b 45 08             	mov    0x8(%ebp),%eax
+     4e4:	01 d0                	add    %edx,%eax
+     4e6:	8b 00                	mov    (%eax),%eax
+     4e8:	f7 d0                	not    %eax
+     4ea:	21 c8                	and    %ecx,%eax
+     4ec:	25 80 80 80 80       	and    $0x80808080,%eax
+     4f1:	85 c0                	test   %eax,%eax
+     4f3:	74 d5                	je     4ca <strlen+0x42>
+  for(; s[n]; n++)
+     4f5:	eb 04                	jmp    4fb <strlen+0x73>
+     4f7:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     4fb:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     4fe:	8b 45 08             	mov    0x8(%ebp),%eax
+     501:	01 d0                	add    %edx,%eax
+     503:	0f b6 00             	movzbl (%eax),%eax
+     506:	84 c0                	test   %al,%al
+     508:	75 ed                	jne    4f7 <strlen+0x6f>
+    ;
+  return n;
+     50a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     50d:	c9                   	leave
+     50e:	c3                   	ret
+
+0000050f <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     50f:	55                   	push   %ebp
+     510:	89 e5                	mov    %esp,%ebp
+     512:	83 ec 10             	sub    $0x10,%esp
+  char *d;
+  uint k;
+
+  d = dst;
+     515:	8b 45 08             	mov    0x8(%ebp),%eax
+     518:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c &= 0xFF;
+     51b:	81 65 0c ff 00 00 00 	andl   $0xff,0xc(%ebp)
+  if(n >= 16){
+     522:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     526:	76 54                	jbe    57c <memset+0x6d>
+    k = -(uint)d & 3;  // bytes up to a word boundary
+     528:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     52b:	f7 d8                	neg    %eax
+     52d:	83 e0 03             	and    $0x3,%eax
+     530:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    stosb(d, c, k);
+     533:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     536:	50                   	push   %eax
+     537:	ff 75 0c             	push   0xc(%ebp)
+     53a:	ff 75 fc             	push   -0x4(%ebp)
+     53d:	e8 e9 fd ff ff       	call   32b <stosb>
+     542:	83 c4 0c             	add    $0xc,%esp
+    d += k;
+     545:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     548:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n -= k;
+     54b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     54e:	29 45 10             	sub    %eax,0x10(%ebp)
+    stosl(d, c*ONES, n/4);
+     551:	8b 45 10             	mov    0x10(%ebp),%eax
+     554:	c1 e8 02             	shr    $0x2,%eax
+     557:	89 c2                	mov    %eax,%edx
+     559:	8b 45 0c             	mov    0xc(%ebp),%eax
+     55c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     562:	52                   	push   %edx
+     563:	50                   	push   %eax
+     564:	ff 75 fc             	push   -0x4(%ebp)
+     567:	e8 e5 fd ff ff       	call   351 <stosl>
+     56c:	83 c4 0c             	add    $0xc,%esp
+    d += n & ~3;
+     56f:	8b 45 10             	mov    0x10(%ebp),%eax
+     572:	83 e0 fc             	and    $0xfffffffc,%eax
+     575:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n &= 3;
+     578:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+  }
+  stosb(d, c, n);
+     57c:	8b 45 10             	mov    0x10(%ebp),%eax
+     57f:	50                   	push   %eax
+     580:	ff 75 0c             	push   0xc(%ebp)
+     583:	ff 75 fc             	push   -0x4(%ebp)
+     586:	e8 a0 fd ff ff       	call   32b <stosb>
+     58b:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     58e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     591:	c9                   	leave
+     592:	c3                   	ret
+
+00000593 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     593:	55                   	push   %ebp
+     594:	89 e5                	mov    %esp,%ebp
+     596:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s1, *s2;
+
+  s1 = v1;
+     599:	8b 45 08             	mov    0x8(%ebp),%eax
+     59c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s2 = v2;
+     59f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     5a2:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     5a5:	eb 0c                	jmp    5b3 <memcmp+0x20>
+    s1 += 4, s2 += 4, n -= 4;
+     5a7:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+     5ab:	83 45 f8 04          	addl   $0x4,-0x8(%ebp)
+     5af:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     5b3:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     5b7:	76 3e                	jbe    5f7 <memcmp+0x64>
+     5b9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     5bc:	8b 10                	mov    (%eax),%edx
+     5be:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     5c1:	8b 00                	mov    (%eax),%eax
+     5c3:	39 c2                	cmp    %eax,%edx
+     5c5:	74 e0                	je     5a7 <memcmp+0x14>
+  while(n-- > 0){
+     5c7:	eb 2e                	jmp    5f7 <memcmp+0x64>
+    if(*s1 != *s2)
+     5c9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     5cc:	0f b6 10             	movzbl (%eax),%edx
+     5cf:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     5d2:	0f b6 00             	movzbl (%eax),%eax
+     5d5:	38 c2                	cmp    %al,%dl
+     5d7:	74 16                	je     5ef <memcmp+0x5c>
+      return *s1 - *s2;
+     5d9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     5dc:	0f b6 00             	movzbl (%eax),%eax
+     5df:	0f b6 d0             	movzbl %al,%edx
+     5e2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     5e5:	0f b6 00             	movzbl (%eax),%eax
+     5e8:	0f b6 c0             	movzbl %al,%eax
+     5eb:	29 c2                	sub    %eax,%edx
+     5ed:	eb 1a                	jmp    609 <memcmp+0x76>
+    s1++, s2++;
+     5ef:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     5f3:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+  while(n-- > 0){
+     5f7:	8b 45 10             	mov    0x10(%ebp),%eax
+     5fa:	8d 50 ff             	lea    -0x1(%eax),%edx
+     5fd:	89 55 10             	mov    %edx,0x10(%ebp)
+     600:	85 c0                	test   %eax,%eax
+     602:	75 c5                	jne    5c9 <memcmp+0x36>
+  }
+  return 0;
+     604:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+     609:	89 d0                	mov    %edx,%eax
+     60b:	c9                   	leave
+     60c:	c3                   	ret
+
+0000060d <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     60d:	55                   	push   %ebp
+     60e:	89 e5                	mov    %esp,%ebp
+     610:	83 ec 14             	sub    $0x14,%esp
+     613:	8b 45 0c             	mov    0xc(%ebp),%eax
+     616:	88 45 ec             	mov    %al,-0x14(%ebp)
+  uint w, cc;
+
+  // Skip whole words holding neither c nor the terminator.
+  for(; ((uint)s & 3) && *s; s++)
+     619:	eb 17                	jmp    632 <strchr+0x25>
+    if(*s == c)
+     61b:	8b 45 08             	mov    0x8(%ebp),%eax
+     61e:	0f b6 00             	movzbl (%eax),%eax
+     621:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     624:	75 08                	jne    62e <strchr+0x21>
+      return (char*)s;
+     626:	8b 45 08             	mov    0x8(%ebp),%eax
+     629:	e9 ad 00 00 00       	jmp    6db <strchr+0xce>
+  for(; ((uint)s & 3) && *s; s++)
+     62e:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     632:	8b 45 08             	mov    0x8(%ebp),%eax
+     635:	83 e0 03             	and    $0x3,%eax
+     638:	85 c0                	test   %eax,%eax
+     63a:	74 0a                	je     646 <strchr+0x39>
+     63c:	8b 45 08             	mov    0x8(%ebp),%eax
+     63f:	0f b6 00             	movzbl (%eax),%eax
+     642:	84 c0                	test   %al,%al
+     644:	75 d5                	jne    61b <strchr+0xe>
+  cc = (uchar)c * ONES;
+     646:	0f b6 45 ec          	movzbl -0x14(%ebp),%eax
+     64a:	0f b6 c0             	movzbl %al,%eax
+     64d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     653:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(*s)
+     656:	8b 45 08             	mov    0x8(%ebp),%eax
+     659:	0f b6 00             	movzbl (%eax),%eax
+     65c:	84 c0                	test   %al,%al
+     65e:	74 6c                	je     6cc <strchr+0xbf>
+    for(; w = *(uint*)s, !HASZERO(w) && !HASZERO(w ^ cc); s += 4)
+     660:	eb 04                	jmp    666 <strchr+0x59>
+     662:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     666:	8b 45 08             	mov    0x8(%ebp),%eax
+     669:	8b 00                	mov    (%eax),%eax
+     66b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     66e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     671:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     677:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     67a:	f7 d0                	not    %eax
+     67c:	21 d0                	and    %edx,%eax
+     67e:	25 80 80 80 80       	and    $0x80808080,%eax
+     683:	85 c0                	test   %eax,%eax
+     685:	75 26                	jne    6ad <strchr+0xa0>
+     687:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     68a:	33 45 fc             	xor    -0x4(%ebp),%eax
+     68d:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     693:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     696:	33 45 fc             	xor    -0x4(%ebp),%eax
+     699:	f7 d0                	not    %eax
+     69b:	21 d0                	and    %edx,%eax
+     69d:	25 80 80 80 80       	and    $0x80808080,%eax
+     6a2:	85 c0                	test   %eax,%eax
+     6a4:	75 07                	jne    6ad <strchr+0xa0>
+     6a6:	b8 01 00 00 00       	mov    $0x1,%eax
+     6ab:	eb 05                	jmp    6b2 <strchr+0xa5>
+     6ad:	b8 00 00 00 00       	mov    $0x0,%eax
+     6b2:	85 c0                	test   %eax,%eax
+     6b4:	75 ac                	jne    662 <strchr+0x55>
+      ;
+  for(; *s; s++)
+     6b6:	eb 14                	jmp    6cc <strchr+0xbf>
+    if(*s == c)
+     6b8:	8b 45 08             	mov    0x8(%ebp),%eax
+     6bb:	0f b6 00             	movzbl (%eax),%eax
+     6be:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     6c1:	75 05                	jne    6c8 <strchr+0xbb>
+      return (char*)s;
+     6c3:	8b 45 08             	mov    0x8(%ebp),%eax
+     6c6:	eb 13                	jmp    6db <strchr+0xce>
+  for(; *s; s++)
+     6c8:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     6cc:	8b 45 08             	mov    0x8(%ebp),%eax
+     6cf:	0f b6 00             	movzbl (%eax),%eax
+     6d2:	84 c0                	test   %al,%al
+     6d4:	75 e2                	jne    6b8 <strchr+0xab>
+  return 0;
+     6d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     6db:	c9                   	leave
+     6dc:	c3                   	ret
+
+000006dd <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     6dd:	55                   	push   %ebp
+     6de:	89 e5                	mov    %esp,%ebp
+     6e0:	83 ec 18             	sub    $0x18,%esp
+  int i, c;
+
+  for(i=0; i+1 < max; ){
+     6e3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     6ea:	eb 37                	jmp    723 <gets+0x46>
+    c = fgetc(0);
+     6ec:	83 ec 0c             	sub    $0xc,%esp
+     6ef:	6a 00                	push   $0x0
+     6f1:	e8 2e 0e 00 00       	call   1524 <fgetc>
+     6f6:	83 c4 10             	add    $0x10,%esp
+     6f9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(c < 0)
+     6fc:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     700:	78 2e                	js     730 <gets+0x53>
+      break;
+    buf[i++] = c;
+     702:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     705:	8d 50 01             	lea    0x1(%eax),%edx
+     708:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     70b:	89 c2                	mov    %eax,%edx
+     70d:	8b 45 08             	mov    0x8(%ebp),%eax
+     710:	01 d0                	add    %edx,%eax
+     712:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     715:	88 10                	mov    %dl,(%eax)
+    if(c == '\n' || c == '\r')
+     717:	83 7d f0 0a          	cmpl   $0xa,-0x10(%ebp)
+     71b:	74 14                	je     731 <gets+0x54>
+     71d:	83 7d f0 0d          	cmpl   $0xd,-0x10(%ebp)
+     721:	74 0e                	je     731 <gets+0x54>
+  for(i=0; i+1 < max; ){
+     723:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     726:	83 c0 01             	add    $0x1,%eax
+     729:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     72c:	7f be                	jg     6ec <gets+0xf>
+     72e:	eb 01                	jmp    731 <gets+0x54>
+      break;
+     730:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     731:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     734:	8b 45 08             	mov    0x8(%ebp),%eax
+     737:	01 d0                	add    %edx,%eax
+     739:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     73c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     73f:	c9                   	leave
+     740:	c3                   	ret
+
+00000741 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     741:	55                   	push   %ebp
+     742:	89 e5                	mov    %esp,%ebp
+     744:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     747:	83 ec 08             	sub    $0x8,%esp
+     74a:	6a 00                	push   $0x0
+     74c:	ff 75 08             	push   0x8(%ebp)
+     74f:	e8 3b 02 00 00       	call   98f <open>
+     754:	83 c4 10             	add    $0x10,%esp
+     757:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     75a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     75e:	79 07                	jns    767 <stat+0x26>
+    return -1;
+     760:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     765:	eb 25                	jmp    78c <stat+0x4b>
+  r = fstat(fd, st);
+     767:	83 ec 08             	sub    $0x8,%esp
+     76a:	ff 75 0c             	push   0xc(%ebp)
+     76d:	ff 75 f4             	push   -0xc(%ebp)
+     770:	e8 47 02 00 00       	call   9bc <fstat>
+     775:	83 c4 10             	add    $0x10,%esp
+     778:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     77b:	83 ec 0c             	sub    $0xc,%esp
+     77e:	ff 75 f4             	push   -0xc(%ebp)
+     781:	e8 c7 0e 00 00       	call   164d <close>
+     786:	83 c4 10             	add    $0x10,%esp
+  return r;
+     789:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     78c:	c9                   	leave
+     78d:	c3                   	ret
+
+0000078e <atoi>:
+
+int
+atoi(const char *s)
+{
+     78e:	55                   	push   %ebp
+     78f:	89 e5                	mov    %esp,%ebp
+     791:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     794:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     79b:	eb 25                	jmp    7c2 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     79d:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     7a0:	89 d0                	mov    %edx,%eax
+     7a2:	c1 e0 02             	shl    $0x2,%eax
+     7a5:	01 d0                	add    %edx,%eax
+     7a7:	01 c0                	add    %eax,%eax
+     7a9:	89 c1                	mov    %eax,%ecx
+     7ab:	8b 45 08             	mov    0x8(%ebp),%eax
+     7ae:	8d 50 01             	lea    0x1(%eax),%edx
+     7b1:	89 55 08             	mov    %edx,0x8(%ebp)
+     7b4:	0f b6 00             	movzbl (%eax),%eax
+     7b7:	0f be c0             	movsbl %al,%eax
+     7ba:	01 c8                	add    %ecx,%eax
+     7bc:	83 e8 30             	sub    $0x30,%eax
+     7bf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     7c2:	8b 45 08             	mov    0x8(%ebp),%eax
+     7c5:	0f b6 00             	movzbl (%eax),%eax
+     7c8:	3c 2f                	cmp    $0x2f,%al
+     7ca:	7e 0a                	jle    7d6 <atoi+0x48>
+     7cc:	8b 45 08             	mov    0x8(%ebp),%eax
+     7cf:	0f b6 00             	movzbl (%eax),%eax
+     7d2:	3c 39                	cmp    $0x39,%al
+     7d4:	7e c7                	jle    79d <atoi+0xf>
+  return n;
+     7d6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     7d9:	c9                   	leave
+     7da:	c3                   	ret
+
+000007db <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     7db:	55                   	push   %ebp
+     7dc:	89 e5                	mov    %esp,%ebp
+     7de:	83 ec 10             	sub    $0x10,%esp
+  char *d, *s;
+  int k;
+
+  if(n <= 0)
+     7e1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     7e5:	7f 08                	jg     7ef <memmove+0x14>
+    return vdst;
+     7e7:	8b 45 08             	mov    0x8(%ebp),%eax
+     7ea:	e9 17 01 00 00       	jmp    906 <memmove+0x12b>
+  d = vdst;
+     7ef:	8b 45 08             	mov    0x8(%ebp),%eax
+     7f2:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s = vsrc;
+     7f5:	8b 45 0c             	mov    0xc(%ebp),%eax
+     7f8:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  if(s < d && s + n > d){
+     7fb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     7fe:	3b 45 fc             	cmp    -0x4(%ebp),%eax
+     801:	0f 83 84 00 00 00    	jae    88b <memmove+0xb0>
+     807:	8b 55 10             	mov    0x10(%ebp),%edx
+     80a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     80d:	01 d0                	add    %edx,%eax
+     80f:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     812:	73 77                	jae    88b <memmove+0xb0>
+    s += n;
+     814:	8b 45 10             	mov    0x10(%ebp),%eax
+     817:	01 45 f8             	add    %eax,-0x8(%ebp)
+    d += n;
+     81a:	8b 45 10             	mov    0x10(%ebp),%eax
+     81d:	01 45 fc             	add    %eax,-0x4(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     820:	eb 17                	jmp    839 <memmove+0x5e>
+      *--d = *--s, n--;
+     822:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     826:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     82a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     82d:	0f b6 10             	movzbl (%eax),%edx
+     830:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     833:	88 10                	mov    %dl,(%eax)
+     835:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     839:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     83d:	7e 22                	jle    861 <memmove+0x86>
+     83f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     842:	83 e0 03             	and    $0x3,%eax
+     845:	85 c0                	test   %eax,%eax
+     847:	75 d9                	jne    822 <memmove+0x47>
+    for(; n >= 4; n -= 4){
+     849:	eb 16                	jmp    861 <memmove+0x86>
+      d -= 4;
+     84b:	83 6d fc 04          	subl   $0x4,-0x4(%ebp)
+      s -= 4;
+     84f:	83 6d f8 04          	subl   $0x4,-0x8(%ebp)
+      *(uint*)d = *(uint*)s;
+     853:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     856:	8b 10                	mov    (%eax),%edx
+     858:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     85b:	89 10                	mov    %edx,(%eax)
+    for(; n >= 4; n -= 4){
+     85d:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+     861:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     865:	7f e4                	jg     84b <memmove+0x70>
+    }
+    while(n-- > 0)
+     867:	eb 13                	jmp    87c <memmove+0xa1>
+      *--d = *--s;
+     869:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     86d:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     871:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     874:	0f b6 10             	movzbl (%eax),%edx
+     877:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     87a:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+     87c:	8b 45 10             	mov    0x10(%ebp),%eax
+     87f:	8d 50 ff             	lea    -0x1(%eax),%edx
+     882:	89 55 10             	mov    %edx,0x10(%ebp)
+     885:	85 c0                	test   %eax,%eax
+     887:	7f e0                	jg     869 <memmove+0x8e>
+  if(s < d && s + n > d){
+     889:	eb 78                	jmp    903 <memmove+0x128>
+  } else {
+    if(n >= 16){
+     88b:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     88f:	7e 61                	jle    8f2 <memmove+0x117>
+      k = -(uint)d & 3;
+     891:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     894:	f7 d8                	neg    %eax
+     896:	83 e0 03             	and    $0x3,%eax
+     899:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      movsb(d, s, k);
+     89c:	ff 75 f4             	push   -0xc(%ebp)
+     89f:	ff 75 f8             	push   -0x8(%ebp)
+     8a2:	ff 75 fc             	push   -0x4(%ebp)
+     8a5:	e8 cd fa ff ff       	call   377 <movsb>
+     8aa:	83 c4 0c             	add    $0xc,%esp
+      d += k;
+     8ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8b0:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += k;
+     8b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8b6:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n -= k;
+     8b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8bc:	29 45 10             	sub    %eax,0x10(%ebp)
+      movsl(d, s, n/4);
+     8bf:	8b 45 10             	mov    0x10(%ebp),%eax
+     8c2:	8d 50 03             	lea    0x3(%eax),%edx
+     8c5:	85 c0                	test   %eax,%eax
+     8c7:	0f 48 c2             	cmovs  %edx,%eax
+     8ca:	c1 f8 02             	sar    $0x2,%eax
+     8cd:	50                   	push   %eax
+     8ce:	ff 75 f8             	push   -0x8(%ebp)
+     8d1:	ff 75 fc             	push   -0x4(%ebp)
+     8d4:	e8 cd fa ff ff       	call   3a6 <movsl>
+     8d9:	83 c4 0c             	add    $0xc,%esp
+      d += n & ~3;
+     8dc:	8b 45 10             	mov    0x10(%ebp),%eax
+     8df:	83 e0 fc             	and    $0xfffffffc,%eax
+     8e2:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += n & ~3;
+     8e5:	8b 45 10             	mov    0x10(%ebp),%eax
+     8e8:	83 e0 fc             	and    $0xfffffffc,%eax
+     8eb:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n &= 3;
+     8ee:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+    }
+    movsb(d, s, n);
+     8f2:	ff 75 10             	push   0x10(%ebp)
+     8f5:	ff 75 f8             	push   -0x8(%ebp)
+     8f8:	ff 75 fc             	push   -0x4(%ebp)
+     8fb:	e8 77 fa ff ff       	call   377 <movsb>
+     900:	83 c4 0c             	add    $0xc,%esp
+  }
+  return vdst;
+     903:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     906:	c9                   	leave
+     907:	c3                   	ret
+
+00000908 <_fork>:
+    movl %esp, %ecx; \
+    movl $1f, %edx; \
+    sysenter; \
+  1: ret
+
+RAWSYSCALL(fork)
+     908:	b8 01 00 00 00       	mov    $0x1,%eax
+     90d:	89 e1                	mov    %esp,%ecx
+     90f:	ba 16 09 00 00       	mov    $0x916,%edx
+     914:	0f 34                	sysenter
+     916:	c3                   	ret
+
+00000917 <_exit>:
+RAWSYSCALL(exit)
+     917:	b8 02 00 00 00       	mov    $0x2,%eax
+     91c:	89 e1                	mov    %esp,%ecx
+     91e:	ba 25 09 00 00       	mov    $0x925,%edx
+     923:	0f 34                	sysenter
+     925:	c3                   	ret
+
+00000926 <wait>:
+SYSCALL(wait)
+     926:	b8 03 00 00 00       	mov    $0x3,%eax
+     92b:	89 e1                	mov    %esp,%ecx
+     92d:	ba 34 09 00 00       	mov    $0x934,%edx
+     932:	0f 34                	sysenter
+     934:	c3                   	ret
+
+00000935 <pipe>:
+SYSCALL(pipe)
+     935:	b8 04 00 00 00       	mov    $0x4,%eax
+     93a:	89 e1                	mov    %esp,%ecx
+     93c:	ba 43 09 00 00       	mov    $0x943,%edx
+     941:	0f 34                	sysenter
+     943:	c3                   	ret
+
+00000944 <read>:
+SYSCALL(read)
+     944:	b8 05 00 00 00       	mov    $0x5,%eax
+     949:	89 e1                	mov    %esp,%ecx
+     94b:	ba 52 09 00 00       	mov    $0x952,%edx
+     950:	0f 34                	sysenter
+     952:	c3                   	ret
+
+00000953 <write>:
+SYSCALL(write)
+     953:	b8 10 00 00 00       	mov    $0x10,%eax
+     958:	89 e1                	mov    %esp,%ecx
+     95a:	ba 61 09 00 00       	mov    $0x961,%edx
+     95f:	0f 34                	sysenter
+     961:	c3                   	ret
+
+00000962 <_close>:
+RAWSYSCALL(close)
+     962:	b8 15 00 00 00       	mov    $0x15,%eax
+     967:	89 e1                	mov    %esp,%ecx
+     969:	ba 70 09 00 00       	mov    $0x970,%edx
+     96e:	0f 34                	sysenter
+     970:	c3                   	ret
+
+00000971 <kill>:
+SYSCALL(kill)
+     971:	b8 06 00 00 00       	mov    $0x6,%eax
+     976:	89 e1                	mov    %esp,%ecx
+     978:	ba 7f 09 00 00       	mov    $0x97f,%edx
+     97d:	0f 34                	sysenter
+     97f:	c3                   	ret
+
+00000980 <_exec>:
+RAWSYSCALL(exec)
+     980:	b8 07 00 00 00       	mov    $0x7,%eax
+     985:	89 e1                	mov    %esp,%ecx
+     987:	ba 8e 09 00 00       	mov    $0x98e,%edx
+     98c:	0f 34                	sysenter
+     98e:	c3                   	ret
+
+0000098f <open>:
+SYSCALL(open)
+     98f:	b8 0f 00 00 00       	mov    $0xf,%eax
+     994:	89 e1                	mov    %esp,%ecx
+     996:	ba 9d 09 00 00       	mov    $0x99d,%edx
+     99b:	0f 34                	sysenter
+     99d:	c3                   	ret
+
+0000099e <mknod>:
+SYSCALL(mknod)
+     99e:	b8 11 00 00 00       	mov    $0x11,%eax
+     9a3:	89 e1                	mov    %esp,%ecx
+     9a5:	ba ac 09 00 00       	mov    $0x9ac,%edx
+     9aa:	0f 34                	sysenter
+     9ac:	c3                   	ret
+
+000009ad <unlink>:
+SYSCALL(unlink)
+     9ad:	b8 12 00 00 00       	mov    $0x12,%eax
+     9b2:	89 e1                	mov    %esp,%ecx
+     9b4:	ba bb 09 00 00       	mov    $0x9bb,%edx
+     9b9:	0f 34                	sysenter
+     9bb:	c3                   	ret
+
+000009bc <fstat>:
+SYSCALL(fstat)
+     9bc:	b8 08 00 00 00       	mov    $0x8,%eax
+     9c1:	89 e1                	mov    %esp,%ecx
+     9c3:	ba ca 09 00 00       	mov    $0x9ca,%edx
+     9c8:	0f 34                	sysenter
+     9ca:	c3                   	ret
+
+000009cb <link>:
+SYSCALL(link)
+     9cb:	b8 13 00 00 00       	mov    $0x13,%eax
+     9d0:	89 e1                	mov    %esp,%ecx
+     9d2:	ba d9 09 00 00       	mov    $0x9d9,%edx
+     9d7:	0f 34                	sysenter
+     9d9:	c3                   	ret
+
+000009da <mkdir>:
+SYSCALL(mkdir)
+     9da:	b8 14 00 00 00       	mov    $0x14,%eax
+     9df:	89 e1                	mov    %esp,%ecx
+     9e1:	ba e8 09 00 00       	mov    $0x9e8,%edx
+     9e6:	0f 34                	sysenter
+     9e8:	c3                   	ret
+
+000009e9 <chdir>:
+SYSCALL(chdir)
+     9e9:	b8 09 00 00 00       	mov    $0x9,%eax
+     9ee:	89 e1                	mov    %esp,%ecx
+     9f0:	ba f7 09 00 00       	mov    $0x9f7,%edx
+     9f5:	0f 34                	sysenter
+     9f7:	c3                   	ret
+
+000009f8 <dup>:
+SYSCALL(dup)
+     9f8:	b8 0a 00 00 00       	mov    $0xa,%eax
+     9fd:	89 e1                	mov    %esp,%ecx
+     9ff:	ba 06 0a 00 00       	mov    $0xa06,%edx
+     a04:	0f 34                	sysenter
+     a06:	c3                   	ret
+
+00000a07 <getpid>:
+SYSCALL(getpid)
+     a07:	b8 0b 00 00 00       	mov    $0xb,%eax
+     a0c:	89 e1                	mov    %esp,%ecx
+     a0e:	ba 15 0a 00 00       	mov    $0xa15,%edx
+     a13:	0f 34                	sysenter
+     a15:	c3                   	ret
+
+00000a16 <sbrk>:
+SYSCALL(sbrk)
+     a16:	b8 0c 00 00 00       	mov    $0xc,%eax
+     a1b:	89 e1                	mov    %esp,%ecx
+     a1d:	ba 24 0a 00 00       	mov    $0xa24,%edx
+     a22:	0f 34                	sysenter
+     a24:	c3                   	ret
+
+00000a25 <sleep>:
+SYSCALL(sleep)
+     a25:	b8 0d 00 00 00       	mov    $0xd,%eax
+     a2a:	89 e1                	mov    %esp,%ecx
+     a2c:	ba 33 0a 00 00       	mov    $0xa33,%edx
+     a31:	0f 34                	sysenter
+     a33:	c3                   	ret
+
+00000a34 <uptime>:
+SYSCALL(uptime)
+     a34:	b8 0e 00 00 00       	mov    $0xe,%eax
+     a39:	89 e1                	mov    %esp,%ecx
+     a3b:	ba 42 0a 00 00       	mov    $0xa42,%edx
+     a40:	0f 34                	sysenter
+     a42:	c3                   	ret
+
+00000a43 <getproc>:
+SYSCALL(getproc)
+     a43:	b8 16 00 00 00       	mov    $0x16,%eax
+     a48:	89 e1                	mov    %esp,%ecx
+     a4a:	ba 51 0a 00 00       	mov    $0xa51,%edx
+     a4f:	0f 34                	sysenter
+     a51:	c3                   	ret
+
+00000a52 <getpgs>:
+SYSCALL(getpgs)
+     a52:	b8 17 00 00 00       	mov    $0x17,%eax
+     a57:	89 e1                	mov    %esp,%ecx
+     a59:	ba 60 0a 00 00       	mov    $0xa60,%edx
+     a5e:	0f 34                	sysenter
+     a60:	c3                   	ret
+
+00000a61 <loadproc>:
+SYSCALL(loadproc)
+     a61:	b8 18 00 00 00       	mov    $0x18,%eax
+     a66:	89 e1                	mov    %esp,%ecx
+     a68:	ba 6f 0a 00 00       	mov    $0xa6f,%edx
+     a6d:	0f 34                	sysenter
+     a6f:	c3                   	ret
+
+00000a70 <iosubmit>:
+SYSCALL(iosubmit)
+     a70:	b8 19 00 00 00       	mov    $0x19,%eax
+     a75:	89 e1                	mov    %esp,%ecx
+     a77:	ba 7e 0a 00 00       	mov    $0xa7e,%edx
+     a7c:	0f 34                	sysenter
+     a7e:	c3                   	ret
+
+00000a7f <sysstat>:
+SYSCALL(sysstat)
+     a7f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     a84:	89 e1                	mov    %esp,%ecx
+     a86:	ba 8d 0a 00 00       	mov    $0xa8d,%edx
+     a8b:	0f 34                	sysenter
+     a8d:	c3                   	ret
+
+00000a8e <splice>:
+SYSCALL(splice)
+     a8e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     a93:	89 e1                	mov    %esp,%ecx
+     a95:	ba 9c 0a 00 00       	mov    $0xa9c,%edx
+     a9a:	0f 34                	sysenter
+     a9c:	c3                   	ret
+
+00000a9d <fsync>:
+SYSCALL(fsync)
+     a9d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     aa2:	89 e1                	mov    %esp,%ecx
+     aa4:	ba ab 0a 00 00       	mov    $0xaab,%edx
+     aa9:	0f 34                	sysenter
+     aab:	c3                   	ret
+
+00000aac <fdatasync>:
+SYSCALL(fdatasync)
+     aac:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     ab1:	89 e1                	mov    %esp,%ecx
+     ab3:	ba ba 0a 00 00       	mov    $0xaba,%edx
+     ab8:	0f 34                	sysenter
+     aba:	c3                   	ret
+
+00000abb <lseek>:
+SYSCALL(lseek)
+     abb:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     ac0:	89 e1                	mov    %esp,%ecx
+     ac2:	ba c9 0a 00 00       	mov    $0xac9,%edx
+     ac7:	0f 34                	sysenter
+     ac9:	c3                   	ret
+
+00000aca <dmesg>:
+SYSCALL(dmesg)
+     aca:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     acf:	89 e1                	mov    %esp,%ecx
+     ad1:	ba d8 0a 00 00       	mov    $0xad8,%edx
+     ad6:	0f 34                	sysenter
+     ad8:	c3                   	ret
+
+00000ad9 <lockstat>:
+SYSCALL(lockstat)
+     ad9:	b8 20 00 00 00       	mov    $0x20,%eax
+     ade:	89 e1                	mov    %esp,%ecx
+     ae0:	ba e7 0a 00 00       	mov    $0xae7,%edx
+     ae5:	0f 34                	sysenter
+     ae7:	c3                   	ret
+
+00000ae8 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     ae8:	55                   	push   %ebp
+     ae9:	89 e5                	mov    %esp,%ebp
+     aeb:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     aee:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     af5:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     af9:	74 17                	je     b12 <printint+0x2a>
+     afb:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     aff:	79 11                	jns    b12 <printint+0x2a>
+    neg = 1;
+     b01:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     b08:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b0b:	f7 d8                	neg    %eax
+     b0d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     b10:	eb 06                	jmp    b18 <printint+0x30>
+  } else {
+    x = xx;
+     b12:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b15:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     b18:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     b1f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     b22:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b25:	ba 00 00 00 00       	mov    $0x0,%edx
+     b2a:	f7 f1                	div    %ecx
+     b2c:	89 d1                	mov    %edx,%ecx
+     b2e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b31:	8d 50 01             	lea    0x1(%eax),%edx
+     b34:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     b37:	0f b6 91 14 1c 00 00 	movzbl 0x1c14(%ecx),%edx
+     b3e:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     b42:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     b45:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b48:	ba 00 00 00 00       	mov    $0x0,%edx
+     b4d:	f7 f1                	div    %ecx
+     b4f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     b52:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     b56:	75 c7                	jne    b1f <printint+0x37>
+  if(neg)
+     b58:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     b5c:	74 2d                	je     b8b <printint+0xa3>
+    buf[i++] = '-';
+     b5e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b61:	8d 50 01             	lea    0x1(%eax),%edx
+     b64:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     b67:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+     b6c:	eb 1d                	jmp    b8b <printint+0xa3>
+    fputc(fd, buf[i]);
+     b6e:	8d 55 dc             	lea    -0x24(%ebp),%edx
+     b71:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b74:	01 d0                	add    %edx,%eax
+     b76:	0f b6 00             	movzbl (%eax),%eax
+     b79:	0f be c0             	movsbl %al,%eax
+     b7c:	83 ec 08             	sub    $0x8,%esp
+     b7f:	50                   	push   %eax
+     b80:	ff 75 08             	push   0x8(%ebp)
+     b83:	e8 f8 08 00 00       	call   1480 <fputc>
+     b88:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+     b8b:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     b8f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     b93:	79 d9                	jns    b6e <printint+0x86>
+}
+     b95:	90                   	nop
+     b96:	90                   	nop
+     b97:	c9                   	leave
+     b98:	c3                   	ret
+
+00000b99 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     b99:	55                   	push   %ebp
+     b9a:	89 e5                	mov    %esp,%ebp
+     b9c:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+     b9f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     ba6:	8d 45 0c             	lea    0xc(%ebp),%eax
+     ba9:	83 c0 04             	add    $0x4,%eax
+     bac:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+     baf:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     bb6:	e9 4a 01 00 00       	jmp    d05 <printf+0x16c>
+    c = fmt[i] & 0xff;
+     bbb:	8b 55 0c             	mov    0xc(%ebp),%edx
+     bbe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bc1:	01 d0                	add    %edx,%eax
+     bc3:	0f b6 00             	movzbl (%eax),%eax
+     bc6:	0f be c0             	movsbl %al,%eax
+     bc9:	25 ff 00 00 00       	and    $0xff,%eax
+     bce:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+     bd1:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     bd5:	75 28                	jne    bff <printf+0x66>
+      if(c == '%'){
+     bd7:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     bdb:	75 0c                	jne    be9 <printf+0x50>
+        state = '%';
+     bdd:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+     be4:	e9 18 01 00 00       	jmp    d01 <printf+0x168>
+      } else {
+        fputc(fd, c);
+     be9:	83 ec 08             	sub    $0x8,%esp
+     bec:	ff 75 e4             	push   -0x1c(%ebp)
+     bef:	ff 75 08             	push   0x8(%ebp)
+     bf2:	e8 89 08 00 00       	call   1480 <fputc>
+     bf7:	83 c4 10             	add    $0x10,%esp
+     bfa:	e9 02 01 00 00       	jmp    d01 <printf+0x168>
+      }
+    } else if(state == '%'){
+     bff:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+     c03:	0f 85 f8 00 00 00    	jne    d01 <printf+0x168>
+      if(c == 'd'){
+     c09:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+     c0d:	75 1e                	jne    c2d <printf+0x94>
+        printint(fd, *ap, 10, 1);
+     c0f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c12:	8b 00                	mov    (%eax),%eax
+     c14:	6a 01                	push   $0x1
+     c16:	6a 0a                	push   $0xa
+     c18:	50                   	push   %eax
+     c19:	ff 75 08             	push   0x8(%ebp)
+     c1c:	e8 c7 fe ff ff       	call   ae8 <printint>
+     c21:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     c24:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     c28:	e9 cd 00 00 00       	jmp    cfa <printf+0x161>
+      } else if(c == 'x' || c == 'p'){
+     c2d:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+     c31:	74 06                	je     c39 <printf+0xa0>
+     c33:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+     c37:	75 1e                	jne    c57 <printf+0xbe>
+        printint(fd, *ap, 16, 0);
+     c39:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c3c:	8b 00                	mov    (%eax),%eax
+     c3e:	6a 00                	push   $0x0
+     c40:	6a 10                	push   $0x10
+     c42:	50                   	push   %eax
+     c43:	ff 75 08             	push   0x8(%ebp)
+     c46:	e8 9d fe ff ff       	call   ae8 <printint>
+     c4b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     c4e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     c52:	e9 a3 00 00 00       	jmp    cfa <printf+0x161>
+      } else if(c == 's'){
+     c57:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+     c5b:	75 43                	jne    ca0 <printf+0x107>
+        s = (char*)*ap;
+     c5d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c60:	8b 00                	mov    (%eax),%eax
+     c62:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     c65:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+     c69:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     c6d:	75 25                	jne    c94 <printf+0xfb>
+          s = "(null)";
+     c6f:	c7 45 f4 e6 16 00 00 	movl   $0x16e6,-0xc(%ebp)
+        while(*s != 0){
+     c76:	eb 1c                	jmp    c94 <printf+0xfb>
+          fputc(fd, *s);
+     c78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c7b:	0f b6 00             	movzbl (%eax),%eax
+     c7e:	0f be c0             	movsbl %al,%eax
+     c81:	83 ec 08             	sub    $0x8,%esp
+     c84:	50                   	push   %eax
+     c85:	ff 75 08             	push   0x8(%ebp)
+     c88:	e8 f3 07 00 00       	call   1480 <fputc>
+     c8d:	83 c4 10             	add    $0x10,%esp
+          s++;
+     c90:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+     c94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c97:	0f b6 00             	movzbl (%eax),%eax
+     c9a:	84 c0                	test   %al,%al
+     c9c:	75 da                	jne    c78 <printf+0xdf>
+     c9e:	eb 5a                	jmp    cfa <printf+0x161>
+        }
+      } else if(c == 'c'){
+     ca0:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+     ca4:	75 1a                	jne    cc0 <printf+0x127>
+        fputc(fd, *ap);
+     ca6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     ca9:	8b 00                	mov    (%eax),%eax
+     cab:	83 ec 08             	sub    $0x8,%esp
+     cae:	50                   	push   %eax
+     caf:	ff 75 08             	push   0x8(%ebp)
+     cb2:	e8 c9 07 00 00       	call   1480 <fputc>
+     cb7:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     cba:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     cbe:	eb 3a                	jmp    cfa <printf+0x161>
+      } else if(c == '%'){
+     cc0:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     cc4:	75 13                	jne    cd9 <printf+0x140>
+        fputc(fd, c);
+     cc6:	83 ec 08             	sub    $0x8,%esp
+     cc9:	ff 75 e4             	push   -0x1c(%ebp)
+     ccc:	ff 75 08             	push   0x8(%ebp)
+     ccf:	e8 ac 07 00 00       	call   1480 <fputc>
+     cd4:	83 c4 10             	add    $0x10,%esp
+     cd7:	eb 21                	jmp    cfa <printf+0x161>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        fputc(fd, '%');
+     cd9:	83 ec 08             	sub    $0x8,%esp
+     cdc:	6a 25                	push   $0x25
+     cde:	ff 75 08             	push   0x8(%ebp)
+     ce1:	e8 9a 07 00 00       	call   1480 <fputc>
+     ce6:	83 c4 10             	add    $0x10,%esp
+        fputc(fd, c);
+     ce9:	83 ec 08             	sub    $0x8,%esp
+     cec:	ff 75 e4             	push   -0x1c(%ebp)
+     cef:	ff 75 08             	push   0x8(%ebp)
+     cf2:	e8 89 07 00 00       	call   1480 <fputc>
+     cf7:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     cfa:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     d01:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     d05:	8b 55 0c             	mov    0xc(%ebp),%edx
+     d08:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d0b:	01 d0                	add    %edx,%eax
+     d0d:	0f b6 00             	movzbl (%eax),%eax
+     d10:	84 c0                	test   %al,%al
+     d12:	0f 85 a3 fe ff ff    	jne    bbb <printf+0x22>
+    }
+  }
+}
+     d18:	90                   	nop
+     d19:	90                   	nop
+     d1a:	c9                   	leave
+     d1b:	c3                   	ret
+
+00000d1c <binof>:
+static struct chunk *bins[NBIN];       // free large chunks
+static struct chunk *top;              // end marker of newest heap segment
+
+static int
+binof(uint size)
+{
+     d1c:	55                   	push   %ebp
+     d1d:	89 e5                	mov    %esp,%ebp
+     d1f:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  i = 0;
+     d22:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     d29:	c1 6d 08 05          	shrl   $0x5,0x8(%ebp)
+     d2d:	eb 07                	jmp    d36 <binof+0x1a>
+    i++;
+     d2f:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     d33:	d1 6d 08             	shrl   0x8(%ebp)
+     d36:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     d3a:	74 06                	je     d42 <binof+0x26>
+     d3c:	83 7d fc 19          	cmpl   $0x19,-0x4(%ebp)
+     d40:	7e ed                	jle    d2f <binof+0x13>
+  return i;
+     d42:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     d45:	c9                   	leave
+     d46:	c3                   	ret
+
+00000d47 <bininsert>:
+
+static void
+bininsert(struct chunk *c)
+{
+     d47:	55                   	push   %ebp
+     d48:	89 e5                	mov    %esp,%ebp
+     d4a:	83 ec 10             	sub    $0x10,%esp
+  struct chunk **b;
+
+  b = &bins[binof(CSIZE(c))];
+     d4d:	8b 45 08             	mov    0x8(%ebp),%eax
+     d50:	8b 00                	mov    (%eax),%eax
+     d52:	83 e0 f8             	and    $0xfffffff8,%eax
+     d55:	50                   	push   %eax
+     d56:	e8 c1 ff ff ff       	call   d1c <binof>
+     d5b:	83 c4 04             	add    $0x4,%esp
+     d5e:	c1 e0 02             	shl    $0x2,%eax
+     d61:	05 60 20 00 00       	add    $0x2060,%eax
+     d66:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c->prev = 0;
+     d69:	8b 45 08             	mov    0x8(%ebp),%eax
+     d6c:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  c->next = *b;
+     d73:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d76:	8b 10                	mov    (%eax),%edx
+     d78:	8b 45 08             	mov    0x8(%ebp),%eax
+     d7b:	89 50 08             	mov    %edx,0x8(%eax)
+  if(*b)
+     d7e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d81:	8b 00                	mov    (%eax),%eax
+     d83:	85 c0                	test   %eax,%eax
+     d85:	74 0b                	je     d92 <bininsert+0x4b>
+    (*b)->prev = c;
+     d87:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d8a:	8b 00                	mov    (%eax),%eax
+     d8c:	8b 55 08             	mov    0x8(%ebp),%edx
+     d8f:	89 50 0c             	mov    %edx,0xc(%eax)
+  *b = c;
+     d92:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d95:	8b 55 08             	mov    0x8(%ebp),%edx
+     d98:	89 10                	mov    %edx,(%eax)
+}
+     d9a:	90                   	nop
+     d9b:	c9                   	leave
+     d9c:	c3                   	ret
+
+00000d9d <binremove>:
+
+static void
+binremove(struct chunk *c)
+{
+     d9d:	55                   	push   %ebp
+     d9e:	89 e5                	mov    %esp,%ebp
+  if(c->prev)
+     da0:	8b 45 08             	mov    0x8(%ebp),%eax
+     da3:	8b 40 0c             	mov    0xc(%eax),%eax
+     da6:	85 c0                	test   %eax,%eax
+     da8:	74 11                	je     dbb <binremove+0x1e>
+    c->prev->next = c->next;
+     daa:	8b 45 08             	mov    0x8(%ebp),%eax
+     dad:	8b 40 0c             	mov    0xc(%eax),%eax
+     db0:	8b 55 08             	mov    0x8(%ebp),%edx
+     db3:	8b 52 08             	mov    0x8(%edx),%edx
+     db6:	89 50 08             	mov    %edx,0x8(%eax)
+     db9:	eb 1e                	jmp    dd9 <binremove+0x3c>
+  else
+    bins[binof(CSIZE(c))] = c->next;
+     dbb:	8b 45 08             	mov    0x8(%ebp),%eax
+     dbe:	8b 00                	mov    (%eax),%eax
+     dc0:	83 e0 f8             	and    $0xfffffff8,%eax
+     dc3:	50                   	push   %eax
+     dc4:	e8 53 ff ff ff       	call   d1c <binof>
+     dc9:	83 c4 04             	add    $0x4,%esp
+     dcc:	8b 55 08             	mov    0x8(%ebp),%edx
+     dcf:	8b 52 08             	mov    0x8(%edx),%edx
+     dd2:	89 14 85 60 20 00 00 	mov    %edx,0x2060(,%eax,4)
+  if(c->next)
+     dd9:	8b 45 08             	mov    0x8(%ebp),%eax
+     ddc:	8b 40 08             	mov    0x8(%eax),%eax
+     ddf:	85 c0                	test   %eax,%eax
+     de1:	74 0f                	je     df2 <binremove+0x55>
+    c->next->prev = c->prev;
+     de3:	8b 45 08             	mov    0x8(%ebp),%eax
+     de6:	8b 40 08             	mov    0x8(%eax),%eax
+     de9:	8b 55 08             	mov    0x8(%ebp),%edx
+     dec:	8b 52 0c             	mov    0xc(%edx),%edx
+     def:	89 50 0c             	mov    %edx,0xc(%eax)
+}
+     df2:	90                   	nop
+     df3:	c9                   	leave
+     df4:	c3                   	ret
+
+00000df5 <freechunk>:
+
+// Free chunk c, merging it with free neighbors.  If trim is
+// set and the result is big and at the break, give it back.
+static void
+freechunk(struct chunk *c, int trim)
+{
+     df5:	55                   	push   %ebp
+     df6:	89 e5                	mov    %esp,%ebp
+     df8:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *p, *n;
+  uint size;
+
+  size = CSIZE(c);
+     dfb:	8b 45 08             	mov    0x8(%ebp),%eax
+     dfe:	8b 00                	mov    (%eax),%eax
+     e00:	83 e0 f8             	and    $0xfffffff8,%eax
+     e03:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  n = NEXTC(c);
+     e06:	8b 45 08             	mov    0x8(%ebp),%eax
+     e09:	8b 00                	mov    (%eax),%eax
+     e0b:	83 e0 f8             	and    $0xfffffff8,%eax
+     e0e:	89 c2                	mov    %eax,%edx
+     e10:	8b 45 08             	mov    0x8(%ebp),%eax
+     e13:	01 d0                	add    %edx,%eax
+     e15:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(!(c->size & PREVUSED)){
+     e18:	8b 45 08             	mov    0x8(%ebp),%eax
+     e1b:	8b 00                	mov    (%eax),%eax
+     e1d:	83 e0 02             	and    $0x2,%eax
+     e20:	85 c0                	test   %eax,%eax
+     e22:	75 30                	jne    e54 <freechunk+0x5f>
+    p = (struct chunk*)((char*)c - *((uint*)c - 1));
+     e24:	8b 45 08             	mov    0x8(%ebp),%eax
+     e27:	83 e8 04             	sub    $0x4,%eax
+     e2a:	8b 00                	mov    (%eax),%eax
+     e2c:	f7 d8                	neg    %eax
+     e2e:	89 c2                	mov    %eax,%edx
+     e30:	8b 45 08             	mov    0x8(%ebp),%eax
+     e33:	01 d0                	add    %edx,%eax
+     e35:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    binremove(p);
+     e38:	ff 75 ec             	push   -0x14(%ebp)
+     e3b:	e8 5d ff ff ff       	call   d9d <binremove>
+     e40:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(p);
+     e43:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     e46:	8b 00                	mov    (%eax),%eax
+     e48:	83 e0 f8             	and    $0xfffffff8,%eax
+     e4b:	01 45 f4             	add    %eax,-0xc(%ebp)
+    c = p;
+     e4e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     e51:	89 45 08             	mov    %eax,0x8(%ebp)
+  }
+  if(!(n->size & USED)){
+     e54:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e57:	8b 00                	mov    (%eax),%eax
+     e59:	83 e0 01             	and    $0x1,%eax
+     e5c:	85 c0                	test   %eax,%eax
+     e5e:	75 16                	jne    e76 <freechunk+0x81>
+    binremove(n);
+     e60:	ff 75 f0             	push   -0x10(%ebp)
+     e63:	e8 35 ff ff ff       	call   d9d <binremove>
+     e68:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(n);
+     e6b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e6e:	8b 00                	mov    (%eax),%eax
+     e70:	83 e0 f8             	and    $0xfffffff8,%eax
+     e73:	01 45 f4             	add    %eax,-0xc(%ebp)
+  }
+  // Free chunks are never adjacent, so the one below is in use.
+  c->size = size | PREVUSED;
+     e76:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e79:	83 c8 02             	or     $0x2,%eax
+     e7c:	89 c2                	mov    %eax,%edx
+     e7e:	8b 45 08             	mov    0x8(%ebp),%eax
+     e81:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+     e83:	8b 45 08             	mov    0x8(%ebp),%eax
+     e86:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  FOOTER(c) = size;
+     e8d:	8b 45 08             	mov    0x8(%ebp),%eax
+     e90:	8b 00                	mov    (%eax),%eax
+     e92:	83 e0 f8             	and    $0xfffffff8,%eax
+     e95:	8d 50 fc             	lea    -0x4(%eax),%edx
+     e98:	8b 45 08             	mov    0x8(%ebp),%eax
+     e9b:	01 c2                	add    %eax,%edx
+     e9d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ea0:	89 02                	mov    %eax,(%edx)
+  n = NEXTC(c);
+     ea2:	8b 45 08             	mov    0x8(%ebp),%eax
+     ea5:	8b 00                	mov    (%eax),%eax
+     ea7:	83 e0 f8             	and    $0xfffffff8,%eax
+     eaa:	89 c2                	mov    %eax,%edx
+     eac:	8b 45 08             	mov    0x8(%ebp),%eax
+     eaf:	01 d0                	add    %edx,%eax
+     eb1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  n->size &= ~PREVUSED;
+     eb4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     eb7:	8b 00                	mov    (%eax),%eax
+     eb9:	83 e0 fd             	and    $0xfffffffd,%eax
+     ebc:	89 c2                	mov    %eax,%edx
+     ebe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ec1:	89 10                	mov    %edx,(%eax)
+
+  if(trim && n == top && size >= TRIMSIZE && sbrk(0) == (char*)top + HDRSIZE){
+     ec3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     ec7:	74 51                	je     f1a <freechunk+0x125>
+     ec9:	a1 cc 20 00 00       	mov    0x20cc,%eax
+     ece:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     ed1:	75 47                	jne    f1a <freechunk+0x125>
+     ed3:	81 7d f4 ff 7f 00 00 	cmpl   $0x7fff,-0xc(%ebp)
+     eda:	76 3e                	jbe    f1a <freechunk+0x125>
+     edc:	83 ec 0c             	sub    $0xc,%esp
+     edf:	6a 00                	push   $0x0
+     ee1:	e8 30 fb ff ff       	call   a16 <sbrk>
+     ee6:	83 c4 10             	add    $0x10,%esp
+     ee9:	8b 15 cc 20 00 00    	mov    0x20cc,%edx
+     eef:	83 c2 08             	add    $0x8,%edx
+     ef2:	39 d0                	cmp    %edx,%eax
+     ef4:	75 24                	jne    f1a <freechunk+0x125>
+    c->size = USED | PREVUSED;
+     ef6:	8b 45 08             	mov    0x8(%ebp),%eax
+     ef9:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+    top = c;
+     eff:	8b 45 08             	mov    0x8(%ebp),%eax
+     f02:	a3 cc 20 00 00       	mov    %eax,0x20cc
+    sbrk(-size);
+     f07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f0a:	f7 d8                	neg    %eax
+     f0c:	83 ec 0c             	sub    $0xc,%esp
+     f0f:	50                   	push   %eax
+     f10:	e8 01 fb ff ff       	call   a16 <sbrk>
+     f15:	83 c4 10             	add    $0x10,%esp
+    return;
+     f18:	eb 0e                	jmp    f28 <freechunk+0x133>
+  }
+  bininsert(c);
+     f1a:	83 ec 0c             	sub    $0xc,%esp
+     f1d:	ff 75 08             	push   0x8(%ebp)
+     f20:	e8 22 fe ff ff       	call   d47 <bininsert>
+     f25:	83 c4 10             	add    $0x10,%esp
+}
+     f28:	c9                   	leave
+     f29:	c3                   	ret
+
+00000f2a <morecore>:
+
+// Grow the heap by at least need bytes.
+static int
+morecore(uint need)
+{
+     f2a:	55                   	push   %ebp
+     f2b:	89 e5                	mov    %esp,%ebp
+     f2d:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+  char *p;
+  uint n, pad;
+
+  n = need + MINCHUNK;
+     f30:	8b 45 08             	mov    0x8(%ebp),%eax
+     f33:	83 c0 18             	add    $0x18,%eax
+     f36:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(n < MINCORE)
+     f39:	81 7d ec ff 3f 00 00 	cmpl   $0x3fff,-0x14(%ebp)
+     f40:	77 07                	ja     f49 <morecore+0x1f>
+    n = MINCORE;
+     f42:	c7 45 ec 00 40 00 00 	movl   $0x4000,-0x14(%ebp)
+  // Keep the break 8-aligned, with the end marker just below it.
+  pad = (8 - ((uint)sbrk(0) & 7)) & 7;
+     f49:	83 ec 0c             	sub    $0xc,%esp
+     f4c:	6a 00                	push   $0x0
+     f4e:	e8 c3 fa ff ff       	call   a16 <sbrk>
+     f53:	83 c4 10             	add    $0x10,%esp
+     f56:	83 e0 07             	and    $0x7,%eax
+     f59:	ba 08 00 00 00       	mov    $0x8,%edx
+     f5e:	29 c2                	sub    %eax,%edx
+     f60:	89 d0                	mov    %edx,%eax
+     f62:	83 e0 07             	and    $0x7,%eax
+     f65:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if((p = sbrk(pad + n)) == (char*)-1){
+     f68:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     f6b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f6e:	01 d0                	add    %edx,%eax
+     f70:	83 ec 0c             	sub    $0xc,%esp
+     f73:	50                   	push   %eax
+     f74:	e8 9d fa ff ff       	call   a16 <sbrk>
+     f79:	83 c4 10             	add    $0x10,%esp
+     f7c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f7f:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     f83:	75 30                	jne    fb5 <morecore+0x8b>
+    n = need + MINCHUNK;
+     f85:	8b 45 08             	mov    0x8(%ebp),%eax
+     f88:	83 c0 18             	add    $0x18,%eax
+     f8b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((p = sbrk(pad + n)) == (char*)-1)
+     f8e:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     f91:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f94:	01 d0                	add    %edx,%eax
+     f96:	83 ec 0c             	sub    $0xc,%esp
+     f99:	50                   	push   %eax
+     f9a:	e8 77 fa ff ff       	call   a16 <sbrk>
+     f9f:	83 c4 10             	add    $0x10,%esp
+     fa2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     fa5:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     fa9:	75 0a                	jne    fb5 <morecore+0x8b>
+      return -1;
+     fab:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     fb0:	e9 8e 00 00 00       	jmp    1043 <morecore+0x119>
+  }
+  p += pad;
+     fb5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     fb8:	01 45 f0             	add    %eax,-0x10(%ebp)
+  if(top && p == (char*)top + HDRSIZE){
+     fbb:	a1 cc 20 00 00       	mov    0x20cc,%eax
+     fc0:	85 c0                	test   %eax,%eax
+     fc2:	74 29                	je     fed <morecore+0xc3>
+     fc4:	a1 cc 20 00 00       	mov    0x20cc,%eax
+     fc9:	83 c0 08             	add    $0x8,%eax
+     fcc:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     fcf:	75 1c                	jne    fed <morecore+0xc3>
+    // Contiguous: the old end marker heads the new chunk.
+    c = top;
+     fd1:	a1 cc 20 00 00       	mov    0x20cc,%eax
+     fd6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = n | (c->size & PREVUSED);
+     fd9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fdc:	8b 00                	mov    (%eax),%eax
+     fde:	83 e0 02             	and    $0x2,%eax
+     fe1:	0b 45 ec             	or     -0x14(%ebp),%eax
+     fe4:	89 c2                	mov    %eax,%edx
+     fe6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fe9:	89 10                	mov    %edx,(%eax)
+     feb:	eb 16                	jmp    1003 <morecore+0xd9>
+  } else {
+    // Someone else moved the break: start a new segment.
+    c = (struct chunk*)p;
+     fed:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ff0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = (n - HDRSIZE) | PREVUSED;
+     ff3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     ff6:	83 e8 08             	sub    $0x8,%eax
+     ff9:	83 c8 02             	or     $0x2,%eax
+     ffc:	89 c2                	mov    %eax,%edx
+     ffe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1001:	89 10                	mov    %edx,(%eax)
+  }
+  top = NEXTC(c);
+    1003:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1006:	8b 00                	mov    (%eax),%eax
+    1008:	83 e0 f8             	and    $0xfffffff8,%eax
+    100b:	89 c2                	mov    %eax,%edx
+    100d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1010:	01 d0                	add    %edx,%eax
+    1012:	a3 cc 20 00 00       	mov    %eax,0x20cc
+  top->size = USED;
+    1017:	a1 cc 20 00 00       	mov    0x20cc,%eax
+    101c:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  top->tag = LARGE;
+    1022:	a1 cc 20 00 00       	mov    0x20cc,%eax
+    1027:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  freechunk(c, 0);
+    102e:	83 ec 08             	sub    $0x8,%esp
+    1031:	6a 00                	push   $0x0
+    1033:	ff 75 f4             	push   -0xc(%ebp)
+    1036:	e8 ba fd ff ff       	call   df5 <freechunk>
+    103b:	83 c4 10             	add    $0x10,%esp
+  return 0;
+    103e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1043:	c9                   	leave
+    1044:	c3                   	ret
+
+00001045 <largealloc>:
+
+static void*
+largealloc(uint nbytes)
+{
+    1045:	55                   	push   %ebp
+    1046:	89 e5                	mov    %esp,%ebp
+    1048:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c, *r;
+  uint need;
+  int i;
+
+  if(nbytes > 0x7fffffff)
+    104b:	8b 45 08             	mov    0x8(%ebp),%eax
+    104e:	85 c0                	test   %eax,%eax
+    1050:	79 0a                	jns    105c <largealloc+0x17>
+    return 0;
+    1052:	b8 00 00 00 00       	mov    $0x0,%eax
+    1057:	e9 43 01 00 00       	jmp    119f <largealloc+0x15a>
+  need = (nbytes + HDRSIZE + 7) & ~7;
+    105c:	8b 45 08             	mov    0x8(%ebp),%eax
+    105f:	83 c0 0f             	add    $0xf,%eax
+    1062:	83 e0 f8             	and    $0xfffffff8,%eax
+    1065:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(need < MINCHUNK)
+    1068:	83 7d f0 17          	cmpl   $0x17,-0x10(%ebp)
+    106c:	77 07                	ja     1075 <largealloc+0x30>
+    need = MINCHUNK;
+    106e:	c7 45 f0 18 00 00 00 	movl   $0x18,-0x10(%ebp)
+  for(;;){
+    for(i = binof(need); i < NBIN; i++)
+    1075:	ff 75 f0             	push   -0x10(%ebp)
+    1078:	e8 9f fc ff ff       	call   d1c <binof>
+    107d:	83 c4 04             	add    $0x4,%esp
+    1080:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1083:	eb 2f                	jmp    10b4 <largealloc+0x6f>
+      for(c = bins[i]; c; c = c->next)
+    1085:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1088:	8b 04 85 60 20 00 00 	mov    0x2060(,%eax,4),%eax
+    108f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1092:	eb 16                	jmp    10aa <largealloc+0x65>
+        if(CSIZE(c) >= need)
+    1094:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1097:	8b 00                	mov    (%eax),%eax
+    1099:	83 e0 f8             	and    $0xfffffff8,%eax
+    109c:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+    109f:	73 35                	jae    10d6 <largealloc+0x91>
+      for(c = bins[i]; c; c = c->next)
+    10a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10a4:	8b 40 08             	mov    0x8(%eax),%eax
+    10a7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    10aa:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    10ae:	75 e4                	jne    1094 <largealloc+0x4f>
+    for(i = binof(need); i < NBIN; i++)
+    10b0:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    10b4:	83 7d ec 1a          	cmpl   $0x1a,-0x14(%ebp)
+    10b8:	7e cb                	jle    1085 <largealloc+0x40>
+          goto found;
+    if(morecore(need) < 0)
+    10ba:	83 ec 0c             	sub    $0xc,%esp
+    10bd:	ff 75 f0             	push   -0x10(%ebp)
+    10c0:	e8 65 fe ff ff       	call   f2a <morecore>
+    10c5:	83 c4 10             	add    $0x10,%esp
+    10c8:	85 c0                	test   %eax,%eax
+    10ca:	79 a9                	jns    1075 <largealloc+0x30>
+      return 0;
+    10cc:	b8 00 00 00 00       	mov    $0x0,%eax
+    10d1:	e9 c9 00 00 00       	jmp    119f <largealloc+0x15a>
+          goto found;
+    10d6:	90                   	nop
+  }
+
+found:
+  binremove(c);
+    10d7:	83 ec 0c             	sub    $0xc,%esp
+    10da:	ff 75 f4             	push   -0xc(%ebp)
+    10dd:	e8 bb fc ff ff       	call   d9d <binremove>
+    10e2:	83 c4 10             	add    $0x10,%esp
+  if(CSIZE(c) - need >= MINCHUNK){
+    10e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10e8:	8b 00                	mov    (%eax),%eax
+    10ea:	83 e0 f8             	and    $0xfffffff8,%eax
+    10ed:	2b 45 f0             	sub    -0x10(%ebp),%eax
+    10f0:	83 f8 17             	cmp    $0x17,%eax
+    10f3:	76 66                	jbe    115b <largealloc+0x116>
+    r = (struct chunk*)((char*)c + need);
+    10f5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    10f8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    10fb:	01 d0                	add    %edx,%eax
+    10fd:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    r->size = (CSIZE(c) - need) | PREVUSED;
+    1100:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1103:	8b 00                	mov    (%eax),%eax
+    1105:	83 e0 f8             	and    $0xfffffff8,%eax
+    1108:	2b 45 f0             	sub    -0x10(%ebp),%eax
+    110b:	83 c8 02             	or     $0x2,%eax
+    110e:	89 c2                	mov    %eax,%edx
+    1110:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1113:	89 10                	mov    %edx,(%eax)
+    r->tag = LARGE;
+    1115:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1118:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+    FOOTER(r) = CSIZE(r);
+    111f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1122:	8b 10                	mov    (%eax),%edx
+    1124:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1127:	8b 00                	mov    (%eax),%eax
+    1129:	83 e0 f8             	and    $0xfffffff8,%eax
+    112c:	8d 48 fc             	lea    -0x4(%eax),%ecx
+    112f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1132:	01 c8                	add    %ecx,%eax
+    1134:	83 e2 f8             	and    $0xfffffff8,%edx
+    1137:	89 10                	mov    %edx,(%eax)
+    bininsert(r);
+    1139:	83 ec 0c             	sub    $0xc,%esp
+    113c:	ff 75 e8             	push   -0x18(%ebp)
+    113f:	e8 03 fc ff ff       	call   d47 <bininsert>
+    1144:	83 c4 10             	add    $0x10,%esp
+    c->size = need | (c->size & PREVUSED);
+    1147:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    114a:	8b 00                	mov    (%eax),%eax
+    114c:	83 e0 02             	and    $0x2,%eax
+    114f:	0b 45 f0             	or     -0x10(%ebp),%eax
+    1152:	89 c2                	mov    %eax,%edx
+    1154:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1157:	89 10                	mov    %edx,(%eax)
+    1159:	eb 25                	jmp    1180 <largealloc+0x13b>
+  } else
+    NEXTC(c)->size |= PREVUSED;
+    115b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    115e:	8b 00                	mov    (%eax),%eax
+    1160:	83 e0 f8             	and    $0xfffffff8,%eax
+    1163:	89 c2                	mov    %eax,%edx
+    1165:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1168:	01 d0                	add    %edx,%eax
+    116a:	8b 10                	mov    (%eax),%edx
+    116c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    116f:	8b 00                	mov    (%eax),%eax
+    1171:	83 e0 f8             	and    $0xfffffff8,%eax
+    1174:	89 c1                	mov    %eax,%ecx
+    1176:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1179:	01 c8                	add    %ecx,%eax
+    117b:	83 ca 02             	or     $0x2,%edx
+    117e:	89 10                	mov    %edx,(%eax)
+  c->size |= USED;
+    1180:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1183:	8b 00                	mov    (%eax),%eax
+    1185:	83 c8 01             	or     $0x1,%eax
+    1188:	89 c2                	mov    %eax,%edx
+    118a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    118d:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+    118f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1192:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  return (char*)c + HDRSIZE;
+    1199:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    119c:	83 c0 08             	add    $0x8,%eax
+}
+    119f:	c9                   	leave
+    11a0:	c3                   	ret
+
+000011a1 <refill>:
+
+// Carve a slab into free blocks of class k.
+static int
+refill(int k)
+{
+    11a1:	55                   	push   %ebp
+    11a2:	89 e5                	mov    %esp,%ebp
+    11a4:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  char *p;
+  uint bs, i;
+
+  if((p = largealloc(SLABSIZE)) == 0)
+    11a7:	83 ec 0c             	sub    $0xc,%esp
+    11aa:	68 00 20 00 00       	push   $0x2000
+    11af:	e8 91 fe ff ff       	call   1045 <largealloc>
+    11b4:	83 c4 10             	add    $0x10,%esp
+    11b7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    11ba:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    11be:	75 07                	jne    11c7 <refill+0x26>
+    return -1;
+    11c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    11c5:	eb 75                	jmp    123c <refill+0x9b>
+  bs = HDRSIZE + (MINSMALL << k);
+    11c7:	8b 45 08             	mov    0x8(%ebp),%eax
+    11ca:	ba 10 00 00 00       	mov    $0x10,%edx
+    11cf:	89 c1                	mov    %eax,%ecx
+    11d1:	d3 e2                	shl    %cl,%edx
+    11d3:	89 d0                	mov    %edx,%eax
+    11d5:	83 c0 08             	add    $0x8,%eax
+    11d8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+    11db:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    11e2:	eb 44                	jmp    1228 <refill+0x87>
+    b = (struct chunk*)(p + i);
+    11e4:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    11e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11ea:	01 d0                	add    %edx,%eax
+    11ec:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    b->size = bs | USED;
+    11ef:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    11f2:	83 c8 01             	or     $0x1,%eax
+    11f5:	89 c2                	mov    %eax,%edx
+    11f7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    11fa:	89 10                	mov    %edx,(%eax)
+    b->tag = k;
+    11fc:	8b 55 08             	mov    0x8(%ebp),%edx
+    11ff:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1202:	89 50 04             	mov    %edx,0x4(%eax)
+    b->next = classes[k];
+    1205:	8b 45 08             	mov    0x8(%ebp),%eax
+    1208:	8b 14 85 40 20 00 00 	mov    0x2040(,%eax,4),%edx
+    120f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1212:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[k] = b;
+    1215:	8b 45 08             	mov    0x8(%ebp),%eax
+    1218:	8b 55 e8             	mov    -0x18(%ebp),%edx
+    121b:	89 14 85 40 20 00 00 	mov    %edx,0x2040(,%eax,4)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+    1222:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1225:	01 45 f4             	add    %eax,-0xc(%ebp)
+    1228:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    122b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    122e:	01 d0                	add    %edx,%eax
+    1230:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    1235:	76 ad                	jbe    11e4 <refill+0x43>
+  }
+  return 0;
+    1237:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    123c:	c9                   	leave
+    123d:	c3                   	ret
+
+0000123e <free>:
+
+void
+free(void *ap)
+{
+    123e:	55                   	push   %ebp
+    123f:	89 e5                	mov    %esp,%ebp
+    1241:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+
+  if(ap == 0)
+    1244:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1248:	74 4b                	je     1295 <free+0x57>
+    return;
+  c = (struct chunk*)((char*)ap - HDRSIZE);
+    124a:	8b 45 08             	mov    0x8(%ebp),%eax
+    124d:	83 e8 08             	sub    $0x8,%eax
+    1250:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(c->tag != LARGE){
+    1253:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1256:	8b 40 04             	mov    0x4(%eax),%eax
+    1259:	83 f8 ff             	cmp    $0xffffffff,%eax
+    125c:	74 25                	je     1283 <free+0x45>
+    c->next = classes[c->tag];
+    125e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1261:	8b 40 04             	mov    0x4(%eax),%eax
+    1264:	8b 14 85 40 20 00 00 	mov    0x2040(,%eax,4),%edx
+    126b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    126e:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[c->tag] = c;
+    1271:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1274:	8b 40 04             	mov    0x4(%eax),%eax
+    1277:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    127a:	89 14 85 40 20 00 00 	mov    %edx,0x2040(,%eax,4)
+    return;
+    1281:	eb 13                	jmp    1296 <free+0x58>
+  }
+  freechunk(c, 1);
+    1283:	83 ec 08             	sub    $0x8,%esp
+    1286:	6a 01                	push   $0x1
+    1288:	ff 75 f4             	push   -0xc(%ebp)
+    128b:	e8 65 fb ff ff       	call   df5 <freechunk>
+    1290:	83 c4 10             	add    $0x10,%esp
+    1293:	eb 01                	jmp    1296 <free+0x58>
+    return;
+    1295:	90                   	nop
+}
+    1296:	c9                   	leave
+    1297:	c3                   	ret
+
+00001298 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1298:	55                   	push   %ebp
+    1299:	89 e5                	mov    %esp,%ebp
+    129b:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  int k;
+
+  if(nbytes > MAXSMALL)
+    129e:	81 7d 08 00 08 00 00 	cmpl   $0x800,0x8(%ebp)
+    12a5:	76 10                	jbe    12b7 <malloc+0x1f>
+    return largealloc(nbytes);
+    12a7:	83 ec 0c             	sub    $0xc,%esp
+    12aa:	ff 75 08             	push   0x8(%ebp)
+    12ad:	e8 93 fd ff ff       	call   1045 <largealloc>
+    12b2:	83 c4 10             	add    $0x10,%esp
+    12b5:	eb 6a                	jmp    1321 <malloc+0x89>
+  for(k = 0; (MINSMALL << k) < nbytes; k++)
+    12b7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    12be:	eb 04                	jmp    12c4 <malloc+0x2c>
+    12c0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    12c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12c7:	ba 10 00 00 00       	mov    $0x10,%edx
+    12cc:	89 c1                	mov    %eax,%ecx
+    12ce:	d3 e2                	shl    %cl,%edx
+    12d0:	89 d0                	mov    %edx,%eax
+    12d2:	3b 45 08             	cmp    0x8(%ebp),%eax
+    12d5:	72 e9                	jb     12c0 <malloc+0x28>
+    ;
+  if(classes[k] == 0 && refill(k) < 0)
+    12d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12da:	8b 04 85 40 20 00 00 	mov    0x2040(,%eax,4),%eax
+    12e1:	85 c0                	test   %eax,%eax
+    12e3:	75 19                	jne    12fe <malloc+0x66>
+    12e5:	83 ec 0c             	sub    $0xc,%esp
+    12e8:	ff 75 f4             	push   -0xc(%ebp)
+    12eb:	e8 b1 fe ff ff       	call   11a1 <refill>
+    12f0:	83 c4 10             	add    $0x10,%esp
+    12f3:	85 c0                	test   %eax,%eax
+    12f5:	79 07                	jns    12fe <malloc+0x66>
+    return 0;
+    12f7:	b8 00 00 00 00       	mov    $0x0,%eax
+    12fc:	eb 23                	jmp    1321 <malloc+0x89>
+  b = classes[k];
+    12fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1301:	8b 04 85 40 20 00 00 	mov    0x2040(,%eax,4),%eax
+    1308:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  classes[k] = b->next;
+    130b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    130e:	8b 50 08             	mov    0x8(%eax),%edx
+    1311:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1314:	89 14 85 40 20 00 00 	mov    %edx,0x2040(,%eax,4)
+  return (char*)b + HDRSIZE;
+    131b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    131e:	83 c0 08             	add    $0x8,%eax
+}
+    1321:	c9                   	leave
+    1322:	c3                   	ret
+
+00001323 <stream>:
+
+// Return the stream for fd, deciding on first use how
+// its output is buffered.  Returns 0 if fd is not open.
+static struct stream*
+stream(int fd)
+{
+    1323:	55                   	push   %ebp
+    1324:	89 e5                	mov    %esp,%ebp
+    1326:	83 ec 28             	sub    $0x28,%esp
+  struct stream *s;
+  struct stat st;
+
+  if(fd < 0 || fd >= NOFILE)
+    1329:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    132d:	78 06                	js     1335 <stream+0x12>
+    132f:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    1333:	7e 07                	jle    133c <stream+0x19>
+    return 0;
+    1335:	b8 00 00 00 00       	mov    $0x0,%eax
+    133a:	eb 55                	jmp    1391 <stream+0x6e>
+  s = &streams[fd];
+    133c:	8b 45 08             	mov    0x8(%ebp),%eax
+    133f:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1345:	05 e0 20 00 00       	add    $0x20e0,%eax
+    134a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(s->mode == UNKNOWN){
+    134d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1350:	8b 00                	mov    (%eax),%eax
+    1352:	85 c0                	test   %eax,%eax
+    1354:	75 38                	jne    138e <stream+0x6b>
+    if(fstat(fd, &st) < 0)
+    1356:	83 ec 08             	sub    $0x8,%esp
+    1359:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    135c:	50                   	push   %eax
+    135d:	ff 75 08             	push   0x8(%ebp)
+    1360:	e8 57 f6 ff ff       	call   9bc <fstat>
+    1365:	83 c4 10             	add    $0x10,%esp
+    1368:	85 c0                	test   %eax,%eax
+    136a:	79 07                	jns    1373 <stream+0x50>
+      return 0;
+    136c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1371:	eb 1e                	jmp    1391 <stream+0x6e>
+    s->mode = st.type == T_DEV ? LINEBUF : FULLBUF;
+    1373:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+    1377:	66 83 f8 03          	cmp    $0x3,%ax
+    137b:	75 07                	jne    1384 <stream+0x61>
+    137d:	ba 01 00 00 00       	mov    $0x1,%edx
+    1382:	eb 05                	jmp    1389 <stream+0x66>
+    1384:	ba 02 00 00 00       	mov    $0x2,%edx
+    1389:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    138c:	89 10                	mov    %edx,(%eax)
+  }
+  return s;
+    138e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1391:	c9                   	leave
+    1392:	c3                   	ret
+
+00001393 <fflush>:
+
+int
+fflush(int fd)
+{
+    1393:	55                   	push   %ebp
+    1394:	89 e5                	mov    %esp,%ebp
+    1396:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  int i, n;
+
+  if(fd < 0 || fd >= NOFILE)
+    1399:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    139d:	78 06                	js     13a5 <fflush+0x12>
+    139f:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    13a3:	7e 07                	jle    13ac <fflush+0x19>
+    return -1;
+    13a5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    13aa:	eb 78                	jmp    1424 <fflush+0x91>
+  s = &streams[fd];
+    13ac:	8b 45 08             	mov    0x8(%ebp),%eax
+    13af:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    13b5:	05 e0 20 00 00       	add    $0x20e0,%eax
+    13ba:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < s->nout; i += n){
+    13bd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    13c4:	eb 44                	jmp    140a <fflush+0x77>
+    if((n = write(fd, s->out + i, s->nout - i)) <= 0){
+    13c6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    13c9:	8b 40 04             	mov    0x4(%eax),%eax
+    13cc:	2b 45 f4             	sub    -0xc(%ebp),%eax
+    13cf:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    13d2:	8d 4a 10             	lea    0x10(%edx),%ecx
+    13d5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    13d8:	01 ca                	add    %ecx,%edx
+    13da:	83 ec 04             	sub    $0x4,%esp
+    13dd:	50                   	push   %eax
+    13de:	52                   	push   %edx
+    13df:	ff 75 08             	push   0x8(%ebp)
+    13e2:	e8 6c f5 ff ff       	call   953 <write>
+    13e7:	83 c4 10             	add    $0x10,%esp
+    13ea:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    13ed:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    13f1:	7f 11                	jg     1404 <fflush+0x71>
+      s->nout = 0;
+    13f3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    13f6:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+      return -1;
+    13fd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1402:	eb 20                	jmp    1424 <fflush+0x91>
+  for(i = 0; i < s->nout; i += n){
+    1404:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1407:	01 45 f4             	add    %eax,-0xc(%ebp)
+    140a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    140d:	8b 40 04             	mov    0x4(%eax),%eax
+    1410:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    1413:	7c b1                	jl     13c6 <fflush+0x33>
+    }
+  }
+  s->nout = 0;
+    1415:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1418:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  return 0;
+    141f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1424:	c9                   	leave
+    1425:	c3                   	ret
+
+00001426 <flushall>:
+
+// Flush every stream, or only line-buffered ones.
+static void
+flushall(int lineonly)
+{
+    1426:	55                   	push   %ebp
+    1427:	89 e5                	mov    %esp,%ebp
+    1429:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+    142c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1433:	eb 41                	jmp    1476 <flushall+0x50>
+    if(streams[fd].nout > 0 && (!lineonly || streams[fd].mode == LINEBUF))
+    1435:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1438:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    143e:	05 e4 20 00 00       	add    $0x20e4,%eax
+    1443:	8b 00                	mov    (%eax),%eax
+    1445:	85 c0                	test   %eax,%eax
+    1447:	7e 29                	jle    1472 <flushall+0x4c>
+    1449:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    144d:	74 15                	je     1464 <flushall+0x3e>
+    144f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1452:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1458:	05 e0 20 00 00       	add    $0x20e0,%eax
+    145d:	8b 00                	mov    (%eax),%eax
+    145f:	83 f8 01             	cmp    $0x1,%eax
+    1462:	75 0e                	jne    1472 <flushall+0x4c>
+      fflush(fd);
+    1464:	83 ec 0c             	sub    $0xc,%esp
+    1467:	ff 75 f4             	push   -0xc(%ebp)
+    146a:	e8 24 ff ff ff       	call   1393 <fflush>
+    146f:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++)
+    1472:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1476:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+    147a:	7e b9                	jle    1435 <flushall+0xf>
+}
+    147c:	90                   	nop
+    147d:	90                   	nop
+    147e:	c9                   	leave
+    147f:	c3                   	ret
+
+00001480 <fputc>:
+
+int
+fputc(int fd, int c)
+{
+    1480:	55                   	push   %ebp
+    1481:	89 e5                	mov    %esp,%ebp
+    1483:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  char ch;
+
+  if((s = stream(fd)) == 0){
+    1486:	83 ec 0c             	sub    $0xc,%esp
+    1489:	ff 75 08             	push   0x8(%ebp)
+    148c:	e8 92 fe ff ff       	call   1323 <stream>
+    1491:	83 c4 10             	add    $0x10,%esp
+    1494:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1497:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    149b:	75 2e                	jne    14cb <fputc+0x4b>
+    ch = c;
+    149d:	8b 45 0c             	mov    0xc(%ebp),%eax
+    14a0:	88 45 f3             	mov    %al,-0xd(%ebp)
+    return write(fd, &ch, 1) == 1 ? (uchar)c : -1;
+    14a3:	83 ec 04             	sub    $0x4,%esp
+    14a6:	6a 01                	push   $0x1
+    14a8:	8d 45 f3             	lea    -0xd(%ebp),%eax
+    14ab:	50                   	push   %eax
+    14ac:	ff 75 08             	push   0x8(%ebp)
+    14af:	e8 9f f4 ff ff       	call   953 <write>
+    14b4:	83 c4 10             	add    $0x10,%esp
+    14b7:	83 f8 01             	cmp    $0x1,%eax
+    14ba:	75 08                	jne    14c4 <fputc+0x44>
+    14bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+    14bf:	0f b6 c0             	movzbl %al,%eax
+    14c2:	eb 5e                	jmp    1522 <fputc+0xa2>
+    14c4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    14c9:	eb 57                	jmp    1522 <fputc+0xa2>
+  }
+  s->out[s->nout++] = c;
+    14cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14ce:	8b 40 04             	mov    0x4(%eax),%eax
+    14d1:	8d 48 01             	lea    0x1(%eax),%ecx
+    14d4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    14d7:	89 4a 04             	mov    %ecx,0x4(%edx)
+    14da:	8b 55 0c             	mov    0xc(%ebp),%edx
+    14dd:	89 d1                	mov    %edx,%ecx
+    14df:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    14e2:	88 4c 02 10          	mov    %cl,0x10(%edx,%eax,1)
+  if(s->nout == BUFSZ || (s->mode == LINEBUF && c == '\n'))
+    14e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14e9:	8b 40 04             	mov    0x4(%eax),%eax
+    14ec:	3d 00 02 00 00       	cmp    $0x200,%eax
+    14f1:	74 10                	je     1503 <fputc+0x83>
+    14f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14f6:	8b 00                	mov    (%eax),%eax
+    14f8:	83 f8 01             	cmp    $0x1,%eax
+    14fb:	75 1f                	jne    151c <fputc+0x9c>
+    14fd:	83 7d 0c 0a          	cmpl   $0xa,0xc(%ebp)
+    1501:	75 19                	jne    151c <fputc+0x9c>
+    if(fflush(fd) < 0)
+    1503:	83 ec 0c             	sub    $0xc,%esp
+    1506:	ff 75 08             	push   0x8(%ebp)
+    1509:	e8 85 fe ff ff       	call   1393 <fflush>
+    150e:	83 c4 10             	add    $0x10,%esp
+    1511:	85 c0                	test   %eax,%eax
+    1513:	79 07                	jns    151c <fputc+0x9c>
+      return -1;
+    1515:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    151a:	eb 06                	jmp    1522 <fputc+0xa2>
+  return (uchar)c;
+    151c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    151f:	0f b6 c0             	movzbl %al,%eax
+}
+    1522:	c9                   	leave
+    1523:	c3                   	ret
+
+00001524 <fgetc>:
+
+// Return the next byte read from fd, or -1 at end of file.
+int
+fgetc(int fd)
+{
+    1524:	55                   	push   %ebp
+    1525:	89 e5                	mov    %esp,%ebp
+    1527:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  uchar c;
+  int n;
+
+  if((s = stream(fd)) == 0){
+    152a:	83 ec 0c             	sub    $0xc,%esp
+    152d:	ff 75 08             	push   0x8(%ebp)
+    1530:	e8 ee fd ff ff       	call   1323 <stream>
+    1535:	83 c4 10             	add    $0x10,%esp
+    1538:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    153b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    153f:	75 39                	jne    157a <fgetc+0x56>
+    flushall(1);
+    1541:	83 ec 0c             	sub    $0xc,%esp
+    1544:	6a 01                	push   $0x1
+    1546:	e8 db fe ff ff       	call   1426 <flushall>
+    154b:	83 c4 10             	add    $0x10,%esp
+    return read(fd, &c, 1) == 1 ? c : -1;
+    154e:	83 ec 04             	sub    $0x4,%esp
+    1551:	6a 01                	push   $0x1
+    1553:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    1556:	50                   	push   %eax
+    1557:	ff 75 08             	push   0x8(%ebp)
+    155a:	e8 e5 f3 ff ff       	call   944 <read>
+    155f:	83 c4 10             	add    $0x10,%esp
+    1562:	83 f8 01             	cmp    $0x1,%eax
+    1565:	75 0c                	jne    1573 <fgetc+0x4f>
+    1567:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    156b:	0f b6 c0             	movzbl %al,%eax
+    156e:	e9 80 00 00 00       	jmp    15f3 <fgetc+0xcf>
+    1573:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1578:	eb 79                	jmp    15f3 <fgetc+0xcf>
+  }
+  if(s->rpos == s->rend){
+    157a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    157d:	8b 50 08             	mov    0x8(%eax),%edx
+    1580:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1583:	8b 40 0c             	mov    0xc(%eax),%eax
+    1586:	39 c2                	cmp    %eax,%edx
+    1588:	75 4c                	jne    15d6 <fgetc+0xb2>
+    flushall(1);
+    158a:	83 ec 0c             	sub    $0xc,%esp
+    158d:	6a 01                	push   $0x1
+    158f:	e8 92 fe ff ff       	call   1426 <flushall>
+    1594:	83 c4 10             	add    $0x10,%esp
+    if((n = read(fd, s->in, BUFSZ)) <= 0)
+    1597:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    159a:	05 10 02 00 00       	add    $0x210,%eax
+    159f:	83 ec 04             	sub    $0x4,%esp
+    15a2:	68 00 02 00 00       	push   $0x200
+    15a7:	50                   	push   %eax
+    15a8:	ff 75 08             	push   0x8(%ebp)
+    15ab:	e8 94 f3 ff ff       	call   944 <read>
+    15b0:	83 c4 10             	add    $0x10,%esp
+    15b3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    15b6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    15ba:	7f 07                	jg     15c3 <fgetc+0x9f>
+      return -1;
+    15bc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    15c1:	eb 30                	jmp    15f3 <fgetc+0xcf>
+    s->rpos = 0;
+    15c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15c6:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+    s->rend = n;
+    15cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15d0:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    15d3:	89 50 0c             	mov    %edx,0xc(%eax)
+  }
+  return (uchar)s->in[s->rpos++];
+    15d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15d9:	8b 40 08             	mov    0x8(%eax),%eax
+    15dc:	8d 48 01             	lea    0x1(%eax),%ecx
+    15df:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    15e2:	89 4a 08             	mov    %ecx,0x8(%edx)
+    15e5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    15e8:	0f b6 84 02 10 02 00 	movzbl 0x210(%edx,%eax,1),%eax
+    15ef:	00 
+    15f0:	0f b6 c0             	movzbl %al,%eax
+}
+    15f3:	c9                   	leave
+    15f4:	c3                   	ret
+
+000015f5 <fork>:
+
+int
+fork(void)
+{
+    15f5:	55                   	push   %ebp
+    15f6:	89 e5                	mov    %esp,%ebp
+    15f8:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    15fb:	83 ec 0c             	sub    $0xc,%esp
+    15fe:	6a 00                	push   $0x0
+    1600:	e8 21 fe ff ff       	call   1426 <flushall>
+    1605:	83 c4 10             	add    $0x10,%esp
+  return _fork();
+    1608:	e8 fb f2 ff ff       	call   908 <_fork>
+}
+    160d:	c9                   	leave
+    160e:	c3                   	ret
+
+0000160f <exec>:
+
+int
+exec(char *path, char **argv)
+{
+    160f:	55                   	push   %ebp
+    1610:	89 e5                	mov    %esp,%ebp
+    1612:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1615:	83 ec 0c             	sub    $0xc,%esp
+    1618:	6a 00                	push   $0x0
+    161a:	e8 07 fe ff ff       	call   1426 <flushall>
+    161f:	83 c4 10             	add    $0x10,%esp
+  return _exec(path, argv);
+    1622:	83 ec 08             	sub    $0x8,%esp
+    1625:	ff 75 0c             	push   0xc(%ebp)
+    1628:	ff 75 08             	push   0x8(%ebp)
+    162b:	e8 50 f3 ff ff       	call   980 <_exec>
+    1630:	83 c4 10             	add    $0x10,%esp
+}
+    1633:	c9                   	leave
+    1634:	c3                   	ret
+
+00001635 <exit>:
+
+int
+exit(void)
+{
+    1635:	55                   	push   %ebp
+    1636:	89 e5                	mov    %esp,%ebp
+    1638:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    163b:	83 ec 0c             	sub    $0xc,%esp
+    163e:	6a 00                	push   $0x0
+    1640:	e8 e1 fd ff ff       	call   1426 <flushall>
+    1645:	83 c4 10             	add    $0x10,%esp
+  _exit();
+    1648:	e8 ca f2 ff ff       	call   917 <_exit>
+
+0000164d <close>:
+}
+
+int
+close(int fd)
+{
+    164d:	55                   	push   %ebp
+    164e:	89 e5                	mov    %esp,%ebp
+    1650:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+
+  if(fd >= 0 && fd < NOFILE){
+    1653:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1657:	78 44                	js     169d <close+0x50>
+    1659:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    165d:	7f 3e                	jg     169d <close+0x50>
+    fflush(fd);
+    165f:	83 ec 0c             	sub    $0xc,%esp
+    1662:	ff 75 08             	push   0x8(%ebp)
+    1665:	e8 29 fd ff ff       	call   1393 <fflush>
+    166a:	83 c4 10             	add    $0x10,%esp
+    s = &streams[fd];
+    166d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1670:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1676:	05 e0 20 00 00       	add    $0x20e0,%eax
+    167b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    s->mode = UNKNOWN;
+    167e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1681:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    s->rpos = s->rend = 0;
+    1687:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    168a:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    1691:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1694:	8b 50 0c             	mov    0xc(%eax),%edx
+    1697:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    169a:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  return _close(fd);
+    169d:	83 ec 0c             	sub    $0xc,%esp
+    16a0:	ff 75 08             	push   0x8(%ebp)
+    16a3:	e8 ba f2 ff ff       	call   962 <_close>
+    16a8:	83 c4 10             	add    $0x10,%esp
+}
+    16ab:	c9                   	leave
+    16ac:	c3                   	ret
@@ -0,0 +1,3366 @@
+
+_increment:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <save>:
+
+int stdout = 1;
+int stderr = 2;
+
+void save(char* name, void* ptr, int size)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 18             	sub    $0x18,%esp
+    printf(stdout, "saving...\n");
+       6:	a1 a4 24 00 00       	mov    0x24a4,%eax
+       b:	83 ec 08             	sub    $0x8,%esp
+       e:	68 08 1c 00 00       	push   $0x1c08
+      13:	50                   	push   %eax
+      14:	e8 da 10 00 00       	call   10f3 <printf>
+      19:	83 c4 10             	add    $0x10,%esp
+
+    int fd = open(name, O_CREATE|O_RDWR);
+      1c:	83 ec 08             	sub    $0x8,%esp
+      1f:	68 02 02 00 00       	push   $0x202
+      24:	ff 75 08             	push   0x8(%ebp)
+      27:	e8 bd 0e 00 00       	call   ee9 <open>
+      2c:	83 c4 10             	add    $0x10,%esp
+      2f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd >= 0)
+      32:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+      36:	78 34                	js     6c <save+0x6c>
+    {
+        printf(stdout, "the file '%s' is created.\n", name);
+      38:	a1 a4 24 00 00       	mov    0x24a4,%eax
+      3d:	83 ec 04             	sub    $0x4,%esp
+      40:	ff 75 08             	push   0x8(%ebp)
+      43:	68 13 1c 00 00       	push   $0x1c13
+      48:	50                   	push   %eax
+      49:	e8 a5 10 00 00       	call   10f3 <printf>
+      4e:	83 c4 10             	add    $0x10,%esp
+    {
+        printf(stderr, "error: an error occured while creating the file '%s'.\n", name);
+        exit();
+    }
+
+    if(write(fd, ptr, size) == size)
+      51:	83 ec 04             	sub    $0x4,%esp
+      54:	ff 75 10             	push   0x10(%ebp)
+      57:	ff 75 0c             	push   0xc(%ebp)
+      5a:	ff 75 f4             	push   -0xc(%ebp)
+      5d:	e8 4b 0e 00 00       	call   ead <write>
+      62:	83 c4 10             	add    $0x10,%esp
+      65:	39 45 10             	cmp    %eax,0x10(%ebp)
+      68:	75 3b                	jne    a5 <save+0xa5>
+      6a:	eb 1e                	jmp    8a <save+0x8a>
+        printf(stderr, "error: an error occured while creating the file '%s'.\n", name);
+      6c:	a1 a8 24 00 00       	mov    0x24a8,%eax
+      71:	83 ec 04             	sub    $0x4,%esp
+      74:	ff 75 08             	push   0x8(%ebp)
+      77:	68 30 1c 00 00       	push   $0x1c30
+      7c:	50                   	push   %eax
+      7d:	e8 71 10 00 00       	call   10f3 <printf>
+      82:	83 c4 10             	add    $0x10,%esp
+        exit();
+      85:	e8 05 1b 00 00       	call   1b8f <exit>
+    {
+        printf(stdout, "the process info is written to the file '%s'.\n", name);
+      8a:	a1 a4 24 00 00       	mov    0x24a4,%eax
+      8f:	83 ec 04             	sub    $0x4,%esp
+      92:	ff 75 08             	push   0x8(%ebp)
+      95:	68 68 1c 00 00       	push   $0x1c68
+      9a:	50                   	push   %eax
+      9b:	e8 53 10 00 00       	call   10f3 <printf>
+      a0:	83 c4 10             	add    $0x10,%esp
+      a3:	eb 1e                	jmp    c3 <save+0xc3>
+    }
+    else
+    {
+        printf(stderr, "error: an error occured while writing to the file '%s'.\n", name);
+      a5:	a1 a8 24 00 00       	mov    0x24a8,%eax
+      aa:	83 ec 04             	sub    $0x4,%esp
+      ad:	ff 75 08             	push   0x8(%ebp)
+      b0:	68 98 1c 00 00       	push   $0x1c98
+      b5:	50                   	push   %eax
+      b6:	e8 38 10 00 00       	call   10f3 <printf>
+      bb:	83 c4 10             	add    $0x10,%esp
+        exit();
+      be:	e8 cc 1a 00 00       	call   1b8f <exit>
+    }
+
+    close(fd);
+      c3:	83 ec 0c             	sub    $0xc,%esp
+      c6:	ff 75 f4             	push   -0xc(%ebp)
+      c9:	e8 d9 1a 00 00       	call   1ba7 <close>
+      ce:	83 c4 10             	add    $0x10,%esp
+}
+      d1:	90                   	nop
+      d2:	c9                   	leave
+      d3:	c3                   	ret
+
+000000d4 <stop>:
+
+void stop(void)
+{
+      d4:	55                   	push   %ebp
+      d5:	89 e5                	mov    %esp,%ebp
+      d7:	83 ec 18             	sub    $0x18,%esp
+    struct proc* p = (struct proc*) malloc(sizeof(struct proc));
+      da:	83 ec 0c             	sub    $0xc,%esp
+      dd:	68 98 00 00 00       	push   $0x98
+      e2:	e8 0b 17 00 00       	call   17f2 <malloc>
+      e7:	83 c4 10             	add    $0x10,%esp
+      ea:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+    p->tf = (struct trapframe*) malloc(sizeof(struct trapframe));
+      ed:	83 ec 0c             	sub    $0xc,%esp
+      f0:	6a 4c                	push   $0x4c
+      f2:	e8 fb 16 00 00       	call   17f2 <malloc>
+      f7:	83 c4 10             	add    $0x10,%esp
+      fa:	8b 55 f0             	mov    -0x10(%ebp),%edx
+      fd:	89 42 18             	mov    %eax,0x18(%edx)
+    p->context = (struct context*) malloc(sizeof(struct context));
+     100:	83 ec 0c             	sub    $0xc,%esp
+     103:	6a 14                	push   $0x14
+     105:	e8 e8 16 00 00       	call   17f2 <malloc>
+     10a:	83 c4 10             	add    $0x10,%esp
+     10d:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     110:	89 42 1c             	mov    %eax,0x1c(%edx)
+    p->cwd = (struct inode*) malloc(sizeof(struct inode));
+     113:	83 ec 0c             	sub    $0xc,%esp
+     116:	68 c0 00 00 00       	push   $0xc0
+     11b:	e8 d2 16 00 00       	call   17f2 <malloc>
+     120:	83 c4 10             	add    $0x10,%esp
+     123:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     126:	89 42 68             	mov    %eax,0x68(%edx)
+
+    getproc(p);
+     129:	83 ec 0c             	sub    $0xc,%esp
+     12c:	ff 75 f0             	push   -0x10(%ebp)
+     12f:	e8 69 0e 00 00       	call   f9d <getproc>
+     134:	83 c4 10             	add    $0x10,%esp
+
+    //sz, name, kstack
+    printf(stdout, "========================userspace=========================\n");
+     137:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     13c:	83 ec 08             	sub    $0x8,%esp
+     13f:	68 d4 1c 00 00       	push   $0x1cd4
+     144:	50                   	push   %eax
+     145:	e8 a9 0f 00 00       	call   10f3 <printf>
+     14a:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "before saving: sz, name, kstack\n");
+     14d:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     152:	83 ec 08             	sub    $0x8,%esp
+     155:	68 10 1d 00 00       	push   $0x1d10
+     15a:	50                   	push   %eax
+     15b:	e8 93 0f 00 00       	call   10f3 <printf>
+     160:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "==========================================================\n");
+     163:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     168:	83 ec 08             	sub    $0x8,%esp
+     16b:	68 34 1d 00 00       	push   $0x1d34
+     170:	50                   	push   %eax
+     171:	e8 7d 0f 00 00       	call   10f3 <printf>
+     176:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "sz = %d\n", p->sz);
+     179:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     17c:	8b 10                	mov    (%eax),%edx
+     17e:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     183:	83 ec 04             	sub    $0x4,%esp
+     186:	52                   	push   %edx
+     187:	68 70 1d 00 00       	push   $0x1d70
+     18c:	50                   	push   %eax
+     18d:	e8 61 0f 00 00       	call   10f3 <printf>
+     192:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "name = %s\n", p->name);
+     195:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     198:	8d 50 6c             	lea    0x6c(%eax),%edx
+     19b:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     1a0:	83 ec 04             	sub    $0x4,%esp
+     1a3:	52                   	push   %edx
+     1a4:	68 79 1d 00 00       	push   $0x1d79
+     1a9:	50                   	push   %eax
+     1aa:	e8 44 0f 00 00       	call   10f3 <printf>
+     1af:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "kstack = %s\n", p->kstack);
+     1b2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     1b5:	8b 50 08             	mov    0x8(%eax),%edx
+     1b8:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     1bd:	83 ec 04             	sub    $0x4,%esp
+     1c0:	52                   	push   %edx
+     1c1:	68 84 1d 00 00       	push   $0x1d84
+     1c6:	50                   	push   %eax
+     1c7:	e8 27 0f 00 00       	call   10f3 <printf>
+     1cc:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "----------------------------------------------------------\n");
+     1cf:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     1d4:	83 ec 08             	sub    $0x8,%esp
+     1d7:	68 94 1d 00 00       	push   $0x1d94
+     1dc:	50                   	push   %eax
+     1dd:	e8 11 0f 00 00       	call   10f3 <printf>
+     1e2:	83 c4 10             	add    $0x10,%esp
+
+    //tf
+    printf(stdout, "========================userspace=========================\n");
+     1e5:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     1ea:	83 ec 08             	sub    $0x8,%esp
+     1ed:	68 d4 1c 00 00       	push   $0x1cd4
+     1f2:	50                   	push   %eax
+     1f3:	e8 fb 0e 00 00       	call   10f3 <printf>
+     1f8:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "before saving: tf\n");
+     1fb:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     200:	83 ec 08             	sub    $0x8,%esp
+     203:	68 d0 1d 00 00       	push   $0x1dd0
+     208:	50                   	push   %eax
+     209:	e8 e5 0e 00 00       	call   10f3 <printf>
+     20e:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "==========================================================\n");
+     211:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     216:	83 ec 08             	sub    $0x8,%esp
+     219:	68 34 1d 00 00       	push   $0x1d34
+     21e:	50                   	push   %eax
+     21f:	e8 cf 0e 00 00       	call   10f3 <printf>
+     224:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "edi = %d\n", p->tf->edi);
+     227:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     22a:	8b 40 18             	mov    0x18(%eax),%eax
+     22d:	8b 10                	mov    (%eax),%edx
+     22f:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     234:	83 ec 04             	sub    $0x4,%esp
+     237:	52                   	push   %edx
+     238:	68 e3 1d 00 00       	push   $0x1de3
+     23d:	50                   	push   %eax
+     23e:	e8 b0 0e 00 00       	call   10f3 <printf>
+     243:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "esi = %d\n", p->tf->esi);
+     246:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     249:	8b 40 18             	mov    0x18(%eax),%eax
+     24c:	8b 50 04             	mov    0x4(%eax),%edx
+     24f:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     254:	83 ec 04             	sub    $0x4,%esp
+     257:	52                   	push   %edx
+     258:	68 ed 1d 00 00       	push   $0x1ded
+     25d:	50                   	push   %eax
+     25e:	e8 90 0e 00 00       	call   10f3 <printf>
+     263:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "ebp = %d\n", p->tf->ebp);
+     266:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     269:	8b 40 18             	mov    0x18(%eax),%eax
+     26c:	8b 50 08             	mov    0x8(%eax),%edx
+     26f:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     274:	83 ec 04             	sub    $0x4,%esp
+     277:	52                   	push   %edx
+     278:	68 f7 1d 00 00       	push   $0x1df7
+     27d:	50                   	push   %eax
+     27e:	e8 70 0e 00 00       	call   10f3 <printf>
+     283:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "oesp = %d\n", p->tf->oesp);
+     286:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     289:	8b 40 18             	mov    0x18(%eax),%eax
+     28c:	8b 50 0c             	mov    0xc(%eax),%edx
+     28f:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     294:	83 ec 04             	sub    $0x4,%esp
+     297:	52                   	push   %edx
+     298:	68 01 1e 00 00       	push   $0x1e01
+     29d:	50                   	push   %eax
+     29e:	e8 50 0e 00 00       	call   10f3 <printf>
+     2a3:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "ebx = %d\n", p->tf->ebx);
+     2a6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     2a9:	8b 40 18             	mov    0x18(%eax),%eax
+     2ac:	8b 50 10             	mov    0x10(%eax),%edx
+     2af:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     2b4:	83 ec 04             	sub    $0x4,%esp
+     2b7:	52                   	push   %edx
+     2b8:	68 0c 1e 00 00       	push   $0x1e0c
+     2bd:	50                   	push   %eax
+     2be:	e8 30 0e 00 00       	call   10f3 <printf>
+     2c3:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "edx = %d\n", p->tf->edx);
+     2c6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     2c9:	8b 40 18             	mov    0x18(%eax),%eax
+     2cc:	8b 50 14             	mov    0x14(%eax),%edx
+     2cf:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     2d4:	83 ec 04             	sub    $0x4,%esp
+     2d7:	52                   	push   %edx
+     2d8:	68 16 1e 00 00       	push   $0x1e16
+     2dd:	50                   	push   %eax
+     2de:	e8 10 0e 00 00       	call   10f3 <printf>
+     2e3:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "ecx = %d\n", p->tf->ecx);
+     2e6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     2e9:	8b 40 18             	mov    0x18(%eax),%eax
+     2ec:	8b 50 18             	mov    0x18(%eax),%edx
+     2ef:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     2f4:	83 ec 04             	sub    $0x4,%esp
+     2f7:	52                   	push   %edx
+     2f8:	68 20 1e 00 00       	push   $0x1e20
+     2fd:	50                   	push   %eax
+     2fe:	e8 f0 0d 00 00       	call   10f3 <printf>
+     303:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "eax = %d\n", p->tf->eax);
+     306:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     309:	8b 40 18             	mov    0x18(%eax),%eax
+     30c:	8b 50 1c             	mov    0x1c(%eax),%edx
+     30f:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     314:	83 ec 04             	sub    $0x4,%esp
+     317:	52                   	push   %edx
+     318:	68 2a 1e 00 00       	push   $0x1e2a
+     31d:	50                   	push   %eax
+     31e:	e8 d0 0d 00 00       	call   10f3 <printf>
+     323:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "gs = %d\n", p->tf->gs);
+     326:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     329:	8b 40 18             	mov    0x18(%eax),%eax
+     32c:	0f b7 40 20          	movzwl 0x20(%eax),%eax
+     330:	0f b7 d0             	movzwl %ax,%edx
+     333:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     338:	83 ec 04             	sub    $0x4,%esp
+     33b:	52                   	push   %edx
+     33c:	68 34 1e 00 00       	push   $0x1e34
+     341:	50                   	push   %eax
+     342:	e8 ac 0d 00 00       	call   10f3 <printf>
+     347:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "padding1 = %d\n", p->tf->padding1);
+     34a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     34d:	8b 40 18             	mov    0x18(%eax),%eax
+     350:	0f b7 40 22          	movzwl 0x22(%eax),%eax
+     354:	0f b7 d0             	movzwl %ax,%edx
+     357:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     35c:	83 ec 04             	sub    $0x4,%esp
+     35f:	52                   	push   %edx
+     360:	68 3d 1e 00 00       	push   $0x1e3d
+     365:	50                   	push   %eax
+     366:	e8 88 0d 00 00       	call   10f3 <printf>
+     36b:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "fs = %d\n", p->tf->fs);
+     36e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     371:	8b 40 18             	mov    0x18(%eax),%eax
+     374:	0f b7 40 24          	movzwl 0x24(%eax),%eax
+     378:	0f b7 d0             	movzwl %ax,%edx
+     37b:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     380:	83 ec 04             	sub    $0x4,%esp
+     383:	52                   	push   %edx
+     384:	68 4c 1e 00 00       	push   $0x1e4c
+     389:	50                   	push   %eax
+     38a:	e8 64 0d 00 00       	call   10f3 <printf>
+     38f:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "padding2 = %d\n", p->tf->padding2);
+     392:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     395:	8b 40 18             	mov    0x18(%eax),%eax
+     398:	0f b7 40 26          	movzwl 0x26(%eax),%eax
+     39c:	0f b7 d0             	movzwl %ax,%edx
+     39f:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     3a4:	83 ec 04             	sub    $0x4,%esp
+     3a7:	52                   	push   %edx
+     3a8:	68 55 1e 00 00       	push   $0x1e55
+     3ad:	50                   	push   %eax
+     3ae:	e8 40 0d 00 00       	call   10f3 <printf>
+     3b3:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "es = %d\n", p->tf->es);
+     3b6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     3b9:	8b 40 18             	mov    0x18(%eax),%eax
+     3bc:	0f b7 40 28          	movzwl 0x28(%eax),%eax
+     3c0:	0f b7 d0             	movzwl %ax,%edx
+     3c3:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     3c8:	83 ec 04             	sub    $0x4,%esp
+     3cb:	52                   	push   %edx
+     3cc:	68 64 1e 00 00       	push   $0x1e64
+     3d1:	50                   	push   %eax
+     3d2:	e8 1c 0d 00 00       	call   10f3 <printf>
+     3d7:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "padding3 = %d\n", p->tf->padding3);
+     3da:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     3dd:	8b 40 18             	mov    0x18(%eax),%eax
+     3e0:	0f b7 40 2a          	movzwl 0x2a(%eax),%eax
+     3e4:	0f b7 d0             	movzwl %ax,%edx
+     3e7:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     3ec:	83 ec 04             	sub    $0x4,%esp
+     3ef:	52                   	push   %edx
+     3f0:	68 6d 1e 00 00       	push   $0x1e6d
+     3f5:	50                   	push   %eax
+     3f6:	e8 f8 0c 00 00       	call   10f3 <printf>
+     3fb:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "ds = %d\n", p->tf->ds);
+     3fe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     401:	8b 40 18             	mov    0x18(%eax),%eax
+     404:	0f b7 40 2c          	movzwl 0x2c(%eax),%eax
+     408:	0f b7 d0             	movzwl %ax,%edx
+     40b:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     410:	83 ec 04             	sub    $0x4,%esp
+     413:	52                   	push   %edx
+     414:	68 7c 1e 00 00       	push   $0x1e7c
+     419:	50                   	push   %eax
+     41a:	e8 d4 0c 00 00       	call   10f3 <printf>
+     41f:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "padding4 = %d\n", p->tf->padding4);
+     422:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     425:	8b 40 18             	mov    0x18(%eax),%eax
+     428:	0f b7 40 2e          	movzwl 0x2e(%eax),%eax
+     42c:	0f b7 d0             	movzwl %ax,%edx
+     42f:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     434:	83 ec 04             	sub    $0x4,%esp
+     437:	52                   	push   %edx
+     438:	68 85 1e 00 00       	push   $0x1e85
+     43d:	50                   	push   %eax
+     43e:	e8 b0 0c 00 00       	call   10f3 <printf>
+     443:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "trapno = %d\n", p->tf->trapno);
+     446:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     449:	8b 40 18             	mov    0x18(%eax),%eax
+     44c:	8b 50 30             	mov    0x30(%eax),%edx
+     44f:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     454:	83 ec 04             	sub    $0x4,%esp
+     457:	52                   	push   %edx
+     458:	68 94 1e 00 00       	push   $0x1e94
+     45d:	50                   	push   %eax
+     45e:	e8 90 0c 00 00       	call   10f3 <printf>
+     463:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "err = %d\n", p->tf->err);
+     466:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     469:	8b 40 18             	mov    0x18(%eax),%eax
+     46c:	8b 50 34             	mov    0x34(%eax),%edx
+     46f:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     474:	83 ec 04             	sub    $0x4,%esp
+     477:	52                   	push   %edx
+     478:	68 a1 1e 00 00       	push   $0x1ea1
+     47d:	50                   	push   %eax
+     47e:	e8 70 0c 00 00       	call   10f3 <printf>
+     483:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "eip = %d\n", p->tf->eip);
+     486:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     489:	8b 40 18             	mov    0x18(%eax),%eax
+     48c:	8b 50 38             	mov    0x38(%eax),%edx
+     48f:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     494:	83 ec 04             	sub    $0x4,%esp
+     497:	52                   	push   %edx
+     498:	68 ab 1e 00 00       	push   $0x1eab
+     49d:	50                   	push   %eax
+     49e:	e8 50 0c 00 00       	call   10f3 <printf>
+     4a3:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "cs = %d\n", p->tf->cs);
+     4a6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     4a9:	8b 40 18             	mov    0x18(%eax),%eax
+     4ac:	0f b7 40 3c          	movzwl 0x3c(%eax),%eax
+     4b0:	0f b7 d0             	movzwl %ax,%edx
+     4b3:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     4b8:	83 ec 04             	sub    $0x4,%esp
+     4bb:	52                   	push   %edx
+     4bc:	68 b5 1e 00 00       	push   $0x1eb5
+     4c1:	50                   	push   %eax
+     4c2:	e8 2c 0c 00 00       	call   10f3 <printf>
+     4c7:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "padding5 = %d\n", p->tf->padding5);
+     4ca:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     4cd:	8b 40 18             	mov    0x18(%eax),%eax
+     4d0:	0f b7 40 3e          	movzwl 0x3e(%eax),%eax
+     4d4:	0f b7 d0             	movzwl %ax,%edx
+     4d7:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     4dc:	83 ec 04             	sub    $0x4,%esp
+     4df:	52                   	push   %edx
+     4e0:	68 be 1e 00 00       	push   $0x1ebe
+     4e5:	50                   	push   %eax
+     4e6:	e8 08 0c 00 00       	call   10f3 <printf>
+     4eb:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "eflags = %d\n", p->tf->eflags);
+     4ee:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     4f1:	8b 40 18             	mov    0x18(%eax),%eax
+     4f4:	8b 50 40             	mov    0x40(%eax),%edx
+     4f7:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     4fc:	83 ec 04             	sub    $0x4,%esp
+     4ff:	52                   	push   %edx
+     500:	68 cd 1e 00 00       	push   $0x1ecd
+     505:	50                   	push   %eax
+     506:	e8 e8 0b 00 00       	call   10f3 <printf>
+     50b:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "esp = %d\n", p->tf->esp);
+     50e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     511:	8b 40 18             	mov    0x18(%eax),%eax
+     514:	8b 50 44             	mov    0x44(%eax),%edx
+     517:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     51c:	83 ec 04             	sub    $0x4,%esp
+     51f:	52                   	push   %edx
+     520:	68 da 1e 00 00       	push   $0x1eda
+     525:	50                   	push   %eax
+     526:	e8 c8 0b 00 00       	call   10f3 <printf>
+     52b:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "ss = %d\n", p->tf->ss);
+     52e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     531:	8b 40 18             	mov    0x18(%eax),%eax
+     534:	0f b7 40 48          	movzwl 0x48(%eax),%eax
+     538:	0f b7 d0             	movzwl %ax,%edx
+     53b:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     540:	83 ec 04             	sub    $0x4,%esp
+     543:	52                   	push   %edx
+     544:	68 e4 1e 00 00       	push   $0x1ee4
+     549:	50                   	push   %eax
+     54a:	e8 a4 0b 00 00       	call   10f3 <printf>
+     54f:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "padding6 = %d\n", p->tf->padding6);
+     552:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     555:	8b 40 18             	mov    0x18(%eax),%eax
+     558:	0f b7 40 4a          	movzwl 0x4a(%eax),%eax
+     55c:	0f b7 d0             	movzwl %ax,%edx
+     55f:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     564:	83 ec 04             	sub    $0x4,%esp
+     567:	52                   	push   %edx
+     568:	68 ed 1e 00 00       	push   $0x1eed
+     56d:	50                   	push   %eax
+     56e:	e8 80 0b 00 00       	call   10f3 <printf>
+     573:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "----------------------------------------------------------\n");
+     576:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     57b:	83 ec 08             	sub    $0x8,%esp
+     57e:	68 94 1d 00 00       	push   $0x1d94
+     583:	50                   	push   %eax
+     584:	e8 6a 0b 00 00       	call   10f3 <printf>
+     589:	83 c4 10             	add    $0x10,%esp
+
+    //context
+    printf(stdout, "========================userspace=========================\n");
+     58c:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     591:	83 ec 08             	sub    $0x8,%esp
+     594:	68 d4 1c 00 00       	push   $0x1cd4
+     599:	50                   	push   %eax
+     59a:	e8 54 0b 00 00       	call   10f3 <printf>
+     59f:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "before saving: context\n");
+     5a2:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     5a7:	83 ec 08             	sub    $0x8,%esp
+     5aa:	68 fc 1e 00 00       	push   $0x1efc
+     5af:	50                   	push   %eax
+     5b0:	e8 3e 0b 00 00       	call   10f3 <printf>
+     5b5:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "==========================================================\n");
+     5b8:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     5bd:	83 ec 08             	sub    $0x8,%esp
+     5c0:	68 34 1d 00 00       	push   $0x1d34
+     5c5:	50                   	push   %eax
+     5c6:	e8 28 0b 00 00       	call   10f3 <printf>
+     5cb:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "edi = %d\n", p->context->edi);
+     5ce:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     5d1:	8b 40 1c             	mov    0x1c(%eax),%eax
+     5d4:	8b 10                	mov    (%eax),%edx
+     5d6:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     5db:	83 ec 04             	sub    $0x4,%esp
+     5de:	52                   	push   %edx
+     5df:	68 e3 1d 00 00       	push   $0x1de3
+     5e4:	50                   	push   %eax
+     5e5:	e8 09 0b 00 00       	call   10f3 <printf>
+     5ea:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "esi = %d\n", p->context->esi);
+     5ed:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     5f0:	8b 40 1c             	mov    0x1c(%eax),%eax
+     5f3:	8b 50 04             	mov    0x4(%eax),%edx
+     5f6:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     5fb:	83 ec 04             	sub    $0x4,%esp
+     5fe:	52                   	push   %edx
+     5ff:	68 ed 1d 00 00       	push   $0x1ded
+     604:	50                   	push   %eax
+     605:	e8 e9 0a 00 00       	call   10f3 <printf>
+     60a:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "ebx = %d\n", p->context->ebx);
+     60d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     610:	8b 40 1c             	mov    0x1c(%eax),%eax
+     613:	8b 50 08             	mov    0x8(%eax),%edx
+     616:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     61b:	83 ec 04             	sub    $0x4,%esp
+     61e:	52                   	push   %edx
+     61f:	68 0c 1e 00 00       	push   $0x1e0c
+     624:	50                   	push   %eax
+     625:	e8 c9 0a 00 00       	call   10f3 <printf>
+     62a:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "ebp = %d\n", p->context->ebp);
+     62d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     630:	8b 40 1c             	mov    0x1c(%eax),%eax
+     633:	8b 50 0c             	mov    0xc(%eax),%edx
+     636:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     63b:	83 ec 04             	sub    $0x4,%esp
+     63e:	52                   	push   %edx
+     63f:	68 f7 1d 00 00       	push   $0x1df7
+     644:	50                   	push   %eax
+     645:	e8 a9 0a 00 00       	call   10f3 <printf>
+     64a:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "eip = %d\n", p->context->eip);
+     64d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     650:	8b 40 1c             	mov    0x1c(%eax),%eax
+     653:	8b 50 10             	mov    0x10(%eax),%edx
+     656:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     65b:	83 ec 04             	sub    $0x4,%esp
+     65e:	52                   	push   %edx
+     65f:	68 ab 1e 00 00       	push   $0x1eab
+     664:	50                   	push   %eax
+     665:	e8 89 0a 00 00       	call   10f3 <printf>
+     66a:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "----------------------------------------------------------\n");
+     66d:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     672:	83 ec 08             	sub    $0x8,%esp
+     675:	68 94 1d 00 00       	push   $0x1d94
+     67a:	50                   	push   %eax
+     67b:	e8 73 0a 00 00       	call   10f3 <printf>
+     680:	83 c4 10             	add    $0x10,%esp
+
+    save("backup", p, sizeof(struct proc));
+     683:	83 ec 04             	sub    $0x4,%esp
+     686:	68 98 00 00 00       	push   $0x98
+     68b:	ff 75 f0             	push   -0x10(%ebp)
+     68e:	68 14 1f 00 00       	push   $0x1f14
+     693:	e8 68 f9 ff ff       	call   0 <save>
+     698:	83 c4 10             	add    $0x10,%esp
+    save("tf", p->tf, sizeof(struct trapframe));
+     69b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     69e:	8b 40 18             	mov    0x18(%eax),%eax
+     6a1:	83 ec 04             	sub    $0x4,%esp
+     6a4:	6a 4c                	push   $0x4c
+     6a6:	50                   	push   %eax
+     6a7:	68 1b 1f 00 00       	push   $0x1f1b
+     6ac:	e8 4f f9 ff ff       	call   0 <save>
+     6b1:	83 c4 10             	add    $0x10,%esp
+    save("context", p->context, sizeof(struct context));
+     6b4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     6b7:	8b 40 1c             	mov    0x1c(%eax),%eax
+     6ba:	83 ec 04             	sub    $0x4,%esp
+     6bd:	6a 14                	push   $0x14
+     6bf:	50                   	push   %eax
+     6c0:	68 1e 1f 00 00       	push   $0x1f1e
+     6c5:	e8 36 f9 ff ff       	call   0 <save>
+     6ca:	83 c4 10             	add    $0x10,%esp
+
+    int num = p->sz / PGSIZE;
+     6cd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     6d0:	8b 00                	mov    (%eax),%eax
+     6d2:	c1 e8 0c             	shr    $0xc,%eax
+     6d5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    char* pgs = (char *) malloc(p->sz);
+     6d8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     6db:	8b 00                	mov    (%eax),%eax
+     6dd:	83 ec 0c             	sub    $0xc,%esp
+     6e0:	50                   	push   %eax
+     6e1:	e8 0c 11 00 00       	call   17f2 <malloc>
+     6e6:	83 c4 10             	add    $0x10,%esp
+     6e9:	89 45 e8             	mov    %eax,-0x18(%ebp)
+
+    getpgs(pgs);
+     6ec:	83 ec 0c             	sub    $0xc,%esp
+     6ef:	ff 75 e8             	push   -0x18(%ebp)
+     6f2:	e8 b5 08 00 00       	call   fac <getpgs>
+     6f7:	83 c4 10             	add    $0x10,%esp
+
+    //pgs
+    printf(stdout, "========================userspace=========================\n");
+     6fa:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     6ff:	83 ec 08             	sub    $0x8,%esp
+     702:	68 d4 1c 00 00       	push   $0x1cd4
+     707:	50                   	push   %eax
+     708:	e8 e6 09 00 00       	call   10f3 <printf>
+     70d:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "before saving: pgs\n");
+     710:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     715:	83 ec 08             	sub    $0x8,%esp
+     718:	68 26 1f 00 00       	push   $0x1f26
+     71d:	50                   	push   %eax
+     71e:	e8 d0 09 00 00       	call   10f3 <printf>
+     723:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "==========================================================\n");
+     726:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     72b:	83 ec 08             	sub    $0x8,%esp
+     72e:	68 34 1d 00 00       	push   $0x1d34
+     733:	50                   	push   %eax
+     734:	e8 ba 09 00 00       	call   10f3 <printf>
+     739:	83 c4 10             	add    $0x10,%esp
+    int i;
+    for(i = 0; i < num; i++)
+     73c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     743:	eb 2e                	jmp    773 <stop+0x69f>
+    {
+        printf(stdout, "page '%d'th = %d\n", i, *(pgs + i * PGSIZE));
+     745:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     748:	c1 e0 0c             	shl    $0xc,%eax
+     74b:	89 c2                	mov    %eax,%edx
+     74d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     750:	01 d0                	add    %edx,%eax
+     752:	0f b6 00             	movzbl (%eax),%eax
+     755:	0f be d0             	movsbl %al,%edx
+     758:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     75d:	52                   	push   %edx
+     75e:	ff 75 f4             	push   -0xc(%ebp)
+     761:	68 3a 1f 00 00       	push   $0x1f3a
+     766:	50                   	push   %eax
+     767:	e8 87 09 00 00       	call   10f3 <printf>
+     76c:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < num; i++)
+     76f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     773:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     776:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+     779:	7c ca                	jl     745 <stop+0x671>
+    }
+    printf(stdout, "----------------------------------------------------------\n");
+     77b:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     780:	83 ec 08             	sub    $0x8,%esp
+     783:	68 94 1d 00 00       	push   $0x1d94
+     788:	50                   	push   %eax
+     789:	e8 65 09 00 00       	call   10f3 <printf>
+     78e:	83 c4 10             	add    $0x10,%esp
+
+    save("pgs", pgs, p->sz);
+     791:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     794:	8b 00                	mov    (%eax),%eax
+     796:	83 ec 04             	sub    $0x4,%esp
+     799:	50                   	push   %eax
+     79a:	ff 75 e8             	push   -0x18(%ebp)
+     79d:	68 4c 1f 00 00       	push   $0x1f4c
+     7a2:	e8 59 f8 ff ff       	call   0 <save>
+     7a7:	83 c4 10             	add    $0x10,%esp
+
+    exit();
+     7aa:	e8 e0 13 00 00       	call   1b8f <exit>
+
+000007af <main>:
+}
+
+int main(int argc, char *argv[])
+{
+     7af:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     7b3:	83 e4 f0             	and    $0xfffffff0,%esp
+     7b6:	ff 71 fc             	push   -0x4(%ecx)
+     7b9:	55                   	push   %ebp
+     7ba:	89 e5                	mov    %esp,%ebp
+     7bc:	51                   	push   %ecx
+     7bd:	83 ec 14             	sub    $0x14,%esp
+     7c0:	89 c8                	mov    %ecx,%eax
+    if(argc != 2)
+     7c2:	83 38 02             	cmpl   $0x2,(%eax)
+     7c5:	74 1b                	je     7e2 <main+0x33>
+    {
+        printf(stderr, "usage: increment [integer]\n");
+     7c7:	a1 a8 24 00 00       	mov    0x24a8,%eax
+     7cc:	83 ec 08             	sub    $0x8,%esp
+     7cf:	68 50 1f 00 00       	push   $0x1f50
+     7d4:	50                   	push   %eax
+     7d5:	e8 19 09 00 00       	call   10f3 <printf>
+     7da:	83 c4 10             	add    $0x10,%esp
+        exit();
+     7dd:	e8 ad 13 00 00       	call   1b8f <exit>
+    }
+    else
+    {
+        int base = 1;
+     7e2:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+        int limit = atoi(argv[1]);
+     7e9:	8b 40 04             	mov    0x4(%eax),%eax
+     7ec:	83 c0 04             	add    $0x4,%eax
+     7ef:	8b 00                	mov    (%eax),%eax
+     7f1:	83 ec 0c             	sub    $0xc,%esp
+     7f4:	50                   	push   %eax
+     7f5:	e8 ee 04 00 00       	call   ce8 <atoi>
+     7fa:	83 c4 10             	add    $0x10,%esp
+     7fd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+
+        if(limit <= 0)
+     800:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     804:	7f 1b                	jg     821 <main+0x72>
+        {
+            printf(stderr, "error: the increment argument must be greater than zero.\n");
+     806:	a1 a8 24 00 00       	mov    0x24a8,%eax
+     80b:	83 ec 08             	sub    $0x8,%esp
+     80e:	68 6c 1f 00 00       	push   $0x1f6c
+     813:	50                   	push   %eax
+     814:	e8 da 08 00 00       	call   10f3 <printf>
+     819:	83 c4 10             	add    $0x10,%esp
+            exit();
+     81c:	e8 6e 13 00 00       	call   1b8f <exit>
+        }
+        else
+        {
+            printf(stdout, "starting to count...\n");
+     821:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     826:	83 ec 08             	sub    $0x8,%esp
+     829:	68 a6 1f 00 00       	push   $0x1fa6
+     82e:	50                   	push   %eax
+     82f:	e8 bf 08 00 00       	call   10f3 <printf>
+     834:	83 c4 10             	add    $0x10,%esp
+
+            int counter;
+            for(counter = base; counter <= limit; counter++)
+     837:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     83a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     83d:	eb 39                	jmp    878 <main+0xc9>
+            {
+                printf(stdout, "%d\n", counter);
+     83f:	a1 a4 24 00 00       	mov    0x24a4,%eax
+     844:	83 ec 04             	sub    $0x4,%esp
+     847:	ff 75 f4             	push   -0xc(%ebp)
+     84a:	68 bc 1f 00 00       	push   $0x1fbc
+     84f:	50                   	push   %eax
+     850:	e8 9e 08 00 00       	call   10f3 <printf>
+     855:	83 c4 10             	add    $0x10,%esp
+                sleep(100);
+     858:	83 ec 0c             	sub    $0xc,%esp
+     85b:	6a 64                	push   $0x64
+     85d:	e8 1d 07 00 00       	call   f7f <sleep>
+     862:	83 c4 10             	add    $0x10,%esp
+
+                if(counter % 2 == 0)
+     865:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     868:	83 e0 01             	and    $0x1,%eax
+     86b:	85 c0                	test   %eax,%eax
+     86d:	75 05                	jne    874 <main+0xc5>
+                {
+                    stop();
+     86f:	e8 60 f8 ff ff       	call   d4 <stop>
+            for(counter = base; counter <= limit; counter++)
+     874:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     878:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     87b:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+     87e:	7e bf                	jle    83f <main+0x90>
+                }
+            }
+
+            exit();
+     880:	e8 0a 13 00 00       	call   1b8f <exit>
+
+00000885 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+     885:	55                   	push   %ebp
+     886:	89 e5                	mov    %esp,%ebp
+     888:	57                   	push   %edi
+     889:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+     88a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     88d:	8b 55 10             	mov    0x10(%ebp),%edx
+     890:	8b 45 0c             	mov    0xc(%ebp),%eax
+     893:	89 cb                	mov    %ecx,%ebx
+     895:	89 df                	mov    %ebx,%edi
+     897:	89 d1                	mov    %edx,%ecx
+     899:	fc                   	cld
+     89a:	f3 aa                	rep stos %al,%es:(%edi)
+     89c:	89 ca                	mov    %ecx,%edx
+     89e:	89 fb                	mov    %edi,%ebx
+     8a0:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     8a3:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     8a6:	90                   	nop
+     8a7:	5b                   	pop    %ebx
+     8a8:	5f                   	pop    %edi
+     8a9:	5d                   	pop    %ebp
+     8aa:	c3                   	ret
+
+000008ab <stosl>:
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+     8ab:	55                   	push   %ebp
+     8ac:	89 e5                	mov    %esp,%ebp
+     8ae:	57                   	push   %edi
+     8af:	53                   	push   %ebx
+  asm volatile("cld; rep stosl" :
+     8b0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     8b3:	8b 55 10             	mov    0x10(%ebp),%edx
+     8b6:	8b 45 0c             	mov    0xc(%ebp),%eax
+     8b9:	89 cb                	mov    %ecx,%ebx
+     8bb:	89 df                	mov    %ebx,%edi
+     8bd:	89 d1                	mov    %edx,%ecx
+     8bf:	fc                   	cld
+     8c0:	f3 ab                	rep stos %eax,%es:(%edi)
+     8c2:	89 ca                	mov    %ecx,%edx
+     8c4:	89 fb                	mov    %edi,%ebx
+     8c6:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     8c9:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     8cc:	90                   	nop
+     8cd:	5b                   	pop    %ebx
+     8ce:	5f                   	pop    %edi
+     8cf:	5d                   	pop    %ebp
+     8d0:	c3                   	ret
+
+000008d1 <movsb>:
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+     8d1:	55                   	push   %ebp
+     8d2:	89 e5                	mov    %esp,%ebp
+     8d4:	57                   	push   %edi
+     8d5:	56                   	push   %esi
+     8d6:	53                   	push   %ebx
+  asm volatile("cld; rep movsb" :
+     8d7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     8da:	8b 55 0c             	mov    0xc(%ebp),%edx
+     8dd:	8b 45 10             	mov    0x10(%ebp),%eax
+     8e0:	89 cb                	mov    %ecx,%ebx
+     8e2:	89 df                	mov    %ebx,%edi
+     8e4:	89 d6                	mov    %edx,%esi
+     8e6:	89 c1                	mov    %eax,%ecx
+     8e8:	fc                   	cld
+     8e9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     8eb:	89 c8                	mov    %ecx,%eax
+     8ed:	89 f2                	mov    %esi,%edx
+     8ef:	89 fb                	mov    %edi,%ebx
+     8f1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     8f4:	89 55 0c             	mov    %edx,0xc(%ebp)
+     8f7:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     8fa:	90                   	nop
+     8fb:	5b                   	pop    %ebx
+     8fc:	5e                   	pop    %esi
+     8fd:	5f                   	pop    %edi
+     8fe:	5d                   	pop    %ebp
+     8ff:	c3                   	ret
+
+00000900 <movsl>:
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+     900:	55                   	push   %ebp
+     901:	89 e5                	mov    %esp,%ebp
+     903:	57                   	push   %edi
+     904:	56                   	push   %esi
+     905:	53                   	push   %ebx
+  asm volatile("cld; rep movsl" :
+     906:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     909:	8b 55 0c             	mov    0xc(%ebp),%edx
+     90c:	8b 45 10             	mov    0x10(%ebp),%eax
+     90f:	89 cb                	mov    %ecx,%ebx
+     911:	89 df                	mov    %ebx,%edi
+     913:	89 d6                	mov    %edx,%esi
+     915:	89 c1                	mov    %eax,%ecx
+     917:	fc                   	cld
+     918:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     91a:	89 c8                	mov    %ecx,%eax
+     91c:	89 f2                	mov    %esi,%edx
+     91e:	89 fb                	mov    %edi,%ebx
+     920:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     923:	89 55 0c             	mov    %edx,0xc(%ebp)
+     926:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     929:	90                   	nop
+     92a:	5b                   	pop    %ebx
+     92b:	5e                   	pop    %esi
+     92c:	5f                   	pop    %edi
+     92d:	5d                   	pop    %ebp
+     92e:	c3                   	ret
+
+0000092f <strcpy>:
+#define ONES        0x01010101
+#define HASZERO(x)  (((x) - ONES) & ~(x) & (ONES << 7))
+
+char*
+strcpy(char *s, char *t)
+{
+     92f:	55                   	push   %ebp
+     930:	89 e5                	mov    %esp,%ebp
+     932:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+     935:	8b 45 08             	mov    0x8(%ebp),%eax
+     938:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     93b:	90                   	nop
+     93c:	8b 55 0c             	mov    0xc(%ebp),%edx
+     93f:	8d 42 01             	lea    0x1(%edx),%eax
+     942:	89 45 0c             	mov    %eax,0xc(%ebp)
+     945:	8b 45 08             	mov    0x8(%ebp),%eax
+     948:	8d 48 01             	lea    0x1(%eax),%ecx
+     94b:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     94e:	0f b6 12             	movzbl (%edx),%edx
+     951:	88 10                	mov    %dl,(%eax)
+     953:	0f b6 00             	movzbl (%eax),%eax
+     956:	84 c0                	test   %al,%al
+     958:	75 e2                	jne    93c <strcpy+0xd>
+    ;
+  return os;
+     95a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     95d:	c9                   	leave
+     95e:	c3                   	ret
+
+0000095f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     95f:	55                   	push   %ebp
+     960:	89 e5                	mov    %esp,%ebp
+  // Aligned words never straddle a page, so reading
+  // whole ones past the end of a string is safe.
+  if((((uint)p | (uint)q) & 3) == 0)
+     962:	8b 55 08             	mov    0x8(%ebp),%edx
+     965:	8b 45 0c             	mov    0xc(%ebp),%eax
+     968:	09 d0                	or     %edx,%eax
+     96a:	83 e0 03             	and    $0x3,%eax
+     96d:	85 c0                	test   %eax,%eax
+     96f:	75 3f                	jne    9b0 <strcmp+0x51>
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     971:	eb 08                	jmp    97b <strcmp+0x1c>
+      p += 4, q += 4;
+     973:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     977:	83 45 0c 04          	addl   $0x4,0xc(%ebp)
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     97b:	8b 45 08             	mov    0x8(%ebp),%eax
+     97e:	8b 10                	mov    (%eax),%edx
+     980:	8b 45 0c             	mov    0xc(%ebp),%eax
+     983:	8b 00                	mov    (%eax),%eax
+     985:	39 c2                	cmp    %eax,%edx
+     987:	75 27                	jne    9b0 <strcmp+0x51>
+     989:	8b 45 08             	mov    0x8(%ebp),%eax
+     98c:	8b 00                	mov    (%eax),%eax
+     98e:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     994:	8b 45 08             	mov    0x8(%ebp),%eax
+     997:	8b 00                	mov    (%eax),%eax
+     999:	f7 d0                	not    %eax
+     99b:	21 d0                	and    %edx,%eax
+     99d:	25 80 80 80 80       	and    $0x80808080,%eax
+     9a2:	85 c0                	test   %eax,%eax
+     9a4:	74 cd                	je     973 <strcmp+0x14>
+  while(*p && *p == *q)
+     9a6:	eb 08                	jmp    9b0 <strcmp+0x51>
+    p++, q++;
+     9a8:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     9ac:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     9b0:	8b 45 08             	mov    0x8(%ebp),%eax
+     9b3:	0f b6 00             	movzbl (%eax),%eax
+     9b6:	84 c0                	test   %al,%al
+     9b8:	74 10                	je     9ca <strcmp+0x6b>
+     9ba:	8b 45 08             	mov    0x8(%ebp),%eax
+     9bd:	0f b6 10             	movzbl (%eax),%edx
+     9c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+     9c3:	0f b6 00             	movzbl (%eax),%eax
+     9c6:	38 c2                	cmp    %al,%dl
+     9c8:	74 de                	je     9a8 <strcmp+0x49>
+  return (uchar)*p - (uchar)*q;
+     9ca:	8b 45 08             	mov    0x8(%ebp),%eax
+     9cd:	0f b6 00             	movzbl (%eax),%eax
+     9d0:	0f b6 d0             	movzbl %al,%edx
+     9d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+     9d6:	0f b6 00             	movzbl (%eax),%eax
+     9d9:	0f b6 c0             	movzbl %al,%eax
+     9dc:	29 c2                	sub    %eax,%edx
+     9de:	89 d0                	mov    %edx,%eax
+}
+     9e0:	5d                   	pop    %ebp
+     9e1:	c3                   	ret
+
+000009e2 <strlen>:
+
+uint
+strlen(char *s)
+{
+     9e2:	55                   	push   %ebp
+     9e3:	89 e5                	mov    %esp,%ebp
+     9e5:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; ((uint)(s+n) & 3) && s[n]; n++)
+     9e8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     9ef:	eb 04                	jmp    9f5 <strlen+0x13>
+     9f1:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     9f5:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     9f8:	8b 45 08             	mov    0x8(%ebp),%eax
+     9fb:	01 d0                	add    %edx,%eax
+     9fd:	83 e0 03             	and    $0x3,%eax
+     a00:	85 c0                	test   %eax,%eax
+     a02:	74 0f                	je     a13 <strlen+0x31>
+     a04:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     a07:	8b 45 08             	mov    0x8(%ebp),%eax
+     a0a:	01 d0                	add    %edx,%eax
+     a0c:	0f b6 00             	movzbl (%eax),%eax
+     a0f:	84 c0                	test   %al,%al
+     a11:	75 de                	jne    9f1 <strlen+0xf>
+    ;
+  if(s[n])
+     a13:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     a16:	8b 45 08             	mov    0x8(%ebp),%eax
+     a19:	01 d0                	add    %edx,%eax
+     a1b:	0f b6 00             	movzbl (%eax),%eax
+     a1e:	84 c0                	test   %al,%al
+     a20:	74 33                	je     a55 <strlen+0x73>
+    while(!HASZERO(*(uint*)(s+n)))
+     a22:	eb 04                	jmp    a28 <strlen+0x46>
+      n += 4;
+     a24:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+    while(!HASZERO(*(uint*)(s+n)))
+     a28:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     a2b:	8b 45 08             	mov    0x8(%ebp),%eax
+     a2e:	01 d0                	add    %edx,%eax
+     a30:	8b 00                	mov    (%eax),%eax
+     a32:	8d 88 ff fe fe fe    	lea    -0x1010101(%eax),%ecx
+     a38:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     a3b:	8b 45 08             	mov    0x8(%ebp),%eax
+     a3e:	01 d0                	add    %edx,%eax
+     a40:	8b 00                	mov    (%eax),%eax
+     a42:	f7 d0                	not    %eax
+     a44:	21 c8                	and    %ecx,%eax
+     a46:	25 80 80 80 80       	and    $0x80808080,%eax
+     a4b:	85 c0                	test   %eax,%eax
+     a4d:	74 d5                	je     a24 <strlen+0x42>
+  for(; s[n]; n++)
+     a4f:	eb 04                	jmp    a55 <strlen+0x73>
+     a51:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     a55:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     a58:	8b 45 08             	mov    0x8(%ebp),%eax
+     a5b:	01 d0                	add    %edx,%eax
+     a5d:	0f b6 00             	movzbl (%eax),%eax
+     a60:	84 c0                	test   %al,%al
+     a62:	75 ed                	jne    a51 <strlen+0x6f>
+    ;
+  return n;
+     a64:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     a67:	c9                   	leave
+     a68:	c3                   	ret
+
+00000a69 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     a69:	55                   	push   %ebp
+     a6a:	89 e5                	mov    %esp,%ebp
+     a6c:	83 ec 10             	sub    $0x10,%esp
+  char *d;
+  uint k;
+
+  d = dst;
+     a6f:	8b 45 08             	mov    0x8(%ebp),%eax
+     a72:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c &= 0xFF;
+     a75:	81 65 0c ff 00 00 00 	andl   $0xff,0xc(%ebp)
+  if(n >= 16){
+     a7c:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     a80:	76 54                	jbe    ad6 <memset+0x6d>
+    k = -(uint)d & 3;  // bytes up to a word boundary
+     a82:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     a85:	f7 d8                	neg    %eax
+     a87:	83 e0 03             	and    $0x3,%eax
+     a8a:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    stosb(d, c, k);
+     a8d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     a90:	50                   	push   %eax
+     a91:	ff 75 0c             	push   0xc(%ebp)
+     a94:	ff 75 fc             	push   -0x4(%ebp)
+     a97:	e8 e9 fd ff ff       	call   885 <stosb>
+     a9c:	83 c4 0c             	add    $0xc,%esp
+    d += k;
+     a9f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     aa2:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n -= k;
+     aa5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     aa8:	29 45 10             	sub    %eax,0x10(%ebp)
+    stosl(d, c*ONES, n/4);
+     aab:	8b 45 10             	mov    0x10(%ebp),%eax
+     aae:	c1 e8 02             	shr    $0x2,%eax
+     ab1:	89 c2                	mov    %eax,%edx
+     ab3:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ab6:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     abc:	52                   	push   %edx
+     abd:	50                   	push   %eax
+     abe:	ff 75 fc             	push   -0x4(%ebp)
+     ac1:	e8 e5 fd ff ff       	call   8ab <stosl>
+     ac6:	83 c4 0c             	add    $0xc,%esp
+    d += n & ~3;
+     ac9:	8b 45 10             	mov    0x10(%ebp),%eax
+     acc:	83 e0 fc             	and    $0xfffffffc,%eax
+     acf:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n &= 3;
+     ad2:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+  }
+  stosb(d, c, n);
+     ad6:	8b 45 10             	mov    0x10(%ebp),%eax
+     ad9:	50                   	push   %eax
+     ada:	ff 75 0c             	push   0xc(%ebp)
+     add:	ff 75 fc             	push   -0x4(%ebp)
+     ae0:	e8 a0 fd ff ff       	call   885 <stosb>
+     ae5:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     ae8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     aeb:	c9                   	leave
+     aec:	c3                   	ret
+
+00000aed <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     aed:	55                   	push   %ebp
+     aee:	89 e5                	mov    %esp,%ebp
+     af0:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s1, *s2;
+
+  s1 = v1;
+     af3:	8b 45 08             	mov    0x8(%ebp),%eax
+     af6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s2 = v2;
+     af9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     afc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     aff:	eb 0c                	jmp    b0d <memcmp+0x20>
+    s1 += 4, s2 += 4, n -= 4;
+     b01:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+     b05:	83 45 f8 04          	addl   $0x4,-0x8(%ebp)
+     b09:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     b0d:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     b11:	76 3e                	jbe    b51 <memcmp+0x64>
+     b13:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     b16:	8b 10                	mov    (%eax),%edx
+     b18:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     b1b:	8b 00                	mov    (%eax),%eax
+     b1d:	39 c2                	cmp    %eax,%edx
+     b1f:	74 e0                	je     b01 <memcmp+0x14>
+  while(n-- > 0){
+     b21:	eb 2e                	jmp    b51 <memcmp+0x64>
+    if(*s1 != *s2)
+     b23:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     b26:	0f b6 10             	movzbl (%eax),%edx
+     b29:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     b2c:	0f b6 00             	movzbl (%eax),%eax
+     b2f:	38 c2                	cmp    %al,%dl
+     b31:	74 16                	je     b49 <memcmp+0x5c>
+      return *s1 - *s2;
+     b33:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     b36:	0f b6 00             	movzbl (%eax),%eax
+     b39:	0f b6 d0             	movzbl %al,%edx
+     b3c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     b3f:	0f b6 00             	movzbl (%eax),%eax
+     b42:	0f b6 c0             	movzbl %al,%eax
+     b45:	29 c2                	sub    %eax,%edx
+     b47:	eb 1a                	jmp    b63 <memcmp+0x76>
+    s1++, s2++;
+     b49:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     b4d:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+  while(n-- > 0){
+     b51:	8b 45 10             	mov    0x10(%ebp),%eax
+     b54:	8d 50 ff             	lea    -0x1(%eax),%edx
+     b57:	89 55 10             	mov    %edx,0x10(%ebp)
+     b5a:	85 c0                	test   %eax,%eax
+     b5c:	75 c5                	jne    b23 <memcmp+0x36>
+  }
+  return 0;
+     b5e:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+     b63:	89 d0                	mov    %edx,%eax
+     b65:	c9                   	leave
+     b66:	c3                   	ret
+
+00000b67 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     b67:	55                   	push   %ebp
+     b68:	89 e5                	mov    %esp,%ebp
+     b6a:	83 ec 14             	sub    $0x14,%esp
+     b6d:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b70:	88 45 ec             	mov    %al,-0x14(%ebp)
+  uint w, cc;
+
+  // Skip whole words holding neither c nor the terminator.
+  for(; ((uint)s & 3) && *s; s++)
+     b73:	eb 17                	jmp    b8c <strchr+0x25>
+    if(*s == c)
+     b75:	8b 45 08             	mov    0x8(%ebp),%eax
+     b78:	0f b6 00             	movzbl (%eax),%eax
+     b7b:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     b7e:	75 08                	jne    b88 <strchr+0x21>
+      return (char*)s;
+     b80:	8b 45 08             	mov    0x8(%ebp),%eax
+     b83:	e9 ad 00 00 00       	jmp    c35 <strchr+0xce>
+  for(; ((uint)s & 3) && *s; s++)
+     b88:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     b8c:	8b 45 08             	mov    0x8(%ebp),%eax
+     b8f:	83 e0 03             	and    $0x3,%eax
+     b92:	85 c0                	test   %eax,%eax
+     b94:	74 0a                	je     ba0 <strchr+0x39>
+     b96:	8b 45 08             	mov    0x8(%ebp),%eax
+     b99:	0f b6 00             	movzbl (%eax),%eax
+     b9c:	84 c0                	test   %al,%al
+     b9e:	75 d5                	jne    b75 <strchr+0xe>
+  cc = (uchar)c * ONES;
+     ba0:	0f b6 45 ec          	movzbl -0x14(%ebp),%eax
+     ba4:	0f b6 c0             	movzbl %al,%eax
+     ba7:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     bad:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(*s)
+     bb0:	8b 45 08             	mov    0x8(%ebp),%eax
+     bb3:	0f b6 00             	movzbl (%eax),%eax
+     bb6:	84 c0                	test   %al,%al
+     bb8:	74 6c                	je     c26 <strchr+0xbf>
+    for(; w = *(uint*)s, !HASZERO(w) && !HASZERO(w ^ cc); s += 4)
+     bba:	eb 04                	jmp    bc0 <strchr+0x59>
+     bbc:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     bc0:	8b 45 08             	mov    0x8(%ebp),%eax
+     bc3:	8b 00                	mov    (%eax),%eax
+     bc5:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     bc8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     bcb:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     bd1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     bd4:	f7 d0                	not    %eax
+     bd6:	21 d0                	and    %edx,%eax
+     bd8:	25 80 80 80 80       	and    $0x80808080,%eax
+     bdd:	85 c0                	test   %eax,%eax
+     bdf:	75 26                	jne    c07 <strchr+0xa0>
+     be1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     be4:	33 45 fc             	xor    -0x4(%ebp),%eax
+     be7:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     bed:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     bf0:	33 45 fc             	xor    -0x4(%ebp),%eax
+     bf3:	f7 d0                	not    %eax
+     bf5:	21 d0                	and    %edx,%eax
+     bf7:	25 80 80 80 80       	and    $0x80808080,%eax
+     bfc:	85 c0                	test   %eax,%eax
+     bfe:	75 07                	jne    c07 <strchr+0xa0>
+     c00:	b8 01 00 00 00       	mov    $0x1,%eax
+     c05:	eb 05                	jmp    c0c <strchr+0xa5>
+     c07:	b8 00 00 00 00       	mov    $0x0,%eax
+     c0c:	85 c0                	test   %eax,%eax
+     c0e:	75 ac                	jne    bbc <strchr+0x55>
+      ;
+  for(; *s; s++)
+     c10:	eb 14                	jmp    c26 <strchr+0xbf>
+    if(*s == c)
+     c12:	8b 45 08             	mov    0x8(%ebp),%eax
+     c15:	0f b6 00             	movzbl (%eax),%eax
+     c18:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     c1b:	75 05                	jne    c22 <strchr+0xbb>
+      return (char*)s;
+     c1d:	8b 45 08             	mov    0x8(%ebp),%eax
+     c20:	eb 13                	jmp    c35 <strchr+0xce>
+  for(; *s; s++)
+     c22:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     c26:	8b 45 08             	mov    0x8(%ebp),%eax
+     c29:	0f b6 00             	movzbl (%eax),%eax
+     c2c:	84 c0                	test   %al,%al
+     c2e:	75 e2                	jne    c12 <strchr+0xab>
+  return 0;
+     c30:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     c35:	c9                   	leave
+     c36:	c3                   	ret
+
+00000c37 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     c37:	55                   	push   %ebp
+     c38:	89 e5                	mov    %esp,%ebp
+     c3a:	83 ec 18             	sub    $0x18,%esp
+  int i, c;
+
+  for(i=0; i+1 < max; ){
+     c3d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     c44:	eb 37                	jmp    c7d <gets+0x46>
+    c = fgetc(0);
+     c46:	83 ec 0c             	sub    $0xc,%esp
+     c49:	6a 00                	push   $0x0
+     c4b:	e8 2e 0e 00 00       	call   1a7e <fgetc>
+     c50:	83 c4 10             	add    $0x10,%esp
+     c53:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(c < 0)
+     c56:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     c5a:	78 2e                	js     c8a <gets+0x53>
+      break;
+    buf[i++] = c;
+     c5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c5f:	8d 50 01             	lea    0x1(%eax),%edx
+     c62:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     c65:	89 c2                	mov    %eax,%edx
+     c67:	8b 45 08             	mov    0x8(%ebp),%eax
+     c6a:	01 d0                	add    %edx,%eax
+     c6c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     c6f:	88 10                	mov    %dl,(%eax)
+    if(c == '\n' || c == '\r')
+     c71:	83 7d f0 0a          	cmpl   $0xa,-0x10(%ebp)
+     c75:	74 14                	je     c8b <gets+0x54>
+     c77:	83 7d f0 0d          	cmpl   $0xd,-0x10(%ebp)
+     c7b:	74 0e                	je     c8b <gets+0x54>
+  for(i=0; i+1 < max; ){
+     c7d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c80:	83 c0 01             	add    $0x1,%eax
+     c83:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     c86:	7f be                	jg     c46 <gets+0xf>
+     c88:	eb 01                	jmp    c8b <gets+0x54>
+      break;
+     c8a:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     c8b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     c8e:	8b 45 08             	mov    0x8(%ebp),%eax
+     c91:	01 d0                	add    %edx,%eax
+     c93:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     c96:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     c99:	c9                   	leave
+     c9a:	c3                   	ret
+
+00000c9b <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     c9b:	55                   	push   %ebp
+     c9c:	89 e5                	mov    %esp,%ebp
+     c9e:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     ca1:	83 ec 08             	sub    $0x8,%esp
+     ca4:	6a 00                	push   $0x0
+     ca6:	ff 75 08             	push   0x8(%ebp)
+     ca9:	e8 3b 02 00 00       	call   ee9 <open>
+     cae:	83 c4 10             	add    $0x10,%esp
+     cb1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     cb4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     cb8:	79 07                	jns    cc1 <stat+0x26>
+    return -1;
+     cba:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     cbf:	eb 25                	jmp    ce6 <stat+0x4b>
+  r = fstat(fd, st);
+     cc1:	83 ec 08             	sub    $0x8,%esp
+     cc4:	ff 75 0c             	push   0xc(%ebp)
+     cc7:	ff 75 f4             	push   -0xc(%ebp)
+     cca:	e8 47 02 00 00       	call   f16 <fstat>
+     ccf:	83 c4 10             	add    $0x10,%esp
+     cd2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     cd5:	83 ec 0c             	sub    $0xc,%esp
+     cd8:	ff 75 f4             	push   -0xc(%ebp)
+     cdb:	e8 c7 0e 00 00       	call   1ba7 <close>
+     ce0:	83 c4 10             	add    $0x10,%esp
+  return r;
+     ce3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     ce6:	c9                   	leave
+     ce7:	c3                   	ret
+
+00000ce8 <atoi>:
+
+int
+atoi(const char *s)
+{
+     ce8:	55                   	push   %ebp
+     ce9:	89 e5                	mov    %esp,%ebp
+     ceb:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     cee:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     cf5:	eb 25                	jmp    d1c <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     cf7:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     cfa:	89 d0                	mov    %edx,%eax
+     cfc:	c1 e0 02             	shl    $0x2,%eax
+     cff:	01 d0                	add    %edx,%eax
+     d01:	01 c0                	add    %eax,%eax
+     d03:	89 c1                	mov    %eax,%ecx
+     d05:	8b 45 08             	mov    0x8(%ebp),%eax
+     d08:	8d 50 01             	lea    0x1(%eax),%edx
+     d0b:	89 55 08             	mov    %edx,0x8(%ebp)
+     d0e:	0f b6 00             	movzbl (%eax),%eax
+     d11:	0f be c0             	movsbl %al,%eax
+     d14:	01 c8                	add    %ecx,%eax
+     d16:	83 e8 30             	sub    $0x30,%eax
+     d19:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     d1c:	8b 45 08             	mov    0x8(%ebp),%eax
+     d1f:	0f b6 00             	movzbl (%eax),%eax
+     d22:	3c 2f                	cmp    $0x2f,%al
+     d24:	7e 0a                	jle    d30 <atoi+0x48>
+     d26:	8b 45 08             	mov    0x8(%ebp),%eax
+     d29:	0f b6 00             	movzbl (%eax),%eax
+     d2c:	3c 39                	cmp    $0x39,%al
+     d2e:	7e c7                	jle    cf7 <atoi+0xf>
+  return n;
+     d30:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     d33:	c9                   	leave
+     d34:	c3                   	ret
+
+00000d35 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     d35:	55                   	push   %ebp
+     d36:	89 e5                	mov    %esp,%ebp
+     d38:	83 ec 10             	sub    $0x10,%esp
+  char *d, *s;
+  int k;
+
+  if(n <= 0)
+     d3b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     d3f:	7f 08                	jg     d49 <memmove+0x14>
+    return vdst;
+     d41:	8b 45 08             	mov    0x8(%ebp),%eax
+     d44:	e9 17 01 00 00       	jmp    e60 <memmove+0x12b>
+  d = vdst;
+     d49:	8b 45 08             	mov    0x8(%ebp),%eax
+     d4c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s = vsrc;
+     d4f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     d52:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  if(s < d && s + n > d){
+     d55:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     d58:	3b 45 fc             	cmp    -0x4(%ebp),%eax
+     d5b:	0f 83 84 00 00 00    	jae    de5 <memmove+0xb0>
+     d61:	8b 55 10             	mov    0x10(%ebp),%edx
+     d64:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     d67:	01 d0                	add    %edx,%eax
+     d69:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     d6c:	73 77                	jae    de5 <memmove+0xb0>
+    s += n;
+     d6e:	8b 45 10             	mov    0x10(%ebp),%eax
+     d71:	01 45 f8             	add    %eax,-0x8(%ebp)
+    d += n;
+     d74:	8b 45 10             	mov    0x10(%ebp),%eax
+     d77:	01 45 fc             	add    %eax,-0x4(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     d7a:	eb 17                	jmp    d93 <memmove+0x5e>
+      *--d = *--s, n--;
+     d7c:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     d80:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     d84:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     d87:	0f b6 10             	movzbl (%eax),%edx
+     d8a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d8d:	88 10                	mov    %dl,(%eax)
+     d8f:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     d93:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     d97:	7e 22                	jle    dbb <memmove+0x86>
+     d99:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d9c:	83 e0 03             	and    $0x3,%eax
+     d9f:	85 c0                	test   %eax,%eax
+     da1:	75 d9                	jne    d7c <memmove+0x47>
+    for(; n >= 4; n -= 4){
+     da3:	eb 16                	jmp    dbb <memmove+0x86>
+      d -= 4;
+     da5:	83 6d fc 04          	subl   $0x4,-0x4(%ebp)
+      s -= 4;
+     da9:	83 6d f8 04          	subl   $0x4,-0x8(%ebp)
+      *(uint*)d = *(uint*)s;
+     dad:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     db0:	8b 10                	mov    (%eax),%edx
+     db2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     db5:	89 10                	mov    %edx,(%eax)
+    for(; n >= 4; n -= 4){
+     db7:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+     dbb:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     dbf:	7f e4                	jg     da5 <memmove+0x70>
+    }
+    while(n-- > 0)
+     dc1:	eb 13                	jmp    dd6 <memmove+0xa1>
+      *--d = *--s;
+     dc3:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     dc7:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     dcb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     dce:	0f b6 10             	movzbl (%eax),%edx
+     dd1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     dd4:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+     dd6:	8b 45 10             	mov    0x10(%ebp),%eax
+     dd9:	8d 50 ff             	lea    -0x1(%eax),%edx
+     ddc:	89 55 10             	mov    %edx,0x10(%ebp)
+     ddf:	85 c0                	test   %eax,%eax
+     de1:	7f e0                	jg     dc3 <memmove+0x8e>
+  if(s < d && s + n > d){
+     de3:	eb 78                	jmp    e5d <memmove+0x128>
+  } else {
+    if(n >= 16){
+     de5:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     de9:	7e 61                	jle    e4c <memmove+0x117>
+      k = -(uint)d & 3;
+     deb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     dee:	f7 d8                	neg    %eax
+     df0:	83 e0 03             	and    $0x3,%eax
+     df3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      movsb(d, s, k);
+     df6:	ff 75 f4             	push   -0xc(%ebp)
+     df9:	ff 75 f8             	push   -0x8(%ebp)
+     dfc:	ff 75 fc             	push   -0x4(%ebp)
+     dff:	e8 cd fa ff ff       	call   8d1 <movsb>
+     e04:	83 c4 0c             	add    $0xc,%esp
+      d += k;
+     e07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e0a:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += k;
+     e0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e10:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n -= k;
+     e13:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e16:	29 45 10             	sub    %eax,0x10(%ebp)
+      movsl(d, s, n/4);
+     e19:	8b 45 10             	mov    0x10(%ebp),%eax
+     e1c:	8d 50 03             	lea    0x3(%eax),%edx
+     e1f:	85 c0                	test   %eax,%eax
+     e21:	0f 48 c2             	cmovs  %edx,%eax
+     e24:	c1 f8 02             	sar    $0x2,%eax
+     e27:	50                   	push   %eax
+     e28:	ff 75 f8             	push   -0x8(%ebp)
+     e2b:	ff 75 fc             	push   -0x4(%ebp)
+     e2e:	e8 cd fa ff ff       	call   900 <movsl>
+     e33:	83 c4 0c             	add    $0xc,%esp
+      d += n & ~3;
+     e36:	8b 45 10             	mov    0x10(%ebp),%eax
+     e39:	83 e0 fc             	and    $0xfffffffc,%eax
+     e3c:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += n & ~3;
+     e3f:	8b 45 10             	mov    0x10(%ebp),%eax
+     e42:	83 e0 fc             	and    $0xfffffffc,%eax
+     e45:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n &= 3;
+     e48:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+    }
+    movsb(d, s, n);
+     e4c:	ff 75 10             	push   0x10(%ebp)
+     e4f:	ff 75 f8             	push   -0x8(%ebp)
+     e52:	ff 75 fc             	push   -0x4(%ebp)
+     e55:	e8 77 fa ff ff       	call   8d1 <movsb>
+     e5a:	83 c4 0c             	add    $0xc,%esp
+  }
+  return vdst;
+     e5d:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     e60:	c9                   	leave
+     e61:	c3                   	ret
+
+00000e62 <_fork>:
+    movl %esp, %ecx; \
+    movl $1f, %edx; \
+    sysenter; \
+  1: ret
+
+RAWSYSCALL(fork)
+     e62:	b8 01 00 00 00       	mov    $0x1,%eax
+     e67:	89 e1                	mov    %esp,%ecx
+     e69:	ba 70 0e 00 00       	mov    $0xe70,%edx
+     e6e:	0f 34                	sysenter
+     e70:	c3                   	ret
+
+00000e71 <_exit>:
+RAWSYSCALL(exit)
+     e71:	b8 02 00 00 00       	mov    $0x2,%eax
+     e76:	89 e1                	mov    %esp,%ecx
+     e78:	ba 7f 0e 00 00       	mov    $0xe7f,%edx
+     e7d:	0f 34                	sysenter
+     e7f:	c3                   	ret
+
+00000e80 <wait>:
+SYSCALL(wait)
+     e80:	b8 03 00 00 00       	mov    $0x3,%eax
+     e85:	89 e1                	mov    %esp,%ecx
+     e87:	ba 8e 0e 00 00       	mov    $0xe8e,%edx
+     e8c:	0f 34                	sysenter
+     e8e:	c3                   	ret
+
+00000e8f <pipe>:
+SYSCALL(pipe)
+     e8f:	b8 04 00 00 00       	mov    $0x4,%eax
+     e94:	89 e1                	mov    %esp,%ecx
+     e96:	ba 9d 0e 00 00       	mov    $0xe9d,%edx
+     e9b:	0f 34                	sysenter
+     e9d:	c3                   	ret
+
+00000e9e <read>:
+SYSCALL(read)
+     e9e:	b8 05 00 00 00       	mov    $0x5,%eax
+     ea3:	89 e1                	mov    %esp,%ecx
+     ea5:	ba ac 0e 00 00       	mov    $0xeac,%edx
+     eaa:	0f 34                	sysenter
+     eac:	c3                   	ret
+
+00000ead <write>:
+SYSCALL(write)
+     ead:	b8 10 00 00 00       	mov    $0x10,%eax
+     eb2:	89 e1                	mov    %esp,%ecx
+     eb4:	ba bb 0e 00 00       	mov    $0xebb,%edx
+     eb9:	0f 34                	sysenter
+     ebb:	c3                   	ret
+
+00000ebc <_close>:
+RAWSYSCALL(close)
+     ebc:	b8 15 00 00 00       	mov    $0x15,%eax
+     ec1:	89 e1                	mov    %esp,%ecx
+     ec3:	ba ca 0e 00 00       	mov    $0xeca,%edx
+     ec8:	0f 34                	sysenter
+     eca:	c3                   	ret
+
+00000ecb <kill>:
+SYSCALL(kill)
+     ecb:	b8 06 00 00 00       	mov    $0x6,%eax
+     ed0:	89 e1                	mov    %esp,%ecx
+     ed2:	ba d9 0e 00 00       	mov    $0xed9,%edx
+     ed7:	0f 34                	sysenter
+     ed9:	c3                   	ret
+
+00000eda <_exec>:
+RAWSYSCALL(exec)
+     eda:	b8 07 00 00 00       	mov    $0x7,%eax
+     edf:	89 e1                	mov    %esp,%ecx
+     ee1:	ba e8 0e 00 00       	mov    $0xee8,%edx
+     ee6:	0f 34                	sysenter
+     ee8:	c3                   	ret
+
+00000ee9 <open>:
+SYSCALL(open)
+     ee9:	b8 0f 00 00 00       	mov    $0xf,%eax
+     eee:	89 e1                	mov    %esp,%ecx
+     ef0:	ba f7 0e 00 00       	mov    $0xef7,%edx
+     ef5:	0f 34                	sysenter
+     ef7:	c3                   	ret
+
+00000ef8 <mknod>:
+SYSCALL(mknod)
+     ef8:	b8 11 00 00 00       	mov    $0x11,%eax
+     efd:	89 e1                	mov    %esp,%ecx
+     eff:	ba 06 0f 00 00       	mov    $0xf06,%edx
+     f04:	0f 34                	sysenter
+     f06:	c3                   	ret
+
+00000f07 <unlink>:
+SYSCALL(unlink)
+     f07:	b8 12 00 00 00       	mov    $0x12,%eax
+     f0c:	89 e1                	mov    %esp,%ecx
+     f0e:	ba 15 0f 00 00       	mov    $0xf15,%edx
+     f13:	0f 34                	sysenter
+     f15:	c3                   	ret
+
+00000f16 <fstat>:
+SYSCALL(fstat)
+     f16:	b8 08 00 00 00       	mov    $0x8,%eax
+     f1b:	89 e1                	mov    %esp,%ecx
+     f1d:	ba 24 0f 00 00       	mov    $0xf24,%edx
+     f22:	0f 34                	sysenter
+     f24:	c3                   	ret
+
+00000f25 <link>:
+SYSCALL(link)
+     f25:	b8 13 00 00 00       	mov    $0x13,%eax
+     f2a:	89 e1                	mov    %esp,%ecx
+     f2c:	ba 33 0f 00 00       	mov    $0xf33,%edx
+     f31:	0f 34                	sysenter
+     f33:	c3                   	ret
+
+00000f34 <mkdir>:
+SYSCALL(mkdir)
+     f34:	b8 14 00 00 00       	mov    $0x14,%eax
+     f39:	89 e1                	mov    %esp,%ecx
+     f3b:	ba 42 0f 00 00       	mov    $0xf42,%edx
+     f40:	0f 34                	sysenter
+     f42:	c3                   	ret
+
+00000f43 <chdir>:
+SYSCALL(chdir)
+     f43:	b8 09 00 00 00       	mov    $0x9,%eax
+     f48:	89 e1                	mov    %esp,%ecx
+     f4a:	ba 51 0f 00 00       	mov    $0xf51,%edx
+     f4f:	0f 34                	sysenter
+     f51:	c3                   	ret
+
+00000f52 <dup>:
+SYSCALL(dup)
+     f52:	b8 0a 00 00 00       	mov    $0xa,%eax
+     f57:	89 e1                	mov    %esp,%ecx
+     f59:	ba 60 0f 00 00       	mov    $0xf60,%edx
+     f5e:	0f 34                	sysenter
+     f60:	c3                   	ret
+
+00000f61 <getpid>:
+SYSCALL(getpid)
+     f61:	b8 0b 00 00 00       	mov    $0xb,%eax
+     f66:	89 e1                	mov    %esp,%ecx
+     f68:	ba 6f 0f 00 00       	mov    $0xf6f,%edx
+     f6d:	0f 34                	sysenter
+     f6f:	c3                   	ret
+
+00000f70 <sbrk>:
+SYSCALL(sbrk)
+     f70:	b8 0c 00 00 00       	mov    $0xc,%eax
+     f75:	89 e1                	mov    %esp,%ecx
+     f77:	ba 7e 0f 00 00       	mov    $0xf7e,%edx
+     f7c:	0f 34                	sysenter
+     f7e:	c3                   	ret
+
+00000f7f <sleep>:
+SYSCALL(sleep)
+     f7f:	b8 0d 00 00 00       	mov    $0xd,%eax
+     f84:	89 e1                	mov    %esp,%ecx
+     f86:	ba 8d 0f 00 00       	mov    $0xf8d,%edx
+     f8b:	0f 34                	sysenter
+     f8d:	c3                   	ret
+
+00000f8e <uptime>:
+SYSCALL(uptime)
+     f8e:	b8 0e 00 00 00       	mov    $0xe,%eax
+     f93:	89 e1                	mov    %esp,%ecx
+     f95:	ba 9c 0f 00 00       	mov    $0xf9c,%edx
+     f9a:	0f 34                	sysenter
+     f9c:	c3                   	ret
+
+00000f9d <getproc>:
+SYSCALL(getproc)
+     f9d:	b8 16 00 00 00       	mov    $0x16,%eax
+     fa2:	89 e1                	mov    %esp,%ecx
+     fa4:	ba ab 0f 00 00       	mov    $0xfab,%edx
+     fa9:	0f 34                	sysenter
+     fab:	c3                   	ret
+
+00000fac <getpgs>:
+SYSCALL(getpgs)
+     fac:	b8 17 00 00 00       	mov    $0x17,%eax
+     fb1:	89 e1                	mov    %esp,%ecx
+     fb3:	ba ba 0f 00 00       	mov    $0xfba,%edx
+     fb8:	0f 34                	sysenter
+     fba:	c3                   	ret
+
+00000fbb <loadproc>:
+SYSCALL(loadproc)
+     fbb:	b8 18 00 00 00       	mov    $0x18,%eax
+     fc0:	89 e1                	mov    %esp,%ecx
+     fc2:	ba c9 0f 00 00       	mov    $0xfc9,%edx
+     fc7:	0f 34                	sysenter
+     fc9:	c3                   	ret
+
+00000fca <iosubmit>:
+SYSCALL(iosubmit)
+     fca:	b8 19 00 00 00       	mov    $0x19,%eax
+     fcf:	89 e1                	mov    %esp,%ecx
+     fd1:	ba d8 0f 00 00       	mov    $0xfd8,%edx
+     fd6:	0f 34                	sysenter
+     fd8:	c3                   	ret
+
+00000fd9 <sysstat>:
+SYSCALL(sysstat)
+     fd9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     fde:	89 e1                	mov    %esp,%ecx
+     fe0:	ba e7 0f 00 00       	mov    $0xfe7,%edx
+     fe5:	0f 34                	sysenter
+     fe7:	c3                   	ret
+
+00000fe8 <splice>:
+SYSCALL(splice)
+     fe8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     fed:	89 e1                	mov    %esp,%ecx
+     fef:	ba f6 0f 00 00       	mov    $0xff6,%edx
+     ff4:	0f 34                	sysenter
+     ff6:	c3                   	ret
+
+00000ff7 <fsync>:
+SYSCALL(fsync)
+     ff7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     ffc:	89 e1                	mov    %esp,%ecx
+     ffe:	ba 05 10 00 00       	mov    $0x1005,%edx
+    1003:	0f 34                	sysenter
+    1005:	c3                   	ret
+
+00001006 <fdatasync>:
+SYSCALL(fdatasync)
+    1006:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    100b:	89 e1                	mov    %esp,%ecx
+    100d:	ba 14 10 00 00       	mov    $0x1014,%edx
+    1012:	0f 34                	sysenter
+    1014:	c3                   	ret
+
+00001015 <lseek>:
+SYSCALL(lseek)
+    1015:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    101a:	89 e1                	mov    %esp,%ecx
+    101c:	ba 23 10 00 00       	mov    $0x1023,%edx
+    1021:	0f 34                	sysenter
+    1023:	c3                   	ret
+
+00001024 <dmesg>:
+SYSCALL(dmesg)
+    1024:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1029:	89 e1                	mov    %esp,%ecx
+    102b:	ba 32 10 00 00       	mov    $0x1032,%edx
+    1030:	0f 34                	sysenter
+    1032:	c3                   	ret
+
+00001033 <lockstat>:
+SYSCALL(lockstat)
+    1033:	b8 20 00 00 00       	mov    $0x20,%eax
+    1038:	89 e1                	mov    %esp,%ecx
+    103a:	ba 41 10 00 00       	mov    $0x1041,%edx
+    103f:	0f 34                	sysenter
+    1041:	c3                   	ret
+
+00001042 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1042:	55                   	push   %ebp
+    1043:	89 e5                	mov    %esp,%ebp
+    1045:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    1048:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+    104f:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+    1053:	74 17                	je     106c <printint+0x2a>
+    1055:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    1059:	79 11                	jns    106c <printint+0x2a>
+    neg = 1;
+    105b:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+    1062:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1065:	f7 d8                	neg    %eax
+    1067:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    106a:	eb 06                	jmp    1072 <printint+0x30>
+  } else {
+    x = xx;
+    106c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    106f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+    1072:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+    1079:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    107c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    107f:	ba 00 00 00 00       	mov    $0x0,%edx
+    1084:	f7 f1                	div    %ecx
+    1086:	89 d1                	mov    %edx,%ecx
+    1088:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    108b:	8d 50 01             	lea    0x1(%eax),%edx
+    108e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    1091:	0f b6 91 ac 24 00 00 	movzbl 0x24ac(%ecx),%edx
+    1098:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+    109c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    109f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    10a2:	ba 00 00 00 00       	mov    $0x0,%edx
+    10a7:	f7 f1                	div    %ecx
+    10a9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    10ac:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    10b0:	75 c7                	jne    1079 <printint+0x37>
+  if(neg)
+    10b2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    10b6:	74 2d                	je     10e5 <printint+0xa3>
+    buf[i++] = '-';
+    10b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10bb:	8d 50 01             	lea    0x1(%eax),%edx
+    10be:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    10c1:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+    10c6:	eb 1d                	jmp    10e5 <printint+0xa3>
+    fputc(fd, buf[i]);
+    10c8:	8d 55 dc             	lea    -0x24(%ebp),%edx
+    10cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10ce:	01 d0                	add    %edx,%eax
+    10d0:	0f b6 00             	movzbl (%eax),%eax
+    10d3:	0f be c0             	movsbl %al,%eax
+    10d6:	83 ec 08             	sub    $0x8,%esp
+    10d9:	50                   	push   %eax
+    10da:	ff 75 08             	push   0x8(%ebp)
+    10dd:	e8 f8 08 00 00       	call   19da <fputc>
+    10e2:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+    10e5:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    10e9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    10ed:	79 d9                	jns    10c8 <printint+0x86>
+}
+    10ef:	90                   	nop
+    10f0:	90                   	nop
+    10f1:	c9                   	leave
+    10f2:	c3                   	ret
+
+000010f3 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    10f3:	55                   	push   %ebp
+    10f4:	89 e5                	mov    %esp,%ebp
+    10f6:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+    10f9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+    1100:	8d 45 0c             	lea    0xc(%ebp),%eax
+    1103:	83 c0 04             	add    $0x4,%eax
+    1106:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+    1109:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    1110:	e9 4a 01 00 00       	jmp    125f <printf+0x16c>
+    c = fmt[i] & 0xff;
+    1115:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1118:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    111b:	01 d0                	add    %edx,%eax
+    111d:	0f b6 00             	movzbl (%eax),%eax
+    1120:	0f be c0             	movsbl %al,%eax
+    1123:	25 ff 00 00 00       	and    $0xff,%eax
+    1128:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+    112b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    112f:	75 28                	jne    1159 <printf+0x66>
+      if(c == '%'){
+    1131:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    1135:	75 0c                	jne    1143 <printf+0x50>
+        state = '%';
+    1137:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+    113e:	e9 18 01 00 00       	jmp    125b <printf+0x168>
+      } else {
+        fputc(fd, c);
+    1143:	83 ec 08             	sub    $0x8,%esp
+    1146:	ff 75 e4             	push   -0x1c(%ebp)
+    1149:	ff 75 08             	push   0x8(%ebp)
+    114c:	e8 89 08 00 00       	call   19da <fputc>
+    1151:	83 c4 10             	add    $0x10,%esp
+    1154:	e9 02 01 00 00       	jmp    125b <printf+0x168>
+      }
+    } else if(state == '%'){
+    1159:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+    115d:	0f 85 f8 00 00 00    	jne    125b <printf+0x168>
+      if(c == 'd'){
+    1163:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+    1167:	75 1e                	jne    1187 <printf+0x94>
+        printint(fd, *ap, 10, 1);
+    1169:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    116c:	8b 00                	mov    (%eax),%eax
+    116e:	6a 01                	push   $0x1
+    1170:	6a 0a                	push   $0xa
+    1172:	50                   	push   %eax
+    1173:	ff 75 08             	push   0x8(%ebp)
+    1176:	e8 c7 fe ff ff       	call   1042 <printint>
+    117b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    117e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    1182:	e9 cd 00 00 00       	jmp    1254 <printf+0x161>
+      } else if(c == 'x' || c == 'p'){
+    1187:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+    118b:	74 06                	je     1193 <printf+0xa0>
+    118d:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+    1191:	75 1e                	jne    11b1 <printf+0xbe>
+        printint(fd, *ap, 16, 0);
+    1193:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1196:	8b 00                	mov    (%eax),%eax
+    1198:	6a 00                	push   $0x0
+    119a:	6a 10                	push   $0x10
+    119c:	50                   	push   %eax
+    119d:	ff 75 08             	push   0x8(%ebp)
+    11a0:	e8 9d fe ff ff       	call   1042 <printint>
+    11a5:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    11a8:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    11ac:	e9 a3 00 00 00       	jmp    1254 <printf+0x161>
+      } else if(c == 's'){
+    11b1:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+    11b5:	75 43                	jne    11fa <printf+0x107>
+        s = (char*)*ap;
+    11b7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    11ba:	8b 00                	mov    (%eax),%eax
+    11bc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+    11bf:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+    11c3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    11c7:	75 25                	jne    11ee <printf+0xfb>
+          s = "(null)";
+    11c9:	c7 45 f4 c0 1f 00 00 	movl   $0x1fc0,-0xc(%ebp)
+        while(*s != 0){
+    11d0:	eb 1c                	jmp    11ee <printf+0xfb>
+          fputc(fd, *s);
+    11d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11d5:	0f b6 00             	movzbl (%eax),%eax
+    11d8:	0f be c0             	movsbl %al,%eax
+    11db:	83 ec 08             	sub    $0x8,%esp
+    11de:	50                   	push   %eax
+    11df:	ff 75 08             	push   0x8(%ebp)
+    11e2:	e8 f3 07 00 00       	call   19da <fputc>
+    11e7:	83 c4 10             	add    $0x10,%esp
+          s++;
+    11ea:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+    11ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11f1:	0f b6 00             	movzbl (%eax),%eax
+    11f4:	84 c0                	test   %al,%al
+    11f6:	75 da                	jne    11d2 <printf+0xdf>
+    11f8:	eb 5a                	jmp    1254 <printf+0x161>
+        }
+      } else if(c == 'c'){
+    11fa:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+    11fe:	75 1a                	jne    121a <printf+0x127>
+        fputc(fd, *ap);
+    1200:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1203:	8b 00                	mov    (%eax),%eax
+    1205:	83 ec 08             	sub    $0x8,%esp
+    1208:	50                   	push   %eax
+    1209:	ff 75 08             	push   0x8(%ebp)
+    120c:	e8 c9 07 00 00       	call   19da <fputc>
+    1211:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    1214:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    1218:	eb 3a                	jmp    1254 <printf+0x161>
+      } else if(c == '%'){
+    121a:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    121e:	75 13                	jne    1233 <printf+0x140>
+        fputc(fd, c);
+    1220:	83 ec 08             	sub    $0x8,%esp
+    1223:	ff 75 e4             	push   -0x1c(%ebp)
+    1226:	ff 75 08             	push   0x8(%ebp)
+    1229:	e8 ac 07 00 00       	call   19da <fputc>
+    122e:	83 c4 10             	add    $0x10,%esp
+    1231:	eb 21                	jmp    1254 <printf+0x161>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        fputc(fd, '%');
+    1233:	83 ec 08             	sub    $0x8,%esp
+    1236:	6a 25                	push   $0x25
+    1238:	ff 75 08             	push   0x8(%ebp)
+    123b:	e8 9a 07 00 00       	call   19da <fputc>
+    1240:	83 c4 10             	add    $0x10,%esp
+        fputc(fd, c);
+    1243:	83 ec 08             	sub    $0x8,%esp
+    1246:	ff 75 e4             	push   -0x1c(%ebp)
+    1249:	ff 75 08             	push   0x8(%ebp)
+    124c:	e8 89 07 00 00       	call   19da <fputc>
+    1251:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+    1254:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+    125b:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    125f:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1262:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1265:	01 d0                	add    %edx,%eax
+    1267:	0f b6 00             	movzbl (%eax),%eax
+    126a:	84 c0                	test   %al,%al
+    126c:	0f 85 a3 fe ff ff    	jne    1115 <printf+0x22>
+    }
+  }
+}
+    1272:	90                   	nop
+    1273:	90                   	nop
+    1274:	c9                   	leave
+    1275:	c3                   	ret
+
+00001276 <binof>:
+static struct chunk *bins[NBIN];       // free large chunks
+static struct chunk *top;              // end marker of newest heap segment
+
+static int
+binof(uint size)
+{
+    1276:	55                   	push   %ebp
+    1277:	89 e5                	mov    %esp,%ebp
+    1279:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  i = 0;
+    127c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+    1283:	c1 6d 08 05          	shrl   $0x5,0x8(%ebp)
+    1287:	eb 07                	jmp    1290 <binof+0x1a>
+    i++;
+    1289:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+    128d:	d1 6d 08             	shrl   0x8(%ebp)
+    1290:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1294:	74 06                	je     129c <binof+0x26>
+    1296:	83 7d fc 19          	cmpl   $0x19,-0x4(%ebp)
+    129a:	7e ed                	jle    1289 <binof+0x13>
+  return i;
+    129c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    129f:	c9                   	leave
+    12a0:	c3                   	ret
+
+000012a1 <bininsert>:
+
+static void
+bininsert(struct chunk *c)
+{
+    12a1:	55                   	push   %ebp
+    12a2:	89 e5                	mov    %esp,%ebp
+    12a4:	83 ec 10             	sub    $0x10,%esp
+  struct chunk **b;
+
+  b = &bins[binof(CSIZE(c))];
+    12a7:	8b 45 08             	mov    0x8(%ebp),%eax
+    12aa:	8b 00                	mov    (%eax),%eax
+    12ac:	83 e0 f8             	and    $0xfffffff8,%eax
+    12af:	50                   	push   %eax
+    12b0:	e8 c1 ff ff ff       	call   1276 <binof>
+    12b5:	83 c4 04             	add    $0x4,%esp
+    12b8:	c1 e0 02             	shl    $0x2,%eax
+    12bb:	05 e0 24 00 00       	add    $0x24e0,%eax
+    12c0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c->prev = 0;
+    12c3:	8b 45 08             	mov    0x8(%ebp),%eax
+    12c6:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  c->next = *b;
+    12cd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    12d0:	8b 10                	mov    (%eax),%edx
+    12d2:	8b 45 08             	mov    0x8(%ebp),%eax
+    12d5:	89 50 08             	mov    %edx,0x8(%eax)
+  if(*b)
+    12d8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    12db:	8b 00                	mov    (%eax),%eax
+    12dd:	85 c0                	test   %eax,%eax
+    12df:	74 0b                	je     12ec <bininsert+0x4b>
+    (*b)->prev = c;
+    12e1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    12e4:	8b 00                	mov    (%eax),%eax
+    12e6:	8b 55 08             	mov    0x8(%ebp),%edx
+    12e9:	89 50 0c             	mov    %edx,0xc(%eax)
+  *b = c;
+    12ec:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    12ef:	8b 55 08             	mov    0x8(%ebp),%edx
+    12f2:	89 10                	mov    %edx,(%eax)
+}
+    12f4:	90                   	nop
+    12f5:	c9                   	leave
+    12f6:	c3                   	ret
+
+000012f7 <binremove>:
+
+static void
+binremove(struct chunk *c)
+{
+    12f7:	55                   	push   %ebp
+    12f8:	89 e5                	mov    %esp,%ebp
+  if(c->prev)
+    12fa:	8b 45 08             	mov    0x8(%ebp),%eax
+    12fd:	8b 40 0c             	mov    0xc(%eax),%eax
+    1300:	85 c0                	test   %eax,%eax
+    1302:	74 11                	je     1315 <binremove+0x1e>
+    c->prev->next = c->next;
+    1304:	8b 45 08             	mov    0x8(%ebp),%eax
+    1307:	8b 40 0c             	mov    0xc(%eax),%eax
+    130a:	8b 55 08             	mov    0x8(%ebp),%edx
+    130d:	8b 52 08             	mov    0x8(%edx),%edx
+    1310:	89 50 08             	mov    %edx,0x8(%eax)
+    1313:	eb 1e                	jmp    1333 <binremove+0x3c>
+  else
+    bins[binof(CSIZE(c))] = c->next;
+    1315:	8b 45 08             	mov    0x8(%ebp),%eax
+    1318:	8b 00                	mov    (%eax),%eax
+    131a:	83 e0 f8             	and    $0xfffffff8,%eax
+    131d:	50                   	push   %eax
+    131e:	e8 53 ff ff ff       	call   1276 <binof>
+    1323:	83 c4 04             	add    $0x4,%esp
+    1326:	8b 55 08             	mov    0x8(%ebp),%edx
+    1329:	8b 52 08             	mov    0x8(%edx),%edx
+    132c:	89 14 85 e0 24 00 00 	mov    %edx,0x24e0(,%eax,4)
+  if(c->next)
+    1333:	8b 45 08             	mov    0x8(%ebp),%eax
+    1336:	8b 40 08             	mov    0x8(%eax),%eax
+    1339:	85 c0                	test   %eax,%eax
+    133b:	74 0f                	je     134c <binremove+0x55>
+    c->next->prev = c->prev;
+    133d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1340:	8b 40 08             	mov    0x8(%eax),%eax
+    1343:	8b 55 08             	mov    0x8(%ebp),%edx
+    1346:	8b 52 0c             	mov    0xc(%edx),%edx
+    1349:	89 50 0c             	mov    %edx,0xc(%eax)
+}
+    134c:	90                   	nop
+    134d:	c9                   	leave
+    134e:	c3                   	ret
+
+0000134f <freechunk>:
+
+// Free chunk c, merging it with free neighbors.  If trim is
+// set and the result is big and at the break, give it back.
+static void
+freechunk(struct chunk *c, int trim)
+{
+    134f:	55                   	push   %ebp
+    1350:	89 e5                	mov    %esp,%ebp
+    1352:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *p, *n;
+  uint size;
+
+  size = CSIZE(c);
+    1355:	8b 45 08             	mov    0x8(%ebp),%eax
+    1358:	8b 00                	mov    (%eax),%eax
+    135a:	83 e0 f8             	and    $0xfffffff8,%eax
+    135d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  n = NEXTC(c);
+    1360:	8b 45 08             	mov    0x8(%ebp),%eax
+    1363:	8b 00                	mov    (%eax),%eax
+    1365:	83 e0 f8             	and    $0xfffffff8,%eax
+    1368:	89 c2                	mov    %eax,%edx
+    136a:	8b 45 08             	mov    0x8(%ebp),%eax
+    136d:	01 d0                	add    %edx,%eax
+    136f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(!(c->size & PREVUSED)){
+    1372:	8b 45 08             	mov    0x8(%ebp),%eax
+    1375:	8b 00                	mov    (%eax),%eax
+    1377:	83 e0 02             	and    $0x2,%eax
+    137a:	85 c0                	test   %eax,%eax
+    137c:	75 30                	jne    13ae <freechunk+0x5f>
+    p = (struct chunk*)((char*)c - *((uint*)c - 1));
+    137e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1381:	83 e8 04             	sub    $0x4,%eax
+    1384:	8b 00                	mov    (%eax),%eax
+    1386:	f7 d8                	neg    %eax
+    1388:	89 c2                	mov    %eax,%edx
+    138a:	8b 45 08             	mov    0x8(%ebp),%eax
+    138d:	01 d0                	add    %edx,%eax
+    138f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    binremove(p);
+    1392:	ff 75 ec             	push   -0x14(%ebp)
+    1395:	e8 5d ff ff ff       	call   12f7 <binremove>
+    139a:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(p);
+    139d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    13a0:	8b 00                	mov    (%eax),%eax
+    13a2:	83 e0 f8             	and    $0xfffffff8,%eax
+    13a5:	01 45 f4             	add    %eax,-0xc(%ebp)
+    c = p;
+    13a8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    13ab:	89 45 08             	mov    %eax,0x8(%ebp)
+  }
+  if(!(n->size & USED)){
+    13ae:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    13b1:	8b 00                	mov    (%eax),%eax
+    13b3:	83 e0 01             	and    $0x1,%eax
+    13b6:	85 c0                	test   %eax,%eax
+    13b8:	75 16                	jne    13d0 <freechunk+0x81>
+    binremove(n);
+    13ba:	ff 75 f0             	push   -0x10(%ebp)
+    13bd:	e8 35 ff ff ff       	call   12f7 <binremove>
+    13c2:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(n);
+    13c5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    13c8:	8b 00                	mov    (%eax),%eax
+    13ca:	83 e0 f8             	and    $0xfffffff8,%eax
+    13cd:	01 45 f4             	add    %eax,-0xc(%ebp)
+  }
+  // Free chunks are never adjacent, so the one below is in use.
+  c->size = size | PREVUSED;
+    13d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13d3:	83 c8 02             	or     $0x2,%eax
+    13d6:	89 c2                	mov    %eax,%edx
+    13d8:	8b 45 08             	mov    0x8(%ebp),%eax
+    13db:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+    13dd:	8b 45 08             	mov    0x8(%ebp),%eax
+    13e0:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  FOOTER(c) = size;
+    13e7:	8b 45 08             	mov    0x8(%ebp),%eax
+    13ea:	8b 00                	mov    (%eax),%eax
+    13ec:	83 e0 f8             	and    $0xfffffff8,%eax
+    13ef:	8d 50 fc             	lea    -0x4(%eax),%edx
+    13f2:	8b 45 08             	mov    0x8(%ebp),%eax
+    13f5:	01 c2                	add    %eax,%edx
+    13f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13fa:	89 02                	mov    %eax,(%edx)
+  n = NEXTC(c);
+    13fc:	8b 45 08             	mov    0x8(%ebp),%eax
+    13ff:	8b 00                	mov    (%eax),%eax
+    1401:	83 e0 f8             	and    $0xfffffff8,%eax
+    1404:	89 c2                	mov    %eax,%edx
+    1406:	8b 45 08             	mov    0x8(%ebp),%eax
+    1409:	01 d0                	add    %edx,%eax
+    140b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  n->size &= ~PREVUSED;
+    140e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1411:	8b 00                	mov    (%eax),%eax
+    1413:	83 e0 fd             	and    $0xfffffffd,%eax
+    1416:	89 c2                	mov    %eax,%edx
+    1418:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    141b:	89 10                	mov    %edx,(%eax)
+
+  if(trim && n == top && size >= TRIMSIZE && sbrk(0) == (char*)top + HDRSIZE){
+    141d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    1421:	74 51                	je     1474 <freechunk+0x125>
+    1423:	a1 4c 25 00 00       	mov    0x254c,%eax
+    1428:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+    142b:	75 47                	jne    1474 <freechunk+0x125>
+    142d:	81 7d f4 ff 7f 00 00 	cmpl   $0x7fff,-0xc(%ebp)
+    1434:	76 3e                	jbe    1474 <freechunk+0x125>
+    1436:	83 ec 0c             	sub    $0xc,%esp
+    1439:	6a 00                	push   $0x0
+    143b:	e8 30 fb ff ff       	call   f70 <sbrk>
+    1440:	83 c4 10             	add    $0x10,%esp
+    1443:	8b 15 4c 25 00 00    	mov    0x254c,%edx
+    1449:	83 c2 08             	add    $0x8,%edx
+    144c:	39 d0                	cmp    %edx,%eax
+    144e:	75 24                	jne    1474 <freechunk+0x125>
+    c->size = USED | PREVUSED;
+    1450:	8b 45 08             	mov    0x8(%ebp),%eax
+    1453:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+    top = c;
+    1459:	8b 45 08             	mov    0x8(%ebp),%eax
+    145c:	a3 4c 25 00 00       	mov    %eax,0x254c
+    sbrk(-size);
+    1461:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1464:	f7 d8                	neg    %eax
+    1466:	83 ec 0c             	sub    $0xc,%esp
+    1469:	50                   	push   %eax
+    146a:	e8 01 fb ff ff       	call   f70 <sbrk>
+    146f:	83 c4 10             	add    $0x10,%esp
+    return;
+    1472:	eb 0e                	jmp    1482 <freechunk+0x133>
+  }
+  bininsert(c);
+    1474:	83 ec 0c             	sub    $0xc,%esp
+    1477:	ff 75 08             	push   0x8(%ebp)
+    147a:	e8 22 fe ff ff       	call   12a1 <bininsert>
+    147f:	83 c4 10             	add    $0x10,%esp
+}
+    1482:	c9                   	leave
+    1483:	c3                   	ret
+
+00001484 <morecore>:
+
+// Grow the heap by at least need bytes.
+static int
+morecore(uint need)
+{
+    1484:	55                   	push   %ebp
+    1485:	89 e5                	mov    %esp,%ebp
+    1487:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+  char *p;
+  uint n, pad;
+
+  n = need + MINCHUNK;
+    148a:	8b 45 08             	mov    0x8(%ebp),%eax
+    148d:	83 c0 18             	add    $0x18,%eax
+    1490:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(n < MINCORE)
+    1493:	81 7d ec ff 3f 00 00 	cmpl   $0x3fff,-0x14(%ebp)
+    149a:	77 07                	ja     14a3 <morecore+0x1f>
+    n = MINCORE;
+    149c:	c7 45 ec 00 40 00 00 	movl   $0x4000,-0x14(%ebp)
+  // Keep the break 8-aligned, with the end marker just below it.
+  pad = (8 - ((uint)sbrk(0) & 7)) & 7;
+    14a3:	83 ec 0c             	sub    $0xc,%esp
+    14a6:	6a 00                	push   $0x0
+    14a8:	e8 c3 fa ff ff       	call   f70 <sbrk>
+    14ad:	83 c4 10             	add    $0x10,%esp
+    14b0:	83 e0 07             	and    $0x7,%eax
+    14b3:	ba 08 00 00 00       	mov    $0x8,%edx
+    14b8:	29 c2                	sub    %eax,%edx
+    14ba:	89 d0                	mov    %edx,%eax
+    14bc:	83 e0 07             	and    $0x7,%eax
+    14bf:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if((p = sbrk(pad + n)) == (char*)-1){
+    14c2:	8b 55 e8             	mov    -0x18(%ebp),%edx
+    14c5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    14c8:	01 d0                	add    %edx,%eax
+    14ca:	83 ec 0c             	sub    $0xc,%esp
+    14cd:	50                   	push   %eax
+    14ce:	e8 9d fa ff ff       	call   f70 <sbrk>
+    14d3:	83 c4 10             	add    $0x10,%esp
+    14d6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    14d9:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+    14dd:	75 30                	jne    150f <morecore+0x8b>
+    n = need + MINCHUNK;
+    14df:	8b 45 08             	mov    0x8(%ebp),%eax
+    14e2:	83 c0 18             	add    $0x18,%eax
+    14e5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((p = sbrk(pad + n)) == (char*)-1)
+    14e8:	8b 55 e8             	mov    -0x18(%ebp),%edx
+    14eb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    14ee:	01 d0                	add    %edx,%eax
+    14f0:	83 ec 0c             	sub    $0xc,%esp
+    14f3:	50                   	push   %eax
+    14f4:	e8 77 fa ff ff       	call   f70 <sbrk>
+    14f9:	83 c4 10             	add    $0x10,%esp
+    14fc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    14ff:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+    1503:	75 0a                	jne    150f <morecore+0x8b>
+      return -1;
+    1505:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    150a:	e9 8e 00 00 00       	jmp    159d <morecore+0x119>
+  }
+  p += pad;
+    150f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1512:	01 45 f0             	add    %eax,-0x10(%ebp)
+  if(top && p == (char*)top + HDRSIZE){
+    1515:	a1 4c 25 00 00       	mov    0x254c,%eax
+    151a:	85 c0                	test   %eax,%eax
+    151c:	74 29                	je     1547 <morecore+0xc3>
+    151e:	a1 4c 25 00 00       	mov    0x254c,%eax
+    1523:	83 c0 08             	add    $0x8,%eax
+    1526:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+    1529:	75 1c                	jne    1547 <morecore+0xc3>
+    // Contiguous: the old end marker heads the new chunk.
+    c = top;
+    152b:	a1 4c 25 00 00       	mov    0x254c,%eax
+    1530:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = n | (c->size & PREVUSED);
+    1533:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1536:	8b 00                	mov    (%eax),%eax
+    1538:	83 e0 02             	and    $0x2,%eax
+    153b:	0b 45 ec             	or     -0x14(%ebp),%eax
+    153e:	89 c2                	mov    %eax,%edx
+    1540:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1543:	89 10                	mov    %edx,(%eax)
+    1545:	eb 16                	jmp    155d <morecore+0xd9>
+  } else {
+    // Someone else moved the break: start a new segment.
+    c = (struct chunk*)p;
+    1547:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    154a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = (n - HDRSIZE) | PREVUSED;
+    154d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1550:	83 e8 08             	sub    $0x8,%eax
+    1553:	83 c8 02             	or     $0x2,%eax
+    1556:	89 c2                	mov    %eax,%edx
+    1558:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    155b:	89 10                	mov    %edx,(%eax)
+  }
+  top = NEXTC(c);
+    155d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1560:	8b 00                	mov    (%eax),%eax
+    1562:	83 e0 f8             	and    $0xfffffff8,%eax
+    1565:	89 c2                	mov    %eax,%edx
+    1567:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    156a:	01 d0                	add    %edx,%eax
+    156c:	a3 4c 25 00 00       	mov    %eax,0x254c
+  top->size = USED;
+    1571:	a1 4c 25 00 00       	mov    0x254c,%eax
+    1576:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  top->tag = LARGE;
+    157c:	a1 4c 25 00 00       	mov    0x254c,%eax
+    1581:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  freechunk(c, 0);
+    1588:	83 ec 08             	sub    $0x8,%esp
+    158b:	6a 00                	push   $0x0
+    158d:	ff 75 f4             	push   -0xc(%ebp)
+    1590:	e8 ba fd ff ff       	call   134f <freechunk>
+    1595:	83 c4 10             	add    $0x10,%esp
+  return 0;
+    1598:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    159d:	c9                   	leave
+    159e:	c3                   	ret
+
+0000159f <largealloc>:
+
+static void*
+largealloc(uint nbytes)
+{
+    159f:	55                   	push   %ebp
+    15a0:	89 e5                	mov    %esp,%ebp
+    15a2:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c, *r;
+  uint need;
+  int i;
+
+  if(nbytes > 0x7fffffff)
+    15a5:	8b 45 08             	mov    0x8(%ebp),%eax
+    15a8:	85 c0                	test   %eax,%eax
+    15aa:	79 0a                	jns    15b6 <largealloc+0x17>
+    return 0;
+    15ac:	b8 00 00 00 00       	mov    $0x0,%eax
+    15b1:	e9 43 01 00 00       	jmp    16f9 <largealloc+0x15a>
+  need = (nbytes + HDRSIZE + 7) & ~7;
+    15b6:	8b 45 08             	mov    0x8(%ebp),%eax
+    15b9:	83 c0 0f             	add    $0xf,%eax
+    15bc:	83 e0 f8             	and    $0xfffffff8,%eax
+    15bf:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(need < MINCHUNK)
+    15c2:	83 7d f0 17          	cmpl   $0x17,-0x10(%ebp)
+    15c6:	77 07                	ja     15cf <largealloc+0x30>
+    need = MINCHUNK;
+    15c8:	c7 45 f0 18 00 00 00 	movl   $0x18,-0x10(%ebp)
+  for(;;){
+    for(i = binof(need); i < NBIN; i++)
+    15cf:	ff 75 f0             	push   -0x10(%ebp)
+    15d2:	e8 9f fc ff ff       	call   1276 <binof>
+    15d7:	83 c4 04             	add    $0x4,%esp
+    15da:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    15dd:	eb 2f                	jmp    160e <largealloc+0x6f>
+      for(c = bins[i]; c; c = c->next)
+    15df:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    15e2:	8b 04 85 e0 24 00 00 	mov    0x24e0(,%eax,4),%eax
+    15e9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    15ec:	eb 16                	jmp    1604 <largealloc+0x65>
+        if(CSIZE(c) >= need)
+    15ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15f1:	8b 00                	mov    (%eax),%eax
+    15f3:	83 e0 f8             	and    $0xfffffff8,%eax
+    15f6:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+    15f9:	73 35                	jae    1630 <largealloc+0x91>
+      for(c = bins[i]; c; c = c->next)
+    15fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15fe:	8b 40 08             	mov    0x8(%eax),%eax
+    1601:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1604:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1608:	75 e4                	jne    15ee <largealloc+0x4f>
+    for(i = binof(need); i < NBIN; i++)
+    160a:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    160e:	83 7d ec 1a          	cmpl   $0x1a,-0x14(%ebp)
+    1612:	7e cb                	jle    15df <largealloc+0x40>
+          goto found;
+    if(morecore(need) < 0)
+    1614:	83 ec 0c             	sub    $0xc,%esp
+    1617:	ff 75 f0             	push   -0x10(%ebp)
+    161a:	e8 65 fe ff ff       	call   1484 <morecore>
+    161f:	83 c4 10             	add    $0x10,%esp
+    1622:	85 c0                	test   %eax,%eax
+    1624:	79 a9                	jns    15cf <largealloc+0x30>
+      return 0;
+    1626:	b8 00 00 00 00       	mov    $0x0,%eax
+    162b:	e9 c9 00 00 00       	jmp    16f9 <largealloc+0x15a>
+          goto found;
+    1630:	90                   	nop
+  }
+
+found:
+  binremove(c);
+    1631:	83 ec 0c             	sub    $0xc,%esp
+    1634:	ff 75 f4             	push   -0xc(%ebp)
+    1637:	e8 bb fc ff ff       	call   12f7 <binremove>
+    163c:	83 c4 10             	add    $0x10,%esp
+  if(CSIZE(c) - need >= MINCHUNK){
+    163f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1642:	8b 00                	mov    (%eax),%eax
+    1644:	83 e0 f8             	and    $0xfffffff8,%eax
+    1647:	2b 45 f0             	sub    -0x10(%ebp),%eax
+    164a:	83 f8 17             	cmp    $0x17,%eax
+    164d:	76 66                	jbe    16b5 <largealloc+0x116>
+    r = (struct chunk*)((char*)c + need);
+    164f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1652:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1655:	01 d0                	add    %edx,%eax
+    1657:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    r->size = (CSIZE(c) - need) | PREVUSED;
+    165a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    165d:	8b 00                	mov    (%eax),%eax
+    165f:	83 e0 f8             	and    $0xfffffff8,%eax
+    1662:	2b 45 f0             	sub    -0x10(%ebp),%eax
+    1665:	83 c8 02             	or     $0x2,%eax
+    1668:	89 c2                	mov    %eax,%edx
+    166a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    166d:	89 10                	mov    %edx,(%eax)
+    r->tag = LARGE;
+    166f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1672:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+    FOOTER(r) = CSIZE(r);
+    1679:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    167c:	8b 10                	mov    (%eax),%edx
+    167e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1681:	8b 00                	mov    (%eax),%eax
+    1683:	83 e0 f8             	and    $0xfffffff8,%eax
+    1686:	8d 48 fc             	lea    -0x4(%eax),%ecx
+    1689:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    168c:	01 c8                	add    %ecx,%eax
+    168e:	83 e2 f8             	and    $0xfffffff8,%edx
+    1691:	89 10                	mov    %edx,(%eax)
+    bininsert(r);
+    1693:	83 ec 0c             	sub    $0xc,%esp
+    1696:	ff 75 e8             	push   -0x18(%ebp)
+    1699:	e8 03 fc ff ff       	call   12a1 <bininsert>
+    169e:	83 c4 10             	add    $0x10,%esp
+    c->size = need | (c->size & PREVUSED);
+    16a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    16a4:	8b 00                	mov    (%eax),%eax
+    16a6:	83 e0 02             	and    $0x2,%eax
+    16a9:	0b 45 f0             	or     -0x10(%ebp),%eax
+    16ac:	89 c2                	mov    %eax,%edx
+    16ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    16b1:	89 10                	mov    %edx,(%eax)
+    16b3:	eb 25                	jmp    16da <largealloc+0x13b>
+  } else
+    NEXTC(c)->size |= PREVUSED;
+    16b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    16b8:	8b 00                	mov    (%eax),%eax
+    16ba:	83 e0 f8             	and    $0xfffffff8,%eax
+    16bd:	89 c2                	mov    %eax,%edx
+    16bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    16c2:	01 d0                	add    %edx,%eax
+    16c4:	8b 10                	mov    (%eax),%edx
+    16c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    16c9:	8b 00                	mov    (%eax),%eax
+    16cb:	83 e0 f8             	and    $0xfffffff8,%eax
+    16ce:	89 c1                	mov    %eax,%ecx
+    16d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    16d3:	01 c8                	add    %ecx,%eax
+    16d5:	83 ca 02             	or     $0x2,%edx
+    16d8:	89 10                	mov    %edx,(%eax)
+  c->size |= USED;
+    16da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    16dd:	8b 00                	mov    (%eax),%eax
+    16df:	83 c8 01             	or     $0x1,%eax
+    16e2:	89 c2                	mov    %eax,%edx
+    16e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    16e7:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+    16e9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    16ec:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  return (char*)c + HDRSIZE;
+    16f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    16f6:	83 c0 08             	add    $0x8,%eax
+}
+    16f9:	c9                   	leave
+    16fa:	c3                   	ret
+
+000016fb <refill>:
+
+// Carve a slab into free blocks of class k.
+static int
+refill(int k)
+{
+    16fb:	55                   	push   %ebp
+    16fc:	89 e5                	mov    %esp,%ebp
+    16fe:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  char *p;
+  uint bs, i;
+
+  if((p = largealloc(SLABSIZE)) == 0)
+    1701:	83 ec 0c             	sub    $0xc,%esp
+    1704:	68 00 20 00 00       	push   $0x2000
+    1709:	e8 91 fe ff ff       	call   159f <largealloc>
+    170e:	83 c4 10             	add    $0x10,%esp
+    1711:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1714:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1718:	75 07                	jne    1721 <refill+0x26>
+    return -1;
+    171a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    171f:	eb 75                	jmp    1796 <refill+0x9b>
+  bs = HDRSIZE + (MINSMALL << k);
+    1721:	8b 45 08             	mov    0x8(%ebp),%eax
+    1724:	ba 10 00 00 00       	mov    $0x10,%edx
+    1729:	89 c1                	mov    %eax,%ecx
+    172b:	d3 e2                	shl    %cl,%edx
+    172d:	89 d0                	mov    %edx,%eax
+    172f:	83 c0 08             	add    $0x8,%eax
+    1732:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+    1735:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    173c:	eb 44                	jmp    1782 <refill+0x87>
+    b = (struct chunk*)(p + i);
+    173e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    1741:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1744:	01 d0                	add    %edx,%eax
+    1746:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    b->size = bs | USED;
+    1749:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    174c:	83 c8 01             	or     $0x1,%eax
+    174f:	89 c2                	mov    %eax,%edx
+    1751:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1754:	89 10                	mov    %edx,(%eax)
+    b->tag = k;
+    1756:	8b 55 08             	mov    0x8(%ebp),%edx
+    1759:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    175c:	89 50 04             	mov    %edx,0x4(%eax)
+    b->next = classes[k];
+    175f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1762:	8b 14 85 c0 24 00 00 	mov    0x24c0(,%eax,4),%edx
+    1769:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    176c:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[k] = b;
+    176f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1772:	8b 55 e8             	mov    -0x18(%ebp),%edx
+    1775:	89 14 85 c0 24 00 00 	mov    %edx,0x24c0(,%eax,4)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+    177c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    177f:	01 45 f4             	add    %eax,-0xc(%ebp)
+    1782:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1785:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1788:	01 d0                	add    %edx,%eax
+    178a:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    178f:	76 ad                	jbe    173e <refill+0x43>
+  }
+  return 0;
+    1791:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1796:	c9                   	leave
+    1797:	c3                   	ret
+
+00001798 <free>:
+
+void
+free(void *ap)
+{
+    1798:	55                   	push   %ebp
+    1799:	89 e5                	mov    %esp,%ebp
+    179b:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+
+  if(ap == 0)
+    179e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    17a2:	74 4b                	je     17ef <free+0x57>
+    return;
+  c = (struct chunk*)((char*)ap - HDRSIZE);
+    17a4:	8b 45 08             	mov    0x8(%ebp),%eax
+    17a7:	83 e8 08             	sub    $0x8,%eax
+    17aa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(c->tag != LARGE){
+    17ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    17b0:	8b 40 04             	mov    0x4(%eax),%eax
+    17b3:	83 f8 ff             	cmp    $0xffffffff,%eax
+    17b6:	74 25                	je     17dd <free+0x45>
+    c->next = classes[c->tag];
+    17b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    17bb:	8b 40 04             	mov    0x4(%eax),%eax
+    17be:	8b 14 85 c0 24 00 00 	mov    0x24c0(,%eax,4),%edx
+    17c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    17c8:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[c->tag] = c;
+    17cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    17ce:	8b 40 04             	mov    0x4(%eax),%eax
+    17d1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    17d4:	89 14 85 c0 24 00 00 	mov    %edx,0x24c0(,%eax,4)
+    return;
+    17db:	eb 13                	jmp    17f0 <free+0x58>
+  }
+  freechunk(c, 1);
+    17dd:	83 ec 08             	sub    $0x8,%esp
+    17e0:	6a 01                	push   $0x1
+    17e2:	ff 75 f4             	push   -0xc(%ebp)
+    17e5:	e8 65 fb ff ff       	call   134f <freechunk>
+    17ea:	83 c4 10             	add    $0x10,%esp
+    17ed:	eb 01                	jmp    17f0 <free+0x58>
+    return;
+    17ef:	90                   	nop
+}
+    17f0:	c9                   	leave
+    17f1:	c3                   	ret
+
+000017f2 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    17f2:	55                   	push   %ebp
+    17f3:	89 e5                	mov    %esp,%ebp
+    17f5:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  int k;
+
+  if(nbytes > MAXSMALL)
+    17f8:	81 7d 08 00 08 00 00 	cmpl   $0x800,0x8(%ebp)
+    17ff:	76 10                	jbe    1811 <malloc+0x1f>
+    return largealloc(nbytes);
+    1801:	83 ec 0c             	sub    $0xc,%esp
+    1804:	ff 75 08             	push   0x8(%ebp)
+    1807:	e8 93 fd ff ff       	call   159f <largealloc>
+    180c:	83 c4 10             	add    $0x10,%esp
+    180f:	eb 6a                	jmp    187b <malloc+0x89>
+  for(k = 0; (MINSMALL << k) < nbytes; k++)
+    1811:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1818:	eb 04                	jmp    181e <malloc+0x2c>
+    181a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    181e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1821:	ba 10 00 00 00       	mov    $0x10,%edx
+    1826:	89 c1                	mov    %eax,%ecx
+    1828:	d3 e2                	shl    %cl,%edx
+    182a:	89 d0                	mov    %edx,%eax
+    182c:	3b 45 08             	cmp    0x8(%ebp),%eax
+    182f:	72 e9                	jb     181a <malloc+0x28>
+    ;
+  if(classes[k] == 0 && refill(k) < 0)
+    1831:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1834:	8b 04 85 c0 24 00 00 	mov    0x24c0(,%eax,4),%eax
+    183b:	85 c0                	test   %eax,%eax
+    183d:	75 19                	jne    1858 <malloc+0x66>
+    183f:	83 ec 0c             	sub    $0xc,%esp
+    1842:	ff 75 f4             	push   -0xc(%ebp)
+    1845:	e8 b1 fe ff ff       	call   16fb <refill>
+    184a:	83 c4 10             	add    $0x10,%esp
+    184d:	85 c0                	test   %eax,%eax
+    184f:	79 07                	jns    1858 <malloc+0x66>
+    return 0;
+    1851:	b8 00 00 00 00       	mov    $0x0,%eax
+    1856:	eb 23                	jmp    187b <malloc+0x89>
+  b = classes[k];
+    1858:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    185b:	8b 04 85 c0 24 00 00 	mov    0x24c0(,%eax,4),%eax
+    1862:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  classes[k] = b->next;
+    1865:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1868:	8b 50 08             	mov    0x8(%eax),%edx
+    186b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    186e:	89 14 85 c0 24 00 00 	mov    %edx,0x24c0(,%eax,4)
+  return (char*)b + HDRSIZE;
+    1875:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1878:	83 c0 08             	add    $0x8,%eax
+}
+    187b:	c9                   	leave
+    187c:	c3                   	ret
+
+0000187d <stream>:
+
+// Return the stream for fd, deciding on first use how
+// its output is buffered.  Returns 0 if fd is not open.
+static struct stream*
+stream(int fd)
+{
+    187d:	55                   	push   %ebp
+    187e:	89 e5                	mov    %esp,%ebp
+    1880:	83 ec 28             	sub    $0x28,%esp
+  struct stream *s;
+  struct stat st;
+
+  if(fd < 0 || fd >= NOFILE)
+    1883:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1887:	78 06                	js     188f <stream+0x12>
+    1889:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    188d:	7e 07                	jle    1896 <stream+0x19>
+    return 0;
+    188f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1894:	eb 55                	jmp    18eb <stream+0x6e>
+  s = &streams[fd];
+    1896:	8b 45 08             	mov    0x8(%ebp),%eax
+    1899:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    189f:	05 60 25 00 00       	add    $0x2560,%eax
+    18a4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(s->mode == UNKNOWN){
+    18a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    18aa:	8b 00                	mov    (%eax),%eax
+    18ac:	85 c0                	test   %eax,%eax
+    18ae:	75 38                	jne    18e8 <stream+0x6b>
+    if(fstat(fd, &st) < 0)
+    18b0:	83 ec 08             	sub    $0x8,%esp
+    18b3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    18b6:	50                   	push   %eax
+    18b7:	ff 75 08             	push   0x8(%ebp)
+    18ba:	e8 57 f6 ff ff       	call   f16 <fstat>
+    18bf:	83 c4 10             	add    $0x10,%esp
+    18c2:	85 c0                	test   %eax,%eax
+    18c4:	79 07                	jns    18cd <stream+0x50>
+      return 0;
+    18c6:	b8 00 00 00 00       	mov    $0x0,%eax
+    18cb:	eb 1e                	jmp    18eb <stream+0x6e>
+    s->mode = st.type == T_DEV ? LINEBUF : FULLBUF;
+    18cd:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+    18d1:	66 83 f8 03          	cmp    $0x3,%ax
+    18d5:	75 07                	jne    18de <stream+0x61>
+    18d7:	ba 01 00 00 00       	mov    $0x1,%edx
+    18dc:	eb 05                	jmp    18e3 <stream+0x66>
+    18de:	ba 02 00 00 00       	mov    $0x2,%edx
+    18e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    18e6:	89 10                	mov    %edx,(%eax)
+  }
+  return s;
+    18e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    18eb:	c9                   	leave
+    18ec:	c3                   	ret
+
+000018ed <fflush>:
+
+int
+fflush(int fd)
+{
+    18ed:	55                   	push   %ebp
+    18ee:	89 e5                	mov    %esp,%ebp
+    18f0:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  int i, n;
+
+  if(fd < 0 || fd >= NOFILE)
+    18f3:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    18f7:	78 06                	js     18ff <fflush+0x12>
+    18f9:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    18fd:	7e 07                	jle    1906 <fflush+0x19>
+    return -1;
+    18ff:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1904:	eb 78                	jmp    197e <fflush+0x91>
+  s = &streams[fd];
+    1906:	8b 45 08             	mov    0x8(%ebp),%eax
+    1909:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    190f:	05 60 25 00 00       	add    $0x2560,%eax
+    1914:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < s->nout; i += n){
+    1917:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    191e:	eb 44                	jmp    1964 <fflush+0x77>
+    if((n = write(fd, s->out + i, s->nout - i)) <= 0){
+    1920:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1923:	8b 40 04             	mov    0x4(%eax),%eax
+    1926:	2b 45 f4             	sub    -0xc(%ebp),%eax
+    1929:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    192c:	8d 4a 10             	lea    0x10(%edx),%ecx
+    192f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1932:	01 ca                	add    %ecx,%edx
+    1934:	83 ec 04             	sub    $0x4,%esp
+    1937:	50                   	push   %eax
+    1938:	52                   	push   %edx
+    1939:	ff 75 08             	push   0x8(%ebp)
+    193c:	e8 6c f5 ff ff       	call   ead <write>
+    1941:	83 c4 10             	add    $0x10,%esp
+    1944:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1947:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    194b:	7f 11                	jg     195e <fflush+0x71>
+      s->nout = 0;
+    194d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1950:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+      return -1;
+    1957:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    195c:	eb 20                	jmp    197e <fflush+0x91>
+  for(i = 0; i < s->nout; i += n){
+    195e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1961:	01 45 f4             	add    %eax,-0xc(%ebp)
+    1964:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1967:	8b 40 04             	mov    0x4(%eax),%eax
+    196a:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    196d:	7c b1                	jl     1920 <fflush+0x33>
+    }
+  }
+  s->nout = 0;
+    196f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1972:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  return 0;
+    1979:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    197e:	c9                   	leave
+    197f:	c3                   	ret
+
+00001980 <flushall>:
+
+// Flush every stream, or only line-buffered ones.
+static void
+flushall(int lineonly)
+{
+    1980:	55                   	push   %ebp
+    1981:	89 e5                	mov    %esp,%ebp
+    1983:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+    1986:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    198d:	eb 41                	jmp    19d0 <flushall+0x50>
+    if(streams[fd].nout > 0 && (!lineonly || streams[fd].mode == LINEBUF))
+    198f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1992:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1998:	05 64 25 00 00       	add    $0x2564,%eax
+    199d:	8b 00                	mov    (%eax),%eax
+    199f:	85 c0                	test   %eax,%eax
+    19a1:	7e 29                	jle    19cc <flushall+0x4c>
+    19a3:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    19a7:	74 15                	je     19be <flushall+0x3e>
+    19a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    19ac:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    19b2:	05 60 25 00 00       	add    $0x2560,%eax
+    19b7:	8b 00                	mov    (%eax),%eax
+    19b9:	83 f8 01             	cmp    $0x1,%eax
+    19bc:	75 0e                	jne    19cc <flushall+0x4c>
+      fflush(fd);
+    19be:	83 ec 0c             	sub    $0xc,%esp
+    19c1:	ff 75 f4             	push   -0xc(%ebp)
+    19c4:	e8 24 ff ff ff       	call   18ed <fflush>
+    19c9:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++)
+    19cc:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    19d0:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+    19d4:	7e b9                	jle    198f <flushall+0xf>
+}
+    19d6:	90                   	nop
+    19d7:	90                   	nop
+    19d8:	c9                   	leave
+    19d9:	c3                   	ret
+
+000019da <fputc>:
+
+int
+fputc(int fd, int c)
+{
+    19da:	55                   	push   %ebp
+    19db:	89 e5                	mov    %esp,%ebp
+    19dd:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  char ch;
+
+  if((s = stream(fd)) == 0){
+    19e0:	83 ec 0c             	sub    $0xc,%esp
+    19e3:	ff 75 08             	push   0x8(%ebp)
+    19e6:	e8 92 fe ff ff       	call   187d <stream>
+    19eb:	83 c4 10             	add    $0x10,%esp
+    19ee:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    19f1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    19f5:	75 2e                	jne    1a25 <fputc+0x4b>
+    ch = c;
+    19f7:	8b 45 0c             	mov    0xc(%ebp),%eax
+    19fa:	88 45 f3             	mov    %al,-0xd(%ebp)
+    return write(fd, &ch, 1) == 1 ? (uchar)c : -1;
+    19fd:	83 ec 04             	sub    $0x4,%esp
+    1a00:	6a 01                	push   $0x1
+    1a02:	8d 45 f3             	lea    -0xd(%ebp),%eax
+    1a05:	50                   	push   %eax
+    1a06:	ff 75 08             	push   0x8(%ebp)
+    1a09:	e8 9f f4 ff ff       	call   ead <write>
+    1a0e:	83 c4 10             	add    $0x10,%esp
+    1a11:	83 f8 01             	cmp    $0x1,%eax
+    1a14:	75 08                	jne    1a1e <fputc+0x44>
+    1a16:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1a19:	0f b6 c0             	movzbl %al,%eax
+    1a1c:	eb 5e                	jmp    1a7c <fputc+0xa2>
+    1a1e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1a23:	eb 57                	jmp    1a7c <fputc+0xa2>
+  }
+  s->out[s->nout++] = c;
+    1a25:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1a28:	8b 40 04             	mov    0x4(%eax),%eax
+    1a2b:	8d 48 01             	lea    0x1(%eax),%ecx
+    1a2e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1a31:	89 4a 04             	mov    %ecx,0x4(%edx)
+    1a34:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1a37:	89 d1                	mov    %edx,%ecx
+    1a39:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1a3c:	88 4c 02 10          	mov    %cl,0x10(%edx,%eax,1)
+  if(s->nout == BUFSZ || (s->mode == LINEBUF && c == '\n'))
+    1a40:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1a43:	8b 40 04             	mov    0x4(%eax),%eax
+    1a46:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1a4b:	74 10                	je     1a5d <fputc+0x83>
+    1a4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1a50:	8b 00                	mov    (%eax),%eax
+    1a52:	83 f8 01             	cmp    $0x1,%eax
+    1a55:	75 1f                	jne    1a76 <fputc+0x9c>
+    1a57:	83 7d 0c 0a          	cmpl   $0xa,0xc(%ebp)
+    1a5b:	75 19                	jne    1a76 <fputc+0x9c>
+    if(fflush(fd) < 0)
+    1a5d:	83 ec 0c             	sub    $0xc,%esp
+    1a60:	ff 75 08             	push   0x8(%ebp)
+    1a63:	e8 85 fe ff ff       	call   18ed <fflush>
+    1a68:	83 c4 10             	add    $0x10,%esp
+    1a6b:	85 c0                	test   %eax,%eax
+    1a6d:	79 07                	jns    1a76 <fputc+0x9c>
+      return -1;
+    1a6f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1a74:	eb 06                	jmp    1a7c <fputc+0xa2>
+  return (uchar)c;
+    1a76:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1a79:	0f b6 c0             	movzbl %al,%eax
+}
+    1a7c:	c9                   	leave
+    1a7d:	c3                   	ret
+
+00001a7e <fgetc>:
+
+// Return the next byte read from fd, or -1 at end of file.
+int
+fgetc(int fd)
+{
+    1a7e:	55                   	push   %ebp
+    1a7f:	89 e5                	mov    %esp,%ebp
+    1a81:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  uchar c;
+  int n;
+
+  if((s = stream(fd)) == 0){
+    1a84:	83 ec 0c             	sub    $0xc,%esp
+    1a87:	ff 75 08             	push   0x8(%ebp)
+    1a8a:	e8 ee fd ff ff       	call   187d <stream>
+    1a8f:	83 c4 10             	add    $0x10,%esp
+    1a92:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1a95:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1a99:	75 39                	jne    1ad4 <fgetc+0x56>
+    flushall(1);
+    1a9b:	83 ec 0c             	sub    $0xc,%esp
+    1a9e:	6a 01                	push   $0x1
+    1aa0:	e8 db fe ff ff       	call   1980 <flushall>
+    1aa5:	83 c4 10             	add    $0x10,%esp
+    return read(fd, &c, 1) == 1 ? c : -1;
+    1aa8:	83 ec 04             	sub    $0x4,%esp
+    1aab:	6a 01                	push   $0x1
+    1aad:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    1ab0:	50                   	push   %eax
+    1ab1:	ff 75 08             	push   0x8(%ebp)
+    1ab4:	e8 e5 f3 ff ff       	call   e9e <read>
+    1ab9:	83 c4 10             	add    $0x10,%esp
+    1abc:	83 f8 01             	cmp    $0x1,%eax
+    1abf:	75 0c                	jne    1acd <fgetc+0x4f>
+    1ac1:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    1ac5:	0f b6 c0             	movzbl %al,%eax
+    1ac8:	e9 80 00 00 00       	jmp    1b4d <fgetc+0xcf>
+    1acd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1ad2:	eb 79                	jmp    1b4d <fgetc+0xcf>
+  }
+  if(s->rpos == s->rend){
+    1ad4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ad7:	8b 50 08             	mov    0x8(%eax),%edx
+    1ada:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1add:	8b 40 0c             	mov    0xc(%eax),%eax
+    1ae0:	39 c2                	cmp    %eax,%edx
+    1ae2:	75 4c                	jne    1b30 <fgetc+0xb2>
+    flushall(1);
+    1ae4:	83 ec 0c             	sub    $0xc,%esp
+    1ae7:	6a 01                	push   $0x1
+    1ae9:	e8 92 fe ff ff       	call   1980 <flushall>
+    1aee:	83 c4 10             	add    $0x10,%esp
+    if((n = read(fd, s->in, BUFSZ)) <= 0)
+    1af1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1af4:	05 10 02 00 00       	add    $0x210,%eax
+    1af9:	83 ec 04             	sub    $0x4,%esp
+    1afc:	68 00 02 00 00       	push   $0x200
+    1b01:	50                   	push   %eax
+    1b02:	ff 75 08             	push   0x8(%ebp)
+    1b05:	e8 94 f3 ff ff       	call   e9e <read>
+    1b0a:	83 c4 10             	add    $0x10,%esp
+    1b0d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1b10:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1b14:	7f 07                	jg     1b1d <fgetc+0x9f>
+      return -1;
+    1b16:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1b1b:	eb 30                	jmp    1b4d <fgetc+0xcf>
+    s->rpos = 0;
+    1b1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1b20:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+    s->rend = n;
+    1b27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1b2a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    1b2d:	89 50 0c             	mov    %edx,0xc(%eax)
+  }
+  return (uchar)s->in[s->rpos++];
+    1b30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1b33:	8b 40 08             	mov    0x8(%eax),%eax
+    1b36:	8d 48 01             	lea    0x1(%eax),%ecx
+    1b39:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1b3c:	89 4a 08             	mov    %ecx,0x8(%edx)
+    1b3f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1b42:	0f b6 84 02 10 02 00 	movzbl 0x210(%edx,%eax,1),%eax
+    1b49:	00 
+    1b4a:	0f b6 c0             	movzbl %al,%eax
+}
+    1b4d:	c9                   	leave
+    1b4e:	c3                   	ret
+
+00001b4f <fork>:
+
+int
+fork(void)
+{
+    1b4f:	55                   	push   %ebp
+    1b50:	89 e5                	mov    %esp,%ebp
+    1b52:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1b55:	83 ec 0c             	sub    $0xc,%esp
+    1b58:	6a 00                	push   $0x0
+    1b5a:	e8 21 fe ff ff       	call   1980 <flushall>
+    1b5f:	83 c4 10             	add    $0x10,%esp
+  return _fork();
+    1b62:	e8 fb f2 ff ff       	call   e62 <_fork>
+}
+    1b67:	c9                   	leave
+    1b68:	c3                   	ret
+
+00001b69 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+    1b69:	55                   	push   %ebp
+    1b6a:	89 e5                	mov    %esp,%ebp
+    1b6c:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1b6f:	83 ec 0c             	sub    $0xc,%esp
+    1b72:	6a 00                	push   $0x0
+    1b74:	e8 07 fe ff ff       	call   1980 <flushall>
+    1b79:	83 c4 10             	add    $0x10,%esp
+  return _exec(path, argv);
+    1b7c:	83 ec 08             	sub    $0x8,%esp
+    1b7f:	ff 75 0c             	push   0xc(%ebp)
+    1b82:	ff 75 08             	push   0x8(%ebp)
+    1b85:	e8 50 f3 ff ff       	call   eda <_exec>
+    1b8a:	83 c4 10             	add    $0x10,%esp
+}
+    1b8d:	c9                   	leave
+    1b8e:	c3                   	ret
+
+00001b8f <exit>:
+
+int
+exit(void)
+{
+    1b8f:	55                   	push   %ebp
+    1b90:	89 e5                	mov    %esp,%ebp
+    1b92:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1b95:	83 ec 0c             	sub    $0xc,%esp
+    1b98:	6a 00                	push   $0x0
+    1b9a:	e8 e1 fd ff ff       	call   1980 <flushall>
+    1b9f:	83 c4 10             	add    $0x10,%esp
+  _exit();
+    1ba2:	e8 ca f2 ff ff       	call   e71 <_exit>
+
+00001ba7 <close>:
+}
+
+int
+close(int fd)
+{
+    1ba7:	55                   	push   %ebp
+    1ba8:	89 e5                	mov    %esp,%ebp
+    1baa:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+
+  if(fd >= 0 && fd < NOFILE){
+    1bad:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1bb1:	78 44                	js     1bf7 <close+0x50>
+    1bb3:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    1bb7:	7f 3e                	jg     1bf7 <close+0x50>
+    fflush(fd);
+    1bb9:	83 ec 0c             	sub    $0xc,%esp
+    1bbc:	ff 75 08             	push   0x8(%ebp)
+    1bbf:	e8 29 fd ff ff       	call   18ed <fflush>
+    1bc4:	83 c4 10             	add    $0x10,%esp
+    s = &streams[fd];
+    1bc7:	8b 45 08             	mov    0x8(%ebp),%eax
+    1bca:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1bd0:	05 60 25 00 00       	add    $0x2560,%eax
+    1bd5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    s->mode = UNKNOWN;
+    1bd8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1bdb:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    s->rpos = s->rend = 0;
+    1be1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1be4:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    1beb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1bee:	8b 50 0c             	mov    0xc(%eax),%edx
+    1bf1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1bf4:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  return _close(fd);
+    1bf7:	83 ec 0c             	sub    $0xc,%esp
+    1bfa:	ff 75 08             	push   0x8(%ebp)
+    1bfd:	e8 ba f2 ff ff       	call   ebc <_close>
+    1c02:	83 c4 10             	add    $0x10,%esp
+}
+    1c05:	c9                   	leave
+    1c06:	c3                   	ret
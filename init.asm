@@ -0,0 +1,2653 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 14             	sub    $0x14,%esp
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+      11:	83 ec 08             	sub    $0x8,%esp
+      14:	6a 02                	push   $0x2
+      16:	68 86 14 00 00       	push   $0x1486
+      1b:	e8 45 07 00 00       	call   765 <open>
+      20:	83 c4 10             	add    $0x10,%esp
+      23:	85 c0                	test   %eax,%eax
+      25:	79 26                	jns    4d <main+0x4d>
+    mknod("console", 1, 1);
+      27:	83 ec 04             	sub    $0x4,%esp
+      2a:	6a 01                	push   $0x1
+      2c:	6a 01                	push   $0x1
+      2e:	68 86 14 00 00       	push   $0x1486
+      33:	e8 3c 07 00 00       	call   774 <mknod>
+      38:	83 c4 10             	add    $0x10,%esp
+    open("console", O_RDWR);
+      3b:	83 ec 08             	sub    $0x8,%esp
+      3e:	6a 02                	push   $0x2
+      40:	68 86 14 00 00       	push   $0x1486
+      45:	e8 1b 07 00 00       	call   765 <open>
+      4a:	83 c4 10             	add    $0x10,%esp
+  }
+  dup(0);  // stdout
+      4d:	83 ec 0c             	sub    $0xc,%esp
+      50:	6a 00                	push   $0x0
+      52:	e8 77 07 00 00       	call   7ce <dup>
+      57:	83 c4 10             	add    $0x10,%esp
+  dup(0);  // stderr
+      5a:	83 ec 0c             	sub    $0xc,%esp
+      5d:	6a 00                	push   $0x0
+      5f:	e8 6a 07 00 00       	call   7ce <dup>
+      64:	83 c4 10             	add    $0x10,%esp
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+      67:	83 ec 08             	sub    $0x8,%esp
+      6a:	68 8e 14 00 00       	push   $0x148e
+      6f:	6a 01                	push   $0x1
+      71:	e8 f9 08 00 00       	call   96f <printf>
+      76:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+      79:	e8 4d 13 00 00       	call   13cb <fork>
+      7e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(pid < 0){
+      81:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+      85:	79 17                	jns    9e <main+0x9e>
+      printf(1, "init: fork failed\n");
+      87:	83 ec 08             	sub    $0x8,%esp
+      8a:	68 a1 14 00 00       	push   $0x14a1
+      8f:	6a 01                	push   $0x1
+      91:	e8 d9 08 00 00       	call   96f <printf>
+      96:	83 c4 10             	add    $0x10,%esp
+      exit();
+      99:	e8 6d 13 00 00       	call   140b <exit>
+    }
+    if(pid == 0){
+      9e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+      a2:	75 3e                	jne    e2 <main+0xe2>
+      exec("sh", argv);
+      a4:	83 ec 08             	sub    $0x8,%esp
+      a7:	68 7c 19 00 00       	push   $0x197c
+      ac:	68 83 14 00 00       	push   $0x1483
+      b1:	e8 2f 13 00 00       	call   13e5 <exec>
+      b6:	83 c4 10             	add    $0x10,%esp
+      printf(1, "init: exec sh failed\n");
+      b9:	83 ec 08             	sub    $0x8,%esp
+      bc:	68 b4 14 00 00       	push   $0x14b4
+      c1:	6a 01                	push   $0x1
+      c3:	e8 a7 08 00 00       	call   96f <printf>
+      c8:	83 c4 10             	add    $0x10,%esp
+      exit();
+      cb:	e8 3b 13 00 00       	call   140b <exit>
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+      printf(1, "zombie!\n");
+      d0:	83 ec 08             	sub    $0x8,%esp
+      d3:	68 ca 14 00 00       	push   $0x14ca
+      d8:	6a 01                	push   $0x1
+      da:	e8 90 08 00 00       	call   96f <printf>
+      df:	83 c4 10             	add    $0x10,%esp
+    while((wpid=wait()) >= 0 && wpid != pid)
+      e2:	e8 15 06 00 00       	call   6fc <wait>
+      e7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+      ea:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+      ee:	0f 88 73 ff ff ff    	js     67 <main+0x67>
+      f4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+      f7:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+      fa:	75 d4                	jne    d0 <main+0xd0>
+    printf(1, "init: starting sh\n");
+      fc:	e9 66 ff ff ff       	jmp    67 <main+0x67>
+
+00000101 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+     101:	55                   	push   %ebp
+     102:	89 e5                	mov    %esp,%ebp
+     104:	57                   	push   %edi
+     105:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+     106:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     109:	8b 55 10             	mov    0x10(%ebp),%edx
+     10c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     10f:	89 cb                	mov    %ecx,%ebx
+     111:	89 df                	mov    %ebx,%edi
+     113:	89 d1                	mov    %edx,%ecx
+     115:	fc                   	cld
+     116:	f3 aa                	rep stos %al,%es:(%edi)
+     118:	89 ca                	mov    %ecx,%edx
+     11a:	89 fb                	mov    %edi,%ebx
+     11c:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     11f:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     122:	90                   	nop
+     123:	5b                   	pop    %ebx
+     124:	5f                   	pop    %edi
+     125:	5d                   	pop    %ebp
+     126:	c3                   	ret
+
+00000127 <stosl>:
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+     127:	55                   	push   %ebp
+     128:	89 e5                	mov    %esp,%ebp
+     12a:	57                   	push   %edi
+     12b:	53                   	push   %ebx
+  asm volatile("cld; rep stosl" :
+     12c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     12f:	8b 55 10             	mov    0x10(%ebp),%edx
+     132:	8b 45 0c             	mov    0xc(%ebp),%eax
+     135:	89 cb                	mov    %ecx,%ebx
+     137:	89 df                	mov    %ebx,%edi
+     139:	89 d1                	mov    %edx,%ecx
+     13b:	fc                   	cld
+     13c:	f3 ab                	rep stos %eax,%es:(%edi)
+     13e:	89 ca                	mov    %ecx,%edx
+     140:	89 fb                	mov    %edi,%ebx
+     142:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     145:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     148:	90                   	nop
+     149:	5b                   	pop    %ebx
+     14a:	5f                   	pop    %edi
+     14b:	5d                   	pop    %ebp
+     14c:	c3                   	ret
+
+0000014d <movsb>:
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+     14d:	55                   	push   %ebp
+     14e:	89 e5                	mov    %esp,%ebp
+     150:	57                   	push   %edi
+     151:	56                   	push   %esi
+     152:	53                   	push   %ebx
+  asm volatile("cld; rep movsb" :
+     153:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     156:	8b 55 0c             	mov    0xc(%ebp),%edx
+     159:	8b 45 10             	mov    0x10(%ebp),%eax
+     15c:	89 cb                	mov    %ecx,%ebx
+     15e:	89 df                	mov    %ebx,%edi
+     160:	89 d6                	mov    %edx,%esi
+     162:	89 c1                	mov    %eax,%ecx
+     164:	fc                   	cld
+     165:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     167:	89 c8                	mov    %ecx,%eax
+     169:	89 f2                	mov    %esi,%edx
+     16b:	89 fb                	mov    %edi,%ebx
+     16d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     170:	89 55 0c             	mov    %edx,0xc(%ebp)
+     173:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     176:	90                   	nop
+     177:	5b                   	pop    %ebx
+     178:	5e                   	pop    %esi
+     179:	5f                   	pop    %edi
+     17a:	5d                   	pop    %ebp
+     17b:	c3                   	ret
+
+0000017c <movsl>:
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+     17c:	55                   	push   %ebp
+     17d:	89 e5                	mov    %esp,%ebp
+     17f:	57                   	push   %edi
+     180:	56                   	push   %esi
+     181:	53                   	push   %ebx
+  asm volatile("cld; rep movsl" :
+     182:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     185:	8b 55 0c             	mov    0xc(%ebp),%edx
+     188:	8b 45 10             	mov    0x10(%ebp),%eax
+     18b:	89 cb                	mov    %ecx,%ebx
+     18d:	89 df                	mov    %ebx,%edi
+     18f:	89 d6                	mov    %edx,%esi
+     191:	89 c1                	mov    %eax,%ecx
+     193:	fc                   	cld
+     194:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     196:	89 c8                	mov    %ecx,%eax
+     198:	89 f2                	mov    %esi,%edx
+     19a:	89 fb                	mov    %edi,%ebx
+     19c:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     19f:	89 55 0c             	mov    %edx,0xc(%ebp)
+     1a2:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     1a5:	90                   	nop
+     1a6:	5b                   	pop    %ebx
+     1a7:	5e                   	pop    %esi
+     1a8:	5f                   	pop    %edi
+     1a9:	5d                   	pop    %ebp
+     1aa:	c3                   	ret
+
+000001ab <strcpy>:
+#define ONES        0x01010101
+#define HASZERO(x)  (((x) - ONES) & ~(x) & (ONES << 7))
+
+char*
+strcpy(char *s, char *t)
+{
+     1ab:	55                   	push   %ebp
+     1ac:	89 e5                	mov    %esp,%ebp
+     1ae:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+     1b1:	8b 45 08             	mov    0x8(%ebp),%eax
+     1b4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     1b7:	90                   	nop
+     1b8:	8b 55 0c             	mov    0xc(%ebp),%edx
+     1bb:	8d 42 01             	lea    0x1(%edx),%eax
+     1be:	89 45 0c             	mov    %eax,0xc(%ebp)
+     1c1:	8b 45 08             	mov    0x8(%ebp),%eax
+     1c4:	8d 48 01             	lea    0x1(%eax),%ecx
+     1c7:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     1ca:	0f b6 12             	movzbl (%edx),%edx
+     1cd:	88 10                	mov    %dl,(%eax)
+     1cf:	0f b6 00             	movzbl (%eax),%eax
+     1d2:	84 c0                	test   %al,%al
+     1d4:	75 e2                	jne    1b8 <strcpy+0xd>
+    ;
+  return os;
+     1d6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     1d9:	c9                   	leave
+     1da:	c3                   	ret
+
+000001db <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     1db:	55                   	push   %ebp
+     1dc:	89 e5                	mov    %esp,%ebp
+  // Aligned words never straddle a page, so reading
+  // whole ones past the end of a string is safe.
+  if((((uint)p | (uint)q) & 3) == 0)
+     1de:	8b 55 08             	mov    0x8(%ebp),%edx
+     1e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+     1e4:	09 d0                	or     %edx,%eax
+     1e6:	83 e0 03             	and    $0x3,%eax
+     1e9:	85 c0                	test   %eax,%eax
+     1eb:	75 3f                	jne    22c <strcmp+0x51>
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     1ed:	eb 08                	jmp    1f7 <strcmp+0x1c>
+      p += 4, q += 4;
+     1ef:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     1f3:	83 45 0c 04          	addl   $0x4,0xc(%ebp)
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     1f7:	8b 45 08             	mov    0x8(%ebp),%eax
+     1fa:	8b 10                	mov    (%eax),%edx
+     1fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+     1ff:	8b 00                	mov    (%eax),%eax
+     201:	39 c2                	cmp    %eax,%edx
+     203:	75 27                	jne    22c <strcmp+0x51>
+     205:	8b 45 08             	mov    0x8(%ebp),%eax
+     208:	8b 00                	mov    (%eax),%eax
+     20a:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     210:	8b 45 08             	mov    0x8(%ebp),%eax
+     213:	8b 00                	mov    (%eax),%eax
+     215:	f7 d0                	not    %eax
+     217:	21 d0                	and    %edx,%eax
+     219:	25 80 80 80 80       	and    $0x80808080,%eax
+     21e:	85 c0                	test   %eax,%eax
+     220:	74 cd                	je     1ef <strcmp+0x14>
+  while(*p && *p == *q)
+     222:	eb 08                	jmp    22c <strcmp+0x51>
+    p++, q++;
+     224:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     228:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     22c:	8b 45 08             	mov    0x8(%ebp),%eax
+     22f:	0f b6 00             	movzbl (%eax),%eax
+     232:	84 c0                	test   %al,%al
+     234:	74 10                	je     246 <strcmp+0x6b>
+     236:	8b 45 08             	mov    0x8(%ebp),%eax
+     239:	0f b6 10             	movzbl (%eax),%edx
+     23c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     23f:	0f b6 00             	movzbl (%eax),%eax
+     242:	38 c2                	cmp    %al,%dl
+     244:	74 de                	je     224 <strcmp+0x49>
+  return (uchar)*p - (uchar)*q;
+     246:	8b 45 08             	mov    0x8(%ebp),%eax
+     249:	0f b6 00             	movzbl (%eax),%eax
+     24c:	0f b6 d0             	movzbl %al,%edx
+     24f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     252:	0f b6 00             	movzbl (%eax),%eax
+     255:	0f b6 c0             	movzbl %al,%eax
+     258:	29 c2                	sub    %eax,%edx
+     25a:	89 d0                	mov    %edx,%eax
+}
+     25c:	5d                   	pop    %ebp
+     25d:	c3                   	ret
+
+0000025e <strlen>:
+
+uint
+strlen(char *s)
+{
+     25e:	55                   	push   %ebp
+     25f:	89 e5                	mov    %esp,%ebp
+     261:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; ((uint)(s+n) & 3) && s[n]; n++)
+     264:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     26b:	eb 04                	jmp    271 <strlen+0x13>
+     26d:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     271:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     274:	8b 45 08             	mov    0x8(%ebp),%eax
+     277:	01 d0                	add    %edx,%eax
+     279:	83 e0 03             	and    $0x3,%eax
+     27c:	85 c0                	test   %eax,%eax
+     27e:	74 0f                	je     28f <strlen+0x31>
+     280:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     283:	8b 45 08             	mov    0x8(%ebp),%eax
+     286:	01 d0                	add    %edx,%eax
+     288:	0f b6 00             	movzbl (%eax),%eax
+     28b:	84 c0                	test   %al,%al
+     28d:	75 de                	jne    26d <strlen+0xf>
+    ;
+  if(s[n])
+     28f:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     292:	8b 45 08             	mov    0x8(%ebp),%eax
+     295:	01 d0                	add    %edx,%eax
+     297:	0f b6 00             	movzbl (%eax),%eax
+     29a:	84 c0                	test   %al,%al
+     29c:	74 33                	je     2d1 <strlen+0x73>
+    while(!HASZERO(*(uint*)(s+n)))
+     29e:	eb 04                	jmp    2a4 <strlen+0x46>
+      n += 4;
+     2a0:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+    while(!HASZERO(*(uint*)(s+n)))
+     2a4:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     2a7:	8b 45 08             	mov    0x8(%ebp),%eax
+     2aa:	01 d0                	add    %edx,%eax
+     2ac:	8b 00                	mov    (%eax),%eax
+     2ae:	8d 88 ff fe fe fe    	lea    -0x1010101(%eax),%ecx
+     2b4:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     2b7:	8b 45 08             	mov    0x8(%ebp),%eax
+     2ba:	01 d0                	add    %edx,%eax
+     2bc:	8b 00                	mov    (%eax),%eax
+     2be:	f7 d0                	not    %eax
+     2c0:	21 c8                	and    %ecx,%eax
+     2c2:	25 80 80 80 80       	and    $0x80808080,%eax
+     2c7:	85 c0                	test   %eax,%eax
+     2c9:	74 d5                	je     2a0 <strlen+0x42>
+  for(; s[n]; n++)
+     2cb:	eb 04                	jmp    2d1 <strlen+0x73>
+     2cd:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     2d1:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     2d4:	8b 45 08             	mov    0x8(%ebp),%eax
+     2d7:	01 d0                	add    %edx,%eax
+     2d9:	0f b6 00             	movzbl (%eax),%eax
+     2dc:	84 c0                	test   %al,%al
+     2de:	75 ed                	jne    2cd <strlen+0x6f>
+    ;
+  return n;
+     2e0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     2e3:	c9                   	leave
+     2e4:	c3                   	ret
+
+000002e5 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     2e5:	55                   	push   %ebp
+     2e6:	89 e5                	mov    %esp,%ebp
+     2e8:	83 ec 10             	sub    $0x10,%esp
+  char *d;
+  uint k;
+
+  d = dst;
+     2eb:	8b 45 08             	mov    0x8(%ebp),%eax
+     2ee:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c &= 0xFF;
+     2f1:	81 65 0c ff 00 00 00 	andl   $0xff,0xc(%ebp)
+  if(n >= 16){
+     2f8:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     2fc:	76 54                	jbe    352 <memset+0x6d>
+    k = -(uint)d & 3;  // bytes up to a word boundary
+     2fe:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     301:	f7 d8                	neg    %eax
+     303:	83 e0 03             	and    $0x3,%eax
+     306:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    stosb(d, c, k);
+     309:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     30c:	50                   	push   %eax
+     30d:	ff 75 0c             	push   0xc(%ebp)
+     310:	ff 75 fc             	push   -0x4(%ebp)
+     313:	e8 e9 fd ff ff       	call   101 <stosb>
+     318:	83 c4 0c             	add    $0xc,%esp
+    d += k;
+     31b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     31e:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n -= k;
+     321:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     324:	29 45 10             	sub    %eax,0x10(%ebp)
+    stosl(d, c*ONES, n/4);
+     327:	8b 45 10             	mov    0x10(%ebp),%eax
+     32a:	c1 e8 02             	shr    $0x2,%eax
+     32d:	89 c2                	mov    %eax,%edx
+     32f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     332:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     338:	52                   	push   %edx
+     339:	50                   	push   %eax
+     33a:	ff 75 fc             	push   -0x4(%ebp)
+     33d:	e8 e5 fd ff ff       	call   127 <stosl>
+     342:	83 c4 0c             	add    $0xc,%esp
+    d += n & ~3;
+     345:	8b 45 10             	mov    0x10(%ebp),%eax
+     348:	83 e0 fc             	and    $0xfffffffc,%eax
+     34b:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n &= 3;
+     34e:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+  }
+  stosb(d, c, n);
+     352:	8b 45 10             	mov    0x10(%ebp),%eax
+     355:	50                   	push   %eax
+     356:	ff 75 0c             	push   0xc(%ebp)
+     359:	ff 75 fc             	push   -0x4(%ebp)
+     35c:	e8 a0 fd ff ff       	call   101 <stosb>
+     361:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     364:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     367:	c9                   	leave
+     368:	c3                   	ret
+
+00000369 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     369:	55                   	push   %ebp
+     36a:	89 e5                	mov    %esp,%ebp
+     36c:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s1, *s2;
+
+  s1 = v1;
+     36f:	8b 45 08             	mov    0x8(%ebp),%eax
+     372:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s2 = v2;
+     375:	8b 45 0c             	mov    0xc(%ebp),%eax
+     378:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     37b:	eb 0c                	jmp    389 <memcmp+0x20>
+    s1 += 4, s2 += 4, n -= 4;
+     37d:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+     381:	83 45 f8 04          	addl   $0x4,-0x8(%ebp)
+     385:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     389:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     38d:	76 3e                	jbe    3cd <memcmp+0x64>
+     38f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     392:	8b 10                	mov    (%eax),%edx
+     394:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     397:	8b 00                	mov    (%eax),%eax
+     399:	39 c2                	cmp    %eax,%edx
+     39b:	74 e0                	je     37d <memcmp+0x14>
+  while(n-- > 0){
+     39d:	eb 2e                	jmp    3cd <memcmp+0x64>
+    if(*s1 != *s2)
+     39f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     3a2:	0f b6 10             	movzbl (%eax),%edx
+     3a5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3a8:	0f b6 00             	movzbl (%eax),%eax
+     3ab:	38 c2                	cmp    %al,%dl
+     3ad:	74 16                	je     3c5 <memcmp+0x5c>
+      return *s1 - *s2;
+     3af:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     3b2:	0f b6 00             	movzbl (%eax),%eax
+     3b5:	0f b6 d0             	movzbl %al,%edx
+     3b8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3bb:	0f b6 00             	movzbl (%eax),%eax
+     3be:	0f b6 c0             	movzbl %al,%eax
+     3c1:	29 c2                	sub    %eax,%edx
+     3c3:	eb 1a                	jmp    3df <memcmp+0x76>
+    s1++, s2++;
+     3c5:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     3c9:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+  while(n-- > 0){
+     3cd:	8b 45 10             	mov    0x10(%ebp),%eax
+     3d0:	8d 50 ff             	lea    -0x1(%eax),%edx
+     3d3:	89 55 10             	mov    %edx,0x10(%ebp)
+     3d6:	85 c0                	test   %eax,%eax
+     3d8:	75 c5                	jne    39f <memcmp+0x36>
+  }
+  return 0;
+     3da:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+     3df:	89 d0                	mov    %edx,%eax
+     3e1:	c9                   	leave
+     3e2:	c3                   	ret
+
+000003e3 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     3e3:	55                   	push   %ebp
+     3e4:	89 e5                	mov    %esp,%ebp
+     3e6:	83 ec 14             	sub    $0x14,%esp
+     3e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3ec:	88 45 ec             	mov    %al,-0x14(%ebp)
+  uint w, cc;
+
+  // Skip whole words holding neither c nor the terminator.
+  for(; ((uint)s & 3) && *s; s++)
+     3ef:	eb 17                	jmp    408 <strchr+0x25>
+    if(*s == c)
+     3f1:	8b 45 08             	mov    0x8(%ebp),%eax
+     3f4:	0f b6 00             	movzbl (%eax),%eax
+     3f7:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     3fa:	75 08                	jne    404 <strchr+0x21>
+      return (char*)s;
+     3fc:	8b 45 08             	mov    0x8(%ebp),%eax
+     3ff:	e9 ad 00 00 00       	jmp    4b1 <strchr+0xce>
+  for(; ((uint)s & 3) && *s; s++)
+     404:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     408:	8b 45 08             	mov    0x8(%ebp),%eax
+     40b:	83 e0 03             	and    $0x3,%eax
+     40e:	85 c0                	test   %eax,%eax
+     410:	74 0a                	je     41c <strchr+0x39>
+     412:	8b 45 08             	mov    0x8(%ebp),%eax
+     415:	0f b6 00             	movzbl (%eax),%eax
+     418:	84 c0                	test   %al,%al
+     41a:	75 d5                	jne    3f1 <strchr+0xe>
+  cc = (uchar)c * ONES;
+     41c:	0f b6 45 ec          	movzbl -0x14(%ebp),%eax
+     420:	0f b6 c0             	movzbl %al,%eax
+     423:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     429:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(*s)
+     42c:	8b 45 08             	mov    0x8(%ebp),%eax
+     42f:	0f b6 00             	movzbl (%eax),%eax
+     432:	84 c0                	test   %al,%al
+     434:	74 6c                	je     4a2 <strchr+0xbf>
+    for(; w = *(uint*)s, !HASZERO(w) && !HASZERO(w ^ cc); s += 4)
+     436:	eb 04                	jmp    43c <strchr+0x59>
+     438:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     43c:	8b 45 08             	mov    0x8(%ebp),%eax
+     43f:	8b 00                	mov    (%eax),%eax
+     441:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     444:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     447:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     44d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     450:	f7 d0                	not    %eax
+     452:	21 d0                	and    %edx,%eax
+     454:	25 80 80 80 80       	and    $0x80808080,%eax
+     459:	85 c0                	test   %eax,%eax
+     45b:	75 26                	jne    483 <strchr+0xa0>
+     45d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     460:	33 45 fc             	xor    -0x4(%ebp),%eax
+     463:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     469:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     46c:	33 45 fc             	xor    -0x4(%ebp),%eax
+     46f:	f7 d0                	not    %eax
+     471:	21 d0                	and    %edx,%eax
+     473:	25 80 80 80 80       	and    $0x80808080,%eax
+     478:	85 c0                	test   %eax,%eax
+     47a:	75 07                	jne    483 <strchr+0xa0>
+     47c:	b8 01 00 00 00       	mov    $0x1,%eax
+     481:	eb 05                	jmp    488 <strchr+0xa5>
+     483:	b8 00 00 00 00       	mov    $0x0,%eax
+     488:	85 c0                	test   %eax,%eax
+     48a:	75 ac                	jne    438 <strchr+0x55>
+      ;
+  for(; *s; s++)
+     48c:	eb 14                	jmp    4a2 <strchr+0xbf>
+    if(*s == c)
+     48e:	8b 45 08             	mov    0x8(%ebp),%eax
+     491:	0f b6 00             	movzbl (%eax),%eax
+     494:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     497:	75 05                	jne    49e <strchr+0xbb>
+      return (char*)s;
+     499:	8b 45 08             	mov    0x8(%ebp),%eax
+     49c:	eb 13                	jmp    4b1 <strchr+0xce>
+  for(; *s; s++)
+     49e:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     4a2:	8b 45 08             	mov    0x8(%ebp),%eax
+     4a5:	0f b6 00             	movzbl (%eax),%eax
+     4a8:	84 c0                	test   %al,%al
+     4aa:	75 e2                	jne    48e <strchr+0xab>
+  return 0;
+     4ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     4b1:	c9                   	leave
+     4b2:	c3                   	ret
+
+000004b3 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     4b3:	55                   	push   %ebp
+     4b4:	89 e5                	mov    %esp,%ebp
+     4b6:	83 ec 18             	sub    $0x18,%esp
+  int i, c;
+
+  for(i=0; i+1 < max; ){
+     4b9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     4c0:	eb 37                	jmp    4f9 <gets+0x46>
+    c = fgetc(0);
+     4c2:	83 ec 0c             	sub    $0xc,%esp
+     4c5:	6a 00                	push   $0x0
+     4c7:	e8 2e 0e 00 00       	call   12fa <fgetc>
+     4cc:	83 c4 10             	add    $0x10,%esp
+     4cf:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(c < 0)
+     4d2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     4d6:	78 2e                	js     506 <gets+0x53>
+      break;
+    buf[i++] = c;
+     4d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4db:	8d 50 01             	lea    0x1(%eax),%edx
+     4de:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     4e1:	89 c2                	mov    %eax,%edx
+     4e3:	8b 45 08             	mov    0x8(%ebp),%eax
+     4e6:	01 d0                	add    %edx,%eax
+     4e8:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     4eb:	88 10                	mov    %dl,(%eax)
+    if(c == '\n' || c == '\r')
+     4ed:	83 7d f0 0a          	cmpl   $0xa,-0x10(%ebp)
+     4f1:	74 14                	je     507 <gets+0x54>
+     4f3:	83 7d f0 0d          	cmpl   $0xd,-0x10(%ebp)
+     4f7:	74 0e                	je     507 <gets+0x54>
+  for(i=0; i+1 < max; ){
+     4f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4fc:	83 c0 01             	add    $0x1,%eax
+     4ff:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     502:	7f be                	jg     4c2 <gets+0xf>
+     504:	eb 01                	jmp    507 <gets+0x54>
+      break;
+     506:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     507:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     50a:	8b 45 08             	mov    0x8(%ebp),%eax
+     50d:	01 d0                	add    %edx,%eax
+     50f:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     512:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     515:	c9                   	leave
+     516:	c3                   	ret
+
+00000517 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     517:	55                   	push   %ebp
+     518:	89 e5                	mov    %esp,%ebp
+     51a:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     51d:	83 ec 08             	sub    $0x8,%esp
+     520:	6a 00                	push   $0x0
+     522:	ff 75 08             	push   0x8(%ebp)
+     525:	e8 3b 02 00 00       	call   765 <open>
+     52a:	83 c4 10             	add    $0x10,%esp
+     52d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     530:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     534:	79 07                	jns    53d <stat+0x26>
+    return -1;
+     536:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     53b:	eb 25                	jmp    562 <stat+0x4b>
+  r = fstat(fd, st);
+     53d:	83 ec 08             	sub    $0x8,%esp
+     540:	ff 75 0c             	push   0xc(%ebp)
+     543:	ff 75 f4             	push   -0xc(%ebp)
+     546:	e8 47 02 00 00       	call   792 <fstat>
+     54b:	83 c4 10             	add    $0x10,%esp
+     54e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     551:	83 ec 0c             	sub    $0xc,%esp
+     554:	ff 75 f4             	push   -0xc(%ebp)
+     557:	e8 c7 0e 00 00       	call   1423 <close>
+     55c:	83 c4 10             	add    $0x10,%esp
+  return r;
+     55f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     562:	c9                   	leave
+     563:	c3                   	ret
+
+00000564 <atoi>:
+
+int
+atoi(const char *s)
+{
+     564:	55                   	push   %ebp
+     565:	89 e5                	mov    %esp,%ebp
+     567:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     56a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     571:	eb 25                	jmp    598 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     573:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     576:	89 d0                	mov    %edx,%eax
+     578:	c1 e0 02             	shl    $0x2,%eax
+     57b:	01 d0                	add    %edx,%eax
+     57d:	01 c0                	add    %eax,%eax
+     57f:	89 c1                	mov    %eax,%ecx
+     581:	8b 45 08             	mov    0x8(%ebp),%eax
+     584:	8d 50 01             	lea    0x1(%eax),%edx
+     587:	89 55 08             	mov    %edx,0x8(%ebp)
+     58a:	0f b6 00             	movzbl (%eax),%eax
+     58d:	0f be c0             	movsbl %al,%eax
+     590:	01 c8                	add    %ecx,%eax
+     592:	83 e8 30             	sub    $0x30,%eax
+     595:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     598:	8b 45 08             	mov    0x8(%ebp),%eax
+     59b:	0f b6 00             	movzbl (%eax),%eax
+     59e:	3c 2f                	cmp    $0x2f,%al
+     5a0:	7e 0a                	jle    5ac <atoi+0x48>
+     5a2:	8b 45 08             	mov    0x8(%ebp),%eax
+     5a5:	0f b6 00             	movzbl (%eax),%eax
+     5a8:	3c 39                	cmp    $0x39,%al
+     5aa:	7e c7                	jle    573 <atoi+0xf>
+  return n;
+     5ac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     5af:	c9                   	leave
+     5b0:	c3                   	ret
+
+000005b1 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     5b1:	55                   	push   %ebp
+     5b2:	89 e5                	mov    %esp,%ebp
+     5b4:	83 ec 10             	sub    $0x10,%esp
+  char *d, *s;
+  int k;
+
+  if(n <= 0)
+     5b7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     5bb:	7f 08                	jg     5c5 <memmove+0x14>
+    return vdst;
+     5bd:	8b 45 08             	mov    0x8(%ebp),%eax
+     5c0:	e9 17 01 00 00       	jmp    6dc <memmove+0x12b>
+  d = vdst;
+     5c5:	8b 45 08             	mov    0x8(%ebp),%eax
+     5c8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s = vsrc;
+     5cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+     5ce:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  if(s < d && s + n > d){
+     5d1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     5d4:	3b 45 fc             	cmp    -0x4(%ebp),%eax
+     5d7:	0f 83 84 00 00 00    	jae    661 <memmove+0xb0>
+     5dd:	8b 55 10             	mov    0x10(%ebp),%edx
+     5e0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     5e3:	01 d0                	add    %edx,%eax
+     5e5:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     5e8:	73 77                	jae    661 <memmove+0xb0>
+    s += n;
+     5ea:	8b 45 10             	mov    0x10(%ebp),%eax
+     5ed:	01 45 f8             	add    %eax,-0x8(%ebp)
+    d += n;
+     5f0:	8b 45 10             	mov    0x10(%ebp),%eax
+     5f3:	01 45 fc             	add    %eax,-0x4(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     5f6:	eb 17                	jmp    60f <memmove+0x5e>
+      *--d = *--s, n--;
+     5f8:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     5fc:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     600:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     603:	0f b6 10             	movzbl (%eax),%edx
+     606:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     609:	88 10                	mov    %dl,(%eax)
+     60b:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     60f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     613:	7e 22                	jle    637 <memmove+0x86>
+     615:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     618:	83 e0 03             	and    $0x3,%eax
+     61b:	85 c0                	test   %eax,%eax
+     61d:	75 d9                	jne    5f8 <memmove+0x47>
+    for(; n >= 4; n -= 4){
+     61f:	eb 16                	jmp    637 <memmove+0x86>
+      d -= 4;
+     621:	83 6d fc 04          	subl   $0x4,-0x4(%ebp)
+      s -= 4;
+     625:	83 6d f8 04          	subl   $0x4,-0x8(%ebp)
+      *(uint*)d = *(uint*)s;
+     629:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     62c:	8b 10                	mov    (%eax),%edx
+     62e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     631:	89 10                	mov    %edx,(%eax)
+    for(; n >= 4; n -= 4){
+     633:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+     637:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     63b:	7f e4                	jg     621 <memmove+0x70>
+    }
+    while(n-- > 0)
+     63d:	eb 13                	jmp    652 <memmove+0xa1>
+      *--d = *--s;
+     63f:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     643:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     647:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     64a:	0f b6 10             	movzbl (%eax),%edx
+     64d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     650:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+     652:	8b 45 10             	mov    0x10(%ebp),%eax
+     655:	8d 50 ff             	lea    -0x1(%eax),%edx
+     658:	89 55 10             	mov    %edx,0x10(%ebp)
+     65b:	85 c0                	test   %eax,%eax
+     65d:	7f e0                	jg     63f <memmove+0x8e>
+  if(s < d && s + n > d){
+     65f:	eb 78                	jmp    6d9 <memmove+0x128>
+  } else {
+    if(n >= 16){
+     661:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     665:	7e 61                	jle    6c8 <memmove+0x117>
+      k = -(uint)d & 3;
+     667:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     66a:	f7 d8                	neg    %eax
+     66c:	83 e0 03             	and    $0x3,%eax
+     66f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      movsb(d, s, k);
+     672:	ff 75 f4             	push   -0xc(%ebp)
+     675:	ff 75 f8             	push   -0x8(%ebp)
+     678:	ff 75 fc             	push   -0x4(%ebp)
+     67b:	e8 cd fa ff ff       	call   14d <movsb>
+     680:	83 c4 0c             	add    $0xc,%esp
+      d += k;
+     683:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     686:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += k;
+     689:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     68c:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n -= k;
+     68f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     692:	29 45 10             	sub    %eax,0x10(%ebp)
+      movsl(d, s, n/4);
+     695:	8b 45 10             	mov    0x10(%ebp),%eax
+     698:	8d 50 03             	lea    0x3(%eax),%edx
+     69b:	85 c0                	test   %eax,%eax
+     69d:	0f 48 c2             	cmovs  %edx,%eax
+     6a0:	c1 f8 02             	sar    $0x2,%eax
+     6a3:	50                   	push   %eax
+     6a4:	ff 75 f8             	push   -0x8(%ebp)
+     6a7:	ff 75 fc             	push   -0x4(%ebp)
+     6aa:	e8 cd fa ff ff       	call   17c <movsl>
+     6af:	83 c4 0c             	add    $0xc,%esp
+      d += n & ~3;
+     6b2:	8b 45 10             	mov    0x10(%ebp),%eax
+     6b5:	83 e0 fc             	and    $0xfffffffc,%eax
+     6b8:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += n & ~3;
+     6bb:	8b 45 10             	mov    0x10(%ebp),%eax
+     6be:	83 e0 fc             	and    $0xfffffffc,%eax
+     6c1:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n &= 3;
+     6c4:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+    }
+    movsb(d, s, n);
+     6c8:	ff 75 10             	push   0x10(%ebp)
+     6cb:	ff 75 f8             	push   -0x8(%ebp)
+     6ce:	ff 75 fc             	push   -0x4(%ebp)
+     6d1:	e8 77 fa ff ff       	call   14d <movsb>
+     6d6:	83 c4 0c             	add    $0xc,%esp
+  }
+  return vdst;
+     6d9:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     6dc:	c9                   	leave
+     6dd:	c3                   	ret
+
+000006de <_fork>:
+    movl %esp, %ecx; \
+    movl $1f, %edx; \
+    sysenter; \
+  1: ret
+
+RAWSYSCALL(fork)
+     6de:	b8 01 00 00 00       	mov    $0x1,%eax
+     6e3:	89 e1                	mov    %esp,%ecx
+     6e5:	ba ec 06 00 00       	mov    $0x6ec,%edx
+     6ea:	0f 34                	sysenter
+     6ec:	c3                   	ret
+
+000006ed <_exit>:
+RAWSYSCALL(exit)
+     6ed:	b8 02 00 00 00       	mov    $0x2,%eax
+     6f2:	89 e1                	mov    %esp,%ecx
+     6f4:	ba fb 06 00 00       	mov    $0x6fb,%edx
+     6f9:	0f 34                	sysenter
+     6fb:	c3                   	ret
+
+000006fc <wait>:
+SYSCALL(wait)
+     6fc:	b8 03 00 00 00       	mov    $0x3,%eax
+     701:	89 e1                	mov    %esp,%ecx
+     703:	ba 0a 07 00 00       	mov    $0x70a,%edx
+     708:	0f 34                	sysenter
+     70a:	c3                   	ret
+
+0000070b <pipe>:
+SYSCALL(pipe)
+     70b:	b8 04 00 00 00       	mov    $0x4,%eax
+     710:	89 e1                	mov    %esp,%ecx
+     712:	ba 19 07 00 00       	mov    $0x719,%edx
+     717:	0f 34                	sysenter
+     719:	c3                   	ret
+
+0000071a <read>:
+SYSCALL(read)
+     71a:	b8 05 00 00 00       	mov    $0x5,%eax
+     71f:	89 e1                	mov    %esp,%ecx
+     721:	ba 28 07 00 00       	mov    $0x728,%edx
+     726:	0f 34                	sysenter
+     728:	c3                   	ret
+
+00000729 <write>:
+SYSCALL(write)
+     729:	b8 10 00 00 00       	mov    $0x10,%eax
+     72e:	89 e1                	mov    %esp,%ecx
+     730:	ba 37 07 00 00       	mov    $0x737,%edx
+     735:	0f 34                	sysenter
+     737:	c3                   	ret
+
+00000738 <_close>:
+RAWSYSCALL(close)
+     738:	b8 15 00 00 00       	mov    $0x15,%eax
+     73d:	89 e1                	mov    %esp,%ecx
+     73f:	ba 46 07 00 00       	mov    $0x746,%edx
+     744:	0f 34                	sysenter
+     746:	c3                   	ret
+
+00000747 <kill>:
+SYSCALL(kill)
+     747:	b8 06 00 00 00       	mov    $0x6,%eax
+     74c:	89 e1                	mov    %esp,%ecx
+     74e:	ba 55 07 00 00       	mov    $0x755,%edx
+     753:	0f 34                	sysenter
+     755:	c3                   	ret
+
+00000756 <_exec>:
+RAWSYSCALL(exec)
+     756:	b8 07 00 00 00       	mov    $0x7,%eax
+     75b:	89 e1                	mov    %esp,%ecx
+     75d:	ba 64 07 00 00       	mov    $0x764,%edx
+     762:	0f 34                	sysenter
+     764:	c3                   	ret
+
+00000765 <open>:
+SYSCALL(open)
+     765:	b8 0f 00 00 00       	mov    $0xf,%eax
+     76a:	89 e1                	mov    %esp,%ecx
+     76c:	ba 73 07 00 00       	mov    $0x773,%edx
+     771:	0f 34                	sysenter
+     773:	c3                   	ret
+
+00000774 <mknod>:
+SYSCALL(mknod)
+     774:	b8 11 00 00 00       	mov    $0x11,%eax
+     779:	89 e1                	mov    %esp,%ecx
+     77b:	ba 82 07 00 00       	mov    $0x782,%edx
+     780:	0f 34                	sysenter
+     782:	c3                   	ret
+
+00000783 <unlink>:
+SYSCALL(unlink)
+     783:	b8 12 00 00 00       	mov    $0x12,%eax
+     788:	89 e1                	mov    %esp,%ecx
+     78a:	ba 91 07 00 00       	mov    $0x791,%edx
+     78f:	0f 34                	sysenter
+     791:	c3                   	ret
+
+00000792 <fstat>:
+SYSCALL(fstat)
+     792:	b8 08 00 00 00       	mov    $0x8,%eax
+     797:	89 e1                	mov    %esp,%ecx
+     799:	ba a0 07 00 00       	mov    $0x7a0,%edx
+     79e:	0f 34                	sysenter
+     7a0:	c3                   	ret
+
+000007a1 <link>:
+SYSCALL(link)
+     7a1:	b8 13 00 00 00       	mov    $0x13,%eax
+     7a6:	89 e1                	mov    %esp,%ecx
+     7a8:	ba af 07 00 00       	mov    $0x7af,%edx
+     7ad:	0f 34                	sysenter
+     7af:	c3                   	ret
+
+000007b0 <mkdir>:
+SYSCALL(mkdir)
+     7b0:	b8 14 00 00 00       	mov    $0x14,%eax
+     7b5:	89 e1                	mov    %esp,%ecx
+     7b7:	ba be 07 00 00       	mov    $0x7be,%edx
+     7bc:	0f 34                	sysenter
+     7be:	c3                   	ret
+
+000007bf <chdir>:
+SYSCALL(chdir)
+     7bf:	b8 09 00 00 00       	mov    $0x9,%eax
+     7c4:	89 e1                	mov    %esp,%ecx
+     7c6:	ba cd 07 00 00       	mov    $0x7cd,%edx
+     7cb:	0f 34                	sysenter
+     7cd:	c3                   	ret
+
+000007ce <dup>:
+SYSCALL(dup)
+     7ce:	b8 0a 00 00 00       	mov    $0xa,%eax
+     7d3:	89 e1                	mov    %esp,%ecx
+     7d5:	ba dc 07 00 00       	mov    $0x7dc,%edx
+     7da:	0f 34                	sysenter
+     7dc:	c3                   	ret
+
+000007dd <getpid>:
+SYSCALL(getpid)
+     7dd:	b8 0b 00 00 00       	mov    $0xb,%eax
+     7e2:	89 e1                	mov    %esp,%ecx
+     7e4:	ba eb 07 00 00       	mov    $0x7eb,%edx
+     7e9:	0f 34                	sysenter
+     7eb:	c3                   	ret
+
+000007ec <sbrk>:
+SYSCALL(sbrk)
+     7ec:	b8 0c 00 00 00       	mov    $0xc,%eax
+     7f1:	89 e1                	mov    %esp,%ecx
+     7f3:	ba fa 07 00 00       	mov    $0x7fa,%edx
+     7f8:	0f 34                	sysenter
+     7fa:	c3                   	ret
+
+000007fb <sleep>:
+SYSCALL(sleep)
+     7fb:	b8 0d 00 00 00       	mov    $0xd,%eax
+     800:	89 e1                	mov    %esp,%ecx
+     802:	ba 09 08 00 00       	mov    $0x809,%edx
+     807:	0f 34                	sysenter
+     809:	c3                   	ret
+
+0000080a <uptime>:
+SYSCALL(uptime)
+     80a:	b8 0e 00 00 00       	mov    $0xe,%eax
+     80f:	89 e1                	mov    %esp,%ecx
+     811:	ba 18 08 00 00       	mov    $0x818,%edx
+     816:	0f 34                	sysenter
+     818:	c3                   	ret
+
+00000819 <getproc>:
+SYSCALL(getproc)
+     819:	b8 16 00 00 00       	mov    $0x16,%eax
+     81e:	89 e1                	mov    %esp,%ecx
+     820:	ba 27 08 00 00       	mov    $0x827,%edx
+     825:	0f 34                	sysenter
+     827:	c3                   	ret
+
+00000828 <getpgs>:
+SYSCALL(getpgs)
+     828:	b8 17 00 00 00       	mov    $0x17,%eax
+     82d:	89 e1                	mov    %esp,%ecx
+     82f:	ba 36 08 00 00       	mov    $0x836,%edx
+     834:	0f 34                	sysenter
+     836:	c3                   	ret
+
+00000837 <loadproc>:
+SYSCALL(loadproc)
+     837:	b8 18 00 00 00       	mov    $0x18,%eax
+     83c:	89 e1                	mov    %esp,%ecx
+     83e:	ba 45 08 00 00       	mov    $0x845,%edx
+     843:	0f 34                	sysenter
+     845:	c3                   	ret
+
+00000846 <iosubmit>:
+SYSCALL(iosubmit)
+     846:	b8 19 00 00 00       	mov    $0x19,%eax
+     84b:	89 e1                	mov    %esp,%ecx
+     84d:	ba 54 08 00 00       	mov    $0x854,%edx
+     852:	0f 34                	sysenter
+     854:	c3                   	ret
+
+00000855 <sysstat>:
+SYSCALL(sysstat)
+     855:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     85a:	89 e1                	mov    %esp,%ecx
+     85c:	ba 63 08 00 00       	mov    $0x863,%edx
+     861:	0f 34                	sysenter
+     863:	c3                   	ret
+
+00000864 <splice>:
+SYSCALL(splice)
+     864:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     869:	89 e1                	mov    %esp,%ecx
+     86b:	ba 72 08 00 00       	mov    $0x872,%edx
+     870:	0f 34                	sysenter
+     872:	c3                   	ret
+
+00000873 <fsync>:
+SYSCALL(fsync)
+     873:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     878:	89 e1                	mov    %esp,%ecx
+     87a:	ba 81 08 00 00       	mov    $0x881,%edx
+     87f:	0f 34                	sysenter
+     881:	c3                   	ret
+
+00000882 <fdatasync>:
+SYSCALL(fdatasync)
+     882:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     887:	89 e1                	mov    %esp,%ecx
+     889:	ba 90 08 00 00       	mov    $0x890,%edx
+     88e:	0f 34                	sysenter
+     890:	c3                   	ret
+
+00000891 <lseek>:
+SYSCALL(lseek)
+     891:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     896:	89 e1                	mov    %esp,%ecx
+     898:	ba 9f 08 00 00       	mov    $0x89f,%edx
+     89d:	0f 34                	sysenter
+     89f:	c3                   	ret
+
+000008a0 <dmesg>:
+SYSCALL(dmesg)
+     8a0:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     8a5:	89 e1                	mov    %esp,%ecx
+     8a7:	ba ae 08 00 00       	mov    $0x8ae,%edx
+     8ac:	0f 34                	sysenter
+     8ae:	c3                   	ret
+
+000008af <lockstat>:
+SYSCALL(lockstat)
+     8af:	b8 20 00 00 00       	mov    $0x20,%eax
+     8b4:	89 e1                	mov    %esp,%ecx
+     8b6:	ba bd 08 00 00       	mov    $0x8bd,%edx
+     8bb:	0f 34                	sysenter
+     8bd:	c3                   	ret
+
+000008be <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     8be:	55                   	push   %ebp
+     8bf:	89 e5                	mov    %esp,%ebp
+     8c1:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     8c4:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     8cb:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     8cf:	74 17                	je     8e8 <printint+0x2a>
+     8d1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     8d5:	79 11                	jns    8e8 <printint+0x2a>
+    neg = 1;
+     8d7:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     8de:	8b 45 0c             	mov    0xc(%ebp),%eax
+     8e1:	f7 d8                	neg    %eax
+     8e3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     8e6:	eb 06                	jmp    8ee <printint+0x30>
+  } else {
+    x = xx;
+     8e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+     8eb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     8ee:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     8f5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     8f8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     8fb:	ba 00 00 00 00       	mov    $0x0,%edx
+     900:	f7 f1                	div    %ecx
+     902:	89 d1                	mov    %edx,%ecx
+     904:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     907:	8d 50 01             	lea    0x1(%eax),%edx
+     90a:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     90d:	0f b6 91 84 19 00 00 	movzbl 0x1984(%ecx),%edx
+     914:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     918:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     91b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     91e:	ba 00 00 00 00       	mov    $0x0,%edx
+     923:	f7 f1                	div    %ecx
+     925:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     928:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     92c:	75 c7                	jne    8f5 <printint+0x37>
+  if(neg)
+     92e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     932:	74 2d                	je     961 <printint+0xa3>
+    buf[i++] = '-';
+     934:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     937:	8d 50 01             	lea    0x1(%eax),%edx
+     93a:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     93d:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+     942:	eb 1d                	jmp    961 <printint+0xa3>
+    fputc(fd, buf[i]);
+     944:	8d 55 dc             	lea    -0x24(%ebp),%edx
+     947:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     94a:	01 d0                	add    %edx,%eax
+     94c:	0f b6 00             	movzbl (%eax),%eax
+     94f:	0f be c0             	movsbl %al,%eax
+     952:	83 ec 08             	sub    $0x8,%esp
+     955:	50                   	push   %eax
+     956:	ff 75 08             	push   0x8(%ebp)
+     959:	e8 f8 08 00 00       	call   1256 <fputc>
+     95e:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+     961:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     965:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     969:	79 d9                	jns    944 <printint+0x86>
+}
+     96b:	90                   	nop
+     96c:	90                   	nop
+     96d:	c9                   	leave
+     96e:	c3                   	ret
+
+0000096f <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     96f:	55                   	push   %ebp
+     970:	89 e5                	mov    %esp,%ebp
+     972:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+     975:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     97c:	8d 45 0c             	lea    0xc(%ebp),%eax
+     97f:	83 c0 04             	add    $0x4,%eax
+     982:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+     985:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     98c:	e9 4a 01 00 00       	jmp    adb <printf+0x16c>
+    c = fmt[i] & 0xff;
+     991:	8b 55 0c             	mov    0xc(%ebp),%edx
+     994:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     997:	01 d0                	add    %edx,%eax
+     999:	0f b6 00             	movzbl (%eax),%eax
+     99c:	0f be c0             	movsbl %al,%eax
+     99f:	25 ff 00 00 00       	and    $0xff,%eax
+     9a4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+     9a7:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     9ab:	75 28                	jne    9d5 <printf+0x66>
+      if(c == '%'){
+     9ad:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     9b1:	75 0c                	jne    9bf <printf+0x50>
+        state = '%';
+     9b3:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+     9ba:	e9 18 01 00 00       	jmp    ad7 <printf+0x168>
+      } else {
+        fputc(fd, c);
+     9bf:	83 ec 08             	sub    $0x8,%esp
+     9c2:	ff 75 e4             	push   -0x1c(%ebp)
+     9c5:	ff 75 08             	push   0x8(%ebp)
+     9c8:	e8 89 08 00 00       	call   1256 <fputc>
+     9cd:	83 c4 10             	add    $0x10,%esp
+     9d0:	e9 02 01 00 00       	jmp    ad7 <printf+0x168>
+      }
+    } else if(state == '%'){
+     9d5:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+     9d9:	0f 85 f8 00 00 00    	jne    ad7 <printf+0x168>
+      if(c == 'd'){
+     9df:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+     9e3:	75 1e                	jne    a03 <printf+0x94>
+        printint(fd, *ap, 10, 1);
+     9e5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     9e8:	8b 00                	mov    (%eax),%eax
+     9ea:	6a 01                	push   $0x1
+     9ec:	6a 0a                	push   $0xa
+     9ee:	50                   	push   %eax
+     9ef:	ff 75 08             	push   0x8(%ebp)
+     9f2:	e8 c7 fe ff ff       	call   8be <printint>
+     9f7:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     9fa:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     9fe:	e9 cd 00 00 00       	jmp    ad0 <printf+0x161>
+      } else if(c == 'x' || c == 'p'){
+     a03:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+     a07:	74 06                	je     a0f <printf+0xa0>
+     a09:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+     a0d:	75 1e                	jne    a2d <printf+0xbe>
+        printint(fd, *ap, 16, 0);
+     a0f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     a12:	8b 00                	mov    (%eax),%eax
+     a14:	6a 00                	push   $0x0
+     a16:	6a 10                	push   $0x10
+     a18:	50                   	push   %eax
+     a19:	ff 75 08             	push   0x8(%ebp)
+     a1c:	e8 9d fe ff ff       	call   8be <printint>
+     a21:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     a24:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     a28:	e9 a3 00 00 00       	jmp    ad0 <printf+0x161>
+      } else if(c == 's'){
+     a2d:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+     a31:	75 43                	jne    a76 <printf+0x107>
+        s = (char*)*ap;
+     a33:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     a36:	8b 00                	mov    (%eax),%eax
+     a38:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     a3b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+     a3f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     a43:	75 25                	jne    a6a <printf+0xfb>
+          s = "(null)";
+     a45:	c7 45 f4 d3 14 00 00 	movl   $0x14d3,-0xc(%ebp)
+        while(*s != 0){
+     a4c:	eb 1c                	jmp    a6a <printf+0xfb>
+          fputc(fd, *s);
+     a4e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a51:	0f b6 00             	movzbl (%eax),%eax
+     a54:	0f be c0             	movsbl %al,%eax
+     a57:	83 ec 08             	sub    $0x8,%esp
+     a5a:	50                   	push   %eax
+     a5b:	ff 75 08             	push   0x8(%ebp)
+     a5e:	e8 f3 07 00 00       	call   1256 <fputc>
+     a63:	83 c4 10             	add    $0x10,%esp
+          s++;
+     a66:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+     a6a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a6d:	0f b6 00             	movzbl (%eax),%eax
+     a70:	84 c0                	test   %al,%al
+     a72:	75 da                	jne    a4e <printf+0xdf>
+     a74:	eb 5a                	jmp    ad0 <printf+0x161>
+        }
+      } else if(c == 'c'){
+     a76:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+     a7a:	75 1a                	jne    a96 <printf+0x127>
+        fputc(fd, *ap);
+     a7c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     a7f:	8b 00                	mov    (%eax),%eax
+     a81:	83 ec 08             	sub    $0x8,%esp
+     a84:	50                   	push   %eax
+     a85:	ff 75 08             	push   0x8(%ebp)
+     a88:	e8 c9 07 00 00       	call   1256 <fputc>
+     a8d:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     a90:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     a94:	eb 3a                	jmp    ad0 <printf+0x161>
+      } else if(c == '%'){
+     a96:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     a9a:	75 13                	jne    aaf <printf+0x140>
+        fputc(fd, c);
+     a9c:	83 ec 08             	sub    $0x8,%esp
+     a9f:	ff 75 e4             	push   -0x1c(%ebp)
+     aa2:	ff 75 08             	push   0x8(%ebp)
+     aa5:	e8 ac 07 00 00       	call   1256 <fputc>
+     aaa:	83 c4 10             	add    $0x10,%esp
+     aad:	eb 21                	jmp    ad0 <printf+0x161>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        fputc(fd, '%');
+     aaf:	83 ec 08             	sub    $0x8,%esp
+     ab2:	6a 25                	push   $0x25
+     ab4:	ff 75 08             	push   0x8(%ebp)
+     ab7:	e8 9a 07 00 00       	call   1256 <fputc>
+     abc:	83 c4 10             	add    $0x10,%esp
+        fputc(fd, c);
+     abf:	83 ec 08             	sub    $0x8,%esp
+     ac2:	ff 75 e4             	push   -0x1c(%ebp)
+     ac5:	ff 75 08             	push   0x8(%ebp)
+     ac8:	e8 89 07 00 00       	call   1256 <fputc>
+     acd:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     ad0:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     ad7:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     adb:	8b 55 0c             	mov    0xc(%ebp),%edx
+     ade:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ae1:	01 d0                	add    %edx,%eax
+     ae3:	0f b6 00             	movzbl (%eax),%eax
+     ae6:	84 c0                	test   %al,%al
+     ae8:	0f 85 a3 fe ff ff    	jne    991 <printf+0x22>
+    }
+  }
+}
+     aee:	90                   	nop
+     aef:	90                   	nop
+     af0:	c9                   	leave
+     af1:	c3                   	ret
+
+00000af2 <binof>:
+static struct chunk *bins[NBIN];       // free large chunks
+static struct chunk *top;              // end marker of newest heap segment
+
+static int
+binof(uint size)
+{
+     af2:	55                   	push   %ebp
+     af3:	89 e5                	mov    %esp,%ebp
+     af5:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  i = 0;
+     af8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     aff:	c1 6d 08 05          	shrl   $0x5,0x8(%ebp)
+     b03:	eb 07                	jmp    b0c <binof+0x1a>
+    i++;
+     b05:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     b09:	d1 6d 08             	shrl   0x8(%ebp)
+     b0c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     b10:	74 06                	je     b18 <binof+0x26>
+     b12:	83 7d fc 19          	cmpl   $0x19,-0x4(%ebp)
+     b16:	7e ed                	jle    b05 <binof+0x13>
+  return i;
+     b18:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     b1b:	c9                   	leave
+     b1c:	c3                   	ret
+
+00000b1d <bininsert>:
+
+static void
+bininsert(struct chunk *c)
+{
+     b1d:	55                   	push   %ebp
+     b1e:	89 e5                	mov    %esp,%ebp
+     b20:	83 ec 10             	sub    $0x10,%esp
+  struct chunk **b;
+
+  b = &bins[binof(CSIZE(c))];
+     b23:	8b 45 08             	mov    0x8(%ebp),%eax
+     b26:	8b 00                	mov    (%eax),%eax
+     b28:	83 e0 f8             	and    $0xfffffff8,%eax
+     b2b:	50                   	push   %eax
+     b2c:	e8 c1 ff ff ff       	call   af2 <binof>
+     b31:	83 c4 04             	add    $0x4,%esp
+     b34:	c1 e0 02             	shl    $0x2,%eax
+     b37:	05 c0 19 00 00       	add    $0x19c0,%eax
+     b3c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c->prev = 0;
+     b3f:	8b 45 08             	mov    0x8(%ebp),%eax
+     b42:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  c->next = *b;
+     b49:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     b4c:	8b 10                	mov    (%eax),%edx
+     b4e:	8b 45 08             	mov    0x8(%ebp),%eax
+     b51:	89 50 08             	mov    %edx,0x8(%eax)
+  if(*b)
+     b54:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     b57:	8b 00                	mov    (%eax),%eax
+     b59:	85 c0                	test   %eax,%eax
+     b5b:	74 0b                	je     b68 <bininsert+0x4b>
+    (*b)->prev = c;
+     b5d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     b60:	8b 00                	mov    (%eax),%eax
+     b62:	8b 55 08             	mov    0x8(%ebp),%edx
+     b65:	89 50 0c             	mov    %edx,0xc(%eax)
+  *b = c;
+     b68:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     b6b:	8b 55 08             	mov    0x8(%ebp),%edx
+     b6e:	89 10                	mov    %edx,(%eax)
+}
+     b70:	90                   	nop
+     b71:	c9                   	leave
+     b72:	c3                   	ret
+
+00000b73 <binremove>:
+
+static void
+binremove(struct chunk *c)
+{
+     b73:	55                   	push   %ebp
+     b74:	89 e5                	mov    %esp,%ebp
+  if(c->prev)
+     b76:	8b 45 08             	mov    0x8(%ebp),%eax
+     b79:	8b 40 0c             	mov    0xc(%eax),%eax
+     b7c:	85 c0                	test   %eax,%eax
+     b7e:	74 11                	je     b91 <binremove+0x1e>
+    c->prev->next = c->next;
+     b80:	8b 45 08             	mov    0x8(%ebp),%eax
+     b83:	8b 40 0c             	mov    0xc(%eax),%eax
+     b86:	8b 55 08             	mov    0x8(%ebp),%edx
+     b89:	8b 52 08             	mov    0x8(%edx),%edx
+     b8c:	89 50 08             	mov    %edx,0x8(%eax)
+     b8f:	eb 1e                	jmp    baf <binremove+0x3c>
+  else
+    bins[binof(CSIZE(c))] = c->next;
+     b91:	8b 45 08             	mov    0x8(%ebp),%eax
+     b94:	8b 00                	mov    (%eax),%eax
+     b96:	83 e0 f8             	and    $0xfffffff8,%eax
+     b99:	50                   	push   %eax
+     b9a:	e8 53 ff ff ff       	call   af2 <binof>
+     b9f:	83 c4 04             	add    $0x4,%esp
+     ba2:	8b 55 08             	mov    0x8(%ebp),%edx
+     ba5:	8b 52 08             	mov    0x8(%edx),%edx
+     ba8:	89 14 85 c0 19 00 00 	mov    %edx,0x19c0(,%eax,4)
+  if(c->next)
+     baf:	8b 45 08             	mov    0x8(%ebp),%eax
+     bb2:	8b 40 08             	mov    0x8(%eax),%eax
+     bb5:	85 c0                	test   %eax,%eax
+     bb7:	74 0f                	je     bc8 <binremove+0x55>
+    c->next->prev = c->prev;
+     bb9:	8b 45 08             	mov    0x8(%ebp),%eax
+     bbc:	8b 40 08             	mov    0x8(%eax),%eax
+     bbf:	8b 55 08             	mov    0x8(%ebp),%edx
+     bc2:	8b 52 0c             	mov    0xc(%edx),%edx
+     bc5:	89 50 0c             	mov    %edx,0xc(%eax)
+}
+     bc8:	90                   	nop
+     bc9:	c9                   	leave
+     bca:	c3                   	ret
+
+00000bcb <freechunk>:
+
+// Free chunk c, merging it with free neighbors.  If trim is
+// set and the result is big and at the break, give it back.
+static void
+freechunk(struct chunk *c, int trim)
+{
+     bcb:	55                   	push   %ebp
+     bcc:	89 e5                	mov    %esp,%ebp
+     bce:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *p, *n;
+  uint size;
+
+  size = CSIZE(c);
+     bd1:	8b 45 08             	mov    0x8(%ebp),%eax
+     bd4:	8b 00                	mov    (%eax),%eax
+     bd6:	83 e0 f8             	and    $0xfffffff8,%eax
+     bd9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  n = NEXTC(c);
+     bdc:	8b 45 08             	mov    0x8(%ebp),%eax
+     bdf:	8b 00                	mov    (%eax),%eax
+     be1:	83 e0 f8             	and    $0xfffffff8,%eax
+     be4:	89 c2                	mov    %eax,%edx
+     be6:	8b 45 08             	mov    0x8(%ebp),%eax
+     be9:	01 d0                	add    %edx,%eax
+     beb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(!(c->size & PREVUSED)){
+     bee:	8b 45 08             	mov    0x8(%ebp),%eax
+     bf1:	8b 00                	mov    (%eax),%eax
+     bf3:	83 e0 02             	and    $0x2,%eax
+     bf6:	85 c0                	test   %eax,%eax
+     bf8:	75 30                	jne    c2a <freechunk+0x5f>
+    p = (struct chunk*)((char*)c - *((uint*)c - 1));
+     bfa:	8b 45 08             	mov    0x8(%ebp),%eax
+     bfd:	83 e8 04             	sub    $0x4,%eax
+     c00:	8b 00                	mov    (%eax),%eax
+     c02:	f7 d8                	neg    %eax
+     c04:	89 c2                	mov    %eax,%edx
+     c06:	8b 45 08             	mov    0x8(%ebp),%eax
+     c09:	01 d0                	add    %edx,%eax
+     c0b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    binremove(p);
+     c0e:	ff 75 ec             	push   -0x14(%ebp)
+     c11:	e8 5d ff ff ff       	call   b73 <binremove>
+     c16:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(p);
+     c19:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     c1c:	8b 00                	mov    (%eax),%eax
+     c1e:	83 e0 f8             	and    $0xfffffff8,%eax
+     c21:	01 45 f4             	add    %eax,-0xc(%ebp)
+    c = p;
+     c24:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     c27:	89 45 08             	mov    %eax,0x8(%ebp)
+  }
+  if(!(n->size & USED)){
+     c2a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c2d:	8b 00                	mov    (%eax),%eax
+     c2f:	83 e0 01             	and    $0x1,%eax
+     c32:	85 c0                	test   %eax,%eax
+     c34:	75 16                	jne    c4c <freechunk+0x81>
+    binremove(n);
+     c36:	ff 75 f0             	push   -0x10(%ebp)
+     c39:	e8 35 ff ff ff       	call   b73 <binremove>
+     c3e:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(n);
+     c41:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c44:	8b 00                	mov    (%eax),%eax
+     c46:	83 e0 f8             	and    $0xfffffff8,%eax
+     c49:	01 45 f4             	add    %eax,-0xc(%ebp)
+  }
+  // Free chunks are never adjacent, so the one below is in use.
+  c->size = size | PREVUSED;
+     c4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c4f:	83 c8 02             	or     $0x2,%eax
+     c52:	89 c2                	mov    %eax,%edx
+     c54:	8b 45 08             	mov    0x8(%ebp),%eax
+     c57:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+     c59:	8b 45 08             	mov    0x8(%ebp),%eax
+     c5c:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  FOOTER(c) = size;
+     c63:	8b 45 08             	mov    0x8(%ebp),%eax
+     c66:	8b 00                	mov    (%eax),%eax
+     c68:	83 e0 f8             	and    $0xfffffff8,%eax
+     c6b:	8d 50 fc             	lea    -0x4(%eax),%edx
+     c6e:	8b 45 08             	mov    0x8(%ebp),%eax
+     c71:	01 c2                	add    %eax,%edx
+     c73:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c76:	89 02                	mov    %eax,(%edx)
+  n = NEXTC(c);
+     c78:	8b 45 08             	mov    0x8(%ebp),%eax
+     c7b:	8b 00                	mov    (%eax),%eax
+     c7d:	83 e0 f8             	and    $0xfffffff8,%eax
+     c80:	89 c2                	mov    %eax,%edx
+     c82:	8b 45 08             	mov    0x8(%ebp),%eax
+     c85:	01 d0                	add    %edx,%eax
+     c87:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  n->size &= ~PREVUSED;
+     c8a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c8d:	8b 00                	mov    (%eax),%eax
+     c8f:	83 e0 fd             	and    $0xfffffffd,%eax
+     c92:	89 c2                	mov    %eax,%edx
+     c94:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c97:	89 10                	mov    %edx,(%eax)
+
+  if(trim && n == top && size >= TRIMSIZE && sbrk(0) == (char*)top + HDRSIZE){
+     c99:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     c9d:	74 51                	je     cf0 <freechunk+0x125>
+     c9f:	a1 2c 1a 00 00       	mov    0x1a2c,%eax
+     ca4:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     ca7:	75 47                	jne    cf0 <freechunk+0x125>
+     ca9:	81 7d f4 ff 7f 00 00 	cmpl   $0x7fff,-0xc(%ebp)
+     cb0:	76 3e                	jbe    cf0 <freechunk+0x125>
+     cb2:	83 ec 0c             	sub    $0xc,%esp
+     cb5:	6a 00                	push   $0x0
+     cb7:	e8 30 fb ff ff       	call   7ec <sbrk>
+     cbc:	83 c4 10             	add    $0x10,%esp
+     cbf:	8b 15 2c 1a 00 00    	mov    0x1a2c,%edx
+     cc5:	83 c2 08             	add    $0x8,%edx
+     cc8:	39 d0                	cmp    %edx,%eax
+     cca:	75 24                	jne    cf0 <freechunk+0x125>
+    c->size = USED | PREVUSED;
+     ccc:	8b 45 08             	mov    0x8(%ebp),%eax
+     ccf:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+    top = c;
+     cd5:	8b 45 08             	mov    0x8(%ebp),%eax
+     cd8:	a3 2c 1a 00 00       	mov    %eax,0x1a2c
+    sbrk(-size);
+     cdd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ce0:	f7 d8                	neg    %eax
+     ce2:	83 ec 0c             	sub    $0xc,%esp
+     ce5:	50                   	push   %eax
+     ce6:	e8 01 fb ff ff       	call   7ec <sbrk>
+     ceb:	83 c4 10             	add    $0x10,%esp
+    return;
+     cee:	eb 0e                	jmp    cfe <freechunk+0x133>
+  }
+  bininsert(c);
+     cf0:	83 ec 0c             	sub    $0xc,%esp
+     cf3:	ff 75 08             	push   0x8(%ebp)
+     cf6:	e8 22 fe ff ff       	call   b1d <bininsert>
+     cfb:	83 c4 10             	add    $0x10,%esp
+}
+     cfe:	c9                   	leave
+     cff:	c3                   	ret
+
+00000d00 <morecore>:
+
+// Grow the heap by at least need bytes.
+static int
+morecore(uint need)
+{
+     d00:	55                   	push   %ebp
+     d01:	89 e5                	mov    %esp,%ebp
+     d03:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+  char *p;
+  uint n, pad;
+
+  n = need + MINCHUNK;
+     d06:	8b 45 08             	mov    0x8(%ebp),%eax
+     d09:	83 c0 18             	add    $0x18,%eax
+     d0c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(n < MINCORE)
+     d0f:	81 7d ec ff 3f 00 00 	cmpl   $0x3fff,-0x14(%ebp)
+     d16:	77 07                	ja     d1f <morecore+0x1f>
+    n = MINCORE;
+     d18:	c7 45 ec 00 40 00 00 	movl   $0x4000,-0x14(%ebp)
+  // Keep the break 8-aligned, with the end marker just below it.
+  pad = (8 - ((uint)sbrk(0) & 7)) & 7;
+     d1f:	83 ec 0c             	sub    $0xc,%esp
+     d22:	6a 00                	push   $0x0
+     d24:	e8 c3 fa ff ff       	call   7ec <sbrk>
+     d29:	83 c4 10             	add    $0x10,%esp
+     d2c:	83 e0 07             	and    $0x7,%eax
+     d2f:	ba 08 00 00 00       	mov    $0x8,%edx
+     d34:	29 c2                	sub    %eax,%edx
+     d36:	89 d0                	mov    %edx,%eax
+     d38:	83 e0 07             	and    $0x7,%eax
+     d3b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if((p = sbrk(pad + n)) == (char*)-1){
+     d3e:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     d41:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     d44:	01 d0                	add    %edx,%eax
+     d46:	83 ec 0c             	sub    $0xc,%esp
+     d49:	50                   	push   %eax
+     d4a:	e8 9d fa ff ff       	call   7ec <sbrk>
+     d4f:	83 c4 10             	add    $0x10,%esp
+     d52:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     d55:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     d59:	75 30                	jne    d8b <morecore+0x8b>
+    n = need + MINCHUNK;
+     d5b:	8b 45 08             	mov    0x8(%ebp),%eax
+     d5e:	83 c0 18             	add    $0x18,%eax
+     d61:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((p = sbrk(pad + n)) == (char*)-1)
+     d64:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     d67:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     d6a:	01 d0                	add    %edx,%eax
+     d6c:	83 ec 0c             	sub    $0xc,%esp
+     d6f:	50                   	push   %eax
+     d70:	e8 77 fa ff ff       	call   7ec <sbrk>
+     d75:	83 c4 10             	add    $0x10,%esp
+     d78:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     d7b:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     d7f:	75 0a                	jne    d8b <morecore+0x8b>
+      return -1;
+     d81:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     d86:	e9 8e 00 00 00       	jmp    e19 <morecore+0x119>
+  }
+  p += pad;
+     d8b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     d8e:	01 45 f0             	add    %eax,-0x10(%ebp)
+  if(top && p == (char*)top + HDRSIZE){
+     d91:	a1 2c 1a 00 00       	mov    0x1a2c,%eax
+     d96:	85 c0                	test   %eax,%eax
+     d98:	74 29                	je     dc3 <morecore+0xc3>
+     d9a:	a1 2c 1a 00 00       	mov    0x1a2c,%eax
+     d9f:	83 c0 08             	add    $0x8,%eax
+     da2:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     da5:	75 1c                	jne    dc3 <morecore+0xc3>
+    // Contiguous: the old end marker heads the new chunk.
+    c = top;
+     da7:	a1 2c 1a 00 00       	mov    0x1a2c,%eax
+     dac:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = n | (c->size & PREVUSED);
+     daf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     db2:	8b 00                	mov    (%eax),%eax
+     db4:	83 e0 02             	and    $0x2,%eax
+     db7:	0b 45 ec             	or     -0x14(%ebp),%eax
+     dba:	89 c2                	mov    %eax,%edx
+     dbc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     dbf:	89 10                	mov    %edx,(%eax)
+     dc1:	eb 16                	jmp    dd9 <morecore+0xd9>
+  } else {
+    // Someone else moved the break: start a new segment.
+    c = (struct chunk*)p;
+     dc3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     dc6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = (n - HDRSIZE) | PREVUSED;
+     dc9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     dcc:	83 e8 08             	sub    $0x8,%eax
+     dcf:	83 c8 02             	or     $0x2,%eax
+     dd2:	89 c2                	mov    %eax,%edx
+     dd4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     dd7:	89 10                	mov    %edx,(%eax)
+  }
+  top = NEXTC(c);
+     dd9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ddc:	8b 00                	mov    (%eax),%eax
+     dde:	83 e0 f8             	and    $0xfffffff8,%eax
+     de1:	89 c2                	mov    %eax,%edx
+     de3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     de6:	01 d0                	add    %edx,%eax
+     de8:	a3 2c 1a 00 00       	mov    %eax,0x1a2c
+  top->size = USED;
+     ded:	a1 2c 1a 00 00       	mov    0x1a2c,%eax
+     df2:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  top->tag = LARGE;
+     df8:	a1 2c 1a 00 00       	mov    0x1a2c,%eax
+     dfd:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  freechunk(c, 0);
+     e04:	83 ec 08             	sub    $0x8,%esp
+     e07:	6a 00                	push   $0x0
+     e09:	ff 75 f4             	push   -0xc(%ebp)
+     e0c:	e8 ba fd ff ff       	call   bcb <freechunk>
+     e11:	83 c4 10             	add    $0x10,%esp
+  return 0;
+     e14:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     e19:	c9                   	leave
+     e1a:	c3                   	ret
+
+00000e1b <largealloc>:
+
+static void*
+largealloc(uint nbytes)
+{
+     e1b:	55                   	push   %ebp
+     e1c:	89 e5                	mov    %esp,%ebp
+     e1e:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c, *r;
+  uint need;
+  int i;
+
+  if(nbytes > 0x7fffffff)
+     e21:	8b 45 08             	mov    0x8(%ebp),%eax
+     e24:	85 c0                	test   %eax,%eax
+     e26:	79 0a                	jns    e32 <largealloc+0x17>
+    return 0;
+     e28:	b8 00 00 00 00       	mov    $0x0,%eax
+     e2d:	e9 43 01 00 00       	jmp    f75 <largealloc+0x15a>
+  need = (nbytes + HDRSIZE + 7) & ~7;
+     e32:	8b 45 08             	mov    0x8(%ebp),%eax
+     e35:	83 c0 0f             	add    $0xf,%eax
+     e38:	83 e0 f8             	and    $0xfffffff8,%eax
+     e3b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(need < MINCHUNK)
+     e3e:	83 7d f0 17          	cmpl   $0x17,-0x10(%ebp)
+     e42:	77 07                	ja     e4b <largealloc+0x30>
+    need = MINCHUNK;
+     e44:	c7 45 f0 18 00 00 00 	movl   $0x18,-0x10(%ebp)
+  for(;;){
+    for(i = binof(need); i < NBIN; i++)
+     e4b:	ff 75 f0             	push   -0x10(%ebp)
+     e4e:	e8 9f fc ff ff       	call   af2 <binof>
+     e53:	83 c4 04             	add    $0x4,%esp
+     e56:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     e59:	eb 2f                	jmp    e8a <largealloc+0x6f>
+      for(c = bins[i]; c; c = c->next)
+     e5b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     e5e:	8b 04 85 c0 19 00 00 	mov    0x19c0(,%eax,4),%eax
+     e65:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     e68:	eb 16                	jmp    e80 <largealloc+0x65>
+        if(CSIZE(c) >= need)
+     e6a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e6d:	8b 00                	mov    (%eax),%eax
+     e6f:	83 e0 f8             	and    $0xfffffff8,%eax
+     e72:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     e75:	73 35                	jae    eac <largealloc+0x91>
+      for(c = bins[i]; c; c = c->next)
+     e77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e7a:	8b 40 08             	mov    0x8(%eax),%eax
+     e7d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     e80:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     e84:	75 e4                	jne    e6a <largealloc+0x4f>
+    for(i = binof(need); i < NBIN; i++)
+     e86:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     e8a:	83 7d ec 1a          	cmpl   $0x1a,-0x14(%ebp)
+     e8e:	7e cb                	jle    e5b <largealloc+0x40>
+          goto found;
+    if(morecore(need) < 0)
+     e90:	83 ec 0c             	sub    $0xc,%esp
+     e93:	ff 75 f0             	push   -0x10(%ebp)
+     e96:	e8 65 fe ff ff       	call   d00 <morecore>
+     e9b:	83 c4 10             	add    $0x10,%esp
+     e9e:	85 c0                	test   %eax,%eax
+     ea0:	79 a9                	jns    e4b <largealloc+0x30>
+      return 0;
+     ea2:	b8 00 00 00 00       	mov    $0x0,%eax
+     ea7:	e9 c9 00 00 00       	jmp    f75 <largealloc+0x15a>
+          goto found;
+     eac:	90                   	nop
+  }
+
+found:
+  binremove(c);
+     ead:	83 ec 0c             	sub    $0xc,%esp
+     eb0:	ff 75 f4             	push   -0xc(%ebp)
+     eb3:	e8 bb fc ff ff       	call   b73 <binremove>
+     eb8:	83 c4 10             	add    $0x10,%esp
+  if(CSIZE(c) - need >= MINCHUNK){
+     ebb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ebe:	8b 00                	mov    (%eax),%eax
+     ec0:	83 e0 f8             	and    $0xfffffff8,%eax
+     ec3:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     ec6:	83 f8 17             	cmp    $0x17,%eax
+     ec9:	76 66                	jbe    f31 <largealloc+0x116>
+    r = (struct chunk*)((char*)c + need);
+     ecb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     ece:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ed1:	01 d0                	add    %edx,%eax
+     ed3:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    r->size = (CSIZE(c) - need) | PREVUSED;
+     ed6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ed9:	8b 00                	mov    (%eax),%eax
+     edb:	83 e0 f8             	and    $0xfffffff8,%eax
+     ede:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     ee1:	83 c8 02             	or     $0x2,%eax
+     ee4:	89 c2                	mov    %eax,%edx
+     ee6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     ee9:	89 10                	mov    %edx,(%eax)
+    r->tag = LARGE;
+     eeb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     eee:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+    FOOTER(r) = CSIZE(r);
+     ef5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     ef8:	8b 10                	mov    (%eax),%edx
+     efa:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     efd:	8b 00                	mov    (%eax),%eax
+     eff:	83 e0 f8             	and    $0xfffffff8,%eax
+     f02:	8d 48 fc             	lea    -0x4(%eax),%ecx
+     f05:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f08:	01 c8                	add    %ecx,%eax
+     f0a:	83 e2 f8             	and    $0xfffffff8,%edx
+     f0d:	89 10                	mov    %edx,(%eax)
+    bininsert(r);
+     f0f:	83 ec 0c             	sub    $0xc,%esp
+     f12:	ff 75 e8             	push   -0x18(%ebp)
+     f15:	e8 03 fc ff ff       	call   b1d <bininsert>
+     f1a:	83 c4 10             	add    $0x10,%esp
+    c->size = need | (c->size & PREVUSED);
+     f1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f20:	8b 00                	mov    (%eax),%eax
+     f22:	83 e0 02             	and    $0x2,%eax
+     f25:	0b 45 f0             	or     -0x10(%ebp),%eax
+     f28:	89 c2                	mov    %eax,%edx
+     f2a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f2d:	89 10                	mov    %edx,(%eax)
+     f2f:	eb 25                	jmp    f56 <largealloc+0x13b>
+  } else
+    NEXTC(c)->size |= PREVUSED;
+     f31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f34:	8b 00                	mov    (%eax),%eax
+     f36:	83 e0 f8             	and    $0xfffffff8,%eax
+     f39:	89 c2                	mov    %eax,%edx
+     f3b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f3e:	01 d0                	add    %edx,%eax
+     f40:	8b 10                	mov    (%eax),%edx
+     f42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f45:	8b 00                	mov    (%eax),%eax
+     f47:	83 e0 f8             	and    $0xfffffff8,%eax
+     f4a:	89 c1                	mov    %eax,%ecx
+     f4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f4f:	01 c8                	add    %ecx,%eax
+     f51:	83 ca 02             	or     $0x2,%edx
+     f54:	89 10                	mov    %edx,(%eax)
+  c->size |= USED;
+     f56:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f59:	8b 00                	mov    (%eax),%eax
+     f5b:	83 c8 01             	or     $0x1,%eax
+     f5e:	89 c2                	mov    %eax,%edx
+     f60:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f63:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+     f65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f68:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  return (char*)c + HDRSIZE;
+     f6f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f72:	83 c0 08             	add    $0x8,%eax
+}
+     f75:	c9                   	leave
+     f76:	c3                   	ret
+
+00000f77 <refill>:
+
+// Carve a slab into free blocks of class k.
+static int
+refill(int k)
+{
+     f77:	55                   	push   %ebp
+     f78:	89 e5                	mov    %esp,%ebp
+     f7a:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  char *p;
+  uint bs, i;
+
+  if((p = largealloc(SLABSIZE)) == 0)
+     f7d:	83 ec 0c             	sub    $0xc,%esp
+     f80:	68 00 20 00 00       	push   $0x2000
+     f85:	e8 91 fe ff ff       	call   e1b <largealloc>
+     f8a:	83 c4 10             	add    $0x10,%esp
+     f8d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f90:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     f94:	75 07                	jne    f9d <refill+0x26>
+    return -1;
+     f96:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     f9b:	eb 75                	jmp    1012 <refill+0x9b>
+  bs = HDRSIZE + (MINSMALL << k);
+     f9d:	8b 45 08             	mov    0x8(%ebp),%eax
+     fa0:	ba 10 00 00 00       	mov    $0x10,%edx
+     fa5:	89 c1                	mov    %eax,%ecx
+     fa7:	d3 e2                	shl    %cl,%edx
+     fa9:	89 d0                	mov    %edx,%eax
+     fab:	83 c0 08             	add    $0x8,%eax
+     fae:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+     fb1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     fb8:	eb 44                	jmp    ffe <refill+0x87>
+    b = (struct chunk*)(p + i);
+     fba:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     fbd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fc0:	01 d0                	add    %edx,%eax
+     fc2:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    b->size = bs | USED;
+     fc5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fc8:	83 c8 01             	or     $0x1,%eax
+     fcb:	89 c2                	mov    %eax,%edx
+     fcd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     fd0:	89 10                	mov    %edx,(%eax)
+    b->tag = k;
+     fd2:	8b 55 08             	mov    0x8(%ebp),%edx
+     fd5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     fd8:	89 50 04             	mov    %edx,0x4(%eax)
+    b->next = classes[k];
+     fdb:	8b 45 08             	mov    0x8(%ebp),%eax
+     fde:	8b 14 85 a0 19 00 00 	mov    0x19a0(,%eax,4),%edx
+     fe5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     fe8:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[k] = b;
+     feb:	8b 45 08             	mov    0x8(%ebp),%eax
+     fee:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     ff1:	89 14 85 a0 19 00 00 	mov    %edx,0x19a0(,%eax,4)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+     ff8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     ffb:	01 45 f4             	add    %eax,-0xc(%ebp)
+     ffe:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1001:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1004:	01 d0                	add    %edx,%eax
+    1006:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    100b:	76 ad                	jbe    fba <refill+0x43>
+  }
+  return 0;
+    100d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1012:	c9                   	leave
+    1013:	c3                   	ret
+
+00001014 <free>:
+
+void
+free(void *ap)
+{
+    1014:	55                   	push   %ebp
+    1015:	89 e5                	mov    %esp,%ebp
+    1017:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+
+  if(ap == 0)
+    101a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    101e:	74 4b                	je     106b <free+0x57>
+    return;
+  c = (struct chunk*)((char*)ap - HDRSIZE);
+    1020:	8b 45 08             	mov    0x8(%ebp),%eax
+    1023:	83 e8 08             	sub    $0x8,%eax
+    1026:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(c->tag != LARGE){
+    1029:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    102c:	8b 40 04             	mov    0x4(%eax),%eax
+    102f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1032:	74 25                	je     1059 <free+0x45>
+    c->next = classes[c->tag];
+    1034:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1037:	8b 40 04             	mov    0x4(%eax),%eax
+    103a:	8b 14 85 a0 19 00 00 	mov    0x19a0(,%eax,4),%edx
+    1041:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1044:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[c->tag] = c;
+    1047:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    104a:	8b 40 04             	mov    0x4(%eax),%eax
+    104d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1050:	89 14 85 a0 19 00 00 	mov    %edx,0x19a0(,%eax,4)
+    return;
+    1057:	eb 13                	jmp    106c <free+0x58>
+  }
+  freechunk(c, 1);
+    1059:	83 ec 08             	sub    $0x8,%esp
+    105c:	6a 01                	push   $0x1
+    105e:	ff 75 f4             	push   -0xc(%ebp)
+    1061:	e8 65 fb ff ff       	call   bcb <freechunk>
+    1066:	83 c4 10             	add    $0x10,%esp
+    1069:	eb 01                	jmp    106c <free+0x58>
+    return;
+    106b:	90                   	nop
+}
+    106c:	c9                   	leave
+    106d:	c3                   	ret
+
+0000106e <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    106e:	55                   	push   %ebp
+    106f:	89 e5                	mov    %esp,%ebp
+    1071:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  int k;
+
+  if(nbytes > MAXSMALL)
+    1074:	81 7d 08 00 08 00 00 	cmpl   $0x800,0x8(%ebp)
+    107b:	76 10                	jbe    108d <malloc+0x1f>
+    return largealloc(nbytes);
+    107d:	83 ec 0c             	sub    $0xc,%esp
+    1080:	ff 75 08             	push   0x8(%ebp)
+    1083:	e8 93 fd ff ff       	call   e1b <largealloc>
+    1088:	83 c4 10             	add    $0x10,%esp
+    108b:	eb 6a                	jmp    10f7 <malloc+0x89>
+  for(k = 0; (MINSMALL << k) < nbytes; k++)
+    108d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1094:	eb 04                	jmp    109a <malloc+0x2c>
+    1096:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    109a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    109d:	ba 10 00 00 00       	mov    $0x10,%edx
+    10a2:	89 c1                	mov    %eax,%ecx
+    10a4:	d3 e2                	shl    %cl,%edx
+    10a6:	89 d0                	mov    %edx,%eax
+    10a8:	3b 45 08             	cmp    0x8(%ebp),%eax
+    10ab:	72 e9                	jb     1096 <malloc+0x28>
+    ;
+  if(classes[k] == 0 && refill(k) < 0)
+    10ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10b0:	8b 04 85 a0 19 00 00 	mov    0x19a0(,%eax,4),%eax
+    10b7:	85 c0                	test   %eax,%eax
+    10b9:	75 19                	jne    10d4 <malloc+0x66>
+    10bb:	83 ec 0c             	sub    $0xc,%esp
+    10be:	ff 75 f4             	push   -0xc(%ebp)
+    10c1:	e8 b1 fe ff ff       	call   f77 <refill>
+    10c6:	83 c4 10             	add    $0x10,%esp
+    10c9:	85 c0                	test   %eax,%eax
+    10cb:	79 07                	jns    10d4 <malloc+0x66>
+    return 0;
+    10cd:	b8 00 00 00 00       	mov    $0x0,%eax
+    10d2:	eb 23                	jmp    10f7 <malloc+0x89>
+  b = classes[k];
+    10d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10d7:	8b 04 85 a0 19 00 00 	mov    0x19a0(,%eax,4),%eax
+    10de:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  classes[k] = b->next;
+    10e1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    10e4:	8b 50 08             	mov    0x8(%eax),%edx
+    10e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10ea:	89 14 85 a0 19 00 00 	mov    %edx,0x19a0(,%eax,4)
+  return (char*)b + HDRSIZE;
+    10f1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    10f4:	83 c0 08             	add    $0x8,%eax
+}
+    10f7:	c9                   	leave
+    10f8:	c3                   	ret
+
+000010f9 <stream>:
+
+// Return the stream for fd, deciding on first use how
+// its output is buffered.  Returns 0 if fd is not open.
+static struct stream*
+stream(int fd)
+{
+    10f9:	55                   	push   %ebp
+    10fa:	89 e5                	mov    %esp,%ebp
+    10fc:	83 ec 28             	sub    $0x28,%esp
+  struct stream *s;
+  struct stat st;
+
+  if(fd < 0 || fd >= NOFILE)
+    10ff:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1103:	78 06                	js     110b <stream+0x12>
+    1105:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    1109:	7e 07                	jle    1112 <stream+0x19>
+    return 0;
+    110b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1110:	eb 55                	jmp    1167 <stream+0x6e>
+  s = &streams[fd];
+    1112:	8b 45 08             	mov    0x8(%ebp),%eax
+    1115:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    111b:	05 40 1a 00 00       	add    $0x1a40,%eax
+    1120:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(s->mode == UNKNOWN){
+    1123:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1126:	8b 00                	mov    (%eax),%eax
+    1128:	85 c0                	test   %eax,%eax
+    112a:	75 38                	jne    1164 <stream+0x6b>
+    if(fstat(fd, &st) < 0)
+    112c:	83 ec 08             	sub    $0x8,%esp
+    112f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1132:	50                   	push   %eax
+    1133:	ff 75 08             	push   0x8(%ebp)
+    1136:	e8 57 f6 ff ff       	call   792 <fstat>
+    113b:	83 c4 10             	add    $0x10,%esp
+    113e:	85 c0                	test   %eax,%eax
+    1140:	79 07                	jns    1149 <stream+0x50>
+      return 0;
+    1142:	b8 00 00 00 00       	mov    $0x0,%eax
+    1147:	eb 1e                	jmp    1167 <stream+0x6e>
+    s->mode = st.type == T_DEV ? LINEBUF : FULLBUF;
+    1149:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+    114d:	66 83 f8 03          	cmp    $0x3,%ax
+    1151:	75 07                	jne    115a <stream+0x61>
+    1153:	ba 01 00 00 00       	mov    $0x1,%edx
+    1158:	eb 05                	jmp    115f <stream+0x66>
+    115a:	ba 02 00 00 00       	mov    $0x2,%edx
+    115f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1162:	89 10                	mov    %edx,(%eax)
+  }
+  return s;
+    1164:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1167:	c9                   	leave
+    1168:	c3                   	ret
+
+00001169 <fflush>:
+
+int
+fflush(int fd)
+{
+    1169:	55                   	push   %ebp
+    116a:	89 e5                	mov    %esp,%ebp
+    116c:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  int i, n;
+
+  if(fd < 0 || fd >= NOFILE)
+    116f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1173:	78 06                	js     117b <fflush+0x12>
+    1175:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    1179:	7e 07                	jle    1182 <fflush+0x19>
+    return -1;
+    117b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1180:	eb 78                	jmp    11fa <fflush+0x91>
+  s = &streams[fd];
+    1182:	8b 45 08             	mov    0x8(%ebp),%eax
+    1185:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    118b:	05 40 1a 00 00       	add    $0x1a40,%eax
+    1190:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < s->nout; i += n){
+    1193:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    119a:	eb 44                	jmp    11e0 <fflush+0x77>
+    if((n = write(fd, s->out + i, s->nout - i)) <= 0){
+    119c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    119f:	8b 40 04             	mov    0x4(%eax),%eax
+    11a2:	2b 45 f4             	sub    -0xc(%ebp),%eax
+    11a5:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    11a8:	8d 4a 10             	lea    0x10(%edx),%ecx
+    11ab:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    11ae:	01 ca                	add    %ecx,%edx
+    11b0:	83 ec 04             	sub    $0x4,%esp
+    11b3:	50                   	push   %eax
+    11b4:	52                   	push   %edx
+    11b5:	ff 75 08             	push   0x8(%ebp)
+    11b8:	e8 6c f5 ff ff       	call   729 <write>
+    11bd:	83 c4 10             	add    $0x10,%esp
+    11c0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    11c3:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    11c7:	7f 11                	jg     11da <fflush+0x71>
+      s->nout = 0;
+    11c9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    11cc:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+      return -1;
+    11d3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    11d8:	eb 20                	jmp    11fa <fflush+0x91>
+  for(i = 0; i < s->nout; i += n){
+    11da:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    11dd:	01 45 f4             	add    %eax,-0xc(%ebp)
+    11e0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    11e3:	8b 40 04             	mov    0x4(%eax),%eax
+    11e6:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    11e9:	7c b1                	jl     119c <fflush+0x33>
+    }
+  }
+  s->nout = 0;
+    11eb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    11ee:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  return 0;
+    11f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    11fa:	c9                   	leave
+    11fb:	c3                   	ret
+
+000011fc <flushall>:
+
+// Flush every stream, or only line-buffered ones.
+static void
+flushall(int lineonly)
+{
+    11fc:	55                   	push   %ebp
+    11fd:	89 e5                	mov    %esp,%ebp
+    11ff:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+    1202:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1209:	eb 41                	jmp    124c <flushall+0x50>
+    if(streams[fd].nout > 0 && (!lineonly || streams[fd].mode == LINEBUF))
+    120b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    120e:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1214:	05 44 1a 00 00       	add    $0x1a44,%eax
+    1219:	8b 00                	mov    (%eax),%eax
+    121b:	85 c0                	test   %eax,%eax
+    121d:	7e 29                	jle    1248 <flushall+0x4c>
+    121f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1223:	74 15                	je     123a <flushall+0x3e>
+    1225:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1228:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    122e:	05 40 1a 00 00       	add    $0x1a40,%eax
+    1233:	8b 00                	mov    (%eax),%eax
+    1235:	83 f8 01             	cmp    $0x1,%eax
+    1238:	75 0e                	jne    1248 <flushall+0x4c>
+      fflush(fd);
+    123a:	83 ec 0c             	sub    $0xc,%esp
+    123d:	ff 75 f4             	push   -0xc(%ebp)
+    1240:	e8 24 ff ff ff       	call   1169 <fflush>
+    1245:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++)
+    1248:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    124c:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+    1250:	7e b9                	jle    120b <flushall+0xf>
+}
+    1252:	90                   	nop
+    1253:	90                   	nop
+    1254:	c9                   	leave
+    1255:	c3                   	ret
+
+00001256 <fputc>:
+
+int
+fputc(int fd, int c)
+{
+    1256:	55                   	push   %ebp
+    1257:	89 e5                	mov    %esp,%ebp
+    1259:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  char ch;
+
+  if((s = stream(fd)) == 0){
+    125c:	83 ec 0c             	sub    $0xc,%esp
+    125f:	ff 75 08             	push   0x8(%ebp)
+    1262:	e8 92 fe ff ff       	call   10f9 <stream>
+    1267:	83 c4 10             	add    $0x10,%esp
+    126a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    126d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1271:	75 2e                	jne    12a1 <fputc+0x4b>
+    ch = c;
+    1273:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1276:	88 45 f3             	mov    %al,-0xd(%ebp)
+    return write(fd, &ch, 1) == 1 ? (uchar)c : -1;
+    1279:	83 ec 04             	sub    $0x4,%esp
+    127c:	6a 01                	push   $0x1
+    127e:	8d 45 f3             	lea    -0xd(%ebp),%eax
+    1281:	50                   	push   %eax
+    1282:	ff 75 08             	push   0x8(%ebp)
+    1285:	e8 9f f4 ff ff       	call   729 <write>
+    128a:	83 c4 10             	add    $0x10,%esp
+    128d:	83 f8 01             	cmp    $0x1,%eax
+    1290:	75 08                	jne    129a <fputc+0x44>
+    1292:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1295:	0f b6 c0             	movzbl %al,%eax
+    1298:	eb 5e                	jmp    12f8 <fputc+0xa2>
+    129a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    129f:	eb 57                	jmp    12f8 <fputc+0xa2>
+  }
+  s->out[s->nout++] = c;
+    12a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12a4:	8b 40 04             	mov    0x4(%eax),%eax
+    12a7:	8d 48 01             	lea    0x1(%eax),%ecx
+    12aa:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    12ad:	89 4a 04             	mov    %ecx,0x4(%edx)
+    12b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+    12b3:	89 d1                	mov    %edx,%ecx
+    12b5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    12b8:	88 4c 02 10          	mov    %cl,0x10(%edx,%eax,1)
+  if(s->nout == BUFSZ || (s->mode == LINEBUF && c == '\n'))
+    12bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12bf:	8b 40 04             	mov    0x4(%eax),%eax
+    12c2:	3d 00 02 00 00       	cmp    $0x200,%eax
+    12c7:	74 10                	je     12d9 <fputc+0x83>
+    12c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12cc:	8b 00                	mov    (%eax),%eax
+    12ce:	83 f8 01             	cmp    $0x1,%eax
+    12d1:	75 1f                	jne    12f2 <fputc+0x9c>
+    12d3:	83 7d 0c 0a          	cmpl   $0xa,0xc(%ebp)
+    12d7:	75 19                	jne    12f2 <fputc+0x9c>
+    if(fflush(fd) < 0)
+    12d9:	83 ec 0c             	sub    $0xc,%esp
+    12dc:	ff 75 08             	push   0x8(%ebp)
+    12df:	e8 85 fe ff ff       	call   1169 <fflush>
+    12e4:	83 c4 10             	add    $0x10,%esp
+    12e7:	85 c0                	test   %eax,%eax
+    12e9:	79 07                	jns    12f2 <fputc+0x9c>
+      return -1;
+    12eb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12f0:	eb 06                	jmp    12f8 <fputc+0xa2>
+  return (uchar)c;
+    12f2:	8b 45 0c             	mov    0xc(%ebp),%eax
+    12f5:	0f b6 c0             	movzbl %al,%eax
+}
+    12f8:	c9                   	leave
+    12f9:	c3                   	ret
+
+000012fa <fgetc>:
+
+// Return the next byte read from fd, or -1 at end of file.
+int
+fgetc(int fd)
+{
+    12fa:	55                   	push   %ebp
+    12fb:	89 e5                	mov    %esp,%ebp
+    12fd:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  uchar c;
+  int n;
+
+  if((s = stream(fd)) == 0){
+    1300:	83 ec 0c             	sub    $0xc,%esp
+    1303:	ff 75 08             	push   0x8(%ebp)
+    1306:	e8 ee fd ff ff       	call   10f9 <stream>
+    130b:	83 c4 10             	add    $0x10,%esp
+    130e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1311:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1315:	75 39                	jne    1350 <fgetc+0x56>
+    flushall(1);
+    1317:	83 ec 0c             	sub    $0xc,%esp
+    131a:	6a 01                	push   $0x1
+    131c:	e8 db fe ff ff       	call   11fc <flushall>
+    1321:	83 c4 10             	add    $0x10,%esp
+    return read(fd, &c, 1) == 1 ? c : -1;
+    1324:	83 ec 04             	sub    $0x4,%esp
+    1327:	6a 01                	push   $0x1
+    1329:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    132c:	50                   	push   %eax
+    132d:	ff 75 08             	push   0x8(%ebp)
+    1330:	e8 e5 f3 ff ff       	call   71a <read>
+    1335:	83 c4 10             	add    $0x10,%esp
+    1338:	83 f8 01             	cmp    $0x1,%eax
+    133b:	75 0c                	jne    1349 <fgetc+0x4f>
+    133d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    1341:	0f b6 c0             	movzbl %al,%eax
+    1344:	e9 80 00 00 00       	jmp    13c9 <fgetc+0xcf>
+    1349:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    134e:	eb 79                	jmp    13c9 <fgetc+0xcf>
+  }
+  if(s->rpos == s->rend){
+    1350:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1353:	8b 50 08             	mov    0x8(%eax),%edx
+    1356:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1359:	8b 40 0c             	mov    0xc(%eax),%eax
+    135c:	39 c2                	cmp    %eax,%edx
+    135e:	75 4c                	jne    13ac <fgetc+0xb2>
+    flushall(1);
+    1360:	83 ec 0c             	sub    $0xc,%esp
+    1363:	6a 01                	push   $0x1
+    1365:	e8 92 fe ff ff       	call   11fc <flushall>
+    136a:	83 c4 10             	add    $0x10,%esp
+    if((n = read(fd, s->in, BUFSZ)) <= 0)
+    136d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1370:	05 10 02 00 00       	add    $0x210,%eax
+    1375:	83 ec 04             	sub    $0x4,%esp
+    1378:	68 00 02 00 00       	push   $0x200
+    137d:	50                   	push   %eax
+    137e:	ff 75 08             	push   0x8(%ebp)
+    1381:	e8 94 f3 ff ff       	call   71a <read>
+    1386:	83 c4 10             	add    $0x10,%esp
+    1389:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    138c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1390:	7f 07                	jg     1399 <fgetc+0x9f>
+      return -1;
+    1392:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1397:	eb 30                	jmp    13c9 <fgetc+0xcf>
+    s->rpos = 0;
+    1399:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    139c:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+    s->rend = n;
+    13a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13a6:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    13a9:	89 50 0c             	mov    %edx,0xc(%eax)
+  }
+  return (uchar)s->in[s->rpos++];
+    13ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13af:	8b 40 08             	mov    0x8(%eax),%eax
+    13b2:	8d 48 01             	lea    0x1(%eax),%ecx
+    13b5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    13b8:	89 4a 08             	mov    %ecx,0x8(%edx)
+    13bb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    13be:	0f b6 84 02 10 02 00 	movzbl 0x210(%edx,%eax,1),%eax
+    13c5:	00 
+    13c6:	0f b6 c0             	movzbl %al,%eax
+}
+    13c9:	c9                   	leave
+    13ca:	c3                   	ret
+
+000013cb <fork>:
+
+int
+fork(void)
+{
+    13cb:	55                   	push   %ebp
+    13cc:	89 e5                	mov    %esp,%ebp
+    13ce:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    13d1:	83 ec 0c             	sub    $0xc,%esp
+    13d4:	6a 00                	push   $0x0
+    13d6:	e8 21 fe ff ff       	call   11fc <flushall>
+    13db:	83 c4 10             	add    $0x10,%esp
+  return _fork();
+    13de:	e8 fb f2 ff ff       	call   6de <_fork>
+}
+    13e3:	c9                   	leave
+    13e4:	c3                   	ret
+
+000013e5 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+    13e5:	55                   	push   %ebp
+    13e6:	89 e5                	mov    %esp,%ebp
+    13e8:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    13eb:	83 ec 0c             	sub    $0xc,%esp
+    13ee:	6a 00                	push   $0x0
+    13f0:	e8 07 fe ff ff       	call   11fc <flushall>
+    13f5:	83 c4 10             	add    $0x10,%esp
+  return _exec(path, argv);
+    13f8:	83 ec 08             	sub    $0x8,%esp
+    13fb:	ff 75 0c             	push   0xc(%ebp)
+    13fe:	ff 75 08             	push   0x8(%ebp)
+    1401:	e8 50 f3 ff ff       	call   756 <_exec>
+    1406:	83 c4 10             	add    $0x10,%esp
+}
+    1409:	c9                   	leave
+    140a:	c3                   	ret
+
+0000140b <exit>:
+
+int
+exit(void)
+{
+    140b:	55                   	push   %ebp
+    140c:	89 e5                	mov    %esp,%ebp
+    140e:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1411:	83 ec 0c             	sub    $0xc,%esp
+    1414:	6a 00                	push   $0x0
+    1416:	e8 e1 fd ff ff       	call   11fc <flushall>
+    141b:	83 c4 10             	add    $0x10,%esp
+  _exit();
+    141e:	e8 ca f2 ff ff       	call   6ed <_exit>
+
+00001423 <close>:
+}
+
+int
+close(int fd)
+{
+    1423:	55                   	push   %ebp
+    1424:	89 e5                	mov    %esp,%ebp
+    1426:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+
+  if(fd >= 0 && fd < NOFILE){
+    1429:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    142d:	78 44                	js     1473 <close+0x50>
+    142f:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    1433:	7f 3e                	jg     1473 <close+0x50>
+    fflush(fd);
+    1435:	83 ec 0c             	sub    $0xc,%esp
+    1438:	ff 75 08             	push   0x8(%ebp)
+    143b:	e8 29 fd ff ff       	call   1169 <fflush>
+    1440:	83 c4 10             	add    $0x10,%esp
+    s = &streams[fd];
+    1443:	8b 45 08             	mov    0x8(%ebp),%eax
+    1446:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    144c:	05 40 1a 00 00       	add    $0x1a40,%eax
+    1451:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    s->mode = UNKNOWN;
+    1454:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1457:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    s->rpos = s->rend = 0;
+    145d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1460:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    1467:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    146a:	8b 50 0c             	mov    0xc(%eax),%edx
+    146d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1470:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  return _close(fd);
+    1473:	83 ec 0c             	sub    $0xc,%esp
+    1476:	ff 75 08             	push   0x8(%ebp)
+    1479:	e8 ba f2 ff ff       	call   738 <_close>
+    147e:	83 c4 10             	add    $0x10,%esp
+}
+    1481:	c9                   	leave
+    1482:	c3                   	ret
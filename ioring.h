@@ -0,0 +1,37 @@
+// Batched system call ring, shared between a user program
+// and the kernel.  The program fills in submission entries
+// at sq[sqtail], advances sqtail, and calls iosubmit(); the
+// kernel consumes entries from sqhead and posts a completion
+// for each at cq[cqtail].  The program reaps completions
+// from cqhead.  Indices only ever increase; slots are taken
+// modulo IORING_SIZE.
+
+#define IORING_SIZE 32
+
+// Operations
+#define IO_READ   1  // read(fd, addr, n)
+#define IO_WRITE  2  // write(fd, addr, n)
+#define IO_OPEN   3  // open(addr, n), n is the mode
+#define IO_CLOSE  4  // close(fd)
+
+struct iosqe {
+  int op;      // IO_READ, IO_WRITE, ...
+  int fd;      // file descriptor
+  uint addr;   // buffer or path
+  int n;       // byte count or open mode
+  uint data;   // copied to the completion, for the caller's use
+};
+
+struct iocqe {
+  int res;     // what the equivalent system call returned
+  uint data;   // from the submission
+};
+
+struct ioring {
+  uint sqhead;  // advanced by the kernel
+  uint sqtail;  // advanced by the program
+  uint cqhead;  // advanced by the program
+  uint cqtail;  // advanced by the kernel
+  struct iosqe sq[IORING_SIZE];
+  struct iocqe cq[IORING_SIZE];
+};
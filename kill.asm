@@ -0,0 +1,2601 @@
+
+_kill:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	53                   	push   %ebx
+       e:	51                   	push   %ecx
+       f:	83 ec 10             	sub    $0x10,%esp
+      12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 2){
+      14:	83 3b 01             	cmpl   $0x1,(%ebx)
+      17:	7f 17                	jg     30 <main+0x30>
+    printf(2, "usage: kill pid...\n");
+      19:	83 ec 08             	sub    $0x8,%esp
+      1c:	68 f4 13 00 00       	push   $0x13f4
+      21:	6a 02                	push   $0x2
+      23:	e8 b8 08 00 00       	call   8e0 <printf>
+      28:	83 c4 10             	add    $0x10,%esp
+    exit();
+      2b:	e8 4c 13 00 00       	call   137c <exit>
+  }
+  for(i=1; i<argc; i++)
+      30:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+      37:	eb 2d                	jmp    66 <main+0x66>
+    kill(atoi(argv[i]));
+      39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      3c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+      43:	8b 43 04             	mov    0x4(%ebx),%eax
+      46:	01 d0                	add    %edx,%eax
+      48:	8b 00                	mov    (%eax),%eax
+      4a:	83 ec 0c             	sub    $0xc,%esp
+      4d:	50                   	push   %eax
+      4e:	e8 82 04 00 00       	call   4d5 <atoi>
+      53:	83 c4 10             	add    $0x10,%esp
+      56:	83 ec 0c             	sub    $0xc,%esp
+      59:	50                   	push   %eax
+      5a:	e8 59 06 00 00       	call   6b8 <kill>
+      5f:	83 c4 10             	add    $0x10,%esp
+  for(i=1; i<argc; i++)
+      62:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+      66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      69:	3b 03                	cmp    (%ebx),%eax
+      6b:	7c cc                	jl     39 <main+0x39>
+  exit();
+      6d:	e8 0a 13 00 00       	call   137c <exit>
+
+00000072 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+      72:	55                   	push   %ebp
+      73:	89 e5                	mov    %esp,%ebp
+      75:	57                   	push   %edi
+      76:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+      77:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      7a:	8b 55 10             	mov    0x10(%ebp),%edx
+      7d:	8b 45 0c             	mov    0xc(%ebp),%eax
+      80:	89 cb                	mov    %ecx,%ebx
+      82:	89 df                	mov    %ebx,%edi
+      84:	89 d1                	mov    %edx,%ecx
+      86:	fc                   	cld
+      87:	f3 aa                	rep stos %al,%es:(%edi)
+      89:	89 ca                	mov    %ecx,%edx
+      8b:	89 fb                	mov    %edi,%ebx
+      8d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+      90:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+      93:	90                   	nop
+      94:	5b                   	pop    %ebx
+      95:	5f                   	pop    %edi
+      96:	5d                   	pop    %ebp
+      97:	c3                   	ret
+
+00000098 <stosl>:
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+      98:	55                   	push   %ebp
+      99:	89 e5                	mov    %esp,%ebp
+      9b:	57                   	push   %edi
+      9c:	53                   	push   %ebx
+  asm volatile("cld; rep stosl" :
+      9d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      a0:	8b 55 10             	mov    0x10(%ebp),%edx
+      a3:	8b 45 0c             	mov    0xc(%ebp),%eax
+      a6:	89 cb                	mov    %ecx,%ebx
+      a8:	89 df                	mov    %ebx,%edi
+      aa:	89 d1                	mov    %edx,%ecx
+      ac:	fc                   	cld
+      ad:	f3 ab                	rep stos %eax,%es:(%edi)
+      af:	89 ca                	mov    %ecx,%edx
+      b1:	89 fb                	mov    %edi,%ebx
+      b3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+      b6:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+      b9:	90                   	nop
+      ba:	5b                   	pop    %ebx
+      bb:	5f                   	pop    %edi
+      bc:	5d                   	pop    %ebp
+      bd:	c3                   	ret
+
+000000be <movsb>:
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+      be:	55                   	push   %ebp
+      bf:	89 e5                	mov    %esp,%ebp
+      c1:	57                   	push   %edi
+      c2:	56                   	push   %esi
+      c3:	53                   	push   %ebx
+  asm volatile("cld; rep movsb" :
+      c4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+      ca:	8b 45 10             	mov    0x10(%ebp),%eax
+      cd:	89 cb                	mov    %ecx,%ebx
+      cf:	89 df                	mov    %ebx,%edi
+      d1:	89 d6                	mov    %edx,%esi
+      d3:	89 c1                	mov    %eax,%ecx
+      d5:	fc                   	cld
+      d6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+      d8:	89 c8                	mov    %ecx,%eax
+      da:	89 f2                	mov    %esi,%edx
+      dc:	89 fb                	mov    %edi,%ebx
+      de:	89 5d 08             	mov    %ebx,0x8(%ebp)
+      e1:	89 55 0c             	mov    %edx,0xc(%ebp)
+      e4:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+      e7:	90                   	nop
+      e8:	5b                   	pop    %ebx
+      e9:	5e                   	pop    %esi
+      ea:	5f                   	pop    %edi
+      eb:	5d                   	pop    %ebp
+      ec:	c3                   	ret
+
+000000ed <movsl>:
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+      ed:	55                   	push   %ebp
+      ee:	89 e5                	mov    %esp,%ebp
+      f0:	57                   	push   %edi
+      f1:	56                   	push   %esi
+      f2:	53                   	push   %ebx
+  asm volatile("cld; rep movsl" :
+      f3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+      f9:	8b 45 10             	mov    0x10(%ebp),%eax
+      fc:	89 cb                	mov    %ecx,%ebx
+      fe:	89 df                	mov    %ebx,%edi
+     100:	89 d6                	mov    %edx,%esi
+     102:	89 c1                	mov    %eax,%ecx
+     104:	fc                   	cld
+     105:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     107:	89 c8                	mov    %ecx,%eax
+     109:	89 f2                	mov    %esi,%edx
+     10b:	89 fb                	mov    %edi,%ebx
+     10d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     110:	89 55 0c             	mov    %edx,0xc(%ebp)
+     113:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     116:	90                   	nop
+     117:	5b                   	pop    %ebx
+     118:	5e                   	pop    %esi
+     119:	5f                   	pop    %edi
+     11a:	5d                   	pop    %ebp
+     11b:	c3                   	ret
+
+0000011c <strcpy>:
+#define ONES        0x01010101
+#define HASZERO(x)  (((x) - ONES) & ~(x) & (ONES << 7))
+
+char*
+strcpy(char *s, char *t)
+{
+     11c:	55                   	push   %ebp
+     11d:	89 e5                	mov    %esp,%ebp
+     11f:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+     122:	8b 45 08             	mov    0x8(%ebp),%eax
+     125:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     128:	90                   	nop
+     129:	8b 55 0c             	mov    0xc(%ebp),%edx
+     12c:	8d 42 01             	lea    0x1(%edx),%eax
+     12f:	89 45 0c             	mov    %eax,0xc(%ebp)
+     132:	8b 45 08             	mov    0x8(%ebp),%eax
+     135:	8d 48 01             	lea    0x1(%eax),%ecx
+     138:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     13b:	0f b6 12             	movzbl (%edx),%edx
+     13e:	88 10                	mov    %dl,(%eax)
+     140:	0f b6 00             	movzbl (%eax),%eax
+     143:	84 c0                	test   %al,%al
+     145:	75 e2                	jne    129 <strcpy+0xd>
+    ;
+  return os;
+     147:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     14a:	c9                   	leave
+     14b:	c3                   	ret
+
+0000014c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     14c:	55                   	push   %ebp
+     14d:	89 e5                	mov    %esp,%ebp
+  // Aligned words never straddle a page, so reading
+  // whole ones past the end of a string is safe.
+  if((((uint)p | (uint)q) & 3) == 0)
+     14f:	8b 55 08             	mov    0x8(%ebp),%edx
+     152:	8b 45 0c             	mov    0xc(%ebp),%eax
+     155:	09 d0                	or     %edx,%eax
+     157:	83 e0 03             	and    $0x3,%eax
+     15a:	85 c0                	test   %eax,%eax
+     15c:	75 3f                	jne    19d <strcmp+0x51>
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     15e:	eb 08                	jmp    168 <strcmp+0x1c>
+      p += 4, q += 4;
+     160:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     164:	83 45 0c 04          	addl   $0x4,0xc(%ebp)
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     168:	8b 45 08             	mov    0x8(%ebp),%eax
+     16b:	8b 10                	mov    (%eax),%edx
+     16d:	8b 45 0c             	mov    0xc(%ebp),%eax
+     170:	8b 00                	mov    (%eax),%eax
+     172:	39 c2                	cmp    %eax,%edx
+     174:	75 27                	jne    19d <strcmp+0x51>
+     176:	8b 45 08             	mov    0x8(%ebp),%eax
+     179:	8b 00                	mov    (%eax),%eax
+     17b:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     181:	8b 45 08             	mov    0x8(%ebp),%eax
+     184:	8b 00                	mov    (%eax),%eax
+     186:	f7 d0                	not    %eax
+     188:	21 d0                	and    %edx,%eax
+     18a:	25 80 80 80 80       	and    $0x80808080,%eax
+     18f:	85 c0                	test   %eax,%eax
+     191:	74 cd                	je     160 <strcmp+0x14>
+  while(*p && *p == *q)
+     193:	eb 08                	jmp    19d <strcmp+0x51>
+    p++, q++;
+     195:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     199:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     19d:	8b 45 08             	mov    0x8(%ebp),%eax
+     1a0:	0f b6 00             	movzbl (%eax),%eax
+     1a3:	84 c0                	test   %al,%al
+     1a5:	74 10                	je     1b7 <strcmp+0x6b>
+     1a7:	8b 45 08             	mov    0x8(%ebp),%eax
+     1aa:	0f b6 10             	movzbl (%eax),%edx
+     1ad:	8b 45 0c             	mov    0xc(%ebp),%eax
+     1b0:	0f b6 00             	movzbl (%eax),%eax
+     1b3:	38 c2                	cmp    %al,%dl
+     1b5:	74 de                	je     195 <strcmp+0x49>
+  return (uchar)*p - (uchar)*q;
+     1b7:	8b 45 08             	mov    0x8(%ebp),%eax
+     1ba:	0f b6 00             	movzbl (%eax),%eax
+     1bd:	0f b6 d0             	movzbl %al,%edx
+     1c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+     1c3:	0f b6 00             	movzbl (%eax),%eax
+     1c6:	0f b6 c0             	movzbl %al,%eax
+     1c9:	29 c2                	sub    %eax,%edx
+     1cb:	89 d0                	mov    %edx,%eax
+}
+     1cd:	5d                   	pop    %ebp
+     1ce:	c3                   	ret
+
+000001cf <strlen>:
+
+uint
+strlen(char *s)
+{
+     1cf:	55                   	push   %ebp
+     1d0:	89 e5                	mov    %esp,%ebp
+     1d2:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; ((uint)(s+n) & 3) && s[n]; n++)
+     1d5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     1dc:	eb 04                	jmp    1e2 <strlen+0x13>
+     1de:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     1e2:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     1e5:	8b 45 08             	mov    0x8(%ebp),%eax
+     1e8:	01 d0                	add    %edx,%eax
+     1ea:	83 e0 03             	and    $0x3,%eax
+     1ed:	85 c0                	test   %eax,%eax
+     1ef:	74 0f                	je     200 <strlen+0x31>
+     1f1:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     1f4:	8b 45 08             	mov    0x8(%ebp),%eax
+     1f7:	01 d0                	add    %edx,%eax
+     1f9:	0f b6 00             	movzbl (%eax),%eax
+     1fc:	84 c0                	test   %al,%al
+     1fe:	75 de                	jne    1de <strlen+0xf>
+    ;
+  if(s[n])
+     200:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     203:	8b 45 08             	mov    0x8(%ebp),%eax
+     206:	01 d0                	add    %edx,%eax
+     208:	0f b6 00             	movzbl (%eax),%eax
+     20b:	84 c0                	test   %al,%al
+     20d:	74 33                	je     242 <strlen+0x73>
+    while(!HASZERO(*(uint*)(s+n)))
+     20f:	eb 04                	jmp    215 <strlen+0x46>
+      n += 4;
+     211:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+    while(!HASZERO(*(uint*)(s+n)))
+     215:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     218:	8b 45 08             	mov    0x8(%ebp),%eax
+     21b:	01 d0                	add    %edx,%eax
+     21d:	8b 00                	mov    (%eax),%eax
+     21f:	8d 88 ff fe fe fe    	lea    -0x1010101(%eax),%ecx
+     225:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     228:	8b 45 08             	mov    0x8(%ebp),%eax
+     22b:	01 d0                	add    %edx,%eax
+     22d:	8b 00                	mov    (%eax),%eax
+     22f:	f7 d0                	not    %eax
+     231:	21 c8                	and    %ecx,%eax
+     233:	25 80 80 80 80       	and    $0x80808080,%eax
+     238:	85 c0                	test   %eax,%eax
+     23a:	74 d5                	je     211 <strlen+0x42>
+  for(; s[n]; n++)
+     23c:	eb 04                	jmp    242 <strlen+0x73>
+     23e:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     242:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     245:	8b 45 08             	mov    0x8(%ebp),%eax
+     248:	01 d0                	add    %edx,%eax
+     24a:	0f b6 00             	movzbl (%eax),%eax
+     24d:	84 c0                	test   %al,%al
+     24f:	75 ed                	jne    23e <strlen+0x6f>
+    ;
+  return n;
+     251:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     254:	c9                   	leave
+     255:	c3                   	ret
+
+00000256 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     256:	55                   	push   %ebp
+     257:	89 e5                	mov    %esp,%ebp
+     259:	83 ec 10             	sub    $0x10,%esp
+  char *d;
+  uint k;
+
+  d = dst;
+     25c:	8b 45 08             	mov    0x8(%ebp),%eax
+     25f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c &= 0xFF;
+     262:	81 65 0c ff 00 00 00 	andl   $0xff,0xc(%ebp)
+  if(n >= 16){
+     269:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     26d:	76 54                	jbe    2c3 <memset+0x6d>
+    k = -(uint)d & 3;  // bytes up to a word boundary
+     26f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     272:	f7 d8                	neg    %eax
+     274:	83 e0 03             	and    $0x3,%eax
+     277:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    stosb(d, c, k);
+     27a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     27d:	50                   	push   %eax
+     27e:	ff 75 0c             	push   0xc(%ebp)
+     281:	ff 75 fc             	push   -0x4(%ebp)
+     284:	e8 e9 fd ff ff       	call   72 <stosb>
+     289:	83 c4 0c             	add    $0xc,%esp
+    d += k;
+     28c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     28f:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n -= k;
+     292:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     295:	29 45 10             	sub    %eax,0x10(%ebp)
+    stosl(d, c*ONES, n/4);
+     298:	8b 45 10             	mov    0x10(%ebp),%eax
+     29b:	c1 e8 02             	shr    $0x2,%eax
+     29e:	89 c2                	mov    %eax,%edx
+     2a0:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2a3:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     2a9:	52                   	push   %edx
+     2aa:	50                   	push   %eax
+     2ab:	ff 75 fc             	push   -0x4(%ebp)
+     2ae:	e8 e5 fd ff ff       	call   98 <stosl>
+     2b3:	83 c4 0c             	add    $0xc,%esp
+    d += n & ~3;
+     2b6:	8b 45 10             	mov    0x10(%ebp),%eax
+     2b9:	83 e0 fc             	and    $0xfffffffc,%eax
+     2bc:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n &= 3;
+     2bf:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+  }
+  stosb(d, c, n);
+     2c3:	8b 45 10             	mov    0x10(%ebp),%eax
+     2c6:	50                   	push   %eax
+     2c7:	ff 75 0c             	push   0xc(%ebp)
+     2ca:	ff 75 fc             	push   -0x4(%ebp)
+     2cd:	e8 a0 fd ff ff       	call   72 <stosb>
+     2d2:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     2d5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     2d8:	c9                   	leave
+     2d9:	c3                   	ret
+
+000002da <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     2da:	55                   	push   %ebp
+     2db:	89 e5                	mov    %esp,%ebp
+     2dd:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s1, *s2;
+
+  s1 = v1;
+     2e0:	8b 45 08             	mov    0x8(%ebp),%eax
+     2e3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s2 = v2;
+     2e6:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2e9:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     2ec:	eb 0c                	jmp    2fa <memcmp+0x20>
+    s1 += 4, s2 += 4, n -= 4;
+     2ee:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+     2f2:	83 45 f8 04          	addl   $0x4,-0x8(%ebp)
+     2f6:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     2fa:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     2fe:	76 3e                	jbe    33e <memcmp+0x64>
+     300:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     303:	8b 10                	mov    (%eax),%edx
+     305:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     308:	8b 00                	mov    (%eax),%eax
+     30a:	39 c2                	cmp    %eax,%edx
+     30c:	74 e0                	je     2ee <memcmp+0x14>
+  while(n-- > 0){
+     30e:	eb 2e                	jmp    33e <memcmp+0x64>
+    if(*s1 != *s2)
+     310:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     313:	0f b6 10             	movzbl (%eax),%edx
+     316:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     319:	0f b6 00             	movzbl (%eax),%eax
+     31c:	38 c2                	cmp    %al,%dl
+     31e:	74 16                	je     336 <memcmp+0x5c>
+      return *s1 - *s2;
+     320:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     323:	0f b6 00             	movzbl (%eax),%eax
+     326:	0f b6 d0             	movzbl %al,%edx
+     329:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     32c:	0f b6 00             	movzbl (%eax),%eax
+     32f:	0f b6 c0             	movzbl %al,%eax
+     332:	29 c2                	sub    %eax,%edx
+     334:	eb 1a                	jmp    350 <memcmp+0x76>
+    s1++, s2++;
+     336:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     33a:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+  while(n-- > 0){
+     33e:	8b 45 10             	mov    0x10(%ebp),%eax
+     341:	8d 50 ff             	lea    -0x1(%eax),%edx
+     344:	89 55 10             	mov    %edx,0x10(%ebp)
+     347:	85 c0                	test   %eax,%eax
+     349:	75 c5                	jne    310 <memcmp+0x36>
+  }
+  return 0;
+     34b:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+     350:	89 d0                	mov    %edx,%eax
+     352:	c9                   	leave
+     353:	c3                   	ret
+
+00000354 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     354:	55                   	push   %ebp
+     355:	89 e5                	mov    %esp,%ebp
+     357:	83 ec 14             	sub    $0x14,%esp
+     35a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     35d:	88 45 ec             	mov    %al,-0x14(%ebp)
+  uint w, cc;
+
+  // Skip whole words holding neither c nor the terminator.
+  for(; ((uint)s & 3) && *s; s++)
+     360:	eb 17                	jmp    379 <strchr+0x25>
+    if(*s == c)
+     362:	8b 45 08             	mov    0x8(%ebp),%eax
+     365:	0f b6 00             	movzbl (%eax),%eax
+     368:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     36b:	75 08                	jne    375 <strchr+0x21>
+      return (char*)s;
+     36d:	8b 45 08             	mov    0x8(%ebp),%eax
+     370:	e9 ad 00 00 00       	jmp    422 <strchr+0xce>
+  for(; ((uint)s & 3) && *s; s++)
+     375:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     379:	8b 45 08             	mov    0x8(%ebp),%eax
+     37c:	83 e0 03             	and    $0x3,%eax
+     37f:	85 c0                	test   %eax,%eax
+     381:	74 0a                	je     38d <strchr+0x39>
+     383:	8b 45 08             	mov    0x8(%ebp),%eax
+     386:	0f b6 00             	movzbl (%eax),%eax
+     389:	84 c0                	test   %al,%al
+     38b:	75 d5                	jne    362 <strchr+0xe>
+  cc = (uchar)c * ONES;
+     38d:	0f b6 45 ec          	movzbl -0x14(%ebp),%eax
+     391:	0f b6 c0             	movzbl %al,%eax
+     394:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     39a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(*s)
+     39d:	8b 45 08             	mov    0x8(%ebp),%eax
+     3a0:	0f b6 00             	movzbl (%eax),%eax
+     3a3:	84 c0                	test   %al,%al
+     3a5:	74 6c                	je     413 <strchr+0xbf>
+    for(; w = *(uint*)s, !HASZERO(w) && !HASZERO(w ^ cc); s += 4)
+     3a7:	eb 04                	jmp    3ad <strchr+0x59>
+     3a9:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     3ad:	8b 45 08             	mov    0x8(%ebp),%eax
+     3b0:	8b 00                	mov    (%eax),%eax
+     3b2:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     3b5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3b8:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     3be:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3c1:	f7 d0                	not    %eax
+     3c3:	21 d0                	and    %edx,%eax
+     3c5:	25 80 80 80 80       	and    $0x80808080,%eax
+     3ca:	85 c0                	test   %eax,%eax
+     3cc:	75 26                	jne    3f4 <strchr+0xa0>
+     3ce:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3d1:	33 45 fc             	xor    -0x4(%ebp),%eax
+     3d4:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     3da:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3dd:	33 45 fc             	xor    -0x4(%ebp),%eax
+     3e0:	f7 d0                	not    %eax
+     3e2:	21 d0                	and    %edx,%eax
+     3e4:	25 80 80 80 80       	and    $0x80808080,%eax
+     3e9:	85 c0                	test   %eax,%eax
+     3eb:	75 07                	jne    3f4 <strchr+0xa0>
+     3ed:	b8 01 00 00 00       	mov    $0x1,%eax
+     3f2:	eb 05                	jmp    3f9 <strchr+0xa5>
+     3f4:	b8 00 00 00 00       	mov    $0x0,%eax
+     3f9:	85 c0                	test   %eax,%eax
+     3fb:	75 ac                	jne    3a9 <strchr+0x55>
+      ;
+  for(; *s; s++)
+     3fd:	eb 14                	jmp    413 <strchr+0xbf>
+    if(*s == c)
+     3ff:	8b 45 08             	mov    0x8(%ebp),%eax
+     402:	0f b6 00             	movzbl (%eax),%eax
+     405:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     408:	75 05                	jne    40f <strchr+0xbb>
+      return (char*)s;
+     40a:	8b 45 08             	mov    0x8(%ebp),%eax
+     40d:	eb 13                	jmp    422 <strchr+0xce>
+  for(; *s; s++)
+     40f:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     413:	8b 45 08             	mov    0x8(%ebp),%eax
+     416:	0f b6 00             	movzbl (%eax),%eax
+     419:	84 c0                	test   %al,%al
+     41b:	75 e2                	jne    3ff <strchr+0xab>
+  return 0;
+     41d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     422:	c9                   	leave
+     423:	c3                   	ret
+
+00000424 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     424:	55                   	push   %ebp
+     425:	89 e5                	mov    %esp,%ebp
+     427:	83 ec 18             	sub    $0x18,%esp
+  int i, c;
+
+  for(i=0; i+1 < max; ){
+     42a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     431:	eb 37                	jmp    46a <gets+0x46>
+    c = fgetc(0);
+     433:	83 ec 0c             	sub    $0xc,%esp
+     436:	6a 00                	push   $0x0
+     438:	e8 2e 0e 00 00       	call   126b <fgetc>
+     43d:	83 c4 10             	add    $0x10,%esp
+     440:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(c < 0)
+     443:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     447:	78 2e                	js     477 <gets+0x53>
+      break;
+    buf[i++] = c;
+     449:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     44c:	8d 50 01             	lea    0x1(%eax),%edx
+     44f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     452:	89 c2                	mov    %eax,%edx
+     454:	8b 45 08             	mov    0x8(%ebp),%eax
+     457:	01 d0                	add    %edx,%eax
+     459:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     45c:	88 10                	mov    %dl,(%eax)
+    if(c == '\n' || c == '\r')
+     45e:	83 7d f0 0a          	cmpl   $0xa,-0x10(%ebp)
+     462:	74 14                	je     478 <gets+0x54>
+     464:	83 7d f0 0d          	cmpl   $0xd,-0x10(%ebp)
+     468:	74 0e                	je     478 <gets+0x54>
+  for(i=0; i+1 < max; ){
+     46a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     46d:	83 c0 01             	add    $0x1,%eax
+     470:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     473:	7f be                	jg     433 <gets+0xf>
+     475:	eb 01                	jmp    478 <gets+0x54>
+      break;
+     477:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     478:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     47b:	8b 45 08             	mov    0x8(%ebp),%eax
+     47e:	01 d0                	add    %edx,%eax
+     480:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     483:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     486:	c9                   	leave
+     487:	c3                   	ret
+
+00000488 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     488:	55                   	push   %ebp
+     489:	89 e5                	mov    %esp,%ebp
+     48b:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     48e:	83 ec 08             	sub    $0x8,%esp
+     491:	6a 00                	push   $0x0
+     493:	ff 75 08             	push   0x8(%ebp)
+     496:	e8 3b 02 00 00       	call   6d6 <open>
+     49b:	83 c4 10             	add    $0x10,%esp
+     49e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     4a1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     4a5:	79 07                	jns    4ae <stat+0x26>
+    return -1;
+     4a7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     4ac:	eb 25                	jmp    4d3 <stat+0x4b>
+  r = fstat(fd, st);
+     4ae:	83 ec 08             	sub    $0x8,%esp
+     4b1:	ff 75 0c             	push   0xc(%ebp)
+     4b4:	ff 75 f4             	push   -0xc(%ebp)
+     4b7:	e8 47 02 00 00       	call   703 <fstat>
+     4bc:	83 c4 10             	add    $0x10,%esp
+     4bf:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     4c2:	83 ec 0c             	sub    $0xc,%esp
+     4c5:	ff 75 f4             	push   -0xc(%ebp)
+     4c8:	e8 c7 0e 00 00       	call   1394 <close>
+     4cd:	83 c4 10             	add    $0x10,%esp
+  return r;
+     4d0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     4d3:	c9                   	leave
+     4d4:	c3                   	ret
+
+000004d5 <atoi>:
+
+int
+atoi(const char *s)
+{
+     4d5:	55                   	push   %ebp
+     4d6:	89 e5                	mov    %esp,%ebp
+     4d8:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     4db:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     4e2:	eb 25                	jmp    509 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     4e4:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     4e7:	89 d0                	mov    %edx,%eax
+     4e9:	c1 e0 02             	shl    $0x2,%eax
+     4ec:	01 d0                	add    %edx,%eax
+     4ee:	01 c0                	add    %eax,%eax
+     4f0:	89 c1                	mov    %eax,%ecx
+     4f2:	8b 45 08             	mov    0x8(%ebp),%eax
+     4f5:	8d 50 01             	lea    0x1(%eax),%edx
+     4f8:	89 55 08             	mov    %edx,0x8(%ebp)
+     4fb:	0f b6 00             	movzbl (%eax),%eax
+     4fe:	0f be c0             	movsbl %al,%eax
+     501:	01 c8                	add    %ecx,%eax
+     503:	83 e8 30             	sub    $0x30,%eax
+     506:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     509:	8b 45 08             	mov    0x8(%ebp),%eax
+     50c:	0f b6 00             	movzbl (%eax),%eax
+     50f:	3c 2f                	cmp    $0x2f,%al
+     511:	7e 0a                	jle    51d <atoi+0x48>
+     513:	8b 45 08             	mov    0x8(%ebp),%eax
+     516:	0f b6 00             	movzbl (%eax),%eax
+     519:	3c 39                	cmp    $0x39,%al
+     51b:	7e c7                	jle    4e4 <atoi+0xf>
+  return n;
+     51d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     520:	c9                   	leave
+     521:	c3                   	ret
+
+00000522 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     522:	55                   	push   %ebp
+     523:	89 e5                	mov    %esp,%ebp
+     525:	83 ec 10             	sub    $0x10,%esp
+  char *d, *s;
+  int k;
+
+  if(n <= 0)
+     528:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     52c:	7f 08                	jg     536 <memmove+0x14>
+    return vdst;
+     52e:	8b 45 08             	mov    0x8(%ebp),%eax
+     531:	e9 17 01 00 00       	jmp    64d <memmove+0x12b>
+  d = vdst;
+     536:	8b 45 08             	mov    0x8(%ebp),%eax
+     539:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s = vsrc;
+     53c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     53f:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  if(s < d && s + n > d){
+     542:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     545:	3b 45 fc             	cmp    -0x4(%ebp),%eax
+     548:	0f 83 84 00 00 00    	jae    5d2 <memmove+0xb0>
+     54e:	8b 55 10             	mov    0x10(%ebp),%edx
+     551:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     554:	01 d0                	add    %edx,%eax
+     556:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     559:	73 77                	jae    5d2 <memmove+0xb0>
+    s += n;
+     55b:	8b 45 10             	mov    0x10(%ebp),%eax
+     55e:	01 45 f8             	add    %eax,-0x8(%ebp)
+    d += n;
+     561:	8b 45 10             	mov    0x10(%ebp),%eax
+     564:	01 45 fc             	add    %eax,-0x4(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     567:	eb 17                	jmp    580 <memmove+0x5e>
+      *--d = *--s, n--;
+     569:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     56d:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     571:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     574:	0f b6 10             	movzbl (%eax),%edx
+     577:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     57a:	88 10                	mov    %dl,(%eax)
+     57c:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     580:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     584:	7e 22                	jle    5a8 <memmove+0x86>
+     586:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     589:	83 e0 03             	and    $0x3,%eax
+     58c:	85 c0                	test   %eax,%eax
+     58e:	75 d9                	jne    569 <memmove+0x47>
+    for(; n >= 4; n -= 4){
+     590:	eb 16                	jmp    5a8 <memmove+0x86>
+      d -= 4;
+     592:	83 6d fc 04          	subl   $0x4,-0x4(%ebp)
+      s -= 4;
+     596:	83 6d f8 04          	subl   $0x4,-0x8(%ebp)
+      *(uint*)d = *(uint*)s;
+     59a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     59d:	8b 10                	mov    (%eax),%edx
+     59f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     5a2:	89 10                	mov    %edx,(%eax)
+    for(; n >= 4; n -= 4){
+     5a4:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+     5a8:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     5ac:	7f e4                	jg     592 <memmove+0x70>
+    }
+    while(n-- > 0)
+     5ae:	eb 13                	jmp    5c3 <memmove+0xa1>
+      *--d = *--s;
+     5b0:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     5b4:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     5b8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     5bb:	0f b6 10             	movzbl (%eax),%edx
+     5be:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     5c1:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+     5c3:	8b 45 10             	mov    0x10(%ebp),%eax
+     5c6:	8d 50 ff             	lea    -0x1(%eax),%edx
+     5c9:	89 55 10             	mov    %edx,0x10(%ebp)
+     5cc:	85 c0                	test   %eax,%eax
+     5ce:	7f e0                	jg     5b0 <memmove+0x8e>
+  if(s < d && s + n > d){
+     5d0:	eb 78                	jmp    64a <memmove+0x128>
+  } else {
+    if(n >= 16){
+     5d2:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     5d6:	7e 61                	jle    639 <memmove+0x117>
+      k = -(uint)d & 3;
+     5d8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     5db:	f7 d8                	neg    %eax
+     5dd:	83 e0 03             	and    $0x3,%eax
+     5e0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      movsb(d, s, k);
+     5e3:	ff 75 f4             	push   -0xc(%ebp)
+     5e6:	ff 75 f8             	push   -0x8(%ebp)
+     5e9:	ff 75 fc             	push   -0x4(%ebp)
+     5ec:	e8 cd fa ff ff       	call   be <movsb>
+     5f1:	83 c4 0c             	add    $0xc,%esp
+      d += k;
+     5f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5f7:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += k;
+     5fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5fd:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n -= k;
+     600:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     603:	29 45 10             	sub    %eax,0x10(%ebp)
+      movsl(d, s, n/4);
+     606:	8b 45 10             	mov    0x10(%ebp),%eax
+     609:	8d 50 03             	lea    0x3(%eax),%edx
+     60c:	85 c0                	test   %eax,%eax
+     60e:	0f 48 c2             	cmovs  %edx,%eax
+     611:	c1 f8 02             	sar    $0x2,%eax
+     614:	50                   	push   %eax
+     615:	ff 75 f8             	push   -0x8(%ebp)
+     618:	ff 75 fc             	push   -0x4(%ebp)
+     61b:	e8 cd fa ff ff       	call   ed <movsl>
+     620:	83 c4 0c             	add    $0xc,%esp
+      d += n & ~3;
+     623:	8b 45 10             	mov    0x10(%ebp),%eax
+     626:	83 e0 fc             	and    $0xfffffffc,%eax
+     629:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += n & ~3;
+     62c:	8b 45 10             	mov    0x10(%ebp),%eax
+     62f:	83 e0 fc             	and    $0xfffffffc,%eax
+     632:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n &= 3;
+     635:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+    }
+    movsb(d, s, n);
+     639:	ff 75 10             	push   0x10(%ebp)
+     63c:	ff 75 f8             	push   -0x8(%ebp)
+     63f:	ff 75 fc             	push   -0x4(%ebp)
+     642:	e8 77 fa ff ff       	call   be <movsb>
+     647:	83 c4 0c             	add    $0xc,%esp
+  }
+  return vdst;
+     64a:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     64d:	c9                   	leave
+     64e:	c3                   	ret
+
+0000064f <_fork>:
+    movl %esp, %ecx; \
+    movl $1f, %edx; \
+    sysenter; \
+  1: ret
+
+RAWSYSCALL(fork)
+     64f:	b8 01 00 00 00       	mov    $0x1,%eax
+     654:	89 e1                	mov    %esp,%ecx
+     656:	ba 5d 06 00 00       	mov    $0x65d,%edx
+     65b:	0f 34                	sysenter
+     65d:	c3                   	ret
+
+0000065e <_exit>:
+RAWSYSCALL(exit)
+     65e:	b8 02 00 00 00       	mov    $0x2,%eax
+     663:	89 e1                	mov    %esp,%ecx
+     665:	ba 6c 06 00 00       	mov    $0x66c,%edx
+     66a:	0f 34                	sysenter
+     66c:	c3                   	ret
+
+0000066d <wait>:
+SYSCALL(wait)
+     66d:	b8 03 00 00 00       	mov    $0x3,%eax
+     672:	89 e1                	mov    %esp,%ecx
+     674:	ba 7b 06 00 00       	mov    $0x67b,%edx
+     679:	0f 34                	sysenter
+     67b:	c3                   	ret
+
+0000067c <pipe>:
+SYSCALL(pipe)
+     67c:	b8 04 00 00 00       	mov    $0x4,%eax
+     681:	89 e1                	mov    %esp,%ecx
+     683:	ba 8a 06 00 00       	mov    $0x68a,%edx
+     688:	0f 34                	sysenter
+     68a:	c3                   	ret
+
+0000068b <read>:
+SYSCALL(read)
+     68b:	b8 05 00 00 00       	mov    $0x5,%eax
+     690:	89 e1                	mov    %esp,%ecx
+     692:	ba 99 06 00 00       	mov    $0x699,%edx
+     697:	0f 34                	sysenter
+     699:	c3                   	ret
+
+0000069a <write>:
+SYSCALL(write)
+     69a:	b8 10 00 00 00       	mov    $0x10,%eax
+     69f:	89 e1                	mov    %esp,%ecx
+     6a1:	ba a8 06 00 00       	mov    $0x6a8,%edx
+     6a6:	0f 34                	sysenter
+     6a8:	c3                   	ret
+
+000006a9 <_close>:
+RAWSYSCALL(close)
+     6a9:	b8 15 00 00 00       	mov    $0x15,%eax
+     6ae:	89 e1                	mov    %esp,%ecx
+     6b0:	ba b7 06 00 00       	mov    $0x6b7,%edx
+     6b5:	0f 34                	sysenter
+     6b7:	c3                   	ret
+
+000006b8 <kill>:
+SYSCALL(kill)
+     6b8:	b8 06 00 00 00       	mov    $0x6,%eax
+     6bd:	89 e1                	mov    %esp,%ecx
+     6bf:	ba c6 06 00 00       	mov    $0x6c6,%edx
+     6c4:	0f 34                	sysenter
+     6c6:	c3                   	ret
+
+000006c7 <_exec>:
+RAWSYSCALL(exec)
+     6c7:	b8 07 00 00 00       	mov    $0x7,%eax
+     6cc:	89 e1                	mov    %esp,%ecx
+     6ce:	ba d5 06 00 00       	mov    $0x6d5,%edx
+     6d3:	0f 34                	sysenter
+     6d5:	c3                   	ret
+
+000006d6 <open>:
+SYSCALL(open)
+     6d6:	b8 0f 00 00 00       	mov    $0xf,%eax
+     6db:	89 e1                	mov    %esp,%ecx
+     6dd:	ba e4 06 00 00       	mov    $0x6e4,%edx
+     6e2:	0f 34                	sysenter
+     6e4:	c3                   	ret
+
+000006e5 <mknod>:
+SYSCALL(mknod)
+     6e5:	b8 11 00 00 00       	mov    $0x11,%eax
+     6ea:	89 e1                	mov    %esp,%ecx
+     6ec:	ba f3 06 00 00       	mov    $0x6f3,%edx
+     6f1:	0f 34                	sysenter
+     6f3:	c3                   	ret
+
+000006f4 <unlink>:
+SYSCALL(unlink)
+     6f4:	b8 12 00 00 00       	mov    $0x12,%eax
+     6f9:	89 e1                	mov    %esp,%ecx
+     6fb:	ba 02 07 00 00       	mov    $0x702,%edx
+     700:	0f 34                	sysenter
+     702:	c3                   	ret
+
+00000703 <fstat>:
+SYSCALL(fstat)
+     703:	b8 08 00 00 00       	mov    $0x8,%eax
+     708:	89 e1                	mov    %esp,%ecx
+     70a:	ba 11 07 00 00       	mov    $0x711,%edx
+     70f:	0f 34                	sysenter
+     711:	c3                   	ret
+
+00000712 <link>:
+SYSCALL(link)
+     712:	b8 13 00 00 00       	mov    $0x13,%eax
+     717:	89 e1                	mov    %esp,%ecx
+     719:	ba 20 07 00 00       	mov    $0x720,%edx
+     71e:	0f 34                	sysenter
+     720:	c3                   	ret
+
+00000721 <mkdir>:
+SYSCALL(mkdir)
+     721:	b8 14 00 00 00       	mov    $0x14,%eax
+     726:	89 e1                	mov    %esp,%ecx
+     728:	ba 2f 07 00 00       	mov    $0x72f,%edx
+     72d:	0f 34                	sysenter
+     72f:	c3                   	ret
+
+00000730 <chdir>:
+SYSCALL(chdir)
+     730:	b8 09 00 00 00       	mov    $0x9,%eax
+     735:	89 e1                	mov    %esp,%ecx
+     737:	ba 3e 07 00 00       	mov    $0x73e,%edx
+     73c:	0f 34                	sysenter
+     73e:	c3                   	ret
+
+0000073f <dup>:
+SYSCALL(dup)
+     73f:	b8 0a 00 00 00       	mov    $0xa,%eax
+     744:	89 e1                	mov    %esp,%ecx
+     746:	ba 4d 07 00 00       	mov    $0x74d,%edx
+     74b:	0f 34                	sysenter
+     74d:	c3                   	ret
+
+0000074e <getpid>:
+SYSCALL(getpid)
+     74e:	b8 0b 00 00 00       	mov    $0xb,%eax
+     753:	89 e1                	mov    %esp,%ecx
+     755:	ba 5c 07 00 00       	mov    $0x75c,%edx
+     75a:	0f 34                	sysenter
+     75c:	c3                   	ret
+
+0000075d <sbrk>:
+SYSCALL(sbrk)
+     75d:	b8 0c 00 00 00       	mov    $0xc,%eax
+     762:	89 e1                	mov    %esp,%ecx
+     764:	ba 6b 07 00 00       	mov    $0x76b,%edx
+     769:	0f 34                	sysenter
+     76b:	c3                   	ret
+
+0000076c <sleep>:
+SYSCALL(sleep)
+     76c:	b8 0d 00 00 00       	mov    $0xd,%eax
+     771:	89 e1                	mov    %esp,%ecx
+     773:	ba 7a 07 00 00       	mov    $0x77a,%edx
+     778:	0f 34                	sysenter
+     77a:	c3                   	ret
+
+0000077b <uptime>:
+SYSCALL(uptime)
+     77b:	b8 0e 00 00 00       	mov    $0xe,%eax
+     780:	89 e1                	mov    %esp,%ecx
+     782:	ba 89 07 00 00       	mov    $0x789,%edx
+     787:	0f 34                	sysenter
+     789:	c3                   	ret
+
+0000078a <getproc>:
+SYSCALL(getproc)
+     78a:	b8 16 00 00 00       	mov    $0x16,%eax
+     78f:	89 e1                	mov    %esp,%ecx
+     791:	ba 98 07 00 00       	mov    $0x798,%edx
+     796:	0f 34                	sysenter
+     798:	c3                   	ret
+
+00000799 <getpgs>:
+SYSCALL(getpgs)
+     799:	b8 17 00 00 00       	mov    $0x17,%eax
+     79e:	89 e1                	mov    %esp,%ecx
+     7a0:	ba a7 07 00 00       	mov    $0x7a7,%edx
+     7a5:	0f 34                	sysenter
+     7a7:	c3                   	ret
+
+000007a8 <loadproc>:
+SYSCALL(loadproc)
+     7a8:	b8 18 00 00 00       	mov    $0x18,%eax
+     7ad:	89 e1                	mov    %esp,%ecx
+     7af:	ba b6 07 00 00       	mov    $0x7b6,%edx
+     7b4:	0f 34                	sysenter
+     7b6:	c3                   	ret
+
+000007b7 <iosubmit>:
+SYSCALL(iosubmit)
+     7b7:	b8 19 00 00 00       	mov    $0x19,%eax
+     7bc:	89 e1                	mov    %esp,%ecx
+     7be:	ba c5 07 00 00       	mov    $0x7c5,%edx
+     7c3:	0f 34                	sysenter
+     7c5:	c3                   	ret
+
+000007c6 <sysstat>:
+SYSCALL(sysstat)
+     7c6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     7cb:	89 e1                	mov    %esp,%ecx
+     7cd:	ba d4 07 00 00       	mov    $0x7d4,%edx
+     7d2:	0f 34                	sysenter
+     7d4:	c3                   	ret
+
+000007d5 <splice>:
+SYSCALL(splice)
+     7d5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     7da:	89 e1                	mov    %esp,%ecx
+     7dc:	ba e3 07 00 00       	mov    $0x7e3,%edx
+     7e1:	0f 34                	sysenter
+     7e3:	c3                   	ret
+
+000007e4 <fsync>:
+SYSCALL(fsync)
+     7e4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     7e9:	89 e1                	mov    %esp,%ecx
+     7eb:	ba f2 07 00 00       	mov    $0x7f2,%edx
+     7f0:	0f 34                	sysenter
+     7f2:	c3                   	ret
+
+000007f3 <fdatasync>:
+SYSCALL(fdatasync)
+     7f3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     7f8:	89 e1                	mov    %esp,%ecx
+     7fa:	ba 01 08 00 00       	mov    $0x801,%edx
+     7ff:	0f 34                	sysenter
+     801:	c3                   	ret
+
+00000802 <lseek>:
+SYSCALL(lseek)
+     802:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     807:	89 e1                	mov    %esp,%ecx
+     809:	ba 10 08 00 00       	mov    $0x810,%edx
+     80e:	0f 34                	sysenter
+     810:	c3                   	ret
+
+00000811 <dmesg>:
+SYSCALL(dmesg)
+     811:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     816:	89 e1                	mov    %esp,%ecx
+     818:	ba 1f 08 00 00       	mov    $0x81f,%edx
+     81d:	0f 34                	sysenter
+     81f:	c3                   	ret
+
+00000820 <lockstat>:
+SYSCALL(lockstat)
+     820:	b8 20 00 00 00       	mov    $0x20,%eax
+     825:	89 e1                	mov    %esp,%ecx
+     827:	ba 2e 08 00 00       	mov    $0x82e,%edx
+     82c:	0f 34                	sysenter
+     82e:	c3                   	ret
+
+0000082f <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     82f:	55                   	push   %ebp
+     830:	89 e5                	mov    %esp,%ebp
+     832:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     835:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     83c:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     840:	74 17                	je     859 <printint+0x2a>
+     842:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     846:	79 11                	jns    859 <printint+0x2a>
+    neg = 1;
+     848:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     84f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     852:	f7 d8                	neg    %eax
+     854:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     857:	eb 06                	jmp    85f <printint+0x30>
+  } else {
+    x = xx;
+     859:	8b 45 0c             	mov    0xc(%ebp),%eax
+     85c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     85f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     866:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     869:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     86c:	ba 00 00 00 00       	mov    $0x0,%edx
+     871:	f7 f1                	div    %ecx
+     873:	89 d1                	mov    %edx,%ecx
+     875:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     878:	8d 50 01             	lea    0x1(%eax),%edx
+     87b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     87e:	0f b6 91 b4 18 00 00 	movzbl 0x18b4(%ecx),%edx
+     885:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     889:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     88c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     88f:	ba 00 00 00 00       	mov    $0x0,%edx
+     894:	f7 f1                	div    %ecx
+     896:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     899:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     89d:	75 c7                	jne    866 <printint+0x37>
+  if(neg)
+     89f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     8a3:	74 2d                	je     8d2 <printint+0xa3>
+    buf[i++] = '-';
+     8a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8a8:	8d 50 01             	lea    0x1(%eax),%edx
+     8ab:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     8ae:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+     8b3:	eb 1d                	jmp    8d2 <printint+0xa3>
+    fputc(fd, buf[i]);
+     8b5:	8d 55 dc             	lea    -0x24(%ebp),%edx
+     8b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8bb:	01 d0                	add    %edx,%eax
+     8bd:	0f b6 00             	movzbl (%eax),%eax
+     8c0:	0f be c0             	movsbl %al,%eax
+     8c3:	83 ec 08             	sub    $0x8,%esp
+     8c6:	50                   	push   %eax
+     8c7:	ff 75 08             	push   0x8(%ebp)
+     8ca:	e8 f8 08 00 00       	call   11c7 <fputc>
+     8cf:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+     8d2:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     8d6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     8da:	79 d9                	jns    8b5 <printint+0x86>
+}
+     8dc:	90                   	nop
+     8dd:	90                   	nop
+     8de:	c9                   	leave
+     8df:	c3                   	ret
+
+000008e0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     8e0:	55                   	push   %ebp
+     8e1:	89 e5                	mov    %esp,%ebp
+     8e3:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+     8e6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     8ed:	8d 45 0c             	lea    0xc(%ebp),%eax
+     8f0:	83 c0 04             	add    $0x4,%eax
+     8f3:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+     8f6:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     8fd:	e9 4a 01 00 00       	jmp    a4c <printf+0x16c>
+    c = fmt[i] & 0xff;
+     902:	8b 55 0c             	mov    0xc(%ebp),%edx
+     905:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     908:	01 d0                	add    %edx,%eax
+     90a:	0f b6 00             	movzbl (%eax),%eax
+     90d:	0f be c0             	movsbl %al,%eax
+     910:	25 ff 00 00 00       	and    $0xff,%eax
+     915:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+     918:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     91c:	75 28                	jne    946 <printf+0x66>
+      if(c == '%'){
+     91e:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     922:	75 0c                	jne    930 <printf+0x50>
+        state = '%';
+     924:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+     92b:	e9 18 01 00 00       	jmp    a48 <printf+0x168>
+      } else {
+        fputc(fd, c);
+     930:	83 ec 08             	sub    $0x8,%esp
+     933:	ff 75 e4             	push   -0x1c(%ebp)
+     936:	ff 75 08             	push   0x8(%ebp)
+     939:	e8 89 08 00 00       	call   11c7 <fputc>
+     93e:	83 c4 10             	add    $0x10,%esp
+     941:	e9 02 01 00 00       	jmp    a48 <printf+0x168>
+      }
+    } else if(state == '%'){
+     946:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+     94a:	0f 85 f8 00 00 00    	jne    a48 <printf+0x168>
+      if(c == 'd'){
+     950:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+     954:	75 1e                	jne    974 <printf+0x94>
+        printint(fd, *ap, 10, 1);
+     956:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     959:	8b 00                	mov    (%eax),%eax
+     95b:	6a 01                	push   $0x1
+     95d:	6a 0a                	push   $0xa
+     95f:	50                   	push   %eax
+     960:	ff 75 08             	push   0x8(%ebp)
+     963:	e8 c7 fe ff ff       	call   82f <printint>
+     968:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     96b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     96f:	e9 cd 00 00 00       	jmp    a41 <printf+0x161>
+      } else if(c == 'x' || c == 'p'){
+     974:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+     978:	74 06                	je     980 <printf+0xa0>
+     97a:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+     97e:	75 1e                	jne    99e <printf+0xbe>
+        printint(fd, *ap, 16, 0);
+     980:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     983:	8b 00                	mov    (%eax),%eax
+     985:	6a 00                	push   $0x0
+     987:	6a 10                	push   $0x10
+     989:	50                   	push   %eax
+     98a:	ff 75 08             	push   0x8(%ebp)
+     98d:	e8 9d fe ff ff       	call   82f <printint>
+     992:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     995:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     999:	e9 a3 00 00 00       	jmp    a41 <printf+0x161>
+      } else if(c == 's'){
+     99e:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+     9a2:	75 43                	jne    9e7 <printf+0x107>
+        s = (char*)*ap;
+     9a4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     9a7:	8b 00                	mov    (%eax),%eax
+     9a9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     9ac:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+     9b0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     9b4:	75 25                	jne    9db <printf+0xfb>
+          s = "(null)";
+     9b6:	c7 45 f4 08 14 00 00 	movl   $0x1408,-0xc(%ebp)
+        while(*s != 0){
+     9bd:	eb 1c                	jmp    9db <printf+0xfb>
+          fputc(fd, *s);
+     9bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9c2:	0f b6 00             	movzbl (%eax),%eax
+     9c5:	0f be c0             	movsbl %al,%eax
+     9c8:	83 ec 08             	sub    $0x8,%esp
+     9cb:	50                   	push   %eax
+     9cc:	ff 75 08             	push   0x8(%ebp)
+     9cf:	e8 f3 07 00 00       	call   11c7 <fputc>
+     9d4:	83 c4 10             	add    $0x10,%esp
+          s++;
+     9d7:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+     9db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9de:	0f b6 00             	movzbl (%eax),%eax
+     9e1:	84 c0                	test   %al,%al
+     9e3:	75 da                	jne    9bf <printf+0xdf>
+     9e5:	eb 5a                	jmp    a41 <printf+0x161>
+        }
+      } else if(c == 'c'){
+     9e7:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+     9eb:	75 1a                	jne    a07 <printf+0x127>
+        fputc(fd, *ap);
+     9ed:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     9f0:	8b 00                	mov    (%eax),%eax
+     9f2:	83 ec 08             	sub    $0x8,%esp
+     9f5:	50                   	push   %eax
+     9f6:	ff 75 08             	push   0x8(%ebp)
+     9f9:	e8 c9 07 00 00       	call   11c7 <fputc>
+     9fe:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     a01:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     a05:	eb 3a                	jmp    a41 <printf+0x161>
+      } else if(c == '%'){
+     a07:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     a0b:	75 13                	jne    a20 <printf+0x140>
+        fputc(fd, c);
+     a0d:	83 ec 08             	sub    $0x8,%esp
+     a10:	ff 75 e4             	push   -0x1c(%ebp)
+     a13:	ff 75 08             	push   0x8(%ebp)
+     a16:	e8 ac 07 00 00       	call   11c7 <fputc>
+     a1b:	83 c4 10             	add    $0x10,%esp
+     a1e:	eb 21                	jmp    a41 <printf+0x161>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        fputc(fd, '%');
+     a20:	83 ec 08             	sub    $0x8,%esp
+     a23:	6a 25                	push   $0x25
+     a25:	ff 75 08             	push   0x8(%ebp)
+     a28:	e8 9a 07 00 00       	call   11c7 <fputc>
+     a2d:	83 c4 10             	add    $0x10,%esp
+        fputc(fd, c);
+     a30:	83 ec 08             	sub    $0x8,%esp
+     a33:	ff 75 e4             	push   -0x1c(%ebp)
+     a36:	ff 75 08             	push   0x8(%ebp)
+     a39:	e8 89 07 00 00       	call   11c7 <fputc>
+     a3e:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     a41:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     a48:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     a4c:	8b 55 0c             	mov    0xc(%ebp),%edx
+     a4f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a52:	01 d0                	add    %edx,%eax
+     a54:	0f b6 00             	movzbl (%eax),%eax
+     a57:	84 c0                	test   %al,%al
+     a59:	0f 85 a3 fe ff ff    	jne    902 <printf+0x22>
+    }
+  }
+}
+     a5f:	90                   	nop
+     a60:	90                   	nop
+     a61:	c9                   	leave
+     a62:	c3                   	ret
+
+00000a63 <binof>:
+static struct chunk *bins[NBIN];       // free large chunks
+static struct chunk *top;              // end marker of newest heap segment
+
+static int
+binof(uint size)
+{
+     a63:	55                   	push   %ebp
+     a64:	89 e5                	mov    %esp,%ebp
+     a66:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  i = 0;
+     a69:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     a70:	c1 6d 08 05          	shrl   $0x5,0x8(%ebp)
+     a74:	eb 07                	jmp    a7d <binof+0x1a>
+    i++;
+     a76:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     a7a:	d1 6d 08             	shrl   0x8(%ebp)
+     a7d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     a81:	74 06                	je     a89 <binof+0x26>
+     a83:	83 7d fc 19          	cmpl   $0x19,-0x4(%ebp)
+     a87:	7e ed                	jle    a76 <binof+0x13>
+  return i;
+     a89:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     a8c:	c9                   	leave
+     a8d:	c3                   	ret
+
+00000a8e <bininsert>:
+
+static void
+bininsert(struct chunk *c)
+{
+     a8e:	55                   	push   %ebp
+     a8f:	89 e5                	mov    %esp,%ebp
+     a91:	83 ec 10             	sub    $0x10,%esp
+  struct chunk **b;
+
+  b = &bins[binof(CSIZE(c))];
+     a94:	8b 45 08             	mov    0x8(%ebp),%eax
+     a97:	8b 00                	mov    (%eax),%eax
+     a99:	83 e0 f8             	and    $0xfffffff8,%eax
+     a9c:	50                   	push   %eax
+     a9d:	e8 c1 ff ff ff       	call   a63 <binof>
+     aa2:	83 c4 04             	add    $0x4,%esp
+     aa5:	c1 e0 02             	shl    $0x2,%eax
+     aa8:	05 00 19 00 00       	add    $0x1900,%eax
+     aad:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c->prev = 0;
+     ab0:	8b 45 08             	mov    0x8(%ebp),%eax
+     ab3:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  c->next = *b;
+     aba:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     abd:	8b 10                	mov    (%eax),%edx
+     abf:	8b 45 08             	mov    0x8(%ebp),%eax
+     ac2:	89 50 08             	mov    %edx,0x8(%eax)
+  if(*b)
+     ac5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ac8:	8b 00                	mov    (%eax),%eax
+     aca:	85 c0                	test   %eax,%eax
+     acc:	74 0b                	je     ad9 <bininsert+0x4b>
+    (*b)->prev = c;
+     ace:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ad1:	8b 00                	mov    (%eax),%eax
+     ad3:	8b 55 08             	mov    0x8(%ebp),%edx
+     ad6:	89 50 0c             	mov    %edx,0xc(%eax)
+  *b = c;
+     ad9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     adc:	8b 55 08             	mov    0x8(%ebp),%edx
+     adf:	89 10                	mov    %edx,(%eax)
+}
+     ae1:	90                   	nop
+     ae2:	c9                   	leave
+     ae3:	c3                   	ret
+
+00000ae4 <binremove>:
+
+static void
+binremove(struct chunk *c)
+{
+     ae4:	55                   	push   %ebp
+     ae5:	89 e5                	mov    %esp,%ebp
+  if(c->prev)
+     ae7:	8b 45 08             	mov    0x8(%ebp),%eax
+     aea:	8b 40 0c             	mov    0xc(%eax),%eax
+     aed:	85 c0                	test   %eax,%eax
+     aef:	74 11                	je     b02 <binremove+0x1e>
+    c->prev->next = c->next;
+     af1:	8b 45 08             	mov    0x8(%ebp),%eax
+     af4:	8b 40 0c             	mov    0xc(%eax),%eax
+     af7:	8b 55 08             	mov    0x8(%ebp),%edx
+     afa:	8b 52 08             	mov    0x8(%edx),%edx
+     afd:	89 50 08             	mov    %edx,0x8(%eax)
+     b00:	eb 1e                	jmp    b20 <binremove+0x3c>
+  else
+    bins[binof(CSIZE(c))] = c->next;
+     b02:	8b 45 08             	mov    0x8(%ebp),%eax
+     b05:	8b 00                	mov    (%eax),%eax
+     b07:	83 e0 f8             	and    $0xfffffff8,%eax
+     b0a:	50                   	push   %eax
+     b0b:	e8 53 ff ff ff       	call   a63 <binof>
+     b10:	83 c4 04             	add    $0x4,%esp
+     b13:	8b 55 08             	mov    0x8(%ebp),%edx
+     b16:	8b 52 08             	mov    0x8(%edx),%edx
+     b19:	89 14 85 00 19 00 00 	mov    %edx,0x1900(,%eax,4)
+  if(c->next)
+     b20:	8b 45 08             	mov    0x8(%ebp),%eax
+     b23:	8b 40 08             	mov    0x8(%eax),%eax
+     b26:	85 c0                	test   %eax,%eax
+     b28:	74 0f                	je     b39 <binremove+0x55>
+    c->next->prev = c->prev;
+     b2a:	8b 45 08             	mov    0x8(%ebp),%eax
+     b2d:	8b 40 08             	mov    0x8(%eax),%eax
+     b30:	8b 55 08             	mov    0x8(%ebp),%edx
+     b33:	8b 52 0c             	mov    0xc(%edx),%edx
+     b36:	89 50 0c             	mov    %edx,0xc(%eax)
+}
+     b39:	90                   	nop
+     b3a:	c9                   	leave
+     b3b:	c3                   	ret
+
+00000b3c <freechunk>:
+
+// Free chunk c, merging it with free neighbors.  If trim is
+// set and the result is big and at the break, give it back.
+static void
+freechunk(struct chunk *c, int trim)
+{
+     b3c:	55                   	push   %ebp
+     b3d:	89 e5                	mov    %esp,%ebp
+     b3f:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *p, *n;
+  uint size;
+
+  size = CSIZE(c);
+     b42:	8b 45 08             	mov    0x8(%ebp),%eax
+     b45:	8b 00                	mov    (%eax),%eax
+     b47:	83 e0 f8             	and    $0xfffffff8,%eax
+     b4a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  n = NEXTC(c);
+     b4d:	8b 45 08             	mov    0x8(%ebp),%eax
+     b50:	8b 00                	mov    (%eax),%eax
+     b52:	83 e0 f8             	and    $0xfffffff8,%eax
+     b55:	89 c2                	mov    %eax,%edx
+     b57:	8b 45 08             	mov    0x8(%ebp),%eax
+     b5a:	01 d0                	add    %edx,%eax
+     b5c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(!(c->size & PREVUSED)){
+     b5f:	8b 45 08             	mov    0x8(%ebp),%eax
+     b62:	8b 00                	mov    (%eax),%eax
+     b64:	83 e0 02             	and    $0x2,%eax
+     b67:	85 c0                	test   %eax,%eax
+     b69:	75 30                	jne    b9b <freechunk+0x5f>
+    p = (struct chunk*)((char*)c - *((uint*)c - 1));
+     b6b:	8b 45 08             	mov    0x8(%ebp),%eax
+     b6e:	83 e8 04             	sub    $0x4,%eax
+     b71:	8b 00                	mov    (%eax),%eax
+     b73:	f7 d8                	neg    %eax
+     b75:	89 c2                	mov    %eax,%edx
+     b77:	8b 45 08             	mov    0x8(%ebp),%eax
+     b7a:	01 d0                	add    %edx,%eax
+     b7c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    binremove(p);
+     b7f:	ff 75 ec             	push   -0x14(%ebp)
+     b82:	e8 5d ff ff ff       	call   ae4 <binremove>
+     b87:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(p);
+     b8a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b8d:	8b 00                	mov    (%eax),%eax
+     b8f:	83 e0 f8             	and    $0xfffffff8,%eax
+     b92:	01 45 f4             	add    %eax,-0xc(%ebp)
+    c = p;
+     b95:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b98:	89 45 08             	mov    %eax,0x8(%ebp)
+  }
+  if(!(n->size & USED)){
+     b9b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b9e:	8b 00                	mov    (%eax),%eax
+     ba0:	83 e0 01             	and    $0x1,%eax
+     ba3:	85 c0                	test   %eax,%eax
+     ba5:	75 16                	jne    bbd <freechunk+0x81>
+    binremove(n);
+     ba7:	ff 75 f0             	push   -0x10(%ebp)
+     baa:	e8 35 ff ff ff       	call   ae4 <binremove>
+     baf:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(n);
+     bb2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bb5:	8b 00                	mov    (%eax),%eax
+     bb7:	83 e0 f8             	and    $0xfffffff8,%eax
+     bba:	01 45 f4             	add    %eax,-0xc(%ebp)
+  }
+  // Free chunks are never adjacent, so the one below is in use.
+  c->size = size | PREVUSED;
+     bbd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     bc0:	83 c8 02             	or     $0x2,%eax
+     bc3:	89 c2                	mov    %eax,%edx
+     bc5:	8b 45 08             	mov    0x8(%ebp),%eax
+     bc8:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+     bca:	8b 45 08             	mov    0x8(%ebp),%eax
+     bcd:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  FOOTER(c) = size;
+     bd4:	8b 45 08             	mov    0x8(%ebp),%eax
+     bd7:	8b 00                	mov    (%eax),%eax
+     bd9:	83 e0 f8             	and    $0xfffffff8,%eax
+     bdc:	8d 50 fc             	lea    -0x4(%eax),%edx
+     bdf:	8b 45 08             	mov    0x8(%ebp),%eax
+     be2:	01 c2                	add    %eax,%edx
+     be4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     be7:	89 02                	mov    %eax,(%edx)
+  n = NEXTC(c);
+     be9:	8b 45 08             	mov    0x8(%ebp),%eax
+     bec:	8b 00                	mov    (%eax),%eax
+     bee:	83 e0 f8             	and    $0xfffffff8,%eax
+     bf1:	89 c2                	mov    %eax,%edx
+     bf3:	8b 45 08             	mov    0x8(%ebp),%eax
+     bf6:	01 d0                	add    %edx,%eax
+     bf8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  n->size &= ~PREVUSED;
+     bfb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bfe:	8b 00                	mov    (%eax),%eax
+     c00:	83 e0 fd             	and    $0xfffffffd,%eax
+     c03:	89 c2                	mov    %eax,%edx
+     c05:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c08:	89 10                	mov    %edx,(%eax)
+
+  if(trim && n == top && size >= TRIMSIZE && sbrk(0) == (char*)top + HDRSIZE){
+     c0a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     c0e:	74 51                	je     c61 <freechunk+0x125>
+     c10:	a1 6c 19 00 00       	mov    0x196c,%eax
+     c15:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     c18:	75 47                	jne    c61 <freechunk+0x125>
+     c1a:	81 7d f4 ff 7f 00 00 	cmpl   $0x7fff,-0xc(%ebp)
+     c21:	76 3e                	jbe    c61 <freechunk+0x125>
+     c23:	83 ec 0c             	sub    $0xc,%esp
+     c26:	6a 00                	push   $0x0
+     c28:	e8 30 fb ff ff       	call   75d <sbrk>
+     c2d:	83 c4 10             	add    $0x10,%esp
+     c30:	8b 15 6c 19 00 00    	mov    0x196c,%edx
+     c36:	83 c2 08             	add    $0x8,%edx
+     c39:	39 d0                	cmp    %edx,%eax
+     c3b:	75 24                	jne    c61 <freechunk+0x125>
+    c->size = USED | PREVUSED;
+     c3d:	8b 45 08             	mov    0x8(%ebp),%eax
+     c40:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+    top = c;
+     c46:	8b 45 08             	mov    0x8(%ebp),%eax
+     c49:	a3 6c 19 00 00       	mov    %eax,0x196c
+    sbrk(-size);
+     c4e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c51:	f7 d8                	neg    %eax
+     c53:	83 ec 0c             	sub    $0xc,%esp
+     c56:	50                   	push   %eax
+     c57:	e8 01 fb ff ff       	call   75d <sbrk>
+     c5c:	83 c4 10             	add    $0x10,%esp
+    return;
+     c5f:	eb 0e                	jmp    c6f <freechunk+0x133>
+  }
+  bininsert(c);
+     c61:	83 ec 0c             	sub    $0xc,%esp
+     c64:	ff 75 08             	push   0x8(%ebp)
+     c67:	e8 22 fe ff ff       	call   a8e <bininsert>
+     c6c:	83 c4 10             	add    $0x10,%esp
+}
+     c6f:	c9                   	leave
+     c70:	c3                   	ret
+
+00000c71 <morecore>:
+
+// Grow the heap by at least need bytes.
+static int
+morecore(uint need)
+{
+     c71:	55                   	push   %ebp
+     c72:	89 e5                	mov    %esp,%ebp
+     c74:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+  char *p;
+  uint n, pad;
+
+  n = need + MINCHUNK;
+     c77:	8b 45 08             	mov    0x8(%ebp),%eax
+     c7a:	83 c0 18             	add    $0x18,%eax
+     c7d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(n < MINCORE)
+     c80:	81 7d ec ff 3f 00 00 	cmpl   $0x3fff,-0x14(%ebp)
+     c87:	77 07                	ja     c90 <morecore+0x1f>
+    n = MINCORE;
+     c89:	c7 45 ec 00 40 00 00 	movl   $0x4000,-0x14(%ebp)
+  // Keep the break 8-aligned, with the end marker just below it.
+  pad = (8 - ((uint)sbrk(0) & 7)) & 7;
+     c90:	83 ec 0c             	sub    $0xc,%esp
+     c93:	6a 00                	push   $0x0
+     c95:	e8 c3 fa ff ff       	call   75d <sbrk>
+     c9a:	83 c4 10             	add    $0x10,%esp
+     c9d:	83 e0 07             	and    $0x7,%eax
+     ca0:	ba 08 00 00 00       	mov    $0x8,%edx
+     ca5:	29 c2                	sub    %eax,%edx
+     ca7:	89 d0                	mov    %edx,%eax
+     ca9:	83 e0 07             	and    $0x7,%eax
+     cac:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if((p = sbrk(pad + n)) == (char*)-1){
+     caf:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     cb2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     cb5:	01 d0                	add    %edx,%eax
+     cb7:	83 ec 0c             	sub    $0xc,%esp
+     cba:	50                   	push   %eax
+     cbb:	e8 9d fa ff ff       	call   75d <sbrk>
+     cc0:	83 c4 10             	add    $0x10,%esp
+     cc3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     cc6:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     cca:	75 30                	jne    cfc <morecore+0x8b>
+    n = need + MINCHUNK;
+     ccc:	8b 45 08             	mov    0x8(%ebp),%eax
+     ccf:	83 c0 18             	add    $0x18,%eax
+     cd2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((p = sbrk(pad + n)) == (char*)-1)
+     cd5:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     cd8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     cdb:	01 d0                	add    %edx,%eax
+     cdd:	83 ec 0c             	sub    $0xc,%esp
+     ce0:	50                   	push   %eax
+     ce1:	e8 77 fa ff ff       	call   75d <sbrk>
+     ce6:	83 c4 10             	add    $0x10,%esp
+     ce9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     cec:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     cf0:	75 0a                	jne    cfc <morecore+0x8b>
+      return -1;
+     cf2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     cf7:	e9 8e 00 00 00       	jmp    d8a <morecore+0x119>
+  }
+  p += pad;
+     cfc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     cff:	01 45 f0             	add    %eax,-0x10(%ebp)
+  if(top && p == (char*)top + HDRSIZE){
+     d02:	a1 6c 19 00 00       	mov    0x196c,%eax
+     d07:	85 c0                	test   %eax,%eax
+     d09:	74 29                	je     d34 <morecore+0xc3>
+     d0b:	a1 6c 19 00 00       	mov    0x196c,%eax
+     d10:	83 c0 08             	add    $0x8,%eax
+     d13:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     d16:	75 1c                	jne    d34 <morecore+0xc3>
+    // Contiguous: the old end marker heads the new chunk.
+    c = top;
+     d18:	a1 6c 19 00 00       	mov    0x196c,%eax
+     d1d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = n | (c->size & PREVUSED);
+     d20:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d23:	8b 00                	mov    (%eax),%eax
+     d25:	83 e0 02             	and    $0x2,%eax
+     d28:	0b 45 ec             	or     -0x14(%ebp),%eax
+     d2b:	89 c2                	mov    %eax,%edx
+     d2d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d30:	89 10                	mov    %edx,(%eax)
+     d32:	eb 16                	jmp    d4a <morecore+0xd9>
+  } else {
+    // Someone else moved the break: start a new segment.
+    c = (struct chunk*)p;
+     d34:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d37:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = (n - HDRSIZE) | PREVUSED;
+     d3a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     d3d:	83 e8 08             	sub    $0x8,%eax
+     d40:	83 c8 02             	or     $0x2,%eax
+     d43:	89 c2                	mov    %eax,%edx
+     d45:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d48:	89 10                	mov    %edx,(%eax)
+  }
+  top = NEXTC(c);
+     d4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d4d:	8b 00                	mov    (%eax),%eax
+     d4f:	83 e0 f8             	and    $0xfffffff8,%eax
+     d52:	89 c2                	mov    %eax,%edx
+     d54:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d57:	01 d0                	add    %edx,%eax
+     d59:	a3 6c 19 00 00       	mov    %eax,0x196c
+  top->size = USED;
+     d5e:	a1 6c 19 00 00       	mov    0x196c,%eax
+     d63:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  top->tag = LARGE;
+     d69:	a1 6c 19 00 00       	mov    0x196c,%eax
+     d6e:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  freechunk(c, 0);
+     d75:	83 ec 08             	sub    $0x8,%esp
+     d78:	6a 00                	push   $0x0
+     d7a:	ff 75 f4             	push   -0xc(%ebp)
+     d7d:	e8 ba fd ff ff       	call   b3c <freechunk>
+     d82:	83 c4 10             	add    $0x10,%esp
+  return 0;
+     d85:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     d8a:	c9                   	leave
+     d8b:	c3                   	ret
+
+00000d8c <largealloc>:
+
+static void*
+largealloc(uint nbytes)
+{
+     d8c:	55                   	push   %ebp
+     d8d:	89 e5                	mov    %esp,%ebp
+     d8f:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c, *r;
+  uint need;
+  int i;
+
+  if(nbytes > 0x7fffffff)
+     d92:	8b 45 08             	mov    0x8(%ebp),%eax
+     d95:	85 c0                	test   %eax,%eax
+     d97:	79 0a                	jns    da3 <largealloc+0x17>
+    return 0;
+     d99:	b8 00 00 00 00       	mov    $0x0,%eax
+     d9e:	e9 43 01 00 00       	jmp    ee6 <largealloc+0x15a>
+  need = (nbytes + HDRSIZE + 7) & ~7;
+     da3:	8b 45 08             	mov    0x8(%ebp),%eax
+     da6:	83 c0 0f             	add    $0xf,%eax
+     da9:	83 e0 f8             	and    $0xfffffff8,%eax
+     dac:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(need < MINCHUNK)
+     daf:	83 7d f0 17          	cmpl   $0x17,-0x10(%ebp)
+     db3:	77 07                	ja     dbc <largealloc+0x30>
+    need = MINCHUNK;
+     db5:	c7 45 f0 18 00 00 00 	movl   $0x18,-0x10(%ebp)
+  for(;;){
+    for(i = binof(need); i < NBIN; i++)
+     dbc:	ff 75 f0             	push   -0x10(%ebp)
+     dbf:	e8 9f fc ff ff       	call   a63 <binof>
+     dc4:	83 c4 04             	add    $0x4,%esp
+     dc7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     dca:	eb 2f                	jmp    dfb <largealloc+0x6f>
+      for(c = bins[i]; c; c = c->next)
+     dcc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     dcf:	8b 04 85 00 19 00 00 	mov    0x1900(,%eax,4),%eax
+     dd6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     dd9:	eb 16                	jmp    df1 <largealloc+0x65>
+        if(CSIZE(c) >= need)
+     ddb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     dde:	8b 00                	mov    (%eax),%eax
+     de0:	83 e0 f8             	and    $0xfffffff8,%eax
+     de3:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     de6:	73 35                	jae    e1d <largealloc+0x91>
+      for(c = bins[i]; c; c = c->next)
+     de8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     deb:	8b 40 08             	mov    0x8(%eax),%eax
+     dee:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     df1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     df5:	75 e4                	jne    ddb <largealloc+0x4f>
+    for(i = binof(need); i < NBIN; i++)
+     df7:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     dfb:	83 7d ec 1a          	cmpl   $0x1a,-0x14(%ebp)
+     dff:	7e cb                	jle    dcc <largealloc+0x40>
+          goto found;
+    if(morecore(need) < 0)
+     e01:	83 ec 0c             	sub    $0xc,%esp
+     e04:	ff 75 f0             	push   -0x10(%ebp)
+     e07:	e8 65 fe ff ff       	call   c71 <morecore>
+     e0c:	83 c4 10             	add    $0x10,%esp
+     e0f:	85 c0                	test   %eax,%eax
+     e11:	79 a9                	jns    dbc <largealloc+0x30>
+      return 0;
+     e13:	b8 00 00 00 00       	mov    $0x0,%eax
+     e18:	e9 c9 00 00 00       	jmp    ee6 <largealloc+0x15a>
+          goto found;
+     e1d:	90                   	nop
+  }
+
+found:
+  binremove(c);
+     e1e:	83 ec 0c             	sub    $0xc,%esp
+     e21:	ff 75 f4             	push   -0xc(%ebp)
+     e24:	e8 bb fc ff ff       	call   ae4 <binremove>
+     e29:	83 c4 10             	add    $0x10,%esp
+  if(CSIZE(c) - need >= MINCHUNK){
+     e2c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e2f:	8b 00                	mov    (%eax),%eax
+     e31:	83 e0 f8             	and    $0xfffffff8,%eax
+     e34:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     e37:	83 f8 17             	cmp    $0x17,%eax
+     e3a:	76 66                	jbe    ea2 <largealloc+0x116>
+    r = (struct chunk*)((char*)c + need);
+     e3c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     e3f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e42:	01 d0                	add    %edx,%eax
+     e44:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    r->size = (CSIZE(c) - need) | PREVUSED;
+     e47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e4a:	8b 00                	mov    (%eax),%eax
+     e4c:	83 e0 f8             	and    $0xfffffff8,%eax
+     e4f:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     e52:	83 c8 02             	or     $0x2,%eax
+     e55:	89 c2                	mov    %eax,%edx
+     e57:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e5a:	89 10                	mov    %edx,(%eax)
+    r->tag = LARGE;
+     e5c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e5f:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+    FOOTER(r) = CSIZE(r);
+     e66:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e69:	8b 10                	mov    (%eax),%edx
+     e6b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e6e:	8b 00                	mov    (%eax),%eax
+     e70:	83 e0 f8             	and    $0xfffffff8,%eax
+     e73:	8d 48 fc             	lea    -0x4(%eax),%ecx
+     e76:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e79:	01 c8                	add    %ecx,%eax
+     e7b:	83 e2 f8             	and    $0xfffffff8,%edx
+     e7e:	89 10                	mov    %edx,(%eax)
+    bininsert(r);
+     e80:	83 ec 0c             	sub    $0xc,%esp
+     e83:	ff 75 e8             	push   -0x18(%ebp)
+     e86:	e8 03 fc ff ff       	call   a8e <bininsert>
+     e8b:	83 c4 10             	add    $0x10,%esp
+    c->size = need | (c->size & PREVUSED);
+     e8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e91:	8b 00                	mov    (%eax),%eax
+     e93:	83 e0 02             	and    $0x2,%eax
+     e96:	0b 45 f0             	or     -0x10(%ebp),%eax
+     e99:	89 c2                	mov    %eax,%edx
+     e9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e9e:	89 10                	mov    %edx,(%eax)
+     ea0:	eb 25                	jmp    ec7 <largealloc+0x13b>
+  } else
+    NEXTC(c)->size |= PREVUSED;
+     ea2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ea5:	8b 00                	mov    (%eax),%eax
+     ea7:	83 e0 f8             	and    $0xfffffff8,%eax
+     eaa:	89 c2                	mov    %eax,%edx
+     eac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eaf:	01 d0                	add    %edx,%eax
+     eb1:	8b 10                	mov    (%eax),%edx
+     eb3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eb6:	8b 00                	mov    (%eax),%eax
+     eb8:	83 e0 f8             	and    $0xfffffff8,%eax
+     ebb:	89 c1                	mov    %eax,%ecx
+     ebd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ec0:	01 c8                	add    %ecx,%eax
+     ec2:	83 ca 02             	or     $0x2,%edx
+     ec5:	89 10                	mov    %edx,(%eax)
+  c->size |= USED;
+     ec7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eca:	8b 00                	mov    (%eax),%eax
+     ecc:	83 c8 01             	or     $0x1,%eax
+     ecf:	89 c2                	mov    %eax,%edx
+     ed1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ed4:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+     ed6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ed9:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  return (char*)c + HDRSIZE;
+     ee0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ee3:	83 c0 08             	add    $0x8,%eax
+}
+     ee6:	c9                   	leave
+     ee7:	c3                   	ret
+
+00000ee8 <refill>:
+
+// Carve a slab into free blocks of class k.
+static int
+refill(int k)
+{
+     ee8:	55                   	push   %ebp
+     ee9:	89 e5                	mov    %esp,%ebp
+     eeb:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  char *p;
+  uint bs, i;
+
+  if((p = largealloc(SLABSIZE)) == 0)
+     eee:	83 ec 0c             	sub    $0xc,%esp
+     ef1:	68 00 20 00 00       	push   $0x2000
+     ef6:	e8 91 fe ff ff       	call   d8c <largealloc>
+     efb:	83 c4 10             	add    $0x10,%esp
+     efe:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f01:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     f05:	75 07                	jne    f0e <refill+0x26>
+    return -1;
+     f07:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     f0c:	eb 75                	jmp    f83 <refill+0x9b>
+  bs = HDRSIZE + (MINSMALL << k);
+     f0e:	8b 45 08             	mov    0x8(%ebp),%eax
+     f11:	ba 10 00 00 00       	mov    $0x10,%edx
+     f16:	89 c1                	mov    %eax,%ecx
+     f18:	d3 e2                	shl    %cl,%edx
+     f1a:	89 d0                	mov    %edx,%eax
+     f1c:	83 c0 08             	add    $0x8,%eax
+     f1f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+     f22:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     f29:	eb 44                	jmp    f6f <refill+0x87>
+    b = (struct chunk*)(p + i);
+     f2b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     f2e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f31:	01 d0                	add    %edx,%eax
+     f33:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    b->size = bs | USED;
+     f36:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f39:	83 c8 01             	or     $0x1,%eax
+     f3c:	89 c2                	mov    %eax,%edx
+     f3e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f41:	89 10                	mov    %edx,(%eax)
+    b->tag = k;
+     f43:	8b 55 08             	mov    0x8(%ebp),%edx
+     f46:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f49:	89 50 04             	mov    %edx,0x4(%eax)
+    b->next = classes[k];
+     f4c:	8b 45 08             	mov    0x8(%ebp),%eax
+     f4f:	8b 14 85 e0 18 00 00 	mov    0x18e0(,%eax,4),%edx
+     f56:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f59:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[k] = b;
+     f5c:	8b 45 08             	mov    0x8(%ebp),%eax
+     f5f:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     f62:	89 14 85 e0 18 00 00 	mov    %edx,0x18e0(,%eax,4)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+     f69:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f6c:	01 45 f4             	add    %eax,-0xc(%ebp)
+     f6f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     f72:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f75:	01 d0                	add    %edx,%eax
+     f77:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     f7c:	76 ad                	jbe    f2b <refill+0x43>
+  }
+  return 0;
+     f7e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     f83:	c9                   	leave
+     f84:	c3                   	ret
+
+00000f85 <free>:
+
+void
+free(void *ap)
+{
+     f85:	55                   	push   %ebp
+     f86:	89 e5                	mov    %esp,%ebp
+     f88:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+
+  if(ap == 0)
+     f8b:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     f8f:	74 4b                	je     fdc <free+0x57>
+    return;
+  c = (struct chunk*)((char*)ap - HDRSIZE);
+     f91:	8b 45 08             	mov    0x8(%ebp),%eax
+     f94:	83 e8 08             	sub    $0x8,%eax
+     f97:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(c->tag != LARGE){
+     f9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f9d:	8b 40 04             	mov    0x4(%eax),%eax
+     fa0:	83 f8 ff             	cmp    $0xffffffff,%eax
+     fa3:	74 25                	je     fca <free+0x45>
+    c->next = classes[c->tag];
+     fa5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fa8:	8b 40 04             	mov    0x4(%eax),%eax
+     fab:	8b 14 85 e0 18 00 00 	mov    0x18e0(,%eax,4),%edx
+     fb2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fb5:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[c->tag] = c;
+     fb8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fbb:	8b 40 04             	mov    0x4(%eax),%eax
+     fbe:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     fc1:	89 14 85 e0 18 00 00 	mov    %edx,0x18e0(,%eax,4)
+    return;
+     fc8:	eb 13                	jmp    fdd <free+0x58>
+  }
+  freechunk(c, 1);
+     fca:	83 ec 08             	sub    $0x8,%esp
+     fcd:	6a 01                	push   $0x1
+     fcf:	ff 75 f4             	push   -0xc(%ebp)
+     fd2:	e8 65 fb ff ff       	call   b3c <freechunk>
+     fd7:	83 c4 10             	add    $0x10,%esp
+     fda:	eb 01                	jmp    fdd <free+0x58>
+    return;
+     fdc:	90                   	nop
+}
+     fdd:	c9                   	leave
+     fde:	c3                   	ret
+
+00000fdf <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     fdf:	55                   	push   %ebp
+     fe0:	89 e5                	mov    %esp,%ebp
+     fe2:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  int k;
+
+  if(nbytes > MAXSMALL)
+     fe5:	81 7d 08 00 08 00 00 	cmpl   $0x800,0x8(%ebp)
+     fec:	76 10                	jbe    ffe <malloc+0x1f>
+    return largealloc(nbytes);
+     fee:	83 ec 0c             	sub    $0xc,%esp
+     ff1:	ff 75 08             	push   0x8(%ebp)
+     ff4:	e8 93 fd ff ff       	call   d8c <largealloc>
+     ff9:	83 c4 10             	add    $0x10,%esp
+     ffc:	eb 6a                	jmp    1068 <malloc+0x89>
+  for(k = 0; (MINSMALL << k) < nbytes; k++)
+     ffe:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1005:	eb 04                	jmp    100b <malloc+0x2c>
+    1007:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    100b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    100e:	ba 10 00 00 00       	mov    $0x10,%edx
+    1013:	89 c1                	mov    %eax,%ecx
+    1015:	d3 e2                	shl    %cl,%edx
+    1017:	89 d0                	mov    %edx,%eax
+    1019:	3b 45 08             	cmp    0x8(%ebp),%eax
+    101c:	72 e9                	jb     1007 <malloc+0x28>
+    ;
+  if(classes[k] == 0 && refill(k) < 0)
+    101e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1021:	8b 04 85 e0 18 00 00 	mov    0x18e0(,%eax,4),%eax
+    1028:	85 c0                	test   %eax,%eax
+    102a:	75 19                	jne    1045 <malloc+0x66>
+    102c:	83 ec 0c             	sub    $0xc,%esp
+    102f:	ff 75 f4             	push   -0xc(%ebp)
+    1032:	e8 b1 fe ff ff       	call   ee8 <refill>
+    1037:	83 c4 10             	add    $0x10,%esp
+    103a:	85 c0                	test   %eax,%eax
+    103c:	79 07                	jns    1045 <malloc+0x66>
+    return 0;
+    103e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1043:	eb 23                	jmp    1068 <malloc+0x89>
+  b = classes[k];
+    1045:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1048:	8b 04 85 e0 18 00 00 	mov    0x18e0(,%eax,4),%eax
+    104f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  classes[k] = b->next;
+    1052:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1055:	8b 50 08             	mov    0x8(%eax),%edx
+    1058:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    105b:	89 14 85 e0 18 00 00 	mov    %edx,0x18e0(,%eax,4)
+  return (char*)b + HDRSIZE;
+    1062:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1065:	83 c0 08             	add    $0x8,%eax
+}
+    1068:	c9                   	leave
+    1069:	c3                   	ret
+
+0000106a <stream>:
+
+// Return the stream for fd, deciding on first use how
+// its output is buffered.  Returns 0 if fd is not open.
+static struct stream*
+stream(int fd)
+{
+    106a:	55                   	push   %ebp
+    106b:	89 e5                	mov    %esp,%ebp
+    106d:	83 ec 28             	sub    $0x28,%esp
+  struct stream *s;
+  struct stat st;
+
+  if(fd < 0 || fd >= NOFILE)
+    1070:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1074:	78 06                	js     107c <stream+0x12>
+    1076:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    107a:	7e 07                	jle    1083 <stream+0x19>
+    return 0;
+    107c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1081:	eb 55                	jmp    10d8 <stream+0x6e>
+  s = &streams[fd];
+    1083:	8b 45 08             	mov    0x8(%ebp),%eax
+    1086:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    108c:	05 80 19 00 00       	add    $0x1980,%eax
+    1091:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(s->mode == UNKNOWN){
+    1094:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1097:	8b 00                	mov    (%eax),%eax
+    1099:	85 c0                	test   %eax,%eax
+    109b:	75 38                	jne    10d5 <stream+0x6b>
+    if(fstat(fd, &st) < 0)
+    109d:	83 ec 08             	sub    $0x8,%esp
+    10a0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    10a3:	50                   	push   %eax
+    10a4:	ff 75 08             	push   0x8(%ebp)
+    10a7:	e8 57 f6 ff ff       	call   703 <fstat>
+    10ac:	83 c4 10             	add    $0x10,%esp
+    10af:	85 c0                	test   %eax,%eax
+    10b1:	79 07                	jns    10ba <stream+0x50>
+      return 0;
+    10b3:	b8 00 00 00 00       	mov    $0x0,%eax
+    10b8:	eb 1e                	jmp    10d8 <stream+0x6e>
+    s->mode = st.type == T_DEV ? LINEBUF : FULLBUF;
+    10ba:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+    10be:	66 83 f8 03          	cmp    $0x3,%ax
+    10c2:	75 07                	jne    10cb <stream+0x61>
+    10c4:	ba 01 00 00 00       	mov    $0x1,%edx
+    10c9:	eb 05                	jmp    10d0 <stream+0x66>
+    10cb:	ba 02 00 00 00       	mov    $0x2,%edx
+    10d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10d3:	89 10                	mov    %edx,(%eax)
+  }
+  return s;
+    10d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    10d8:	c9                   	leave
+    10d9:	c3                   	ret
+
+000010da <fflush>:
+
+int
+fflush(int fd)
+{
+    10da:	55                   	push   %ebp
+    10db:	89 e5                	mov    %esp,%ebp
+    10dd:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  int i, n;
+
+  if(fd < 0 || fd >= NOFILE)
+    10e0:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    10e4:	78 06                	js     10ec <fflush+0x12>
+    10e6:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    10ea:	7e 07                	jle    10f3 <fflush+0x19>
+    return -1;
+    10ec:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    10f1:	eb 78                	jmp    116b <fflush+0x91>
+  s = &streams[fd];
+    10f3:	8b 45 08             	mov    0x8(%ebp),%eax
+    10f6:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    10fc:	05 80 19 00 00       	add    $0x1980,%eax
+    1101:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < s->nout; i += n){
+    1104:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    110b:	eb 44                	jmp    1151 <fflush+0x77>
+    if((n = write(fd, s->out + i, s->nout - i)) <= 0){
+    110d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1110:	8b 40 04             	mov    0x4(%eax),%eax
+    1113:	2b 45 f4             	sub    -0xc(%ebp),%eax
+    1116:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    1119:	8d 4a 10             	lea    0x10(%edx),%ecx
+    111c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    111f:	01 ca                	add    %ecx,%edx
+    1121:	83 ec 04             	sub    $0x4,%esp
+    1124:	50                   	push   %eax
+    1125:	52                   	push   %edx
+    1126:	ff 75 08             	push   0x8(%ebp)
+    1129:	e8 6c f5 ff ff       	call   69a <write>
+    112e:	83 c4 10             	add    $0x10,%esp
+    1131:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1134:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1138:	7f 11                	jg     114b <fflush+0x71>
+      s->nout = 0;
+    113a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    113d:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+      return -1;
+    1144:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1149:	eb 20                	jmp    116b <fflush+0x91>
+  for(i = 0; i < s->nout; i += n){
+    114b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    114e:	01 45 f4             	add    %eax,-0xc(%ebp)
+    1151:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1154:	8b 40 04             	mov    0x4(%eax),%eax
+    1157:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    115a:	7c b1                	jl     110d <fflush+0x33>
+    }
+  }
+  s->nout = 0;
+    115c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    115f:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  return 0;
+    1166:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    116b:	c9                   	leave
+    116c:	c3                   	ret
+
+0000116d <flushall>:
+
+// Flush every stream, or only line-buffered ones.
+static void
+flushall(int lineonly)
+{
+    116d:	55                   	push   %ebp
+    116e:	89 e5                	mov    %esp,%ebp
+    1170:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+    1173:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    117a:	eb 41                	jmp    11bd <flushall+0x50>
+    if(streams[fd].nout > 0 && (!lineonly || streams[fd].mode == LINEBUF))
+    117c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    117f:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1185:	05 84 19 00 00       	add    $0x1984,%eax
+    118a:	8b 00                	mov    (%eax),%eax
+    118c:	85 c0                	test   %eax,%eax
+    118e:	7e 29                	jle    11b9 <flushall+0x4c>
+    1190:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1194:	74 15                	je     11ab <flushall+0x3e>
+    1196:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1199:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    119f:	05 80 19 00 00       	add    $0x1980,%eax
+    11a4:	8b 00                	mov    (%eax),%eax
+    11a6:	83 f8 01             	cmp    $0x1,%eax
+    11a9:	75 0e                	jne    11b9 <flushall+0x4c>
+      fflush(fd);
+    11ab:	83 ec 0c             	sub    $0xc,%esp
+    11ae:	ff 75 f4             	push   -0xc(%ebp)
+    11b1:	e8 24 ff ff ff       	call   10da <fflush>
+    11b6:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++)
+    11b9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    11bd:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+    11c1:	7e b9                	jle    117c <flushall+0xf>
+}
+    11c3:	90                   	nop
+    11c4:	90                   	nop
+    11c5:	c9                   	leave
+    11c6:	c3                   	ret
+
+000011c7 <fputc>:
+
+int
+fputc(int fd, int c)
+{
+    11c7:	55                   	push   %ebp
+    11c8:	89 e5                	mov    %esp,%ebp
+    11ca:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  char ch;
+
+  if((s = stream(fd)) == 0){
+    11cd:	83 ec 0c             	sub    $0xc,%esp
+    11d0:	ff 75 08             	push   0x8(%ebp)
+    11d3:	e8 92 fe ff ff       	call   106a <stream>
+    11d8:	83 c4 10             	add    $0x10,%esp
+    11db:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    11de:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    11e2:	75 2e                	jne    1212 <fputc+0x4b>
+    ch = c;
+    11e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11e7:	88 45 f3             	mov    %al,-0xd(%ebp)
+    return write(fd, &ch, 1) == 1 ? (uchar)c : -1;
+    11ea:	83 ec 04             	sub    $0x4,%esp
+    11ed:	6a 01                	push   $0x1
+    11ef:	8d 45 f3             	lea    -0xd(%ebp),%eax
+    11f2:	50                   	push   %eax
+    11f3:	ff 75 08             	push   0x8(%ebp)
+    11f6:	e8 9f f4 ff ff       	call   69a <write>
+    11fb:	83 c4 10             	add    $0x10,%esp
+    11fe:	83 f8 01             	cmp    $0x1,%eax
+    1201:	75 08                	jne    120b <fputc+0x44>
+    1203:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1206:	0f b6 c0             	movzbl %al,%eax
+    1209:	eb 5e                	jmp    1269 <fputc+0xa2>
+    120b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1210:	eb 57                	jmp    1269 <fputc+0xa2>
+  }
+  s->out[s->nout++] = c;
+    1212:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1215:	8b 40 04             	mov    0x4(%eax),%eax
+    1218:	8d 48 01             	lea    0x1(%eax),%ecx
+    121b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    121e:	89 4a 04             	mov    %ecx,0x4(%edx)
+    1221:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1224:	89 d1                	mov    %edx,%ecx
+    1226:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1229:	88 4c 02 10          	mov    %cl,0x10(%edx,%eax,1)
+  if(s->nout == BUFSZ || (s->mode == LINEBUF && c == '\n'))
+    122d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1230:	8b 40 04             	mov    0x4(%eax),%eax
+    1233:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1238:	74 10                	je     124a <fputc+0x83>
+    123a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    123d:	8b 00                	mov    (%eax),%eax
+    123f:	83 f8 01             	cmp    $0x1,%eax
+    1242:	75 1f                	jne    1263 <fputc+0x9c>
+    1244:	83 7d 0c 0a          	cmpl   $0xa,0xc(%ebp)
+    1248:	75 19                	jne    1263 <fputc+0x9c>
+    if(fflush(fd) < 0)
+    124a:	83 ec 0c             	sub    $0xc,%esp
+    124d:	ff 75 08             	push   0x8(%ebp)
+    1250:	e8 85 fe ff ff       	call   10da <fflush>
+    1255:	83 c4 10             	add    $0x10,%esp
+    1258:	85 c0                	test   %eax,%eax
+    125a:	79 07                	jns    1263 <fputc+0x9c>
+      return -1;
+    125c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1261:	eb 06                	jmp    1269 <fputc+0xa2>
+  return (uchar)c;
+    1263:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1266:	0f b6 c0             	movzbl %al,%eax
+}
+    1269:	c9                   	leave
+    126a:	c3                   	ret
+
+0000126b <fgetc>:
+
+// Return the next byte read from fd, or -1 at end of file.
+int
+fgetc(int fd)
+{
+    126b:	55                   	push   %ebp
+    126c:	89 e5                	mov    %esp,%ebp
+    126e:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  uchar c;
+  int n;
+
+  if((s = stream(fd)) == 0){
+    1271:	83 ec 0c             	sub    $0xc,%esp
+    1274:	ff 75 08             	push   0x8(%ebp)
+    1277:	e8 ee fd ff ff       	call   106a <stream>
+    127c:	83 c4 10             	add    $0x10,%esp
+    127f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1282:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1286:	75 39                	jne    12c1 <fgetc+0x56>
+    flushall(1);
+    1288:	83 ec 0c             	sub    $0xc,%esp
+    128b:	6a 01                	push   $0x1
+    128d:	e8 db fe ff ff       	call   116d <flushall>
+    1292:	83 c4 10             	add    $0x10,%esp
+    return read(fd, &c, 1) == 1 ? c : -1;
+    1295:	83 ec 04             	sub    $0x4,%esp
+    1298:	6a 01                	push   $0x1
+    129a:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    129d:	50                   	push   %eax
+    129e:	ff 75 08             	push   0x8(%ebp)
+    12a1:	e8 e5 f3 ff ff       	call   68b <read>
+    12a6:	83 c4 10             	add    $0x10,%esp
+    12a9:	83 f8 01             	cmp    $0x1,%eax
+    12ac:	75 0c                	jne    12ba <fgetc+0x4f>
+    12ae:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    12b2:	0f b6 c0             	movzbl %al,%eax
+    12b5:	e9 80 00 00 00       	jmp    133a <fgetc+0xcf>
+    12ba:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12bf:	eb 79                	jmp    133a <fgetc+0xcf>
+  }
+  if(s->rpos == s->rend){
+    12c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12c4:	8b 50 08             	mov    0x8(%eax),%edx
+    12c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12ca:	8b 40 0c             	mov    0xc(%eax),%eax
+    12cd:	39 c2                	cmp    %eax,%edx
+    12cf:	75 4c                	jne    131d <fgetc+0xb2>
+    flushall(1);
+    12d1:	83 ec 0c             	sub    $0xc,%esp
+    12d4:	6a 01                	push   $0x1
+    12d6:	e8 92 fe ff ff       	call   116d <flushall>
+    12db:	83 c4 10             	add    $0x10,%esp
+    if((n = read(fd, s->in, BUFSZ)) <= 0)
+    12de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12e1:	05 10 02 00 00       	add    $0x210,%eax
+    12e6:	83 ec 04             	sub    $0x4,%esp
+    12e9:	68 00 02 00 00       	push   $0x200
+    12ee:	50                   	push   %eax
+    12ef:	ff 75 08             	push   0x8(%ebp)
+    12f2:	e8 94 f3 ff ff       	call   68b <read>
+    12f7:	83 c4 10             	add    $0x10,%esp
+    12fa:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    12fd:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1301:	7f 07                	jg     130a <fgetc+0x9f>
+      return -1;
+    1303:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1308:	eb 30                	jmp    133a <fgetc+0xcf>
+    s->rpos = 0;
+    130a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    130d:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+    s->rend = n;
+    1314:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1317:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    131a:	89 50 0c             	mov    %edx,0xc(%eax)
+  }
+  return (uchar)s->in[s->rpos++];
+    131d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1320:	8b 40 08             	mov    0x8(%eax),%eax
+    1323:	8d 48 01             	lea    0x1(%eax),%ecx
+    1326:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1329:	89 4a 08             	mov    %ecx,0x8(%edx)
+    132c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    132f:	0f b6 84 02 10 02 00 	movzbl 0x210(%edx,%eax,1),%eax
+    1336:	00 
+    1337:	0f b6 c0             	movzbl %al,%eax
+}
+    133a:	c9                   	leave
+    133b:	c3                   	ret
+
+0000133c <fork>:
+
+int
+fork(void)
+{
+    133c:	55                   	push   %ebp
+    133d:	89 e5                	mov    %esp,%ebp
+    133f:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1342:	83 ec 0c             	sub    $0xc,%esp
+    1345:	6a 00                	push   $0x0
+    1347:	e8 21 fe ff ff       	call   116d <flushall>
+    134c:	83 c4 10             	add    $0x10,%esp
+  return _fork();
+    134f:	e8 fb f2 ff ff       	call   64f <_fork>
+}
+    1354:	c9                   	leave
+    1355:	c3                   	ret
+
+00001356 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+    1356:	55                   	push   %ebp
+    1357:	89 e5                	mov    %esp,%ebp
+    1359:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    135c:	83 ec 0c             	sub    $0xc,%esp
+    135f:	6a 00                	push   $0x0
+    1361:	e8 07 fe ff ff       	call   116d <flushall>
+    1366:	83 c4 10             	add    $0x10,%esp
+  return _exec(path, argv);
+    1369:	83 ec 08             	sub    $0x8,%esp
+    136c:	ff 75 0c             	push   0xc(%ebp)
+    136f:	ff 75 08             	push   0x8(%ebp)
+    1372:	e8 50 f3 ff ff       	call   6c7 <_exec>
+    1377:	83 c4 10             	add    $0x10,%esp
+}
+    137a:	c9                   	leave
+    137b:	c3                   	ret
+
+0000137c <exit>:
+
+int
+exit(void)
+{
+    137c:	55                   	push   %ebp
+    137d:	89 e5                	mov    %esp,%ebp
+    137f:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1382:	83 ec 0c             	sub    $0xc,%esp
+    1385:	6a 00                	push   $0x0
+    1387:	e8 e1 fd ff ff       	call   116d <flushall>
+    138c:	83 c4 10             	add    $0x10,%esp
+  _exit();
+    138f:	e8 ca f2 ff ff       	call   65e <_exit>
+
+00001394 <close>:
+}
+
+int
+close(int fd)
+{
+    1394:	55                   	push   %ebp
+    1395:	89 e5                	mov    %esp,%ebp
+    1397:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+
+  if(fd >= 0 && fd < NOFILE){
+    139a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    139e:	78 44                	js     13e4 <close+0x50>
+    13a0:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    13a4:	7f 3e                	jg     13e4 <close+0x50>
+    fflush(fd);
+    13a6:	83 ec 0c             	sub    $0xc,%esp
+    13a9:	ff 75 08             	push   0x8(%ebp)
+    13ac:	e8 29 fd ff ff       	call   10da <fflush>
+    13b1:	83 c4 10             	add    $0x10,%esp
+    s = &streams[fd];
+    13b4:	8b 45 08             	mov    0x8(%ebp),%eax
+    13b7:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    13bd:	05 80 19 00 00       	add    $0x1980,%eax
+    13c2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    s->mode = UNKNOWN;
+    13c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13c8:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    s->rpos = s->rend = 0;
+    13ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13d1:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    13d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13db:	8b 50 0c             	mov    0xc(%eax),%edx
+    13de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13e1:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  return _close(fd);
+    13e4:	83 ec 0c             	sub    $0xc,%esp
+    13e7:	ff 75 08             	push   0x8(%ebp)
+    13ea:	e8 ba f2 ff ff       	call   6a9 <_close>
+    13ef:	83 c4 10             	add    $0x10,%esp
+}
+    13f2:	c9                   	leave
+    13f3:	c3                   	ret
@@ -0,0 +1,2603 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	53                   	push   %ebx
+       e:	51                   	push   %ecx
+       f:	89 cb                	mov    %ecx,%ebx
+  if(argc != 3){
+      11:	83 3b 03             	cmpl   $0x3,(%ebx)
+      14:	74 17                	je     2d <main+0x2d>
+    printf(2, "Usage: ln old new\n");
+      16:	83 ec 08             	sub    $0x8,%esp
+      19:	68 f6 13 00 00       	push   $0x13f6
+      1e:	6a 02                	push   $0x2
+      20:	e8 bd 08 00 00       	call   8e2 <printf>
+      25:	83 c4 10             	add    $0x10,%esp
+    exit();
+      28:	e8 51 13 00 00       	call   137e <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+      2d:	8b 43 04             	mov    0x4(%ebx),%eax
+      30:	83 c0 08             	add    $0x8,%eax
+      33:	8b 10                	mov    (%eax),%edx
+      35:	8b 43 04             	mov    0x4(%ebx),%eax
+      38:	83 c0 04             	add    $0x4,%eax
+      3b:	8b 00                	mov    (%eax),%eax
+      3d:	83 ec 08             	sub    $0x8,%esp
+      40:	52                   	push   %edx
+      41:	50                   	push   %eax
+      42:	e8 cd 06 00 00       	call   714 <link>
+      47:	83 c4 10             	add    $0x10,%esp
+      4a:	85 c0                	test   %eax,%eax
+      4c:	79 21                	jns    6f <main+0x6f>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+      4e:	8b 43 04             	mov    0x4(%ebx),%eax
+      51:	83 c0 08             	add    $0x8,%eax
+      54:	8b 10                	mov    (%eax),%edx
+      56:	8b 43 04             	mov    0x4(%ebx),%eax
+      59:	83 c0 04             	add    $0x4,%eax
+      5c:	8b 00                	mov    (%eax),%eax
+      5e:	52                   	push   %edx
+      5f:	50                   	push   %eax
+      60:	68 09 14 00 00       	push   $0x1409
+      65:	6a 02                	push   $0x2
+      67:	e8 76 08 00 00       	call   8e2 <printf>
+      6c:	83 c4 10             	add    $0x10,%esp
+  exit();
+      6f:	e8 0a 13 00 00       	call   137e <exit>
+
+00000074 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+      74:	55                   	push   %ebp
+      75:	89 e5                	mov    %esp,%ebp
+      77:	57                   	push   %edi
+      78:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+      79:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      7c:	8b 55 10             	mov    0x10(%ebp),%edx
+      7f:	8b 45 0c             	mov    0xc(%ebp),%eax
+      82:	89 cb                	mov    %ecx,%ebx
+      84:	89 df                	mov    %ebx,%edi
+      86:	89 d1                	mov    %edx,%ecx
+      88:	fc                   	cld
+      89:	f3 aa                	rep stos %al,%es:(%edi)
+      8b:	89 ca                	mov    %ecx,%edx
+      8d:	89 fb                	mov    %edi,%ebx
+      8f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+      92:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+      95:	90                   	nop
+      96:	5b                   	pop    %ebx
+      97:	5f                   	pop    %edi
+      98:	5d                   	pop    %ebp
+      99:	c3                   	ret
+
+0000009a <stosl>:
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+      9a:	55                   	push   %ebp
+      9b:	89 e5                	mov    %esp,%ebp
+      9d:	57                   	push   %edi
+      9e:	53                   	push   %ebx
+  asm volatile("cld; rep stosl" :
+      9f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      a2:	8b 55 10             	mov    0x10(%ebp),%edx
+      a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+      a8:	89 cb                	mov    %ecx,%ebx
+      aa:	89 df                	mov    %ebx,%edi
+      ac:	89 d1                	mov    %edx,%ecx
+      ae:	fc                   	cld
+      af:	f3 ab                	rep stos %eax,%es:(%edi)
+      b1:	89 ca                	mov    %ecx,%edx
+      b3:	89 fb                	mov    %edi,%ebx
+      b5:	89 5d 08             	mov    %ebx,0x8(%ebp)
+      b8:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+      bb:	90                   	nop
+      bc:	5b                   	pop    %ebx
+      bd:	5f                   	pop    %edi
+      be:	5d                   	pop    %ebp
+      bf:	c3                   	ret
+
+000000c0 <movsb>:
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+      c0:	55                   	push   %ebp
+      c1:	89 e5                	mov    %esp,%ebp
+      c3:	57                   	push   %edi
+      c4:	56                   	push   %esi
+      c5:	53                   	push   %ebx
+  asm volatile("cld; rep movsb" :
+      c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      c9:	8b 55 0c             	mov    0xc(%ebp),%edx
+      cc:	8b 45 10             	mov    0x10(%ebp),%eax
+      cf:	89 cb                	mov    %ecx,%ebx
+      d1:	89 df                	mov    %ebx,%edi
+      d3:	89 d6                	mov    %edx,%esi
+      d5:	89 c1                	mov    %eax,%ecx
+      d7:	fc                   	cld
+      d8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+      da:	89 c8                	mov    %ecx,%eax
+      dc:	89 f2                	mov    %esi,%edx
+      de:	89 fb                	mov    %edi,%ebx
+      e0:	89 5d 08             	mov    %ebx,0x8(%ebp)
+      e3:	89 55 0c             	mov    %edx,0xc(%ebp)
+      e6:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+      e9:	90                   	nop
+      ea:	5b                   	pop    %ebx
+      eb:	5e                   	pop    %esi
+      ec:	5f                   	pop    %edi
+      ed:	5d                   	pop    %ebp
+      ee:	c3                   	ret
+
+000000ef <movsl>:
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+      ef:	55                   	push   %ebp
+      f0:	89 e5                	mov    %esp,%ebp
+      f2:	57                   	push   %edi
+      f3:	56                   	push   %esi
+      f4:	53                   	push   %ebx
+  asm volatile("cld; rep movsl" :
+      f5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+      fb:	8b 45 10             	mov    0x10(%ebp),%eax
+      fe:	89 cb                	mov    %ecx,%ebx
+     100:	89 df                	mov    %ebx,%edi
+     102:	89 d6                	mov    %edx,%esi
+     104:	89 c1                	mov    %eax,%ecx
+     106:	fc                   	cld
+     107:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     109:	89 c8                	mov    %ecx,%eax
+     10b:	89 f2                	mov    %esi,%edx
+     10d:	89 fb                	mov    %edi,%ebx
+     10f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     112:	89 55 0c             	mov    %edx,0xc(%ebp)
+     115:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     118:	90                   	nop
+     119:	5b                   	pop    %ebx
+     11a:	5e                   	pop    %esi
+     11b:	5f                   	pop    %edi
+     11c:	5d                   	pop    %ebp
+     11d:	c3                   	ret
+
+0000011e <strcpy>:
+#define ONES        0x01010101
+#define HASZERO(x)  (((x) - ONES) & ~(x) & (ONES << 7))
+
+char*
+strcpy(char *s, char *t)
+{
+     11e:	55                   	push   %ebp
+     11f:	89 e5                	mov    %esp,%ebp
+     121:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+     124:	8b 45 08             	mov    0x8(%ebp),%eax
+     127:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     12a:	90                   	nop
+     12b:	8b 55 0c             	mov    0xc(%ebp),%edx
+     12e:	8d 42 01             	lea    0x1(%edx),%eax
+     131:	89 45 0c             	mov    %eax,0xc(%ebp)
+     134:	8b 45 08             	mov    0x8(%ebp),%eax
+     137:	8d 48 01             	lea    0x1(%eax),%ecx
+     13a:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     13d:	0f b6 12             	movzbl (%edx),%edx
+     140:	88 10                	mov    %dl,(%eax)
+     142:	0f b6 00             	movzbl (%eax),%eax
+     145:	84 c0                	test   %al,%al
+     147:	75 e2                	jne    12b <strcpy+0xd>
+    ;
+  return os;
+     149:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     14c:	c9                   	leave
+     14d:	c3                   	ret
+
+0000014e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     14e:	55                   	push   %ebp
+     14f:	89 e5                	mov    %esp,%ebp
+  // Aligned words never straddle a page, so reading
+  // whole ones past the end of a string is safe.
+  if((((uint)p | (uint)q) & 3) == 0)
+     151:	8b 55 08             	mov    0x8(%ebp),%edx
+     154:	8b 45 0c             	mov    0xc(%ebp),%eax
+     157:	09 d0                	or     %edx,%eax
+     159:	83 e0 03             	and    $0x3,%eax
+     15c:	85 c0                	test   %eax,%eax
+     15e:	75 3f                	jne    19f <strcmp+0x51>
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     160:	eb 08                	jmp    16a <strcmp+0x1c>
+      p += 4, q += 4;
+     162:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     166:	83 45 0c 04          	addl   $0x4,0xc(%ebp)
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     16a:	8b 45 08             	mov    0x8(%ebp),%eax
+     16d:	8b 10                	mov    (%eax),%edx
+     16f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     172:	8b 00                	mov    (%eax),%eax
+     174:	39 c2                	cmp    %eax,%edx
+     176:	75 27                	jne    19f <strcmp+0x51>
+     178:	8b 45 08             	mov    0x8(%ebp),%eax
+     17b:	8b 00                	mov    (%eax),%eax
+     17d:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     183:	8b 45 08             	mov    0x8(%ebp),%eax
+     186:	8b 00                	mov    (%eax),%eax
+     188:	f7 d0                	not    %eax
+     18a:	21 d0                	and    %edx,%eax
+     18c:	25 80 80 80 80       	and    $0x80808080,%eax
+     191:	85 c0                	test   %eax,%eax
+     193:	74 cd                	je     162 <strcmp+0x14>
+  while(*p && *p == *q)
+     195:	eb 08                	jmp    19f <strcmp+0x51>
+    p++, q++;
+     197:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     19b:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     19f:	8b 45 08             	mov    0x8(%ebp),%eax
+     1a2:	0f b6 00             	movzbl (%eax),%eax
+     1a5:	84 c0                	test   %al,%al
+     1a7:	74 10                	je     1b9 <strcmp+0x6b>
+     1a9:	8b 45 08             	mov    0x8(%ebp),%eax
+     1ac:	0f b6 10             	movzbl (%eax),%edx
+     1af:	8b 45 0c             	mov    0xc(%ebp),%eax
+     1b2:	0f b6 00             	movzbl (%eax),%eax
+     1b5:	38 c2                	cmp    %al,%dl
+     1b7:	74 de                	je     197 <strcmp+0x49>
+  return (uchar)*p - (uchar)*q;
+     1b9:	8b 45 08             	mov    0x8(%ebp),%eax
+     1bc:	0f b6 00             	movzbl (%eax),%eax
+     1bf:	0f b6 d0             	movzbl %al,%edx
+     1c2:	8b 45 0c             	mov    0xc(%ebp),%eax
+     1c5:	0f b6 00             	movzbl (%eax),%eax
+     1c8:	0f b6 c0             	movzbl %al,%eax
+     1cb:	29 c2                	sub    %eax,%edx
+     1cd:	89 d0                	mov    %edx,%eax
+}
+     1cf:	5d                   	pop    %ebp
+     1d0:	c3                   	ret
+
+000001d1 <strlen>:
+
+uint
+strlen(char *s)
+{
+     1d1:	55                   	push   %ebp
+     1d2:	89 e5                	mov    %esp,%ebp
+     1d4:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; ((uint)(s+n) & 3) && s[n]; n++)
+     1d7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     1de:	eb 04                	jmp    1e4 <strlen+0x13>
+     1e0:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     1e4:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     1e7:	8b 45 08             	mov    0x8(%ebp),%eax
+     1ea:	01 d0                	add    %edx,%eax
+     1ec:	83 e0 03             	and    $0x3,%eax
+     1ef:	85 c0                	test   %eax,%eax
+     1f1:	74 0f                	je     202 <strlen+0x31>
+     1f3:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     1f6:	8b 45 08             	mov    0x8(%ebp),%eax
+     1f9:	01 d0                	add    %edx,%eax
+     1fb:	0f b6 00             	movzbl (%eax),%eax
+     1fe:	84 c0                	test   %al,%al
+     200:	75 de                	jne    1e0 <strlen+0xf>
+    ;
+  if(s[n])
+     202:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     205:	8b 45 08             	mov    0x8(%ebp),%eax
+     208:	01 d0                	add    %edx,%eax
+     20a:	0f b6 00             	movzbl (%eax),%eax
+     20d:	84 c0                	test   %al,%al
+     20f:	74 33                	je     244 <strlen+0x73>
+    while(!HASZERO(*(uint*)(s+n)))
+     211:	eb 04                	jmp    217 <strlen+0x46>
+      n += 4;
+     213:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+    while(!HASZERO(*(uint*)(s+n)))
+     217:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     21a:	8b 45 08             	mov    0x8(%ebp),%eax
+     21d:	01 d0                	add    %edx,%eax
+     21f:	8b 00                	mov    (%eax),%eax
+     221:	8d 88 ff fe fe fe    	lea    -0x1010101(%eax),%ecx
+     227:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     22a:	8b 45 08             	mov    0x8(%ebp),%eax
+     22d:	01 d0                	add    %edx,%eax
+     22f:	8b 00                	mov    (%eax),%eax
+     231:	f7 d0                	not    %eax
+     233:	21 c8                	and    %ecx,%eax
+     235:	25 80 80 80 80       	and    $0x80808080,%eax
+     23a:	85 c0                	test   %eax,%eax
+     23c:	74 d5                	je     213 <strlen+0x42>
+  for(; s[n]; n++)
+     23e:	eb 04                	jmp    244 <strlen+0x73>
+     240:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     244:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     247:	8b 45 08             	mov    0x8(%ebp),%eax
+     24a:	01 d0                	add    %edx,%eax
+     24c:	0f b6 00             	movzbl (%eax),%eax
+     24f:	84 c0                	test   %al,%al
+     251:	75 ed                	jne    240 <strlen+0x6f>
+    ;
+  return n;
+     253:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     256:	c9                   	leave
+     257:	c3                   	ret
+
+00000258 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     258:	55                   	push   %ebp
+     259:	89 e5                	mov    %esp,%ebp
+     25b:	83 ec 10             	sub    $0x10,%esp
+  char *d;
+  uint k;
+
+  d = dst;
+     25e:	8b 45 08             	mov    0x8(%ebp),%eax
+     261:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c &= 0xFF;
+     264:	81 65 0c ff 00 00 00 	andl   $0xff,0xc(%ebp)
+  if(n >= 16){
+     26b:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     26f:	76 54                	jbe    2c5 <memset+0x6d>
+    k = -(uint)d & 3;  // bytes up to a word boundary
+     271:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     274:	f7 d8                	neg    %eax
+     276:	83 e0 03             	and    $0x3,%eax
+     279:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    stosb(d, c, k);
+     27c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     27f:	50                   	push   %eax
+     280:	ff 75 0c             	push   0xc(%ebp)
+     283:	ff 75 fc             	push   -0x4(%ebp)
+     286:	e8 e9 fd ff ff       	call   74 <stosb>
+     28b:	83 c4 0c             	add    $0xc,%esp
+    d += k;
+     28e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     291:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n -= k;
+     294:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     297:	29 45 10             	sub    %eax,0x10(%ebp)
+    stosl(d, c*ONES, n/4);
+     29a:	8b 45 10             	mov    0x10(%ebp),%eax
+     29d:	c1 e8 02             	shr    $0x2,%eax
+     2a0:	89 c2                	mov    %eax,%edx
+     2a2:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2a5:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     2ab:	52                   	push   %edx
+     2ac:	50                   	push   %eax
+     2ad:	ff 75 fc             	push   -0x4(%ebp)
+     2b0:	e8 e5 fd ff ff       	call   9a <stosl>
+     2b5:	83 c4 0c             	add    $0xc,%esp
+    d += n & ~3;
+     2b8:	8b 45 10             	mov    0x10(%ebp),%eax
+     2bb:	83 e0 fc             	and    $0xfffffffc,%eax
+     2be:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n &= 3;
+     2c1:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+  }
+  stosb(d, c, n);
+     2c5:	8b 45 10             	mov    0x10(%ebp),%eax
+     2c8:	50                   	push   %eax
+     2c9:	ff 75 0c             	push   0xc(%ebp)
+     2cc:	ff 75 fc             	push   -0x4(%ebp)
+     2cf:	e8 a0 fd ff ff       	call   74 <stosb>
+     2d4:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     2d7:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     2da:	c9                   	leave
+     2db:	c3                   	ret
+
+000002dc <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     2dc:	55                   	push   %ebp
+     2dd:	89 e5                	mov    %esp,%ebp
+     2df:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s1, *s2;
+
+  s1 = v1;
+     2e2:	8b 45 08             	mov    0x8(%ebp),%eax
+     2e5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s2 = v2;
+     2e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2eb:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     2ee:	eb 0c                	jmp    2fc <memcmp+0x20>
+    s1 += 4, s2 += 4, n -= 4;
+     2f0:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+     2f4:	83 45 f8 04          	addl   $0x4,-0x8(%ebp)
+     2f8:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     2fc:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     300:	76 3e                	jbe    340 <memcmp+0x64>
+     302:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     305:	8b 10                	mov    (%eax),%edx
+     307:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     30a:	8b 00                	mov    (%eax),%eax
+     30c:	39 c2                	cmp    %eax,%edx
+     30e:	74 e0                	je     2f0 <memcmp+0x14>
+  while(n-- > 0){
+     310:	eb 2e                	jmp    340 <memcmp+0x64>
+    if(*s1 != *s2)
+     312:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     315:	0f b6 10             	movzbl (%eax),%edx
+     318:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     31b:	0f b6 00             	movzbl (%eax),%eax
+     31e:	38 c2                	cmp    %al,%dl
+     320:	74 16                	je     338 <memcmp+0x5c>
+      return *s1 - *s2;
+     322:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     325:	0f b6 00             	movzbl (%eax),%eax
+     328:	0f b6 d0             	movzbl %al,%edx
+     32b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     32e:	0f b6 00             	movzbl (%eax),%eax
+     331:	0f b6 c0             	movzbl %al,%eax
+     334:	29 c2                	sub    %eax,%edx
+     336:	eb 1a                	jmp    352 <memcmp+0x76>
+    s1++, s2++;
+     338:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     33c:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+  while(n-- > 0){
+     340:	8b 45 10             	mov    0x10(%ebp),%eax
+     343:	8d 50 ff             	lea    -0x1(%eax),%edx
+     346:	89 55 10             	mov    %edx,0x10(%ebp)
+     349:	85 c0                	test   %eax,%eax
+     34b:	75 c5                	jne    312 <memcmp+0x36>
+  }
+  return 0;
+     34d:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+     352:	89 d0                	mov    %edx,%eax
+     354:	c9                   	leave
+     355:	c3                   	ret
+
+00000356 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     356:	55                   	push   %ebp
+     357:	89 e5                	mov    %esp,%ebp
+     359:	83 ec 14             	sub    $0x14,%esp
+     35c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     35f:	88 45 ec             	mov    %al,-0x14(%ebp)
+  uint w, cc;
+
+  // Skip whole words holding neither c nor the terminator.
+  for(; ((uint)s & 3) && *s; s++)
+     362:	eb 17                	jmp    37b <strchr+0x25>
+    if(*s == c)
+     364:	8b 45 08             	mov    0x8(%ebp),%eax
+     367:	0f b6 00             	movzbl (%eax),%eax
+     36a:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     36d:	75 08                	jne    377 <strchr+0x21>
+      return (char*)s;
+     36f:	8b 45 08             	mov    0x8(%ebp),%eax
+     372:	e9 ad 00 00 00       	jmp    424 <strchr+0xce>
+  for(; ((uint)s & 3) && *s; s++)
+     377:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     37b:	8b 45 08             	mov    0x8(%ebp),%eax
+     37e:	83 e0 03             	and    $0x3,%eax
+     381:	85 c0                	test   %eax,%eax
+     383:	74 0a                	je     38f <strchr+0x39>
+     385:	8b 45 08             	mov    0x8(%ebp),%eax
+     388:	0f b6 00             	movzbl (%eax),%eax
+     38b:	84 c0                	test   %al,%al
+     38d:	75 d5                	jne    364 <strchr+0xe>
+  cc = (uchar)c * ONES;
+     38f:	0f b6 45 ec          	movzbl -0x14(%ebp),%eax
+     393:	0f b6 c0             	movzbl %al,%eax
+     396:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     39c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(*s)
+     39f:	8b 45 08             	mov    0x8(%ebp),%eax
+     3a2:	0f b6 00             	movzbl (%eax),%eax
+     3a5:	84 c0                	test   %al,%al
+     3a7:	74 6c                	je     415 <strchr+0xbf>
+    for(; w = *(uint*)s, !HASZERO(w) && !HASZERO(w ^ cc); s += 4)
+     3a9:	eb 04                	jmp    3af <strchr+0x59>
+     3ab:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     3af:	8b 45 08             	mov    0x8(%ebp),%eax
+     3b2:	8b 00                	mov    (%eax),%eax
+     3b4:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     3b7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3ba:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     3c0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3c3:	f7 d0                	not    %eax
+     3c5:	21 d0                	and    %edx,%eax
+     3c7:	25 80 80 80 80       	and    $0x80808080,%eax
+     3cc:	85 c0                	test   %eax,%eax
+     3ce:	75 26                	jne    3f6 <strchr+0xa0>
+     3d0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3d3:	33 45 fc             	xor    -0x4(%ebp),%eax
+     3d6:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     3dc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3df:	33 45 fc             	xor    -0x4(%ebp),%eax
+     3e2:	f7 d0                	not    %eax
+     3e4:	21 d0                	and    %edx,%eax
+     3e6:	25 80 80 80 80       	and    $0x80808080,%eax
+     3eb:	85 c0                	test   %eax,%eax
+     3ed:	75 07                	jne    3f6 <strchr+0xa0>
+     3ef:	b8 01 00 00 00       	mov    $0x1,%eax
+     3f4:	eb 05                	jmp    3fb <strchr+0xa5>
+     3f6:	b8 00 00 00 00       	mov    $0x0,%eax
+     3fb:	85 c0                	test   %eax,%eax
+     3fd:	75 ac                	jne    3ab <strchr+0x55>
+      ;
+  for(; *s; s++)
+     3ff:	eb 14                	jmp    415 <strchr+0xbf>
+    if(*s == c)
+     401:	8b 45 08             	mov    0x8(%ebp),%eax
+     404:	0f b6 00             	movzbl (%eax),%eax
+     407:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     40a:	75 05                	jne    411 <strchr+0xbb>
+      return (char*)s;
+     40c:	8b 45 08             	mov    0x8(%ebp),%eax
+     40f:	eb 13                	jmp    424 <strchr+0xce>
+  for(; *s; s++)
+     411:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     415:	8b 45 08             	mov    0x8(%ebp),%eax
+     418:	0f b6 00             	movzbl (%eax),%eax
+     41b:	84 c0                	test   %al,%al
+     41d:	75 e2                	jne    401 <strchr+0xab>
+  return 0;
+     41f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     424:	c9                   	leave
+     425:	c3                   	ret
+
+00000426 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     426:	55                   	push   %ebp
+     427:	89 e5                	mov    %esp,%ebp
+     429:	83 ec 18             	sub    $0x18,%esp
+  int i, c;
+
+  for(i=0; i+1 < max; ){
+     42c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     433:	eb 37                	jmp    46c <gets+0x46>
+    c = fgetc(0);
+     435:	83 ec 0c             	sub    $0xc,%esp
+     438:	6a 00                	push   $0x0
+     43a:	e8 2e 0e 00 00       	call   126d <fgetc>
+     43f:	83 c4 10             	add    $0x10,%esp
+     442:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(c < 0)
+     445:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     449:	78 2e                	js     479 <gets+0x53>
+      break;
+    buf[i++] = c;
+     44b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     44e:	8d 50 01             	lea    0x1(%eax),%edx
+     451:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     454:	89 c2                	mov    %eax,%edx
+     456:	8b 45 08             	mov    0x8(%ebp),%eax
+     459:	01 d0                	add    %edx,%eax
+     45b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     45e:	88 10                	mov    %dl,(%eax)
+    if(c == '\n' || c == '\r')
+     460:	83 7d f0 0a          	cmpl   $0xa,-0x10(%ebp)
+     464:	74 14                	je     47a <gets+0x54>
+     466:	83 7d f0 0d          	cmpl   $0xd,-0x10(%ebp)
+     46a:	74 0e                	je     47a <gets+0x54>
+  for(i=0; i+1 < max; ){
+     46c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     46f:	83 c0 01             	add    $0x1,%eax
+     472:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     475:	7f be                	jg     435 <gets+0xf>
+     477:	eb 01                	jmp    47a <gets+0x54>
+      break;
+     479:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     47a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     47d:	8b 45 08             	mov    0x8(%ebp),%eax
+     480:	01 d0                	add    %edx,%eax
+     482:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     485:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     488:	c9                   	leave
+     489:	c3                   	ret
+
+0000048a <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     48a:	55                   	push   %ebp
+     48b:	89 e5                	mov    %esp,%ebp
+     48d:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     490:	83 ec 08             	sub    $0x8,%esp
+     493:	6a 00                	push   $0x0
+     495:	ff 75 08             	push   0x8(%ebp)
+     498:	e8 3b 02 00 00       	call   6d8 <open>
+     49d:	83 c4 10             	add    $0x10,%esp
+     4a0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     4a3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     4a7:	79 07                	jns    4b0 <stat+0x26>
+    return -1;
+     4a9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     4ae:	eb 25                	jmp    4d5 <stat+0x4b>
+  r = fstat(fd, st);
+     4b0:	83 ec 08             	sub    $0x8,%esp
+     4b3:	ff 75 0c             	push   0xc(%ebp)
+     4b6:	ff 75 f4             	push   -0xc(%ebp)
+     4b9:	e8 47 02 00 00       	call   705 <fstat>
+     4be:	83 c4 10             	add    $0x10,%esp
+     4c1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     4c4:	83 ec 0c             	sub    $0xc,%esp
+     4c7:	ff 75 f4             	push   -0xc(%ebp)
+     4ca:	e8 c7 0e 00 00       	call   1396 <close>
+     4cf:	83 c4 10             	add    $0x10,%esp
+  return r;
+     4d2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     4d5:	c9                   	leave
+     4d6:	c3                   	ret
+
+000004d7 <atoi>:
+
+int
+atoi(const char *s)
+{
+     4d7:	55                   	push   %ebp
+     4d8:	89 e5                	mov    %esp,%ebp
+     4da:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     4dd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     4e4:	eb 25                	jmp    50b <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     4e6:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     4e9:	89 d0                	mov    %edx,%eax
+     4eb:	c1 e0 02             	shl    $0x2,%eax
+     4ee:	01 d0                	add    %edx,%eax
+     4f0:	01 c0                	add    %eax,%eax
+     4f2:	89 c1                	mov    %eax,%ecx
+     4f4:	8b 45 08             	mov    0x8(%ebp),%eax
+     4f7:	8d 50 01             	lea    0x1(%eax),%edx
+     4fa:	89 55 08             	mov    %edx,0x8(%ebp)
+     4fd:	0f b6 00             	movzbl (%eax),%eax
+     500:	0f be c0             	movsbl %al,%eax
+     503:	01 c8                	add    %ecx,%eax
+     505:	83 e8 30             	sub    $0x30,%eax
+     508:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     50b:	8b 45 08             	mov    0x8(%ebp),%eax
+     50e:	0f b6 00             	movzbl (%eax),%eax
+     511:	3c 2f                	cmp    $0x2f,%al
+     513:	7e 0a                	jle    51f <atoi+0x48>
+     515:	8b 45 08             	mov    0x8(%ebp),%eax
+     518:	0f b6 00             	movzbl (%eax),%eax
+     51b:	3c 39                	cmp    $0x39,%al
+     51d:	7e c7                	jle    4e6 <atoi+0xf>
+  return n;
+     51f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     522:	c9                   	leave
+     523:	c3                   	ret
+
+00000524 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     524:	55                   	push   %ebp
+     525:	89 e5                	mov    %esp,%ebp
+     527:	83 ec 10             	sub    $0x10,%esp
+  char *d, *s;
+  int k;
+
+  if(n <= 0)
+     52a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     52e:	7f 08                	jg     538 <memmove+0x14>
+    return vdst;
+     530:	8b 45 08             	mov    0x8(%ebp),%eax
+     533:	e9 17 01 00 00       	jmp    64f <memmove+0x12b>
+  d = vdst;
+     538:	8b 45 08             	mov    0x8(%ebp),%eax
+     53b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s = vsrc;
+     53e:	8b 45 0c             	mov    0xc(%ebp),%eax
+     541:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  if(s < d && s + n > d){
+     544:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     547:	3b 45 fc             	cmp    -0x4(%ebp),%eax
+     54a:	0f 83 84 00 00 00    	jae    5d4 <memmove+0xb0>
+     550:	8b 55 10             	mov    0x10(%ebp),%edx
+     553:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     556:	01 d0                	add    %edx,%eax
+     558:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     55b:	73 77                	jae    5d4 <memmove+0xb0>
+    s += n;
+     55d:	8b 45 10             	mov    0x10(%ebp),%eax
+     560:	01 45 f8             	add    %eax,-0x8(%ebp)
+    d += n;
+     563:	8b 45 10             	mov    0x10(%ebp),%eax
+     566:	01 45 fc             	add    %eax,-0x4(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     569:	eb 17                	jmp    582 <memmove+0x5e>
+      *--d = *--s, n--;
+     56b:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     56f:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     573:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     576:	0f b6 10             	movzbl (%eax),%edx
+     579:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     57c:	88 10                	mov    %dl,(%eax)
+     57e:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     582:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     586:	7e 22                	jle    5aa <memmove+0x86>
+     588:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     58b:	83 e0 03             	and    $0x3,%eax
+     58e:	85 c0                	test   %eax,%eax
+     590:	75 d9                	jne    56b <memmove+0x47>
+    for(; n >= 4; n -= 4){
+     592:	eb 16                	jmp    5aa <memmove+0x86>
+      d -= 4;
+     594:	83 6d fc 04          	subl   $0x4,-0x4(%ebp)
+      s -= 4;
+     598:	83 6d f8 04          	subl   $0x4,-0x8(%ebp)
+      *(uint*)d = *(uint*)s;
+     59c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     59f:	8b 10                	mov    (%eax),%edx
+     5a1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     5a4:	89 10                	mov    %edx,(%eax)
+    for(; n >= 4; n -= 4){
+     5a6:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+     5aa:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     5ae:	7f e4                	jg     594 <memmove+0x70>
+    }
+    while(n-- > 0)
+     5b0:	eb 13                	jmp    5c5 <memmove+0xa1>
+      *--d = *--s;
+     5b2:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     5b6:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     5ba:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     5bd:	0f b6 10             	movzbl (%eax),%edx
+     5c0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     5c3:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+     5c5:	8b 45 10             	mov    0x10(%ebp),%eax
+     5c8:	8d 50 ff             	lea    -0x1(%eax),%edx
+     5cb:	89 55 10             	mov    %edx,0x10(%ebp)
+     5ce:	85 c0                	test   %eax,%eax
+     5d0:	7f e0                	jg     5b2 <memmove+0x8e>
+  if(s < d && s + n > d){
+     5d2:	eb 78                	jmp    64c <memmove+0x128>
+  } else {
+    if(n >= 16){
+     5d4:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     5d8:	7e 61                	jle    63b <memmove+0x117>
+      k = -(uint)d & 3;
+     5da:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     5dd:	f7 d8                	neg    %eax
+     5df:	83 e0 03             	and    $0x3,%eax
+     5e2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      movsb(d, s, k);
+     5e5:	ff 75 f4             	push   -0xc(%ebp)
+     5e8:	ff 75 f8             	push   -0x8(%ebp)
+     5eb:	ff 75 fc             	push   -0x4(%ebp)
+     5ee:	e8 cd fa ff ff       	call   c0 <movsb>
+     5f3:	83 c4 0c             	add    $0xc,%esp
+      d += k;
+     5f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5f9:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += k;
+     5fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5ff:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n -= k;
+     602:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     605:	29 45 10             	sub    %eax,0x10(%ebp)
+      movsl(d, s, n/4);
+     608:	8b 45 10             	mov    0x10(%ebp),%eax
+     60b:	8d 50 03             	lea    0x3(%eax),%edx
+     60e:	85 c0                	test   %eax,%eax
+     610:	0f 48 c2             	cmovs  %edx,%eax
+     613:	c1 f8 02             	sar    $0x2,%eax
+     616:	50                   	push   %eax
+     617:	ff 75 f8             	push   -0x8(%ebp)
+     61a:	ff 75 fc             	push   -0x4(%ebp)
+     61d:	e8 cd fa ff ff       	call   ef <movsl>
+     622:	83 c4 0c             	add    $0xc,%esp
+      d += n & ~3;
+     625:	8b 45 10             	mov    0x10(%ebp),%eax
+     628:	83 e0 fc             	and    $0xfffffffc,%eax
+     62b:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += n & ~3;
+     62e:	8b 45 10             	mov    0x10(%ebp),%eax
+     631:	83 e0 fc             	and    $0xfffffffc,%eax
+     634:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n &= 3;
+     637:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+    }
+    movsb(d, s, n);
+     63b:	ff 75 10             	push   0x10(%ebp)
+     63e:	ff 75 f8             	push   -0x8(%ebp)
+     641:	ff 75 fc             	push   -0x4(%ebp)
+     644:	e8 77 fa ff ff       	call   c0 <movsb>
+     649:	83 c4 0c             	add    $0xc,%esp
+  }
+  return vdst;
+     64c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     64f:	c9                   	leave
+     650:	c3                   	ret
+
+00000651 <_fork>:
+    movl %esp, %ecx; \
+    movl $1f, %edx; \
+    sysenter; \
+  1: ret
+
+RAWSYSCALL(fork)
+     651:	b8 01 00 00 00       	mov    $0x1,%eax
+     656:	89 e1                	mov    %esp,%ecx
+     658:	ba 5f 06 00 00       	mov    $0x65f,%edx
+     65d:	0f 34                	sysenter
+     65f:	c3                   	ret
+
+00000660 <_exit>:
+RAWSYSCALL(exit)
+     660:	b8 02 00 00 00       	mov    $0x2,%eax
+     665:	89 e1                	mov    %esp,%ecx
+     667:	ba 6e 06 00 00       	mov    $0x66e,%edx
+     66c:	0f 34                	sysenter
+     66e:	c3                   	ret
+
+0000066f <wait>:
+SYSCALL(wait)
+     66f:	b8 03 00 00 00       	mov    $0x3,%eax
+     674:	89 e1                	mov    %esp,%ecx
+     676:	ba 7d 06 00 00       	mov    $0x67d,%edx
+     67b:	0f 34                	sysenter
+     67d:	c3                   	ret
+
+0000067e <pipe>:
+SYSCALL(pipe)
+     67e:	b8 04 00 00 00       	mov    $0x4,%eax
+     683:	89 e1                	mov    %esp,%ecx
+     685:	ba 8c 06 00 00       	mov    $0x68c,%edx
+     68a:	0f 34                	sysenter
+     68c:	c3                   	ret
+
+0000068d <read>:
+SYSCALL(read)
+     68d:	b8 05 00 00 00       	mov    $0x5,%eax
+     692:	89 e1                	mov    %esp,%ecx
+     694:	ba 9b 06 00 00       	mov    $0x69b,%edx
+     699:	0f 34                	sysenter
+     69b:	c3                   	ret
+
+0000069c <write>:
+SYSCALL(write)
+     69c:	b8 10 00 00 00       	mov    $0x10,%eax
+     6a1:	89 e1                	mov    %esp,%ecx
+     6a3:	ba aa 06 00 00       	mov    $0x6aa,%edx
+     6a8:	0f 34                	sysenter
+     6aa:	c3                   	ret
+
+000006ab <_close>:
+RAWSYSCALL(close)
+     6ab:	b8 15 00 00 00       	mov    $0x15,%eax
+     6b0:	89 e1                	mov    %esp,%ecx
+     6b2:	ba b9 06 00 00       	mov    $0x6b9,%edx
+     6b7:	0f 34                	sysenter
+     6b9:	c3                   	ret
+
+000006ba <kill>:
+SYSCALL(kill)
+     6ba:	b8 06 00 00 00       	mov    $0x6,%eax
+     6bf:	89 e1                	mov    %esp,%ecx
+     6c1:	ba c8 06 00 00       	mov    $0x6c8,%edx
+     6c6:	0f 34                	sysenter
+     6c8:	c3                   	ret
+
+000006c9 <_exec>:
+RAWSYSCALL(exec)
+     6c9:	b8 07 00 00 00       	mov    $0x7,%eax
+     6ce:	89 e1                	mov    %esp,%ecx
+     6d0:	ba d7 06 00 00       	mov    $0x6d7,%edx
+     6d5:	0f 34                	sysenter
+     6d7:	c3                   	ret
+
+000006d8 <open>:
+SYSCALL(open)
+     6d8:	b8 0f 00 00 00       	mov    $0xf,%eax
+     6dd:	89 e1                	mov    %esp,%ecx
+     6df:	ba e6 06 00 00       	mov    $0x6e6,%edx
+     6e4:	0f 34                	sysenter
+     6e6:	c3                   	ret
+
+000006e7 <mknod>:
+SYSCALL(mknod)
+     6e7:	b8 11 00 00 00       	mov    $0x11,%eax
+     6ec:	89 e1                	mov    %esp,%ecx
+     6ee:	ba f5 06 00 00       	mov    $0x6f5,%edx
+     6f3:	0f 34                	sysenter
+     6f5:	c3                   	ret
+
+000006f6 <unlink>:
+SYSCALL(unlink)
+     6f6:	b8 12 00 00 00       	mov    $0x12,%eax
+     6fb:	89 e1                	mov    %esp,%ecx
+     6fd:	ba 04 07 00 00       	mov    $0x704,%edx
+     702:	0f 34                	sysenter
+     704:	c3                   	ret
+
+00000705 <fstat>:
+SYSCALL(fstat)
+     705:	b8 08 00 00 00       	mov    $0x8,%eax
+     70a:	89 e1                	mov    %esp,%ecx
+     70c:	ba 13 07 00 00       	mov    $0x713,%edx
+     711:	0f 34                	sysenter
+     713:	c3                   	ret
+
+00000714 <link>:
+SYSCALL(link)
+     714:	b8 13 00 00 00       	mov    $0x13,%eax
+     719:	89 e1                	mov    %esp,%ecx
+     71b:	ba 22 07 00 00       	mov    $0x722,%edx
+     720:	0f 34                	sysenter
+     722:	c3                   	ret
+
+00000723 <mkdir>:
+SYSCALL(mkdir)
+     723:	b8 14 00 00 00       	mov    $0x14,%eax
+     728:	89 e1                	mov    %esp,%ecx
+     72a:	ba 31 07 00 00       	mov    $0x731,%edx
+     72f:	0f 34                	sysenter
+     731:	c3                   	ret
+
+00000732 <chdir>:
+SYSCALL(chdir)
+     732:	b8 09 00 00 00       	mov    $0x9,%eax
+     737:	89 e1                	mov    %esp,%ecx
+     739:	ba 40 07 00 00       	mov    $0x740,%edx
+     73e:	0f 34                	sysenter
+     740:	c3                   	ret
+
+00000741 <dup>:
+SYSCALL(dup)
+     741:	b8 0a 00 00 00       	mov    $0xa,%eax
+     746:	89 e1                	mov    %esp,%ecx
+     748:	ba 4f 07 00 00       	mov    $0x74f,%edx
+     74d:	0f 34                	sysenter
+     74f:	c3                   	ret
+
+00000750 <getpid>:
+SYSCALL(getpid)
+     750:	b8 0b 00 00 00       	mov    $0xb,%eax
+     755:	89 e1                	mov    %esp,%ecx
+     757:	ba 5e 07 00 00       	mov    $0x75e,%edx
+     75c:	0f 34                	sysenter
+     75e:	c3                   	ret
+
+0000075f <sbrk>:
+SYSCALL(sbrk)
+     75f:	b8 0c 00 00 00       	mov    $0xc,%eax
+     764:	89 e1                	mov    %esp,%ecx
+     766:	ba 6d 07 00 00       	mov    $0x76d,%edx
+     76b:	0f 34                	sysenter
+     76d:	c3                   	ret
+
+0000076e <sleep>:
+SYSCALL(sleep)
+     76e:	b8 0d 00 00 00       	mov    $0xd,%eax
+     773:	89 e1                	mov    %esp,%ecx
+     775:	ba 7c 07 00 00       	mov    $0x77c,%edx
+     77a:	0f 34                	sysenter
+     77c:	c3                   	ret
+
+0000077d <uptime>:
+SYSCALL(uptime)
+     77d:	b8 0e 00 00 00       	mov    $0xe,%eax
+     782:	89 e1                	mov    %esp,%ecx
+     784:	ba 8b 07 00 00       	mov    $0x78b,%edx
+     789:	0f 34                	sysenter
+     78b:	c3                   	ret
+
+0000078c <getproc>:
+SYSCALL(getproc)
+     78c:	b8 16 00 00 00       	mov    $0x16,%eax
+     791:	89 e1                	mov    %esp,%ecx
+     793:	ba 9a 07 00 00       	mov    $0x79a,%edx
+     798:	0f 34                	sysenter
+     79a:	c3                   	ret
+
+0000079b <getpgs>:
+SYSCALL(getpgs)
+     79b:	b8 17 00 00 00       	mov    $0x17,%eax
+     7a0:	89 e1                	mov    %esp,%ecx
+     7a2:	ba a9 07 00 00       	mov    $0x7a9,%edx
+     7a7:	0f 34                	sysenter
+     7a9:	c3                   	ret
+
+000007aa <loadproc>:
+SYSCALL(loadproc)
+     7aa:	b8 18 00 00 00       	mov    $0x18,%eax
+     7af:	89 e1                	mov    %esp,%ecx
+     7b1:	ba b8 07 00 00       	mov    $0x7b8,%edx
+     7b6:	0f 34                	sysenter
+     7b8:	c3                   	ret
+
+000007b9 <iosubmit>:
+SYSCALL(iosubmit)
+     7b9:	b8 19 00 00 00       	mov    $0x19,%eax
+     7be:	89 e1                	mov    %esp,%ecx
+     7c0:	ba c7 07 00 00       	mov    $0x7c7,%edx
+     7c5:	0f 34                	sysenter
+     7c7:	c3                   	ret
+
+000007c8 <sysstat>:
+SYSCALL(sysstat)
+     7c8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     7cd:	89 e1                	mov    %esp,%ecx
+     7cf:	ba d6 07 00 00       	mov    $0x7d6,%edx
+     7d4:	0f 34                	sysenter
+     7d6:	c3                   	ret
+
+000007d7 <splice>:
+SYSCALL(splice)
+     7d7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     7dc:	89 e1                	mov    %esp,%ecx
+     7de:	ba e5 07 00 00       	mov    $0x7e5,%edx
+     7e3:	0f 34                	sysenter
+     7e5:	c3                   	ret
+
+000007e6 <fsync>:
+SYSCALL(fsync)
+     7e6:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     7eb:	89 e1                	mov    %esp,%ecx
+     7ed:	ba f4 07 00 00       	mov    $0x7f4,%edx
+     7f2:	0f 34                	sysenter
+     7f4:	c3                   	ret
+
+000007f5 <fdatasync>:
+SYSCALL(fdatasync)
+     7f5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     7fa:	89 e1                	mov    %esp,%ecx
+     7fc:	ba 03 08 00 00       	mov    $0x803,%edx
+     801:	0f 34                	sysenter
+     803:	c3                   	ret
+
+00000804 <lseek>:
+SYSCALL(lseek)
+     804:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     809:	89 e1                	mov    %esp,%ecx
+     80b:	ba 12 08 00 00       	mov    $0x812,%edx
+     810:	0f 34                	sysenter
+     812:	c3                   	ret
+
+00000813 <dmesg>:
+SYSCALL(dmesg)
+     813:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     818:	89 e1                	mov    %esp,%ecx
+     81a:	ba 21 08 00 00       	mov    $0x821,%edx
+     81f:	0f 34                	sysenter
+     821:	c3                   	ret
+
+00000822 <lockstat>:
+SYSCALL(lockstat)
+     822:	b8 20 00 00 00       	mov    $0x20,%eax
+     827:	89 e1                	mov    %esp,%ecx
+     829:	ba 30 08 00 00       	mov    $0x830,%edx
+     82e:	0f 34                	sysenter
+     830:	c3                   	ret
+
+00000831 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     831:	55                   	push   %ebp
+     832:	89 e5                	mov    %esp,%ebp
+     834:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     837:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     83e:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     842:	74 17                	je     85b <printint+0x2a>
+     844:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     848:	79 11                	jns    85b <printint+0x2a>
+    neg = 1;
+     84a:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     851:	8b 45 0c             	mov    0xc(%ebp),%eax
+     854:	f7 d8                	neg    %eax
+     856:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     859:	eb 06                	jmp    861 <printint+0x30>
+  } else {
+    x = xx;
+     85b:	8b 45 0c             	mov    0xc(%ebp),%eax
+     85e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     861:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     868:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     86b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     86e:	ba 00 00 00 00       	mov    $0x0,%edx
+     873:	f7 f1                	div    %ecx
+     875:	89 d1                	mov    %edx,%ecx
+     877:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     87a:	8d 50 01             	lea    0x1(%eax),%edx
+     87d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     880:	0f b6 91 c8 18 00 00 	movzbl 0x18c8(%ecx),%edx
+     887:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     88b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     88e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     891:	ba 00 00 00 00       	mov    $0x0,%edx
+     896:	f7 f1                	div    %ecx
+     898:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     89b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     89f:	75 c7                	jne    868 <printint+0x37>
+  if(neg)
+     8a1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     8a5:	74 2d                	je     8d4 <printint+0xa3>
+    buf[i++] = '-';
+     8a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8aa:	8d 50 01             	lea    0x1(%eax),%edx
+     8ad:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     8b0:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+     8b5:	eb 1d                	jmp    8d4 <printint+0xa3>
+    fputc(fd, buf[i]);
+     8b7:	8d 55 dc             	lea    -0x24(%ebp),%edx
+     8ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8bd:	01 d0                	add    %edx,%eax
+     8bf:	0f b6 00             	movzbl (%eax),%eax
+     8c2:	0f be c0             	movsbl %al,%eax
+     8c5:	83 ec 08             	sub    $0x8,%esp
+     8c8:	50                   	push   %eax
+     8c9:	ff 75 08             	push   0x8(%ebp)
+     8cc:	e8 f8 08 00 00       	call   11c9 <fputc>
+     8d1:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+     8d4:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     8d8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     8dc:	79 d9                	jns    8b7 <printint+0x86>
+}
+     8de:	90                   	nop
+     8df:	90                   	nop
+     8e0:	c9                   	leave
+     8e1:	c3                   	ret
+
+000008e2 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     8e2:	55                   	push   %ebp
+     8e3:	89 e5                	mov    %esp,%ebp
+     8e5:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+     8e8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     8ef:	8d 45 0c             	lea    0xc(%ebp),%eax
+     8f2:	83 c0 04             	add    $0x4,%eax
+     8f5:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+     8f8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     8ff:	e9 4a 01 00 00       	jmp    a4e <printf+0x16c>
+    c = fmt[i] & 0xff;
+     904:	8b 55 0c             	mov    0xc(%ebp),%edx
+     907:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     90a:	01 d0                	add    %edx,%eax
+     90c:	0f b6 00             	movzbl (%eax),%eax
+     90f:	0f be c0             	movsbl %al,%eax
+     912:	25 ff 00 00 00       	and    $0xff,%eax
+     917:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+     91a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     91e:	75 28                	jne    948 <printf+0x66>
+      if(c == '%'){
+     920:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     924:	75 0c                	jne    932 <printf+0x50>
+        state = '%';
+     926:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+     92d:	e9 18 01 00 00       	jmp    a4a <printf+0x168>
+      } else {
+        fputc(fd, c);
+     932:	83 ec 08             	sub    $0x8,%esp
+     935:	ff 75 e4             	push   -0x1c(%ebp)
+     938:	ff 75 08             	push   0x8(%ebp)
+     93b:	e8 89 08 00 00       	call   11c9 <fputc>
+     940:	83 c4 10             	add    $0x10,%esp
+     943:	e9 02 01 00 00       	jmp    a4a <printf+0x168>
+      }
+    } else if(state == '%'){
+     948:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+     94c:	0f 85 f8 00 00 00    	jne    a4a <printf+0x168>
+      if(c == 'd'){
+     952:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+     956:	75 1e                	jne    976 <printf+0x94>
+        printint(fd, *ap, 10, 1);
+     958:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     95b:	8b 00                	mov    (%eax),%eax
+     95d:	6a 01                	push   $0x1
+     95f:	6a 0a                	push   $0xa
+     961:	50                   	push   %eax
+     962:	ff 75 08             	push   0x8(%ebp)
+     965:	e8 c7 fe ff ff       	call   831 <printint>
+     96a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     96d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     971:	e9 cd 00 00 00       	jmp    a43 <printf+0x161>
+      } else if(c == 'x' || c == 'p'){
+     976:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+     97a:	74 06                	je     982 <printf+0xa0>
+     97c:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+     980:	75 1e                	jne    9a0 <printf+0xbe>
+        printint(fd, *ap, 16, 0);
+     982:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     985:	8b 00                	mov    (%eax),%eax
+     987:	6a 00                	push   $0x0
+     989:	6a 10                	push   $0x10
+     98b:	50                   	push   %eax
+     98c:	ff 75 08             	push   0x8(%ebp)
+     98f:	e8 9d fe ff ff       	call   831 <printint>
+     994:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     997:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     99b:	e9 a3 00 00 00       	jmp    a43 <printf+0x161>
+      } else if(c == 's'){
+     9a0:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+     9a4:	75 43                	jne    9e9 <printf+0x107>
+        s = (char*)*ap;
+     9a6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     9a9:	8b 00                	mov    (%eax),%eax
+     9ab:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     9ae:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+     9b2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     9b6:	75 25                	jne    9dd <printf+0xfb>
+          s = "(null)";
+     9b8:	c7 45 f4 1d 14 00 00 	movl   $0x141d,-0xc(%ebp)
+        while(*s != 0){
+     9bf:	eb 1c                	jmp    9dd <printf+0xfb>
+          fputc(fd, *s);
+     9c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9c4:	0f b6 00             	movzbl (%eax),%eax
+     9c7:	0f be c0             	movsbl %al,%eax
+     9ca:	83 ec 08             	sub    $0x8,%esp
+     9cd:	50                   	push   %eax
+     9ce:	ff 75 08             	push   0x8(%ebp)
+     9d1:	e8 f3 07 00 00       	call   11c9 <fputc>
+     9d6:	83 c4 10             	add    $0x10,%esp
+          s++;
+     9d9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+     9dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9e0:	0f b6 00             	movzbl (%eax),%eax
+     9e3:	84 c0                	test   %al,%al
+     9e5:	75 da                	jne    9c1 <printf+0xdf>
+     9e7:	eb 5a                	jmp    a43 <printf+0x161>
+        }
+      } else if(c == 'c'){
+     9e9:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+     9ed:	75 1a                	jne    a09 <printf+0x127>
+        fputc(fd, *ap);
+     9ef:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     9f2:	8b 00                	mov    (%eax),%eax
+     9f4:	83 ec 08             	sub    $0x8,%esp
+     9f7:	50                   	push   %eax
+     9f8:	ff 75 08             	push   0x8(%ebp)
+     9fb:	e8 c9 07 00 00       	call   11c9 <fputc>
+     a00:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     a03:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     a07:	eb 3a                	jmp    a43 <printf+0x161>
+      } else if(c == '%'){
+     a09:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     a0d:	75 13                	jne    a22 <printf+0x140>
+        fputc(fd, c);
+     a0f:	83 ec 08             	sub    $0x8,%esp
+     a12:	ff 75 e4             	push   -0x1c(%ebp)
+     a15:	ff 75 08             	push   0x8(%ebp)
+     a18:	e8 ac 07 00 00       	call   11c9 <fputc>
+     a1d:	83 c4 10             	add    $0x10,%esp
+     a20:	eb 21                	jmp    a43 <printf+0x161>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        fputc(fd, '%');
+     a22:	83 ec 08             	sub    $0x8,%esp
+     a25:	6a 25                	push   $0x25
+     a27:	ff 75 08             	push   0x8(%ebp)
+     a2a:	e8 9a 07 00 00       	call   11c9 <fputc>
+     a2f:	83 c4 10             	add    $0x10,%esp
+        fputc(fd, c);
+     a32:	83 ec 08             	sub    $0x8,%esp
+     a35:	ff 75 e4             	push   -0x1c(%ebp)
+     a38:	ff 75 08             	push   0x8(%ebp)
+     a3b:	e8 89 07 00 00       	call   11c9 <fputc>
+     a40:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     a43:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     a4a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     a4e:	8b 55 0c             	mov    0xc(%ebp),%edx
+     a51:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a54:	01 d0                	add    %edx,%eax
+     a56:	0f b6 00             	movzbl (%eax),%eax
+     a59:	84 c0                	test   %al,%al
+     a5b:	0f 85 a3 fe ff ff    	jne    904 <printf+0x22>
+    }
+  }
+}
+     a61:	90                   	nop
+     a62:	90                   	nop
+     a63:	c9                   	leave
+     a64:	c3                   	ret
+
+00000a65 <binof>:
+static struct chunk *bins[NBIN];       // free large chunks
+static struct chunk *top;              // end marker of newest heap segment
+
+static int
+binof(uint size)
+{
+     a65:	55                   	push   %ebp
+     a66:	89 e5                	mov    %esp,%ebp
+     a68:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  i = 0;
+     a6b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     a72:	c1 6d 08 05          	shrl   $0x5,0x8(%ebp)
+     a76:	eb 07                	jmp    a7f <binof+0x1a>
+    i++;
+     a78:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     a7c:	d1 6d 08             	shrl   0x8(%ebp)
+     a7f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     a83:	74 06                	je     a8b <binof+0x26>
+     a85:	83 7d fc 19          	cmpl   $0x19,-0x4(%ebp)
+     a89:	7e ed                	jle    a78 <binof+0x13>
+  return i;
+     a8b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     a8e:	c9                   	leave
+     a8f:	c3                   	ret
+
+00000a90 <bininsert>:
+
+static void
+bininsert(struct chunk *c)
+{
+     a90:	55                   	push   %ebp
+     a91:	89 e5                	mov    %esp,%ebp
+     a93:	83 ec 10             	sub    $0x10,%esp
+  struct chunk **b;
+
+  b = &bins[binof(CSIZE(c))];
+     a96:	8b 45 08             	mov    0x8(%ebp),%eax
+     a99:	8b 00                	mov    (%eax),%eax
+     a9b:	83 e0 f8             	and    $0xfffffff8,%eax
+     a9e:	50                   	push   %eax
+     a9f:	e8 c1 ff ff ff       	call   a65 <binof>
+     aa4:	83 c4 04             	add    $0x4,%esp
+     aa7:	c1 e0 02             	shl    $0x2,%eax
+     aaa:	05 00 19 00 00       	add    $0x1900,%eax
+     aaf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c->prev = 0;
+     ab2:	8b 45 08             	mov    0x8(%ebp),%eax
+     ab5:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  c->next = *b;
+     abc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     abf:	8b 10                	mov    (%eax),%edx
+     ac1:	8b 45 08             	mov    0x8(%ebp),%eax
+     ac4:	89 50 08             	mov    %edx,0x8(%eax)
+  if(*b)
+     ac7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     aca:	8b 00                	mov    (%eax),%eax
+     acc:	85 c0                	test   %eax,%eax
+     ace:	74 0b                	je     adb <bininsert+0x4b>
+    (*b)->prev = c;
+     ad0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ad3:	8b 00                	mov    (%eax),%eax
+     ad5:	8b 55 08             	mov    0x8(%ebp),%edx
+     ad8:	89 50 0c             	mov    %edx,0xc(%eax)
+  *b = c;
+     adb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ade:	8b 55 08             	mov    0x8(%ebp),%edx
+     ae1:	89 10                	mov    %edx,(%eax)
+}
+     ae3:	90                   	nop
+     ae4:	c9                   	leave
+     ae5:	c3                   	ret
+
+00000ae6 <binremove>:
+
+static void
+binremove(struct chunk *c)
+{
+     ae6:	55                   	push   %ebp
+     ae7:	89 e5                	mov    %esp,%ebp
+  if(c->prev)
+     ae9:	8b 45 08             	mov    0x8(%ebp),%eax
+     aec:	8b 40 0c             	mov    0xc(%eax),%eax
+     aef:	85 c0                	test   %eax,%eax
+     af1:	74 11                	je     b04 <binremove+0x1e>
+    c->prev->next = c->next;
+     af3:	8b 45 08             	mov    0x8(%ebp),%eax
+     af6:	8b 40 0c             	mov    0xc(%eax),%eax
+     af9:	8b 55 08             	mov    0x8(%ebp),%edx
+     afc:	8b 52 08             	mov    0x8(%edx),%edx
+     aff:	89 50 08             	mov    %edx,0x8(%eax)
+     b02:	eb 1e                	jmp    b22 <binremove+0x3c>
+  else
+    bins[binof(CSIZE(c))] = c->next;
+     b04:	8b 45 08             	mov    0x8(%ebp),%eax
+     b07:	8b 00                	mov    (%eax),%eax
+     b09:	83 e0 f8             	and    $0xfffffff8,%eax
+     b0c:	50                   	push   %eax
+     b0d:	e8 53 ff ff ff       	call   a65 <binof>
+     b12:	83 c4 04             	add    $0x4,%esp
+     b15:	8b 55 08             	mov    0x8(%ebp),%edx
+     b18:	8b 52 08             	mov    0x8(%edx),%edx
+     b1b:	89 14 85 00 19 00 00 	mov    %edx,0x1900(,%eax,4)
+  if(c->next)
+     b22:	8b 45 08             	mov    0x8(%ebp),%eax
+     b25:	8b 40 08             	mov    0x8(%eax),%eax
+     b28:	85 c0                	test   %eax,%eax
+     b2a:	74 0f                	je     b3b <binremove+0x55>
+    c->next->prev = c->prev;
+     b2c:	8b 45 08             	mov    0x8(%ebp),%eax
+     b2f:	8b 40 08             	mov    0x8(%eax),%eax
+     b32:	8b 55 08             	mov    0x8(%ebp),%edx
+     b35:	8b 52 0c             	mov    0xc(%edx),%edx
+     b38:	89 50 0c             	mov    %edx,0xc(%eax)
+}
+     b3b:	90                   	nop
+     b3c:	c9                   	leave
+     b3d:	c3                   	ret
+
+00000b3e <freechunk>:
+
+// Free chunk c, merging it with free neighbors.  If trim is
+// set and the result is big and at the break, give it back.
+static void
+freechunk(struct chunk *c, int trim)
+{
+     b3e:	55                   	push   %ebp
+     b3f:	89 e5                	mov    %esp,%ebp
+     b41:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *p, *n;
+  uint size;
+
+  size = CSIZE(c);
+     b44:	8b 45 08             	mov    0x8(%ebp),%eax
+     b47:	8b 00                	mov    (%eax),%eax
+     b49:	83 e0 f8             	and    $0xfffffff8,%eax
+     b4c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  n = NEXTC(c);
+     b4f:	8b 45 08             	mov    0x8(%ebp),%eax
+     b52:	8b 00                	mov    (%eax),%eax
+     b54:	83 e0 f8             	and    $0xfffffff8,%eax
+     b57:	89 c2                	mov    %eax,%edx
+     b59:	8b 45 08             	mov    0x8(%ebp),%eax
+     b5c:	01 d0                	add    %edx,%eax
+     b5e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(!(c->size & PREVUSED)){
+     b61:	8b 45 08             	mov    0x8(%ebp),%eax
+     b64:	8b 00                	mov    (%eax),%eax
+     b66:	83 e0 02             	and    $0x2,%eax
+     b69:	85 c0                	test   %eax,%eax
+     b6b:	75 30                	jne    b9d <freechunk+0x5f>
+    p = (struct chunk*)((char*)c - *((uint*)c - 1));
+     b6d:	8b 45 08             	mov    0x8(%ebp),%eax
+     b70:	83 e8 04             	sub    $0x4,%eax
+     b73:	8b 00                	mov    (%eax),%eax
+     b75:	f7 d8                	neg    %eax
+     b77:	89 c2                	mov    %eax,%edx
+     b79:	8b 45 08             	mov    0x8(%ebp),%eax
+     b7c:	01 d0                	add    %edx,%eax
+     b7e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    binremove(p);
+     b81:	ff 75 ec             	push   -0x14(%ebp)
+     b84:	e8 5d ff ff ff       	call   ae6 <binremove>
+     b89:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(p);
+     b8c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b8f:	8b 00                	mov    (%eax),%eax
+     b91:	83 e0 f8             	and    $0xfffffff8,%eax
+     b94:	01 45 f4             	add    %eax,-0xc(%ebp)
+    c = p;
+     b97:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b9a:	89 45 08             	mov    %eax,0x8(%ebp)
+  }
+  if(!(n->size & USED)){
+     b9d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ba0:	8b 00                	mov    (%eax),%eax
+     ba2:	83 e0 01             	and    $0x1,%eax
+     ba5:	85 c0                	test   %eax,%eax
+     ba7:	75 16                	jne    bbf <freechunk+0x81>
+    binremove(n);
+     ba9:	ff 75 f0             	push   -0x10(%ebp)
+     bac:	e8 35 ff ff ff       	call   ae6 <binremove>
+     bb1:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(n);
+     bb4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bb7:	8b 00                	mov    (%eax),%eax
+     bb9:	83 e0 f8             	and    $0xfffffff8,%eax
+     bbc:	01 45 f4             	add    %eax,-0xc(%ebp)
+  }
+  // Free chunks are never adjacent, so the one below is in use.
+  c->size = size | PREVUSED;
+     bbf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     bc2:	83 c8 02             	or     $0x2,%eax
+     bc5:	89 c2                	mov    %eax,%edx
+     bc7:	8b 45 08             	mov    0x8(%ebp),%eax
+     bca:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+     bcc:	8b 45 08             	mov    0x8(%ebp),%eax
+     bcf:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  FOOTER(c) = size;
+     bd6:	8b 45 08             	mov    0x8(%ebp),%eax
+     bd9:	8b 00                	mov    (%eax),%eax
+     bdb:	83 e0 f8             	and    $0xfffffff8,%eax
+     bde:	8d 50 fc             	lea    -0x4(%eax),%edx
+     be1:	8b 45 08             	mov    0x8(%ebp),%eax
+     be4:	01 c2                	add    %eax,%edx
+     be6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     be9:	89 02                	mov    %eax,(%edx)
+  n = NEXTC(c);
+     beb:	8b 45 08             	mov    0x8(%ebp),%eax
+     bee:	8b 00                	mov    (%eax),%eax
+     bf0:	83 e0 f8             	and    $0xfffffff8,%eax
+     bf3:	89 c2                	mov    %eax,%edx
+     bf5:	8b 45 08             	mov    0x8(%ebp),%eax
+     bf8:	01 d0                	add    %edx,%eax
+     bfa:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  n->size &= ~PREVUSED;
+     bfd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c00:	8b 00                	mov    (%eax),%eax
+     c02:	83 e0 fd             	and    $0xfffffffd,%eax
+     c05:	89 c2                	mov    %eax,%edx
+     c07:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c0a:	89 10                	mov    %edx,(%eax)
+
+  if(trim && n == top && size >= TRIMSIZE && sbrk(0) == (char*)top + HDRSIZE){
+     c0c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     c10:	74 51                	je     c63 <freechunk+0x125>
+     c12:	a1 6c 19 00 00       	mov    0x196c,%eax
+     c17:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     c1a:	75 47                	jne    c63 <freechunk+0x125>
+     c1c:	81 7d f4 ff 7f 00 00 	cmpl   $0x7fff,-0xc(%ebp)
+     c23:	76 3e                	jbe    c63 <freechunk+0x125>
+     c25:	83 ec 0c             	sub    $0xc,%esp
+     c28:	6a 00                	push   $0x0
+     c2a:	e8 30 fb ff ff       	call   75f <sbrk>
+     c2f:	83 c4 10             	add    $0x10,%esp
+     c32:	8b 15 6c 19 00 00    	mov    0x196c,%edx
+     c38:	83 c2 08             	add    $0x8,%edx
+     c3b:	39 d0                	cmp    %edx,%eax
+     c3d:	75 24                	jne    c63 <freechunk+0x125>
+    c->size = USED | PREVUSED;
+     c3f:	8b 45 08             	mov    0x8(%ebp),%eax
+     c42:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+    top = c;
+     c48:	8b 45 08             	mov    0x8(%ebp),%eax
+     c4b:	a3 6c 19 00 00       	mov    %eax,0x196c
+    sbrk(-size);
+     c50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c53:	f7 d8                	neg    %eax
+     c55:	83 ec 0c             	sub    $0xc,%esp
+     c58:	50                   	push   %eax
+     c59:	e8 01 fb ff ff       	call   75f <sbrk>
+     c5e:	83 c4 10             	add    $0x10,%esp
+    return;
+     c61:	eb 0e                	jmp    c71 <freechunk+0x133>
+  }
+  bininsert(c);
+     c63:	83 ec 0c             	sub    $0xc,%esp
+     c66:	ff 75 08             	push   0x8(%ebp)
+     c69:	e8 22 fe ff ff       	call   a90 <bininsert>
+     c6e:	83 c4 10             	add    $0x10,%esp
+}
+     c71:	c9                   	leave
+     c72:	c3                   	ret
+
+00000c73 <morecore>:
+
+// Grow the heap by at least need bytes.
+static int
+morecore(uint need)
+{
+     c73:	55                   	push   %ebp
+     c74:	89 e5                	mov    %esp,%ebp
+     c76:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+  char *p;
+  uint n, pad;
+
+  n = need + MINCHUNK;
+     c79:	8b 45 08             	mov    0x8(%ebp),%eax
+     c7c:	83 c0 18             	add    $0x18,%eax
+     c7f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(n < MINCORE)
+     c82:	81 7d ec ff 3f 00 00 	cmpl   $0x3fff,-0x14(%ebp)
+     c89:	77 07                	ja     c92 <morecore+0x1f>
+    n = MINCORE;
+     c8b:	c7 45 ec 00 40 00 00 	movl   $0x4000,-0x14(%ebp)
+  // Keep the break 8-aligned, with the end marker just below it.
+  pad = (8 - ((uint)sbrk(0) & 7)) & 7;
+     c92:	83 ec 0c             	sub    $0xc,%esp
+     c95:	6a 00                	push   $0x0
+     c97:	e8 c3 fa ff ff       	call   75f <sbrk>
+     c9c:	83 c4 10             	add    $0x10,%esp
+     c9f:	83 e0 07             	and    $0x7,%eax
+     ca2:	ba 08 00 00 00       	mov    $0x8,%edx
+     ca7:	29 c2                	sub    %eax,%edx
+     ca9:	89 d0                	mov    %edx,%eax
+     cab:	83 e0 07             	and    $0x7,%eax
+     cae:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if((p = sbrk(pad + n)) == (char*)-1){
+     cb1:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     cb4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     cb7:	01 d0                	add    %edx,%eax
+     cb9:	83 ec 0c             	sub    $0xc,%esp
+     cbc:	50                   	push   %eax
+     cbd:	e8 9d fa ff ff       	call   75f <sbrk>
+     cc2:	83 c4 10             	add    $0x10,%esp
+     cc5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     cc8:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     ccc:	75 30                	jne    cfe <morecore+0x8b>
+    n = need + MINCHUNK;
+     cce:	8b 45 08             	mov    0x8(%ebp),%eax
+     cd1:	83 c0 18             	add    $0x18,%eax
+     cd4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((p = sbrk(pad + n)) == (char*)-1)
+     cd7:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     cda:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     cdd:	01 d0                	add    %edx,%eax
+     cdf:	83 ec 0c             	sub    $0xc,%esp
+     ce2:	50                   	push   %eax
+     ce3:	e8 77 fa ff ff       	call   75f <sbrk>
+     ce8:	83 c4 10             	add    $0x10,%esp
+     ceb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     cee:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     cf2:	75 0a                	jne    cfe <morecore+0x8b>
+      return -1;
+     cf4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     cf9:	e9 8e 00 00 00       	jmp    d8c <morecore+0x119>
+  }
+  p += pad;
+     cfe:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     d01:	01 45 f0             	add    %eax,-0x10(%ebp)
+  if(top && p == (char*)top + HDRSIZE){
+     d04:	a1 6c 19 00 00       	mov    0x196c,%eax
+     d09:	85 c0                	test   %eax,%eax
+     d0b:	74 29                	je     d36 <morecore+0xc3>
+     d0d:	a1 6c 19 00 00       	mov    0x196c,%eax
+     d12:	83 c0 08             	add    $0x8,%eax
+     d15:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     d18:	75 1c                	jne    d36 <morecore+0xc3>
+    // Contiguous: the old end marker heads the new chunk.
+    c = top;
+     d1a:	a1 6c 19 00 00       	mov    0x196c,%eax
+     d1f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = n | (c->size & PREVUSED);
+     d22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d25:	8b 00                	mov    (%eax),%eax
+     d27:	83 e0 02             	and    $0x2,%eax
+     d2a:	0b 45 ec             	or     -0x14(%ebp),%eax
+     d2d:	89 c2                	mov    %eax,%edx
+     d2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d32:	89 10                	mov    %edx,(%eax)
+     d34:	eb 16                	jmp    d4c <morecore+0xd9>
+  } else {
+    // Someone else moved the break: start a new segment.
+    c = (struct chunk*)p;
+     d36:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d39:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = (n - HDRSIZE) | PREVUSED;
+     d3c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     d3f:	83 e8 08             	sub    $0x8,%eax
+     d42:	83 c8 02             	or     $0x2,%eax
+     d45:	89 c2                	mov    %eax,%edx
+     d47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d4a:	89 10                	mov    %edx,(%eax)
+  }
+  top = NEXTC(c);
+     d4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d4f:	8b 00                	mov    (%eax),%eax
+     d51:	83 e0 f8             	and    $0xfffffff8,%eax
+     d54:	89 c2                	mov    %eax,%edx
+     d56:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d59:	01 d0                	add    %edx,%eax
+     d5b:	a3 6c 19 00 00       	mov    %eax,0x196c
+  top->size = USED;
+     d60:	a1 6c 19 00 00       	mov    0x196c,%eax
+     d65:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  top->tag = LARGE;
+     d6b:	a1 6c 19 00 00       	mov    0x196c,%eax
+     d70:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  freechunk(c, 0);
+     d77:	83 ec 08             	sub    $0x8,%esp
+     d7a:	6a 00                	push   $0x0
+     d7c:	ff 75 f4             	push   -0xc(%ebp)
+     d7f:	e8 ba fd ff ff       	call   b3e <freechunk>
+     d84:	83 c4 10             	add    $0x10,%esp
+  return 0;
+     d87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     d8c:	c9                   	leave
+     d8d:	c3                   	ret
+
+00000d8e <largealloc>:
+
+static void*
+largealloc(uint nbytes)
+{
+     d8e:	55                   	push   %ebp
+     d8f:	89 e5                	mov    %esp,%ebp
+     d91:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c, *r;
+  uint need;
+  int i;
+
+  if(nbytes > 0x7fffffff)
+     d94:	8b 45 08             	mov    0x8(%ebp),%eax
+     d97:	85 c0                	test   %eax,%eax
+     d99:	79 0a                	jns    da5 <largealloc+0x17>
+    return 0;
+     d9b:	b8 00 00 00 00       	mov    $0x0,%eax
+     da0:	e9 43 01 00 00       	jmp    ee8 <largealloc+0x15a>
+  need = (nbytes + HDRSIZE + 7) & ~7;
+     da5:	8b 45 08             	mov    0x8(%ebp),%eax
+     da8:	83 c0 0f             	add    $0xf,%eax
+     dab:	83 e0 f8             	and    $0xfffffff8,%eax
+     dae:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(need < MINCHUNK)
+     db1:	83 7d f0 17          	cmpl   $0x17,-0x10(%ebp)
+     db5:	77 07                	ja     dbe <largealloc+0x30>
+    need = MINCHUNK;
+     db7:	c7 45 f0 18 00 00 00 	movl   $0x18,-0x10(%ebp)
+  for(;;){
+    for(i = binof(need); i < NBIN; i++)
+     dbe:	ff 75 f0             	push   -0x10(%ebp)
+     dc1:	e8 9f fc ff ff       	call   a65 <binof>
+     dc6:	83 c4 04             	add    $0x4,%esp
+     dc9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     dcc:	eb 2f                	jmp    dfd <largealloc+0x6f>
+      for(c = bins[i]; c; c = c->next)
+     dce:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     dd1:	8b 04 85 00 19 00 00 	mov    0x1900(,%eax,4),%eax
+     dd8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     ddb:	eb 16                	jmp    df3 <largealloc+0x65>
+        if(CSIZE(c) >= need)
+     ddd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     de0:	8b 00                	mov    (%eax),%eax
+     de2:	83 e0 f8             	and    $0xfffffff8,%eax
+     de5:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     de8:	73 35                	jae    e1f <largealloc+0x91>
+      for(c = bins[i]; c; c = c->next)
+     dea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ded:	8b 40 08             	mov    0x8(%eax),%eax
+     df0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     df3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     df7:	75 e4                	jne    ddd <largealloc+0x4f>
+    for(i = binof(need); i < NBIN; i++)
+     df9:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     dfd:	83 7d ec 1a          	cmpl   $0x1a,-0x14(%ebp)
+     e01:	7e cb                	jle    dce <largealloc+0x40>
+          goto found;
+    if(morecore(need) < 0)
+     e03:	83 ec 0c             	sub    $0xc,%esp
+     e06:	ff 75 f0             	push   -0x10(%ebp)
+     e09:	e8 65 fe ff ff       	call   c73 <morecore>
+     e0e:	83 c4 10             	add    $0x10,%esp
+     e11:	85 c0                	test   %eax,%eax
+     e13:	79 a9                	jns    dbe <largealloc+0x30>
+      return 0;
+     e15:	b8 00 00 00 00       	mov    $0x0,%eax
+     e1a:	e9 c9 00 00 00       	jmp    ee8 <largealloc+0x15a>
+          goto found;
+     e1f:	90                   	nop
+  }
+
+found:
+  binremove(c);
+     e20:	83 ec 0c             	sub    $0xc,%esp
+     e23:	ff 75 f4             	push   -0xc(%ebp)
+     e26:	e8 bb fc ff ff       	call   ae6 <binremove>
+     e2b:	83 c4 10             	add    $0x10,%esp
+  if(CSIZE(c) - need >= MINCHUNK){
+     e2e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e31:	8b 00                	mov    (%eax),%eax
+     e33:	83 e0 f8             	and    $0xfffffff8,%eax
+     e36:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     e39:	83 f8 17             	cmp    $0x17,%eax
+     e3c:	76 66                	jbe    ea4 <largealloc+0x116>
+    r = (struct chunk*)((char*)c + need);
+     e3e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     e41:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e44:	01 d0                	add    %edx,%eax
+     e46:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    r->size = (CSIZE(c) - need) | PREVUSED;
+     e49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e4c:	8b 00                	mov    (%eax),%eax
+     e4e:	83 e0 f8             	and    $0xfffffff8,%eax
+     e51:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     e54:	83 c8 02             	or     $0x2,%eax
+     e57:	89 c2                	mov    %eax,%edx
+     e59:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e5c:	89 10                	mov    %edx,(%eax)
+    r->tag = LARGE;
+     e5e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e61:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+    FOOTER(r) = CSIZE(r);
+     e68:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e6b:	8b 10                	mov    (%eax),%edx
+     e6d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e70:	8b 00                	mov    (%eax),%eax
+     e72:	83 e0 f8             	and    $0xfffffff8,%eax
+     e75:	8d 48 fc             	lea    -0x4(%eax),%ecx
+     e78:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e7b:	01 c8                	add    %ecx,%eax
+     e7d:	83 e2 f8             	and    $0xfffffff8,%edx
+     e80:	89 10                	mov    %edx,(%eax)
+    bininsert(r);
+     e82:	83 ec 0c             	sub    $0xc,%esp
+     e85:	ff 75 e8             	push   -0x18(%ebp)
+     e88:	e8 03 fc ff ff       	call   a90 <bininsert>
+     e8d:	83 c4 10             	add    $0x10,%esp
+    c->size = need | (c->size & PREVUSED);
+     e90:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e93:	8b 00                	mov    (%eax),%eax
+     e95:	83 e0 02             	and    $0x2,%eax
+     e98:	0b 45 f0             	or     -0x10(%ebp),%eax
+     e9b:	89 c2                	mov    %eax,%edx
+     e9d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ea0:	89 10                	mov    %edx,(%eax)
+     ea2:	eb 25                	jmp    ec9 <largealloc+0x13b>
+  } else
+    NEXTC(c)->size |= PREVUSED;
+     ea4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ea7:	8b 00                	mov    (%eax),%eax
+     ea9:	83 e0 f8             	and    $0xfffffff8,%eax
+     eac:	89 c2                	mov    %eax,%edx
+     eae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eb1:	01 d0                	add    %edx,%eax
+     eb3:	8b 10                	mov    (%eax),%edx
+     eb5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eb8:	8b 00                	mov    (%eax),%eax
+     eba:	83 e0 f8             	and    $0xfffffff8,%eax
+     ebd:	89 c1                	mov    %eax,%ecx
+     ebf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ec2:	01 c8                	add    %ecx,%eax
+     ec4:	83 ca 02             	or     $0x2,%edx
+     ec7:	89 10                	mov    %edx,(%eax)
+  c->size |= USED;
+     ec9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ecc:	8b 00                	mov    (%eax),%eax
+     ece:	83 c8 01             	or     $0x1,%eax
+     ed1:	89 c2                	mov    %eax,%edx
+     ed3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ed6:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+     ed8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     edb:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  return (char*)c + HDRSIZE;
+     ee2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ee5:	83 c0 08             	add    $0x8,%eax
+}
+     ee8:	c9                   	leave
+     ee9:	c3                   	ret
+
+00000eea <refill>:
+
+// Carve a slab into free blocks of class k.
+static int
+refill(int k)
+{
+     eea:	55                   	push   %ebp
+     eeb:	89 e5                	mov    %esp,%ebp
+     eed:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  char *p;
+  uint bs, i;
+
+  if((p = largealloc(SLABSIZE)) == 0)
+     ef0:	83 ec 0c             	sub    $0xc,%esp
+     ef3:	68 00 20 00 00       	push   $0x2000
+     ef8:	e8 91 fe ff ff       	call   d8e <largealloc>
+     efd:	83 c4 10             	add    $0x10,%esp
+     f00:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f03:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     f07:	75 07                	jne    f10 <refill+0x26>
+    return -1;
+     f09:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     f0e:	eb 75                	jmp    f85 <refill+0x9b>
+  bs = HDRSIZE + (MINSMALL << k);
+     f10:	8b 45 08             	mov    0x8(%ebp),%eax
+     f13:	ba 10 00 00 00       	mov    $0x10,%edx
+     f18:	89 c1                	mov    %eax,%ecx
+     f1a:	d3 e2                	shl    %cl,%edx
+     f1c:	89 d0                	mov    %edx,%eax
+     f1e:	83 c0 08             	add    $0x8,%eax
+     f21:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+     f24:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     f2b:	eb 44                	jmp    f71 <refill+0x87>
+    b = (struct chunk*)(p + i);
+     f2d:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     f30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f33:	01 d0                	add    %edx,%eax
+     f35:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    b->size = bs | USED;
+     f38:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f3b:	83 c8 01             	or     $0x1,%eax
+     f3e:	89 c2                	mov    %eax,%edx
+     f40:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f43:	89 10                	mov    %edx,(%eax)
+    b->tag = k;
+     f45:	8b 55 08             	mov    0x8(%ebp),%edx
+     f48:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f4b:	89 50 04             	mov    %edx,0x4(%eax)
+    b->next = classes[k];
+     f4e:	8b 45 08             	mov    0x8(%ebp),%eax
+     f51:	8b 14 85 e0 18 00 00 	mov    0x18e0(,%eax,4),%edx
+     f58:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f5b:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[k] = b;
+     f5e:	8b 45 08             	mov    0x8(%ebp),%eax
+     f61:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     f64:	89 14 85 e0 18 00 00 	mov    %edx,0x18e0(,%eax,4)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+     f6b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f6e:	01 45 f4             	add    %eax,-0xc(%ebp)
+     f71:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     f74:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f77:	01 d0                	add    %edx,%eax
+     f79:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     f7e:	76 ad                	jbe    f2d <refill+0x43>
+  }
+  return 0;
+     f80:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     f85:	c9                   	leave
+     f86:	c3                   	ret
+
+00000f87 <free>:
+
+void
+free(void *ap)
+{
+     f87:	55                   	push   %ebp
+     f88:	89 e5                	mov    %esp,%ebp
+     f8a:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+
+  if(ap == 0)
+     f8d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     f91:	74 4b                	je     fde <free+0x57>
+    return;
+  c = (struct chunk*)((char*)ap - HDRSIZE);
+     f93:	8b 45 08             	mov    0x8(%ebp),%eax
+     f96:	83 e8 08             	sub    $0x8,%eax
+     f99:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(c->tag != LARGE){
+     f9c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f9f:	8b 40 04             	mov    0x4(%eax),%eax
+     fa2:	83 f8 ff             	cmp    $0xffffffff,%eax
+     fa5:	74 25                	je     fcc <free+0x45>
+    c->next = classes[c->tag];
+     fa7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     faa:	8b 40 04             	mov    0x4(%eax),%eax
+     fad:	8b 14 85 e0 18 00 00 	mov    0x18e0(,%eax,4),%edx
+     fb4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fb7:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[c->tag] = c;
+     fba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fbd:	8b 40 04             	mov    0x4(%eax),%eax
+     fc0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     fc3:	89 14 85 e0 18 00 00 	mov    %edx,0x18e0(,%eax,4)
+    return;
+     fca:	eb 13                	jmp    fdf <free+0x58>
+  }
+  freechunk(c, 1);
+     fcc:	83 ec 08             	sub    $0x8,%esp
+     fcf:	6a 01                	push   $0x1
+     fd1:	ff 75 f4             	push   -0xc(%ebp)
+     fd4:	e8 65 fb ff ff       	call   b3e <freechunk>
+     fd9:	83 c4 10             	add    $0x10,%esp
+     fdc:	eb 01                	jmp    fdf <free+0x58>
+    return;
+     fde:	90                   	nop
+}
+     fdf:	c9                   	leave
+     fe0:	c3                   	ret
+
+00000fe1 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     fe1:	55                   	push   %ebp
+     fe2:	89 e5                	mov    %esp,%ebp
+     fe4:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  int k;
+
+  if(nbytes > MAXSMALL)
+     fe7:	81 7d 08 00 08 00 00 	cmpl   $0x800,0x8(%ebp)
+     fee:	76 10                	jbe    1000 <malloc+0x1f>
+    return largealloc(nbytes);
+     ff0:	83 ec 0c             	sub    $0xc,%esp
+     ff3:	ff 75 08             	push   0x8(%ebp)
+     ff6:	e8 93 fd ff ff       	call   d8e <largealloc>
+     ffb:	83 c4 10             	add    $0x10,%esp
+     ffe:	eb 6a                	jmp    106a <malloc+0x89>
+  for(k = 0; (MINSMALL << k) < nbytes; k++)
+    1000:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1007:	eb 04                	jmp    100d <malloc+0x2c>
+    1009:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    100d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1010:	ba 10 00 00 00       	mov    $0x10,%edx
+    1015:	89 c1                	mov    %eax,%ecx
+    1017:	d3 e2                	shl    %cl,%edx
+    1019:	89 d0                	mov    %edx,%eax
+    101b:	3b 45 08             	cmp    0x8(%ebp),%eax
+    101e:	72 e9                	jb     1009 <malloc+0x28>
+    ;
+  if(classes[k] == 0 && refill(k) < 0)
+    1020:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1023:	8b 04 85 e0 18 00 00 	mov    0x18e0(,%eax,4),%eax
+    102a:	85 c0                	test   %eax,%eax
+    102c:	75 19                	jne    1047 <malloc+0x66>
+    102e:	83 ec 0c             	sub    $0xc,%esp
+    1031:	ff 75 f4             	push   -0xc(%ebp)
+    1034:	e8 b1 fe ff ff       	call   eea <refill>
+    1039:	83 c4 10             	add    $0x10,%esp
+    103c:	85 c0                	test   %eax,%eax
+    103e:	79 07                	jns    1047 <malloc+0x66>
+    return 0;
+    1040:	b8 00 00 00 00       	mov    $0x0,%eax
+    1045:	eb 23                	jmp    106a <malloc+0x89>
+  b = classes[k];
+    1047:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    104a:	8b 04 85 e0 18 00 00 	mov    0x18e0(,%eax,4),%eax
+    1051:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  classes[k] = b->next;
+    1054:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1057:	8b 50 08             	mov    0x8(%eax),%edx
+    105a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    105d:	89 14 85 e0 18 00 00 	mov    %edx,0x18e0(,%eax,4)
+  return (char*)b + HDRSIZE;
+    1064:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1067:	83 c0 08             	add    $0x8,%eax
+}
+    106a:	c9                   	leave
+    106b:	c3                   	ret
+
+0000106c <stream>:
+
+// Return the stream for fd, deciding on first use how
+// its output is buffered.  Returns 0 if fd is not open.
+static struct stream*
+stream(int fd)
+{
+    106c:	55                   	push   %ebp
+    106d:	89 e5                	mov    %esp,%ebp
+    106f:	83 ec 28             	sub    $0x28,%esp
+  struct stream *s;
+  struct stat st;
+
+  if(fd < 0 || fd >= NOFILE)
+    1072:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1076:	78 06                	js     107e <stream+0x12>
+    1078:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    107c:	7e 07                	jle    1085 <stream+0x19>
+    return 0;
+    107e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1083:	eb 55                	jmp    10da <stream+0x6e>
+  s = &streams[fd];
+    1085:	8b 45 08             	mov    0x8(%ebp),%eax
+    1088:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    108e:	05 80 19 00 00       	add    $0x1980,%eax
+    1093:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(s->mode == UNKNOWN){
+    1096:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1099:	8b 00                	mov    (%eax),%eax
+    109b:	85 c0                	test   %eax,%eax
+    109d:	75 38                	jne    10d7 <stream+0x6b>
+    if(fstat(fd, &st) < 0)
+    109f:	83 ec 08             	sub    $0x8,%esp
+    10a2:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    10a5:	50                   	push   %eax
+    10a6:	ff 75 08             	push   0x8(%ebp)
+    10a9:	e8 57 f6 ff ff       	call   705 <fstat>
+    10ae:	83 c4 10             	add    $0x10,%esp
+    10b1:	85 c0                	test   %eax,%eax
+    10b3:	79 07                	jns    10bc <stream+0x50>
+      return 0;
+    10b5:	b8 00 00 00 00       	mov    $0x0,%eax
+    10ba:	eb 1e                	jmp    10da <stream+0x6e>
+    s->mode = st.type == T_DEV ? LINEBUF : FULLBUF;
+    10bc:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+    10c0:	66 83 f8 03          	cmp    $0x3,%ax
+    10c4:	75 07                	jne    10cd <stream+0x61>
+    10c6:	ba 01 00 00 00       	mov    $0x1,%edx
+    10cb:	eb 05                	jmp    10d2 <stream+0x66>
+    10cd:	ba 02 00 00 00       	mov    $0x2,%edx
+    10d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10d5:	89 10                	mov    %edx,(%eax)
+  }
+  return s;
+    10d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    10da:	c9                   	leave
+    10db:	c3                   	ret
+
+000010dc <fflush>:
+
+int
+fflush(int fd)
+{
+    10dc:	55                   	push   %ebp
+    10dd:	89 e5                	mov    %esp,%ebp
+    10df:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  int i, n;
+
+  if(fd < 0 || fd >= NOFILE)
+    10e2:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    10e6:	78 06                	js     10ee <fflush+0x12>
+    10e8:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    10ec:	7e 07                	jle    10f5 <fflush+0x19>
+    return -1;
+    10ee:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    10f3:	eb 78                	jmp    116d <fflush+0x91>
+  s = &streams[fd];
+    10f5:	8b 45 08             	mov    0x8(%ebp),%eax
+    10f8:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    10fe:	05 80 19 00 00       	add    $0x1980,%eax
+    1103:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < s->nout; i += n){
+    1106:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    110d:	eb 44                	jmp    1153 <fflush+0x77>
+    if((n = write(fd, s->out + i, s->nout - i)) <= 0){
+    110f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1112:	8b 40 04             	mov    0x4(%eax),%eax
+    1115:	2b 45 f4             	sub    -0xc(%ebp),%eax
+    1118:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    111b:	8d 4a 10             	lea    0x10(%edx),%ecx
+    111e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1121:	01 ca                	add    %ecx,%edx
+    1123:	83 ec 04             	sub    $0x4,%esp
+    1126:	50                   	push   %eax
+    1127:	52                   	push   %edx
+    1128:	ff 75 08             	push   0x8(%ebp)
+    112b:	e8 6c f5 ff ff       	call   69c <write>
+    1130:	83 c4 10             	add    $0x10,%esp
+    1133:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1136:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    113a:	7f 11                	jg     114d <fflush+0x71>
+      s->nout = 0;
+    113c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    113f:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+      return -1;
+    1146:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    114b:	eb 20                	jmp    116d <fflush+0x91>
+  for(i = 0; i < s->nout; i += n){
+    114d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1150:	01 45 f4             	add    %eax,-0xc(%ebp)
+    1153:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1156:	8b 40 04             	mov    0x4(%eax),%eax
+    1159:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    115c:	7c b1                	jl     110f <fflush+0x33>
+    }
+  }
+  s->nout = 0;
+    115e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1161:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  return 0;
+    1168:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    116d:	c9                   	leave
+    116e:	c3                   	ret
+
+0000116f <flushall>:
+
+// Flush every stream, or only line-buffered ones.
+static void
+flushall(int lineonly)
+{
+    116f:	55                   	push   %ebp
+    1170:	89 e5                	mov    %esp,%ebp
+    1172:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+    1175:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    117c:	eb 41                	jmp    11bf <flushall+0x50>
+    if(streams[fd].nout > 0 && (!lineonly || streams[fd].mode == LINEBUF))
+    117e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1181:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1187:	05 84 19 00 00       	add    $0x1984,%eax
+    118c:	8b 00                	mov    (%eax),%eax
+    118e:	85 c0                	test   %eax,%eax
+    1190:	7e 29                	jle    11bb <flushall+0x4c>
+    1192:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1196:	74 15                	je     11ad <flushall+0x3e>
+    1198:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    119b:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    11a1:	05 80 19 00 00       	add    $0x1980,%eax
+    11a6:	8b 00                	mov    (%eax),%eax
+    11a8:	83 f8 01             	cmp    $0x1,%eax
+    11ab:	75 0e                	jne    11bb <flushall+0x4c>
+      fflush(fd);
+    11ad:	83 ec 0c             	sub    $0xc,%esp
+    11b0:	ff 75 f4             	push   -0xc(%ebp)
+    11b3:	e8 24 ff ff ff       	call   10dc <fflush>
+    11b8:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++)
+    11bb:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    11bf:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+    11c3:	7e b9                	jle    117e <flushall+0xf>
+}
+    11c5:	90                   	nop
+    11c6:	90                   	nop
+    11c7:	c9                   	leave
+    11c8:	c3                   	ret
+
+000011c9 <fputc>:
+
+int
+fputc(int fd, int c)
+{
+    11c9:	55                   	push   %ebp
+    11ca:	89 e5                	mov    %esp,%ebp
+    11cc:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  char ch;
+
+  if((s = stream(fd)) == 0){
+    11cf:	83 ec 0c             	sub    $0xc,%esp
+    11d2:	ff 75 08             	push   0x8(%ebp)
+    11d5:	e8 92 fe ff ff       	call   106c <stream>
+    11da:	83 c4 10             	add    $0x10,%esp
+    11dd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    11e0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    11e4:	75 2e                	jne    1214 <fputc+0x4b>
+    ch = c;
+    11e6:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11e9:	88 45 f3             	mov    %al,-0xd(%ebp)
+    return write(fd, &ch, 1) == 1 ? (uchar)c : -1;
+    11ec:	83 ec 04             	sub    $0x4,%esp
+    11ef:	6a 01                	push   $0x1
+    11f1:	8d 45 f3             	lea    -0xd(%ebp),%eax
+    11f4:	50                   	push   %eax
+    11f5:	ff 75 08             	push   0x8(%ebp)
+    11f8:	e8 9f f4 ff ff       	call   69c <write>
+    11fd:	83 c4 10             	add    $0x10,%esp
+    1200:	83 f8 01             	cmp    $0x1,%eax
+    1203:	75 08                	jne    120d <fputc+0x44>
+    1205:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1208:	0f b6 c0             	movzbl %al,%eax
+    120b:	eb 5e                	jmp    126b <fputc+0xa2>
+    120d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1212:	eb 57                	jmp    126b <fputc+0xa2>
+  }
+  s->out[s->nout++] = c;
+    1214:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1217:	8b 40 04             	mov    0x4(%eax),%eax
+    121a:	8d 48 01             	lea    0x1(%eax),%ecx
+    121d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1220:	89 4a 04             	mov    %ecx,0x4(%edx)
+    1223:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1226:	89 d1                	mov    %edx,%ecx
+    1228:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    122b:	88 4c 02 10          	mov    %cl,0x10(%edx,%eax,1)
+  if(s->nout == BUFSZ || (s->mode == LINEBUF && c == '\n'))
+    122f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1232:	8b 40 04             	mov    0x4(%eax),%eax
+    1235:	3d 00 02 00 00       	cmp    $0x200,%eax
+    123a:	74 10                	je     124c <fputc+0x83>
+    123c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    123f:	8b 00                	mov    (%eax),%eax
+    1241:	83 f8 01             	cmp    $0x1,%eax
+    1244:	75 1f                	jne    1265 <fputc+0x9c>
+    1246:	83 7d 0c 0a          	cmpl   $0xa,0xc(%ebp)
+    124a:	75 19                	jne    1265 <fputc+0x9c>
+    if(fflush(fd) < 0)
+    124c:	83 ec 0c             	sub    $0xc,%esp
+    124f:	ff 75 08             	push   0x8(%ebp)
+    1252:	e8 85 fe ff ff       	call   10dc <fflush>
+    1257:	83 c4 10             	add    $0x10,%esp
+    125a:	85 c0                	test   %eax,%eax
+    125c:	79 07                	jns    1265 <fputc+0x9c>
+      return -1;
+    125e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1263:	eb 06                	jmp    126b <fputc+0xa2>
+  return (uchar)c;
+    1265:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1268:	0f b6 c0             	movzbl %al,%eax
+}
+    126b:	c9                   	leave
+    126c:	c3                   	ret
+
+0000126d <fgetc>:
+
+// Return the next byte read from fd, or -1 at end of file.
+int
+fgetc(int fd)
+{
+    126d:	55                   	push   %ebp
+    126e:	89 e5                	mov    %esp,%ebp
+    1270:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  uchar c;
+  int n;
+
+  if((s = stream(fd)) == 0){
+    1273:	83 ec 0c             	sub    $0xc,%esp
+    1276:	ff 75 08             	push   0x8(%ebp)
+    1279:	e8 ee fd ff ff       	call   106c <stream>
+    127e:	83 c4 10             	add    $0x10,%esp
+    1281:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1284:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1288:	75 39                	jne    12c3 <fgetc+0x56>
+    flushall(1);
+    128a:	83 ec 0c             	sub    $0xc,%esp
+    128d:	6a 01                	push   $0x1
+    128f:	e8 db fe ff ff       	call   116f <flushall>
+    1294:	83 c4 10             	add    $0x10,%esp
+    return read(fd, &c, 1) == 1 ? c : -1;
+    1297:	83 ec 04             	sub    $0x4,%esp
+    129a:	6a 01                	push   $0x1
+    129c:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    129f:	50                   	push   %eax
+    12a0:	ff 75 08             	push   0x8(%ebp)
+    12a3:	e8 e5 f3 ff ff       	call   68d <read>
+    12a8:	83 c4 10             	add    $0x10,%esp
+    12ab:	83 f8 01             	cmp    $0x1,%eax
+    12ae:	75 0c                	jne    12bc <fgetc+0x4f>
+    12b0:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    12b4:	0f b6 c0             	movzbl %al,%eax
+    12b7:	e9 80 00 00 00       	jmp    133c <fgetc+0xcf>
+    12bc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12c1:	eb 79                	jmp    133c <fgetc+0xcf>
+  }
+  if(s->rpos == s->rend){
+    12c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12c6:	8b 50 08             	mov    0x8(%eax),%edx
+    12c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12cc:	8b 40 0c             	mov    0xc(%eax),%eax
+    12cf:	39 c2                	cmp    %eax,%edx
+    12d1:	75 4c                	jne    131f <fgetc+0xb2>
+    flushall(1);
+    12d3:	83 ec 0c             	sub    $0xc,%esp
+    12d6:	6a 01                	push   $0x1
+    12d8:	e8 92 fe ff ff       	call   116f <flushall>
+    12dd:	83 c4 10             	add    $0x10,%esp
+    if((n = read(fd, s->in, BUFSZ)) <= 0)
+    12e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12e3:	05 10 02 00 00       	add    $0x210,%eax
+    12e8:	83 ec 04             	sub    $0x4,%esp
+    12eb:	68 00 02 00 00       	push   $0x200
+    12f0:	50                   	push   %eax
+    12f1:	ff 75 08             	push   0x8(%ebp)
+    12f4:	e8 94 f3 ff ff       	call   68d <read>
+    12f9:	83 c4 10             	add    $0x10,%esp
+    12fc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    12ff:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1303:	7f 07                	jg     130c <fgetc+0x9f>
+      return -1;
+    1305:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    130a:	eb 30                	jmp    133c <fgetc+0xcf>
+    s->rpos = 0;
+    130c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    130f:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+    s->rend = n;
+    1316:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1319:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    131c:	89 50 0c             	mov    %edx,0xc(%eax)
+  }
+  return (uchar)s->in[s->rpos++];
+    131f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1322:	8b 40 08             	mov    0x8(%eax),%eax
+    1325:	8d 48 01             	lea    0x1(%eax),%ecx
+    1328:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    132b:	89 4a 08             	mov    %ecx,0x8(%edx)
+    132e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1331:	0f b6 84 02 10 02 00 	movzbl 0x210(%edx,%eax,1),%eax
+    1338:	00 
+    1339:	0f b6 c0             	movzbl %al,%eax
+}
+    133c:	c9                   	leave
+    133d:	c3                   	ret
+
+0000133e <fork>:
+
+int
+fork(void)
+{
+    133e:	55                   	push   %ebp
+    133f:	89 e5                	mov    %esp,%ebp
+    1341:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1344:	83 ec 0c             	sub    $0xc,%esp
+    1347:	6a 00                	push   $0x0
+    1349:	e8 21 fe ff ff       	call   116f <flushall>
+    134e:	83 c4 10             	add    $0x10,%esp
+  return _fork();
+    1351:	e8 fb f2 ff ff       	call   651 <_fork>
+}
+    1356:	c9                   	leave
+    1357:	c3                   	ret
+
+00001358 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+    1358:	55                   	push   %ebp
+    1359:	89 e5                	mov    %esp,%ebp
+    135b:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    135e:	83 ec 0c             	sub    $0xc,%esp
+    1361:	6a 00                	push   $0x0
+    1363:	e8 07 fe ff ff       	call   116f <flushall>
+    1368:	83 c4 10             	add    $0x10,%esp
+  return _exec(path, argv);
+    136b:	83 ec 08             	sub    $0x8,%esp
+    136e:	ff 75 0c             	push   0xc(%ebp)
+    1371:	ff 75 08             	push   0x8(%ebp)
+    1374:	e8 50 f3 ff ff       	call   6c9 <_exec>
+    1379:	83 c4 10             	add    $0x10,%esp
+}
+    137c:	c9                   	leave
+    137d:	c3                   	ret
+
+0000137e <exit>:
+
+int
+exit(void)
+{
+    137e:	55                   	push   %ebp
+    137f:	89 e5                	mov    %esp,%ebp
+    1381:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1384:	83 ec 0c             	sub    $0xc,%esp
+    1387:	6a 00                	push   $0x0
+    1389:	e8 e1 fd ff ff       	call   116f <flushall>
+    138e:	83 c4 10             	add    $0x10,%esp
+  _exit();
+    1391:	e8 ca f2 ff ff       	call   660 <_exit>
+
+00001396 <close>:
+}
+
+int
+close(int fd)
+{
+    1396:	55                   	push   %ebp
+    1397:	89 e5                	mov    %esp,%ebp
+    1399:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+
+  if(fd >= 0 && fd < NOFILE){
+    139c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    13a0:	78 44                	js     13e6 <close+0x50>
+    13a2:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    13a6:	7f 3e                	jg     13e6 <close+0x50>
+    fflush(fd);
+    13a8:	83 ec 0c             	sub    $0xc,%esp
+    13ab:	ff 75 08             	push   0x8(%ebp)
+    13ae:	e8 29 fd ff ff       	call   10dc <fflush>
+    13b3:	83 c4 10             	add    $0x10,%esp
+    s = &streams[fd];
+    13b6:	8b 45 08             	mov    0x8(%ebp),%eax
+    13b9:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    13bf:	05 80 19 00 00       	add    $0x1980,%eax
+    13c4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    s->mode = UNKNOWN;
+    13c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13ca:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    s->rpos = s->rend = 0;
+    13d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13d3:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    13da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13dd:	8b 50 0c             	mov    0xc(%eax),%edx
+    13e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13e3:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  return _close(fd);
+    13e6:	83 ec 0c             	sub    $0xc,%esp
+    13e9:	ff 75 08             	push   0x8(%ebp)
+    13ec:	e8 ba f2 ff ff       	call   6ab <_close>
+    13f1:	83 c4 10             	add    $0x10,%esp
+}
+    13f4:	c9                   	leave
+    13f5:	c3                   	ret
@@ -0,0 +1,3387 @@
+
+_load:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <load>:
+
+int stdout = 1;
+int stderr = 2;
+
+void load(char* name, void* ptr, int size)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 18             	sub    $0x18,%esp
+    printf(stdout, "loading...\n");
+       6:	a1 04 25 00 00       	mov    0x2504,%eax
+       b:	83 ec 08             	sub    $0x8,%esp
+       e:	68 60 1c 00 00       	push   $0x1c60
+      13:	50                   	push   %eax
+      14:	e8 32 11 00 00       	call   114b <printf>
+      19:	83 c4 10             	add    $0x10,%esp
+
+    int fd = open(name, O_RDONLY);
+      1c:	83 ec 08             	sub    $0x8,%esp
+      1f:	6a 00                	push   $0x0
+      21:	ff 75 08             	push   0x8(%ebp)
+      24:	e8 18 0f 00 00       	call   f41 <open>
+      29:	83 c4 10             	add    $0x10,%esp
+      2c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd >= 0)
+      2f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+      33:	78 34                	js     69 <load+0x69>
+    {
+        printf(stdout, "the file '%s' is opened.\n", name);
+      35:	a1 04 25 00 00       	mov    0x2504,%eax
+      3a:	83 ec 04             	sub    $0x4,%esp
+      3d:	ff 75 08             	push   0x8(%ebp)
+      40:	68 6c 1c 00 00       	push   $0x1c6c
+      45:	50                   	push   %eax
+      46:	e8 00 11 00 00       	call   114b <printf>
+      4b:	83 c4 10             	add    $0x10,%esp
+    {
+        printf(stderr, "error: an error occured while opening the file '%s'.\n", name);
+        exit();
+    }
+
+    if(read(fd, ptr, size) == size)
+      4e:	83 ec 04             	sub    $0x4,%esp
+      51:	ff 75 10             	push   0x10(%ebp)
+      54:	ff 75 0c             	push   0xc(%ebp)
+      57:	ff 75 f4             	push   -0xc(%ebp)
+      5a:	e8 97 0e 00 00       	call   ef6 <read>
+      5f:	83 c4 10             	add    $0x10,%esp
+      62:	39 45 10             	cmp    %eax,0x10(%ebp)
+      65:	75 5b                	jne    c2 <load+0xc2>
+      67:	eb 1e                	jmp    87 <load+0x87>
+        printf(stderr, "error: an error occured while opening the file '%s'.\n", name);
+      69:	a1 08 25 00 00       	mov    0x2508,%eax
+      6e:	83 ec 04             	sub    $0x4,%esp
+      71:	ff 75 08             	push   0x8(%ebp)
+      74:	68 88 1c 00 00       	push   $0x1c88
+      79:	50                   	push   %eax
+      7a:	e8 cc 10 00 00       	call   114b <printf>
+      7f:	83 c4 10             	add    $0x10,%esp
+        exit();
+      82:	e8 60 1b 00 00       	call   1be7 <exit>
+    {
+        printf(stdout, "the process info is read from the file '%s'.\n", name);
+      87:	a1 04 25 00 00       	mov    0x2504,%eax
+      8c:	83 ec 04             	sub    $0x4,%esp
+      8f:	ff 75 08             	push   0x8(%ebp)
+      92:	68 c0 1c 00 00       	push   $0x1cc0
+      97:	50                   	push   %eax
+      98:	e8 ae 10 00 00       	call   114b <printf>
+      9d:	83 c4 10             	add    $0x10,%esp
+    {
+        printf(stderr, "error: an error occured while reading from the file '%s'.\n", name);
+        exit();
+    }
+
+    close(fd);
+      a0:	83 ec 0c             	sub    $0xc,%esp
+      a3:	ff 75 f4             	push   -0xc(%ebp)
+      a6:	e8 54 1b 00 00       	call   1bff <close>
+      ab:	83 c4 10             	add    $0x10,%esp
+
+    if(unlink(name) >= 0)
+      ae:	83 ec 0c             	sub    $0xc,%esp
+      b1:	ff 75 08             	push   0x8(%ebp)
+      b4:	e8 a6 0e 00 00       	call   f5f <unlink>
+      b9:	83 c4 10             	add    $0x10,%esp
+      bc:	85 c0                	test   %eax,%eax
+      be:	78 3b                	js     fb <load+0xfb>
+      c0:	eb 1e                	jmp    e0 <load+0xe0>
+        printf(stderr, "error: an error occured while reading from the file '%s'.\n", name);
+      c2:	a1 08 25 00 00       	mov    0x2508,%eax
+      c7:	83 ec 04             	sub    $0x4,%esp
+      ca:	ff 75 08             	push   0x8(%ebp)
+      cd:	68 f0 1c 00 00       	push   $0x1cf0
+      d2:	50                   	push   %eax
+      d3:	e8 73 10 00 00       	call   114b <printf>
+      d8:	83 c4 10             	add    $0x10,%esp
+        exit();
+      db:	e8 07 1b 00 00       	call   1be7 <exit>
+    {
+        printf(stdout, "the file '%s' is deleted.\n", name);
+      e0:	a1 04 25 00 00       	mov    0x2504,%eax
+      e5:	83 ec 04             	sub    $0x4,%esp
+      e8:	ff 75 08             	push   0x8(%ebp)
+      eb:	68 2b 1d 00 00       	push   $0x1d2b
+      f0:	50                   	push   %eax
+      f1:	e8 55 10 00 00       	call   114b <printf>
+      f6:	83 c4 10             	add    $0x10,%esp
+    else
+    {
+        printf(stderr, "error: an error occured while unlinking the file '%s'.\n", name);
+        exit();
+    }
+}
+      f9:	eb 1e                	jmp    119 <load+0x119>
+        printf(stderr, "error: an error occured while unlinking the file '%s'.\n", name);
+      fb:	a1 08 25 00 00       	mov    0x2508,%eax
+     100:	83 ec 04             	sub    $0x4,%esp
+     103:	ff 75 08             	push   0x8(%ebp)
+     106:	68 48 1d 00 00       	push   $0x1d48
+     10b:	50                   	push   %eax
+     10c:	e8 3a 10 00 00       	call   114b <printf>
+     111:	83 c4 10             	add    $0x10,%esp
+        exit();
+     114:	e8 ce 1a 00 00       	call   1be7 <exit>
+}
+     119:	c9                   	leave
+     11a:	c3                   	ret
+
+0000011b <main>:
+
+int main(int argc, char *argv[])
+{
+     11b:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     11f:	83 e4 f0             	and    $0xfffffff0,%esp
+     122:	ff 71 fc             	push   -0x4(%ecx)
+     125:	55                   	push   %ebp
+     126:	89 e5                	mov    %esp,%ebp
+     128:	51                   	push   %ecx
+     129:	83 ec 24             	sub    $0x24,%esp
+    struct proc* p = (struct proc*) malloc(sizeof(struct proc));
+     12c:	83 ec 0c             	sub    $0xc,%esp
+     12f:	68 98 00 00 00       	push   $0x98
+     134:	e8 11 17 00 00       	call   184a <malloc>
+     139:	83 c4 10             	add    $0x10,%esp
+     13c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    p->tf = (struct trapframe*) malloc(sizeof(struct trapframe));
+     13f:	83 ec 0c             	sub    $0xc,%esp
+     142:	6a 4c                	push   $0x4c
+     144:	e8 01 17 00 00       	call   184a <malloc>
+     149:	83 c4 10             	add    $0x10,%esp
+     14c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     14f:	89 42 18             	mov    %eax,0x18(%edx)
+    p->context = (struct context*) malloc(sizeof(struct context));
+     152:	83 ec 0c             	sub    $0xc,%esp
+     155:	6a 14                	push   $0x14
+     157:	e8 ee 16 00 00       	call   184a <malloc>
+     15c:	83 c4 10             	add    $0x10,%esp
+     15f:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     162:	89 42 1c             	mov    %eax,0x1c(%edx)
+    p->cwd = (struct inode*) malloc(sizeof(struct inode));
+     165:	83 ec 0c             	sub    $0xc,%esp
+     168:	68 c0 00 00 00       	push   $0xc0
+     16d:	e8 d8 16 00 00       	call   184a <malloc>
+     172:	83 c4 10             	add    $0x10,%esp
+     175:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     178:	89 42 68             	mov    %eax,0x68(%edx)
+
+    load("backup", p, sizeof(struct proc));
+     17b:	83 ec 04             	sub    $0x4,%esp
+     17e:	68 98 00 00 00       	push   $0x98
+     183:	ff 75 f0             	push   -0x10(%ebp)
+     186:	68 80 1d 00 00       	push   $0x1d80
+     18b:	e8 70 fe ff ff       	call   0 <load>
+     190:	83 c4 10             	add    $0x10,%esp
+    char* pgs = (char *) malloc(p->sz);
+     193:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     196:	8b 00                	mov    (%eax),%eax
+     198:	83 ec 0c             	sub    $0xc,%esp
+     19b:	50                   	push   %eax
+     19c:	e8 a9 16 00 00       	call   184a <malloc>
+     1a1:	83 c4 10             	add    $0x10,%esp
+     1a4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+
+    load("tf", p->tf, sizeof(struct trapframe));
+     1a7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     1aa:	8b 40 18             	mov    0x18(%eax),%eax
+     1ad:	83 ec 04             	sub    $0x4,%esp
+     1b0:	6a 4c                	push   $0x4c
+     1b2:	50                   	push   %eax
+     1b3:	68 87 1d 00 00       	push   $0x1d87
+     1b8:	e8 43 fe ff ff       	call   0 <load>
+     1bd:	83 c4 10             	add    $0x10,%esp
+    load("context", p->context, sizeof(struct context));
+     1c0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     1c3:	8b 40 1c             	mov    0x1c(%eax),%eax
+     1c6:	83 ec 04             	sub    $0x4,%esp
+     1c9:	6a 14                	push   $0x14
+     1cb:	50                   	push   %eax
+     1cc:	68 8a 1d 00 00       	push   $0x1d8a
+     1d1:	e8 2a fe ff ff       	call   0 <load>
+     1d6:	83 c4 10             	add    $0x10,%esp
+    load("pgs", pgs, p->sz);
+     1d9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     1dc:	8b 00                	mov    (%eax),%eax
+     1de:	83 ec 04             	sub    $0x4,%esp
+     1e1:	50                   	push   %eax
+     1e2:	ff 75 ec             	push   -0x14(%ebp)
+     1e5:	68 92 1d 00 00       	push   $0x1d92
+     1ea:	e8 11 fe ff ff       	call   0 <load>
+     1ef:	83 c4 10             	add    $0x10,%esp
+
+    int num = p->sz / PGSIZE;
+     1f2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     1f5:	8b 00                	mov    (%eax),%eax
+     1f7:	c1 e8 0c             	shr    $0xc,%eax
+     1fa:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    p->pgdir = (pde_t*) malloc(sizeof(pde_t) * num);
+     1fd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     200:	c1 e0 02             	shl    $0x2,%eax
+     203:	83 ec 0c             	sub    $0xc,%esp
+     206:	50                   	push   %eax
+     207:	e8 3e 16 00 00       	call   184a <malloc>
+     20c:	83 c4 10             	add    $0x10,%esp
+     20f:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     212:	89 42 04             	mov    %eax,0x4(%edx)
+    int i;
+    for(i = 0; i < num; i++)
+     215:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     21c:	eb 24                	jmp    242 <main+0x127>
+    {
+        *(p->pgdir + i) = (pde_t) (pgs + i * PGSIZE);
+     21e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     221:	c1 e0 0c             	shl    $0xc,%eax
+     224:	89 c2                	mov    %eax,%edx
+     226:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     229:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     22c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     22f:	8b 40 04             	mov    0x4(%eax),%eax
+     232:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     235:	c1 e2 02             	shl    $0x2,%edx
+     238:	01 d0                	add    %edx,%eax
+     23a:	89 ca                	mov    %ecx,%edx
+     23c:	89 10                	mov    %edx,(%eax)
+    for(i = 0; i < num; i++)
+     23e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     242:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     245:	3b 45 e8             	cmp    -0x18(%ebp),%eax
+     248:	7c d4                	jl     21e <main+0x103>
+    }
+
+    //proc
+    printf(stdout, "========================userspace=========================\n");
+     24a:	a1 04 25 00 00       	mov    0x2504,%eax
+     24f:	83 ec 08             	sub    $0x8,%esp
+     252:	68 98 1d 00 00       	push   $0x1d98
+     257:	50                   	push   %eax
+     258:	e8 ee 0e 00 00       	call   114b <printf>
+     25d:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "after loading: sz, name, kstack\n");
+     260:	a1 04 25 00 00       	mov    0x2504,%eax
+     265:	83 ec 08             	sub    $0x8,%esp
+     268:	68 d4 1d 00 00       	push   $0x1dd4
+     26d:	50                   	push   %eax
+     26e:	e8 d8 0e 00 00       	call   114b <printf>
+     273:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "==========================================================\n");
+     276:	a1 04 25 00 00       	mov    0x2504,%eax
+     27b:	83 ec 08             	sub    $0x8,%esp
+     27e:	68 f8 1d 00 00       	push   $0x1df8
+     283:	50                   	push   %eax
+     284:	e8 c2 0e 00 00       	call   114b <printf>
+     289:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "sz = %d\n", p->sz);
+     28c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     28f:	8b 10                	mov    (%eax),%edx
+     291:	a1 04 25 00 00       	mov    0x2504,%eax
+     296:	83 ec 04             	sub    $0x4,%esp
+     299:	52                   	push   %edx
+     29a:	68 34 1e 00 00       	push   $0x1e34
+     29f:	50                   	push   %eax
+     2a0:	e8 a6 0e 00 00       	call   114b <printf>
+     2a5:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "name = %s\n", p->name);
+     2a8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     2ab:	8d 50 6c             	lea    0x6c(%eax),%edx
+     2ae:	a1 04 25 00 00       	mov    0x2504,%eax
+     2b3:	83 ec 04             	sub    $0x4,%esp
+     2b6:	52                   	push   %edx
+     2b7:	68 3d 1e 00 00       	push   $0x1e3d
+     2bc:	50                   	push   %eax
+     2bd:	e8 89 0e 00 00       	call   114b <printf>
+     2c2:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "kstack = %s\n", p->kstack);
+     2c5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     2c8:	8b 50 08             	mov    0x8(%eax),%edx
+     2cb:	a1 04 25 00 00       	mov    0x2504,%eax
+     2d0:	83 ec 04             	sub    $0x4,%esp
+     2d3:	52                   	push   %edx
+     2d4:	68 48 1e 00 00       	push   $0x1e48
+     2d9:	50                   	push   %eax
+     2da:	e8 6c 0e 00 00       	call   114b <printf>
+     2df:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "----------------------------------------------------------\n");
+     2e2:	a1 04 25 00 00       	mov    0x2504,%eax
+     2e7:	83 ec 08             	sub    $0x8,%esp
+     2ea:	68 58 1e 00 00       	push   $0x1e58
+     2ef:	50                   	push   %eax
+     2f0:	e8 56 0e 00 00       	call   114b <printf>
+     2f5:	83 c4 10             	add    $0x10,%esp
+
+    //pgs
+    printf(stdout, "========================userspace=========================\n");
+     2f8:	a1 04 25 00 00       	mov    0x2504,%eax
+     2fd:	83 ec 08             	sub    $0x8,%esp
+     300:	68 98 1d 00 00       	push   $0x1d98
+     305:	50                   	push   %eax
+     306:	e8 40 0e 00 00       	call   114b <printf>
+     30b:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "after loading: pgs\n");
+     30e:	a1 04 25 00 00       	mov    0x2504,%eax
+     313:	83 ec 08             	sub    $0x8,%esp
+     316:	68 94 1e 00 00       	push   $0x1e94
+     31b:	50                   	push   %eax
+     31c:	e8 2a 0e 00 00       	call   114b <printf>
+     321:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "==========================================================\n");
+     324:	a1 04 25 00 00       	mov    0x2504,%eax
+     329:	83 ec 08             	sub    $0x8,%esp
+     32c:	68 f8 1d 00 00       	push   $0x1df8
+     331:	50                   	push   %eax
+     332:	e8 14 0e 00 00       	call   114b <printf>
+     337:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < num; i++)
+     33a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     341:	eb 55                	jmp    398 <main+0x27d>
+    {
+        printf(stdout, "page '%d'th = %d\n", i, *(pgs + i * PGSIZE));
+     343:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     346:	c1 e0 0c             	shl    $0xc,%eax
+     349:	89 c2                	mov    %eax,%edx
+     34b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     34e:	01 d0                	add    %edx,%eax
+     350:	0f b6 00             	movzbl (%eax),%eax
+     353:	0f be d0             	movsbl %al,%edx
+     356:	a1 04 25 00 00       	mov    0x2504,%eax
+     35b:	52                   	push   %edx
+     35c:	ff 75 f4             	push   -0xc(%ebp)
+     35f:	68 a8 1e 00 00       	push   $0x1ea8
+     364:	50                   	push   %eax
+     365:	e8 e1 0d 00 00       	call   114b <printf>
+     36a:	83 c4 10             	add    $0x10,%esp
+        printf(stdout, "page '%d'th = %d\n", i, *(p->pgdir + i));
+     36d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     370:	8b 40 04             	mov    0x4(%eax),%eax
+     373:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     376:	c1 e2 02             	shl    $0x2,%edx
+     379:	01 d0                	add    %edx,%eax
+     37b:	8b 10                	mov    (%eax),%edx
+     37d:	a1 04 25 00 00       	mov    0x2504,%eax
+     382:	52                   	push   %edx
+     383:	ff 75 f4             	push   -0xc(%ebp)
+     386:	68 a8 1e 00 00       	push   $0x1ea8
+     38b:	50                   	push   %eax
+     38c:	e8 ba 0d 00 00       	call   114b <printf>
+     391:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < num; i++)
+     394:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     398:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     39b:	3b 45 e8             	cmp    -0x18(%ebp),%eax
+     39e:	7c a3                	jl     343 <main+0x228>
+    }
+    printf(stdout, "----------------------------------------------------------\n");
+     3a0:	a1 04 25 00 00       	mov    0x2504,%eax
+     3a5:	83 ec 08             	sub    $0x8,%esp
+     3a8:	68 58 1e 00 00       	push   $0x1e58
+     3ad:	50                   	push   %eax
+     3ae:	e8 98 0d 00 00       	call   114b <printf>
+     3b3:	83 c4 10             	add    $0x10,%esp
+
+    //tf
+    printf(stdout, "========================userspace=========================\n");
+     3b6:	a1 04 25 00 00       	mov    0x2504,%eax
+     3bb:	83 ec 08             	sub    $0x8,%esp
+     3be:	68 98 1d 00 00       	push   $0x1d98
+     3c3:	50                   	push   %eax
+     3c4:	e8 82 0d 00 00       	call   114b <printf>
+     3c9:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "after loading: tf\n");
+     3cc:	a1 04 25 00 00       	mov    0x2504,%eax
+     3d1:	83 ec 08             	sub    $0x8,%esp
+     3d4:	68 ba 1e 00 00       	push   $0x1eba
+     3d9:	50                   	push   %eax
+     3da:	e8 6c 0d 00 00       	call   114b <printf>
+     3df:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "==========================================================\n");
+     3e2:	a1 04 25 00 00       	mov    0x2504,%eax
+     3e7:	83 ec 08             	sub    $0x8,%esp
+     3ea:	68 f8 1d 00 00       	push   $0x1df8
+     3ef:	50                   	push   %eax
+     3f0:	e8 56 0d 00 00       	call   114b <printf>
+     3f5:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "edi = %d\n", p->tf->edi);
+     3f8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     3fb:	8b 40 18             	mov    0x18(%eax),%eax
+     3fe:	8b 10                	mov    (%eax),%edx
+     400:	a1 04 25 00 00       	mov    0x2504,%eax
+     405:	83 ec 04             	sub    $0x4,%esp
+     408:	52                   	push   %edx
+     409:	68 cd 1e 00 00       	push   $0x1ecd
+     40e:	50                   	push   %eax
+     40f:	e8 37 0d 00 00       	call   114b <printf>
+     414:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "esi = %d\n", p->tf->esi);
+     417:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     41a:	8b 40 18             	mov    0x18(%eax),%eax
+     41d:	8b 50 04             	mov    0x4(%eax),%edx
+     420:	a1 04 25 00 00       	mov    0x2504,%eax
+     425:	83 ec 04             	sub    $0x4,%esp
+     428:	52                   	push   %edx
+     429:	68 d7 1e 00 00       	push   $0x1ed7
+     42e:	50                   	push   %eax
+     42f:	e8 17 0d 00 00       	call   114b <printf>
+     434:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "ebp = %d\n", p->tf->ebp);
+     437:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     43a:	8b 40 18             	mov    0x18(%eax),%eax
+     43d:	8b 50 08             	mov    0x8(%eax),%edx
+     440:	a1 04 25 00 00       	mov    0x2504,%eax
+     445:	83 ec 04             	sub    $0x4,%esp
+     448:	52                   	push   %edx
+     449:	68 e1 1e 00 00       	push   $0x1ee1
+     44e:	50                   	push   %eax
+     44f:	e8 f7 0c 00 00       	call   114b <printf>
+     454:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "oesp = %d\n", p->tf->oesp);
+     457:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     45a:	8b 40 18             	mov    0x18(%eax),%eax
+     45d:	8b 50 0c             	mov    0xc(%eax),%edx
+     460:	a1 04 25 00 00       	mov    0x2504,%eax
+     465:	83 ec 04             	sub    $0x4,%esp
+     468:	52                   	push   %edx
+     469:	68 eb 1e 00 00       	push   $0x1eeb
+     46e:	50                   	push   %eax
+     46f:	e8 d7 0c 00 00       	call   114b <printf>
+     474:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "ebx = %d\n", p->tf->ebx);
+     477:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     47a:	8b 40 18             	mov    0x18(%eax),%eax
+     47d:	8b 50 10             	mov    0x10(%eax),%edx
+     480:	a1 04 25 00 00       	mov    0x2504,%eax
+     485:	83 ec 04             	sub    $0x4,%esp
+     488:	52                   	push   %edx
+     489:	68 f6 1e 00 00       	push   $0x1ef6
+     48e:	50                   	push   %eax
+     48f:	e8 b7 0c 00 00       	call   114b <printf>
+     494:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "edx = %d\n", p->tf->edx);
+     497:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     49a:	8b 40 18             	mov    0x18(%eax),%eax
+     49d:	8b 50 14             	mov    0x14(%eax),%edx
+     4a0:	a1 04 25 00 00       	mov    0x2504,%eax
+     4a5:	83 ec 04             	sub    $0x4,%esp
+     4a8:	52                   	push   %edx
+     4a9:	68 00 1f 00 00       	push   $0x1f00
+     4ae:	50                   	push   %eax
+     4af:	e8 97 0c 00 00       	call   114b <printf>
+     4b4:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "ecx = %d\n", p->tf->ecx);
+     4b7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     4ba:	8b 40 18             	mov    0x18(%eax),%eax
+     4bd:	8b 50 18             	mov    0x18(%eax),%edx
+     4c0:	a1 04 25 00 00       	mov    0x2504,%eax
+     4c5:	83 ec 04             	sub    $0x4,%esp
+     4c8:	52                   	push   %edx
+     4c9:	68 0a 1f 00 00       	push   $0x1f0a
+     4ce:	50                   	push   %eax
+     4cf:	e8 77 0c 00 00       	call   114b <printf>
+     4d4:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "eax = %d\n", p->tf->eax);
+     4d7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     4da:	8b 40 18             	mov    0x18(%eax),%eax
+     4dd:	8b 50 1c             	mov    0x1c(%eax),%edx
+     4e0:	a1 04 25 00 00       	mov    0x2504,%eax
+     4e5:	83 ec 04             	sub    $0x4,%esp
+     4e8:	52                   	push   %edx
+     4e9:	68 14 1f 00 00       	push   $0x1f14
+     4ee:	50                   	push   %eax
+     4ef:	e8 57 0c 00 00       	call   114b <printf>
+     4f4:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "gs = %d\n", p->tf->gs);
+     4f7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     4fa:	8b 40 18             	mov    0x18(%eax),%eax
+     4fd:	0f b7 40 20          	movzwl 0x20(%eax),%eax
+     501:	0f b7 d0             	movzwl %ax,%edx
+     504:	a1 04 25 00 00       	mov    0x2504,%eax
+     509:	83 ec 04             	sub    $0x4,%esp
+     50c:	52                   	push   %edx
+     50d:	68 1e 1f 00 00       	push   $0x1f1e
+     512:	50                   	push   %eax
+     513:	e8 33 0c 00 00       	call   114b <printf>
+     518:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "padding1 = %d\n", p->tf->padding1);
+     51b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     51e:	8b 40 18             	mov    0x18(%eax),%eax
+     521:	0f b7 40 22          	movzwl 0x22(%eax),%eax
+     525:	0f b7 d0             	movzwl %ax,%edx
+     528:	a1 04 25 00 00       	mov    0x2504,%eax
+     52d:	83 ec 04             	sub    $0x4,%esp
+     530:	52                   	push   %edx
+     531:	68 27 1f 00 00       	push   $0x1f27
+     536:	50                   	push   %eax
+     537:	e8 0f 0c 00 00       	call   114b <printf>
+     53c:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "fs = %d\n", p->tf->fs);
+     53f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     542:	8b 40 18             	mov    0x18(%eax),%eax
+     545:	0f b7 40 24          	movzwl 0x24(%eax),%eax
+     549:	0f b7 d0             	movzwl %ax,%edx
+     54c:	a1 04 25 00 00       	mov    0x2504,%eax
+     551:	83 ec 04             	sub    $0x4,%esp
+     554:	52                   	push   %edx
+     555:	68 36 1f 00 00       	push   $0x1f36
+     55a:	50                   	push   %eax
+     55b:	e8 eb 0b 00 00       	call   114b <printf>
+     560:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "padding2 = %d\n", p->tf->padding2);
+     563:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     566:	8b 40 18             	mov    0x18(%eax),%eax
+     569:	0f b7 40 26          	movzwl 0x26(%eax),%eax
+     56d:	0f b7 d0             	movzwl %ax,%edx
+     570:	a1 04 25 00 00       	mov    0x2504,%eax
+     575:	83 ec 04             	sub    $0x4,%esp
+     578:	52                   	push   %edx
+     579:	68 3f 1f 00 00       	push   $0x1f3f
+     57e:	50                   	push   %eax
+     57f:	e8 c7 0b 00 00       	call   114b <printf>
+     584:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "es = %d\n", p->tf->es);
+     587:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     58a:	8b 40 18             	mov    0x18(%eax),%eax
+     58d:	0f b7 40 28          	movzwl 0x28(%eax),%eax
+     591:	0f b7 d0             	movzwl %ax,%edx
+     594:	a1 04 25 00 00       	mov    0x2504,%eax
+     599:	83 ec 04             	sub    $0x4,%esp
+     59c:	52                   	push   %edx
+     59d:	68 4e 1f 00 00       	push   $0x1f4e
+     5a2:	50                   	push   %eax
+     5a3:	e8 a3 0b 00 00       	call   114b <printf>
+     5a8:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "padding3 = %d\n", p->tf->padding3);
+     5ab:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     5ae:	8b 40 18             	mov    0x18(%eax),%eax
+     5b1:	0f b7 40 2a          	movzwl 0x2a(%eax),%eax
+     5b5:	0f b7 d0             	movzwl %ax,%edx
+     5b8:	a1 04 25 00 00       	mov    0x2504,%eax
+     5bd:	83 ec 04             	sub    $0x4,%esp
+     5c0:	52                   	push   %edx
+     5c1:	68 57 1f 00 00       	push   $0x1f57
+     5c6:	50                   	push   %eax
+     5c7:	e8 7f 0b 00 00       	call   114b <printf>
+     5cc:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "ds = %d\n", p->tf->ds);
+     5cf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     5d2:	8b 40 18             	mov    0x18(%eax),%eax
+     5d5:	0f b7 40 2c          	movzwl 0x2c(%eax),%eax
+     5d9:	0f b7 d0             	movzwl %ax,%edx
+     5dc:	a1 04 25 00 00       	mov    0x2504,%eax
+     5e1:	83 ec 04             	sub    $0x4,%esp
+     5e4:	52                   	push   %edx
+     5e5:	68 66 1f 00 00       	push   $0x1f66
+     5ea:	50                   	push   %eax
+     5eb:	e8 5b 0b 00 00       	call   114b <printf>
+     5f0:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "padding4 = %d\n", p->tf->padding4);
+     5f3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     5f6:	8b 40 18             	mov    0x18(%eax),%eax
+     5f9:	0f b7 40 2e          	movzwl 0x2e(%eax),%eax
+     5fd:	0f b7 d0             	movzwl %ax,%edx
+     600:	a1 04 25 00 00       	mov    0x2504,%eax
+     605:	83 ec 04             	sub    $0x4,%esp
+     608:	52                   	push   %edx
+     609:	68 6f 1f 00 00       	push   $0x1f6f
+     60e:	50                   	push   %eax
+     60f:	e8 37 0b 00 00       	call   114b <printf>
+     614:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "trapno = %d\n", p->tf->trapno);
+     617:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     61a:	8b 40 18             	mov    0x18(%eax),%eax
+     61d:	8b 50 30             	mov    0x30(%eax),%edx
+     620:	a1 04 25 00 00       	mov    0x2504,%eax
+     625:	83 ec 04             	sub    $0x4,%esp
+     628:	52                   	push   %edx
+     629:	68 7e 1f 00 00       	push   $0x1f7e
+     62e:	50                   	push   %eax
+     62f:	e8 17 0b 00 00       	call   114b <printf>
+     634:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "err = %d\n", p->tf->err);
+     637:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     63a:	8b 40 18             	mov    0x18(%eax),%eax
+     63d:	8b 50 34             	mov    0x34(%eax),%edx
+     640:	a1 04 25 00 00       	mov    0x2504,%eax
+     645:	83 ec 04             	sub    $0x4,%esp
+     648:	52                   	push   %edx
+     649:	68 8b 1f 00 00       	push   $0x1f8b
+     64e:	50                   	push   %eax
+     64f:	e8 f7 0a 00 00       	call   114b <printf>
+     654:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "eip = %d\n", p->tf->eip);
+     657:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     65a:	8b 40 18             	mov    0x18(%eax),%eax
+     65d:	8b 50 38             	mov    0x38(%eax),%edx
+     660:	a1 04 25 00 00       	mov    0x2504,%eax
+     665:	83 ec 04             	sub    $0x4,%esp
+     668:	52                   	push   %edx
+     669:	68 95 1f 00 00       	push   $0x1f95
+     66e:	50                   	push   %eax
+     66f:	e8 d7 0a 00 00       	call   114b <printf>
+     674:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "cs = %d\n", p->tf->cs);
+     677:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     67a:	8b 40 18             	mov    0x18(%eax),%eax
+     67d:	0f b7 40 3c          	movzwl 0x3c(%eax),%eax
+     681:	0f b7 d0             	movzwl %ax,%edx
+     684:	a1 04 25 00 00       	mov    0x2504,%eax
+     689:	83 ec 04             	sub    $0x4,%esp
+     68c:	52                   	push   %edx
+     68d:	68 9f 1f 00 00       	push   $0x1f9f
+     692:	50                   	push   %eax
+     693:	e8 b3 0a 00 00       	call   114b <printf>
+     698:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "padding5 = %d\n", p->tf->padding5);
+     69b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     69e:	8b 40 18             	mov    0x18(%eax),%eax
+     6a1:	0f b7 40 3e          	movzwl 0x3e(%eax),%eax
+     6a5:	0f b7 d0             	movzwl %ax,%edx
+     6a8:	a1 04 25 00 00       	mov    0x2504,%eax
+     6ad:	83 ec 04             	sub    $0x4,%esp
+     6b0:	52                   	push   %edx
+     6b1:	68 a8 1f 00 00       	push   $0x1fa8
+     6b6:	50                   	push   %eax
+     6b7:	e8 8f 0a 00 00       	call   114b <printf>
+     6bc:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "eflags = %d\n", p->tf->eflags);
+     6bf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     6c2:	8b 40 18             	mov    0x18(%eax),%eax
+     6c5:	8b 50 40             	mov    0x40(%eax),%edx
+     6c8:	a1 04 25 00 00       	mov    0x2504,%eax
+     6cd:	83 ec 04             	sub    $0x4,%esp
+     6d0:	52                   	push   %edx
+     6d1:	68 b7 1f 00 00       	push   $0x1fb7
+     6d6:	50                   	push   %eax
+     6d7:	e8 6f 0a 00 00       	call   114b <printf>
+     6dc:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "esp = %d\n", p->tf->esp);
+     6df:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     6e2:	8b 40 18             	mov    0x18(%eax),%eax
+     6e5:	8b 50 44             	mov    0x44(%eax),%edx
+     6e8:	a1 04 25 00 00       	mov    0x2504,%eax
+     6ed:	83 ec 04             	sub    $0x4,%esp
+     6f0:	52                   	push   %edx
+     6f1:	68 c4 1f 00 00       	push   $0x1fc4
+     6f6:	50                   	push   %eax
+     6f7:	e8 4f 0a 00 00       	call   114b <printf>
+     6fc:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "ss = %d\n", p->tf->ss);
+     6ff:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     702:	8b 40 18             	mov    0x18(%eax),%eax
+     705:	0f b7 40 48          	movzwl 0x48(%eax),%eax
+     709:	0f b7 d0             	movzwl %ax,%edx
+     70c:	a1 04 25 00 00       	mov    0x2504,%eax
+     711:	83 ec 04             	sub    $0x4,%esp
+     714:	52                   	push   %edx
+     715:	68 ce 1f 00 00       	push   $0x1fce
+     71a:	50                   	push   %eax
+     71b:	e8 2b 0a 00 00       	call   114b <printf>
+     720:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "padding6 = %d\n", p->tf->padding6);
+     723:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     726:	8b 40 18             	mov    0x18(%eax),%eax
+     729:	0f b7 40 4a          	movzwl 0x4a(%eax),%eax
+     72d:	0f b7 d0             	movzwl %ax,%edx
+     730:	a1 04 25 00 00       	mov    0x2504,%eax
+     735:	83 ec 04             	sub    $0x4,%esp
+     738:	52                   	push   %edx
+     739:	68 d7 1f 00 00       	push   $0x1fd7
+     73e:	50                   	push   %eax
+     73f:	e8 07 0a 00 00       	call   114b <printf>
+     744:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "----------------------------------------------------------\n");
+     747:	a1 04 25 00 00       	mov    0x2504,%eax
+     74c:	83 ec 08             	sub    $0x8,%esp
+     74f:	68 58 1e 00 00       	push   $0x1e58
+     754:	50                   	push   %eax
+     755:	e8 f1 09 00 00       	call   114b <printf>
+     75a:	83 c4 10             	add    $0x10,%esp
+
+    //context
+    printf(stdout, "========================userspace=========================\n");
+     75d:	a1 04 25 00 00       	mov    0x2504,%eax
+     762:	83 ec 08             	sub    $0x8,%esp
+     765:	68 98 1d 00 00       	push   $0x1d98
+     76a:	50                   	push   %eax
+     76b:	e8 db 09 00 00       	call   114b <printf>
+     770:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "after loading: context\n");
+     773:	a1 04 25 00 00       	mov    0x2504,%eax
+     778:	83 ec 08             	sub    $0x8,%esp
+     77b:	68 e6 1f 00 00       	push   $0x1fe6
+     780:	50                   	push   %eax
+     781:	e8 c5 09 00 00       	call   114b <printf>
+     786:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "==========================================================\n");
+     789:	a1 04 25 00 00       	mov    0x2504,%eax
+     78e:	83 ec 08             	sub    $0x8,%esp
+     791:	68 f8 1d 00 00       	push   $0x1df8
+     796:	50                   	push   %eax
+     797:	e8 af 09 00 00       	call   114b <printf>
+     79c:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "edi = %d\n", p->context->edi);
+     79f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     7a2:	8b 40 1c             	mov    0x1c(%eax),%eax
+     7a5:	8b 10                	mov    (%eax),%edx
+     7a7:	a1 04 25 00 00       	mov    0x2504,%eax
+     7ac:	83 ec 04             	sub    $0x4,%esp
+     7af:	52                   	push   %edx
+     7b0:	68 cd 1e 00 00       	push   $0x1ecd
+     7b5:	50                   	push   %eax
+     7b6:	e8 90 09 00 00       	call   114b <printf>
+     7bb:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "esi = %d\n", p->context->esi);
+     7be:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     7c1:	8b 40 1c             	mov    0x1c(%eax),%eax
+     7c4:	8b 50 04             	mov    0x4(%eax),%edx
+     7c7:	a1 04 25 00 00       	mov    0x2504,%eax
+     7cc:	83 ec 04             	sub    $0x4,%esp
+     7cf:	52                   	push   %edx
+     7d0:	68 d7 1e 00 00       	push   $0x1ed7
+     7d5:	50                   	push   %eax
+     7d6:	e8 70 09 00 00       	call   114b <printf>
+     7db:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "ebx = %d\n", p->context->ebx);
+     7de:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     7e1:	8b 40 1c             	mov    0x1c(%eax),%eax
+     7e4:	8b 50 08             	mov    0x8(%eax),%edx
+     7e7:	a1 04 25 00 00       	mov    0x2504,%eax
+     7ec:	83 ec 04             	sub    $0x4,%esp
+     7ef:	52                   	push   %edx
+     7f0:	68 f6 1e 00 00       	push   $0x1ef6
+     7f5:	50                   	push   %eax
+     7f6:	e8 50 09 00 00       	call   114b <printf>
+     7fb:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "ebp = %d\n", p->context->ebp);
+     7fe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     801:	8b 40 1c             	mov    0x1c(%eax),%eax
+     804:	8b 50 0c             	mov    0xc(%eax),%edx
+     807:	a1 04 25 00 00       	mov    0x2504,%eax
+     80c:	83 ec 04             	sub    $0x4,%esp
+     80f:	52                   	push   %edx
+     810:	68 e1 1e 00 00       	push   $0x1ee1
+     815:	50                   	push   %eax
+     816:	e8 30 09 00 00       	call   114b <printf>
+     81b:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "eip = %d\n", p->context->eip);
+     81e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     821:	8b 40 1c             	mov    0x1c(%eax),%eax
+     824:	8b 50 10             	mov    0x10(%eax),%edx
+     827:	a1 04 25 00 00       	mov    0x2504,%eax
+     82c:	83 ec 04             	sub    $0x4,%esp
+     82f:	52                   	push   %edx
+     830:	68 95 1f 00 00       	push   $0x1f95
+     835:	50                   	push   %eax
+     836:	e8 10 09 00 00       	call   114b <printf>
+     83b:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "----------------------------------------------------------\n");
+     83e:	a1 04 25 00 00       	mov    0x2504,%eax
+     843:	83 ec 08             	sub    $0x8,%esp
+     846:	68 58 1e 00 00       	push   $0x1e58
+     84b:	50                   	push   %eax
+     84c:	e8 fa 08 00 00       	call   114b <printf>
+     851:	83 c4 10             	add    $0x10,%esp
+
+    int pid = loadproc(p, pgs);
+     854:	83 ec 08             	sub    $0x8,%esp
+     857:	ff 75 ec             	push   -0x14(%ebp)
+     85a:	ff 75 f0             	push   -0x10(%ebp)
+     85d:	e8 b1 07 00 00       	call   1013 <loadproc>
+     862:	83 c4 10             	add    $0x10,%esp
+     865:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(pid < 0)
+     868:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     86c:	79 1b                	jns    889 <main+0x76e>
+    {
+        printf(stderr, "error: an error occured while forking.\n");
+     86e:	a1 08 25 00 00       	mov    0x2508,%eax
+     873:	83 ec 08             	sub    $0x8,%esp
+     876:	68 00 20 00 00       	push   $0x2000
+     87b:	50                   	push   %eax
+     87c:	e8 ca 08 00 00       	call   114b <printf>
+     881:	83 c4 10             	add    $0x10,%esp
+        exit();
+     884:	e8 5e 13 00 00       	call   1be7 <exit>
+    }
+    else if(pid == 0)
+     889:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     88d:	75 18                	jne    8a7 <main+0x78c>
+    {
+        printf(stdout, "child\n");
+     88f:	a1 04 25 00 00       	mov    0x2504,%eax
+     894:	83 ec 08             	sub    $0x8,%esp
+     897:	68 28 20 00 00       	push   $0x2028
+     89c:	50                   	push   %eax
+     89d:	e8 a9 08 00 00       	call   114b <printf>
+     8a2:	83 c4 10             	add    $0x10,%esp
+     8a5:	eb 1b                	jmp    8c2 <main+0x7a7>
+    }
+    else
+    {
+        printf(stdout, "parent\n");
+     8a7:	a1 04 25 00 00       	mov    0x2504,%eax
+     8ac:	83 ec 08             	sub    $0x8,%esp
+     8af:	68 2f 20 00 00       	push   $0x202f
+     8b4:	50                   	push   %eax
+     8b5:	e8 91 08 00 00       	call   114b <printf>
+     8ba:	83 c4 10             	add    $0x10,%esp
+        wait();
+     8bd:	e8 16 06 00 00       	call   ed8 <wait>
+    }
+
+    printf(stdout, "both\n");
+     8c2:	a1 04 25 00 00       	mov    0x2504,%eax
+     8c7:	83 ec 08             	sub    $0x8,%esp
+     8ca:	68 37 20 00 00       	push   $0x2037
+     8cf:	50                   	push   %eax
+     8d0:	e8 76 08 00 00       	call   114b <printf>
+     8d5:	83 c4 10             	add    $0x10,%esp
+
+    exit();
+     8d8:	e8 0a 13 00 00       	call   1be7 <exit>
+
+000008dd <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+     8dd:	55                   	push   %ebp
+     8de:	89 e5                	mov    %esp,%ebp
+     8e0:	57                   	push   %edi
+     8e1:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+     8e2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     8e5:	8b 55 10             	mov    0x10(%ebp),%edx
+     8e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+     8eb:	89 cb                	mov    %ecx,%ebx
+     8ed:	89 df                	mov    %ebx,%edi
+     8ef:	89 d1                	mov    %edx,%ecx
+     8f1:	fc                   	cld
+     8f2:	f3 aa                	rep stos %al,%es:(%edi)
+     8f4:	89 ca                	mov    %ecx,%edx
+     8f6:	89 fb                	mov    %edi,%ebx
+     8f8:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     8fb:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     8fe:	90                   	nop
+     8ff:	5b                   	pop    %ebx
+     900:	5f                   	pop    %edi
+     901:	5d                   	pop    %ebp
+     902:	c3                   	ret
+
+00000903 <stosl>:
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+     903:	55                   	push   %ebp
+     904:	89 e5                	mov    %esp,%ebp
+     906:	57                   	push   %edi
+     907:	53                   	push   %ebx
+  asm volatile("cld; rep stosl" :
+     908:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     90b:	8b 55 10             	mov    0x10(%ebp),%edx
+     90e:	8b 45 0c             	mov    0xc(%ebp),%eax
+     911:	89 cb                	mov    %ecx,%ebx
+     913:	89 df                	mov    %ebx,%edi
+     915:	89 d1                	mov    %edx,%ecx
+     917:	fc                   	cld
+     918:	f3 ab                	rep stos %eax,%es:(%edi)
+     91a:	89 ca                	mov    %ecx,%edx
+     91c:	89 fb                	mov    %edi,%ebx
+     91e:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     921:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     924:	90                   	nop
+     925:	5b                   	pop    %ebx
+     926:	5f                   	pop    %edi
+     927:	5d                   	pop    %ebp
+     928:	c3                   	ret
+
+00000929 <movsb>:
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+     929:	55                   	push   %ebp
+     92a:	89 e5                	mov    %esp,%ebp
+     92c:	57                   	push   %edi
+     92d:	56                   	push   %esi
+     92e:	53                   	push   %ebx
+  asm volatile("cld; rep movsb" :
+     92f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     932:	8b 55 0c             	mov    0xc(%ebp),%edx
+     935:	8b 45 10             	mov    0x10(%ebp),%eax
+     938:	89 cb                	mov    %ecx,%ebx
+     93a:	89 df                	mov    %ebx,%edi
+     93c:	89 d6                	mov    %edx,%esi
+     93e:	89 c1                	mov    %eax,%ecx
+     940:	fc                   	cld
+     941:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     943:	89 c8                	mov    %ecx,%eax
+     945:	89 f2                	mov    %esi,%edx
+     947:	89 fb                	mov    %edi,%ebx
+     949:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     94c:	89 55 0c             	mov    %edx,0xc(%ebp)
+     94f:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     952:	90                   	nop
+     953:	5b                   	pop    %ebx
+     954:	5e                   	pop    %esi
+     955:	5f                   	pop    %edi
+     956:	5d                   	pop    %ebp
+     957:	c3                   	ret
+
+00000958 <movsl>:
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+     958:	55                   	push   %ebp
+     959:	89 e5                	mov    %esp,%ebp
+     95b:	57                   	push   %edi
+     95c:	56                   	push   %esi
+     95d:	53                   	push   %ebx
+  asm volatile("cld; rep movsl" :
+     95e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     961:	8b 55 0c             	mov    0xc(%ebp),%edx
+     964:	8b 45 10             	mov    0x10(%ebp),%eax
+     967:	89 cb                	mov    %ecx,%ebx
+     969:	89 df                	mov    %ebx,%edi
+     96b:	89 d6                	mov    %edx,%esi
+     96d:	89 c1                	mov    %eax,%ecx
+     96f:	fc                   	cld
+     970:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     972:	89 c8                	mov    %ecx,%eax
+     974:	89 f2                	mov    %esi,%edx
+     976:	89 fb                	mov    %edi,%ebx
+     978:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     97b:	89 55 0c             	mov    %edx,0xc(%ebp)
+     97e:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     981:	90                   	nop
+     982:	5b                   	pop    %ebx
+     983:	5e                   	pop    %esi
+     984:	5f                   	pop    %edi
+     985:	5d                   	pop    %ebp
+     986:	c3                   	ret
+
+00000987 <strcpy>:
+#define ONES        0x01010101
+#define HASZERO(x)  (((x) - ONES) & ~(x) & (ONES << 7))
+
+char*
+strcpy(char *s, char *t)
+{
+     987:	55                   	push   %ebp
+     988:	89 e5                	mov    %esp,%ebp
+     98a:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+     98d:	8b 45 08             	mov    0x8(%ebp),%eax
+     990:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     993:	90                   	nop
+     994:	8b 55 0c             	mov    0xc(%ebp),%edx
+     997:	8d 42 01             	lea    0x1(%edx),%eax
+     99a:	89 45 0c             	mov    %eax,0xc(%ebp)
+     99d:	8b 45 08             	mov    0x8(%ebp),%eax
+     9a0:	8d 48 01             	lea    0x1(%eax),%ecx
+     9a3:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     9a6:	0f b6 12             	movzbl (%edx),%edx
+     9a9:	88 10                	mov    %dl,(%eax)
+     9ab:	0f b6 00             	movzbl (%eax),%eax
+     9ae:	84 c0                	test   %al,%al
+     9b0:	75 e2                	jne    994 <strcpy+0xd>
+    ;
+  return os;
+     9b2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     9b5:	c9                   	leave
+     9b6:	c3                   	ret
+
+000009b7 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     9b7:	55                   	push   %ebp
+     9b8:	89 e5                	mov    %esp,%ebp
+  // Aligned words never straddle a page, so reading
+  // whole ones past the end of a string is safe.
+  if((((uint)p | (uint)q) & 3) == 0)
+     9ba:	8b 55 08             	mov    0x8(%ebp),%edx
+     9bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+     9c0:	09 d0                	or     %edx,%eax
+     9c2:	83 e0 03             	and    $0x3,%eax
+     9c5:	85 c0                	test   %eax,%eax
+     9c7:	75 3f                	jne    a08 <strcmp+0x51>
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     9c9:	eb 08                	jmp    9d3 <strcmp+0x1c>
+      p += 4, q += 4;
+     9cb:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     9cf:	83 45 0c 04          	addl   $0x4,0xc(%ebp)
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     9d3:	8b 45 08             	mov    0x8(%ebp),%eax
+     9d6:	8b 10                	mov    (%eax),%edx
+     9d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+     9db:	8b 00                	mov    (%eax),%eax
+     9dd:	39 c2                	cmp    %eax,%edx
+     9df:	75 27                	jne    a08 <strcmp+0x51>
+     9e1:	8b 45 08             	mov    0x8(%ebp),%eax
+     9e4:	8b 00                	mov    (%eax),%eax
+     9e6:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     9ec:	8b 45 08             	mov    0x8(%ebp),%eax
+     9ef:	8b 00                	mov    (%eax),%eax
+     9f1:	f7 d0                	not    %eax
+     9f3:	21 d0                	and    %edx,%eax
+     9f5:	25 80 80 80 80       	and    $0x80808080,%eax
+     9fa:	85 c0                	test   %eax,%eax
+     9fc:	74 cd                	je     9cb <strcmp+0x14>
+  while(*p && *p == *q)
+     9fe:	eb 08                	jmp    a08 <strcmp+0x51>
+    p++, q++;
+     a00:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     a04:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     a08:	8b 45 08             	mov    0x8(%ebp),%eax
+     a0b:	0f b6 00             	movzbl (%eax),%eax
+     a0e:	84 c0                	test   %al,%al
+     a10:	74 10                	je     a22 <strcmp+0x6b>
+     a12:	8b 45 08             	mov    0x8(%ebp),%eax
+     a15:	0f b6 10             	movzbl (%eax),%edx
+     a18:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a1b:	0f b6 00             	movzbl (%eax),%eax
+     a1e:	38 c2                	cmp    %al,%dl
+     a20:	74 de                	je     a00 <strcmp+0x49>
+  return (uchar)*p - (uchar)*q;
+     a22:	8b 45 08             	mov    0x8(%ebp),%eax
+     a25:	0f b6 00             	movzbl (%eax),%eax
+     a28:	0f b6 d0             	movzbl %al,%edx
+     a2b:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a2e:	0f b6 00             	movzbl (%eax),%eax
+     a31:	0f b6 c0             	movzbl %al,%eax
+     a34:	29 c2                	sub    %eax,%edx
+     a36:	89 d0                	mov    %edx,%eax
+}
+     a38:	5d                   	pop    %ebp
+     a39:	c3                   	ret
+
+00000a3a <strlen>:
+
+uint
+strlen(char *s)
+{
+     a3a:	55                   	push   %ebp
+     a3b:	89 e5                	mov    %esp,%ebp
+     a3d:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; ((uint)(s+n) & 3) && s[n]; n++)
+     a40:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     a47:	eb 04                	jmp    a4d <strlen+0x13>
+     a49:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     a4d:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     a50:	8b 45 08             	mov    0x8(%ebp),%eax
+     a53:	01 d0                	add    %edx,%eax
+     a55:	83 e0 03             	and    $0x3,%eax
+     a58:	85 c0                	test   %eax,%eax
+     a5a:	74 0f                	je     a6b <strlen+0x31>
+     a5c:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     a5f:	8b 45 08             	mov    0x8(%ebp),%eax
+     a62:	01 d0                	add    %edx,%eax
+     a64:	0f b6 00             	movzbl (%eax),%eax
+     a67:	84 c0                	test   %al,%al
+     a69:	75 de                	jne    a49 <strlen+0xf>
+    ;
+  if(s[n])
+     a6b:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     a6e:	8b 45 08             	mov    0x8(%ebp),%eax
+     a71:	01 d0                	add    %edx,%eax
+     a73:	0f b6 00             	movzbl (%eax),%eax
+     a76:	84 c0                	test   %al,%al
+     a78:	74 33                	je     aad <strlen+0x73>
+    while(!HASZERO(*(uint*)(s+n)))
+     a7a:	eb 04                	jmp    a80 <strlen+0x46>
+      n += 4;
+     a7c:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+    while(!HASZERO(*(uint*)(s+n)))
+     a80:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     a83:	8b 45 08             	mov    0x8(%ebp),%eax
+     a86:	01 d0                	add    %edx,%eax
+     a88:	8b 00                	mov    (%eax),%eax
+     a8a:	8d 88 ff fe fe fe    	lea    -0x1010101(%eax),%ecx
+     a90:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     a93:	8b 45 08             	mov    0x8(%ebp),%eax
+     a96:	01 d0                	add    %edx,%eax
+     a98:	8b 00                	mov    (%eax),%eax
+     a9a:	f7 d0                	not    %eax
+     a9c:	21 c8                	and    %ecx,%eax
+     a9e:	25 80 80 80 80       	and    $0x80808080,%eax
+     aa3:	85 c0                	test   %eax,%eax
+     aa5:	74 d5                	je     a7c <strlen+0x42>
+  for(; s[n]; n++)
+     aa7:	eb 04                	jmp    aad <strlen+0x73>
+     aa9:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     aad:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     ab0:	8b 45 08             	mov    0x8(%ebp),%eax
+     ab3:	01 d0                	add    %edx,%eax
+     ab5:	0f b6 00             	movzbl (%eax),%eax
+     ab8:	84 c0                	test   %al,%al
+     aba:	75 ed                	jne    aa9 <strlen+0x6f>
+    ;
+  return n;
+     abc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     abf:	c9                   	leave
+     ac0:	c3                   	ret
+
+00000ac1 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     ac1:	55                   	push   %ebp
+     ac2:	89 e5                	mov    %esp,%ebp
+     ac4:	83 ec 10             	sub    $0x10,%esp
+  char *d;
+  uint k;
+
+  d = dst;
+     ac7:	8b 45 08             	mov    0x8(%ebp),%eax
+     aca:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c &= 0xFF;
+     acd:	81 65 0c ff 00 00 00 	andl   $0xff,0xc(%ebp)
+  if(n >= 16){
+     ad4:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     ad8:	76 54                	jbe    b2e <memset+0x6d>
+    k = -(uint)d & 3;  // bytes up to a word boundary
+     ada:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     add:	f7 d8                	neg    %eax
+     adf:	83 e0 03             	and    $0x3,%eax
+     ae2:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    stosb(d, c, k);
+     ae5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     ae8:	50                   	push   %eax
+     ae9:	ff 75 0c             	push   0xc(%ebp)
+     aec:	ff 75 fc             	push   -0x4(%ebp)
+     aef:	e8 e9 fd ff ff       	call   8dd <stosb>
+     af4:	83 c4 0c             	add    $0xc,%esp
+    d += k;
+     af7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     afa:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n -= k;
+     afd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     b00:	29 45 10             	sub    %eax,0x10(%ebp)
+    stosl(d, c*ONES, n/4);
+     b03:	8b 45 10             	mov    0x10(%ebp),%eax
+     b06:	c1 e8 02             	shr    $0x2,%eax
+     b09:	89 c2                	mov    %eax,%edx
+     b0b:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b0e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     b14:	52                   	push   %edx
+     b15:	50                   	push   %eax
+     b16:	ff 75 fc             	push   -0x4(%ebp)
+     b19:	e8 e5 fd ff ff       	call   903 <stosl>
+     b1e:	83 c4 0c             	add    $0xc,%esp
+    d += n & ~3;
+     b21:	8b 45 10             	mov    0x10(%ebp),%eax
+     b24:	83 e0 fc             	and    $0xfffffffc,%eax
+     b27:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n &= 3;
+     b2a:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+  }
+  stosb(d, c, n);
+     b2e:	8b 45 10             	mov    0x10(%ebp),%eax
+     b31:	50                   	push   %eax
+     b32:	ff 75 0c             	push   0xc(%ebp)
+     b35:	ff 75 fc             	push   -0x4(%ebp)
+     b38:	e8 a0 fd ff ff       	call   8dd <stosb>
+     b3d:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     b40:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     b43:	c9                   	leave
+     b44:	c3                   	ret
+
+00000b45 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     b45:	55                   	push   %ebp
+     b46:	89 e5                	mov    %esp,%ebp
+     b48:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s1, *s2;
+
+  s1 = v1;
+     b4b:	8b 45 08             	mov    0x8(%ebp),%eax
+     b4e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s2 = v2;
+     b51:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b54:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     b57:	eb 0c                	jmp    b65 <memcmp+0x20>
+    s1 += 4, s2 += 4, n -= 4;
+     b59:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+     b5d:	83 45 f8 04          	addl   $0x4,-0x8(%ebp)
+     b61:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     b65:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     b69:	76 3e                	jbe    ba9 <memcmp+0x64>
+     b6b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     b6e:	8b 10                	mov    (%eax),%edx
+     b70:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     b73:	8b 00                	mov    (%eax),%eax
+     b75:	39 c2                	cmp    %eax,%edx
+     b77:	74 e0                	je     b59 <memcmp+0x14>
+  while(n-- > 0){
+     b79:	eb 2e                	jmp    ba9 <memcmp+0x64>
+    if(*s1 != *s2)
+     b7b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     b7e:	0f b6 10             	movzbl (%eax),%edx
+     b81:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     b84:	0f b6 00             	movzbl (%eax),%eax
+     b87:	38 c2                	cmp    %al,%dl
+     b89:	74 16                	je     ba1 <memcmp+0x5c>
+      return *s1 - *s2;
+     b8b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     b8e:	0f b6 00             	movzbl (%eax),%eax
+     b91:	0f b6 d0             	movzbl %al,%edx
+     b94:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     b97:	0f b6 00             	movzbl (%eax),%eax
+     b9a:	0f b6 c0             	movzbl %al,%eax
+     b9d:	29 c2                	sub    %eax,%edx
+     b9f:	eb 1a                	jmp    bbb <memcmp+0x76>
+    s1++, s2++;
+     ba1:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     ba5:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+  while(n-- > 0){
+     ba9:	8b 45 10             	mov    0x10(%ebp),%eax
+     bac:	8d 50 ff             	lea    -0x1(%eax),%edx
+     baf:	89 55 10             	mov    %edx,0x10(%ebp)
+     bb2:	85 c0                	test   %eax,%eax
+     bb4:	75 c5                	jne    b7b <memcmp+0x36>
+  }
+  return 0;
+     bb6:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+     bbb:	89 d0                	mov    %edx,%eax
+     bbd:	c9                   	leave
+     bbe:	c3                   	ret
+
+00000bbf <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     bbf:	55                   	push   %ebp
+     bc0:	89 e5                	mov    %esp,%ebp
+     bc2:	83 ec 14             	sub    $0x14,%esp
+     bc5:	8b 45 0c             	mov    0xc(%ebp),%eax
+     bc8:	88 45 ec             	mov    %al,-0x14(%ebp)
+  uint w, cc;
+
+  // Skip whole words holding neither c nor the terminator.
+  for(; ((uint)s & 3) && *s; s++)
+     bcb:	eb 17                	jmp    be4 <strchr+0x25>
+    if(*s == c)
+     bcd:	8b 45 08             	mov    0x8(%ebp),%eax
+     bd0:	0f b6 00             	movzbl (%eax),%eax
+     bd3:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     bd6:	75 08                	jne    be0 <strchr+0x21>
+      return (char*)s;
+     bd8:	8b 45 08             	mov    0x8(%ebp),%eax
+     bdb:	e9 ad 00 00 00       	jmp    c8d <strchr+0xce>
+  for(; ((uint)s & 3) && *s; s++)
+     be0:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     be4:	8b 45 08             	mov    0x8(%ebp),%eax
+     be7:	83 e0 03             	and    $0x3,%eax
+     bea:	85 c0                	test   %eax,%eax
+     bec:	74 0a                	je     bf8 <strchr+0x39>
+     bee:	8b 45 08             	mov    0x8(%ebp),%eax
+     bf1:	0f b6 00             	movzbl (%eax),%eax
+     bf4:	84 c0                	test   %al,%al
+     bf6:	75 d5                	jne    bcd <strchr+0xe>
+  cc = (uchar)c * ONES;
+     bf8:	0f b6 45 ec          	movzbl -0x14(%ebp),%eax
+     bfc:	0f b6 c0             	movzbl %al,%eax
+     bff:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     c05:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(*s)
+     c08:	8b 45 08             	mov    0x8(%ebp),%eax
+     c0b:	0f b6 00             	movzbl (%eax),%eax
+     c0e:	84 c0                	test   %al,%al
+     c10:	74 6c                	je     c7e <strchr+0xbf>
+    for(; w = *(uint*)s, !HASZERO(w) && !HASZERO(w ^ cc); s += 4)
+     c12:	eb 04                	jmp    c18 <strchr+0x59>
+     c14:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     c18:	8b 45 08             	mov    0x8(%ebp),%eax
+     c1b:	8b 00                	mov    (%eax),%eax
+     c1d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     c20:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     c23:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     c29:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     c2c:	f7 d0                	not    %eax
+     c2e:	21 d0                	and    %edx,%eax
+     c30:	25 80 80 80 80       	and    $0x80808080,%eax
+     c35:	85 c0                	test   %eax,%eax
+     c37:	75 26                	jne    c5f <strchr+0xa0>
+     c39:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     c3c:	33 45 fc             	xor    -0x4(%ebp),%eax
+     c3f:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     c45:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     c48:	33 45 fc             	xor    -0x4(%ebp),%eax
+     c4b:	f7 d0                	not    %eax
+     c4d:	21 d0                	and    %edx,%eax
+     c4f:	25 80 80 80 80       	and    $0x80808080,%eax
+     c54:	85 c0                	test   %eax,%eax
+     c56:	75 07                	jne    c5f <strchr+0xa0>
+     c58:	b8 01 00 00 00       	mov    $0x1,%eax
+     c5d:	eb 05                	jmp    c64 <strchr+0xa5>
+     c5f:	b8 00 00 00 00       	mov    $0x0,%eax
+     c64:	85 c0                	test   %eax,%eax
+     c66:	75 ac                	jne    c14 <strchr+0x55>
+      ;
+  for(; *s; s++)
+     c68:	eb 14                	jmp    c7e <strchr+0xbf>
+    if(*s == c)
+     c6a:	8b 45 08             	mov    0x8(%ebp),%eax
+     c6d:	0f b6 00             	movzbl (%eax),%eax
+     c70:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     c73:	75 05                	jne    c7a <strchr+0xbb>
+      return (char*)s;
+     c75:	8b 45 08             	mov    0x8(%ebp),%eax
+     c78:	eb 13                	jmp    c8d <strchr+0xce>
+  for(; *s; s++)
+     c7a:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     c7e:	8b 45 08             	mov    0x8(%ebp),%eax
+     c81:	0f b6 00             	movzbl (%eax),%eax
+     c84:	84 c0                	test   %al,%al
+     c86:	75 e2                	jne    c6a <strchr+0xab>
+  return 0;
+     c88:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     c8d:	c9                   	leave
+     c8e:	c3                   	ret
+
+00000c8f <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     c8f:	55                   	push   %ebp
+     c90:	89 e5                	mov    %esp,%ebp
+     c92:	83 ec 18             	sub    $0x18,%esp
+  int i, c;
+
+  for(i=0; i+1 < max; ){
+     c95:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     c9c:	eb 37                	jmp    cd5 <gets+0x46>
+    c = fgetc(0);
+     c9e:	83 ec 0c             	sub    $0xc,%esp
+     ca1:	6a 00                	push   $0x0
+     ca3:	e8 2e 0e 00 00       	call   1ad6 <fgetc>
+     ca8:	83 c4 10             	add    $0x10,%esp
+     cab:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(c < 0)
+     cae:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     cb2:	78 2e                	js     ce2 <gets+0x53>
+      break;
+    buf[i++] = c;
+     cb4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     cb7:	8d 50 01             	lea    0x1(%eax),%edx
+     cba:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     cbd:	89 c2                	mov    %eax,%edx
+     cbf:	8b 45 08             	mov    0x8(%ebp),%eax
+     cc2:	01 d0                	add    %edx,%eax
+     cc4:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     cc7:	88 10                	mov    %dl,(%eax)
+    if(c == '\n' || c == '\r')
+     cc9:	83 7d f0 0a          	cmpl   $0xa,-0x10(%ebp)
+     ccd:	74 14                	je     ce3 <gets+0x54>
+     ccf:	83 7d f0 0d          	cmpl   $0xd,-0x10(%ebp)
+     cd3:	74 0e                	je     ce3 <gets+0x54>
+  for(i=0; i+1 < max; ){
+     cd5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     cd8:	83 c0 01             	add    $0x1,%eax
+     cdb:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     cde:	7f be                	jg     c9e <gets+0xf>
+     ce0:	eb 01                	jmp    ce3 <gets+0x54>
+      break;
+     ce2:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     ce3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     ce6:	8b 45 08             	mov    0x8(%ebp),%eax
+     ce9:	01 d0                	add    %edx,%eax
+     ceb:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     cee:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     cf1:	c9                   	leave
+     cf2:	c3                   	ret
+
+00000cf3 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     cf3:	55                   	push   %ebp
+     cf4:	89 e5                	mov    %esp,%ebp
+     cf6:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     cf9:	83 ec 08             	sub    $0x8,%esp
+     cfc:	6a 00                	push   $0x0
+     cfe:	ff 75 08             	push   0x8(%ebp)
+     d01:	e8 3b 02 00 00       	call   f41 <open>
+     d06:	83 c4 10             	add    $0x10,%esp
+     d09:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     d0c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     d10:	79 07                	jns    d19 <stat+0x26>
+    return -1;
+     d12:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     d17:	eb 25                	jmp    d3e <stat+0x4b>
+  r = fstat(fd, st);
+     d19:	83 ec 08             	sub    $0x8,%esp
+     d1c:	ff 75 0c             	push   0xc(%ebp)
+     d1f:	ff 75 f4             	push   -0xc(%ebp)
+     d22:	e8 47 02 00 00       	call   f6e <fstat>
+     d27:	83 c4 10             	add    $0x10,%esp
+     d2a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     d2d:	83 ec 0c             	sub    $0xc,%esp
+     d30:	ff 75 f4             	push   -0xc(%ebp)
+     d33:	e8 c7 0e 00 00       	call   1bff <close>
+     d38:	83 c4 10             	add    $0x10,%esp
+  return r;
+     d3b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     d3e:	c9                   	leave
+     d3f:	c3                   	ret
+
+00000d40 <atoi>:
+
+int
+atoi(const char *s)
+{
+     d40:	55                   	push   %ebp
+     d41:	89 e5                	mov    %esp,%ebp
+     d43:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     d46:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     d4d:	eb 25                	jmp    d74 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     d4f:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     d52:	89 d0                	mov    %edx,%eax
+     d54:	c1 e0 02             	shl    $0x2,%eax
+     d57:	01 d0                	add    %edx,%eax
+     d59:	01 c0                	add    %eax,%eax
+     d5b:	89 c1                	mov    %eax,%ecx
+     d5d:	8b 45 08             	mov    0x8(%ebp),%eax
+     d60:	8d 50 01             	lea    0x1(%eax),%edx
+     d63:	89 55 08             	mov    %edx,0x8(%ebp)
+     d66:	0f b6 00             	movzbl (%eax),%eax
+     d69:	0f be c0             	movsbl %al,%eax
+     d6c:	01 c8                	add    %ecx,%eax
+     d6e:	83 e8 30             	sub    $0x30,%eax
+     d71:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     d74:	8b 45 08             	mov    0x8(%ebp),%eax
+     d77:	0f b6 00             	movzbl (%eax),%eax
+     d7a:	3c 2f                	cmp    $0x2f,%al
+     d7c:	7e 0a                	jle    d88 <atoi+0x48>
+     d7e:	8b 45 08             	mov    0x8(%ebp),%eax
+     d81:	0f b6 00             	movzbl (%eax),%eax
+     d84:	3c 39                	cmp    $0x39,%al
+     d86:	7e c7                	jle    d4f <atoi+0xf>
+  return n;
+     d88:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     d8b:	c9                   	leave
+     d8c:	c3                   	ret
+
+00000d8d <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     d8d:	55                   	push   %ebp
+     d8e:	89 e5                	mov    %esp,%ebp
+     d90:	83 ec 10             	sub    $0x10,%esp
+  char *d, *s;
+  int k;
+
+  if(n <= 0)
+     d93:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     d97:	7f 08                	jg     da1 <memmove+0x14>
+    return vdst;
+     d99:	8b 45 08             	mov    0x8(%ebp),%eax
+     d9c:	e9 17 01 00 00       	jmp    eb8 <memmove+0x12b>
+  d = vdst;
+     da1:	8b 45 08             	mov    0x8(%ebp),%eax
+     da4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s = vsrc;
+     da7:	8b 45 0c             	mov    0xc(%ebp),%eax
+     daa:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  if(s < d && s + n > d){
+     dad:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     db0:	3b 45 fc             	cmp    -0x4(%ebp),%eax
+     db3:	0f 83 84 00 00 00    	jae    e3d <memmove+0xb0>
+     db9:	8b 55 10             	mov    0x10(%ebp),%edx
+     dbc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     dbf:	01 d0                	add    %edx,%eax
+     dc1:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     dc4:	73 77                	jae    e3d <memmove+0xb0>
+    s += n;
+     dc6:	8b 45 10             	mov    0x10(%ebp),%eax
+     dc9:	01 45 f8             	add    %eax,-0x8(%ebp)
+    d += n;
+     dcc:	8b 45 10             	mov    0x10(%ebp),%eax
+     dcf:	01 45 fc             	add    %eax,-0x4(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     dd2:	eb 17                	jmp    deb <memmove+0x5e>
+      *--d = *--s, n--;
+     dd4:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     dd8:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     ddc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     ddf:	0f b6 10             	movzbl (%eax),%edx
+     de2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     de5:	88 10                	mov    %dl,(%eax)
+     de7:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     deb:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     def:	7e 22                	jle    e13 <memmove+0x86>
+     df1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     df4:	83 e0 03             	and    $0x3,%eax
+     df7:	85 c0                	test   %eax,%eax
+     df9:	75 d9                	jne    dd4 <memmove+0x47>
+    for(; n >= 4; n -= 4){
+     dfb:	eb 16                	jmp    e13 <memmove+0x86>
+      d -= 4;
+     dfd:	83 6d fc 04          	subl   $0x4,-0x4(%ebp)
+      s -= 4;
+     e01:	83 6d f8 04          	subl   $0x4,-0x8(%ebp)
+      *(uint*)d = *(uint*)s;
+     e05:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     e08:	8b 10                	mov    (%eax),%edx
+     e0a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e0d:	89 10                	mov    %edx,(%eax)
+    for(; n >= 4; n -= 4){
+     e0f:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+     e13:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     e17:	7f e4                	jg     dfd <memmove+0x70>
+    }
+    while(n-- > 0)
+     e19:	eb 13                	jmp    e2e <memmove+0xa1>
+      *--d = *--s;
+     e1b:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     e1f:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     e23:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     e26:	0f b6 10             	movzbl (%eax),%edx
+     e29:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e2c:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+     e2e:	8b 45 10             	mov    0x10(%ebp),%eax
+     e31:	8d 50 ff             	lea    -0x1(%eax),%edx
+     e34:	89 55 10             	mov    %edx,0x10(%ebp)
+     e37:	85 c0                	test   %eax,%eax
+     e39:	7f e0                	jg     e1b <memmove+0x8e>
+  if(s < d && s + n > d){
+     e3b:	eb 78                	jmp    eb5 <memmove+0x128>
+  } else {
+    if(n >= 16){
+     e3d:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     e41:	7e 61                	jle    ea4 <memmove+0x117>
+      k = -(uint)d & 3;
+     e43:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e46:	f7 d8                	neg    %eax
+     e48:	83 e0 03             	and    $0x3,%eax
+     e4b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      movsb(d, s, k);
+     e4e:	ff 75 f4             	push   -0xc(%ebp)
+     e51:	ff 75 f8             	push   -0x8(%ebp)
+     e54:	ff 75 fc             	push   -0x4(%ebp)
+     e57:	e8 cd fa ff ff       	call   929 <movsb>
+     e5c:	83 c4 0c             	add    $0xc,%esp
+      d += k;
+     e5f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e62:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += k;
+     e65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e68:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n -= k;
+     e6b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e6e:	29 45 10             	sub    %eax,0x10(%ebp)
+      movsl(d, s, n/4);
+     e71:	8b 45 10             	mov    0x10(%ebp),%eax
+     e74:	8d 50 03             	lea    0x3(%eax),%edx
+     e77:	85 c0                	test   %eax,%eax
+     e79:	0f 48 c2             	cmovs  %edx,%eax
+     e7c:	c1 f8 02             	sar    $0x2,%eax
+     e7f:	50                   	push   %eax
+     e80:	ff 75 f8             	push   -0x8(%ebp)
+     e83:	ff 75 fc             	push   -0x4(%ebp)
+     e86:	e8 cd fa ff ff       	call   958 <movsl>
+     e8b:	83 c4 0c             	add    $0xc,%esp
+      d += n & ~3;
+     e8e:	8b 45 10             	mov    0x10(%ebp),%eax
+     e91:	83 e0 fc             	and    $0xfffffffc,%eax
+     e94:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += n & ~3;
+     e97:	8b 45 10             	mov    0x10(%ebp),%eax
+     e9a:	83 e0 fc             	and    $0xfffffffc,%eax
+     e9d:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n &= 3;
+     ea0:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+    }
+    movsb(d, s, n);
+     ea4:	ff 75 10             	push   0x10(%ebp)
+     ea7:	ff 75 f8             	push   -0x8(%ebp)
+     eaa:	ff 75 fc             	push   -0x4(%ebp)
+     ead:	e8 77 fa ff ff       	call   929 <movsb>
+     eb2:	83 c4 0c             	add    $0xc,%esp
+  }
+  return vdst;
+     eb5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     eb8:	c9                   	leave
+     eb9:	c3                   	ret
+
+00000eba <_fork>:
+    movl %esp, %ecx; \
+    movl $1f, %edx; \
+    sysenter; \
+  1: ret
+
+RAWSYSCALL(fork)
+     eba:	b8 01 00 00 00       	mov    $0x1,%eax
+     ebf:	89 e1                	mov    %esp,%ecx
+     ec1:	ba c8 0e 00 00       	mov    $0xec8,%edx
+     ec6:	0f 34                	sysenter
+     ec8:	c3                   	ret
+
+00000ec9 <_exit>:
+RAWSYSCALL(exit)
+     ec9:	b8 02 00 00 00       	mov    $0x2,%eax
+     ece:	89 e1                	mov    %esp,%ecx
+     ed0:	ba d7 0e 00 00       	mov    $0xed7,%edx
+     ed5:	0f 34                	sysenter
+     ed7:	c3                   	ret
+
+00000ed8 <wait>:
+SYSCALL(wait)
+     ed8:	b8 03 00 00 00       	mov    $0x3,%eax
+     edd:	89 e1                	mov    %esp,%ecx
+     edf:	ba e6 0e 00 00       	mov    $0xee6,%edx
+     ee4:	0f 34                	sysenter
+     ee6:	c3                   	ret
+
+00000ee7 <pipe>:
+SYSCALL(pipe)
+     ee7:	b8 04 00 00 00       	mov    $0x4,%eax
+     eec:	89 e1                	mov    %esp,%ecx
+     eee:	ba f5 0e 00 00       	mov    $0xef5,%edx
+     ef3:	0f 34                	sysenter
+     ef5:	c3                   	ret
+
+00000ef6 <read>:
+SYSCALL(read)
+     ef6:	b8 05 00 00 00       	mov    $0x5,%eax
+     efb:	89 e1                	mov    %esp,%ecx
+     efd:	ba 04 0f 00 00       	mov    $0xf04,%edx
+     f02:	0f 34                	sysenter
+     f04:	c3                   	ret
+
+00000f05 <write>:
+SYSCALL(write)
+     f05:	b8 10 00 00 00       	mov    $0x10,%eax
+     f0a:	89 e1                	mov    %esp,%ecx
+     f0c:	ba 13 0f 00 00       	mov    $0xf13,%edx
+     f11:	0f 34                	sysenter
+     f13:	c3                   	ret
+
+00000f14 <_close>:
+RAWSYSCALL(close)
+     f14:	b8 15 00 00 00       	mov    $0x15,%eax
+     f19:	89 e1                	mov    %esp,%ecx
+     f1b:	ba 22 0f 00 00       	mov    $0xf22,%edx
+     f20:	0f 34                	sysenter
+     f22:	c3                   	ret
+
+00000f23 <kill>:
+SYSCALL(kill)
+     f23:	b8 06 00 00 00       	mov    $0x6,%eax
+     f28:	89 e1                	mov    %esp,%ecx
+     f2a:	ba 31 0f 00 00       	mov    $0xf31,%edx
+     f2f:	0f 34                	sysenter
+     f31:	c3                   	ret
+
+00000f32 <_exec>:
+RAWSYSCALL(exec)
+     f32:	b8 07 00 00 00       	mov    $0x7,%eax
+     f37:	89 e1                	mov    %esp,%ecx
+     f39:	ba 40 0f 00 00       	mov    $0xf40,%edx
+     f3e:	0f 34                	sysenter
+     f40:	c3                   	ret
+
+00000f41 <open>:
+SYSCALL(open)
+     f41:	b8 0f 00 00 00       	mov    $0xf,%eax
+     f46:	89 e1                	mov    %esp,%ecx
+     f48:	ba 4f 0f 00 00       	mov    $0xf4f,%edx
+     f4d:	0f 34                	sysenter
+     f4f:	c3                   	ret
+
+00000f50 <mknod>:
+SYSCALL(mknod)
+     f50:	b8 11 00 00 00       	mov    $0x11,%eax
+     f55:	89 e1                	mov    %esp,%ecx
+     f57:	ba 5e 0f 00 00       	mov    $0xf5e,%edx
+     f5c:	0f 34                	sysenter
+     f5e:	c3                   	ret
+
+00000f5f <unlink>:
+SYSCALL(unlink)
+     f5f:	b8 12 00 00 00       	mov    $0x12,%eax
+     f64:	89 e1                	mov    %esp,%ecx
+     f66:	ba 6d 0f 00 00       	mov    $0xf6d,%edx
+     f6b:	0f 34                	sysenter
+     f6d:	c3                   	ret
+
+00000f6e <fstat>:
+SYSCALL(fstat)
+     f6e:	b8 08 00 00 00       	mov    $0x8,%eax
+     f73:	89 e1                	mov    %esp,%ecx
+     f75:	ba 7c 0f 00 00       	mov    $0xf7c,%edx
+     f7a:	0f 34                	sysenter
+     f7c:	c3                   	ret
+
+00000f7d <link>:
+SYSCALL(link)
+     f7d:	b8 13 00 00 00       	mov    $0x13,%eax
+     f82:	89 e1                	mov    %esp,%ecx
+     f84:	ba 8b 0f 00 00       	mov    $0xf8b,%edx
+     f89:	0f 34                	sysenter
+     f8b:	c3                   	ret
+
+00000f8c <mkdir>:
+SYSCALL(mkdir)
+     f8c:	b8 14 00 00 00       	mov    $0x14,%eax
+     f91:	89 e1                	mov    %esp,%ecx
+     f93:	ba 9a 0f 00 00       	mov    $0xf9a,%edx
+     f98:	0f 34                	sysenter
+     f9a:	c3                   	ret
+
+00000f9b <chdir>:
+SYSCALL(chdir)
+     f9b:	b8 09 00 00 00       	mov    $0x9,%eax
+     fa0:	89 e1                	mov    %esp,%ecx
+     fa2:	ba a9 0f 00 00       	mov    $0xfa9,%edx
+     fa7:	0f 34                	sysenter
+     fa9:	c3                   	ret
+
+00000faa <dup>:
+SYSCALL(dup)
+     faa:	b8 0a 00 00 00       	mov    $0xa,%eax
+     faf:	89 e1                	mov    %esp,%ecx
+     fb1:	ba b8 0f 00 00       	mov    $0xfb8,%edx
+     fb6:	0f 34                	sysenter
+     fb8:	c3                   	ret
+
+00000fb9 <getpid>:
+SYSCALL(getpid)
+     fb9:	b8 0b 00 00 00       	mov    $0xb,%eax
+     fbe:	89 e1                	mov    %esp,%ecx
+     fc0:	ba c7 0f 00 00       	mov    $0xfc7,%edx
+     fc5:	0f 34                	sysenter
+     fc7:	c3                   	ret
+
+00000fc8 <sbrk>:
+SYSCALL(sbrk)
+     fc8:	b8 0c 00 00 00       	mov    $0xc,%eax
+     fcd:	89 e1                	mov    %esp,%ecx
+     fcf:	ba d6 0f 00 00       	mov    $0xfd6,%edx
+     fd4:	0f 34                	sysenter
+     fd6:	c3                   	ret
+
+00000fd7 <sleep>:
+SYSCALL(sleep)
+     fd7:	b8 0d 00 00 00       	mov    $0xd,%eax
+     fdc:	89 e1                	mov    %esp,%ecx
+     fde:	ba e5 0f 00 00       	mov    $0xfe5,%edx
+     fe3:	0f 34                	sysenter
+     fe5:	c3                   	ret
+
+00000fe6 <uptime>:
+SYSCALL(uptime)
+     fe6:	b8 0e 00 00 00       	mov    $0xe,%eax
+     feb:	89 e1                	mov    %esp,%ecx
+     fed:	ba f4 0f 00 00       	mov    $0xff4,%edx
+     ff2:	0f 34                	sysenter
+     ff4:	c3                   	ret
+
+00000ff5 <getproc>:
+SYSCALL(getproc)
+     ff5:	b8 16 00 00 00       	mov    $0x16,%eax
+     ffa:	89 e1                	mov    %esp,%ecx
+     ffc:	ba 03 10 00 00       	mov    $0x1003,%edx
+    1001:	0f 34                	sysenter
+    1003:	c3                   	ret
+
+00001004 <getpgs>:
+SYSCALL(getpgs)
+    1004:	b8 17 00 00 00       	mov    $0x17,%eax
+    1009:	89 e1                	mov    %esp,%ecx
+    100b:	ba 12 10 00 00       	mov    $0x1012,%edx
+    1010:	0f 34                	sysenter
+    1012:	c3                   	ret
+
+00001013 <loadproc>:
+SYSCALL(loadproc)
+    1013:	b8 18 00 00 00       	mov    $0x18,%eax
+    1018:	89 e1                	mov    %esp,%ecx
+    101a:	ba 21 10 00 00       	mov    $0x1021,%edx
+    101f:	0f 34                	sysenter
+    1021:	c3                   	ret
+
+00001022 <iosubmit>:
+SYSCALL(iosubmit)
+    1022:	b8 19 00 00 00       	mov    $0x19,%eax
+    1027:	89 e1                	mov    %esp,%ecx
+    1029:	ba 30 10 00 00       	mov    $0x1030,%edx
+    102e:	0f 34                	sysenter
+    1030:	c3                   	ret
+
+00001031 <sysstat>:
+SYSCALL(sysstat)
+    1031:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1036:	89 e1                	mov    %esp,%ecx
+    1038:	ba 3f 10 00 00       	mov    $0x103f,%edx
+    103d:	0f 34                	sysenter
+    103f:	c3                   	ret
+
+00001040 <splice>:
+SYSCALL(splice)
+    1040:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1045:	89 e1                	mov    %esp,%ecx
+    1047:	ba 4e 10 00 00       	mov    $0x104e,%edx
+    104c:	0f 34                	sysenter
+    104e:	c3                   	ret
+
+0000104f <fsync>:
+SYSCALL(fsync)
+    104f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1054:	89 e1                	mov    %esp,%ecx
+    1056:	ba 5d 10 00 00       	mov    $0x105d,%edx
+    105b:	0f 34                	sysenter
+    105d:	c3                   	ret
+
+0000105e <fdatasync>:
+SYSCALL(fdatasync)
+    105e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1063:	89 e1                	mov    %esp,%ecx
+    1065:	ba 6c 10 00 00       	mov    $0x106c,%edx
+    106a:	0f 34                	sysenter
+    106c:	c3                   	ret
+
+0000106d <lseek>:
+SYSCALL(lseek)
+    106d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1072:	89 e1                	mov    %esp,%ecx
+    1074:	ba 7b 10 00 00       	mov    $0x107b,%edx
+    1079:	0f 34                	sysenter
+    107b:	c3                   	ret
+
+0000107c <dmesg>:
+SYSCALL(dmesg)
+    107c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1081:	89 e1                	mov    %esp,%ecx
+    1083:	ba 8a 10 00 00       	mov    $0x108a,%edx
+    1088:	0f 34                	sysenter
+    108a:	c3                   	ret
+
+0000108b <lockstat>:
+SYSCALL(lockstat)
+    108b:	b8 20 00 00 00       	mov    $0x20,%eax
+    1090:	89 e1                	mov    %esp,%ecx
+    1092:	ba 99 10 00 00       	mov    $0x1099,%edx
+    1097:	0f 34                	sysenter
+    1099:	c3                   	ret
+
+0000109a <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    109a:	55                   	push   %ebp
+    109b:	89 e5                	mov    %esp,%ebp
+    109d:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    10a0:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+    10a7:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+    10ab:	74 17                	je     10c4 <printint+0x2a>
+    10ad:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    10b1:	79 11                	jns    10c4 <printint+0x2a>
+    neg = 1;
+    10b3:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+    10ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+    10bd:	f7 d8                	neg    %eax
+    10bf:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    10c2:	eb 06                	jmp    10ca <printint+0x30>
+  } else {
+    x = xx;
+    10c4:	8b 45 0c             	mov    0xc(%ebp),%eax
+    10c7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+    10ca:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+    10d1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    10d4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    10d7:	ba 00 00 00 00       	mov    $0x0,%edx
+    10dc:	f7 f1                	div    %ecx
+    10de:	89 d1                	mov    %edx,%ecx
+    10e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10e3:	8d 50 01             	lea    0x1(%eax),%edx
+    10e6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    10e9:	0f b6 91 0c 25 00 00 	movzbl 0x250c(%ecx),%edx
+    10f0:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+    10f4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    10f7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    10fa:	ba 00 00 00 00       	mov    $0x0,%edx
+    10ff:	f7 f1                	div    %ecx
+    1101:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1104:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1108:	75 c7                	jne    10d1 <printint+0x37>
+  if(neg)
+    110a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    110e:	74 2d                	je     113d <printint+0xa3>
+    buf[i++] = '-';
+    1110:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1113:	8d 50 01             	lea    0x1(%eax),%edx
+    1116:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    1119:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+    111e:	eb 1d                	jmp    113d <printint+0xa3>
+    fputc(fd, buf[i]);
+    1120:	8d 55 dc             	lea    -0x24(%ebp),%edx
+    1123:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1126:	01 d0                	add    %edx,%eax
+    1128:	0f b6 00             	movzbl (%eax),%eax
+    112b:	0f be c0             	movsbl %al,%eax
+    112e:	83 ec 08             	sub    $0x8,%esp
+    1131:	50                   	push   %eax
+    1132:	ff 75 08             	push   0x8(%ebp)
+    1135:	e8 f8 08 00 00       	call   1a32 <fputc>
+    113a:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+    113d:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    1141:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1145:	79 d9                	jns    1120 <printint+0x86>
+}
+    1147:	90                   	nop
+    1148:	90                   	nop
+    1149:	c9                   	leave
+    114a:	c3                   	ret
+
+0000114b <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    114b:	55                   	push   %ebp
+    114c:	89 e5                	mov    %esp,%ebp
+    114e:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+    1151:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+    1158:	8d 45 0c             	lea    0xc(%ebp),%eax
+    115b:	83 c0 04             	add    $0x4,%eax
+    115e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+    1161:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    1168:	e9 4a 01 00 00       	jmp    12b7 <printf+0x16c>
+    c = fmt[i] & 0xff;
+    116d:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1170:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1173:	01 d0                	add    %edx,%eax
+    1175:	0f b6 00             	movzbl (%eax),%eax
+    1178:	0f be c0             	movsbl %al,%eax
+    117b:	25 ff 00 00 00       	and    $0xff,%eax
+    1180:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+    1183:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1187:	75 28                	jne    11b1 <printf+0x66>
+      if(c == '%'){
+    1189:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    118d:	75 0c                	jne    119b <printf+0x50>
+        state = '%';
+    118f:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+    1196:	e9 18 01 00 00       	jmp    12b3 <printf+0x168>
+      } else {
+        fputc(fd, c);
+    119b:	83 ec 08             	sub    $0x8,%esp
+    119e:	ff 75 e4             	push   -0x1c(%ebp)
+    11a1:	ff 75 08             	push   0x8(%ebp)
+    11a4:	e8 89 08 00 00       	call   1a32 <fputc>
+    11a9:	83 c4 10             	add    $0x10,%esp
+    11ac:	e9 02 01 00 00       	jmp    12b3 <printf+0x168>
+      }
+    } else if(state == '%'){
+    11b1:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+    11b5:	0f 85 f8 00 00 00    	jne    12b3 <printf+0x168>
+      if(c == 'd'){
+    11bb:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+    11bf:	75 1e                	jne    11df <printf+0x94>
+        printint(fd, *ap, 10, 1);
+    11c1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    11c4:	8b 00                	mov    (%eax),%eax
+    11c6:	6a 01                	push   $0x1
+    11c8:	6a 0a                	push   $0xa
+    11ca:	50                   	push   %eax
+    11cb:	ff 75 08             	push   0x8(%ebp)
+    11ce:	e8 c7 fe ff ff       	call   109a <printint>
+    11d3:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    11d6:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    11da:	e9 cd 00 00 00       	jmp    12ac <printf+0x161>
+      } else if(c == 'x' || c == 'p'){
+    11df:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+    11e3:	74 06                	je     11eb <printf+0xa0>
+    11e5:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+    11e9:	75 1e                	jne    1209 <printf+0xbe>
+        printint(fd, *ap, 16, 0);
+    11eb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    11ee:	8b 00                	mov    (%eax),%eax
+    11f0:	6a 00                	push   $0x0
+    11f2:	6a 10                	push   $0x10
+    11f4:	50                   	push   %eax
+    11f5:	ff 75 08             	push   0x8(%ebp)
+    11f8:	e8 9d fe ff ff       	call   109a <printint>
+    11fd:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    1200:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    1204:	e9 a3 00 00 00       	jmp    12ac <printf+0x161>
+      } else if(c == 's'){
+    1209:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+    120d:	75 43                	jne    1252 <printf+0x107>
+        s = (char*)*ap;
+    120f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1212:	8b 00                	mov    (%eax),%eax
+    1214:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+    1217:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+    121b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    121f:	75 25                	jne    1246 <printf+0xfb>
+          s = "(null)";
+    1221:	c7 45 f4 3d 20 00 00 	movl   $0x203d,-0xc(%ebp)
+        while(*s != 0){
+    1228:	eb 1c                	jmp    1246 <printf+0xfb>
+          fputc(fd, *s);
+    122a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    122d:	0f b6 00             	movzbl (%eax),%eax
+    1230:	0f be c0             	movsbl %al,%eax
+    1233:	83 ec 08             	sub    $0x8,%esp
+    1236:	50                   	push   %eax
+    1237:	ff 75 08             	push   0x8(%ebp)
+    123a:	e8 f3 07 00 00       	call   1a32 <fputc>
+    123f:	83 c4 10             	add    $0x10,%esp
+          s++;
+    1242:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+    1246:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1249:	0f b6 00             	movzbl (%eax),%eax
+    124c:	84 c0                	test   %al,%al
+    124e:	75 da                	jne    122a <printf+0xdf>
+    1250:	eb 5a                	jmp    12ac <printf+0x161>
+        }
+      } else if(c == 'c'){
+    1252:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+    1256:	75 1a                	jne    1272 <printf+0x127>
+        fputc(fd, *ap);
+    1258:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    125b:	8b 00                	mov    (%eax),%eax
+    125d:	83 ec 08             	sub    $0x8,%esp
+    1260:	50                   	push   %eax
+    1261:	ff 75 08             	push   0x8(%ebp)
+    1264:	e8 c9 07 00 00       	call   1a32 <fputc>
+    1269:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    126c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    1270:	eb 3a                	jmp    12ac <printf+0x161>
+      } else if(c == '%'){
+    1272:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    1276:	75 13                	jne    128b <printf+0x140>
+        fputc(fd, c);
+    1278:	83 ec 08             	sub    $0x8,%esp
+    127b:	ff 75 e4             	push   -0x1c(%ebp)
+    127e:	ff 75 08             	push   0x8(%ebp)
+    1281:	e8 ac 07 00 00       	call   1a32 <fputc>
+    1286:	83 c4 10             	add    $0x10,%esp
+    1289:	eb 21                	jmp    12ac <printf+0x161>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        fputc(fd, '%');
+    128b:	83 ec 08             	sub    $0x8,%esp
+    128e:	6a 25                	push   $0x25
+    1290:	ff 75 08             	push   0x8(%ebp)
+    1293:	e8 9a 07 00 00       	call   1a32 <fputc>
+    1298:	83 c4 10             	add    $0x10,%esp
+        fputc(fd, c);
+    129b:	83 ec 08             	sub    $0x8,%esp
+    129e:	ff 75 e4             	push   -0x1c(%ebp)
+    12a1:	ff 75 08             	push   0x8(%ebp)
+    12a4:	e8 89 07 00 00       	call   1a32 <fputc>
+    12a9:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+    12ac:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+    12b3:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    12b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+    12ba:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    12bd:	01 d0                	add    %edx,%eax
+    12bf:	0f b6 00             	movzbl (%eax),%eax
+    12c2:	84 c0                	test   %al,%al
+    12c4:	0f 85 a3 fe ff ff    	jne    116d <printf+0x22>
+    }
+  }
+}
+    12ca:	90                   	nop
+    12cb:	90                   	nop
+    12cc:	c9                   	leave
+    12cd:	c3                   	ret
+
+000012ce <binof>:
+static struct chunk *bins[NBIN];       // free large chunks
+static struct chunk *top;              // end marker of newest heap segment
+
+static int
+binof(uint size)
+{
+    12ce:	55                   	push   %ebp
+    12cf:	89 e5                	mov    %esp,%ebp
+    12d1:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  i = 0;
+    12d4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+    12db:	c1 6d 08 05          	shrl   $0x5,0x8(%ebp)
+    12df:	eb 07                	jmp    12e8 <binof+0x1a>
+    i++;
+    12e1:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+    12e5:	d1 6d 08             	shrl   0x8(%ebp)
+    12e8:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    12ec:	74 06                	je     12f4 <binof+0x26>
+    12ee:	83 7d fc 19          	cmpl   $0x19,-0x4(%ebp)
+    12f2:	7e ed                	jle    12e1 <binof+0x13>
+  return i;
+    12f4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    12f7:	c9                   	leave
+    12f8:	c3                   	ret
+
+000012f9 <bininsert>:
+
+static void
+bininsert(struct chunk *c)
+{
+    12f9:	55                   	push   %ebp
+    12fa:	89 e5                	mov    %esp,%ebp
+    12fc:	83 ec 10             	sub    $0x10,%esp
+  struct chunk **b;
+
+  b = &bins[binof(CSIZE(c))];
+    12ff:	8b 45 08             	mov    0x8(%ebp),%eax
+    1302:	8b 00                	mov    (%eax),%eax
+    1304:	83 e0 f8             	and    $0xfffffff8,%eax
+    1307:	50                   	push   %eax
+    1308:	e8 c1 ff ff ff       	call   12ce <binof>
+    130d:	83 c4 04             	add    $0x4,%esp
+    1310:	c1 e0 02             	shl    $0x2,%eax
+    1313:	05 40 25 00 00       	add    $0x2540,%eax
+    1318:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c->prev = 0;
+    131b:	8b 45 08             	mov    0x8(%ebp),%eax
+    131e:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  c->next = *b;
+    1325:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1328:	8b 10                	mov    (%eax),%edx
+    132a:	8b 45 08             	mov    0x8(%ebp),%eax
+    132d:	89 50 08             	mov    %edx,0x8(%eax)
+  if(*b)
+    1330:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1333:	8b 00                	mov    (%eax),%eax
+    1335:	85 c0                	test   %eax,%eax
+    1337:	74 0b                	je     1344 <bininsert+0x4b>
+    (*b)->prev = c;
+    1339:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    133c:	8b 00                	mov    (%eax),%eax
+    133e:	8b 55 08             	mov    0x8(%ebp),%edx
+    1341:	89 50 0c             	mov    %edx,0xc(%eax)
+  *b = c;
+    1344:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1347:	8b 55 08             	mov    0x8(%ebp),%edx
+    134a:	89 10                	mov    %edx,(%eax)
+}
+    134c:	90                   	nop
+    134d:	c9                   	leave
+    134e:	c3                   	ret
+
+0000134f <binremove>:
+
+static void
+binremove(struct chunk *c)
+{
+    134f:	55                   	push   %ebp
+    1350:	89 e5                	mov    %esp,%ebp
+  if(c->prev)
+    1352:	8b 45 08             	mov    0x8(%ebp),%eax
+    1355:	8b 40 0c             	mov    0xc(%eax),%eax
+    1358:	85 c0                	test   %eax,%eax
+    135a:	74 11                	je     136d <binremove+0x1e>
+    c->prev->next = c->next;
+    135c:	8b 45 08             	mov    0x8(%ebp),%eax
+    135f:	8b 40 0c             	mov    0xc(%eax),%eax
+    1362:	8b 55 08             	mov    0x8(%ebp),%edx
+    1365:	8b 52 08             	mov    0x8(%edx),%edx
+    1368:	89 50 08             	mov    %edx,0x8(%eax)
+    136b:	eb 1e                	jmp    138b <binremove+0x3c>
+  else
+    bins[binof(CSIZE(c))] = c->next;
+    136d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1370:	8b 00                	mov    (%eax),%eax
+    1372:	83 e0 f8             	and    $0xfffffff8,%eax
+    1375:	50                   	push   %eax
+    1376:	e8 53 ff ff ff       	call   12ce <binof>
+    137b:	83 c4 04             	add    $0x4,%esp
+    137e:	8b 55 08             	mov    0x8(%ebp),%edx
+    1381:	8b 52 08             	mov    0x8(%edx),%edx
+    1384:	89 14 85 40 25 00 00 	mov    %edx,0x2540(,%eax,4)
+  if(c->next)
+    138b:	8b 45 08             	mov    0x8(%ebp),%eax
+    138e:	8b 40 08             	mov    0x8(%eax),%eax
+    1391:	85 c0                	test   %eax,%eax
+    1393:	74 0f                	je     13a4 <binremove+0x55>
+    c->next->prev = c->prev;
+    1395:	8b 45 08             	mov    0x8(%ebp),%eax
+    1398:	8b 40 08             	mov    0x8(%eax),%eax
+    139b:	8b 55 08             	mov    0x8(%ebp),%edx
+    139e:	8b 52 0c             	mov    0xc(%edx),%edx
+    13a1:	89 50 0c             	mov    %edx,0xc(%eax)
+}
+    13a4:	90                   	nop
+    13a5:	c9                   	leave
+    13a6:	c3                   	ret
+
+000013a7 <freechunk>:
+
+// Free chunk c, merging it with free neighbors.  If trim is
+// set and the result is big and at the break, give it back.
+static void
+freechunk(struct chunk *c, int trim)
+{
+    13a7:	55                   	push   %ebp
+    13a8:	89 e5                	mov    %esp,%ebp
+    13aa:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *p, *n;
+  uint size;
+
+  size = CSIZE(c);
+    13ad:	8b 45 08             	mov    0x8(%ebp),%eax
+    13b0:	8b 00                	mov    (%eax),%eax
+    13b2:	83 e0 f8             	and    $0xfffffff8,%eax
+    13b5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  n = NEXTC(c);
+    13b8:	8b 45 08             	mov    0x8(%ebp),%eax
+    13bb:	8b 00                	mov    (%eax),%eax
+    13bd:	83 e0 f8             	and    $0xfffffff8,%eax
+    13c0:	89 c2                	mov    %eax,%edx
+    13c2:	8b 45 08             	mov    0x8(%ebp),%eax
+    13c5:	01 d0                	add    %edx,%eax
+    13c7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(!(c->size & PREVUSED)){
+    13ca:	8b 45 08             	mov    0x8(%ebp),%eax
+    13cd:	8b 00                	mov    (%eax),%eax
+    13cf:	83 e0 02             	and    $0x2,%eax
+    13d2:	85 c0                	test   %eax,%eax
+    13d4:	75 30                	jne    1406 <freechunk+0x5f>
+    p = (struct chunk*)((char*)c - *((uint*)c - 1));
+    13d6:	8b 45 08             	mov    0x8(%ebp),%eax
+    13d9:	83 e8 04             	sub    $0x4,%eax
+    13dc:	8b 00                	mov    (%eax),%eax
+    13de:	f7 d8                	neg    %eax
+    13e0:	89 c2                	mov    %eax,%edx
+    13e2:	8b 45 08             	mov    0x8(%ebp),%eax
+    13e5:	01 d0                	add    %edx,%eax
+    13e7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    binremove(p);
+    13ea:	ff 75 ec             	push   -0x14(%ebp)
+    13ed:	e8 5d ff ff ff       	call   134f <binremove>
+    13f2:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(p);
+    13f5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    13f8:	8b 00                	mov    (%eax),%eax
+    13fa:	83 e0 f8             	and    $0xfffffff8,%eax
+    13fd:	01 45 f4             	add    %eax,-0xc(%ebp)
+    c = p;
+    1400:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1403:	89 45 08             	mov    %eax,0x8(%ebp)
+  }
+  if(!(n->size & USED)){
+    1406:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1409:	8b 00                	mov    (%eax),%eax
+    140b:	83 e0 01             	and    $0x1,%eax
+    140e:	85 c0                	test   %eax,%eax
+    1410:	75 16                	jne    1428 <freechunk+0x81>
+    binremove(n);
+    1412:	ff 75 f0             	push   -0x10(%ebp)
+    1415:	e8 35 ff ff ff       	call   134f <binremove>
+    141a:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(n);
+    141d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1420:	8b 00                	mov    (%eax),%eax
+    1422:	83 e0 f8             	and    $0xfffffff8,%eax
+    1425:	01 45 f4             	add    %eax,-0xc(%ebp)
+  }
+  // Free chunks are never adjacent, so the one below is in use.
+  c->size = size | PREVUSED;
+    1428:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    142b:	83 c8 02             	or     $0x2,%eax
+    142e:	89 c2                	mov    %eax,%edx
+    1430:	8b 45 08             	mov    0x8(%ebp),%eax
+    1433:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+    1435:	8b 45 08             	mov    0x8(%ebp),%eax
+    1438:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  FOOTER(c) = size;
+    143f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1442:	8b 00                	mov    (%eax),%eax
+    1444:	83 e0 f8             	and    $0xfffffff8,%eax
+    1447:	8d 50 fc             	lea    -0x4(%eax),%edx
+    144a:	8b 45 08             	mov    0x8(%ebp),%eax
+    144d:	01 c2                	add    %eax,%edx
+    144f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1452:	89 02                	mov    %eax,(%edx)
+  n = NEXTC(c);
+    1454:	8b 45 08             	mov    0x8(%ebp),%eax
+    1457:	8b 00                	mov    (%eax),%eax
+    1459:	83 e0 f8             	and    $0xfffffff8,%eax
+    145c:	89 c2                	mov    %eax,%edx
+    145e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1461:	01 d0                	add    %edx,%eax
+    1463:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  n->size &= ~PREVUSED;
+    1466:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1469:	8b 00                	mov    (%eax),%eax
+    146b:	83 e0 fd             	and    $0xfffffffd,%eax
+    146e:	89 c2                	mov    %eax,%edx
+    1470:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1473:	89 10                	mov    %edx,(%eax)
+
+  if(trim && n == top && size >= TRIMSIZE && sbrk(0) == (char*)top + HDRSIZE){
+    1475:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    1479:	74 51                	je     14cc <freechunk+0x125>
+    147b:	a1 ac 25 00 00       	mov    0x25ac,%eax
+    1480:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+    1483:	75 47                	jne    14cc <freechunk+0x125>
+    1485:	81 7d f4 ff 7f 00 00 	cmpl   $0x7fff,-0xc(%ebp)
+    148c:	76 3e                	jbe    14cc <freechunk+0x125>
+    148e:	83 ec 0c             	sub    $0xc,%esp
+    1491:	6a 00                	push   $0x0
+    1493:	e8 30 fb ff ff       	call   fc8 <sbrk>
+    1498:	83 c4 10             	add    $0x10,%esp
+    149b:	8b 15 ac 25 00 00    	mov    0x25ac,%edx
+    14a1:	83 c2 08             	add    $0x8,%edx
+    14a4:	39 d0                	cmp    %edx,%eax
+    14a6:	75 24                	jne    14cc <freechunk+0x125>
+    c->size = USED | PREVUSED;
+    14a8:	8b 45 08             	mov    0x8(%ebp),%eax
+    14ab:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+    top = c;
+    14b1:	8b 45 08             	mov    0x8(%ebp),%eax
+    14b4:	a3 ac 25 00 00       	mov    %eax,0x25ac
+    sbrk(-size);
+    14b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14bc:	f7 d8                	neg    %eax
+    14be:	83 ec 0c             	sub    $0xc,%esp
+    14c1:	50                   	push   %eax
+    14c2:	e8 01 fb ff ff       	call   fc8 <sbrk>
+    14c7:	83 c4 10             	add    $0x10,%esp
+    return;
+    14ca:	eb 0e                	jmp    14da <freechunk+0x133>
+  }
+  bininsert(c);
+    14cc:	83 ec 0c             	sub    $0xc,%esp
+    14cf:	ff 75 08             	push   0x8(%ebp)
+    14d2:	e8 22 fe ff ff       	call   12f9 <bininsert>
+    14d7:	83 c4 10             	add    $0x10,%esp
+}
+    14da:	c9                   	leave
+    14db:	c3                   	ret
+
+000014dc <morecore>:
+
+// Grow the heap by at least need bytes.
+static int
+morecore(uint need)
+{
+    14dc:	55                   	push   %ebp
+    14dd:	89 e5                	mov    %esp,%ebp
+    14df:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+  char *p;
+  uint n, pad;
+
+  n = need + MINCHUNK;
+    14e2:	8b 45 08             	mov    0x8(%ebp),%eax
+    14e5:	83 c0 18             	add    $0x18,%eax
+    14e8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(n < MINCORE)
+    14eb:	81 7d ec ff 3f 00 00 	cmpl   $0x3fff,-0x14(%ebp)
+    14f2:	77 07                	ja     14fb <morecore+0x1f>
+    n = MINCORE;
+    14f4:	c7 45 ec 00 40 00 00 	movl   $0x4000,-0x14(%ebp)
+  // Keep the break 8-aligned, with the end marker just below it.
+  pad = (8 - ((uint)sbrk(0) & 7)) & 7;
+    14fb:	83 ec 0c             	sub    $0xc,%esp
+    14fe:	6a 00                	push   $0x0
+    1500:	e8 c3 fa ff ff       	call   fc8 <sbrk>
+    1505:	83 c4 10             	add    $0x10,%esp
+    1508:	83 e0 07             	and    $0x7,%eax
+    150b:	ba 08 00 00 00       	mov    $0x8,%edx
+    1510:	29 c2                	sub    %eax,%edx
+    1512:	89 d0                	mov    %edx,%eax
+    1514:	83 e0 07             	and    $0x7,%eax
+    1517:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if((p = sbrk(pad + n)) == (char*)-1){
+    151a:	8b 55 e8             	mov    -0x18(%ebp),%edx
+    151d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1520:	01 d0                	add    %edx,%eax
+    1522:	83 ec 0c             	sub    $0xc,%esp
+    1525:	50                   	push   %eax
+    1526:	e8 9d fa ff ff       	call   fc8 <sbrk>
+    152b:	83 c4 10             	add    $0x10,%esp
+    152e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1531:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+    1535:	75 30                	jne    1567 <morecore+0x8b>
+    n = need + MINCHUNK;
+    1537:	8b 45 08             	mov    0x8(%ebp),%eax
+    153a:	83 c0 18             	add    $0x18,%eax
+    153d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((p = sbrk(pad + n)) == (char*)-1)
+    1540:	8b 55 e8             	mov    -0x18(%ebp),%edx
+    1543:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1546:	01 d0                	add    %edx,%eax
+    1548:	83 ec 0c             	sub    $0xc,%esp
+    154b:	50                   	push   %eax
+    154c:	e8 77 fa ff ff       	call   fc8 <sbrk>
+    1551:	83 c4 10             	add    $0x10,%esp
+    1554:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1557:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+    155b:	75 0a                	jne    1567 <morecore+0x8b>
+      return -1;
+    155d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1562:	e9 8e 00 00 00       	jmp    15f5 <morecore+0x119>
+  }
+  p += pad;
+    1567:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    156a:	01 45 f0             	add    %eax,-0x10(%ebp)
+  if(top && p == (char*)top + HDRSIZE){
+    156d:	a1 ac 25 00 00       	mov    0x25ac,%eax
+    1572:	85 c0                	test   %eax,%eax
+    1574:	74 29                	je     159f <morecore+0xc3>
+    1576:	a1 ac 25 00 00       	mov    0x25ac,%eax
+    157b:	83 c0 08             	add    $0x8,%eax
+    157e:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+    1581:	75 1c                	jne    159f <morecore+0xc3>
+    // Contiguous: the old end marker heads the new chunk.
+    c = top;
+    1583:	a1 ac 25 00 00       	mov    0x25ac,%eax
+    1588:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = n | (c->size & PREVUSED);
+    158b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    158e:	8b 00                	mov    (%eax),%eax
+    1590:	83 e0 02             	and    $0x2,%eax
+    1593:	0b 45 ec             	or     -0x14(%ebp),%eax
+    1596:	89 c2                	mov    %eax,%edx
+    1598:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    159b:	89 10                	mov    %edx,(%eax)
+    159d:	eb 16                	jmp    15b5 <morecore+0xd9>
+  } else {
+    // Someone else moved the break: start a new segment.
+    c = (struct chunk*)p;
+    159f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    15a2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = (n - HDRSIZE) | PREVUSED;
+    15a5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    15a8:	83 e8 08             	sub    $0x8,%eax
+    15ab:	83 c8 02             	or     $0x2,%eax
+    15ae:	89 c2                	mov    %eax,%edx
+    15b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15b3:	89 10                	mov    %edx,(%eax)
+  }
+  top = NEXTC(c);
+    15b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15b8:	8b 00                	mov    (%eax),%eax
+    15ba:	83 e0 f8             	and    $0xfffffff8,%eax
+    15bd:	89 c2                	mov    %eax,%edx
+    15bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15c2:	01 d0                	add    %edx,%eax
+    15c4:	a3 ac 25 00 00       	mov    %eax,0x25ac
+  top->size = USED;
+    15c9:	a1 ac 25 00 00       	mov    0x25ac,%eax
+    15ce:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  top->tag = LARGE;
+    15d4:	a1 ac 25 00 00       	mov    0x25ac,%eax
+    15d9:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  freechunk(c, 0);
+    15e0:	83 ec 08             	sub    $0x8,%esp
+    15e3:	6a 00                	push   $0x0
+    15e5:	ff 75 f4             	push   -0xc(%ebp)
+    15e8:	e8 ba fd ff ff       	call   13a7 <freechunk>
+    15ed:	83 c4 10             	add    $0x10,%esp
+  return 0;
+    15f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    15f5:	c9                   	leave
+    15f6:	c3                   	ret
+
+000015f7 <largealloc>:
+
+static void*
+largealloc(uint nbytes)
+{
+    15f7:	55                   	push   %ebp
+    15f8:	89 e5                	mov    %esp,%ebp
+    15fa:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c, *r;
+  uint need;
+  int i;
+
+  if(nbytes > 0x7fffffff)
+    15fd:	8b 45 08             	mov    0x8(%ebp),%eax
+    1600:	85 c0                	test   %eax,%eax
+    1602:	79 0a                	jns    160e <largealloc+0x17>
+    return 0;
+    1604:	b8 00 00 00 00       	mov    $0x0,%eax
+    1609:	e9 43 01 00 00       	jmp    1751 <largealloc+0x15a>
+  need = (nbytes + HDRSIZE + 7) & ~7;
+    160e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1611:	83 c0 0f             	add    $0xf,%eax
+    1614:	83 e0 f8             	and    $0xfffffff8,%eax
+    1617:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(need < MINCHUNK)
+    161a:	83 7d f0 17          	cmpl   $0x17,-0x10(%ebp)
+    161e:	77 07                	ja     1627 <largealloc+0x30>
+    need = MINCHUNK;
+    1620:	c7 45 f0 18 00 00 00 	movl   $0x18,-0x10(%ebp)
+  for(;;){
+    for(i = binof(need); i < NBIN; i++)
+    1627:	ff 75 f0             	push   -0x10(%ebp)
+    162a:	e8 9f fc ff ff       	call   12ce <binof>
+    162f:	83 c4 04             	add    $0x4,%esp
+    1632:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1635:	eb 2f                	jmp    1666 <largealloc+0x6f>
+      for(c = bins[i]; c; c = c->next)
+    1637:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    163a:	8b 04 85 40 25 00 00 	mov    0x2540(,%eax,4),%eax
+    1641:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1644:	eb 16                	jmp    165c <largealloc+0x65>
+        if(CSIZE(c) >= need)
+    1646:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1649:	8b 00                	mov    (%eax),%eax
+    164b:	83 e0 f8             	and    $0xfffffff8,%eax
+    164e:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+    1651:	73 35                	jae    1688 <largealloc+0x91>
+      for(c = bins[i]; c; c = c->next)
+    1653:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1656:	8b 40 08             	mov    0x8(%eax),%eax
+    1659:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    165c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1660:	75 e4                	jne    1646 <largealloc+0x4f>
+    for(i = binof(need); i < NBIN; i++)
+    1662:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    1666:	83 7d ec 1a          	cmpl   $0x1a,-0x14(%ebp)
+    166a:	7e cb                	jle    1637 <largealloc+0x40>
+          goto found;
+    if(morecore(need) < 0)
+    166c:	83 ec 0c             	sub    $0xc,%esp
+    166f:	ff 75 f0             	push   -0x10(%ebp)
+    1672:	e8 65 fe ff ff       	call   14dc <morecore>
+    1677:	83 c4 10             	add    $0x10,%esp
+    167a:	85 c0                	test   %eax,%eax
+    167c:	79 a9                	jns    1627 <largealloc+0x30>
+      return 0;
+    167e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1683:	e9 c9 00 00 00       	jmp    1751 <largealloc+0x15a>
+          goto found;
+    1688:	90                   	nop
+  }
+
+found:
+  binremove(c);
+    1689:	83 ec 0c             	sub    $0xc,%esp
+    168c:	ff 75 f4             	push   -0xc(%ebp)
+    168f:	e8 bb fc ff ff       	call   134f <binremove>
+    1694:	83 c4 10             	add    $0x10,%esp
+  if(CSIZE(c) - need >= MINCHUNK){
+    1697:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    169a:	8b 00                	mov    (%eax),%eax
+    169c:	83 e0 f8             	and    $0xfffffff8,%eax
+    169f:	2b 45 f0             	sub    -0x10(%ebp),%eax
+    16a2:	83 f8 17             	cmp    $0x17,%eax
+    16a5:	76 66                	jbe    170d <largealloc+0x116>
+    r = (struct chunk*)((char*)c + need);
+    16a7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    16aa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    16ad:	01 d0                	add    %edx,%eax
+    16af:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    r->size = (CSIZE(c) - need) | PREVUSED;
+    16b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    16b5:	8b 00                	mov    (%eax),%eax
+    16b7:	83 e0 f8             	and    $0xfffffff8,%eax
+    16ba:	2b 45 f0             	sub    -0x10(%ebp),%eax
+    16bd:	83 c8 02             	or     $0x2,%eax
+    16c0:	89 c2                	mov    %eax,%edx
+    16c2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    16c5:	89 10                	mov    %edx,(%eax)
+    r->tag = LARGE;
+    16c7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    16ca:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+    FOOTER(r) = CSIZE(r);
+    16d1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    16d4:	8b 10                	mov    (%eax),%edx
+    16d6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    16d9:	8b 00                	mov    (%eax),%eax
+    16db:	83 e0 f8             	and    $0xfffffff8,%eax
+    16de:	8d 48 fc             	lea    -0x4(%eax),%ecx
+    16e1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    16e4:	01 c8                	add    %ecx,%eax
+    16e6:	83 e2 f8             	and    $0xfffffff8,%edx
+    16e9:	89 10                	mov    %edx,(%eax)
+    bininsert(r);
+    16eb:	83 ec 0c             	sub    $0xc,%esp
+    16ee:	ff 75 e8             	push   -0x18(%ebp)
+    16f1:	e8 03 fc ff ff       	call   12f9 <bininsert>
+    16f6:	83 c4 10             	add    $0x10,%esp
+    c->size = need | (c->size & PREVUSED);
+    16f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    16fc:	8b 00                	mov    (%eax),%eax
+    16fe:	83 e0 02             	and    $0x2,%eax
+    1701:	0b 45 f0             	or     -0x10(%ebp),%eax
+    1704:	89 c2                	mov    %eax,%edx
+    1706:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1709:	89 10                	mov    %edx,(%eax)
+    170b:	eb 25                	jmp    1732 <largealloc+0x13b>
+  } else
+    NEXTC(c)->size |= PREVUSED;
+    170d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1710:	8b 00                	mov    (%eax),%eax
+    1712:	83 e0 f8             	and    $0xfffffff8,%eax
+    1715:	89 c2                	mov    %eax,%edx
+    1717:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    171a:	01 d0                	add    %edx,%eax
+    171c:	8b 10                	mov    (%eax),%edx
+    171e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1721:	8b 00                	mov    (%eax),%eax
+    1723:	83 e0 f8             	and    $0xfffffff8,%eax
+    1726:	89 c1                	mov    %eax,%ecx
+    1728:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    172b:	01 c8                	add    %ecx,%eax
+    172d:	83 ca 02             	or     $0x2,%edx
+    1730:	89 10                	mov    %edx,(%eax)
+  c->size |= USED;
+    1732:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1735:	8b 00                	mov    (%eax),%eax
+    1737:	83 c8 01             	or     $0x1,%eax
+    173a:	89 c2                	mov    %eax,%edx
+    173c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    173f:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+    1741:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1744:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  return (char*)c + HDRSIZE;
+    174b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    174e:	83 c0 08             	add    $0x8,%eax
+}
+    1751:	c9                   	leave
+    1752:	c3                   	ret
+
+00001753 <refill>:
+
+// Carve a slab into free blocks of class k.
+static int
+refill(int k)
+{
+    1753:	55                   	push   %ebp
+    1754:	89 e5                	mov    %esp,%ebp
+    1756:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  char *p;
+  uint bs, i;
+
+  if((p = largealloc(SLABSIZE)) == 0)
+    1759:	83 ec 0c             	sub    $0xc,%esp
+    175c:	68 00 20 00 00       	push   $0x2000
+    1761:	e8 91 fe ff ff       	call   15f7 <largealloc>
+    1766:	83 c4 10             	add    $0x10,%esp
+    1769:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    176c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1770:	75 07                	jne    1779 <refill+0x26>
+    return -1;
+    1772:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1777:	eb 75                	jmp    17ee <refill+0x9b>
+  bs = HDRSIZE + (MINSMALL << k);
+    1779:	8b 45 08             	mov    0x8(%ebp),%eax
+    177c:	ba 10 00 00 00       	mov    $0x10,%edx
+    1781:	89 c1                	mov    %eax,%ecx
+    1783:	d3 e2                	shl    %cl,%edx
+    1785:	89 d0                	mov    %edx,%eax
+    1787:	83 c0 08             	add    $0x8,%eax
+    178a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+    178d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1794:	eb 44                	jmp    17da <refill+0x87>
+    b = (struct chunk*)(p + i);
+    1796:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    1799:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    179c:	01 d0                	add    %edx,%eax
+    179e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    b->size = bs | USED;
+    17a1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    17a4:	83 c8 01             	or     $0x1,%eax
+    17a7:	89 c2                	mov    %eax,%edx
+    17a9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    17ac:	89 10                	mov    %edx,(%eax)
+    b->tag = k;
+    17ae:	8b 55 08             	mov    0x8(%ebp),%edx
+    17b1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    17b4:	89 50 04             	mov    %edx,0x4(%eax)
+    b->next = classes[k];
+    17b7:	8b 45 08             	mov    0x8(%ebp),%eax
+    17ba:	8b 14 85 20 25 00 00 	mov    0x2520(,%eax,4),%edx
+    17c1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    17c4:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[k] = b;
+    17c7:	8b 45 08             	mov    0x8(%ebp),%eax
+    17ca:	8b 55 e8             	mov    -0x18(%ebp),%edx
+    17cd:	89 14 85 20 25 00 00 	mov    %edx,0x2520(,%eax,4)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+    17d4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    17d7:	01 45 f4             	add    %eax,-0xc(%ebp)
+    17da:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    17dd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    17e0:	01 d0                	add    %edx,%eax
+    17e2:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    17e7:	76 ad                	jbe    1796 <refill+0x43>
+  }
+  return 0;
+    17e9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    17ee:	c9                   	leave
+    17ef:	c3                   	ret
+
+000017f0 <free>:
+
+void
+free(void *ap)
+{
+    17f0:	55                   	push   %ebp
+    17f1:	89 e5                	mov    %esp,%ebp
+    17f3:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+
+  if(ap == 0)
+    17f6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    17fa:	74 4b                	je     1847 <free+0x57>
+    return;
+  c = (struct chunk*)((char*)ap - HDRSIZE);
+    17fc:	8b 45 08             	mov    0x8(%ebp),%eax
+    17ff:	83 e8 08             	sub    $0x8,%eax
+    1802:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(c->tag != LARGE){
+    1805:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1808:	8b 40 04             	mov    0x4(%eax),%eax
+    180b:	83 f8 ff             	cmp    $0xffffffff,%eax
+    180e:	74 25                	je     1835 <free+0x45>
+    c->next = classes[c->tag];
+    1810:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1813:	8b 40 04             	mov    0x4(%eax),%eax
+    1816:	8b 14 85 20 25 00 00 	mov    0x2520(,%eax,4),%edx
+    181d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1820:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[c->tag] = c;
+    1823:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1826:	8b 40 04             	mov    0x4(%eax),%eax
+    1829:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    182c:	89 14 85 20 25 00 00 	mov    %edx,0x2520(,%eax,4)
+    return;
+    1833:	eb 13                	jmp    1848 <free+0x58>
+  }
+  freechunk(c, 1);
+    1835:	83 ec 08             	sub    $0x8,%esp
+    1838:	6a 01                	push   $0x1
+    183a:	ff 75 f4             	push   -0xc(%ebp)
+    183d:	e8 65 fb ff ff       	call   13a7 <freechunk>
+    1842:	83 c4 10             	add    $0x10,%esp
+    1845:	eb 01                	jmp    1848 <free+0x58>
+    return;
+    1847:	90                   	nop
+}
+    1848:	c9                   	leave
+    1849:	c3                   	ret
+
+0000184a <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    184a:	55                   	push   %ebp
+    184b:	89 e5                	mov    %esp,%ebp
+    184d:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  int k;
+
+  if(nbytes > MAXSMALL)
+    1850:	81 7d 08 00 08 00 00 	cmpl   $0x800,0x8(%ebp)
+    1857:	76 10                	jbe    1869 <malloc+0x1f>
+    return largealloc(nbytes);
+    1859:	83 ec 0c             	sub    $0xc,%esp
+    185c:	ff 75 08             	push   0x8(%ebp)
+    185f:	e8 93 fd ff ff       	call   15f7 <largealloc>
+    1864:	83 c4 10             	add    $0x10,%esp
+    1867:	eb 6a                	jmp    18d3 <malloc+0x89>
+  for(k = 0; (MINSMALL << k) < nbytes; k++)
+    1869:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1870:	eb 04                	jmp    1876 <malloc+0x2c>
+    1872:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1876:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1879:	ba 10 00 00 00       	mov    $0x10,%edx
+    187e:	89 c1                	mov    %eax,%ecx
+    1880:	d3 e2                	shl    %cl,%edx
+    1882:	89 d0                	mov    %edx,%eax
+    1884:	3b 45 08             	cmp    0x8(%ebp),%eax
+    1887:	72 e9                	jb     1872 <malloc+0x28>
+    ;
+  if(classes[k] == 0 && refill(k) < 0)
+    1889:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    188c:	8b 04 85 20 25 00 00 	mov    0x2520(,%eax,4),%eax
+    1893:	85 c0                	test   %eax,%eax
+    1895:	75 19                	jne    18b0 <malloc+0x66>
+    1897:	83 ec 0c             	sub    $0xc,%esp
+    189a:	ff 75 f4             	push   -0xc(%ebp)
+    189d:	e8 b1 fe ff ff       	call   1753 <refill>
+    18a2:	83 c4 10             	add    $0x10,%esp
+    18a5:	85 c0                	test   %eax,%eax
+    18a7:	79 07                	jns    18b0 <malloc+0x66>
+    return 0;
+    18a9:	b8 00 00 00 00       	mov    $0x0,%eax
+    18ae:	eb 23                	jmp    18d3 <malloc+0x89>
+  b = classes[k];
+    18b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    18b3:	8b 04 85 20 25 00 00 	mov    0x2520(,%eax,4),%eax
+    18ba:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  classes[k] = b->next;
+    18bd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    18c0:	8b 50 08             	mov    0x8(%eax),%edx
+    18c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    18c6:	89 14 85 20 25 00 00 	mov    %edx,0x2520(,%eax,4)
+  return (char*)b + HDRSIZE;
+    18cd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    18d0:	83 c0 08             	add    $0x8,%eax
+}
+    18d3:	c9                   	leave
+    18d4:	c3                   	ret
+
+000018d5 <stream>:
+
+// Return the stream for fd, deciding on first use how
+// its output is buffered.  Returns 0 if fd is not open.
+static struct stream*
+stream(int fd)
+{
+    18d5:	55                   	push   %ebp
+    18d6:	89 e5                	mov    %esp,%ebp
+    18d8:	83 ec 28             	sub    $0x28,%esp
+  struct stream *s;
+  struct stat st;
+
+  if(fd < 0 || fd >= NOFILE)
+    18db:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    18df:	78 06                	js     18e7 <stream+0x12>
+    18e1:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    18e5:	7e 07                	jle    18ee <stream+0x19>
+    return 0;
+    18e7:	b8 00 00 00 00       	mov    $0x0,%eax
+    18ec:	eb 55                	jmp    1943 <stream+0x6e>
+  s = &streams[fd];
+    18ee:	8b 45 08             	mov    0x8(%ebp),%eax
+    18f1:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    18f7:	05 c0 25 00 00       	add    $0x25c0,%eax
+    18fc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(s->mode == UNKNOWN){
+    18ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1902:	8b 00                	mov    (%eax),%eax
+    1904:	85 c0                	test   %eax,%eax
+    1906:	75 38                	jne    1940 <stream+0x6b>
+    if(fstat(fd, &st) < 0)
+    1908:	83 ec 08             	sub    $0x8,%esp
+    190b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    190e:	50                   	push   %eax
+    190f:	ff 75 08             	push   0x8(%ebp)
+    1912:	e8 57 f6 ff ff       	call   f6e <fstat>
+    1917:	83 c4 10             	add    $0x10,%esp
+    191a:	85 c0                	test   %eax,%eax
+    191c:	79 07                	jns    1925 <stream+0x50>
+      return 0;
+    191e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1923:	eb 1e                	jmp    1943 <stream+0x6e>
+    s->mode = st.type == T_DEV ? LINEBUF : FULLBUF;
+    1925:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+    1929:	66 83 f8 03          	cmp    $0x3,%ax
+    192d:	75 07                	jne    1936 <stream+0x61>
+    192f:	ba 01 00 00 00       	mov    $0x1,%edx
+    1934:	eb 05                	jmp    193b <stream+0x66>
+    1936:	ba 02 00 00 00       	mov    $0x2,%edx
+    193b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    193e:	89 10                	mov    %edx,(%eax)
+  }
+  return s;
+    1940:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1943:	c9                   	leave
+    1944:	c3                   	ret
+
+00001945 <fflush>:
+
+int
+fflush(int fd)
+{
+    1945:	55                   	push   %ebp
+    1946:	89 e5                	mov    %esp,%ebp
+    1948:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  int i, n;
+
+  if(fd < 0 || fd >= NOFILE)
+    194b:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    194f:	78 06                	js     1957 <fflush+0x12>
+    1951:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    1955:	7e 07                	jle    195e <fflush+0x19>
+    return -1;
+    1957:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    195c:	eb 78                	jmp    19d6 <fflush+0x91>
+  s = &streams[fd];
+    195e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1961:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1967:	05 c0 25 00 00       	add    $0x25c0,%eax
+    196c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < s->nout; i += n){
+    196f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1976:	eb 44                	jmp    19bc <fflush+0x77>
+    if((n = write(fd, s->out + i, s->nout - i)) <= 0){
+    1978:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    197b:	8b 40 04             	mov    0x4(%eax),%eax
+    197e:	2b 45 f4             	sub    -0xc(%ebp),%eax
+    1981:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    1984:	8d 4a 10             	lea    0x10(%edx),%ecx
+    1987:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    198a:	01 ca                	add    %ecx,%edx
+    198c:	83 ec 04             	sub    $0x4,%esp
+    198f:	50                   	push   %eax
+    1990:	52                   	push   %edx
+    1991:	ff 75 08             	push   0x8(%ebp)
+    1994:	e8 6c f5 ff ff       	call   f05 <write>
+    1999:	83 c4 10             	add    $0x10,%esp
+    199c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    199f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    19a3:	7f 11                	jg     19b6 <fflush+0x71>
+      s->nout = 0;
+    19a5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    19a8:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+      return -1;
+    19af:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    19b4:	eb 20                	jmp    19d6 <fflush+0x91>
+  for(i = 0; i < s->nout; i += n){
+    19b6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    19b9:	01 45 f4             	add    %eax,-0xc(%ebp)
+    19bc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    19bf:	8b 40 04             	mov    0x4(%eax),%eax
+    19c2:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    19c5:	7c b1                	jl     1978 <fflush+0x33>
+    }
+  }
+  s->nout = 0;
+    19c7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    19ca:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  return 0;
+    19d1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    19d6:	c9                   	leave
+    19d7:	c3                   	ret
+
+000019d8 <flushall>:
+
+// Flush every stream, or only line-buffered ones.
+static void
+flushall(int lineonly)
+{
+    19d8:	55                   	push   %ebp
+    19d9:	89 e5                	mov    %esp,%ebp
+    19db:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+    19de:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    19e5:	eb 41                	jmp    1a28 <flushall+0x50>
+    if(streams[fd].nout > 0 && (!lineonly || streams[fd].mode == LINEBUF))
+    19e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    19ea:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    19f0:	05 c4 25 00 00       	add    $0x25c4,%eax
+    19f5:	8b 00                	mov    (%eax),%eax
+    19f7:	85 c0                	test   %eax,%eax
+    19f9:	7e 29                	jle    1a24 <flushall+0x4c>
+    19fb:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    19ff:	74 15                	je     1a16 <flushall+0x3e>
+    1a01:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1a04:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1a0a:	05 c0 25 00 00       	add    $0x25c0,%eax
+    1a0f:	8b 00                	mov    (%eax),%eax
+    1a11:	83 f8 01             	cmp    $0x1,%eax
+    1a14:	75 0e                	jne    1a24 <flushall+0x4c>
+      fflush(fd);
+    1a16:	83 ec 0c             	sub    $0xc,%esp
+    1a19:	ff 75 f4             	push   -0xc(%ebp)
+    1a1c:	e8 24 ff ff ff       	call   1945 <fflush>
+    1a21:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++)
+    1a24:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1a28:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+    1a2c:	7e b9                	jle    19e7 <flushall+0xf>
+}
+    1a2e:	90                   	nop
+    1a2f:	90                   	nop
+    1a30:	c9                   	leave
+    1a31:	c3                   	ret
+
+00001a32 <fputc>:
+
+int
+fputc(int fd, int c)
+{
+    1a32:	55                   	push   %ebp
+    1a33:	89 e5                	mov    %esp,%ebp
+    1a35:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  char ch;
+
+  if((s = stream(fd)) == 0){
+    1a38:	83 ec 0c             	sub    $0xc,%esp
+    1a3b:	ff 75 08             	push   0x8(%ebp)
+    1a3e:	e8 92 fe ff ff       	call   18d5 <stream>
+    1a43:	83 c4 10             	add    $0x10,%esp
+    1a46:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1a49:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1a4d:	75 2e                	jne    1a7d <fputc+0x4b>
+    ch = c;
+    1a4f:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1a52:	88 45 f3             	mov    %al,-0xd(%ebp)
+    return write(fd, &ch, 1) == 1 ? (uchar)c : -1;
+    1a55:	83 ec 04             	sub    $0x4,%esp
+    1a58:	6a 01                	push   $0x1
+    1a5a:	8d 45 f3             	lea    -0xd(%ebp),%eax
+    1a5d:	50                   	push   %eax
+    1a5e:	ff 75 08             	push   0x8(%ebp)
+    1a61:	e8 9f f4 ff ff       	call   f05 <write>
+    1a66:	83 c4 10             	add    $0x10,%esp
+    1a69:	83 f8 01             	cmp    $0x1,%eax
+    1a6c:	75 08                	jne    1a76 <fputc+0x44>
+    1a6e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1a71:	0f b6 c0             	movzbl %al,%eax
+    1a74:	eb 5e                	jmp    1ad4 <fputc+0xa2>
+    1a76:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1a7b:	eb 57                	jmp    1ad4 <fputc+0xa2>
+  }
+  s->out[s->nout++] = c;
+    1a7d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1a80:	8b 40 04             	mov    0x4(%eax),%eax
+    1a83:	8d 48 01             	lea    0x1(%eax),%ecx
+    1a86:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1a89:	89 4a 04             	mov    %ecx,0x4(%edx)
+    1a8c:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1a8f:	89 d1                	mov    %edx,%ecx
+    1a91:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1a94:	88 4c 02 10          	mov    %cl,0x10(%edx,%eax,1)
+  if(s->nout == BUFSZ || (s->mode == LINEBUF && c == '\n'))
+    1a98:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1a9b:	8b 40 04             	mov    0x4(%eax),%eax
+    1a9e:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1aa3:	74 10                	je     1ab5 <fputc+0x83>
+    1aa5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1aa8:	8b 00                	mov    (%eax),%eax
+    1aaa:	83 f8 01             	cmp    $0x1,%eax
+    1aad:	75 1f                	jne    1ace <fputc+0x9c>
+    1aaf:	83 7d 0c 0a          	cmpl   $0xa,0xc(%ebp)
+    1ab3:	75 19                	jne    1ace <fputc+0x9c>
+    if(fflush(fd) < 0)
+    1ab5:	83 ec 0c             	sub    $0xc,%esp
+    1ab8:	ff 75 08             	push   0x8(%ebp)
+    1abb:	e8 85 fe ff ff       	call   1945 <fflush>
+    1ac0:	83 c4 10             	add    $0x10,%esp
+    1ac3:	85 c0                	test   %eax,%eax
+    1ac5:	79 07                	jns    1ace <fputc+0x9c>
+      return -1;
+    1ac7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1acc:	eb 06                	jmp    1ad4 <fputc+0xa2>
+  return (uchar)c;
+    1ace:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1ad1:	0f b6 c0             	movzbl %al,%eax
+}
+    1ad4:	c9                   	leave
+    1ad5:	c3                   	ret
+
+00001ad6 <fgetc>:
+
+// Return the next byte read from fd, or -1 at end of file.
+int
+fgetc(int fd)
+{
+    1ad6:	55                   	push   %ebp
+    1ad7:	89 e5                	mov    %esp,%ebp
+    1ad9:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  uchar c;
+  int n;
+
+  if((s = stream(fd)) == 0){
+    1adc:	83 ec 0c             	sub    $0xc,%esp
+    1adf:	ff 75 08             	push   0x8(%ebp)
+    1ae2:	e8 ee fd ff ff       	call   18d5 <stream>
+    1ae7:	83 c4 10             	add    $0x10,%esp
+    1aea:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1aed:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1af1:	75 39                	jne    1b2c <fgetc+0x56>
+    flushall(1);
+    1af3:	83 ec 0c             	sub    $0xc,%esp
+    1af6:	6a 01                	push   $0x1
+    1af8:	e8 db fe ff ff       	call   19d8 <flushall>
+    1afd:	83 c4 10             	add    $0x10,%esp
+    return read(fd, &c, 1) == 1 ? c : -1;
+    1b00:	83 ec 04             	sub    $0x4,%esp
+    1b03:	6a 01                	push   $0x1
+    1b05:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    1b08:	50                   	push   %eax
+    1b09:	ff 75 08             	push   0x8(%ebp)
+    1b0c:	e8 e5 f3 ff ff       	call   ef6 <read>
+    1b11:	83 c4 10             	add    $0x10,%esp
+    1b14:	83 f8 01             	cmp    $0x1,%eax
+    1b17:	75 0c                	jne    1b25 <fgetc+0x4f>
+    1b19:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    1b1d:	0f b6 c0             	movzbl %al,%eax
+    1b20:	e9 80 00 00 00       	jmp    1ba5 <fgetc+0xcf>
+    1b25:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1b2a:	eb 79                	jmp    1ba5 <fgetc+0xcf>
+  }
+  if(s->rpos == s->rend){
+    1b2c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1b2f:	8b 50 08             	mov    0x8(%eax),%edx
+    1b32:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1b35:	8b 40 0c             	mov    0xc(%eax),%eax
+    1b38:	39 c2                	cmp    %eax,%edx
+    1b3a:	75 4c                	jne    1b88 <fgetc+0xb2>
+    flushall(1);
+    1b3c:	83 ec 0c             	sub    $0xc,%esp
+    1b3f:	6a 01                	push   $0x1
+    1b41:	e8 92 fe ff ff       	call   19d8 <flushall>
+    1b46:	83 c4 10             	add    $0x10,%esp
+    if((n = read(fd, s->in, BUFSZ)) <= 0)
+    1b49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1b4c:	05 10 02 00 00       	add    $0x210,%eax
+    1b51:	83 ec 04             	sub    $0x4,%esp
+    1b54:	68 00 02 00 00       	push   $0x200
+    1b59:	50                   	push   %eax
+    1b5a:	ff 75 08             	push   0x8(%ebp)
+    1b5d:	e8 94 f3 ff ff       	call   ef6 <read>
+    1b62:	83 c4 10             	add    $0x10,%esp
+    1b65:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1b68:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1b6c:	7f 07                	jg     1b75 <fgetc+0x9f>
+      return -1;
+    1b6e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1b73:	eb 30                	jmp    1ba5 <fgetc+0xcf>
+    s->rpos = 0;
+    1b75:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1b78:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+    s->rend = n;
+    1b7f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1b82:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    1b85:	89 50 0c             	mov    %edx,0xc(%eax)
+  }
+  return (uchar)s->in[s->rpos++];
+    1b88:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1b8b:	8b 40 08             	mov    0x8(%eax),%eax
+    1b8e:	8d 48 01             	lea    0x1(%eax),%ecx
+    1b91:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1b94:	89 4a 08             	mov    %ecx,0x8(%edx)
+    1b97:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1b9a:	0f b6 84 02 10 02 00 	movzbl 0x210(%edx,%eax,1),%eax
+    1ba1:	00 
+    1ba2:	0f b6 c0             	movzbl %al,%eax
+}
+    1ba5:	c9                   	leave
+    1ba6:	c3                   	ret
+
+00001ba7 <fork>:
+
+int
+fork(void)
+{
+    1ba7:	55                   	push   %ebp
+    1ba8:	89 e5                	mov    %esp,%ebp
+    1baa:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1bad:	83 ec 0c             	sub    $0xc,%esp
+    1bb0:	6a 00                	push   $0x0
+    1bb2:	e8 21 fe ff ff       	call   19d8 <flushall>
+    1bb7:	83 c4 10             	add    $0x10,%esp
+  return _fork();
+    1bba:	e8 fb f2 ff ff       	call   eba <_fork>
+}
+    1bbf:	c9                   	leave
+    1bc0:	c3                   	ret
+
+00001bc1 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+    1bc1:	55                   	push   %ebp
+    1bc2:	89 e5                	mov    %esp,%ebp
+    1bc4:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1bc7:	83 ec 0c             	sub    $0xc,%esp
+    1bca:	6a 00                	push   $0x0
+    1bcc:	e8 07 fe ff ff       	call   19d8 <flushall>
+    1bd1:	83 c4 10             	add    $0x10,%esp
+  return _exec(path, argv);
+    1bd4:	83 ec 08             	sub    $0x8,%esp
+    1bd7:	ff 75 0c             	push   0xc(%ebp)
+    1bda:	ff 75 08             	push   0x8(%ebp)
+    1bdd:	e8 50 f3 ff ff       	call   f32 <_exec>
+    1be2:	83 c4 10             	add    $0x10,%esp
+}
+    1be5:	c9                   	leave
+    1be6:	c3                   	ret
+
+00001be7 <exit>:
+
+int
+exit(void)
+{
+    1be7:	55                   	push   %ebp
+    1be8:	89 e5                	mov    %esp,%ebp
+    1bea:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1bed:	83 ec 0c             	sub    $0xc,%esp
+    1bf0:	6a 00                	push   $0x0
+    1bf2:	e8 e1 fd ff ff       	call   19d8 <flushall>
+    1bf7:	83 c4 10             	add    $0x10,%esp
+  _exit();
+    1bfa:	e8 ca f2 ff ff       	call   ec9 <_exit>
+
+00001bff <close>:
+}
+
+int
+close(int fd)
+{
+    1bff:	55                   	push   %ebp
+    1c00:	89 e5                	mov    %esp,%ebp
+    1c02:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+
+  if(fd >= 0 && fd < NOFILE){
+    1c05:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1c09:	78 44                	js     1c4f <close+0x50>
+    1c0b:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    1c0f:	7f 3e                	jg     1c4f <close+0x50>
+    fflush(fd);
+    1c11:	83 ec 0c             	sub    $0xc,%esp
+    1c14:	ff 75 08             	push   0x8(%ebp)
+    1c17:	e8 29 fd ff ff       	call   1945 <fflush>
+    1c1c:	83 c4 10             	add    $0x10,%esp
+    s = &streams[fd];
+    1c1f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1c22:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1c28:	05 c0 25 00 00       	add    $0x25c0,%eax
+    1c2d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    s->mode = UNKNOWN;
+    1c30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1c33:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    s->rpos = s->rend = 0;
+    1c39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1c3c:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    1c43:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1c46:	8b 50 0c             	mov    0xc(%eax),%edx
+    1c49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1c4c:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  return _close(fd);
+    1c4f:	83 ec 0c             	sub    $0xc,%esp
+    1c52:	ff 75 08             	push   0x8(%ebp)
+    1c55:	e8 ba f2 ff ff       	call   f14 <_close>
+    1c5a:	83 c4 10             	add    $0x10,%esp
+}
+    1c5d:	c9                   	leave
+    1c5e:	c3                   	ret
@@ -4,7 +4,8 @@
 #include "mmu.h"
 #include "param.h"
 #include "proc.h"
-
+#include "spinlock.h"
+#include "sleeplock.h"
 #include "fs.h"
 #include "file.h"
 #include "x86.h"
@@ -0,0 +1,2658 @@
+
+_lockstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+struct lockstat st[NLOCKSTAT];
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 28             	sub    $0x28,%esp
+  int i, n;
+  uint hold;
+
+  if((n = lockstat(st, NLOCKSTAT)) < 0){
+      14:	83 ec 08             	sub    $0x8,%esp
+      17:	6a 40                	push   $0x40
+      19:	68 e0 19 00 00       	push   $0x19e0
+      1e:	e8 a2 08 00 00       	call   8c5 <lockstat>
+      23:	83 c4 10             	add    $0x10,%esp
+      26:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      29:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+      2d:	79 17                	jns    46 <main+0x46>
+    printf(2, "lockstat: failed\n");
+      2f:	83 ec 08             	sub    $0x8,%esp
+      32:	68 9c 14 00 00       	push   $0x149c
+      37:	6a 02                	push   $0x2
+      39:	e8 47 09 00 00       	call   985 <printf>
+      3e:	83 c4 10             	add    $0x10,%esp
+    exit();
+      41:	e8 db 13 00 00       	call   1421 <exit>
+  }
+  printf(1, "lock acquires contended spins max-hold-cycles sleeps sleep-ticks\n");
+      46:	83 ec 08             	sub    $0x8,%esp
+      49:	68 b0 14 00 00       	push   $0x14b0
+      4e:	6a 01                	push   $0x1
+      50:	e8 30 09 00 00       	call   985 <printf>
+      55:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++){
+      58:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+      5f:	e9 a2 00 00 00       	jmp    106 <main+0x106>
+    hold = st[i].maxhold > 0x7fffffff ? 0x7fffffff : st[i].maxhold;
+      64:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      67:	6b c0 2c             	imul   $0x2c,%eax,%eax
+      6a:	05 f0 19 00 00       	add    $0x19f0,%eax
+      6f:	8b 50 10             	mov    0x10(%eax),%edx
+      72:	8b 40 0c             	mov    0xc(%eax),%eax
+      75:	b9 ff ff ff 7f       	mov    $0x7fffffff,%ecx
+      7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+      7f:	39 c1                	cmp    %eax,%ecx
+      81:	89 df                	mov    %ebx,%edi
+      83:	19 d7                	sbb    %edx,%edi
+      85:	89 cf                	mov    %ecx,%edi
+      87:	0f 43 f8             	cmovae %eax,%edi
+      8a:	89 7d d0             	mov    %edi,-0x30(%ebp)
+      8d:	89 de                	mov    %ebx,%esi
+      8f:	0f 43 f2             	cmovae %edx,%esi
+      92:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+      95:	8b 45 d0             	mov    -0x30(%ebp),%eax
+      98:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    printf(1, "%s %d %d %d %d %d %d\n", st[i].name, st[i].nacquire,
+      9b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      9e:	6b c0 2c             	imul   $0x2c,%eax,%eax
+      a1:	05 08 1a 00 00       	add    $0x1a08,%eax
+      a6:	8b 08                	mov    (%eax),%ecx
+      a8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      ab:	6b c0 2c             	imul   $0x2c,%eax,%eax
+      ae:	05 04 1a 00 00       	add    $0x1a04,%eax
+      b3:	8b 38                	mov    (%eax),%edi
+      b5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      b8:	6b c0 2c             	imul   $0x2c,%eax,%eax
+      bb:	05 f8 19 00 00       	add    $0x19f8,%eax
+      c0:	8b 30                	mov    (%eax),%esi
+      c2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      c5:	6b c0 2c             	imul   $0x2c,%eax,%eax
+      c8:	05 f4 19 00 00       	add    $0x19f4,%eax
+      cd:	8b 18                	mov    (%eax),%ebx
+      cf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      d2:	6b c0 2c             	imul   $0x2c,%eax,%eax
+      d5:	05 f0 19 00 00       	add    $0x19f0,%eax
+      da:	8b 10                	mov    (%eax),%edx
+      dc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      df:	6b c0 2c             	imul   $0x2c,%eax,%eax
+      e2:	05 e0 19 00 00       	add    $0x19e0,%eax
+      e7:	83 ec 0c             	sub    $0xc,%esp
+      ea:	51                   	push   %ecx
+      eb:	57                   	push   %edi
+      ec:	ff 75 dc             	push   -0x24(%ebp)
+      ef:	56                   	push   %esi
+      f0:	53                   	push   %ebx
+      f1:	52                   	push   %edx
+      f2:	50                   	push   %eax
+      f3:	68 f2 14 00 00       	push   $0x14f2
+      f8:	6a 01                	push   $0x1
+      fa:	e8 86 08 00 00       	call   985 <printf>
+      ff:	83 c4 30             	add    $0x30,%esp
+  for(i = 0; i < n; i++){
+     102:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+     106:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     109:	3b 45 e0             	cmp    -0x20(%ebp),%eax
+     10c:	0f 8c 52 ff ff ff    	jl     64 <main+0x64>
+           st[i].ncontend, st[i].spins, hold, st[i].nsleep, st[i].sleepticks);
+  }
+  exit();
+     112:	e8 0a 13 00 00       	call   1421 <exit>
+
+00000117 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+     117:	55                   	push   %ebp
+     118:	89 e5                	mov    %esp,%ebp
+     11a:	57                   	push   %edi
+     11b:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+     11c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     11f:	8b 55 10             	mov    0x10(%ebp),%edx
+     122:	8b 45 0c             	mov    0xc(%ebp),%eax
+     125:	89 cb                	mov    %ecx,%ebx
+     127:	89 df                	mov    %ebx,%edi
+     129:	89 d1                	mov    %edx,%ecx
+     12b:	fc                   	cld
+     12c:	f3 aa                	rep stos %al,%es:(%edi)
+     12e:	89 ca                	mov    %ecx,%edx
+     130:	89 fb                	mov    %edi,%ebx
+     132:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     135:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     138:	90                   	nop
+     139:	5b                   	pop    %ebx
+     13a:	5f                   	pop    %edi
+     13b:	5d                   	pop    %ebp
+     13c:	c3                   	ret
+
+0000013d <stosl>:
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+     13d:	55                   	push   %ebp
+     13e:	89 e5                	mov    %esp,%ebp
+     140:	57                   	push   %edi
+     141:	53                   	push   %ebx
+  asm volatile("cld; rep stosl" :
+     142:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     145:	8b 55 10             	mov    0x10(%ebp),%edx
+     148:	8b 45 0c             	mov    0xc(%ebp),%eax
+     14b:	89 cb                	mov    %ecx,%ebx
+     14d:	89 df                	mov    %ebx,%edi
+     14f:	89 d1                	mov    %edx,%ecx
+     151:	fc                   	cld
+     152:	f3 ab                	rep stos %eax,%es:(%edi)
+     154:	89 ca                	mov    %ecx,%edx
+     156:	89 fb                	mov    %edi,%ebx
+     158:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     15b:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     15e:	90                   	nop
+     15f:	5b                   	pop    %ebx
+     160:	5f                   	pop    %edi
+     161:	5d                   	pop    %ebp
+     162:	c3                   	ret
+
+00000163 <movsb>:
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+     163:	55                   	push   %ebp
+     164:	89 e5                	mov    %esp,%ebp
+     166:	57                   	push   %edi
+     167:	56                   	push   %esi
+     168:	53                   	push   %ebx
+  asm volatile("cld; rep movsb" :
+     169:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     16c:	8b 55 0c             	mov    0xc(%ebp),%edx
+     16f:	8b 45 10             	mov    0x10(%ebp),%eax
+     172:	89 cb                	mov    %ecx,%ebx
+     174:	89 df                	mov    %ebx,%edi
+     176:	89 d6                	mov    %edx,%esi
+     178:	89 c1                	mov    %eax,%ecx
+     17a:	fc                   	cld
+     17b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     17d:	89 c8                	mov    %ecx,%eax
+     17f:	89 f2                	mov    %esi,%edx
+     181:	89 fb                	mov    %edi,%ebx
+     183:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     186:	89 55 0c             	mov    %edx,0xc(%ebp)
+     189:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     18c:	90                   	nop
+     18d:	5b                   	pop    %ebx
+     18e:	5e                   	pop    %esi
+     18f:	5f                   	pop    %edi
+     190:	5d                   	pop    %ebp
+     191:	c3                   	ret
+
+00000192 <movsl>:
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+     192:	55                   	push   %ebp
+     193:	89 e5                	mov    %esp,%ebp
+     195:	57                   	push   %edi
+     196:	56                   	push   %esi
+     197:	53                   	push   %ebx
+  asm volatile("cld; rep movsl" :
+     198:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     19b:	8b 55 0c             	mov    0xc(%ebp),%edx
+     19e:	8b 45 10             	mov    0x10(%ebp),%eax
+     1a1:	89 cb                	mov    %ecx,%ebx
+     1a3:	89 df                	mov    %ebx,%edi
+     1a5:	89 d6                	mov    %edx,%esi
+     1a7:	89 c1                	mov    %eax,%ecx
+     1a9:	fc                   	cld
+     1aa:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     1ac:	89 c8                	mov    %ecx,%eax
+     1ae:	89 f2                	mov    %esi,%edx
+     1b0:	89 fb                	mov    %edi,%ebx
+     1b2:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     1b5:	89 55 0c             	mov    %edx,0xc(%ebp)
+     1b8:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     1bb:	90                   	nop
+     1bc:	5b                   	pop    %ebx
+     1bd:	5e                   	pop    %esi
+     1be:	5f                   	pop    %edi
+     1bf:	5d                   	pop    %ebp
+     1c0:	c3                   	ret
+
+000001c1 <strcpy>:
+#define ONES        0x01010101
+#define HASZERO(x)  (((x) - ONES) & ~(x) & (ONES << 7))
+
+char*
+strcpy(char *s, char *t)
+{
+     1c1:	55                   	push   %ebp
+     1c2:	89 e5                	mov    %esp,%ebp
+     1c4:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+     1c7:	8b 45 08             	mov    0x8(%ebp),%eax
+     1ca:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     1cd:	90                   	nop
+     1ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+     1d1:	8d 42 01             	lea    0x1(%edx),%eax
+     1d4:	89 45 0c             	mov    %eax,0xc(%ebp)
+     1d7:	8b 45 08             	mov    0x8(%ebp),%eax
+     1da:	8d 48 01             	lea    0x1(%eax),%ecx
+     1dd:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     1e0:	0f b6 12             	movzbl (%edx),%edx
+     1e3:	88 10                	mov    %dl,(%eax)
+     1e5:	0f b6 00             	movzbl (%eax),%eax
+     1e8:	84 c0                	test   %al,%al
+     1ea:	75 e2                	jne    1ce <strcpy+0xd>
+    ;
+  return os;
+     1ec:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     1ef:	c9                   	leave
+     1f0:	c3                   	ret
+
+000001f1 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     1f1:	55                   	push   %ebp
+     1f2:	89 e5                	mov    %esp,%ebp
+  // Aligned words never straddle a page, so reading
+  // whole ones past the end of a string is safe.
+  if((((uint)p | (uint)q) & 3) == 0)
+     1f4:	8b 55 08             	mov    0x8(%ebp),%edx
+     1f7:	8b 45 0c             	mov    0xc(%ebp),%eax
+     1fa:	09 d0                	or     %edx,%eax
+     1fc:	83 e0 03             	and    $0x3,%eax
+     1ff:	85 c0                	test   %eax,%eax
+     201:	75 3f                	jne    242 <strcmp+0x51>
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     203:	eb 08                	jmp    20d <strcmp+0x1c>
+      p += 4, q += 4;
+     205:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     209:	83 45 0c 04          	addl   $0x4,0xc(%ebp)
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     20d:	8b 45 08             	mov    0x8(%ebp),%eax
+     210:	8b 10                	mov    (%eax),%edx
+     212:	8b 45 0c             	mov    0xc(%ebp),%eax
+     215:	8b 00                	mov    (%eax),%eax
+     217:	39 c2                	cmp    %eax,%edx
+     219:	75 27                	jne    242 <strcmp+0x51>
+     21b:	8b 45 08             	mov    0x8(%ebp),%eax
+     21e:	8b 00                	mov    (%eax),%eax
+     220:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     226:	8b 45 08             	mov    0x8(%ebp),%eax
+     229:	8b 00                	mov    (%eax),%eax
+     22b:	f7 d0                	not    %eax
+     22d:	21 d0                	and    %edx,%eax
+     22f:	25 80 80 80 80       	and    $0x80808080,%eax
+     234:	85 c0                	test   %eax,%eax
+     236:	74 cd                	je     205 <strcmp+0x14>
+  while(*p && *p == *q)
+     238:	eb 08                	jmp    242 <strcmp+0x51>
+    p++, q++;
+     23a:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     23e:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     242:	8b 45 08             	mov    0x8(%ebp),%eax
+     245:	0f b6 00             	movzbl (%eax),%eax
+     248:	84 c0                	test   %al,%al
+     24a:	74 10                	je     25c <strcmp+0x6b>
+     24c:	8b 45 08             	mov    0x8(%ebp),%eax
+     24f:	0f b6 10             	movzbl (%eax),%edx
+     252:	8b 45 0c             	mov    0xc(%ebp),%eax
+     255:	0f b6 00             	movzbl (%eax),%eax
+     258:	38 c2                	cmp    %al,%dl
+     25a:	74 de                	je     23a <strcmp+0x49>
+  return (uchar)*p - (uchar)*q;
+     25c:	8b 45 08             	mov    0x8(%ebp),%eax
+     25f:	0f b6 00             	movzbl (%eax),%eax
+     262:	0f b6 d0             	movzbl %al,%edx
+     265:	8b 45 0c             	mov    0xc(%ebp),%eax
+     268:	0f b6 00             	movzbl (%eax),%eax
+     26b:	0f b6 c0             	movzbl %al,%eax
+     26e:	29 c2                	sub    %eax,%edx
+     270:	89 d0                	mov    %edx,%eax
+}
+     272:	5d                   	pop    %ebp
+     273:	c3                   	ret
+
+00000274 <strlen>:
+
+uint
+strlen(char *s)
+{
+     274:	55                   	push   %ebp
+     275:	89 e5                	mov    %esp,%ebp
+     277:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; ((uint)(s+n) & 3) && s[n]; n++)
+     27a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     281:	eb 04                	jmp    287 <strlen+0x13>
+     283:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     287:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     28a:	8b 45 08             	mov    0x8(%ebp),%eax
+     28d:	01 d0                	add    %edx,%eax
+     28f:	83 e0 03             	and    $0x3,%eax
+     292:	85 c0                	test   %eax,%eax
+     294:	74 0f                	je     2a5 <strlen+0x31>
+     296:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     299:	8b 45 08             	mov    0x8(%ebp),%eax
+     29c:	01 d0                	add    %edx,%eax
+     29e:	0f b6 00             	movzbl (%eax),%eax
+     2a1:	84 c0                	test   %al,%al
+     2a3:	75 de                	jne    283 <strlen+0xf>
+    ;
+  if(s[n])
+     2a5:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     2a8:	8b 45 08             	mov    0x8(%ebp),%eax
+     2ab:	01 d0                	add    %edx,%eax
+     2ad:	0f b6 00             	movzbl (%eax),%eax
+     2b0:	84 c0                	test   %al,%al
+     2b2:	74 33                	je     2e7 <strlen+0x73>
+    while(!HASZERO(*(uint*)(s+n)))
+     2b4:	eb 04                	jmp    2ba <strlen+0x46>
+      n += 4;
+     2b6:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+    while(!HASZERO(*(uint*)(s+n)))
+     2ba:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     2bd:	8b 45 08             	mov    0x8(%ebp),%eax
+     2c0:	01 d0                	add    %edx,%eax
+     2c2:	8b 00                	mov    (%eax),%eax
+     2c4:	8d 88 ff fe fe fe    	lea    -0x1010101(%eax),%ecx
+     2ca:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     2cd:	8b 45 08             	mov    0x8(%ebp),%eax
+     2d0:	01 d0                	add    %edx,%eax
+     2d2:	8b 00                	mov    (%eax),%eax
+     2d4:	f7 d0                	not    %eax
+     2d6:	21 c8                	and    %ecx,%eax
+     2d8:	25 80 80 80 80       	and    $0x80808080,%eax
+     2dd:	85 c0                	test   %eax,%eax
+     2df:	74 d5                	je     2b6 <strlen+0x42>
+  for(; s[n]; n++)
+     2e1:	eb 04                	jmp    2e7 <strlen+0x73>
+     2e3:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     2e7:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     2ea:	8b 45 08             	mov    0x8(%ebp),%eax
+     2ed:	01 d0                	add    %edx,%eax
+     2ef:	0f b6 00             	movzbl (%eax),%eax
+     2f2:	84 c0                	test   %al,%al
+     2f4:	75 ed                	jne    2e3 <strlen+0x6f>
+    ;
+  return n;
+     2f6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     2f9:	c9                   	leave
+     2fa:	c3                   	ret
+
+000002fb <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     2fb:	55                   	push   %ebp
+     2fc:	89 e5                	mov    %esp,%ebp
+     2fe:	83 ec 10             	sub    $0x10,%esp
+  char *d;
+  uint k;
+
+  d = dst;
+     301:	8b 45 08             	mov    0x8(%ebp),%eax
+     304:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c &= 0xFF;
+     307:	81 65 0c ff 00 00 00 	andl   $0xff,0xc(%ebp)
+  if(n >= 16){
+     30e:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     312:	76 54                	jbe    368 <memset+0x6d>
+    k = -(uint)d & 3;  // bytes up to a word boundary
+     314:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     317:	f7 d8                	neg    %eax
+     319:	83 e0 03             	and    $0x3,%eax
+     31c:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    stosb(d, c, k);
+     31f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     322:	50                   	push   %eax
+     323:	ff 75 0c             	push   0xc(%ebp)
+     326:	ff 75 fc             	push   -0x4(%ebp)
+     329:	e8 e9 fd ff ff       	call   117 <stosb>
+     32e:	83 c4 0c             	add    $0xc,%esp
+    d += k;
+     331:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     334:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n -= k;
+     337:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     33a:	29 45 10             	sub    %eax,0x10(%ebp)
+    stosl(d, c*ONES, n/4);
+     33d:	8b 45 10             	mov    0x10(%ebp),%eax
+     340:	c1 e8 02             	shr    $0x2,%eax
+     343:	89 c2                	mov    %eax,%edx
+     345:	8b 45 0c             	mov    0xc(%ebp),%eax
+     348:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     34e:	52                   	push   %edx
+     34f:	50                   	push   %eax
+     350:	ff 75 fc             	push   -0x4(%ebp)
+     353:	e8 e5 fd ff ff       	call   13d <stosl>
+     358:	83 c4 0c             	add    $0xc,%esp
+    d += n & ~3;
+     35b:	8b 45 10             	mov    0x10(%ebp),%eax
+     35e:	83 e0 fc             	and    $0xfffffffc,%eax
+     361:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n &= 3;
+     364:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+  }
+  stosb(d, c, n);
+     368:	8b 45 10             	mov    0x10(%ebp),%eax
+     36b:	50                   	push   %eax
+     36c:	ff 75 0c             	push   0xc(%ebp)
+     36f:	ff 75 fc             	push   -0x4(%ebp)
+     372:	e8 a0 fd ff ff       	call   117 <stosb>
+     377:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     37a:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     37d:	c9                   	leave
+     37e:	c3                   	ret
+
+0000037f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     37f:	55                   	push   %ebp
+     380:	89 e5                	mov    %esp,%ebp
+     382:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s1, *s2;
+
+  s1 = v1;
+     385:	8b 45 08             	mov    0x8(%ebp),%eax
+     388:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s2 = v2;
+     38b:	8b 45 0c             	mov    0xc(%ebp),%eax
+     38e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     391:	eb 0c                	jmp    39f <memcmp+0x20>
+    s1 += 4, s2 += 4, n -= 4;
+     393:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+     397:	83 45 f8 04          	addl   $0x4,-0x8(%ebp)
+     39b:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     39f:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     3a3:	76 3e                	jbe    3e3 <memcmp+0x64>
+     3a5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     3a8:	8b 10                	mov    (%eax),%edx
+     3aa:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3ad:	8b 00                	mov    (%eax),%eax
+     3af:	39 c2                	cmp    %eax,%edx
+     3b1:	74 e0                	je     393 <memcmp+0x14>
+  while(n-- > 0){
+     3b3:	eb 2e                	jmp    3e3 <memcmp+0x64>
+    if(*s1 != *s2)
+     3b5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     3b8:	0f b6 10             	movzbl (%eax),%edx
+     3bb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3be:	0f b6 00             	movzbl (%eax),%eax
+     3c1:	38 c2                	cmp    %al,%dl
+     3c3:	74 16                	je     3db <memcmp+0x5c>
+      return *s1 - *s2;
+     3c5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     3c8:	0f b6 00             	movzbl (%eax),%eax
+     3cb:	0f b6 d0             	movzbl %al,%edx
+     3ce:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3d1:	0f b6 00             	movzbl (%eax),%eax
+     3d4:	0f b6 c0             	movzbl %al,%eax
+     3d7:	29 c2                	sub    %eax,%edx
+     3d9:	eb 1a                	jmp    3f5 <memcmp+0x76>
+    s1++, s2++;
+     3db:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     3df:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+  while(n-- > 0){
+     3e3:	8b 45 10             	mov    0x10(%ebp),%eax
+     3e6:	8d 50 ff             	lea    -0x1(%eax),%edx
+     3e9:	89 55 10             	mov    %edx,0x10(%ebp)
+     3ec:	85 c0                	test   %eax,%eax
+     3ee:	75 c5                	jne    3b5 <memcmp+0x36>
+  }
+  return 0;
+     3f0:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+     3f5:	89 d0                	mov    %edx,%eax
+     3f7:	c9                   	leave
+     3f8:	c3                   	ret
+
+000003f9 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     3f9:	55                   	push   %ebp
+     3fa:	89 e5                	mov    %esp,%ebp
+     3fc:	83 ec 14             	sub    $0x14,%esp
+     3ff:	8b 45 0c             	mov    0xc(%ebp),%eax
+     402:	88 45 ec             	mov    %al,-0x14(%ebp)
+  uint w, cc;
+
+  // Skip whole words holding neither c nor the terminator.
+  for(; ((uint)s & 3) && *s; s++)
+     405:	eb 17                	jmp    41e <strchr+0x25>
+    if(*s == c)
+     407:	8b 45 08             	mov    0x8(%ebp),%eax
+     40a:	0f b6 00             	movzbl (%eax),%eax
+     40d:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     410:	75 08                	jne    41a <strchr+0x21>
+      return (char*)s;
+     412:	8b 45 08             	mov    0x8(%ebp),%eax
+     415:	e9 ad 00 00 00       	jmp    4c7 <strchr+0xce>
+  for(; ((uint)s & 3) && *s; s++)
+     41a:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     41e:	8b 45 08             	mov    0x8(%ebp),%eax
+     421:	83 e0 03             	and    $0x3,%eax
+     424:	85 c0                	test   %eax,%eax
+     426:	74 0a                	je     432 <strchr+0x39>
+     428:	8b 45 08             	mov    0x8(%ebp),%eax
+     42b:	0f b6 00             	movzbl (%eax),%eax
+     42e:	84 c0                	test   %al,%al
+     430:	75 d5                	jne    407 <strchr+0xe>
+  cc = (uchar)c * ONES;
+     432:	0f b6 45 ec          	movzbl -0x14(%ebp),%eax
+     436:	0f b6 c0             	movzbl %al,%eax
+     439:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     43f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(*s)
+     442:	8b 45 08             	mov    0x8(%ebp),%eax
+     445:	0f b6 00             	movzbl (%eax),%eax
+     448:	84 c0                	test   %al,%al
+     44a:	74 6c                	je     4b8 <strchr+0xbf>
+    for(; w = *(uint*)s, !HASZERO(w) && !HASZERO(w ^ cc); s += 4)
+     44c:	eb 04                	jmp    452 <strchr+0x59>
+     44e:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     452:	8b 45 08             	mov    0x8(%ebp),%eax
+     455:	8b 00                	mov    (%eax),%eax
+     457:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     45a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     45d:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     463:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     466:	f7 d0                	not    %eax
+     468:	21 d0                	and    %edx,%eax
+     46a:	25 80 80 80 80       	and    $0x80808080,%eax
+     46f:	85 c0                	test   %eax,%eax
+     471:	75 26                	jne    499 <strchr+0xa0>
+     473:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     476:	33 45 fc             	xor    -0x4(%ebp),%eax
+     479:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     47f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     482:	33 45 fc             	xor    -0x4(%ebp),%eax
+     485:	f7 d0                	not    %eax
+     487:	21 d0                	and    %edx,%eax
+     489:	25 80 80 80 80       	and    $0x80808080,%eax
+     48e:	85 c0                	test   %eax,%eax
+     490:	75 07                	jne    499 <strchr+0xa0>
+     492:	b8 01 00 00 00       	mov    $0x1,%eax
+     497:	eb 05                	jmp    49e <strchr+0xa5>
+     499:	b8 00 00 00 00       	mov    $0x0,%eax
+     49e:	85 c0                	test   %eax,%eax
+     4a0:	75 ac                	jne    44e <strchr+0x55>
+      ;
+  for(; *s; s++)
+     4a2:	eb 14                	jmp    4b8 <strchr+0xbf>
+    if(*s == c)
+     4a4:	8b 45 08             	mov    0x8(%ebp),%eax
+     4a7:	0f b6 00             	movzbl (%eax),%eax
+     4aa:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     4ad:	75 05                	jne    4b4 <strchr+0xbb>
+      return (char*)s;
+     4af:	8b 45 08             	mov    0x8(%ebp),%eax
+     4b2:	eb 13                	jmp    4c7 <strchr+0xce>
+  for(; *s; s++)
+     4b4:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     4b8:	8b 45 08             	mov    0x8(%ebp),%eax
+     4bb:	0f b6 00             	movzbl (%eax),%eax
+     4be:	84 c0                	test   %al,%al
+     4c0:	75 e2                	jne    4a4 <strchr+0xab>
+  return 0;
+     4c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     4c7:	c9                   	leave
+     4c8:	c3                   	ret
+
+000004c9 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     4c9:	55                   	push   %ebp
+     4ca:	89 e5                	mov    %esp,%ebp
+     4cc:	83 ec 18             	sub    $0x18,%esp
+  int i, c;
+
+  for(i=0; i+1 < max; ){
+     4cf:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     4d6:	eb 37                	jmp    50f <gets+0x46>
+    c = fgetc(0);
+     4d8:	83 ec 0c             	sub    $0xc,%esp
+     4db:	6a 00                	push   $0x0
+     4dd:	e8 2e 0e 00 00       	call   1310 <fgetc>
+     4e2:	83 c4 10             	add    $0x10,%esp
+     4e5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(c < 0)
+     4e8:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     4ec:	78 2e                	js     51c <gets+0x53>
+      break;
+    buf[i++] = c;
+     4ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4f1:	8d 50 01             	lea    0x1(%eax),%edx
+     4f4:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     4f7:	89 c2                	mov    %eax,%edx
+     4f9:	8b 45 08             	mov    0x8(%ebp),%eax
+     4fc:	01 d0                	add    %edx,%eax
+     4fe:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     501:	88 10                	mov    %dl,(%eax)
+    if(c == '\n' || c == '\r')
+     503:	83 7d f0 0a          	cmpl   $0xa,-0x10(%ebp)
+     507:	74 14                	je     51d <gets+0x54>
+     509:	83 7d f0 0d          	cmpl   $0xd,-0x10(%ebp)
+     50d:	74 0e                	je     51d <gets+0x54>
+  for(i=0; i+1 < max; ){
+     50f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     512:	83 c0 01             	add    $0x1,%eax
+     515:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     518:	7f be                	jg     4d8 <gets+0xf>
+     51a:	eb 01                	jmp    51d <gets+0x54>
+      break;
+     51c:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     51d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     520:	8b 45 08             	mov    0x8(%ebp),%eax
+     523:	01 d0                	add    %edx,%eax
+     525:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     528:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     52b:	c9                   	leave
+     52c:	c3                   	ret
+
+0000052d <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     52d:	55                   	push   %ebp
+     52e:	89 e5                	mov    %esp,%ebp
+     530:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     533:	83 ec 08             	sub    $0x8,%esp
+     536:	6a 00                	push   $0x0
+     538:	ff 75 08             	push   0x8(%ebp)
+     53b:	e8 3b 02 00 00       	call   77b <open>
+     540:	83 c4 10             	add    $0x10,%esp
+     543:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     546:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     54a:	79 07                	jns    553 <stat+0x26>
+    return -1;
+     54c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     551:	eb 25                	jmp    578 <stat+0x4b>
+  r = fstat(fd, st);
+     553:	83 ec 08             	sub    $0x8,%esp
+     556:	ff 75 0c             	push   0xc(%ebp)
+     559:	ff 75 f4             	push   -0xc(%ebp)
+     55c:	e8 47 02 00 00       	call   7a8 <fstat>
+     561:	83 c4 10             	add    $0x10,%esp
+     564:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     567:	83 ec 0c             	sub    $0xc,%esp
+     56a:	ff 75 f4             	push   -0xc(%ebp)
+     56d:	e8 c7 0e 00 00       	call   1439 <close>
+     572:	83 c4 10             	add    $0x10,%esp
+  return r;
+     575:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     578:	c9                   	leave
+     579:	c3                   	ret
+
+0000057a <atoi>:
+
+int
+atoi(const char *s)
+{
+     57a:	55                   	push   %ebp
+     57b:	89 e5                	mov    %esp,%ebp
+     57d:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     580:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     587:	eb 25                	jmp    5ae <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     589:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     58c:	89 d0                	mov    %edx,%eax
+     58e:	c1 e0 02             	shl    $0x2,%eax
+     591:	01 d0                	add    %edx,%eax
+     593:	01 c0                	add    %eax,%eax
+     595:	89 c1                	mov    %eax,%ecx
+     597:	8b 45 08             	mov    0x8(%ebp),%eax
+     59a:	8d 50 01             	lea    0x1(%eax),%edx
+     59d:	89 55 08             	mov    %edx,0x8(%ebp)
+     5a0:	0f b6 00             	movzbl (%eax),%eax
+     5a3:	0f be c0             	movsbl %al,%eax
+     5a6:	01 c8                	add    %ecx,%eax
+     5a8:	83 e8 30             	sub    $0x30,%eax
+     5ab:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     5ae:	8b 45 08             	mov    0x8(%ebp),%eax
+     5b1:	0f b6 00             	movzbl (%eax),%eax
+     5b4:	3c 2f                	cmp    $0x2f,%al
+     5b6:	7e 0a                	jle    5c2 <atoi+0x48>
+     5b8:	8b 45 08             	mov    0x8(%ebp),%eax
+     5bb:	0f b6 00             	movzbl (%eax),%eax
+     5be:	3c 39                	cmp    $0x39,%al
+     5c0:	7e c7                	jle    589 <atoi+0xf>
+  return n;
+     5c2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     5c5:	c9                   	leave
+     5c6:	c3                   	ret
+
+000005c7 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     5c7:	55                   	push   %ebp
+     5c8:	89 e5                	mov    %esp,%ebp
+     5ca:	83 ec 10             	sub    $0x10,%esp
+  char *d, *s;
+  int k;
+
+  if(n <= 0)
+     5cd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     5d1:	7f 08                	jg     5db <memmove+0x14>
+    return vdst;
+     5d3:	8b 45 08             	mov    0x8(%ebp),%eax
+     5d6:	e9 17 01 00 00       	jmp    6f2 <memmove+0x12b>
+  d = vdst;
+     5db:	8b 45 08             	mov    0x8(%ebp),%eax
+     5de:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s = vsrc;
+     5e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+     5e4:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  if(s < d && s + n > d){
+     5e7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     5ea:	3b 45 fc             	cmp    -0x4(%ebp),%eax
+     5ed:	0f 83 84 00 00 00    	jae    677 <memmove+0xb0>
+     5f3:	8b 55 10             	mov    0x10(%ebp),%edx
+     5f6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     5f9:	01 d0                	add    %edx,%eax
+     5fb:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     5fe:	73 77                	jae    677 <memmove+0xb0>
+    s += n;
+     600:	8b 45 10             	mov    0x10(%ebp),%eax
+     603:	01 45 f8             	add    %eax,-0x8(%ebp)
+    d += n;
+     606:	8b 45 10             	mov    0x10(%ebp),%eax
+     609:	01 45 fc             	add    %eax,-0x4(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     60c:	eb 17                	jmp    625 <memmove+0x5e>
+      *--d = *--s, n--;
+     60e:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     612:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     616:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     619:	0f b6 10             	movzbl (%eax),%edx
+     61c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     61f:	88 10                	mov    %dl,(%eax)
+     621:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     625:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     629:	7e 22                	jle    64d <memmove+0x86>
+     62b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     62e:	83 e0 03             	and    $0x3,%eax
+     631:	85 c0                	test   %eax,%eax
+     633:	75 d9                	jne    60e <memmove+0x47>
+    for(; n >= 4; n -= 4){
+     635:	eb 16                	jmp    64d <memmove+0x86>
+      d -= 4;
+     637:	83 6d fc 04          	subl   $0x4,-0x4(%ebp)
+      s -= 4;
+     63b:	83 6d f8 04          	subl   $0x4,-0x8(%ebp)
+      *(uint*)d = *(uint*)s;
+     63f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     642:	8b 10                	mov    (%eax),%edx
+     644:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     647:	89 10                	mov    %edx,(%eax)
+    for(; n >= 4; n -= 4){
+     649:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+     64d:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     651:	7f e4                	jg     637 <memmove+0x70>
+    }
+    while(n-- > 0)
+     653:	eb 13                	jmp    668 <memmove+0xa1>
+      *--d = *--s;
+     655:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     659:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     65d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     660:	0f b6 10             	movzbl (%eax),%edx
+     663:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     666:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+     668:	8b 45 10             	mov    0x10(%ebp),%eax
+     66b:	8d 50 ff             	lea    -0x1(%eax),%edx
+     66e:	89 55 10             	mov    %edx,0x10(%ebp)
+     671:	85 c0                	test   %eax,%eax
+     673:	7f e0                	jg     655 <memmove+0x8e>
+  if(s < d && s + n > d){
+     675:	eb 78                	jmp    6ef <memmove+0x128>
+  } else {
+    if(n >= 16){
+     677:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     67b:	7e 61                	jle    6de <memmove+0x117>
+      k = -(uint)d & 3;
+     67d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     680:	f7 d8                	neg    %eax
+     682:	83 e0 03             	and    $0x3,%eax
+     685:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      movsb(d, s, k);
+     688:	ff 75 f4             	push   -0xc(%ebp)
+     68b:	ff 75 f8             	push   -0x8(%ebp)
+     68e:	ff 75 fc             	push   -0x4(%ebp)
+     691:	e8 cd fa ff ff       	call   163 <movsb>
+     696:	83 c4 0c             	add    $0xc,%esp
+      d += k;
+     699:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     69c:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += k;
+     69f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6a2:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n -= k;
+     6a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6a8:	29 45 10             	sub    %eax,0x10(%ebp)
+      movsl(d, s, n/4);
+     6ab:	8b 45 10             	mov    0x10(%ebp),%eax
+     6ae:	8d 50 03             	lea    0x3(%eax),%edx
+     6b1:	85 c0                	test   %eax,%eax
+     6b3:	0f 48 c2             	cmovs  %edx,%eax
+     6b6:	c1 f8 02             	sar    $0x2,%eax
+     6b9:	50                   	push   %eax
+     6ba:	ff 75 f8             	push   -0x8(%ebp)
+     6bd:	ff 75 fc             	push   -0x4(%ebp)
+     6c0:	e8 cd fa ff ff       	call   192 <movsl>
+     6c5:	83 c4 0c             	add    $0xc,%esp
+      d += n & ~3;
+     6c8:	8b 45 10             	mov    0x10(%ebp),%eax
+     6cb:	83 e0 fc             	and    $0xfffffffc,%eax
+     6ce:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += n & ~3;
+     6d1:	8b 45 10             	mov    0x10(%ebp),%eax
+     6d4:	83 e0 fc             	and    $0xfffffffc,%eax
+     6d7:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n &= 3;
+     6da:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+    }
+    movsb(d, s, n);
+     6de:	ff 75 10             	push   0x10(%ebp)
+     6e1:	ff 75 f8             	push   -0x8(%ebp)
+     6e4:	ff 75 fc             	push   -0x4(%ebp)
+     6e7:	e8 77 fa ff ff       	call   163 <movsb>
+     6ec:	83 c4 0c             	add    $0xc,%esp
+  }
+  return vdst;
+     6ef:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     6f2:	c9                   	leave
+     6f3:	c3                   	ret
+
+000006f4 <_fork>:
+    movl %esp, %ecx; \
+    movl $1f, %edx; \
+    sysenter; \
+  1: ret
+
+RAWSYSCALL(fork)
+     6f4:	b8 01 00 00 00       	mov    $0x1,%eax
+     6f9:	89 e1                	mov    %esp,%ecx
+     6fb:	ba 02 07 00 00       	mov    $0x702,%edx
+     700:	0f 34                	sysenter
+     702:	c3                   	ret
+
+00000703 <_exit>:
+RAWSYSCALL(exit)
+     703:	b8 02 00 00 00       	mov    $0x2,%eax
+     708:	89 e1                	mov    %esp,%ecx
+     70a:	ba 11 07 00 00       	mov    $0x711,%edx
+     70f:	0f 34                	sysenter
+     711:	c3                   	ret
+
+00000712 <wait>:
+SYSCALL(wait)
+     712:	b8 03 00 00 00       	mov    $0x3,%eax
+     717:	89 e1                	mov    %esp,%ecx
+     719:	ba 20 07 00 00       	mov    $0x720,%edx
+     71e:	0f 34                	sysenter
+     720:	c3                   	ret
+
+00000721 <pipe>:
+SYSCALL(pipe)
+     721:	b8 04 00 00 00       	mov    $0x4,%eax
+     726:	89 e1                	mov    %esp,%ecx
+     728:	ba 2f 07 00 00       	mov    $0x72f,%edx
+     72d:	0f 34                	sysenter
+     72f:	c3                   	ret
+
+00000730 <read>:
+SYSCALL(read)
+     730:	b8 05 00 00 00       	mov    $0x5,%eax
+     735:	89 e1                	mov    %esp,%ecx
+     737:	ba 3e 07 00 00       	mov    $0x73e,%edx
+     73c:	0f 34                	sysenter
+     73e:	c3                   	ret
+
+0000073f <write>:
+SYSCALL(write)
+     73f:	b8 10 00 00 00       	mov    $0x10,%eax
+     744:	89 e1                	mov    %esp,%ecx
+     746:	ba 4d 07 00 00       	mov    $0x74d,%edx
+     74b:	0f 34                	sysenter
+     74d:	c3                   	ret
+
+0000074e <_close>:
+RAWSYSCALL(close)
+     74e:	b8 15 00 00 00       	mov    $0x15,%eax
+     753:	89 e1                	mov    %esp,%ecx
+     755:	ba 5c 07 00 00       	mov    $0x75c,%edx
+     75a:	0f 34                	sysenter
+     75c:	c3                   	ret
+
+0000075d <kill>:
+SYSCALL(kill)
+     75d:	b8 06 00 00 00       	mov    $0x6,%eax
+     762:	89 e1                	mov    %esp,%ecx
+     764:	ba 6b 07 00 00       	mov    $0x76b,%edx
+     769:	0f 34                	sysenter
+     76b:	c3                   	ret
+
+0000076c <_exec>:
+RAWSYSCALL(exec)
+     76c:	b8 07 00 00 00       	mov    $0x7,%eax
+     771:	89 e1                	mov    %esp,%ecx
+     773:	ba 7a 07 00 00       	mov    $0x77a,%edx
+     778:	0f 34                	sysenter
+     77a:	c3                   	ret
+
+0000077b <open>:
+SYSCALL(open)
+     77b:	b8 0f 00 00 00       	mov    $0xf,%eax
+     780:	89 e1                	mov    %esp,%ecx
+     782:	ba 89 07 00 00       	mov    $0x789,%edx
+     787:	0f 34                	sysenter
+     789:	c3                   	ret
+
+0000078a <mknod>:
+SYSCALL(mknod)
+     78a:	b8 11 00 00 00       	mov    $0x11,%eax
+     78f:	89 e1                	mov    %esp,%ecx
+     791:	ba 98 07 00 00       	mov    $0x798,%edx
+     796:	0f 34                	sysenter
+     798:	c3                   	ret
+
+00000799 <unlink>:
+SYSCALL(unlink)
+     799:	b8 12 00 00 00       	mov    $0x12,%eax
+     79e:	89 e1                	mov    %esp,%ecx
+     7a0:	ba a7 07 00 00       	mov    $0x7a7,%edx
+     7a5:	0f 34                	sysenter
+     7a7:	c3                   	ret
+
+000007a8 <fstat>:
+SYSCALL(fstat)
+     7a8:	b8 08 00 00 00       	mov    $0x8,%eax
+     7ad:	89 e1                	mov    %esp,%ecx
+     7af:	ba b6 07 00 00       	mov    $0x7b6,%edx
+     7b4:	0f 34                	sysenter
+     7b6:	c3                   	ret
+
+000007b7 <link>:
+SYSCALL(link)
+     7b7:	b8 13 00 00 00       	mov    $0x13,%eax
+     7bc:	89 e1                	mov    %esp,%ecx
+     7be:	ba c5 07 00 00       	mov    $0x7c5,%edx
+     7c3:	0f 34                	sysenter
+     7c5:	c3                   	ret
+
+000007c6 <mkdir>:
+SYSCALL(mkdir)
+     7c6:	b8 14 00 00 00       	mov    $0x14,%eax
+     7cb:	89 e1                	mov    %esp,%ecx
+     7cd:	ba d4 07 00 00       	mov    $0x7d4,%edx
+     7d2:	0f 34                	sysenter
+     7d4:	c3                   	ret
+
+000007d5 <chdir>:
+SYSCALL(chdir)
+     7d5:	b8 09 00 00 00       	mov    $0x9,%eax
+     7da:	89 e1                	mov    %esp,%ecx
+     7dc:	ba e3 07 00 00       	mov    $0x7e3,%edx
+     7e1:	0f 34                	sysenter
+     7e3:	c3                   	ret
+
+000007e4 <dup>:
+SYSCALL(dup)
+     7e4:	b8 0a 00 00 00       	mov    $0xa,%eax
+     7e9:	89 e1                	mov    %esp,%ecx
+     7eb:	ba f2 07 00 00       	mov    $0x7f2,%edx
+     7f0:	0f 34                	sysenter
+     7f2:	c3                   	ret
+
+000007f3 <getpid>:
+SYSCALL(getpid)
+     7f3:	b8 0b 00 00 00       	mov    $0xb,%eax
+     7f8:	89 e1                	mov    %esp,%ecx
+     7fa:	ba 01 08 00 00       	mov    $0x801,%edx
+     7ff:	0f 34                	sysenter
+     801:	c3                   	ret
+
+00000802 <sbrk>:
+SYSCALL(sbrk)
+     802:	b8 0c 00 00 00       	mov    $0xc,%eax
+     807:	89 e1                	mov    %esp,%ecx
+     809:	ba 10 08 00 00       	mov    $0x810,%edx
+     80e:	0f 34                	sysenter
+     810:	c3                   	ret
+
+00000811 <sleep>:
+SYSCALL(sleep)
+     811:	b8 0d 00 00 00       	mov    $0xd,%eax
+     816:	89 e1                	mov    %esp,%ecx
+     818:	ba 1f 08 00 00       	mov    $0x81f,%edx
+     81d:	0f 34                	sysenter
+     81f:	c3                   	ret
+
+00000820 <uptime>:
+SYSCALL(uptime)
+     820:	b8 0e 00 00 00       	mov    $0xe,%eax
+     825:	89 e1                	mov    %esp,%ecx
+     827:	ba 2e 08 00 00       	mov    $0x82e,%edx
+     82c:	0f 34                	sysenter
+     82e:	c3                   	ret
+
+0000082f <getproc>:
+SYSCALL(getproc)
+     82f:	b8 16 00 00 00       	mov    $0x16,%eax
+     834:	89 e1                	mov    %esp,%ecx
+     836:	ba 3d 08 00 00       	mov    $0x83d,%edx
+     83b:	0f 34                	sysenter
+     83d:	c3                   	ret
+
+0000083e <getpgs>:
+SYSCALL(getpgs)
+     83e:	b8 17 00 00 00       	mov    $0x17,%eax
+     843:	89 e1                	mov    %esp,%ecx
+     845:	ba 4c 08 00 00       	mov    $0x84c,%edx
+     84a:	0f 34                	sysenter
+     84c:	c3                   	ret
+
+0000084d <loadproc>:
+SYSCALL(loadproc)
+     84d:	b8 18 00 00 00       	mov    $0x18,%eax
+     852:	89 e1                	mov    %esp,%ecx
+     854:	ba 5b 08 00 00       	mov    $0x85b,%edx
+     859:	0f 34                	sysenter
+     85b:	c3                   	ret
+
+0000085c <iosubmit>:
+SYSCALL(iosubmit)
+     85c:	b8 19 00 00 00       	mov    $0x19,%eax
+     861:	89 e1                	mov    %esp,%ecx
+     863:	ba 6a 08 00 00       	mov    $0x86a,%edx
+     868:	0f 34                	sysenter
+     86a:	c3                   	ret
+
+0000086b <sysstat>:
+SYSCALL(sysstat)
+     86b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     870:	89 e1                	mov    %esp,%ecx
+     872:	ba 79 08 00 00       	mov    $0x879,%edx
+     877:	0f 34                	sysenter
+     879:	c3                   	ret
+
+0000087a <splice>:
+SYSCALL(splice)
+     87a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     87f:	89 e1                	mov    %esp,%ecx
+     881:	ba 88 08 00 00       	mov    $0x888,%edx
+     886:	0f 34                	sysenter
+     888:	c3                   	ret
+
+00000889 <fsync>:
+SYSCALL(fsync)
+     889:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     88e:	89 e1                	mov    %esp,%ecx
+     890:	ba 97 08 00 00       	mov    $0x897,%edx
+     895:	0f 34                	sysenter
+     897:	c3                   	ret
+
+00000898 <fdatasync>:
+SYSCALL(fdatasync)
+     898:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     89d:	89 e1                	mov    %esp,%ecx
+     89f:	ba a6 08 00 00       	mov    $0x8a6,%edx
+     8a4:	0f 34                	sysenter
+     8a6:	c3                   	ret
+
+000008a7 <lseek>:
+SYSCALL(lseek)
+     8a7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     8ac:	89 e1                	mov    %esp,%ecx
+     8ae:	ba b5 08 00 00       	mov    $0x8b5,%edx
+     8b3:	0f 34                	sysenter
+     8b5:	c3                   	ret
+
+000008b6 <dmesg>:
+SYSCALL(dmesg)
+     8b6:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     8bb:	89 e1                	mov    %esp,%ecx
+     8bd:	ba c4 08 00 00       	mov    $0x8c4,%edx
+     8c2:	0f 34                	sysenter
+     8c4:	c3                   	ret
+
+000008c5 <lockstat>:
+SYSCALL(lockstat)
+     8c5:	b8 20 00 00 00       	mov    $0x20,%eax
+     8ca:	89 e1                	mov    %esp,%ecx
+     8cc:	ba d3 08 00 00       	mov    $0x8d3,%edx
+     8d1:	0f 34                	sysenter
+     8d3:	c3                   	ret
+
+000008d4 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     8d4:	55                   	push   %ebp
+     8d5:	89 e5                	mov    %esp,%ebp
+     8d7:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     8da:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     8e1:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     8e5:	74 17                	je     8fe <printint+0x2a>
+     8e7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     8eb:	79 11                	jns    8fe <printint+0x2a>
+    neg = 1;
+     8ed:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     8f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+     8f7:	f7 d8                	neg    %eax
+     8f9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     8fc:	eb 06                	jmp    904 <printint+0x30>
+  } else {
+    x = xx;
+     8fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+     901:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     904:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     90b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     90e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     911:	ba 00 00 00 00       	mov    $0x0,%edx
+     916:	f7 f1                	div    %ecx
+     918:	89 d1                	mov    %edx,%ecx
+     91a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     91d:	8d 50 01             	lea    0x1(%eax),%edx
+     920:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     923:	0f b6 91 bc 19 00 00 	movzbl 0x19bc(%ecx),%edx
+     92a:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     92e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     931:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     934:	ba 00 00 00 00       	mov    $0x0,%edx
+     939:	f7 f1                	div    %ecx
+     93b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     93e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     942:	75 c7                	jne    90b <printint+0x37>
+  if(neg)
+     944:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     948:	74 2d                	je     977 <printint+0xa3>
+    buf[i++] = '-';
+     94a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     94d:	8d 50 01             	lea    0x1(%eax),%edx
+     950:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     953:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+     958:	eb 1d                	jmp    977 <printint+0xa3>
+    fputc(fd, buf[i]);
+     95a:	8d 55 dc             	lea    -0x24(%ebp),%edx
+     95d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     960:	01 d0                	add    %edx,%eax
+     962:	0f b6 00             	movzbl (%eax),%eax
+     965:	0f be c0             	movsbl %al,%eax
+     968:	83 ec 08             	sub    $0x8,%esp
+     96b:	50                   	push   %eax
+     96c:	ff 75 08             	push   0x8(%ebp)
+     96f:	e8 f8 08 00 00       	call   126c <fputc>
+     974:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+     977:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     97b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     97f:	79 d9                	jns    95a <printint+0x86>
+}
+     981:	90                   	nop
+     982:	90                   	nop
+     983:	c9                   	leave
+     984:	c3                   	ret
+
+00000985 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     985:	55                   	push   %ebp
+     986:	89 e5                	mov    %esp,%ebp
+     988:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+     98b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     992:	8d 45 0c             	lea    0xc(%ebp),%eax
+     995:	83 c0 04             	add    $0x4,%eax
+     998:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+     99b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     9a2:	e9 4a 01 00 00       	jmp    af1 <printf+0x16c>
+    c = fmt[i] & 0xff;
+     9a7:	8b 55 0c             	mov    0xc(%ebp),%edx
+     9aa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     9ad:	01 d0                	add    %edx,%eax
+     9af:	0f b6 00             	movzbl (%eax),%eax
+     9b2:	0f be c0             	movsbl %al,%eax
+     9b5:	25 ff 00 00 00       	and    $0xff,%eax
+     9ba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+     9bd:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     9c1:	75 28                	jne    9eb <printf+0x66>
+      if(c == '%'){
+     9c3:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     9c7:	75 0c                	jne    9d5 <printf+0x50>
+        state = '%';
+     9c9:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+     9d0:	e9 18 01 00 00       	jmp    aed <printf+0x168>
+      } else {
+        fputc(fd, c);
+     9d5:	83 ec 08             	sub    $0x8,%esp
+     9d8:	ff 75 e4             	push   -0x1c(%ebp)
+     9db:	ff 75 08             	push   0x8(%ebp)
+     9de:	e8 89 08 00 00       	call   126c <fputc>
+     9e3:	83 c4 10             	add    $0x10,%esp
+     9e6:	e9 02 01 00 00       	jmp    aed <printf+0x168>
+      }
+    } else if(state == '%'){
+     9eb:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+     9ef:	0f 85 f8 00 00 00    	jne    aed <printf+0x168>
+      if(c == 'd'){
+     9f5:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+     9f9:	75 1e                	jne    a19 <printf+0x94>
+        printint(fd, *ap, 10, 1);
+     9fb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     9fe:	8b 00                	mov    (%eax),%eax
+     a00:	6a 01                	push   $0x1
+     a02:	6a 0a                	push   $0xa
+     a04:	50                   	push   %eax
+     a05:	ff 75 08             	push   0x8(%ebp)
+     a08:	e8 c7 fe ff ff       	call   8d4 <printint>
+     a0d:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     a10:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     a14:	e9 cd 00 00 00       	jmp    ae6 <printf+0x161>
+      } else if(c == 'x' || c == 'p'){
+     a19:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+     a1d:	74 06                	je     a25 <printf+0xa0>
+     a1f:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+     a23:	75 1e                	jne    a43 <printf+0xbe>
+        printint(fd, *ap, 16, 0);
+     a25:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     a28:	8b 00                	mov    (%eax),%eax
+     a2a:	6a 00                	push   $0x0
+     a2c:	6a 10                	push   $0x10
+     a2e:	50                   	push   %eax
+     a2f:	ff 75 08             	push   0x8(%ebp)
+     a32:	e8 9d fe ff ff       	call   8d4 <printint>
+     a37:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     a3a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     a3e:	e9 a3 00 00 00       	jmp    ae6 <printf+0x161>
+      } else if(c == 's'){
+     a43:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+     a47:	75 43                	jne    a8c <printf+0x107>
+        s = (char*)*ap;
+     a49:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     a4c:	8b 00                	mov    (%eax),%eax
+     a4e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     a51:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+     a55:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     a59:	75 25                	jne    a80 <printf+0xfb>
+          s = "(null)";
+     a5b:	c7 45 f4 08 15 00 00 	movl   $0x1508,-0xc(%ebp)
+        while(*s != 0){
+     a62:	eb 1c                	jmp    a80 <printf+0xfb>
+          fputc(fd, *s);
+     a64:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a67:	0f b6 00             	movzbl (%eax),%eax
+     a6a:	0f be c0             	movsbl %al,%eax
+     a6d:	83 ec 08             	sub    $0x8,%esp
+     a70:	50                   	push   %eax
+     a71:	ff 75 08             	push   0x8(%ebp)
+     a74:	e8 f3 07 00 00       	call   126c <fputc>
+     a79:	83 c4 10             	add    $0x10,%esp
+          s++;
+     a7c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+     a80:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a83:	0f b6 00             	movzbl (%eax),%eax
+     a86:	84 c0                	test   %al,%al
+     a88:	75 da                	jne    a64 <printf+0xdf>
+     a8a:	eb 5a                	jmp    ae6 <printf+0x161>
+        }
+      } else if(c == 'c'){
+     a8c:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+     a90:	75 1a                	jne    aac <printf+0x127>
+        fputc(fd, *ap);
+     a92:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     a95:	8b 00                	mov    (%eax),%eax
+     a97:	83 ec 08             	sub    $0x8,%esp
+     a9a:	50                   	push   %eax
+     a9b:	ff 75 08             	push   0x8(%ebp)
+     a9e:	e8 c9 07 00 00       	call   126c <fputc>
+     aa3:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     aa6:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     aaa:	eb 3a                	jmp    ae6 <printf+0x161>
+      } else if(c == '%'){
+     aac:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     ab0:	75 13                	jne    ac5 <printf+0x140>
+        fputc(fd, c);
+     ab2:	83 ec 08             	sub    $0x8,%esp
+     ab5:	ff 75 e4             	push   -0x1c(%ebp)
+     ab8:	ff 75 08             	push   0x8(%ebp)
+     abb:	e8 ac 07 00 00       	call   126c <fputc>
+     ac0:	83 c4 10             	add    $0x10,%esp
+     ac3:	eb 21                	jmp    ae6 <printf+0x161>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        fputc(fd, '%');
+     ac5:	83 ec 08             	sub    $0x8,%esp
+     ac8:	6a 25                	push   $0x25
+     aca:	ff 75 08             	push   0x8(%ebp)
+     acd:	e8 9a 07 00 00       	call   126c <fputc>
+     ad2:	83 c4 10             	add    $0x10,%esp
+        fputc(fd, c);
+     ad5:	83 ec 08             	sub    $0x8,%esp
+     ad8:	ff 75 e4             	push   -0x1c(%ebp)
+     adb:	ff 75 08             	push   0x8(%ebp)
+     ade:	e8 89 07 00 00       	call   126c <fputc>
+     ae3:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     ae6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     aed:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     af1:	8b 55 0c             	mov    0xc(%ebp),%edx
+     af4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     af7:	01 d0                	add    %edx,%eax
+     af9:	0f b6 00             	movzbl (%eax),%eax
+     afc:	84 c0                	test   %al,%al
+     afe:	0f 85 a3 fe ff ff    	jne    9a7 <printf+0x22>
+    }
+  }
+}
+     b04:	90                   	nop
+     b05:	90                   	nop
+     b06:	c9                   	leave
+     b07:	c3                   	ret
+
+00000b08 <binof>:
+static struct chunk *bins[NBIN];       // free large chunks
+static struct chunk *top;              // end marker of newest heap segment
+
+static int
+binof(uint size)
+{
+     b08:	55                   	push   %ebp
+     b09:	89 e5                	mov    %esp,%ebp
+     b0b:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  i = 0;
+     b0e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     b15:	c1 6d 08 05          	shrl   $0x5,0x8(%ebp)
+     b19:	eb 07                	jmp    b22 <binof+0x1a>
+    i++;
+     b1b:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     b1f:	d1 6d 08             	shrl   0x8(%ebp)
+     b22:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     b26:	74 06                	je     b2e <binof+0x26>
+     b28:	83 7d fc 19          	cmpl   $0x19,-0x4(%ebp)
+     b2c:	7e ed                	jle    b1b <binof+0x13>
+  return i;
+     b2e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     b31:	c9                   	leave
+     b32:	c3                   	ret
+
+00000b33 <bininsert>:
+
+static void
+bininsert(struct chunk *c)
+{
+     b33:	55                   	push   %ebp
+     b34:	89 e5                	mov    %esp,%ebp
+     b36:	83 ec 10             	sub    $0x10,%esp
+  struct chunk **b;
+
+  b = &bins[binof(CSIZE(c))];
+     b39:	8b 45 08             	mov    0x8(%ebp),%eax
+     b3c:	8b 00                	mov    (%eax),%eax
+     b3e:	83 e0 f8             	and    $0xfffffff8,%eax
+     b41:	50                   	push   %eax
+     b42:	e8 c1 ff ff ff       	call   b08 <binof>
+     b47:	83 c4 04             	add    $0x4,%esp
+     b4a:	c1 e0 02             	shl    $0x2,%eax
+     b4d:	05 00 25 00 00       	add    $0x2500,%eax
+     b52:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c->prev = 0;
+     b55:	8b 45 08             	mov    0x8(%ebp),%eax
+     b58:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  c->next = *b;
+     b5f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     b62:	8b 10                	mov    (%eax),%edx
+     b64:	8b 45 08             	mov    0x8(%ebp),%eax
+     b67:	89 50 08             	mov    %edx,0x8(%eax)
+  if(*b)
+     b6a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     b6d:	8b 00                	mov    (%eax),%eax
+     b6f:	85 c0                	test   %eax,%eax
+     b71:	74 0b                	je     b7e <bininsert+0x4b>
+    (*b)->prev = c;
+     b73:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     b76:	8b 00                	mov    (%eax),%eax
+     b78:	8b 55 08             	mov    0x8(%ebp),%edx
+     b7b:	89 50 0c             	mov    %edx,0xc(%eax)
+  *b = c;
+     b7e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     b81:	8b 55 08             	mov    0x8(%ebp),%edx
+     b84:	89 10                	mov    %edx,(%eax)
+}
+     b86:	90                   	nop
+     b87:	c9                   	leave
+     b88:	c3                   	ret
+
+00000b89 <binremove>:
+
+static void
+binremove(struct chunk *c)
+{
+     b89:	55                   	push   %ebp
+     b8a:	89 e5                	mov    %esp,%ebp
+  if(c->prev)
+     b8c:	8b 45 08             	mov    0x8(%ebp),%eax
+     b8f:	8b 40 0c             	mov    0xc(%eax),%eax
+     b92:	85 c0                	test   %eax,%eax
+     b94:	74 11                	je     ba7 <binremove+0x1e>
+    c->prev->next = c->next;
+     b96:	8b 45 08             	mov    0x8(%ebp),%eax
+     b99:	8b 40 0c             	mov    0xc(%eax),%eax
+     b9c:	8b 55 08             	mov    0x8(%ebp),%edx
+     b9f:	8b 52 08             	mov    0x8(%edx),%edx
+     ba2:	89 50 08             	mov    %edx,0x8(%eax)
+     ba5:	eb 1e                	jmp    bc5 <binremove+0x3c>
+  else
+    bins[binof(CSIZE(c))] = c->next;
+     ba7:	8b 45 08             	mov    0x8(%ebp),%eax
+     baa:	8b 00                	mov    (%eax),%eax
+     bac:	83 e0 f8             	and    $0xfffffff8,%eax
+     baf:	50                   	push   %eax
+     bb0:	e8 53 ff ff ff       	call   b08 <binof>
+     bb5:	83 c4 04             	add    $0x4,%esp
+     bb8:	8b 55 08             	mov    0x8(%ebp),%edx
+     bbb:	8b 52 08             	mov    0x8(%edx),%edx
+     bbe:	89 14 85 00 25 00 00 	mov    %edx,0x2500(,%eax,4)
+  if(c->next)
+     bc5:	8b 45 08             	mov    0x8(%ebp),%eax
+     bc8:	8b 40 08             	mov    0x8(%eax),%eax
+     bcb:	85 c0                	test   %eax,%eax
+     bcd:	74 0f                	je     bde <binremove+0x55>
+    c->next->prev = c->prev;
+     bcf:	8b 45 08             	mov    0x8(%ebp),%eax
+     bd2:	8b 40 08             	mov    0x8(%eax),%eax
+     bd5:	8b 55 08             	mov    0x8(%ebp),%edx
+     bd8:	8b 52 0c             	mov    0xc(%edx),%edx
+     bdb:	89 50 0c             	mov    %edx,0xc(%eax)
+}
+     bde:	90                   	nop
+     bdf:	c9                   	leave
+     be0:	c3                   	ret
+
+00000be1 <freechunk>:
+
+// Free chunk c, merging it with free neighbors.  If trim is
+// set and the result is big and at the break, give it back.
+static void
+freechunk(struct chunk *c, int trim)
+{
+     be1:	55                   	push   %ebp
+     be2:	89 e5                	mov    %esp,%ebp
+     be4:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *p, *n;
+  uint size;
+
+  size = CSIZE(c);
+     be7:	8b 45 08             	mov    0x8(%ebp),%eax
+     bea:	8b 00                	mov    (%eax),%eax
+     bec:	83 e0 f8             	and    $0xfffffff8,%eax
+     bef:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  n = NEXTC(c);
+     bf2:	8b 45 08             	mov    0x8(%ebp),%eax
+     bf5:	8b 00                	mov    (%eax),%eax
+     bf7:	83 e0 f8             	and    $0xfffffff8,%eax
+     bfa:	89 c2                	mov    %eax,%edx
+     bfc:	8b 45 08             	mov    0x8(%ebp),%eax
+     bff:	01 d0                	add    %edx,%eax
+     c01:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(!(c->size & PREVUSED)){
+     c04:	8b 45 08             	mov    0x8(%ebp),%eax
+     c07:	8b 00                	mov    (%eax),%eax
+     c09:	83 e0 02             	and    $0x2,%eax
+     c0c:	85 c0                	test   %eax,%eax
+     c0e:	75 30                	jne    c40 <freechunk+0x5f>
+    p = (struct chunk*)((char*)c - *((uint*)c - 1));
+     c10:	8b 45 08             	mov    0x8(%ebp),%eax
+     c13:	83 e8 04             	sub    $0x4,%eax
+     c16:	8b 00                	mov    (%eax),%eax
+     c18:	f7 d8                	neg    %eax
+     c1a:	89 c2                	mov    %eax,%edx
+     c1c:	8b 45 08             	mov    0x8(%ebp),%eax
+     c1f:	01 d0                	add    %edx,%eax
+     c21:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    binremove(p);
+     c24:	ff 75 ec             	push   -0x14(%ebp)
+     c27:	e8 5d ff ff ff       	call   b89 <binremove>
+     c2c:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(p);
+     c2f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     c32:	8b 00                	mov    (%eax),%eax
+     c34:	83 e0 f8             	and    $0xfffffff8,%eax
+     c37:	01 45 f4             	add    %eax,-0xc(%ebp)
+    c = p;
+     c3a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     c3d:	89 45 08             	mov    %eax,0x8(%ebp)
+  }
+  if(!(n->size & USED)){
+     c40:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c43:	8b 00                	mov    (%eax),%eax
+     c45:	83 e0 01             	and    $0x1,%eax
+     c48:	85 c0                	test   %eax,%eax
+     c4a:	75 16                	jne    c62 <freechunk+0x81>
+    binremove(n);
+     c4c:	ff 75 f0             	push   -0x10(%ebp)
+     c4f:	e8 35 ff ff ff       	call   b89 <binremove>
+     c54:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(n);
+     c57:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c5a:	8b 00                	mov    (%eax),%eax
+     c5c:	83 e0 f8             	and    $0xfffffff8,%eax
+     c5f:	01 45 f4             	add    %eax,-0xc(%ebp)
+  }
+  // Free chunks are never adjacent, so the one below is in use.
+  c->size = size | PREVUSED;
+     c62:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c65:	83 c8 02             	or     $0x2,%eax
+     c68:	89 c2                	mov    %eax,%edx
+     c6a:	8b 45 08             	mov    0x8(%ebp),%eax
+     c6d:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+     c6f:	8b 45 08             	mov    0x8(%ebp),%eax
+     c72:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  FOOTER(c) = size;
+     c79:	8b 45 08             	mov    0x8(%ebp),%eax
+     c7c:	8b 00                	mov    (%eax),%eax
+     c7e:	83 e0 f8             	and    $0xfffffff8,%eax
+     c81:	8d 50 fc             	lea    -0x4(%eax),%edx
+     c84:	8b 45 08             	mov    0x8(%ebp),%eax
+     c87:	01 c2                	add    %eax,%edx
+     c89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c8c:	89 02                	mov    %eax,(%edx)
+  n = NEXTC(c);
+     c8e:	8b 45 08             	mov    0x8(%ebp),%eax
+     c91:	8b 00                	mov    (%eax),%eax
+     c93:	83 e0 f8             	and    $0xfffffff8,%eax
+     c96:	89 c2                	mov    %eax,%edx
+     c98:	8b 45 08             	mov    0x8(%ebp),%eax
+     c9b:	01 d0                	add    %edx,%eax
+     c9d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  n->size &= ~PREVUSED;
+     ca0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ca3:	8b 00                	mov    (%eax),%eax
+     ca5:	83 e0 fd             	and    $0xfffffffd,%eax
+     ca8:	89 c2                	mov    %eax,%edx
+     caa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     cad:	89 10                	mov    %edx,(%eax)
+
+  if(trim && n == top && size >= TRIMSIZE && sbrk(0) == (char*)top + HDRSIZE){
+     caf:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     cb3:	74 51                	je     d06 <freechunk+0x125>
+     cb5:	a1 6c 25 00 00       	mov    0x256c,%eax
+     cba:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     cbd:	75 47                	jne    d06 <freechunk+0x125>
+     cbf:	81 7d f4 ff 7f 00 00 	cmpl   $0x7fff,-0xc(%ebp)
+     cc6:	76 3e                	jbe    d06 <freechunk+0x125>
+     cc8:	83 ec 0c             	sub    $0xc,%esp
+     ccb:	6a 00                	push   $0x0
+     ccd:	e8 30 fb ff ff       	call   802 <sbrk>
+     cd2:	83 c4 10             	add    $0x10,%esp
+     cd5:	8b 15 6c 25 00 00    	mov    0x256c,%edx
+     cdb:	83 c2 08             	add    $0x8,%edx
+     cde:	39 d0                	cmp    %edx,%eax
+     ce0:	75 24                	jne    d06 <freechunk+0x125>
+    c->size = USED | PREVUSED;
+     ce2:	8b 45 08             	mov    0x8(%ebp),%eax
+     ce5:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+    top = c;
+     ceb:	8b 45 08             	mov    0x8(%ebp),%eax
+     cee:	a3 6c 25 00 00       	mov    %eax,0x256c
+    sbrk(-size);
+     cf3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     cf6:	f7 d8                	neg    %eax
+     cf8:	83 ec 0c             	sub    $0xc,%esp
+     cfb:	50                   	push   %eax
+     cfc:	e8 01 fb ff ff       	call   802 <sbrk>
+     d01:	83 c4 10             	add    $0x10,%esp
+    return;
+     d04:	eb 0e                	jmp    d14 <freechunk+0x133>
+  }
+  bininsert(c);
+     d06:	83 ec 0c             	sub    $0xc,%esp
+     d09:	ff 75 08             	push   0x8(%ebp)
+     d0c:	e8 22 fe ff ff       	call   b33 <bininsert>
+     d11:	83 c4 10             	add    $0x10,%esp
+}
+     d14:	c9                   	leave
+     d15:	c3                   	ret
+
+00000d16 <morecore>:
+
+// Grow the heap by at least need bytes.
+static int
+morecore(uint need)
+{
+     d16:	55                   	push   %ebp
+     d17:	89 e5                	mov    %esp,%ebp
+     d19:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+  char *p;
+  uint n, pad;
+
+  n = need + MINCHUNK;
+     d1c:	8b 45 08             	mov    0x8(%ebp),%eax
+     d1f:	83 c0 18             	add    $0x18,%eax
+     d22:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(n < MINCORE)
+     d25:	81 7d ec ff 3f 00 00 	cmpl   $0x3fff,-0x14(%ebp)
+     d2c:	77 07                	ja     d35 <morecore+0x1f>
+    n = MINCORE;
+     d2e:	c7 45 ec 00 40 00 00 	movl   $0x4000,-0x14(%ebp)
+  // Keep the break 8-aligned, with the end marker just below it.
+  pad = (8 - ((uint)sbrk(0) & 7)) & 7;
+     d35:	83 ec 0c             	sub    $0xc,%esp
+     d38:	6a 00                	push   $0x0
+     d3a:	e8 c3 fa ff ff       	call   802 <sbrk>
+     d3f:	83 c4 10             	add    $0x10,%esp
+     d42:	83 e0 07             	and    $0x7,%eax
+     d45:	ba 08 00 00 00       	mov    $0x8,%edx
+     d4a:	29 c2                	sub    %eax,%edx
+     d4c:	89 d0                	mov    %edx,%eax
+     d4e:	83 e0 07             	and    $0x7,%eax
+     d51:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if((p = sbrk(pad + n)) == (char*)-1){
+     d54:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     d57:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     d5a:	01 d0                	add    %edx,%eax
+     d5c:	83 ec 0c             	sub    $0xc,%esp
+     d5f:	50                   	push   %eax
+     d60:	e8 9d fa ff ff       	call   802 <sbrk>
+     d65:	83 c4 10             	add    $0x10,%esp
+     d68:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     d6b:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     d6f:	75 30                	jne    da1 <morecore+0x8b>
+    n = need + MINCHUNK;
+     d71:	8b 45 08             	mov    0x8(%ebp),%eax
+     d74:	83 c0 18             	add    $0x18,%eax
+     d77:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((p = sbrk(pad + n)) == (char*)-1)
+     d7a:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     d7d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     d80:	01 d0                	add    %edx,%eax
+     d82:	83 ec 0c             	sub    $0xc,%esp
+     d85:	50                   	push   %eax
+     d86:	e8 77 fa ff ff       	call   802 <sbrk>
+     d8b:	83 c4 10             	add    $0x10,%esp
+     d8e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     d91:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     d95:	75 0a                	jne    da1 <morecore+0x8b>
+      return -1;
+     d97:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     d9c:	e9 8e 00 00 00       	jmp    e2f <morecore+0x119>
+  }
+  p += pad;
+     da1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     da4:	01 45 f0             	add    %eax,-0x10(%ebp)
+  if(top && p == (char*)top + HDRSIZE){
+     da7:	a1 6c 25 00 00       	mov    0x256c,%eax
+     dac:	85 c0                	test   %eax,%eax
+     dae:	74 29                	je     dd9 <morecore+0xc3>
+     db0:	a1 6c 25 00 00       	mov    0x256c,%eax
+     db5:	83 c0 08             	add    $0x8,%eax
+     db8:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     dbb:	75 1c                	jne    dd9 <morecore+0xc3>
+    // Contiguous: the old end marker heads the new chunk.
+    c = top;
+     dbd:	a1 6c 25 00 00       	mov    0x256c,%eax
+     dc2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = n | (c->size & PREVUSED);
+     dc5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     dc8:	8b 00                	mov    (%eax),%eax
+     dca:	83 e0 02             	and    $0x2,%eax
+     dcd:	0b 45 ec             	or     -0x14(%ebp),%eax
+     dd0:	89 c2                	mov    %eax,%edx
+     dd2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     dd5:	89 10                	mov    %edx,(%eax)
+     dd7:	eb 16                	jmp    def <morecore+0xd9>
+  } else {
+    // Someone else moved the break: start a new segment.
+    c = (struct chunk*)p;
+     dd9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ddc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = (n - HDRSIZE) | PREVUSED;
+     ddf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     de2:	83 e8 08             	sub    $0x8,%eax
+     de5:	83 c8 02             	or     $0x2,%eax
+     de8:	89 c2                	mov    %eax,%edx
+     dea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ded:	89 10                	mov    %edx,(%eax)
+  }
+  top = NEXTC(c);
+     def:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     df2:	8b 00                	mov    (%eax),%eax
+     df4:	83 e0 f8             	and    $0xfffffff8,%eax
+     df7:	89 c2                	mov    %eax,%edx
+     df9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     dfc:	01 d0                	add    %edx,%eax
+     dfe:	a3 6c 25 00 00       	mov    %eax,0x256c
+  top->size = USED;
+     e03:	a1 6c 25 00 00       	mov    0x256c,%eax
+     e08:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  top->tag = LARGE;
+     e0e:	a1 6c 25 00 00       	mov    0x256c,%eax
+     e13:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  freechunk(c, 0);
+     e1a:	83 ec 08             	sub    $0x8,%esp
+     e1d:	6a 00                	push   $0x0
+     e1f:	ff 75 f4             	push   -0xc(%ebp)
+     e22:	e8 ba fd ff ff       	call   be1 <freechunk>
+     e27:	83 c4 10             	add    $0x10,%esp
+  return 0;
+     e2a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     e2f:	c9                   	leave
+     e30:	c3                   	ret
+
+00000e31 <largealloc>:
+
+static void*
+largealloc(uint nbytes)
+{
+     e31:	55                   	push   %ebp
+     e32:	89 e5                	mov    %esp,%ebp
+     e34:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c, *r;
+  uint need;
+  int i;
+
+  if(nbytes > 0x7fffffff)
+     e37:	8b 45 08             	mov    0x8(%ebp),%eax
+     e3a:	85 c0                	test   %eax,%eax
+     e3c:	79 0a                	jns    e48 <largealloc+0x17>
+    return 0;
+     e3e:	b8 00 00 00 00       	mov    $0x0,%eax
+     e43:	e9 43 01 00 00       	jmp    f8b <largealloc+0x15a>
+  need = (nbytes + HDRSIZE + 7) & ~7;
+     e48:	8b 45 08             	mov    0x8(%ebp),%eax
+     e4b:	83 c0 0f             	add    $0xf,%eax
+     e4e:	83 e0 f8             	and    $0xfffffff8,%eax
+     e51:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(need < MINCHUNK)
+     e54:	83 7d f0 17          	cmpl   $0x17,-0x10(%ebp)
+     e58:	77 07                	ja     e61 <largealloc+0x30>
+    need = MINCHUNK;
+     e5a:	c7 45 f0 18 00 00 00 	movl   $0x18,-0x10(%ebp)
+  for(;;){
+    for(i = binof(need); i < NBIN; i++)
+     e61:	ff 75 f0             	push   -0x10(%ebp)
+     e64:	e8 9f fc ff ff       	call   b08 <binof>
+     e69:	83 c4 04             	add    $0x4,%esp
+     e6c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     e6f:	eb 2f                	jmp    ea0 <largealloc+0x6f>
+      for(c = bins[i]; c; c = c->next)
+     e71:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     e74:	8b 04 85 00 25 00 00 	mov    0x2500(,%eax,4),%eax
+     e7b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     e7e:	eb 16                	jmp    e96 <largealloc+0x65>
+        if(CSIZE(c) >= need)
+     e80:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e83:	8b 00                	mov    (%eax),%eax
+     e85:	83 e0 f8             	and    $0xfffffff8,%eax
+     e88:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     e8b:	73 35                	jae    ec2 <largealloc+0x91>
+      for(c = bins[i]; c; c = c->next)
+     e8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e90:	8b 40 08             	mov    0x8(%eax),%eax
+     e93:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     e96:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     e9a:	75 e4                	jne    e80 <largealloc+0x4f>
+    for(i = binof(need); i < NBIN; i++)
+     e9c:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     ea0:	83 7d ec 1a          	cmpl   $0x1a,-0x14(%ebp)
+     ea4:	7e cb                	jle    e71 <largealloc+0x40>
+          goto found;
+    if(morecore(need) < 0)
+     ea6:	83 ec 0c             	sub    $0xc,%esp
+     ea9:	ff 75 f0             	push   -0x10(%ebp)
+     eac:	e8 65 fe ff ff       	call   d16 <morecore>
+     eb1:	83 c4 10             	add    $0x10,%esp
+     eb4:	85 c0                	test   %eax,%eax
+     eb6:	79 a9                	jns    e61 <largealloc+0x30>
+      return 0;
+     eb8:	b8 00 00 00 00       	mov    $0x0,%eax
+     ebd:	e9 c9 00 00 00       	jmp    f8b <largealloc+0x15a>
+          goto found;
+     ec2:	90                   	nop
+  }
+
+found:
+  binremove(c);
+     ec3:	83 ec 0c             	sub    $0xc,%esp
+     ec6:	ff 75 f4             	push   -0xc(%ebp)
+     ec9:	e8 bb fc ff ff       	call   b89 <binremove>
+     ece:	83 c4 10             	add    $0x10,%esp
+  if(CSIZE(c) - need >= MINCHUNK){
+     ed1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ed4:	8b 00                	mov    (%eax),%eax
+     ed6:	83 e0 f8             	and    $0xfffffff8,%eax
+     ed9:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     edc:	83 f8 17             	cmp    $0x17,%eax
+     edf:	76 66                	jbe    f47 <largealloc+0x116>
+    r = (struct chunk*)((char*)c + need);
+     ee1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     ee4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ee7:	01 d0                	add    %edx,%eax
+     ee9:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    r->size = (CSIZE(c) - need) | PREVUSED;
+     eec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eef:	8b 00                	mov    (%eax),%eax
+     ef1:	83 e0 f8             	and    $0xfffffff8,%eax
+     ef4:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     ef7:	83 c8 02             	or     $0x2,%eax
+     efa:	89 c2                	mov    %eax,%edx
+     efc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     eff:	89 10                	mov    %edx,(%eax)
+    r->tag = LARGE;
+     f01:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f04:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+    FOOTER(r) = CSIZE(r);
+     f0b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f0e:	8b 10                	mov    (%eax),%edx
+     f10:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f13:	8b 00                	mov    (%eax),%eax
+     f15:	83 e0 f8             	and    $0xfffffff8,%eax
+     f18:	8d 48 fc             	lea    -0x4(%eax),%ecx
+     f1b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f1e:	01 c8                	add    %ecx,%eax
+     f20:	83 e2 f8             	and    $0xfffffff8,%edx
+     f23:	89 10                	mov    %edx,(%eax)
+    bininsert(r);
+     f25:	83 ec 0c             	sub    $0xc,%esp
+     f28:	ff 75 e8             	push   -0x18(%ebp)
+     f2b:	e8 03 fc ff ff       	call   b33 <bininsert>
+     f30:	83 c4 10             	add    $0x10,%esp
+    c->size = need | (c->size & PREVUSED);
+     f33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f36:	8b 00                	mov    (%eax),%eax
+     f38:	83 e0 02             	and    $0x2,%eax
+     f3b:	0b 45 f0             	or     -0x10(%ebp),%eax
+     f3e:	89 c2                	mov    %eax,%edx
+     f40:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f43:	89 10                	mov    %edx,(%eax)
+     f45:	eb 25                	jmp    f6c <largealloc+0x13b>
+  } else
+    NEXTC(c)->size |= PREVUSED;
+     f47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f4a:	8b 00                	mov    (%eax),%eax
+     f4c:	83 e0 f8             	and    $0xfffffff8,%eax
+     f4f:	89 c2                	mov    %eax,%edx
+     f51:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f54:	01 d0                	add    %edx,%eax
+     f56:	8b 10                	mov    (%eax),%edx
+     f58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f5b:	8b 00                	mov    (%eax),%eax
+     f5d:	83 e0 f8             	and    $0xfffffff8,%eax
+     f60:	89 c1                	mov    %eax,%ecx
+     f62:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f65:	01 c8                	add    %ecx,%eax
+     f67:	83 ca 02             	or     $0x2,%edx
+     f6a:	89 10                	mov    %edx,(%eax)
+  c->size |= USED;
+     f6c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f6f:	8b 00                	mov    (%eax),%eax
+     f71:	83 c8 01             	or     $0x1,%eax
+     f74:	89 c2                	mov    %eax,%edx
+     f76:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f79:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+     f7b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f7e:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  return (char*)c + HDRSIZE;
+     f85:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f88:	83 c0 08             	add    $0x8,%eax
+}
+     f8b:	c9                   	leave
+     f8c:	c3                   	ret
+
+00000f8d <refill>:
+
+// Carve a slab into free blocks of class k.
+static int
+refill(int k)
+{
+     f8d:	55                   	push   %ebp
+     f8e:	89 e5                	mov    %esp,%ebp
+     f90:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  char *p;
+  uint bs, i;
+
+  if((p = largealloc(SLABSIZE)) == 0)
+     f93:	83 ec 0c             	sub    $0xc,%esp
+     f96:	68 00 20 00 00       	push   $0x2000
+     f9b:	e8 91 fe ff ff       	call   e31 <largealloc>
+     fa0:	83 c4 10             	add    $0x10,%esp
+     fa3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     fa6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     faa:	75 07                	jne    fb3 <refill+0x26>
+    return -1;
+     fac:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     fb1:	eb 75                	jmp    1028 <refill+0x9b>
+  bs = HDRSIZE + (MINSMALL << k);
+     fb3:	8b 45 08             	mov    0x8(%ebp),%eax
+     fb6:	ba 10 00 00 00       	mov    $0x10,%edx
+     fbb:	89 c1                	mov    %eax,%ecx
+     fbd:	d3 e2                	shl    %cl,%edx
+     fbf:	89 d0                	mov    %edx,%eax
+     fc1:	83 c0 08             	add    $0x8,%eax
+     fc4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+     fc7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     fce:	eb 44                	jmp    1014 <refill+0x87>
+    b = (struct chunk*)(p + i);
+     fd0:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     fd3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fd6:	01 d0                	add    %edx,%eax
+     fd8:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    b->size = bs | USED;
+     fdb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fde:	83 c8 01             	or     $0x1,%eax
+     fe1:	89 c2                	mov    %eax,%edx
+     fe3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     fe6:	89 10                	mov    %edx,(%eax)
+    b->tag = k;
+     fe8:	8b 55 08             	mov    0x8(%ebp),%edx
+     feb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     fee:	89 50 04             	mov    %edx,0x4(%eax)
+    b->next = classes[k];
+     ff1:	8b 45 08             	mov    0x8(%ebp),%eax
+     ff4:	8b 14 85 e0 24 00 00 	mov    0x24e0(,%eax,4),%edx
+     ffb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     ffe:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[k] = b;
+    1001:	8b 45 08             	mov    0x8(%ebp),%eax
+    1004:	8b 55 e8             	mov    -0x18(%ebp),%edx
+    1007:	89 14 85 e0 24 00 00 	mov    %edx,0x24e0(,%eax,4)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+    100e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1011:	01 45 f4             	add    %eax,-0xc(%ebp)
+    1014:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1017:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    101a:	01 d0                	add    %edx,%eax
+    101c:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    1021:	76 ad                	jbe    fd0 <refill+0x43>
+  }
+  return 0;
+    1023:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1028:	c9                   	leave
+    1029:	c3                   	ret
+
+0000102a <free>:
+
+void
+free(void *ap)
+{
+    102a:	55                   	push   %ebp
+    102b:	89 e5                	mov    %esp,%ebp
+    102d:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+
+  if(ap == 0)
+    1030:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1034:	74 4b                	je     1081 <free+0x57>
+    return;
+  c = (struct chunk*)((char*)ap - HDRSIZE);
+    1036:	8b 45 08             	mov    0x8(%ebp),%eax
+    1039:	83 e8 08             	sub    $0x8,%eax
+    103c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(c->tag != LARGE){
+    103f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1042:	8b 40 04             	mov    0x4(%eax),%eax
+    1045:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1048:	74 25                	je     106f <free+0x45>
+    c->next = classes[c->tag];
+    104a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    104d:	8b 40 04             	mov    0x4(%eax),%eax
+    1050:	8b 14 85 e0 24 00 00 	mov    0x24e0(,%eax,4),%edx
+    1057:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    105a:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[c->tag] = c;
+    105d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1060:	8b 40 04             	mov    0x4(%eax),%eax
+    1063:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1066:	89 14 85 e0 24 00 00 	mov    %edx,0x24e0(,%eax,4)
+    return;
+    106d:	eb 13                	jmp    1082 <free+0x58>
+  }
+  freechunk(c, 1);
+    106f:	83 ec 08             	sub    $0x8,%esp
+    1072:	6a 01                	push   $0x1
+    1074:	ff 75 f4             	push   -0xc(%ebp)
+    1077:	e8 65 fb ff ff       	call   be1 <freechunk>
+    107c:	83 c4 10             	add    $0x10,%esp
+    107f:	eb 01                	jmp    1082 <free+0x58>
+    return;
+    1081:	90                   	nop
+}
+    1082:	c9                   	leave
+    1083:	c3                   	ret
+
+00001084 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1084:	55                   	push   %ebp
+    1085:	89 e5                	mov    %esp,%ebp
+    1087:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  int k;
+
+  if(nbytes > MAXSMALL)
+    108a:	81 7d 08 00 08 00 00 	cmpl   $0x800,0x8(%ebp)
+    1091:	76 10                	jbe    10a3 <malloc+0x1f>
+    return largealloc(nbytes);
+    1093:	83 ec 0c             	sub    $0xc,%esp
+    1096:	ff 75 08             	push   0x8(%ebp)
+    1099:	e8 93 fd ff ff       	call   e31 <largealloc>
+    109e:	83 c4 10             	add    $0x10,%esp
+    10a1:	eb 6a                	jmp    110d <malloc+0x89>
+  for(k = 0; (MINSMALL << k) < nbytes; k++)
+    10a3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    10aa:	eb 04                	jmp    10b0 <malloc+0x2c>
+    10ac:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    10b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10b3:	ba 10 00 00 00       	mov    $0x10,%edx
+    10b8:	89 c1                	mov    %eax,%ecx
+    10ba:	d3 e2                	shl    %cl,%edx
+    10bc:	89 d0                	mov    %edx,%eax
+    10be:	3b 45 08             	cmp    0x8(%ebp),%eax
+    10c1:	72 e9                	jb     10ac <malloc+0x28>
+    ;
+  if(classes[k] == 0 && refill(k) < 0)
+    10c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10c6:	8b 04 85 e0 24 00 00 	mov    0x24e0(,%eax,4),%eax
+    10cd:	85 c0                	test   %eax,%eax
+    10cf:	75 19                	jne    10ea <malloc+0x66>
+    10d1:	83 ec 0c             	sub    $0xc,%esp
+    10d4:	ff 75 f4             	push   -0xc(%ebp)
+    10d7:	e8 b1 fe ff ff       	call   f8d <refill>
+    10dc:	83 c4 10             	add    $0x10,%esp
+    10df:	85 c0                	test   %eax,%eax
+    10e1:	79 07                	jns    10ea <malloc+0x66>
+    return 0;
+    10e3:	b8 00 00 00 00       	mov    $0x0,%eax
+    10e8:	eb 23                	jmp    110d <malloc+0x89>
+  b = classes[k];
+    10ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10ed:	8b 04 85 e0 24 00 00 	mov    0x24e0(,%eax,4),%eax
+    10f4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  classes[k] = b->next;
+    10f7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    10fa:	8b 50 08             	mov    0x8(%eax),%edx
+    10fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1100:	89 14 85 e0 24 00 00 	mov    %edx,0x24e0(,%eax,4)
+  return (char*)b + HDRSIZE;
+    1107:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    110a:	83 c0 08             	add    $0x8,%eax
+}
+    110d:	c9                   	leave
+    110e:	c3                   	ret
+
+0000110f <stream>:
+
+// Return the stream for fd, deciding on first use how
+// its output is buffered.  Returns 0 if fd is not open.
+static struct stream*
+stream(int fd)
+{
+    110f:	55                   	push   %ebp
+    1110:	89 e5                	mov    %esp,%ebp
+    1112:	83 ec 28             	sub    $0x28,%esp
+  struct stream *s;
+  struct stat st;
+
+  if(fd < 0 || fd >= NOFILE)
+    1115:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1119:	78 06                	js     1121 <stream+0x12>
+    111b:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    111f:	7e 07                	jle    1128 <stream+0x19>
+    return 0;
+    1121:	b8 00 00 00 00       	mov    $0x0,%eax
+    1126:	eb 55                	jmp    117d <stream+0x6e>
+  s = &streams[fd];
+    1128:	8b 45 08             	mov    0x8(%ebp),%eax
+    112b:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1131:	05 80 25 00 00       	add    $0x2580,%eax
+    1136:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(s->mode == UNKNOWN){
+    1139:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    113c:	8b 00                	mov    (%eax),%eax
+    113e:	85 c0                	test   %eax,%eax
+    1140:	75 38                	jne    117a <stream+0x6b>
+    if(fstat(fd, &st) < 0)
+    1142:	83 ec 08             	sub    $0x8,%esp
+    1145:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1148:	50                   	push   %eax
+    1149:	ff 75 08             	push   0x8(%ebp)
+    114c:	e8 57 f6 ff ff       	call   7a8 <fstat>
+    1151:	83 c4 10             	add    $0x10,%esp
+    1154:	85 c0                	test   %eax,%eax
+    1156:	79 07                	jns    115f <stream+0x50>
+      return 0;
+    1158:	b8 00 00 00 00       	mov    $0x0,%eax
+    115d:	eb 1e                	jmp    117d <stream+0x6e>
+    s->mode = st.type == T_DEV ? LINEBUF : FULLBUF;
+    115f:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+    1163:	66 83 f8 03          	cmp    $0x3,%ax
+    1167:	75 07                	jne    1170 <stream+0x61>
+    1169:	ba 01 00 00 00       	mov    $0x1,%edx
+    116e:	eb 05                	jmp    1175 <stream+0x66>
+    1170:	ba 02 00 00 00       	mov    $0x2,%edx
+    1175:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1178:	89 10                	mov    %edx,(%eax)
+  }
+  return s;
+    117a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    117d:	c9                   	leave
+    117e:	c3                   	ret
+
+0000117f <fflush>:
+
+int
+fflush(int fd)
+{
+    117f:	55                   	push   %ebp
+    1180:	89 e5                	mov    %esp,%ebp
+    1182:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  int i, n;
+
+  if(fd < 0 || fd >= NOFILE)
+    1185:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1189:	78 06                	js     1191 <fflush+0x12>
+    118b:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    118f:	7e 07                	jle    1198 <fflush+0x19>
+    return -1;
+    1191:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1196:	eb 78                	jmp    1210 <fflush+0x91>
+  s = &streams[fd];
+    1198:	8b 45 08             	mov    0x8(%ebp),%eax
+    119b:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    11a1:	05 80 25 00 00       	add    $0x2580,%eax
+    11a6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < s->nout; i += n){
+    11a9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    11b0:	eb 44                	jmp    11f6 <fflush+0x77>
+    if((n = write(fd, s->out + i, s->nout - i)) <= 0){
+    11b2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    11b5:	8b 40 04             	mov    0x4(%eax),%eax
+    11b8:	2b 45 f4             	sub    -0xc(%ebp),%eax
+    11bb:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    11be:	8d 4a 10             	lea    0x10(%edx),%ecx
+    11c1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    11c4:	01 ca                	add    %ecx,%edx
+    11c6:	83 ec 04             	sub    $0x4,%esp
+    11c9:	50                   	push   %eax
+    11ca:	52                   	push   %edx
+    11cb:	ff 75 08             	push   0x8(%ebp)
+    11ce:	e8 6c f5 ff ff       	call   73f <write>
+    11d3:	83 c4 10             	add    $0x10,%esp
+    11d6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    11d9:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    11dd:	7f 11                	jg     11f0 <fflush+0x71>
+      s->nout = 0;
+    11df:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    11e2:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+      return -1;
+    11e9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    11ee:	eb 20                	jmp    1210 <fflush+0x91>
+  for(i = 0; i < s->nout; i += n){
+    11f0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    11f3:	01 45 f4             	add    %eax,-0xc(%ebp)
+    11f6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    11f9:	8b 40 04             	mov    0x4(%eax),%eax
+    11fc:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    11ff:	7c b1                	jl     11b2 <fflush+0x33>
+    }
+  }
+  s->nout = 0;
+    1201:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1204:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  return 0;
+    120b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1210:	c9                   	leave
+    1211:	c3                   	ret
+
+00001212 <flushall>:
+
+// Flush every stream, or only line-buffered ones.
+static void
+flushall(int lineonly)
+{
+    1212:	55                   	push   %ebp
+    1213:	89 e5                	mov    %esp,%ebp
+    1215:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+    1218:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    121f:	eb 41                	jmp    1262 <flushall+0x50>
+    if(streams[fd].nout > 0 && (!lineonly || streams[fd].mode == LINEBUF))
+    1221:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1224:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    122a:	05 84 25 00 00       	add    $0x2584,%eax
+    122f:	8b 00                	mov    (%eax),%eax
+    1231:	85 c0                	test   %eax,%eax
+    1233:	7e 29                	jle    125e <flushall+0x4c>
+    1235:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1239:	74 15                	je     1250 <flushall+0x3e>
+    123b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    123e:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1244:	05 80 25 00 00       	add    $0x2580,%eax
+    1249:	8b 00                	mov    (%eax),%eax
+    124b:	83 f8 01             	cmp    $0x1,%eax
+    124e:	75 0e                	jne    125e <flushall+0x4c>
+      fflush(fd);
+    1250:	83 ec 0c             	sub    $0xc,%esp
+    1253:	ff 75 f4             	push   -0xc(%ebp)
+    1256:	e8 24 ff ff ff       	call   117f <fflush>
+    125b:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++)
+    125e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1262:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+    1266:	7e b9                	jle    1221 <flushall+0xf>
+}
+    1268:	90                   	nop
+    1269:	90                   	nop
+    126a:	c9                   	leave
+    126b:	c3                   	ret
+
+0000126c <fputc>:
+
+int
+fputc(int fd, int c)
+{
+    126c:	55                   	push   %ebp
+    126d:	89 e5                	mov    %esp,%ebp
+    126f:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  char ch;
+
+  if((s = stream(fd)) == 0){
+    1272:	83 ec 0c             	sub    $0xc,%esp
+    1275:	ff 75 08             	push   0x8(%ebp)
+    1278:	e8 92 fe ff ff       	call   110f <stream>
+    127d:	83 c4 10             	add    $0x10,%esp
+    1280:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1283:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1287:	75 2e                	jne    12b7 <fputc+0x4b>
+    ch = c;
+    1289:	8b 45 0c             	mov    0xc(%ebp),%eax
+    128c:	88 45 f3             	mov    %al,-0xd(%ebp)
+    return write(fd, &ch, 1) == 1 ? (uchar)c : -1;
+    128f:	83 ec 04             	sub    $0x4,%esp
+    1292:	6a 01                	push   $0x1
+    1294:	8d 45 f3             	lea    -0xd(%ebp),%eax
+    1297:	50                   	push   %eax
+    1298:	ff 75 08             	push   0x8(%ebp)
+    129b:	e8 9f f4 ff ff       	call   73f <write>
+    12a0:	83 c4 10             	add    $0x10,%esp
+    12a3:	83 f8 01             	cmp    $0x1,%eax
+    12a6:	75 08                	jne    12b0 <fputc+0x44>
+    12a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+    12ab:	0f b6 c0             	movzbl %al,%eax
+    12ae:	eb 5e                	jmp    130e <fputc+0xa2>
+    12b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12b5:	eb 57                	jmp    130e <fputc+0xa2>
+  }
+  s->out[s->nout++] = c;
+    12b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12ba:	8b 40 04             	mov    0x4(%eax),%eax
+    12bd:	8d 48 01             	lea    0x1(%eax),%ecx
+    12c0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    12c3:	89 4a 04             	mov    %ecx,0x4(%edx)
+    12c6:	8b 55 0c             	mov    0xc(%ebp),%edx
+    12c9:	89 d1                	mov    %edx,%ecx
+    12cb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    12ce:	88 4c 02 10          	mov    %cl,0x10(%edx,%eax,1)
+  if(s->nout == BUFSZ || (s->mode == LINEBUF && c == '\n'))
+    12d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12d5:	8b 40 04             	mov    0x4(%eax),%eax
+    12d8:	3d 00 02 00 00       	cmp    $0x200,%eax
+    12dd:	74 10                	je     12ef <fputc+0x83>
+    12df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12e2:	8b 00                	mov    (%eax),%eax
+    12e4:	83 f8 01             	cmp    $0x1,%eax
+    12e7:	75 1f                	jne    1308 <fputc+0x9c>
+    12e9:	83 7d 0c 0a          	cmpl   $0xa,0xc(%ebp)
+    12ed:	75 19                	jne    1308 <fputc+0x9c>
+    if(fflush(fd) < 0)
+    12ef:	83 ec 0c             	sub    $0xc,%esp
+    12f2:	ff 75 08             	push   0x8(%ebp)
+    12f5:	e8 85 fe ff ff       	call   117f <fflush>
+    12fa:	83 c4 10             	add    $0x10,%esp
+    12fd:	85 c0                	test   %eax,%eax
+    12ff:	79 07                	jns    1308 <fputc+0x9c>
+      return -1;
+    1301:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1306:	eb 06                	jmp    130e <fputc+0xa2>
+  return (uchar)c;
+    1308:	8b 45 0c             	mov    0xc(%ebp),%eax
+    130b:	0f b6 c0             	movzbl %al,%eax
+}
+    130e:	c9                   	leave
+    130f:	c3                   	ret
+
+00001310 <fgetc>:
+
+// Return the next byte read from fd, or -1 at end of file.
+int
+fgetc(int fd)
+{
+    1310:	55                   	push   %ebp
+    1311:	89 e5                	mov    %esp,%ebp
+    1313:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  uchar c;
+  int n;
+
+  if((s = stream(fd)) == 0){
+    1316:	83 ec 0c             	sub    $0xc,%esp
+    1319:	ff 75 08             	push   0x8(%ebp)
+    131c:	e8 ee fd ff ff       	call   110f <stream>
+    1321:	83 c4 10             	add    $0x10,%esp
+    1324:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1327:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    132b:	75 39                	jne    1366 <fgetc+0x56>
+    flushall(1);
+    132d:	83 ec 0c             	sub    $0xc,%esp
+    1330:	6a 01                	push   $0x1
+    1332:	e8 db fe ff ff       	call   1212 <flushall>
+    1337:	83 c4 10             	add    $0x10,%esp
+    return read(fd, &c, 1) == 1 ? c : -1;
+    133a:	83 ec 04             	sub    $0x4,%esp
+    133d:	6a 01                	push   $0x1
+    133f:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    1342:	50                   	push   %eax
+    1343:	ff 75 08             	push   0x8(%ebp)
+    1346:	e8 e5 f3 ff ff       	call   730 <read>
+    134b:	83 c4 10             	add    $0x10,%esp
+    134e:	83 f8 01             	cmp    $0x1,%eax
+    1351:	75 0c                	jne    135f <fgetc+0x4f>
+    1353:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    1357:	0f b6 c0             	movzbl %al,%eax
+    135a:	e9 80 00 00 00       	jmp    13df <fgetc+0xcf>
+    135f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1364:	eb 79                	jmp    13df <fgetc+0xcf>
+  }
+  if(s->rpos == s->rend){
+    1366:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1369:	8b 50 08             	mov    0x8(%eax),%edx
+    136c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    136f:	8b 40 0c             	mov    0xc(%eax),%eax
+    1372:	39 c2                	cmp    %eax,%edx
+    1374:	75 4c                	jne    13c2 <fgetc+0xb2>
+    flushall(1);
+    1376:	83 ec 0c             	sub    $0xc,%esp
+    1379:	6a 01                	push   $0x1
+    137b:	e8 92 fe ff ff       	call   1212 <flushall>
+    1380:	83 c4 10             	add    $0x10,%esp
+    if((n = read(fd, s->in, BUFSZ)) <= 0)
+    1383:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1386:	05 10 02 00 00       	add    $0x210,%eax
+    138b:	83 ec 04             	sub    $0x4,%esp
+    138e:	68 00 02 00 00       	push   $0x200
+    1393:	50                   	push   %eax
+    1394:	ff 75 08             	push   0x8(%ebp)
+    1397:	e8 94 f3 ff ff       	call   730 <read>
+    139c:	83 c4 10             	add    $0x10,%esp
+    139f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    13a2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    13a6:	7f 07                	jg     13af <fgetc+0x9f>
+      return -1;
+    13a8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    13ad:	eb 30                	jmp    13df <fgetc+0xcf>
+    s->rpos = 0;
+    13af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13b2:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+    s->rend = n;
+    13b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13bc:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    13bf:	89 50 0c             	mov    %edx,0xc(%eax)
+  }
+  return (uchar)s->in[s->rpos++];
+    13c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13c5:	8b 40 08             	mov    0x8(%eax),%eax
+    13c8:	8d 48 01             	lea    0x1(%eax),%ecx
+    13cb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    13ce:	89 4a 08             	mov    %ecx,0x8(%edx)
+    13d1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    13d4:	0f b6 84 02 10 02 00 	movzbl 0x210(%edx,%eax,1),%eax
+    13db:	00 
+    13dc:	0f b6 c0             	movzbl %al,%eax
+}
+    13df:	c9                   	leave
+    13e0:	c3                   	ret
+
+000013e1 <fork>:
+
+int
+fork(void)
+{
+    13e1:	55                   	push   %ebp
+    13e2:	89 e5                	mov    %esp,%ebp
+    13e4:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    13e7:	83 ec 0c             	sub    $0xc,%esp
+    13ea:	6a 00                	push   $0x0
+    13ec:	e8 21 fe ff ff       	call   1212 <flushall>
+    13f1:	83 c4 10             	add    $0x10,%esp
+  return _fork();
+    13f4:	e8 fb f2 ff ff       	call   6f4 <_fork>
+}
+    13f9:	c9                   	leave
+    13fa:	c3                   	ret
+
+000013fb <exec>:
+
+int
+exec(char *path, char **argv)
+{
+    13fb:	55                   	push   %ebp
+    13fc:	89 e5                	mov    %esp,%ebp
+    13fe:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1401:	83 ec 0c             	sub    $0xc,%esp
+    1404:	6a 00                	push   $0x0
+    1406:	e8 07 fe ff ff       	call   1212 <flushall>
+    140b:	83 c4 10             	add    $0x10,%esp
+  return _exec(path, argv);
+    140e:	83 ec 08             	sub    $0x8,%esp
+    1411:	ff 75 0c             	push   0xc(%ebp)
+    1414:	ff 75 08             	push   0x8(%ebp)
+    1417:	e8 50 f3 ff ff       	call   76c <_exec>
+    141c:	83 c4 10             	add    $0x10,%esp
+}
+    141f:	c9                   	leave
+    1420:	c3                   	ret
+
+00001421 <exit>:
+
+int
+exit(void)
+{
+    1421:	55                   	push   %ebp
+    1422:	89 e5                	mov    %esp,%ebp
+    1424:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1427:	83 ec 0c             	sub    $0xc,%esp
+    142a:	6a 00                	push   $0x0
+    142c:	e8 e1 fd ff ff       	call   1212 <flushall>
+    1431:	83 c4 10             	add    $0x10,%esp
+  _exit();
+    1434:	e8 ca f2 ff ff       	call   703 <_exit>
+
+00001439 <close>:
+}
+
+int
+close(int fd)
+{
+    1439:	55                   	push   %ebp
+    143a:	89 e5                	mov    %esp,%ebp
+    143c:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+
+  if(fd >= 0 && fd < NOFILE){
+    143f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1443:	78 44                	js     1489 <close+0x50>
+    1445:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    1449:	7f 3e                	jg     1489 <close+0x50>
+    fflush(fd);
+    144b:	83 ec 0c             	sub    $0xc,%esp
+    144e:	ff 75 08             	push   0x8(%ebp)
+    1451:	e8 29 fd ff ff       	call   117f <fflush>
+    1456:	83 c4 10             	add    $0x10,%esp
+    s = &streams[fd];
+    1459:	8b 45 08             	mov    0x8(%ebp),%eax
+    145c:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1462:	05 80 25 00 00       	add    $0x2580,%eax
+    1467:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    s->mode = UNKNOWN;
+    146a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    146d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    s->rpos = s->rend = 0;
+    1473:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1476:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    147d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1480:	8b 50 0c             	mov    0xc(%eax),%edx
+    1483:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1486:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  return _close(fd);
+    1489:	83 ec 0c             	sub    $0xc,%esp
+    148c:	ff 75 08             	push   0x8(%ebp)
+    148f:	e8 ba f2 ff ff       	call   74e <_close>
+    1494:	83 c4 10             	add    $0x10,%esp
+}
+    1497:	c9                   	leave
+    1498:	c3                   	ret
@@ -0,0 +1,29 @@
+// Print lock contention statistics, one line per lock name:
+// acquisitions, contended acquisitions, spins, longest hold,
+// and for sleep locks, waits that slept and ticks spent asleep.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "lockstat.h"
+
+struct lockstat st[NLOCKSTAT];
+
+int
+main(void)
+{
+  int i, n;
+  uint hold;
+
+  if((n = lockstat(st, NLOCKSTAT)) < 0){
+    printf(2, "lockstat: failed\n");
+    exit();
+  }
+  printf(1, "lock acquires contended spins max-hold-cycles sleeps sleep-ticks\n");
+  for(i = 0; i < n; i++){
+    hold = st[i].maxhold > 0x7fffffff ? 0x7fffffff : st[i].maxhold;
+    printf(1, "%s %d %d %d %d %d %d\n", st[i].name, st[i].nacquire,
+           st[i].ncontend, st[i].spins, hold, st[i].nsleep, st[i].sleepticks);
+  }
+  exit();
+}
@@ -0,0 +1,17 @@
+// Lock contention statistics, kept by acquire() and release()
+// for each lock name, and by the sleep locks for the spin lock
+// inside them, and read by the lockstat system call.
+// All locks with the same name (every pipe's, say) share one entry.
+
+#define NLOCKSTAT  64  // lock names tracked
+#define LOCKNAME   16
+
+struct lockstat {
+  char name[LOCKNAME];
+  uint nacquire;     // acquisitions
+  uint ncontend;     // acquisitions that had to wait
+  uint spins;        // times waiters polled the lock
+  uint64 maxhold;    // longest hold, in TSC cycles
+  uint nsleep;       // sleep lock acquisitions that had to sleep
+  uint sleepticks;   // ticks spent asleep waiting for them
+};
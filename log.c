@@ -1,7 +1,10 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
+#include "proc.h"
 #include "spinlock.h"
+#include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
 
@@ -14,25 +17,56 @@
 // write an uncommitted system call's updates to disk.
 //
 // A system call should call begin_op()/end_op() to mark
-// its start and end. Usually begin_op() just increments
-// the count of in-progress FS system calls and returns.
-// But if it thinks the log is close to running out, it
-// sleeps until the last outstanding end_op() commits.
+// its start and end. begin_op() reserves MAXOPBLOCKS blocks
+// of log space for the operation (begin_opn() reserves a given
+// number), and usually just counts the operation and returns.
+// But if the log lacks that much space, it sleeps until the
+// log thread has committed.  Each block the operation adds
+// to the transaction uses up one block of its reservation,
+// and end_op() returns whatever is left, so space is held
+// only for blocks an operation may still dirty.
+//
+// The log's size comes from the superblock (mkfs -l),
+// up to LOGSIZE data blocks plus the header block.
+//
+// Commits are done by a kernel thread, logflush(), not by
+// end_op().  It lets a transaction gather the operations of
+// many system calls for up to COMMITTICKS ticks, or until the
+// log is nearly full or log_sync() asks for it, then closes
+// it: new operations wait only while the thread copies the
+// transaction's blocks into memory, and join the next
+// transaction while that copy is written to the log and then
+// installed.  end_op() therefore does not make an operation
+// durable; log_sync() waits until it is.
+//
+// File data is not logged (see bdwrite() in bio.c), but
+// logflush() writes it back before committing, so a committed
+// transaction never points a file at a block whose data has
+// not reached the disk.  Nor does a block a transaction frees
+// get reused until that transaction commits (see bfree()).
 //
 // The log is a physical re-do log containing disk blocks.
 // The on-disk log format:
-//   header block, containing block #s for block A, B, C, ...
+//   header block, containing block #s and checksums for block A, B, C, ...
 //   block A
 //   block B
 //   block C
 //   ...
-// Log appends are synchronous.
+// Log appends are synchronous.  The header is written after
+// the blocks, but a crash can still leave a block torn or
+// unwritten if the disk reorders writes; recovery checks
+// every block against its checksum and discards the whole
+// transaction if one does not match.
+
+#define COMMITTICKS 5  // longest a transaction stays open
+#define BPPG (PGSIZE/BSIZE)
 
 // Contents of the header block, used for both the on-disk header block
 // and to keep track in memory of logged block# before commit.
 struct logheader {
   int n;   
   int block[LOGSIZE];
+  uint sum[LOGSIZE];  // blocksum() of each logged block
 };
 
 struct log {
@@ -40,18 +74,31 @@ struct log {
   int start;
   int size;
   int outstanding; // how many FS sys calls are executing.
-  int committing;  // in commit(), please wait.
+  int reserved;    // log blocks they may still add to lh
+  int closing;     // logflush() is closing the transaction, please wait.
+  int full;        // begin_op() is waiting for log space.
   int dev;
+  uint opened;     // ticks when lh got its first block
+  uint seq;        // sequence number of the open transaction
+  uint done;       // last transaction installed on disk
+  uint want;       // log_sync() is waiting for this transaction
   struct logheader lh;
+
+  // Owned by logflush(): the transaction being committed.
+  struct logheader clh;
+  char *copy[(LOGSIZE+BPPG-1)/BPPG];  // copies of its blocks
+  struct buf io;   // for writing them, outside the buffer cache
 };
 struct log log;
 
 static void recover_from_log(void);
-static void commit();
+static void logflush(void);
 
 void
 initlog(int dev)
 {
+  int i;
+
   if (sizeof(struct logheader) >= BSIZE)
     panic("initlog: too big logheader");
 
@@ -61,146 +108,321 @@ initlog(int dev)
   log.start = sb.logstart;
   log.size = sb.nlog;
   log.dev = dev;
+  if (log.size - 1 < MINLOGSIZE || log.size - 1 > LOGSIZE)
+    panic("initlog: bad log size");
+  for (i = 0; i < NELEM(log.copy); i++)
+    if ((log.copy[i] = kalloc()) == 0)
+      panic("initlog: kalloc");
   recover_from_log();
+  log.seq = 1;
+  kproc("logflush", logflush);
 }
 
-// Copy committed blocks from log to their home location
-static void 
-install_trans(void)
+// Checksum of a logged block.
+static uint
+blocksum(char *data)
 {
-  int tail;
+  uint *w = (uint*)data;
+  uint a, b;
+  int i;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
-    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
-    bwrite(dbuf);  // write dst to disk
-    brelse(lbuf); 
-    brelse(dbuf);
+  a = 1;
+  b = 0;
+  for (i = 0; i < BSIZE/sizeof(uint); i++) {
+    a += w[i];
+    b += a;
   }
+  return a ^ (b << 16) ^ (b >> 16);
 }
 
-// Read the log header from disk into the in-memory log header
+// Address of the copy of block n of the transaction being committed.
+static char*
+copyof(int n)
+{
+  return log.copy[n/BPPG] + (n%BPPG)*BSIZE;
+}
+
+// Read or write the copy of block n of log.clh at blockno,
+// outside the buffer cache.
+static void
+rw_copy(int n, uint blockno, int write)
+{
+  log.io.dev = log.dev;
+  log.io.blockno = blockno;
+  log.io.flags = write ? B_BUSY|B_DIRTY : B_BUSY;
+  if (write)
+    memmove(log.io.data, copyof(n), BSIZE);
+  iderw(&log.io);
+  if (!write)
+    memmove(copyof(n), log.io.data, BSIZE);
+}
+
+// Write the header of the transaction being committed,
+// or an empty one.
 static void
-read_head(void)
+write_chead(int n)
 {
-  struct buf *buf = bread(log.dev, log.start);
-  struct logheader *lh = (struct logheader *) (buf->data);
+  struct logheader *hb = (struct logheader *) (log.io.data);
   int i;
-  log.lh.n = lh->n;
-  for (i = 0; i < log.lh.n; i++) {
-    log.lh.block[i] = lh->block[i];
+
+  log.io.dev = log.dev;
+  log.io.blockno = log.start;
+  log.io.flags = B_BUSY|B_DIRTY;
+  memset(log.io.data, 0, BSIZE);
+  hb->n = n;
+  for (i = 0; i < n; i++) {
+    hb->block[i] = log.clh.block[i];
+    hb->sum[i] = log.clh.sum[i];
   }
-  brelse(buf);
+  iderw(&log.io);
 }
 
-// Write in-memory log header to disk.
-// This is the true point at which the
-// current transaction commits.
-static void
-write_head(void)
+// Copy committed blocks from log.copy to their home locations,
+// in ascending block order so the disk sweeps across once.
+static void 
+install_trans(void)
 {
-  struct buf *buf = bread(log.dev, log.start);
-  struct logheader *hb = (struct logheader *) (buf->data);
+  int i, j, order[LOGSIZE];
+
+  for (i = 0; i < log.clh.n; i++) {
+    for (j = i; j > 0 && log.clh.block[order[j-1]] > log.clh.block[i]; j--)
+      order[j] = order[j-1];
+    order[j] = i;
+  }
+  for (i = 0; i < log.clh.n; i++)
+    rw_copy(order[i], log.clh.block[order[i]], 1);
+}
+
+// Read the log header, and the blocks it names into log.copy.
+// Returns 0 if a block does not match its checksum.
+static int
+read_trans(void)
+{
+  struct logheader *lh = (struct logheader *) (log.io.data);
   int i;
-  hb->n = log.lh.n;
-  for (i = 0; i < log.lh.n; i++) {
-    hb->block[i] = log.lh.block[i];
+
+  log.io.dev = log.dev;
+  log.io.blockno = log.start;
+  log.io.flags = B_BUSY;
+  iderw(&log.io);
+  if (lh->n < 0 || lh->n > log.size - 1)
+    return 0;
+  log.clh = *lh;
+  for (i = 0; i < log.clh.n; i++) {
+    rw_copy(i, log.start+i+1, 0);
+    if (blocksum(copyof(i)) != log.clh.sum[i])
+      return 0;
   }
-  bwrite(buf);
-  brelse(buf);
+  return 1;
 }
 
+// Runs before the file system reads anything else from the
+// disk, since it installs blocks without going through the
+// buffer cache.
 static void
 recover_from_log(void)
 {
-  read_head();      
-  install_trans(); // if committed, copy from log to disk
-  log.lh.n = 0;
-  write_head(); // clear the log
+  if (read_trans())
+    install_trans(); // if committed, copy from log to disk
+  else
+    cprintf("log: discarding torn transaction\n");
+  log.clh.n = 0;
+  write_chead(0); // clear the log
 }
 
-// called at the start of each FS system call.
+// Most log blocks one operation can reserve.
+int
+log_space(void)
+{
+  return log.size - 1;
+}
+
+// called at the start of an FS system call that will
+// write at most n blocks.
 void
-begin_op(void)
+begin_opn(int n)
 {
+  if(n > log_space())
+    panic("begin_opn");
+
   acquire(&log.lock);
   while(1){
-    if(log.committing){
+    if(log.closing){
       sleep(&log, &log.lock);
-    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+    } else if(log.lh.n + log.reserved + n > log_space()){
       // this op might exhaust log space; wait for commit.
+      log.full = 1;
+      wakeup(&log.lh);
       sleep(&log, &log.lock);
     } else {
       log.outstanding += 1;
+      log.reserved += n;
+      proc->logres = n;
       release(&log.lock);
       break;
     }
   }
 }
 
+// called at the start of each FS system call.
+void
+begin_op(void)
+{
+  begin_opn(MAXOPBLOCKS);
+}
+
 // called at the end of each FS system call.
-// commits if this was the last outstanding operation.
+// The operation becomes durable when logflush() commits it.
 void
 end_op(void)
 {
-  int do_commit = 0;
-
   acquire(&log.lock);
   log.outstanding -= 1;
-  if(log.committing)
-    panic("log.committing");
+  log.reserved -= proc->logres;
+  proc->logres = 0;
   if(log.outstanding == 0){
-    do_commit = 1;
-    log.committing = 1;
-  } else {
-    // begin_op() may be waiting for log space.
-    wakeup(&log);
+    // logflush() may be waiting to close the transaction.
+    wakeup(&log.lh);
   }
+  // begin_op() may be waiting for log space.
+  wakeup(&log);
   release(&log.lock);
+}
 
-  if(do_commit){
-    // call commit w/o holding locks, since not allowed
-    // to sleep with locks.
-    commit();
-    acquire(&log.lock);
-    log.committing = 0;
-    wakeup(&log);
-    release(&log.lock);
+// Sequence number of the open transaction, which holds
+// the caller's operation.
+uint
+log_seq(void)
+{
+  return log.seq;
+}
+
+// Wait until every operation that has called end_op()
+// is on disk.  Must not be called inside an operation.
+void
+log_sync(void)
+{
+  log_wait(~0);
+}
+
+// Wait until transaction seq (from log_seq()) is on disk.
+// Must not be called inside an operation.
+void
+log_wait(uint seq)
+{
+  acquire(&log.lock);
+  if(seq >= log.seq)
+    seq = log.lh.n > 0 ? log.seq : log.seq - 1;
+  if(seq > log.want)
+    log.want = seq;
+  wakeup(&log.lh);
+  while(log.done < seq)
+    sleep(&log.done, &log.lock);
+  release(&log.lock);
+}
+
+// Does the open transaction need committing now?
+// Caller must hold log.lock.
+static int
+commitdue(void)
+{
+  return log.lh.n > 0 &&
+    (log.full || log.want >= log.seq || ticks - log.opened >= COMMITTICKS);
+}
+
+// Close the open transaction and copy its blocks into log.copy.
+// New operations wait only for the copy.
+// Returns the transaction's sequence number.
+static uint
+close_trans(void)
+{
+  int i;
+  uint seq;
+  struct buf *b;
+
+  acquire(&log.lock);
+  log.closing = 1;
+  while(log.outstanding > 0)
+    sleep(&log.lh, &log.lock);
+  log.clh = log.lh;
+  log.lh.n = 0;
+  log.full = 0;
+  seq = log.seq++;
+  bmapclose();
+  release(&log.lock);
+
+  for (i = 0; i < log.clh.n; i++) {
+    b = bread(log.dev, log.clh.block[i]);  // pinned in the cache
+    memmove(copyof(i), b->data, BSIZE);
+    brelse(b);
+    log.clh.sum[i] = blocksum(copyof(i));
   }
+
+  acquire(&log.lock);
+  log.closing = 0;
+  wakeup(&log);
+  release(&log.lock);
+  return seq;
 }
 
-// Copy modified blocks from cache to log.
-static void 
-write_log(void)
+// Once the closed transaction is installed, let the cache evict
+// its blocks, except those the open transaction has since changed.
+static void
+unpin_trans(void)
 {
-  int tail;
+  int i, j;
+  struct buf *b;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
-    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
-    memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
-    brelse(from); 
-    brelse(to);
+  for (i = 0; i < log.clh.n; i++) {
+    b = bread(log.dev, log.clh.block[i]);
+    acquire(&log.lock);
+    for (j = 0; j < log.lh.n; j++)
+      if (log.lh.block[j] == b->blockno)
+        break;
+    if (j == log.lh.n)
+      b->flags &= ~B_DIRTY;
+    release(&log.lock);
+    brelse(b);
   }
 }
 
+// The log thread: commit transactions as they come due.
 static void
-commit()
-{
-  if (log.lh.n > 0) {
-    write_log();     // Write modified blocks from cache to log
-    write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
-    log.lh.n = 0; 
-    write_head();    // Erase the transaction from the log
+logflush(void)
+{
+  int i;
+  uint seq;
+
+  for(;;){
+    acquire(&log.lock);
+    while(!commitdue()){
+      if(log.lh.n == 0)
+        sleep(&log.lh, &log.lock);
+      else
+        sleep(&ticks, &log.lock);  // check again next tick
+    }
+    release(&log.lock);
+
+    seq = close_trans();
+    bflush(0, 0);  // file data goes to disk before the blocks that point to it
+    for (i = 0; i < log.clh.n; i++)
+      rw_copy(i, log.start+i+1, 1);   // Write the log
+    write_chead(log.clh.n);           // Write header -- the real commit
+    bmapcommit();                     // Blocks it freed may be reused
+    install_trans();                  // Now install writes to home locations
+    write_chead(0);                   // Erase the transaction from the log
+    unpin_trans();
+
+    acquire(&log.lock);
+    log.done = seq;
+    wakeup(&log.done);
+    release(&log.lock);
   }
 }
 
 // Caller has modified b->data and is done with the buffer.
 // Record the block number and pin in the cache with B_DIRTY.
-// commit()/write_log() will do the disk write.
+// logflush() will do the disk write.
 //
 // log_write() replaces bwrite(); a typical use is:
 //   bp = bread(...)
@@ -212,8 +434,6 @@ log_write(struct buf *b)
 {
   int i;
 
-  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
-    panic("too big a transaction");
   if (log.outstanding < 1)
     panic("log_write outside of trans");
 
@@ -222,9 +442,18 @@ log_write(struct buf *b)
     if (log.lh.block[i] == b->blockno)   // log absorbtion
       break;
   }
-  log.lh.block[i] = b->blockno;
-  if (i == log.lh.n)
+  if (i == log.lh.n) {
+    if (log.lh.n >= LOGSIZE || log.lh.n >= log_space())
+      panic("too big a transaction");
     log.lh.n++;
+    if (proc->logres > 0) {
+      proc->logres--;
+      log.reserved--;
+    }
+  }
+  log.lh.block[i] = b->blockno;
+  if (log.lh.n == 1)
+    log.opened = ticks;
   b->flags |= B_DIRTY; // prevent eviction
   release(&log.lock);
 }
@@ -0,0 +1,2897 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <fmtname>:
+#include "user.h"
+#include "fs.h"
+
+char*
+fmtname(char *path)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	53                   	push   %ebx
+       4:	83 ec 14             	sub    $0x14,%esp
+  static char buf[DIRSIZ+1];
+  char *p;
+  
+  // Find first character after last slash.
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+       7:	83 ec 0c             	sub    $0xc,%esp
+       a:	ff 75 08             	push   0x8(%ebp)
+       d:	e8 8f 04 00 00       	call   4a1 <strlen>
+      12:	83 c4 10             	add    $0x10,%esp
+      15:	8b 55 08             	mov    0x8(%ebp),%edx
+      18:	01 d0                	add    %edx,%eax
+      1a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      1d:	eb 04                	jmp    23 <fmtname+0x23>
+      1f:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+      23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      26:	3b 45 08             	cmp    0x8(%ebp),%eax
+      29:	72 0a                	jb     35 <fmtname+0x35>
+      2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      2e:	0f b6 00             	movzbl (%eax),%eax
+      31:	3c 2f                	cmp    $0x2f,%al
+      33:	75 ea                	jne    1f <fmtname+0x1f>
+    ;
+  p++;
+      35:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  
+  // Return blank-padded name.
+  if(strlen(p) >= DIRSIZ)
+      39:	83 ec 0c             	sub    $0xc,%esp
+      3c:	ff 75 f4             	push   -0xc(%ebp)
+      3f:	e8 5d 04 00 00       	call   4a1 <strlen>
+      44:	83 c4 10             	add    $0x10,%esp
+      47:	83 f8 0d             	cmp    $0xd,%eax
+      4a:	76 05                	jbe    51 <fmtname+0x51>
+    return p;
+      4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      4f:	eb 60                	jmp    b1 <fmtname+0xb1>
+  memmove(buf, p, strlen(p));
+      51:	83 ec 0c             	sub    $0xc,%esp
+      54:	ff 75 f4             	push   -0xc(%ebp)
+      57:	e8 45 04 00 00       	call   4a1 <strlen>
+      5c:	83 c4 10             	add    $0x10,%esp
+      5f:	83 ec 04             	sub    $0x4,%esp
+      62:	50                   	push   %eax
+      63:	ff 75 f4             	push   -0xc(%ebp)
+      66:	68 40 1c 00 00       	push   $0x1c40
+      6b:	e8 84 07 00 00       	call   7f4 <memmove>
+      70:	83 c4 10             	add    $0x10,%esp
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+      73:	83 ec 0c             	sub    $0xc,%esp
+      76:	ff 75 f4             	push   -0xc(%ebp)
+      79:	e8 23 04 00 00       	call   4a1 <strlen>
+      7e:	83 c4 10             	add    $0x10,%esp
+      81:	ba 0e 00 00 00       	mov    $0xe,%edx
+      86:	89 d3                	mov    %edx,%ebx
+      88:	29 c3                	sub    %eax,%ebx
+      8a:	83 ec 0c             	sub    $0xc,%esp
+      8d:	ff 75 f4             	push   -0xc(%ebp)
+      90:	e8 0c 04 00 00       	call   4a1 <strlen>
+      95:	83 c4 10             	add    $0x10,%esp
+      98:	05 40 1c 00 00       	add    $0x1c40,%eax
+      9d:	83 ec 04             	sub    $0x4,%esp
+      a0:	53                   	push   %ebx
+      a1:	6a 20                	push   $0x20
+      a3:	50                   	push   %eax
+      a4:	e8 7f 04 00 00       	call   528 <memset>
+      a9:	83 c4 10             	add    $0x10,%esp
+  return buf;
+      ac:	b8 40 1c 00 00       	mov    $0x1c40,%eax
+}
+      b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      b4:	c9                   	leave
+      b5:	c3                   	ret
+
+000000b6 <ls>:
+
+void
+ls(char *path)
+{
+      b6:	55                   	push   %ebp
+      b7:	89 e5                	mov    %esp,%ebp
+      b9:	57                   	push   %edi
+      ba:	56                   	push   %esi
+      bb:	53                   	push   %ebx
+      bc:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  char buf[512], *p;
+  int fd;
+  struct dirent de;
+  struct stat st;
+  
+  if((fd = open(path, 0)) < 0){
+      c2:	83 ec 08             	sub    $0x8,%esp
+      c5:	6a 00                	push   $0x0
+      c7:	ff 75 08             	push   0x8(%ebp)
+      ca:	e8 d9 08 00 00       	call   9a8 <open>
+      cf:	83 c4 10             	add    $0x10,%esp
+      d2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      d5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+      d9:	79 1a                	jns    f5 <ls+0x3f>
+    printf(2, "ls: cannot open %s\n", path);
+      db:	83 ec 04             	sub    $0x4,%esp
+      de:	ff 75 08             	push   0x8(%ebp)
+      e1:	68 c6 16 00 00       	push   $0x16c6
+      e6:	6a 02                	push   $0x2
+      e8:	e8 c5 0a 00 00       	call   bb2 <printf>
+      ed:	83 c4 10             	add    $0x10,%esp
+    return;
+      f0:	e9 e3 01 00 00       	jmp    2d8 <ls+0x222>
+  }
+  
+  if(fstat(fd, &st) < 0){
+      f5:	83 ec 08             	sub    $0x8,%esp
+      f8:	8d 85 bc fd ff ff    	lea    -0x244(%ebp),%eax
+      fe:	50                   	push   %eax
+      ff:	ff 75 e4             	push   -0x1c(%ebp)
+     102:	e8 ce 08 00 00       	call   9d5 <fstat>
+     107:	83 c4 10             	add    $0x10,%esp
+     10a:	85 c0                	test   %eax,%eax
+     10c:	79 28                	jns    136 <ls+0x80>
+    printf(2, "ls: cannot stat %s\n", path);
+     10e:	83 ec 04             	sub    $0x4,%esp
+     111:	ff 75 08             	push   0x8(%ebp)
+     114:	68 da 16 00 00       	push   $0x16da
+     119:	6a 02                	push   $0x2
+     11b:	e8 92 0a 00 00       	call   bb2 <printf>
+     120:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+     123:	83 ec 0c             	sub    $0xc,%esp
+     126:	ff 75 e4             	push   -0x1c(%ebp)
+     129:	e8 38 15 00 00       	call   1666 <close>
+     12e:	83 c4 10             	add    $0x10,%esp
+    return;
+     131:	e9 a2 01 00 00       	jmp    2d8 <ls+0x222>
+  }
+  
+  switch(st.type){
+     136:	0f b7 85 bc fd ff ff 	movzwl -0x244(%ebp),%eax
+     13d:	98                   	cwtl
+     13e:	83 f8 01             	cmp    $0x1,%eax
+     141:	74 48                	je     18b <ls+0xd5>
+     143:	83 f8 02             	cmp    $0x2,%eax
+     146:	0f 85 7e 01 00 00    	jne    2ca <ls+0x214>
+  case T_FILE:
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+     14c:	8b bd cc fd ff ff    	mov    -0x234(%ebp),%edi
+     152:	8b b5 c4 fd ff ff    	mov    -0x23c(%ebp),%esi
+     158:	0f b7 85 bc fd ff ff 	movzwl -0x244(%ebp),%eax
+     15f:	0f bf d8             	movswl %ax,%ebx
+     162:	83 ec 0c             	sub    $0xc,%esp
+     165:	ff 75 08             	push   0x8(%ebp)
+     168:	e8 93 fe ff ff       	call   0 <fmtname>
+     16d:	83 c4 10             	add    $0x10,%esp
+     170:	83 ec 08             	sub    $0x8,%esp
+     173:	57                   	push   %edi
+     174:	56                   	push   %esi
+     175:	53                   	push   %ebx
+     176:	50                   	push   %eax
+     177:	68 ee 16 00 00       	push   $0x16ee
+     17c:	6a 01                	push   $0x1
+     17e:	e8 2f 0a 00 00       	call   bb2 <printf>
+     183:	83 c4 20             	add    $0x20,%esp
+    break;
+     186:	e9 3f 01 00 00       	jmp    2ca <ls+0x214>
+  
+  case T_DIR:
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+     18b:	83 ec 0c             	sub    $0xc,%esp
+     18e:	ff 75 08             	push   0x8(%ebp)
+     191:	e8 0b 03 00 00       	call   4a1 <strlen>
+     196:	83 c4 10             	add    $0x10,%esp
+     199:	83 c0 10             	add    $0x10,%eax
+     19c:	3d 00 02 00 00       	cmp    $0x200,%eax
+     1a1:	76 17                	jbe    1ba <ls+0x104>
+      printf(1, "ls: path too long\n");
+     1a3:	83 ec 08             	sub    $0x8,%esp
+     1a6:	68 fb 16 00 00       	push   $0x16fb
+     1ab:	6a 01                	push   $0x1
+     1ad:	e8 00 0a 00 00       	call   bb2 <printf>
+     1b2:	83 c4 10             	add    $0x10,%esp
+      break;
+     1b5:	e9 10 01 00 00       	jmp    2ca <ls+0x214>
+    }
+    strcpy(buf, path);
+     1ba:	83 ec 08             	sub    $0x8,%esp
+     1bd:	ff 75 08             	push   0x8(%ebp)
+     1c0:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+     1c6:	50                   	push   %eax
+     1c7:	e8 22 02 00 00       	call   3ee <strcpy>
+     1cc:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+     1cf:	83 ec 0c             	sub    $0xc,%esp
+     1d2:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+     1d8:	50                   	push   %eax
+     1d9:	e8 c3 02 00 00       	call   4a1 <strlen>
+     1de:	83 c4 10             	add    $0x10,%esp
+     1e1:	8d 95 e0 fd ff ff    	lea    -0x220(%ebp),%edx
+     1e7:	01 d0                	add    %edx,%eax
+     1e9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    *p++ = '/';
+     1ec:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     1ef:	8d 50 01             	lea    0x1(%eax),%edx
+     1f2:	89 55 e0             	mov    %edx,-0x20(%ebp)
+     1f5:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+     1f8:	e9 ac 00 00 00       	jmp    2a9 <ls+0x1f3>
+      if(de.inum == 0)
+     1fd:	0f b7 85 d0 fd ff ff 	movzwl -0x230(%ebp),%eax
+     204:	66 85 c0             	test   %ax,%ax
+     207:	0f 84 9b 00 00 00    	je     2a8 <ls+0x1f2>
+        continue;
+      memmove(p, de.name, DIRSIZ);
+     20d:	83 ec 04             	sub    $0x4,%esp
+     210:	6a 0e                	push   $0xe
+     212:	8d 85 d0 fd ff ff    	lea    -0x230(%ebp),%eax
+     218:	83 c0 02             	add    $0x2,%eax
+     21b:	50                   	push   %eax
+     21c:	ff 75 e0             	push   -0x20(%ebp)
+     21f:	e8 d0 05 00 00       	call   7f4 <memmove>
+     224:	83 c4 10             	add    $0x10,%esp
+      p[DIRSIZ] = 0;
+     227:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     22a:	83 c0 0e             	add    $0xe,%eax
+     22d:	c6 00 00             	movb   $0x0,(%eax)
+      if(stat(buf, &st) < 0){
+     230:	83 ec 08             	sub    $0x8,%esp
+     233:	8d 85 bc fd ff ff    	lea    -0x244(%ebp),%eax
+     239:	50                   	push   %eax
+     23a:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+     240:	50                   	push   %eax
+     241:	e8 14 05 00 00       	call   75a <stat>
+     246:	83 c4 10             	add    $0x10,%esp
+     249:	85 c0                	test   %eax,%eax
+     24b:	79 1b                	jns    268 <ls+0x1b2>
+        printf(1, "ls: cannot stat %s\n", buf);
+     24d:	83 ec 04             	sub    $0x4,%esp
+     250:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+     256:	50                   	push   %eax
+     257:	68 da 16 00 00       	push   $0x16da
+     25c:	6a 01                	push   $0x1
+     25e:	e8 4f 09 00 00       	call   bb2 <printf>
+     263:	83 c4 10             	add    $0x10,%esp
+        continue;
+     266:	eb 41                	jmp    2a9 <ls+0x1f3>
+      }
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+     268:	8b bd cc fd ff ff    	mov    -0x234(%ebp),%edi
+     26e:	8b b5 c4 fd ff ff    	mov    -0x23c(%ebp),%esi
+     274:	0f b7 85 bc fd ff ff 	movzwl -0x244(%ebp),%eax
+     27b:	0f bf d8             	movswl %ax,%ebx
+     27e:	83 ec 0c             	sub    $0xc,%esp
+     281:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+     287:	50                   	push   %eax
+     288:	e8 73 fd ff ff       	call   0 <fmtname>
+     28d:	83 c4 10             	add    $0x10,%esp
+     290:	83 ec 08             	sub    $0x8,%esp
+     293:	57                   	push   %edi
+     294:	56                   	push   %esi
+     295:	53                   	push   %ebx
+     296:	50                   	push   %eax
+     297:	68 ee 16 00 00       	push   $0x16ee
+     29c:	6a 01                	push   $0x1
+     29e:	e8 0f 09 00 00       	call   bb2 <printf>
+     2a3:	83 c4 20             	add    $0x20,%esp
+     2a6:	eb 01                	jmp    2a9 <ls+0x1f3>
+        continue;
+     2a8:	90                   	nop
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+     2a9:	83 ec 04             	sub    $0x4,%esp
+     2ac:	6a 10                	push   $0x10
+     2ae:	8d 85 d0 fd ff ff    	lea    -0x230(%ebp),%eax
+     2b4:	50                   	push   %eax
+     2b5:	ff 75 e4             	push   -0x1c(%ebp)
+     2b8:	e8 a0 06 00 00       	call   95d <read>
+     2bd:	83 c4 10             	add    $0x10,%esp
+     2c0:	83 f8 10             	cmp    $0x10,%eax
+     2c3:	0f 84 34 ff ff ff    	je     1fd <ls+0x147>
+    }
+    break;
+     2c9:	90                   	nop
+  }
+  close(fd);
+     2ca:	83 ec 0c             	sub    $0xc,%esp
+     2cd:	ff 75 e4             	push   -0x1c(%ebp)
+     2d0:	e8 91 13 00 00       	call   1666 <close>
+     2d5:	83 c4 10             	add    $0x10,%esp
+}
+     2d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2db:	5b                   	pop    %ebx
+     2dc:	5e                   	pop    %esi
+     2dd:	5f                   	pop    %edi
+     2de:	5d                   	pop    %ebp
+     2df:	c3                   	ret
+
+000002e0 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     2e0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     2e4:	83 e4 f0             	and    $0xfffffff0,%esp
+     2e7:	ff 71 fc             	push   -0x4(%ecx)
+     2ea:	55                   	push   %ebp
+     2eb:	89 e5                	mov    %esp,%ebp
+     2ed:	53                   	push   %ebx
+     2ee:	51                   	push   %ecx
+     2ef:	83 ec 10             	sub    $0x10,%esp
+     2f2:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 2){
+     2f4:	83 3b 01             	cmpl   $0x1,(%ebx)
+     2f7:	7f 15                	jg     30e <main+0x2e>
+    ls(".");
+     2f9:	83 ec 0c             	sub    $0xc,%esp
+     2fc:	68 0e 17 00 00       	push   $0x170e
+     301:	e8 b0 fd ff ff       	call   b6 <ls>
+     306:	83 c4 10             	add    $0x10,%esp
+    exit();
+     309:	e8 40 13 00 00       	call   164e <exit>
+  }
+  for(i=1; i<argc; i++)
+     30e:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+     315:	eb 21                	jmp    338 <main+0x58>
+    ls(argv[i]);
+     317:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     31a:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     321:	8b 43 04             	mov    0x4(%ebx),%eax
+     324:	01 d0                	add    %edx,%eax
+     326:	8b 00                	mov    (%eax),%eax
+     328:	83 ec 0c             	sub    $0xc,%esp
+     32b:	50                   	push   %eax
+     32c:	e8 85 fd ff ff       	call   b6 <ls>
+     331:	83 c4 10             	add    $0x10,%esp
+  for(i=1; i<argc; i++)
+     334:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     338:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     33b:	3b 03                	cmp    (%ebx),%eax
+     33d:	7c d8                	jl     317 <main+0x37>
+  exit();
+     33f:	e8 0a 13 00 00       	call   164e <exit>
+
+00000344 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+     344:	55                   	push   %ebp
+     345:	89 e5                	mov    %esp,%ebp
+     347:	57                   	push   %edi
+     348:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+     349:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     34c:	8b 55 10             	mov    0x10(%ebp),%edx
+     34f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     352:	89 cb                	mov    %ecx,%ebx
+     354:	89 df                	mov    %ebx,%edi
+     356:	89 d1                	mov    %edx,%ecx
+     358:	fc                   	cld
+     359:	f3 aa                	rep stos %al,%es:(%edi)
+     35b:	89 ca                	mov    %ecx,%edx
+     35d:	89 fb                	mov    %edi,%ebx
+     35f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     362:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     365:	90                   	nop
+     366:	5b                   	pop    %ebx
+     367:	5f                   	pop    %edi
+     368:	5d                   	pop    %ebp
+     369:	c3                   	ret
+
+0000036a <stosl>:
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+     36a:	55                   	push   %ebp
+     36b:	89 e5                	mov    %esp,%ebp
+     36d:	57                   	push   %edi
+     36e:	53                   	push   %ebx
+  asm volatile("cld; rep stosl" :
+     36f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     372:	8b 55 10             	mov    0x10(%ebp),%edx
+     375:	8b 45 0c             	mov    0xc(%ebp),%eax
+     378:	89 cb                	mov    %ecx,%ebx
+     37a:	89 df                	mov    %ebx,%edi
+     37c:	89 d1                	mov    %edx,%ecx
+     37e:	fc                   	cld
+     37f:	f3 ab                	rep stos %eax,%es:(%edi)
+     381:	89 ca                	mov    %ecx,%edx
+     383:	89 fb                	mov    %edi,%ebx
+     385:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     388:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     38b:	90                   	nop
+     38c:	5b                   	pop    %ebx
+     38d:	5f                   	pop    %edi
+     38e:	5d                   	pop    %ebp
+     38f:	c3                   	ret
+
+00000390 <movsb>:
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+     390:	55                   	push   %ebp
+     391:	89 e5                	mov    %esp,%ebp
+     393:	57                   	push   %edi
+     394:	56                   	push   %esi
+     395:	53                   	push   %ebx
+  asm volatile("cld; rep movsb" :
+     396:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     399:	8b 55 0c             	mov    0xc(%ebp),%edx
+     39c:	8b 45 10             	mov    0x10(%ebp),%eax
+     39f:	89 cb                	mov    %ecx,%ebx
+     3a1:	89 df                	mov    %ebx,%edi
+     3a3:	89 d6                	mov    %edx,%esi
+     3a5:	89 c1                	mov    %eax,%ecx
+     3a7:	fc                   	cld
+     3a8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     3aa:	89 c8                	mov    %ecx,%eax
+     3ac:	89 f2                	mov    %esi,%edx
+     3ae:	89 fb                	mov    %edi,%ebx
+     3b0:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     3b3:	89 55 0c             	mov    %edx,0xc(%ebp)
+     3b6:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     3b9:	90                   	nop
+     3ba:	5b                   	pop    %ebx
+     3bb:	5e                   	pop    %esi
+     3bc:	5f                   	pop    %edi
+     3bd:	5d                   	pop    %ebp
+     3be:	c3                   	ret
+
+000003bf <movsl>:
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+     3bf:	55                   	push   %ebp
+     3c0:	89 e5                	mov    %esp,%ebp
+     3c2:	57                   	push   %edi
+     3c3:	56                   	push   %esi
+     3c4:	53                   	push   %ebx
+  asm volatile("cld; rep movsl" :
+     3c5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     3c8:	8b 55 0c             	mov    0xc(%ebp),%edx
+     3cb:	8b 45 10             	mov    0x10(%ebp),%eax
+     3ce:	89 cb                	mov    %ecx,%ebx
+     3d0:	89 df                	mov    %ebx,%edi
+     3d2:	89 d6                	mov    %edx,%esi
+     3d4:	89 c1                	mov    %eax,%ecx
+     3d6:	fc                   	cld
+     3d7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     3d9:	89 c8                	mov    %ecx,%eax
+     3db:	89 f2                	mov    %esi,%edx
+     3dd:	89 fb                	mov    %edi,%ebx
+     3df:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     3e2:	89 55 0c             	mov    %edx,0xc(%ebp)
+     3e5:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     3e8:	90                   	nop
+     3e9:	5b                   	pop    %ebx
+     3ea:	5e                   	pop    %esi
+     3eb:	5f                   	pop    %edi
+     3ec:	5d                   	pop    %ebp
+     3ed:	c3                   	ret
+
+000003ee <strcpy>:
+#define ONES        0x01010101
+#define HASZERO(x)  (((x) - ONES) & ~(x) & (ONES << 7))
+
+char*
+strcpy(char *s, char *t)
+{
+     3ee:	55                   	push   %ebp
+     3ef:	89 e5                	mov    %esp,%ebp
+     3f1:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+     3f4:	8b 45 08             	mov    0x8(%ebp),%eax
+     3f7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     3fa:	90                   	nop
+     3fb:	8b 55 0c             	mov    0xc(%ebp),%edx
+     3fe:	8d 42 01             	lea    0x1(%edx),%eax
+     401:	89 45 0c             	mov    %eax,0xc(%ebp)
+     404:	8b 45 08             	mov    0x8(%ebp),%eax
+     407:	8d 48 01             	lea    0x1(%eax),%ecx
+     40a:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     40d:	0f b6 12             	movzbl (%edx),%edx
+     410:	88 10                	mov    %dl,(%eax)
+     412:	0f b6 00             	movzbl (%eax),%eax
+     415:	84 c0                	test   %al,%al
+     417:	75 e2                	jne    3fb <strcpy+0xd>
+    ;
+  return os;
+     419:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     41c:	c9                   	leave
+     41d:	c3                   	ret
+
+0000041e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     41e:	55                   	push   %ebp
+     41f:	89 e5                	mov    %esp,%ebp
+  // Aligned words never straddle a page, so reading
+  // whole ones past the end of a string is safe.
+  if((((uint)p | (uint)q) & 3) == 0)
+     421:	8b 55 08             	mov    0x8(%ebp),%edx
+     424:	8b 45 0c             	mov    0xc(%ebp),%eax
+     427:	09 d0                	or     %edx,%eax
+     429:	83 e0 03             	and    $0x3,%eax
+     42c:	85 c0                	test   %eax,%eax
+     42e:	75 3f                	jne    46f <strcmp+0x51>
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     430:	eb 08                	jmp    43a <strcmp+0x1c>
+      p += 4, q += 4;
+     432:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     436:	83 45 0c 04          	addl   $0x4,0xc(%ebp)
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     43a:	8b 45 08             	mov    0x8(%ebp),%eax
+     43d:	8b 10                	mov    (%eax),%edx
+     43f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     442:	8b 00                	mov    (%eax),%eax
+     444:	39 c2                	cmp    %eax,%edx
+     446:	75 27                	jne    46f <strcmp+0x51>
+     448:	8b 45 08             	mov    0x8(%ebp),%eax
+     44b:	8b 00                	mov    (%eax),%eax
+     44d:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     453:	8b 45 08             	mov    0x8(%ebp),%eax
+     456:	8b 00                	mov    (%eax),%eax
+     458:	f7 d0                	not    %eax
+     45a:	21 d0                	and    %edx,%eax
+     45c:	25 80 80 80 80       	and    $0x80808080,%eax
+     461:	85 c0                	test   %eax,%eax
+     463:	74 cd                	je     432 <strcmp+0x14>
+  while(*p && *p == *q)
+     465:	eb 08                	jmp    46f <strcmp+0x51>
+    p++, q++;
+     467:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     46b:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     46f:	8b 45 08             	mov    0x8(%ebp),%eax
+     472:	0f b6 00             	movzbl (%eax),%eax
+     475:	84 c0                	test   %al,%al
+     477:	74 10                	je     489 <strcmp+0x6b>
+     479:	8b 45 08             	mov    0x8(%ebp),%eax
+     47c:	0f b6 10             	movzbl (%eax),%edx
+     47f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     482:	0f b6 00             	movzbl (%eax),%eax
+     485:	38 c2                	cmp    %al,%dl
+     487:	74 de                	je     467 <strcmp+0x49>
+  return (uchar)*p - (uchar)*q;
+     489:	8b 45 08             	mov    0x8(%ebp),%eax
+     48c:	0f b6 00             	movzbl (%eax),%eax
+     48f:	0f b6 d0             	movzbl %al,%edx
+     492:	8b 45 0c             	mov    0xc(%ebp),%eax
+     495:	0f b6 00             	movzbl (%eax),%eax
+     498:	0f b6 c0             	movzbl %al,%eax
+     49b:	29 c2                	sub    %eax,%edx
+     49d:	89 d0                	mov    %edx,%eax
+}
+     49f:	5d                   	pop    %ebp
+     4a0:	c3                   	ret
+
+000004a1 <strlen>:
+
+uint
+strlen(char *s)
+{
+     4a1:	55                   	push   %ebp
+     4a2:	89 e5                	mov    %esp,%ebp
+     4a4:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; ((uint)(s+n) & 3) && s[n]; n++)
+     4a7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     4ae:	eb 04                	jmp    4b4 <strlen+0x13>
+     4b0:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     4b4:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     4b7:	8b 45 08             	mov    0x8(%ebp),%eax
+     4ba:	01 d0                	add    %edx,%eax
+     4bc:	83 e0 03             	and    $0x3,%eax
+     4bf:	85 c0                	test   %eax,%eax
+     4c1:	74 0f                	je     4d2 <strlen+0x31>
+     4c3:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     4c6:	8b 45 08             	mov    0x8(%ebp),%eax
+     4c9:	01 d0                	add    %edx,%eax
+     4cb:	0f b6 00             	movzbl (%eax),%eax
+     4ce:	84 c0                	test   %al,%al
+     4d0:	75 de                	jne    4b0 <strlen+0xf>
+    ;
+  if(s[n])
+     4d2:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     4d5:	8b 45 08             	mov    0x8(%ebp),%eax
+     4d8:	01 d0                	add    %edx,%eax
+     4da:	0f b6 00             	movzbl (%eax),%eax
+     4dd:	84 c0                	test   %al,%al
+     4df:	74 33                	je     514 <strlen+0x73>
+    while(!HASZERO(*(uint*)(s+n)))
+     4e1:	eb 04                	jmp    4e7 <strlen+0x46>
+      n += 4;
+     4e3:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+    while(!HASZERO(*(uint*)(s+n)))
+     4e7:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     4ea:	8b 45 08             	mov    0x8(%ebp),%eax
+     4ed:	01 d0                	add    %edx,%eax
+     4ef:	8b 00                	mov    (%eax),%eax
+     4f1:	8d 88 ff fe fe fe    	lea    -0x1010101(%eax),%ecx
+     4f7:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     4fa:	8b 45 08             	mov    0x8(%ebp),%eax
+     4fd:	01 d0                	add    %edx,%eax
+     4ff:	8b 00                	mov    (%eax),%eax
+     501:	f7 d0                	not    %eax
+     503:	21 c8                	and    %ecx,%eax
+     505:	25 80 80 80 80       	and    $0x80808080,%eax
+     50a:	85 c0                	test   %eax,%eax
+     50c:	74 d5                	je     4e3 <strlen+0x42>
+  for(; s[n]; n++)
+     50e:	eb 04                	jmp    514 <strlen+0x73>
+     510:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     514:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     517:	8b 45 08             	mov    0x8(%ebp),%eax
+     51a:	01 d0                	add    %edx,%eax
+     51c:	0f b6 00             	movzbl (%eax),%eax
+     51f:	84 c0                	test   %al,%al
+     521:	75 ed                	jne    510 <strlen+0x6f>
+    ;
+  return n;
+     523:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     526:	c9                   	leave
+     527:	c3                   	ret
+
+00000528 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     528:	55                   	push   %ebp
+     529:	89 e5                	mov    %esp,%ebp
+     52b:	83 ec 10             	sub    $0x10,%esp
+  char *d;
+  uint k;
+
+  d = dst;
+     52e:	8b 45 08             	mov    0x8(%ebp),%eax
+     531:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c &= 0xFF;
+     534:	81 65 0c ff 00 00 00 	andl   $0xff,0xc(%ebp)
+  if(n >= 16){
+     53b:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     53f:	76 54                	jbe    595 <memset+0x6d>
+    k = -(uint)d & 3;  // bytes up to a word boundary
+     541:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     544:	f7 d8                	neg    %eax
+     546:	83 e0 03             	and    $0x3,%eax
+     549:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    stosb(d, c, k);
+     54c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     54f:	50                   	push   %eax
+     550:	ff 75 0c             	push   0xc(%ebp)
+     553:	ff 75 fc             	push   -0x4(%ebp)
+     556:	e8 e9 fd ff ff       	call   344 <stosb>
+     55b:	83 c4 0c             	add    $0xc,%esp
+    d += k;
+     55e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     561:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n -= k;
+     564:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     567:	29 45 10             	sub    %eax,0x10(%ebp)
+    stosl(d, c*ONES, n/4);
+     56a:	8b 45 10             	mov    0x10(%ebp),%eax
+     56d:	c1 e8 02             	shr    $0x2,%eax
+     570:	89 c2                	mov    %eax,%edx
+     572:	8b 45 0c             	mov    0xc(%ebp),%eax
+     575:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     57b:	52                   	push   %edx
+     57c:	50                   	push   %eax
+     57d:	ff 75 fc             	push   -0x4(%ebp)
+     580:	e8 e5 fd ff ff       	call   36a <stosl>
+     585:	83 c4 0c             	add    $0xc,%esp
+    d += n & ~3;
+     588:	8b 45 10             	mov    0x10(%ebp),%eax
+     58b:	83 e0 fc             	and    $0xfffffffc,%eax
+     58e:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n &= 3;
+     591:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+  }
+  stosb(d, c, n);
+     595:	8b 45 10             	mov    0x10(%ebp),%eax
+     598:	50                   	push   %eax
+     599:	ff 75 0c             	push   0xc(%ebp)
+     59c:	ff 75 fc             	push   -0x4(%ebp)
+     59f:	e8 a0 fd ff ff       	call   344 <stosb>
+     5a4:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     5a7:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     5aa:	c9                   	leave
+     5ab:	c3                   	ret
+
+000005ac <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     5ac:	55                   	push   %ebp
+     5ad:	89 e5                	mov    %esp,%ebp
+     5af:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s1, *s2;
+
+  s1 = v1;
+     5b2:	8b 45 08             	mov    0x8(%ebp),%eax
+     5b5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s2 = v2;
+     5b8:	8b 45 0c             	mov    0xc(%ebp),%eax
+     5bb:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     5be:	eb 0c                	jmp    5cc <memcmp+0x20>
+    s1 += 4, s2 += 4, n -= 4;
+     5c0:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+     5c4:	83 45 f8 04          	addl   $0x4,-0x8(%ebp)
+     5c8:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     5cc:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     5d0:	76 3e                	jbe    610 <memcmp+0x64>
+     5d2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     5d5:	8b 10                	mov    (%eax),%edx
+     5d7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     5da:	8b 00                	mov    (%eax),%eax
+     5dc:	39 c2                	cmp    %eax,%edx
+     5de:	74 e0                	je     5c0 <memcmp+0x14>
+  while(n-- > 0){
+     5e0:	eb 2e                	jmp    610 <memcmp+0x64>
+    if(*s1 != *s2)
+     5e2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     5e5:	0f b6 10             	movzbl (%eax),%edx
+     5e8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     5eb:	0f b6 00             	movzbl (%eax),%eax
+     5ee:	38 c2                	cmp    %al,%dl
+     5f0:	74 16                	je     608 <memcmp+0x5c>
+      return *s1 - *s2;
+     5f2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     5f5:	0f b6 00             	movzbl (%eax),%eax
+     5f8:	0f b6 d0             	movzbl %al,%edx
+     5fb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     5fe:	0f b6 00             	movzbl (%eax),%eax
+     601:	0f b6 c0             	movzbl %al,%eax
+     604:	29 c2                	sub    %eax,%edx
+     606:	eb 1a                	jmp    622 <memcmp+0x76>
+    s1++, s2++;
+     608:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     60c:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+  while(n-- > 0){
+     610:	8b 45 10             	mov    0x10(%ebp),%eax
+     613:	8d 50 ff             	lea    -0x1(%eax),%edx
+     616:	89 55 10             	mov    %edx,0x10(%ebp)
+     619:	85 c0                	test   %eax,%eax
+     61b:	75 c5                	jne    5e2 <memcmp+0x36>
+  }
+  return 0;
+     61d:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+     622:	89 d0                	mov    %edx,%eax
+     624:	c9                   	leave
+     625:	c3                   	ret
+
+00000626 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     626:	55                   	push   %ebp
+     627:	89 e5                	mov    %esp,%ebp
+     629:	83 ec 14             	sub    $0x14,%esp
+     62c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     62f:	88 45 ec             	mov    %al,-0x14(%ebp)
+  uint w, cc;
+
+  // Skip whole words holding neither c nor the terminator.
+  for(; ((uint)s & 3) && *s; s++)
+     632:	eb 17                	jmp    64b <strchr+0x25>
+    if(*s == c)
+     634:	8b 45 08             	mov    0x8(%ebp),%eax
+     637:	0f b6 00             	movzbl (%eax),%eax
+     63a:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     63d:	75 08                	jne    647 <strchr+0x21>
+      return (char*)s;
+     63f:	8b 45 08             	mov    0x8(%ebp),%eax
+     642:	e9 ad 00 00 00       	jmp    6f4 <strchr+0xce>
+  for(; ((uint)s & 3) && *s; s++)
+     647:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     64b:	8b 45 08             	mov    0x8(%ebp),%eax
+     64e:	83 e0 03             	and    $0x3,%eax
+     651:	85 c0                	test   %eax,%eax
+     653:	74 0a                	je     65f <strchr+0x39>
+     655:	8b 45 08             	mov    0x8(%ebp),%eax
+     658:	0f b6 00             	movzbl (%eax),%eax
+     65b:	84 c0                	test   %al,%al
+     65d:	75 d5                	jne    634 <strchr+0xe>
+  cc = (uchar)c * ONES;
+     65f:	0f b6 45 ec          	movzbl -0x14(%ebp),%eax
+     663:	0f b6 c0             	movzbl %al,%eax
+     666:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     66c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(*s)
+     66f:	8b 45 08             	mov    0x8(%ebp),%eax
+     672:	0f b6 00             	movzbl (%eax),%eax
+     675:	84 c0                	test   %al,%al
+     677:	74 6c                	je     6e5 <strchr+0xbf>
+    for(; w = *(uint*)s, !HASZERO(w) && !HASZERO(w ^ cc); s += 4)
+     679:	eb 04                	jmp    67f <strchr+0x59>
+     67b:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     67f:	8b 45 08             	mov    0x8(%ebp),%eax
+     682:	8b 00                	mov    (%eax),%eax
+     684:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     687:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     68a:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     690:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     693:	f7 d0                	not    %eax
+     695:	21 d0                	and    %edx,%eax
+     697:	25 80 80 80 80       	and    $0x80808080,%eax
+     69c:	85 c0                	test   %eax,%eax
+     69e:	75 26                	jne    6c6 <strchr+0xa0>
+     6a0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     6a3:	33 45 fc             	xor    -0x4(%ebp),%eax
+     6a6:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     6ac:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     6af:	33 45 fc             	xor    -0x4(%ebp),%eax
+     6b2:	f7 d0                	not    %eax
+     6b4:	21 d0                	and    %edx,%eax
+     6b6:	25 80 80 80 80       	and    $0x80808080,%eax
+     6bb:	85 c0                	test   %eax,%eax
+     6bd:	75 07                	jne    6c6 <strchr+0xa0>
+     6bf:	b8 01 00 00 00       	mov    $0x1,%eax
+     6c4:	eb 05                	jmp    6cb <strchr+0xa5>
+     6c6:	b8 00 00 00 00       	mov    $0x0,%eax
+     6cb:	85 c0                	test   %eax,%eax
+     6cd:	75 ac                	jne    67b <strchr+0x55>
+      ;
+  for(; *s; s++)
+     6cf:	eb 14                	jmp    6e5 <strchr+0xbf>
+    if(*s == c)
+     6d1:	8b 45 08             	mov    0x8(%ebp),%eax
+     6d4:	0f b6 00             	movzbl (%eax),%eax
+     6d7:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     6da:	75 05                	jne    6e1 <strchr+0xbb>
+      return (char*)s;
+     6dc:	8b 45 08             	mov    0x8(%ebp),%eax
+     6df:	eb 13                	jmp    6f4 <strchr+0xce>
+  for(; *s; s++)
+     6e1:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     6e5:	8b 45 08             	mov    0x8(%ebp),%eax
+     6e8:	0f b6 00             	movzbl (%eax),%eax
+     6eb:	84 c0                	test   %al,%al
+     6ed:	75 e2                	jne    6d1 <strchr+0xab>
+  return 0;
+     6ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     6f4:	c9                   	leave
+     6f5:	c3                   	ret
+
+000006f6 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     6f6:	55                   	push   %ebp
+     6f7:	89 e5                	mov    %esp,%ebp
+     6f9:	83 ec 18             	sub    $0x18,%esp
+  int i, c;
+
+  for(i=0; i+1 < max; ){
+     6fc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     703:	eb 37                	jmp    73c <gets+0x46>
+    c = fgetc(0);
+     705:	83 ec 0c             	sub    $0xc,%esp
+     708:	6a 00                	push   $0x0
+     70a:	e8 2e 0e 00 00       	call   153d <fgetc>
+     70f:	83 c4 10             	add    $0x10,%esp
+     712:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(c < 0)
+     715:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     719:	78 2e                	js     749 <gets+0x53>
+      break;
+    buf[i++] = c;
+     71b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     71e:	8d 50 01             	lea    0x1(%eax),%edx
+     721:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     724:	89 c2                	mov    %eax,%edx
+     726:	8b 45 08             	mov    0x8(%ebp),%eax
+     729:	01 d0                	add    %edx,%eax
+     72b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     72e:	88 10                	mov    %dl,(%eax)
+    if(c == '\n' || c == '\r')
+     730:	83 7d f0 0a          	cmpl   $0xa,-0x10(%ebp)
+     734:	74 14                	je     74a <gets+0x54>
+     736:	83 7d f0 0d          	cmpl   $0xd,-0x10(%ebp)
+     73a:	74 0e                	je     74a <gets+0x54>
+  for(i=0; i+1 < max; ){
+     73c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     73f:	83 c0 01             	add    $0x1,%eax
+     742:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     745:	7f be                	jg     705 <gets+0xf>
+     747:	eb 01                	jmp    74a <gets+0x54>
+      break;
+     749:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     74a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     74d:	8b 45 08             	mov    0x8(%ebp),%eax
+     750:	01 d0                	add    %edx,%eax
+     752:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     755:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     758:	c9                   	leave
+     759:	c3                   	ret
+
+0000075a <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     75a:	55                   	push   %ebp
+     75b:	89 e5                	mov    %esp,%ebp
+     75d:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     760:	83 ec 08             	sub    $0x8,%esp
+     763:	6a 00                	push   $0x0
+     765:	ff 75 08             	push   0x8(%ebp)
+     768:	e8 3b 02 00 00       	call   9a8 <open>
+     76d:	83 c4 10             	add    $0x10,%esp
+     770:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     773:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     777:	79 07                	jns    780 <stat+0x26>
+    return -1;
+     779:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     77e:	eb 25                	jmp    7a5 <stat+0x4b>
+  r = fstat(fd, st);
+     780:	83 ec 08             	sub    $0x8,%esp
+     783:	ff 75 0c             	push   0xc(%ebp)
+     786:	ff 75 f4             	push   -0xc(%ebp)
+     789:	e8 47 02 00 00       	call   9d5 <fstat>
+     78e:	83 c4 10             	add    $0x10,%esp
+     791:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     794:	83 ec 0c             	sub    $0xc,%esp
+     797:	ff 75 f4             	push   -0xc(%ebp)
+     79a:	e8 c7 0e 00 00       	call   1666 <close>
+     79f:	83 c4 10             	add    $0x10,%esp
+  return r;
+     7a2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     7a5:	c9                   	leave
+     7a6:	c3                   	ret
+
+000007a7 <atoi>:
+
+int
+atoi(const char *s)
+{
+     7a7:	55                   	push   %ebp
+     7a8:	89 e5                	mov    %esp,%ebp
+     7aa:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     7ad:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     7b4:	eb 25                	jmp    7db <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     7b6:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     7b9:	89 d0                	mov    %edx,%eax
+     7bb:	c1 e0 02             	shl    $0x2,%eax
+     7be:	01 d0                	add    %edx,%eax
+     7c0:	01 c0                	add    %eax,%eax
+     7c2:	89 c1                	mov    %eax,%ecx
+     7c4:	8b 45 08             	mov    0x8(%ebp),%eax
+     7c7:	8d 50 01             	lea    0x1(%eax),%edx
+     7ca:	89 55 08             	mov    %edx,0x8(%ebp)
+     7cd:	0f b6 00             	movzbl (%eax),%eax
+     7d0:	0f be c0             	movsbl %al,%eax
+     7d3:	01 c8                	add    %ecx,%eax
+     7d5:	83 e8 30             	sub    $0x30,%eax
+     7d8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     7db:	8b 45 08             	mov    0x8(%ebp),%eax
+     7de:	0f b6 00             	movzbl (%eax),%eax
+     7e1:	3c 2f                	cmp    $0x2f,%al
+     7e3:	7e 0a                	jle    7ef <atoi+0x48>
+     7e5:	8b 45 08             	mov    0x8(%ebp),%eax
+     7e8:	0f b6 00             	movzbl (%eax),%eax
+     7eb:	3c 39                	cmp    $0x39,%al
+     7ed:	7e c7                	jle    7b6 <atoi+0xf>
+  return n;
+     7ef:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     7f2:	c9                   	leave
+     7f3:	c3                   	ret
+
+000007f4 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     7f4:	55                   	push   %ebp
+     7f5:	89 e5                	mov    %esp,%ebp
+     7f7:	83 ec 10             	sub    $0x10,%esp
+  char *d, *s;
+  int k;
+
+  if(n <= 0)
+     7fa:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     7fe:	7f 08                	jg     808 <memmove+0x14>
+    return vdst;
+     800:	8b 45 08             	mov    0x8(%ebp),%eax
+     803:	e9 17 01 00 00       	jmp    91f <memmove+0x12b>
+  d = vdst;
+     808:	8b 45 08             	mov    0x8(%ebp),%eax
+     80b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s = vsrc;
+     80e:	8b 45 0c             	mov    0xc(%ebp),%eax
+     811:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  if(s < d && s + n > d){
+     814:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     817:	3b 45 fc             	cmp    -0x4(%ebp),%eax
+     81a:	0f 83 84 00 00 00    	jae    8a4 <memmove+0xb0>
+     820:	8b 55 10             	mov    0x10(%ebp),%edx
+     823:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     826:	01 d0                	add    %edx,%eax
+     828:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     82b:	73 77                	jae    8a4 <memmove+0xb0>
+    s += n;
+     82d:	8b 45 10             	mov    0x10(%ebp),%eax
+     830:	01 45 f8             	add    %eax,-0x8(%ebp)
+    d += n;
+     833:	8b 45 10             	mov    0x10(%ebp),%eax
+     836:	01 45 fc             	add    %eax,-0x4(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     839:	eb 17                	jmp    852 <memmove+0x5e>
+      *--d = *--s, n--;
+     83b:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     83f:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     843:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     846:	0f b6 10             	movzbl (%eax),%edx
+     849:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     84c:	88 10                	mov    %dl,(%eax)
+     84e:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     852:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     856:	7e 22                	jle    87a <memmove+0x86>
+     858:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     85b:	83 e0 03             	and    $0x3,%eax
+     85e:	85 c0                	test   %eax,%eax
+     860:	75 d9                	jne    83b <memmove+0x47>
+    for(; n >= 4; n -= 4){
+     862:	eb 16                	jmp    87a <memmove+0x86>
+      d -= 4;
+     864:	83 6d fc 04          	subl   $0x4,-0x4(%ebp)
+      s -= 4;
+     868:	83 6d f8 04          	subl   $0x4,-0x8(%ebp)
+      *(uint*)d = *(uint*)s;
+     86c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     86f:	8b 10                	mov    (%eax),%edx
+     871:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     874:	89 10                	mov    %edx,(%eax)
+    for(; n >= 4; n -= 4){
+     876:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+     87a:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     87e:	7f e4                	jg     864 <memmove+0x70>
+    }
+    while(n-- > 0)
+     880:	eb 13                	jmp    895 <memmove+0xa1>
+      *--d = *--s;
+     882:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     886:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     88a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     88d:	0f b6 10             	movzbl (%eax),%edx
+     890:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     893:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+     895:	8b 45 10             	mov    0x10(%ebp),%eax
+     898:	8d 50 ff             	lea    -0x1(%eax),%edx
+     89b:	89 55 10             	mov    %edx,0x10(%ebp)
+     89e:	85 c0                	test   %eax,%eax
+     8a0:	7f e0                	jg     882 <memmove+0x8e>
+  if(s < d && s + n > d){
+     8a2:	eb 78                	jmp    91c <memmove+0x128>
+  } else {
+    if(n >= 16){
+     8a4:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     8a8:	7e 61                	jle    90b <memmove+0x117>
+      k = -(uint)d & 3;
+     8aa:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     8ad:	f7 d8                	neg    %eax
+     8af:	83 e0 03             	and    $0x3,%eax
+     8b2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      movsb(d, s, k);
+     8b5:	ff 75 f4             	push   -0xc(%ebp)
+     8b8:	ff 75 f8             	push   -0x8(%ebp)
+     8bb:	ff 75 fc             	push   -0x4(%ebp)
+     8be:	e8 cd fa ff ff       	call   390 <movsb>
+     8c3:	83 c4 0c             	add    $0xc,%esp
+      d += k;
+     8c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8c9:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += k;
+     8cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8cf:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n -= k;
+     8d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8d5:	29 45 10             	sub    %eax,0x10(%ebp)
+      movsl(d, s, n/4);
+     8d8:	8b 45 10             	mov    0x10(%ebp),%eax
+     8db:	8d 50 03             	lea    0x3(%eax),%edx
+     8de:	85 c0                	test   %eax,%eax
+     8e0:	0f 48 c2             	cmovs  %edx,%eax
+     8e3:	c1 f8 02             	sar    $0x2,%eax
+     8e6:	50                   	push   %eax
+     8e7:	ff 75 f8             	push   -0x8(%ebp)
+     8ea:	ff 75 fc             	push   -0x4(%ebp)
+     8ed:	e8 cd fa ff ff       	call   3bf <movsl>
+     8f2:	83 c4 0c             	add    $0xc,%esp
+      d += n & ~3;
+     8f5:	8b 45 10             	mov    0x10(%ebp),%eax
+     8f8:	83 e0 fc             	and    $0xfffffffc,%eax
+     8fb:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += n & ~3;
+     8fe:	8b 45 10             	mov    0x10(%ebp),%eax
+     901:	83 e0 fc             	and    $0xfffffffc,%eax
+     904:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n &= 3;
+     907:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+    }
+    movsb(d, s, n);
+     90b:	ff 75 10             	push   0x10(%ebp)
+     90e:	ff 75 f8             	push   -0x8(%ebp)
+     911:	ff 75 fc             	push   -0x4(%ebp)
+     914:	e8 77 fa ff ff       	call   390 <movsb>
+     919:	83 c4 0c             	add    $0xc,%esp
+  }
+  return vdst;
+     91c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     91f:	c9                   	leave
+     920:	c3                   	ret
+
+00000921 <_fork>:
+    movl %esp, %ecx; \
+    movl $1f, %edx; \
+    sysenter; \
+  1: ret
+
+RAWSYSCALL(fork)
+     921:	b8 01 00 00 00       	mov    $0x1,%eax
+     926:	89 e1                	mov    %esp,%ecx
+     928:	ba 2f 09 00 00       	mov    $0x92f,%edx
+     92d:	0f 34                	sysenter
+     92f:	c3                   	ret
+
+00000930 <_exit>:
+RAWSYSCALL(exit)
+     930:	b8 02 00 00 00       	mov    $0x2,%eax
+     935:	89 e1                	mov    %esp,%ecx
+     937:	ba 3e 09 00 00       	mov    $0x93e,%edx
+     93c:	0f 34                	sysenter
+     93e:	c3                   	ret
+
+0000093f <wait>:
+SYSCALL(wait)
+     93f:	b8 03 00 00 00       	mov    $0x3,%eax
+     944:	89 e1                	mov    %esp,%ecx
+     946:	ba 4d 09 00 00       	mov    $0x94d,%edx
+     94b:	0f 34                	sysenter
+     94d:	c3                   	ret
+
+0000094e <pipe>:
+SYSCALL(pipe)
+     94e:	b8 04 00 00 00       	mov    $0x4,%eax
+     953:	89 e1                	mov    %esp,%ecx
+     955:	ba 5c 09 00 00       	mov    $0x95c,%edx
+     95a:	0f 34                	sysenter
+     95c:	c3                   	ret
+
+0000095d <read>:
+SYSCALL(read)
+     95d:	b8 05 00 00 00       	mov    $0x5,%eax
+     962:	89 e1                	mov    %esp,%ecx
+     964:	ba 6b 09 00 00       	mov    $0x96b,%edx
+     969:	0f 34                	sysenter
+     96b:	c3                   	ret
+
+0000096c <write>:
+SYSCALL(write)
+     96c:	b8 10 00 00 00       	mov    $0x10,%eax
+     971:	89 e1                	mov    %esp,%ecx
+     973:	ba 7a 09 00 00       	mov    $0x97a,%edx
+     978:	0f 34                	sysenter
+     97a:	c3                   	ret
+
+0000097b <_close>:
+RAWSYSCALL(close)
+     97b:	b8 15 00 00 00       	mov    $0x15,%eax
+     980:	89 e1                	mov    %esp,%ecx
+     982:	ba 89 09 00 00       	mov    $0x989,%edx
+     987:	0f 34                	sysenter
+     989:	c3                   	ret
+
+0000098a <kill>:
+SYSCALL(kill)
+     98a:	b8 06 00 00 00       	mov    $0x6,%eax
+     98f:	89 e1                	mov    %esp,%ecx
+     991:	ba 98 09 00 00       	mov    $0x998,%edx
+     996:	0f 34                	sysenter
+     998:	c3                   	ret
+
+00000999 <_exec>:
+RAWSYSCALL(exec)
+     999:	b8 07 00 00 00       	mov    $0x7,%eax
+     99e:	89 e1                	mov    %esp,%ecx
+     9a0:	ba a7 09 00 00       	mov    $0x9a7,%edx
+     9a5:	0f 34                	sysenter
+     9a7:	c3                   	ret
+
+000009a8 <open>:
+SYSCALL(open)
+     9a8:	b8 0f 00 00 00       	mov    $0xf,%eax
+     9ad:	89 e1                	mov    %esp,%ecx
+     9af:	ba b6 09 00 00       	mov    $0x9b6,%edx
+     9b4:	0f 34                	sysenter
+     9b6:	c3                   	ret
+
+000009b7 <mknod>:
+SYSCALL(mknod)
+     9b7:	b8 11 00 00 00       	mov    $0x11,%eax
+     9bc:	89 e1                	mov    %esp,%ecx
+     9be:	ba c5 09 00 00       	mov    $0x9c5,%edx
+     9c3:	0f 34                	sysenter
+     9c5:	c3                   	ret
+
+000009c6 <unlink>:
+SYSCALL(unlink)
+     9c6:	b8 12 00 00 00       	mov    $0x12,%eax
+     9cb:	89 e1                	mov    %esp,%ecx
+     9cd:	ba d4 09 00 00       	mov    $0x9d4,%edx
+     9d2:	0f 34                	sysenter
+     9d4:	c3                   	ret
+
+000009d5 <fstat>:
+SYSCALL(fstat)
+     9d5:	b8 08 00 00 00       	mov    $0x8,%eax
+     9da:	89 e1                	mov    %esp,%ecx
+     9dc:	ba e3 09 00 00       	mov    $0x9e3,%edx
+     9e1:	0f 34                	sysenter
+     9e3:	c3                   	ret
+
+000009e4 <link>:
+SYSCALL(link)
+     9e4:	b8 13 00 00 00       	mov    $0x13,%eax
+     9e9:	89 e1                	mov    %esp,%ecx
+     9eb:	ba f2 09 00 00       	mov    $0x9f2,%edx
+     9f0:	0f 34                	sysenter
+     9f2:	c3                   	ret
+
+000009f3 <mkdir>:
+SYSCALL(mkdir)
+     9f3:	b8 14 00 00 00       	mov    $0x14,%eax
+     9f8:	89 e1                	mov    %esp,%ecx
+     9fa:	ba 01 0a 00 00       	mov    $0xa01,%edx
+     9ff:	0f 34                	sysenter
+     a01:	c3                   	ret
+
+00000a02 <chdir>:
+SYSCALL(chdir)
+     a02:	b8 09 00 00 00       	mov    $0x9,%eax
+     a07:	89 e1                	mov    %esp,%ecx
+     a09:	ba 10 0a 00 00       	mov    $0xa10,%edx
+     a0e:	0f 34                	sysenter
+     a10:	c3                   	ret
+
+00000a11 <dup>:
+SYSCALL(dup)
+     a11:	b8 0a 00 00 00       	mov    $0xa,%eax
+     a16:	89 e1                	mov    %esp,%ecx
+     a18:	ba 1f 0a 00 00       	mov    $0xa1f,%edx
+     a1d:	0f 34                	sysenter
+     a1f:	c3                   	ret
+
+00000a20 <getpid>:
+SYSCALL(getpid)
+     a20:	b8 0b 00 00 00       	mov    $0xb,%eax
+     a25:	89 e1                	mov    %esp,%ecx
+     a27:	ba 2e 0a 00 00       	mov    $0xa2e,%edx
+     a2c:	0f 34                	sysenter
+     a2e:	c3                   	ret
+
+00000a2f <sbrk>:
+SYSCALL(sbrk)
+     a2f:	b8 0c 00 00 00       	mov    $0xc,%eax
+     a34:	89 e1                	mov    %esp,%ecx
+     a36:	ba 3d 0a 00 00       	mov    $0xa3d,%edx
+     a3b:	0f 34                	sysenter
+     a3d:	c3                   	ret
+
+00000a3e <sleep>:
+SYSCALL(sleep)
+     a3e:	b8 0d 00 00 00       	mov    $0xd,%eax
+     a43:	89 e1                	mov    %esp,%ecx
+     a45:	ba 4c 0a 00 00       	mov    $0xa4c,%edx
+     a4a:	0f 34                	sysenter
+     a4c:	c3                   	ret
+
+00000a4d <uptime>:
+SYSCALL(uptime)
+     a4d:	b8 0e 00 00 00       	mov    $0xe,%eax
+     a52:	89 e1                	mov    %esp,%ecx
+     a54:	ba 5b 0a 00 00       	mov    $0xa5b,%edx
+     a59:	0f 34                	sysenter
+     a5b:	c3                   	ret
+
+00000a5c <getproc>:
+SYSCALL(getproc)
+     a5c:	b8 16 00 00 00       	mov    $0x16,%eax
+     a61:	89 e1                	mov    %esp,%ecx
+     a63:	ba 6a 0a 00 00       	mov    $0xa6a,%edx
+     a68:	0f 34                	sysenter
+     a6a:	c3                   	ret
+
+00000a6b <getpgs>:
+SYSCALL(getpgs)
+     a6b:	b8 17 00 00 00       	mov    $0x17,%eax
+     a70:	89 e1                	mov    %esp,%ecx
+     a72:	ba 79 0a 00 00       	mov    $0xa79,%edx
+     a77:	0f 34                	sysenter
+     a79:	c3                   	ret
+
+00000a7a <loadproc>:
+SYSCALL(loadproc)
+     a7a:	b8 18 00 00 00       	mov    $0x18,%eax
+     a7f:	89 e1                	mov    %esp,%ecx
+     a81:	ba 88 0a 00 00       	mov    $0xa88,%edx
+     a86:	0f 34                	sysenter
+     a88:	c3                   	ret
+
+00000a89 <iosubmit>:
+SYSCALL(iosubmit)
+     a89:	b8 19 00 00 00       	mov    $0x19,%eax
+     a8e:	89 e1                	mov    %esp,%ecx
+     a90:	ba 97 0a 00 00       	mov    $0xa97,%edx
+     a95:	0f 34                	sysenter
+     a97:	c3                   	ret
+
+00000a98 <sysstat>:
+SYSCALL(sysstat)
+     a98:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     a9d:	89 e1                	mov    %esp,%ecx
+     a9f:	ba a6 0a 00 00       	mov    $0xaa6,%edx
+     aa4:	0f 34                	sysenter
+     aa6:	c3                   	ret
+
+00000aa7 <splice>:
+SYSCALL(splice)
+     aa7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     aac:	89 e1                	mov    %esp,%ecx
+     aae:	ba b5 0a 00 00       	mov    $0xab5,%edx
+     ab3:	0f 34                	sysenter
+     ab5:	c3                   	ret
+
+00000ab6 <fsync>:
+SYSCALL(fsync)
+     ab6:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     abb:	89 e1                	mov    %esp,%ecx
+     abd:	ba c4 0a 00 00       	mov    $0xac4,%edx
+     ac2:	0f 34                	sysenter
+     ac4:	c3                   	ret
+
+00000ac5 <fdatasync>:
+SYSCALL(fdatasync)
+     ac5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     aca:	89 e1                	mov    %esp,%ecx
+     acc:	ba d3 0a 00 00       	mov    $0xad3,%edx
+     ad1:	0f 34                	sysenter
+     ad3:	c3                   	ret
+
+00000ad4 <lseek>:
+SYSCALL(lseek)
+     ad4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     ad9:	89 e1                	mov    %esp,%ecx
+     adb:	ba e2 0a 00 00       	mov    $0xae2,%edx
+     ae0:	0f 34                	sysenter
+     ae2:	c3                   	ret
+
+00000ae3 <dmesg>:
+SYSCALL(dmesg)
+     ae3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     ae8:	89 e1                	mov    %esp,%ecx
+     aea:	ba f1 0a 00 00       	mov    $0xaf1,%edx
+     aef:	0f 34                	sysenter
+     af1:	c3                   	ret
+
+00000af2 <lockstat>:
+SYSCALL(lockstat)
+     af2:	b8 20 00 00 00       	mov    $0x20,%eax
+     af7:	89 e1                	mov    %esp,%ecx
+     af9:	ba 00 0b 00 00       	mov    $0xb00,%edx
+     afe:	0f 34                	sysenter
+     b00:	c3                   	ret
+
+00000b01 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     b01:	55                   	push   %ebp
+     b02:	89 e5                	mov    %esp,%ebp
+     b04:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     b07:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     b0e:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     b12:	74 17                	je     b2b <printint+0x2a>
+     b14:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     b18:	79 11                	jns    b2b <printint+0x2a>
+    neg = 1;
+     b1a:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     b21:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b24:	f7 d8                	neg    %eax
+     b26:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     b29:	eb 06                	jmp    b31 <printint+0x30>
+  } else {
+    x = xx;
+     b2b:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b2e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     b31:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     b38:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     b3b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b3e:	ba 00 00 00 00       	mov    $0x0,%edx
+     b43:	f7 f1                	div    %ecx
+     b45:	89 d1                	mov    %edx,%ecx
+     b47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b4a:	8d 50 01             	lea    0x1(%eax),%edx
+     b4d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     b50:	0f b6 91 10 1c 00 00 	movzbl 0x1c10(%ecx),%edx
+     b57:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     b5b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     b5e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b61:	ba 00 00 00 00       	mov    $0x0,%edx
+     b66:	f7 f1                	div    %ecx
+     b68:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     b6b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     b6f:	75 c7                	jne    b38 <printint+0x37>
+  if(neg)
+     b71:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     b75:	74 2d                	je     ba4 <printint+0xa3>
+    buf[i++] = '-';
+     b77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b7a:	8d 50 01             	lea    0x1(%eax),%edx
+     b7d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     b80:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+     b85:	eb 1d                	jmp    ba4 <printint+0xa3>
+    fputc(fd, buf[i]);
+     b87:	8d 55 dc             	lea    -0x24(%ebp),%edx
+     b8a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b8d:	01 d0                	add    %edx,%eax
+     b8f:	0f b6 00             	movzbl (%eax),%eax
+     b92:	0f be c0             	movsbl %al,%eax
+     b95:	83 ec 08             	sub    $0x8,%esp
+     b98:	50                   	push   %eax
+     b99:	ff 75 08             	push   0x8(%ebp)
+     b9c:	e8 f8 08 00 00       	call   1499 <fputc>
+     ba1:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+     ba4:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     ba8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     bac:	79 d9                	jns    b87 <printint+0x86>
+}
+     bae:	90                   	nop
+     baf:	90                   	nop
+     bb0:	c9                   	leave
+     bb1:	c3                   	ret
+
+00000bb2 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     bb2:	55                   	push   %ebp
+     bb3:	89 e5                	mov    %esp,%ebp
+     bb5:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+     bb8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     bbf:	8d 45 0c             	lea    0xc(%ebp),%eax
+     bc2:	83 c0 04             	add    $0x4,%eax
+     bc5:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+     bc8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     bcf:	e9 4a 01 00 00       	jmp    d1e <printf+0x16c>
+    c = fmt[i] & 0xff;
+     bd4:	8b 55 0c             	mov    0xc(%ebp),%edx
+     bd7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bda:	01 d0                	add    %edx,%eax
+     bdc:	0f b6 00             	movzbl (%eax),%eax
+     bdf:	0f be c0             	movsbl %al,%eax
+     be2:	25 ff 00 00 00       	and    $0xff,%eax
+     be7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+     bea:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     bee:	75 28                	jne    c18 <printf+0x66>
+      if(c == '%'){
+     bf0:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     bf4:	75 0c                	jne    c02 <printf+0x50>
+        state = '%';
+     bf6:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+     bfd:	e9 18 01 00 00       	jmp    d1a <printf+0x168>
+      } else {
+        fputc(fd, c);
+     c02:	83 ec 08             	sub    $0x8,%esp
+     c05:	ff 75 e4             	push   -0x1c(%ebp)
+     c08:	ff 75 08             	push   0x8(%ebp)
+     c0b:	e8 89 08 00 00       	call   1499 <fputc>
+     c10:	83 c4 10             	add    $0x10,%esp
+     c13:	e9 02 01 00 00       	jmp    d1a <printf+0x168>
+      }
+    } else if(state == '%'){
+     c18:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+     c1c:	0f 85 f8 00 00 00    	jne    d1a <printf+0x168>
+      if(c == 'd'){
+     c22:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+     c26:	75 1e                	jne    c46 <printf+0x94>
+        printint(fd, *ap, 10, 1);
+     c28:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c2b:	8b 00                	mov    (%eax),%eax
+     c2d:	6a 01                	push   $0x1
+     c2f:	6a 0a                	push   $0xa
+     c31:	50                   	push   %eax
+     c32:	ff 75 08             	push   0x8(%ebp)
+     c35:	e8 c7 fe ff ff       	call   b01 <printint>
+     c3a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     c3d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     c41:	e9 cd 00 00 00       	jmp    d13 <printf+0x161>
+      } else if(c == 'x' || c == 'p'){
+     c46:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+     c4a:	74 06                	je     c52 <printf+0xa0>
+     c4c:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+     c50:	75 1e                	jne    c70 <printf+0xbe>
+        printint(fd, *ap, 16, 0);
+     c52:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c55:	8b 00                	mov    (%eax),%eax
+     c57:	6a 00                	push   $0x0
+     c59:	6a 10                	push   $0x10
+     c5b:	50                   	push   %eax
+     c5c:	ff 75 08             	push   0x8(%ebp)
+     c5f:	e8 9d fe ff ff       	call   b01 <printint>
+     c64:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     c67:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     c6b:	e9 a3 00 00 00       	jmp    d13 <printf+0x161>
+      } else if(c == 's'){
+     c70:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+     c74:	75 43                	jne    cb9 <printf+0x107>
+        s = (char*)*ap;
+     c76:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c79:	8b 00                	mov    (%eax),%eax
+     c7b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     c7e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+     c82:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     c86:	75 25                	jne    cad <printf+0xfb>
+          s = "(null)";
+     c88:	c7 45 f4 10 17 00 00 	movl   $0x1710,-0xc(%ebp)
+        while(*s != 0){
+     c8f:	eb 1c                	jmp    cad <printf+0xfb>
+          fputc(fd, *s);
+     c91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c94:	0f b6 00             	movzbl (%eax),%eax
+     c97:	0f be c0             	movsbl %al,%eax
+     c9a:	83 ec 08             	sub    $0x8,%esp
+     c9d:	50                   	push   %eax
+     c9e:	ff 75 08             	push   0x8(%ebp)
+     ca1:	e8 f3 07 00 00       	call   1499 <fputc>
+     ca6:	83 c4 10             	add    $0x10,%esp
+          s++;
+     ca9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+     cad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     cb0:	0f b6 00             	movzbl (%eax),%eax
+     cb3:	84 c0                	test   %al,%al
+     cb5:	75 da                	jne    c91 <printf+0xdf>
+     cb7:	eb 5a                	jmp    d13 <printf+0x161>
+        }
+      } else if(c == 'c'){
+     cb9:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+     cbd:	75 1a                	jne    cd9 <printf+0x127>
+        fputc(fd, *ap);
+     cbf:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     cc2:	8b 00                	mov    (%eax),%eax
+     cc4:	83 ec 08             	sub    $0x8,%esp
+     cc7:	50                   	push   %eax
+     cc8:	ff 75 08             	push   0x8(%ebp)
+     ccb:	e8 c9 07 00 00       	call   1499 <fputc>
+     cd0:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     cd3:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     cd7:	eb 3a                	jmp    d13 <printf+0x161>
+      } else if(c == '%'){
+     cd9:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     cdd:	75 13                	jne    cf2 <printf+0x140>
+        fputc(fd, c);
+     cdf:	83 ec 08             	sub    $0x8,%esp
+     ce2:	ff 75 e4             	push   -0x1c(%ebp)
+     ce5:	ff 75 08             	push   0x8(%ebp)
+     ce8:	e8 ac 07 00 00       	call   1499 <fputc>
+     ced:	83 c4 10             	add    $0x10,%esp
+     cf0:	eb 21                	jmp    d13 <printf+0x161>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        fputc(fd, '%');
+     cf2:	83 ec 08             	sub    $0x8,%esp
+     cf5:	6a 25                	push   $0x25
+     cf7:	ff 75 08             	push   0x8(%ebp)
+     cfa:	e8 9a 07 00 00       	call   1499 <fputc>
+     cff:	83 c4 10             	add    $0x10,%esp
+        fputc(fd, c);
+     d02:	83 ec 08             	sub    $0x8,%esp
+     d05:	ff 75 e4             	push   -0x1c(%ebp)
+     d08:	ff 75 08             	push   0x8(%ebp)
+     d0b:	e8 89 07 00 00       	call   1499 <fputc>
+     d10:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     d13:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     d1a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     d1e:	8b 55 0c             	mov    0xc(%ebp),%edx
+     d21:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d24:	01 d0                	add    %edx,%eax
+     d26:	0f b6 00             	movzbl (%eax),%eax
+     d29:	84 c0                	test   %al,%al
+     d2b:	0f 85 a3 fe ff ff    	jne    bd4 <printf+0x22>
+    }
+  }
+}
+     d31:	90                   	nop
+     d32:	90                   	nop
+     d33:	c9                   	leave
+     d34:	c3                   	ret
+
+00000d35 <binof>:
+static struct chunk *bins[NBIN];       // free large chunks
+static struct chunk *top;              // end marker of newest heap segment
+
+static int
+binof(uint size)
+{
+     d35:	55                   	push   %ebp
+     d36:	89 e5                	mov    %esp,%ebp
+     d38:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  i = 0;
+     d3b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     d42:	c1 6d 08 05          	shrl   $0x5,0x8(%ebp)
+     d46:	eb 07                	jmp    d4f <binof+0x1a>
+    i++;
+     d48:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     d4c:	d1 6d 08             	shrl   0x8(%ebp)
+     d4f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     d53:	74 06                	je     d5b <binof+0x26>
+     d55:	83 7d fc 19          	cmpl   $0x19,-0x4(%ebp)
+     d59:	7e ed                	jle    d48 <binof+0x13>
+  return i;
+     d5b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     d5e:	c9                   	leave
+     d5f:	c3                   	ret
+
+00000d60 <bininsert>:
+
+static void
+bininsert(struct chunk *c)
+{
+     d60:	55                   	push   %ebp
+     d61:	89 e5                	mov    %esp,%ebp
+     d63:	83 ec 10             	sub    $0x10,%esp
+  struct chunk **b;
+
+  b = &bins[binof(CSIZE(c))];
+     d66:	8b 45 08             	mov    0x8(%ebp),%eax
+     d69:	8b 00                	mov    (%eax),%eax
+     d6b:	83 e0 f8             	and    $0xfffffff8,%eax
+     d6e:	50                   	push   %eax
+     d6f:	e8 c1 ff ff ff       	call   d35 <binof>
+     d74:	83 c4 04             	add    $0x4,%esp
+     d77:	c1 e0 02             	shl    $0x2,%eax
+     d7a:	05 80 1c 00 00       	add    $0x1c80,%eax
+     d7f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c->prev = 0;
+     d82:	8b 45 08             	mov    0x8(%ebp),%eax
+     d85:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  c->next = *b;
+     d8c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d8f:	8b 10                	mov    (%eax),%edx
+     d91:	8b 45 08             	mov    0x8(%ebp),%eax
+     d94:	89 50 08             	mov    %edx,0x8(%eax)
+  if(*b)
+     d97:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d9a:	8b 00                	mov    (%eax),%eax
+     d9c:	85 c0                	test   %eax,%eax
+     d9e:	74 0b                	je     dab <bininsert+0x4b>
+    (*b)->prev = c;
+     da0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     da3:	8b 00                	mov    (%eax),%eax
+     da5:	8b 55 08             	mov    0x8(%ebp),%edx
+     da8:	89 50 0c             	mov    %edx,0xc(%eax)
+  *b = c;
+     dab:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     dae:	8b 55 08             	mov    0x8(%ebp),%edx
+     db1:	89 10                	mov    %edx,(%eax)
+}
+     db3:	90                   	nop
+     db4:	c9                   	leave
+     db5:	c3                   	ret
+
+00000db6 <binremove>:
+
+static void
+binremove(struct chunk *c)
+{
+     db6:	55                   	push   %ebp
+     db7:	89 e5                	mov    %esp,%ebp
+  if(c->prev)
+     db9:	8b 45 08             	mov    0x8(%ebp),%eax
+     dbc:	8b 40 0c             	mov    0xc(%eax),%eax
+     dbf:	85 c0                	test   %eax,%eax
+     dc1:	74 11                	je     dd4 <binremove+0x1e>
+    c->prev->next = c->next;
+     dc3:	8b 45 08             	mov    0x8(%ebp),%eax
+     dc6:	8b 40 0c             	mov    0xc(%eax),%eax
+     dc9:	8b 55 08             	mov    0x8(%ebp),%edx
+     dcc:	8b 52 08             	mov    0x8(%edx),%edx
+     dcf:	89 50 08             	mov    %edx,0x8(%eax)
+     dd2:	eb 1e                	jmp    df2 <binremove+0x3c>
+  else
+    bins[binof(CSIZE(c))] = c->next;
+     dd4:	8b 45 08             	mov    0x8(%ebp),%eax
+     dd7:	8b 00                	mov    (%eax),%eax
+     dd9:	83 e0 f8             	and    $0xfffffff8,%eax
+     ddc:	50                   	push   %eax
+     ddd:	e8 53 ff ff ff       	call   d35 <binof>
+     de2:	83 c4 04             	add    $0x4,%esp
+     de5:	8b 55 08             	mov    0x8(%ebp),%edx
+     de8:	8b 52 08             	mov    0x8(%edx),%edx
+     deb:	89 14 85 80 1c 00 00 	mov    %edx,0x1c80(,%eax,4)
+  if(c->next)
+     df2:	8b 45 08             	mov    0x8(%ebp),%eax
+     df5:	8b 40 08             	mov    0x8(%eax),%eax
+     df8:	85 c0                	test   %eax,%eax
+     dfa:	74 0f                	je     e0b <binremove+0x55>
+    c->next->prev = c->prev;
+     dfc:	8b 45 08             	mov    0x8(%ebp),%eax
+     dff:	8b 40 08             	mov    0x8(%eax),%eax
+     e02:	8b 55 08             	mov    0x8(%ebp),%edx
+     e05:	8b 52 0c             	mov    0xc(%edx),%edx
+     e08:	89 50 0c             	mov    %edx,0xc(%eax)
+}
+     e0b:	90                   	nop
+     e0c:	c9                   	leave
+     e0d:	c3                   	ret
+
+00000e0e <freechunk>:
+
+// Free chunk c, merging it with free neighbors.  If trim is
+// set and the result is big and at the break, give it back.
+static void
+freechunk(struct chunk *c, int trim)
+{
+     e0e:	55                   	push   %ebp
+     e0f:	89 e5                	mov    %esp,%ebp
+     e11:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *p, *n;
+  uint size;
+
+  size = CSIZE(c);
+     e14:	8b 45 08             	mov    0x8(%ebp),%eax
+     e17:	8b 00                	mov    (%eax),%eax
+     e19:	83 e0 f8             	and    $0xfffffff8,%eax
+     e1c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  n = NEXTC(c);
+     e1f:	8b 45 08             	mov    0x8(%ebp),%eax
+     e22:	8b 00                	mov    (%eax),%eax
+     e24:	83 e0 f8             	and    $0xfffffff8,%eax
+     e27:	89 c2                	mov    %eax,%edx
+     e29:	8b 45 08             	mov    0x8(%ebp),%eax
+     e2c:	01 d0                	add    %edx,%eax
+     e2e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(!(c->size & PREVUSED)){
+     e31:	8b 45 08             	mov    0x8(%ebp),%eax
+     e34:	8b 00                	mov    (%eax),%eax
+     e36:	83 e0 02             	and    $0x2,%eax
+     e39:	85 c0                	test   %eax,%eax
+     e3b:	75 30                	jne    e6d <freechunk+0x5f>
+    p = (struct chunk*)((char*)c - *((uint*)c - 1));
+     e3d:	8b 45 08             	mov    0x8(%ebp),%eax
+     e40:	83 e8 04             	sub    $0x4,%eax
+     e43:	8b 00                	mov    (%eax),%eax
+     e45:	f7 d8                	neg    %eax
+     e47:	89 c2                	mov    %eax,%edx
+     e49:	8b 45 08             	mov    0x8(%ebp),%eax
+     e4c:	01 d0                	add    %edx,%eax
+     e4e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    binremove(p);
+     e51:	ff 75 ec             	push   -0x14(%ebp)
+     e54:	e8 5d ff ff ff       	call   db6 <binremove>
+     e59:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(p);
+     e5c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     e5f:	8b 00                	mov    (%eax),%eax
+     e61:	83 e0 f8             	and    $0xfffffff8,%eax
+     e64:	01 45 f4             	add    %eax,-0xc(%ebp)
+    c = p;
+     e67:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     e6a:	89 45 08             	mov    %eax,0x8(%ebp)
+  }
+  if(!(n->size & USED)){
+     e6d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e70:	8b 00                	mov    (%eax),%eax
+     e72:	83 e0 01             	and    $0x1,%eax
+     e75:	85 c0                	test   %eax,%eax
+     e77:	75 16                	jne    e8f <freechunk+0x81>
+    binremove(n);
+     e79:	ff 75 f0             	push   -0x10(%ebp)
+     e7c:	e8 35 ff ff ff       	call   db6 <binremove>
+     e81:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(n);
+     e84:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e87:	8b 00                	mov    (%eax),%eax
+     e89:	83 e0 f8             	and    $0xfffffff8,%eax
+     e8c:	01 45 f4             	add    %eax,-0xc(%ebp)
+  }
+  // Free chunks are never adjacent, so the one below is in use.
+  c->size = size | PREVUSED;
+     e8f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e92:	83 c8 02             	or     $0x2,%eax
+     e95:	89 c2                	mov    %eax,%edx
+     e97:	8b 45 08             	mov    0x8(%ebp),%eax
+     e9a:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+     e9c:	8b 45 08             	mov    0x8(%ebp),%eax
+     e9f:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  FOOTER(c) = size;
+     ea6:	8b 45 08             	mov    0x8(%ebp),%eax
+     ea9:	8b 00                	mov    (%eax),%eax
+     eab:	83 e0 f8             	and    $0xfffffff8,%eax
+     eae:	8d 50 fc             	lea    -0x4(%eax),%edx
+     eb1:	8b 45 08             	mov    0x8(%ebp),%eax
+     eb4:	01 c2                	add    %eax,%edx
+     eb6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eb9:	89 02                	mov    %eax,(%edx)
+  n = NEXTC(c);
+     ebb:	8b 45 08             	mov    0x8(%ebp),%eax
+     ebe:	8b 00                	mov    (%eax),%eax
+     ec0:	83 e0 f8             	and    $0xfffffff8,%eax
+     ec3:	89 c2                	mov    %eax,%edx
+     ec5:	8b 45 08             	mov    0x8(%ebp),%eax
+     ec8:	01 d0                	add    %edx,%eax
+     eca:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  n->size &= ~PREVUSED;
+     ecd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ed0:	8b 00                	mov    (%eax),%eax
+     ed2:	83 e0 fd             	and    $0xfffffffd,%eax
+     ed5:	89 c2                	mov    %eax,%edx
+     ed7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     eda:	89 10                	mov    %edx,(%eax)
+
+  if(trim && n == top && size >= TRIMSIZE && sbrk(0) == (char*)top + HDRSIZE){
+     edc:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     ee0:	74 51                	je     f33 <freechunk+0x125>
+     ee2:	a1 ec 1c 00 00       	mov    0x1cec,%eax
+     ee7:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     eea:	75 47                	jne    f33 <freechunk+0x125>
+     eec:	81 7d f4 ff 7f 00 00 	cmpl   $0x7fff,-0xc(%ebp)
+     ef3:	76 3e                	jbe    f33 <freechunk+0x125>
+     ef5:	83 ec 0c             	sub    $0xc,%esp
+     ef8:	6a 00                	push   $0x0
+     efa:	e8 30 fb ff ff       	call   a2f <sbrk>
+     eff:	83 c4 10             	add    $0x10,%esp
+     f02:	8b 15 ec 1c 00 00    	mov    0x1cec,%edx
+     f08:	83 c2 08             	add    $0x8,%edx
+     f0b:	39 d0                	cmp    %edx,%eax
+     f0d:	75 24                	jne    f33 <freechunk+0x125>
+    c->size = USED | PREVUSED;
+     f0f:	8b 45 08             	mov    0x8(%ebp),%eax
+     f12:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+    top = c;
+     f18:	8b 45 08             	mov    0x8(%ebp),%eax
+     f1b:	a3 ec 1c 00 00       	mov    %eax,0x1cec
+    sbrk(-size);
+     f20:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f23:	f7 d8                	neg    %eax
+     f25:	83 ec 0c             	sub    $0xc,%esp
+     f28:	50                   	push   %eax
+     f29:	e8 01 fb ff ff       	call   a2f <sbrk>
+     f2e:	83 c4 10             	add    $0x10,%esp
+    return;
+     f31:	eb 0e                	jmp    f41 <freechunk+0x133>
+  }
+  bininsert(c);
+     f33:	83 ec 0c             	sub    $0xc,%esp
+     f36:	ff 75 08             	push   0x8(%ebp)
+     f39:	e8 22 fe ff ff       	call   d60 <bininsert>
+     f3e:	83 c4 10             	add    $0x10,%esp
+}
+     f41:	c9                   	leave
+     f42:	c3                   	ret
+
+00000f43 <morecore>:
+
+// Grow the heap by at least need bytes.
+static int
+morecore(uint need)
+{
+     f43:	55                   	push   %ebp
+     f44:	89 e5                	mov    %esp,%ebp
+     f46:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+  char *p;
+  uint n, pad;
+
+  n = need + MINCHUNK;
+     f49:	8b 45 08             	mov    0x8(%ebp),%eax
+     f4c:	83 c0 18             	add    $0x18,%eax
+     f4f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(n < MINCORE)
+     f52:	81 7d ec ff 3f 00 00 	cmpl   $0x3fff,-0x14(%ebp)
+     f59:	77 07                	ja     f62 <morecore+0x1f>
+    n = MINCORE;
+     f5b:	c7 45 ec 00 40 00 00 	movl   $0x4000,-0x14(%ebp)
+  // Keep the break 8-aligned, with the end marker just below it.
+  pad = (8 - ((uint)sbrk(0) & 7)) & 7;
+     f62:	83 ec 0c             	sub    $0xc,%esp
+     f65:	6a 00                	push   $0x0
+     f67:	e8 c3 fa ff ff       	call   a2f <sbrk>
+     f6c:	83 c4 10             	add    $0x10,%esp
+     f6f:	83 e0 07             	and    $0x7,%eax
+     f72:	ba 08 00 00 00       	mov    $0x8,%edx
+     f77:	29 c2                	sub    %eax,%edx
+     f79:	89 d0                	mov    %edx,%eax
+     f7b:	83 e0 07             	and    $0x7,%eax
+     f7e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if((p = sbrk(pad + n)) == (char*)-1){
+     f81:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     f84:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f87:	01 d0                	add    %edx,%eax
+     f89:	83 ec 0c             	sub    $0xc,%esp
+     f8c:	50                   	push   %eax
+     f8d:	e8 9d fa ff ff       	call   a2f <sbrk>
+     f92:	83 c4 10             	add    $0x10,%esp
+     f95:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f98:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     f9c:	75 30                	jne    fce <morecore+0x8b>
+    n = need + MINCHUNK;
+     f9e:	8b 45 08             	mov    0x8(%ebp),%eax
+     fa1:	83 c0 18             	add    $0x18,%eax
+     fa4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((p = sbrk(pad + n)) == (char*)-1)
+     fa7:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     faa:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fad:	01 d0                	add    %edx,%eax
+     faf:	83 ec 0c             	sub    $0xc,%esp
+     fb2:	50                   	push   %eax
+     fb3:	e8 77 fa ff ff       	call   a2f <sbrk>
+     fb8:	83 c4 10             	add    $0x10,%esp
+     fbb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     fbe:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     fc2:	75 0a                	jne    fce <morecore+0x8b>
+      return -1;
+     fc4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     fc9:	e9 8e 00 00 00       	jmp    105c <morecore+0x119>
+  }
+  p += pad;
+     fce:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     fd1:	01 45 f0             	add    %eax,-0x10(%ebp)
+  if(top && p == (char*)top + HDRSIZE){
+     fd4:	a1 ec 1c 00 00       	mov    0x1cec,%eax
+     fd9:	85 c0                	test   %eax,%eax
+     fdb:	74 29                	je     1006 <morecore+0xc3>
+     fdd:	a1 ec 1c 00 00       	mov    0x1cec,%eax
+     fe2:	83 c0 08             	add    $0x8,%eax
+     fe5:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     fe8:	75 1c                	jne    1006 <morecore+0xc3>
+    // Contiguous: the old end marker heads the new chunk.
+    c = top;
+     fea:	a1 ec 1c 00 00       	mov    0x1cec,%eax
+     fef:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = n | (c->size & PREVUSED);
+     ff2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ff5:	8b 00                	mov    (%eax),%eax
+     ff7:	83 e0 02             	and    $0x2,%eax
+     ffa:	0b 45 ec             	or     -0x14(%ebp),%eax
+     ffd:	89 c2                	mov    %eax,%edx
+     fff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1002:	89 10                	mov    %edx,(%eax)
+    1004:	eb 16                	jmp    101c <morecore+0xd9>
+  } else {
+    // Someone else moved the break: start a new segment.
+    c = (struct chunk*)p;
+    1006:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1009:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = (n - HDRSIZE) | PREVUSED;
+    100c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    100f:	83 e8 08             	sub    $0x8,%eax
+    1012:	83 c8 02             	or     $0x2,%eax
+    1015:	89 c2                	mov    %eax,%edx
+    1017:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    101a:	89 10                	mov    %edx,(%eax)
+  }
+  top = NEXTC(c);
+    101c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    101f:	8b 00                	mov    (%eax),%eax
+    1021:	83 e0 f8             	and    $0xfffffff8,%eax
+    1024:	89 c2                	mov    %eax,%edx
+    1026:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1029:	01 d0                	add    %edx,%eax
+    102b:	a3 ec 1c 00 00       	mov    %eax,0x1cec
+  top->size = USED;
+    1030:	a1 ec 1c 00 00       	mov    0x1cec,%eax
+    1035:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  top->tag = LARGE;
+    103b:	a1 ec 1c 00 00       	mov    0x1cec,%eax
+    1040:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  freechunk(c, 0);
+    1047:	83 ec 08             	sub    $0x8,%esp
+    104a:	6a 00                	push   $0x0
+    104c:	ff 75 f4             	push   -0xc(%ebp)
+    104f:	e8 ba fd ff ff       	call   e0e <freechunk>
+    1054:	83 c4 10             	add    $0x10,%esp
+  return 0;
+    1057:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    105c:	c9                   	leave
+    105d:	c3                   	ret
+
+0000105e <largealloc>:
+
+static void*
+largealloc(uint nbytes)
+{
+    105e:	55                   	push   %ebp
+    105f:	89 e5                	mov    %esp,%ebp
+    1061:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c, *r;
+  uint need;
+  int i;
+
+  if(nbytes > 0x7fffffff)
+    1064:	8b 45 08             	mov    0x8(%ebp),%eax
+    1067:	85 c0                	test   %eax,%eax
+    1069:	79 0a                	jns    1075 <largealloc+0x17>
+    return 0;
+    106b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1070:	e9 43 01 00 00       	jmp    11b8 <largealloc+0x15a>
+  need = (nbytes + HDRSIZE + 7) & ~7;
+    1075:	8b 45 08             	mov    0x8(%ebp),%eax
+    1078:	83 c0 0f             	add    $0xf,%eax
+    107b:	83 e0 f8             	and    $0xfffffff8,%eax
+    107e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(need < MINCHUNK)
+    1081:	83 7d f0 17          	cmpl   $0x17,-0x10(%ebp)
+    1085:	77 07                	ja     108e <largealloc+0x30>
+    need = MINCHUNK;
+    1087:	c7 45 f0 18 00 00 00 	movl   $0x18,-0x10(%ebp)
+  for(;;){
+    for(i = binof(need); i < NBIN; i++)
+    108e:	ff 75 f0             	push   -0x10(%ebp)
+    1091:	e8 9f fc ff ff       	call   d35 <binof>
+    1096:	83 c4 04             	add    $0x4,%esp
+    1099:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    109c:	eb 2f                	jmp    10cd <largealloc+0x6f>
+      for(c = bins[i]; c; c = c->next)
+    109e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    10a1:	8b 04 85 80 1c 00 00 	mov    0x1c80(,%eax,4),%eax
+    10a8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    10ab:	eb 16                	jmp    10c3 <largealloc+0x65>
+        if(CSIZE(c) >= need)
+    10ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10b0:	8b 00                	mov    (%eax),%eax
+    10b2:	83 e0 f8             	and    $0xfffffff8,%eax
+    10b5:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+    10b8:	73 35                	jae    10ef <largealloc+0x91>
+      for(c = bins[i]; c; c = c->next)
+    10ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10bd:	8b 40 08             	mov    0x8(%eax),%eax
+    10c0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    10c3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    10c7:	75 e4                	jne    10ad <largealloc+0x4f>
+    for(i = binof(need); i < NBIN; i++)
+    10c9:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    10cd:	83 7d ec 1a          	cmpl   $0x1a,-0x14(%ebp)
+    10d1:	7e cb                	jle    109e <largealloc+0x40>
+          goto found;
+    if(morecore(need) < 0)
+    10d3:	83 ec 0c             	sub    $0xc,%esp
+    10d6:	ff 75 f0             	push   -0x10(%ebp)
+    10d9:	e8 65 fe ff ff       	call   f43 <morecore>
+    10de:	83 c4 10             	add    $0x10,%esp
+    10e1:	85 c0                	test   %eax,%eax
+    10e3:	79 a9                	jns    108e <largealloc+0x30>
+      return 0;
+    10e5:	b8 00 00 00 00       	mov    $0x0,%eax
+    10ea:	e9 c9 00 00 00       	jmp    11b8 <largealloc+0x15a>
+          goto found;
+    10ef:	90                   	nop
+  }
+
+found:
+  binremove(c);
+    10f0:	83 ec 0c             	sub    $0xc,%esp
+    10f3:	ff 75 f4             	push   -0xc(%ebp)
+    10f6:	e8 bb fc ff ff       	call   db6 <binremove>
+    10fb:	83 c4 10             	add    $0x10,%esp
+  if(CSIZE(c) - need >= MINCHUNK){
+    10fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1101:	8b 00                	mov    (%eax),%eax
+    1103:	83 e0 f8             	and    $0xfffffff8,%eax
+    1106:	2b 45 f0             	sub    -0x10(%ebp),%eax
+    1109:	83 f8 17             	cmp    $0x17,%eax
+    110c:	76 66                	jbe    1174 <largealloc+0x116>
+    r = (struct chunk*)((char*)c + need);
+    110e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1111:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1114:	01 d0                	add    %edx,%eax
+    1116:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    r->size = (CSIZE(c) - need) | PREVUSED;
+    1119:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    111c:	8b 00                	mov    (%eax),%eax
+    111e:	83 e0 f8             	and    $0xfffffff8,%eax
+    1121:	2b 45 f0             	sub    -0x10(%ebp),%eax
+    1124:	83 c8 02             	or     $0x2,%eax
+    1127:	89 c2                	mov    %eax,%edx
+    1129:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    112c:	89 10                	mov    %edx,(%eax)
+    r->tag = LARGE;
+    112e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1131:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+    FOOTER(r) = CSIZE(r);
+    1138:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    113b:	8b 10                	mov    (%eax),%edx
+    113d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1140:	8b 00                	mov    (%eax),%eax
+    1142:	83 e0 f8             	and    $0xfffffff8,%eax
+    1145:	8d 48 fc             	lea    -0x4(%eax),%ecx
+    1148:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    114b:	01 c8                	add    %ecx,%eax
+    114d:	83 e2 f8             	and    $0xfffffff8,%edx
+    1150:	89 10                	mov    %edx,(%eax)
+    bininsert(r);
+    1152:	83 ec 0c             	sub    $0xc,%esp
+    1155:	ff 75 e8             	push   -0x18(%ebp)
+    1158:	e8 03 fc ff ff       	call   d60 <bininsert>
+    115d:	83 c4 10             	add    $0x10,%esp
+    c->size = need | (c->size & PREVUSED);
+    1160:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1163:	8b 00                	mov    (%eax),%eax
+    1165:	83 e0 02             	and    $0x2,%eax
+    1168:	0b 45 f0             	or     -0x10(%ebp),%eax
+    116b:	89 c2                	mov    %eax,%edx
+    116d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1170:	89 10                	mov    %edx,(%eax)
+    1172:	eb 25                	jmp    1199 <largealloc+0x13b>
+  } else
+    NEXTC(c)->size |= PREVUSED;
+    1174:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1177:	8b 00                	mov    (%eax),%eax
+    1179:	83 e0 f8             	and    $0xfffffff8,%eax
+    117c:	89 c2                	mov    %eax,%edx
+    117e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1181:	01 d0                	add    %edx,%eax
+    1183:	8b 10                	mov    (%eax),%edx
+    1185:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1188:	8b 00                	mov    (%eax),%eax
+    118a:	83 e0 f8             	and    $0xfffffff8,%eax
+    118d:	89 c1                	mov    %eax,%ecx
+    118f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1192:	01 c8                	add    %ecx,%eax
+    1194:	83 ca 02             	or     $0x2,%edx
+    1197:	89 10                	mov    %edx,(%eax)
+  c->size |= USED;
+    1199:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    119c:	8b 00                	mov    (%eax),%eax
+    119e:	83 c8 01             	or     $0x1,%eax
+    11a1:	89 c2                	mov    %eax,%edx
+    11a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11a6:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+    11a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11ab:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  return (char*)c + HDRSIZE;
+    11b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11b5:	83 c0 08             	add    $0x8,%eax
+}
+    11b8:	c9                   	leave
+    11b9:	c3                   	ret
+
+000011ba <refill>:
+
+// Carve a slab into free blocks of class k.
+static int
+refill(int k)
+{
+    11ba:	55                   	push   %ebp
+    11bb:	89 e5                	mov    %esp,%ebp
+    11bd:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  char *p;
+  uint bs, i;
+
+  if((p = largealloc(SLABSIZE)) == 0)
+    11c0:	83 ec 0c             	sub    $0xc,%esp
+    11c3:	68 00 20 00 00       	push   $0x2000
+    11c8:	e8 91 fe ff ff       	call   105e <largealloc>
+    11cd:	83 c4 10             	add    $0x10,%esp
+    11d0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    11d3:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    11d7:	75 07                	jne    11e0 <refill+0x26>
+    return -1;
+    11d9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    11de:	eb 75                	jmp    1255 <refill+0x9b>
+  bs = HDRSIZE + (MINSMALL << k);
+    11e0:	8b 45 08             	mov    0x8(%ebp),%eax
+    11e3:	ba 10 00 00 00       	mov    $0x10,%edx
+    11e8:	89 c1                	mov    %eax,%ecx
+    11ea:	d3 e2                	shl    %cl,%edx
+    11ec:	89 d0                	mov    %edx,%eax
+    11ee:	83 c0 08             	add    $0x8,%eax
+    11f1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+    11f4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    11fb:	eb 44                	jmp    1241 <refill+0x87>
+    b = (struct chunk*)(p + i);
+    11fd:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    1200:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1203:	01 d0                	add    %edx,%eax
+    1205:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    b->size = bs | USED;
+    1208:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    120b:	83 c8 01             	or     $0x1,%eax
+    120e:	89 c2                	mov    %eax,%edx
+    1210:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1213:	89 10                	mov    %edx,(%eax)
+    b->tag = k;
+    1215:	8b 55 08             	mov    0x8(%ebp),%edx
+    1218:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    121b:	89 50 04             	mov    %edx,0x4(%eax)
+    b->next = classes[k];
+    121e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1221:	8b 14 85 60 1c 00 00 	mov    0x1c60(,%eax,4),%edx
+    1228:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    122b:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[k] = b;
+    122e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1231:	8b 55 e8             	mov    -0x18(%ebp),%edx
+    1234:	89 14 85 60 1c 00 00 	mov    %edx,0x1c60(,%eax,4)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+    123b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    123e:	01 45 f4             	add    %eax,-0xc(%ebp)
+    1241:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1244:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1247:	01 d0                	add    %edx,%eax
+    1249:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    124e:	76 ad                	jbe    11fd <refill+0x43>
+  }
+  return 0;
+    1250:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1255:	c9                   	leave
+    1256:	c3                   	ret
+
+00001257 <free>:
+
+void
+free(void *ap)
+{
+    1257:	55                   	push   %ebp
+    1258:	89 e5                	mov    %esp,%ebp
+    125a:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+
+  if(ap == 0)
+    125d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1261:	74 4b                	je     12ae <free+0x57>
+    return;
+  c = (struct chunk*)((char*)ap - HDRSIZE);
+    1263:	8b 45 08             	mov    0x8(%ebp),%eax
+    1266:	83 e8 08             	sub    $0x8,%eax
+    1269:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(c->tag != LARGE){
+    126c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    126f:	8b 40 04             	mov    0x4(%eax),%eax
+    1272:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1275:	74 25                	je     129c <free+0x45>
+    c->next = classes[c->tag];
+    1277:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    127a:	8b 40 04             	mov    0x4(%eax),%eax
+    127d:	8b 14 85 60 1c 00 00 	mov    0x1c60(,%eax,4),%edx
+    1284:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1287:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[c->tag] = c;
+    128a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    128d:	8b 40 04             	mov    0x4(%eax),%eax
+    1290:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1293:	89 14 85 60 1c 00 00 	mov    %edx,0x1c60(,%eax,4)
+    return;
+    129a:	eb 13                	jmp    12af <free+0x58>
+  }
+  freechunk(c, 1);
+    129c:	83 ec 08             	sub    $0x8,%esp
+    129f:	6a 01                	push   $0x1
+    12a1:	ff 75 f4             	push   -0xc(%ebp)
+    12a4:	e8 65 fb ff ff       	call   e0e <freechunk>
+    12a9:	83 c4 10             	add    $0x10,%esp
+    12ac:	eb 01                	jmp    12af <free+0x58>
+    return;
+    12ae:	90                   	nop
+}
+    12af:	c9                   	leave
+    12b0:	c3                   	ret
+
+000012b1 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    12b1:	55                   	push   %ebp
+    12b2:	89 e5                	mov    %esp,%ebp
+    12b4:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  int k;
+
+  if(nbytes > MAXSMALL)
+    12b7:	81 7d 08 00 08 00 00 	cmpl   $0x800,0x8(%ebp)
+    12be:	76 10                	jbe    12d0 <malloc+0x1f>
+    return largealloc(nbytes);
+    12c0:	83 ec 0c             	sub    $0xc,%esp
+    12c3:	ff 75 08             	push   0x8(%ebp)
+    12c6:	e8 93 fd ff ff       	call   105e <largealloc>
+    12cb:	83 c4 10             	add    $0x10,%esp
+    12ce:	eb 6a                	jmp    133a <malloc+0x89>
+  for(k = 0; (MINSMALL << k) < nbytes; k++)
+    12d0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    12d7:	eb 04                	jmp    12dd <malloc+0x2c>
+    12d9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    12dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12e0:	ba 10 00 00 00       	mov    $0x10,%edx
+    12e5:	89 c1                	mov    %eax,%ecx
+    12e7:	d3 e2                	shl    %cl,%edx
+    12e9:	89 d0                	mov    %edx,%eax
+    12eb:	3b 45 08             	cmp    0x8(%ebp),%eax
+    12ee:	72 e9                	jb     12d9 <malloc+0x28>
+    ;
+  if(classes[k] == 0 && refill(k) < 0)
+    12f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12f3:	8b 04 85 60 1c 00 00 	mov    0x1c60(,%eax,4),%eax
+    12fa:	85 c0                	test   %eax,%eax
+    12fc:	75 19                	jne    1317 <malloc+0x66>
+    12fe:	83 ec 0c             	sub    $0xc,%esp
+    1301:	ff 75 f4             	push   -0xc(%ebp)
+    1304:	e8 b1 fe ff ff       	call   11ba <refill>
+    1309:	83 c4 10             	add    $0x10,%esp
+    130c:	85 c0                	test   %eax,%eax
+    130e:	79 07                	jns    1317 <malloc+0x66>
+    return 0;
+    1310:	b8 00 00 00 00       	mov    $0x0,%eax
+    1315:	eb 23                	jmp    133a <malloc+0x89>
+  b = classes[k];
+    1317:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    131a:	8b 04 85 60 1c 00 00 	mov    0x1c60(,%eax,4),%eax
+    1321:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  classes[k] = b->next;
+    1324:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1327:	8b 50 08             	mov    0x8(%eax),%edx
+    132a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    132d:	89 14 85 60 1c 00 00 	mov    %edx,0x1c60(,%eax,4)
+  return (char*)b + HDRSIZE;
+    1334:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1337:	83 c0 08             	add    $0x8,%eax
+}
+    133a:	c9                   	leave
+    133b:	c3                   	ret
+
+0000133c <stream>:
+
+// Return the stream for fd, deciding on first use how
+// its output is buffered.  Returns 0 if fd is not open.
+static struct stream*
+stream(int fd)
+{
+    133c:	55                   	push   %ebp
+    133d:	89 e5                	mov    %esp,%ebp
+    133f:	83 ec 28             	sub    $0x28,%esp
+  struct stream *s;
+  struct stat st;
+
+  if(fd < 0 || fd >= NOFILE)
+    1342:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1346:	78 06                	js     134e <stream+0x12>
+    1348:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    134c:	7e 07                	jle    1355 <stream+0x19>
+    return 0;
+    134e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1353:	eb 55                	jmp    13aa <stream+0x6e>
+  s = &streams[fd];
+    1355:	8b 45 08             	mov    0x8(%ebp),%eax
+    1358:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    135e:	05 00 1d 00 00       	add    $0x1d00,%eax
+    1363:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(s->mode == UNKNOWN){
+    1366:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1369:	8b 00                	mov    (%eax),%eax
+    136b:	85 c0                	test   %eax,%eax
+    136d:	75 38                	jne    13a7 <stream+0x6b>
+    if(fstat(fd, &st) < 0)
+    136f:	83 ec 08             	sub    $0x8,%esp
+    1372:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1375:	50                   	push   %eax
+    1376:	ff 75 08             	push   0x8(%ebp)
+    1379:	e8 57 f6 ff ff       	call   9d5 <fstat>
+    137e:	83 c4 10             	add    $0x10,%esp
+    1381:	85 c0                	test   %eax,%eax
+    1383:	79 07                	jns    138c <stream+0x50>
+      return 0;
+    1385:	b8 00 00 00 00       	mov    $0x0,%eax
+    138a:	eb 1e                	jmp    13aa <stream+0x6e>
+    s->mode = st.type == T_DEV ? LINEBUF : FULLBUF;
+    138c:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+    1390:	66 83 f8 03          	cmp    $0x3,%ax
+    1394:	75 07                	jne    139d <stream+0x61>
+    1396:	ba 01 00 00 00       	mov    $0x1,%edx
+    139b:	eb 05                	jmp    13a2 <stream+0x66>
+    139d:	ba 02 00 00 00       	mov    $0x2,%edx
+    13a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13a5:	89 10                	mov    %edx,(%eax)
+  }
+  return s;
+    13a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    13aa:	c9                   	leave
+    13ab:	c3                   	ret
+
+000013ac <fflush>:
+
+int
+fflush(int fd)
+{
+    13ac:	55                   	push   %ebp
+    13ad:	89 e5                	mov    %esp,%ebp
+    13af:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  int i, n;
+
+  if(fd < 0 || fd >= NOFILE)
+    13b2:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    13b6:	78 06                	js     13be <fflush+0x12>
+    13b8:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    13bc:	7e 07                	jle    13c5 <fflush+0x19>
+    return -1;
+    13be:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    13c3:	eb 78                	jmp    143d <fflush+0x91>
+  s = &streams[fd];
+    13c5:	8b 45 08             	mov    0x8(%ebp),%eax
+    13c8:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    13ce:	05 00 1d 00 00       	add    $0x1d00,%eax
+    13d3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < s->nout; i += n){
+    13d6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    13dd:	eb 44                	jmp    1423 <fflush+0x77>
+    if((n = write(fd, s->out + i, s->nout - i)) <= 0){
+    13df:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    13e2:	8b 40 04             	mov    0x4(%eax),%eax
+    13e5:	2b 45 f4             	sub    -0xc(%ebp),%eax
+    13e8:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    13eb:	8d 4a 10             	lea    0x10(%edx),%ecx
+    13ee:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    13f1:	01 ca                	add    %ecx,%edx
+    13f3:	83 ec 04             	sub    $0x4,%esp
+    13f6:	50                   	push   %eax
+    13f7:	52                   	push   %edx
+    13f8:	ff 75 08             	push   0x8(%ebp)
+    13fb:	e8 6c f5 ff ff       	call   96c <write>
+    1400:	83 c4 10             	add    $0x10,%esp
+    1403:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1406:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    140a:	7f 11                	jg     141d <fflush+0x71>
+      s->nout = 0;
+    140c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    140f:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+      return -1;
+    1416:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    141b:	eb 20                	jmp    143d <fflush+0x91>
+  for(i = 0; i < s->nout; i += n){
+    141d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1420:	01 45 f4             	add    %eax,-0xc(%ebp)
+    1423:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1426:	8b 40 04             	mov    0x4(%eax),%eax
+    1429:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    142c:	7c b1                	jl     13df <fflush+0x33>
+    }
+  }
+  s->nout = 0;
+    142e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1431:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  return 0;
+    1438:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    143d:	c9                   	leave
+    143e:	c3                   	ret
+
+0000143f <flushall>:
+
+// Flush every stream, or only line-buffered ones.
+static void
+flushall(int lineonly)
+{
+    143f:	55                   	push   %ebp
+    1440:	89 e5                	mov    %esp,%ebp
+    1442:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+    1445:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    144c:	eb 41                	jmp    148f <flushall+0x50>
+    if(streams[fd].nout > 0 && (!lineonly || streams[fd].mode == LINEBUF))
+    144e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1451:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1457:	05 04 1d 00 00       	add    $0x1d04,%eax
+    145c:	8b 00                	mov    (%eax),%eax
+    145e:	85 c0                	test   %eax,%eax
+    1460:	7e 29                	jle    148b <flushall+0x4c>
+    1462:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1466:	74 15                	je     147d <flushall+0x3e>
+    1468:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    146b:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1471:	05 00 1d 00 00       	add    $0x1d00,%eax
+    1476:	8b 00                	mov    (%eax),%eax
+    1478:	83 f8 01             	cmp    $0x1,%eax
+    147b:	75 0e                	jne    148b <flushall+0x4c>
+      fflush(fd);
+    147d:	83 ec 0c             	sub    $0xc,%esp
+    1480:	ff 75 f4             	push   -0xc(%ebp)
+    1483:	e8 24 ff ff ff       	call   13ac <fflush>
+    1488:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++)
+    148b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    148f:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+    1493:	7e b9                	jle    144e <flushall+0xf>
+}
+    1495:	90                   	nop
+    1496:	90                   	nop
+    1497:	c9                   	leave
+    1498:	c3                   	ret
+
+00001499 <fputc>:
+
+int
+fputc(int fd, int c)
+{
+    1499:	55                   	push   %ebp
+    149a:	89 e5                	mov    %esp,%ebp
+    149c:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  char ch;
+
+  if((s = stream(fd)) == 0){
+    149f:	83 ec 0c             	sub    $0xc,%esp
+    14a2:	ff 75 08             	push   0x8(%ebp)
+    14a5:	e8 92 fe ff ff       	call   133c <stream>
+    14aa:	83 c4 10             	add    $0x10,%esp
+    14ad:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    14b0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    14b4:	75 2e                	jne    14e4 <fputc+0x4b>
+    ch = c;
+    14b6:	8b 45 0c             	mov    0xc(%ebp),%eax
+    14b9:	88 45 f3             	mov    %al,-0xd(%ebp)
+    return write(fd, &ch, 1) == 1 ? (uchar)c : -1;
+    14bc:	83 ec 04             	sub    $0x4,%esp
+    14bf:	6a 01                	push   $0x1
+    14c1:	8d 45 f3             	lea    -0xd(%ebp),%eax
+    14c4:	50                   	push   %eax
+    14c5:	ff 75 08             	push   0x8(%ebp)
+    14c8:	e8 9f f4 ff ff       	call   96c <write>
+    14cd:	83 c4 10             	add    $0x10,%esp
+    14d0:	83 f8 01             	cmp    $0x1,%eax
+    14d3:	75 08                	jne    14dd <fputc+0x44>
+    14d5:	8b 45 0c             	mov    0xc(%ebp),%eax
+    14d8:	0f b6 c0             	movzbl %al,%eax
+    14db:	eb 5e                	jmp    153b <fputc+0xa2>
+    14dd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    14e2:	eb 57                	jmp    153b <fputc+0xa2>
+  }
+  s->out[s->nout++] = c;
+    14e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14e7:	8b 40 04             	mov    0x4(%eax),%eax
+    14ea:	8d 48 01             	lea    0x1(%eax),%ecx
+    14ed:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    14f0:	89 4a 04             	mov    %ecx,0x4(%edx)
+    14f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+    14f6:	89 d1                	mov    %edx,%ecx
+    14f8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    14fb:	88 4c 02 10          	mov    %cl,0x10(%edx,%eax,1)
+  if(s->nout == BUFSZ || (s->mode == LINEBUF && c == '\n'))
+    14ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1502:	8b 40 04             	mov    0x4(%eax),%eax
+    1505:	3d 00 02 00 00       	cmp    $0x200,%eax
+    150a:	74 10                	je     151c <fputc+0x83>
+    150c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    150f:	8b 00                	mov    (%eax),%eax
+    1511:	83 f8 01             	cmp    $0x1,%eax
+    1514:	75 1f                	jne    1535 <fputc+0x9c>
+    1516:	83 7d 0c 0a          	cmpl   $0xa,0xc(%ebp)
+    151a:	75 19                	jne    1535 <fputc+0x9c>
+    if(fflush(fd) < 0)
+    151c:	83 ec 0c             	sub    $0xc,%esp
+    151f:	ff 75 08             	push   0x8(%ebp)
+    1522:	e8 85 fe ff ff       	call   13ac <fflush>
+    1527:	83 c4 10             	add    $0x10,%esp
+    152a:	85 c0                	test   %eax,%eax
+    152c:	79 07                	jns    1535 <fputc+0x9c>
+      return -1;
+    152e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1533:	eb 06                	jmp    153b <fputc+0xa2>
+  return (uchar)c;
+    1535:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1538:	0f b6 c0             	movzbl %al,%eax
+}
+    153b:	c9                   	leave
+    153c:	c3                   	ret
+
+0000153d <fgetc>:
+
+// Return the next byte read from fd, or -1 at end of file.
+int
+fgetc(int fd)
+{
+    153d:	55                   	push   %ebp
+    153e:	89 e5                	mov    %esp,%ebp
+    1540:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  uchar c;
+  int n;
+
+  if((s = stream(fd)) == 0){
+    1543:	83 ec 0c             	sub    $0xc,%esp
+    1546:	ff 75 08             	push   0x8(%ebp)
+    1549:	e8 ee fd ff ff       	call   133c <stream>
+    154e:	83 c4 10             	add    $0x10,%esp
+    1551:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1554:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1558:	75 39                	jne    1593 <fgetc+0x56>
+    flushall(1);
+    155a:	83 ec 0c             	sub    $0xc,%esp
+    155d:	6a 01                	push   $0x1
+    155f:	e8 db fe ff ff       	call   143f <flushall>
+    1564:	83 c4 10             	add    $0x10,%esp
+    return read(fd, &c, 1) == 1 ? c : -1;
+    1567:	83 ec 04             	sub    $0x4,%esp
+    156a:	6a 01                	push   $0x1
+    156c:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    156f:	50                   	push   %eax
+    1570:	ff 75 08             	push   0x8(%ebp)
+    1573:	e8 e5 f3 ff ff       	call   95d <read>
+    1578:	83 c4 10             	add    $0x10,%esp
+    157b:	83 f8 01             	cmp    $0x1,%eax
+    157e:	75 0c                	jne    158c <fgetc+0x4f>
+    1580:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    1584:	0f b6 c0             	movzbl %al,%eax
+    1587:	e9 80 00 00 00       	jmp    160c <fgetc+0xcf>
+    158c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1591:	eb 79                	jmp    160c <fgetc+0xcf>
+  }
+  if(s->rpos == s->rend){
+    1593:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1596:	8b 50 08             	mov    0x8(%eax),%edx
+    1599:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    159c:	8b 40 0c             	mov    0xc(%eax),%eax
+    159f:	39 c2                	cmp    %eax,%edx
+    15a1:	75 4c                	jne    15ef <fgetc+0xb2>
+    flushall(1);
+    15a3:	83 ec 0c             	sub    $0xc,%esp
+    15a6:	6a 01                	push   $0x1
+    15a8:	e8 92 fe ff ff       	call   143f <flushall>
+    15ad:	83 c4 10             	add    $0x10,%esp
+    if((n = read(fd, s->in, BUFSZ)) <= 0)
+    15b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15b3:	05 10 02 00 00       	add    $0x210,%eax
+    15b8:	83 ec 04             	sub    $0x4,%esp
+    15bb:	68 00 02 00 00       	push   $0x200
+    15c0:	50                   	push   %eax
+    15c1:	ff 75 08             	push   0x8(%ebp)
+    15c4:	e8 94 f3 ff ff       	call   95d <read>
+    15c9:	83 c4 10             	add    $0x10,%esp
+    15cc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    15cf:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    15d3:	7f 07                	jg     15dc <fgetc+0x9f>
+      return -1;
+    15d5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    15da:	eb 30                	jmp    160c <fgetc+0xcf>
+    s->rpos = 0;
+    15dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15df:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+    s->rend = n;
+    15e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15e9:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    15ec:	89 50 0c             	mov    %edx,0xc(%eax)
+  }
+  return (uchar)s->in[s->rpos++];
+    15ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15f2:	8b 40 08             	mov    0x8(%eax),%eax
+    15f5:	8d 48 01             	lea    0x1(%eax),%ecx
+    15f8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    15fb:	89 4a 08             	mov    %ecx,0x8(%edx)
+    15fe:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1601:	0f b6 84 02 10 02 00 	movzbl 0x210(%edx,%eax,1),%eax
+    1608:	00 
+    1609:	0f b6 c0             	movzbl %al,%eax
+}
+    160c:	c9                   	leave
+    160d:	c3                   	ret
+
+0000160e <fork>:
+
+int
+fork(void)
+{
+    160e:	55                   	push   %ebp
+    160f:	89 e5                	mov    %esp,%ebp
+    1611:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1614:	83 ec 0c             	sub    $0xc,%esp
+    1617:	6a 00                	push   $0x0
+    1619:	e8 21 fe ff ff       	call   143f <flushall>
+    161e:	83 c4 10             	add    $0x10,%esp
+  return _fork();
+    1621:	e8 fb f2 ff ff       	call   921 <_fork>
+}
+    1626:	c9                   	leave
+    1627:	c3                   	ret
+
+00001628 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+    1628:	55                   	push   %ebp
+    1629:	89 e5                	mov    %esp,%ebp
+    162b:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    162e:	83 ec 0c             	sub    $0xc,%esp
+    1631:	6a 00                	push   $0x0
+    1633:	e8 07 fe ff ff       	call   143f <flushall>
+    1638:	83 c4 10             	add    $0x10,%esp
+  return _exec(path, argv);
+    163b:	83 ec 08             	sub    $0x8,%esp
+    163e:	ff 75 0c             	push   0xc(%ebp)
+    1641:	ff 75 08             	push   0x8(%ebp)
+    1644:	e8 50 f3 ff ff       	call   999 <_exec>
+    1649:	83 c4 10             	add    $0x10,%esp
+}
+    164c:	c9                   	leave
+    164d:	c3                   	ret
+
+0000164e <exit>:
+
+int
+exit(void)
+{
+    164e:	55                   	push   %ebp
+    164f:	89 e5                	mov    %esp,%ebp
+    1651:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1654:	83 ec 0c             	sub    $0xc,%esp
+    1657:	6a 00                	push   $0x0
+    1659:	e8 e1 fd ff ff       	call   143f <flushall>
+    165e:	83 c4 10             	add    $0x10,%esp
+  _exit();
+    1661:	e8 ca f2 ff ff       	call   930 <_exit>
+
+00001666 <close>:
+}
+
+int
+close(int fd)
+{
+    1666:	55                   	push   %ebp
+    1667:	89 e5                	mov    %esp,%ebp
+    1669:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+
+  if(fd >= 0 && fd < NOFILE){
+    166c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1670:	78 44                	js     16b6 <close+0x50>
+    1672:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    1676:	7f 3e                	jg     16b6 <close+0x50>
+    fflush(fd);
+    1678:	83 ec 0c             	sub    $0xc,%esp
+    167b:	ff 75 08             	push   0x8(%ebp)
+    167e:	e8 29 fd ff ff       	call   13ac <fflush>
+    1683:	83 c4 10             	add    $0x10,%esp
+    s = &streams[fd];
+    1686:	8b 45 08             	mov    0x8(%ebp),%eax
+    1689:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    168f:	05 00 1d 00 00       	add    $0x1d00,%eax
+    1694:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    s->mode = UNKNOWN;
+    1697:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    169a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    s->rpos = s->rend = 0;
+    16a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    16a3:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    16aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    16ad:	8b 50 0c             	mov    0xc(%eax),%edx
+    16b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    16b3:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  return _close(fd);
+    16b6:	83 ec 0c             	sub    $0xc,%esp
+    16b9:	ff 75 08             	push   0x8(%ebp)
+    16bc:	e8 ba f2 ff ff       	call   97b <_close>
+    16c1:	83 c4 10             	add    $0x10,%esp
+}
+    16c4:	c9                   	leave
+    16c5:	c3                   	ret
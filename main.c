@@ -19,6 +19,7 @@ main(void)
 {
   kinit1(end, P2V(4*1024*1024)); // phys page allocator
   kvmalloc();      // kernel page table
+  slabinit();      // kernel object caches
   mpinit();        // collect info about this machine
   lapicinit();
   seginit();       // set up segments
@@ -57,6 +58,7 @@ mpmain(void)
 {
   cprintf("cpu%d: starting\n", cpu->id);
   idtinit();       // load idt register
+  sysenterinit();  // fast system call entry
   xchg(&cpu->started, 1); // tell startothers() we're up
   scheduler();     // start running processes
 }
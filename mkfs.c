@@ -22,7 +22,7 @@
 
 int nbitmap = FSSIZE/(BSIZE*8) + 1;
 int ninodeblocks = NINODES / IPB + 1;
-int nlog = LOGSIZE;  
+int nlog = LOGSIZE+1;  // header and data blocks (-l)
 int nmeta;    // Number of meta blocks (boot, sb, nlog, inode, bitmap)
 int nblocks;  // Number of data blocks
 
@@ -31,6 +31,7 @@ struct superblock sb;
 char zeroes[BSIZE];
 uint freeinode = 1;
 uint freeblock;
+uint nbuckets;  // if non-zero, root is a hashed directory
 
 
 void balloc(int);
@@ -40,6 +41,9 @@ void rinode(uint inum, struct dinode *ip);
 void rsect(uint sec, void *buf);
 uint ialloc(ushort type);
 void iappend(uint inum, void *p, int n);
+void iinline(uint inum, void *p, int n);
+void dirappend(uint dinum, char *name, uint inum);
+void hashdirinit(uint dinum);
 
 // convert to intel byte order
 ushort
@@ -68,21 +72,44 @@ int
 main(int argc, char *argv[])
 {
   int i, cc, fd;
-  uint rootino, inum, off;
-  struct dirent de;
+  uint rootino, inum, off, n;
   char buf[BSIZE];
   struct dinode din;
 
 
   static_assert(sizeof(int) == 4, "Integers must be 4 bytes!");
 
-  if(argc < 2){
-    fprintf(stderr, "Usage: mkfs fs.img files...\n");
+  while(argc > 2 && argv[1][0] == '-'){
+    if(strcmp(argv[1], "-l") == 0)
+      nlog = atoi(argv[2]);
+    else
+      break;
+    argc -= 2;
+    argv += 2;
+  }
+
+  if(argc < 2 || argv[1][0] == '-'){
+    fprintf(stderr, "Usage: mkfs [-l nlog] fs.img files...\n");
+    exit(1);
+  }
+
+  // A root too big to be linear is hashed, with buckets
+  // for about twice its entries, ".", ".." and the files.
+  n = argc;
+  if(n > HASHDIRMIN*DPB){
+    nbuckets = (2*n + DPB-2) / (DPB-1);
+    if(nbuckets > MAXDIRBUCKET)
+      nbuckets = MAXDIRBUCKET;
+  }
+  if(nlog-1 < MINLOGSIZE || nlog-1 > LOGSIZE){
+    fprintf(stderr, "mkfs: nlog must be %d to %d\n", MINLOGSIZE+1, LOGSIZE+1);
     exit(1);
   }
 
   assert((BSIZE % sizeof(struct dinode)) == 0);
   assert((BSIZE % sizeof(struct dirent)) == 0);
+  assert(sizeof(struct dirchain) == sizeof(struct dirent));
+  assert(sizeof(struct dirhdr) == sizeof(struct dirent));
 
   fsfd = open(argv[1], O_RDWR|O_CREAT|O_TRUNC, 0666);
   if(fsfd < 0){
@@ -117,15 +144,10 @@ main(int argc, char *argv[])
   rootino = ialloc(T_DIR);
   assert(rootino == ROOTINO);
 
-  bzero(&de, sizeof(de));
-  de.inum = xshort(rootino);
-  strcpy(de.name, ".");
-  iappend(rootino, &de, sizeof(de));
-
-  bzero(&de, sizeof(de));
-  de.inum = xshort(rootino);
-  strcpy(de.name, "..");
-  iappend(rootino, &de, sizeof(de));
+  if(nbuckets)
+    hashdirinit(rootino);
+  dirappend(rootino, ".", rootino);
+  dirappend(rootino, "..", rootino);
 
   for(i = 2; i < argc; i++){
     assert(index(argv[i], '/') == 0);
@@ -143,24 +165,30 @@ main(int argc, char *argv[])
       ++argv[i];
 
     inum = ialloc(T_FILE);
+    dirappend(rootino, argv[i], inum);
 
-    bzero(&de, sizeof(de));
-    de.inum = xshort(inum);
-    strncpy(de.name, argv[i], DIRSIZ);
-    iappend(rootino, &de, sizeof(de));
-
-    while((cc = read(fd, buf, sizeof(buf))) > 0)
-      iappend(inum, buf, cc);
+    // Small files go inline in the inode.
+    if(lseek(fd, 0, SEEK_END) <= INLINESIZE){
+      lseek(fd, 0, SEEK_SET);
+      cc = read(fd, buf, INLINESIZE);
+      iinline(inum, buf, cc);
+    } else {
+      lseek(fd, 0, SEEK_SET);
+      while((cc = read(fd, buf, sizeof(buf))) > 0)
+        iappend(inum, buf, cc);
+    }
 
     close(fd);
   }
 
   // fix size of root inode dir
-  rinode(rootino, &din);
-  off = xint(din.size);
-  off = ((off/BSIZE) + 1) * BSIZE;
-  din.size = xint(off);
-  winode(rootino, &din);
+  if(!nbuckets){
+    rinode(rootino, &din);
+    off = xint(din.size);
+    off = ((off/BSIZE) + 1) * BSIZE;
+    din.size = xint(off);
+    winode(rootino, &din);
+  }
 
   balloc(freeblock);
 
@@ -252,6 +280,43 @@ balloc(int used)
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 
+// Return the disk block holding block fbn of din,
+// allocating it if necessary.  Same layout as bmap() in fs.c.
+uint
+ibmap(struct dinode *din, uint fbn)
+{
+  uint indirect[NINDIRECT];
+  uint addr, level, n;
+
+  if(fbn < NDIRECT){
+    if(xint(din->addrs[fbn]) == 0){
+      din->addrs[fbn] = xint(freeblock++);
+    }
+    return xint(din->addrs[fbn]);
+  }
+  fbn -= NDIRECT;
+
+  for(level = 0, n = 1; fbn >= n*NINDIRECT; level++, n *= NINDIRECT){
+    fbn -= n*NINDIRECT;
+    assert(level < NLEVEL-1);
+  }
+  if(xint(din->addrs[NDIRECT+level]) == 0){
+    din->addrs[NDIRECT+level] = xint(freeblock++);
+  }
+  addr = xint(din->addrs[NDIRECT+level]);
+  for(;; n /= NINDIRECT){
+    rsect(addr, (char*)indirect);
+    if(indirect[fbn/n] == 0){
+      indirect[fbn/n] = xint(freeblock++);
+      wsect(addr, (char*)indirect);
+    }
+    addr = xint(indirect[fbn/n]);
+    if(n == 1)
+      return addr;
+    fbn %= n;
+  }
+}
+
 void
 iappend(uint inum, void *xp, int n)
 {
@@ -259,31 +324,15 @@ iappend(uint inum, void *xp, int n)
   uint fbn, off, n1;
   struct dinode din;
   char buf[BSIZE];
-  uint indirect[NINDIRECT];
   uint x;
 
   rinode(inum, &din);
+  assert(!(xint(din.flags) & DI_INLINE));
   off = xint(din.size);
   // printf("append inum %d at off %d sz %d\n", inum, off, n);
   while(n > 0){
     fbn = off / BSIZE;
-    assert(fbn < MAXFILE);
-    if(fbn < NDIRECT){
-      if(xint(din.addrs[fbn]) == 0){
-        din.addrs[fbn] = xint(freeblock++);
-      }
-      x = xint(din.addrs[fbn]);
-    } else {
-      if(xint(din.addrs[NDIRECT]) == 0){
-        din.addrs[NDIRECT] = xint(freeblock++);
-      }
-      rsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      if(indirect[fbn - NDIRECT] == 0){
-        indirect[fbn - NDIRECT] = xint(freeblock++);
-        wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      }
-      x = xint(indirect[fbn-NDIRECT]);
-    }
+    x = ibmap(&din, fbn);
     n1 = min(n, (fbn + 1) * BSIZE - off);
     rsect(x, buf);
     bcopy(p, buf + off - (fbn * BSIZE), n1);
@@ -295,3 +344,85 @@ iappend(uint inum, void *xp, int n)
   din.size = xint(off);
   winode(inum, &din);
 }
+
+// Make the empty file inum hold p[0..n-1] inline.
+void
+iinline(uint inum, void *p, int n)
+{
+  struct dinode din;
+
+  assert(n >= 0 && n <= INLINESIZE);
+  rinode(inum, &din);
+  din.flags = xint(DI_INLINE);
+  memmove(din.addrs, p, n);
+  din.size = xint(n);
+  winode(inum, &din);
+}
+
+// Make directory dinum a hashed directory: a header and
+// nbuckets empty blocks.  See struct dirhdr in fs.h.
+void
+hashdirinit(uint dinum)
+{
+  struct dinode din;
+  struct dirhdr hdr[DPB];
+  uint i;
+
+  for(i = 0; i <= nbuckets; i++)
+    iappend(dinum, zeroes, BSIZE);
+  rinode(dinum, &din);
+  din.flags = xint(DI_HASHED);
+  winode(dinum, &din);
+
+  bzero(hdr, sizeof(hdr));
+  HDRWORD(hdr, HDRNBUCKET) = xshort(nbuckets);
+  for(i = 0; i < nbuckets; i++)
+    HDRWORD(hdr, HDRBUCKET(i)) = xshort(1+i);
+  wsect(ibmap(&din, 0), hdr);
+}
+
+// Add the entry (name, inum) to directory dinum.
+void
+dirappend(uint dinum, char *name, uint inum)
+{
+  struct dinode din;
+  struct dirent de, blk[DPB];
+  struct dirchain *dc;
+  uint bn, nb, i;
+
+  bzero(&de, sizeof(de));
+  de.inum = xshort(inum);
+  strncpy(de.name, name, DIRSIZ);
+
+  rinode(dinum, &din);
+  if(!(xint(din.flags) & DI_HASHED)){
+    iappend(dinum, &de, sizeof(de));
+    return;
+  }
+
+  bn = 1 + dirbucket(dirhash(de.name), nbuckets);
+  for(;;){
+    rsect(ibmap(&din, bn), blk);
+    for(i = 0; i < DPB-1; i++){
+      if(blk[i].inum == 0){
+        blk[i] = de;
+        wsect(ibmap(&din, bn), blk);
+        return;
+      }
+    }
+    dc = (struct dirchain*)&blk[DPB-1];
+    if(dc->next == 0)
+      break;
+    bn = xint(dc->next);
+  }
+
+  // Chain is full: append an overflow block to it.
+  nb = xint(din.size) / BSIZE;
+  dc->next = xint(nb);
+  wsect(ibmap(&din, bn), blk);
+  iappend(dinum, zeroes, BSIZE);
+  rinode(dinum, &din);
+  bzero(blk, sizeof(blk));
+  blk[0] = de;
+  wsect(ibmap(&din, nb), blk);
+}
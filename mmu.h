@@ -39,11 +39,22 @@
 
 #define CR4_PSE         0x00000010      // Page size extension
 
+// Model specific registers
+#define MSR_SYSENTER_CS  0x174          // sysenter target %cs
+#define MSR_SYSENTER_ESP 0x175          // sysenter target %esp
+#define MSR_SYSENTER_EIP 0x176          // sysenter target %eip
+
+// CPUID feature flags (%edx of leaf 1)
+#define CPUID_SEP       0x00000800      // sysenter/sysexit present
+
+// sysenter/sysexit derive their segments from SEG_KCODE:
+// kernel data must follow kernel code, and user code and
+// user data must follow that, in this order.
 #define SEG_KCODE 1  // kernel code
 #define SEG_KDATA 2  // kernel data+stack
-#define SEG_KCPU  3  // kernel per-cpu data
-#define SEG_UCODE 4  // user code
-#define SEG_UDATA 5  // user data+stack
+#define SEG_UCODE 3  // user code
+#define SEG_UDATA 4  // user data+stack
+#define SEG_KCPU  5  // kernel per-cpu data
 #define SEG_TSS   6  // this process's task state
 
 //PAGEBREAK!
@@ -1,23 +1,35 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "stat.h"
 #include "mmu.h"
 #include "proc.h"
+#include "spinlock.h"
+#include "sleeplock.h"
 #include "fs.h"
 #include "file.h"
-#include "spinlock.h"
 
-#define PIPESIZE 512
+#define min(a, b) ((a) < (b) ? (a) : (b))
 
+// A pipe and its buffer share one kalloc() page; the
+// buffer is whatever the header leaves of the page.
+// nread and nwrite count bytes, but piperead pulls both
+// back by PIPESIZE once nread reaches it, so that n%PIPESIZE
+// stays a valid buffer offset without needing PIPESIZE to
+// be a power of two.
 struct pipe {
   struct spinlock lock;
-  char data[PIPESIZE];
   uint nread;     // number of bytes read
   uint nwrite;    // number of bytes written
   int readopen;   // read fd is still open
   int writeopen;  // write fd is still open
+  int nrsleep;    // readers sleeping on nread
+  int nwsleep;    // writers sleeping on nwrite
+  char data[];    // PIPESIZE bytes
 };
 
+#define PIPESIZE (PGSIZE - sizeof(struct pipe))
+
 int
 pipealloc(struct file **f0, struct file **f1)
 {
@@ -33,6 +45,8 @@ pipealloc(struct file **f0, struct file **f1)
   p->writeopen = 1;
   p->nwrite = 0;
   p->nread = 0;
+  p->nrsleep = 0;
+  p->nwsleep = 0;
   initlock(&p->lock, "pipe");
   (*f0)->type = FD_PIPE;
   (*f0)->readable = 1;
@@ -73,25 +87,71 @@ pipeclose(struct pipe *p, int writable)
     release(&p->lock);
 }
 
+// Copy up to n bytes from src into p, as far as p has room.
+// Caller must hold p->lock.  Returns the number copied.
+static int
+pipecopyin(struct pipe *p, char *src, int n)
+{
+  int i, m;
+  uint off;
+
+  for(i = 0; i < n && p->nwrite != p->nread + PIPESIZE; i += m){
+    off = p->nwrite % PIPESIZE;
+    m = min(n - i, p->nread + PIPESIZE - p->nwrite);
+    m = min(m, PIPESIZE - off);
+    memmove(p->data + off, src + i, m);
+    p->nwrite += m;
+  }
+  return i;
+}
+
+// Copy up to n bytes out of p into dst, as far as p has data.
+// Caller must hold p->lock.  Returns the number copied.
+static int
+pipecopyout(struct pipe *p, char *dst, int n)
+{
+  int i, m;
+  uint off;
+
+  for(i = 0; i < n && p->nread != p->nwrite; i += m){  //DOC: piperead-copy
+    off = p->nread % PIPESIZE;
+    m = min(n - i, p->nwrite - p->nread);
+    m = min(m, PIPESIZE - off);
+    memmove(dst + i, p->data + off, m);
+    p->nread += m;
+  }
+  if(p->nread >= PIPESIZE){
+    p->nread -= PIPESIZE;
+    p->nwrite -= PIPESIZE;
+  }
+  return i;
+}
+
 //PAGEBREAK: 40
+// Copy as much as fits in each pass with one memmove per
+// contiguous span, and only wake the other side if it
+// is actually asleep.
 int
 pipewrite(struct pipe *p, char *addr, int n)
 {
   int i;
 
   acquire(&p->lock);
-  for(i = 0; i < n; i++){
+  for(i = 0; i < n; i += pipecopyin(p, addr + i, n - i)){
     while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
       if(p->readopen == 0 || proc->killed){
         release(&p->lock);
         return -1;
       }
-      wakeup(&p->nread);
+      if(p->nrsleep)
+        wakeup(&p->nread);
+      p->nwsleep++;
       sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+      p->nwsleep--;
     }
-    p->data[p->nwrite++ % PIPESIZE] = addr[i];
   }
-  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+  if(p->nrsleep)
+    wakeup(&p->nread);  //DOC: pipewrite-wakeup1
   release(&p->lock);
   return n;
 }
@@ -107,14 +167,97 @@ piperead(struct pipe *p, char *addr, int n)
       release(&p->lock);
       return -1;
     }
+    p->nrsleep++;
     sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+    p->nrsleep--;
   }
-  for(i = 0; i < n; i++){  //DOC: piperead-copy
-    if(p->nread == p->nwrite)
+  i = pipecopyout(p, addr, n);
+  if(p->nwsleep)
+    wakeup(&p->nwrite);  //DOC: piperead-wakeup
+  release(&p->lock);
+  return i;
+}
+
+// Wait until p has room to write (if writing) or data to
+// read.  Returns 1 when ready, 0 at end of file when
+// reading, -1 if the reader has gone away or the caller
+// has been killed.  Used by splice, which must not sleep
+// on the pipe while it holds buffer cache blocks.
+int
+pipewait(struct pipe *p, int writing)
+{
+  int r;
+
+  acquire(&p->lock);
+  for(;;){
+    if(proc->killed || (writing && p->readopen == 0)){
+      r = -1;
+      break;
+    }
+    if(writing && p->nwrite != p->nread + PIPESIZE){
+      r = 1;
       break;
-    addr[i] = p->data[p->nread++ % PIPESIZE];
+    }
+    if(!writing && p->nread != p->nwrite){
+      r = 1;
+      break;
+    }
+    if(!writing && !p->writeopen){
+      r = 0;
+      break;
+    }
+    if(writing){
+      p->nwsleep++;
+      sleep(&p->nwrite, &p->lock);
+      p->nwsleep--;
+    } else {
+      p->nrsleep++;
+      sleep(&p->nread, &p->lock);
+      p->nrsleep--;
+    }
   }
-  wakeup(&p->nwrite);  //DOC: piperead-wakeup
+  release(&p->lock);
+  return r;
+}
+
+// Copy up to n bytes from kernel memory src into p
+// without sleeping.  Returns the number copied.
+int
+pipeput(struct pipe *p, char *src, int n)
+{
+  int i;
+
+  acquire(&p->lock);
+  i = pipecopyin(p, src, n);
+  if(i > 0 && p->nrsleep)
+    wakeup(&p->nread);
+  release(&p->lock);
+  return i;
+}
+
+// Copy up to n bytes from p into kernel memory dst
+// without sleeping.  Returns the number copied.
+int
+pipeget(struct pipe *p, char *dst, int n)
+{
+  int i;
+
+  acquire(&p->lock);
+  i = pipecopyout(p, dst, n);
+  if(i > 0 && p->nwsleep)
+    wakeup(&p->nwrite);
   release(&p->lock);
   return i;
 }
+
+// Describe pipe p for fstat: its size is the
+// number of bytes waiting to be read.
+void
+pipestat(struct pipe *p, struct stat *st)
+{
+  memset(st, 0, sizeof(*st));
+  st->type = T_PIPE;
+  acquire(&p->lock);
+  st->size = p->nwrite - p->nread;
+  release(&p->lock);
+}
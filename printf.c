@@ -2,12 +2,6 @@
 #include "stat.h"
 #include "user.h"
 
-static void
-putc(int fd, char c)
-{
-  write(fd, &c, 1);
-}
-
 static void
 printint(int fd, int xx, int base, int sgn)
 {
@@ -32,7 +26,7 @@ printint(int fd, int xx, int base, int sgn)
     buf[i++] = '-';
 
   while(--i >= 0)
-    putc(fd, buf[i]);
+    fputc(fd, buf[i]);
 }
 
 // Print to the given fd. Only understands %d, %x, %p, %s.
@@ -51,7 +45,7 @@ printf(int fd, char *fmt, ...)
       if(c == '%'){
         state = '%';
       } else {
-        putc(fd, c);
+        fputc(fd, c);
       }
     } else if(state == '%'){
       if(c == 'd'){
@@ -66,18 +60,18 @@ printf(int fd, char *fmt, ...)
         if(s == 0)
           s = "(null)";
         while(*s != 0){
-          putc(fd, *s);
+          fputc(fd, *s);
           s++;
         }
       } else if(c == 'c'){
-        putc(fd, *ap);
+        fputc(fd, *ap);
         ap++;
       } else if(c == '%'){
-        putc(fd, c);
+        fputc(fd, c);
       } else {
         // Unknown % sequence.  Print it to draw attention.
-        putc(fd, '%');
-        putc(fd, c);
+        fputc(fd, '%');
+        fputc(fd, c);
       }
       state = 0;
     }
@@ -6,13 +6,24 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "sleeplock.h"
 
 #include "fs.h"
 #include "file.h"
 
+#define NPIDHASH 61
+#define PIDHASH(pid) ((uint)(pid) % NPIDHASH)
+
+// Procs are allocated as they are needed and kept on a free
+// list once reaped.  Live procs are on the all list, which the
+// scheduler walks, and in a hash by pid; each proc also heads
+// a list of its children.
 struct {
   struct spinlock lock;
-  struct proc proc[NPROC];
+  int nproc;                      // procs on the all list
+  struct proc all;                // list head, through next/prev
+  struct proc *free;              // reaped procs, through next
+  struct proc *pidhash[NPIDHASH];
 } ptable;
 
 static struct proc *initproc;
@@ -27,11 +38,66 @@ void
 pinit(void)
 {
   initlock(&ptable.lock, "ptable");
+  ptable.all.next = ptable.all.prev = &ptable.all;
+}
+
+// Make p a child of parent.  Caller holds ptable.lock.
+static void
+addchild(struct proc *parent, struct proc *p)
+{
+  p->parent = parent;
+  p->sibprev = 0;
+  p->sibnext = parent->children;
+  if(parent->children)
+    parent->children->sibprev = p;
+  parent->children = p;
+}
+
+// Take p off its parent's list of children.
+// Caller holds ptable.lock.
+static void
+delchild(struct proc *p)
+{
+  if(p->parent == 0)
+    return;
+  if(p->sibprev)
+    p->sibprev->sibnext = p->sibnext;
+  else
+    p->parent->children = p->sibnext;
+  if(p->sibnext)
+    p->sibnext->sibprev = p->sibprev;
+  p->parent = 0;
+}
+
+// Return p to the free list.  Caller holds ptable.lock
+// and has released p's kernel stack and memory.
+static void
+freeproc(struct proc *p)
+{
+  struct proc **pp;
+
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp; pp = &(*pp)->hnext){
+    if(*pp == p){
+      *pp = p->hnext;
+      break;
+    }
+  }
+  delchild(p);
+  p->next->prev = p->prev;
+  p->prev->next = p->next;
+  ptable.nproc--;
+
+  p->state = UNUSED;
+  p->pid = 0;
+  p->name[0] = 0;
+  p->killed = 0;
+  p->next = ptable.free;
+  ptable.free = p;
 }
 
 //PAGEBREAK: 32
-// Look in the process table for an UNUSED proc.
-// If found, change state to EMBRYO and initialize
+// Take a proc from the free list, or allocate one.
+// If there is one, change state to EMBRYO and initialize
 // state required to run in the kernel.
 // Otherwise return 0.
 static struct proc*
@@ -41,20 +107,33 @@ allocproc(void)
   char *sp;
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == UNUSED)
-      goto found;
-  release(&ptable.lock);
-  return 0;
-
-found:
+  if(ptable.nproc >= NPROC){
+    release(&ptable.lock);
+    return 0;
+  }
+  if((p = ptable.free) != 0)
+    ptable.free = p->next;
+  else if((p = kmalloc(sizeof(*p))) == 0){
+    release(&ptable.lock);
+    return 0;
+  }
+  memset(p, 0, sizeof(*p));
   p->state = EMBRYO;
   p->pid = nextpid++;
+  p->hnext = ptable.pidhash[PIDHASH(p->pid)];
+  ptable.pidhash[PIDHASH(p->pid)] = p;
+  p->next = ptable.all.next;
+  p->prev = &ptable.all;
+  ptable.all.next->prev = p;
+  ptable.all.next = p;
+  ptable.nproc++;
   release(&ptable.lock);
 
   // Allocate kernel stack.
   if((p->kstack = kalloc()) == 0){
-    p->state = UNUSED;
+    acquire(&ptable.lock);
+    freeproc(p);
+    release(&ptable.lock);
     return 0;
   }
   sp = p->kstack + KSTACKSIZE;
@@ -105,6 +184,30 @@ userinit(void)
   p->state = RUNNABLE;
 }
 
+// Start a kernel thread that runs fn(), which must not return.
+// It has no user memory and is nobody's child.
+struct proc*
+kproc(char *name, void (*fn)(void))
+{
+  struct proc *p;
+
+  if((p = allocproc()) == 0 || (p->pgdir = setupkvm()) == 0)
+    panic("kproc");
+  p->sz = 0;
+  p->parent = 0;
+  p->killed = 0;
+  p->cwd = 0;
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  // Return from forkret into fn instead of trapret.
+  *(uint*)(p->context + 1) = (uint)fn;
+
+  acquire(&ptable.lock);
+  p->state = RUNNABLE;
+  release(&ptable.lock);
+  return p;
+}
+
 // Grow current process's memory by n bytes.
 // Return 0 on success, -1 on failure.
 int
@@ -142,11 +245,12 @@ fork(void)
   if((np->pgdir = copyuvm(proc->pgdir, proc->sz)) == 0){
     kfree(np->kstack);
     np->kstack = 0;
-    np->state = UNUSED;
+    acquire(&ptable.lock);
+    freeproc(np);
+    release(&ptable.lock);
     return -1;
   }
   np->sz = proc->sz;
-  np->parent = proc;
   *np->tf = *proc->tf;
 
   // Clear %eax so that fork returns 0 in the child.
@@ -163,6 +267,7 @@ fork(void)
 
   // lock to force the compiler to emit the np->state write last.
   acquire(&ptable.lock);
+  addchild(proc, np);
   np->state = RUNNABLE;
   release(&ptable.lock);
 
@@ -200,12 +305,11 @@ exit(void)
   wakeup1(proc->parent);
 
   // Pass abandoned children to init.
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->parent == proc){
-      p->parent = initproc;
-      if(p->state == ZOMBIE)
-        wakeup1(initproc);
-    }
+  while((p = proc->children) != 0){
+    delchild(p);
+    addchild(initproc, p);
+    if(p->state == ZOMBIE)
+      wakeup1(initproc);
   }
 
   // Jump into the scheduler, never to return.
@@ -224,23 +328,16 @@ wait(void)
 
   acquire(&ptable.lock);
   for(;;){
-    // Scan through table looking for zombie children.
-    havekids = 0;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->parent != proc)
-        continue;
-      havekids = 1;
+    // Scan through our children looking for zombies.
+    havekids = proc->children != 0;
+    for(p = proc->children; p; p = p->sibnext){
       if(p->state == ZOMBIE){
         // Found one.
         pid = p->pid;
         kfree(p->kstack);
         p->kstack = 0;
         freevm(p->pgdir);
-        p->state = UNUSED;
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
+        freeproc(p);
         release(&ptable.lock);
         return pid;
       }
@@ -275,8 +372,10 @@ scheduler(void)
     sti();
 
     // Loop over process table looking for process to run.
+    // The list may change while p runs, but p stays on it
+    // until we have moved past it.
     acquire(&ptable.lock);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    for(p = ptable.all.next; p != &ptable.all; p = p->next){
       if(p->state != RUNNABLE)
         continue;
 
@@ -342,8 +441,11 @@ forkret(void)
     // of a regular process (e.g., they call sleep), and thus cannot 
     // be run from main().
     first = 0;
-    iinit(ROOTDEV);
+    // Recover the log before iinit() reads the free bitmap.
     initlog(ROOTDEV);
+    iinit(ROOTDEV);
+    kproc("bflush", bflusher);
+    kproc("klogd", klogd);
   }
 
   // Return to "caller", actually trapret (see allocproc).
@@ -394,7 +496,7 @@ wakeup1(void *chan)
 {
   struct proc *p;
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+  for(p = ptable.all.next; p != &ptable.all; p = p->next)
     if(p->state == SLEEPING && p->chan == chan)
       p->state = RUNNABLE;
 }
@@ -408,6 +510,17 @@ wakeup(void *chan)
   release(&ptable.lock);
 }
 
+// Wake p if it is sleeping on chan; unlike wakeup,
+// this looks at no other process.
+void
+wakeproc(struct proc *p, void *chan)
+{
+  acquire(&ptable.lock);
+  if(p->state == SLEEPING && p->chan == chan)
+    p->state = RUNNABLE;
+  release(&ptable.lock);
+}
+
 // Kill the process with the given pid.
 // Process won't exit until it returns
 // to user space (see trap in trap.c).
@@ -417,7 +530,7 @@ kill(int pid)
   struct proc *p;
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.pidhash[PIDHASH(pid)]; p; p = p->hnext){
     if(p->pid == pid){
       p->killed = 1;
       // Wake process from sleep if necessary.
@@ -451,7 +564,7 @@ procdump(void)
   char *state;
   uint pc[10];
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.all.next; p != &ptable.all; p = p->next){
     if(p->state == UNUSED)
       continue;
     if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
@@ -662,11 +775,12 @@ int loadproc(struct proc* p, char* pgs)
   {
     kfree(np->kstack);
     np->kstack = 0;
-    np->state = UNUSED;
+    acquire(&ptable.lock);
+    freeproc(np);
+    release(&ptable.lock);
     return -1;
   }
   np->sz = p->sz;
-  np->parent = proc;
   *np->tf = *p->tf;
 
   np->tf->eax = 0;
@@ -678,6 +792,7 @@ int loadproc(struct proc* p, char* pgs)
   pid = np->pid;
 
   acquire(&ptable.lock);
+  addchild(proc, np);
   np->state = RUNNABLE;
   release(&ptable.lock);
 
@@ -66,6 +66,14 @@ struct proc {
   struct file *ofile[NOFILE];  // Open files
   struct inode *cwd;           // Current directory
   char name[16];               // Process name (debugging)
+  int logres;                  // Log blocks reserved by current FS op
+
+  struct proc *next;           // ptable list of all procs, or free list
+  struct proc *prev;
+  struct proc *hnext;          // ptable pid hash chain
+  struct proc *children;       // first child
+  struct proc *sibnext;        // parent's list of children
+  struct proc *sibprev;
 };
 
 // Process memory is laid out contiguously, low addresses first:
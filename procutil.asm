@@ -0,0 +1,2880 @@
+
+_procutil:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <save>:
+
+int stdout = 1;
+int stderr = 2;
+
+void save(char* name, struct proc p)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 18             	sub    $0x18,%esp
+    printf(stdout, "saving...\n");
+       6:	a1 c0 1d 00 00       	mov    0x1dc0,%eax
+       b:	83 ec 08             	sub    $0x8,%esp
+       e:	68 a0 16 00 00       	push   $0x16a0
+      13:	50                   	push   %eax
+      14:	e8 73 0b 00 00       	call   b8c <printf>
+      19:	83 c4 10             	add    $0x10,%esp
+
+    int fd = open(name, O_CREATE|O_RDWR);
+      1c:	83 ec 08             	sub    $0x8,%esp
+      1f:	68 02 02 00 00       	push   $0x202
+      24:	ff 75 08             	push   0x8(%ebp)
+      27:	e8 56 09 00 00       	call   982 <open>
+      2c:	83 c4 10             	add    $0x10,%esp
+      2f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fd >= 0)
+      32:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+      36:	78 39                	js     71 <save+0x71>
+    {
+        printf(stdout, "the file '%s' is created.\n", name);
+      38:	a1 c0 1d 00 00       	mov    0x1dc0,%eax
+      3d:	83 ec 04             	sub    $0x4,%esp
+      40:	ff 75 08             	push   0x8(%ebp)
+      43:	68 ab 16 00 00       	push   $0x16ab
+      48:	50                   	push   %eax
+      49:	e8 3e 0b 00 00       	call   b8c <printf>
+      4e:	83 c4 10             	add    $0x10,%esp
+    {
+        printf(stderr, "error: an error occured while creating the file '%s'.\n", name);
+        exit();
+    }
+
+    if(write(fd, &p, sizeof(p)) == sizeof(p))
+      51:	83 ec 04             	sub    $0x4,%esp
+      54:	68 98 00 00 00       	push   $0x98
+      59:	8d 45 0c             	lea    0xc(%ebp),%eax
+      5c:	50                   	push   %eax
+      5d:	ff 75 f4             	push   -0xc(%ebp)
+      60:	e8 e1 08 00 00       	call   946 <write>
+      65:	83 c4 10             	add    $0x10,%esp
+      68:	3d 98 00 00 00       	cmp    $0x98,%eax
+      6d:	75 3b                	jne    aa <save+0xaa>
+      6f:	eb 1e                	jmp    8f <save+0x8f>
+        printf(stderr, "error: an error occured while creating the file '%s'.\n", name);
+      71:	a1 c4 1d 00 00       	mov    0x1dc4,%eax
+      76:	83 ec 04             	sub    $0x4,%esp
+      79:	ff 75 08             	push   0x8(%ebp)
+      7c:	68 c8 16 00 00       	push   $0x16c8
+      81:	50                   	push   %eax
+      82:	e8 05 0b 00 00       	call   b8c <printf>
+      87:	83 c4 10             	add    $0x10,%esp
+        exit();
+      8a:	e8 99 15 00 00       	call   1628 <exit>
+    {
+        printf(stdout, "the process info is written to the file '%s'.\n", name);
+      8f:	a1 c0 1d 00 00       	mov    0x1dc0,%eax
+      94:	83 ec 04             	sub    $0x4,%esp
+      97:	ff 75 08             	push   0x8(%ebp)
+      9a:	68 00 17 00 00       	push   $0x1700
+      9f:	50                   	push   %eax
+      a0:	e8 e7 0a 00 00       	call   b8c <printf>
+      a5:	83 c4 10             	add    $0x10,%esp
+      a8:	eb 1e                	jmp    c8 <save+0xc8>
+    }
+    else
+    {
+        printf(stderr, "error: an error occured while writing to the file '%s'.\n", name);
+      aa:	a1 c4 1d 00 00       	mov    0x1dc4,%eax
+      af:	83 ec 04             	sub    $0x4,%esp
+      b2:	ff 75 08             	push   0x8(%ebp)
+      b5:	68 30 17 00 00       	push   $0x1730
+      ba:	50                   	push   %eax
+      bb:	e8 cc 0a 00 00       	call   b8c <printf>
+      c0:	83 c4 10             	add    $0x10,%esp
+        exit();
+      c3:	e8 60 15 00 00       	call   1628 <exit>
+    }
+
+    close(fd);
+      c8:	83 ec 0c             	sub    $0xc,%esp
+      cb:	ff 75 f4             	push   -0xc(%ebp)
+      ce:	e8 6d 15 00 00       	call   1640 <close>
+      d3:	83 c4 10             	add    $0x10,%esp
+}
+      d6:	90                   	nop
+      d7:	c9                   	leave
+      d8:	c3                   	ret
+
+000000d9 <load>:
+
+struct proc load(char* name)
+{
+      d9:	55                   	push   %ebp
+      da:	89 e5                	mov    %esp,%ebp
+      dc:	57                   	push   %edi
+      dd:	56                   	push   %esi
+      de:	53                   	push   %ebx
+      df:	81 ec ac 00 00 00    	sub    $0xac,%esp
+    printf(stdout, "loading...\n");
+      e5:	a1 c0 1d 00 00       	mov    0x1dc0,%eax
+      ea:	83 ec 08             	sub    $0x8,%esp
+      ed:	68 69 17 00 00       	push   $0x1769
+      f2:	50                   	push   %eax
+      f3:	e8 94 0a 00 00       	call   b8c <printf>
+      f8:	83 c4 10             	add    $0x10,%esp
+
+    int fd = open(name, O_RDONLY);
+      fb:	83 ec 08             	sub    $0x8,%esp
+      fe:	6a 00                	push   $0x0
+     100:	ff 75 0c             	push   0xc(%ebp)
+     103:	e8 7a 08 00 00       	call   982 <open>
+     108:	83 c4 10             	add    $0x10,%esp
+     10b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(fd >= 0)
+     10e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     112:	78 3c                	js     150 <load+0x77>
+    {
+        printf(stdout, "the file '%s' is opened.\n", name);
+     114:	a1 c0 1d 00 00       	mov    0x1dc0,%eax
+     119:	83 ec 04             	sub    $0x4,%esp
+     11c:	ff 75 0c             	push   0xc(%ebp)
+     11f:	68 75 17 00 00       	push   $0x1775
+     124:	50                   	push   %eax
+     125:	e8 62 0a 00 00       	call   b8c <printf>
+     12a:	83 c4 10             	add    $0x10,%esp
+        printf(stderr, "error: an error occured while opening the file '%s'.\n", name);
+        exit();
+    }
+
+    struct proc p;
+    if(read(fd, &p, sizeof(p)) == sizeof(p))
+     12d:	83 ec 04             	sub    $0x4,%esp
+     130:	68 98 00 00 00       	push   $0x98
+     135:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+     13b:	50                   	push   %eax
+     13c:	ff 75 e4             	push   -0x1c(%ebp)
+     13f:	e8 f3 07 00 00       	call   937 <read>
+     144:	83 c4 10             	add    $0x10,%esp
+     147:	3d 98 00 00 00       	cmp    $0x98,%eax
+     14c:	75 5b                	jne    1a9 <load+0xd0>
+     14e:	eb 1e                	jmp    16e <load+0x95>
+        printf(stderr, "error: an error occured while opening the file '%s'.\n", name);
+     150:	a1 c4 1d 00 00       	mov    0x1dc4,%eax
+     155:	83 ec 04             	sub    $0x4,%esp
+     158:	ff 75 0c             	push   0xc(%ebp)
+     15b:	68 90 17 00 00       	push   $0x1790
+     160:	50                   	push   %eax
+     161:	e8 26 0a 00 00       	call   b8c <printf>
+     166:	83 c4 10             	add    $0x10,%esp
+        exit();
+     169:	e8 ba 14 00 00       	call   1628 <exit>
+    {
+        printf(stdout, "the process info is read from the file '%s'.\n", name);
+     16e:	a1 c0 1d 00 00       	mov    0x1dc0,%eax
+     173:	83 ec 04             	sub    $0x4,%esp
+     176:	ff 75 0c             	push   0xc(%ebp)
+     179:	68 c8 17 00 00       	push   $0x17c8
+     17e:	50                   	push   %eax
+     17f:	e8 08 0a 00 00       	call   b8c <printf>
+     184:	83 c4 10             	add    $0x10,%esp
+    {
+        printf(stderr, "error: an error occured while reading from the file '%s'.\n", name);
+        exit();
+    }
+
+    close(fd);
+     187:	83 ec 0c             	sub    $0xc,%esp
+     18a:	ff 75 e4             	push   -0x1c(%ebp)
+     18d:	e8 ae 14 00 00       	call   1640 <close>
+     192:	83 c4 10             	add    $0x10,%esp
+
+    if(unlink(name) >= 0)
+     195:	83 ec 0c             	sub    $0xc,%esp
+     198:	ff 75 0c             	push   0xc(%ebp)
+     19b:	e8 00 08 00 00       	call   9a0 <unlink>
+     1a0:	83 c4 10             	add    $0x10,%esp
+     1a3:	85 c0                	test   %eax,%eax
+     1a5:	78 3b                	js     1e2 <load+0x109>
+     1a7:	eb 1e                	jmp    1c7 <load+0xee>
+        printf(stderr, "error: an error occured while reading from the file '%s'.\n", name);
+     1a9:	a1 c4 1d 00 00       	mov    0x1dc4,%eax
+     1ae:	83 ec 04             	sub    $0x4,%esp
+     1b1:	ff 75 0c             	push   0xc(%ebp)
+     1b4:	68 f8 17 00 00       	push   $0x17f8
+     1b9:	50                   	push   %eax
+     1ba:	e8 cd 09 00 00       	call   b8c <printf>
+     1bf:	83 c4 10             	add    $0x10,%esp
+        exit();
+     1c2:	e8 61 14 00 00       	call   1628 <exit>
+    {
+        printf(stdout, "the file '%s' is deleted.\n", name);
+     1c7:	a1 c0 1d 00 00       	mov    0x1dc0,%eax
+     1cc:	83 ec 04             	sub    $0x4,%esp
+     1cf:	ff 75 0c             	push   0xc(%ebp)
+     1d2:	68 33 18 00 00       	push   $0x1833
+     1d7:	50                   	push   %eax
+     1d8:	e8 af 09 00 00       	call   b8c <printf>
+     1dd:	83 c4 10             	add    $0x10,%esp
+     1e0:	eb 1e                	jmp    200 <load+0x127>
+    }
+    else
+    {
+        printf(stderr, "error: an error occured while unlinking the file '%s'.\n", name);
+     1e2:	a1 c4 1d 00 00       	mov    0x1dc4,%eax
+     1e7:	83 ec 04             	sub    $0x4,%esp
+     1ea:	ff 75 0c             	push   0xc(%ebp)
+     1ed:	68 50 18 00 00       	push   $0x1850
+     1f2:	50                   	push   %eax
+     1f3:	e8 94 09 00 00       	call   b8c <printf>
+     1f8:	83 c4 10             	add    $0x10,%esp
+        exit();
+     1fb:	e8 28 14 00 00       	call   1628 <exit>
+    }
+
+    return p;
+     200:	8b 45 08             	mov    0x8(%ebp),%eax
+     203:	89 c3                	mov    %eax,%ebx
+     205:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+     20b:	ba 26 00 00 00       	mov    $0x26,%edx
+     210:	89 df                	mov    %ebx,%edi
+     212:	89 c6                	mov    %eax,%esi
+     214:	89 d1                	mov    %edx,%ecx
+     216:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+}
+     218:	8b 45 08             	mov    0x8(%ebp),%eax
+     21b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     21e:	5b                   	pop    %ebx
+     21f:	5e                   	pop    %esi
+     220:	5f                   	pop    %edi
+     221:	5d                   	pop    %ebp
+     222:	c2 04 00             	ret    $0x4
+
+00000225 <main>:
+
+int main(int argc, char *argv[])
+{
+     225:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     229:	83 e4 f0             	and    $0xfffffff0,%esp
+     22c:	ff 71 fc             	push   -0x4(%ecx)
+     22f:	55                   	push   %ebp
+     230:	89 e5                	mov    %esp,%ebp
+     232:	57                   	push   %edi
+     233:	56                   	push   %esi
+     234:	53                   	push   %ebx
+     235:	51                   	push   %ecx
+     236:	81 ec a8 00 00 00    	sub    $0xa8,%esp
+    int pid = getpid();
+     23c:	e8 b9 07 00 00       	call   9fa <getpid>
+     241:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    printf(stdout, "pid = %d\n", pid);
+     244:	a1 c0 1d 00 00       	mov    0x1dc0,%eax
+     249:	83 ec 04             	sub    $0x4,%esp
+     24c:	ff 75 e4             	push   -0x1c(%ebp)
+     24f:	68 88 18 00 00       	push   $0x1888
+     254:	50                   	push   %eax
+     255:	e8 32 09 00 00       	call   b8c <printf>
+     25a:	83 c4 10             	add    $0x10,%esp
+
+    struct proc* p_before = malloc(sizeof(struct proc));
+     25d:	83 ec 0c             	sub    $0xc,%esp
+     260:	68 98 00 00 00       	push   $0x98
+     265:	e8 21 10 00 00       	call   128b <malloc>
+     26a:	83 c4 10             	add    $0x10,%esp
+     26d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    getproc(p_before);
+     270:	83 ec 0c             	sub    $0xc,%esp
+     273:	ff 75 e0             	push   -0x20(%ebp)
+     276:	e8 bb 07 00 00       	call   a36 <getproc>
+     27b:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "pid = %d\n", p_before->pid);
+     27e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     281:	8b 50 10             	mov    0x10(%eax),%edx
+     284:	a1 c0 1d 00 00       	mov    0x1dc0,%eax
+     289:	83 ec 04             	sub    $0x4,%esp
+     28c:	52                   	push   %edx
+     28d:	68 88 18 00 00       	push   $0x1888
+     292:	50                   	push   %eax
+     293:	e8 f4 08 00 00       	call   b8c <printf>
+     298:	83 c4 10             	add    $0x10,%esp
+    save("backup", *p_before);
+     29b:	83 ec 04             	sub    $0x4,%esp
+     29e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     2a1:	81 ec 98 00 00 00    	sub    $0x98,%esp
+     2a7:	89 e2                	mov    %esp,%edx
+     2a9:	89 c3                	mov    %eax,%ebx
+     2ab:	b8 26 00 00 00       	mov    $0x26,%eax
+     2b0:	89 d7                	mov    %edx,%edi
+     2b2:	89 de                	mov    %ebx,%esi
+     2b4:	89 c1                	mov    %eax,%ecx
+     2b6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     2b8:	68 92 18 00 00       	push   $0x1892
+     2bd:	e8 3e fd ff ff       	call   0 <save>
+     2c2:	81 c4 a0 00 00 00    	add    $0xa0,%esp
+    printf(stdout, "before: pid = %d\n", p_before->pid);
+     2c8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     2cb:	8b 50 10             	mov    0x10(%eax),%edx
+     2ce:	a1 c0 1d 00 00       	mov    0x1dc0,%eax
+     2d3:	83 ec 04             	sub    $0x4,%esp
+     2d6:	52                   	push   %edx
+     2d7:	68 99 18 00 00       	push   $0x1899
+     2dc:	50                   	push   %eax
+     2dd:	e8 aa 08 00 00       	call   b8c <printf>
+     2e2:	83 c4 10             	add    $0x10,%esp
+
+    struct proc p_after = load("backup");
+     2e5:	8d 85 48 ff ff ff    	lea    -0xb8(%ebp),%eax
+     2eb:	83 ec 08             	sub    $0x8,%esp
+     2ee:	68 92 18 00 00       	push   $0x1892
+     2f3:	50                   	push   %eax
+     2f4:	e8 e0 fd ff ff       	call   d9 <load>
+     2f9:	83 c4 0c             	add    $0xc,%esp
+    printf(stdout, "after: pid = %d\n", p_after.pid);
+     2fc:	8b 95 58 ff ff ff    	mov    -0xa8(%ebp),%edx
+     302:	a1 c0 1d 00 00       	mov    0x1dc0,%eax
+     307:	83 ec 04             	sub    $0x4,%esp
+     30a:	52                   	push   %edx
+     30b:	68 ab 18 00 00       	push   $0x18ab
+     310:	50                   	push   %eax
+     311:	e8 76 08 00 00       	call   b8c <printf>
+     316:	83 c4 10             	add    $0x10,%esp
+
+    exit();
+     319:	e8 0a 13 00 00       	call   1628 <exit>
+
+0000031e <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+     31e:	55                   	push   %ebp
+     31f:	89 e5                	mov    %esp,%ebp
+     321:	57                   	push   %edi
+     322:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+     323:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     326:	8b 55 10             	mov    0x10(%ebp),%edx
+     329:	8b 45 0c             	mov    0xc(%ebp),%eax
+     32c:	89 cb                	mov    %ecx,%ebx
+     32e:	89 df                	mov    %ebx,%edi
+     330:	89 d1                	mov    %edx,%ecx
+     332:	fc                   	cld
+     333:	f3 aa                	rep stos %al,%es:(%edi)
+     335:	89 ca                	mov    %ecx,%edx
+     337:	89 fb                	mov    %edi,%ebx
+     339:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     33c:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     33f:	90                   	nop
+     340:	5b                   	pop    %ebx
+     341:	5f                   	pop    %edi
+     342:	5d                   	pop    %ebp
+     343:	c3                   	ret
+
+00000344 <stosl>:
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+     344:	55                   	push   %ebp
+     345:	89 e5                	mov    %esp,%ebp
+     347:	57                   	push   %edi
+     348:	53                   	push   %ebx
+  asm volatile("cld; rep stosl" :
+     349:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     34c:	8b 55 10             	mov    0x10(%ebp),%edx
+     34f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     352:	89 cb                	mov    %ecx,%ebx
+     354:	89 df                	mov    %ebx,%edi
+     356:	89 d1                	mov    %edx,%ecx
+     358:	fc                   	cld
+     359:	f3 ab                	rep stos %eax,%es:(%edi)
+     35b:	89 ca                	mov    %ecx,%edx
+     35d:	89 fb                	mov    %edi,%ebx
+     35f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     362:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     365:	90                   	nop
+     366:	5b                   	pop    %ebx
+     367:	5f                   	pop    %edi
+     368:	5d                   	pop    %ebp
+     369:	c3                   	ret
+
+0000036a <movsb>:
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+     36a:	55                   	push   %ebp
+     36b:	89 e5                	mov    %esp,%ebp
+     36d:	57                   	push   %edi
+     36e:	56                   	push   %esi
+     36f:	53                   	push   %ebx
+  asm volatile("cld; rep movsb" :
+     370:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     373:	8b 55 0c             	mov    0xc(%ebp),%edx
+     376:	8b 45 10             	mov    0x10(%ebp),%eax
+     379:	89 cb                	mov    %ecx,%ebx
+     37b:	89 df                	mov    %ebx,%edi
+     37d:	89 d6                	mov    %edx,%esi
+     37f:	89 c1                	mov    %eax,%ecx
+     381:	fc                   	cld
+     382:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     384:	89 c8                	mov    %ecx,%eax
+     386:	89 f2                	mov    %esi,%edx
+     388:	89 fb                	mov    %edi,%ebx
+     38a:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     38d:	89 55 0c             	mov    %edx,0xc(%ebp)
+     390:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     393:	90                   	nop
+     394:	5b                   	pop    %ebx
+     395:	5e                   	pop    %esi
+     396:	5f                   	pop    %edi
+     397:	5d                   	pop    %ebp
+     398:	c3                   	ret
+
+00000399 <movsl>:
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+     399:	55                   	push   %ebp
+     39a:	89 e5                	mov    %esp,%ebp
+     39c:	57                   	push   %edi
+     39d:	56                   	push   %esi
+     39e:	53                   	push   %ebx
+  asm volatile("cld; rep movsl" :
+     39f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     3a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+     3a5:	8b 45 10             	mov    0x10(%ebp),%eax
+     3a8:	89 cb                	mov    %ecx,%ebx
+     3aa:	89 df                	mov    %ebx,%edi
+     3ac:	89 d6                	mov    %edx,%esi
+     3ae:	89 c1                	mov    %eax,%ecx
+     3b0:	fc                   	cld
+     3b1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     3b3:	89 c8                	mov    %ecx,%eax
+     3b5:	89 f2                	mov    %esi,%edx
+     3b7:	89 fb                	mov    %edi,%ebx
+     3b9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     3bc:	89 55 0c             	mov    %edx,0xc(%ebp)
+     3bf:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     3c2:	90                   	nop
+     3c3:	5b                   	pop    %ebx
+     3c4:	5e                   	pop    %esi
+     3c5:	5f                   	pop    %edi
+     3c6:	5d                   	pop    %ebp
+     3c7:	c3                   	ret
+
+000003c8 <strcpy>:
+#define ONES        0x01010101
+#define HASZERO(x)  (((x) - ONES) & ~(x) & (ONES << 7))
+
+char*
+strcpy(char *s, char *t)
+{
+     3c8:	55                   	push   %ebp
+     3c9:	89 e5                	mov    %esp,%ebp
+     3cb:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+     3ce:	8b 45 08             	mov    0x8(%ebp),%eax
+     3d1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     3d4:	90                   	nop
+     3d5:	8b 55 0c             	mov    0xc(%ebp),%edx
+     3d8:	8d 42 01             	lea    0x1(%edx),%eax
+     3db:	89 45 0c             	mov    %eax,0xc(%ebp)
+     3de:	8b 45 08             	mov    0x8(%ebp),%eax
+     3e1:	8d 48 01             	lea    0x1(%eax),%ecx
+     3e4:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     3e7:	0f b6 12             	movzbl (%edx),%edx
+     3ea:	88 10                	mov    %dl,(%eax)
+     3ec:	0f b6 00             	movzbl (%eax),%eax
+     3ef:	84 c0                	test   %al,%al
+     3f1:	75 e2                	jne    3d5 <strcpy+0xd>
+    ;
+  return os;
+     3f3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     3f6:	c9                   	leave
+     3f7:	c3                   	ret
+
+000003f8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     3f8:	55                   	push   %ebp
+     3f9:	89 e5                	mov    %esp,%ebp
+  // Aligned words never straddle a page, so reading
+  // whole ones past the end of a string is safe.
+  if((((uint)p | (uint)q) & 3) == 0)
+     3fb:	8b 55 08             	mov    0x8(%ebp),%edx
+     3fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+     401:	09 d0                	or     %edx,%eax
+     403:	83 e0 03             	and    $0x3,%eax
+     406:	85 c0                	test   %eax,%eax
+     408:	75 3f                	jne    449 <strcmp+0x51>
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     40a:	eb 08                	jmp    414 <strcmp+0x1c>
+      p += 4, q += 4;
+     40c:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     410:	83 45 0c 04          	addl   $0x4,0xc(%ebp)
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     414:	8b 45 08             	mov    0x8(%ebp),%eax
+     417:	8b 10                	mov    (%eax),%edx
+     419:	8b 45 0c             	mov    0xc(%ebp),%eax
+     41c:	8b 00                	mov    (%eax),%eax
+     41e:	39 c2                	cmp    %eax,%edx
+     420:	75 27                	jne    449 <strcmp+0x51>
+     422:	8b 45 08             	mov    0x8(%ebp),%eax
+     425:	8b 00                	mov    (%eax),%eax
+     427:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     42d:	8b 45 08             	mov    0x8(%ebp),%eax
+     430:	8b 00                	mov    (%eax),%eax
+     432:	f7 d0                	not    %eax
+     434:	21 d0                	and    %edx,%eax
+     436:	25 80 80 80 80       	and    $0x80808080,%eax
+     43b:	85 c0                	test   %eax,%eax
+     43d:	74 cd                	je     40c <strcmp+0x14>
+  while(*p && *p == *q)
+     43f:	eb 08                	jmp    449 <strcmp+0x51>
+    p++, q++;
+     441:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     445:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     449:	8b 45 08             	mov    0x8(%ebp),%eax
+     44c:	0f b6 00             	movzbl (%eax),%eax
+     44f:	84 c0                	test   %al,%al
+     451:	74 10                	je     463 <strcmp+0x6b>
+     453:	8b 45 08             	mov    0x8(%ebp),%eax
+     456:	0f b6 10             	movzbl (%eax),%edx
+     459:	8b 45 0c             	mov    0xc(%ebp),%eax
+     45c:	0f b6 00             	movzbl (%eax),%eax
+     45f:	38 c2                	cmp    %al,%dl
+     461:	74 de                	je     441 <strcmp+0x49>
+  return (uchar)*p - (uchar)*q;
+     463:	8b 45 08             	mov    0x8(%ebp),%eax
+     466:	0f b6 00             	movzbl (%eax),%eax
+     469:	0f b6 d0             	movzbl %al,%edx
+     46c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     46f:	0f b6 00             	movzbl (%eax),%eax
+     472:	0f b6 c0             	movzbl %al,%eax
+     475:	29 c2                	sub    %eax,%edx
+     477:	89 d0                	mov    %edx,%eax
+}
+     479:	5d                   	pop    %ebp
+     47a:	c3                   	ret
+
+0000047b <strlen>:
+
+uint
+strlen(char *s)
+{
+     47b:	55                   	push   %ebp
+     47c:	89 e5                	mov    %esp,%ebp
+     47e:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; ((uint)(s+n) & 3) && s[n]; n++)
+     481:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     488:	eb 04                	jmp    48e <strlen+0x13>
+     48a:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     48e:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     491:	8b 45 08             	mov    0x8(%ebp),%eax
+     494:	01 d0                	add    %edx,%eax
+     496:	83 e0 03             	and    $0x3,%eax
+     499:	85 c0                	test   %eax,%eax
+     49b:	74 0f                	je     4ac <strlen+0x31>
+     49d:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     4a0:	8b 45 08             	mov    0x8(%ebp),%eax
+     4a3:	01 d0                	add    %edx,%eax
+     4a5:	0f b6 00             	movzbl (%eax),%eax
+     4a8:	84 c0                	test   %al,%al
+     4aa:	75 de                	jne    48a <strlen+0xf>
+    ;
+  if(s[n])
+     4ac:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     4af:	8b 45 08             	mov    0x8(%ebp),%eax
+     4b2:	01 d0                	add    %edx,%eax
+     4b4:	0f b6 00             	movzbl (%eax),%eax
+     4b7:	84 c0                	test   %al,%al
+     4b9:	74 33                	je     4ee <strlen+0x73>
+    while(!HASZERO(*(uint*)(s+n)))
+     4bb:	eb 04                	jmp    4c1 <strlen+0x46>
+      n += 4;
+     4bd:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+    while(!HASZERO(*(uint*)(s+n)))
+     4c1:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     4c4:	8b 45 08             	mov    0x8(%ebp),%eax
+     4c7:	01 d0                	add    %edx,%eax
+     4c9:	8b 00                	mov    (%eax),%eax
+     4cb:	8d 88 ff fe fe fe    	lea    -0x1010101(%eax),%ecx
+     4d1:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     4d4:	8b 45 08             	mov    0x8(%ebp),%eax
+     4d7:	01 d0                	add    %edx,%eax
+     4d9:	8b 00                	mov    (%eax),%eax
+     4db:	f7 d0                	not    %eax
+     4dd:	21 c8                	and    %ecx,%eax
+     4df:	25 80 80 80 80       	and    $0x80808080,%eax
+     4e4:	85 c0                	test   %eax,%eax
+     4e6:	74 d5                	je     4bd <strlen+0x42>
+  for(; s[n]; n++)
+     4e8:	eb 04                	jmp    4ee <strlen+0x73>
+     4ea:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     4ee:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     4f1:	8b 45 08             	mov    0x8(%ebp),%eax
+     4f4:	01 d0                	add    %edx,%eax
+     4f6:	0f b6 00             	movzbl (%eax),%eax
+     4f9:	84 c0                	test   %al,%al
+     4fb:	75 ed                	jne    4ea <strlen+0x6f>
+    ;
+  return n;
+     4fd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     500:	c9                   	leave
+     501:	c3                   	ret
+
+00000502 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     502:	55                   	push   %ebp
+     503:	89 e5                	mov    %esp,%ebp
+     505:	83 ec 10             	sub    $0x10,%esp
+  char *d;
+  uint k;
+
+  d = dst;
+     508:	8b 45 08             	mov    0x8(%ebp),%eax
+     50b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c &= 0xFF;
+     50e:	81 65 0c ff 00 00 00 	andl   $0xff,0xc(%ebp)
+  if(n >= 16){
+     515:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     519:	76 54                	jbe    56f <memset+0x6d>
+    k = -(uint)d & 3;  // bytes up to a word boundary
+     51b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     51e:	f7 d8                	neg    %eax
+     520:	83 e0 03             	and    $0x3,%eax
+     523:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    stosb(d, c, k);
+     526:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     529:	50                   	push   %eax
+     52a:	ff 75 0c             	push   0xc(%ebp)
+     52d:	ff 75 fc             	push   -0x4(%ebp)
+     530:	e8 e9 fd ff ff       	call   31e <stosb>
+     535:	83 c4 0c             	add    $0xc,%esp
+    d += k;
+     538:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     53b:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n -= k;
+     53e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     541:	29 45 10             	sub    %eax,0x10(%ebp)
+    stosl(d, c*ONES, n/4);
+     544:	8b 45 10             	mov    0x10(%ebp),%eax
+     547:	c1 e8 02             	shr    $0x2,%eax
+     54a:	89 c2                	mov    %eax,%edx
+     54c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     54f:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     555:	52                   	push   %edx
+     556:	50                   	push   %eax
+     557:	ff 75 fc             	push   -0x4(%ebp)
+     55a:	e8 e5 fd ff ff       	call   344 <stosl>
+     55f:	83 c4 0c             	add    $0xc,%esp
+    d += n & ~3;
+     562:	8b 45 10             	mov    0x10(%ebp),%eax
+     565:	83 e0 fc             	and    $0xfffffffc,%eax
+     568:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n &= 3;
+     56b:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+  }
+  stosb(d, c, n);
+     56f:	8b 45 10             	mov    0x10(%ebp),%eax
+     572:	50                   	push   %eax
+     573:	ff 75 0c             	push   0xc(%ebp)
+     576:	ff 75 fc             	push   -0x4(%ebp)
+     579:	e8 a0 fd ff ff       	call   31e <stosb>
+     57e:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     581:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     584:	c9                   	leave
+     585:	c3                   	ret
+
+00000586 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     586:	55                   	push   %ebp
+     587:	89 e5                	mov    %esp,%ebp
+     589:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s1, *s2;
+
+  s1 = v1;
+     58c:	8b 45 08             	mov    0x8(%ebp),%eax
+     58f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s2 = v2;
+     592:	8b 45 0c             	mov    0xc(%ebp),%eax
+     595:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     598:	eb 0c                	jmp    5a6 <memcmp+0x20>
+    s1 += 4, s2 += 4, n -= 4;
+     59a:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+     59e:	83 45 f8 04          	addl   $0x4,-0x8(%ebp)
+     5a2:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     5a6:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     5aa:	76 3e                	jbe    5ea <memcmp+0x64>
+     5ac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     5af:	8b 10                	mov    (%eax),%edx
+     5b1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     5b4:	8b 00                	mov    (%eax),%eax
+     5b6:	39 c2                	cmp    %eax,%edx
+     5b8:	74 e0                	je     59a <memcmp+0x14>
+  while(n-- > 0){
+     5ba:	eb 2e                	jmp    5ea <memcmp+0x64>
+    if(*s1 != *s2)
+     5bc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     5bf:	0f b6 10             	movzbl (%eax),%edx
+     5c2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     5c5:	0f b6 00             	movzbl (%eax),%eax
+     5c8:	38 c2                	cmp    %al,%dl
+     5ca:	74 16                	je     5e2 <memcmp+0x5c>
+      return *s1 - *s2;
+     5cc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     5cf:	0f b6 00             	movzbl (%eax),%eax
+     5d2:	0f b6 d0             	movzbl %al,%edx
+     5d5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     5d8:	0f b6 00             	movzbl (%eax),%eax
+     5db:	0f b6 c0             	movzbl %al,%eax
+     5de:	29 c2                	sub    %eax,%edx
+     5e0:	eb 1a                	jmp    5fc <memcmp+0x76>
+    s1++, s2++;
+     5e2:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     5e6:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+  while(n-- > 0){
+     5ea:	8b 45 10             	mov    0x10(%ebp),%eax
+     5ed:	8d 50 ff             	lea    -0x1(%eax),%edx
+     5f0:	89 55 10             	mov    %edx,0x10(%ebp)
+     5f3:	85 c0                	test   %eax,%eax
+     5f5:	75 c5                	jne    5bc <memcmp+0x36>
+  }
+  return 0;
+     5f7:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+     5fc:	89 d0                	mov    %edx,%eax
+     5fe:	c9                   	leave
+     5ff:	c3                   	ret
+
+00000600 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     600:	55                   	push   %ebp
+     601:	89 e5                	mov    %esp,%ebp
+     603:	83 ec 14             	sub    $0x14,%esp
+     606:	8b 45 0c             	mov    0xc(%ebp),%eax
+     609:	88 45 ec             	mov    %al,-0x14(%ebp)
+  uint w, cc;
+
+  // Skip whole words holding neither c nor the terminator.
+  for(; ((uint)s & 3) && *s; s++)
+     60c:	eb 17                	jmp    625 <strchr+0x25>
+    if(*s == c)
+     60e:	8b 45 08             	mov    0x8(%ebp),%eax
+     611:	0f b6 00             	movzbl (%eax),%eax
+     614:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     617:	75 08                	jne    621 <strchr+0x21>
+      return (char*)s;
+     619:	8b 45 08             	mov    0x8(%ebp),%eax
+     61c:	e9 ad 00 00 00       	jmp    6ce <strchr+0xce>
+  for(; ((uint)s & 3) && *s; s++)
+     621:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     625:	8b 45 08             	mov    0x8(%ebp),%eax
+     628:	83 e0 03             	and    $0x3,%eax
+     62b:	85 c0                	test   %eax,%eax
+     62d:	74 0a                	je     639 <strchr+0x39>
+     62f:	8b 45 08             	mov    0x8(%ebp),%eax
+     632:	0f b6 00             	movzbl (%eax),%eax
+     635:	84 c0                	test   %al,%al
+     637:	75 d5                	jne    60e <strchr+0xe>
+  cc = (uchar)c * ONES;
+     639:	0f b6 45 ec          	movzbl -0x14(%ebp),%eax
+     63d:	0f b6 c0             	movzbl %al,%eax
+     640:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     646:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(*s)
+     649:	8b 45 08             	mov    0x8(%ebp),%eax
+     64c:	0f b6 00             	movzbl (%eax),%eax
+     64f:	84 c0                	test   %al,%al
+     651:	74 6c                	je     6bf <strchr+0xbf>
+    for(; w = *(uint*)s, !HASZERO(w) && !HASZERO(w ^ cc); s += 4)
+     653:	eb 04                	jmp    659 <strchr+0x59>
+     655:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     659:	8b 45 08             	mov    0x8(%ebp),%eax
+     65c:	8b 00                	mov    (%eax),%eax
+     65e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     661:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     664:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     66a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     66d:	f7 d0                	not    %eax
+     66f:	21 d0                	and    %edx,%eax
+     671:	25 80 80 80 80       	and    $0x80808080,%eax
+     676:	85 c0                	test   %eax,%eax
+     678:	75 26                	jne    6a0 <strchr+0xa0>
+     67a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     67d:	33 45 fc             	xor    -0x4(%ebp),%eax
+     680:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     686:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     689:	33 45 fc             	xor    -0x4(%ebp),%eax
+     68c:	f7 d0                	not    %eax
+     68e:	21 d0                	and    %edx,%eax
+     690:	25 80 80 80 80       	and    $0x80808080,%eax
+     695:	85 c0                	test   %eax,%eax
+     697:	75 07                	jne    6a0 <strchr+0xa0>
+     699:	b8 01 00 00 00       	mov    $0x1,%eax
+     69e:	eb 05                	jmp    6a5 <strchr+0xa5>
+     6a0:	b8 00 00 00 00       	mov    $0x0,%eax
+     6a5:	85 c0                	test   %eax,%eax
+     6a7:	75 ac                	jne    655 <strchr+0x55>
+      ;
+  for(; *s; s++)
+     6a9:	eb 14                	jmp    6bf <strchr+0xbf>
+    if(*s == c)
+     6ab:	8b 45 08             	mov    0x8(%ebp),%eax
+     6ae:	0f b6 00             	movzbl (%eax),%eax
+     6b1:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     6b4:	75 05                	jne    6bb <strchr+0xbb>
+      return (char*)s;
+     6b6:	8b 45 08             	mov    0x8(%ebp),%eax
+     6b9:	eb 13                	jmp    6ce <strchr+0xce>
+  for(; *s; s++)
+     6bb:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     6bf:	8b 45 08             	mov    0x8(%ebp),%eax
+     6c2:	0f b6 00             	movzbl (%eax),%eax
+     6c5:	84 c0                	test   %al,%al
+     6c7:	75 e2                	jne    6ab <strchr+0xab>
+  return 0;
+     6c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     6ce:	c9                   	leave
+     6cf:	c3                   	ret
+
+000006d0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     6d0:	55                   	push   %ebp
+     6d1:	89 e5                	mov    %esp,%ebp
+     6d3:	83 ec 18             	sub    $0x18,%esp
+  int i, c;
+
+  for(i=0; i+1 < max; ){
+     6d6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     6dd:	eb 37                	jmp    716 <gets+0x46>
+    c = fgetc(0);
+     6df:	83 ec 0c             	sub    $0xc,%esp
+     6e2:	6a 00                	push   $0x0
+     6e4:	e8 2e 0e 00 00       	call   1517 <fgetc>
+     6e9:	83 c4 10             	add    $0x10,%esp
+     6ec:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(c < 0)
+     6ef:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     6f3:	78 2e                	js     723 <gets+0x53>
+      break;
+    buf[i++] = c;
+     6f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6f8:	8d 50 01             	lea    0x1(%eax),%edx
+     6fb:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     6fe:	89 c2                	mov    %eax,%edx
+     700:	8b 45 08             	mov    0x8(%ebp),%eax
+     703:	01 d0                	add    %edx,%eax
+     705:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     708:	88 10                	mov    %dl,(%eax)
+    if(c == '\n' || c == '\r')
+     70a:	83 7d f0 0a          	cmpl   $0xa,-0x10(%ebp)
+     70e:	74 14                	je     724 <gets+0x54>
+     710:	83 7d f0 0d          	cmpl   $0xd,-0x10(%ebp)
+     714:	74 0e                	je     724 <gets+0x54>
+  for(i=0; i+1 < max; ){
+     716:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     719:	83 c0 01             	add    $0x1,%eax
+     71c:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     71f:	7f be                	jg     6df <gets+0xf>
+     721:	eb 01                	jmp    724 <gets+0x54>
+      break;
+     723:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     724:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     727:	8b 45 08             	mov    0x8(%ebp),%eax
+     72a:	01 d0                	add    %edx,%eax
+     72c:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     72f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     732:	c9                   	leave
+     733:	c3                   	ret
+
+00000734 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     734:	55                   	push   %ebp
+     735:	89 e5                	mov    %esp,%ebp
+     737:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     73a:	83 ec 08             	sub    $0x8,%esp
+     73d:	6a 00                	push   $0x0
+     73f:	ff 75 08             	push   0x8(%ebp)
+     742:	e8 3b 02 00 00       	call   982 <open>
+     747:	83 c4 10             	add    $0x10,%esp
+     74a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     74d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     751:	79 07                	jns    75a <stat+0x26>
+    return -1;
+     753:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     758:	eb 25                	jmp    77f <stat+0x4b>
+  r = fstat(fd, st);
+     75a:	83 ec 08             	sub    $0x8,%esp
+     75d:	ff 75 0c             	push   0xc(%ebp)
+     760:	ff 75 f4             	push   -0xc(%ebp)
+     763:	e8 47 02 00 00       	call   9af <fstat>
+     768:	83 c4 10             	add    $0x10,%esp
+     76b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     76e:	83 ec 0c             	sub    $0xc,%esp
+     771:	ff 75 f4             	push   -0xc(%ebp)
+     774:	e8 c7 0e 00 00       	call   1640 <close>
+     779:	83 c4 10             	add    $0x10,%esp
+  return r;
+     77c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     77f:	c9                   	leave
+     780:	c3                   	ret
+
+00000781 <atoi>:
+
+int
+atoi(const char *s)
+{
+     781:	55                   	push   %ebp
+     782:	89 e5                	mov    %esp,%ebp
+     784:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     787:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     78e:	eb 25                	jmp    7b5 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     790:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     793:	89 d0                	mov    %edx,%eax
+     795:	c1 e0 02             	shl    $0x2,%eax
+     798:	01 d0                	add    %edx,%eax
+     79a:	01 c0                	add    %eax,%eax
+     79c:	89 c1                	mov    %eax,%ecx
+     79e:	8b 45 08             	mov    0x8(%ebp),%eax
+     7a1:	8d 50 01             	lea    0x1(%eax),%edx
+     7a4:	89 55 08             	mov    %edx,0x8(%ebp)
+     7a7:	0f b6 00             	movzbl (%eax),%eax
+     7aa:	0f be c0             	movsbl %al,%eax
+     7ad:	01 c8                	add    %ecx,%eax
+     7af:	83 e8 30             	sub    $0x30,%eax
+     7b2:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     7b5:	8b 45 08             	mov    0x8(%ebp),%eax
+     7b8:	0f b6 00             	movzbl (%eax),%eax
+     7bb:	3c 2f                	cmp    $0x2f,%al
+     7bd:	7e 0a                	jle    7c9 <atoi+0x48>
+     7bf:	8b 45 08             	mov    0x8(%ebp),%eax
+     7c2:	0f b6 00             	movzbl (%eax),%eax
+     7c5:	3c 39                	cmp    $0x39,%al
+     7c7:	7e c7                	jle    790 <atoi+0xf>
+  return n;
+     7c9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     7cc:	c9                   	leave
+     7cd:	c3                   	ret
+
+000007ce <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     7ce:	55                   	push   %ebp
+     7cf:	89 e5                	mov    %esp,%ebp
+     7d1:	83 ec 10             	sub    $0x10,%esp
+  char *d, *s;
+  int k;
+
+  if(n <= 0)
+     7d4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     7d8:	7f 08                	jg     7e2 <memmove+0x14>
+    return vdst;
+     7da:	8b 45 08             	mov    0x8(%ebp),%eax
+     7dd:	e9 17 01 00 00       	jmp    8f9 <memmove+0x12b>
+  d = vdst;
+     7e2:	8b 45 08             	mov    0x8(%ebp),%eax
+     7e5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s = vsrc;
+     7e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+     7eb:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  if(s < d && s + n > d){
+     7ee:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     7f1:	3b 45 fc             	cmp    -0x4(%ebp),%eax
+     7f4:	0f 83 84 00 00 00    	jae    87e <memmove+0xb0>
+     7fa:	8b 55 10             	mov    0x10(%ebp),%edx
+     7fd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     800:	01 d0                	add    %edx,%eax
+     802:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     805:	73 77                	jae    87e <memmove+0xb0>
+    s += n;
+     807:	8b 45 10             	mov    0x10(%ebp),%eax
+     80a:	01 45 f8             	add    %eax,-0x8(%ebp)
+    d += n;
+     80d:	8b 45 10             	mov    0x10(%ebp),%eax
+     810:	01 45 fc             	add    %eax,-0x4(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     813:	eb 17                	jmp    82c <memmove+0x5e>
+      *--d = *--s, n--;
+     815:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     819:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     81d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     820:	0f b6 10             	movzbl (%eax),%edx
+     823:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     826:	88 10                	mov    %dl,(%eax)
+     828:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     82c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     830:	7e 22                	jle    854 <memmove+0x86>
+     832:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     835:	83 e0 03             	and    $0x3,%eax
+     838:	85 c0                	test   %eax,%eax
+     83a:	75 d9                	jne    815 <memmove+0x47>
+    for(; n >= 4; n -= 4){
+     83c:	eb 16                	jmp    854 <memmove+0x86>
+      d -= 4;
+     83e:	83 6d fc 04          	subl   $0x4,-0x4(%ebp)
+      s -= 4;
+     842:	83 6d f8 04          	subl   $0x4,-0x8(%ebp)
+      *(uint*)d = *(uint*)s;
+     846:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     849:	8b 10                	mov    (%eax),%edx
+     84b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     84e:	89 10                	mov    %edx,(%eax)
+    for(; n >= 4; n -= 4){
+     850:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+     854:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     858:	7f e4                	jg     83e <memmove+0x70>
+    }
+    while(n-- > 0)
+     85a:	eb 13                	jmp    86f <memmove+0xa1>
+      *--d = *--s;
+     85c:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     860:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     864:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     867:	0f b6 10             	movzbl (%eax),%edx
+     86a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     86d:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+     86f:	8b 45 10             	mov    0x10(%ebp),%eax
+     872:	8d 50 ff             	lea    -0x1(%eax),%edx
+     875:	89 55 10             	mov    %edx,0x10(%ebp)
+     878:	85 c0                	test   %eax,%eax
+     87a:	7f e0                	jg     85c <memmove+0x8e>
+  if(s < d && s + n > d){
+     87c:	eb 78                	jmp    8f6 <memmove+0x128>
+  } else {
+    if(n >= 16){
+     87e:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     882:	7e 61                	jle    8e5 <memmove+0x117>
+      k = -(uint)d & 3;
+     884:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     887:	f7 d8                	neg    %eax
+     889:	83 e0 03             	and    $0x3,%eax
+     88c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      movsb(d, s, k);
+     88f:	ff 75 f4             	push   -0xc(%ebp)
+     892:	ff 75 f8             	push   -0x8(%ebp)
+     895:	ff 75 fc             	push   -0x4(%ebp)
+     898:	e8 cd fa ff ff       	call   36a <movsb>
+     89d:	83 c4 0c             	add    $0xc,%esp
+      d += k;
+     8a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8a3:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += k;
+     8a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8a9:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n -= k;
+     8ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8af:	29 45 10             	sub    %eax,0x10(%ebp)
+      movsl(d, s, n/4);
+     8b2:	8b 45 10             	mov    0x10(%ebp),%eax
+     8b5:	8d 50 03             	lea    0x3(%eax),%edx
+     8b8:	85 c0                	test   %eax,%eax
+     8ba:	0f 48 c2             	cmovs  %edx,%eax
+     8bd:	c1 f8 02             	sar    $0x2,%eax
+     8c0:	50                   	push   %eax
+     8c1:	ff 75 f8             	push   -0x8(%ebp)
+     8c4:	ff 75 fc             	push   -0x4(%ebp)
+     8c7:	e8 cd fa ff ff       	call   399 <movsl>
+     8cc:	83 c4 0c             	add    $0xc,%esp
+      d += n & ~3;
+     8cf:	8b 45 10             	mov    0x10(%ebp),%eax
+     8d2:	83 e0 fc             	and    $0xfffffffc,%eax
+     8d5:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += n & ~3;
+     8d8:	8b 45 10             	mov    0x10(%ebp),%eax
+     8db:	83 e0 fc             	and    $0xfffffffc,%eax
+     8de:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n &= 3;
+     8e1:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+    }
+    movsb(d, s, n);
+     8e5:	ff 75 10             	push   0x10(%ebp)
+     8e8:	ff 75 f8             	push   -0x8(%ebp)
+     8eb:	ff 75 fc             	push   -0x4(%ebp)
+     8ee:	e8 77 fa ff ff       	call   36a <movsb>
+     8f3:	83 c4 0c             	add    $0xc,%esp
+  }
+  return vdst;
+     8f6:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     8f9:	c9                   	leave
+     8fa:	c3                   	ret
+
+000008fb <_fork>:
+    movl %esp, %ecx; \
+    movl $1f, %edx; \
+    sysenter; \
+  1: ret
+
+RAWSYSCALL(fork)
+     8fb:	b8 01 00 00 00       	mov    $0x1,%eax
+     900:	89 e1                	mov    %esp,%ecx
+     902:	ba 09 09 00 00       	mov    $0x909,%edx
+     907:	0f 34                	sysenter
+     909:	c3                   	ret
+
+0000090a <_exit>:
+RAWSYSCALL(exit)
+     90a:	b8 02 00 00 00       	mov    $0x2,%eax
+     90f:	89 e1                	mov    %esp,%ecx
+     911:	ba 18 09 00 00       	mov    $0x918,%edx
+     916:	0f 34                	sysenter
+     918:	c3                   	ret
+
+00000919 <wait>:
+SYSCALL(wait)
+     919:	b8 03 00 00 00       	mov    $0x3,%eax
+     91e:	89 e1                	mov    %esp,%ecx
+     920:	ba 27 09 00 00       	mov    $0x927,%edx
+     925:	0f 34                	sysenter
+     927:	c3                   	ret
+
+00000928 <pipe>:
+SYSCALL(pipe)
+     928:	b8 04 00 00 00       	mov    $0x4,%eax
+     92d:	89 e1                	mov    %esp,%ecx
+     92f:	ba 36 09 00 00       	mov    $0x936,%edx
+     934:	0f 34                	sysenter
+     936:	c3                   	ret
+
+00000937 <read>:
+SYSCALL(read)
+     937:	b8 05 00 00 00       	mov    $0x5,%eax
+     93c:	89 e1                	mov    %esp,%ecx
+     93e:	ba 45 09 00 00       	mov    $0x945,%edx
+     943:	0f 34                	sysenter
+     945:	c3                   	ret
+
+00000946 <write>:
+SYSCALL(write)
+     946:	b8 10 00 00 00       	mov    $0x10,%eax
+     94b:	89 e1                	mov    %esp,%ecx
+     94d:	ba 54 09 00 00       	mov    $0x954,%edx
+     952:	0f 34                	sysenter
+     954:	c3                   	ret
+
+00000955 <_close>:
+RAWSYSCALL(close)
+     955:	b8 15 00 00 00       	mov    $0x15,%eax
+     95a:	89 e1                	mov    %esp,%ecx
+     95c:	ba 63 09 00 00       	mov    $0x963,%edx
+     961:	0f 34                	sysenter
+     963:	c3                   	ret
+
+00000964 <kill>:
+SYSCALL(kill)
+     964:	b8 06 00 00 00       	mov    $0x6,%eax
+     969:	89 e1                	mov    %esp,%ecx
+     96b:	ba 72 09 00 00       	mov    $0x972,%edx
+     970:	0f 34                	sysenter
+     972:	c3                   	ret
+
+00000973 <_exec>:
+RAWSYSCALL(exec)
+     973:	b8 07 00 00 00       	mov    $0x7,%eax
+     978:	89 e1                	mov    %esp,%ecx
+     97a:	ba 81 09 00 00       	mov    $0x981,%edx
+     97f:	0f 34                	sysenter
+     981:	c3                   	ret
+
+00000982 <open>:
+SYSCALL(open)
+     982:	b8 0f 00 00 00       	mov    $0xf,%eax
+     987:	89 e1                	mov    %esp,%ecx
+     989:	ba 90 09 00 00       	mov    $0x990,%edx
+     98e:	0f 34                	sysenter
+     990:	c3                   	ret
+
+00000991 <mknod>:
+SYSCALL(mknod)
+     991:	b8 11 00 00 00       	mov    $0x11,%eax
+     996:	89 e1                	mov    %esp,%ecx
+     998:	ba 9f 09 00 00       	mov    $0x99f,%edx
+     99d:	0f 34                	sysenter
+     99f:	c3                   	ret
+
+000009a0 <unlink>:
+SYSCALL(unlink)
+     9a0:	b8 12 00 00 00       	mov    $0x12,%eax
+     9a5:	89 e1                	mov    %esp,%ecx
+     9a7:	ba ae 09 00 00       	mov    $0x9ae,%edx
+     9ac:	0f 34                	sysenter
+     9ae:	c3                   	ret
+
+000009af <fstat>:
+SYSCALL(fstat)
+     9af:	b8 08 00 00 00       	mov    $0x8,%eax
+     9b4:	89 e1                	mov    %esp,%ecx
+     9b6:	ba bd 09 00 00       	mov    $0x9bd,%edx
+     9bb:	0f 34                	sysenter
+     9bd:	c3                   	ret
+
+000009be <link>:
+SYSCALL(link)
+     9be:	b8 13 00 00 00       	mov    $0x13,%eax
+     9c3:	89 e1                	mov    %esp,%ecx
+     9c5:	ba cc 09 00 00       	mov    $0x9cc,%edx
+     9ca:	0f 34                	sysenter
+     9cc:	c3                   	ret
+
+000009cd <mkdir>:
+SYSCALL(mkdir)
+     9cd:	b8 14 00 00 00       	mov    $0x14,%eax
+     9d2:	89 e1                	mov    %esp,%ecx
+     9d4:	ba db 09 00 00       	mov    $0x9db,%edx
+     9d9:	0f 34                	sysenter
+     9db:	c3                   	ret
+
+000009dc <chdir>:
+SYSCALL(chdir)
+     9dc:	b8 09 00 00 00       	mov    $0x9,%eax
+     9e1:	89 e1                	mov    %esp,%ecx
+     9e3:	ba ea 09 00 00       	mov    $0x9ea,%edx
+     9e8:	0f 34                	sysenter
+     9ea:	c3                   	ret
+
+000009eb <dup>:
+SYSCALL(dup)
+     9eb:	b8 0a 00 00 00       	mov    $0xa,%eax
+     9f0:	89 e1                	mov    %esp,%ecx
+     9f2:	ba f9 09 00 00       	mov    $0x9f9,%edx
+     9f7:	0f 34                	sysenter
+     9f9:	c3                   	ret
+
+000009fa <getpid>:
+SYSCALL(getpid)
+     9fa:	b8 0b 00 00 00       	mov    $0xb,%eax
+     9ff:	89 e1                	mov    %esp,%ecx
+     a01:	ba 08 0a 00 00       	mov    $0xa08,%edx
+     a06:	0f 34                	sysenter
+     a08:	c3                   	ret
+
+00000a09 <sbrk>:
+SYSCALL(sbrk)
+     a09:	b8 0c 00 00 00       	mov    $0xc,%eax
+     a0e:	89 e1                	mov    %esp,%ecx
+     a10:	ba 17 0a 00 00       	mov    $0xa17,%edx
+     a15:	0f 34                	sysenter
+     a17:	c3                   	ret
+
+00000a18 <sleep>:
+SYSCALL(sleep)
+     a18:	b8 0d 00 00 00       	mov    $0xd,%eax
+     a1d:	89 e1                	mov    %esp,%ecx
+     a1f:	ba 26 0a 00 00       	mov    $0xa26,%edx
+     a24:	0f 34                	sysenter
+     a26:	c3                   	ret
+
+00000a27 <uptime>:
+SYSCALL(uptime)
+     a27:	b8 0e 00 00 00       	mov    $0xe,%eax
+     a2c:	89 e1                	mov    %esp,%ecx
+     a2e:	ba 35 0a 00 00       	mov    $0xa35,%edx
+     a33:	0f 34                	sysenter
+     a35:	c3                   	ret
+
+00000a36 <getproc>:
+SYSCALL(getproc)
+     a36:	b8 16 00 00 00       	mov    $0x16,%eax
+     a3b:	89 e1                	mov    %esp,%ecx
+     a3d:	ba 44 0a 00 00       	mov    $0xa44,%edx
+     a42:	0f 34                	sysenter
+     a44:	c3                   	ret
+
+00000a45 <getpgs>:
+SYSCALL(getpgs)
+     a45:	b8 17 00 00 00       	mov    $0x17,%eax
+     a4a:	89 e1                	mov    %esp,%ecx
+     a4c:	ba 53 0a 00 00       	mov    $0xa53,%edx
+     a51:	0f 34                	sysenter
+     a53:	c3                   	ret
+
+00000a54 <loadproc>:
+SYSCALL(loadproc)
+     a54:	b8 18 00 00 00       	mov    $0x18,%eax
+     a59:	89 e1                	mov    %esp,%ecx
+     a5b:	ba 62 0a 00 00       	mov    $0xa62,%edx
+     a60:	0f 34                	sysenter
+     a62:	c3                   	ret
+
+00000a63 <iosubmit>:
+SYSCALL(iosubmit)
+     a63:	b8 19 00 00 00       	mov    $0x19,%eax
+     a68:	89 e1                	mov    %esp,%ecx
+     a6a:	ba 71 0a 00 00       	mov    $0xa71,%edx
+     a6f:	0f 34                	sysenter
+     a71:	c3                   	ret
+
+00000a72 <sysstat>:
+SYSCALL(sysstat)
+     a72:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     a77:	89 e1                	mov    %esp,%ecx
+     a79:	ba 80 0a 00 00       	mov    $0xa80,%edx
+     a7e:	0f 34                	sysenter
+     a80:	c3                   	ret
+
+00000a81 <splice>:
+SYSCALL(splice)
+     a81:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     a86:	89 e1                	mov    %esp,%ecx
+     a88:	ba 8f 0a 00 00       	mov    $0xa8f,%edx
+     a8d:	0f 34                	sysenter
+     a8f:	c3                   	ret
+
+00000a90 <fsync>:
+SYSCALL(fsync)
+     a90:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     a95:	89 e1                	mov    %esp,%ecx
+     a97:	ba 9e 0a 00 00       	mov    $0xa9e,%edx
+     a9c:	0f 34                	sysenter
+     a9e:	c3                   	ret
+
+00000a9f <fdatasync>:
+SYSCALL(fdatasync)
+     a9f:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     aa4:	89 e1                	mov    %esp,%ecx
+     aa6:	ba ad 0a 00 00       	mov    $0xaad,%edx
+     aab:	0f 34                	sysenter
+     aad:	c3                   	ret
+
+00000aae <lseek>:
+SYSCALL(lseek)
+     aae:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     ab3:	89 e1                	mov    %esp,%ecx
+     ab5:	ba bc 0a 00 00       	mov    $0xabc,%edx
+     aba:	0f 34                	sysenter
+     abc:	c3                   	ret
+
+00000abd <dmesg>:
+SYSCALL(dmesg)
+     abd:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     ac2:	89 e1                	mov    %esp,%ecx
+     ac4:	ba cb 0a 00 00       	mov    $0xacb,%edx
+     ac9:	0f 34                	sysenter
+     acb:	c3                   	ret
+
+00000acc <lockstat>:
+SYSCALL(lockstat)
+     acc:	b8 20 00 00 00       	mov    $0x20,%eax
+     ad1:	89 e1                	mov    %esp,%ecx
+     ad3:	ba da 0a 00 00       	mov    $0xada,%edx
+     ad8:	0f 34                	sysenter
+     ada:	c3                   	ret
+
+00000adb <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     adb:	55                   	push   %ebp
+     adc:	89 e5                	mov    %esp,%ebp
+     ade:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     ae1:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     ae8:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     aec:	74 17                	je     b05 <printint+0x2a>
+     aee:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     af2:	79 11                	jns    b05 <printint+0x2a>
+    neg = 1;
+     af4:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     afb:	8b 45 0c             	mov    0xc(%ebp),%eax
+     afe:	f7 d8                	neg    %eax
+     b00:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     b03:	eb 06                	jmp    b0b <printint+0x30>
+  } else {
+    x = xx;
+     b05:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b08:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     b0b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     b12:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     b15:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b18:	ba 00 00 00 00       	mov    $0x0,%edx
+     b1d:	f7 f1                	div    %ecx
+     b1f:	89 d1                	mov    %edx,%ecx
+     b21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b24:	8d 50 01             	lea    0x1(%eax),%edx
+     b27:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     b2a:	0f b6 91 c8 1d 00 00 	movzbl 0x1dc8(%ecx),%edx
+     b31:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     b35:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     b38:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b3b:	ba 00 00 00 00       	mov    $0x0,%edx
+     b40:	f7 f1                	div    %ecx
+     b42:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     b45:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     b49:	75 c7                	jne    b12 <printint+0x37>
+  if(neg)
+     b4b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     b4f:	74 2d                	je     b7e <printint+0xa3>
+    buf[i++] = '-';
+     b51:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b54:	8d 50 01             	lea    0x1(%eax),%edx
+     b57:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     b5a:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+     b5f:	eb 1d                	jmp    b7e <printint+0xa3>
+    fputc(fd, buf[i]);
+     b61:	8d 55 dc             	lea    -0x24(%ebp),%edx
+     b64:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b67:	01 d0                	add    %edx,%eax
+     b69:	0f b6 00             	movzbl (%eax),%eax
+     b6c:	0f be c0             	movsbl %al,%eax
+     b6f:	83 ec 08             	sub    $0x8,%esp
+     b72:	50                   	push   %eax
+     b73:	ff 75 08             	push   0x8(%ebp)
+     b76:	e8 f8 08 00 00       	call   1473 <fputc>
+     b7b:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+     b7e:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     b82:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     b86:	79 d9                	jns    b61 <printint+0x86>
+}
+     b88:	90                   	nop
+     b89:	90                   	nop
+     b8a:	c9                   	leave
+     b8b:	c3                   	ret
+
+00000b8c <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     b8c:	55                   	push   %ebp
+     b8d:	89 e5                	mov    %esp,%ebp
+     b8f:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+     b92:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     b99:	8d 45 0c             	lea    0xc(%ebp),%eax
+     b9c:	83 c0 04             	add    $0x4,%eax
+     b9f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+     ba2:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     ba9:	e9 4a 01 00 00       	jmp    cf8 <printf+0x16c>
+    c = fmt[i] & 0xff;
+     bae:	8b 55 0c             	mov    0xc(%ebp),%edx
+     bb1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bb4:	01 d0                	add    %edx,%eax
+     bb6:	0f b6 00             	movzbl (%eax),%eax
+     bb9:	0f be c0             	movsbl %al,%eax
+     bbc:	25 ff 00 00 00       	and    $0xff,%eax
+     bc1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+     bc4:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     bc8:	75 28                	jne    bf2 <printf+0x66>
+      if(c == '%'){
+     bca:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     bce:	75 0c                	jne    bdc <printf+0x50>
+        state = '%';
+     bd0:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+     bd7:	e9 18 01 00 00       	jmp    cf4 <printf+0x168>
+      } else {
+        fputc(fd, c);
+     bdc:	83 ec 08             	sub    $0x8,%esp
+     bdf:	ff 75 e4             	push   -0x1c(%ebp)
+     be2:	ff 75 08             	push   0x8(%ebp)
+     be5:	e8 89 08 00 00       	call   1473 <fputc>
+     bea:	83 c4 10             	add    $0x10,%esp
+     bed:	e9 02 01 00 00       	jmp    cf4 <printf+0x168>
+      }
+    } else if(state == '%'){
+     bf2:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+     bf6:	0f 85 f8 00 00 00    	jne    cf4 <printf+0x168>
+      if(c == 'd'){
+     bfc:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+     c00:	75 1e                	jne    c20 <printf+0x94>
+        printint(fd, *ap, 10, 1);
+     c02:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c05:	8b 00                	mov    (%eax),%eax
+     c07:	6a 01                	push   $0x1
+     c09:	6a 0a                	push   $0xa
+     c0b:	50                   	push   %eax
+     c0c:	ff 75 08             	push   0x8(%ebp)
+     c0f:	e8 c7 fe ff ff       	call   adb <printint>
+     c14:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     c17:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     c1b:	e9 cd 00 00 00       	jmp    ced <printf+0x161>
+      } else if(c == 'x' || c == 'p'){
+     c20:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+     c24:	74 06                	je     c2c <printf+0xa0>
+     c26:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+     c2a:	75 1e                	jne    c4a <printf+0xbe>
+        printint(fd, *ap, 16, 0);
+     c2c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c2f:	8b 00                	mov    (%eax),%eax
+     c31:	6a 00                	push   $0x0
+     c33:	6a 10                	push   $0x10
+     c35:	50                   	push   %eax
+     c36:	ff 75 08             	push   0x8(%ebp)
+     c39:	e8 9d fe ff ff       	call   adb <printint>
+     c3e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     c41:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     c45:	e9 a3 00 00 00       	jmp    ced <printf+0x161>
+      } else if(c == 's'){
+     c4a:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+     c4e:	75 43                	jne    c93 <printf+0x107>
+        s = (char*)*ap;
+     c50:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c53:	8b 00                	mov    (%eax),%eax
+     c55:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     c58:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+     c5c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     c60:	75 25                	jne    c87 <printf+0xfb>
+          s = "(null)";
+     c62:	c7 45 f4 bc 18 00 00 	movl   $0x18bc,-0xc(%ebp)
+        while(*s != 0){
+     c69:	eb 1c                	jmp    c87 <printf+0xfb>
+          fputc(fd, *s);
+     c6b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c6e:	0f b6 00             	movzbl (%eax),%eax
+     c71:	0f be c0             	movsbl %al,%eax
+     c74:	83 ec 08             	sub    $0x8,%esp
+     c77:	50                   	push   %eax
+     c78:	ff 75 08             	push   0x8(%ebp)
+     c7b:	e8 f3 07 00 00       	call   1473 <fputc>
+     c80:	83 c4 10             	add    $0x10,%esp
+          s++;
+     c83:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+     c87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c8a:	0f b6 00             	movzbl (%eax),%eax
+     c8d:	84 c0                	test   %al,%al
+     c8f:	75 da                	jne    c6b <printf+0xdf>
+     c91:	eb 5a                	jmp    ced <printf+0x161>
+        }
+      } else if(c == 'c'){
+     c93:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+     c97:	75 1a                	jne    cb3 <printf+0x127>
+        fputc(fd, *ap);
+     c99:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c9c:	8b 00                	mov    (%eax),%eax
+     c9e:	83 ec 08             	sub    $0x8,%esp
+     ca1:	50                   	push   %eax
+     ca2:	ff 75 08             	push   0x8(%ebp)
+     ca5:	e8 c9 07 00 00       	call   1473 <fputc>
+     caa:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     cad:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     cb1:	eb 3a                	jmp    ced <printf+0x161>
+      } else if(c == '%'){
+     cb3:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     cb7:	75 13                	jne    ccc <printf+0x140>
+        fputc(fd, c);
+     cb9:	83 ec 08             	sub    $0x8,%esp
+     cbc:	ff 75 e4             	push   -0x1c(%ebp)
+     cbf:	ff 75 08             	push   0x8(%ebp)
+     cc2:	e8 ac 07 00 00       	call   1473 <fputc>
+     cc7:	83 c4 10             	add    $0x10,%esp
+     cca:	eb 21                	jmp    ced <printf+0x161>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        fputc(fd, '%');
+     ccc:	83 ec 08             	sub    $0x8,%esp
+     ccf:	6a 25                	push   $0x25
+     cd1:	ff 75 08             	push   0x8(%ebp)
+     cd4:	e8 9a 07 00 00       	call   1473 <fputc>
+     cd9:	83 c4 10             	add    $0x10,%esp
+        fputc(fd, c);
+     cdc:	83 ec 08             	sub    $0x8,%esp
+     cdf:	ff 75 e4             	push   -0x1c(%ebp)
+     ce2:	ff 75 08             	push   0x8(%ebp)
+     ce5:	e8 89 07 00 00       	call   1473 <fputc>
+     cea:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     ced:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     cf4:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     cf8:	8b 55 0c             	mov    0xc(%ebp),%edx
+     cfb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     cfe:	01 d0                	add    %edx,%eax
+     d00:	0f b6 00             	movzbl (%eax),%eax
+     d03:	84 c0                	test   %al,%al
+     d05:	0f 85 a3 fe ff ff    	jne    bae <printf+0x22>
+    }
+  }
+}
+     d0b:	90                   	nop
+     d0c:	90                   	nop
+     d0d:	c9                   	leave
+     d0e:	c3                   	ret
+
+00000d0f <binof>:
+static struct chunk *bins[NBIN];       // free large chunks
+static struct chunk *top;              // end marker of newest heap segment
+
+static int
+binof(uint size)
+{
+     d0f:	55                   	push   %ebp
+     d10:	89 e5                	mov    %esp,%ebp
+     d12:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  i = 0;
+     d15:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     d1c:	c1 6d 08 05          	shrl   $0x5,0x8(%ebp)
+     d20:	eb 07                	jmp    d29 <binof+0x1a>
+    i++;
+     d22:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     d26:	d1 6d 08             	shrl   0x8(%ebp)
+     d29:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     d2d:	74 06                	je     d35 <binof+0x26>
+     d2f:	83 7d fc 19          	cmpl   $0x19,-0x4(%ebp)
+     d33:	7e ed                	jle    d22 <binof+0x13>
+  return i;
+     d35:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     d38:	c9                   	leave
+     d39:	c3                   	ret
+
+00000d3a <bininsert>:
+
+static void
+bininsert(struct chunk *c)
+{
+     d3a:	55                   	push   %ebp
+     d3b:	89 e5                	mov    %esp,%ebp
+     d3d:	83 ec 10             	sub    $0x10,%esp
+  struct chunk **b;
+
+  b = &bins[binof(CSIZE(c))];
+     d40:	8b 45 08             	mov    0x8(%ebp),%eax
+     d43:	8b 00                	mov    (%eax),%eax
+     d45:	83 e0 f8             	and    $0xfffffff8,%eax
+     d48:	50                   	push   %eax
+     d49:	e8 c1 ff ff ff       	call   d0f <binof>
+     d4e:	83 c4 04             	add    $0x4,%esp
+     d51:	c1 e0 02             	shl    $0x2,%eax
+     d54:	05 00 1e 00 00       	add    $0x1e00,%eax
+     d59:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c->prev = 0;
+     d5c:	8b 45 08             	mov    0x8(%ebp),%eax
+     d5f:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  c->next = *b;
+     d66:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d69:	8b 10                	mov    (%eax),%edx
+     d6b:	8b 45 08             	mov    0x8(%ebp),%eax
+     d6e:	89 50 08             	mov    %edx,0x8(%eax)
+  if(*b)
+     d71:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d74:	8b 00                	mov    (%eax),%eax
+     d76:	85 c0                	test   %eax,%eax
+     d78:	74 0b                	je     d85 <bininsert+0x4b>
+    (*b)->prev = c;
+     d7a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d7d:	8b 00                	mov    (%eax),%eax
+     d7f:	8b 55 08             	mov    0x8(%ebp),%edx
+     d82:	89 50 0c             	mov    %edx,0xc(%eax)
+  *b = c;
+     d85:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     d88:	8b 55 08             	mov    0x8(%ebp),%edx
+     d8b:	89 10                	mov    %edx,(%eax)
+}
+     d8d:	90                   	nop
+     d8e:	c9                   	leave
+     d8f:	c3                   	ret
+
+00000d90 <binremove>:
+
+static void
+binremove(struct chunk *c)
+{
+     d90:	55                   	push   %ebp
+     d91:	89 e5                	mov    %esp,%ebp
+  if(c->prev)
+     d93:	8b 45 08             	mov    0x8(%ebp),%eax
+     d96:	8b 40 0c             	mov    0xc(%eax),%eax
+     d99:	85 c0                	test   %eax,%eax
+     d9b:	74 11                	je     dae <binremove+0x1e>
+    c->prev->next = c->next;
+     d9d:	8b 45 08             	mov    0x8(%ebp),%eax
+     da0:	8b 40 0c             	mov    0xc(%eax),%eax
+     da3:	8b 55 08             	mov    0x8(%ebp),%edx
+     da6:	8b 52 08             	mov    0x8(%edx),%edx
+     da9:	89 50 08             	mov    %edx,0x8(%eax)
+     dac:	eb 1e                	jmp    dcc <binremove+0x3c>
+  else
+    bins[binof(CSIZE(c))] = c->next;
+     dae:	8b 45 08             	mov    0x8(%ebp),%eax
+     db1:	8b 00                	mov    (%eax),%eax
+     db3:	83 e0 f8             	and    $0xfffffff8,%eax
+     db6:	50                   	push   %eax
+     db7:	e8 53 ff ff ff       	call   d0f <binof>
+     dbc:	83 c4 04             	add    $0x4,%esp
+     dbf:	8b 55 08             	mov    0x8(%ebp),%edx
+     dc2:	8b 52 08             	mov    0x8(%edx),%edx
+     dc5:	89 14 85 00 1e 00 00 	mov    %edx,0x1e00(,%eax,4)
+  if(c->next)
+     dcc:	8b 45 08             	mov    0x8(%ebp),%eax
+     dcf:	8b 40 08             	mov    0x8(%eax),%eax
+     dd2:	85 c0                	test   %eax,%eax
+     dd4:	74 0f                	je     de5 <binremove+0x55>
+    c->next->prev = c->prev;
+     dd6:	8b 45 08             	mov    0x8(%ebp),%eax
+     dd9:	8b 40 08             	mov    0x8(%eax),%eax
+     ddc:	8b 55 08             	mov    0x8(%ebp),%edx
+     ddf:	8b 52 0c             	mov    0xc(%edx),%edx
+     de2:	89 50 0c             	mov    %edx,0xc(%eax)
+}
+     de5:	90                   	nop
+     de6:	c9                   	leave
+     de7:	c3                   	ret
+
+00000de8 <freechunk>:
+
+// Free chunk c, merging it with free neighbors.  If trim is
+// set and the result is big and at the break, give it back.
+static void
+freechunk(struct chunk *c, int trim)
+{
+     de8:	55                   	push   %ebp
+     de9:	89 e5                	mov    %esp,%ebp
+     deb:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *p, *n;
+  uint size;
+
+  size = CSIZE(c);
+     dee:	8b 45 08             	mov    0x8(%ebp),%eax
+     df1:	8b 00                	mov    (%eax),%eax
+     df3:	83 e0 f8             	and    $0xfffffff8,%eax
+     df6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  n = NEXTC(c);
+     df9:	8b 45 08             	mov    0x8(%ebp),%eax
+     dfc:	8b 00                	mov    (%eax),%eax
+     dfe:	83 e0 f8             	and    $0xfffffff8,%eax
+     e01:	89 c2                	mov    %eax,%edx
+     e03:	8b 45 08             	mov    0x8(%ebp),%eax
+     e06:	01 d0                	add    %edx,%eax
+     e08:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(!(c->size & PREVUSED)){
+     e0b:	8b 45 08             	mov    0x8(%ebp),%eax
+     e0e:	8b 00                	mov    (%eax),%eax
+     e10:	83 e0 02             	and    $0x2,%eax
+     e13:	85 c0                	test   %eax,%eax
+     e15:	75 30                	jne    e47 <freechunk+0x5f>
+    p = (struct chunk*)((char*)c - *((uint*)c - 1));
+     e17:	8b 45 08             	mov    0x8(%ebp),%eax
+     e1a:	83 e8 04             	sub    $0x4,%eax
+     e1d:	8b 00                	mov    (%eax),%eax
+     e1f:	f7 d8                	neg    %eax
+     e21:	89 c2                	mov    %eax,%edx
+     e23:	8b 45 08             	mov    0x8(%ebp),%eax
+     e26:	01 d0                	add    %edx,%eax
+     e28:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    binremove(p);
+     e2b:	ff 75 ec             	push   -0x14(%ebp)
+     e2e:	e8 5d ff ff ff       	call   d90 <binremove>
+     e33:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(p);
+     e36:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     e39:	8b 00                	mov    (%eax),%eax
+     e3b:	83 e0 f8             	and    $0xfffffff8,%eax
+     e3e:	01 45 f4             	add    %eax,-0xc(%ebp)
+    c = p;
+     e41:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     e44:	89 45 08             	mov    %eax,0x8(%ebp)
+  }
+  if(!(n->size & USED)){
+     e47:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e4a:	8b 00                	mov    (%eax),%eax
+     e4c:	83 e0 01             	and    $0x1,%eax
+     e4f:	85 c0                	test   %eax,%eax
+     e51:	75 16                	jne    e69 <freechunk+0x81>
+    binremove(n);
+     e53:	ff 75 f0             	push   -0x10(%ebp)
+     e56:	e8 35 ff ff ff       	call   d90 <binremove>
+     e5b:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(n);
+     e5e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e61:	8b 00                	mov    (%eax),%eax
+     e63:	83 e0 f8             	and    $0xfffffff8,%eax
+     e66:	01 45 f4             	add    %eax,-0xc(%ebp)
+  }
+  // Free chunks are never adjacent, so the one below is in use.
+  c->size = size | PREVUSED;
+     e69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e6c:	83 c8 02             	or     $0x2,%eax
+     e6f:	89 c2                	mov    %eax,%edx
+     e71:	8b 45 08             	mov    0x8(%ebp),%eax
+     e74:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+     e76:	8b 45 08             	mov    0x8(%ebp),%eax
+     e79:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  FOOTER(c) = size;
+     e80:	8b 45 08             	mov    0x8(%ebp),%eax
+     e83:	8b 00                	mov    (%eax),%eax
+     e85:	83 e0 f8             	and    $0xfffffff8,%eax
+     e88:	8d 50 fc             	lea    -0x4(%eax),%edx
+     e8b:	8b 45 08             	mov    0x8(%ebp),%eax
+     e8e:	01 c2                	add    %eax,%edx
+     e90:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e93:	89 02                	mov    %eax,(%edx)
+  n = NEXTC(c);
+     e95:	8b 45 08             	mov    0x8(%ebp),%eax
+     e98:	8b 00                	mov    (%eax),%eax
+     e9a:	83 e0 f8             	and    $0xfffffff8,%eax
+     e9d:	89 c2                	mov    %eax,%edx
+     e9f:	8b 45 08             	mov    0x8(%ebp),%eax
+     ea2:	01 d0                	add    %edx,%eax
+     ea4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  n->size &= ~PREVUSED;
+     ea7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     eaa:	8b 00                	mov    (%eax),%eax
+     eac:	83 e0 fd             	and    $0xfffffffd,%eax
+     eaf:	89 c2                	mov    %eax,%edx
+     eb1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     eb4:	89 10                	mov    %edx,(%eax)
+
+  if(trim && n == top && size >= TRIMSIZE && sbrk(0) == (char*)top + HDRSIZE){
+     eb6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     eba:	74 51                	je     f0d <freechunk+0x125>
+     ebc:	a1 6c 1e 00 00       	mov    0x1e6c,%eax
+     ec1:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     ec4:	75 47                	jne    f0d <freechunk+0x125>
+     ec6:	81 7d f4 ff 7f 00 00 	cmpl   $0x7fff,-0xc(%ebp)
+     ecd:	76 3e                	jbe    f0d <freechunk+0x125>
+     ecf:	83 ec 0c             	sub    $0xc,%esp
+     ed2:	6a 00                	push   $0x0
+     ed4:	e8 30 fb ff ff       	call   a09 <sbrk>
+     ed9:	83 c4 10             	add    $0x10,%esp
+     edc:	8b 15 6c 1e 00 00    	mov    0x1e6c,%edx
+     ee2:	83 c2 08             	add    $0x8,%edx
+     ee5:	39 d0                	cmp    %edx,%eax
+     ee7:	75 24                	jne    f0d <freechunk+0x125>
+    c->size = USED | PREVUSED;
+     ee9:	8b 45 08             	mov    0x8(%ebp),%eax
+     eec:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+    top = c;
+     ef2:	8b 45 08             	mov    0x8(%ebp),%eax
+     ef5:	a3 6c 1e 00 00       	mov    %eax,0x1e6c
+    sbrk(-size);
+     efa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     efd:	f7 d8                	neg    %eax
+     eff:	83 ec 0c             	sub    $0xc,%esp
+     f02:	50                   	push   %eax
+     f03:	e8 01 fb ff ff       	call   a09 <sbrk>
+     f08:	83 c4 10             	add    $0x10,%esp
+    return;
+     f0b:	eb 0e                	jmp    f1b <freechunk+0x133>
+  }
+  bininsert(c);
+     f0d:	83 ec 0c             	sub    $0xc,%esp
+     f10:	ff 75 08             	push   0x8(%ebp)
+     f13:	e8 22 fe ff ff       	call   d3a <bininsert>
+     f18:	83 c4 10             	add    $0x10,%esp
+}
+     f1b:	c9                   	leave
+     f1c:	c3                   	ret
+
+00000f1d <morecore>:
+
+// Grow the heap by at least need bytes.
+static int
+morecore(uint need)
+{
+     f1d:	55                   	push   %ebp
+     f1e:	89 e5                	mov    %esp,%ebp
+     f20:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+  char *p;
+  uint n, pad;
+
+  n = need + MINCHUNK;
+     f23:	8b 45 08             	mov    0x8(%ebp),%eax
+     f26:	83 c0 18             	add    $0x18,%eax
+     f29:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(n < MINCORE)
+     f2c:	81 7d ec ff 3f 00 00 	cmpl   $0x3fff,-0x14(%ebp)
+     f33:	77 07                	ja     f3c <morecore+0x1f>
+    n = MINCORE;
+     f35:	c7 45 ec 00 40 00 00 	movl   $0x4000,-0x14(%ebp)
+  // Keep the break 8-aligned, with the end marker just below it.
+  pad = (8 - ((uint)sbrk(0) & 7)) & 7;
+     f3c:	83 ec 0c             	sub    $0xc,%esp
+     f3f:	6a 00                	push   $0x0
+     f41:	e8 c3 fa ff ff       	call   a09 <sbrk>
+     f46:	83 c4 10             	add    $0x10,%esp
+     f49:	83 e0 07             	and    $0x7,%eax
+     f4c:	ba 08 00 00 00       	mov    $0x8,%edx
+     f51:	29 c2                	sub    %eax,%edx
+     f53:	89 d0                	mov    %edx,%eax
+     f55:	83 e0 07             	and    $0x7,%eax
+     f58:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if((p = sbrk(pad + n)) == (char*)-1){
+     f5b:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     f5e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f61:	01 d0                	add    %edx,%eax
+     f63:	83 ec 0c             	sub    $0xc,%esp
+     f66:	50                   	push   %eax
+     f67:	e8 9d fa ff ff       	call   a09 <sbrk>
+     f6c:	83 c4 10             	add    $0x10,%esp
+     f6f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f72:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     f76:	75 30                	jne    fa8 <morecore+0x8b>
+    n = need + MINCHUNK;
+     f78:	8b 45 08             	mov    0x8(%ebp),%eax
+     f7b:	83 c0 18             	add    $0x18,%eax
+     f7e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((p = sbrk(pad + n)) == (char*)-1)
+     f81:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     f84:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f87:	01 d0                	add    %edx,%eax
+     f89:	83 ec 0c             	sub    $0xc,%esp
+     f8c:	50                   	push   %eax
+     f8d:	e8 77 fa ff ff       	call   a09 <sbrk>
+     f92:	83 c4 10             	add    $0x10,%esp
+     f95:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f98:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     f9c:	75 0a                	jne    fa8 <morecore+0x8b>
+      return -1;
+     f9e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     fa3:	e9 8e 00 00 00       	jmp    1036 <morecore+0x119>
+  }
+  p += pad;
+     fa8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     fab:	01 45 f0             	add    %eax,-0x10(%ebp)
+  if(top && p == (char*)top + HDRSIZE){
+     fae:	a1 6c 1e 00 00       	mov    0x1e6c,%eax
+     fb3:	85 c0                	test   %eax,%eax
+     fb5:	74 29                	je     fe0 <morecore+0xc3>
+     fb7:	a1 6c 1e 00 00       	mov    0x1e6c,%eax
+     fbc:	83 c0 08             	add    $0x8,%eax
+     fbf:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     fc2:	75 1c                	jne    fe0 <morecore+0xc3>
+    // Contiguous: the old end marker heads the new chunk.
+    c = top;
+     fc4:	a1 6c 1e 00 00       	mov    0x1e6c,%eax
+     fc9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = n | (c->size & PREVUSED);
+     fcc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fcf:	8b 00                	mov    (%eax),%eax
+     fd1:	83 e0 02             	and    $0x2,%eax
+     fd4:	0b 45 ec             	or     -0x14(%ebp),%eax
+     fd7:	89 c2                	mov    %eax,%edx
+     fd9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fdc:	89 10                	mov    %edx,(%eax)
+     fde:	eb 16                	jmp    ff6 <morecore+0xd9>
+  } else {
+    // Someone else moved the break: start a new segment.
+    c = (struct chunk*)p;
+     fe0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     fe3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = (n - HDRSIZE) | PREVUSED;
+     fe6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fe9:	83 e8 08             	sub    $0x8,%eax
+     fec:	83 c8 02             	or     $0x2,%eax
+     fef:	89 c2                	mov    %eax,%edx
+     ff1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ff4:	89 10                	mov    %edx,(%eax)
+  }
+  top = NEXTC(c);
+     ff6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ff9:	8b 00                	mov    (%eax),%eax
+     ffb:	83 e0 f8             	and    $0xfffffff8,%eax
+     ffe:	89 c2                	mov    %eax,%edx
+    1000:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1003:	01 d0                	add    %edx,%eax
+    1005:	a3 6c 1e 00 00       	mov    %eax,0x1e6c
+  top->size = USED;
+    100a:	a1 6c 1e 00 00       	mov    0x1e6c,%eax
+    100f:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  top->tag = LARGE;
+    1015:	a1 6c 1e 00 00       	mov    0x1e6c,%eax
+    101a:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  freechunk(c, 0);
+    1021:	83 ec 08             	sub    $0x8,%esp
+    1024:	6a 00                	push   $0x0
+    1026:	ff 75 f4             	push   -0xc(%ebp)
+    1029:	e8 ba fd ff ff       	call   de8 <freechunk>
+    102e:	83 c4 10             	add    $0x10,%esp
+  return 0;
+    1031:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1036:	c9                   	leave
+    1037:	c3                   	ret
+
+00001038 <largealloc>:
+
+static void*
+largealloc(uint nbytes)
+{
+    1038:	55                   	push   %ebp
+    1039:	89 e5                	mov    %esp,%ebp
+    103b:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c, *r;
+  uint need;
+  int i;
+
+  if(nbytes > 0x7fffffff)
+    103e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1041:	85 c0                	test   %eax,%eax
+    1043:	79 0a                	jns    104f <largealloc+0x17>
+    return 0;
+    1045:	b8 00 00 00 00       	mov    $0x0,%eax
+    104a:	e9 43 01 00 00       	jmp    1192 <largealloc+0x15a>
+  need = (nbytes + HDRSIZE + 7) & ~7;
+    104f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1052:	83 c0 0f             	add    $0xf,%eax
+    1055:	83 e0 f8             	and    $0xfffffff8,%eax
+    1058:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(need < MINCHUNK)
+    105b:	83 7d f0 17          	cmpl   $0x17,-0x10(%ebp)
+    105f:	77 07                	ja     1068 <largealloc+0x30>
+    need = MINCHUNK;
+    1061:	c7 45 f0 18 00 00 00 	movl   $0x18,-0x10(%ebp)
+  for(;;){
+    for(i = binof(need); i < NBIN; i++)
+    1068:	ff 75 f0             	push   -0x10(%ebp)
+    106b:	e8 9f fc ff ff       	call   d0f <binof>
+    1070:	83 c4 04             	add    $0x4,%esp
+    1073:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1076:	eb 2f                	jmp    10a7 <largealloc+0x6f>
+      for(c = bins[i]; c; c = c->next)
+    1078:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    107b:	8b 04 85 00 1e 00 00 	mov    0x1e00(,%eax,4),%eax
+    1082:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1085:	eb 16                	jmp    109d <largealloc+0x65>
+        if(CSIZE(c) >= need)
+    1087:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    108a:	8b 00                	mov    (%eax),%eax
+    108c:	83 e0 f8             	and    $0xfffffff8,%eax
+    108f:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+    1092:	73 35                	jae    10c9 <largealloc+0x91>
+      for(c = bins[i]; c; c = c->next)
+    1094:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1097:	8b 40 08             	mov    0x8(%eax),%eax
+    109a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    109d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    10a1:	75 e4                	jne    1087 <largealloc+0x4f>
+    for(i = binof(need); i < NBIN; i++)
+    10a3:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    10a7:	83 7d ec 1a          	cmpl   $0x1a,-0x14(%ebp)
+    10ab:	7e cb                	jle    1078 <largealloc+0x40>
+          goto found;
+    if(morecore(need) < 0)
+    10ad:	83 ec 0c             	sub    $0xc,%esp
+    10b0:	ff 75 f0             	push   -0x10(%ebp)
+    10b3:	e8 65 fe ff ff       	call   f1d <morecore>
+    10b8:	83 c4 10             	add    $0x10,%esp
+    10bb:	85 c0                	test   %eax,%eax
+    10bd:	79 a9                	jns    1068 <largealloc+0x30>
+      return 0;
+    10bf:	b8 00 00 00 00       	mov    $0x0,%eax
+    10c4:	e9 c9 00 00 00       	jmp    1192 <largealloc+0x15a>
+          goto found;
+    10c9:	90                   	nop
+  }
+
+found:
+  binremove(c);
+    10ca:	83 ec 0c             	sub    $0xc,%esp
+    10cd:	ff 75 f4             	push   -0xc(%ebp)
+    10d0:	e8 bb fc ff ff       	call   d90 <binremove>
+    10d5:	83 c4 10             	add    $0x10,%esp
+  if(CSIZE(c) - need >= MINCHUNK){
+    10d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10db:	8b 00                	mov    (%eax),%eax
+    10dd:	83 e0 f8             	and    $0xfffffff8,%eax
+    10e0:	2b 45 f0             	sub    -0x10(%ebp),%eax
+    10e3:	83 f8 17             	cmp    $0x17,%eax
+    10e6:	76 66                	jbe    114e <largealloc+0x116>
+    r = (struct chunk*)((char*)c + need);
+    10e8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    10eb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    10ee:	01 d0                	add    %edx,%eax
+    10f0:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    r->size = (CSIZE(c) - need) | PREVUSED;
+    10f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10f6:	8b 00                	mov    (%eax),%eax
+    10f8:	83 e0 f8             	and    $0xfffffff8,%eax
+    10fb:	2b 45 f0             	sub    -0x10(%ebp),%eax
+    10fe:	83 c8 02             	or     $0x2,%eax
+    1101:	89 c2                	mov    %eax,%edx
+    1103:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1106:	89 10                	mov    %edx,(%eax)
+    r->tag = LARGE;
+    1108:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    110b:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+    FOOTER(r) = CSIZE(r);
+    1112:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1115:	8b 10                	mov    (%eax),%edx
+    1117:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    111a:	8b 00                	mov    (%eax),%eax
+    111c:	83 e0 f8             	and    $0xfffffff8,%eax
+    111f:	8d 48 fc             	lea    -0x4(%eax),%ecx
+    1122:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1125:	01 c8                	add    %ecx,%eax
+    1127:	83 e2 f8             	and    $0xfffffff8,%edx
+    112a:	89 10                	mov    %edx,(%eax)
+    bininsert(r);
+    112c:	83 ec 0c             	sub    $0xc,%esp
+    112f:	ff 75 e8             	push   -0x18(%ebp)
+    1132:	e8 03 fc ff ff       	call   d3a <bininsert>
+    1137:	83 c4 10             	add    $0x10,%esp
+    c->size = need | (c->size & PREVUSED);
+    113a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    113d:	8b 00                	mov    (%eax),%eax
+    113f:	83 e0 02             	and    $0x2,%eax
+    1142:	0b 45 f0             	or     -0x10(%ebp),%eax
+    1145:	89 c2                	mov    %eax,%edx
+    1147:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    114a:	89 10                	mov    %edx,(%eax)
+    114c:	eb 25                	jmp    1173 <largealloc+0x13b>
+  } else
+    NEXTC(c)->size |= PREVUSED;
+    114e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1151:	8b 00                	mov    (%eax),%eax
+    1153:	83 e0 f8             	and    $0xfffffff8,%eax
+    1156:	89 c2                	mov    %eax,%edx
+    1158:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    115b:	01 d0                	add    %edx,%eax
+    115d:	8b 10                	mov    (%eax),%edx
+    115f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1162:	8b 00                	mov    (%eax),%eax
+    1164:	83 e0 f8             	and    $0xfffffff8,%eax
+    1167:	89 c1                	mov    %eax,%ecx
+    1169:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    116c:	01 c8                	add    %ecx,%eax
+    116e:	83 ca 02             	or     $0x2,%edx
+    1171:	89 10                	mov    %edx,(%eax)
+  c->size |= USED;
+    1173:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1176:	8b 00                	mov    (%eax),%eax
+    1178:	83 c8 01             	or     $0x1,%eax
+    117b:	89 c2                	mov    %eax,%edx
+    117d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1180:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+    1182:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1185:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  return (char*)c + HDRSIZE;
+    118c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    118f:	83 c0 08             	add    $0x8,%eax
+}
+    1192:	c9                   	leave
+    1193:	c3                   	ret
+
+00001194 <refill>:
+
+// Carve a slab into free blocks of class k.
+static int
+refill(int k)
+{
+    1194:	55                   	push   %ebp
+    1195:	89 e5                	mov    %esp,%ebp
+    1197:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  char *p;
+  uint bs, i;
+
+  if((p = largealloc(SLABSIZE)) == 0)
+    119a:	83 ec 0c             	sub    $0xc,%esp
+    119d:	68 00 20 00 00       	push   $0x2000
+    11a2:	e8 91 fe ff ff       	call   1038 <largealloc>
+    11a7:	83 c4 10             	add    $0x10,%esp
+    11aa:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    11ad:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    11b1:	75 07                	jne    11ba <refill+0x26>
+    return -1;
+    11b3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    11b8:	eb 75                	jmp    122f <refill+0x9b>
+  bs = HDRSIZE + (MINSMALL << k);
+    11ba:	8b 45 08             	mov    0x8(%ebp),%eax
+    11bd:	ba 10 00 00 00       	mov    $0x10,%edx
+    11c2:	89 c1                	mov    %eax,%ecx
+    11c4:	d3 e2                	shl    %cl,%edx
+    11c6:	89 d0                	mov    %edx,%eax
+    11c8:	83 c0 08             	add    $0x8,%eax
+    11cb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+    11ce:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    11d5:	eb 44                	jmp    121b <refill+0x87>
+    b = (struct chunk*)(p + i);
+    11d7:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    11da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11dd:	01 d0                	add    %edx,%eax
+    11df:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    b->size = bs | USED;
+    11e2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    11e5:	83 c8 01             	or     $0x1,%eax
+    11e8:	89 c2                	mov    %eax,%edx
+    11ea:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    11ed:	89 10                	mov    %edx,(%eax)
+    b->tag = k;
+    11ef:	8b 55 08             	mov    0x8(%ebp),%edx
+    11f2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    11f5:	89 50 04             	mov    %edx,0x4(%eax)
+    b->next = classes[k];
+    11f8:	8b 45 08             	mov    0x8(%ebp),%eax
+    11fb:	8b 14 85 e0 1d 00 00 	mov    0x1de0(,%eax,4),%edx
+    1202:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1205:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[k] = b;
+    1208:	8b 45 08             	mov    0x8(%ebp),%eax
+    120b:	8b 55 e8             	mov    -0x18(%ebp),%edx
+    120e:	89 14 85 e0 1d 00 00 	mov    %edx,0x1de0(,%eax,4)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+    1215:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1218:	01 45 f4             	add    %eax,-0xc(%ebp)
+    121b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    121e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1221:	01 d0                	add    %edx,%eax
+    1223:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    1228:	76 ad                	jbe    11d7 <refill+0x43>
+  }
+  return 0;
+    122a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    122f:	c9                   	leave
+    1230:	c3                   	ret
+
+00001231 <free>:
+
+void
+free(void *ap)
+{
+    1231:	55                   	push   %ebp
+    1232:	89 e5                	mov    %esp,%ebp
+    1234:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+
+  if(ap == 0)
+    1237:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    123b:	74 4b                	je     1288 <free+0x57>
+    return;
+  c = (struct chunk*)((char*)ap - HDRSIZE);
+    123d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1240:	83 e8 08             	sub    $0x8,%eax
+    1243:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(c->tag != LARGE){
+    1246:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1249:	8b 40 04             	mov    0x4(%eax),%eax
+    124c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    124f:	74 25                	je     1276 <free+0x45>
+    c->next = classes[c->tag];
+    1251:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1254:	8b 40 04             	mov    0x4(%eax),%eax
+    1257:	8b 14 85 e0 1d 00 00 	mov    0x1de0(,%eax,4),%edx
+    125e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1261:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[c->tag] = c;
+    1264:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1267:	8b 40 04             	mov    0x4(%eax),%eax
+    126a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    126d:	89 14 85 e0 1d 00 00 	mov    %edx,0x1de0(,%eax,4)
+    return;
+    1274:	eb 13                	jmp    1289 <free+0x58>
+  }
+  freechunk(c, 1);
+    1276:	83 ec 08             	sub    $0x8,%esp
+    1279:	6a 01                	push   $0x1
+    127b:	ff 75 f4             	push   -0xc(%ebp)
+    127e:	e8 65 fb ff ff       	call   de8 <freechunk>
+    1283:	83 c4 10             	add    $0x10,%esp
+    1286:	eb 01                	jmp    1289 <free+0x58>
+    return;
+    1288:	90                   	nop
+}
+    1289:	c9                   	leave
+    128a:	c3                   	ret
+
+0000128b <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    128b:	55                   	push   %ebp
+    128c:	89 e5                	mov    %esp,%ebp
+    128e:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  int k;
+
+  if(nbytes > MAXSMALL)
+    1291:	81 7d 08 00 08 00 00 	cmpl   $0x800,0x8(%ebp)
+    1298:	76 10                	jbe    12aa <malloc+0x1f>
+    return largealloc(nbytes);
+    129a:	83 ec 0c             	sub    $0xc,%esp
+    129d:	ff 75 08             	push   0x8(%ebp)
+    12a0:	e8 93 fd ff ff       	call   1038 <largealloc>
+    12a5:	83 c4 10             	add    $0x10,%esp
+    12a8:	eb 6a                	jmp    1314 <malloc+0x89>
+  for(k = 0; (MINSMALL << k) < nbytes; k++)
+    12aa:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    12b1:	eb 04                	jmp    12b7 <malloc+0x2c>
+    12b3:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    12b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12ba:	ba 10 00 00 00       	mov    $0x10,%edx
+    12bf:	89 c1                	mov    %eax,%ecx
+    12c1:	d3 e2                	shl    %cl,%edx
+    12c3:	89 d0                	mov    %edx,%eax
+    12c5:	3b 45 08             	cmp    0x8(%ebp),%eax
+    12c8:	72 e9                	jb     12b3 <malloc+0x28>
+    ;
+  if(classes[k] == 0 && refill(k) < 0)
+    12ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12cd:	8b 04 85 e0 1d 00 00 	mov    0x1de0(,%eax,4),%eax
+    12d4:	85 c0                	test   %eax,%eax
+    12d6:	75 19                	jne    12f1 <malloc+0x66>
+    12d8:	83 ec 0c             	sub    $0xc,%esp
+    12db:	ff 75 f4             	push   -0xc(%ebp)
+    12de:	e8 b1 fe ff ff       	call   1194 <refill>
+    12e3:	83 c4 10             	add    $0x10,%esp
+    12e6:	85 c0                	test   %eax,%eax
+    12e8:	79 07                	jns    12f1 <malloc+0x66>
+    return 0;
+    12ea:	b8 00 00 00 00       	mov    $0x0,%eax
+    12ef:	eb 23                	jmp    1314 <malloc+0x89>
+  b = classes[k];
+    12f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12f4:	8b 04 85 e0 1d 00 00 	mov    0x1de0(,%eax,4),%eax
+    12fb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  classes[k] = b->next;
+    12fe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1301:	8b 50 08             	mov    0x8(%eax),%edx
+    1304:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1307:	89 14 85 e0 1d 00 00 	mov    %edx,0x1de0(,%eax,4)
+  return (char*)b + HDRSIZE;
+    130e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1311:	83 c0 08             	add    $0x8,%eax
+}
+    1314:	c9                   	leave
+    1315:	c3                   	ret
+
+00001316 <stream>:
+
+// Return the stream for fd, deciding on first use how
+// its output is buffered.  Returns 0 if fd is not open.
+static struct stream*
+stream(int fd)
+{
+    1316:	55                   	push   %ebp
+    1317:	89 e5                	mov    %esp,%ebp
+    1319:	83 ec 28             	sub    $0x28,%esp
+  struct stream *s;
+  struct stat st;
+
+  if(fd < 0 || fd >= NOFILE)
+    131c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1320:	78 06                	js     1328 <stream+0x12>
+    1322:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    1326:	7e 07                	jle    132f <stream+0x19>
+    return 0;
+    1328:	b8 00 00 00 00       	mov    $0x0,%eax
+    132d:	eb 55                	jmp    1384 <stream+0x6e>
+  s = &streams[fd];
+    132f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1332:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1338:	05 80 1e 00 00       	add    $0x1e80,%eax
+    133d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(s->mode == UNKNOWN){
+    1340:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1343:	8b 00                	mov    (%eax),%eax
+    1345:	85 c0                	test   %eax,%eax
+    1347:	75 38                	jne    1381 <stream+0x6b>
+    if(fstat(fd, &st) < 0)
+    1349:	83 ec 08             	sub    $0x8,%esp
+    134c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    134f:	50                   	push   %eax
+    1350:	ff 75 08             	push   0x8(%ebp)
+    1353:	e8 57 f6 ff ff       	call   9af <fstat>
+    1358:	83 c4 10             	add    $0x10,%esp
+    135b:	85 c0                	test   %eax,%eax
+    135d:	79 07                	jns    1366 <stream+0x50>
+      return 0;
+    135f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1364:	eb 1e                	jmp    1384 <stream+0x6e>
+    s->mode = st.type == T_DEV ? LINEBUF : FULLBUF;
+    1366:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+    136a:	66 83 f8 03          	cmp    $0x3,%ax
+    136e:	75 07                	jne    1377 <stream+0x61>
+    1370:	ba 01 00 00 00       	mov    $0x1,%edx
+    1375:	eb 05                	jmp    137c <stream+0x66>
+    1377:	ba 02 00 00 00       	mov    $0x2,%edx
+    137c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    137f:	89 10                	mov    %edx,(%eax)
+  }
+  return s;
+    1381:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1384:	c9                   	leave
+    1385:	c3                   	ret
+
+00001386 <fflush>:
+
+int
+fflush(int fd)
+{
+    1386:	55                   	push   %ebp
+    1387:	89 e5                	mov    %esp,%ebp
+    1389:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  int i, n;
+
+  if(fd < 0 || fd >= NOFILE)
+    138c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1390:	78 06                	js     1398 <fflush+0x12>
+    1392:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    1396:	7e 07                	jle    139f <fflush+0x19>
+    return -1;
+    1398:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    139d:	eb 78                	jmp    1417 <fflush+0x91>
+  s = &streams[fd];
+    139f:	8b 45 08             	mov    0x8(%ebp),%eax
+    13a2:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    13a8:	05 80 1e 00 00       	add    $0x1e80,%eax
+    13ad:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < s->nout; i += n){
+    13b0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    13b7:	eb 44                	jmp    13fd <fflush+0x77>
+    if((n = write(fd, s->out + i, s->nout - i)) <= 0){
+    13b9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    13bc:	8b 40 04             	mov    0x4(%eax),%eax
+    13bf:	2b 45 f4             	sub    -0xc(%ebp),%eax
+    13c2:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    13c5:	8d 4a 10             	lea    0x10(%edx),%ecx
+    13c8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    13cb:	01 ca                	add    %ecx,%edx
+    13cd:	83 ec 04             	sub    $0x4,%esp
+    13d0:	50                   	push   %eax
+    13d1:	52                   	push   %edx
+    13d2:	ff 75 08             	push   0x8(%ebp)
+    13d5:	e8 6c f5 ff ff       	call   946 <write>
+    13da:	83 c4 10             	add    $0x10,%esp
+    13dd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    13e0:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    13e4:	7f 11                	jg     13f7 <fflush+0x71>
+      s->nout = 0;
+    13e6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    13e9:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+      return -1;
+    13f0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    13f5:	eb 20                	jmp    1417 <fflush+0x91>
+  for(i = 0; i < s->nout; i += n){
+    13f7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    13fa:	01 45 f4             	add    %eax,-0xc(%ebp)
+    13fd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1400:	8b 40 04             	mov    0x4(%eax),%eax
+    1403:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    1406:	7c b1                	jl     13b9 <fflush+0x33>
+    }
+  }
+  s->nout = 0;
+    1408:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    140b:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  return 0;
+    1412:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1417:	c9                   	leave
+    1418:	c3                   	ret
+
+00001419 <flushall>:
+
+// Flush every stream, or only line-buffered ones.
+static void
+flushall(int lineonly)
+{
+    1419:	55                   	push   %ebp
+    141a:	89 e5                	mov    %esp,%ebp
+    141c:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+    141f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1426:	eb 41                	jmp    1469 <flushall+0x50>
+    if(streams[fd].nout > 0 && (!lineonly || streams[fd].mode == LINEBUF))
+    1428:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    142b:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1431:	05 84 1e 00 00       	add    $0x1e84,%eax
+    1436:	8b 00                	mov    (%eax),%eax
+    1438:	85 c0                	test   %eax,%eax
+    143a:	7e 29                	jle    1465 <flushall+0x4c>
+    143c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1440:	74 15                	je     1457 <flushall+0x3e>
+    1442:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1445:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    144b:	05 80 1e 00 00       	add    $0x1e80,%eax
+    1450:	8b 00                	mov    (%eax),%eax
+    1452:	83 f8 01             	cmp    $0x1,%eax
+    1455:	75 0e                	jne    1465 <flushall+0x4c>
+      fflush(fd);
+    1457:	83 ec 0c             	sub    $0xc,%esp
+    145a:	ff 75 f4             	push   -0xc(%ebp)
+    145d:	e8 24 ff ff ff       	call   1386 <fflush>
+    1462:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++)
+    1465:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1469:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+    146d:	7e b9                	jle    1428 <flushall+0xf>
+}
+    146f:	90                   	nop
+    1470:	90                   	nop
+    1471:	c9                   	leave
+    1472:	c3                   	ret
+
+00001473 <fputc>:
+
+int
+fputc(int fd, int c)
+{
+    1473:	55                   	push   %ebp
+    1474:	89 e5                	mov    %esp,%ebp
+    1476:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  char ch;
+
+  if((s = stream(fd)) == 0){
+    1479:	83 ec 0c             	sub    $0xc,%esp
+    147c:	ff 75 08             	push   0x8(%ebp)
+    147f:	e8 92 fe ff ff       	call   1316 <stream>
+    1484:	83 c4 10             	add    $0x10,%esp
+    1487:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    148a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    148e:	75 2e                	jne    14be <fputc+0x4b>
+    ch = c;
+    1490:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1493:	88 45 f3             	mov    %al,-0xd(%ebp)
+    return write(fd, &ch, 1) == 1 ? (uchar)c : -1;
+    1496:	83 ec 04             	sub    $0x4,%esp
+    1499:	6a 01                	push   $0x1
+    149b:	8d 45 f3             	lea    -0xd(%ebp),%eax
+    149e:	50                   	push   %eax
+    149f:	ff 75 08             	push   0x8(%ebp)
+    14a2:	e8 9f f4 ff ff       	call   946 <write>
+    14a7:	83 c4 10             	add    $0x10,%esp
+    14aa:	83 f8 01             	cmp    $0x1,%eax
+    14ad:	75 08                	jne    14b7 <fputc+0x44>
+    14af:	8b 45 0c             	mov    0xc(%ebp),%eax
+    14b2:	0f b6 c0             	movzbl %al,%eax
+    14b5:	eb 5e                	jmp    1515 <fputc+0xa2>
+    14b7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    14bc:	eb 57                	jmp    1515 <fputc+0xa2>
+  }
+  s->out[s->nout++] = c;
+    14be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14c1:	8b 40 04             	mov    0x4(%eax),%eax
+    14c4:	8d 48 01             	lea    0x1(%eax),%ecx
+    14c7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    14ca:	89 4a 04             	mov    %ecx,0x4(%edx)
+    14cd:	8b 55 0c             	mov    0xc(%ebp),%edx
+    14d0:	89 d1                	mov    %edx,%ecx
+    14d2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    14d5:	88 4c 02 10          	mov    %cl,0x10(%edx,%eax,1)
+  if(s->nout == BUFSZ || (s->mode == LINEBUF && c == '\n'))
+    14d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14dc:	8b 40 04             	mov    0x4(%eax),%eax
+    14df:	3d 00 02 00 00       	cmp    $0x200,%eax
+    14e4:	74 10                	je     14f6 <fputc+0x83>
+    14e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14e9:	8b 00                	mov    (%eax),%eax
+    14eb:	83 f8 01             	cmp    $0x1,%eax
+    14ee:	75 1f                	jne    150f <fputc+0x9c>
+    14f0:	83 7d 0c 0a          	cmpl   $0xa,0xc(%ebp)
+    14f4:	75 19                	jne    150f <fputc+0x9c>
+    if(fflush(fd) < 0)
+    14f6:	83 ec 0c             	sub    $0xc,%esp
+    14f9:	ff 75 08             	push   0x8(%ebp)
+    14fc:	e8 85 fe ff ff       	call   1386 <fflush>
+    1501:	83 c4 10             	add    $0x10,%esp
+    1504:	85 c0                	test   %eax,%eax
+    1506:	79 07                	jns    150f <fputc+0x9c>
+      return -1;
+    1508:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    150d:	eb 06                	jmp    1515 <fputc+0xa2>
+  return (uchar)c;
+    150f:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1512:	0f b6 c0             	movzbl %al,%eax
+}
+    1515:	c9                   	leave
+    1516:	c3                   	ret
+
+00001517 <fgetc>:
+
+// Return the next byte read from fd, or -1 at end of file.
+int
+fgetc(int fd)
+{
+    1517:	55                   	push   %ebp
+    1518:	89 e5                	mov    %esp,%ebp
+    151a:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  uchar c;
+  int n;
+
+  if((s = stream(fd)) == 0){
+    151d:	83 ec 0c             	sub    $0xc,%esp
+    1520:	ff 75 08             	push   0x8(%ebp)
+    1523:	e8 ee fd ff ff       	call   1316 <stream>
+    1528:	83 c4 10             	add    $0x10,%esp
+    152b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    152e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1532:	75 39                	jne    156d <fgetc+0x56>
+    flushall(1);
+    1534:	83 ec 0c             	sub    $0xc,%esp
+    1537:	6a 01                	push   $0x1
+    1539:	e8 db fe ff ff       	call   1419 <flushall>
+    153e:	83 c4 10             	add    $0x10,%esp
+    return read(fd, &c, 1) == 1 ? c : -1;
+    1541:	83 ec 04             	sub    $0x4,%esp
+    1544:	6a 01                	push   $0x1
+    1546:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    1549:	50                   	push   %eax
+    154a:	ff 75 08             	push   0x8(%ebp)
+    154d:	e8 e5 f3 ff ff       	call   937 <read>
+    1552:	83 c4 10             	add    $0x10,%esp
+    1555:	83 f8 01             	cmp    $0x1,%eax
+    1558:	75 0c                	jne    1566 <fgetc+0x4f>
+    155a:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    155e:	0f b6 c0             	movzbl %al,%eax
+    1561:	e9 80 00 00 00       	jmp    15e6 <fgetc+0xcf>
+    1566:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    156b:	eb 79                	jmp    15e6 <fgetc+0xcf>
+  }
+  if(s->rpos == s->rend){
+    156d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1570:	8b 50 08             	mov    0x8(%eax),%edx
+    1573:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1576:	8b 40 0c             	mov    0xc(%eax),%eax
+    1579:	39 c2                	cmp    %eax,%edx
+    157b:	75 4c                	jne    15c9 <fgetc+0xb2>
+    flushall(1);
+    157d:	83 ec 0c             	sub    $0xc,%esp
+    1580:	6a 01                	push   $0x1
+    1582:	e8 92 fe ff ff       	call   1419 <flushall>
+    1587:	83 c4 10             	add    $0x10,%esp
+    if((n = read(fd, s->in, BUFSZ)) <= 0)
+    158a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    158d:	05 10 02 00 00       	add    $0x210,%eax
+    1592:	83 ec 04             	sub    $0x4,%esp
+    1595:	68 00 02 00 00       	push   $0x200
+    159a:	50                   	push   %eax
+    159b:	ff 75 08             	push   0x8(%ebp)
+    159e:	e8 94 f3 ff ff       	call   937 <read>
+    15a3:	83 c4 10             	add    $0x10,%esp
+    15a6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    15a9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    15ad:	7f 07                	jg     15b6 <fgetc+0x9f>
+      return -1;
+    15af:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    15b4:	eb 30                	jmp    15e6 <fgetc+0xcf>
+    s->rpos = 0;
+    15b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15b9:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+    s->rend = n;
+    15c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15c3:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    15c6:	89 50 0c             	mov    %edx,0xc(%eax)
+  }
+  return (uchar)s->in[s->rpos++];
+    15c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15cc:	8b 40 08             	mov    0x8(%eax),%eax
+    15cf:	8d 48 01             	lea    0x1(%eax),%ecx
+    15d2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    15d5:	89 4a 08             	mov    %ecx,0x8(%edx)
+    15d8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    15db:	0f b6 84 02 10 02 00 	movzbl 0x210(%edx,%eax,1),%eax
+    15e2:	00 
+    15e3:	0f b6 c0             	movzbl %al,%eax
+}
+    15e6:	c9                   	leave
+    15e7:	c3                   	ret
+
+000015e8 <fork>:
+
+int
+fork(void)
+{
+    15e8:	55                   	push   %ebp
+    15e9:	89 e5                	mov    %esp,%ebp
+    15eb:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    15ee:	83 ec 0c             	sub    $0xc,%esp
+    15f1:	6a 00                	push   $0x0
+    15f3:	e8 21 fe ff ff       	call   1419 <flushall>
+    15f8:	83 c4 10             	add    $0x10,%esp
+  return _fork();
+    15fb:	e8 fb f2 ff ff       	call   8fb <_fork>
+}
+    1600:	c9                   	leave
+    1601:	c3                   	ret
+
+00001602 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+    1602:	55                   	push   %ebp
+    1603:	89 e5                	mov    %esp,%ebp
+    1605:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1608:	83 ec 0c             	sub    $0xc,%esp
+    160b:	6a 00                	push   $0x0
+    160d:	e8 07 fe ff ff       	call   1419 <flushall>
+    1612:	83 c4 10             	add    $0x10,%esp
+  return _exec(path, argv);
+    1615:	83 ec 08             	sub    $0x8,%esp
+    1618:	ff 75 0c             	push   0xc(%ebp)
+    161b:	ff 75 08             	push   0x8(%ebp)
+    161e:	e8 50 f3 ff ff       	call   973 <_exec>
+    1623:	83 c4 10             	add    $0x10,%esp
+}
+    1626:	c9                   	leave
+    1627:	c3                   	ret
+
+00001628 <exit>:
+
+int
+exit(void)
+{
+    1628:	55                   	push   %ebp
+    1629:	89 e5                	mov    %esp,%ebp
+    162b:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    162e:	83 ec 0c             	sub    $0xc,%esp
+    1631:	6a 00                	push   $0x0
+    1633:	e8 e1 fd ff ff       	call   1419 <flushall>
+    1638:	83 c4 10             	add    $0x10,%esp
+  _exit();
+    163b:	e8 ca f2 ff ff       	call   90a <_exit>
+
+00001640 <close>:
+}
+
+int
+close(int fd)
+{
+    1640:	55                   	push   %ebp
+    1641:	89 e5                	mov    %esp,%ebp
+    1643:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+
+  if(fd >= 0 && fd < NOFILE){
+    1646:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    164a:	78 44                	js     1690 <close+0x50>
+    164c:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    1650:	7f 3e                	jg     1690 <close+0x50>
+    fflush(fd);
+    1652:	83 ec 0c             	sub    $0xc,%esp
+    1655:	ff 75 08             	push   0x8(%ebp)
+    1658:	e8 29 fd ff ff       	call   1386 <fflush>
+    165d:	83 c4 10             	add    $0x10,%esp
+    s = &streams[fd];
+    1660:	8b 45 08             	mov    0x8(%ebp),%eax
+    1663:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1669:	05 80 1e 00 00       	add    $0x1e80,%eax
+    166e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    s->mode = UNKNOWN;
+    1671:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1674:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    s->rpos = s->rend = 0;
+    167a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    167d:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    1684:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1687:	8b 50 0c             	mov    0xc(%eax),%edx
+    168a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    168d:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  return _close(fd);
+    1690:	83 ec 0c             	sub    $0xc,%esp
+    1693:	ff 75 08             	push   0x8(%ebp)
+    1696:	e8 ba f2 ff ff       	call   955 <_close>
+    169b:	83 c4 10             	add    $0x10,%esp
+}
+    169e:	c9                   	leave
+    169f:	c3                   	ret
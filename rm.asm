@@ -0,0 +1,2617 @@
+
+_rm:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	53                   	push   %ebx
+       e:	51                   	push   %ecx
+       f:	83 ec 10             	sub    $0x10,%esp
+      12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 2){
+      14:	83 3b 01             	cmpl   $0x1,(%ebx)
+      17:	7f 17                	jg     30 <main+0x30>
+    printf(2, "Usage: rm files...\n");
+      19:	83 ec 08             	sub    $0x8,%esp
+      1c:	68 12 14 00 00       	push   $0x1412
+      21:	6a 02                	push   $0x2
+      23:	e8 d6 08 00 00       	call   8fe <printf>
+      28:	83 c4 10             	add    $0x10,%esp
+    exit();
+      2b:	e8 6a 13 00 00       	call   139a <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+      30:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+      37:	eb 4b                	jmp    84 <main+0x84>
+    if(unlink(argv[i]) < 0){
+      39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      3c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+      43:	8b 43 04             	mov    0x4(%ebx),%eax
+      46:	01 d0                	add    %edx,%eax
+      48:	8b 00                	mov    (%eax),%eax
+      4a:	83 ec 0c             	sub    $0xc,%esp
+      4d:	50                   	push   %eax
+      4e:	e8 bf 06 00 00       	call   712 <unlink>
+      53:	83 c4 10             	add    $0x10,%esp
+      56:	85 c0                	test   %eax,%eax
+      58:	79 26                	jns    80 <main+0x80>
+      printf(2, "rm: %s failed to delete\n", argv[i]);
+      5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      5d:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+      64:	8b 43 04             	mov    0x4(%ebx),%eax
+      67:	01 d0                	add    %edx,%eax
+      69:	8b 00                	mov    (%eax),%eax
+      6b:	83 ec 04             	sub    $0x4,%esp
+      6e:	50                   	push   %eax
+      6f:	68 26 14 00 00       	push   $0x1426
+      74:	6a 02                	push   $0x2
+      76:	e8 83 08 00 00       	call   8fe <printf>
+      7b:	83 c4 10             	add    $0x10,%esp
+      break;
+      7e:	eb 0b                	jmp    8b <main+0x8b>
+  for(i = 1; i < argc; i++){
+      80:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+      84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      87:	3b 03                	cmp    (%ebx),%eax
+      89:	7c ae                	jl     39 <main+0x39>
+    }
+  }
+
+  exit();
+      8b:	e8 0a 13 00 00       	call   139a <exit>
+
+00000090 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+      90:	55                   	push   %ebp
+      91:	89 e5                	mov    %esp,%ebp
+      93:	57                   	push   %edi
+      94:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+      95:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      98:	8b 55 10             	mov    0x10(%ebp),%edx
+      9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+      9e:	89 cb                	mov    %ecx,%ebx
+      a0:	89 df                	mov    %ebx,%edi
+      a2:	89 d1                	mov    %edx,%ecx
+      a4:	fc                   	cld
+      a5:	f3 aa                	rep stos %al,%es:(%edi)
+      a7:	89 ca                	mov    %ecx,%edx
+      a9:	89 fb                	mov    %edi,%ebx
+      ab:	89 5d 08             	mov    %ebx,0x8(%ebp)
+      ae:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+      b1:	90                   	nop
+      b2:	5b                   	pop    %ebx
+      b3:	5f                   	pop    %edi
+      b4:	5d                   	pop    %ebp
+      b5:	c3                   	ret
+
+000000b6 <stosl>:
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+      b6:	55                   	push   %ebp
+      b7:	89 e5                	mov    %esp,%ebp
+      b9:	57                   	push   %edi
+      ba:	53                   	push   %ebx
+  asm volatile("cld; rep stosl" :
+      bb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      be:	8b 55 10             	mov    0x10(%ebp),%edx
+      c1:	8b 45 0c             	mov    0xc(%ebp),%eax
+      c4:	89 cb                	mov    %ecx,%ebx
+      c6:	89 df                	mov    %ebx,%edi
+      c8:	89 d1                	mov    %edx,%ecx
+      ca:	fc                   	cld
+      cb:	f3 ab                	rep stos %eax,%es:(%edi)
+      cd:	89 ca                	mov    %ecx,%edx
+      cf:	89 fb                	mov    %edi,%ebx
+      d1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+      d4:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+      d7:	90                   	nop
+      d8:	5b                   	pop    %ebx
+      d9:	5f                   	pop    %edi
+      da:	5d                   	pop    %ebp
+      db:	c3                   	ret
+
+000000dc <movsb>:
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+      dc:	55                   	push   %ebp
+      dd:	89 e5                	mov    %esp,%ebp
+      df:	57                   	push   %edi
+      e0:	56                   	push   %esi
+      e1:	53                   	push   %ebx
+  asm volatile("cld; rep movsb" :
+      e2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      e5:	8b 55 0c             	mov    0xc(%ebp),%edx
+      e8:	8b 45 10             	mov    0x10(%ebp),%eax
+      eb:	89 cb                	mov    %ecx,%ebx
+      ed:	89 df                	mov    %ebx,%edi
+      ef:	89 d6                	mov    %edx,%esi
+      f1:	89 c1                	mov    %eax,%ecx
+      f3:	fc                   	cld
+      f4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+      f6:	89 c8                	mov    %ecx,%eax
+      f8:	89 f2                	mov    %esi,%edx
+      fa:	89 fb                	mov    %edi,%ebx
+      fc:	89 5d 08             	mov    %ebx,0x8(%ebp)
+      ff:	89 55 0c             	mov    %edx,0xc(%ebp)
+     102:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     105:	90                   	nop
+     106:	5b                   	pop    %ebx
+     107:	5e                   	pop    %esi
+     108:	5f                   	pop    %edi
+     109:	5d                   	pop    %ebp
+     10a:	c3                   	ret
+
+0000010b <movsl>:
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+     10b:	55                   	push   %ebp
+     10c:	89 e5                	mov    %esp,%ebp
+     10e:	57                   	push   %edi
+     10f:	56                   	push   %esi
+     110:	53                   	push   %ebx
+  asm volatile("cld; rep movsl" :
+     111:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     114:	8b 55 0c             	mov    0xc(%ebp),%edx
+     117:	8b 45 10             	mov    0x10(%ebp),%eax
+     11a:	89 cb                	mov    %ecx,%ebx
+     11c:	89 df                	mov    %ebx,%edi
+     11e:	89 d6                	mov    %edx,%esi
+     120:	89 c1                	mov    %eax,%ecx
+     122:	fc                   	cld
+     123:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     125:	89 c8                	mov    %ecx,%eax
+     127:	89 f2                	mov    %esi,%edx
+     129:	89 fb                	mov    %edi,%ebx
+     12b:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     12e:	89 55 0c             	mov    %edx,0xc(%ebp)
+     131:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     134:	90                   	nop
+     135:	5b                   	pop    %ebx
+     136:	5e                   	pop    %esi
+     137:	5f                   	pop    %edi
+     138:	5d                   	pop    %ebp
+     139:	c3                   	ret
+
+0000013a <strcpy>:
+#define ONES        0x01010101
+#define HASZERO(x)  (((x) - ONES) & ~(x) & (ONES << 7))
+
+char*
+strcpy(char *s, char *t)
+{
+     13a:	55                   	push   %ebp
+     13b:	89 e5                	mov    %esp,%ebp
+     13d:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+     140:	8b 45 08             	mov    0x8(%ebp),%eax
+     143:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     146:	90                   	nop
+     147:	8b 55 0c             	mov    0xc(%ebp),%edx
+     14a:	8d 42 01             	lea    0x1(%edx),%eax
+     14d:	89 45 0c             	mov    %eax,0xc(%ebp)
+     150:	8b 45 08             	mov    0x8(%ebp),%eax
+     153:	8d 48 01             	lea    0x1(%eax),%ecx
+     156:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     159:	0f b6 12             	movzbl (%edx),%edx
+     15c:	88 10                	mov    %dl,(%eax)
+     15e:	0f b6 00             	movzbl (%eax),%eax
+     161:	84 c0                	test   %al,%al
+     163:	75 e2                	jne    147 <strcpy+0xd>
+    ;
+  return os;
+     165:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     168:	c9                   	leave
+     169:	c3                   	ret
+
+0000016a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     16a:	55                   	push   %ebp
+     16b:	89 e5                	mov    %esp,%ebp
+  // Aligned words never straddle a page, so reading
+  // whole ones past the end of a string is safe.
+  if((((uint)p | (uint)q) & 3) == 0)
+     16d:	8b 55 08             	mov    0x8(%ebp),%edx
+     170:	8b 45 0c             	mov    0xc(%ebp),%eax
+     173:	09 d0                	or     %edx,%eax
+     175:	83 e0 03             	and    $0x3,%eax
+     178:	85 c0                	test   %eax,%eax
+     17a:	75 3f                	jne    1bb <strcmp+0x51>
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     17c:	eb 08                	jmp    186 <strcmp+0x1c>
+      p += 4, q += 4;
+     17e:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     182:	83 45 0c 04          	addl   $0x4,0xc(%ebp)
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     186:	8b 45 08             	mov    0x8(%ebp),%eax
+     189:	8b 10                	mov    (%eax),%edx
+     18b:	8b 45 0c             	mov    0xc(%ebp),%eax
+     18e:	8b 00                	mov    (%eax),%eax
+     190:	39 c2                	cmp    %eax,%edx
+     192:	75 27                	jne    1bb <strcmp+0x51>
+     194:	8b 45 08             	mov    0x8(%ebp),%eax
+     197:	8b 00                	mov    (%eax),%eax
+     199:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     19f:	8b 45 08             	mov    0x8(%ebp),%eax
+     1a2:	8b 00                	mov    (%eax),%eax
+     1a4:	f7 d0                	not    %eax
+     1a6:	21 d0                	and    %edx,%eax
+     1a8:	25 80 80 80 80       	and    $0x80808080,%eax
+     1ad:	85 c0                	test   %eax,%eax
+     1af:	74 cd                	je     17e <strcmp+0x14>
+  while(*p && *p == *q)
+     1b1:	eb 08                	jmp    1bb <strcmp+0x51>
+    p++, q++;
+     1b3:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     1b7:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     1bb:	8b 45 08             	mov    0x8(%ebp),%eax
+     1be:	0f b6 00             	movzbl (%eax),%eax
+     1c1:	84 c0                	test   %al,%al
+     1c3:	74 10                	je     1d5 <strcmp+0x6b>
+     1c5:	8b 45 08             	mov    0x8(%ebp),%eax
+     1c8:	0f b6 10             	movzbl (%eax),%edx
+     1cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+     1ce:	0f b6 00             	movzbl (%eax),%eax
+     1d1:	38 c2                	cmp    %al,%dl
+     1d3:	74 de                	je     1b3 <strcmp+0x49>
+  return (uchar)*p - (uchar)*q;
+     1d5:	8b 45 08             	mov    0x8(%ebp),%eax
+     1d8:	0f b6 00             	movzbl (%eax),%eax
+     1db:	0f b6 d0             	movzbl %al,%edx
+     1de:	8b 45 0c             	mov    0xc(%ebp),%eax
+     1e1:	0f b6 00             	movzbl (%eax),%eax
+     1e4:	0f b6 c0             	movzbl %al,%eax
+     1e7:	29 c2                	sub    %eax,%edx
+     1e9:	89 d0                	mov    %edx,%eax
+}
+     1eb:	5d                   	pop    %ebp
+     1ec:	c3                   	ret
+
+000001ed <strlen>:
+
+uint
+strlen(char *s)
+{
+     1ed:	55                   	push   %ebp
+     1ee:	89 e5                	mov    %esp,%ebp
+     1f0:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; ((uint)(s+n) & 3) && s[n]; n++)
+     1f3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     1fa:	eb 04                	jmp    200 <strlen+0x13>
+     1fc:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     200:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     203:	8b 45 08             	mov    0x8(%ebp),%eax
+     206:	01 d0                	add    %edx,%eax
+     208:	83 e0 03             	and    $0x3,%eax
+     20b:	85 c0                	test   %eax,%eax
+     20d:	74 0f                	je     21e <strlen+0x31>
+     20f:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     212:	8b 45 08             	mov    0x8(%ebp),%eax
+     215:	01 d0                	add    %edx,%eax
+     217:	0f b6 00             	movzbl (%eax),%eax
+     21a:	84 c0                	test   %al,%al
+     21c:	75 de                	jne    1fc <strlen+0xf>
+    ;
+  if(s[n])
+     21e:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     221:	8b 45 08             	mov    0x8(%ebp),%eax
+     224:	01 d0                	add    %edx,%eax
+     226:	0f b6 00             	movzbl (%eax),%eax
+     229:	84 c0                	test   %al,%al
+     22b:	74 33                	je     260 <strlen+0x73>
+    while(!HASZERO(*(uint*)(s+n)))
+     22d:	eb 04                	jmp    233 <strlen+0x46>
+      n += 4;
+     22f:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+    while(!HASZERO(*(uint*)(s+n)))
+     233:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     236:	8b 45 08             	mov    0x8(%ebp),%eax
+     239:	01 d0                	add    %edx,%eax
+     23b:	8b 00                	mov    (%eax),%eax
+     23d:	8d 88 ff fe fe fe    	lea    -0x1010101(%eax),%ecx
+     243:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     246:	8b 45 08             	mov    0x8(%ebp),%eax
+     249:	01 d0                	add    %edx,%eax
+     24b:	8b 00                	mov    (%eax),%eax
+     24d:	f7 d0                	not    %eax
+     24f:	21 c8                	and    %ecx,%eax
+     251:	25 80 80 80 80       	and    $0x80808080,%eax
+     256:	85 c0                	test   %eax,%eax
+     258:	74 d5                	je     22f <strlen+0x42>
+  for(; s[n]; n++)
+     25a:	eb 04                	jmp    260 <strlen+0x73>
+     25c:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     260:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     263:	8b 45 08             	mov    0x8(%ebp),%eax
+     266:	01 d0                	add    %edx,%eax
+     268:	0f b6 00             	movzbl (%eax),%eax
+     26b:	84 c0                	test   %al,%al
+     26d:	75 ed                	jne    25c <strlen+0x6f>
+    ;
+  return n;
+     26f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     272:	c9                   	leave
+     273:	c3                   	ret
+
+00000274 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     274:	55                   	push   %ebp
+     275:	89 e5                	mov    %esp,%ebp
+     277:	83 ec 10             	sub    $0x10,%esp
+  char *d;
+  uint k;
+
+  d = dst;
+     27a:	8b 45 08             	mov    0x8(%ebp),%eax
+     27d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c &= 0xFF;
+     280:	81 65 0c ff 00 00 00 	andl   $0xff,0xc(%ebp)
+  if(n >= 16){
+     287:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     28b:	76 54                	jbe    2e1 <memset+0x6d>
+    k = -(uint)d & 3;  // bytes up to a word boundary
+     28d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     290:	f7 d8                	neg    %eax
+     292:	83 e0 03             	and    $0x3,%eax
+     295:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    stosb(d, c, k);
+     298:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     29b:	50                   	push   %eax
+     29c:	ff 75 0c             	push   0xc(%ebp)
+     29f:	ff 75 fc             	push   -0x4(%ebp)
+     2a2:	e8 e9 fd ff ff       	call   90 <stosb>
+     2a7:	83 c4 0c             	add    $0xc,%esp
+    d += k;
+     2aa:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     2ad:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n -= k;
+     2b0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     2b3:	29 45 10             	sub    %eax,0x10(%ebp)
+    stosl(d, c*ONES, n/4);
+     2b6:	8b 45 10             	mov    0x10(%ebp),%eax
+     2b9:	c1 e8 02             	shr    $0x2,%eax
+     2bc:	89 c2                	mov    %eax,%edx
+     2be:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2c1:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     2c7:	52                   	push   %edx
+     2c8:	50                   	push   %eax
+     2c9:	ff 75 fc             	push   -0x4(%ebp)
+     2cc:	e8 e5 fd ff ff       	call   b6 <stosl>
+     2d1:	83 c4 0c             	add    $0xc,%esp
+    d += n & ~3;
+     2d4:	8b 45 10             	mov    0x10(%ebp),%eax
+     2d7:	83 e0 fc             	and    $0xfffffffc,%eax
+     2da:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n &= 3;
+     2dd:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+  }
+  stosb(d, c, n);
+     2e1:	8b 45 10             	mov    0x10(%ebp),%eax
+     2e4:	50                   	push   %eax
+     2e5:	ff 75 0c             	push   0xc(%ebp)
+     2e8:	ff 75 fc             	push   -0x4(%ebp)
+     2eb:	e8 a0 fd ff ff       	call   90 <stosb>
+     2f0:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     2f3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     2f6:	c9                   	leave
+     2f7:	c3                   	ret
+
+000002f8 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     2f8:	55                   	push   %ebp
+     2f9:	89 e5                	mov    %esp,%ebp
+     2fb:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s1, *s2;
+
+  s1 = v1;
+     2fe:	8b 45 08             	mov    0x8(%ebp),%eax
+     301:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s2 = v2;
+     304:	8b 45 0c             	mov    0xc(%ebp),%eax
+     307:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     30a:	eb 0c                	jmp    318 <memcmp+0x20>
+    s1 += 4, s2 += 4, n -= 4;
+     30c:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+     310:	83 45 f8 04          	addl   $0x4,-0x8(%ebp)
+     314:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     318:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     31c:	76 3e                	jbe    35c <memcmp+0x64>
+     31e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     321:	8b 10                	mov    (%eax),%edx
+     323:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     326:	8b 00                	mov    (%eax),%eax
+     328:	39 c2                	cmp    %eax,%edx
+     32a:	74 e0                	je     30c <memcmp+0x14>
+  while(n-- > 0){
+     32c:	eb 2e                	jmp    35c <memcmp+0x64>
+    if(*s1 != *s2)
+     32e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     331:	0f b6 10             	movzbl (%eax),%edx
+     334:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     337:	0f b6 00             	movzbl (%eax),%eax
+     33a:	38 c2                	cmp    %al,%dl
+     33c:	74 16                	je     354 <memcmp+0x5c>
+      return *s1 - *s2;
+     33e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     341:	0f b6 00             	movzbl (%eax),%eax
+     344:	0f b6 d0             	movzbl %al,%edx
+     347:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     34a:	0f b6 00             	movzbl (%eax),%eax
+     34d:	0f b6 c0             	movzbl %al,%eax
+     350:	29 c2                	sub    %eax,%edx
+     352:	eb 1a                	jmp    36e <memcmp+0x76>
+    s1++, s2++;
+     354:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     358:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+  while(n-- > 0){
+     35c:	8b 45 10             	mov    0x10(%ebp),%eax
+     35f:	8d 50 ff             	lea    -0x1(%eax),%edx
+     362:	89 55 10             	mov    %edx,0x10(%ebp)
+     365:	85 c0                	test   %eax,%eax
+     367:	75 c5                	jne    32e <memcmp+0x36>
+  }
+  return 0;
+     369:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+     36e:	89 d0                	mov    %edx,%eax
+     370:	c9                   	leave
+     371:	c3                   	ret
+
+00000372 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     372:	55                   	push   %ebp
+     373:	89 e5                	mov    %esp,%ebp
+     375:	83 ec 14             	sub    $0x14,%esp
+     378:	8b 45 0c             	mov    0xc(%ebp),%eax
+     37b:	88 45 ec             	mov    %al,-0x14(%ebp)
+  uint w, cc;
+
+  // Skip whole words holding neither c nor the terminator.
+  for(; ((uint)s & 3) && *s; s++)
+     37e:	eb 17                	jmp    397 <strchr+0x25>
+    if(*s == c)
+     380:	8b 45 08             	mov    0x8(%ebp),%eax
+     383:	0f b6 00             	movzbl (%eax),%eax
+     386:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     389:	75 08                	jne    393 <strchr+0x21>
+      return (char*)s;
+     38b:	8b 45 08             	mov    0x8(%ebp),%eax
+     38e:	e9 ad 00 00 00       	jmp    440 <strchr+0xce>
+  for(; ((uint)s & 3) && *s; s++)
+     393:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     397:	8b 45 08             	mov    0x8(%ebp),%eax
+     39a:	83 e0 03             	and    $0x3,%eax
+     39d:	85 c0                	test   %eax,%eax
+     39f:	74 0a                	je     3ab <strchr+0x39>
+     3a1:	8b 45 08             	mov    0x8(%ebp),%eax
+     3a4:	0f b6 00             	movzbl (%eax),%eax
+     3a7:	84 c0                	test   %al,%al
+     3a9:	75 d5                	jne    380 <strchr+0xe>
+  cc = (uchar)c * ONES;
+     3ab:	0f b6 45 ec          	movzbl -0x14(%ebp),%eax
+     3af:	0f b6 c0             	movzbl %al,%eax
+     3b2:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     3b8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(*s)
+     3bb:	8b 45 08             	mov    0x8(%ebp),%eax
+     3be:	0f b6 00             	movzbl (%eax),%eax
+     3c1:	84 c0                	test   %al,%al
+     3c3:	74 6c                	je     431 <strchr+0xbf>
+    for(; w = *(uint*)s, !HASZERO(w) && !HASZERO(w ^ cc); s += 4)
+     3c5:	eb 04                	jmp    3cb <strchr+0x59>
+     3c7:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     3cb:	8b 45 08             	mov    0x8(%ebp),%eax
+     3ce:	8b 00                	mov    (%eax),%eax
+     3d0:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     3d3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3d6:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     3dc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3df:	f7 d0                	not    %eax
+     3e1:	21 d0                	and    %edx,%eax
+     3e3:	25 80 80 80 80       	and    $0x80808080,%eax
+     3e8:	85 c0                	test   %eax,%eax
+     3ea:	75 26                	jne    412 <strchr+0xa0>
+     3ec:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3ef:	33 45 fc             	xor    -0x4(%ebp),%eax
+     3f2:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     3f8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3fb:	33 45 fc             	xor    -0x4(%ebp),%eax
+     3fe:	f7 d0                	not    %eax
+     400:	21 d0                	and    %edx,%eax
+     402:	25 80 80 80 80       	and    $0x80808080,%eax
+     407:	85 c0                	test   %eax,%eax
+     409:	75 07                	jne    412 <strchr+0xa0>
+     40b:	b8 01 00 00 00       	mov    $0x1,%eax
+     410:	eb 05                	jmp    417 <strchr+0xa5>
+     412:	b8 00 00 00 00       	mov    $0x0,%eax
+     417:	85 c0                	test   %eax,%eax
+     419:	75 ac                	jne    3c7 <strchr+0x55>
+      ;
+  for(; *s; s++)
+     41b:	eb 14                	jmp    431 <strchr+0xbf>
+    if(*s == c)
+     41d:	8b 45 08             	mov    0x8(%ebp),%eax
+     420:	0f b6 00             	movzbl (%eax),%eax
+     423:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     426:	75 05                	jne    42d <strchr+0xbb>
+      return (char*)s;
+     428:	8b 45 08             	mov    0x8(%ebp),%eax
+     42b:	eb 13                	jmp    440 <strchr+0xce>
+  for(; *s; s++)
+     42d:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     431:	8b 45 08             	mov    0x8(%ebp),%eax
+     434:	0f b6 00             	movzbl (%eax),%eax
+     437:	84 c0                	test   %al,%al
+     439:	75 e2                	jne    41d <strchr+0xab>
+  return 0;
+     43b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     440:	c9                   	leave
+     441:	c3                   	ret
+
+00000442 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     442:	55                   	push   %ebp
+     443:	89 e5                	mov    %esp,%ebp
+     445:	83 ec 18             	sub    $0x18,%esp
+  int i, c;
+
+  for(i=0; i+1 < max; ){
+     448:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     44f:	eb 37                	jmp    488 <gets+0x46>
+    c = fgetc(0);
+     451:	83 ec 0c             	sub    $0xc,%esp
+     454:	6a 00                	push   $0x0
+     456:	e8 2e 0e 00 00       	call   1289 <fgetc>
+     45b:	83 c4 10             	add    $0x10,%esp
+     45e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(c < 0)
+     461:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     465:	78 2e                	js     495 <gets+0x53>
+      break;
+    buf[i++] = c;
+     467:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     46a:	8d 50 01             	lea    0x1(%eax),%edx
+     46d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     470:	89 c2                	mov    %eax,%edx
+     472:	8b 45 08             	mov    0x8(%ebp),%eax
+     475:	01 d0                	add    %edx,%eax
+     477:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     47a:	88 10                	mov    %dl,(%eax)
+    if(c == '\n' || c == '\r')
+     47c:	83 7d f0 0a          	cmpl   $0xa,-0x10(%ebp)
+     480:	74 14                	je     496 <gets+0x54>
+     482:	83 7d f0 0d          	cmpl   $0xd,-0x10(%ebp)
+     486:	74 0e                	je     496 <gets+0x54>
+  for(i=0; i+1 < max; ){
+     488:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     48b:	83 c0 01             	add    $0x1,%eax
+     48e:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     491:	7f be                	jg     451 <gets+0xf>
+     493:	eb 01                	jmp    496 <gets+0x54>
+      break;
+     495:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     496:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     499:	8b 45 08             	mov    0x8(%ebp),%eax
+     49c:	01 d0                	add    %edx,%eax
+     49e:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     4a1:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     4a4:	c9                   	leave
+     4a5:	c3                   	ret
+
+000004a6 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     4a6:	55                   	push   %ebp
+     4a7:	89 e5                	mov    %esp,%ebp
+     4a9:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     4ac:	83 ec 08             	sub    $0x8,%esp
+     4af:	6a 00                	push   $0x0
+     4b1:	ff 75 08             	push   0x8(%ebp)
+     4b4:	e8 3b 02 00 00       	call   6f4 <open>
+     4b9:	83 c4 10             	add    $0x10,%esp
+     4bc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     4bf:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     4c3:	79 07                	jns    4cc <stat+0x26>
+    return -1;
+     4c5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     4ca:	eb 25                	jmp    4f1 <stat+0x4b>
+  r = fstat(fd, st);
+     4cc:	83 ec 08             	sub    $0x8,%esp
+     4cf:	ff 75 0c             	push   0xc(%ebp)
+     4d2:	ff 75 f4             	push   -0xc(%ebp)
+     4d5:	e8 47 02 00 00       	call   721 <fstat>
+     4da:	83 c4 10             	add    $0x10,%esp
+     4dd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     4e0:	83 ec 0c             	sub    $0xc,%esp
+     4e3:	ff 75 f4             	push   -0xc(%ebp)
+     4e6:	e8 c7 0e 00 00       	call   13b2 <close>
+     4eb:	83 c4 10             	add    $0x10,%esp
+  return r;
+     4ee:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     4f1:	c9                   	leave
+     4f2:	c3                   	ret
+
+000004f3 <atoi>:
+
+int
+atoi(const char *s)
+{
+     4f3:	55                   	push   %ebp
+     4f4:	89 e5                	mov    %esp,%ebp
+     4f6:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     4f9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     500:	eb 25                	jmp    527 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     502:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     505:	89 d0                	mov    %edx,%eax
+     507:	c1 e0 02             	shl    $0x2,%eax
+     50a:	01 d0                	add    %edx,%eax
+     50c:	01 c0                	add    %eax,%eax
+     50e:	89 c1                	mov    %eax,%ecx
+     510:	8b 45 08             	mov    0x8(%ebp),%eax
+     513:	8d 50 01             	lea    0x1(%eax),%edx
+     516:	89 55 08             	mov    %edx,0x8(%ebp)
+     519:	0f b6 00             	movzbl (%eax),%eax
+     51c:	0f be c0             	movsbl %al,%eax
+     51f:	01 c8                	add    %ecx,%eax
+     521:	83 e8 30             	sub    $0x30,%eax
+     524:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     527:	8b 45 08             	mov    0x8(%ebp),%eax
+     52a:	0f b6 00             	movzbl (%eax),%eax
+     52d:	3c 2f                	cmp    $0x2f,%al
+     52f:	7e 0a                	jle    53b <atoi+0x48>
+     531:	8b 45 08             	mov    0x8(%ebp),%eax
+     534:	0f b6 00             	movzbl (%eax),%eax
+     537:	3c 39                	cmp    $0x39,%al
+     539:	7e c7                	jle    502 <atoi+0xf>
+  return n;
+     53b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     53e:	c9                   	leave
+     53f:	c3                   	ret
+
+00000540 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     540:	55                   	push   %ebp
+     541:	89 e5                	mov    %esp,%ebp
+     543:	83 ec 10             	sub    $0x10,%esp
+  char *d, *s;
+  int k;
+
+  if(n <= 0)
+     546:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     54a:	7f 08                	jg     554 <memmove+0x14>
+    return vdst;
+     54c:	8b 45 08             	mov    0x8(%ebp),%eax
+     54f:	e9 17 01 00 00       	jmp    66b <memmove+0x12b>
+  d = vdst;
+     554:	8b 45 08             	mov    0x8(%ebp),%eax
+     557:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s = vsrc;
+     55a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     55d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  if(s < d && s + n > d){
+     560:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     563:	3b 45 fc             	cmp    -0x4(%ebp),%eax
+     566:	0f 83 84 00 00 00    	jae    5f0 <memmove+0xb0>
+     56c:	8b 55 10             	mov    0x10(%ebp),%edx
+     56f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     572:	01 d0                	add    %edx,%eax
+     574:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     577:	73 77                	jae    5f0 <memmove+0xb0>
+    s += n;
+     579:	8b 45 10             	mov    0x10(%ebp),%eax
+     57c:	01 45 f8             	add    %eax,-0x8(%ebp)
+    d += n;
+     57f:	8b 45 10             	mov    0x10(%ebp),%eax
+     582:	01 45 fc             	add    %eax,-0x4(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     585:	eb 17                	jmp    59e <memmove+0x5e>
+      *--d = *--s, n--;
+     587:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     58b:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     58f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     592:	0f b6 10             	movzbl (%eax),%edx
+     595:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     598:	88 10                	mov    %dl,(%eax)
+     59a:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     59e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     5a2:	7e 22                	jle    5c6 <memmove+0x86>
+     5a4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     5a7:	83 e0 03             	and    $0x3,%eax
+     5aa:	85 c0                	test   %eax,%eax
+     5ac:	75 d9                	jne    587 <memmove+0x47>
+    for(; n >= 4; n -= 4){
+     5ae:	eb 16                	jmp    5c6 <memmove+0x86>
+      d -= 4;
+     5b0:	83 6d fc 04          	subl   $0x4,-0x4(%ebp)
+      s -= 4;
+     5b4:	83 6d f8 04          	subl   $0x4,-0x8(%ebp)
+      *(uint*)d = *(uint*)s;
+     5b8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     5bb:	8b 10                	mov    (%eax),%edx
+     5bd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     5c0:	89 10                	mov    %edx,(%eax)
+    for(; n >= 4; n -= 4){
+     5c2:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+     5c6:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     5ca:	7f e4                	jg     5b0 <memmove+0x70>
+    }
+    while(n-- > 0)
+     5cc:	eb 13                	jmp    5e1 <memmove+0xa1>
+      *--d = *--s;
+     5ce:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     5d2:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     5d6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     5d9:	0f b6 10             	movzbl (%eax),%edx
+     5dc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     5df:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+     5e1:	8b 45 10             	mov    0x10(%ebp),%eax
+     5e4:	8d 50 ff             	lea    -0x1(%eax),%edx
+     5e7:	89 55 10             	mov    %edx,0x10(%ebp)
+     5ea:	85 c0                	test   %eax,%eax
+     5ec:	7f e0                	jg     5ce <memmove+0x8e>
+  if(s < d && s + n > d){
+     5ee:	eb 78                	jmp    668 <memmove+0x128>
+  } else {
+    if(n >= 16){
+     5f0:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     5f4:	7e 61                	jle    657 <memmove+0x117>
+      k = -(uint)d & 3;
+     5f6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     5f9:	f7 d8                	neg    %eax
+     5fb:	83 e0 03             	and    $0x3,%eax
+     5fe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      movsb(d, s, k);
+     601:	ff 75 f4             	push   -0xc(%ebp)
+     604:	ff 75 f8             	push   -0x8(%ebp)
+     607:	ff 75 fc             	push   -0x4(%ebp)
+     60a:	e8 cd fa ff ff       	call   dc <movsb>
+     60f:	83 c4 0c             	add    $0xc,%esp
+      d += k;
+     612:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     615:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += k;
+     618:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     61b:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n -= k;
+     61e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     621:	29 45 10             	sub    %eax,0x10(%ebp)
+      movsl(d, s, n/4);
+     624:	8b 45 10             	mov    0x10(%ebp),%eax
+     627:	8d 50 03             	lea    0x3(%eax),%edx
+     62a:	85 c0                	test   %eax,%eax
+     62c:	0f 48 c2             	cmovs  %edx,%eax
+     62f:	c1 f8 02             	sar    $0x2,%eax
+     632:	50                   	push   %eax
+     633:	ff 75 f8             	push   -0x8(%ebp)
+     636:	ff 75 fc             	push   -0x4(%ebp)
+     639:	e8 cd fa ff ff       	call   10b <movsl>
+     63e:	83 c4 0c             	add    $0xc,%esp
+      d += n & ~3;
+     641:	8b 45 10             	mov    0x10(%ebp),%eax
+     644:	83 e0 fc             	and    $0xfffffffc,%eax
+     647:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += n & ~3;
+     64a:	8b 45 10             	mov    0x10(%ebp),%eax
+     64d:	83 e0 fc             	and    $0xfffffffc,%eax
+     650:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n &= 3;
+     653:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+    }
+    movsb(d, s, n);
+     657:	ff 75 10             	push   0x10(%ebp)
+     65a:	ff 75 f8             	push   -0x8(%ebp)
+     65d:	ff 75 fc             	push   -0x4(%ebp)
+     660:	e8 77 fa ff ff       	call   dc <movsb>
+     665:	83 c4 0c             	add    $0xc,%esp
+  }
+  return vdst;
+     668:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     66b:	c9                   	leave
+     66c:	c3                   	ret
+
+0000066d <_fork>:
+    movl %esp, %ecx; \
+    movl $1f, %edx; \
+    sysenter; \
+  1: ret
+
+RAWSYSCALL(fork)
+     66d:	b8 01 00 00 00       	mov    $0x1,%eax
+     672:	89 e1                	mov    %esp,%ecx
+     674:	ba 7b 06 00 00       	mov    $0x67b,%edx
+     679:	0f 34                	sysenter
+     67b:	c3                   	ret
+
+0000067c <_exit>:
+RAWSYSCALL(exit)
+     67c:	b8 02 00 00 00       	mov    $0x2,%eax
+     681:	89 e1                	mov    %esp,%ecx
+     683:	ba 8a 06 00 00       	mov    $0x68a,%edx
+     688:	0f 34                	sysenter
+     68a:	c3                   	ret
+
+0000068b <wait>:
+SYSCALL(wait)
+     68b:	b8 03 00 00 00       	mov    $0x3,%eax
+     690:	89 e1                	mov    %esp,%ecx
+     692:	ba 99 06 00 00       	mov    $0x699,%edx
+     697:	0f 34                	sysenter
+     699:	c3                   	ret
+
+0000069a <pipe>:
+SYSCALL(pipe)
+     69a:	b8 04 00 00 00       	mov    $0x4,%eax
+     69f:	89 e1                	mov    %esp,%ecx
+     6a1:	ba a8 06 00 00       	mov    $0x6a8,%edx
+     6a6:	0f 34                	sysenter
+     6a8:	c3                   	ret
+
+000006a9 <read>:
+SYSCALL(read)
+     6a9:	b8 05 00 00 00       	mov    $0x5,%eax
+     6ae:	89 e1                	mov    %esp,%ecx
+     6b0:	ba b7 06 00 00       	mov    $0x6b7,%edx
+     6b5:	0f 34                	sysenter
+     6b7:	c3                   	ret
+
+000006b8 <write>:
+SYSCALL(write)
+     6b8:	b8 10 00 00 00       	mov    $0x10,%eax
+     6bd:	89 e1                	mov    %esp,%ecx
+     6bf:	ba c6 06 00 00       	mov    $0x6c6,%edx
+     6c4:	0f 34                	sysenter
+     6c6:	c3                   	ret
+
+000006c7 <_close>:
+RAWSYSCALL(close)
+     6c7:	b8 15 00 00 00       	mov    $0x15,%eax
+     6cc:	89 e1                	mov    %esp,%ecx
+     6ce:	ba d5 06 00 00       	mov    $0x6d5,%edx
+     6d3:	0f 34                	sysenter
+     6d5:	c3                   	ret
+
+000006d6 <kill>:
+SYSCALL(kill)
+     6d6:	b8 06 00 00 00       	mov    $0x6,%eax
+     6db:	89 e1                	mov    %esp,%ecx
+     6dd:	ba e4 06 00 00       	mov    $0x6e4,%edx
+     6e2:	0f 34                	sysenter
+     6e4:	c3                   	ret
+
+000006e5 <_exec>:
+RAWSYSCALL(exec)
+     6e5:	b8 07 00 00 00       	mov    $0x7,%eax
+     6ea:	89 e1                	mov    %esp,%ecx
+     6ec:	ba f3 06 00 00       	mov    $0x6f3,%edx
+     6f1:	0f 34                	sysenter
+     6f3:	c3                   	ret
+
+000006f4 <open>:
+SYSCALL(open)
+     6f4:	b8 0f 00 00 00       	mov    $0xf,%eax
+     6f9:	89 e1                	mov    %esp,%ecx
+     6fb:	ba 02 07 00 00       	mov    $0x702,%edx
+     700:	0f 34                	sysenter
+     702:	c3                   	ret
+
+00000703 <mknod>:
+SYSCALL(mknod)
+     703:	b8 11 00 00 00       	mov    $0x11,%eax
+     708:	89 e1                	mov    %esp,%ecx
+     70a:	ba 11 07 00 00       	mov    $0x711,%edx
+     70f:	0f 34                	sysenter
+     711:	c3                   	ret
+
+00000712 <unlink>:
+SYSCALL(unlink)
+     712:	b8 12 00 00 00       	mov    $0x12,%eax
+     717:	89 e1                	mov    %esp,%ecx
+     719:	ba 20 07 00 00       	mov    $0x720,%edx
+     71e:	0f 34                	sysenter
+     720:	c3                   	ret
+
+00000721 <fstat>:
+SYSCALL(fstat)
+     721:	b8 08 00 00 00       	mov    $0x8,%eax
+     726:	89 e1                	mov    %esp,%ecx
+     728:	ba 2f 07 00 00       	mov    $0x72f,%edx
+     72d:	0f 34                	sysenter
+     72f:	c3                   	ret
+
+00000730 <link>:
+SYSCALL(link)
+     730:	b8 13 00 00 00       	mov    $0x13,%eax
+     735:	89 e1                	mov    %esp,%ecx
+     737:	ba 3e 07 00 00       	mov    $0x73e,%edx
+     73c:	0f 34                	sysenter
+     73e:	c3                   	ret
+
+0000073f <mkdir>:
+SYSCALL(mkdir)
+     73f:	b8 14 00 00 00       	mov    $0x14,%eax
+     744:	89 e1                	mov    %esp,%ecx
+     746:	ba 4d 07 00 00       	mov    $0x74d,%edx
+     74b:	0f 34                	sysenter
+     74d:	c3                   	ret
+
+0000074e <chdir>:
+SYSCALL(chdir)
+     74e:	b8 09 00 00 00       	mov    $0x9,%eax
+     753:	89 e1                	mov    %esp,%ecx
+     755:	ba 5c 07 00 00       	mov    $0x75c,%edx
+     75a:	0f 34                	sysenter
+     75c:	c3                   	ret
+
+0000075d <dup>:
+SYSCALL(dup)
+     75d:	b8 0a 00 00 00       	mov    $0xa,%eax
+     762:	89 e1                	mov    %esp,%ecx
+     764:	ba 6b 07 00 00       	mov    $0x76b,%edx
+     769:	0f 34                	sysenter
+     76b:	c3                   	ret
+
+0000076c <getpid>:
+SYSCALL(getpid)
+     76c:	b8 0b 00 00 00       	mov    $0xb,%eax
+     771:	89 e1                	mov    %esp,%ecx
+     773:	ba 7a 07 00 00       	mov    $0x77a,%edx
+     778:	0f 34                	sysenter
+     77a:	c3                   	ret
+
+0000077b <sbrk>:
+SYSCALL(sbrk)
+     77b:	b8 0c 00 00 00       	mov    $0xc,%eax
+     780:	89 e1                	mov    %esp,%ecx
+     782:	ba 89 07 00 00       	mov    $0x789,%edx
+     787:	0f 34                	sysenter
+     789:	c3                   	ret
+
+0000078a <sleep>:
+SYSCALL(sleep)
+     78a:	b8 0d 00 00 00       	mov    $0xd,%eax
+     78f:	89 e1                	mov    %esp,%ecx
+     791:	ba 98 07 00 00       	mov    $0x798,%edx
+     796:	0f 34                	sysenter
+     798:	c3                   	ret
+
+00000799 <uptime>:
+SYSCALL(uptime)
+     799:	b8 0e 00 00 00       	mov    $0xe,%eax
+     79e:	89 e1                	mov    %esp,%ecx
+     7a0:	ba a7 07 00 00       	mov    $0x7a7,%edx
+     7a5:	0f 34                	sysenter
+     7a7:	c3                   	ret
+
+000007a8 <getproc>:
+SYSCALL(getproc)
+     7a8:	b8 16 00 00 00       	mov    $0x16,%eax
+     7ad:	89 e1                	mov    %esp,%ecx
+     7af:	ba b6 07 00 00       	mov    $0x7b6,%edx
+     7b4:	0f 34                	sysenter
+     7b6:	c3                   	ret
+
+000007b7 <getpgs>:
+SYSCALL(getpgs)
+     7b7:	b8 17 00 00 00       	mov    $0x17,%eax
+     7bc:	89 e1                	mov    %esp,%ecx
+     7be:	ba c5 07 00 00       	mov    $0x7c5,%edx
+     7c3:	0f 34                	sysenter
+     7c5:	c3                   	ret
+
+000007c6 <loadproc>:
+SYSCALL(loadproc)
+     7c6:	b8 18 00 00 00       	mov    $0x18,%eax
+     7cb:	89 e1                	mov    %esp,%ecx
+     7cd:	ba d4 07 00 00       	mov    $0x7d4,%edx
+     7d2:	0f 34                	sysenter
+     7d4:	c3                   	ret
+
+000007d5 <iosubmit>:
+SYSCALL(iosubmit)
+     7d5:	b8 19 00 00 00       	mov    $0x19,%eax
+     7da:	89 e1                	mov    %esp,%ecx
+     7dc:	ba e3 07 00 00       	mov    $0x7e3,%edx
+     7e1:	0f 34                	sysenter
+     7e3:	c3                   	ret
+
+000007e4 <sysstat>:
+SYSCALL(sysstat)
+     7e4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     7e9:	89 e1                	mov    %esp,%ecx
+     7eb:	ba f2 07 00 00       	mov    $0x7f2,%edx
+     7f0:	0f 34                	sysenter
+     7f2:	c3                   	ret
+
+000007f3 <splice>:
+SYSCALL(splice)
+     7f3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     7f8:	89 e1                	mov    %esp,%ecx
+     7fa:	ba 01 08 00 00       	mov    $0x801,%edx
+     7ff:	0f 34                	sysenter
+     801:	c3                   	ret
+
+00000802 <fsync>:
+SYSCALL(fsync)
+     802:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     807:	89 e1                	mov    %esp,%ecx
+     809:	ba 10 08 00 00       	mov    $0x810,%edx
+     80e:	0f 34                	sysenter
+     810:	c3                   	ret
+
+00000811 <fdatasync>:
+SYSCALL(fdatasync)
+     811:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     816:	89 e1                	mov    %esp,%ecx
+     818:	ba 1f 08 00 00       	mov    $0x81f,%edx
+     81d:	0f 34                	sysenter
+     81f:	c3                   	ret
+
+00000820 <lseek>:
+SYSCALL(lseek)
+     820:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     825:	89 e1                	mov    %esp,%ecx
+     827:	ba 2e 08 00 00       	mov    $0x82e,%edx
+     82c:	0f 34                	sysenter
+     82e:	c3                   	ret
+
+0000082f <dmesg>:
+SYSCALL(dmesg)
+     82f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     834:	89 e1                	mov    %esp,%ecx
+     836:	ba 3d 08 00 00       	mov    $0x83d,%edx
+     83b:	0f 34                	sysenter
+     83d:	c3                   	ret
+
+0000083e <lockstat>:
+SYSCALL(lockstat)
+     83e:	b8 20 00 00 00       	mov    $0x20,%eax
+     843:	89 e1                	mov    %esp,%ecx
+     845:	ba 4c 08 00 00       	mov    $0x84c,%edx
+     84a:	0f 34                	sysenter
+     84c:	c3                   	ret
+
+0000084d <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     84d:	55                   	push   %ebp
+     84e:	89 e5                	mov    %esp,%ebp
+     850:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     853:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     85a:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     85e:	74 17                	je     877 <printint+0x2a>
+     860:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     864:	79 11                	jns    877 <printint+0x2a>
+    neg = 1;
+     866:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     86d:	8b 45 0c             	mov    0xc(%ebp),%eax
+     870:	f7 d8                	neg    %eax
+     872:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     875:	eb 06                	jmp    87d <printint+0x30>
+  } else {
+    x = xx;
+     877:	8b 45 0c             	mov    0xc(%ebp),%eax
+     87a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     87d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     884:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     887:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     88a:	ba 00 00 00 00       	mov    $0x0,%edx
+     88f:	f7 f1                	div    %ecx
+     891:	89 d1                	mov    %edx,%ecx
+     893:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     896:	8d 50 01             	lea    0x1(%eax),%edx
+     899:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     89c:	0f b6 91 ec 18 00 00 	movzbl 0x18ec(%ecx),%edx
+     8a3:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     8a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     8aa:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     8ad:	ba 00 00 00 00       	mov    $0x0,%edx
+     8b2:	f7 f1                	div    %ecx
+     8b4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     8b7:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     8bb:	75 c7                	jne    884 <printint+0x37>
+  if(neg)
+     8bd:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     8c1:	74 2d                	je     8f0 <printint+0xa3>
+    buf[i++] = '-';
+     8c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8c6:	8d 50 01             	lea    0x1(%eax),%edx
+     8c9:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     8cc:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+     8d1:	eb 1d                	jmp    8f0 <printint+0xa3>
+    fputc(fd, buf[i]);
+     8d3:	8d 55 dc             	lea    -0x24(%ebp),%edx
+     8d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8d9:	01 d0                	add    %edx,%eax
+     8db:	0f b6 00             	movzbl (%eax),%eax
+     8de:	0f be c0             	movsbl %al,%eax
+     8e1:	83 ec 08             	sub    $0x8,%esp
+     8e4:	50                   	push   %eax
+     8e5:	ff 75 08             	push   0x8(%ebp)
+     8e8:	e8 f8 08 00 00       	call   11e5 <fputc>
+     8ed:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+     8f0:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     8f4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     8f8:	79 d9                	jns    8d3 <printint+0x86>
+}
+     8fa:	90                   	nop
+     8fb:	90                   	nop
+     8fc:	c9                   	leave
+     8fd:	c3                   	ret
+
+000008fe <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     8fe:	55                   	push   %ebp
+     8ff:	89 e5                	mov    %esp,%ebp
+     901:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+     904:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     90b:	8d 45 0c             	lea    0xc(%ebp),%eax
+     90e:	83 c0 04             	add    $0x4,%eax
+     911:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+     914:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     91b:	e9 4a 01 00 00       	jmp    a6a <printf+0x16c>
+    c = fmt[i] & 0xff;
+     920:	8b 55 0c             	mov    0xc(%ebp),%edx
+     923:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     926:	01 d0                	add    %edx,%eax
+     928:	0f b6 00             	movzbl (%eax),%eax
+     92b:	0f be c0             	movsbl %al,%eax
+     92e:	25 ff 00 00 00       	and    $0xff,%eax
+     933:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+     936:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     93a:	75 28                	jne    964 <printf+0x66>
+      if(c == '%'){
+     93c:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     940:	75 0c                	jne    94e <printf+0x50>
+        state = '%';
+     942:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+     949:	e9 18 01 00 00       	jmp    a66 <printf+0x168>
+      } else {
+        fputc(fd, c);
+     94e:	83 ec 08             	sub    $0x8,%esp
+     951:	ff 75 e4             	push   -0x1c(%ebp)
+     954:	ff 75 08             	push   0x8(%ebp)
+     957:	e8 89 08 00 00       	call   11e5 <fputc>
+     95c:	83 c4 10             	add    $0x10,%esp
+     95f:	e9 02 01 00 00       	jmp    a66 <printf+0x168>
+      }
+    } else if(state == '%'){
+     964:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+     968:	0f 85 f8 00 00 00    	jne    a66 <printf+0x168>
+      if(c == 'd'){
+     96e:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+     972:	75 1e                	jne    992 <printf+0x94>
+        printint(fd, *ap, 10, 1);
+     974:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     977:	8b 00                	mov    (%eax),%eax
+     979:	6a 01                	push   $0x1
+     97b:	6a 0a                	push   $0xa
+     97d:	50                   	push   %eax
+     97e:	ff 75 08             	push   0x8(%ebp)
+     981:	e8 c7 fe ff ff       	call   84d <printint>
+     986:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     989:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     98d:	e9 cd 00 00 00       	jmp    a5f <printf+0x161>
+      } else if(c == 'x' || c == 'p'){
+     992:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+     996:	74 06                	je     99e <printf+0xa0>
+     998:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+     99c:	75 1e                	jne    9bc <printf+0xbe>
+        printint(fd, *ap, 16, 0);
+     99e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     9a1:	8b 00                	mov    (%eax),%eax
+     9a3:	6a 00                	push   $0x0
+     9a5:	6a 10                	push   $0x10
+     9a7:	50                   	push   %eax
+     9a8:	ff 75 08             	push   0x8(%ebp)
+     9ab:	e8 9d fe ff ff       	call   84d <printint>
+     9b0:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     9b3:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     9b7:	e9 a3 00 00 00       	jmp    a5f <printf+0x161>
+      } else if(c == 's'){
+     9bc:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+     9c0:	75 43                	jne    a05 <printf+0x107>
+        s = (char*)*ap;
+     9c2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     9c5:	8b 00                	mov    (%eax),%eax
+     9c7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     9ca:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+     9ce:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     9d2:	75 25                	jne    9f9 <printf+0xfb>
+          s = "(null)";
+     9d4:	c7 45 f4 3f 14 00 00 	movl   $0x143f,-0xc(%ebp)
+        while(*s != 0){
+     9db:	eb 1c                	jmp    9f9 <printf+0xfb>
+          fputc(fd, *s);
+     9dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9e0:	0f b6 00             	movzbl (%eax),%eax
+     9e3:	0f be c0             	movsbl %al,%eax
+     9e6:	83 ec 08             	sub    $0x8,%esp
+     9e9:	50                   	push   %eax
+     9ea:	ff 75 08             	push   0x8(%ebp)
+     9ed:	e8 f3 07 00 00       	call   11e5 <fputc>
+     9f2:	83 c4 10             	add    $0x10,%esp
+          s++;
+     9f5:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+     9f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9fc:	0f b6 00             	movzbl (%eax),%eax
+     9ff:	84 c0                	test   %al,%al
+     a01:	75 da                	jne    9dd <printf+0xdf>
+     a03:	eb 5a                	jmp    a5f <printf+0x161>
+        }
+      } else if(c == 'c'){
+     a05:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+     a09:	75 1a                	jne    a25 <printf+0x127>
+        fputc(fd, *ap);
+     a0b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     a0e:	8b 00                	mov    (%eax),%eax
+     a10:	83 ec 08             	sub    $0x8,%esp
+     a13:	50                   	push   %eax
+     a14:	ff 75 08             	push   0x8(%ebp)
+     a17:	e8 c9 07 00 00       	call   11e5 <fputc>
+     a1c:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     a1f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     a23:	eb 3a                	jmp    a5f <printf+0x161>
+      } else if(c == '%'){
+     a25:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     a29:	75 13                	jne    a3e <printf+0x140>
+        fputc(fd, c);
+     a2b:	83 ec 08             	sub    $0x8,%esp
+     a2e:	ff 75 e4             	push   -0x1c(%ebp)
+     a31:	ff 75 08             	push   0x8(%ebp)
+     a34:	e8 ac 07 00 00       	call   11e5 <fputc>
+     a39:	83 c4 10             	add    $0x10,%esp
+     a3c:	eb 21                	jmp    a5f <printf+0x161>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        fputc(fd, '%');
+     a3e:	83 ec 08             	sub    $0x8,%esp
+     a41:	6a 25                	push   $0x25
+     a43:	ff 75 08             	push   0x8(%ebp)
+     a46:	e8 9a 07 00 00       	call   11e5 <fputc>
+     a4b:	83 c4 10             	add    $0x10,%esp
+        fputc(fd, c);
+     a4e:	83 ec 08             	sub    $0x8,%esp
+     a51:	ff 75 e4             	push   -0x1c(%ebp)
+     a54:	ff 75 08             	push   0x8(%ebp)
+     a57:	e8 89 07 00 00       	call   11e5 <fputc>
+     a5c:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     a5f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     a66:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     a6a:	8b 55 0c             	mov    0xc(%ebp),%edx
+     a6d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a70:	01 d0                	add    %edx,%eax
+     a72:	0f b6 00             	movzbl (%eax),%eax
+     a75:	84 c0                	test   %al,%al
+     a77:	0f 85 a3 fe ff ff    	jne    920 <printf+0x22>
+    }
+  }
+}
+     a7d:	90                   	nop
+     a7e:	90                   	nop
+     a7f:	c9                   	leave
+     a80:	c3                   	ret
+
+00000a81 <binof>:
+static struct chunk *bins[NBIN];       // free large chunks
+static struct chunk *top;              // end marker of newest heap segment
+
+static int
+binof(uint size)
+{
+     a81:	55                   	push   %ebp
+     a82:	89 e5                	mov    %esp,%ebp
+     a84:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  i = 0;
+     a87:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     a8e:	c1 6d 08 05          	shrl   $0x5,0x8(%ebp)
+     a92:	eb 07                	jmp    a9b <binof+0x1a>
+    i++;
+     a94:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     a98:	d1 6d 08             	shrl   0x8(%ebp)
+     a9b:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     a9f:	74 06                	je     aa7 <binof+0x26>
+     aa1:	83 7d fc 19          	cmpl   $0x19,-0x4(%ebp)
+     aa5:	7e ed                	jle    a94 <binof+0x13>
+  return i;
+     aa7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     aaa:	c9                   	leave
+     aab:	c3                   	ret
+
+00000aac <bininsert>:
+
+static void
+bininsert(struct chunk *c)
+{
+     aac:	55                   	push   %ebp
+     aad:	89 e5                	mov    %esp,%ebp
+     aaf:	83 ec 10             	sub    $0x10,%esp
+  struct chunk **b;
+
+  b = &bins[binof(CSIZE(c))];
+     ab2:	8b 45 08             	mov    0x8(%ebp),%eax
+     ab5:	8b 00                	mov    (%eax),%eax
+     ab7:	83 e0 f8             	and    $0xfffffff8,%eax
+     aba:	50                   	push   %eax
+     abb:	e8 c1 ff ff ff       	call   a81 <binof>
+     ac0:	83 c4 04             	add    $0x4,%esp
+     ac3:	c1 e0 02             	shl    $0x2,%eax
+     ac6:	05 20 19 00 00       	add    $0x1920,%eax
+     acb:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c->prev = 0;
+     ace:	8b 45 08             	mov    0x8(%ebp),%eax
+     ad1:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  c->next = *b;
+     ad8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     adb:	8b 10                	mov    (%eax),%edx
+     add:	8b 45 08             	mov    0x8(%ebp),%eax
+     ae0:	89 50 08             	mov    %edx,0x8(%eax)
+  if(*b)
+     ae3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ae6:	8b 00                	mov    (%eax),%eax
+     ae8:	85 c0                	test   %eax,%eax
+     aea:	74 0b                	je     af7 <bininsert+0x4b>
+    (*b)->prev = c;
+     aec:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     aef:	8b 00                	mov    (%eax),%eax
+     af1:	8b 55 08             	mov    0x8(%ebp),%edx
+     af4:	89 50 0c             	mov    %edx,0xc(%eax)
+  *b = c;
+     af7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     afa:	8b 55 08             	mov    0x8(%ebp),%edx
+     afd:	89 10                	mov    %edx,(%eax)
+}
+     aff:	90                   	nop
+     b00:	c9                   	leave
+     b01:	c3                   	ret
+
+00000b02 <binremove>:
+
+static void
+binremove(struct chunk *c)
+{
+     b02:	55                   	push   %ebp
+     b03:	89 e5                	mov    %esp,%ebp
+  if(c->prev)
+     b05:	8b 45 08             	mov    0x8(%ebp),%eax
+     b08:	8b 40 0c             	mov    0xc(%eax),%eax
+     b0b:	85 c0                	test   %eax,%eax
+     b0d:	74 11                	je     b20 <binremove+0x1e>
+    c->prev->next = c->next;
+     b0f:	8b 45 08             	mov    0x8(%ebp),%eax
+     b12:	8b 40 0c             	mov    0xc(%eax),%eax
+     b15:	8b 55 08             	mov    0x8(%ebp),%edx
+     b18:	8b 52 08             	mov    0x8(%edx),%edx
+     b1b:	89 50 08             	mov    %edx,0x8(%eax)
+     b1e:	eb 1e                	jmp    b3e <binremove+0x3c>
+  else
+    bins[binof(CSIZE(c))] = c->next;
+     b20:	8b 45 08             	mov    0x8(%ebp),%eax
+     b23:	8b 00                	mov    (%eax),%eax
+     b25:	83 e0 f8             	and    $0xfffffff8,%eax
+     b28:	50                   	push   %eax
+     b29:	e8 53 ff ff ff       	call   a81 <binof>
+     b2e:	83 c4 04             	add    $0x4,%esp
+     b31:	8b 55 08             	mov    0x8(%ebp),%edx
+     b34:	8b 52 08             	mov    0x8(%edx),%edx
+     b37:	89 14 85 20 19 00 00 	mov    %edx,0x1920(,%eax,4)
+  if(c->next)
+     b3e:	8b 45 08             	mov    0x8(%ebp),%eax
+     b41:	8b 40 08             	mov    0x8(%eax),%eax
+     b44:	85 c0                	test   %eax,%eax
+     b46:	74 0f                	je     b57 <binremove+0x55>
+    c->next->prev = c->prev;
+     b48:	8b 45 08             	mov    0x8(%ebp),%eax
+     b4b:	8b 40 08             	mov    0x8(%eax),%eax
+     b4e:	8b 55 08             	mov    0x8(%ebp),%edx
+     b51:	8b 52 0c             	mov    0xc(%edx),%edx
+     b54:	89 50 0c             	mov    %edx,0xc(%eax)
+}
+     b57:	90                   	nop
+     b58:	c9                   	leave
+     b59:	c3                   	ret
+
+00000b5a <freechunk>:
+
+// Free chunk c, merging it with free neighbors.  If trim is
+// set and the result is big and at the break, give it back.
+static void
+freechunk(struct chunk *c, int trim)
+{
+     b5a:	55                   	push   %ebp
+     b5b:	89 e5                	mov    %esp,%ebp
+     b5d:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *p, *n;
+  uint size;
+
+  size = CSIZE(c);
+     b60:	8b 45 08             	mov    0x8(%ebp),%eax
+     b63:	8b 00                	mov    (%eax),%eax
+     b65:	83 e0 f8             	and    $0xfffffff8,%eax
+     b68:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  n = NEXTC(c);
+     b6b:	8b 45 08             	mov    0x8(%ebp),%eax
+     b6e:	8b 00                	mov    (%eax),%eax
+     b70:	83 e0 f8             	and    $0xfffffff8,%eax
+     b73:	89 c2                	mov    %eax,%edx
+     b75:	8b 45 08             	mov    0x8(%ebp),%eax
+     b78:	01 d0                	add    %edx,%eax
+     b7a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(!(c->size & PREVUSED)){
+     b7d:	8b 45 08             	mov    0x8(%ebp),%eax
+     b80:	8b 00                	mov    (%eax),%eax
+     b82:	83 e0 02             	and    $0x2,%eax
+     b85:	85 c0                	test   %eax,%eax
+     b87:	75 30                	jne    bb9 <freechunk+0x5f>
+    p = (struct chunk*)((char*)c - *((uint*)c - 1));
+     b89:	8b 45 08             	mov    0x8(%ebp),%eax
+     b8c:	83 e8 04             	sub    $0x4,%eax
+     b8f:	8b 00                	mov    (%eax),%eax
+     b91:	f7 d8                	neg    %eax
+     b93:	89 c2                	mov    %eax,%edx
+     b95:	8b 45 08             	mov    0x8(%ebp),%eax
+     b98:	01 d0                	add    %edx,%eax
+     b9a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    binremove(p);
+     b9d:	ff 75 ec             	push   -0x14(%ebp)
+     ba0:	e8 5d ff ff ff       	call   b02 <binremove>
+     ba5:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(p);
+     ba8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     bab:	8b 00                	mov    (%eax),%eax
+     bad:	83 e0 f8             	and    $0xfffffff8,%eax
+     bb0:	01 45 f4             	add    %eax,-0xc(%ebp)
+    c = p;
+     bb3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     bb6:	89 45 08             	mov    %eax,0x8(%ebp)
+  }
+  if(!(n->size & USED)){
+     bb9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bbc:	8b 00                	mov    (%eax),%eax
+     bbe:	83 e0 01             	and    $0x1,%eax
+     bc1:	85 c0                	test   %eax,%eax
+     bc3:	75 16                	jne    bdb <freechunk+0x81>
+    binremove(n);
+     bc5:	ff 75 f0             	push   -0x10(%ebp)
+     bc8:	e8 35 ff ff ff       	call   b02 <binremove>
+     bcd:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(n);
+     bd0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bd3:	8b 00                	mov    (%eax),%eax
+     bd5:	83 e0 f8             	and    $0xfffffff8,%eax
+     bd8:	01 45 f4             	add    %eax,-0xc(%ebp)
+  }
+  // Free chunks are never adjacent, so the one below is in use.
+  c->size = size | PREVUSED;
+     bdb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     bde:	83 c8 02             	or     $0x2,%eax
+     be1:	89 c2                	mov    %eax,%edx
+     be3:	8b 45 08             	mov    0x8(%ebp),%eax
+     be6:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+     be8:	8b 45 08             	mov    0x8(%ebp),%eax
+     beb:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  FOOTER(c) = size;
+     bf2:	8b 45 08             	mov    0x8(%ebp),%eax
+     bf5:	8b 00                	mov    (%eax),%eax
+     bf7:	83 e0 f8             	and    $0xfffffff8,%eax
+     bfa:	8d 50 fc             	lea    -0x4(%eax),%edx
+     bfd:	8b 45 08             	mov    0x8(%ebp),%eax
+     c00:	01 c2                	add    %eax,%edx
+     c02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c05:	89 02                	mov    %eax,(%edx)
+  n = NEXTC(c);
+     c07:	8b 45 08             	mov    0x8(%ebp),%eax
+     c0a:	8b 00                	mov    (%eax),%eax
+     c0c:	83 e0 f8             	and    $0xfffffff8,%eax
+     c0f:	89 c2                	mov    %eax,%edx
+     c11:	8b 45 08             	mov    0x8(%ebp),%eax
+     c14:	01 d0                	add    %edx,%eax
+     c16:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  n->size &= ~PREVUSED;
+     c19:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c1c:	8b 00                	mov    (%eax),%eax
+     c1e:	83 e0 fd             	and    $0xfffffffd,%eax
+     c21:	89 c2                	mov    %eax,%edx
+     c23:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c26:	89 10                	mov    %edx,(%eax)
+
+  if(trim && n == top && size >= TRIMSIZE && sbrk(0) == (char*)top + HDRSIZE){
+     c28:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     c2c:	74 51                	je     c7f <freechunk+0x125>
+     c2e:	a1 8c 19 00 00       	mov    0x198c,%eax
+     c33:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     c36:	75 47                	jne    c7f <freechunk+0x125>
+     c38:	81 7d f4 ff 7f 00 00 	cmpl   $0x7fff,-0xc(%ebp)
+     c3f:	76 3e                	jbe    c7f <freechunk+0x125>
+     c41:	83 ec 0c             	sub    $0xc,%esp
+     c44:	6a 00                	push   $0x0
+     c46:	e8 30 fb ff ff       	call   77b <sbrk>
+     c4b:	83 c4 10             	add    $0x10,%esp
+     c4e:	8b 15 8c 19 00 00    	mov    0x198c,%edx
+     c54:	83 c2 08             	add    $0x8,%edx
+     c57:	39 d0                	cmp    %edx,%eax
+     c59:	75 24                	jne    c7f <freechunk+0x125>
+    c->size = USED | PREVUSED;
+     c5b:	8b 45 08             	mov    0x8(%ebp),%eax
+     c5e:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+    top = c;
+     c64:	8b 45 08             	mov    0x8(%ebp),%eax
+     c67:	a3 8c 19 00 00       	mov    %eax,0x198c
+    sbrk(-size);
+     c6c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c6f:	f7 d8                	neg    %eax
+     c71:	83 ec 0c             	sub    $0xc,%esp
+     c74:	50                   	push   %eax
+     c75:	e8 01 fb ff ff       	call   77b <sbrk>
+     c7a:	83 c4 10             	add    $0x10,%esp
+    return;
+     c7d:	eb 0e                	jmp    c8d <freechunk+0x133>
+  }
+  bininsert(c);
+     c7f:	83 ec 0c             	sub    $0xc,%esp
+     c82:	ff 75 08             	push   0x8(%ebp)
+     c85:	e8 22 fe ff ff       	call   aac <bininsert>
+     c8a:	83 c4 10             	add    $0x10,%esp
+}
+     c8d:	c9                   	leave
+     c8e:	c3                   	ret
+
+00000c8f <morecore>:
+
+// Grow the heap by at least need bytes.
+static int
+morecore(uint need)
+{
+     c8f:	55                   	push   %ebp
+     c90:	89 e5                	mov    %esp,%ebp
+     c92:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+  char *p;
+  uint n, pad;
+
+  n = need + MINCHUNK;
+     c95:	8b 45 08             	mov    0x8(%ebp),%eax
+     c98:	83 c0 18             	add    $0x18,%eax
+     c9b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(n < MINCORE)
+     c9e:	81 7d ec ff 3f 00 00 	cmpl   $0x3fff,-0x14(%ebp)
+     ca5:	77 07                	ja     cae <morecore+0x1f>
+    n = MINCORE;
+     ca7:	c7 45 ec 00 40 00 00 	movl   $0x4000,-0x14(%ebp)
+  // Keep the break 8-aligned, with the end marker just below it.
+  pad = (8 - ((uint)sbrk(0) & 7)) & 7;
+     cae:	83 ec 0c             	sub    $0xc,%esp
+     cb1:	6a 00                	push   $0x0
+     cb3:	e8 c3 fa ff ff       	call   77b <sbrk>
+     cb8:	83 c4 10             	add    $0x10,%esp
+     cbb:	83 e0 07             	and    $0x7,%eax
+     cbe:	ba 08 00 00 00       	mov    $0x8,%edx
+     cc3:	29 c2                	sub    %eax,%edx
+     cc5:	89 d0                	mov    %edx,%eax
+     cc7:	83 e0 07             	and    $0x7,%eax
+     cca:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if((p = sbrk(pad + n)) == (char*)-1){
+     ccd:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     cd0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     cd3:	01 d0                	add    %edx,%eax
+     cd5:	83 ec 0c             	sub    $0xc,%esp
+     cd8:	50                   	push   %eax
+     cd9:	e8 9d fa ff ff       	call   77b <sbrk>
+     cde:	83 c4 10             	add    $0x10,%esp
+     ce1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     ce4:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     ce8:	75 30                	jne    d1a <morecore+0x8b>
+    n = need + MINCHUNK;
+     cea:	8b 45 08             	mov    0x8(%ebp),%eax
+     ced:	83 c0 18             	add    $0x18,%eax
+     cf0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((p = sbrk(pad + n)) == (char*)-1)
+     cf3:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     cf6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     cf9:	01 d0                	add    %edx,%eax
+     cfb:	83 ec 0c             	sub    $0xc,%esp
+     cfe:	50                   	push   %eax
+     cff:	e8 77 fa ff ff       	call   77b <sbrk>
+     d04:	83 c4 10             	add    $0x10,%esp
+     d07:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     d0a:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     d0e:	75 0a                	jne    d1a <morecore+0x8b>
+      return -1;
+     d10:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     d15:	e9 8e 00 00 00       	jmp    da8 <morecore+0x119>
+  }
+  p += pad;
+     d1a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     d1d:	01 45 f0             	add    %eax,-0x10(%ebp)
+  if(top && p == (char*)top + HDRSIZE){
+     d20:	a1 8c 19 00 00       	mov    0x198c,%eax
+     d25:	85 c0                	test   %eax,%eax
+     d27:	74 29                	je     d52 <morecore+0xc3>
+     d29:	a1 8c 19 00 00       	mov    0x198c,%eax
+     d2e:	83 c0 08             	add    $0x8,%eax
+     d31:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     d34:	75 1c                	jne    d52 <morecore+0xc3>
+    // Contiguous: the old end marker heads the new chunk.
+    c = top;
+     d36:	a1 8c 19 00 00       	mov    0x198c,%eax
+     d3b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = n | (c->size & PREVUSED);
+     d3e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d41:	8b 00                	mov    (%eax),%eax
+     d43:	83 e0 02             	and    $0x2,%eax
+     d46:	0b 45 ec             	or     -0x14(%ebp),%eax
+     d49:	89 c2                	mov    %eax,%edx
+     d4b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d4e:	89 10                	mov    %edx,(%eax)
+     d50:	eb 16                	jmp    d68 <morecore+0xd9>
+  } else {
+    // Someone else moved the break: start a new segment.
+    c = (struct chunk*)p;
+     d52:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d55:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = (n - HDRSIZE) | PREVUSED;
+     d58:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     d5b:	83 e8 08             	sub    $0x8,%eax
+     d5e:	83 c8 02             	or     $0x2,%eax
+     d61:	89 c2                	mov    %eax,%edx
+     d63:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d66:	89 10                	mov    %edx,(%eax)
+  }
+  top = NEXTC(c);
+     d68:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d6b:	8b 00                	mov    (%eax),%eax
+     d6d:	83 e0 f8             	and    $0xfffffff8,%eax
+     d70:	89 c2                	mov    %eax,%edx
+     d72:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d75:	01 d0                	add    %edx,%eax
+     d77:	a3 8c 19 00 00       	mov    %eax,0x198c
+  top->size = USED;
+     d7c:	a1 8c 19 00 00       	mov    0x198c,%eax
+     d81:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  top->tag = LARGE;
+     d87:	a1 8c 19 00 00       	mov    0x198c,%eax
+     d8c:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  freechunk(c, 0);
+     d93:	83 ec 08             	sub    $0x8,%esp
+     d96:	6a 00                	push   $0x0
+     d98:	ff 75 f4             	push   -0xc(%ebp)
+     d9b:	e8 ba fd ff ff       	call   b5a <freechunk>
+     da0:	83 c4 10             	add    $0x10,%esp
+  return 0;
+     da3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     da8:	c9                   	leave
+     da9:	c3                   	ret
+
+00000daa <largealloc>:
+
+static void*
+largealloc(uint nbytes)
+{
+     daa:	55                   	push   %ebp
+     dab:	89 e5                	mov    %esp,%ebp
+     dad:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c, *r;
+  uint need;
+  int i;
+
+  if(nbytes > 0x7fffffff)
+     db0:	8b 45 08             	mov    0x8(%ebp),%eax
+     db3:	85 c0                	test   %eax,%eax
+     db5:	79 0a                	jns    dc1 <largealloc+0x17>
+    return 0;
+     db7:	b8 00 00 00 00       	mov    $0x0,%eax
+     dbc:	e9 43 01 00 00       	jmp    f04 <largealloc+0x15a>
+  need = (nbytes + HDRSIZE + 7) & ~7;
+     dc1:	8b 45 08             	mov    0x8(%ebp),%eax
+     dc4:	83 c0 0f             	add    $0xf,%eax
+     dc7:	83 e0 f8             	and    $0xfffffff8,%eax
+     dca:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(need < MINCHUNK)
+     dcd:	83 7d f0 17          	cmpl   $0x17,-0x10(%ebp)
+     dd1:	77 07                	ja     dda <largealloc+0x30>
+    need = MINCHUNK;
+     dd3:	c7 45 f0 18 00 00 00 	movl   $0x18,-0x10(%ebp)
+  for(;;){
+    for(i = binof(need); i < NBIN; i++)
+     dda:	ff 75 f0             	push   -0x10(%ebp)
+     ddd:	e8 9f fc ff ff       	call   a81 <binof>
+     de2:	83 c4 04             	add    $0x4,%esp
+     de5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     de8:	eb 2f                	jmp    e19 <largealloc+0x6f>
+      for(c = bins[i]; c; c = c->next)
+     dea:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     ded:	8b 04 85 20 19 00 00 	mov    0x1920(,%eax,4),%eax
+     df4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     df7:	eb 16                	jmp    e0f <largealloc+0x65>
+        if(CSIZE(c) >= need)
+     df9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     dfc:	8b 00                	mov    (%eax),%eax
+     dfe:	83 e0 f8             	and    $0xfffffff8,%eax
+     e01:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     e04:	73 35                	jae    e3b <largealloc+0x91>
+      for(c = bins[i]; c; c = c->next)
+     e06:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e09:	8b 40 08             	mov    0x8(%eax),%eax
+     e0c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     e0f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     e13:	75 e4                	jne    df9 <largealloc+0x4f>
+    for(i = binof(need); i < NBIN; i++)
+     e15:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     e19:	83 7d ec 1a          	cmpl   $0x1a,-0x14(%ebp)
+     e1d:	7e cb                	jle    dea <largealloc+0x40>
+          goto found;
+    if(morecore(need) < 0)
+     e1f:	83 ec 0c             	sub    $0xc,%esp
+     e22:	ff 75 f0             	push   -0x10(%ebp)
+     e25:	e8 65 fe ff ff       	call   c8f <morecore>
+     e2a:	83 c4 10             	add    $0x10,%esp
+     e2d:	85 c0                	test   %eax,%eax
+     e2f:	79 a9                	jns    dda <largealloc+0x30>
+      return 0;
+     e31:	b8 00 00 00 00       	mov    $0x0,%eax
+     e36:	e9 c9 00 00 00       	jmp    f04 <largealloc+0x15a>
+          goto found;
+     e3b:	90                   	nop
+  }
+
+found:
+  binremove(c);
+     e3c:	83 ec 0c             	sub    $0xc,%esp
+     e3f:	ff 75 f4             	push   -0xc(%ebp)
+     e42:	e8 bb fc ff ff       	call   b02 <binremove>
+     e47:	83 c4 10             	add    $0x10,%esp
+  if(CSIZE(c) - need >= MINCHUNK){
+     e4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e4d:	8b 00                	mov    (%eax),%eax
+     e4f:	83 e0 f8             	and    $0xfffffff8,%eax
+     e52:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     e55:	83 f8 17             	cmp    $0x17,%eax
+     e58:	76 66                	jbe    ec0 <largealloc+0x116>
+    r = (struct chunk*)((char*)c + need);
+     e5a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     e5d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e60:	01 d0                	add    %edx,%eax
+     e62:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    r->size = (CSIZE(c) - need) | PREVUSED;
+     e65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e68:	8b 00                	mov    (%eax),%eax
+     e6a:	83 e0 f8             	and    $0xfffffff8,%eax
+     e6d:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     e70:	83 c8 02             	or     $0x2,%eax
+     e73:	89 c2                	mov    %eax,%edx
+     e75:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e78:	89 10                	mov    %edx,(%eax)
+    r->tag = LARGE;
+     e7a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e7d:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+    FOOTER(r) = CSIZE(r);
+     e84:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e87:	8b 10                	mov    (%eax),%edx
+     e89:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e8c:	8b 00                	mov    (%eax),%eax
+     e8e:	83 e0 f8             	and    $0xfffffff8,%eax
+     e91:	8d 48 fc             	lea    -0x4(%eax),%ecx
+     e94:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e97:	01 c8                	add    %ecx,%eax
+     e99:	83 e2 f8             	and    $0xfffffff8,%edx
+     e9c:	89 10                	mov    %edx,(%eax)
+    bininsert(r);
+     e9e:	83 ec 0c             	sub    $0xc,%esp
+     ea1:	ff 75 e8             	push   -0x18(%ebp)
+     ea4:	e8 03 fc ff ff       	call   aac <bininsert>
+     ea9:	83 c4 10             	add    $0x10,%esp
+    c->size = need | (c->size & PREVUSED);
+     eac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eaf:	8b 00                	mov    (%eax),%eax
+     eb1:	83 e0 02             	and    $0x2,%eax
+     eb4:	0b 45 f0             	or     -0x10(%ebp),%eax
+     eb7:	89 c2                	mov    %eax,%edx
+     eb9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ebc:	89 10                	mov    %edx,(%eax)
+     ebe:	eb 25                	jmp    ee5 <largealloc+0x13b>
+  } else
+    NEXTC(c)->size |= PREVUSED;
+     ec0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ec3:	8b 00                	mov    (%eax),%eax
+     ec5:	83 e0 f8             	and    $0xfffffff8,%eax
+     ec8:	89 c2                	mov    %eax,%edx
+     eca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ecd:	01 d0                	add    %edx,%eax
+     ecf:	8b 10                	mov    (%eax),%edx
+     ed1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ed4:	8b 00                	mov    (%eax),%eax
+     ed6:	83 e0 f8             	and    $0xfffffff8,%eax
+     ed9:	89 c1                	mov    %eax,%ecx
+     edb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ede:	01 c8                	add    %ecx,%eax
+     ee0:	83 ca 02             	or     $0x2,%edx
+     ee3:	89 10                	mov    %edx,(%eax)
+  c->size |= USED;
+     ee5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ee8:	8b 00                	mov    (%eax),%eax
+     eea:	83 c8 01             	or     $0x1,%eax
+     eed:	89 c2                	mov    %eax,%edx
+     eef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ef2:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+     ef4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ef7:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  return (char*)c + HDRSIZE;
+     efe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f01:	83 c0 08             	add    $0x8,%eax
+}
+     f04:	c9                   	leave
+     f05:	c3                   	ret
+
+00000f06 <refill>:
+
+// Carve a slab into free blocks of class k.
+static int
+refill(int k)
+{
+     f06:	55                   	push   %ebp
+     f07:	89 e5                	mov    %esp,%ebp
+     f09:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  char *p;
+  uint bs, i;
+
+  if((p = largealloc(SLABSIZE)) == 0)
+     f0c:	83 ec 0c             	sub    $0xc,%esp
+     f0f:	68 00 20 00 00       	push   $0x2000
+     f14:	e8 91 fe ff ff       	call   daa <largealloc>
+     f19:	83 c4 10             	add    $0x10,%esp
+     f1c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f1f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     f23:	75 07                	jne    f2c <refill+0x26>
+    return -1;
+     f25:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     f2a:	eb 75                	jmp    fa1 <refill+0x9b>
+  bs = HDRSIZE + (MINSMALL << k);
+     f2c:	8b 45 08             	mov    0x8(%ebp),%eax
+     f2f:	ba 10 00 00 00       	mov    $0x10,%edx
+     f34:	89 c1                	mov    %eax,%ecx
+     f36:	d3 e2                	shl    %cl,%edx
+     f38:	89 d0                	mov    %edx,%eax
+     f3a:	83 c0 08             	add    $0x8,%eax
+     f3d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+     f40:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     f47:	eb 44                	jmp    f8d <refill+0x87>
+    b = (struct chunk*)(p + i);
+     f49:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     f4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f4f:	01 d0                	add    %edx,%eax
+     f51:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    b->size = bs | USED;
+     f54:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f57:	83 c8 01             	or     $0x1,%eax
+     f5a:	89 c2                	mov    %eax,%edx
+     f5c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f5f:	89 10                	mov    %edx,(%eax)
+    b->tag = k;
+     f61:	8b 55 08             	mov    0x8(%ebp),%edx
+     f64:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f67:	89 50 04             	mov    %edx,0x4(%eax)
+    b->next = classes[k];
+     f6a:	8b 45 08             	mov    0x8(%ebp),%eax
+     f6d:	8b 14 85 00 19 00 00 	mov    0x1900(,%eax,4),%edx
+     f74:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f77:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[k] = b;
+     f7a:	8b 45 08             	mov    0x8(%ebp),%eax
+     f7d:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     f80:	89 14 85 00 19 00 00 	mov    %edx,0x1900(,%eax,4)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+     f87:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f8a:	01 45 f4             	add    %eax,-0xc(%ebp)
+     f8d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     f90:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f93:	01 d0                	add    %edx,%eax
+     f95:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     f9a:	76 ad                	jbe    f49 <refill+0x43>
+  }
+  return 0;
+     f9c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     fa1:	c9                   	leave
+     fa2:	c3                   	ret
+
+00000fa3 <free>:
+
+void
+free(void *ap)
+{
+     fa3:	55                   	push   %ebp
+     fa4:	89 e5                	mov    %esp,%ebp
+     fa6:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+
+  if(ap == 0)
+     fa9:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     fad:	74 4b                	je     ffa <free+0x57>
+    return;
+  c = (struct chunk*)((char*)ap - HDRSIZE);
+     faf:	8b 45 08             	mov    0x8(%ebp),%eax
+     fb2:	83 e8 08             	sub    $0x8,%eax
+     fb5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(c->tag != LARGE){
+     fb8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fbb:	8b 40 04             	mov    0x4(%eax),%eax
+     fbe:	83 f8 ff             	cmp    $0xffffffff,%eax
+     fc1:	74 25                	je     fe8 <free+0x45>
+    c->next = classes[c->tag];
+     fc3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fc6:	8b 40 04             	mov    0x4(%eax),%eax
+     fc9:	8b 14 85 00 19 00 00 	mov    0x1900(,%eax,4),%edx
+     fd0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fd3:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[c->tag] = c;
+     fd6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fd9:	8b 40 04             	mov    0x4(%eax),%eax
+     fdc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     fdf:	89 14 85 00 19 00 00 	mov    %edx,0x1900(,%eax,4)
+    return;
+     fe6:	eb 13                	jmp    ffb <free+0x58>
+  }
+  freechunk(c, 1);
+     fe8:	83 ec 08             	sub    $0x8,%esp
+     feb:	6a 01                	push   $0x1
+     fed:	ff 75 f4             	push   -0xc(%ebp)
+     ff0:	e8 65 fb ff ff       	call   b5a <freechunk>
+     ff5:	83 c4 10             	add    $0x10,%esp
+     ff8:	eb 01                	jmp    ffb <free+0x58>
+    return;
+     ffa:	90                   	nop
+}
+     ffb:	c9                   	leave
+     ffc:	c3                   	ret
+
+00000ffd <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     ffd:	55                   	push   %ebp
+     ffe:	89 e5                	mov    %esp,%ebp
+    1000:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  int k;
+
+  if(nbytes > MAXSMALL)
+    1003:	81 7d 08 00 08 00 00 	cmpl   $0x800,0x8(%ebp)
+    100a:	76 10                	jbe    101c <malloc+0x1f>
+    return largealloc(nbytes);
+    100c:	83 ec 0c             	sub    $0xc,%esp
+    100f:	ff 75 08             	push   0x8(%ebp)
+    1012:	e8 93 fd ff ff       	call   daa <largealloc>
+    1017:	83 c4 10             	add    $0x10,%esp
+    101a:	eb 6a                	jmp    1086 <malloc+0x89>
+  for(k = 0; (MINSMALL << k) < nbytes; k++)
+    101c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1023:	eb 04                	jmp    1029 <malloc+0x2c>
+    1025:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1029:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    102c:	ba 10 00 00 00       	mov    $0x10,%edx
+    1031:	89 c1                	mov    %eax,%ecx
+    1033:	d3 e2                	shl    %cl,%edx
+    1035:	89 d0                	mov    %edx,%eax
+    1037:	3b 45 08             	cmp    0x8(%ebp),%eax
+    103a:	72 e9                	jb     1025 <malloc+0x28>
+    ;
+  if(classes[k] == 0 && refill(k) < 0)
+    103c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    103f:	8b 04 85 00 19 00 00 	mov    0x1900(,%eax,4),%eax
+    1046:	85 c0                	test   %eax,%eax
+    1048:	75 19                	jne    1063 <malloc+0x66>
+    104a:	83 ec 0c             	sub    $0xc,%esp
+    104d:	ff 75 f4             	push   -0xc(%ebp)
+    1050:	e8 b1 fe ff ff       	call   f06 <refill>
+    1055:	83 c4 10             	add    $0x10,%esp
+    1058:	85 c0                	test   %eax,%eax
+    105a:	79 07                	jns    1063 <malloc+0x66>
+    return 0;
+    105c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1061:	eb 23                	jmp    1086 <malloc+0x89>
+  b = classes[k];
+    1063:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1066:	8b 04 85 00 19 00 00 	mov    0x1900(,%eax,4),%eax
+    106d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  classes[k] = b->next;
+    1070:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1073:	8b 50 08             	mov    0x8(%eax),%edx
+    1076:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1079:	89 14 85 00 19 00 00 	mov    %edx,0x1900(,%eax,4)
+  return (char*)b + HDRSIZE;
+    1080:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1083:	83 c0 08             	add    $0x8,%eax
+}
+    1086:	c9                   	leave
+    1087:	c3                   	ret
+
+00001088 <stream>:
+
+// Return the stream for fd, deciding on first use how
+// its output is buffered.  Returns 0 if fd is not open.
+static struct stream*
+stream(int fd)
+{
+    1088:	55                   	push   %ebp
+    1089:	89 e5                	mov    %esp,%ebp
+    108b:	83 ec 28             	sub    $0x28,%esp
+  struct stream *s;
+  struct stat st;
+
+  if(fd < 0 || fd >= NOFILE)
+    108e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1092:	78 06                	js     109a <stream+0x12>
+    1094:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    1098:	7e 07                	jle    10a1 <stream+0x19>
+    return 0;
+    109a:	b8 00 00 00 00       	mov    $0x0,%eax
+    109f:	eb 55                	jmp    10f6 <stream+0x6e>
+  s = &streams[fd];
+    10a1:	8b 45 08             	mov    0x8(%ebp),%eax
+    10a4:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    10aa:	05 a0 19 00 00       	add    $0x19a0,%eax
+    10af:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(s->mode == UNKNOWN){
+    10b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10b5:	8b 00                	mov    (%eax),%eax
+    10b7:	85 c0                	test   %eax,%eax
+    10b9:	75 38                	jne    10f3 <stream+0x6b>
+    if(fstat(fd, &st) < 0)
+    10bb:	83 ec 08             	sub    $0x8,%esp
+    10be:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    10c1:	50                   	push   %eax
+    10c2:	ff 75 08             	push   0x8(%ebp)
+    10c5:	e8 57 f6 ff ff       	call   721 <fstat>
+    10ca:	83 c4 10             	add    $0x10,%esp
+    10cd:	85 c0                	test   %eax,%eax
+    10cf:	79 07                	jns    10d8 <stream+0x50>
+      return 0;
+    10d1:	b8 00 00 00 00       	mov    $0x0,%eax
+    10d6:	eb 1e                	jmp    10f6 <stream+0x6e>
+    s->mode = st.type == T_DEV ? LINEBUF : FULLBUF;
+    10d8:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+    10dc:	66 83 f8 03          	cmp    $0x3,%ax
+    10e0:	75 07                	jne    10e9 <stream+0x61>
+    10e2:	ba 01 00 00 00       	mov    $0x1,%edx
+    10e7:	eb 05                	jmp    10ee <stream+0x66>
+    10e9:	ba 02 00 00 00       	mov    $0x2,%edx
+    10ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10f1:	89 10                	mov    %edx,(%eax)
+  }
+  return s;
+    10f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    10f6:	c9                   	leave
+    10f7:	c3                   	ret
+
+000010f8 <fflush>:
+
+int
+fflush(int fd)
+{
+    10f8:	55                   	push   %ebp
+    10f9:	89 e5                	mov    %esp,%ebp
+    10fb:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  int i, n;
+
+  if(fd < 0 || fd >= NOFILE)
+    10fe:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1102:	78 06                	js     110a <fflush+0x12>
+    1104:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    1108:	7e 07                	jle    1111 <fflush+0x19>
+    return -1;
+    110a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    110f:	eb 78                	jmp    1189 <fflush+0x91>
+  s = &streams[fd];
+    1111:	8b 45 08             	mov    0x8(%ebp),%eax
+    1114:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    111a:	05 a0 19 00 00       	add    $0x19a0,%eax
+    111f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < s->nout; i += n){
+    1122:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1129:	eb 44                	jmp    116f <fflush+0x77>
+    if((n = write(fd, s->out + i, s->nout - i)) <= 0){
+    112b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    112e:	8b 40 04             	mov    0x4(%eax),%eax
+    1131:	2b 45 f4             	sub    -0xc(%ebp),%eax
+    1134:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    1137:	8d 4a 10             	lea    0x10(%edx),%ecx
+    113a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    113d:	01 ca                	add    %ecx,%edx
+    113f:	83 ec 04             	sub    $0x4,%esp
+    1142:	50                   	push   %eax
+    1143:	52                   	push   %edx
+    1144:	ff 75 08             	push   0x8(%ebp)
+    1147:	e8 6c f5 ff ff       	call   6b8 <write>
+    114c:	83 c4 10             	add    $0x10,%esp
+    114f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1152:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1156:	7f 11                	jg     1169 <fflush+0x71>
+      s->nout = 0;
+    1158:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    115b:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+      return -1;
+    1162:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1167:	eb 20                	jmp    1189 <fflush+0x91>
+  for(i = 0; i < s->nout; i += n){
+    1169:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    116c:	01 45 f4             	add    %eax,-0xc(%ebp)
+    116f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1172:	8b 40 04             	mov    0x4(%eax),%eax
+    1175:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    1178:	7c b1                	jl     112b <fflush+0x33>
+    }
+  }
+  s->nout = 0;
+    117a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    117d:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  return 0;
+    1184:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1189:	c9                   	leave
+    118a:	c3                   	ret
+
+0000118b <flushall>:
+
+// Flush every stream, or only line-buffered ones.
+static void
+flushall(int lineonly)
+{
+    118b:	55                   	push   %ebp
+    118c:	89 e5                	mov    %esp,%ebp
+    118e:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+    1191:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1198:	eb 41                	jmp    11db <flushall+0x50>
+    if(streams[fd].nout > 0 && (!lineonly || streams[fd].mode == LINEBUF))
+    119a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    119d:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    11a3:	05 a4 19 00 00       	add    $0x19a4,%eax
+    11a8:	8b 00                	mov    (%eax),%eax
+    11aa:	85 c0                	test   %eax,%eax
+    11ac:	7e 29                	jle    11d7 <flushall+0x4c>
+    11ae:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    11b2:	74 15                	je     11c9 <flushall+0x3e>
+    11b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11b7:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    11bd:	05 a0 19 00 00       	add    $0x19a0,%eax
+    11c2:	8b 00                	mov    (%eax),%eax
+    11c4:	83 f8 01             	cmp    $0x1,%eax
+    11c7:	75 0e                	jne    11d7 <flushall+0x4c>
+      fflush(fd);
+    11c9:	83 ec 0c             	sub    $0xc,%esp
+    11cc:	ff 75 f4             	push   -0xc(%ebp)
+    11cf:	e8 24 ff ff ff       	call   10f8 <fflush>
+    11d4:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++)
+    11d7:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    11db:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+    11df:	7e b9                	jle    119a <flushall+0xf>
+}
+    11e1:	90                   	nop
+    11e2:	90                   	nop
+    11e3:	c9                   	leave
+    11e4:	c3                   	ret
+
+000011e5 <fputc>:
+
+int
+fputc(int fd, int c)
+{
+    11e5:	55                   	push   %ebp
+    11e6:	89 e5                	mov    %esp,%ebp
+    11e8:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  char ch;
+
+  if((s = stream(fd)) == 0){
+    11eb:	83 ec 0c             	sub    $0xc,%esp
+    11ee:	ff 75 08             	push   0x8(%ebp)
+    11f1:	e8 92 fe ff ff       	call   1088 <stream>
+    11f6:	83 c4 10             	add    $0x10,%esp
+    11f9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    11fc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1200:	75 2e                	jne    1230 <fputc+0x4b>
+    ch = c;
+    1202:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1205:	88 45 f3             	mov    %al,-0xd(%ebp)
+    return write(fd, &ch, 1) == 1 ? (uchar)c : -1;
+    1208:	83 ec 04             	sub    $0x4,%esp
+    120b:	6a 01                	push   $0x1
+    120d:	8d 45 f3             	lea    -0xd(%ebp),%eax
+    1210:	50                   	push   %eax
+    1211:	ff 75 08             	push   0x8(%ebp)
+    1214:	e8 9f f4 ff ff       	call   6b8 <write>
+    1219:	83 c4 10             	add    $0x10,%esp
+    121c:	83 f8 01             	cmp    $0x1,%eax
+    121f:	75 08                	jne    1229 <fputc+0x44>
+    1221:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1224:	0f b6 c0             	movzbl %al,%eax
+    1227:	eb 5e                	jmp    1287 <fputc+0xa2>
+    1229:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    122e:	eb 57                	jmp    1287 <fputc+0xa2>
+  }
+  s->out[s->nout++] = c;
+    1230:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1233:	8b 40 04             	mov    0x4(%eax),%eax
+    1236:	8d 48 01             	lea    0x1(%eax),%ecx
+    1239:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    123c:	89 4a 04             	mov    %ecx,0x4(%edx)
+    123f:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1242:	89 d1                	mov    %edx,%ecx
+    1244:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1247:	88 4c 02 10          	mov    %cl,0x10(%edx,%eax,1)
+  if(s->nout == BUFSZ || (s->mode == LINEBUF && c == '\n'))
+    124b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    124e:	8b 40 04             	mov    0x4(%eax),%eax
+    1251:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1256:	74 10                	je     1268 <fputc+0x83>
+    1258:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    125b:	8b 00                	mov    (%eax),%eax
+    125d:	83 f8 01             	cmp    $0x1,%eax
+    1260:	75 1f                	jne    1281 <fputc+0x9c>
+    1262:	83 7d 0c 0a          	cmpl   $0xa,0xc(%ebp)
+    1266:	75 19                	jne    1281 <fputc+0x9c>
+    if(fflush(fd) < 0)
+    1268:	83 ec 0c             	sub    $0xc,%esp
+    126b:	ff 75 08             	push   0x8(%ebp)
+    126e:	e8 85 fe ff ff       	call   10f8 <fflush>
+    1273:	83 c4 10             	add    $0x10,%esp
+    1276:	85 c0                	test   %eax,%eax
+    1278:	79 07                	jns    1281 <fputc+0x9c>
+      return -1;
+    127a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    127f:	eb 06                	jmp    1287 <fputc+0xa2>
+  return (uchar)c;
+    1281:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1284:	0f b6 c0             	movzbl %al,%eax
+}
+    1287:	c9                   	leave
+    1288:	c3                   	ret
+
+00001289 <fgetc>:
+
+// Return the next byte read from fd, or -1 at end of file.
+int
+fgetc(int fd)
+{
+    1289:	55                   	push   %ebp
+    128a:	89 e5                	mov    %esp,%ebp
+    128c:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  uchar c;
+  int n;
+
+  if((s = stream(fd)) == 0){
+    128f:	83 ec 0c             	sub    $0xc,%esp
+    1292:	ff 75 08             	push   0x8(%ebp)
+    1295:	e8 ee fd ff ff       	call   1088 <stream>
+    129a:	83 c4 10             	add    $0x10,%esp
+    129d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    12a0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    12a4:	75 39                	jne    12df <fgetc+0x56>
+    flushall(1);
+    12a6:	83 ec 0c             	sub    $0xc,%esp
+    12a9:	6a 01                	push   $0x1
+    12ab:	e8 db fe ff ff       	call   118b <flushall>
+    12b0:	83 c4 10             	add    $0x10,%esp
+    return read(fd, &c, 1) == 1 ? c : -1;
+    12b3:	83 ec 04             	sub    $0x4,%esp
+    12b6:	6a 01                	push   $0x1
+    12b8:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    12bb:	50                   	push   %eax
+    12bc:	ff 75 08             	push   0x8(%ebp)
+    12bf:	e8 e5 f3 ff ff       	call   6a9 <read>
+    12c4:	83 c4 10             	add    $0x10,%esp
+    12c7:	83 f8 01             	cmp    $0x1,%eax
+    12ca:	75 0c                	jne    12d8 <fgetc+0x4f>
+    12cc:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    12d0:	0f b6 c0             	movzbl %al,%eax
+    12d3:	e9 80 00 00 00       	jmp    1358 <fgetc+0xcf>
+    12d8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12dd:	eb 79                	jmp    1358 <fgetc+0xcf>
+  }
+  if(s->rpos == s->rend){
+    12df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12e2:	8b 50 08             	mov    0x8(%eax),%edx
+    12e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12e8:	8b 40 0c             	mov    0xc(%eax),%eax
+    12eb:	39 c2                	cmp    %eax,%edx
+    12ed:	75 4c                	jne    133b <fgetc+0xb2>
+    flushall(1);
+    12ef:	83 ec 0c             	sub    $0xc,%esp
+    12f2:	6a 01                	push   $0x1
+    12f4:	e8 92 fe ff ff       	call   118b <flushall>
+    12f9:	83 c4 10             	add    $0x10,%esp
+    if((n = read(fd, s->in, BUFSZ)) <= 0)
+    12fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12ff:	05 10 02 00 00       	add    $0x210,%eax
+    1304:	83 ec 04             	sub    $0x4,%esp
+    1307:	68 00 02 00 00       	push   $0x200
+    130c:	50                   	push   %eax
+    130d:	ff 75 08             	push   0x8(%ebp)
+    1310:	e8 94 f3 ff ff       	call   6a9 <read>
+    1315:	83 c4 10             	add    $0x10,%esp
+    1318:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    131b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    131f:	7f 07                	jg     1328 <fgetc+0x9f>
+      return -1;
+    1321:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1326:	eb 30                	jmp    1358 <fgetc+0xcf>
+    s->rpos = 0;
+    1328:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    132b:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+    s->rend = n;
+    1332:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1335:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    1338:	89 50 0c             	mov    %edx,0xc(%eax)
+  }
+  return (uchar)s->in[s->rpos++];
+    133b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    133e:	8b 40 08             	mov    0x8(%eax),%eax
+    1341:	8d 48 01             	lea    0x1(%eax),%ecx
+    1344:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1347:	89 4a 08             	mov    %ecx,0x8(%edx)
+    134a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    134d:	0f b6 84 02 10 02 00 	movzbl 0x210(%edx,%eax,1),%eax
+    1354:	00 
+    1355:	0f b6 c0             	movzbl %al,%eax
+}
+    1358:	c9                   	leave
+    1359:	c3                   	ret
+
+0000135a <fork>:
+
+int
+fork(void)
+{
+    135a:	55                   	push   %ebp
+    135b:	89 e5                	mov    %esp,%ebp
+    135d:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1360:	83 ec 0c             	sub    $0xc,%esp
+    1363:	6a 00                	push   $0x0
+    1365:	e8 21 fe ff ff       	call   118b <flushall>
+    136a:	83 c4 10             	add    $0x10,%esp
+  return _fork();
+    136d:	e8 fb f2 ff ff       	call   66d <_fork>
+}
+    1372:	c9                   	leave
+    1373:	c3                   	ret
+
+00001374 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+    1374:	55                   	push   %ebp
+    1375:	89 e5                	mov    %esp,%ebp
+    1377:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    137a:	83 ec 0c             	sub    $0xc,%esp
+    137d:	6a 00                	push   $0x0
+    137f:	e8 07 fe ff ff       	call   118b <flushall>
+    1384:	83 c4 10             	add    $0x10,%esp
+  return _exec(path, argv);
+    1387:	83 ec 08             	sub    $0x8,%esp
+    138a:	ff 75 0c             	push   0xc(%ebp)
+    138d:	ff 75 08             	push   0x8(%ebp)
+    1390:	e8 50 f3 ff ff       	call   6e5 <_exec>
+    1395:	83 c4 10             	add    $0x10,%esp
+}
+    1398:	c9                   	leave
+    1399:	c3                   	ret
+
+0000139a <exit>:
+
+int
+exit(void)
+{
+    139a:	55                   	push   %ebp
+    139b:	89 e5                	mov    %esp,%ebp
+    139d:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    13a0:	83 ec 0c             	sub    $0xc,%esp
+    13a3:	6a 00                	push   $0x0
+    13a5:	e8 e1 fd ff ff       	call   118b <flushall>
+    13aa:	83 c4 10             	add    $0x10,%esp
+  _exit();
+    13ad:	e8 ca f2 ff ff       	call   67c <_exit>
+
+000013b2 <close>:
+}
+
+int
+close(int fd)
+{
+    13b2:	55                   	push   %ebp
+    13b3:	89 e5                	mov    %esp,%ebp
+    13b5:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+
+  if(fd >= 0 && fd < NOFILE){
+    13b8:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    13bc:	78 44                	js     1402 <close+0x50>
+    13be:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    13c2:	7f 3e                	jg     1402 <close+0x50>
+    fflush(fd);
+    13c4:	83 ec 0c             	sub    $0xc,%esp
+    13c7:	ff 75 08             	push   0x8(%ebp)
+    13ca:	e8 29 fd ff ff       	call   10f8 <fflush>
+    13cf:	83 c4 10             	add    $0x10,%esp
+    s = &streams[fd];
+    13d2:	8b 45 08             	mov    0x8(%ebp),%eax
+    13d5:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    13db:	05 a0 19 00 00       	add    $0x19a0,%eax
+    13e0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    s->mode = UNKNOWN;
+    13e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13e6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    s->rpos = s->rend = 0;
+    13ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13ef:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    13f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13f9:	8b 50 0c             	mov    0xc(%eax),%edx
+    13fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13ff:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  return _close(fd);
+    1402:	83 ec 0c             	sub    $0xc,%esp
+    1405:	ff 75 08             	push   0x8(%ebp)
+    1408:	e8 ba f2 ff ff       	call   6c7 <_close>
+    140d:	83 c4 10             	add    $0x10,%esp
+}
+    1410:	c9                   	leave
+    1411:	c3                   	ret
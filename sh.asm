@@ -0,0 +1,4086 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <runcmd>:
+struct cmd *parsecmd(char*);
+
+// Execute cmd.  Never returns.
+void
+runcmd(struct cmd *cmd)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 28             	sub    $0x28,%esp
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+       6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+       a:	75 05                	jne    11 <runcmd+0x11>
+    exit();
+       c:	e8 7d 1f 00 00       	call   1f8e <exit>
+  
+  switch(cmd->type){
+      11:	8b 45 08             	mov    0x8(%ebp),%eax
+      14:	8b 00                	mov    (%eax),%eax
+      16:	83 f8 05             	cmp    $0x5,%eax
+      19:	77 09                	ja     24 <runcmd+0x24>
+      1b:	8b 04 85 34 20 00 00 	mov    0x2034(,%eax,4),%eax
+      22:	ff e0                	jmp    *%eax
+  default:
+    panic("runcmd");
+      24:	83 ec 0c             	sub    $0xc,%esp
+      27:	68 08 20 00 00       	push   $0x2008
+      2c:	e8 6e 03 00 00       	call   39f <panic>
+      31:	83 c4 10             	add    $0x10,%esp
+
+  case EXEC:
+    ecmd = (struct execcmd*)cmd;
+      34:	8b 45 08             	mov    0x8(%ebp),%eax
+      37:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(ecmd->argv[0] == 0)
+      3a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      3d:	8b 40 04             	mov    0x4(%eax),%eax
+      40:	85 c0                	test   %eax,%eax
+      42:	75 05                	jne    49 <runcmd+0x49>
+      exit();
+      44:	e8 45 1f 00 00       	call   1f8e <exit>
+    exec(ecmd->argv[0], ecmd->argv);
+      49:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      4c:	8d 50 04             	lea    0x4(%eax),%edx
+      4f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      52:	8b 40 04             	mov    0x4(%eax),%eax
+      55:	83 ec 08             	sub    $0x8,%esp
+      58:	52                   	push   %edx
+      59:	50                   	push   %eax
+      5a:	e8 09 1f 00 00       	call   1f68 <exec>
+      5f:	83 c4 10             	add    $0x10,%esp
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+      62:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      65:	8b 40 04             	mov    0x4(%eax),%eax
+      68:	83 ec 04             	sub    $0x4,%esp
+      6b:	50                   	push   %eax
+      6c:	68 0f 20 00 00       	push   $0x200f
+      71:	6a 02                	push   $0x2
+      73:	e8 7a 14 00 00       	call   14f2 <printf>
+      78:	83 c4 10             	add    $0x10,%esp
+    break;
+      7b:	e9 c6 01 00 00       	jmp    246 <runcmd+0x246>
+
+  case REDIR:
+    rcmd = (struct redircmd*)cmd;
+      80:	8b 45 08             	mov    0x8(%ebp),%eax
+      83:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    close(rcmd->fd);
+      86:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      89:	8b 40 14             	mov    0x14(%eax),%eax
+      8c:	83 ec 0c             	sub    $0xc,%esp
+      8f:	50                   	push   %eax
+      90:	e8 11 1f 00 00       	call   1fa6 <close>
+      95:	83 c4 10             	add    $0x10,%esp
+    if(open(rcmd->file, rcmd->mode) < 0){
+      98:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      9b:	8b 50 10             	mov    0x10(%eax),%edx
+      9e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      a1:	8b 40 08             	mov    0x8(%eax),%eax
+      a4:	83 ec 08             	sub    $0x8,%esp
+      a7:	52                   	push   %edx
+      a8:	50                   	push   %eax
+      a9:	e8 3a 12 00 00       	call   12e8 <open>
+      ae:	83 c4 10             	add    $0x10,%esp
+      b1:	85 c0                	test   %eax,%eax
+      b3:	79 1e                	jns    d3 <runcmd+0xd3>
+      printf(2, "open %s failed\n", rcmd->file);
+      b5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      b8:	8b 40 08             	mov    0x8(%eax),%eax
+      bb:	83 ec 04             	sub    $0x4,%esp
+      be:	50                   	push   %eax
+      bf:	68 1f 20 00 00       	push   $0x201f
+      c4:	6a 02                	push   $0x2
+      c6:	e8 27 14 00 00       	call   14f2 <printf>
+      cb:	83 c4 10             	add    $0x10,%esp
+      exit();
+      ce:	e8 bb 1e 00 00       	call   1f8e <exit>
+    }
+    runcmd(rcmd->cmd);
+      d3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      d6:	8b 40 04             	mov    0x4(%eax),%eax
+      d9:	83 ec 0c             	sub    $0xc,%esp
+      dc:	50                   	push   %eax
+      dd:	e8 1e ff ff ff       	call   0 <runcmd>
+      e2:	83 c4 10             	add    $0x10,%esp
+    break;
+      e5:	e9 5c 01 00 00       	jmp    246 <runcmd+0x246>
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+      ea:	8b 45 08             	mov    0x8(%ebp),%eax
+      ed:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fork1() == 0)
+      f0:	e8 ca 02 00 00       	call   3bf <fork1>
+      f5:	85 c0                	test   %eax,%eax
+      f7:	75 12                	jne    10b <runcmd+0x10b>
+      runcmd(lcmd->left);
+      f9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+      fc:	8b 40 04             	mov    0x4(%eax),%eax
+      ff:	83 ec 0c             	sub    $0xc,%esp
+     102:	50                   	push   %eax
+     103:	e8 f8 fe ff ff       	call   0 <runcmd>
+     108:	83 c4 10             	add    $0x10,%esp
+    wait();
+     10b:	e8 6f 11 00 00       	call   127f <wait>
+    runcmd(lcmd->right);
+     110:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     113:	8b 40 08             	mov    0x8(%eax),%eax
+     116:	83 ec 0c             	sub    $0xc,%esp
+     119:	50                   	push   %eax
+     11a:	e8 e1 fe ff ff       	call   0 <runcmd>
+     11f:	83 c4 10             	add    $0x10,%esp
+    break;
+     122:	e9 1f 01 00 00       	jmp    246 <runcmd+0x246>
+
+  case PIPE:
+    pcmd = (struct pipecmd*)cmd;
+     127:	8b 45 08             	mov    0x8(%ebp),%eax
+     12a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(pipe(p) < 0)
+     12d:	83 ec 0c             	sub    $0xc,%esp
+     130:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     133:	50                   	push   %eax
+     134:	e8 55 11 00 00       	call   128e <pipe>
+     139:	83 c4 10             	add    $0x10,%esp
+     13c:	85 c0                	test   %eax,%eax
+     13e:	79 10                	jns    150 <runcmd+0x150>
+      panic("pipe");
+     140:	83 ec 0c             	sub    $0xc,%esp
+     143:	68 2f 20 00 00       	push   $0x202f
+     148:	e8 52 02 00 00       	call   39f <panic>
+     14d:	83 c4 10             	add    $0x10,%esp
+    if(fork1() == 0){
+     150:	e8 6a 02 00 00       	call   3bf <fork1>
+     155:	85 c0                	test   %eax,%eax
+     157:	75 4c                	jne    1a5 <runcmd+0x1a5>
+      close(1);
+     159:	83 ec 0c             	sub    $0xc,%esp
+     15c:	6a 01                	push   $0x1
+     15e:	e8 43 1e 00 00       	call   1fa6 <close>
+     163:	83 c4 10             	add    $0x10,%esp
+      dup(p[1]);
+     166:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     169:	83 ec 0c             	sub    $0xc,%esp
+     16c:	50                   	push   %eax
+     16d:	e8 df 11 00 00       	call   1351 <dup>
+     172:	83 c4 10             	add    $0x10,%esp
+      close(p[0]);
+     175:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     178:	83 ec 0c             	sub    $0xc,%esp
+     17b:	50                   	push   %eax
+     17c:	e8 25 1e 00 00       	call   1fa6 <close>
+     181:	83 c4 10             	add    $0x10,%esp
+      close(p[1]);
+     184:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     187:	83 ec 0c             	sub    $0xc,%esp
+     18a:	50                   	push   %eax
+     18b:	e8 16 1e 00 00       	call   1fa6 <close>
+     190:	83 c4 10             	add    $0x10,%esp
+      runcmd(pcmd->left);
+     193:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     196:	8b 40 04             	mov    0x4(%eax),%eax
+     199:	83 ec 0c             	sub    $0xc,%esp
+     19c:	50                   	push   %eax
+     19d:	e8 5e fe ff ff       	call   0 <runcmd>
+     1a2:	83 c4 10             	add    $0x10,%esp
+    }
+    if(fork1() == 0){
+     1a5:	e8 15 02 00 00       	call   3bf <fork1>
+     1aa:	85 c0                	test   %eax,%eax
+     1ac:	75 4c                	jne    1fa <runcmd+0x1fa>
+      close(0);
+     1ae:	83 ec 0c             	sub    $0xc,%esp
+     1b1:	6a 00                	push   $0x0
+     1b3:	e8 ee 1d 00 00       	call   1fa6 <close>
+     1b8:	83 c4 10             	add    $0x10,%esp
+      dup(p[0]);
+     1bb:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     1be:	83 ec 0c             	sub    $0xc,%esp
+     1c1:	50                   	push   %eax
+     1c2:	e8 8a 11 00 00       	call   1351 <dup>
+     1c7:	83 c4 10             	add    $0x10,%esp
+      close(p[0]);
+     1ca:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     1cd:	83 ec 0c             	sub    $0xc,%esp
+     1d0:	50                   	push   %eax
+     1d1:	e8 d0 1d 00 00       	call   1fa6 <close>
+     1d6:	83 c4 10             	add    $0x10,%esp
+      close(p[1]);
+     1d9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     1dc:	83 ec 0c             	sub    $0xc,%esp
+     1df:	50                   	push   %eax
+     1e0:	e8 c1 1d 00 00       	call   1fa6 <close>
+     1e5:	83 c4 10             	add    $0x10,%esp
+      runcmd(pcmd->right);
+     1e8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     1eb:	8b 40 08             	mov    0x8(%eax),%eax
+     1ee:	83 ec 0c             	sub    $0xc,%esp
+     1f1:	50                   	push   %eax
+     1f2:	e8 09 fe ff ff       	call   0 <runcmd>
+     1f7:	83 c4 10             	add    $0x10,%esp
+    }
+    close(p[0]);
+     1fa:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     1fd:	83 ec 0c             	sub    $0xc,%esp
+     200:	50                   	push   %eax
+     201:	e8 a0 1d 00 00       	call   1fa6 <close>
+     206:	83 c4 10             	add    $0x10,%esp
+    close(p[1]);
+     209:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     20c:	83 ec 0c             	sub    $0xc,%esp
+     20f:	50                   	push   %eax
+     210:	e8 91 1d 00 00       	call   1fa6 <close>
+     215:	83 c4 10             	add    $0x10,%esp
+    wait();
+     218:	e8 62 10 00 00       	call   127f <wait>
+    wait();
+     21d:	e8 5d 10 00 00       	call   127f <wait>
+    break;
+     222:	eb 22                	jmp    246 <runcmd+0x246>
+    
+  case BACK:
+    bcmd = (struct backcmd*)cmd;
+     224:	8b 45 08             	mov    0x8(%ebp),%eax
+     227:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fork1() == 0)
+     22a:	e8 90 01 00 00       	call   3bf <fork1>
+     22f:	85 c0                	test   %eax,%eax
+     231:	75 12                	jne    245 <runcmd+0x245>
+      runcmd(bcmd->cmd);
+     233:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     236:	8b 40 04             	mov    0x4(%eax),%eax
+     239:	83 ec 0c             	sub    $0xc,%esp
+     23c:	50                   	push   %eax
+     23d:	e8 be fd ff ff       	call   0 <runcmd>
+     242:	83 c4 10             	add    $0x10,%esp
+    break;
+     245:	90                   	nop
+  }
+  exit();
+     246:	e8 43 1d 00 00       	call   1f8e <exit>
+
+0000024b <getcmd>:
+}
+
+int
+getcmd(char *buf, int nbuf)
+{
+     24b:	55                   	push   %ebp
+     24c:	89 e5                	mov    %esp,%ebp
+     24e:	83 ec 08             	sub    $0x8,%esp
+  printf(2, "$ ");
+     251:	83 ec 08             	sub    $0x8,%esp
+     254:	68 4c 20 00 00       	push   $0x204c
+     259:	6a 02                	push   $0x2
+     25b:	e8 92 12 00 00       	call   14f2 <printf>
+     260:	83 c4 10             	add    $0x10,%esp
+  memset(buf, 0, nbuf);
+     263:	8b 45 0c             	mov    0xc(%ebp),%eax
+     266:	83 ec 04             	sub    $0x4,%esp
+     269:	50                   	push   %eax
+     26a:	6a 00                	push   $0x0
+     26c:	ff 75 08             	push   0x8(%ebp)
+     26f:	e8 f4 0b 00 00       	call   e68 <memset>
+     274:	83 c4 10             	add    $0x10,%esp
+  gets(buf, nbuf);
+     277:	83 ec 08             	sub    $0x8,%esp
+     27a:	ff 75 0c             	push   0xc(%ebp)
+     27d:	ff 75 08             	push   0x8(%ebp)
+     280:	e8 b1 0d 00 00       	call   1036 <gets>
+     285:	83 c4 10             	add    $0x10,%esp
+  if(buf[0] == 0) // EOF
+     288:	8b 45 08             	mov    0x8(%ebp),%eax
+     28b:	0f b6 00             	movzbl (%eax),%eax
+     28e:	84 c0                	test   %al,%al
+     290:	75 07                	jne    299 <getcmd+0x4e>
+    return -1;
+     292:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     297:	eb 05                	jmp    29e <getcmd+0x53>
+  return 0;
+     299:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     29e:	c9                   	leave
+     29f:	c3                   	ret
+
+000002a0 <main>:
+
+int
+main(void)
+{
+     2a0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     2a4:	83 e4 f0             	and    $0xfffffff0,%esp
+     2a7:	ff 71 fc             	push   -0x4(%ecx)
+     2aa:	55                   	push   %ebp
+     2ab:	89 e5                	mov    %esp,%ebp
+     2ad:	51                   	push   %ecx
+     2ae:	83 ec 14             	sub    $0x14,%esp
+  static char buf[100];
+  int fd;
+  
+  // Assumes three file descriptors open.
+  while((fd = open("console", O_RDWR)) >= 0){
+     2b1:	eb 16                	jmp    2c9 <main+0x29>
+    if(fd >= 3){
+     2b3:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+     2b7:	7e 10                	jle    2c9 <main+0x29>
+      close(fd);
+     2b9:	83 ec 0c             	sub    $0xc,%esp
+     2bc:	ff 75 f4             	push   -0xc(%ebp)
+     2bf:	e8 e2 1c 00 00       	call   1fa6 <close>
+     2c4:	83 c4 10             	add    $0x10,%esp
+      break;
+     2c7:	eb 1b                	jmp    2e4 <main+0x44>
+  while((fd = open("console", O_RDWR)) >= 0){
+     2c9:	83 ec 08             	sub    $0x8,%esp
+     2cc:	6a 02                	push   $0x2
+     2ce:	68 4f 20 00 00       	push   $0x204f
+     2d3:	e8 10 10 00 00       	call   12e8 <open>
+     2d8:	83 c4 10             	add    $0x10,%esp
+     2db:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     2de:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     2e2:	79 cf                	jns    2b3 <main+0x13>
+    }
+  }
+  
+  // Read and run input commands.
+  while(getcmd(buf, sizeof(buf)) >= 0){
+     2e4:	e9 97 00 00 00       	jmp    380 <main+0xe0>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+     2e9:	0f b6 05 00 28 00 00 	movzbl 0x2800,%eax
+     2f0:	3c 63                	cmp    $0x63,%al
+     2f2:	75 5f                	jne    353 <main+0xb3>
+     2f4:	0f b6 05 01 28 00 00 	movzbl 0x2801,%eax
+     2fb:	3c 64                	cmp    $0x64,%al
+     2fd:	75 54                	jne    353 <main+0xb3>
+     2ff:	0f b6 05 02 28 00 00 	movzbl 0x2802,%eax
+     306:	3c 20                	cmp    $0x20,%al
+     308:	75 49                	jne    353 <main+0xb3>
+      // Clumsy but will have to do for now.
+      // Chdir has no effect on the parent if run in the child.
+      buf[strlen(buf)-1] = 0;  // chop \n
+     30a:	83 ec 0c             	sub    $0xc,%esp
+     30d:	68 00 28 00 00       	push   $0x2800
+     312:	e8 ca 0a 00 00       	call   de1 <strlen>
+     317:	83 c4 10             	add    $0x10,%esp
+     31a:	83 e8 01             	sub    $0x1,%eax
+     31d:	c6 80 00 28 00 00 00 	movb   $0x0,0x2800(%eax)
+      if(chdir(buf+3) < 0)
+     324:	b8 03 28 00 00       	mov    $0x2803,%eax
+     329:	83 ec 0c             	sub    $0xc,%esp
+     32c:	50                   	push   %eax
+     32d:	e8 10 10 00 00       	call   1342 <chdir>
+     332:	83 c4 10             	add    $0x10,%esp
+     335:	85 c0                	test   %eax,%eax
+     337:	79 46                	jns    37f <main+0xdf>
+        printf(2, "cannot cd %s\n", buf+3);
+     339:	b8 03 28 00 00       	mov    $0x2803,%eax
+     33e:	83 ec 04             	sub    $0x4,%esp
+     341:	50                   	push   %eax
+     342:	68 57 20 00 00       	push   $0x2057
+     347:	6a 02                	push   $0x2
+     349:	e8 a4 11 00 00       	call   14f2 <printf>
+     34e:	83 c4 10             	add    $0x10,%esp
+      continue;
+     351:	eb 2c                	jmp    37f <main+0xdf>
+    }
+    if(fork1() == 0)
+     353:	e8 67 00 00 00       	call   3bf <fork1>
+     358:	85 c0                	test   %eax,%eax
+     35a:	75 1c                	jne    378 <main+0xd8>
+      runcmd(parsecmd(buf));
+     35c:	83 ec 0c             	sub    $0xc,%esp
+     35f:	68 00 28 00 00       	push   $0x2800
+     364:	e8 ad 03 00 00       	call   716 <parsecmd>
+     369:	83 c4 10             	add    $0x10,%esp
+     36c:	83 ec 0c             	sub    $0xc,%esp
+     36f:	50                   	push   %eax
+     370:	e8 8b fc ff ff       	call   0 <runcmd>
+     375:	83 c4 10             	add    $0x10,%esp
+    wait();
+     378:	e8 02 0f 00 00       	call   127f <wait>
+     37d:	eb 01                	jmp    380 <main+0xe0>
+      continue;
+     37f:	90                   	nop
+  while(getcmd(buf, sizeof(buf)) >= 0){
+     380:	83 ec 08             	sub    $0x8,%esp
+     383:	6a 64                	push   $0x64
+     385:	68 00 28 00 00       	push   $0x2800
+     38a:	e8 bc fe ff ff       	call   24b <getcmd>
+     38f:	83 c4 10             	add    $0x10,%esp
+     392:	85 c0                	test   %eax,%eax
+     394:	0f 89 4f ff ff ff    	jns    2e9 <main+0x49>
+  }
+  exit();
+     39a:	e8 ef 1b 00 00       	call   1f8e <exit>
+
+0000039f <panic>:
+}
+
+void
+panic(char *s)
+{
+     39f:	55                   	push   %ebp
+     3a0:	89 e5                	mov    %esp,%ebp
+     3a2:	83 ec 08             	sub    $0x8,%esp
+  printf(2, "%s\n", s);
+     3a5:	83 ec 04             	sub    $0x4,%esp
+     3a8:	ff 75 08             	push   0x8(%ebp)
+     3ab:	68 65 20 00 00       	push   $0x2065
+     3b0:	6a 02                	push   $0x2
+     3b2:	e8 3b 11 00 00       	call   14f2 <printf>
+     3b7:	83 c4 10             	add    $0x10,%esp
+  exit();
+     3ba:	e8 cf 1b 00 00       	call   1f8e <exit>
+
+000003bf <fork1>:
+}
+
+int
+fork1(void)
+{
+     3bf:	55                   	push   %ebp
+     3c0:	89 e5                	mov    %esp,%ebp
+     3c2:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+  
+  pid = fork();
+     3c5:	e8 84 1b 00 00       	call   1f4e <fork>
+     3ca:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid == -1)
+     3cd:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+     3d1:	75 10                	jne    3e3 <fork1+0x24>
+    panic("fork");
+     3d3:	83 ec 0c             	sub    $0xc,%esp
+     3d6:	68 69 20 00 00       	push   $0x2069
+     3db:	e8 bf ff ff ff       	call   39f <panic>
+     3e0:	83 c4 10             	add    $0x10,%esp
+  return pid;
+     3e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     3e6:	c9                   	leave
+     3e7:	c3                   	ret
+
+000003e8 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     3e8:	55                   	push   %ebp
+     3e9:	89 e5                	mov    %esp,%ebp
+     3eb:	83 ec 18             	sub    $0x18,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     3ee:	83 ec 0c             	sub    $0xc,%esp
+     3f1:	6a 54                	push   $0x54
+     3f3:	e8 f9 17 00 00       	call   1bf1 <malloc>
+     3f8:	83 c4 10             	add    $0x10,%esp
+     3fb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+     3fe:	83 ec 04             	sub    $0x4,%esp
+     401:	6a 54                	push   $0x54
+     403:	6a 00                	push   $0x0
+     405:	ff 75 f4             	push   -0xc(%ebp)
+     408:	e8 5b 0a 00 00       	call   e68 <memset>
+     40d:	83 c4 10             	add    $0x10,%esp
+  cmd->type = EXEC;
+     410:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     413:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  return (struct cmd*)cmd;
+     419:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     41c:	c9                   	leave
+     41d:	c3                   	ret
+
+0000041e <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     41e:	55                   	push   %ebp
+     41f:	89 e5                	mov    %esp,%ebp
+     421:	83 ec 18             	sub    $0x18,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     424:	83 ec 0c             	sub    $0xc,%esp
+     427:	6a 18                	push   $0x18
+     429:	e8 c3 17 00 00       	call   1bf1 <malloc>
+     42e:	83 c4 10             	add    $0x10,%esp
+     431:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+     434:	83 ec 04             	sub    $0x4,%esp
+     437:	6a 18                	push   $0x18
+     439:	6a 00                	push   $0x0
+     43b:	ff 75 f4             	push   -0xc(%ebp)
+     43e:	e8 25 0a 00 00       	call   e68 <memset>
+     443:	83 c4 10             	add    $0x10,%esp
+  cmd->type = REDIR;
+     446:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     449:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+  cmd->cmd = subcmd;
+     44f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     452:	8b 55 08             	mov    0x8(%ebp),%edx
+     455:	89 50 04             	mov    %edx,0x4(%eax)
+  cmd->file = file;
+     458:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     45b:	8b 55 0c             	mov    0xc(%ebp),%edx
+     45e:	89 50 08             	mov    %edx,0x8(%eax)
+  cmd->efile = efile;
+     461:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     464:	8b 55 10             	mov    0x10(%ebp),%edx
+     467:	89 50 0c             	mov    %edx,0xc(%eax)
+  cmd->mode = mode;
+     46a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     46d:	8b 55 14             	mov    0x14(%ebp),%edx
+     470:	89 50 10             	mov    %edx,0x10(%eax)
+  cmd->fd = fd;
+     473:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     476:	8b 55 18             	mov    0x18(%ebp),%edx
+     479:	89 50 14             	mov    %edx,0x14(%eax)
+  return (struct cmd*)cmd;
+     47c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     47f:	c9                   	leave
+     480:	c3                   	ret
+
+00000481 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     481:	55                   	push   %ebp
+     482:	89 e5                	mov    %esp,%ebp
+     484:	83 ec 18             	sub    $0x18,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     487:	83 ec 0c             	sub    $0xc,%esp
+     48a:	6a 0c                	push   $0xc
+     48c:	e8 60 17 00 00       	call   1bf1 <malloc>
+     491:	83 c4 10             	add    $0x10,%esp
+     494:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+     497:	83 ec 04             	sub    $0x4,%esp
+     49a:	6a 0c                	push   $0xc
+     49c:	6a 00                	push   $0x0
+     49e:	ff 75 f4             	push   -0xc(%ebp)
+     4a1:	e8 c2 09 00 00       	call   e68 <memset>
+     4a6:	83 c4 10             	add    $0x10,%esp
+  cmd->type = PIPE;
+     4a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4ac:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+  cmd->left = left;
+     4b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4b5:	8b 55 08             	mov    0x8(%ebp),%edx
+     4b8:	89 50 04             	mov    %edx,0x4(%eax)
+  cmd->right = right;
+     4bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4be:	8b 55 0c             	mov    0xc(%ebp),%edx
+     4c1:	89 50 08             	mov    %edx,0x8(%eax)
+  return (struct cmd*)cmd;
+     4c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     4c7:	c9                   	leave
+     4c8:	c3                   	ret
+
+000004c9 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     4c9:	55                   	push   %ebp
+     4ca:	89 e5                	mov    %esp,%ebp
+     4cc:	83 ec 18             	sub    $0x18,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     4cf:	83 ec 0c             	sub    $0xc,%esp
+     4d2:	6a 0c                	push   $0xc
+     4d4:	e8 18 17 00 00       	call   1bf1 <malloc>
+     4d9:	83 c4 10             	add    $0x10,%esp
+     4dc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+     4df:	83 ec 04             	sub    $0x4,%esp
+     4e2:	6a 0c                	push   $0xc
+     4e4:	6a 00                	push   $0x0
+     4e6:	ff 75 f4             	push   -0xc(%ebp)
+     4e9:	e8 7a 09 00 00       	call   e68 <memset>
+     4ee:	83 c4 10             	add    $0x10,%esp
+  cmd->type = LIST;
+     4f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4f4:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+  cmd->left = left;
+     4fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4fd:	8b 55 08             	mov    0x8(%ebp),%edx
+     500:	89 50 04             	mov    %edx,0x4(%eax)
+  cmd->right = right;
+     503:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     506:	8b 55 0c             	mov    0xc(%ebp),%edx
+     509:	89 50 08             	mov    %edx,0x8(%eax)
+  return (struct cmd*)cmd;
+     50c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     50f:	c9                   	leave
+     510:	c3                   	ret
+
+00000511 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     511:	55                   	push   %ebp
+     512:	89 e5                	mov    %esp,%ebp
+     514:	83 ec 18             	sub    $0x18,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     517:	83 ec 0c             	sub    $0xc,%esp
+     51a:	6a 08                	push   $0x8
+     51c:	e8 d0 16 00 00       	call   1bf1 <malloc>
+     521:	83 c4 10             	add    $0x10,%esp
+     524:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+     527:	83 ec 04             	sub    $0x4,%esp
+     52a:	6a 08                	push   $0x8
+     52c:	6a 00                	push   $0x0
+     52e:	ff 75 f4             	push   -0xc(%ebp)
+     531:	e8 32 09 00 00       	call   e68 <memset>
+     536:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+     539:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     53c:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+  cmd->cmd = subcmd;
+     542:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     545:	8b 55 08             	mov    0x8(%ebp),%edx
+     548:	89 50 04             	mov    %edx,0x4(%eax)
+  return (struct cmd*)cmd;
+     54b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     54e:	c9                   	leave
+     54f:	c3                   	ret
+
+00000550 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     550:	55                   	push   %ebp
+     551:	89 e5                	mov    %esp,%ebp
+     553:	83 ec 18             	sub    $0x18,%esp
+  char *s;
+  int ret;
+  
+  s = *ps;
+     556:	8b 45 08             	mov    0x8(%ebp),%eax
+     559:	8b 00                	mov    (%eax),%eax
+     55b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(s < es && strchr(whitespace, *s))
+     55e:	eb 04                	jmp    564 <gettoken+0x14>
+    s++;
+     560:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  while(s < es && strchr(whitespace, *s))
+     564:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     567:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     56a:	73 1e                	jae    58a <gettoken+0x3a>
+     56c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     56f:	0f b6 00             	movzbl (%eax),%eax
+     572:	0f be c0             	movsbl %al,%eax
+     575:	83 ec 08             	sub    $0x8,%esp
+     578:	50                   	push   %eax
+     579:	68 dc 27 00 00       	push   $0x27dc
+     57e:	e8 e3 09 00 00       	call   f66 <strchr>
+     583:	83 c4 10             	add    $0x10,%esp
+     586:	85 c0                	test   %eax,%eax
+     588:	75 d6                	jne    560 <gettoken+0x10>
+  if(q)
+     58a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     58e:	74 08                	je     598 <gettoken+0x48>
+    *q = s;
+     590:	8b 45 10             	mov    0x10(%ebp),%eax
+     593:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     596:	89 10                	mov    %edx,(%eax)
+  ret = *s;
+     598:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     59b:	0f b6 00             	movzbl (%eax),%eax
+     59e:	0f be c0             	movsbl %al,%eax
+     5a1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  switch(*s){
+     5a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5a7:	0f b6 00             	movzbl (%eax),%eax
+     5aa:	0f be c0             	movsbl %al,%eax
+     5ad:	83 f8 7c             	cmp    $0x7c,%eax
+     5b0:	74 2c                	je     5de <gettoken+0x8e>
+     5b2:	83 f8 7c             	cmp    $0x7c,%eax
+     5b5:	7f 48                	jg     5ff <gettoken+0xaf>
+     5b7:	83 f8 3e             	cmp    $0x3e,%eax
+     5ba:	74 28                	je     5e4 <gettoken+0x94>
+     5bc:	83 f8 3e             	cmp    $0x3e,%eax
+     5bf:	7f 3e                	jg     5ff <gettoken+0xaf>
+     5c1:	83 f8 3c             	cmp    $0x3c,%eax
+     5c4:	7f 39                	jg     5ff <gettoken+0xaf>
+     5c6:	83 f8 3b             	cmp    $0x3b,%eax
+     5c9:	7d 13                	jge    5de <gettoken+0x8e>
+     5cb:	83 f8 29             	cmp    $0x29,%eax
+     5ce:	7f 2f                	jg     5ff <gettoken+0xaf>
+     5d0:	83 f8 28             	cmp    $0x28,%eax
+     5d3:	7d 09                	jge    5de <gettoken+0x8e>
+     5d5:	85 c0                	test   %eax,%eax
+     5d7:	74 79                	je     652 <gettoken+0x102>
+     5d9:	83 f8 26             	cmp    $0x26,%eax
+     5dc:	75 21                	jne    5ff <gettoken+0xaf>
+  case '(':
+  case ')':
+  case ';':
+  case '&':
+  case '<':
+    s++;
+     5de:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    break;
+     5e2:	eb 75                	jmp    659 <gettoken+0x109>
+  case '>':
+    s++;
+     5e4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    if(*s == '>'){
+     5e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5eb:	0f b6 00             	movzbl (%eax),%eax
+     5ee:	3c 3e                	cmp    $0x3e,%al
+     5f0:	75 63                	jne    655 <gettoken+0x105>
+      ret = '+';
+     5f2:	c7 45 f0 2b 00 00 00 	movl   $0x2b,-0x10(%ebp)
+      s++;
+     5f9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    }
+    break;
+     5fd:	eb 56                	jmp    655 <gettoken+0x105>
+  default:
+    ret = 'a';
+     5ff:	c7 45 f0 61 00 00 00 	movl   $0x61,-0x10(%ebp)
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     606:	eb 04                	jmp    60c <gettoken+0xbc>
+      s++;
+     608:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     60c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     60f:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     612:	73 44                	jae    658 <gettoken+0x108>
+     614:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     617:	0f b6 00             	movzbl (%eax),%eax
+     61a:	0f be c0             	movsbl %al,%eax
+     61d:	83 ec 08             	sub    $0x8,%esp
+     620:	50                   	push   %eax
+     621:	68 dc 27 00 00       	push   $0x27dc
+     626:	e8 3b 09 00 00       	call   f66 <strchr>
+     62b:	83 c4 10             	add    $0x10,%esp
+     62e:	85 c0                	test   %eax,%eax
+     630:	75 26                	jne    658 <gettoken+0x108>
+     632:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     635:	0f b6 00             	movzbl (%eax),%eax
+     638:	0f be c0             	movsbl %al,%eax
+     63b:	83 ec 08             	sub    $0x8,%esp
+     63e:	50                   	push   %eax
+     63f:	68 e4 27 00 00       	push   $0x27e4
+     644:	e8 1d 09 00 00       	call   f66 <strchr>
+     649:	83 c4 10             	add    $0x10,%esp
+     64c:	85 c0                	test   %eax,%eax
+     64e:	74 b8                	je     608 <gettoken+0xb8>
+    break;
+     650:	eb 06                	jmp    658 <gettoken+0x108>
+    break;
+     652:	90                   	nop
+     653:	eb 04                	jmp    659 <gettoken+0x109>
+    break;
+     655:	90                   	nop
+     656:	eb 01                	jmp    659 <gettoken+0x109>
+    break;
+     658:	90                   	nop
+  }
+  if(eq)
+     659:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     65d:	74 0e                	je     66d <gettoken+0x11d>
+    *eq = s;
+     65f:	8b 45 14             	mov    0x14(%ebp),%eax
+     662:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     665:	89 10                	mov    %edx,(%eax)
+  
+  while(s < es && strchr(whitespace, *s))
+     667:	eb 04                	jmp    66d <gettoken+0x11d>
+    s++;
+     669:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  while(s < es && strchr(whitespace, *s))
+     66d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     670:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     673:	73 1e                	jae    693 <gettoken+0x143>
+     675:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     678:	0f b6 00             	movzbl (%eax),%eax
+     67b:	0f be c0             	movsbl %al,%eax
+     67e:	83 ec 08             	sub    $0x8,%esp
+     681:	50                   	push   %eax
+     682:	68 dc 27 00 00       	push   $0x27dc
+     687:	e8 da 08 00 00       	call   f66 <strchr>
+     68c:	83 c4 10             	add    $0x10,%esp
+     68f:	85 c0                	test   %eax,%eax
+     691:	75 d6                	jne    669 <gettoken+0x119>
+  *ps = s;
+     693:	8b 45 08             	mov    0x8(%ebp),%eax
+     696:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     699:	89 10                	mov    %edx,(%eax)
+  return ret;
+     69b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     69e:	c9                   	leave
+     69f:	c3                   	ret
+
+000006a0 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     6a0:	55                   	push   %ebp
+     6a1:	89 e5                	mov    %esp,%ebp
+     6a3:	83 ec 18             	sub    $0x18,%esp
+  char *s;
+  
+  s = *ps;
+     6a6:	8b 45 08             	mov    0x8(%ebp),%eax
+     6a9:	8b 00                	mov    (%eax),%eax
+     6ab:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(s < es && strchr(whitespace, *s))
+     6ae:	eb 04                	jmp    6b4 <peek+0x14>
+    s++;
+     6b0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  while(s < es && strchr(whitespace, *s))
+     6b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6b7:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     6ba:	73 1e                	jae    6da <peek+0x3a>
+     6bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6bf:	0f b6 00             	movzbl (%eax),%eax
+     6c2:	0f be c0             	movsbl %al,%eax
+     6c5:	83 ec 08             	sub    $0x8,%esp
+     6c8:	50                   	push   %eax
+     6c9:	68 dc 27 00 00       	push   $0x27dc
+     6ce:	e8 93 08 00 00       	call   f66 <strchr>
+     6d3:	83 c4 10             	add    $0x10,%esp
+     6d6:	85 c0                	test   %eax,%eax
+     6d8:	75 d6                	jne    6b0 <peek+0x10>
+  *ps = s;
+     6da:	8b 45 08             	mov    0x8(%ebp),%eax
+     6dd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     6e0:	89 10                	mov    %edx,(%eax)
+  return *s && strchr(toks, *s);
+     6e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6e5:	0f b6 00             	movzbl (%eax),%eax
+     6e8:	84 c0                	test   %al,%al
+     6ea:	74 23                	je     70f <peek+0x6f>
+     6ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6ef:	0f b6 00             	movzbl (%eax),%eax
+     6f2:	0f be c0             	movsbl %al,%eax
+     6f5:	83 ec 08             	sub    $0x8,%esp
+     6f8:	50                   	push   %eax
+     6f9:	ff 75 10             	push   0x10(%ebp)
+     6fc:	e8 65 08 00 00       	call   f66 <strchr>
+     701:	83 c4 10             	add    $0x10,%esp
+     704:	85 c0                	test   %eax,%eax
+     706:	74 07                	je     70f <peek+0x6f>
+     708:	b8 01 00 00 00       	mov    $0x1,%eax
+     70d:	eb 05                	jmp    714 <peek+0x74>
+     70f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     714:	c9                   	leave
+     715:	c3                   	ret
+
+00000716 <parsecmd>:
+struct cmd *parseexec(char**, char*);
+struct cmd *nulterminate(struct cmd*);
+
+struct cmd*
+parsecmd(char *s)
+{
+     716:	55                   	push   %ebp
+     717:	89 e5                	mov    %esp,%ebp
+     719:	53                   	push   %ebx
+     71a:	83 ec 14             	sub    $0x14,%esp
+  char *es;
+  struct cmd *cmd;
+
+  es = s + strlen(s);
+     71d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     720:	8b 45 08             	mov    0x8(%ebp),%eax
+     723:	83 ec 0c             	sub    $0xc,%esp
+     726:	50                   	push   %eax
+     727:	e8 b5 06 00 00       	call   de1 <strlen>
+     72c:	83 c4 10             	add    $0x10,%esp
+     72f:	01 d8                	add    %ebx,%eax
+     731:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  cmd = parseline(&s, es);
+     734:	83 ec 08             	sub    $0x8,%esp
+     737:	ff 75 f4             	push   -0xc(%ebp)
+     73a:	8d 45 08             	lea    0x8(%ebp),%eax
+     73d:	50                   	push   %eax
+     73e:	e8 61 00 00 00       	call   7a4 <parseline>
+     743:	83 c4 10             	add    $0x10,%esp
+     746:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  peek(&s, es, "");
+     749:	83 ec 04             	sub    $0x4,%esp
+     74c:	68 6e 20 00 00       	push   $0x206e
+     751:	ff 75 f4             	push   -0xc(%ebp)
+     754:	8d 45 08             	lea    0x8(%ebp),%eax
+     757:	50                   	push   %eax
+     758:	e8 43 ff ff ff       	call   6a0 <peek>
+     75d:	83 c4 10             	add    $0x10,%esp
+  if(s != es){
+     760:	8b 45 08             	mov    0x8(%ebp),%eax
+     763:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+     766:	74 26                	je     78e <parsecmd+0x78>
+    printf(2, "leftovers: %s\n", s);
+     768:	8b 45 08             	mov    0x8(%ebp),%eax
+     76b:	83 ec 04             	sub    $0x4,%esp
+     76e:	50                   	push   %eax
+     76f:	68 6f 20 00 00       	push   $0x206f
+     774:	6a 02                	push   $0x2
+     776:	e8 77 0d 00 00       	call   14f2 <printf>
+     77b:	83 c4 10             	add    $0x10,%esp
+    panic("syntax");
+     77e:	83 ec 0c             	sub    $0xc,%esp
+     781:	68 7e 20 00 00       	push   $0x207e
+     786:	e8 14 fc ff ff       	call   39f <panic>
+     78b:	83 c4 10             	add    $0x10,%esp
+  }
+  nulterminate(cmd);
+     78e:	83 ec 0c             	sub    $0xc,%esp
+     791:	ff 75 f0             	push   -0x10(%ebp)
+     794:	e8 ef 03 00 00       	call   b88 <nulterminate>
+     799:	83 c4 10             	add    $0x10,%esp
+  return cmd;
+     79c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     79f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7a2:	c9                   	leave
+     7a3:	c3                   	ret
+
+000007a4 <parseline>:
+
+struct cmd*
+parseline(char **ps, char *es)
+{
+     7a4:	55                   	push   %ebp
+     7a5:	89 e5                	mov    %esp,%ebp
+     7a7:	83 ec 18             	sub    $0x18,%esp
+  struct cmd *cmd;
+
+  cmd = parsepipe(ps, es);
+     7aa:	83 ec 08             	sub    $0x8,%esp
+     7ad:	ff 75 0c             	push   0xc(%ebp)
+     7b0:	ff 75 08             	push   0x8(%ebp)
+     7b3:	e8 99 00 00 00       	call   851 <parsepipe>
+     7b8:	83 c4 10             	add    $0x10,%esp
+     7bb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(peek(ps, es, "&")){
+     7be:	eb 23                	jmp    7e3 <parseline+0x3f>
+    gettoken(ps, es, 0, 0);
+     7c0:	6a 00                	push   $0x0
+     7c2:	6a 00                	push   $0x0
+     7c4:	ff 75 0c             	push   0xc(%ebp)
+     7c7:	ff 75 08             	push   0x8(%ebp)
+     7ca:	e8 81 fd ff ff       	call   550 <gettoken>
+     7cf:	83 c4 10             	add    $0x10,%esp
+    cmd = backcmd(cmd);
+     7d2:	83 ec 0c             	sub    $0xc,%esp
+     7d5:	ff 75 f4             	push   -0xc(%ebp)
+     7d8:	e8 34 fd ff ff       	call   511 <backcmd>
+     7dd:	83 c4 10             	add    $0x10,%esp
+     7e0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(peek(ps, es, "&")){
+     7e3:	83 ec 04             	sub    $0x4,%esp
+     7e6:	68 85 20 00 00       	push   $0x2085
+     7eb:	ff 75 0c             	push   0xc(%ebp)
+     7ee:	ff 75 08             	push   0x8(%ebp)
+     7f1:	e8 aa fe ff ff       	call   6a0 <peek>
+     7f6:	83 c4 10             	add    $0x10,%esp
+     7f9:	85 c0                	test   %eax,%eax
+     7fb:	75 c3                	jne    7c0 <parseline+0x1c>
+  }
+  if(peek(ps, es, ";")){
+     7fd:	83 ec 04             	sub    $0x4,%esp
+     800:	68 87 20 00 00       	push   $0x2087
+     805:	ff 75 0c             	push   0xc(%ebp)
+     808:	ff 75 08             	push   0x8(%ebp)
+     80b:	e8 90 fe ff ff       	call   6a0 <peek>
+     810:	83 c4 10             	add    $0x10,%esp
+     813:	85 c0                	test   %eax,%eax
+     815:	74 35                	je     84c <parseline+0xa8>
+    gettoken(ps, es, 0, 0);
+     817:	6a 00                	push   $0x0
+     819:	6a 00                	push   $0x0
+     81b:	ff 75 0c             	push   0xc(%ebp)
+     81e:	ff 75 08             	push   0x8(%ebp)
+     821:	e8 2a fd ff ff       	call   550 <gettoken>
+     826:	83 c4 10             	add    $0x10,%esp
+    cmd = listcmd(cmd, parseline(ps, es));
+     829:	83 ec 08             	sub    $0x8,%esp
+     82c:	ff 75 0c             	push   0xc(%ebp)
+     82f:	ff 75 08             	push   0x8(%ebp)
+     832:	e8 6d ff ff ff       	call   7a4 <parseline>
+     837:	83 c4 10             	add    $0x10,%esp
+     83a:	83 ec 08             	sub    $0x8,%esp
+     83d:	50                   	push   %eax
+     83e:	ff 75 f4             	push   -0xc(%ebp)
+     841:	e8 83 fc ff ff       	call   4c9 <listcmd>
+     846:	83 c4 10             	add    $0x10,%esp
+     849:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  }
+  return cmd;
+     84c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     84f:	c9                   	leave
+     850:	c3                   	ret
+
+00000851 <parsepipe>:
+
+struct cmd*
+parsepipe(char **ps, char *es)
+{
+     851:	55                   	push   %ebp
+     852:	89 e5                	mov    %esp,%ebp
+     854:	83 ec 18             	sub    $0x18,%esp
+  struct cmd *cmd;
+
+  cmd = parseexec(ps, es);
+     857:	83 ec 08             	sub    $0x8,%esp
+     85a:	ff 75 0c             	push   0xc(%ebp)
+     85d:	ff 75 08             	push   0x8(%ebp)
+     860:	e8 f0 01 00 00       	call   a55 <parseexec>
+     865:	83 c4 10             	add    $0x10,%esp
+     868:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(peek(ps, es, "|")){
+     86b:	83 ec 04             	sub    $0x4,%esp
+     86e:	68 89 20 00 00       	push   $0x2089
+     873:	ff 75 0c             	push   0xc(%ebp)
+     876:	ff 75 08             	push   0x8(%ebp)
+     879:	e8 22 fe ff ff       	call   6a0 <peek>
+     87e:	83 c4 10             	add    $0x10,%esp
+     881:	85 c0                	test   %eax,%eax
+     883:	74 35                	je     8ba <parsepipe+0x69>
+    gettoken(ps, es, 0, 0);
+     885:	6a 00                	push   $0x0
+     887:	6a 00                	push   $0x0
+     889:	ff 75 0c             	push   0xc(%ebp)
+     88c:	ff 75 08             	push   0x8(%ebp)
+     88f:	e8 bc fc ff ff       	call   550 <gettoken>
+     894:	83 c4 10             	add    $0x10,%esp
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     897:	83 ec 08             	sub    $0x8,%esp
+     89a:	ff 75 0c             	push   0xc(%ebp)
+     89d:	ff 75 08             	push   0x8(%ebp)
+     8a0:	e8 ac ff ff ff       	call   851 <parsepipe>
+     8a5:	83 c4 10             	add    $0x10,%esp
+     8a8:	83 ec 08             	sub    $0x8,%esp
+     8ab:	50                   	push   %eax
+     8ac:	ff 75 f4             	push   -0xc(%ebp)
+     8af:	e8 cd fb ff ff       	call   481 <pipecmd>
+     8b4:	83 c4 10             	add    $0x10,%esp
+     8b7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  }
+  return cmd;
+     8ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     8bd:	c9                   	leave
+     8be:	c3                   	ret
+
+000008bf <parseredirs>:
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     8bf:	55                   	push   %ebp
+     8c0:	89 e5                	mov    %esp,%ebp
+     8c2:	83 ec 18             	sub    $0x18,%esp
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     8c5:	e9 ba 00 00 00       	jmp    984 <parseredirs+0xc5>
+    tok = gettoken(ps, es, 0, 0);
+     8ca:	6a 00                	push   $0x0
+     8cc:	6a 00                	push   $0x0
+     8ce:	ff 75 10             	push   0x10(%ebp)
+     8d1:	ff 75 0c             	push   0xc(%ebp)
+     8d4:	e8 77 fc ff ff       	call   550 <gettoken>
+     8d9:	83 c4 10             	add    $0x10,%esp
+     8dc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     8df:	8d 45 ec             	lea    -0x14(%ebp),%eax
+     8e2:	50                   	push   %eax
+     8e3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     8e6:	50                   	push   %eax
+     8e7:	ff 75 10             	push   0x10(%ebp)
+     8ea:	ff 75 0c             	push   0xc(%ebp)
+     8ed:	e8 5e fc ff ff       	call   550 <gettoken>
+     8f2:	83 c4 10             	add    $0x10,%esp
+     8f5:	83 f8 61             	cmp    $0x61,%eax
+     8f8:	74 10                	je     90a <parseredirs+0x4b>
+      panic("missing file for redirection");
+     8fa:	83 ec 0c             	sub    $0xc,%esp
+     8fd:	68 8b 20 00 00       	push   $0x208b
+     902:	e8 98 fa ff ff       	call   39f <panic>
+     907:	83 c4 10             	add    $0x10,%esp
+    switch(tok){
+     90a:	83 7d f4 3e          	cmpl   $0x3e,-0xc(%ebp)
+     90e:	74 31                	je     941 <parseredirs+0x82>
+     910:	83 7d f4 3e          	cmpl   $0x3e,-0xc(%ebp)
+     914:	7f 6e                	jg     984 <parseredirs+0xc5>
+     916:	83 7d f4 2b          	cmpl   $0x2b,-0xc(%ebp)
+     91a:	74 47                	je     963 <parseredirs+0xa4>
+     91c:	83 7d f4 3c          	cmpl   $0x3c,-0xc(%ebp)
+     920:	75 62                	jne    984 <parseredirs+0xc5>
+    case '<':
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     922:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     925:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     928:	83 ec 0c             	sub    $0xc,%esp
+     92b:	6a 00                	push   $0x0
+     92d:	6a 00                	push   $0x0
+     92f:	52                   	push   %edx
+     930:	50                   	push   %eax
+     931:	ff 75 08             	push   0x8(%ebp)
+     934:	e8 e5 fa ff ff       	call   41e <redircmd>
+     939:	83 c4 20             	add    $0x20,%esp
+     93c:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     93f:	eb 43                	jmp    984 <parseredirs+0xc5>
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     941:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     944:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     947:	83 ec 0c             	sub    $0xc,%esp
+     94a:	6a 01                	push   $0x1
+     94c:	68 01 02 00 00       	push   $0x201
+     951:	52                   	push   %edx
+     952:	50                   	push   %eax
+     953:	ff 75 08             	push   0x8(%ebp)
+     956:	e8 c3 fa ff ff       	call   41e <redircmd>
+     95b:	83 c4 20             	add    $0x20,%esp
+     95e:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     961:	eb 21                	jmp    984 <parseredirs+0xc5>
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     963:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     966:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     969:	83 ec 0c             	sub    $0xc,%esp
+     96c:	6a 01                	push   $0x1
+     96e:	68 01 02 00 00       	push   $0x201
+     973:	52                   	push   %edx
+     974:	50                   	push   %eax
+     975:	ff 75 08             	push   0x8(%ebp)
+     978:	e8 a1 fa ff ff       	call   41e <redircmd>
+     97d:	83 c4 20             	add    $0x20,%esp
+     980:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     983:	90                   	nop
+  while(peek(ps, es, "<>")){
+     984:	83 ec 04             	sub    $0x4,%esp
+     987:	68 a8 20 00 00       	push   $0x20a8
+     98c:	ff 75 10             	push   0x10(%ebp)
+     98f:	ff 75 0c             	push   0xc(%ebp)
+     992:	e8 09 fd ff ff       	call   6a0 <peek>
+     997:	83 c4 10             	add    $0x10,%esp
+     99a:	85 c0                	test   %eax,%eax
+     99c:	0f 85 28 ff ff ff    	jne    8ca <parseredirs+0xb>
+    }
+  }
+  return cmd;
+     9a2:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     9a5:	c9                   	leave
+     9a6:	c3                   	ret
+
+000009a7 <parseblock>:
+
+struct cmd*
+parseblock(char **ps, char *es)
+{
+     9a7:	55                   	push   %ebp
+     9a8:	89 e5                	mov    %esp,%ebp
+     9aa:	83 ec 18             	sub    $0x18,%esp
+  struct cmd *cmd;
+
+  if(!peek(ps, es, "("))
+     9ad:	83 ec 04             	sub    $0x4,%esp
+     9b0:	68 ab 20 00 00       	push   $0x20ab
+     9b5:	ff 75 0c             	push   0xc(%ebp)
+     9b8:	ff 75 08             	push   0x8(%ebp)
+     9bb:	e8 e0 fc ff ff       	call   6a0 <peek>
+     9c0:	83 c4 10             	add    $0x10,%esp
+     9c3:	85 c0                	test   %eax,%eax
+     9c5:	75 10                	jne    9d7 <parseblock+0x30>
+    panic("parseblock");
+     9c7:	83 ec 0c             	sub    $0xc,%esp
+     9ca:	68 ad 20 00 00       	push   $0x20ad
+     9cf:	e8 cb f9 ff ff       	call   39f <panic>
+     9d4:	83 c4 10             	add    $0x10,%esp
+  gettoken(ps, es, 0, 0);
+     9d7:	6a 00                	push   $0x0
+     9d9:	6a 00                	push   $0x0
+     9db:	ff 75 0c             	push   0xc(%ebp)
+     9de:	ff 75 08             	push   0x8(%ebp)
+     9e1:	e8 6a fb ff ff       	call   550 <gettoken>
+     9e6:	83 c4 10             	add    $0x10,%esp
+  cmd = parseline(ps, es);
+     9e9:	83 ec 08             	sub    $0x8,%esp
+     9ec:	ff 75 0c             	push   0xc(%ebp)
+     9ef:	ff 75 08             	push   0x8(%ebp)
+     9f2:	e8 ad fd ff ff       	call   7a4 <parseline>
+     9f7:	83 c4 10             	add    $0x10,%esp
+     9fa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(!peek(ps, es, ")"))
+     9fd:	83 ec 04             	sub    $0x4,%esp
+     a00:	68 b8 20 00 00       	push   $0x20b8
+     a05:	ff 75 0c             	push   0xc(%ebp)
+     a08:	ff 75 08             	push   0x8(%ebp)
+     a0b:	e8 90 fc ff ff       	call   6a0 <peek>
+     a10:	83 c4 10             	add    $0x10,%esp
+     a13:	85 c0                	test   %eax,%eax
+     a15:	75 10                	jne    a27 <parseblock+0x80>
+    panic("syntax - missing )");
+     a17:	83 ec 0c             	sub    $0xc,%esp
+     a1a:	68 ba 20 00 00       	push   $0x20ba
+     a1f:	e8 7b f9 ff ff       	call   39f <panic>
+     a24:	83 c4 10             	add    $0x10,%esp
+  gettoken(ps, es, 0, 0);
+     a27:	6a 00                	push   $0x0
+     a29:	6a 00                	push   $0x0
+     a2b:	ff 75 0c             	push   0xc(%ebp)
+     a2e:	ff 75 08             	push   0x8(%ebp)
+     a31:	e8 1a fb ff ff       	call   550 <gettoken>
+     a36:	83 c4 10             	add    $0x10,%esp
+  cmd = parseredirs(cmd, ps, es);
+     a39:	83 ec 04             	sub    $0x4,%esp
+     a3c:	ff 75 0c             	push   0xc(%ebp)
+     a3f:	ff 75 08             	push   0x8(%ebp)
+     a42:	ff 75 f4             	push   -0xc(%ebp)
+     a45:	e8 75 fe ff ff       	call   8bf <parseredirs>
+     a4a:	83 c4 10             	add    $0x10,%esp
+     a4d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  return cmd;
+     a50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     a53:	c9                   	leave
+     a54:	c3                   	ret
+
+00000a55 <parseexec>:
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     a55:	55                   	push   %ebp
+     a56:	89 e5                	mov    %esp,%ebp
+     a58:	83 ec 28             	sub    $0x28,%esp
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+  
+  if(peek(ps, es, "("))
+     a5b:	83 ec 04             	sub    $0x4,%esp
+     a5e:	68 ab 20 00 00       	push   $0x20ab
+     a63:	ff 75 0c             	push   0xc(%ebp)
+     a66:	ff 75 08             	push   0x8(%ebp)
+     a69:	e8 32 fc ff ff       	call   6a0 <peek>
+     a6e:	83 c4 10             	add    $0x10,%esp
+     a71:	85 c0                	test   %eax,%eax
+     a73:	74 16                	je     a8b <parseexec+0x36>
+    return parseblock(ps, es);
+     a75:	83 ec 08             	sub    $0x8,%esp
+     a78:	ff 75 0c             	push   0xc(%ebp)
+     a7b:	ff 75 08             	push   0x8(%ebp)
+     a7e:	e8 24 ff ff ff       	call   9a7 <parseblock>
+     a83:	83 c4 10             	add    $0x10,%esp
+     a86:	e9 fb 00 00 00       	jmp    b86 <parseexec+0x131>
+
+  ret = execcmd();
+     a8b:	e8 58 f9 ff ff       	call   3e8 <execcmd>
+     a90:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  cmd = (struct execcmd*)ret;
+     a93:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a96:	89 45 ec             	mov    %eax,-0x14(%ebp)
+
+  argc = 0;
+     a99:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  ret = parseredirs(ret, ps, es);
+     aa0:	83 ec 04             	sub    $0x4,%esp
+     aa3:	ff 75 0c             	push   0xc(%ebp)
+     aa6:	ff 75 08             	push   0x8(%ebp)
+     aa9:	ff 75 f0             	push   -0x10(%ebp)
+     aac:	e8 0e fe ff ff       	call   8bf <parseredirs>
+     ab1:	83 c4 10             	add    $0x10,%esp
+     ab4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     ab7:	e9 87 00 00 00       	jmp    b43 <parseexec+0xee>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     abc:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     abf:	50                   	push   %eax
+     ac0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     ac3:	50                   	push   %eax
+     ac4:	ff 75 0c             	push   0xc(%ebp)
+     ac7:	ff 75 08             	push   0x8(%ebp)
+     aca:	e8 81 fa ff ff       	call   550 <gettoken>
+     acf:	83 c4 10             	add    $0x10,%esp
+     ad2:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     ad5:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     ad9:	0f 84 84 00 00 00    	je     b63 <parseexec+0x10e>
+      break;
+    if(tok != 'a')
+     adf:	83 7d e8 61          	cmpl   $0x61,-0x18(%ebp)
+     ae3:	74 10                	je     af5 <parseexec+0xa0>
+      panic("syntax");
+     ae5:	83 ec 0c             	sub    $0xc,%esp
+     ae8:	68 7e 20 00 00       	push   $0x207e
+     aed:	e8 ad f8 ff ff       	call   39f <panic>
+     af2:	83 c4 10             	add    $0x10,%esp
+    cmd->argv[argc] = q;
+     af5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     af8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     afb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     afe:	89 4c 90 04          	mov    %ecx,0x4(%eax,%edx,4)
+    cmd->eargv[argc] = eq;
+     b02:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     b05:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b08:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+     b0b:	83 c1 08             	add    $0x8,%ecx
+     b0e:	89 54 88 0c          	mov    %edx,0xc(%eax,%ecx,4)
+    argc++;
+     b12:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    if(argc >= MAXARGS)
+     b16:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+     b1a:	7e 10                	jle    b2c <parseexec+0xd7>
+      panic("too many args");
+     b1c:	83 ec 0c             	sub    $0xc,%esp
+     b1f:	68 cd 20 00 00       	push   $0x20cd
+     b24:	e8 76 f8 ff ff       	call   39f <panic>
+     b29:	83 c4 10             	add    $0x10,%esp
+    ret = parseredirs(ret, ps, es);
+     b2c:	83 ec 04             	sub    $0x4,%esp
+     b2f:	ff 75 0c             	push   0xc(%ebp)
+     b32:	ff 75 08             	push   0x8(%ebp)
+     b35:	ff 75 f0             	push   -0x10(%ebp)
+     b38:	e8 82 fd ff ff       	call   8bf <parseredirs>
+     b3d:	83 c4 10             	add    $0x10,%esp
+     b40:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     b43:	83 ec 04             	sub    $0x4,%esp
+     b46:	68 db 20 00 00       	push   $0x20db
+     b4b:	ff 75 0c             	push   0xc(%ebp)
+     b4e:	ff 75 08             	push   0x8(%ebp)
+     b51:	e8 4a fb ff ff       	call   6a0 <peek>
+     b56:	83 c4 10             	add    $0x10,%esp
+     b59:	85 c0                	test   %eax,%eax
+     b5b:	0f 84 5b ff ff ff    	je     abc <parseexec+0x67>
+     b61:	eb 01                	jmp    b64 <parseexec+0x10f>
+      break;
+     b63:	90                   	nop
+  }
+  cmd->argv[argc] = 0;
+     b64:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b67:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     b6a:	c7 44 90 04 00 00 00 	movl   $0x0,0x4(%eax,%edx,4)
+     b71:	00 
+  cmd->eargv[argc] = 0;
+     b72:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b75:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     b78:	83 c2 08             	add    $0x8,%edx
+     b7b:	c7 44 90 0c 00 00 00 	movl   $0x0,0xc(%eax,%edx,4)
+     b82:	00 
+  return ret;
+     b83:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     b86:	c9                   	leave
+     b87:	c3                   	ret
+
+00000b88 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     b88:	55                   	push   %ebp
+     b89:	89 e5                	mov    %esp,%ebp
+     b8b:	83 ec 28             	sub    $0x28,%esp
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     b8e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     b92:	75 0a                	jne    b9e <nulterminate+0x16>
+    return 0;
+     b94:	b8 00 00 00 00       	mov    $0x0,%eax
+     b99:	e9 e4 00 00 00       	jmp    c82 <nulterminate+0xfa>
+  
+  switch(cmd->type){
+     b9e:	8b 45 08             	mov    0x8(%ebp),%eax
+     ba1:	8b 00                	mov    (%eax),%eax
+     ba3:	83 f8 05             	cmp    $0x5,%eax
+     ba6:	0f 87 d3 00 00 00    	ja     c7f <nulterminate+0xf7>
+     bac:	8b 04 85 e0 20 00 00 	mov    0x20e0(,%eax,4),%eax
+     bb3:	ff e0                	jmp    *%eax
+  case EXEC:
+    ecmd = (struct execcmd*)cmd;
+     bb5:	8b 45 08             	mov    0x8(%ebp),%eax
+     bb8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    for(i=0; ecmd->argv[i]; i++)
+     bbb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     bc2:	eb 14                	jmp    bd8 <nulterminate+0x50>
+      *ecmd->eargv[i] = 0;
+     bc4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     bc7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     bca:	83 c2 08             	add    $0x8,%edx
+     bcd:	8b 44 90 0c          	mov    0xc(%eax,%edx,4),%eax
+     bd1:	c6 00 00             	movb   $0x0,(%eax)
+    for(i=0; ecmd->argv[i]; i++)
+     bd4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     bd8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     bdb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     bde:	8b 44 90 04          	mov    0x4(%eax,%edx,4),%eax
+     be2:	85 c0                	test   %eax,%eax
+     be4:	75 de                	jne    bc4 <nulterminate+0x3c>
+    break;
+     be6:	e9 94 00 00 00       	jmp    c7f <nulterminate+0xf7>
+
+  case REDIR:
+    rcmd = (struct redircmd*)cmd;
+     beb:	8b 45 08             	mov    0x8(%ebp),%eax
+     bee:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    nulterminate(rcmd->cmd);
+     bf1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     bf4:	8b 40 04             	mov    0x4(%eax),%eax
+     bf7:	83 ec 0c             	sub    $0xc,%esp
+     bfa:	50                   	push   %eax
+     bfb:	e8 88 ff ff ff       	call   b88 <nulterminate>
+     c00:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+     c03:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c06:	8b 40 0c             	mov    0xc(%eax),%eax
+     c09:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     c0c:	eb 71                	jmp    c7f <nulterminate+0xf7>
+
+  case PIPE:
+    pcmd = (struct pipecmd*)cmd;
+     c0e:	8b 45 08             	mov    0x8(%ebp),%eax
+     c11:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    nulterminate(pcmd->left);
+     c14:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c17:	8b 40 04             	mov    0x4(%eax),%eax
+     c1a:	83 ec 0c             	sub    $0xc,%esp
+     c1d:	50                   	push   %eax
+     c1e:	e8 65 ff ff ff       	call   b88 <nulterminate>
+     c23:	83 c4 10             	add    $0x10,%esp
+    nulterminate(pcmd->right);
+     c26:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c29:	8b 40 08             	mov    0x8(%eax),%eax
+     c2c:	83 ec 0c             	sub    $0xc,%esp
+     c2f:	50                   	push   %eax
+     c30:	e8 53 ff ff ff       	call   b88 <nulterminate>
+     c35:	83 c4 10             	add    $0x10,%esp
+    break;
+     c38:	eb 45                	jmp    c7f <nulterminate+0xf7>
+    
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+     c3a:	8b 45 08             	mov    0x8(%ebp),%eax
+     c3d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    nulterminate(lcmd->left);
+     c40:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     c43:	8b 40 04             	mov    0x4(%eax),%eax
+     c46:	83 ec 0c             	sub    $0xc,%esp
+     c49:	50                   	push   %eax
+     c4a:	e8 39 ff ff ff       	call   b88 <nulterminate>
+     c4f:	83 c4 10             	add    $0x10,%esp
+    nulterminate(lcmd->right);
+     c52:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     c55:	8b 40 08             	mov    0x8(%eax),%eax
+     c58:	83 ec 0c             	sub    $0xc,%esp
+     c5b:	50                   	push   %eax
+     c5c:	e8 27 ff ff ff       	call   b88 <nulterminate>
+     c61:	83 c4 10             	add    $0x10,%esp
+    break;
+     c64:	eb 19                	jmp    c7f <nulterminate+0xf7>
+
+  case BACK:
+    bcmd = (struct backcmd*)cmd;
+     c66:	8b 45 08             	mov    0x8(%ebp),%eax
+     c69:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    nulterminate(bcmd->cmd);
+     c6c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c6f:	8b 40 04             	mov    0x4(%eax),%eax
+     c72:	83 ec 0c             	sub    $0xc,%esp
+     c75:	50                   	push   %eax
+     c76:	e8 0d ff ff ff       	call   b88 <nulterminate>
+     c7b:	83 c4 10             	add    $0x10,%esp
+    break;
+     c7e:	90                   	nop
+  }
+  return cmd;
+     c7f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     c82:	c9                   	leave
+     c83:	c3                   	ret
+
+00000c84 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+     c84:	55                   	push   %ebp
+     c85:	89 e5                	mov    %esp,%ebp
+     c87:	57                   	push   %edi
+     c88:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+     c89:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     c8c:	8b 55 10             	mov    0x10(%ebp),%edx
+     c8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c92:	89 cb                	mov    %ecx,%ebx
+     c94:	89 df                	mov    %ebx,%edi
+     c96:	89 d1                	mov    %edx,%ecx
+     c98:	fc                   	cld
+     c99:	f3 aa                	rep stos %al,%es:(%edi)
+     c9b:	89 ca                	mov    %ecx,%edx
+     c9d:	89 fb                	mov    %edi,%ebx
+     c9f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     ca2:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     ca5:	90                   	nop
+     ca6:	5b                   	pop    %ebx
+     ca7:	5f                   	pop    %edi
+     ca8:	5d                   	pop    %ebp
+     ca9:	c3                   	ret
+
+00000caa <stosl>:
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+     caa:	55                   	push   %ebp
+     cab:	89 e5                	mov    %esp,%ebp
+     cad:	57                   	push   %edi
+     cae:	53                   	push   %ebx
+  asm volatile("cld; rep stosl" :
+     caf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     cb2:	8b 55 10             	mov    0x10(%ebp),%edx
+     cb5:	8b 45 0c             	mov    0xc(%ebp),%eax
+     cb8:	89 cb                	mov    %ecx,%ebx
+     cba:	89 df                	mov    %ebx,%edi
+     cbc:	89 d1                	mov    %edx,%ecx
+     cbe:	fc                   	cld
+     cbf:	f3 ab                	rep stos %eax,%es:(%edi)
+     cc1:	89 ca                	mov    %ecx,%edx
+     cc3:	89 fb                	mov    %edi,%ebx
+     cc5:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     cc8:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     ccb:	90                   	nop
+     ccc:	5b                   	pop    %ebx
+     ccd:	5f                   	pop    %edi
+     cce:	5d                   	pop    %ebp
+     ccf:	c3                   	ret
+
+00000cd0 <movsb>:
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+     cd0:	55                   	push   %ebp
+     cd1:	89 e5                	mov    %esp,%ebp
+     cd3:	57                   	push   %edi
+     cd4:	56                   	push   %esi
+     cd5:	53                   	push   %ebx
+  asm volatile("cld; rep movsb" :
+     cd6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     cd9:	8b 55 0c             	mov    0xc(%ebp),%edx
+     cdc:	8b 45 10             	mov    0x10(%ebp),%eax
+     cdf:	89 cb                	mov    %ecx,%ebx
+     ce1:	89 df                	mov    %ebx,%edi
+     ce3:	89 d6                	mov    %edx,%esi
+     ce5:	89 c1                	mov    %eax,%ecx
+     ce7:	fc                   	cld
+     ce8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     cea:	89 c8                	mov    %ecx,%eax
+     cec:	89 f2                	mov    %esi,%edx
+     cee:	89 fb                	mov    %edi,%ebx
+     cf0:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     cf3:	89 55 0c             	mov    %edx,0xc(%ebp)
+     cf6:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     cf9:	90                   	nop
+     cfa:	5b                   	pop    %ebx
+     cfb:	5e                   	pop    %esi
+     cfc:	5f                   	pop    %edi
+     cfd:	5d                   	pop    %ebp
+     cfe:	c3                   	ret
+
+00000cff <movsl>:
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+     cff:	55                   	push   %ebp
+     d00:	89 e5                	mov    %esp,%ebp
+     d02:	57                   	push   %edi
+     d03:	56                   	push   %esi
+     d04:	53                   	push   %ebx
+  asm volatile("cld; rep movsl" :
+     d05:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     d08:	8b 55 0c             	mov    0xc(%ebp),%edx
+     d0b:	8b 45 10             	mov    0x10(%ebp),%eax
+     d0e:	89 cb                	mov    %ecx,%ebx
+     d10:	89 df                	mov    %ebx,%edi
+     d12:	89 d6                	mov    %edx,%esi
+     d14:	89 c1                	mov    %eax,%ecx
+     d16:	fc                   	cld
+     d17:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     d19:	89 c8                	mov    %ecx,%eax
+     d1b:	89 f2                	mov    %esi,%edx
+     d1d:	89 fb                	mov    %edi,%ebx
+     d1f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     d22:	89 55 0c             	mov    %edx,0xc(%ebp)
+     d25:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     d28:	90                   	nop
+     d29:	5b                   	pop    %ebx
+     d2a:	5e                   	pop    %esi
+     d2b:	5f                   	pop    %edi
+     d2c:	5d                   	pop    %ebp
+     d2d:	c3                   	ret
+
+00000d2e <strcpy>:
+#define ONES        0x01010101
+#define HASZERO(x)  (((x) - ONES) & ~(x) & (ONES << 7))
+
+char*
+strcpy(char *s, char *t)
+{
+     d2e:	55                   	push   %ebp
+     d2f:	89 e5                	mov    %esp,%ebp
+     d31:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+     d34:	8b 45 08             	mov    0x8(%ebp),%eax
+     d37:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     d3a:	90                   	nop
+     d3b:	8b 55 0c             	mov    0xc(%ebp),%edx
+     d3e:	8d 42 01             	lea    0x1(%edx),%eax
+     d41:	89 45 0c             	mov    %eax,0xc(%ebp)
+     d44:	8b 45 08             	mov    0x8(%ebp),%eax
+     d47:	8d 48 01             	lea    0x1(%eax),%ecx
+     d4a:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     d4d:	0f b6 12             	movzbl (%edx),%edx
+     d50:	88 10                	mov    %dl,(%eax)
+     d52:	0f b6 00             	movzbl (%eax),%eax
+     d55:	84 c0                	test   %al,%al
+     d57:	75 e2                	jne    d3b <strcpy+0xd>
+    ;
+  return os;
+     d59:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     d5c:	c9                   	leave
+     d5d:	c3                   	ret
+
+00000d5e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     d5e:	55                   	push   %ebp
+     d5f:	89 e5                	mov    %esp,%ebp
+  // Aligned words never straddle a page, so reading
+  // whole ones past the end of a string is safe.
+  if((((uint)p | (uint)q) & 3) == 0)
+     d61:	8b 55 08             	mov    0x8(%ebp),%edx
+     d64:	8b 45 0c             	mov    0xc(%ebp),%eax
+     d67:	09 d0                	or     %edx,%eax
+     d69:	83 e0 03             	and    $0x3,%eax
+     d6c:	85 c0                	test   %eax,%eax
+     d6e:	75 3f                	jne    daf <strcmp+0x51>
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     d70:	eb 08                	jmp    d7a <strcmp+0x1c>
+      p += 4, q += 4;
+     d72:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     d76:	83 45 0c 04          	addl   $0x4,0xc(%ebp)
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     d7a:	8b 45 08             	mov    0x8(%ebp),%eax
+     d7d:	8b 10                	mov    (%eax),%edx
+     d7f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     d82:	8b 00                	mov    (%eax),%eax
+     d84:	39 c2                	cmp    %eax,%edx
+     d86:	75 27                	jne    daf <strcmp+0x51>
+     d88:	8b 45 08             	mov    0x8(%ebp),%eax
+     d8b:	8b 00                	mov    (%eax),%eax
+     d8d:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     d93:	8b 45 08             	mov    0x8(%ebp),%eax
+     d96:	8b 00                	mov    (%eax),%eax
+     d98:	f7 d0                	not    %eax
+     d9a:	21 d0                	and    %edx,%eax
+     d9c:	25 80 80 80 80       	and    $0x80808080,%eax
+     da1:	85 c0                	test   %eax,%eax
+     da3:	74 cd                	je     d72 <strcmp+0x14>
+  while(*p && *p == *q)
+     da5:	eb 08                	jmp    daf <strcmp+0x51>
+    p++, q++;
+     da7:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     dab:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     daf:	8b 45 08             	mov    0x8(%ebp),%eax
+     db2:	0f b6 00             	movzbl (%eax),%eax
+     db5:	84 c0                	test   %al,%al
+     db7:	74 10                	je     dc9 <strcmp+0x6b>
+     db9:	8b 45 08             	mov    0x8(%ebp),%eax
+     dbc:	0f b6 10             	movzbl (%eax),%edx
+     dbf:	8b 45 0c             	mov    0xc(%ebp),%eax
+     dc2:	0f b6 00             	movzbl (%eax),%eax
+     dc5:	38 c2                	cmp    %al,%dl
+     dc7:	74 de                	je     da7 <strcmp+0x49>
+  return (uchar)*p - (uchar)*q;
+     dc9:	8b 45 08             	mov    0x8(%ebp),%eax
+     dcc:	0f b6 00             	movzbl (%eax),%eax
+     dcf:	0f b6 d0             	movzbl %al,%edx
+     dd2:	8b 45 0c             	mov    0xc(%ebp),%eax
+     dd5:	0f b6 00             	movzbl (%eax),%eax
+     dd8:	0f b6 c0             	movzbl %al,%eax
+     ddb:	29 c2                	sub    %eax,%edx
+     ddd:	89 d0                	mov    %edx,%eax
+}
+     ddf:	5d                   	pop    %ebp
+     de0:	c3                   	ret
+
+00000de1 <strlen>:
+
+uint
+strlen(char *s)
+{
+     de1:	55                   	push   %ebp
+     de2:	89 e5                	mov    %esp,%ebp
+     de4:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; ((uint)(s+n) & 3) && s[n]; n++)
+     de7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     dee:	eb 04                	jmp    df4 <strlen+0x13>
+     df0:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     df4:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     df7:	8b 45 08             	mov    0x8(%ebp),%eax
+     dfa:	01 d0                	add    %edx,%eax
+     dfc:	83 e0 03             	and    $0x3,%eax
+     dff:	85 c0                	test   %eax,%eax
+     e01:	74 0f                	je     e12 <strlen+0x31>
+     e03:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     e06:	8b 45 08             	mov    0x8(%ebp),%eax
+     e09:	01 d0                	add    %edx,%eax
+     e0b:	0f b6 00             	movzbl (%eax),%eax
+     e0e:	84 c0                	test   %al,%al
+     e10:	75 de                	jne    df0 <strlen+0xf>
+    ;
+  if(s[n])
+     e12:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     e15:	8b 45 08             	mov    0x8(%ebp),%eax
+     e18:	01 d0                	add    %edx,%eax
+     e1a:	0f b6 00             	movzbl (%eax),%eax
+     e1d:	84 c0                	test   %al,%al
+     e1f:	74 33                	je     e54 <strlen+0x73>
+    while(!HASZERO(*(uint*)(s+n)))
+     e21:	eb 04                	jmp    e27 <strlen+0x46>
+      n += 4;
+     e23:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+    while(!HASZERO(*(uint*)(s+n)))
+     e27:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     e2a:	8b 45 08             	mov    0x8(%ebp),%eax
+     e2d:	01 d0                	add    %edx,%eax
+     e2f:	8b 00                	mov    (%eax),%eax
+     e31:	8d 88 ff fe fe fe    	lea    -0x1010101(%eax),%ecx
+     e37:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     e3a:	8b 45 08             	mov    0x8(%ebp),%eax
+     e3d:	01 d0                	add    %edx,%eax
+     e3f:	8b 00                	mov    (%eax),%eax
+     e41:	f7 d0                	not    %eax
+     e43:	21 c8                	and    %ecx,%eax
+     e45:	25 80 80 80 80       	and    $0x80808080,%eax
+     e4a:	85 c0                	test   %eax,%eax
+     e4c:	74 d5                	je     e23 <strlen+0x42>
+  for(; s[n]; n++)
+     e4e:	eb 04                	jmp    e54 <strlen+0x73>
+     e50:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     e54:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     e57:	8b 45 08             	mov    0x8(%ebp),%eax
+     e5a:	01 d0                	add    %edx,%eax
+     e5c:	0f b6 00             	movzbl (%eax),%eax
+     e5f:	84 c0                	test   %al,%al
+     e61:	75 ed                	jne    e50 <strlen+0x6f>
+    ;
+  return n;
+     e63:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     e66:	c9                   	leave
+     e67:	c3                   	ret
+
+00000e68 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     e68:	55                   	push   %ebp
+     e69:	89 e5                	mov    %esp,%ebp
+     e6b:	83 ec 10             	sub    $0x10,%esp
+  char *d;
+  uint k;
+
+  d = dst;
+     e6e:	8b 45 08             	mov    0x8(%ebp),%eax
+     e71:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c &= 0xFF;
+     e74:	81 65 0c ff 00 00 00 	andl   $0xff,0xc(%ebp)
+  if(n >= 16){
+     e7b:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     e7f:	76 54                	jbe    ed5 <memset+0x6d>
+    k = -(uint)d & 3;  // bytes up to a word boundary
+     e81:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e84:	f7 d8                	neg    %eax
+     e86:	83 e0 03             	and    $0x3,%eax
+     e89:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    stosb(d, c, k);
+     e8c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     e8f:	50                   	push   %eax
+     e90:	ff 75 0c             	push   0xc(%ebp)
+     e93:	ff 75 fc             	push   -0x4(%ebp)
+     e96:	e8 e9 fd ff ff       	call   c84 <stosb>
+     e9b:	83 c4 0c             	add    $0xc,%esp
+    d += k;
+     e9e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     ea1:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n -= k;
+     ea4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     ea7:	29 45 10             	sub    %eax,0x10(%ebp)
+    stosl(d, c*ONES, n/4);
+     eaa:	8b 45 10             	mov    0x10(%ebp),%eax
+     ead:	c1 e8 02             	shr    $0x2,%eax
+     eb0:	89 c2                	mov    %eax,%edx
+     eb2:	8b 45 0c             	mov    0xc(%ebp),%eax
+     eb5:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     ebb:	52                   	push   %edx
+     ebc:	50                   	push   %eax
+     ebd:	ff 75 fc             	push   -0x4(%ebp)
+     ec0:	e8 e5 fd ff ff       	call   caa <stosl>
+     ec5:	83 c4 0c             	add    $0xc,%esp
+    d += n & ~3;
+     ec8:	8b 45 10             	mov    0x10(%ebp),%eax
+     ecb:	83 e0 fc             	and    $0xfffffffc,%eax
+     ece:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n &= 3;
+     ed1:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+  }
+  stosb(d, c, n);
+     ed5:	8b 45 10             	mov    0x10(%ebp),%eax
+     ed8:	50                   	push   %eax
+     ed9:	ff 75 0c             	push   0xc(%ebp)
+     edc:	ff 75 fc             	push   -0x4(%ebp)
+     edf:	e8 a0 fd ff ff       	call   c84 <stosb>
+     ee4:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     ee7:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     eea:	c9                   	leave
+     eeb:	c3                   	ret
+
+00000eec <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     eec:	55                   	push   %ebp
+     eed:	89 e5                	mov    %esp,%ebp
+     eef:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s1, *s2;
+
+  s1 = v1;
+     ef2:	8b 45 08             	mov    0x8(%ebp),%eax
+     ef5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s2 = v2;
+     ef8:	8b 45 0c             	mov    0xc(%ebp),%eax
+     efb:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     efe:	eb 0c                	jmp    f0c <memcmp+0x20>
+    s1 += 4, s2 += 4, n -= 4;
+     f00:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+     f04:	83 45 f8 04          	addl   $0x4,-0x8(%ebp)
+     f08:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     f0c:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     f10:	76 3e                	jbe    f50 <memcmp+0x64>
+     f12:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f15:	8b 10                	mov    (%eax),%edx
+     f17:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     f1a:	8b 00                	mov    (%eax),%eax
+     f1c:	39 c2                	cmp    %eax,%edx
+     f1e:	74 e0                	je     f00 <memcmp+0x14>
+  while(n-- > 0){
+     f20:	eb 2e                	jmp    f50 <memcmp+0x64>
+    if(*s1 != *s2)
+     f22:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f25:	0f b6 10             	movzbl (%eax),%edx
+     f28:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     f2b:	0f b6 00             	movzbl (%eax),%eax
+     f2e:	38 c2                	cmp    %al,%dl
+     f30:	74 16                	je     f48 <memcmp+0x5c>
+      return *s1 - *s2;
+     f32:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f35:	0f b6 00             	movzbl (%eax),%eax
+     f38:	0f b6 d0             	movzbl %al,%edx
+     f3b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     f3e:	0f b6 00             	movzbl (%eax),%eax
+     f41:	0f b6 c0             	movzbl %al,%eax
+     f44:	29 c2                	sub    %eax,%edx
+     f46:	eb 1a                	jmp    f62 <memcmp+0x76>
+    s1++, s2++;
+     f48:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     f4c:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+  while(n-- > 0){
+     f50:	8b 45 10             	mov    0x10(%ebp),%eax
+     f53:	8d 50 ff             	lea    -0x1(%eax),%edx
+     f56:	89 55 10             	mov    %edx,0x10(%ebp)
+     f59:	85 c0                	test   %eax,%eax
+     f5b:	75 c5                	jne    f22 <memcmp+0x36>
+  }
+  return 0;
+     f5d:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+     f62:	89 d0                	mov    %edx,%eax
+     f64:	c9                   	leave
+     f65:	c3                   	ret
+
+00000f66 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     f66:	55                   	push   %ebp
+     f67:	89 e5                	mov    %esp,%ebp
+     f69:	83 ec 14             	sub    $0x14,%esp
+     f6c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     f6f:	88 45 ec             	mov    %al,-0x14(%ebp)
+  uint w, cc;
+
+  // Skip whole words holding neither c nor the terminator.
+  for(; ((uint)s & 3) && *s; s++)
+     f72:	eb 17                	jmp    f8b <strchr+0x25>
+    if(*s == c)
+     f74:	8b 45 08             	mov    0x8(%ebp),%eax
+     f77:	0f b6 00             	movzbl (%eax),%eax
+     f7a:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     f7d:	75 08                	jne    f87 <strchr+0x21>
+      return (char*)s;
+     f7f:	8b 45 08             	mov    0x8(%ebp),%eax
+     f82:	e9 ad 00 00 00       	jmp    1034 <strchr+0xce>
+  for(; ((uint)s & 3) && *s; s++)
+     f87:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     f8b:	8b 45 08             	mov    0x8(%ebp),%eax
+     f8e:	83 e0 03             	and    $0x3,%eax
+     f91:	85 c0                	test   %eax,%eax
+     f93:	74 0a                	je     f9f <strchr+0x39>
+     f95:	8b 45 08             	mov    0x8(%ebp),%eax
+     f98:	0f b6 00             	movzbl (%eax),%eax
+     f9b:	84 c0                	test   %al,%al
+     f9d:	75 d5                	jne    f74 <strchr+0xe>
+  cc = (uchar)c * ONES;
+     f9f:	0f b6 45 ec          	movzbl -0x14(%ebp),%eax
+     fa3:	0f b6 c0             	movzbl %al,%eax
+     fa6:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     fac:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(*s)
+     faf:	8b 45 08             	mov    0x8(%ebp),%eax
+     fb2:	0f b6 00             	movzbl (%eax),%eax
+     fb5:	84 c0                	test   %al,%al
+     fb7:	74 6c                	je     1025 <strchr+0xbf>
+    for(; w = *(uint*)s, !HASZERO(w) && !HASZERO(w ^ cc); s += 4)
+     fb9:	eb 04                	jmp    fbf <strchr+0x59>
+     fbb:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     fbf:	8b 45 08             	mov    0x8(%ebp),%eax
+     fc2:	8b 00                	mov    (%eax),%eax
+     fc4:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     fc7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     fca:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     fd0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     fd3:	f7 d0                	not    %eax
+     fd5:	21 d0                	and    %edx,%eax
+     fd7:	25 80 80 80 80       	and    $0x80808080,%eax
+     fdc:	85 c0                	test   %eax,%eax
+     fde:	75 26                	jne    1006 <strchr+0xa0>
+     fe0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     fe3:	33 45 fc             	xor    -0x4(%ebp),%eax
+     fe6:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     fec:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     fef:	33 45 fc             	xor    -0x4(%ebp),%eax
+     ff2:	f7 d0                	not    %eax
+     ff4:	21 d0                	and    %edx,%eax
+     ff6:	25 80 80 80 80       	and    $0x80808080,%eax
+     ffb:	85 c0                	test   %eax,%eax
+     ffd:	75 07                	jne    1006 <strchr+0xa0>
+     fff:	b8 01 00 00 00       	mov    $0x1,%eax
+    1004:	eb 05                	jmp    100b <strchr+0xa5>
+    1006:	b8 00 00 00 00       	mov    $0x0,%eax
+    100b:	85 c0                	test   %eax,%eax
+    100d:	75 ac                	jne    fbb <strchr+0x55>
+      ;
+  for(; *s; s++)
+    100f:	eb 14                	jmp    1025 <strchr+0xbf>
+    if(*s == c)
+    1011:	8b 45 08             	mov    0x8(%ebp),%eax
+    1014:	0f b6 00             	movzbl (%eax),%eax
+    1017:	38 45 ec             	cmp    %al,-0x14(%ebp)
+    101a:	75 05                	jne    1021 <strchr+0xbb>
+      return (char*)s;
+    101c:	8b 45 08             	mov    0x8(%ebp),%eax
+    101f:	eb 13                	jmp    1034 <strchr+0xce>
+  for(; *s; s++)
+    1021:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    1025:	8b 45 08             	mov    0x8(%ebp),%eax
+    1028:	0f b6 00             	movzbl (%eax),%eax
+    102b:	84 c0                	test   %al,%al
+    102d:	75 e2                	jne    1011 <strchr+0xab>
+  return 0;
+    102f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1034:	c9                   	leave
+    1035:	c3                   	ret
+
+00001036 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1036:	55                   	push   %ebp
+    1037:	89 e5                	mov    %esp,%ebp
+    1039:	83 ec 18             	sub    $0x18,%esp
+  int i, c;
+
+  for(i=0; i+1 < max; ){
+    103c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1043:	eb 37                	jmp    107c <gets+0x46>
+    c = fgetc(0);
+    1045:	83 ec 0c             	sub    $0xc,%esp
+    1048:	6a 00                	push   $0x0
+    104a:	e8 2e 0e 00 00       	call   1e7d <fgetc>
+    104f:	83 c4 10             	add    $0x10,%esp
+    1052:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(c < 0)
+    1055:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1059:	78 2e                	js     1089 <gets+0x53>
+      break;
+    buf[i++] = c;
+    105b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    105e:	8d 50 01             	lea    0x1(%eax),%edx
+    1061:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    1064:	89 c2                	mov    %eax,%edx
+    1066:	8b 45 08             	mov    0x8(%ebp),%eax
+    1069:	01 d0                	add    %edx,%eax
+    106b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    106e:	88 10                	mov    %dl,(%eax)
+    if(c == '\n' || c == '\r')
+    1070:	83 7d f0 0a          	cmpl   $0xa,-0x10(%ebp)
+    1074:	74 14                	je     108a <gets+0x54>
+    1076:	83 7d f0 0d          	cmpl   $0xd,-0x10(%ebp)
+    107a:	74 0e                	je     108a <gets+0x54>
+  for(i=0; i+1 < max; ){
+    107c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    107f:	83 c0 01             	add    $0x1,%eax
+    1082:	39 45 0c             	cmp    %eax,0xc(%ebp)
+    1085:	7f be                	jg     1045 <gets+0xf>
+    1087:	eb 01                	jmp    108a <gets+0x54>
+      break;
+    1089:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    108a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    108d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1090:	01 d0                	add    %edx,%eax
+    1092:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+    1095:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    1098:	c9                   	leave
+    1099:	c3                   	ret
+
+0000109a <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    109a:	55                   	push   %ebp
+    109b:	89 e5                	mov    %esp,%ebp
+    109d:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    10a0:	83 ec 08             	sub    $0x8,%esp
+    10a3:	6a 00                	push   $0x0
+    10a5:	ff 75 08             	push   0x8(%ebp)
+    10a8:	e8 3b 02 00 00       	call   12e8 <open>
+    10ad:	83 c4 10             	add    $0x10,%esp
+    10b0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+    10b3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    10b7:	79 07                	jns    10c0 <stat+0x26>
+    return -1;
+    10b9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    10be:	eb 25                	jmp    10e5 <stat+0x4b>
+  r = fstat(fd, st);
+    10c0:	83 ec 08             	sub    $0x8,%esp
+    10c3:	ff 75 0c             	push   0xc(%ebp)
+    10c6:	ff 75 f4             	push   -0xc(%ebp)
+    10c9:	e8 47 02 00 00       	call   1315 <fstat>
+    10ce:	83 c4 10             	add    $0x10,%esp
+    10d1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+    10d4:	83 ec 0c             	sub    $0xc,%esp
+    10d7:	ff 75 f4             	push   -0xc(%ebp)
+    10da:	e8 c7 0e 00 00       	call   1fa6 <close>
+    10df:	83 c4 10             	add    $0x10,%esp
+  return r;
+    10e2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    10e5:	c9                   	leave
+    10e6:	c3                   	ret
+
+000010e7 <atoi>:
+
+int
+atoi(const char *s)
+{
+    10e7:	55                   	push   %ebp
+    10e8:	89 e5                	mov    %esp,%ebp
+    10ea:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+    10ed:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    10f4:	eb 25                	jmp    111b <atoi+0x34>
+    n = n*10 + *s++ - '0';
+    10f6:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    10f9:	89 d0                	mov    %edx,%eax
+    10fb:	c1 e0 02             	shl    $0x2,%eax
+    10fe:	01 d0                	add    %edx,%eax
+    1100:	01 c0                	add    %eax,%eax
+    1102:	89 c1                	mov    %eax,%ecx
+    1104:	8b 45 08             	mov    0x8(%ebp),%eax
+    1107:	8d 50 01             	lea    0x1(%eax),%edx
+    110a:	89 55 08             	mov    %edx,0x8(%ebp)
+    110d:	0f b6 00             	movzbl (%eax),%eax
+    1110:	0f be c0             	movsbl %al,%eax
+    1113:	01 c8                	add    %ecx,%eax
+    1115:	83 e8 30             	sub    $0x30,%eax
+    1118:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    111b:	8b 45 08             	mov    0x8(%ebp),%eax
+    111e:	0f b6 00             	movzbl (%eax),%eax
+    1121:	3c 2f                	cmp    $0x2f,%al
+    1123:	7e 0a                	jle    112f <atoi+0x48>
+    1125:	8b 45 08             	mov    0x8(%ebp),%eax
+    1128:	0f b6 00             	movzbl (%eax),%eax
+    112b:	3c 39                	cmp    $0x39,%al
+    112d:	7e c7                	jle    10f6 <atoi+0xf>
+  return n;
+    112f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    1132:	c9                   	leave
+    1133:	c3                   	ret
+
+00001134 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    1134:	55                   	push   %ebp
+    1135:	89 e5                	mov    %esp,%ebp
+    1137:	83 ec 10             	sub    $0x10,%esp
+  char *d, *s;
+  int k;
+
+  if(n <= 0)
+    113a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+    113e:	7f 08                	jg     1148 <memmove+0x14>
+    return vdst;
+    1140:	8b 45 08             	mov    0x8(%ebp),%eax
+    1143:	e9 17 01 00 00       	jmp    125f <memmove+0x12b>
+  d = vdst;
+    1148:	8b 45 08             	mov    0x8(%ebp),%eax
+    114b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s = vsrc;
+    114e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1151:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  if(s < d && s + n > d){
+    1154:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1157:	3b 45 fc             	cmp    -0x4(%ebp),%eax
+    115a:	0f 83 84 00 00 00    	jae    11e4 <memmove+0xb0>
+    1160:	8b 55 10             	mov    0x10(%ebp),%edx
+    1163:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1166:	01 d0                	add    %edx,%eax
+    1168:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    116b:	73 77                	jae    11e4 <memmove+0xb0>
+    s += n;
+    116d:	8b 45 10             	mov    0x10(%ebp),%eax
+    1170:	01 45 f8             	add    %eax,-0x8(%ebp)
+    d += n;
+    1173:	8b 45 10             	mov    0x10(%ebp),%eax
+    1176:	01 45 fc             	add    %eax,-0x4(%ebp)
+    while(n > 0 && ((uint)d & 3))
+    1179:	eb 17                	jmp    1192 <memmove+0x5e>
+      *--d = *--s, n--;
+    117b:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+    117f:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+    1183:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1186:	0f b6 10             	movzbl (%eax),%edx
+    1189:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    118c:	88 10                	mov    %dl,(%eax)
+    118e:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+    while(n > 0 && ((uint)d & 3))
+    1192:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+    1196:	7e 22                	jle    11ba <memmove+0x86>
+    1198:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    119b:	83 e0 03             	and    $0x3,%eax
+    119e:	85 c0                	test   %eax,%eax
+    11a0:	75 d9                	jne    117b <memmove+0x47>
+    for(; n >= 4; n -= 4){
+    11a2:	eb 16                	jmp    11ba <memmove+0x86>
+      d -= 4;
+    11a4:	83 6d fc 04          	subl   $0x4,-0x4(%ebp)
+      s -= 4;
+    11a8:	83 6d f8 04          	subl   $0x4,-0x8(%ebp)
+      *(uint*)d = *(uint*)s;
+    11ac:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    11af:	8b 10                	mov    (%eax),%edx
+    11b1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    11b4:	89 10                	mov    %edx,(%eax)
+    for(; n >= 4; n -= 4){
+    11b6:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+    11ba:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+    11be:	7f e4                	jg     11a4 <memmove+0x70>
+    }
+    while(n-- > 0)
+    11c0:	eb 13                	jmp    11d5 <memmove+0xa1>
+      *--d = *--s;
+    11c2:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+    11c6:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+    11ca:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    11cd:	0f b6 10             	movzbl (%eax),%edx
+    11d0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    11d3:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+    11d5:	8b 45 10             	mov    0x10(%ebp),%eax
+    11d8:	8d 50 ff             	lea    -0x1(%eax),%edx
+    11db:	89 55 10             	mov    %edx,0x10(%ebp)
+    11de:	85 c0                	test   %eax,%eax
+    11e0:	7f e0                	jg     11c2 <memmove+0x8e>
+  if(s < d && s + n > d){
+    11e2:	eb 78                	jmp    125c <memmove+0x128>
+  } else {
+    if(n >= 16){
+    11e4:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+    11e8:	7e 61                	jle    124b <memmove+0x117>
+      k = -(uint)d & 3;
+    11ea:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    11ed:	f7 d8                	neg    %eax
+    11ef:	83 e0 03             	and    $0x3,%eax
+    11f2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      movsb(d, s, k);
+    11f5:	ff 75 f4             	push   -0xc(%ebp)
+    11f8:	ff 75 f8             	push   -0x8(%ebp)
+    11fb:	ff 75 fc             	push   -0x4(%ebp)
+    11fe:	e8 cd fa ff ff       	call   cd0 <movsb>
+    1203:	83 c4 0c             	add    $0xc,%esp
+      d += k;
+    1206:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1209:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += k;
+    120c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    120f:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n -= k;
+    1212:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1215:	29 45 10             	sub    %eax,0x10(%ebp)
+      movsl(d, s, n/4);
+    1218:	8b 45 10             	mov    0x10(%ebp),%eax
+    121b:	8d 50 03             	lea    0x3(%eax),%edx
+    121e:	85 c0                	test   %eax,%eax
+    1220:	0f 48 c2             	cmovs  %edx,%eax
+    1223:	c1 f8 02             	sar    $0x2,%eax
+    1226:	50                   	push   %eax
+    1227:	ff 75 f8             	push   -0x8(%ebp)
+    122a:	ff 75 fc             	push   -0x4(%ebp)
+    122d:	e8 cd fa ff ff       	call   cff <movsl>
+    1232:	83 c4 0c             	add    $0xc,%esp
+      d += n & ~3;
+    1235:	8b 45 10             	mov    0x10(%ebp),%eax
+    1238:	83 e0 fc             	and    $0xfffffffc,%eax
+    123b:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += n & ~3;
+    123e:	8b 45 10             	mov    0x10(%ebp),%eax
+    1241:	83 e0 fc             	and    $0xfffffffc,%eax
+    1244:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n &= 3;
+    1247:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+    }
+    movsb(d, s, n);
+    124b:	ff 75 10             	push   0x10(%ebp)
+    124e:	ff 75 f8             	push   -0x8(%ebp)
+    1251:	ff 75 fc             	push   -0x4(%ebp)
+    1254:	e8 77 fa ff ff       	call   cd0 <movsb>
+    1259:	83 c4 0c             	add    $0xc,%esp
+  }
+  return vdst;
+    125c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    125f:	c9                   	leave
+    1260:	c3                   	ret
+
+00001261 <_fork>:
+    movl %esp, %ecx; \
+    movl $1f, %edx; \
+    sysenter; \
+  1: ret
+
+RAWSYSCALL(fork)
+    1261:	b8 01 00 00 00       	mov    $0x1,%eax
+    1266:	89 e1                	mov    %esp,%ecx
+    1268:	ba 6f 12 00 00       	mov    $0x126f,%edx
+    126d:	0f 34                	sysenter
+    126f:	c3                   	ret
+
+00001270 <_exit>:
+RAWSYSCALL(exit)
+    1270:	b8 02 00 00 00       	mov    $0x2,%eax
+    1275:	89 e1                	mov    %esp,%ecx
+    1277:	ba 7e 12 00 00       	mov    $0x127e,%edx
+    127c:	0f 34                	sysenter
+    127e:	c3                   	ret
+
+0000127f <wait>:
+SYSCALL(wait)
+    127f:	b8 03 00 00 00       	mov    $0x3,%eax
+    1284:	89 e1                	mov    %esp,%ecx
+    1286:	ba 8d 12 00 00       	mov    $0x128d,%edx
+    128b:	0f 34                	sysenter
+    128d:	c3                   	ret
+
+0000128e <pipe>:
+SYSCALL(pipe)
+    128e:	b8 04 00 00 00       	mov    $0x4,%eax
+    1293:	89 e1                	mov    %esp,%ecx
+    1295:	ba 9c 12 00 00       	mov    $0x129c,%edx
+    129a:	0f 34                	sysenter
+    129c:	c3                   	ret
+
+0000129d <read>:
+SYSCALL(read)
+    129d:	b8 05 00 00 00       	mov    $0x5,%eax
+    12a2:	89 e1                	mov    %esp,%ecx
+    12a4:	ba ab 12 00 00       	mov    $0x12ab,%edx
+    12a9:	0f 34                	sysenter
+    12ab:	c3                   	ret
+
+000012ac <write>:
+SYSCALL(write)
+    12ac:	b8 10 00 00 00       	mov    $0x10,%eax
+    12b1:	89 e1                	mov    %esp,%ecx
+    12b3:	ba ba 12 00 00       	mov    $0x12ba,%edx
+    12b8:	0f 34                	sysenter
+    12ba:	c3                   	ret
+
+000012bb <_close>:
+RAWSYSCALL(close)
+    12bb:	b8 15 00 00 00       	mov    $0x15,%eax
+    12c0:	89 e1                	mov    %esp,%ecx
+    12c2:	ba c9 12 00 00       	mov    $0x12c9,%edx
+    12c7:	0f 34                	sysenter
+    12c9:	c3                   	ret
+
+000012ca <kill>:
+SYSCALL(kill)
+    12ca:	b8 06 00 00 00       	mov    $0x6,%eax
+    12cf:	89 e1                	mov    %esp,%ecx
+    12d1:	ba d8 12 00 00       	mov    $0x12d8,%edx
+    12d6:	0f 34                	sysenter
+    12d8:	c3                   	ret
+
+000012d9 <_exec>:
+RAWSYSCALL(exec)
+    12d9:	b8 07 00 00 00       	mov    $0x7,%eax
+    12de:	89 e1                	mov    %esp,%ecx
+    12e0:	ba e7 12 00 00       	mov    $0x12e7,%edx
+    12e5:	0f 34                	sysenter
+    12e7:	c3                   	ret
+
+000012e8 <open>:
+SYSCALL(open)
+    12e8:	b8 0f 00 00 00       	mov    $0xf,%eax
+    12ed:	89 e1                	mov    %esp,%ecx
+    12ef:	ba f6 12 00 00       	mov    $0x12f6,%edx
+    12f4:	0f 34                	sysenter
+    12f6:	c3                   	ret
+
+000012f7 <mknod>:
+SYSCALL(mknod)
+    12f7:	b8 11 00 00 00       	mov    $0x11,%eax
+    12fc:	89 e1                	mov    %esp,%ecx
+    12fe:	ba 05 13 00 00       	mov    $0x1305,%edx
+    1303:	0f 34                	sysenter
+    1305:	c3                   	ret
+
+00001306 <unlink>:
+SYSCALL(unlink)
+    1306:	b8 12 00 00 00       	mov    $0x12,%eax
+    130b:	89 e1                	mov    %esp,%ecx
+    130d:	ba 14 13 00 00       	mov    $0x1314,%edx
+    1312:	0f 34                	sysenter
+    1314:	c3                   	ret
+
+00001315 <fstat>:
+SYSCALL(fstat)
+    1315:	b8 08 00 00 00       	mov    $0x8,%eax
+    131a:	89 e1                	mov    %esp,%ecx
+    131c:	ba 23 13 00 00       	mov    $0x1323,%edx
+    1321:	0f 34                	sysenter
+    1323:	c3                   	ret
+
+00001324 <link>:
+SYSCALL(link)
+    1324:	b8 13 00 00 00       	mov    $0x13,%eax
+    1329:	89 e1                	mov    %esp,%ecx
+    132b:	ba 32 13 00 00       	mov    $0x1332,%edx
+    1330:	0f 34                	sysenter
+    1332:	c3                   	ret
+
+00001333 <mkdir>:
+SYSCALL(mkdir)
+    1333:	b8 14 00 00 00       	mov    $0x14,%eax
+    1338:	89 e1                	mov    %esp,%ecx
+    133a:	ba 41 13 00 00       	mov    $0x1341,%edx
+    133f:	0f 34                	sysenter
+    1341:	c3                   	ret
+
+00001342 <chdir>:
+SYSCALL(chdir)
+    1342:	b8 09 00 00 00       	mov    $0x9,%eax
+    1347:	89 e1                	mov    %esp,%ecx
+    1349:	ba 50 13 00 00       	mov    $0x1350,%edx
+    134e:	0f 34                	sysenter
+    1350:	c3                   	ret
+
+00001351 <dup>:
+SYSCALL(dup)
+    1351:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1356:	89 e1                	mov    %esp,%ecx
+    1358:	ba 5f 13 00 00       	mov    $0x135f,%edx
+    135d:	0f 34                	sysenter
+    135f:	c3                   	ret
+
+00001360 <getpid>:
+SYSCALL(getpid)
+    1360:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1365:	89 e1                	mov    %esp,%ecx
+    1367:	ba 6e 13 00 00       	mov    $0x136e,%edx
+    136c:	0f 34                	sysenter
+    136e:	c3                   	ret
+
+0000136f <sbrk>:
+SYSCALL(sbrk)
+    136f:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1374:	89 e1                	mov    %esp,%ecx
+    1376:	ba 7d 13 00 00       	mov    $0x137d,%edx
+    137b:	0f 34                	sysenter
+    137d:	c3                   	ret
+
+0000137e <sleep>:
+SYSCALL(sleep)
+    137e:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1383:	89 e1                	mov    %esp,%ecx
+    1385:	ba 8c 13 00 00       	mov    $0x138c,%edx
+    138a:	0f 34                	sysenter
+    138c:	c3                   	ret
+
+0000138d <uptime>:
+SYSCALL(uptime)
+    138d:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1392:	89 e1                	mov    %esp,%ecx
+    1394:	ba 9b 13 00 00       	mov    $0x139b,%edx
+    1399:	0f 34                	sysenter
+    139b:	c3                   	ret
+
+0000139c <getproc>:
+SYSCALL(getproc)
+    139c:	b8 16 00 00 00       	mov    $0x16,%eax
+    13a1:	89 e1                	mov    %esp,%ecx
+    13a3:	ba aa 13 00 00       	mov    $0x13aa,%edx
+    13a8:	0f 34                	sysenter
+    13aa:	c3                   	ret
+
+000013ab <getpgs>:
+SYSCALL(getpgs)
+    13ab:	b8 17 00 00 00       	mov    $0x17,%eax
+    13b0:	89 e1                	mov    %esp,%ecx
+    13b2:	ba b9 13 00 00       	mov    $0x13b9,%edx
+    13b7:	0f 34                	sysenter
+    13b9:	c3                   	ret
+
+000013ba <loadproc>:
+SYSCALL(loadproc)
+    13ba:	b8 18 00 00 00       	mov    $0x18,%eax
+    13bf:	89 e1                	mov    %esp,%ecx
+    13c1:	ba c8 13 00 00       	mov    $0x13c8,%edx
+    13c6:	0f 34                	sysenter
+    13c8:	c3                   	ret
+
+000013c9 <iosubmit>:
+SYSCALL(iosubmit)
+    13c9:	b8 19 00 00 00       	mov    $0x19,%eax
+    13ce:	89 e1                	mov    %esp,%ecx
+    13d0:	ba d7 13 00 00       	mov    $0x13d7,%edx
+    13d5:	0f 34                	sysenter
+    13d7:	c3                   	ret
+
+000013d8 <sysstat>:
+SYSCALL(sysstat)
+    13d8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    13dd:	89 e1                	mov    %esp,%ecx
+    13df:	ba e6 13 00 00       	mov    $0x13e6,%edx
+    13e4:	0f 34                	sysenter
+    13e6:	c3                   	ret
+
+000013e7 <splice>:
+SYSCALL(splice)
+    13e7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    13ec:	89 e1                	mov    %esp,%ecx
+    13ee:	ba f5 13 00 00       	mov    $0x13f5,%edx
+    13f3:	0f 34                	sysenter
+    13f5:	c3                   	ret
+
+000013f6 <fsync>:
+SYSCALL(fsync)
+    13f6:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    13fb:	89 e1                	mov    %esp,%ecx
+    13fd:	ba 04 14 00 00       	mov    $0x1404,%edx
+    1402:	0f 34                	sysenter
+    1404:	c3                   	ret
+
+00001405 <fdatasync>:
+SYSCALL(fdatasync)
+    1405:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    140a:	89 e1                	mov    %esp,%ecx
+    140c:	ba 13 14 00 00       	mov    $0x1413,%edx
+    1411:	0f 34                	sysenter
+    1413:	c3                   	ret
+
+00001414 <lseek>:
+SYSCALL(lseek)
+    1414:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1419:	89 e1                	mov    %esp,%ecx
+    141b:	ba 22 14 00 00       	mov    $0x1422,%edx
+    1420:	0f 34                	sysenter
+    1422:	c3                   	ret
+
+00001423 <dmesg>:
+SYSCALL(dmesg)
+    1423:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1428:	89 e1                	mov    %esp,%ecx
+    142a:	ba 31 14 00 00       	mov    $0x1431,%edx
+    142f:	0f 34                	sysenter
+    1431:	c3                   	ret
+
+00001432 <lockstat>:
+SYSCALL(lockstat)
+    1432:	b8 20 00 00 00       	mov    $0x20,%eax
+    1437:	89 e1                	mov    %esp,%ecx
+    1439:	ba 40 14 00 00       	mov    $0x1440,%edx
+    143e:	0f 34                	sysenter
+    1440:	c3                   	ret
+
+00001441 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1441:	55                   	push   %ebp
+    1442:	89 e5                	mov    %esp,%ebp
+    1444:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    1447:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+    144e:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+    1452:	74 17                	je     146b <printint+0x2a>
+    1454:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    1458:	79 11                	jns    146b <printint+0x2a>
+    neg = 1;
+    145a:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+    1461:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1464:	f7 d8                	neg    %eax
+    1466:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1469:	eb 06                	jmp    1471 <printint+0x30>
+  } else {
+    x = xx;
+    146b:	8b 45 0c             	mov    0xc(%ebp),%eax
+    146e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+    1471:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+    1478:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    147b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    147e:	ba 00 00 00 00       	mov    $0x0,%edx
+    1483:	f7 f1                	div    %ecx
+    1485:	89 d1                	mov    %edx,%ecx
+    1487:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    148a:	8d 50 01             	lea    0x1(%eax),%edx
+    148d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    1490:	0f b6 91 ec 27 00 00 	movzbl 0x27ec(%ecx),%edx
+    1497:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+    149b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    149e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    14a1:	ba 00 00 00 00       	mov    $0x0,%edx
+    14a6:	f7 f1                	div    %ecx
+    14a8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    14ab:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    14af:	75 c7                	jne    1478 <printint+0x37>
+  if(neg)
+    14b1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    14b5:	74 2d                	je     14e4 <printint+0xa3>
+    buf[i++] = '-';
+    14b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14ba:	8d 50 01             	lea    0x1(%eax),%edx
+    14bd:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    14c0:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+    14c5:	eb 1d                	jmp    14e4 <printint+0xa3>
+    fputc(fd, buf[i]);
+    14c7:	8d 55 dc             	lea    -0x24(%ebp),%edx
+    14ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14cd:	01 d0                	add    %edx,%eax
+    14cf:	0f b6 00             	movzbl (%eax),%eax
+    14d2:	0f be c0             	movsbl %al,%eax
+    14d5:	83 ec 08             	sub    $0x8,%esp
+    14d8:	50                   	push   %eax
+    14d9:	ff 75 08             	push   0x8(%ebp)
+    14dc:	e8 f8 08 00 00       	call   1dd9 <fputc>
+    14e1:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+    14e4:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    14e8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    14ec:	79 d9                	jns    14c7 <printint+0x86>
+}
+    14ee:	90                   	nop
+    14ef:	90                   	nop
+    14f0:	c9                   	leave
+    14f1:	c3                   	ret
+
+000014f2 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    14f2:	55                   	push   %ebp
+    14f3:	89 e5                	mov    %esp,%ebp
+    14f5:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+    14f8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+    14ff:	8d 45 0c             	lea    0xc(%ebp),%eax
+    1502:	83 c0 04             	add    $0x4,%eax
+    1505:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+    1508:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    150f:	e9 4a 01 00 00       	jmp    165e <printf+0x16c>
+    c = fmt[i] & 0xff;
+    1514:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1517:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    151a:	01 d0                	add    %edx,%eax
+    151c:	0f b6 00             	movzbl (%eax),%eax
+    151f:	0f be c0             	movsbl %al,%eax
+    1522:	25 ff 00 00 00       	and    $0xff,%eax
+    1527:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+    152a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    152e:	75 28                	jne    1558 <printf+0x66>
+      if(c == '%'){
+    1530:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    1534:	75 0c                	jne    1542 <printf+0x50>
+        state = '%';
+    1536:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+    153d:	e9 18 01 00 00       	jmp    165a <printf+0x168>
+      } else {
+        fputc(fd, c);
+    1542:	83 ec 08             	sub    $0x8,%esp
+    1545:	ff 75 e4             	push   -0x1c(%ebp)
+    1548:	ff 75 08             	push   0x8(%ebp)
+    154b:	e8 89 08 00 00       	call   1dd9 <fputc>
+    1550:	83 c4 10             	add    $0x10,%esp
+    1553:	e9 02 01 00 00       	jmp    165a <printf+0x168>
+      }
+    } else if(state == '%'){
+    1558:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+    155c:	0f 85 f8 00 00 00    	jne    165a <printf+0x168>
+      if(c == 'd'){
+    1562:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+    1566:	75 1e                	jne    1586 <printf+0x94>
+        printint(fd, *ap, 10, 1);
+    1568:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    156b:	8b 00                	mov    (%eax),%eax
+    156d:	6a 01                	push   $0x1
+    156f:	6a 0a                	push   $0xa
+    1571:	50                   	push   %eax
+    1572:	ff 75 08             	push   0x8(%ebp)
+    1575:	e8 c7 fe ff ff       	call   1441 <printint>
+    157a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    157d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    1581:	e9 cd 00 00 00       	jmp    1653 <printf+0x161>
+      } else if(c == 'x' || c == 'p'){
+    1586:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+    158a:	74 06                	je     1592 <printf+0xa0>
+    158c:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+    1590:	75 1e                	jne    15b0 <printf+0xbe>
+        printint(fd, *ap, 16, 0);
+    1592:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1595:	8b 00                	mov    (%eax),%eax
+    1597:	6a 00                	push   $0x0
+    1599:	6a 10                	push   $0x10
+    159b:	50                   	push   %eax
+    159c:	ff 75 08             	push   0x8(%ebp)
+    159f:	e8 9d fe ff ff       	call   1441 <printint>
+    15a4:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    15a7:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    15ab:	e9 a3 00 00 00       	jmp    1653 <printf+0x161>
+      } else if(c == 's'){
+    15b0:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+    15b4:	75 43                	jne    15f9 <printf+0x107>
+        s = (char*)*ap;
+    15b6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    15b9:	8b 00                	mov    (%eax),%eax
+    15bb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+    15be:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+    15c2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    15c6:	75 25                	jne    15ed <printf+0xfb>
+          s = "(null)";
+    15c8:	c7 45 f4 f8 20 00 00 	movl   $0x20f8,-0xc(%ebp)
+        while(*s != 0){
+    15cf:	eb 1c                	jmp    15ed <printf+0xfb>
+          fputc(fd, *s);
+    15d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15d4:	0f b6 00             	movzbl (%eax),%eax
+    15d7:	0f be c0             	movsbl %al,%eax
+    15da:	83 ec 08             	sub    $0x8,%esp
+    15dd:	50                   	push   %eax
+    15de:	ff 75 08             	push   0x8(%ebp)
+    15e1:	e8 f3 07 00 00       	call   1dd9 <fputc>
+    15e6:	83 c4 10             	add    $0x10,%esp
+          s++;
+    15e9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+    15ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15f0:	0f b6 00             	movzbl (%eax),%eax
+    15f3:	84 c0                	test   %al,%al
+    15f5:	75 da                	jne    15d1 <printf+0xdf>
+    15f7:	eb 5a                	jmp    1653 <printf+0x161>
+        }
+      } else if(c == 'c'){
+    15f9:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+    15fd:	75 1a                	jne    1619 <printf+0x127>
+        fputc(fd, *ap);
+    15ff:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1602:	8b 00                	mov    (%eax),%eax
+    1604:	83 ec 08             	sub    $0x8,%esp
+    1607:	50                   	push   %eax
+    1608:	ff 75 08             	push   0x8(%ebp)
+    160b:	e8 c9 07 00 00       	call   1dd9 <fputc>
+    1610:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    1613:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    1617:	eb 3a                	jmp    1653 <printf+0x161>
+      } else if(c == '%'){
+    1619:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    161d:	75 13                	jne    1632 <printf+0x140>
+        fputc(fd, c);
+    161f:	83 ec 08             	sub    $0x8,%esp
+    1622:	ff 75 e4             	push   -0x1c(%ebp)
+    1625:	ff 75 08             	push   0x8(%ebp)
+    1628:	e8 ac 07 00 00       	call   1dd9 <fputc>
+    162d:	83 c4 10             	add    $0x10,%esp
+    1630:	eb 21                	jmp    1653 <printf+0x161>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        fputc(fd, '%');
+    1632:	83 ec 08             	sub    $0x8,%esp
+    1635:	6a 25                	push   $0x25
+    1637:	ff 75 08             	push   0x8(%ebp)
+    163a:	e8 9a 07 00 00       	call   1dd9 <fputc>
+    163f:	83 c4 10             	add    $0x10,%esp
+        fputc(fd, c);
+    1642:	83 ec 08             	sub    $0x8,%esp
+    1645:	ff 75 e4             	push   -0x1c(%ebp)
+    1648:	ff 75 08             	push   0x8(%ebp)
+    164b:	e8 89 07 00 00       	call   1dd9 <fputc>
+    1650:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+    1653:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+    165a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    165e:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1661:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1664:	01 d0                	add    %edx,%eax
+    1666:	0f b6 00             	movzbl (%eax),%eax
+    1669:	84 c0                	test   %al,%al
+    166b:	0f 85 a3 fe ff ff    	jne    1514 <printf+0x22>
+    }
+  }
+}
+    1671:	90                   	nop
+    1672:	90                   	nop
+    1673:	c9                   	leave
+    1674:	c3                   	ret
+
+00001675 <binof>:
+static struct chunk *bins[NBIN];       // free large chunks
+static struct chunk *top;              // end marker of newest heap segment
+
+static int
+binof(uint size)
+{
+    1675:	55                   	push   %ebp
+    1676:	89 e5                	mov    %esp,%ebp
+    1678:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  i = 0;
+    167b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+    1682:	c1 6d 08 05          	shrl   $0x5,0x8(%ebp)
+    1686:	eb 07                	jmp    168f <binof+0x1a>
+    i++;
+    1688:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+    168c:	d1 6d 08             	shrl   0x8(%ebp)
+    168f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1693:	74 06                	je     169b <binof+0x26>
+    1695:	83 7d fc 19          	cmpl   $0x19,-0x4(%ebp)
+    1699:	7e ed                	jle    1688 <binof+0x13>
+  return i;
+    169b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    169e:	c9                   	leave
+    169f:	c3                   	ret
+
+000016a0 <bininsert>:
+
+static void
+bininsert(struct chunk *c)
+{
+    16a0:	55                   	push   %ebp
+    16a1:	89 e5                	mov    %esp,%ebp
+    16a3:	83 ec 10             	sub    $0x10,%esp
+  struct chunk **b;
+
+  b = &bins[binof(CSIZE(c))];
+    16a6:	8b 45 08             	mov    0x8(%ebp),%eax
+    16a9:	8b 00                	mov    (%eax),%eax
+    16ab:	83 e0 f8             	and    $0xfffffff8,%eax
+    16ae:	50                   	push   %eax
+    16af:	e8 c1 ff ff ff       	call   1675 <binof>
+    16b4:	83 c4 04             	add    $0x4,%esp
+    16b7:	c1 e0 02             	shl    $0x2,%eax
+    16ba:	05 a0 28 00 00       	add    $0x28a0,%eax
+    16bf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c->prev = 0;
+    16c2:	8b 45 08             	mov    0x8(%ebp),%eax
+    16c5:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  c->next = *b;
+    16cc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    16cf:	8b 10                	mov    (%eax),%edx
+    16d1:	8b 45 08             	mov    0x8(%ebp),%eax
+    16d4:	89 50 08             	mov    %edx,0x8(%eax)
+  if(*b)
+    16d7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    16da:	8b 00                	mov    (%eax),%eax
+    16dc:	85 c0                	test   %eax,%eax
+    16de:	74 0b                	je     16eb <bininsert+0x4b>
+    (*b)->prev = c;
+    16e0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    16e3:	8b 00                	mov    (%eax),%eax
+    16e5:	8b 55 08             	mov    0x8(%ebp),%edx
+    16e8:	89 50 0c             	mov    %edx,0xc(%eax)
+  *b = c;
+    16eb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    16ee:	8b 55 08             	mov    0x8(%ebp),%edx
+    16f1:	89 10                	mov    %edx,(%eax)
+}
+    16f3:	90                   	nop
+    16f4:	c9                   	leave
+    16f5:	c3                   	ret
+
+000016f6 <binremove>:
+
+static void
+binremove(struct chunk *c)
+{
+    16f6:	55                   	push   %ebp
+    16f7:	89 e5                	mov    %esp,%ebp
+  if(c->prev)
+    16f9:	8b 45 08             	mov    0x8(%ebp),%eax
+    16fc:	8b 40 0c             	mov    0xc(%eax),%eax
+    16ff:	85 c0                	test   %eax,%eax
+    1701:	74 11                	je     1714 <binremove+0x1e>
+    c->prev->next = c->next;
+    1703:	8b 45 08             	mov    0x8(%ebp),%eax
+    1706:	8b 40 0c             	mov    0xc(%eax),%eax
+    1709:	8b 55 08             	mov    0x8(%ebp),%edx
+    170c:	8b 52 08             	mov    0x8(%edx),%edx
+    170f:	89 50 08             	mov    %edx,0x8(%eax)
+    1712:	eb 1e                	jmp    1732 <binremove+0x3c>
+  else
+    bins[binof(CSIZE(c))] = c->next;
+    1714:	8b 45 08             	mov    0x8(%ebp),%eax
+    1717:	8b 00                	mov    (%eax),%eax
+    1719:	83 e0 f8             	and    $0xfffffff8,%eax
+    171c:	50                   	push   %eax
+    171d:	e8 53 ff ff ff       	call   1675 <binof>
+    1722:	83 c4 04             	add    $0x4,%esp
+    1725:	8b 55 08             	mov    0x8(%ebp),%edx
+    1728:	8b 52 08             	mov    0x8(%edx),%edx
+    172b:	89 14 85 a0 28 00 00 	mov    %edx,0x28a0(,%eax,4)
+  if(c->next)
+    1732:	8b 45 08             	mov    0x8(%ebp),%eax
+    1735:	8b 40 08             	mov    0x8(%eax),%eax
+    1738:	85 c0                	test   %eax,%eax
+    173a:	74 0f                	je     174b <binremove+0x55>
+    c->next->prev = c->prev;
+    173c:	8b 45 08             	mov    0x8(%ebp),%eax
+    173f:	8b 40 08             	mov    0x8(%eax),%eax
+    1742:	8b 55 08             	mov    0x8(%ebp),%edx
+    1745:	8b 52 0c             	mov    0xc(%edx),%edx
+    1748:	89 50 0c             	mov    %edx,0xc(%eax)
+}
+    174b:	90                   	nop
+    174c:	c9                   	leave
+    174d:	c3                   	ret
+
+0000174e <freechunk>:
+
+// Free chunk c, merging it with free neighbors.  If trim is
+// set and the result is big and at the break, give it back.
+static void
+freechunk(struct chunk *c, int trim)
+{
+    174e:	55                   	push   %ebp
+    174f:	89 e5                	mov    %esp,%ebp
+    1751:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *p, *n;
+  uint size;
+
+  size = CSIZE(c);
+    1754:	8b 45 08             	mov    0x8(%ebp),%eax
+    1757:	8b 00                	mov    (%eax),%eax
+    1759:	83 e0 f8             	and    $0xfffffff8,%eax
+    175c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  n = NEXTC(c);
+    175f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1762:	8b 00                	mov    (%eax),%eax
+    1764:	83 e0 f8             	and    $0xfffffff8,%eax
+    1767:	89 c2                	mov    %eax,%edx
+    1769:	8b 45 08             	mov    0x8(%ebp),%eax
+    176c:	01 d0                	add    %edx,%eax
+    176e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(!(c->size & PREVUSED)){
+    1771:	8b 45 08             	mov    0x8(%ebp),%eax
+    1774:	8b 00                	mov    (%eax),%eax
+    1776:	83 e0 02             	and    $0x2,%eax
+    1779:	85 c0                	test   %eax,%eax
+    177b:	75 30                	jne    17ad <freechunk+0x5f>
+    p = (struct chunk*)((char*)c - *((uint*)c - 1));
+    177d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1780:	83 e8 04             	sub    $0x4,%eax
+    1783:	8b 00                	mov    (%eax),%eax
+    1785:	f7 d8                	neg    %eax
+    1787:	89 c2                	mov    %eax,%edx
+    1789:	8b 45 08             	mov    0x8(%ebp),%eax
+    178c:	01 d0                	add    %edx,%eax
+    178e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    binremove(p);
+    1791:	ff 75 ec             	push   -0x14(%ebp)
+    1794:	e8 5d ff ff ff       	call   16f6 <binremove>
+    1799:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(p);
+    179c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    179f:	8b 00                	mov    (%eax),%eax
+    17a1:	83 e0 f8             	and    $0xfffffff8,%eax
+    17a4:	01 45 f4             	add    %eax,-0xc(%ebp)
+    c = p;
+    17a7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    17aa:	89 45 08             	mov    %eax,0x8(%ebp)
+  }
+  if(!(n->size & USED)){
+    17ad:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    17b0:	8b 00                	mov    (%eax),%eax
+    17b2:	83 e0 01             	and    $0x1,%eax
+    17b5:	85 c0                	test   %eax,%eax
+    17b7:	75 16                	jne    17cf <freechunk+0x81>
+    binremove(n);
+    17b9:	ff 75 f0             	push   -0x10(%ebp)
+    17bc:	e8 35 ff ff ff       	call   16f6 <binremove>
+    17c1:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(n);
+    17c4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    17c7:	8b 00                	mov    (%eax),%eax
+    17c9:	83 e0 f8             	and    $0xfffffff8,%eax
+    17cc:	01 45 f4             	add    %eax,-0xc(%ebp)
+  }
+  // Free chunks are never adjacent, so the one below is in use.
+  c->size = size | PREVUSED;
+    17cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    17d2:	83 c8 02             	or     $0x2,%eax
+    17d5:	89 c2                	mov    %eax,%edx
+    17d7:	8b 45 08             	mov    0x8(%ebp),%eax
+    17da:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+    17dc:	8b 45 08             	mov    0x8(%ebp),%eax
+    17df:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  FOOTER(c) = size;
+    17e6:	8b 45 08             	mov    0x8(%ebp),%eax
+    17e9:	8b 00                	mov    (%eax),%eax
+    17eb:	83 e0 f8             	and    $0xfffffff8,%eax
+    17ee:	8d 50 fc             	lea    -0x4(%eax),%edx
+    17f1:	8b 45 08             	mov    0x8(%ebp),%eax
+    17f4:	01 c2                	add    %eax,%edx
+    17f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    17f9:	89 02                	mov    %eax,(%edx)
+  n = NEXTC(c);
+    17fb:	8b 45 08             	mov    0x8(%ebp),%eax
+    17fe:	8b 00                	mov    (%eax),%eax
+    1800:	83 e0 f8             	and    $0xfffffff8,%eax
+    1803:	89 c2                	mov    %eax,%edx
+    1805:	8b 45 08             	mov    0x8(%ebp),%eax
+    1808:	01 d0                	add    %edx,%eax
+    180a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  n->size &= ~PREVUSED;
+    180d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1810:	8b 00                	mov    (%eax),%eax
+    1812:	83 e0 fd             	and    $0xfffffffd,%eax
+    1815:	89 c2                	mov    %eax,%edx
+    1817:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    181a:	89 10                	mov    %edx,(%eax)
+
+  if(trim && n == top && size >= TRIMSIZE && sbrk(0) == (char*)top + HDRSIZE){
+    181c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    1820:	74 51                	je     1873 <freechunk+0x125>
+    1822:	a1 0c 29 00 00       	mov    0x290c,%eax
+    1827:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+    182a:	75 47                	jne    1873 <freechunk+0x125>
+    182c:	81 7d f4 ff 7f 00 00 	cmpl   $0x7fff,-0xc(%ebp)
+    1833:	76 3e                	jbe    1873 <freechunk+0x125>
+    1835:	83 ec 0c             	sub    $0xc,%esp
+    1838:	6a 00                	push   $0x0
+    183a:	e8 30 fb ff ff       	call   136f <sbrk>
+    183f:	83 c4 10             	add    $0x10,%esp
+    1842:	8b 15 0c 29 00 00    	mov    0x290c,%edx
+    1848:	83 c2 08             	add    $0x8,%edx
+    184b:	39 d0                	cmp    %edx,%eax
+    184d:	75 24                	jne    1873 <freechunk+0x125>
+    c->size = USED | PREVUSED;
+    184f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1852:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+    top = c;
+    1858:	8b 45 08             	mov    0x8(%ebp),%eax
+    185b:	a3 0c 29 00 00       	mov    %eax,0x290c
+    sbrk(-size);
+    1860:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1863:	f7 d8                	neg    %eax
+    1865:	83 ec 0c             	sub    $0xc,%esp
+    1868:	50                   	push   %eax
+    1869:	e8 01 fb ff ff       	call   136f <sbrk>
+    186e:	83 c4 10             	add    $0x10,%esp
+    return;
+    1871:	eb 0e                	jmp    1881 <freechunk+0x133>
+  }
+  bininsert(c);
+    1873:	83 ec 0c             	sub    $0xc,%esp
+    1876:	ff 75 08             	push   0x8(%ebp)
+    1879:	e8 22 fe ff ff       	call   16a0 <bininsert>
+    187e:	83 c4 10             	add    $0x10,%esp
+}
+    1881:	c9                   	leave
+    1882:	c3                   	ret
+
+00001883 <morecore>:
+
+// Grow the heap by at least need bytes.
+static int
+morecore(uint need)
+{
+    1883:	55                   	push   %ebp
+    1884:	89 e5                	mov    %esp,%ebp
+    1886:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+  char *p;
+  uint n, pad;
+
+  n = need + MINCHUNK;
+    1889:	8b 45 08             	mov    0x8(%ebp),%eax
+    188c:	83 c0 18             	add    $0x18,%eax
+    188f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(n < MINCORE)
+    1892:	81 7d ec ff 3f 00 00 	cmpl   $0x3fff,-0x14(%ebp)
+    1899:	77 07                	ja     18a2 <morecore+0x1f>
+    n = MINCORE;
+    189b:	c7 45 ec 00 40 00 00 	movl   $0x4000,-0x14(%ebp)
+  // Keep the break 8-aligned, with the end marker just below it.
+  pad = (8 - ((uint)sbrk(0) & 7)) & 7;
+    18a2:	83 ec 0c             	sub    $0xc,%esp
+    18a5:	6a 00                	push   $0x0
+    18a7:	e8 c3 fa ff ff       	call   136f <sbrk>
+    18ac:	83 c4 10             	add    $0x10,%esp
+    18af:	83 e0 07             	and    $0x7,%eax
+    18b2:	ba 08 00 00 00       	mov    $0x8,%edx
+    18b7:	29 c2                	sub    %eax,%edx
+    18b9:	89 d0                	mov    %edx,%eax
+    18bb:	83 e0 07             	and    $0x7,%eax
+    18be:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if((p = sbrk(pad + n)) == (char*)-1){
+    18c1:	8b 55 e8             	mov    -0x18(%ebp),%edx
+    18c4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    18c7:	01 d0                	add    %edx,%eax
+    18c9:	83 ec 0c             	sub    $0xc,%esp
+    18cc:	50                   	push   %eax
+    18cd:	e8 9d fa ff ff       	call   136f <sbrk>
+    18d2:	83 c4 10             	add    $0x10,%esp
+    18d5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    18d8:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+    18dc:	75 30                	jne    190e <morecore+0x8b>
+    n = need + MINCHUNK;
+    18de:	8b 45 08             	mov    0x8(%ebp),%eax
+    18e1:	83 c0 18             	add    $0x18,%eax
+    18e4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((p = sbrk(pad + n)) == (char*)-1)
+    18e7:	8b 55 e8             	mov    -0x18(%ebp),%edx
+    18ea:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    18ed:	01 d0                	add    %edx,%eax
+    18ef:	83 ec 0c             	sub    $0xc,%esp
+    18f2:	50                   	push   %eax
+    18f3:	e8 77 fa ff ff       	call   136f <sbrk>
+    18f8:	83 c4 10             	add    $0x10,%esp
+    18fb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    18fe:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+    1902:	75 0a                	jne    190e <morecore+0x8b>
+      return -1;
+    1904:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1909:	e9 8e 00 00 00       	jmp    199c <morecore+0x119>
+  }
+  p += pad;
+    190e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1911:	01 45 f0             	add    %eax,-0x10(%ebp)
+  if(top && p == (char*)top + HDRSIZE){
+    1914:	a1 0c 29 00 00       	mov    0x290c,%eax
+    1919:	85 c0                	test   %eax,%eax
+    191b:	74 29                	je     1946 <morecore+0xc3>
+    191d:	a1 0c 29 00 00       	mov    0x290c,%eax
+    1922:	83 c0 08             	add    $0x8,%eax
+    1925:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+    1928:	75 1c                	jne    1946 <morecore+0xc3>
+    // Contiguous: the old end marker heads the new chunk.
+    c = top;
+    192a:	a1 0c 29 00 00       	mov    0x290c,%eax
+    192f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = n | (c->size & PREVUSED);
+    1932:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1935:	8b 00                	mov    (%eax),%eax
+    1937:	83 e0 02             	and    $0x2,%eax
+    193a:	0b 45 ec             	or     -0x14(%ebp),%eax
+    193d:	89 c2                	mov    %eax,%edx
+    193f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1942:	89 10                	mov    %edx,(%eax)
+    1944:	eb 16                	jmp    195c <morecore+0xd9>
+  } else {
+    // Someone else moved the break: start a new segment.
+    c = (struct chunk*)p;
+    1946:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1949:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = (n - HDRSIZE) | PREVUSED;
+    194c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    194f:	83 e8 08             	sub    $0x8,%eax
+    1952:	83 c8 02             	or     $0x2,%eax
+    1955:	89 c2                	mov    %eax,%edx
+    1957:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    195a:	89 10                	mov    %edx,(%eax)
+  }
+  top = NEXTC(c);
+    195c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    195f:	8b 00                	mov    (%eax),%eax
+    1961:	83 e0 f8             	and    $0xfffffff8,%eax
+    1964:	89 c2                	mov    %eax,%edx
+    1966:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1969:	01 d0                	add    %edx,%eax
+    196b:	a3 0c 29 00 00       	mov    %eax,0x290c
+  top->size = USED;
+    1970:	a1 0c 29 00 00       	mov    0x290c,%eax
+    1975:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  top->tag = LARGE;
+    197b:	a1 0c 29 00 00       	mov    0x290c,%eax
+    1980:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  freechunk(c, 0);
+    1987:	83 ec 08             	sub    $0x8,%esp
+    198a:	6a 00                	push   $0x0
+    198c:	ff 75 f4             	push   -0xc(%ebp)
+    198f:	e8 ba fd ff ff       	call   174e <freechunk>
+    1994:	83 c4 10             	add    $0x10,%esp
+  return 0;
+    1997:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    199c:	c9                   	leave
+    199d:	c3                   	ret
+
+0000199e <largealloc>:
+
+static void*
+largealloc(uint nbytes)
+{
+    199e:	55                   	push   %ebp
+    199f:	89 e5                	mov    %esp,%ebp
+    19a1:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c, *r;
+  uint need;
+  int i;
+
+  if(nbytes > 0x7fffffff)
+    19a4:	8b 45 08             	mov    0x8(%ebp),%eax
+    19a7:	85 c0                	test   %eax,%eax
+    19a9:	79 0a                	jns    19b5 <largealloc+0x17>
+    return 0;
+    19ab:	b8 00 00 00 00       	mov    $0x0,%eax
+    19b0:	e9 43 01 00 00       	jmp    1af8 <largealloc+0x15a>
+  need = (nbytes + HDRSIZE + 7) & ~7;
+    19b5:	8b 45 08             	mov    0x8(%ebp),%eax
+    19b8:	83 c0 0f             	add    $0xf,%eax
+    19bb:	83 e0 f8             	and    $0xfffffff8,%eax
+    19be:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(need < MINCHUNK)
+    19c1:	83 7d f0 17          	cmpl   $0x17,-0x10(%ebp)
+    19c5:	77 07                	ja     19ce <largealloc+0x30>
+    need = MINCHUNK;
+    19c7:	c7 45 f0 18 00 00 00 	movl   $0x18,-0x10(%ebp)
+  for(;;){
+    for(i = binof(need); i < NBIN; i++)
+    19ce:	ff 75 f0             	push   -0x10(%ebp)
+    19d1:	e8 9f fc ff ff       	call   1675 <binof>
+    19d6:	83 c4 04             	add    $0x4,%esp
+    19d9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    19dc:	eb 2f                	jmp    1a0d <largealloc+0x6f>
+      for(c = bins[i]; c; c = c->next)
+    19de:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    19e1:	8b 04 85 a0 28 00 00 	mov    0x28a0(,%eax,4),%eax
+    19e8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    19eb:	eb 16                	jmp    1a03 <largealloc+0x65>
+        if(CSIZE(c) >= need)
+    19ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    19f0:	8b 00                	mov    (%eax),%eax
+    19f2:	83 e0 f8             	and    $0xfffffff8,%eax
+    19f5:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+    19f8:	73 35                	jae    1a2f <largealloc+0x91>
+      for(c = bins[i]; c; c = c->next)
+    19fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    19fd:	8b 40 08             	mov    0x8(%eax),%eax
+    1a00:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1a03:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1a07:	75 e4                	jne    19ed <largealloc+0x4f>
+    for(i = binof(need); i < NBIN; i++)
+    1a09:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    1a0d:	83 7d ec 1a          	cmpl   $0x1a,-0x14(%ebp)
+    1a11:	7e cb                	jle    19de <largealloc+0x40>
+          goto found;
+    if(morecore(need) < 0)
+    1a13:	83 ec 0c             	sub    $0xc,%esp
+    1a16:	ff 75 f0             	push   -0x10(%ebp)
+    1a19:	e8 65 fe ff ff       	call   1883 <morecore>
+    1a1e:	83 c4 10             	add    $0x10,%esp
+    1a21:	85 c0                	test   %eax,%eax
+    1a23:	79 a9                	jns    19ce <largealloc+0x30>
+      return 0;
+    1a25:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a2a:	e9 c9 00 00 00       	jmp    1af8 <largealloc+0x15a>
+          goto found;
+    1a2f:	90                   	nop
+  }
+
+found:
+  binremove(c);
+    1a30:	83 ec 0c             	sub    $0xc,%esp
+    1a33:	ff 75 f4             	push   -0xc(%ebp)
+    1a36:	e8 bb fc ff ff       	call   16f6 <binremove>
+    1a3b:	83 c4 10             	add    $0x10,%esp
+  if(CSIZE(c) - need >= MINCHUNK){
+    1a3e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1a41:	8b 00                	mov    (%eax),%eax
+    1a43:	83 e0 f8             	and    $0xfffffff8,%eax
+    1a46:	2b 45 f0             	sub    -0x10(%ebp),%eax
+    1a49:	83 f8 17             	cmp    $0x17,%eax
+    1a4c:	76 66                	jbe    1ab4 <largealloc+0x116>
+    r = (struct chunk*)((char*)c + need);
+    1a4e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1a51:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1a54:	01 d0                	add    %edx,%eax
+    1a56:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    r->size = (CSIZE(c) - need) | PREVUSED;
+    1a59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1a5c:	8b 00                	mov    (%eax),%eax
+    1a5e:	83 e0 f8             	and    $0xfffffff8,%eax
+    1a61:	2b 45 f0             	sub    -0x10(%ebp),%eax
+    1a64:	83 c8 02             	or     $0x2,%eax
+    1a67:	89 c2                	mov    %eax,%edx
+    1a69:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1a6c:	89 10                	mov    %edx,(%eax)
+    r->tag = LARGE;
+    1a6e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1a71:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+    FOOTER(r) = CSIZE(r);
+    1a78:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1a7b:	8b 10                	mov    (%eax),%edx
+    1a7d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1a80:	8b 00                	mov    (%eax),%eax
+    1a82:	83 e0 f8             	and    $0xfffffff8,%eax
+    1a85:	8d 48 fc             	lea    -0x4(%eax),%ecx
+    1a88:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1a8b:	01 c8                	add    %ecx,%eax
+    1a8d:	83 e2 f8             	and    $0xfffffff8,%edx
+    1a90:	89 10                	mov    %edx,(%eax)
+    bininsert(r);
+    1a92:	83 ec 0c             	sub    $0xc,%esp
+    1a95:	ff 75 e8             	push   -0x18(%ebp)
+    1a98:	e8 03 fc ff ff       	call   16a0 <bininsert>
+    1a9d:	83 c4 10             	add    $0x10,%esp
+    c->size = need | (c->size & PREVUSED);
+    1aa0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1aa3:	8b 00                	mov    (%eax),%eax
+    1aa5:	83 e0 02             	and    $0x2,%eax
+    1aa8:	0b 45 f0             	or     -0x10(%ebp),%eax
+    1aab:	89 c2                	mov    %eax,%edx
+    1aad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ab0:	89 10                	mov    %edx,(%eax)
+    1ab2:	eb 25                	jmp    1ad9 <largealloc+0x13b>
+  } else
+    NEXTC(c)->size |= PREVUSED;
+    1ab4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ab7:	8b 00                	mov    (%eax),%eax
+    1ab9:	83 e0 f8             	and    $0xfffffff8,%eax
+    1abc:	89 c2                	mov    %eax,%edx
+    1abe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ac1:	01 d0                	add    %edx,%eax
+    1ac3:	8b 10                	mov    (%eax),%edx
+    1ac5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ac8:	8b 00                	mov    (%eax),%eax
+    1aca:	83 e0 f8             	and    $0xfffffff8,%eax
+    1acd:	89 c1                	mov    %eax,%ecx
+    1acf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ad2:	01 c8                	add    %ecx,%eax
+    1ad4:	83 ca 02             	or     $0x2,%edx
+    1ad7:	89 10                	mov    %edx,(%eax)
+  c->size |= USED;
+    1ad9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1adc:	8b 00                	mov    (%eax),%eax
+    1ade:	83 c8 01             	or     $0x1,%eax
+    1ae1:	89 c2                	mov    %eax,%edx
+    1ae3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ae6:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+    1ae8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1aeb:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  return (char*)c + HDRSIZE;
+    1af2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1af5:	83 c0 08             	add    $0x8,%eax
+}
+    1af8:	c9                   	leave
+    1af9:	c3                   	ret
+
+00001afa <refill>:
+
+// Carve a slab into free blocks of class k.
+static int
+refill(int k)
+{
+    1afa:	55                   	push   %ebp
+    1afb:	89 e5                	mov    %esp,%ebp
+    1afd:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  char *p;
+  uint bs, i;
+
+  if((p = largealloc(SLABSIZE)) == 0)
+    1b00:	83 ec 0c             	sub    $0xc,%esp
+    1b03:	68 00 20 00 00       	push   $0x2000
+    1b08:	e8 91 fe ff ff       	call   199e <largealloc>
+    1b0d:	83 c4 10             	add    $0x10,%esp
+    1b10:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1b13:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1b17:	75 07                	jne    1b20 <refill+0x26>
+    return -1;
+    1b19:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1b1e:	eb 75                	jmp    1b95 <refill+0x9b>
+  bs = HDRSIZE + (MINSMALL << k);
+    1b20:	8b 45 08             	mov    0x8(%ebp),%eax
+    1b23:	ba 10 00 00 00       	mov    $0x10,%edx
+    1b28:	89 c1                	mov    %eax,%ecx
+    1b2a:	d3 e2                	shl    %cl,%edx
+    1b2c:	89 d0                	mov    %edx,%eax
+    1b2e:	83 c0 08             	add    $0x8,%eax
+    1b31:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+    1b34:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1b3b:	eb 44                	jmp    1b81 <refill+0x87>
+    b = (struct chunk*)(p + i);
+    1b3d:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    1b40:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1b43:	01 d0                	add    %edx,%eax
+    1b45:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    b->size = bs | USED;
+    1b48:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1b4b:	83 c8 01             	or     $0x1,%eax
+    1b4e:	89 c2                	mov    %eax,%edx
+    1b50:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1b53:	89 10                	mov    %edx,(%eax)
+    b->tag = k;
+    1b55:	8b 55 08             	mov    0x8(%ebp),%edx
+    1b58:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1b5b:	89 50 04             	mov    %edx,0x4(%eax)
+    b->next = classes[k];
+    1b5e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1b61:	8b 14 85 80 28 00 00 	mov    0x2880(,%eax,4),%edx
+    1b68:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1b6b:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[k] = b;
+    1b6e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1b71:	8b 55 e8             	mov    -0x18(%ebp),%edx
+    1b74:	89 14 85 80 28 00 00 	mov    %edx,0x2880(,%eax,4)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+    1b7b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1b7e:	01 45 f4             	add    %eax,-0xc(%ebp)
+    1b81:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1b84:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1b87:	01 d0                	add    %edx,%eax
+    1b89:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    1b8e:	76 ad                	jbe    1b3d <refill+0x43>
+  }
+  return 0;
+    1b90:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1b95:	c9                   	leave
+    1b96:	c3                   	ret
+
+00001b97 <free>:
+
+void
+free(void *ap)
+{
+    1b97:	55                   	push   %ebp
+    1b98:	89 e5                	mov    %esp,%ebp
+    1b9a:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+
+  if(ap == 0)
+    1b9d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1ba1:	74 4b                	je     1bee <free+0x57>
+    return;
+  c = (struct chunk*)((char*)ap - HDRSIZE);
+    1ba3:	8b 45 08             	mov    0x8(%ebp),%eax
+    1ba6:	83 e8 08             	sub    $0x8,%eax
+    1ba9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(c->tag != LARGE){
+    1bac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1baf:	8b 40 04             	mov    0x4(%eax),%eax
+    1bb2:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1bb5:	74 25                	je     1bdc <free+0x45>
+    c->next = classes[c->tag];
+    1bb7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1bba:	8b 40 04             	mov    0x4(%eax),%eax
+    1bbd:	8b 14 85 80 28 00 00 	mov    0x2880(,%eax,4),%edx
+    1bc4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1bc7:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[c->tag] = c;
+    1bca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1bcd:	8b 40 04             	mov    0x4(%eax),%eax
+    1bd0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1bd3:	89 14 85 80 28 00 00 	mov    %edx,0x2880(,%eax,4)
+    return;
+    1bda:	eb 13                	jmp    1bef <free+0x58>
+  }
+  freechunk(c, 1);
+    1bdc:	83 ec 08             	sub    $0x8,%esp
+    1bdf:	6a 01                	push   $0x1
+    1be1:	ff 75 f4             	push   -0xc(%ebp)
+    1be4:	e8 65 fb ff ff       	call   174e <freechunk>
+    1be9:	83 c4 10             	add    $0x10,%esp
+    1bec:	eb 01                	jmp    1bef <free+0x58>
+    return;
+    1bee:	90                   	nop
+}
+    1bef:	c9                   	leave
+    1bf0:	c3                   	ret
+
+00001bf1 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1bf1:	55                   	push   %ebp
+    1bf2:	89 e5                	mov    %esp,%ebp
+    1bf4:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  int k;
+
+  if(nbytes > MAXSMALL)
+    1bf7:	81 7d 08 00 08 00 00 	cmpl   $0x800,0x8(%ebp)
+    1bfe:	76 10                	jbe    1c10 <malloc+0x1f>
+    return largealloc(nbytes);
+    1c00:	83 ec 0c             	sub    $0xc,%esp
+    1c03:	ff 75 08             	push   0x8(%ebp)
+    1c06:	e8 93 fd ff ff       	call   199e <largealloc>
+    1c0b:	83 c4 10             	add    $0x10,%esp
+    1c0e:	eb 6a                	jmp    1c7a <malloc+0x89>
+  for(k = 0; (MINSMALL << k) < nbytes; k++)
+    1c10:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1c17:	eb 04                	jmp    1c1d <malloc+0x2c>
+    1c19:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1c1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1c20:	ba 10 00 00 00       	mov    $0x10,%edx
+    1c25:	89 c1                	mov    %eax,%ecx
+    1c27:	d3 e2                	shl    %cl,%edx
+    1c29:	89 d0                	mov    %edx,%eax
+    1c2b:	3b 45 08             	cmp    0x8(%ebp),%eax
+    1c2e:	72 e9                	jb     1c19 <malloc+0x28>
+    ;
+  if(classes[k] == 0 && refill(k) < 0)
+    1c30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1c33:	8b 04 85 80 28 00 00 	mov    0x2880(,%eax,4),%eax
+    1c3a:	85 c0                	test   %eax,%eax
+    1c3c:	75 19                	jne    1c57 <malloc+0x66>
+    1c3e:	83 ec 0c             	sub    $0xc,%esp
+    1c41:	ff 75 f4             	push   -0xc(%ebp)
+    1c44:	e8 b1 fe ff ff       	call   1afa <refill>
+    1c49:	83 c4 10             	add    $0x10,%esp
+    1c4c:	85 c0                	test   %eax,%eax
+    1c4e:	79 07                	jns    1c57 <malloc+0x66>
+    return 0;
+    1c50:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c55:	eb 23                	jmp    1c7a <malloc+0x89>
+  b = classes[k];
+    1c57:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1c5a:	8b 04 85 80 28 00 00 	mov    0x2880(,%eax,4),%eax
+    1c61:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  classes[k] = b->next;
+    1c64:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1c67:	8b 50 08             	mov    0x8(%eax),%edx
+    1c6a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1c6d:	89 14 85 80 28 00 00 	mov    %edx,0x2880(,%eax,4)
+  return (char*)b + HDRSIZE;
+    1c74:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1c77:	83 c0 08             	add    $0x8,%eax
+}
+    1c7a:	c9                   	leave
+    1c7b:	c3                   	ret
+
+00001c7c <stream>:
+
+// Return the stream for fd, deciding on first use how
+// its output is buffered.  Returns 0 if fd is not open.
+static struct stream*
+stream(int fd)
+{
+    1c7c:	55                   	push   %ebp
+    1c7d:	89 e5                	mov    %esp,%ebp
+    1c7f:	83 ec 28             	sub    $0x28,%esp
+  struct stream *s;
+  struct stat st;
+
+  if(fd < 0 || fd >= NOFILE)
+    1c82:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1c86:	78 06                	js     1c8e <stream+0x12>
+    1c88:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    1c8c:	7e 07                	jle    1c95 <stream+0x19>
+    return 0;
+    1c8e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c93:	eb 55                	jmp    1cea <stream+0x6e>
+  s = &streams[fd];
+    1c95:	8b 45 08             	mov    0x8(%ebp),%eax
+    1c98:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1c9e:	05 20 29 00 00       	add    $0x2920,%eax
+    1ca3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(s->mode == UNKNOWN){
+    1ca6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ca9:	8b 00                	mov    (%eax),%eax
+    1cab:	85 c0                	test   %eax,%eax
+    1cad:	75 38                	jne    1ce7 <stream+0x6b>
+    if(fstat(fd, &st) < 0)
+    1caf:	83 ec 08             	sub    $0x8,%esp
+    1cb2:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1cb5:	50                   	push   %eax
+    1cb6:	ff 75 08             	push   0x8(%ebp)
+    1cb9:	e8 57 f6 ff ff       	call   1315 <fstat>
+    1cbe:	83 c4 10             	add    $0x10,%esp
+    1cc1:	85 c0                	test   %eax,%eax
+    1cc3:	79 07                	jns    1ccc <stream+0x50>
+      return 0;
+    1cc5:	b8 00 00 00 00       	mov    $0x0,%eax
+    1cca:	eb 1e                	jmp    1cea <stream+0x6e>
+    s->mode = st.type == T_DEV ? LINEBUF : FULLBUF;
+    1ccc:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+    1cd0:	66 83 f8 03          	cmp    $0x3,%ax
+    1cd4:	75 07                	jne    1cdd <stream+0x61>
+    1cd6:	ba 01 00 00 00       	mov    $0x1,%edx
+    1cdb:	eb 05                	jmp    1ce2 <stream+0x66>
+    1cdd:	ba 02 00 00 00       	mov    $0x2,%edx
+    1ce2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ce5:	89 10                	mov    %edx,(%eax)
+  }
+  return s;
+    1ce7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1cea:	c9                   	leave
+    1ceb:	c3                   	ret
+
+00001cec <fflush>:
+
+int
+fflush(int fd)
+{
+    1cec:	55                   	push   %ebp
+    1ced:	89 e5                	mov    %esp,%ebp
+    1cef:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  int i, n;
+
+  if(fd < 0 || fd >= NOFILE)
+    1cf2:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1cf6:	78 06                	js     1cfe <fflush+0x12>
+    1cf8:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    1cfc:	7e 07                	jle    1d05 <fflush+0x19>
+    return -1;
+    1cfe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1d03:	eb 78                	jmp    1d7d <fflush+0x91>
+  s = &streams[fd];
+    1d05:	8b 45 08             	mov    0x8(%ebp),%eax
+    1d08:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1d0e:	05 20 29 00 00       	add    $0x2920,%eax
+    1d13:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < s->nout; i += n){
+    1d16:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1d1d:	eb 44                	jmp    1d63 <fflush+0x77>
+    if((n = write(fd, s->out + i, s->nout - i)) <= 0){
+    1d1f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1d22:	8b 40 04             	mov    0x4(%eax),%eax
+    1d25:	2b 45 f4             	sub    -0xc(%ebp),%eax
+    1d28:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    1d2b:	8d 4a 10             	lea    0x10(%edx),%ecx
+    1d2e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1d31:	01 ca                	add    %ecx,%edx
+    1d33:	83 ec 04             	sub    $0x4,%esp
+    1d36:	50                   	push   %eax
+    1d37:	52                   	push   %edx
+    1d38:	ff 75 08             	push   0x8(%ebp)
+    1d3b:	e8 6c f5 ff ff       	call   12ac <write>
+    1d40:	83 c4 10             	add    $0x10,%esp
+    1d43:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1d46:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1d4a:	7f 11                	jg     1d5d <fflush+0x71>
+      s->nout = 0;
+    1d4c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1d4f:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+      return -1;
+    1d56:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1d5b:	eb 20                	jmp    1d7d <fflush+0x91>
+  for(i = 0; i < s->nout; i += n){
+    1d5d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1d60:	01 45 f4             	add    %eax,-0xc(%ebp)
+    1d63:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1d66:	8b 40 04             	mov    0x4(%eax),%eax
+    1d69:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    1d6c:	7c b1                	jl     1d1f <fflush+0x33>
+    }
+  }
+  s->nout = 0;
+    1d6e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1d71:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  return 0;
+    1d78:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1d7d:	c9                   	leave
+    1d7e:	c3                   	ret
+
+00001d7f <flushall>:
+
+// Flush every stream, or only line-buffered ones.
+static void
+flushall(int lineonly)
+{
+    1d7f:	55                   	push   %ebp
+    1d80:	89 e5                	mov    %esp,%ebp
+    1d82:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+    1d85:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1d8c:	eb 41                	jmp    1dcf <flushall+0x50>
+    if(streams[fd].nout > 0 && (!lineonly || streams[fd].mode == LINEBUF))
+    1d8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1d91:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1d97:	05 24 29 00 00       	add    $0x2924,%eax
+    1d9c:	8b 00                	mov    (%eax),%eax
+    1d9e:	85 c0                	test   %eax,%eax
+    1da0:	7e 29                	jle    1dcb <flushall+0x4c>
+    1da2:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1da6:	74 15                	je     1dbd <flushall+0x3e>
+    1da8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1dab:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1db1:	05 20 29 00 00       	add    $0x2920,%eax
+    1db6:	8b 00                	mov    (%eax),%eax
+    1db8:	83 f8 01             	cmp    $0x1,%eax
+    1dbb:	75 0e                	jne    1dcb <flushall+0x4c>
+      fflush(fd);
+    1dbd:	83 ec 0c             	sub    $0xc,%esp
+    1dc0:	ff 75 f4             	push   -0xc(%ebp)
+    1dc3:	e8 24 ff ff ff       	call   1cec <fflush>
+    1dc8:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++)
+    1dcb:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1dcf:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+    1dd3:	7e b9                	jle    1d8e <flushall+0xf>
+}
+    1dd5:	90                   	nop
+    1dd6:	90                   	nop
+    1dd7:	c9                   	leave
+    1dd8:	c3                   	ret
+
+00001dd9 <fputc>:
+
+int
+fputc(int fd, int c)
+{
+    1dd9:	55                   	push   %ebp
+    1dda:	89 e5                	mov    %esp,%ebp
+    1ddc:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  char ch;
+
+  if((s = stream(fd)) == 0){
+    1ddf:	83 ec 0c             	sub    $0xc,%esp
+    1de2:	ff 75 08             	push   0x8(%ebp)
+    1de5:	e8 92 fe ff ff       	call   1c7c <stream>
+    1dea:	83 c4 10             	add    $0x10,%esp
+    1ded:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1df0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1df4:	75 2e                	jne    1e24 <fputc+0x4b>
+    ch = c;
+    1df6:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1df9:	88 45 f3             	mov    %al,-0xd(%ebp)
+    return write(fd, &ch, 1) == 1 ? (uchar)c : -1;
+    1dfc:	83 ec 04             	sub    $0x4,%esp
+    1dff:	6a 01                	push   $0x1
+    1e01:	8d 45 f3             	lea    -0xd(%ebp),%eax
+    1e04:	50                   	push   %eax
+    1e05:	ff 75 08             	push   0x8(%ebp)
+    1e08:	e8 9f f4 ff ff       	call   12ac <write>
+    1e0d:	83 c4 10             	add    $0x10,%esp
+    1e10:	83 f8 01             	cmp    $0x1,%eax
+    1e13:	75 08                	jne    1e1d <fputc+0x44>
+    1e15:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1e18:	0f b6 c0             	movzbl %al,%eax
+    1e1b:	eb 5e                	jmp    1e7b <fputc+0xa2>
+    1e1d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1e22:	eb 57                	jmp    1e7b <fputc+0xa2>
+  }
+  s->out[s->nout++] = c;
+    1e24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1e27:	8b 40 04             	mov    0x4(%eax),%eax
+    1e2a:	8d 48 01             	lea    0x1(%eax),%ecx
+    1e2d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1e30:	89 4a 04             	mov    %ecx,0x4(%edx)
+    1e33:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1e36:	89 d1                	mov    %edx,%ecx
+    1e38:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1e3b:	88 4c 02 10          	mov    %cl,0x10(%edx,%eax,1)
+  if(s->nout == BUFSZ || (s->mode == LINEBUF && c == '\n'))
+    1e3f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1e42:	8b 40 04             	mov    0x4(%eax),%eax
+    1e45:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1e4a:	74 10                	je     1e5c <fputc+0x83>
+    1e4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1e4f:	8b 00                	mov    (%eax),%eax
+    1e51:	83 f8 01             	cmp    $0x1,%eax
+    1e54:	75 1f                	jne    1e75 <fputc+0x9c>
+    1e56:	83 7d 0c 0a          	cmpl   $0xa,0xc(%ebp)
+    1e5a:	75 19                	jne    1e75 <fputc+0x9c>
+    if(fflush(fd) < 0)
+    1e5c:	83 ec 0c             	sub    $0xc,%esp
+    1e5f:	ff 75 08             	push   0x8(%ebp)
+    1e62:	e8 85 fe ff ff       	call   1cec <fflush>
+    1e67:	83 c4 10             	add    $0x10,%esp
+    1e6a:	85 c0                	test   %eax,%eax
+    1e6c:	79 07                	jns    1e75 <fputc+0x9c>
+      return -1;
+    1e6e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1e73:	eb 06                	jmp    1e7b <fputc+0xa2>
+  return (uchar)c;
+    1e75:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1e78:	0f b6 c0             	movzbl %al,%eax
+}
+    1e7b:	c9                   	leave
+    1e7c:	c3                   	ret
+
+00001e7d <fgetc>:
+
+// Return the next byte read from fd, or -1 at end of file.
+int
+fgetc(int fd)
+{
+    1e7d:	55                   	push   %ebp
+    1e7e:	89 e5                	mov    %esp,%ebp
+    1e80:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  uchar c;
+  int n;
+
+  if((s = stream(fd)) == 0){
+    1e83:	83 ec 0c             	sub    $0xc,%esp
+    1e86:	ff 75 08             	push   0x8(%ebp)
+    1e89:	e8 ee fd ff ff       	call   1c7c <stream>
+    1e8e:	83 c4 10             	add    $0x10,%esp
+    1e91:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1e94:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1e98:	75 39                	jne    1ed3 <fgetc+0x56>
+    flushall(1);
+    1e9a:	83 ec 0c             	sub    $0xc,%esp
+    1e9d:	6a 01                	push   $0x1
+    1e9f:	e8 db fe ff ff       	call   1d7f <flushall>
+    1ea4:	83 c4 10             	add    $0x10,%esp
+    return read(fd, &c, 1) == 1 ? c : -1;
+    1ea7:	83 ec 04             	sub    $0x4,%esp
+    1eaa:	6a 01                	push   $0x1
+    1eac:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    1eaf:	50                   	push   %eax
+    1eb0:	ff 75 08             	push   0x8(%ebp)
+    1eb3:	e8 e5 f3 ff ff       	call   129d <read>
+    1eb8:	83 c4 10             	add    $0x10,%esp
+    1ebb:	83 f8 01             	cmp    $0x1,%eax
+    1ebe:	75 0c                	jne    1ecc <fgetc+0x4f>
+    1ec0:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    1ec4:	0f b6 c0             	movzbl %al,%eax
+    1ec7:	e9 80 00 00 00       	jmp    1f4c <fgetc+0xcf>
+    1ecc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1ed1:	eb 79                	jmp    1f4c <fgetc+0xcf>
+  }
+  if(s->rpos == s->rend){
+    1ed3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ed6:	8b 50 08             	mov    0x8(%eax),%edx
+    1ed9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1edc:	8b 40 0c             	mov    0xc(%eax),%eax
+    1edf:	39 c2                	cmp    %eax,%edx
+    1ee1:	75 4c                	jne    1f2f <fgetc+0xb2>
+    flushall(1);
+    1ee3:	83 ec 0c             	sub    $0xc,%esp
+    1ee6:	6a 01                	push   $0x1
+    1ee8:	e8 92 fe ff ff       	call   1d7f <flushall>
+    1eed:	83 c4 10             	add    $0x10,%esp
+    if((n = read(fd, s->in, BUFSZ)) <= 0)
+    1ef0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ef3:	05 10 02 00 00       	add    $0x210,%eax
+    1ef8:	83 ec 04             	sub    $0x4,%esp
+    1efb:	68 00 02 00 00       	push   $0x200
+    1f00:	50                   	push   %eax
+    1f01:	ff 75 08             	push   0x8(%ebp)
+    1f04:	e8 94 f3 ff ff       	call   129d <read>
+    1f09:	83 c4 10             	add    $0x10,%esp
+    1f0c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1f0f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1f13:	7f 07                	jg     1f1c <fgetc+0x9f>
+      return -1;
+    1f15:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1f1a:	eb 30                	jmp    1f4c <fgetc+0xcf>
+    s->rpos = 0;
+    1f1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1f1f:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+    s->rend = n;
+    1f26:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1f29:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    1f2c:	89 50 0c             	mov    %edx,0xc(%eax)
+  }
+  return (uchar)s->in[s->rpos++];
+    1f2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1f32:	8b 40 08             	mov    0x8(%eax),%eax
+    1f35:	8d 48 01             	lea    0x1(%eax),%ecx
+    1f38:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1f3b:	89 4a 08             	mov    %ecx,0x8(%edx)
+    1f3e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1f41:	0f b6 84 02 10 02 00 	movzbl 0x210(%edx,%eax,1),%eax
+    1f48:	00 
+    1f49:	0f b6 c0             	movzbl %al,%eax
+}
+    1f4c:	c9                   	leave
+    1f4d:	c3                   	ret
+
+00001f4e <fork>:
+
+int
+fork(void)
+{
+    1f4e:	55                   	push   %ebp
+    1f4f:	89 e5                	mov    %esp,%ebp
+    1f51:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1f54:	83 ec 0c             	sub    $0xc,%esp
+    1f57:	6a 00                	push   $0x0
+    1f59:	e8 21 fe ff ff       	call   1d7f <flushall>
+    1f5e:	83 c4 10             	add    $0x10,%esp
+  return _fork();
+    1f61:	e8 fb f2 ff ff       	call   1261 <_fork>
+}
+    1f66:	c9                   	leave
+    1f67:	c3                   	ret
+
+00001f68 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+    1f68:	55                   	push   %ebp
+    1f69:	89 e5                	mov    %esp,%ebp
+    1f6b:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1f6e:	83 ec 0c             	sub    $0xc,%esp
+    1f71:	6a 00                	push   $0x0
+    1f73:	e8 07 fe ff ff       	call   1d7f <flushall>
+    1f78:	83 c4 10             	add    $0x10,%esp
+  return _exec(path, argv);
+    1f7b:	83 ec 08             	sub    $0x8,%esp
+    1f7e:	ff 75 0c             	push   0xc(%ebp)
+    1f81:	ff 75 08             	push   0x8(%ebp)
+    1f84:	e8 50 f3 ff ff       	call   12d9 <_exec>
+    1f89:	83 c4 10             	add    $0x10,%esp
+}
+    1f8c:	c9                   	leave
+    1f8d:	c3                   	ret
+
+00001f8e <exit>:
+
+int
+exit(void)
+{
+    1f8e:	55                   	push   %ebp
+    1f8f:	89 e5                	mov    %esp,%ebp
+    1f91:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1f94:	83 ec 0c             	sub    $0xc,%esp
+    1f97:	6a 00                	push   $0x0
+    1f99:	e8 e1 fd ff ff       	call   1d7f <flushall>
+    1f9e:	83 c4 10             	add    $0x10,%esp
+  _exit();
+    1fa1:	e8 ca f2 ff ff       	call   1270 <_exit>
+
+00001fa6 <close>:
+}
+
+int
+close(int fd)
+{
+    1fa6:	55                   	push   %ebp
+    1fa7:	89 e5                	mov    %esp,%ebp
+    1fa9:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+
+  if(fd >= 0 && fd < NOFILE){
+    1fac:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1fb0:	78 44                	js     1ff6 <close+0x50>
+    1fb2:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    1fb6:	7f 3e                	jg     1ff6 <close+0x50>
+    fflush(fd);
+    1fb8:	83 ec 0c             	sub    $0xc,%esp
+    1fbb:	ff 75 08             	push   0x8(%ebp)
+    1fbe:	e8 29 fd ff ff       	call   1cec <fflush>
+    1fc3:	83 c4 10             	add    $0x10,%esp
+    s = &streams[fd];
+    1fc6:	8b 45 08             	mov    0x8(%ebp),%eax
+    1fc9:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1fcf:	05 20 29 00 00       	add    $0x2920,%eax
+    1fd4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    s->mode = UNKNOWN;
+    1fd7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1fda:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    s->rpos = s->rend = 0;
+    1fe0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1fe3:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    1fea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1fed:	8b 50 0c             	mov    0xc(%eax),%edx
+    1ff0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ff3:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  return _close(fd);
+    1ff6:	83 ec 0c             	sub    $0xc,%esp
+    1ff9:	ff 75 08             	push   0x8(%ebp)
+    1ffc:	e8 ba f2 ff ff       	call   12bb <_close>
+    2001:	83 c4 10             	add    $0x10,%esp
+}
+    2004:	c9                   	leave
+    2005:	c3                   	ret
@@ -0,0 +1,201 @@
+// Kernel object allocator, for things smaller than a page.
+//
+// kmalloc() serves requests of up to KMAXSIZE bytes from one
+// cache per power-of-two size.  A cache carves kalloc() pages
+// ("slabs") into objects; the slab header at the start of each
+// page says which cache the objects belong to, so kmfree()
+// needs no size.  Each CPU keeps a magazine of free objects
+// of every size, so most calls touch only that CPU's magazine,
+// with interrupts off and no lock; a cache's lock is taken only
+// to refill an empty magazine or drain a full one.  A slab whose
+// objects are all free goes back to kalloc() once its cache
+// already holds another empty one.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+
+#define NKCLASS   7     // object sizes 16, 32, ..., 1024
+#define KMINSIZE  16
+#define KMAXSIZE  (KMINSIZE << (NKCLASS-1))
+#define MAGSIZE   16    // free objects a CPU keeps per size
+
+struct kobj {
+  struct kobj *next;
+};
+
+struct slab {
+  struct kcache *cache;
+  struct slab *next;   // cache's list of slabs with free objects
+  struct slab *prev;
+  uint inuse;          // objects handed out, including to magazines
+  struct kobj *free;
+};
+
+#define SLABHDR  ((sizeof(struct slab) + KMINSIZE-1) & ~(KMINSIZE-1))
+
+struct kcache {
+  struct spinlock lock;
+  uint size;
+  struct slab *avail;  // slabs with at least one free object
+  int nempty;          // slabs on avail with no objects in use
+};
+
+struct magazine {
+  int n;
+  void *obj[MAGSIZE];
+};
+
+static struct kcache caches[NKCLASS];
+static struct magazine mags[NCPU][NKCLASS];
+
+void
+slabinit(void)
+{
+  int k;
+
+  for(k = 0; k < NKCLASS; k++){
+    initlock(&caches[k].lock, "kcache");
+    caches[k].size = KMINSIZE << k;
+  }
+}
+
+static void
+availinsert(struct kcache *c, struct slab *s)
+{
+  s->prev = 0;
+  s->next = c->avail;
+  if(c->avail)
+    c->avail->prev = s;
+  c->avail = s;
+}
+
+static void
+availremove(struct kcache *c, struct slab *s)
+{
+  if(s->prev)
+    s->prev->next = s->next;
+  else
+    c->avail = s->next;
+  if(s->next)
+    s->next->prev = s->prev;
+}
+
+// Take one object from cache c, growing it by a slab if need be.
+// Caller holds c->lock.
+static void*
+cacheget(struct kcache *c)
+{
+  struct slab *s;
+  struct kobj *o;
+  char *p;
+
+  if((s = c->avail) == 0){
+    if((s = (struct slab*)kalloc()) == 0)
+      return 0;
+    s->cache = c;
+    s->inuse = 0;
+    s->free = 0;
+    for(p = (char*)s + SLABHDR; p + c->size <= (char*)s + PGSIZE; p += c->size){
+      o = (struct kobj*)p;
+      o->next = s->free;
+      s->free = o;
+    }
+    availinsert(c, s);
+    c->nempty++;
+  }
+  o = s->free;
+  s->free = o->next;
+  if(s->inuse++ == 0)
+    c->nempty--;
+  if(s->free == 0)
+    availremove(c, s);
+  return o;
+}
+
+// Return object v to its slab.  Caller holds c->lock.
+static void
+cacheput(struct kcache *c, void *v)
+{
+  struct slab *s;
+  struct kobj *o;
+
+  s = (struct slab*)PGROUNDDOWN((uint)v);
+  if(s->free == 0)
+    availinsert(c, s);
+  o = v;
+  o->next = s->free;
+  s->free = o;
+  if(--s->inuse == 0){
+    if(c->nempty > 0){
+      availremove(c, s);
+      kfree((char*)s);
+    } else
+      c->nempty++;
+  }
+}
+
+// Allocate n bytes of kernel memory.  Requests larger than
+// KMAXSIZE get a whole page.  Returns 0 if out of memory.
+void*
+kmalloc(uint n)
+{
+  struct magazine *m;
+  struct kcache *c;
+  void *v;
+  int k;
+
+  if(n > PGSIZE)
+    return 0;
+  if(n > KMAXSIZE)
+    return kalloc();
+  for(k = 0; (KMINSIZE << k) < n; k++)
+    ;
+  c = &caches[k];
+
+  pushcli();
+  m = &mags[cpu - cpus][k];
+  if(m->n == 0){
+    acquire(&c->lock);
+    while(m->n < MAGSIZE/2 && (v = cacheget(c)) != 0)
+      m->obj[m->n++] = v;
+    release(&c->lock);
+  }
+  v = m->n > 0 ? m->obj[--m->n] : 0;
+  popcli();
+  return v;
+}
+
+// Free memory returned by kmalloc().
+void
+kmfree(void *v)
+{
+  struct magazine *m;
+  struct kcache *c;
+
+  if((uint)v % PGSIZE == 0){
+    kfree(v);  // a whole page; slab objects never start one
+    return;
+  }
+  c = ((struct slab*)PGROUNDDOWN((uint)v))->cache;
+  if(c < caches || c >= caches + NKCLASS)
+    panic("kmfree");
+
+  // Fill with junk to catch dangling refs.
+  memset(v, 1, c->size);
+
+  pushcli();
+  m = &mags[cpu - cpus][c - caches];
+  if(m->n == MAGSIZE){
+    acquire(&c->lock);
+    while(m->n > MAGSIZE/2)
+      cacheput(c, m->obj[--m->n]);
+    release(&c->lock);
+  }
+  m->obj[m->n++] = v;
+  popcli();
+}
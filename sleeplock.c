@@ -0,0 +1,148 @@
+// Sleeping locks
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "lockstat.h"
+
+// A waiting process, on its own stack.
+struct slwaiter {
+  struct proc *p;
+  int shared;
+  int granted;             // releasesleep gave it the lock
+  struct slwaiter *next;
+};
+
+void
+initsleeplock(struct sleeplock *lk, char *name)
+{
+  initlock(&lk->lk, name);
+  lk->name = name;
+  lk->locked = 0;
+  lk->pid = 0;
+  lk->readers = 0;
+  lk->head = 0;
+  lk->tail = 0;
+}
+
+static void
+enqueue(struct sleeplock *lk, struct slwaiter *w)
+{
+  w->next = 0;
+  if(lk->tail)
+    lk->tail->next = w;
+  else
+    lk->head = w;
+  lk->tail = w;
+}
+
+// Queue behind earlier waiters and sleep until granted the
+// lock; count the wait in the lock's statistics.  w leaves
+// the queue in grant(), before waitfor can return.
+// Caller holds lk->lk.
+static void
+waitfor(struct sleeplock *lk, int shared)
+{
+  struct slwaiter w;
+  uint ticks0;
+
+  w.p = proc;
+  w.shared = shared;
+  w.granted = 0;
+  enqueue(lk, &w);
+
+  ticks0 = ticks;
+  while(!w.granted)
+    sleep(&w, &lk->lk);
+  if(lk->lk.stat){
+    __sync_fetch_and_add(&lk->lk.stat->nsleep, 1);
+    __sync_fetch_and_add(&lk->lk.stat->sleepticks, ticks - ticks0);
+  }
+}
+
+// Hand the lock to the waiters at the head of the queue that
+// can have it now.  Only the waiter itself is woken, rather
+// than everything sleeping.  Caller holds lk->lk.
+static void
+grant(struct sleeplock *lk)
+{
+  struct slwaiter *w;
+
+  while((w = lk->head) != 0){
+    if(lk->locked || (!w->shared && lk->readers > 0))
+      break;
+    lk->head = w->next;
+    if(lk->head == 0)
+      lk->tail = 0;
+    if(w->shared)
+      lk->readers++;
+    else {
+      lk->locked = 1;
+      lk->pid = w->p->pid;
+    }
+    w->granted = 1;
+    // w stays valid: its owner can't return from sleep
+    // until we release lk->lk.
+    wakeproc(w->p, w);
+  }
+}
+
+void
+acquiresleep(struct sleeplock *lk)
+{
+  acquire(&lk->lk);
+  if(lk->locked || lk->readers > 0 || lk->head)
+    waitfor(lk, 0);
+  else {
+    lk->locked = 1;
+    lk->pid = proc->pid;
+  }
+  release(&lk->lk);
+}
+
+// Acquire lk shared with other readers.  Readers queue behind
+// a waiting writer, so a stream of them can't starve it.
+void
+acquiresleepshared(struct sleeplock *lk)
+{
+  acquire(&lk->lk);
+  if(lk->locked || lk->head)
+    waitfor(lk, 1);
+  else
+    lk->readers++;
+  release(&lk->lk);
+}
+
+// Release lk, held either exclusively or shared.
+void
+releasesleep(struct sleeplock *lk)
+{
+  acquire(&lk->lk);
+  if(lk->locked){
+    lk->locked = 0;
+    lk->pid = 0;
+  } else if(lk->readers > 0)
+    lk->readers--;
+  else
+    panic("releasesleep");
+  grant(lk);
+  release(&lk->lk);
+}
+
+// Is lk held exclusively by this process, or held shared?
+int
+holdingsleep(struct sleeplock *lk)
+{
+  int r;
+
+  acquire(&lk->lk);
+  r = lk->locked ? lk->pid == proc->pid : lk->readers > 0;
+  release(&lk->lk);
+  return r;
+}
@@ -0,0 +1,15 @@
+// Long-term lock for processes: waiters sleep instead of spin.
+// Held either exclusively by one process or shared by any
+// number of readers.  Waiters queue in arrival order, and
+// releasesleep hands the lock straight to the first of them,
+// or to the run of readers at the head of the queue.
+struct sleeplock {
+  struct spinlock lk;      // protects this sleep lock
+  int locked;              // held exclusively?
+  int pid;                 // process holding it exclusively
+  int readers;             // number of shared holders
+  struct slwaiter *head;   // waiters, oldest first
+  struct slwaiter *tail;
+  char *name;              // name of lock
+};
+
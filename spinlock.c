@@ -8,13 +8,45 @@
 #include "mmu.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "lockstat.h"
+
+static struct lockstat lockstats[NLOCKSTAT];
+static uint statlock;  // guards adding to lockstats
+
+// Find or make the statistics entry for name.  initlock runs
+// before the cpu structures are set up, so this can't use
+// acquire or pushcli; it spins on statlock bare.  Interrupts stay
+// off while statlock is held, so we can't be preempted holding it.
+static struct lockstat*
+findstat(char *name)
+{
+  struct lockstat *st;
+  uint eflags;
+
+  eflags = readeflags();
+  cli();
+  while(xchg(&statlock, 1) != 0)
+    ;
+  for(st = lockstats; st < lockstats + NLOCKSTAT; st++){
+    if(st->name[0] == 0)
+      safestrcpy(st->name, name, LOCKNAME);
+    if(strncmp(st->name, name, LOCKNAME-1) == 0)
+      break;
+  }
+  xchg(&statlock, 0);
+  if(eflags & FL_IF)
+    sti();
+  return st < lockstats + NLOCKSTAT ? st : 0;
+}
 
 void
 initlock(struct spinlock *lk, char *name)
 {
   lk->name = name;
-  lk->locked = 0;
+  lk->next = 0;
+  lk->owner = 0;
   lk->cpu = 0;
+  lk->stat = findstat(name);
 }
 
 // Acquire the lock.
@@ -24,45 +56,67 @@ initlock(struct spinlock *lk, char *name)
 void
 acquire(struct spinlock *lk)
 {
+  uint ticket, spins;
+
   pushcli(); // disable interrupts to avoid deadlock.
   if(holding(lk))
     panic("acquire");
 
-  // The xchg is atomic.
+  // The locked xadd is atomic.
   // It also serializes, so that reads after acquire are not
-  // reordered before it. 
-  while(xchg(&lk->locked, 1) != 0)
-    ;
+  // reordered before it.  Waiters only read owner, so they
+  // spin in their own caches until release writes it.
+  ticket = __sync_fetch_and_add(&lk->next, 1);
+  for(spins = 0; *(volatile uint*)&lk->owner != ticket; spins++)
+    pause();
 
   // Record info about lock acquisition for debugging.
   lk->cpu = cpu;
   getcallerpcs(&lk, lk->pcs);
+  if(lk->stat){
+    __sync_fetch_and_add(&lk->stat->nacquire, 1);
+    if(spins){
+      __sync_fetch_and_add(&lk->stat->ncontend, 1);
+      __sync_fetch_and_add(&lk->stat->spins, spins);
+    }
+  }
+  lk->start = rdtsc();
 }
 
 // Release the lock.
 void
 release(struct spinlock *lk)
 {
+  uint64 hold;
+
   if(!holding(lk))
     panic("release");
 
+  hold = rdtsc() - lk->start;
+  if(lk->stat && hold > lk->stat->maxhold)
+    lk->stat->maxhold = hold;  // racy across CPUs; good enough
   lk->pcs[0] = 0;
   lk->cpu = 0;
 
-  // The xchg serializes, so that reads before release are 
-  // not reordered after it.  The 1996 PentiumPro manual (Volume 3,
-  // 7.2) says reads can be carried out speculatively and in
-  // any order, which implies we need to serialize here.
-  // But the 2007 Intel 64 Architecture Memory Ordering White
-  // Paper says that Intel 64 and IA-32 will not move a load
-  // after a store. So lock->locked = 0 would work here.
-  // The xchg being asm volatile ensures gcc emits it after
-  // the above assignments (and after the critical section).
-  xchg(&lk->locked, 0);
+  // The locked add serializes, so that reads before release
+  // are not reordered after it, and gcc emits it after the
+  // above assignments (and after the critical section).
+  __sync_fetch_and_add(&lk->owner, 1);
 
   popcli();
 }
 
+// Copy out up to n lock statistics entries; return how many.
+int
+getlockstat(struct lockstat *st, int n)
+{
+  int i;
+
+  for(i = 0; i < n && i < NLOCKSTAT && lockstats[i].name[0]; i++)
+    st[i] = lockstats[i];
+  return i;
+}
+
 // Record the current call stack in pcs[] by following the %ebp chain.
 void
 getcallerpcs(void *v, uint pcs[])
@@ -85,7 +139,7 @@ getcallerpcs(void *v, uint pcs[])
 int
 holding(struct spinlock *lock)
 {
-  return lock->locked && lock->cpu == cpu;
+  return lock->next != lock->owner && lock->cpu == cpu;
 }
 
 
@@ -1,11 +1,18 @@
 // Mutual exclusion lock.
+// A ticket lock: acquire() takes the next ticket and spins until
+// owner reaches it, so CPUs get the lock in the order they asked.
 struct spinlock {
-  uint locked;       // Is the lock held?
-  
+  uint next;         // Next ticket to hand out.
+  uint owner;        // Ticket being served; held if next != owner.
+
   // For debugging:
   char *name;        // Name of lock.
   struct cpu *cpu;   // The cpu holding the lock.
   uint pcs[10];      // The call stack (an array of program counters)
                      // that locked the lock.
+
+  // For lockstat:
+  struct lockstat *stat;  // Shared by all locks with this name.
+  uint64 start;           // TSC when acquired.
 };
 
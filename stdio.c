@@ -0,0 +1,155 @@
+// Buffered I/O for user programs.
+//
+// Each file descriptor has an output and an input buffer.
+// Output to the console is line buffered; output to files
+// and pipes is written only when the buffer fills or on
+// fflush.  Buffers are flushed before fork, exec, exit and
+// close, so output is neither lost nor duplicated, and
+// line-buffered output is flushed before any read refills
+// an input buffer, so prompts appear before the reply.
+
+#include "types.h"
+#include "stat.h"
+#include "param.h"
+#include "user.h"
+
+#define BUFSZ 512
+
+// Buffering modes.
+#define UNKNOWN  0   // fd not looked at since last close
+#define LINEBUF  1   // console: flush at newline
+#define FULLBUF  2   // file or pipe: flush when full
+
+struct stream {
+  int mode;
+  int nout;          // bytes waiting in out[]
+  int rpos;          // next unread byte in in[]
+  int rend;          // end of valid bytes in in[]
+  char out[BUFSZ];
+  char in[BUFSZ];
+};
+
+static struct stream streams[NOFILE];
+
+// Return the stream for fd, deciding on first use how
+// its output is buffered.  Returns 0 if fd is not open.
+static struct stream*
+stream(int fd)
+{
+  struct stream *s;
+  struct stat st;
+
+  if(fd < 0 || fd >= NOFILE)
+    return 0;
+  s = &streams[fd];
+  if(s->mode == UNKNOWN){
+    if(fstat(fd, &st) < 0)
+      return 0;
+    s->mode = st.type == T_DEV ? LINEBUF : FULLBUF;
+  }
+  return s;
+}
+
+int
+fflush(int fd)
+{
+  struct stream *s;
+  int i, n;
+
+  if(fd < 0 || fd >= NOFILE)
+    return -1;
+  s = &streams[fd];
+  for(i = 0; i < s->nout; i += n){
+    if((n = write(fd, s->out + i, s->nout - i)) <= 0){
+      s->nout = 0;
+      return -1;
+    }
+  }
+  s->nout = 0;
+  return 0;
+}
+
+// Flush every stream, or only line-buffered ones.
+static void
+flushall(int lineonly)
+{
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+    if(streams[fd].nout > 0 && (!lineonly || streams[fd].mode == LINEBUF))
+      fflush(fd);
+}
+
+int
+fputc(int fd, int c)
+{
+  struct stream *s;
+  char ch;
+
+  if((s = stream(fd)) == 0){
+    ch = c;
+    return write(fd, &ch, 1) == 1 ? (uchar)c : -1;
+  }
+  s->out[s->nout++] = c;
+  if(s->nout == BUFSZ || (s->mode == LINEBUF && c == '\n'))
+    if(fflush(fd) < 0)
+      return -1;
+  return (uchar)c;
+}
+
+// Return the next byte read from fd, or -1 at end of file.
+int
+fgetc(int fd)
+{
+  struct stream *s;
+  uchar c;
+  int n;
+
+  if((s = stream(fd)) == 0){
+    flushall(1);
+    return read(fd, &c, 1) == 1 ? c : -1;
+  }
+  if(s->rpos == s->rend){
+    flushall(1);
+    if((n = read(fd, s->in, BUFSZ)) <= 0)
+      return -1;
+    s->rpos = 0;
+    s->rend = n;
+  }
+  return (uchar)s->in[s->rpos++];
+}
+
+int
+fork(void)
+{
+  flushall(0);
+  return _fork();
+}
+
+int
+exec(char *path, char **argv)
+{
+  flushall(0);
+  return _exec(path, argv);
+}
+
+int
+exit(void)
+{
+  flushall(0);
+  _exit();
+}
+
+int
+close(int fd)
+{
+  struct stream *s;
+
+  if(fd >= 0 && fd < NOFILE){
+    fflush(fd);
+    s = &streams[fd];
+    s->mode = UNKNOWN;
+    s->rpos = s->rend = 0;
+  }
+  return _close(fd);
+}
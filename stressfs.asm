@@ -0,0 +1,2746 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <batch>:
+
+// Queue n copies of op on fd with buffer data
+// and submit them with a single system call.
+void
+batch(int op, int fd, char *data, int size, int n)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 18             	sub    $0x18,%esp
+  struct iosqe *e;
+  int i;
+
+  for(i = 0; i < n; i++){
+       6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+       d:	eb 58                	jmp    67 <batch+0x67>
+    e = &ring.sq[ring.sqtail++ % IORING_SIZE];
+       f:	a1 84 1a 00 00       	mov    0x1a84,%eax
+      14:	8d 50 01             	lea    0x1(%eax),%edx
+      17:	89 15 84 1a 00 00    	mov    %edx,0x1a84
+      1d:	83 e0 1f             	and    $0x1f,%eax
+      20:	89 c2                	mov    %eax,%edx
+      22:	89 d0                	mov    %edx,%eax
+      24:	c1 e0 02             	shl    $0x2,%eax
+      27:	01 d0                	add    %edx,%eax
+      29:	c1 e0 02             	shl    $0x2,%eax
+      2c:	83 c0 10             	add    $0x10,%eax
+      2f:	05 80 1a 00 00       	add    $0x1a80,%eax
+      34:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    e->op = op;
+      37:	8b 45 f0             	mov    -0x10(%ebp),%eax
+      3a:	8b 55 08             	mov    0x8(%ebp),%edx
+      3d:	89 10                	mov    %edx,(%eax)
+    e->fd = fd;
+      3f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+      42:	8b 55 0c             	mov    0xc(%ebp),%edx
+      45:	89 50 04             	mov    %edx,0x4(%eax)
+    e->addr = (uint)data;
+      48:	8b 55 10             	mov    0x10(%ebp),%edx
+      4b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+      4e:	89 50 08             	mov    %edx,0x8(%eax)
+    e->n = size;
+      51:	8b 45 f0             	mov    -0x10(%ebp),%eax
+      54:	8b 55 14             	mov    0x14(%ebp),%edx
+      57:	89 50 0c             	mov    %edx,0xc(%eax)
+    e->data = i;
+      5a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+      5d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+      60:	89 50 10             	mov    %edx,0x10(%eax)
+  for(i = 0; i < n; i++){
+      63:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+      67:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      6a:	3b 45 18             	cmp    0x18(%ebp),%eax
+      6d:	7c a0                	jl     f <batch+0xf>
+  }
+  if(iosubmit(&ring) != n)
+      6f:	83 ec 0c             	sub    $0xc,%esp
+      72:	68 80 1a 00 00       	push   $0x1a80
+      77:	e8 a0 08 00 00       	call   91c <iosubmit>
+      7c:	83 c4 10             	add    $0x10,%esp
+      7f:	39 45 18             	cmp    %eax,0x18(%ebp)
+      82:	74 12                	je     96 <batch+0x96>
+    printf(1, "stressfs: iosubmit failed\n");
+      84:	83 ec 08             	sub    $0x8,%esp
+      87:	68 59 15 00 00       	push   $0x1559
+      8c:	6a 01                	push   $0x1
+      8e:	e8 b2 09 00 00       	call   a45 <printf>
+      93:	83 c4 10             	add    $0x10,%esp
+  ring.cqhead = ring.cqtail;
+      96:	a1 8c 1a 00 00       	mov    0x1a8c,%eax
+      9b:	a3 88 1a 00 00       	mov    %eax,0x1a88
+}
+      a0:	90                   	nop
+      a1:	c9                   	leave
+      a2:	c3                   	ret
+
+000000a3 <main>:
+
+int
+main(int argc, char *argv[])
+{
+      a3:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+      a7:	83 e4 f0             	and    $0xfffffff0,%esp
+      aa:	ff 71 fc             	push   -0x4(%ecx)
+      ad:	55                   	push   %ebp
+      ae:	89 e5                	mov    %esp,%ebp
+      b0:	51                   	push   %ecx
+      b1:	81 ec 24 02 00 00    	sub    $0x224,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+      b7:	c7 45 e6 73 74 72 65 	movl   $0x65727473,-0x1a(%ebp)
+      be:	c7 45 ea 73 73 66 73 	movl   $0x73667373,-0x16(%ebp)
+      c5:	66 c7 45 ee 30 00    	movw   $0x30,-0x12(%ebp)
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+      cb:	83 ec 08             	sub    $0x8,%esp
+      ce:	68 74 15 00 00       	push   $0x1574
+      d3:	6a 01                	push   $0x1
+      d5:	e8 6b 09 00 00       	call   a45 <printf>
+      da:	83 c4 10             	add    $0x10,%esp
+  memset(data, 'a', sizeof(data));
+      dd:	83 ec 04             	sub    $0x4,%esp
+      e0:	68 00 02 00 00       	push   $0x200
+      e5:	6a 61                	push   $0x61
+      e7:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+      ed:	50                   	push   %eax
+      ee:	e8 c8 02 00 00       	call   3bb <memset>
+      f3:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < 4; i++)
+      f6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+      fd:	eb 0d                	jmp    10c <main+0x69>
+    if(fork() > 0)
+      ff:	e8 9d 13 00 00       	call   14a1 <fork>
+     104:	85 c0                	test   %eax,%eax
+     106:	7f 0c                	jg     114 <main+0x71>
+  for(i = 0; i < 4; i++)
+     108:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     10c:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+     110:	7e ed                	jle    ff <main+0x5c>
+     112:	eb 01                	jmp    115 <main+0x72>
+      break;
+     114:	90                   	nop
+
+  printf(1, "write %d\n", i);
+     115:	83 ec 04             	sub    $0x4,%esp
+     118:	ff 75 f4             	push   -0xc(%ebp)
+     11b:	68 87 15 00 00       	push   $0x1587
+     120:	6a 01                	push   $0x1
+     122:	e8 1e 09 00 00       	call   a45 <printf>
+     127:	83 c4 10             	add    $0x10,%esp
+
+  path[8] += i;
+     12a:	0f b6 45 ee          	movzbl -0x12(%ebp),%eax
+     12e:	89 c2                	mov    %eax,%edx
+     130:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     133:	01 d0                	add    %edx,%eax
+     135:	88 45 ee             	mov    %al,-0x12(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+     138:	83 ec 08             	sub    $0x8,%esp
+     13b:	68 02 02 00 00       	push   $0x202
+     140:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+     143:	50                   	push   %eax
+     144:	e8 f2 06 00 00       	call   83b <open>
+     149:	83 c4 10             	add    $0x10,%esp
+     14c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  batch(IO_WRITE, fd, data, sizeof(data), 20);
+     14f:	83 ec 0c             	sub    $0xc,%esp
+     152:	6a 14                	push   $0x14
+     154:	68 00 02 00 00       	push   $0x200
+     159:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+     15f:	50                   	push   %eax
+     160:	ff 75 f0             	push   -0x10(%ebp)
+     163:	6a 02                	push   $0x2
+     165:	e8 96 fe ff ff       	call   0 <batch>
+     16a:	83 c4 20             	add    $0x20,%esp
+  close(fd);
+     16d:	83 ec 0c             	sub    $0xc,%esp
+     170:	ff 75 f0             	push   -0x10(%ebp)
+     173:	e8 81 13 00 00       	call   14f9 <close>
+     178:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "read\n");
+     17b:	83 ec 08             	sub    $0x8,%esp
+     17e:	68 91 15 00 00       	push   $0x1591
+     183:	6a 01                	push   $0x1
+     185:	e8 bb 08 00 00       	call   a45 <printf>
+     18a:	83 c4 10             	add    $0x10,%esp
+
+  fd = open(path, O_RDONLY);
+     18d:	83 ec 08             	sub    $0x8,%esp
+     190:	6a 00                	push   $0x0
+     192:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+     195:	50                   	push   %eax
+     196:	e8 a0 06 00 00       	call   83b <open>
+     19b:	83 c4 10             	add    $0x10,%esp
+     19e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  batch(IO_READ, fd, data, sizeof(data), 20);
+     1a1:	83 ec 0c             	sub    $0xc,%esp
+     1a4:	6a 14                	push   $0x14
+     1a6:	68 00 02 00 00       	push   $0x200
+     1ab:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+     1b1:	50                   	push   %eax
+     1b2:	ff 75 f0             	push   -0x10(%ebp)
+     1b5:	6a 01                	push   $0x1
+     1b7:	e8 44 fe ff ff       	call   0 <batch>
+     1bc:	83 c4 20             	add    $0x20,%esp
+  close(fd);
+     1bf:	83 ec 0c             	sub    $0xc,%esp
+     1c2:	ff 75 f0             	push   -0x10(%ebp)
+     1c5:	e8 2f 13 00 00       	call   14f9 <close>
+     1ca:	83 c4 10             	add    $0x10,%esp
+
+  wait();
+     1cd:	e8 00 06 00 00       	call   7d2 <wait>
+  
+  exit();
+     1d2:	e8 0a 13 00 00       	call   14e1 <exit>
+
+000001d7 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+     1d7:	55                   	push   %ebp
+     1d8:	89 e5                	mov    %esp,%ebp
+     1da:	57                   	push   %edi
+     1db:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+     1dc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     1df:	8b 55 10             	mov    0x10(%ebp),%edx
+     1e2:	8b 45 0c             	mov    0xc(%ebp),%eax
+     1e5:	89 cb                	mov    %ecx,%ebx
+     1e7:	89 df                	mov    %ebx,%edi
+     1e9:	89 d1                	mov    %edx,%ecx
+     1eb:	fc                   	cld
+     1ec:	f3 aa                	rep stos %al,%es:(%edi)
+     1ee:	89 ca                	mov    %ecx,%edx
+     1f0:	89 fb                	mov    %edi,%ebx
+     1f2:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     1f5:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     1f8:	90                   	nop
+     1f9:	5b                   	pop    %ebx
+     1fa:	5f                   	pop    %edi
+     1fb:	5d                   	pop    %ebp
+     1fc:	c3                   	ret
+
+000001fd <stosl>:
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+     1fd:	55                   	push   %ebp
+     1fe:	89 e5                	mov    %esp,%ebp
+     200:	57                   	push   %edi
+     201:	53                   	push   %ebx
+  asm volatile("cld; rep stosl" :
+     202:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     205:	8b 55 10             	mov    0x10(%ebp),%edx
+     208:	8b 45 0c             	mov    0xc(%ebp),%eax
+     20b:	89 cb                	mov    %ecx,%ebx
+     20d:	89 df                	mov    %ebx,%edi
+     20f:	89 d1                	mov    %edx,%ecx
+     211:	fc                   	cld
+     212:	f3 ab                	rep stos %eax,%es:(%edi)
+     214:	89 ca                	mov    %ecx,%edx
+     216:	89 fb                	mov    %edi,%ebx
+     218:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     21b:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     21e:	90                   	nop
+     21f:	5b                   	pop    %ebx
+     220:	5f                   	pop    %edi
+     221:	5d                   	pop    %ebp
+     222:	c3                   	ret
+
+00000223 <movsb>:
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+     223:	55                   	push   %ebp
+     224:	89 e5                	mov    %esp,%ebp
+     226:	57                   	push   %edi
+     227:	56                   	push   %esi
+     228:	53                   	push   %ebx
+  asm volatile("cld; rep movsb" :
+     229:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     22c:	8b 55 0c             	mov    0xc(%ebp),%edx
+     22f:	8b 45 10             	mov    0x10(%ebp),%eax
+     232:	89 cb                	mov    %ecx,%ebx
+     234:	89 df                	mov    %ebx,%edi
+     236:	89 d6                	mov    %edx,%esi
+     238:	89 c1                	mov    %eax,%ecx
+     23a:	fc                   	cld
+     23b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     23d:	89 c8                	mov    %ecx,%eax
+     23f:	89 f2                	mov    %esi,%edx
+     241:	89 fb                	mov    %edi,%ebx
+     243:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     246:	89 55 0c             	mov    %edx,0xc(%ebp)
+     249:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     24c:	90                   	nop
+     24d:	5b                   	pop    %ebx
+     24e:	5e                   	pop    %esi
+     24f:	5f                   	pop    %edi
+     250:	5d                   	pop    %ebp
+     251:	c3                   	ret
+
+00000252 <movsl>:
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+     252:	55                   	push   %ebp
+     253:	89 e5                	mov    %esp,%ebp
+     255:	57                   	push   %edi
+     256:	56                   	push   %esi
+     257:	53                   	push   %ebx
+  asm volatile("cld; rep movsl" :
+     258:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     25b:	8b 55 0c             	mov    0xc(%ebp),%edx
+     25e:	8b 45 10             	mov    0x10(%ebp),%eax
+     261:	89 cb                	mov    %ecx,%ebx
+     263:	89 df                	mov    %ebx,%edi
+     265:	89 d6                	mov    %edx,%esi
+     267:	89 c1                	mov    %eax,%ecx
+     269:	fc                   	cld
+     26a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     26c:	89 c8                	mov    %ecx,%eax
+     26e:	89 f2                	mov    %esi,%edx
+     270:	89 fb                	mov    %edi,%ebx
+     272:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     275:	89 55 0c             	mov    %edx,0xc(%ebp)
+     278:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     27b:	90                   	nop
+     27c:	5b                   	pop    %ebx
+     27d:	5e                   	pop    %esi
+     27e:	5f                   	pop    %edi
+     27f:	5d                   	pop    %ebp
+     280:	c3                   	ret
+
+00000281 <strcpy>:
+#define ONES        0x01010101
+#define HASZERO(x)  (((x) - ONES) & ~(x) & (ONES << 7))
+
+char*
+strcpy(char *s, char *t)
+{
+     281:	55                   	push   %ebp
+     282:	89 e5                	mov    %esp,%ebp
+     284:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+     287:	8b 45 08             	mov    0x8(%ebp),%eax
+     28a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     28d:	90                   	nop
+     28e:	8b 55 0c             	mov    0xc(%ebp),%edx
+     291:	8d 42 01             	lea    0x1(%edx),%eax
+     294:	89 45 0c             	mov    %eax,0xc(%ebp)
+     297:	8b 45 08             	mov    0x8(%ebp),%eax
+     29a:	8d 48 01             	lea    0x1(%eax),%ecx
+     29d:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     2a0:	0f b6 12             	movzbl (%edx),%edx
+     2a3:	88 10                	mov    %dl,(%eax)
+     2a5:	0f b6 00             	movzbl (%eax),%eax
+     2a8:	84 c0                	test   %al,%al
+     2aa:	75 e2                	jne    28e <strcpy+0xd>
+    ;
+  return os;
+     2ac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     2af:	c9                   	leave
+     2b0:	c3                   	ret
+
+000002b1 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     2b1:	55                   	push   %ebp
+     2b2:	89 e5                	mov    %esp,%ebp
+  // Aligned words never straddle a page, so reading
+  // whole ones past the end of a string is safe.
+  if((((uint)p | (uint)q) & 3) == 0)
+     2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+     2b7:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2ba:	09 d0                	or     %edx,%eax
+     2bc:	83 e0 03             	and    $0x3,%eax
+     2bf:	85 c0                	test   %eax,%eax
+     2c1:	75 3f                	jne    302 <strcmp+0x51>
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     2c3:	eb 08                	jmp    2cd <strcmp+0x1c>
+      p += 4, q += 4;
+     2c5:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     2c9:	83 45 0c 04          	addl   $0x4,0xc(%ebp)
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     2cd:	8b 45 08             	mov    0x8(%ebp),%eax
+     2d0:	8b 10                	mov    (%eax),%edx
+     2d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2d5:	8b 00                	mov    (%eax),%eax
+     2d7:	39 c2                	cmp    %eax,%edx
+     2d9:	75 27                	jne    302 <strcmp+0x51>
+     2db:	8b 45 08             	mov    0x8(%ebp),%eax
+     2de:	8b 00                	mov    (%eax),%eax
+     2e0:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     2e6:	8b 45 08             	mov    0x8(%ebp),%eax
+     2e9:	8b 00                	mov    (%eax),%eax
+     2eb:	f7 d0                	not    %eax
+     2ed:	21 d0                	and    %edx,%eax
+     2ef:	25 80 80 80 80       	and    $0x80808080,%eax
+     2f4:	85 c0                	test   %eax,%eax
+     2f6:	74 cd                	je     2c5 <strcmp+0x14>
+  while(*p && *p == *q)
+     2f8:	eb 08                	jmp    302 <strcmp+0x51>
+    p++, q++;
+     2fa:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     2fe:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     302:	8b 45 08             	mov    0x8(%ebp),%eax
+     305:	0f b6 00             	movzbl (%eax),%eax
+     308:	84 c0                	test   %al,%al
+     30a:	74 10                	je     31c <strcmp+0x6b>
+     30c:	8b 45 08             	mov    0x8(%ebp),%eax
+     30f:	0f b6 10             	movzbl (%eax),%edx
+     312:	8b 45 0c             	mov    0xc(%ebp),%eax
+     315:	0f b6 00             	movzbl (%eax),%eax
+     318:	38 c2                	cmp    %al,%dl
+     31a:	74 de                	je     2fa <strcmp+0x49>
+  return (uchar)*p - (uchar)*q;
+     31c:	8b 45 08             	mov    0x8(%ebp),%eax
+     31f:	0f b6 00             	movzbl (%eax),%eax
+     322:	0f b6 d0             	movzbl %al,%edx
+     325:	8b 45 0c             	mov    0xc(%ebp),%eax
+     328:	0f b6 00             	movzbl (%eax),%eax
+     32b:	0f b6 c0             	movzbl %al,%eax
+     32e:	29 c2                	sub    %eax,%edx
+     330:	89 d0                	mov    %edx,%eax
+}
+     332:	5d                   	pop    %ebp
+     333:	c3                   	ret
+
+00000334 <strlen>:
+
+uint
+strlen(char *s)
+{
+     334:	55                   	push   %ebp
+     335:	89 e5                	mov    %esp,%ebp
+     337:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; ((uint)(s+n) & 3) && s[n]; n++)
+     33a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     341:	eb 04                	jmp    347 <strlen+0x13>
+     343:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     347:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     34a:	8b 45 08             	mov    0x8(%ebp),%eax
+     34d:	01 d0                	add    %edx,%eax
+     34f:	83 e0 03             	and    $0x3,%eax
+     352:	85 c0                	test   %eax,%eax
+     354:	74 0f                	je     365 <strlen+0x31>
+     356:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     359:	8b 45 08             	mov    0x8(%ebp),%eax
+     35c:	01 d0                	add    %edx,%eax
+     35e:	0f b6 00             	movzbl (%eax),%eax
+     361:	84 c0                	test   %al,%al
+     363:	75 de                	jne    343 <strlen+0xf>
+    ;
+  if(s[n])
+     365:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     368:	8b 45 08             	mov    0x8(%ebp),%eax
+     36b:	01 d0                	add    %edx,%eax
+     36d:	0f b6 00             	movzbl (%eax),%eax
+     370:	84 c0                	test   %al,%al
+     372:	74 33                	je     3a7 <strlen+0x73>
+    while(!HASZERO(*(uint*)(s+n)))
+     374:	eb 04                	jmp    37a <strlen+0x46>
+      n += 4;
+     376:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+    while(!HASZERO(*(uint*)(s+n)))
+     37a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     37d:	8b 45 08             	mov    0x8(%ebp),%eax
+     380:	01 d0                	add    %edx,%eax
+     382:	8b 00                	mov    (%eax),%eax
+     384:	8d 88 ff fe fe fe    	lea    -0x1010101(%eax),%ecx
+     38a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     38d:	8b 45 08             	mov    0x8(%ebp),%eax
+     390:	01 d0                	add    %edx,%eax
+     392:	8b 00                	mov    (%eax),%eax
+     394:	f7 d0                	not    %eax
+     396:	21 c8                	and    %ecx,%eax
+     398:	25 80 80 80 80       	and    $0x80808080,%eax
+     39d:	85 c0                	test   %eax,%eax
+     39f:	74 d5                	je     376 <strlen+0x42>
+  for(; s[n]; n++)
+     3a1:	eb 04                	jmp    3a7 <strlen+0x73>
+     3a3:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     3a7:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     3aa:	8b 45 08             	mov    0x8(%ebp),%eax
+     3ad:	01 d0                	add    %edx,%eax
+     3af:	0f b6 00             	movzbl (%eax),%eax
+     3b2:	84 c0                	test   %al,%al
+     3b4:	75 ed                	jne    3a3 <strlen+0x6f>
+    ;
+  return n;
+     3b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     3b9:	c9                   	leave
+     3ba:	c3                   	ret
+
+000003bb <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     3bb:	55                   	push   %ebp
+     3bc:	89 e5                	mov    %esp,%ebp
+     3be:	83 ec 10             	sub    $0x10,%esp
+  char *d;
+  uint k;
+
+  d = dst;
+     3c1:	8b 45 08             	mov    0x8(%ebp),%eax
+     3c4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c &= 0xFF;
+     3c7:	81 65 0c ff 00 00 00 	andl   $0xff,0xc(%ebp)
+  if(n >= 16){
+     3ce:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     3d2:	76 54                	jbe    428 <memset+0x6d>
+    k = -(uint)d & 3;  // bytes up to a word boundary
+     3d4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     3d7:	f7 d8                	neg    %eax
+     3d9:	83 e0 03             	and    $0x3,%eax
+     3dc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    stosb(d, c, k);
+     3df:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3e2:	50                   	push   %eax
+     3e3:	ff 75 0c             	push   0xc(%ebp)
+     3e6:	ff 75 fc             	push   -0x4(%ebp)
+     3e9:	e8 e9 fd ff ff       	call   1d7 <stosb>
+     3ee:	83 c4 0c             	add    $0xc,%esp
+    d += k;
+     3f1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3f4:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n -= k;
+     3f7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3fa:	29 45 10             	sub    %eax,0x10(%ebp)
+    stosl(d, c*ONES, n/4);
+     3fd:	8b 45 10             	mov    0x10(%ebp),%eax
+     400:	c1 e8 02             	shr    $0x2,%eax
+     403:	89 c2                	mov    %eax,%edx
+     405:	8b 45 0c             	mov    0xc(%ebp),%eax
+     408:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     40e:	52                   	push   %edx
+     40f:	50                   	push   %eax
+     410:	ff 75 fc             	push   -0x4(%ebp)
+     413:	e8 e5 fd ff ff       	call   1fd <stosl>
+     418:	83 c4 0c             	add    $0xc,%esp
+    d += n & ~3;
+     41b:	8b 45 10             	mov    0x10(%ebp),%eax
+     41e:	83 e0 fc             	and    $0xfffffffc,%eax
+     421:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n &= 3;
+     424:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+  }
+  stosb(d, c, n);
+     428:	8b 45 10             	mov    0x10(%ebp),%eax
+     42b:	50                   	push   %eax
+     42c:	ff 75 0c             	push   0xc(%ebp)
+     42f:	ff 75 fc             	push   -0x4(%ebp)
+     432:	e8 a0 fd ff ff       	call   1d7 <stosb>
+     437:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     43a:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     43d:	c9                   	leave
+     43e:	c3                   	ret
+
+0000043f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     43f:	55                   	push   %ebp
+     440:	89 e5                	mov    %esp,%ebp
+     442:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s1, *s2;
+
+  s1 = v1;
+     445:	8b 45 08             	mov    0x8(%ebp),%eax
+     448:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s2 = v2;
+     44b:	8b 45 0c             	mov    0xc(%ebp),%eax
+     44e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     451:	eb 0c                	jmp    45f <memcmp+0x20>
+    s1 += 4, s2 += 4, n -= 4;
+     453:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+     457:	83 45 f8 04          	addl   $0x4,-0x8(%ebp)
+     45b:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     45f:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     463:	76 3e                	jbe    4a3 <memcmp+0x64>
+     465:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     468:	8b 10                	mov    (%eax),%edx
+     46a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     46d:	8b 00                	mov    (%eax),%eax
+     46f:	39 c2                	cmp    %eax,%edx
+     471:	74 e0                	je     453 <memcmp+0x14>
+  while(n-- > 0){
+     473:	eb 2e                	jmp    4a3 <memcmp+0x64>
+    if(*s1 != *s2)
+     475:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     478:	0f b6 10             	movzbl (%eax),%edx
+     47b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     47e:	0f b6 00             	movzbl (%eax),%eax
+     481:	38 c2                	cmp    %al,%dl
+     483:	74 16                	je     49b <memcmp+0x5c>
+      return *s1 - *s2;
+     485:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     488:	0f b6 00             	movzbl (%eax),%eax
+     48b:	0f b6 d0             	movzbl %al,%edx
+     48e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     491:	0f b6 00             	movzbl (%eax),%eax
+     494:	0f b6 c0             	movzbl %al,%eax
+     497:	29 c2                	sub    %eax,%edx
+     499:	eb 1a                	jmp    4b5 <memcmp+0x76>
+    s1++, s2++;
+     49b:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     49f:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+  while(n-- > 0){
+     4a3:	8b 45 10             	mov    0x10(%ebp),%eax
+     4a6:	8d 50 ff             	lea    -0x1(%eax),%edx
+     4a9:	89 55 10             	mov    %edx,0x10(%ebp)
+     4ac:	85 c0                	test   %eax,%eax
+     4ae:	75 c5                	jne    475 <memcmp+0x36>
+  }
+  return 0;
+     4b0:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+     4b5:	89 d0                	mov    %edx,%eax
+     4b7:	c9                   	leave
+     4b8:	c3                   	ret
+
+000004b9 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     4b9:	55                   	push   %ebp
+     4ba:	89 e5                	mov    %esp,%ebp
+     4bc:	83 ec 14             	sub    $0x14,%esp
+     4bf:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4c2:	88 45 ec             	mov    %al,-0x14(%ebp)
+  uint w, cc;
+
+  // Skip whole words holding neither c nor the terminator.
+  for(; ((uint)s & 3) && *s; s++)
+     4c5:	eb 17                	jmp    4de <strchr+0x25>
+    if(*s == c)
+     4c7:	8b 45 08             	mov    0x8(%ebp),%eax
+     4ca:	0f b6 00             	movzbl (%eax),%eax
+     4cd:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     4d0:	75 08                	jne    4da <strchr+0x21>
+      return (char*)s;
+     4d2:	8b 45 08             	mov    0x8(%ebp),%eax
+     4d5:	e9 ad 00 00 00       	jmp    587 <strchr+0xce>
+  for(; ((uint)s & 3) && *s; s++)
+     4da:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     4de:	8b 45 08             	mov    0x8(%ebp),%eax
+     4e1:	83 e0 03             	and    $0x3,%eax
+     4e4:	85 c0                	test   %eax,%eax
+     4e6:	74 0a                	je     4f2 <strchr+0x39>
+     4e8:	8b 45 08             	mov    0x8(%ebp),%eax
+     4eb:	0f b6 00             	movzbl (%eax),%eax
+     4ee:	84 c0                	test   %al,%al
+     4f0:	75 d5                	jne    4c7 <strchr+0xe>
+  cc = (uchar)c * ONES;
+     4f2:	0f b6 45 ec          	movzbl -0x14(%ebp),%eax
+     4f6:	0f b6 c0             	movzbl %al,%eax
+     4f9:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     4ff:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(*s)
+     502:	8b 45 08             	mov    0x8(%ebp),%eax
+     505:	0f b6 00             	movzbl (%eax),%eax
+     508:	84 c0                	test   %al,%al
+     50a:	74 6c                	je     578 <strchr+0xbf>
+    for(; w = *(uint*)s, !HASZERO(w) && !HASZERO(w ^ cc); s += 4)
+     50c:	eb 04                	jmp    512 <strchr+0x59>
+     50e:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     512:	8b 45 08             	mov    0x8(%ebp),%eax
+     515:	8b 00                	mov    (%eax),%eax
+     517:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     51a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     51d:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     523:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     526:	f7 d0                	not    %eax
+     528:	21 d0                	and    %edx,%eax
+     52a:	25 80 80 80 80       	and    $0x80808080,%eax
+     52f:	85 c0                	test   %eax,%eax
+     531:	75 26                	jne    559 <strchr+0xa0>
+     533:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     536:	33 45 fc             	xor    -0x4(%ebp),%eax
+     539:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     53f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     542:	33 45 fc             	xor    -0x4(%ebp),%eax
+     545:	f7 d0                	not    %eax
+     547:	21 d0                	and    %edx,%eax
+     549:	25 80 80 80 80       	and    $0x80808080,%eax
+     54e:	85 c0                	test   %eax,%eax
+     550:	75 07                	jne    559 <strchr+0xa0>
+     552:	b8 01 00 00 00       	mov    $0x1,%eax
+     557:	eb 05                	jmp    55e <strchr+0xa5>
+     559:	b8 00 00 00 00       	mov    $0x0,%eax
+     55e:	85 c0                	test   %eax,%eax
+     560:	75 ac                	jne    50e <strchr+0x55>
+      ;
+  for(; *s; s++)
+     562:	eb 14                	jmp    578 <strchr+0xbf>
+    if(*s == c)
+     564:	8b 45 08             	mov    0x8(%ebp),%eax
+     567:	0f b6 00             	movzbl (%eax),%eax
+     56a:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     56d:	75 05                	jne    574 <strchr+0xbb>
+      return (char*)s;
+     56f:	8b 45 08             	mov    0x8(%ebp),%eax
+     572:	eb 13                	jmp    587 <strchr+0xce>
+  for(; *s; s++)
+     574:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     578:	8b 45 08             	mov    0x8(%ebp),%eax
+     57b:	0f b6 00             	movzbl (%eax),%eax
+     57e:	84 c0                	test   %al,%al
+     580:	75 e2                	jne    564 <strchr+0xab>
+  return 0;
+     582:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     587:	c9                   	leave
+     588:	c3                   	ret
+
+00000589 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     589:	55                   	push   %ebp
+     58a:	89 e5                	mov    %esp,%ebp
+     58c:	83 ec 18             	sub    $0x18,%esp
+  int i, c;
+
+  for(i=0; i+1 < max; ){
+     58f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     596:	eb 37                	jmp    5cf <gets+0x46>
+    c = fgetc(0);
+     598:	83 ec 0c             	sub    $0xc,%esp
+     59b:	6a 00                	push   $0x0
+     59d:	e8 2e 0e 00 00       	call   13d0 <fgetc>
+     5a2:	83 c4 10             	add    $0x10,%esp
+     5a5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(c < 0)
+     5a8:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     5ac:	78 2e                	js     5dc <gets+0x53>
+      break;
+    buf[i++] = c;
+     5ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5b1:	8d 50 01             	lea    0x1(%eax),%edx
+     5b4:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     5b7:	89 c2                	mov    %eax,%edx
+     5b9:	8b 45 08             	mov    0x8(%ebp),%eax
+     5bc:	01 d0                	add    %edx,%eax
+     5be:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     5c1:	88 10                	mov    %dl,(%eax)
+    if(c == '\n' || c == '\r')
+     5c3:	83 7d f0 0a          	cmpl   $0xa,-0x10(%ebp)
+     5c7:	74 14                	je     5dd <gets+0x54>
+     5c9:	83 7d f0 0d          	cmpl   $0xd,-0x10(%ebp)
+     5cd:	74 0e                	je     5dd <gets+0x54>
+  for(i=0; i+1 < max; ){
+     5cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5d2:	83 c0 01             	add    $0x1,%eax
+     5d5:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     5d8:	7f be                	jg     598 <gets+0xf>
+     5da:	eb 01                	jmp    5dd <gets+0x54>
+      break;
+     5dc:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     5dd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     5e0:	8b 45 08             	mov    0x8(%ebp),%eax
+     5e3:	01 d0                	add    %edx,%eax
+     5e5:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     5e8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     5eb:	c9                   	leave
+     5ec:	c3                   	ret
+
+000005ed <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     5ed:	55                   	push   %ebp
+     5ee:	89 e5                	mov    %esp,%ebp
+     5f0:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     5f3:	83 ec 08             	sub    $0x8,%esp
+     5f6:	6a 00                	push   $0x0
+     5f8:	ff 75 08             	push   0x8(%ebp)
+     5fb:	e8 3b 02 00 00       	call   83b <open>
+     600:	83 c4 10             	add    $0x10,%esp
+     603:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     606:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     60a:	79 07                	jns    613 <stat+0x26>
+    return -1;
+     60c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     611:	eb 25                	jmp    638 <stat+0x4b>
+  r = fstat(fd, st);
+     613:	83 ec 08             	sub    $0x8,%esp
+     616:	ff 75 0c             	push   0xc(%ebp)
+     619:	ff 75 f4             	push   -0xc(%ebp)
+     61c:	e8 47 02 00 00       	call   868 <fstat>
+     621:	83 c4 10             	add    $0x10,%esp
+     624:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     627:	83 ec 0c             	sub    $0xc,%esp
+     62a:	ff 75 f4             	push   -0xc(%ebp)
+     62d:	e8 c7 0e 00 00       	call   14f9 <close>
+     632:	83 c4 10             	add    $0x10,%esp
+  return r;
+     635:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     638:	c9                   	leave
+     639:	c3                   	ret
+
+0000063a <atoi>:
+
+int
+atoi(const char *s)
+{
+     63a:	55                   	push   %ebp
+     63b:	89 e5                	mov    %esp,%ebp
+     63d:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     640:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     647:	eb 25                	jmp    66e <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     649:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     64c:	89 d0                	mov    %edx,%eax
+     64e:	c1 e0 02             	shl    $0x2,%eax
+     651:	01 d0                	add    %edx,%eax
+     653:	01 c0                	add    %eax,%eax
+     655:	89 c1                	mov    %eax,%ecx
+     657:	8b 45 08             	mov    0x8(%ebp),%eax
+     65a:	8d 50 01             	lea    0x1(%eax),%edx
+     65d:	89 55 08             	mov    %edx,0x8(%ebp)
+     660:	0f b6 00             	movzbl (%eax),%eax
+     663:	0f be c0             	movsbl %al,%eax
+     666:	01 c8                	add    %ecx,%eax
+     668:	83 e8 30             	sub    $0x30,%eax
+     66b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     66e:	8b 45 08             	mov    0x8(%ebp),%eax
+     671:	0f b6 00             	movzbl (%eax),%eax
+     674:	3c 2f                	cmp    $0x2f,%al
+     676:	7e 0a                	jle    682 <atoi+0x48>
+     678:	8b 45 08             	mov    0x8(%ebp),%eax
+     67b:	0f b6 00             	movzbl (%eax),%eax
+     67e:	3c 39                	cmp    $0x39,%al
+     680:	7e c7                	jle    649 <atoi+0xf>
+  return n;
+     682:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     685:	c9                   	leave
+     686:	c3                   	ret
+
+00000687 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     687:	55                   	push   %ebp
+     688:	89 e5                	mov    %esp,%ebp
+     68a:	83 ec 10             	sub    $0x10,%esp
+  char *d, *s;
+  int k;
+
+  if(n <= 0)
+     68d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     691:	7f 08                	jg     69b <memmove+0x14>
+    return vdst;
+     693:	8b 45 08             	mov    0x8(%ebp),%eax
+     696:	e9 17 01 00 00       	jmp    7b2 <memmove+0x12b>
+  d = vdst;
+     69b:	8b 45 08             	mov    0x8(%ebp),%eax
+     69e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s = vsrc;
+     6a1:	8b 45 0c             	mov    0xc(%ebp),%eax
+     6a4:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  if(s < d && s + n > d){
+     6a7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     6aa:	3b 45 fc             	cmp    -0x4(%ebp),%eax
+     6ad:	0f 83 84 00 00 00    	jae    737 <memmove+0xb0>
+     6b3:	8b 55 10             	mov    0x10(%ebp),%edx
+     6b6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     6b9:	01 d0                	add    %edx,%eax
+     6bb:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     6be:	73 77                	jae    737 <memmove+0xb0>
+    s += n;
+     6c0:	8b 45 10             	mov    0x10(%ebp),%eax
+     6c3:	01 45 f8             	add    %eax,-0x8(%ebp)
+    d += n;
+     6c6:	8b 45 10             	mov    0x10(%ebp),%eax
+     6c9:	01 45 fc             	add    %eax,-0x4(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     6cc:	eb 17                	jmp    6e5 <memmove+0x5e>
+      *--d = *--s, n--;
+     6ce:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     6d2:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     6d6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     6d9:	0f b6 10             	movzbl (%eax),%edx
+     6dc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     6df:	88 10                	mov    %dl,(%eax)
+     6e1:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     6e5:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     6e9:	7e 22                	jle    70d <memmove+0x86>
+     6eb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     6ee:	83 e0 03             	and    $0x3,%eax
+     6f1:	85 c0                	test   %eax,%eax
+     6f3:	75 d9                	jne    6ce <memmove+0x47>
+    for(; n >= 4; n -= 4){
+     6f5:	eb 16                	jmp    70d <memmove+0x86>
+      d -= 4;
+     6f7:	83 6d fc 04          	subl   $0x4,-0x4(%ebp)
+      s -= 4;
+     6fb:	83 6d f8 04          	subl   $0x4,-0x8(%ebp)
+      *(uint*)d = *(uint*)s;
+     6ff:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     702:	8b 10                	mov    (%eax),%edx
+     704:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     707:	89 10                	mov    %edx,(%eax)
+    for(; n >= 4; n -= 4){
+     709:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+     70d:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     711:	7f e4                	jg     6f7 <memmove+0x70>
+    }
+    while(n-- > 0)
+     713:	eb 13                	jmp    728 <memmove+0xa1>
+      *--d = *--s;
+     715:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     719:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     71d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     720:	0f b6 10             	movzbl (%eax),%edx
+     723:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     726:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+     728:	8b 45 10             	mov    0x10(%ebp),%eax
+     72b:	8d 50 ff             	lea    -0x1(%eax),%edx
+     72e:	89 55 10             	mov    %edx,0x10(%ebp)
+     731:	85 c0                	test   %eax,%eax
+     733:	7f e0                	jg     715 <memmove+0x8e>
+  if(s < d && s + n > d){
+     735:	eb 78                	jmp    7af <memmove+0x128>
+  } else {
+    if(n >= 16){
+     737:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     73b:	7e 61                	jle    79e <memmove+0x117>
+      k = -(uint)d & 3;
+     73d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     740:	f7 d8                	neg    %eax
+     742:	83 e0 03             	and    $0x3,%eax
+     745:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      movsb(d, s, k);
+     748:	ff 75 f4             	push   -0xc(%ebp)
+     74b:	ff 75 f8             	push   -0x8(%ebp)
+     74e:	ff 75 fc             	push   -0x4(%ebp)
+     751:	e8 cd fa ff ff       	call   223 <movsb>
+     756:	83 c4 0c             	add    $0xc,%esp
+      d += k;
+     759:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     75c:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += k;
+     75f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     762:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n -= k;
+     765:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     768:	29 45 10             	sub    %eax,0x10(%ebp)
+      movsl(d, s, n/4);
+     76b:	8b 45 10             	mov    0x10(%ebp),%eax
+     76e:	8d 50 03             	lea    0x3(%eax),%edx
+     771:	85 c0                	test   %eax,%eax
+     773:	0f 48 c2             	cmovs  %edx,%eax
+     776:	c1 f8 02             	sar    $0x2,%eax
+     779:	50                   	push   %eax
+     77a:	ff 75 f8             	push   -0x8(%ebp)
+     77d:	ff 75 fc             	push   -0x4(%ebp)
+     780:	e8 cd fa ff ff       	call   252 <movsl>
+     785:	83 c4 0c             	add    $0xc,%esp
+      d += n & ~3;
+     788:	8b 45 10             	mov    0x10(%ebp),%eax
+     78b:	83 e0 fc             	and    $0xfffffffc,%eax
+     78e:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += n & ~3;
+     791:	8b 45 10             	mov    0x10(%ebp),%eax
+     794:	83 e0 fc             	and    $0xfffffffc,%eax
+     797:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n &= 3;
+     79a:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+    }
+    movsb(d, s, n);
+     79e:	ff 75 10             	push   0x10(%ebp)
+     7a1:	ff 75 f8             	push   -0x8(%ebp)
+     7a4:	ff 75 fc             	push   -0x4(%ebp)
+     7a7:	e8 77 fa ff ff       	call   223 <movsb>
+     7ac:	83 c4 0c             	add    $0xc,%esp
+  }
+  return vdst;
+     7af:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     7b2:	c9                   	leave
+     7b3:	c3                   	ret
+
+000007b4 <_fork>:
+    movl %esp, %ecx; \
+    movl $1f, %edx; \
+    sysenter; \
+  1: ret
+
+RAWSYSCALL(fork)
+     7b4:	b8 01 00 00 00       	mov    $0x1,%eax
+     7b9:	89 e1                	mov    %esp,%ecx
+     7bb:	ba c2 07 00 00       	mov    $0x7c2,%edx
+     7c0:	0f 34                	sysenter
+     7c2:	c3                   	ret
+
+000007c3 <_exit>:
+RAWSYSCALL(exit)
+     7c3:	b8 02 00 00 00       	mov    $0x2,%eax
+     7c8:	89 e1                	mov    %esp,%ecx
+     7ca:	ba d1 07 00 00       	mov    $0x7d1,%edx
+     7cf:	0f 34                	sysenter
+     7d1:	c3                   	ret
+
+000007d2 <wait>:
+SYSCALL(wait)
+     7d2:	b8 03 00 00 00       	mov    $0x3,%eax
+     7d7:	89 e1                	mov    %esp,%ecx
+     7d9:	ba e0 07 00 00       	mov    $0x7e0,%edx
+     7de:	0f 34                	sysenter
+     7e0:	c3                   	ret
+
+000007e1 <pipe>:
+SYSCALL(pipe)
+     7e1:	b8 04 00 00 00       	mov    $0x4,%eax
+     7e6:	89 e1                	mov    %esp,%ecx
+     7e8:	ba ef 07 00 00       	mov    $0x7ef,%edx
+     7ed:	0f 34                	sysenter
+     7ef:	c3                   	ret
+
+000007f0 <read>:
+SYSCALL(read)
+     7f0:	b8 05 00 00 00       	mov    $0x5,%eax
+     7f5:	89 e1                	mov    %esp,%ecx
+     7f7:	ba fe 07 00 00       	mov    $0x7fe,%edx
+     7fc:	0f 34                	sysenter
+     7fe:	c3                   	ret
+
+000007ff <write>:
+SYSCALL(write)
+     7ff:	b8 10 00 00 00       	mov    $0x10,%eax
+     804:	89 e1                	mov    %esp,%ecx
+     806:	ba 0d 08 00 00       	mov    $0x80d,%edx
+     80b:	0f 34                	sysenter
+     80d:	c3                   	ret
+
+0000080e <_close>:
+RAWSYSCALL(close)
+     80e:	b8 15 00 00 00       	mov    $0x15,%eax
+     813:	89 e1                	mov    %esp,%ecx
+     815:	ba 1c 08 00 00       	mov    $0x81c,%edx
+     81a:	0f 34                	sysenter
+     81c:	c3                   	ret
+
+0000081d <kill>:
+SYSCALL(kill)
+     81d:	b8 06 00 00 00       	mov    $0x6,%eax
+     822:	89 e1                	mov    %esp,%ecx
+     824:	ba 2b 08 00 00       	mov    $0x82b,%edx
+     829:	0f 34                	sysenter
+     82b:	c3                   	ret
+
+0000082c <_exec>:
+RAWSYSCALL(exec)
+     82c:	b8 07 00 00 00       	mov    $0x7,%eax
+     831:	89 e1                	mov    %esp,%ecx
+     833:	ba 3a 08 00 00       	mov    $0x83a,%edx
+     838:	0f 34                	sysenter
+     83a:	c3                   	ret
+
+0000083b <open>:
+SYSCALL(open)
+     83b:	b8 0f 00 00 00       	mov    $0xf,%eax
+     840:	89 e1                	mov    %esp,%ecx
+     842:	ba 49 08 00 00       	mov    $0x849,%edx
+     847:	0f 34                	sysenter
+     849:	c3                   	ret
+
+0000084a <mknod>:
+SYSCALL(mknod)
+     84a:	b8 11 00 00 00       	mov    $0x11,%eax
+     84f:	89 e1                	mov    %esp,%ecx
+     851:	ba 58 08 00 00       	mov    $0x858,%edx
+     856:	0f 34                	sysenter
+     858:	c3                   	ret
+
+00000859 <unlink>:
+SYSCALL(unlink)
+     859:	b8 12 00 00 00       	mov    $0x12,%eax
+     85e:	89 e1                	mov    %esp,%ecx
+     860:	ba 67 08 00 00       	mov    $0x867,%edx
+     865:	0f 34                	sysenter
+     867:	c3                   	ret
+
+00000868 <fstat>:
+SYSCALL(fstat)
+     868:	b8 08 00 00 00       	mov    $0x8,%eax
+     86d:	89 e1                	mov    %esp,%ecx
+     86f:	ba 76 08 00 00       	mov    $0x876,%edx
+     874:	0f 34                	sysenter
+     876:	c3                   	ret
+
+00000877 <link>:
+SYSCALL(link)
+     877:	b8 13 00 00 00       	mov    $0x13,%eax
+     87c:	89 e1                	mov    %esp,%ecx
+     87e:	ba 85 08 00 00       	mov    $0x885,%edx
+     883:	0f 34                	sysenter
+     885:	c3                   	ret
+
+00000886 <mkdir>:
+SYSCALL(mkdir)
+     886:	b8 14 00 00 00       	mov    $0x14,%eax
+     88b:	89 e1                	mov    %esp,%ecx
+     88d:	ba 94 08 00 00       	mov    $0x894,%edx
+     892:	0f 34                	sysenter
+     894:	c3                   	ret
+
+00000895 <chdir>:
+SYSCALL(chdir)
+     895:	b8 09 00 00 00       	mov    $0x9,%eax
+     89a:	89 e1                	mov    %esp,%ecx
+     89c:	ba a3 08 00 00       	mov    $0x8a3,%edx
+     8a1:	0f 34                	sysenter
+     8a3:	c3                   	ret
+
+000008a4 <dup>:
+SYSCALL(dup)
+     8a4:	b8 0a 00 00 00       	mov    $0xa,%eax
+     8a9:	89 e1                	mov    %esp,%ecx
+     8ab:	ba b2 08 00 00       	mov    $0x8b2,%edx
+     8b0:	0f 34                	sysenter
+     8b2:	c3                   	ret
+
+000008b3 <getpid>:
+SYSCALL(getpid)
+     8b3:	b8 0b 00 00 00       	mov    $0xb,%eax
+     8b8:	89 e1                	mov    %esp,%ecx
+     8ba:	ba c1 08 00 00       	mov    $0x8c1,%edx
+     8bf:	0f 34                	sysenter
+     8c1:	c3                   	ret
+
+000008c2 <sbrk>:
+SYSCALL(sbrk)
+     8c2:	b8 0c 00 00 00       	mov    $0xc,%eax
+     8c7:	89 e1                	mov    %esp,%ecx
+     8c9:	ba d0 08 00 00       	mov    $0x8d0,%edx
+     8ce:	0f 34                	sysenter
+     8d0:	c3                   	ret
+
+000008d1 <sleep>:
+SYSCALL(sleep)
+     8d1:	b8 0d 00 00 00       	mov    $0xd,%eax
+     8d6:	89 e1                	mov    %esp,%ecx
+     8d8:	ba df 08 00 00       	mov    $0x8df,%edx
+     8dd:	0f 34                	sysenter
+     8df:	c3                   	ret
+
+000008e0 <uptime>:
+SYSCALL(uptime)
+     8e0:	b8 0e 00 00 00       	mov    $0xe,%eax
+     8e5:	89 e1                	mov    %esp,%ecx
+     8e7:	ba ee 08 00 00       	mov    $0x8ee,%edx
+     8ec:	0f 34                	sysenter
+     8ee:	c3                   	ret
+
+000008ef <getproc>:
+SYSCALL(getproc)
+     8ef:	b8 16 00 00 00       	mov    $0x16,%eax
+     8f4:	89 e1                	mov    %esp,%ecx
+     8f6:	ba fd 08 00 00       	mov    $0x8fd,%edx
+     8fb:	0f 34                	sysenter
+     8fd:	c3                   	ret
+
+000008fe <getpgs>:
+SYSCALL(getpgs)
+     8fe:	b8 17 00 00 00       	mov    $0x17,%eax
+     903:	89 e1                	mov    %esp,%ecx
+     905:	ba 0c 09 00 00       	mov    $0x90c,%edx
+     90a:	0f 34                	sysenter
+     90c:	c3                   	ret
+
+0000090d <loadproc>:
+SYSCALL(loadproc)
+     90d:	b8 18 00 00 00       	mov    $0x18,%eax
+     912:	89 e1                	mov    %esp,%ecx
+     914:	ba 1b 09 00 00       	mov    $0x91b,%edx
+     919:	0f 34                	sysenter
+     91b:	c3                   	ret
+
+0000091c <iosubmit>:
+SYSCALL(iosubmit)
+     91c:	b8 19 00 00 00       	mov    $0x19,%eax
+     921:	89 e1                	mov    %esp,%ecx
+     923:	ba 2a 09 00 00       	mov    $0x92a,%edx
+     928:	0f 34                	sysenter
+     92a:	c3                   	ret
+
+0000092b <sysstat>:
+SYSCALL(sysstat)
+     92b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     930:	89 e1                	mov    %esp,%ecx
+     932:	ba 39 09 00 00       	mov    $0x939,%edx
+     937:	0f 34                	sysenter
+     939:	c3                   	ret
+
+0000093a <splice>:
+SYSCALL(splice)
+     93a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     93f:	89 e1                	mov    %esp,%ecx
+     941:	ba 48 09 00 00       	mov    $0x948,%edx
+     946:	0f 34                	sysenter
+     948:	c3                   	ret
+
+00000949 <fsync>:
+SYSCALL(fsync)
+     949:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     94e:	89 e1                	mov    %esp,%ecx
+     950:	ba 57 09 00 00       	mov    $0x957,%edx
+     955:	0f 34                	sysenter
+     957:	c3                   	ret
+
+00000958 <fdatasync>:
+SYSCALL(fdatasync)
+     958:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     95d:	89 e1                	mov    %esp,%ecx
+     95f:	ba 66 09 00 00       	mov    $0x966,%edx
+     964:	0f 34                	sysenter
+     966:	c3                   	ret
+
+00000967 <lseek>:
+SYSCALL(lseek)
+     967:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     96c:	89 e1                	mov    %esp,%ecx
+     96e:	ba 75 09 00 00       	mov    $0x975,%edx
+     973:	0f 34                	sysenter
+     975:	c3                   	ret
+
+00000976 <dmesg>:
+SYSCALL(dmesg)
+     976:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     97b:	89 e1                	mov    %esp,%ecx
+     97d:	ba 84 09 00 00       	mov    $0x984,%edx
+     982:	0f 34                	sysenter
+     984:	c3                   	ret
+
+00000985 <lockstat>:
+SYSCALL(lockstat)
+     985:	b8 20 00 00 00       	mov    $0x20,%eax
+     98a:	89 e1                	mov    %esp,%ecx
+     98c:	ba 93 09 00 00       	mov    $0x993,%edx
+     991:	0f 34                	sysenter
+     993:	c3                   	ret
+
+00000994 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     994:	55                   	push   %ebp
+     995:	89 e5                	mov    %esp,%ebp
+     997:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     99a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     9a1:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     9a5:	74 17                	je     9be <printint+0x2a>
+     9a7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     9ab:	79 11                	jns    9be <printint+0x2a>
+    neg = 1;
+     9ad:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     9b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+     9b7:	f7 d8                	neg    %eax
+     9b9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     9bc:	eb 06                	jmp    9c4 <printint+0x30>
+  } else {
+    x = xx;
+     9be:	8b 45 0c             	mov    0xc(%ebp),%eax
+     9c1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     9c4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     9cb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     9ce:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     9d1:	ba 00 00 00 00       	mov    $0x0,%edx
+     9d6:	f7 f1                	div    %ecx
+     9d8:	89 d1                	mov    %edx,%ecx
+     9da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9dd:	8d 50 01             	lea    0x1(%eax),%edx
+     9e0:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     9e3:	0f b6 91 60 1a 00 00 	movzbl 0x1a60(%ecx),%edx
+     9ea:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     9ee:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     9f1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     9f4:	ba 00 00 00 00       	mov    $0x0,%edx
+     9f9:	f7 f1                	div    %ecx
+     9fb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     9fe:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     a02:	75 c7                	jne    9cb <printint+0x37>
+  if(neg)
+     a04:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     a08:	74 2d                	je     a37 <printint+0xa3>
+    buf[i++] = '-';
+     a0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a0d:	8d 50 01             	lea    0x1(%eax),%edx
+     a10:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     a13:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+     a18:	eb 1d                	jmp    a37 <printint+0xa3>
+    fputc(fd, buf[i]);
+     a1a:	8d 55 dc             	lea    -0x24(%ebp),%edx
+     a1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a20:	01 d0                	add    %edx,%eax
+     a22:	0f b6 00             	movzbl (%eax),%eax
+     a25:	0f be c0             	movsbl %al,%eax
+     a28:	83 ec 08             	sub    $0x8,%esp
+     a2b:	50                   	push   %eax
+     a2c:	ff 75 08             	push   0x8(%ebp)
+     a2f:	e8 f8 08 00 00       	call   132c <fputc>
+     a34:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+     a37:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     a3b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     a3f:	79 d9                	jns    a1a <printint+0x86>
+}
+     a41:	90                   	nop
+     a42:	90                   	nop
+     a43:	c9                   	leave
+     a44:	c3                   	ret
+
+00000a45 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     a45:	55                   	push   %ebp
+     a46:	89 e5                	mov    %esp,%ebp
+     a48:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+     a4b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     a52:	8d 45 0c             	lea    0xc(%ebp),%eax
+     a55:	83 c0 04             	add    $0x4,%eax
+     a58:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+     a5b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     a62:	e9 4a 01 00 00       	jmp    bb1 <printf+0x16c>
+    c = fmt[i] & 0xff;
+     a67:	8b 55 0c             	mov    0xc(%ebp),%edx
+     a6a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a6d:	01 d0                	add    %edx,%eax
+     a6f:	0f b6 00             	movzbl (%eax),%eax
+     a72:	0f be c0             	movsbl %al,%eax
+     a75:	25 ff 00 00 00       	and    $0xff,%eax
+     a7a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+     a7d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     a81:	75 28                	jne    aab <printf+0x66>
+      if(c == '%'){
+     a83:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     a87:	75 0c                	jne    a95 <printf+0x50>
+        state = '%';
+     a89:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+     a90:	e9 18 01 00 00       	jmp    bad <printf+0x168>
+      } else {
+        fputc(fd, c);
+     a95:	83 ec 08             	sub    $0x8,%esp
+     a98:	ff 75 e4             	push   -0x1c(%ebp)
+     a9b:	ff 75 08             	push   0x8(%ebp)
+     a9e:	e8 89 08 00 00       	call   132c <fputc>
+     aa3:	83 c4 10             	add    $0x10,%esp
+     aa6:	e9 02 01 00 00       	jmp    bad <printf+0x168>
+      }
+    } else if(state == '%'){
+     aab:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+     aaf:	0f 85 f8 00 00 00    	jne    bad <printf+0x168>
+      if(c == 'd'){
+     ab5:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+     ab9:	75 1e                	jne    ad9 <printf+0x94>
+        printint(fd, *ap, 10, 1);
+     abb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     abe:	8b 00                	mov    (%eax),%eax
+     ac0:	6a 01                	push   $0x1
+     ac2:	6a 0a                	push   $0xa
+     ac4:	50                   	push   %eax
+     ac5:	ff 75 08             	push   0x8(%ebp)
+     ac8:	e8 c7 fe ff ff       	call   994 <printint>
+     acd:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     ad0:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     ad4:	e9 cd 00 00 00       	jmp    ba6 <printf+0x161>
+      } else if(c == 'x' || c == 'p'){
+     ad9:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+     add:	74 06                	je     ae5 <printf+0xa0>
+     adf:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+     ae3:	75 1e                	jne    b03 <printf+0xbe>
+        printint(fd, *ap, 16, 0);
+     ae5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     ae8:	8b 00                	mov    (%eax),%eax
+     aea:	6a 00                	push   $0x0
+     aec:	6a 10                	push   $0x10
+     aee:	50                   	push   %eax
+     aef:	ff 75 08             	push   0x8(%ebp)
+     af2:	e8 9d fe ff ff       	call   994 <printint>
+     af7:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     afa:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     afe:	e9 a3 00 00 00       	jmp    ba6 <printf+0x161>
+      } else if(c == 's'){
+     b03:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+     b07:	75 43                	jne    b4c <printf+0x107>
+        s = (char*)*ap;
+     b09:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     b0c:	8b 00                	mov    (%eax),%eax
+     b0e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     b11:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+     b15:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     b19:	75 25                	jne    b40 <printf+0xfb>
+          s = "(null)";
+     b1b:	c7 45 f4 97 15 00 00 	movl   $0x1597,-0xc(%ebp)
+        while(*s != 0){
+     b22:	eb 1c                	jmp    b40 <printf+0xfb>
+          fputc(fd, *s);
+     b24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b27:	0f b6 00             	movzbl (%eax),%eax
+     b2a:	0f be c0             	movsbl %al,%eax
+     b2d:	83 ec 08             	sub    $0x8,%esp
+     b30:	50                   	push   %eax
+     b31:	ff 75 08             	push   0x8(%ebp)
+     b34:	e8 f3 07 00 00       	call   132c <fputc>
+     b39:	83 c4 10             	add    $0x10,%esp
+          s++;
+     b3c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+     b40:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b43:	0f b6 00             	movzbl (%eax),%eax
+     b46:	84 c0                	test   %al,%al
+     b48:	75 da                	jne    b24 <printf+0xdf>
+     b4a:	eb 5a                	jmp    ba6 <printf+0x161>
+        }
+      } else if(c == 'c'){
+     b4c:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+     b50:	75 1a                	jne    b6c <printf+0x127>
+        fputc(fd, *ap);
+     b52:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     b55:	8b 00                	mov    (%eax),%eax
+     b57:	83 ec 08             	sub    $0x8,%esp
+     b5a:	50                   	push   %eax
+     b5b:	ff 75 08             	push   0x8(%ebp)
+     b5e:	e8 c9 07 00 00       	call   132c <fputc>
+     b63:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     b66:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     b6a:	eb 3a                	jmp    ba6 <printf+0x161>
+      } else if(c == '%'){
+     b6c:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     b70:	75 13                	jne    b85 <printf+0x140>
+        fputc(fd, c);
+     b72:	83 ec 08             	sub    $0x8,%esp
+     b75:	ff 75 e4             	push   -0x1c(%ebp)
+     b78:	ff 75 08             	push   0x8(%ebp)
+     b7b:	e8 ac 07 00 00       	call   132c <fputc>
+     b80:	83 c4 10             	add    $0x10,%esp
+     b83:	eb 21                	jmp    ba6 <printf+0x161>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        fputc(fd, '%');
+     b85:	83 ec 08             	sub    $0x8,%esp
+     b88:	6a 25                	push   $0x25
+     b8a:	ff 75 08             	push   0x8(%ebp)
+     b8d:	e8 9a 07 00 00       	call   132c <fputc>
+     b92:	83 c4 10             	add    $0x10,%esp
+        fputc(fd, c);
+     b95:	83 ec 08             	sub    $0x8,%esp
+     b98:	ff 75 e4             	push   -0x1c(%ebp)
+     b9b:	ff 75 08             	push   0x8(%ebp)
+     b9e:	e8 89 07 00 00       	call   132c <fputc>
+     ba3:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     ba6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     bad:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     bb1:	8b 55 0c             	mov    0xc(%ebp),%edx
+     bb4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bb7:	01 d0                	add    %edx,%eax
+     bb9:	0f b6 00             	movzbl (%eax),%eax
+     bbc:	84 c0                	test   %al,%al
+     bbe:	0f 85 a3 fe ff ff    	jne    a67 <printf+0x22>
+    }
+  }
+}
+     bc4:	90                   	nop
+     bc5:	90                   	nop
+     bc6:	c9                   	leave
+     bc7:	c3                   	ret
+
+00000bc8 <binof>:
+static struct chunk *bins[NBIN];       // free large chunks
+static struct chunk *top;              // end marker of newest heap segment
+
+static int
+binof(uint size)
+{
+     bc8:	55                   	push   %ebp
+     bc9:	89 e5                	mov    %esp,%ebp
+     bcb:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  i = 0;
+     bce:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     bd5:	c1 6d 08 05          	shrl   $0x5,0x8(%ebp)
+     bd9:	eb 07                	jmp    be2 <binof+0x1a>
+    i++;
+     bdb:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     bdf:	d1 6d 08             	shrl   0x8(%ebp)
+     be2:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     be6:	74 06                	je     bee <binof+0x26>
+     be8:	83 7d fc 19          	cmpl   $0x19,-0x4(%ebp)
+     bec:	7e ed                	jle    bdb <binof+0x13>
+  return i;
+     bee:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     bf1:	c9                   	leave
+     bf2:	c3                   	ret
+
+00000bf3 <bininsert>:
+
+static void
+bininsert(struct chunk *c)
+{
+     bf3:	55                   	push   %ebp
+     bf4:	89 e5                	mov    %esp,%ebp
+     bf6:	83 ec 10             	sub    $0x10,%esp
+  struct chunk **b;
+
+  b = &bins[binof(CSIZE(c))];
+     bf9:	8b 45 08             	mov    0x8(%ebp),%eax
+     bfc:	8b 00                	mov    (%eax),%eax
+     bfe:	83 e0 f8             	and    $0xfffffff8,%eax
+     c01:	50                   	push   %eax
+     c02:	e8 c1 ff ff ff       	call   bc8 <binof>
+     c07:	83 c4 04             	add    $0x4,%esp
+     c0a:	c1 e0 02             	shl    $0x2,%eax
+     c0d:	05 40 1e 00 00       	add    $0x1e40,%eax
+     c12:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c->prev = 0;
+     c15:	8b 45 08             	mov    0x8(%ebp),%eax
+     c18:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  c->next = *b;
+     c1f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c22:	8b 10                	mov    (%eax),%edx
+     c24:	8b 45 08             	mov    0x8(%ebp),%eax
+     c27:	89 50 08             	mov    %edx,0x8(%eax)
+  if(*b)
+     c2a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c2d:	8b 00                	mov    (%eax),%eax
+     c2f:	85 c0                	test   %eax,%eax
+     c31:	74 0b                	je     c3e <bininsert+0x4b>
+    (*b)->prev = c;
+     c33:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c36:	8b 00                	mov    (%eax),%eax
+     c38:	8b 55 08             	mov    0x8(%ebp),%edx
+     c3b:	89 50 0c             	mov    %edx,0xc(%eax)
+  *b = c;
+     c3e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c41:	8b 55 08             	mov    0x8(%ebp),%edx
+     c44:	89 10                	mov    %edx,(%eax)
+}
+     c46:	90                   	nop
+     c47:	c9                   	leave
+     c48:	c3                   	ret
+
+00000c49 <binremove>:
+
+static void
+binremove(struct chunk *c)
+{
+     c49:	55                   	push   %ebp
+     c4a:	89 e5                	mov    %esp,%ebp
+  if(c->prev)
+     c4c:	8b 45 08             	mov    0x8(%ebp),%eax
+     c4f:	8b 40 0c             	mov    0xc(%eax),%eax
+     c52:	85 c0                	test   %eax,%eax
+     c54:	74 11                	je     c67 <binremove+0x1e>
+    c->prev->next = c->next;
+     c56:	8b 45 08             	mov    0x8(%ebp),%eax
+     c59:	8b 40 0c             	mov    0xc(%eax),%eax
+     c5c:	8b 55 08             	mov    0x8(%ebp),%edx
+     c5f:	8b 52 08             	mov    0x8(%edx),%edx
+     c62:	89 50 08             	mov    %edx,0x8(%eax)
+     c65:	eb 1e                	jmp    c85 <binremove+0x3c>
+  else
+    bins[binof(CSIZE(c))] = c->next;
+     c67:	8b 45 08             	mov    0x8(%ebp),%eax
+     c6a:	8b 00                	mov    (%eax),%eax
+     c6c:	83 e0 f8             	and    $0xfffffff8,%eax
+     c6f:	50                   	push   %eax
+     c70:	e8 53 ff ff ff       	call   bc8 <binof>
+     c75:	83 c4 04             	add    $0x4,%esp
+     c78:	8b 55 08             	mov    0x8(%ebp),%edx
+     c7b:	8b 52 08             	mov    0x8(%edx),%edx
+     c7e:	89 14 85 40 1e 00 00 	mov    %edx,0x1e40(,%eax,4)
+  if(c->next)
+     c85:	8b 45 08             	mov    0x8(%ebp),%eax
+     c88:	8b 40 08             	mov    0x8(%eax),%eax
+     c8b:	85 c0                	test   %eax,%eax
+     c8d:	74 0f                	je     c9e <binremove+0x55>
+    c->next->prev = c->prev;
+     c8f:	8b 45 08             	mov    0x8(%ebp),%eax
+     c92:	8b 40 08             	mov    0x8(%eax),%eax
+     c95:	8b 55 08             	mov    0x8(%ebp),%edx
+     c98:	8b 52 0c             	mov    0xc(%edx),%edx
+     c9b:	89 50 0c             	mov    %edx,0xc(%eax)
+}
+     c9e:	90                   	nop
+     c9f:	c9                   	leave
+     ca0:	c3                   	ret
+
+00000ca1 <freechunk>:
+
+// Free chunk c, merging it with free neighbors.  If trim is
+// set and the result is big and at the break, give it back.
+static void
+freechunk(struct chunk *c, int trim)
+{
+     ca1:	55                   	push   %ebp
+     ca2:	89 e5                	mov    %esp,%ebp
+     ca4:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *p, *n;
+  uint size;
+
+  size = CSIZE(c);
+     ca7:	8b 45 08             	mov    0x8(%ebp),%eax
+     caa:	8b 00                	mov    (%eax),%eax
+     cac:	83 e0 f8             	and    $0xfffffff8,%eax
+     caf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  n = NEXTC(c);
+     cb2:	8b 45 08             	mov    0x8(%ebp),%eax
+     cb5:	8b 00                	mov    (%eax),%eax
+     cb7:	83 e0 f8             	and    $0xfffffff8,%eax
+     cba:	89 c2                	mov    %eax,%edx
+     cbc:	8b 45 08             	mov    0x8(%ebp),%eax
+     cbf:	01 d0                	add    %edx,%eax
+     cc1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(!(c->size & PREVUSED)){
+     cc4:	8b 45 08             	mov    0x8(%ebp),%eax
+     cc7:	8b 00                	mov    (%eax),%eax
+     cc9:	83 e0 02             	and    $0x2,%eax
+     ccc:	85 c0                	test   %eax,%eax
+     cce:	75 30                	jne    d00 <freechunk+0x5f>
+    p = (struct chunk*)((char*)c - *((uint*)c - 1));
+     cd0:	8b 45 08             	mov    0x8(%ebp),%eax
+     cd3:	83 e8 04             	sub    $0x4,%eax
+     cd6:	8b 00                	mov    (%eax),%eax
+     cd8:	f7 d8                	neg    %eax
+     cda:	89 c2                	mov    %eax,%edx
+     cdc:	8b 45 08             	mov    0x8(%ebp),%eax
+     cdf:	01 d0                	add    %edx,%eax
+     ce1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    binremove(p);
+     ce4:	ff 75 ec             	push   -0x14(%ebp)
+     ce7:	e8 5d ff ff ff       	call   c49 <binremove>
+     cec:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(p);
+     cef:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     cf2:	8b 00                	mov    (%eax),%eax
+     cf4:	83 e0 f8             	and    $0xfffffff8,%eax
+     cf7:	01 45 f4             	add    %eax,-0xc(%ebp)
+    c = p;
+     cfa:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     cfd:	89 45 08             	mov    %eax,0x8(%ebp)
+  }
+  if(!(n->size & USED)){
+     d00:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d03:	8b 00                	mov    (%eax),%eax
+     d05:	83 e0 01             	and    $0x1,%eax
+     d08:	85 c0                	test   %eax,%eax
+     d0a:	75 16                	jne    d22 <freechunk+0x81>
+    binremove(n);
+     d0c:	ff 75 f0             	push   -0x10(%ebp)
+     d0f:	e8 35 ff ff ff       	call   c49 <binremove>
+     d14:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(n);
+     d17:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d1a:	8b 00                	mov    (%eax),%eax
+     d1c:	83 e0 f8             	and    $0xfffffff8,%eax
+     d1f:	01 45 f4             	add    %eax,-0xc(%ebp)
+  }
+  // Free chunks are never adjacent, so the one below is in use.
+  c->size = size | PREVUSED;
+     d22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d25:	83 c8 02             	or     $0x2,%eax
+     d28:	89 c2                	mov    %eax,%edx
+     d2a:	8b 45 08             	mov    0x8(%ebp),%eax
+     d2d:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+     d2f:	8b 45 08             	mov    0x8(%ebp),%eax
+     d32:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  FOOTER(c) = size;
+     d39:	8b 45 08             	mov    0x8(%ebp),%eax
+     d3c:	8b 00                	mov    (%eax),%eax
+     d3e:	83 e0 f8             	and    $0xfffffff8,%eax
+     d41:	8d 50 fc             	lea    -0x4(%eax),%edx
+     d44:	8b 45 08             	mov    0x8(%ebp),%eax
+     d47:	01 c2                	add    %eax,%edx
+     d49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d4c:	89 02                	mov    %eax,(%edx)
+  n = NEXTC(c);
+     d4e:	8b 45 08             	mov    0x8(%ebp),%eax
+     d51:	8b 00                	mov    (%eax),%eax
+     d53:	83 e0 f8             	and    $0xfffffff8,%eax
+     d56:	89 c2                	mov    %eax,%edx
+     d58:	8b 45 08             	mov    0x8(%ebp),%eax
+     d5b:	01 d0                	add    %edx,%eax
+     d5d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  n->size &= ~PREVUSED;
+     d60:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d63:	8b 00                	mov    (%eax),%eax
+     d65:	83 e0 fd             	and    $0xfffffffd,%eax
+     d68:	89 c2                	mov    %eax,%edx
+     d6a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d6d:	89 10                	mov    %edx,(%eax)
+
+  if(trim && n == top && size >= TRIMSIZE && sbrk(0) == (char*)top + HDRSIZE){
+     d6f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     d73:	74 51                	je     dc6 <freechunk+0x125>
+     d75:	a1 ac 1e 00 00       	mov    0x1eac,%eax
+     d7a:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     d7d:	75 47                	jne    dc6 <freechunk+0x125>
+     d7f:	81 7d f4 ff 7f 00 00 	cmpl   $0x7fff,-0xc(%ebp)
+     d86:	76 3e                	jbe    dc6 <freechunk+0x125>
+     d88:	83 ec 0c             	sub    $0xc,%esp
+     d8b:	6a 00                	push   $0x0
+     d8d:	e8 30 fb ff ff       	call   8c2 <sbrk>
+     d92:	83 c4 10             	add    $0x10,%esp
+     d95:	8b 15 ac 1e 00 00    	mov    0x1eac,%edx
+     d9b:	83 c2 08             	add    $0x8,%edx
+     d9e:	39 d0                	cmp    %edx,%eax
+     da0:	75 24                	jne    dc6 <freechunk+0x125>
+    c->size = USED | PREVUSED;
+     da2:	8b 45 08             	mov    0x8(%ebp),%eax
+     da5:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+    top = c;
+     dab:	8b 45 08             	mov    0x8(%ebp),%eax
+     dae:	a3 ac 1e 00 00       	mov    %eax,0x1eac
+    sbrk(-size);
+     db3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     db6:	f7 d8                	neg    %eax
+     db8:	83 ec 0c             	sub    $0xc,%esp
+     dbb:	50                   	push   %eax
+     dbc:	e8 01 fb ff ff       	call   8c2 <sbrk>
+     dc1:	83 c4 10             	add    $0x10,%esp
+    return;
+     dc4:	eb 0e                	jmp    dd4 <freechunk+0x133>
+  }
+  bininsert(c);
+     dc6:	83 ec 0c             	sub    $0xc,%esp
+     dc9:	ff 75 08             	push   0x8(%ebp)
+     dcc:	e8 22 fe ff ff       	call   bf3 <bininsert>
+     dd1:	83 c4 10             	add    $0x10,%esp
+}
+     dd4:	c9                   	leave
+     dd5:	c3                   	ret
+
+00000dd6 <morecore>:
+
+// Grow the heap by at least need bytes.
+static int
+morecore(uint need)
+{
+     dd6:	55                   	push   %ebp
+     dd7:	89 e5                	mov    %esp,%ebp
+     dd9:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+  char *p;
+  uint n, pad;
+
+  n = need + MINCHUNK;
+     ddc:	8b 45 08             	mov    0x8(%ebp),%eax
+     ddf:	83 c0 18             	add    $0x18,%eax
+     de2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(n < MINCORE)
+     de5:	81 7d ec ff 3f 00 00 	cmpl   $0x3fff,-0x14(%ebp)
+     dec:	77 07                	ja     df5 <morecore+0x1f>
+    n = MINCORE;
+     dee:	c7 45 ec 00 40 00 00 	movl   $0x4000,-0x14(%ebp)
+  // Keep the break 8-aligned, with the end marker just below it.
+  pad = (8 - ((uint)sbrk(0) & 7)) & 7;
+     df5:	83 ec 0c             	sub    $0xc,%esp
+     df8:	6a 00                	push   $0x0
+     dfa:	e8 c3 fa ff ff       	call   8c2 <sbrk>
+     dff:	83 c4 10             	add    $0x10,%esp
+     e02:	83 e0 07             	and    $0x7,%eax
+     e05:	ba 08 00 00 00       	mov    $0x8,%edx
+     e0a:	29 c2                	sub    %eax,%edx
+     e0c:	89 d0                	mov    %edx,%eax
+     e0e:	83 e0 07             	and    $0x7,%eax
+     e11:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if((p = sbrk(pad + n)) == (char*)-1){
+     e14:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     e17:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     e1a:	01 d0                	add    %edx,%eax
+     e1c:	83 ec 0c             	sub    $0xc,%esp
+     e1f:	50                   	push   %eax
+     e20:	e8 9d fa ff ff       	call   8c2 <sbrk>
+     e25:	83 c4 10             	add    $0x10,%esp
+     e28:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     e2b:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     e2f:	75 30                	jne    e61 <morecore+0x8b>
+    n = need + MINCHUNK;
+     e31:	8b 45 08             	mov    0x8(%ebp),%eax
+     e34:	83 c0 18             	add    $0x18,%eax
+     e37:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((p = sbrk(pad + n)) == (char*)-1)
+     e3a:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     e3d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     e40:	01 d0                	add    %edx,%eax
+     e42:	83 ec 0c             	sub    $0xc,%esp
+     e45:	50                   	push   %eax
+     e46:	e8 77 fa ff ff       	call   8c2 <sbrk>
+     e4b:	83 c4 10             	add    $0x10,%esp
+     e4e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     e51:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     e55:	75 0a                	jne    e61 <morecore+0x8b>
+      return -1;
+     e57:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     e5c:	e9 8e 00 00 00       	jmp    eef <morecore+0x119>
+  }
+  p += pad;
+     e61:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e64:	01 45 f0             	add    %eax,-0x10(%ebp)
+  if(top && p == (char*)top + HDRSIZE){
+     e67:	a1 ac 1e 00 00       	mov    0x1eac,%eax
+     e6c:	85 c0                	test   %eax,%eax
+     e6e:	74 29                	je     e99 <morecore+0xc3>
+     e70:	a1 ac 1e 00 00       	mov    0x1eac,%eax
+     e75:	83 c0 08             	add    $0x8,%eax
+     e78:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     e7b:	75 1c                	jne    e99 <morecore+0xc3>
+    // Contiguous: the old end marker heads the new chunk.
+    c = top;
+     e7d:	a1 ac 1e 00 00       	mov    0x1eac,%eax
+     e82:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = n | (c->size & PREVUSED);
+     e85:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e88:	8b 00                	mov    (%eax),%eax
+     e8a:	83 e0 02             	and    $0x2,%eax
+     e8d:	0b 45 ec             	or     -0x14(%ebp),%eax
+     e90:	89 c2                	mov    %eax,%edx
+     e92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e95:	89 10                	mov    %edx,(%eax)
+     e97:	eb 16                	jmp    eaf <morecore+0xd9>
+  } else {
+    // Someone else moved the break: start a new segment.
+    c = (struct chunk*)p;
+     e99:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e9c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = (n - HDRSIZE) | PREVUSED;
+     e9f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     ea2:	83 e8 08             	sub    $0x8,%eax
+     ea5:	83 c8 02             	or     $0x2,%eax
+     ea8:	89 c2                	mov    %eax,%edx
+     eaa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ead:	89 10                	mov    %edx,(%eax)
+  }
+  top = NEXTC(c);
+     eaf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eb2:	8b 00                	mov    (%eax),%eax
+     eb4:	83 e0 f8             	and    $0xfffffff8,%eax
+     eb7:	89 c2                	mov    %eax,%edx
+     eb9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ebc:	01 d0                	add    %edx,%eax
+     ebe:	a3 ac 1e 00 00       	mov    %eax,0x1eac
+  top->size = USED;
+     ec3:	a1 ac 1e 00 00       	mov    0x1eac,%eax
+     ec8:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  top->tag = LARGE;
+     ece:	a1 ac 1e 00 00       	mov    0x1eac,%eax
+     ed3:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  freechunk(c, 0);
+     eda:	83 ec 08             	sub    $0x8,%esp
+     edd:	6a 00                	push   $0x0
+     edf:	ff 75 f4             	push   -0xc(%ebp)
+     ee2:	e8 ba fd ff ff       	call   ca1 <freechunk>
+     ee7:	83 c4 10             	add    $0x10,%esp
+  return 0;
+     eea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     eef:	c9                   	leave
+     ef0:	c3                   	ret
+
+00000ef1 <largealloc>:
+
+static void*
+largealloc(uint nbytes)
+{
+     ef1:	55                   	push   %ebp
+     ef2:	89 e5                	mov    %esp,%ebp
+     ef4:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c, *r;
+  uint need;
+  int i;
+
+  if(nbytes > 0x7fffffff)
+     ef7:	8b 45 08             	mov    0x8(%ebp),%eax
+     efa:	85 c0                	test   %eax,%eax
+     efc:	79 0a                	jns    f08 <largealloc+0x17>
+    return 0;
+     efe:	b8 00 00 00 00       	mov    $0x0,%eax
+     f03:	e9 43 01 00 00       	jmp    104b <largealloc+0x15a>
+  need = (nbytes + HDRSIZE + 7) & ~7;
+     f08:	8b 45 08             	mov    0x8(%ebp),%eax
+     f0b:	83 c0 0f             	add    $0xf,%eax
+     f0e:	83 e0 f8             	and    $0xfffffff8,%eax
+     f11:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(need < MINCHUNK)
+     f14:	83 7d f0 17          	cmpl   $0x17,-0x10(%ebp)
+     f18:	77 07                	ja     f21 <largealloc+0x30>
+    need = MINCHUNK;
+     f1a:	c7 45 f0 18 00 00 00 	movl   $0x18,-0x10(%ebp)
+  for(;;){
+    for(i = binof(need); i < NBIN; i++)
+     f21:	ff 75 f0             	push   -0x10(%ebp)
+     f24:	e8 9f fc ff ff       	call   bc8 <binof>
+     f29:	83 c4 04             	add    $0x4,%esp
+     f2c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     f2f:	eb 2f                	jmp    f60 <largealloc+0x6f>
+      for(c = bins[i]; c; c = c->next)
+     f31:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f34:	8b 04 85 40 1e 00 00 	mov    0x1e40(,%eax,4),%eax
+     f3b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     f3e:	eb 16                	jmp    f56 <largealloc+0x65>
+        if(CSIZE(c) >= need)
+     f40:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f43:	8b 00                	mov    (%eax),%eax
+     f45:	83 e0 f8             	and    $0xfffffff8,%eax
+     f48:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     f4b:	73 35                	jae    f82 <largealloc+0x91>
+      for(c = bins[i]; c; c = c->next)
+     f4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f50:	8b 40 08             	mov    0x8(%eax),%eax
+     f53:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     f56:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     f5a:	75 e4                	jne    f40 <largealloc+0x4f>
+    for(i = binof(need); i < NBIN; i++)
+     f5c:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     f60:	83 7d ec 1a          	cmpl   $0x1a,-0x14(%ebp)
+     f64:	7e cb                	jle    f31 <largealloc+0x40>
+          goto found;
+    if(morecore(need) < 0)
+     f66:	83 ec 0c             	sub    $0xc,%esp
+     f69:	ff 75 f0             	push   -0x10(%ebp)
+     f6c:	e8 65 fe ff ff       	call   dd6 <morecore>
+     f71:	83 c4 10             	add    $0x10,%esp
+     f74:	85 c0                	test   %eax,%eax
+     f76:	79 a9                	jns    f21 <largealloc+0x30>
+      return 0;
+     f78:	b8 00 00 00 00       	mov    $0x0,%eax
+     f7d:	e9 c9 00 00 00       	jmp    104b <largealloc+0x15a>
+          goto found;
+     f82:	90                   	nop
+  }
+
+found:
+  binremove(c);
+     f83:	83 ec 0c             	sub    $0xc,%esp
+     f86:	ff 75 f4             	push   -0xc(%ebp)
+     f89:	e8 bb fc ff ff       	call   c49 <binremove>
+     f8e:	83 c4 10             	add    $0x10,%esp
+  if(CSIZE(c) - need >= MINCHUNK){
+     f91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f94:	8b 00                	mov    (%eax),%eax
+     f96:	83 e0 f8             	and    $0xfffffff8,%eax
+     f99:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     f9c:	83 f8 17             	cmp    $0x17,%eax
+     f9f:	76 66                	jbe    1007 <largealloc+0x116>
+    r = (struct chunk*)((char*)c + need);
+     fa1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     fa4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     fa7:	01 d0                	add    %edx,%eax
+     fa9:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    r->size = (CSIZE(c) - need) | PREVUSED;
+     fac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     faf:	8b 00                	mov    (%eax),%eax
+     fb1:	83 e0 f8             	and    $0xfffffff8,%eax
+     fb4:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     fb7:	83 c8 02             	or     $0x2,%eax
+     fba:	89 c2                	mov    %eax,%edx
+     fbc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     fbf:	89 10                	mov    %edx,(%eax)
+    r->tag = LARGE;
+     fc1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     fc4:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+    FOOTER(r) = CSIZE(r);
+     fcb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     fce:	8b 10                	mov    (%eax),%edx
+     fd0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     fd3:	8b 00                	mov    (%eax),%eax
+     fd5:	83 e0 f8             	and    $0xfffffff8,%eax
+     fd8:	8d 48 fc             	lea    -0x4(%eax),%ecx
+     fdb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     fde:	01 c8                	add    %ecx,%eax
+     fe0:	83 e2 f8             	and    $0xfffffff8,%edx
+     fe3:	89 10                	mov    %edx,(%eax)
+    bininsert(r);
+     fe5:	83 ec 0c             	sub    $0xc,%esp
+     fe8:	ff 75 e8             	push   -0x18(%ebp)
+     feb:	e8 03 fc ff ff       	call   bf3 <bininsert>
+     ff0:	83 c4 10             	add    $0x10,%esp
+    c->size = need | (c->size & PREVUSED);
+     ff3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ff6:	8b 00                	mov    (%eax),%eax
+     ff8:	83 e0 02             	and    $0x2,%eax
+     ffb:	0b 45 f0             	or     -0x10(%ebp),%eax
+     ffe:	89 c2                	mov    %eax,%edx
+    1000:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1003:	89 10                	mov    %edx,(%eax)
+    1005:	eb 25                	jmp    102c <largealloc+0x13b>
+  } else
+    NEXTC(c)->size |= PREVUSED;
+    1007:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    100a:	8b 00                	mov    (%eax),%eax
+    100c:	83 e0 f8             	and    $0xfffffff8,%eax
+    100f:	89 c2                	mov    %eax,%edx
+    1011:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1014:	01 d0                	add    %edx,%eax
+    1016:	8b 10                	mov    (%eax),%edx
+    1018:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    101b:	8b 00                	mov    (%eax),%eax
+    101d:	83 e0 f8             	and    $0xfffffff8,%eax
+    1020:	89 c1                	mov    %eax,%ecx
+    1022:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1025:	01 c8                	add    %ecx,%eax
+    1027:	83 ca 02             	or     $0x2,%edx
+    102a:	89 10                	mov    %edx,(%eax)
+  c->size |= USED;
+    102c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    102f:	8b 00                	mov    (%eax),%eax
+    1031:	83 c8 01             	or     $0x1,%eax
+    1034:	89 c2                	mov    %eax,%edx
+    1036:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1039:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+    103b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    103e:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  return (char*)c + HDRSIZE;
+    1045:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1048:	83 c0 08             	add    $0x8,%eax
+}
+    104b:	c9                   	leave
+    104c:	c3                   	ret
+
+0000104d <refill>:
+
+// Carve a slab into free blocks of class k.
+static int
+refill(int k)
+{
+    104d:	55                   	push   %ebp
+    104e:	89 e5                	mov    %esp,%ebp
+    1050:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  char *p;
+  uint bs, i;
+
+  if((p = largealloc(SLABSIZE)) == 0)
+    1053:	83 ec 0c             	sub    $0xc,%esp
+    1056:	68 00 20 00 00       	push   $0x2000
+    105b:	e8 91 fe ff ff       	call   ef1 <largealloc>
+    1060:	83 c4 10             	add    $0x10,%esp
+    1063:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1066:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    106a:	75 07                	jne    1073 <refill+0x26>
+    return -1;
+    106c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1071:	eb 75                	jmp    10e8 <refill+0x9b>
+  bs = HDRSIZE + (MINSMALL << k);
+    1073:	8b 45 08             	mov    0x8(%ebp),%eax
+    1076:	ba 10 00 00 00       	mov    $0x10,%edx
+    107b:	89 c1                	mov    %eax,%ecx
+    107d:	d3 e2                	shl    %cl,%edx
+    107f:	89 d0                	mov    %edx,%eax
+    1081:	83 c0 08             	add    $0x8,%eax
+    1084:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+    1087:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    108e:	eb 44                	jmp    10d4 <refill+0x87>
+    b = (struct chunk*)(p + i);
+    1090:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    1093:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1096:	01 d0                	add    %edx,%eax
+    1098:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    b->size = bs | USED;
+    109b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    109e:	83 c8 01             	or     $0x1,%eax
+    10a1:	89 c2                	mov    %eax,%edx
+    10a3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    10a6:	89 10                	mov    %edx,(%eax)
+    b->tag = k;
+    10a8:	8b 55 08             	mov    0x8(%ebp),%edx
+    10ab:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    10ae:	89 50 04             	mov    %edx,0x4(%eax)
+    b->next = classes[k];
+    10b1:	8b 45 08             	mov    0x8(%ebp),%eax
+    10b4:	8b 14 85 20 1e 00 00 	mov    0x1e20(,%eax,4),%edx
+    10bb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    10be:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[k] = b;
+    10c1:	8b 45 08             	mov    0x8(%ebp),%eax
+    10c4:	8b 55 e8             	mov    -0x18(%ebp),%edx
+    10c7:	89 14 85 20 1e 00 00 	mov    %edx,0x1e20(,%eax,4)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+    10ce:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    10d1:	01 45 f4             	add    %eax,-0xc(%ebp)
+    10d4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    10d7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    10da:	01 d0                	add    %edx,%eax
+    10dc:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    10e1:	76 ad                	jbe    1090 <refill+0x43>
+  }
+  return 0;
+    10e3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    10e8:	c9                   	leave
+    10e9:	c3                   	ret
+
+000010ea <free>:
+
+void
+free(void *ap)
+{
+    10ea:	55                   	push   %ebp
+    10eb:	89 e5                	mov    %esp,%ebp
+    10ed:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+
+  if(ap == 0)
+    10f0:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    10f4:	74 4b                	je     1141 <free+0x57>
+    return;
+  c = (struct chunk*)((char*)ap - HDRSIZE);
+    10f6:	8b 45 08             	mov    0x8(%ebp),%eax
+    10f9:	83 e8 08             	sub    $0x8,%eax
+    10fc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(c->tag != LARGE){
+    10ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1102:	8b 40 04             	mov    0x4(%eax),%eax
+    1105:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1108:	74 25                	je     112f <free+0x45>
+    c->next = classes[c->tag];
+    110a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    110d:	8b 40 04             	mov    0x4(%eax),%eax
+    1110:	8b 14 85 20 1e 00 00 	mov    0x1e20(,%eax,4),%edx
+    1117:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    111a:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[c->tag] = c;
+    111d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1120:	8b 40 04             	mov    0x4(%eax),%eax
+    1123:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1126:	89 14 85 20 1e 00 00 	mov    %edx,0x1e20(,%eax,4)
+    return;
+    112d:	eb 13                	jmp    1142 <free+0x58>
+  }
+  freechunk(c, 1);
+    112f:	83 ec 08             	sub    $0x8,%esp
+    1132:	6a 01                	push   $0x1
+    1134:	ff 75 f4             	push   -0xc(%ebp)
+    1137:	e8 65 fb ff ff       	call   ca1 <freechunk>
+    113c:	83 c4 10             	add    $0x10,%esp
+    113f:	eb 01                	jmp    1142 <free+0x58>
+    return;
+    1141:	90                   	nop
+}
+    1142:	c9                   	leave
+    1143:	c3                   	ret
+
+00001144 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1144:	55                   	push   %ebp
+    1145:	89 e5                	mov    %esp,%ebp
+    1147:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  int k;
+
+  if(nbytes > MAXSMALL)
+    114a:	81 7d 08 00 08 00 00 	cmpl   $0x800,0x8(%ebp)
+    1151:	76 10                	jbe    1163 <malloc+0x1f>
+    return largealloc(nbytes);
+    1153:	83 ec 0c             	sub    $0xc,%esp
+    1156:	ff 75 08             	push   0x8(%ebp)
+    1159:	e8 93 fd ff ff       	call   ef1 <largealloc>
+    115e:	83 c4 10             	add    $0x10,%esp
+    1161:	eb 6a                	jmp    11cd <malloc+0x89>
+  for(k = 0; (MINSMALL << k) < nbytes; k++)
+    1163:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    116a:	eb 04                	jmp    1170 <malloc+0x2c>
+    116c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1170:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1173:	ba 10 00 00 00       	mov    $0x10,%edx
+    1178:	89 c1                	mov    %eax,%ecx
+    117a:	d3 e2                	shl    %cl,%edx
+    117c:	89 d0                	mov    %edx,%eax
+    117e:	3b 45 08             	cmp    0x8(%ebp),%eax
+    1181:	72 e9                	jb     116c <malloc+0x28>
+    ;
+  if(classes[k] == 0 && refill(k) < 0)
+    1183:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1186:	8b 04 85 20 1e 00 00 	mov    0x1e20(,%eax,4),%eax
+    118d:	85 c0                	test   %eax,%eax
+    118f:	75 19                	jne    11aa <malloc+0x66>
+    1191:	83 ec 0c             	sub    $0xc,%esp
+    1194:	ff 75 f4             	push   -0xc(%ebp)
+    1197:	e8 b1 fe ff ff       	call   104d <refill>
+    119c:	83 c4 10             	add    $0x10,%esp
+    119f:	85 c0                	test   %eax,%eax
+    11a1:	79 07                	jns    11aa <malloc+0x66>
+    return 0;
+    11a3:	b8 00 00 00 00       	mov    $0x0,%eax
+    11a8:	eb 23                	jmp    11cd <malloc+0x89>
+  b = classes[k];
+    11aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11ad:	8b 04 85 20 1e 00 00 	mov    0x1e20(,%eax,4),%eax
+    11b4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  classes[k] = b->next;
+    11b7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    11ba:	8b 50 08             	mov    0x8(%eax),%edx
+    11bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11c0:	89 14 85 20 1e 00 00 	mov    %edx,0x1e20(,%eax,4)
+  return (char*)b + HDRSIZE;
+    11c7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    11ca:	83 c0 08             	add    $0x8,%eax
+}
+    11cd:	c9                   	leave
+    11ce:	c3                   	ret
+
+000011cf <stream>:
+
+// Return the stream for fd, deciding on first use how
+// its output is buffered.  Returns 0 if fd is not open.
+static struct stream*
+stream(int fd)
+{
+    11cf:	55                   	push   %ebp
+    11d0:	89 e5                	mov    %esp,%ebp
+    11d2:	83 ec 28             	sub    $0x28,%esp
+  struct stream *s;
+  struct stat st;
+
+  if(fd < 0 || fd >= NOFILE)
+    11d5:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    11d9:	78 06                	js     11e1 <stream+0x12>
+    11db:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    11df:	7e 07                	jle    11e8 <stream+0x19>
+    return 0;
+    11e1:	b8 00 00 00 00       	mov    $0x0,%eax
+    11e6:	eb 55                	jmp    123d <stream+0x6e>
+  s = &streams[fd];
+    11e8:	8b 45 08             	mov    0x8(%ebp),%eax
+    11eb:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    11f1:	05 c0 1e 00 00       	add    $0x1ec0,%eax
+    11f6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(s->mode == UNKNOWN){
+    11f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11fc:	8b 00                	mov    (%eax),%eax
+    11fe:	85 c0                	test   %eax,%eax
+    1200:	75 38                	jne    123a <stream+0x6b>
+    if(fstat(fd, &st) < 0)
+    1202:	83 ec 08             	sub    $0x8,%esp
+    1205:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1208:	50                   	push   %eax
+    1209:	ff 75 08             	push   0x8(%ebp)
+    120c:	e8 57 f6 ff ff       	call   868 <fstat>
+    1211:	83 c4 10             	add    $0x10,%esp
+    1214:	85 c0                	test   %eax,%eax
+    1216:	79 07                	jns    121f <stream+0x50>
+      return 0;
+    1218:	b8 00 00 00 00       	mov    $0x0,%eax
+    121d:	eb 1e                	jmp    123d <stream+0x6e>
+    s->mode = st.type == T_DEV ? LINEBUF : FULLBUF;
+    121f:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+    1223:	66 83 f8 03          	cmp    $0x3,%ax
+    1227:	75 07                	jne    1230 <stream+0x61>
+    1229:	ba 01 00 00 00       	mov    $0x1,%edx
+    122e:	eb 05                	jmp    1235 <stream+0x66>
+    1230:	ba 02 00 00 00       	mov    $0x2,%edx
+    1235:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1238:	89 10                	mov    %edx,(%eax)
+  }
+  return s;
+    123a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    123d:	c9                   	leave
+    123e:	c3                   	ret
+
+0000123f <fflush>:
+
+int
+fflush(int fd)
+{
+    123f:	55                   	push   %ebp
+    1240:	89 e5                	mov    %esp,%ebp
+    1242:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  int i, n;
+
+  if(fd < 0 || fd >= NOFILE)
+    1245:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1249:	78 06                	js     1251 <fflush+0x12>
+    124b:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    124f:	7e 07                	jle    1258 <fflush+0x19>
+    return -1;
+    1251:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1256:	eb 78                	jmp    12d0 <fflush+0x91>
+  s = &streams[fd];
+    1258:	8b 45 08             	mov    0x8(%ebp),%eax
+    125b:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1261:	05 c0 1e 00 00       	add    $0x1ec0,%eax
+    1266:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < s->nout; i += n){
+    1269:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1270:	eb 44                	jmp    12b6 <fflush+0x77>
+    if((n = write(fd, s->out + i, s->nout - i)) <= 0){
+    1272:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1275:	8b 40 04             	mov    0x4(%eax),%eax
+    1278:	2b 45 f4             	sub    -0xc(%ebp),%eax
+    127b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    127e:	8d 4a 10             	lea    0x10(%edx),%ecx
+    1281:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1284:	01 ca                	add    %ecx,%edx
+    1286:	83 ec 04             	sub    $0x4,%esp
+    1289:	50                   	push   %eax
+    128a:	52                   	push   %edx
+    128b:	ff 75 08             	push   0x8(%ebp)
+    128e:	e8 6c f5 ff ff       	call   7ff <write>
+    1293:	83 c4 10             	add    $0x10,%esp
+    1296:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1299:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    129d:	7f 11                	jg     12b0 <fflush+0x71>
+      s->nout = 0;
+    129f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    12a2:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+      return -1;
+    12a9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12ae:	eb 20                	jmp    12d0 <fflush+0x91>
+  for(i = 0; i < s->nout; i += n){
+    12b0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    12b3:	01 45 f4             	add    %eax,-0xc(%ebp)
+    12b6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    12b9:	8b 40 04             	mov    0x4(%eax),%eax
+    12bc:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    12bf:	7c b1                	jl     1272 <fflush+0x33>
+    }
+  }
+  s->nout = 0;
+    12c1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    12c4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  return 0;
+    12cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    12d0:	c9                   	leave
+    12d1:	c3                   	ret
+
+000012d2 <flushall>:
+
+// Flush every stream, or only line-buffered ones.
+static void
+flushall(int lineonly)
+{
+    12d2:	55                   	push   %ebp
+    12d3:	89 e5                	mov    %esp,%ebp
+    12d5:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+    12d8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    12df:	eb 41                	jmp    1322 <flushall+0x50>
+    if(streams[fd].nout > 0 && (!lineonly || streams[fd].mode == LINEBUF))
+    12e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12e4:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    12ea:	05 c4 1e 00 00       	add    $0x1ec4,%eax
+    12ef:	8b 00                	mov    (%eax),%eax
+    12f1:	85 c0                	test   %eax,%eax
+    12f3:	7e 29                	jle    131e <flushall+0x4c>
+    12f5:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    12f9:	74 15                	je     1310 <flushall+0x3e>
+    12fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12fe:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1304:	05 c0 1e 00 00       	add    $0x1ec0,%eax
+    1309:	8b 00                	mov    (%eax),%eax
+    130b:	83 f8 01             	cmp    $0x1,%eax
+    130e:	75 0e                	jne    131e <flushall+0x4c>
+      fflush(fd);
+    1310:	83 ec 0c             	sub    $0xc,%esp
+    1313:	ff 75 f4             	push   -0xc(%ebp)
+    1316:	e8 24 ff ff ff       	call   123f <fflush>
+    131b:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++)
+    131e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1322:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+    1326:	7e b9                	jle    12e1 <flushall+0xf>
+}
+    1328:	90                   	nop
+    1329:	90                   	nop
+    132a:	c9                   	leave
+    132b:	c3                   	ret
+
+0000132c <fputc>:
+
+int
+fputc(int fd, int c)
+{
+    132c:	55                   	push   %ebp
+    132d:	89 e5                	mov    %esp,%ebp
+    132f:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  char ch;
+
+  if((s = stream(fd)) == 0){
+    1332:	83 ec 0c             	sub    $0xc,%esp
+    1335:	ff 75 08             	push   0x8(%ebp)
+    1338:	e8 92 fe ff ff       	call   11cf <stream>
+    133d:	83 c4 10             	add    $0x10,%esp
+    1340:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1343:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1347:	75 2e                	jne    1377 <fputc+0x4b>
+    ch = c;
+    1349:	8b 45 0c             	mov    0xc(%ebp),%eax
+    134c:	88 45 f3             	mov    %al,-0xd(%ebp)
+    return write(fd, &ch, 1) == 1 ? (uchar)c : -1;
+    134f:	83 ec 04             	sub    $0x4,%esp
+    1352:	6a 01                	push   $0x1
+    1354:	8d 45 f3             	lea    -0xd(%ebp),%eax
+    1357:	50                   	push   %eax
+    1358:	ff 75 08             	push   0x8(%ebp)
+    135b:	e8 9f f4 ff ff       	call   7ff <write>
+    1360:	83 c4 10             	add    $0x10,%esp
+    1363:	83 f8 01             	cmp    $0x1,%eax
+    1366:	75 08                	jne    1370 <fputc+0x44>
+    1368:	8b 45 0c             	mov    0xc(%ebp),%eax
+    136b:	0f b6 c0             	movzbl %al,%eax
+    136e:	eb 5e                	jmp    13ce <fputc+0xa2>
+    1370:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1375:	eb 57                	jmp    13ce <fputc+0xa2>
+  }
+  s->out[s->nout++] = c;
+    1377:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    137a:	8b 40 04             	mov    0x4(%eax),%eax
+    137d:	8d 48 01             	lea    0x1(%eax),%ecx
+    1380:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1383:	89 4a 04             	mov    %ecx,0x4(%edx)
+    1386:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1389:	89 d1                	mov    %edx,%ecx
+    138b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    138e:	88 4c 02 10          	mov    %cl,0x10(%edx,%eax,1)
+  if(s->nout == BUFSZ || (s->mode == LINEBUF && c == '\n'))
+    1392:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1395:	8b 40 04             	mov    0x4(%eax),%eax
+    1398:	3d 00 02 00 00       	cmp    $0x200,%eax
+    139d:	74 10                	je     13af <fputc+0x83>
+    139f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13a2:	8b 00                	mov    (%eax),%eax
+    13a4:	83 f8 01             	cmp    $0x1,%eax
+    13a7:	75 1f                	jne    13c8 <fputc+0x9c>
+    13a9:	83 7d 0c 0a          	cmpl   $0xa,0xc(%ebp)
+    13ad:	75 19                	jne    13c8 <fputc+0x9c>
+    if(fflush(fd) < 0)
+    13af:	83 ec 0c             	sub    $0xc,%esp
+    13b2:	ff 75 08             	push   0x8(%ebp)
+    13b5:	e8 85 fe ff ff       	call   123f <fflush>
+    13ba:	83 c4 10             	add    $0x10,%esp
+    13bd:	85 c0                	test   %eax,%eax
+    13bf:	79 07                	jns    13c8 <fputc+0x9c>
+      return -1;
+    13c1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    13c6:	eb 06                	jmp    13ce <fputc+0xa2>
+  return (uchar)c;
+    13c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+    13cb:	0f b6 c0             	movzbl %al,%eax
+}
+    13ce:	c9                   	leave
+    13cf:	c3                   	ret
+
+000013d0 <fgetc>:
+
+// Return the next byte read from fd, or -1 at end of file.
+int
+fgetc(int fd)
+{
+    13d0:	55                   	push   %ebp
+    13d1:	89 e5                	mov    %esp,%ebp
+    13d3:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  uchar c;
+  int n;
+
+  if((s = stream(fd)) == 0){
+    13d6:	83 ec 0c             	sub    $0xc,%esp
+    13d9:	ff 75 08             	push   0x8(%ebp)
+    13dc:	e8 ee fd ff ff       	call   11cf <stream>
+    13e1:	83 c4 10             	add    $0x10,%esp
+    13e4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    13e7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    13eb:	75 39                	jne    1426 <fgetc+0x56>
+    flushall(1);
+    13ed:	83 ec 0c             	sub    $0xc,%esp
+    13f0:	6a 01                	push   $0x1
+    13f2:	e8 db fe ff ff       	call   12d2 <flushall>
+    13f7:	83 c4 10             	add    $0x10,%esp
+    return read(fd, &c, 1) == 1 ? c : -1;
+    13fa:	83 ec 04             	sub    $0x4,%esp
+    13fd:	6a 01                	push   $0x1
+    13ff:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    1402:	50                   	push   %eax
+    1403:	ff 75 08             	push   0x8(%ebp)
+    1406:	e8 e5 f3 ff ff       	call   7f0 <read>
+    140b:	83 c4 10             	add    $0x10,%esp
+    140e:	83 f8 01             	cmp    $0x1,%eax
+    1411:	75 0c                	jne    141f <fgetc+0x4f>
+    1413:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    1417:	0f b6 c0             	movzbl %al,%eax
+    141a:	e9 80 00 00 00       	jmp    149f <fgetc+0xcf>
+    141f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1424:	eb 79                	jmp    149f <fgetc+0xcf>
+  }
+  if(s->rpos == s->rend){
+    1426:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1429:	8b 50 08             	mov    0x8(%eax),%edx
+    142c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    142f:	8b 40 0c             	mov    0xc(%eax),%eax
+    1432:	39 c2                	cmp    %eax,%edx
+    1434:	75 4c                	jne    1482 <fgetc+0xb2>
+    flushall(1);
+    1436:	83 ec 0c             	sub    $0xc,%esp
+    1439:	6a 01                	push   $0x1
+    143b:	e8 92 fe ff ff       	call   12d2 <flushall>
+    1440:	83 c4 10             	add    $0x10,%esp
+    if((n = read(fd, s->in, BUFSZ)) <= 0)
+    1443:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1446:	05 10 02 00 00       	add    $0x210,%eax
+    144b:	83 ec 04             	sub    $0x4,%esp
+    144e:	68 00 02 00 00       	push   $0x200
+    1453:	50                   	push   %eax
+    1454:	ff 75 08             	push   0x8(%ebp)
+    1457:	e8 94 f3 ff ff       	call   7f0 <read>
+    145c:	83 c4 10             	add    $0x10,%esp
+    145f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1462:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1466:	7f 07                	jg     146f <fgetc+0x9f>
+      return -1;
+    1468:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    146d:	eb 30                	jmp    149f <fgetc+0xcf>
+    s->rpos = 0;
+    146f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1472:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+    s->rend = n;
+    1479:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    147c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    147f:	89 50 0c             	mov    %edx,0xc(%eax)
+  }
+  return (uchar)s->in[s->rpos++];
+    1482:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1485:	8b 40 08             	mov    0x8(%eax),%eax
+    1488:	8d 48 01             	lea    0x1(%eax),%ecx
+    148b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    148e:	89 4a 08             	mov    %ecx,0x8(%edx)
+    1491:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1494:	0f b6 84 02 10 02 00 	movzbl 0x210(%edx,%eax,1),%eax
+    149b:	00 
+    149c:	0f b6 c0             	movzbl %al,%eax
+}
+    149f:	c9                   	leave
+    14a0:	c3                   	ret
+
+000014a1 <fork>:
+
+int
+fork(void)
+{
+    14a1:	55                   	push   %ebp
+    14a2:	89 e5                	mov    %esp,%ebp
+    14a4:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    14a7:	83 ec 0c             	sub    $0xc,%esp
+    14aa:	6a 00                	push   $0x0
+    14ac:	e8 21 fe ff ff       	call   12d2 <flushall>
+    14b1:	83 c4 10             	add    $0x10,%esp
+  return _fork();
+    14b4:	e8 fb f2 ff ff       	call   7b4 <_fork>
+}
+    14b9:	c9                   	leave
+    14ba:	c3                   	ret
+
+000014bb <exec>:
+
+int
+exec(char *path, char **argv)
+{
+    14bb:	55                   	push   %ebp
+    14bc:	89 e5                	mov    %esp,%ebp
+    14be:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    14c1:	83 ec 0c             	sub    $0xc,%esp
+    14c4:	6a 00                	push   $0x0
+    14c6:	e8 07 fe ff ff       	call   12d2 <flushall>
+    14cb:	83 c4 10             	add    $0x10,%esp
+  return _exec(path, argv);
+    14ce:	83 ec 08             	sub    $0x8,%esp
+    14d1:	ff 75 0c             	push   0xc(%ebp)
+    14d4:	ff 75 08             	push   0x8(%ebp)
+    14d7:	e8 50 f3 ff ff       	call   82c <_exec>
+    14dc:	83 c4 10             	add    $0x10,%esp
+}
+    14df:	c9                   	leave
+    14e0:	c3                   	ret
+
+000014e1 <exit>:
+
+int
+exit(void)
+{
+    14e1:	55                   	push   %ebp
+    14e2:	89 e5                	mov    %esp,%ebp
+    14e4:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    14e7:	83 ec 0c             	sub    $0xc,%esp
+    14ea:	6a 00                	push   $0x0
+    14ec:	e8 e1 fd ff ff       	call   12d2 <flushall>
+    14f1:	83 c4 10             	add    $0x10,%esp
+  _exit();
+    14f4:	e8 ca f2 ff ff       	call   7c3 <_exit>
+
+000014f9 <close>:
+}
+
+int
+close(int fd)
+{
+    14f9:	55                   	push   %ebp
+    14fa:	89 e5                	mov    %esp,%ebp
+    14fc:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+
+  if(fd >= 0 && fd < NOFILE){
+    14ff:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1503:	78 44                	js     1549 <close+0x50>
+    1505:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    1509:	7f 3e                	jg     1549 <close+0x50>
+    fflush(fd);
+    150b:	83 ec 0c             	sub    $0xc,%esp
+    150e:	ff 75 08             	push   0x8(%ebp)
+    1511:	e8 29 fd ff ff       	call   123f <fflush>
+    1516:	83 c4 10             	add    $0x10,%esp
+    s = &streams[fd];
+    1519:	8b 45 08             	mov    0x8(%ebp),%eax
+    151c:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1522:	05 c0 1e 00 00       	add    $0x1ec0,%eax
+    1527:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    s->mode = UNKNOWN;
+    152a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    152d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    s->rpos = s->rend = 0;
+    1533:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1536:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    153d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1540:	8b 50 0c             	mov    0xc(%eax),%edx
+    1543:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1546:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  return _close(fd);
+    1549:	83 ec 0c             	sub    $0xc,%esp
+    154c:	ff 75 08             	push   0x8(%ebp)
+    154f:	e8 ba f2 ff ff       	call   80e <_close>
+    1554:	83 c4 10             	add    $0x10,%esp
+}
+    1557:	c9                   	leave
+    1558:	c3                   	ret
@@ -12,6 +12,30 @@
 #include "user.h"
 #include "fs.h"
 #include "fcntl.h"
+#include "ioring.h"
+
+struct ioring ring;
+
+// Queue n copies of op on fd with buffer data
+// and submit them with a single system call.
+void
+batch(int op, int fd, char *data, int size, int n)
+{
+  struct iosqe *e;
+  int i;
+
+  for(i = 0; i < n; i++){
+    e = &ring.sq[ring.sqtail++ % IORING_SIZE];
+    e->op = op;
+    e->fd = fd;
+    e->addr = (uint)data;
+    e->n = size;
+    e->data = i;
+  }
+  if(iosubmit(&ring) != n)
+    printf(1, "stressfs: iosubmit failed\n");
+  ring.cqhead = ring.cqtail;
+}
 
 int
 main(int argc, char *argv[])
@@ -31,16 +55,13 @@ main(int argc, char *argv[])
 
   path[8] += i;
   fd = open(path, O_CREATE | O_RDWR);
-  for(i = 0; i < 20; i++)
-//    printf(fd, "%d\n", i);
-    write(fd, data, sizeof(data));
+  batch(IO_WRITE, fd, data, sizeof(data), 20);
   close(fd);
 
   printf(1, "read\n");
 
   fd = open(path, O_RDONLY);
-  for (i = 0; i < 20; i++)
-    read(fd, data, sizeof(data));
+  batch(IO_READ, fd, data, sizeof(data), 20);
   close(fd);
 
   wait();
@@ -1,14 +1,30 @@
 #include "types.h"
 #include "x86.h"
 
+// The routines below work a word at a time where they can,
+// with the string instructions for bulk copies and fills.
+// A word x has a zero byte iff HASZERO(x) is nonzero.
+#define ONES        0x01010101
+#define HASZERO(x)  (((x) - ONES) & ~(x) & (ONES << 7))
+
 void*
 memset(void *dst, int c, uint n)
 {
-  if ((int)dst%4 == 0 && n%4 == 0){
-    c &= 0xFF;
-    stosl(dst, (c<<24)|(c<<16)|(c<<8)|c, n/4);
-  } else
-    stosb(dst, c, n);
+  char *d;
+  uint k;
+
+  d = dst;
+  c &= 0xFF;
+  if(n >= 16){
+    k = -(uint)d & 3;  // bytes up to a word boundary
+    stosb(d, c, k);
+    d += k;
+    n -= k;
+    stosl(d, c*ONES, n/4);
+    d += n & ~3;
+    n &= 3;
+  }
+  stosb(d, c, n);
   return dst;
 }
 
@@ -19,6 +35,8 @@ memcmp(const void *v1, const void *v2, uint n)
   
   s1 = v1;
   s2 = v2;
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+    s1 += 4, s2 += 4, n -= 4;
   while(n-- > 0){
     if(*s1 != *s2)
       return *s1 - *s2;
@@ -33,17 +51,36 @@ memmove(void *dst, const void *src, uint n)
 {
   const char *s;
   char *d;
+  uint k;
 
   s = src;
   d = dst;
   if(s < d && s + n > d){
     s += n;
     d += n;
+    while(n > 0 && ((uint)d & 3))
+      *--d = *--s, n--;
+    for(; n >= 4; n -= 4){
+      d -= 4;
+      s -= 4;
+      *(uint*)d = *(uint*)s;
+    }
     while(n-- > 0)
       *--d = *--s;
-  } else
-    while(n-- > 0)
-      *d++ = *s++;
+  } else {
+    if(n >= 16){
+      k = -(uint)d & 3;
+      movsb(d, s, k);
+      d += k;
+      s += k;
+      n -= k;
+      movsl(d, s, n/4);
+      d += n & ~3;
+      s += n & ~3;
+      n &= 3;
+    }
+    movsb(d, s, n);
+  }
 
   return dst;
 }
@@ -58,6 +95,11 @@ memcpy(void *dst, const void *src, uint n)
 int
 strncmp(const char *p, const char *q, uint n)
 {
+  // Aligned words never straddle a page, so reading
+  // whole ones past the end of a string is safe.
+  if((((uint)p | (uint)q) & 3) == 0)
+    while(n >= 4 && *(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+      n -= 4, p += 4, q += 4;
   while(n > 0 && *p && *p == *q)
     n--, p++, q++;
   if(n == 0)
@@ -98,7 +140,12 @@ strlen(const char *s)
 {
   int n;
 
-  for(n = 0; s[n]; n++)
+  for(n = 0; ((uint)(s+n) & 3) && s[n]; n++)
+    ;
+  if(s[n])
+    while(!HASZERO(*(uint*)(s+n)))
+      n += 4;
+  for(; s[n]; n++)
     ;
   return n;
 }
@@ -6,8 +6,9 @@
 #include "proc.h"
 #include "x86.h"
 #include "syscall.h"
+#include "sysstat.h"
 
-// User code makes a system call with INT T_SYSCALL.
+// User code makes a system call with sysenter or INT T_SYSCALL.
 // System call number in %eax.
 // Arguments on the stack, from the user call to the C
 // library system call function. The saved user %esp points
@@ -101,6 +102,14 @@ extern int sys_uptime(void);
 extern int sys_getproc(void);
 extern int sys_getpgs(void);
 extern int sys_loadproc(void);
+extern int sys_iosubmit(void);
+extern int sys_sysstat(void);
+extern int sys_splice(void);
+extern int sys_fsync(void);
+extern int sys_fdatasync(void);
+extern int sys_lseek(void);
+extern int sys_dmesg(void);
+extern int sys_lockstat(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -127,16 +136,90 @@ static int (*syscalls[])(void) = {
 [SYS_getproc] sys_getproc,
 [SYS_getpgs] sys_getpgs,
 [SYS_loadproc] sys_loadproc,
+[SYS_iosubmit] sys_iosubmit,
+[SYS_sysstat] sys_sysstat,
+[SYS_splice]  sys_splice,
+[SYS_fsync]   sys_fsync,
+[SYS_fdatasync] sys_fdatasync,
+[SYS_lseek]   sys_lseek,
+[SYS_dmesg]   sys_dmesg,
+[SYS_lockstat] sys_lockstat,
 };
 
+// Per-CPU system call counts and latencies.
+// Each CPU updates only its own entry, with interrupts
+// off, so no lock is needed; readers may see a slightly
+// stale sum.
+static struct sysstat sysstats[NCPU];
+
+// Record a call to num that took cycles TSC cycles.
+// A call that never returns (exit) is counted but not timed.
+static void
+sysaccount(int num, uint64 cycles, int done)
+{
+  struct sysstat *st;
+  int b;
+
+  pushcli();
+  st = &sysstats[cpu - cpus];
+  if(!done){
+    st->count[num]++;
+  } else {
+    st->cycles[num] += cycles;
+    cycles >>= SYSHIST0;
+    for(b = 0; b < NSYSHIST-1 && (cycles >>= 1) != 0; b++)
+      ;
+    st->hist[num][b]++;
+  }
+  popcli();
+}
+
+// Read the TSC and note which CPU it belongs to.
+static uint64
+systsc(int *c)
+{
+  uint64 t;
+
+  pushcli();
+  t = rdtsc();
+  *c = cpu - cpus;
+  popcli();
+  return t;
+}
+
+// Sum the statistics of all CPUs into *st.
+void
+getsysstat(struct sysstat *st)
+{
+  int c, i, b;
+
+  memset(st, 0, sizeof(*st));
+  for(c = 0; c < ncpu; c++){
+    for(i = 0; i < NSYSCALL; i++){
+      st->count[i] += sysstats[c].count[i];
+      st->cycles[i] += sysstats[c].cycles[i];
+      for(b = 0; b < NSYSHIST; b++)
+        st->hist[i][b] += sysstats[c].hist[i][b];
+    }
+  }
+}
+
 void
 syscall(void)
 {
-  int num;
+  int num, c0, c1;
+  uint64 t0, t1;
 
   num = proc->tf->eax;
   if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+    sysaccount(num, 0, 0);
+    t0 = systsc(&c0);
     proc->tf->eax = syscalls[num]();
+    t1 = systsc(&c1);
+    // A call that slept may have woken up on another CPU, whose
+    // TSC need not agree with this one's; don't time it.
+    if(c1 == c0 && t1 >= t0)
+      sysaccount(num, t1 - t0, 1);
   } else {
     cprintf("%d %s: unknown sys call %d\n",
             proc->pid, proc->name, num);
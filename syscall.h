@@ -22,4 +22,12 @@
 #define SYS_close  21
 #define SYS_getproc  22
 #define SYS_getpgs   23
-#define SYS_loadproc 24
\ No newline at end of file
+#define SYS_loadproc 24
+#define SYS_iosubmit 25
+#define SYS_sysstat  26
+#define SYS_splice   27
+#define SYS_fsync    28
+#define SYS_fdatasync 29
+#define SYS_lseek    30
+#define SYS_dmesg    31
+#define SYS_lockstat 32
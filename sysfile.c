@@ -10,9 +10,29 @@
 #include "stat.h"
 #include "mmu.h"
 #include "proc.h"
+#include "spinlock.h"
+#include "sleeplock.h"
 #include "fs.h"
 #include "file.h"
 #include "fcntl.h"
+#include "ioring.h"
+
+// Log blocks for an operation that adds a directory entry,
+// which may grow the directory's hash table.
+#define LINKBLOCKS (MAXOPBLOCKS + DIRGROWBLOCKS)
+
+// Return the struct file for file descriptor fd in *pf.
+static int
+fdfile(int fd, struct file **pf)
+{
+  struct file *f;
+
+  if(fd < 0 || fd >= NOFILE || (f=proc->ofile[fd]) == 0)
+    return -1;
+  if(pf)
+    *pf = f;
+  return 0;
+}
 
 // Fetch the nth word-sized system call argument as a file descriptor
 // and return both the descriptor and the corresponding struct file.
@@ -20,16 +40,13 @@ static int
 argfd(int n, int *pfd, struct file **pf)
 {
   int fd;
-  struct file *f;
 
   if(argint(n, &fd) < 0)
     return -1;
-  if(fd < 0 || fd >= NOFILE || (f=proc->ofile[fd]) == 0)
+  if(fdfile(fd, pf) < 0)
     return -1;
   if(pfd)
     *pfd = fd;
-  if(pf)
-    *pf = f;
   return 0;
 }
 
@@ -87,19 +104,85 @@ sys_write(void)
   return filewrite(f, p, n);
 }
 
-int
-sys_close(void)
+static int
+closefd(int fd)
 {
-  int fd;
   struct file *f;
-  
-  if(argfd(0, &fd, &f) < 0)
+
+  if(fdfile(fd, &f) < 0)
     return -1;
   proc->ofile[fd] = 0;
   fileclose(f);
   return 0;
 }
 
+// Move data between a pipe and a file without copying it
+// through user space.
+int
+sys_splice(void)
+{
+  struct file *in, *out;
+  int n;
+
+  if(argfd(0, 0, &in) < 0 || argfd(1, 0, &out) < 0 || argint(2, &n) < 0)
+    return -1;
+  return filesplice(in, out, n);
+}
+
+// Write back the file data of fd, then wait for the log:
+// all of it if all is set, otherwise only the transaction
+// that last changed the file's size or blocks.
+static int
+syncfd(int all)
+{
+  struct file *f;
+  struct inode *ip;
+  uint seq;
+
+  if(argfd(0, 0, &f) < 0)
+    return -1;
+  if(f->type != FD_INODE){
+    if(all)
+      log_sync();
+    return 0;
+  }
+  ip = f->ip;
+  bflush(ip->dev, ip->inum);
+  ilock(ip);
+  seq = ip->logseq;
+  iunlock(ip);
+  log_wait(all ? ~0 : seq);
+  // The log may have pinned some of the data until now.
+  bflush(ip->dev, ip->inum);
+  return 0;
+}
+
+// Wait until the file system operations done so far,
+// and the data written to fd, are on disk.
+int
+sys_fsync(void)
+{
+  return syncfd(1);
+}
+
+// Wait until the data written to fd, and what is needed
+// to read it back, are on disk.
+int
+sys_fdatasync(void)
+{
+  return syncfd(0);
+}
+
+int
+sys_close(void)
+{
+  int fd;
+  
+  if(argint(0, &fd) < 0)
+    return -1;
+  return closefd(fd);
+}
+
 int
 sys_fstat(void)
 {
@@ -111,6 +194,17 @@ sys_fstat(void)
   return filestat(f, st);
 }
 
+int
+sys_lseek(void)
+{
+  struct file *f;
+  int off, whence;
+
+  if(argfd(0, 0, &f) < 0 || argint(1, &off) < 0 || argint(2, &whence) < 0)
+    return -1;
+  return fileseek(f, off, whence);
+}
+
 // Create the path new as a link to the same inode as old.
 int
 sys_link(void)
@@ -121,7 +215,7 @@ sys_link(void)
   if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
     return -1;
 
-  begin_op();
+  begin_opn(LINKBLOCKS);
   if((ip = namei(old)) == 0){
     end_op();
     return -1;
@@ -162,16 +256,17 @@ bad:
 }
 
 // Is the directory dp empty except for "." and ".." ?
+// In a hashed directory they need not be the first two entries.
 static int
 isdirempty(struct inode *dp)
 {
   int off;
   struct dirent de;
 
-  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+  for(off=0; off<dp->size; off+=sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
       panic("isdirempty: readi");
-    if(de.inum != 0)
+    if(de.inum != 0 && namecmp(de.name, ".") != 0 && namecmp(de.name, "..") != 0)
       return 0;
   }
   return 1;
@@ -215,6 +310,7 @@ sys_unlink(void)
   memset(&de, 0, sizeof(de));
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
     panic("unlink: writei");
+  dcacheforget(dp, name);
   if(ip->type == T_DIR){
     dp->nlink--;
     iupdate(dp);
@@ -280,18 +376,14 @@ create(char *path, short type, short major, short minor)
   return ip;
 }
 
-int
-sys_open(void)
+static int
+openfd(char *path, int omode)
 {
-  char *path;
-  int fd, omode;
+  int fd;
   struct file *f;
   struct inode *ip;
 
-  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
-    return -1;
-
-  begin_op();
+  begin_opn(omode & O_CREATE ? LINKBLOCKS : MAXOPBLOCKS);
 
   if(omode & O_CREATE){
     ip = create(path, T_FILE, 0, 0);
@@ -330,13 +422,24 @@ sys_open(void)
   return fd;
 }
 
+int
+sys_open(void)
+{
+  char *path;
+  int omode;
+
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+    return -1;
+  return openfd(path, omode);
+}
+
 int
 sys_mkdir(void)
 {
   char *path;
   struct inode *ip;
 
-  begin_op();
+  begin_opn(LINKBLOCKS);
   if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
     end_op();
     return -1;
@@ -354,7 +457,7 @@ sys_mknod(void)
   int len;
   int major, minor;
   
-  begin_op();
+  begin_opn(LINKBLOCKS);
   if((len=argstr(0, &path)) < 0 ||
      argint(1, &major) < 0 ||
      argint(2, &minor) < 0 ||
@@ -440,3 +543,57 @@ sys_pipe(void)
   fd[1] = fd1;
   return 0;
 }
+
+// Carry out one ring submission, as the equivalent
+// system call would, checking its arguments the same way.
+static int
+iorun(struct iosqe *e)
+{
+  struct file *f;
+  char *path;
+
+  switch(e->op){
+  case IO_READ:
+  case IO_WRITE:
+    if(fdfile(e->fd, &f) < 0 || e->n < 0)
+      return -1;
+    if(e->addr >= proc->sz || e->addr+e->n > proc->sz)
+      return -1;
+    if(e->op == IO_READ)
+      return fileread(f, (char*)e->addr, e->n);
+    return filewrite(f, (char*)e->addr, e->n);
+  case IO_OPEN:
+    if(fetchstr(e->addr, &path) < 0)
+      return -1;
+    return openfd(path, e->n);
+  case IO_CLOSE:
+    return closefd(e->fd);
+  }
+  return -1;
+}
+
+// Run the pending submissions of the ring in user memory,
+// posting a completion for each.  Stops early if the
+// completion queue fills.  Returns the number consumed.
+int
+sys_iosubmit(void)
+{
+  struct ioring *r;
+  struct iosqe e;
+  struct iocqe *c;
+  int n;
+
+  if(argptr(0, (void*)&r, sizeof(*r)) < 0)
+    return -1;
+  for(n = 0; r->sqhead != r->sqtail; n++){
+    if(r->cqtail - r->cqhead >= IORING_SIZE || proc->killed)
+      break;
+    e = r->sq[r->sqhead % IORING_SIZE];
+    c = &r->cq[r->cqtail % IORING_SIZE];
+    c->data = e.data;
+    c->res = iorun(&e);
+    r->sqhead++;
+    r->cqtail++;
+  }
+  return n;
+}
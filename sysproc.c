@@ -6,6 +6,8 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "sysstat.h"
+#include "lockstat.h"
 
 int
 sys_fork(void)
@@ -125,4 +127,42 @@ int sys_loadproc(void)
   }
 
   return loadproc(p, pgs);
-}
\ No newline at end of file
+}
+
+// Copy the system call statistics to user memory.
+int
+sys_sysstat(void)
+{
+  struct sysstat *st;
+
+  if(argptr(0, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  getsysstat(st);
+  return 0;
+}
+
+int
+sys_dmesg(void)
+{
+  char *buf;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0 || argptr(0, &buf, n) < 0)
+    return -1;
+  return klogread(buf, n);
+}
+
+int
+sys_lockstat(void)
+{
+  struct lockstat *st;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0)
+    return -1;
+  if(n > NLOCKSTAT)
+    n = NLOCKSTAT;
+  if(argptr(0, (void*)&st, n*sizeof(*st)) < 0)
+    return -1;
+  return getlockstat(st, n);
+}
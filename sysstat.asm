@@ -0,0 +1,2779 @@
+
+_sysstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <average>:
+struct sysstat st;
+
+// Average of total over n, without 64-bit division.
+uint
+average(uint64 total, uint n)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 18             	sub    $0x18,%esp
+       6:	8b 45 08             	mov    0x8(%ebp),%eax
+       9:	89 45 e8             	mov    %eax,-0x18(%ebp)
+       c:	8b 45 0c             	mov    0xc(%ebp),%eax
+       f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  int shift;
+
+  for(shift = 0; total >> 32; shift++)
+      12:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+      19:	eb 16                	jmp    31 <average+0x31>
+    total >>= 1;
+      1b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      1e:	8b 55 ec             	mov    -0x14(%ebp),%edx
+      21:	0f ac d0 01          	shrd   $0x1,%edx,%eax
+      25:	d1 ea                	shr    %edx
+      27:	89 45 e8             	mov    %eax,-0x18(%ebp)
+      2a:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  for(shift = 0; total >> 32; shift++)
+      2d:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+      31:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      34:	8b 55 ec             	mov    -0x14(%ebp),%edx
+      37:	89 d0                	mov    %edx,%eax
+      39:	31 d2                	xor    %edx,%edx
+      3b:	09 d0                	or     %edx,%eax
+      3d:	85 c0                	test   %eax,%eax
+      3f:	75 da                	jne    1b <average+0x1b>
+  return ((uint)total / n) << shift;
+      41:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      44:	ba 00 00 00 00       	mov    $0x0,%edx
+      49:	f7 75 10             	divl   0x10(%ebp)
+      4c:	89 c2                	mov    %eax,%edx
+      4e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+      51:	89 c1                	mov    %eax,%ecx
+      53:	d3 e2                	shl    %cl,%edx
+      55:	89 d0                	mov    %edx,%eax
+}
+      57:	c9                   	leave
+      58:	c3                   	ret
+
+00000059 <main>:
+
+int
+main(int argc, char *argv[])
+{
+      59:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+      5d:	83 e4 f0             	and    $0xfffffff0,%esp
+      60:	ff 71 fc             	push   -0x4(%ecx)
+      63:	55                   	push   %ebp
+      64:	89 e5                	mov    %esp,%ebp
+      66:	51                   	push   %ecx
+      67:	83 ec 14             	sub    $0x14,%esp
+      6a:	89 c8                	mov    %ecx,%eax
+  int i, b, hflag;
+  uint timed;
+
+  hflag = argc > 1 && strcmp(argv[1], "-h") == 0;
+      6c:	83 38 01             	cmpl   $0x1,(%eax)
+      6f:	7e 24                	jle    95 <main+0x3c>
+      71:	8b 40 04             	mov    0x4(%eax),%eax
+      74:	83 c0 04             	add    $0x4,%eax
+      77:	8b 00                	mov    (%eax),%eax
+      79:	83 ec 08             	sub    $0x8,%esp
+      7c:	68 92 16 00 00       	push   $0x1692
+      81:	50                   	push   %eax
+      82:	e8 99 02 00 00       	call   320 <strcmp>
+      87:	83 c4 10             	add    $0x10,%esp
+      8a:	85 c0                	test   %eax,%eax
+      8c:	75 07                	jne    95 <main+0x3c>
+      8e:	b8 01 00 00 00       	mov    $0x1,%eax
+      93:	eb 05                	jmp    9a <main+0x41>
+      95:	b8 00 00 00 00       	mov    $0x0,%eax
+      9a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(sysstat(&st) < 0){
+      9d:	83 ec 0c             	sub    $0xc,%esp
+      a0:	68 60 1c 00 00       	push   $0x1c60
+      a5:	e8 f0 08 00 00       	call   99a <sysstat>
+      aa:	83 c4 10             	add    $0x10,%esp
+      ad:	85 c0                	test   %eax,%eax
+      af:	79 17                	jns    c8 <main+0x6f>
+    printf(2, "sysstat: failed\n");
+      b1:	83 ec 08             	sub    $0x8,%esp
+      b4:	68 95 16 00 00       	push   $0x1695
+      b9:	6a 02                	push   $0x2
+      bb:	e8 f4 09 00 00       	call   ab4 <printf>
+      c0:	83 c4 10             	add    $0x10,%esp
+    exit();
+      c3:	e8 88 14 00 00       	call   1550 <exit>
+  }
+
+  printf(1, "call count avg-cycles\n");
+      c8:	83 ec 08             	sub    $0x8,%esp
+      cb:	68 a6 16 00 00       	push   $0x16a6
+      d0:	6a 01                	push   $0x1
+      d2:	e8 dd 09 00 00       	call   ab4 <printf>
+      d7:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NSYSCALL; i++){
+      da:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+      e1:	e9 51 01 00 00       	jmp    237 <main+0x1de>
+    if(st.count[i] == 0)
+      e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      e9:	8b 04 85 60 1c 00 00 	mov    0x1c60(,%eax,4),%eax
+      f0:	85 c0                	test   %eax,%eax
+      f2:	0f 84 37 01 00 00    	je     22f <main+0x1d6>
+      continue;
+    timed = 0;
+      f8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    for(b = 0; b < NSYSHIST; b++)
+      ff:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     106:	eb 1e                	jmp    126 <main+0xcd>
+      timed += st.hist[i][b];
+     108:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     10b:	c1 e0 04             	shl    $0x4,%eax
+     10e:	89 c2                	mov    %eax,%edx
+     110:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     113:	01 d0                	add    %edx,%eax
+     115:	83 c0 78             	add    $0x78,%eax
+     118:	8b 04 85 60 1c 00 00 	mov    0x1c60(,%eax,4),%eax
+     11f:	01 45 ec             	add    %eax,-0x14(%ebp)
+    for(b = 0; b < NSYSHIST; b++)
+     122:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     126:	83 7d f0 0f          	cmpl   $0xf,-0x10(%ebp)
+     12a:	7e dc                	jle    108 <main+0xaf>
+    printf(1, "%s %d %d\n", i < NELEM(names) && names[i] ? names[i] : "?",
+     12c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     130:	74 26                	je     158 <main+0xff>
+           st.count[i], timed ? average(st.cycles[i], timed) : 0);
+     132:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     135:	83 c0 14             	add    $0x14,%eax
+     138:	8b 14 c5 64 1c 00 00 	mov    0x1c64(,%eax,8),%edx
+     13f:	8b 04 c5 60 1c 00 00 	mov    0x1c60(,%eax,8),%eax
+     146:	83 ec 04             	sub    $0x4,%esp
+     149:	ff 75 ec             	push   -0x14(%ebp)
+     14c:	52                   	push   %edx
+     14d:	50                   	push   %eax
+     14e:	e8 ad fe ff ff       	call   0 <average>
+     153:	83 c4 10             	add    $0x10,%esp
+     156:	eb 05                	jmp    15d <main+0x104>
+    printf(1, "%s %d %d\n", i < NELEM(names) && names[i] ? names[i] : "?",
+     158:	b8 00 00 00 00       	mov    $0x0,%eax
+     15d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     160:	8b 0c 95 60 1c 00 00 	mov    0x1c60(,%edx,4),%ecx
+     167:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     16a:	83 fa 20             	cmp    $0x20,%edx
+     16d:	77 1a                	ja     189 <main+0x130>
+     16f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     172:	8b 14 95 c0 1b 00 00 	mov    0x1bc0(,%edx,4),%edx
+     179:	85 d2                	test   %edx,%edx
+     17b:	74 0c                	je     189 <main+0x130>
+     17d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     180:	8b 14 95 c0 1b 00 00 	mov    0x1bc0(,%edx,4),%edx
+     187:	eb 05                	jmp    18e <main+0x135>
+     189:	ba bd 16 00 00       	mov    $0x16bd,%edx
+     18e:	83 ec 0c             	sub    $0xc,%esp
+     191:	50                   	push   %eax
+     192:	51                   	push   %ecx
+     193:	52                   	push   %edx
+     194:	68 bf 16 00 00       	push   $0x16bf
+     199:	6a 01                	push   $0x1
+     19b:	e8 14 09 00 00       	call   ab4 <printf>
+     1a0:	83 c4 20             	add    $0x20,%esp
+    if(!hflag)
+     1a3:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     1a7:	0f 84 85 00 00 00    	je     232 <main+0x1d9>
+      continue;
+    for(b = 0; b < NSYSHIST; b++)
+     1ad:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     1b4:	eb 71                	jmp    227 <main+0x1ce>
+      if(st.hist[i][b])
+     1b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     1b9:	c1 e0 04             	shl    $0x4,%eax
+     1bc:	89 c2                	mov    %eax,%edx
+     1be:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     1c1:	01 d0                	add    %edx,%eax
+     1c3:	83 c0 78             	add    $0x78,%eax
+     1c6:	8b 04 85 60 1c 00 00 	mov    0x1c60(,%eax,4),%eax
+     1cd:	85 c0                	test   %eax,%eax
+     1cf:	74 52                	je     223 <main+0x1ca>
+        printf(1, "  %s2^%d: %d\n", b == NSYSHIST-1 ? ">=" : "<",
+     1d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     1d4:	c1 e0 04             	shl    $0x4,%eax
+     1d7:	89 c2                	mov    %eax,%edx
+     1d9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     1dc:	01 d0                	add    %edx,%eax
+     1de:	83 c0 78             	add    $0x78,%eax
+     1e1:	8b 14 85 60 1c 00 00 	mov    0x1c60(,%eax,4),%edx
+     1e8:	83 7d f0 0f          	cmpl   $0xf,-0x10(%ebp)
+     1ec:	75 08                	jne    1f6 <main+0x19d>
+     1ee:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     1f1:	83 c0 08             	add    $0x8,%eax
+     1f4:	eb 06                	jmp    1fc <main+0x1a3>
+     1f6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     1f9:	83 c0 09             	add    $0x9,%eax
+     1fc:	83 7d f0 0f          	cmpl   $0xf,-0x10(%ebp)
+     200:	75 07                	jne    209 <main+0x1b0>
+     202:	b9 c9 16 00 00       	mov    $0x16c9,%ecx
+     207:	eb 05                	jmp    20e <main+0x1b5>
+     209:	b9 cc 16 00 00       	mov    $0x16cc,%ecx
+     20e:	83 ec 0c             	sub    $0xc,%esp
+     211:	52                   	push   %edx
+     212:	50                   	push   %eax
+     213:	51                   	push   %ecx
+     214:	68 ce 16 00 00       	push   $0x16ce
+     219:	6a 01                	push   $0x1
+     21b:	e8 94 08 00 00       	call   ab4 <printf>
+     220:	83 c4 20             	add    $0x20,%esp
+    for(b = 0; b < NSYSHIST; b++)
+     223:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     227:	83 7d f0 0f          	cmpl   $0xf,-0x10(%ebp)
+     22b:	7e 89                	jle    1b6 <main+0x15d>
+     22d:	eb 04                	jmp    233 <main+0x1da>
+      continue;
+     22f:	90                   	nop
+     230:	eb 01                	jmp    233 <main+0x1da>
+      continue;
+     232:	90                   	nop
+  for(i = 0; i < NSYSCALL; i++){
+     233:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     237:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+     23b:	0f 8e a5 fe ff ff    	jle    e6 <main+0x8d>
+               b == NSYSHIST-1 ? SYSHIST0+b : SYSHIST0+b+1, st.hist[i][b]);
+  }
+  exit();
+     241:	e8 0a 13 00 00       	call   1550 <exit>
+
+00000246 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+     246:	55                   	push   %ebp
+     247:	89 e5                	mov    %esp,%ebp
+     249:	57                   	push   %edi
+     24a:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+     24b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     24e:	8b 55 10             	mov    0x10(%ebp),%edx
+     251:	8b 45 0c             	mov    0xc(%ebp),%eax
+     254:	89 cb                	mov    %ecx,%ebx
+     256:	89 df                	mov    %ebx,%edi
+     258:	89 d1                	mov    %edx,%ecx
+     25a:	fc                   	cld
+     25b:	f3 aa                	rep stos %al,%es:(%edi)
+     25d:	89 ca                	mov    %ecx,%edx
+     25f:	89 fb                	mov    %edi,%ebx
+     261:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     264:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     267:	90                   	nop
+     268:	5b                   	pop    %ebx
+     269:	5f                   	pop    %edi
+     26a:	5d                   	pop    %ebp
+     26b:	c3                   	ret
+
+0000026c <stosl>:
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+     26c:	55                   	push   %ebp
+     26d:	89 e5                	mov    %esp,%ebp
+     26f:	57                   	push   %edi
+     270:	53                   	push   %ebx
+  asm volatile("cld; rep stosl" :
+     271:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     274:	8b 55 10             	mov    0x10(%ebp),%edx
+     277:	8b 45 0c             	mov    0xc(%ebp),%eax
+     27a:	89 cb                	mov    %ecx,%ebx
+     27c:	89 df                	mov    %ebx,%edi
+     27e:	89 d1                	mov    %edx,%ecx
+     280:	fc                   	cld
+     281:	f3 ab                	rep stos %eax,%es:(%edi)
+     283:	89 ca                	mov    %ecx,%edx
+     285:	89 fb                	mov    %edi,%ebx
+     287:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     28a:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     28d:	90                   	nop
+     28e:	5b                   	pop    %ebx
+     28f:	5f                   	pop    %edi
+     290:	5d                   	pop    %ebp
+     291:	c3                   	ret
+
+00000292 <movsb>:
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+     292:	55                   	push   %ebp
+     293:	89 e5                	mov    %esp,%ebp
+     295:	57                   	push   %edi
+     296:	56                   	push   %esi
+     297:	53                   	push   %ebx
+  asm volatile("cld; rep movsb" :
+     298:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     29b:	8b 55 0c             	mov    0xc(%ebp),%edx
+     29e:	8b 45 10             	mov    0x10(%ebp),%eax
+     2a1:	89 cb                	mov    %ecx,%ebx
+     2a3:	89 df                	mov    %ebx,%edi
+     2a5:	89 d6                	mov    %edx,%esi
+     2a7:	89 c1                	mov    %eax,%ecx
+     2a9:	fc                   	cld
+     2aa:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     2ac:	89 c8                	mov    %ecx,%eax
+     2ae:	89 f2                	mov    %esi,%edx
+     2b0:	89 fb                	mov    %edi,%ebx
+     2b2:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     2b5:	89 55 0c             	mov    %edx,0xc(%ebp)
+     2b8:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     2bb:	90                   	nop
+     2bc:	5b                   	pop    %ebx
+     2bd:	5e                   	pop    %esi
+     2be:	5f                   	pop    %edi
+     2bf:	5d                   	pop    %ebp
+     2c0:	c3                   	ret
+
+000002c1 <movsl>:
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+     2c1:	55                   	push   %ebp
+     2c2:	89 e5                	mov    %esp,%ebp
+     2c4:	57                   	push   %edi
+     2c5:	56                   	push   %esi
+     2c6:	53                   	push   %ebx
+  asm volatile("cld; rep movsl" :
+     2c7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     2ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+     2cd:	8b 45 10             	mov    0x10(%ebp),%eax
+     2d0:	89 cb                	mov    %ecx,%ebx
+     2d2:	89 df                	mov    %ebx,%edi
+     2d4:	89 d6                	mov    %edx,%esi
+     2d6:	89 c1                	mov    %eax,%ecx
+     2d8:	fc                   	cld
+     2d9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     2db:	89 c8                	mov    %ecx,%eax
+     2dd:	89 f2                	mov    %esi,%edx
+     2df:	89 fb                	mov    %edi,%ebx
+     2e1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     2e4:	89 55 0c             	mov    %edx,0xc(%ebp)
+     2e7:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     2ea:	90                   	nop
+     2eb:	5b                   	pop    %ebx
+     2ec:	5e                   	pop    %esi
+     2ed:	5f                   	pop    %edi
+     2ee:	5d                   	pop    %ebp
+     2ef:	c3                   	ret
+
+000002f0 <strcpy>:
+#define ONES        0x01010101
+#define HASZERO(x)  (((x) - ONES) & ~(x) & (ONES << 7))
+
+char*
+strcpy(char *s, char *t)
+{
+     2f0:	55                   	push   %ebp
+     2f1:	89 e5                	mov    %esp,%ebp
+     2f3:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+     2f6:	8b 45 08             	mov    0x8(%ebp),%eax
+     2f9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     2fc:	90                   	nop
+     2fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+     300:	8d 42 01             	lea    0x1(%edx),%eax
+     303:	89 45 0c             	mov    %eax,0xc(%ebp)
+     306:	8b 45 08             	mov    0x8(%ebp),%eax
+     309:	8d 48 01             	lea    0x1(%eax),%ecx
+     30c:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     30f:	0f b6 12             	movzbl (%edx),%edx
+     312:	88 10                	mov    %dl,(%eax)
+     314:	0f b6 00             	movzbl (%eax),%eax
+     317:	84 c0                	test   %al,%al
+     319:	75 e2                	jne    2fd <strcpy+0xd>
+    ;
+  return os;
+     31b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     31e:	c9                   	leave
+     31f:	c3                   	ret
+
+00000320 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     320:	55                   	push   %ebp
+     321:	89 e5                	mov    %esp,%ebp
+  // Aligned words never straddle a page, so reading
+  // whole ones past the end of a string is safe.
+  if((((uint)p | (uint)q) & 3) == 0)
+     323:	8b 55 08             	mov    0x8(%ebp),%edx
+     326:	8b 45 0c             	mov    0xc(%ebp),%eax
+     329:	09 d0                	or     %edx,%eax
+     32b:	83 e0 03             	and    $0x3,%eax
+     32e:	85 c0                	test   %eax,%eax
+     330:	75 3f                	jne    371 <strcmp+0x51>
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     332:	eb 08                	jmp    33c <strcmp+0x1c>
+      p += 4, q += 4;
+     334:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     338:	83 45 0c 04          	addl   $0x4,0xc(%ebp)
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     33c:	8b 45 08             	mov    0x8(%ebp),%eax
+     33f:	8b 10                	mov    (%eax),%edx
+     341:	8b 45 0c             	mov    0xc(%ebp),%eax
+     344:	8b 00                	mov    (%eax),%eax
+     346:	39 c2                	cmp    %eax,%edx
+     348:	75 27                	jne    371 <strcmp+0x51>
+     34a:	8b 45 08             	mov    0x8(%ebp),%eax
+     34d:	8b 00                	mov    (%eax),%eax
+     34f:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     355:	8b 45 08             	mov    0x8(%ebp),%eax
+     358:	8b 00                	mov    (%eax),%eax
+     35a:	f7 d0                	not    %eax
+     35c:	21 d0                	and    %edx,%eax
+     35e:	25 80 80 80 80       	and    $0x80808080,%eax
+     363:	85 c0                	test   %eax,%eax
+     365:	74 cd                	je     334 <strcmp+0x14>
+  while(*p && *p == *q)
+     367:	eb 08                	jmp    371 <strcmp+0x51>
+    p++, q++;
+     369:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     36d:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     371:	8b 45 08             	mov    0x8(%ebp),%eax
+     374:	0f b6 00             	movzbl (%eax),%eax
+     377:	84 c0                	test   %al,%al
+     379:	74 10                	je     38b <strcmp+0x6b>
+     37b:	8b 45 08             	mov    0x8(%ebp),%eax
+     37e:	0f b6 10             	movzbl (%eax),%edx
+     381:	8b 45 0c             	mov    0xc(%ebp),%eax
+     384:	0f b6 00             	movzbl (%eax),%eax
+     387:	38 c2                	cmp    %al,%dl
+     389:	74 de                	je     369 <strcmp+0x49>
+  return (uchar)*p - (uchar)*q;
+     38b:	8b 45 08             	mov    0x8(%ebp),%eax
+     38e:	0f b6 00             	movzbl (%eax),%eax
+     391:	0f b6 d0             	movzbl %al,%edx
+     394:	8b 45 0c             	mov    0xc(%ebp),%eax
+     397:	0f b6 00             	movzbl (%eax),%eax
+     39a:	0f b6 c0             	movzbl %al,%eax
+     39d:	29 c2                	sub    %eax,%edx
+     39f:	89 d0                	mov    %edx,%eax
+}
+     3a1:	5d                   	pop    %ebp
+     3a2:	c3                   	ret
+
+000003a3 <strlen>:
+
+uint
+strlen(char *s)
+{
+     3a3:	55                   	push   %ebp
+     3a4:	89 e5                	mov    %esp,%ebp
+     3a6:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; ((uint)(s+n) & 3) && s[n]; n++)
+     3a9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     3b0:	eb 04                	jmp    3b6 <strlen+0x13>
+     3b2:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     3b6:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     3b9:	8b 45 08             	mov    0x8(%ebp),%eax
+     3bc:	01 d0                	add    %edx,%eax
+     3be:	83 e0 03             	and    $0x3,%eax
+     3c1:	85 c0                	test   %eax,%eax
+     3c3:	74 0f                	je     3d4 <strlen+0x31>
+     3c5:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     3c8:	8b 45 08             	mov    0x8(%ebp),%eax
+     3cb:	01 d0                	add    %edx,%eax
+     3cd:	0f b6 00             	movzbl (%eax),%eax
+     3d0:	84 c0                	test   %al,%al
+     3d2:	75 de                	jne    3b2 <strlen+0xf>
+    ;
+  if(s[n])
+     3d4:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     3d7:	8b 45 08             	mov    0x8(%ebp),%eax
+     3da:	01 d0                	add    %edx,%eax
+     3dc:	0f b6 00             	movzbl (%eax),%eax
+     3df:	84 c0                	test   %al,%al
+     3e1:	74 33                	je     416 <strlen+0x73>
+    while(!HASZERO(*(uint*)(s+n)))
+     3e3:	eb 04                	jmp    3e9 <strlen+0x46>
+      n += 4;
+     3e5:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+    while(!HASZERO(*(uint*)(s+n)))
+     3e9:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     3ec:	8b 45 08             	mov    0x8(%ebp),%eax
+     3ef:	01 d0                	add    %edx,%eax
+     3f1:	8b 00                	mov    (%eax),%eax
+     3f3:	8d 88 ff fe fe fe    	lea    -0x1010101(%eax),%ecx
+     3f9:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     3fc:	8b 45 08             	mov    0x8(%ebp),%eax
+     3ff:	01 d0                	add    %edx,%eax
+     401:	8b 00                	mov    (%eax),%eax
+     403:	f7 d0                	not    %eax
+     405:	21 c8                	and    %ecx,%eax
+     407:	25 80 80 80 80       	and    $0x80808080,%eax
+     40c:	85 c0                	test   %eax,%eax
+     40e:	74 d5                	je     3e5 <strlen+0x42>
+  for(; s[n]; n++)
+     410:	eb 04                	jmp    416 <strlen+0x73>
+     412:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     416:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     419:	8b 45 08             	mov    0x8(%ebp),%eax
+     41c:	01 d0                	add    %edx,%eax
+     41e:	0f b6 00             	movzbl (%eax),%eax
+     421:	84 c0                	test   %al,%al
+     423:	75 ed                	jne    412 <strlen+0x6f>
+    ;
+  return n;
+     425:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     428:	c9                   	leave
+     429:	c3                   	ret
+
+0000042a <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     42a:	55                   	push   %ebp
+     42b:	89 e5                	mov    %esp,%ebp
+     42d:	83 ec 10             	sub    $0x10,%esp
+  char *d;
+  uint k;
+
+  d = dst;
+     430:	8b 45 08             	mov    0x8(%ebp),%eax
+     433:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c &= 0xFF;
+     436:	81 65 0c ff 00 00 00 	andl   $0xff,0xc(%ebp)
+  if(n >= 16){
+     43d:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     441:	76 54                	jbe    497 <memset+0x6d>
+    k = -(uint)d & 3;  // bytes up to a word boundary
+     443:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     446:	f7 d8                	neg    %eax
+     448:	83 e0 03             	and    $0x3,%eax
+     44b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    stosb(d, c, k);
+     44e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     451:	50                   	push   %eax
+     452:	ff 75 0c             	push   0xc(%ebp)
+     455:	ff 75 fc             	push   -0x4(%ebp)
+     458:	e8 e9 fd ff ff       	call   246 <stosb>
+     45d:	83 c4 0c             	add    $0xc,%esp
+    d += k;
+     460:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     463:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n -= k;
+     466:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     469:	29 45 10             	sub    %eax,0x10(%ebp)
+    stosl(d, c*ONES, n/4);
+     46c:	8b 45 10             	mov    0x10(%ebp),%eax
+     46f:	c1 e8 02             	shr    $0x2,%eax
+     472:	89 c2                	mov    %eax,%edx
+     474:	8b 45 0c             	mov    0xc(%ebp),%eax
+     477:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     47d:	52                   	push   %edx
+     47e:	50                   	push   %eax
+     47f:	ff 75 fc             	push   -0x4(%ebp)
+     482:	e8 e5 fd ff ff       	call   26c <stosl>
+     487:	83 c4 0c             	add    $0xc,%esp
+    d += n & ~3;
+     48a:	8b 45 10             	mov    0x10(%ebp),%eax
+     48d:	83 e0 fc             	and    $0xfffffffc,%eax
+     490:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n &= 3;
+     493:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+  }
+  stosb(d, c, n);
+     497:	8b 45 10             	mov    0x10(%ebp),%eax
+     49a:	50                   	push   %eax
+     49b:	ff 75 0c             	push   0xc(%ebp)
+     49e:	ff 75 fc             	push   -0x4(%ebp)
+     4a1:	e8 a0 fd ff ff       	call   246 <stosb>
+     4a6:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     4a9:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     4ac:	c9                   	leave
+     4ad:	c3                   	ret
+
+000004ae <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     4ae:	55                   	push   %ebp
+     4af:	89 e5                	mov    %esp,%ebp
+     4b1:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s1, *s2;
+
+  s1 = v1;
+     4b4:	8b 45 08             	mov    0x8(%ebp),%eax
+     4b7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s2 = v2;
+     4ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4bd:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     4c0:	eb 0c                	jmp    4ce <memcmp+0x20>
+    s1 += 4, s2 += 4, n -= 4;
+     4c2:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+     4c6:	83 45 f8 04          	addl   $0x4,-0x8(%ebp)
+     4ca:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     4ce:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     4d2:	76 3e                	jbe    512 <memcmp+0x64>
+     4d4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     4d7:	8b 10                	mov    (%eax),%edx
+     4d9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     4dc:	8b 00                	mov    (%eax),%eax
+     4de:	39 c2                	cmp    %eax,%edx
+     4e0:	74 e0                	je     4c2 <memcmp+0x14>
+  while(n-- > 0){
+     4e2:	eb 2e                	jmp    512 <memcmp+0x64>
+    if(*s1 != *s2)
+     4e4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     4e7:	0f b6 10             	movzbl (%eax),%edx
+     4ea:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     4ed:	0f b6 00             	movzbl (%eax),%eax
+     4f0:	38 c2                	cmp    %al,%dl
+     4f2:	74 16                	je     50a <memcmp+0x5c>
+      return *s1 - *s2;
+     4f4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     4f7:	0f b6 00             	movzbl (%eax),%eax
+     4fa:	0f b6 d0             	movzbl %al,%edx
+     4fd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     500:	0f b6 00             	movzbl (%eax),%eax
+     503:	0f b6 c0             	movzbl %al,%eax
+     506:	29 c2                	sub    %eax,%edx
+     508:	eb 1a                	jmp    524 <memcmp+0x76>
+    s1++, s2++;
+     50a:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     50e:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+  while(n-- > 0){
+     512:	8b 45 10             	mov    0x10(%ebp),%eax
+     515:	8d 50 ff             	lea    -0x1(%eax),%edx
+     518:	89 55 10             	mov    %edx,0x10(%ebp)
+     51b:	85 c0                	test   %eax,%eax
+     51d:	75 c5                	jne    4e4 <memcmp+0x36>
+  }
+  return 0;
+     51f:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+     524:	89 d0                	mov    %edx,%eax
+     526:	c9                   	leave
+     527:	c3                   	ret
+
+00000528 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     528:	55                   	push   %ebp
+     529:	89 e5                	mov    %esp,%ebp
+     52b:	83 ec 14             	sub    $0x14,%esp
+     52e:	8b 45 0c             	mov    0xc(%ebp),%eax
+     531:	88 45 ec             	mov    %al,-0x14(%ebp)
+  uint w, cc;
+
+  // Skip whole words holding neither c nor the terminator.
+  for(; ((uint)s & 3) && *s; s++)
+     534:	eb 17                	jmp    54d <strchr+0x25>
+    if(*s == c)
+     536:	8b 45 08             	mov    0x8(%ebp),%eax
+     539:	0f b6 00             	movzbl (%eax),%eax
+     53c:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     53f:	75 08                	jne    549 <strchr+0x21>
+      return (char*)s;
+     541:	8b 45 08             	mov    0x8(%ebp),%eax
+     544:	e9 ad 00 00 00       	jmp    5f6 <strchr+0xce>
+  for(; ((uint)s & 3) && *s; s++)
+     549:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     54d:	8b 45 08             	mov    0x8(%ebp),%eax
+     550:	83 e0 03             	and    $0x3,%eax
+     553:	85 c0                	test   %eax,%eax
+     555:	74 0a                	je     561 <strchr+0x39>
+     557:	8b 45 08             	mov    0x8(%ebp),%eax
+     55a:	0f b6 00             	movzbl (%eax),%eax
+     55d:	84 c0                	test   %al,%al
+     55f:	75 d5                	jne    536 <strchr+0xe>
+  cc = (uchar)c * ONES;
+     561:	0f b6 45 ec          	movzbl -0x14(%ebp),%eax
+     565:	0f b6 c0             	movzbl %al,%eax
+     568:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     56e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(*s)
+     571:	8b 45 08             	mov    0x8(%ebp),%eax
+     574:	0f b6 00             	movzbl (%eax),%eax
+     577:	84 c0                	test   %al,%al
+     579:	74 6c                	je     5e7 <strchr+0xbf>
+    for(; w = *(uint*)s, !HASZERO(w) && !HASZERO(w ^ cc); s += 4)
+     57b:	eb 04                	jmp    581 <strchr+0x59>
+     57d:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     581:	8b 45 08             	mov    0x8(%ebp),%eax
+     584:	8b 00                	mov    (%eax),%eax
+     586:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     589:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     58c:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     592:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     595:	f7 d0                	not    %eax
+     597:	21 d0                	and    %edx,%eax
+     599:	25 80 80 80 80       	and    $0x80808080,%eax
+     59e:	85 c0                	test   %eax,%eax
+     5a0:	75 26                	jne    5c8 <strchr+0xa0>
+     5a2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     5a5:	33 45 fc             	xor    -0x4(%ebp),%eax
+     5a8:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     5ae:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     5b1:	33 45 fc             	xor    -0x4(%ebp),%eax
+     5b4:	f7 d0                	not    %eax
+     5b6:	21 d0                	and    %edx,%eax
+     5b8:	25 80 80 80 80       	and    $0x80808080,%eax
+     5bd:	85 c0                	test   %eax,%eax
+     5bf:	75 07                	jne    5c8 <strchr+0xa0>
+     5c1:	b8 01 00 00 00       	mov    $0x1,%eax
+     5c6:	eb 05                	jmp    5cd <strchr+0xa5>
+     5c8:	b8 00 00 00 00       	mov    $0x0,%eax
+     5cd:	85 c0                	test   %eax,%eax
+     5cf:	75 ac                	jne    57d <strchr+0x55>
+      ;
+  for(; *s; s++)
+     5d1:	eb 14                	jmp    5e7 <strchr+0xbf>
+    if(*s == c)
+     5d3:	8b 45 08             	mov    0x8(%ebp),%eax
+     5d6:	0f b6 00             	movzbl (%eax),%eax
+     5d9:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     5dc:	75 05                	jne    5e3 <strchr+0xbb>
+      return (char*)s;
+     5de:	8b 45 08             	mov    0x8(%ebp),%eax
+     5e1:	eb 13                	jmp    5f6 <strchr+0xce>
+  for(; *s; s++)
+     5e3:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     5e7:	8b 45 08             	mov    0x8(%ebp),%eax
+     5ea:	0f b6 00             	movzbl (%eax),%eax
+     5ed:	84 c0                	test   %al,%al
+     5ef:	75 e2                	jne    5d3 <strchr+0xab>
+  return 0;
+     5f1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     5f6:	c9                   	leave
+     5f7:	c3                   	ret
+
+000005f8 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     5f8:	55                   	push   %ebp
+     5f9:	89 e5                	mov    %esp,%ebp
+     5fb:	83 ec 18             	sub    $0x18,%esp
+  int i, c;
+
+  for(i=0; i+1 < max; ){
+     5fe:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     605:	eb 37                	jmp    63e <gets+0x46>
+    c = fgetc(0);
+     607:	83 ec 0c             	sub    $0xc,%esp
+     60a:	6a 00                	push   $0x0
+     60c:	e8 2e 0e 00 00       	call   143f <fgetc>
+     611:	83 c4 10             	add    $0x10,%esp
+     614:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(c < 0)
+     617:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     61b:	78 2e                	js     64b <gets+0x53>
+      break;
+    buf[i++] = c;
+     61d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     620:	8d 50 01             	lea    0x1(%eax),%edx
+     623:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     626:	89 c2                	mov    %eax,%edx
+     628:	8b 45 08             	mov    0x8(%ebp),%eax
+     62b:	01 d0                	add    %edx,%eax
+     62d:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     630:	88 10                	mov    %dl,(%eax)
+    if(c == '\n' || c == '\r')
+     632:	83 7d f0 0a          	cmpl   $0xa,-0x10(%ebp)
+     636:	74 14                	je     64c <gets+0x54>
+     638:	83 7d f0 0d          	cmpl   $0xd,-0x10(%ebp)
+     63c:	74 0e                	je     64c <gets+0x54>
+  for(i=0; i+1 < max; ){
+     63e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     641:	83 c0 01             	add    $0x1,%eax
+     644:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     647:	7f be                	jg     607 <gets+0xf>
+     649:	eb 01                	jmp    64c <gets+0x54>
+      break;
+     64b:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     64c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     64f:	8b 45 08             	mov    0x8(%ebp),%eax
+     652:	01 d0                	add    %edx,%eax
+     654:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     657:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     65a:	c9                   	leave
+     65b:	c3                   	ret
+
+0000065c <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     65c:	55                   	push   %ebp
+     65d:	89 e5                	mov    %esp,%ebp
+     65f:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     662:	83 ec 08             	sub    $0x8,%esp
+     665:	6a 00                	push   $0x0
+     667:	ff 75 08             	push   0x8(%ebp)
+     66a:	e8 3b 02 00 00       	call   8aa <open>
+     66f:	83 c4 10             	add    $0x10,%esp
+     672:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     675:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     679:	79 07                	jns    682 <stat+0x26>
+    return -1;
+     67b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     680:	eb 25                	jmp    6a7 <stat+0x4b>
+  r = fstat(fd, st);
+     682:	83 ec 08             	sub    $0x8,%esp
+     685:	ff 75 0c             	push   0xc(%ebp)
+     688:	ff 75 f4             	push   -0xc(%ebp)
+     68b:	e8 47 02 00 00       	call   8d7 <fstat>
+     690:	83 c4 10             	add    $0x10,%esp
+     693:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     696:	83 ec 0c             	sub    $0xc,%esp
+     699:	ff 75 f4             	push   -0xc(%ebp)
+     69c:	e8 c7 0e 00 00       	call   1568 <close>
+     6a1:	83 c4 10             	add    $0x10,%esp
+  return r;
+     6a4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     6a7:	c9                   	leave
+     6a8:	c3                   	ret
+
+000006a9 <atoi>:
+
+int
+atoi(const char *s)
+{
+     6a9:	55                   	push   %ebp
+     6aa:	89 e5                	mov    %esp,%ebp
+     6ac:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     6af:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     6b6:	eb 25                	jmp    6dd <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     6b8:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     6bb:	89 d0                	mov    %edx,%eax
+     6bd:	c1 e0 02             	shl    $0x2,%eax
+     6c0:	01 d0                	add    %edx,%eax
+     6c2:	01 c0                	add    %eax,%eax
+     6c4:	89 c1                	mov    %eax,%ecx
+     6c6:	8b 45 08             	mov    0x8(%ebp),%eax
+     6c9:	8d 50 01             	lea    0x1(%eax),%edx
+     6cc:	89 55 08             	mov    %edx,0x8(%ebp)
+     6cf:	0f b6 00             	movzbl (%eax),%eax
+     6d2:	0f be c0             	movsbl %al,%eax
+     6d5:	01 c8                	add    %ecx,%eax
+     6d7:	83 e8 30             	sub    $0x30,%eax
+     6da:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     6dd:	8b 45 08             	mov    0x8(%ebp),%eax
+     6e0:	0f b6 00             	movzbl (%eax),%eax
+     6e3:	3c 2f                	cmp    $0x2f,%al
+     6e5:	7e 0a                	jle    6f1 <atoi+0x48>
+     6e7:	8b 45 08             	mov    0x8(%ebp),%eax
+     6ea:	0f b6 00             	movzbl (%eax),%eax
+     6ed:	3c 39                	cmp    $0x39,%al
+     6ef:	7e c7                	jle    6b8 <atoi+0xf>
+  return n;
+     6f1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     6f4:	c9                   	leave
+     6f5:	c3                   	ret
+
+000006f6 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     6f6:	55                   	push   %ebp
+     6f7:	89 e5                	mov    %esp,%ebp
+     6f9:	83 ec 10             	sub    $0x10,%esp
+  char *d, *s;
+  int k;
+
+  if(n <= 0)
+     6fc:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     700:	7f 08                	jg     70a <memmove+0x14>
+    return vdst;
+     702:	8b 45 08             	mov    0x8(%ebp),%eax
+     705:	e9 17 01 00 00       	jmp    821 <memmove+0x12b>
+  d = vdst;
+     70a:	8b 45 08             	mov    0x8(%ebp),%eax
+     70d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s = vsrc;
+     710:	8b 45 0c             	mov    0xc(%ebp),%eax
+     713:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  if(s < d && s + n > d){
+     716:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     719:	3b 45 fc             	cmp    -0x4(%ebp),%eax
+     71c:	0f 83 84 00 00 00    	jae    7a6 <memmove+0xb0>
+     722:	8b 55 10             	mov    0x10(%ebp),%edx
+     725:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     728:	01 d0                	add    %edx,%eax
+     72a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     72d:	73 77                	jae    7a6 <memmove+0xb0>
+    s += n;
+     72f:	8b 45 10             	mov    0x10(%ebp),%eax
+     732:	01 45 f8             	add    %eax,-0x8(%ebp)
+    d += n;
+     735:	8b 45 10             	mov    0x10(%ebp),%eax
+     738:	01 45 fc             	add    %eax,-0x4(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     73b:	eb 17                	jmp    754 <memmove+0x5e>
+      *--d = *--s, n--;
+     73d:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     741:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     745:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     748:	0f b6 10             	movzbl (%eax),%edx
+     74b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     74e:	88 10                	mov    %dl,(%eax)
+     750:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     754:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     758:	7e 22                	jle    77c <memmove+0x86>
+     75a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     75d:	83 e0 03             	and    $0x3,%eax
+     760:	85 c0                	test   %eax,%eax
+     762:	75 d9                	jne    73d <memmove+0x47>
+    for(; n >= 4; n -= 4){
+     764:	eb 16                	jmp    77c <memmove+0x86>
+      d -= 4;
+     766:	83 6d fc 04          	subl   $0x4,-0x4(%ebp)
+      s -= 4;
+     76a:	83 6d f8 04          	subl   $0x4,-0x8(%ebp)
+      *(uint*)d = *(uint*)s;
+     76e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     771:	8b 10                	mov    (%eax),%edx
+     773:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     776:	89 10                	mov    %edx,(%eax)
+    for(; n >= 4; n -= 4){
+     778:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+     77c:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     780:	7f e4                	jg     766 <memmove+0x70>
+    }
+    while(n-- > 0)
+     782:	eb 13                	jmp    797 <memmove+0xa1>
+      *--d = *--s;
+     784:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     788:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     78c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     78f:	0f b6 10             	movzbl (%eax),%edx
+     792:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     795:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+     797:	8b 45 10             	mov    0x10(%ebp),%eax
+     79a:	8d 50 ff             	lea    -0x1(%eax),%edx
+     79d:	89 55 10             	mov    %edx,0x10(%ebp)
+     7a0:	85 c0                	test   %eax,%eax
+     7a2:	7f e0                	jg     784 <memmove+0x8e>
+  if(s < d && s + n > d){
+     7a4:	eb 78                	jmp    81e <memmove+0x128>
+  } else {
+    if(n >= 16){
+     7a6:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     7aa:	7e 61                	jle    80d <memmove+0x117>
+      k = -(uint)d & 3;
+     7ac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     7af:	f7 d8                	neg    %eax
+     7b1:	83 e0 03             	and    $0x3,%eax
+     7b4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      movsb(d, s, k);
+     7b7:	ff 75 f4             	push   -0xc(%ebp)
+     7ba:	ff 75 f8             	push   -0x8(%ebp)
+     7bd:	ff 75 fc             	push   -0x4(%ebp)
+     7c0:	e8 cd fa ff ff       	call   292 <movsb>
+     7c5:	83 c4 0c             	add    $0xc,%esp
+      d += k;
+     7c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7cb:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += k;
+     7ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7d1:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n -= k;
+     7d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7d7:	29 45 10             	sub    %eax,0x10(%ebp)
+      movsl(d, s, n/4);
+     7da:	8b 45 10             	mov    0x10(%ebp),%eax
+     7dd:	8d 50 03             	lea    0x3(%eax),%edx
+     7e0:	85 c0                	test   %eax,%eax
+     7e2:	0f 48 c2             	cmovs  %edx,%eax
+     7e5:	c1 f8 02             	sar    $0x2,%eax
+     7e8:	50                   	push   %eax
+     7e9:	ff 75 f8             	push   -0x8(%ebp)
+     7ec:	ff 75 fc             	push   -0x4(%ebp)
+     7ef:	e8 cd fa ff ff       	call   2c1 <movsl>
+     7f4:	83 c4 0c             	add    $0xc,%esp
+      d += n & ~3;
+     7f7:	8b 45 10             	mov    0x10(%ebp),%eax
+     7fa:	83 e0 fc             	and    $0xfffffffc,%eax
+     7fd:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += n & ~3;
+     800:	8b 45 10             	mov    0x10(%ebp),%eax
+     803:	83 e0 fc             	and    $0xfffffffc,%eax
+     806:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n &= 3;
+     809:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+    }
+    movsb(d, s, n);
+     80d:	ff 75 10             	push   0x10(%ebp)
+     810:	ff 75 f8             	push   -0x8(%ebp)
+     813:	ff 75 fc             	push   -0x4(%ebp)
+     816:	e8 77 fa ff ff       	call   292 <movsb>
+     81b:	83 c4 0c             	add    $0xc,%esp
+  }
+  return vdst;
+     81e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     821:	c9                   	leave
+     822:	c3                   	ret
+
+00000823 <_fork>:
+    movl %esp, %ecx; \
+    movl $1f, %edx; \
+    sysenter; \
+  1: ret
+
+RAWSYSCALL(fork)
+     823:	b8 01 00 00 00       	mov    $0x1,%eax
+     828:	89 e1                	mov    %esp,%ecx
+     82a:	ba 31 08 00 00       	mov    $0x831,%edx
+     82f:	0f 34                	sysenter
+     831:	c3                   	ret
+
+00000832 <_exit>:
+RAWSYSCALL(exit)
+     832:	b8 02 00 00 00       	mov    $0x2,%eax
+     837:	89 e1                	mov    %esp,%ecx
+     839:	ba 40 08 00 00       	mov    $0x840,%edx
+     83e:	0f 34                	sysenter
+     840:	c3                   	ret
+
+00000841 <wait>:
+SYSCALL(wait)
+     841:	b8 03 00 00 00       	mov    $0x3,%eax
+     846:	89 e1                	mov    %esp,%ecx
+     848:	ba 4f 08 00 00       	mov    $0x84f,%edx
+     84d:	0f 34                	sysenter
+     84f:	c3                   	ret
+
+00000850 <pipe>:
+SYSCALL(pipe)
+     850:	b8 04 00 00 00       	mov    $0x4,%eax
+     855:	89 e1                	mov    %esp,%ecx
+     857:	ba 5e 08 00 00       	mov    $0x85e,%edx
+     85c:	0f 34                	sysenter
+     85e:	c3                   	ret
+
+0000085f <read>:
+SYSCALL(read)
+     85f:	b8 05 00 00 00       	mov    $0x5,%eax
+     864:	89 e1                	mov    %esp,%ecx
+     866:	ba 6d 08 00 00       	mov    $0x86d,%edx
+     86b:	0f 34                	sysenter
+     86d:	c3                   	ret
+
+0000086e <write>:
+SYSCALL(write)
+     86e:	b8 10 00 00 00       	mov    $0x10,%eax
+     873:	89 e1                	mov    %esp,%ecx
+     875:	ba 7c 08 00 00       	mov    $0x87c,%edx
+     87a:	0f 34                	sysenter
+     87c:	c3                   	ret
+
+0000087d <_close>:
+RAWSYSCALL(close)
+     87d:	b8 15 00 00 00       	mov    $0x15,%eax
+     882:	89 e1                	mov    %esp,%ecx
+     884:	ba 8b 08 00 00       	mov    $0x88b,%edx
+     889:	0f 34                	sysenter
+     88b:	c3                   	ret
+
+0000088c <kill>:
+SYSCALL(kill)
+     88c:	b8 06 00 00 00       	mov    $0x6,%eax
+     891:	89 e1                	mov    %esp,%ecx
+     893:	ba 9a 08 00 00       	mov    $0x89a,%edx
+     898:	0f 34                	sysenter
+     89a:	c3                   	ret
+
+0000089b <_exec>:
+RAWSYSCALL(exec)
+     89b:	b8 07 00 00 00       	mov    $0x7,%eax
+     8a0:	89 e1                	mov    %esp,%ecx
+     8a2:	ba a9 08 00 00       	mov    $0x8a9,%edx
+     8a7:	0f 34                	sysenter
+     8a9:	c3                   	ret
+
+000008aa <open>:
+SYSCALL(open)
+     8aa:	b8 0f 00 00 00       	mov    $0xf,%eax
+     8af:	89 e1                	mov    %esp,%ecx
+     8b1:	ba b8 08 00 00       	mov    $0x8b8,%edx
+     8b6:	0f 34                	sysenter
+     8b8:	c3                   	ret
+
+000008b9 <mknod>:
+SYSCALL(mknod)
+     8b9:	b8 11 00 00 00       	mov    $0x11,%eax
+     8be:	89 e1                	mov    %esp,%ecx
+     8c0:	ba c7 08 00 00       	mov    $0x8c7,%edx
+     8c5:	0f 34                	sysenter
+     8c7:	c3                   	ret
+
+000008c8 <unlink>:
+SYSCALL(unlink)
+     8c8:	b8 12 00 00 00       	mov    $0x12,%eax
+     8cd:	89 e1                	mov    %esp,%ecx
+     8cf:	ba d6 08 00 00       	mov    $0x8d6,%edx
+     8d4:	0f 34                	sysenter
+     8d6:	c3                   	ret
+
+000008d7 <fstat>:
+SYSCALL(fstat)
+     8d7:	b8 08 00 00 00       	mov    $0x8,%eax
+     8dc:	89 e1                	mov    %esp,%ecx
+     8de:	ba e5 08 00 00       	mov    $0x8e5,%edx
+     8e3:	0f 34                	sysenter
+     8e5:	c3                   	ret
+
+000008e6 <link>:
+SYSCALL(link)
+     8e6:	b8 13 00 00 00       	mov    $0x13,%eax
+     8eb:	89 e1                	mov    %esp,%ecx
+     8ed:	ba f4 08 00 00       	mov    $0x8f4,%edx
+     8f2:	0f 34                	sysenter
+     8f4:	c3                   	ret
+
+000008f5 <mkdir>:
+SYSCALL(mkdir)
+     8f5:	b8 14 00 00 00       	mov    $0x14,%eax
+     8fa:	89 e1                	mov    %esp,%ecx
+     8fc:	ba 03 09 00 00       	mov    $0x903,%edx
+     901:	0f 34                	sysenter
+     903:	c3                   	ret
+
+00000904 <chdir>:
+SYSCALL(chdir)
+     904:	b8 09 00 00 00       	mov    $0x9,%eax
+     909:	89 e1                	mov    %esp,%ecx
+     90b:	ba 12 09 00 00       	mov    $0x912,%edx
+     910:	0f 34                	sysenter
+     912:	c3                   	ret
+
+00000913 <dup>:
+SYSCALL(dup)
+     913:	b8 0a 00 00 00       	mov    $0xa,%eax
+     918:	89 e1                	mov    %esp,%ecx
+     91a:	ba 21 09 00 00       	mov    $0x921,%edx
+     91f:	0f 34                	sysenter
+     921:	c3                   	ret
+
+00000922 <getpid>:
+SYSCALL(getpid)
+     922:	b8 0b 00 00 00       	mov    $0xb,%eax
+     927:	89 e1                	mov    %esp,%ecx
+     929:	ba 30 09 00 00       	mov    $0x930,%edx
+     92e:	0f 34                	sysenter
+     930:	c3                   	ret
+
+00000931 <sbrk>:
+SYSCALL(sbrk)
+     931:	b8 0c 00 00 00       	mov    $0xc,%eax
+     936:	89 e1                	mov    %esp,%ecx
+     938:	ba 3f 09 00 00       	mov    $0x93f,%edx
+     93d:	0f 34                	sysenter
+     93f:	c3                   	ret
+
+00000940 <sleep>:
+SYSCALL(sleep)
+     940:	b8 0d 00 00 00       	mov    $0xd,%eax
+     945:	89 e1                	mov    %esp,%ecx
+     947:	ba 4e 09 00 00       	mov    $0x94e,%edx
+     94c:	0f 34                	sysenter
+     94e:	c3                   	ret
+
+0000094f <uptime>:
+SYSCALL(uptime)
+     94f:	b8 0e 00 00 00       	mov    $0xe,%eax
+     954:	89 e1                	mov    %esp,%ecx
+     956:	ba 5d 09 00 00       	mov    $0x95d,%edx
+     95b:	0f 34                	sysenter
+     95d:	c3                   	ret
+
+0000095e <getproc>:
+SYSCALL(getproc)
+     95e:	b8 16 00 00 00       	mov    $0x16,%eax
+     963:	89 e1                	mov    %esp,%ecx
+     965:	ba 6c 09 00 00       	mov    $0x96c,%edx
+     96a:	0f 34                	sysenter
+     96c:	c3                   	ret
+
+0000096d <getpgs>:
+SYSCALL(getpgs)
+     96d:	b8 17 00 00 00       	mov    $0x17,%eax
+     972:	89 e1                	mov    %esp,%ecx
+     974:	ba 7b 09 00 00       	mov    $0x97b,%edx
+     979:	0f 34                	sysenter
+     97b:	c3                   	ret
+
+0000097c <loadproc>:
+SYSCALL(loadproc)
+     97c:	b8 18 00 00 00       	mov    $0x18,%eax
+     981:	89 e1                	mov    %esp,%ecx
+     983:	ba 8a 09 00 00       	mov    $0x98a,%edx
+     988:	0f 34                	sysenter
+     98a:	c3                   	ret
+
+0000098b <iosubmit>:
+SYSCALL(iosubmit)
+     98b:	b8 19 00 00 00       	mov    $0x19,%eax
+     990:	89 e1                	mov    %esp,%ecx
+     992:	ba 99 09 00 00       	mov    $0x999,%edx
+     997:	0f 34                	sysenter
+     999:	c3                   	ret
+
+0000099a <sysstat>:
+SYSCALL(sysstat)
+     99a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     99f:	89 e1                	mov    %esp,%ecx
+     9a1:	ba a8 09 00 00       	mov    $0x9a8,%edx
+     9a6:	0f 34                	sysenter
+     9a8:	c3                   	ret
+
+000009a9 <splice>:
+SYSCALL(splice)
+     9a9:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     9ae:	89 e1                	mov    %esp,%ecx
+     9b0:	ba b7 09 00 00       	mov    $0x9b7,%edx
+     9b5:	0f 34                	sysenter
+     9b7:	c3                   	ret
+
+000009b8 <fsync>:
+SYSCALL(fsync)
+     9b8:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     9bd:	89 e1                	mov    %esp,%ecx
+     9bf:	ba c6 09 00 00       	mov    $0x9c6,%edx
+     9c4:	0f 34                	sysenter
+     9c6:	c3                   	ret
+
+000009c7 <fdatasync>:
+SYSCALL(fdatasync)
+     9c7:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     9cc:	89 e1                	mov    %esp,%ecx
+     9ce:	ba d5 09 00 00       	mov    $0x9d5,%edx
+     9d3:	0f 34                	sysenter
+     9d5:	c3                   	ret
+
+000009d6 <lseek>:
+SYSCALL(lseek)
+     9d6:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     9db:	89 e1                	mov    %esp,%ecx
+     9dd:	ba e4 09 00 00       	mov    $0x9e4,%edx
+     9e2:	0f 34                	sysenter
+     9e4:	c3                   	ret
+
+000009e5 <dmesg>:
+SYSCALL(dmesg)
+     9e5:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     9ea:	89 e1                	mov    %esp,%ecx
+     9ec:	ba f3 09 00 00       	mov    $0x9f3,%edx
+     9f1:	0f 34                	sysenter
+     9f3:	c3                   	ret
+
+000009f4 <lockstat>:
+SYSCALL(lockstat)
+     9f4:	b8 20 00 00 00       	mov    $0x20,%eax
+     9f9:	89 e1                	mov    %esp,%ecx
+     9fb:	ba 02 0a 00 00       	mov    $0xa02,%edx
+     a00:	0f 34                	sysenter
+     a02:	c3                   	ret
+
+00000a03 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     a03:	55                   	push   %ebp
+     a04:	89 e5                	mov    %esp,%ebp
+     a06:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     a09:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     a10:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     a14:	74 17                	je     a2d <printint+0x2a>
+     a16:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     a1a:	79 11                	jns    a2d <printint+0x2a>
+    neg = 1;
+     a1c:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     a23:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a26:	f7 d8                	neg    %eax
+     a28:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     a2b:	eb 06                	jmp    a33 <printint+0x30>
+  } else {
+    x = xx;
+     a2d:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a30:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     a33:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     a3a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     a3d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     a40:	ba 00 00 00 00       	mov    $0x0,%edx
+     a45:	f7 f1                	div    %ecx
+     a47:	89 d1                	mov    %edx,%ecx
+     a49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a4c:	8d 50 01             	lea    0x1(%eax),%edx
+     a4f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     a52:	0f b6 91 44 1c 00 00 	movzbl 0x1c44(%ecx),%edx
+     a59:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     a5d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     a60:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     a63:	ba 00 00 00 00       	mov    $0x0,%edx
+     a68:	f7 f1                	div    %ecx
+     a6a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     a6d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     a71:	75 c7                	jne    a3a <printint+0x37>
+  if(neg)
+     a73:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     a77:	74 2d                	je     aa6 <printint+0xa3>
+    buf[i++] = '-';
+     a79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a7c:	8d 50 01             	lea    0x1(%eax),%edx
+     a7f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     a82:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+     a87:	eb 1d                	jmp    aa6 <printint+0xa3>
+    fputc(fd, buf[i]);
+     a89:	8d 55 dc             	lea    -0x24(%ebp),%edx
+     a8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a8f:	01 d0                	add    %edx,%eax
+     a91:	0f b6 00             	movzbl (%eax),%eax
+     a94:	0f be c0             	movsbl %al,%eax
+     a97:	83 ec 08             	sub    $0x8,%esp
+     a9a:	50                   	push   %eax
+     a9b:	ff 75 08             	push   0x8(%ebp)
+     a9e:	e8 f8 08 00 00       	call   139b <fputc>
+     aa3:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+     aa6:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     aaa:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     aae:	79 d9                	jns    a89 <printint+0x86>
+}
+     ab0:	90                   	nop
+     ab1:	90                   	nop
+     ab2:	c9                   	leave
+     ab3:	c3                   	ret
+
+00000ab4 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     ab4:	55                   	push   %ebp
+     ab5:	89 e5                	mov    %esp,%ebp
+     ab7:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+     aba:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     ac1:	8d 45 0c             	lea    0xc(%ebp),%eax
+     ac4:	83 c0 04             	add    $0x4,%eax
+     ac7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+     aca:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     ad1:	e9 4a 01 00 00       	jmp    c20 <printf+0x16c>
+    c = fmt[i] & 0xff;
+     ad6:	8b 55 0c             	mov    0xc(%ebp),%edx
+     ad9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     adc:	01 d0                	add    %edx,%eax
+     ade:	0f b6 00             	movzbl (%eax),%eax
+     ae1:	0f be c0             	movsbl %al,%eax
+     ae4:	25 ff 00 00 00       	and    $0xff,%eax
+     ae9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+     aec:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     af0:	75 28                	jne    b1a <printf+0x66>
+      if(c == '%'){
+     af2:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     af6:	75 0c                	jne    b04 <printf+0x50>
+        state = '%';
+     af8:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+     aff:	e9 18 01 00 00       	jmp    c1c <printf+0x168>
+      } else {
+        fputc(fd, c);
+     b04:	83 ec 08             	sub    $0x8,%esp
+     b07:	ff 75 e4             	push   -0x1c(%ebp)
+     b0a:	ff 75 08             	push   0x8(%ebp)
+     b0d:	e8 89 08 00 00       	call   139b <fputc>
+     b12:	83 c4 10             	add    $0x10,%esp
+     b15:	e9 02 01 00 00       	jmp    c1c <printf+0x168>
+      }
+    } else if(state == '%'){
+     b1a:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+     b1e:	0f 85 f8 00 00 00    	jne    c1c <printf+0x168>
+      if(c == 'd'){
+     b24:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+     b28:	75 1e                	jne    b48 <printf+0x94>
+        printint(fd, *ap, 10, 1);
+     b2a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     b2d:	8b 00                	mov    (%eax),%eax
+     b2f:	6a 01                	push   $0x1
+     b31:	6a 0a                	push   $0xa
+     b33:	50                   	push   %eax
+     b34:	ff 75 08             	push   0x8(%ebp)
+     b37:	e8 c7 fe ff ff       	call   a03 <printint>
+     b3c:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     b3f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     b43:	e9 cd 00 00 00       	jmp    c15 <printf+0x161>
+      } else if(c == 'x' || c == 'p'){
+     b48:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+     b4c:	74 06                	je     b54 <printf+0xa0>
+     b4e:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+     b52:	75 1e                	jne    b72 <printf+0xbe>
+        printint(fd, *ap, 16, 0);
+     b54:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     b57:	8b 00                	mov    (%eax),%eax
+     b59:	6a 00                	push   $0x0
+     b5b:	6a 10                	push   $0x10
+     b5d:	50                   	push   %eax
+     b5e:	ff 75 08             	push   0x8(%ebp)
+     b61:	e8 9d fe ff ff       	call   a03 <printint>
+     b66:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     b69:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     b6d:	e9 a3 00 00 00       	jmp    c15 <printf+0x161>
+      } else if(c == 's'){
+     b72:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+     b76:	75 43                	jne    bbb <printf+0x107>
+        s = (char*)*ap;
+     b78:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     b7b:	8b 00                	mov    (%eax),%eax
+     b7d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     b80:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+     b84:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     b88:	75 25                	jne    baf <printf+0xfb>
+          s = "(null)";
+     b8a:	c7 45 f4 dc 16 00 00 	movl   $0x16dc,-0xc(%ebp)
+        while(*s != 0){
+     b91:	eb 1c                	jmp    baf <printf+0xfb>
+          fputc(fd, *s);
+     b93:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b96:	0f b6 00             	movzbl (%eax),%eax
+     b99:	0f be c0             	movsbl %al,%eax
+     b9c:	83 ec 08             	sub    $0x8,%esp
+     b9f:	50                   	push   %eax
+     ba0:	ff 75 08             	push   0x8(%ebp)
+     ba3:	e8 f3 07 00 00       	call   139b <fputc>
+     ba8:	83 c4 10             	add    $0x10,%esp
+          s++;
+     bab:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+     baf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     bb2:	0f b6 00             	movzbl (%eax),%eax
+     bb5:	84 c0                	test   %al,%al
+     bb7:	75 da                	jne    b93 <printf+0xdf>
+     bb9:	eb 5a                	jmp    c15 <printf+0x161>
+        }
+      } else if(c == 'c'){
+     bbb:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+     bbf:	75 1a                	jne    bdb <printf+0x127>
+        fputc(fd, *ap);
+     bc1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     bc4:	8b 00                	mov    (%eax),%eax
+     bc6:	83 ec 08             	sub    $0x8,%esp
+     bc9:	50                   	push   %eax
+     bca:	ff 75 08             	push   0x8(%ebp)
+     bcd:	e8 c9 07 00 00       	call   139b <fputc>
+     bd2:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     bd5:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     bd9:	eb 3a                	jmp    c15 <printf+0x161>
+      } else if(c == '%'){
+     bdb:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     bdf:	75 13                	jne    bf4 <printf+0x140>
+        fputc(fd, c);
+     be1:	83 ec 08             	sub    $0x8,%esp
+     be4:	ff 75 e4             	push   -0x1c(%ebp)
+     be7:	ff 75 08             	push   0x8(%ebp)
+     bea:	e8 ac 07 00 00       	call   139b <fputc>
+     bef:	83 c4 10             	add    $0x10,%esp
+     bf2:	eb 21                	jmp    c15 <printf+0x161>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        fputc(fd, '%');
+     bf4:	83 ec 08             	sub    $0x8,%esp
+     bf7:	6a 25                	push   $0x25
+     bf9:	ff 75 08             	push   0x8(%ebp)
+     bfc:	e8 9a 07 00 00       	call   139b <fputc>
+     c01:	83 c4 10             	add    $0x10,%esp
+        fputc(fd, c);
+     c04:	83 ec 08             	sub    $0x8,%esp
+     c07:	ff 75 e4             	push   -0x1c(%ebp)
+     c0a:	ff 75 08             	push   0x8(%ebp)
+     c0d:	e8 89 07 00 00       	call   139b <fputc>
+     c12:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     c15:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     c1c:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     c20:	8b 55 0c             	mov    0xc(%ebp),%edx
+     c23:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c26:	01 d0                	add    %edx,%eax
+     c28:	0f b6 00             	movzbl (%eax),%eax
+     c2b:	84 c0                	test   %al,%al
+     c2d:	0f 85 a3 fe ff ff    	jne    ad6 <printf+0x22>
+    }
+  }
+}
+     c33:	90                   	nop
+     c34:	90                   	nop
+     c35:	c9                   	leave
+     c36:	c3                   	ret
+
+00000c37 <binof>:
+static struct chunk *bins[NBIN];       // free large chunks
+static struct chunk *top;              // end marker of newest heap segment
+
+static int
+binof(uint size)
+{
+     c37:	55                   	push   %ebp
+     c38:	89 e5                	mov    %esp,%ebp
+     c3a:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  i = 0;
+     c3d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     c44:	c1 6d 08 05          	shrl   $0x5,0x8(%ebp)
+     c48:	eb 07                	jmp    c51 <binof+0x1a>
+    i++;
+     c4a:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     c4e:	d1 6d 08             	shrl   0x8(%ebp)
+     c51:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     c55:	74 06                	je     c5d <binof+0x26>
+     c57:	83 7d fc 19          	cmpl   $0x19,-0x4(%ebp)
+     c5b:	7e ed                	jle    c4a <binof+0x13>
+  return i;
+     c5d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     c60:	c9                   	leave
+     c61:	c3                   	ret
+
+00000c62 <bininsert>:
+
+static void
+bininsert(struct chunk *c)
+{
+     c62:	55                   	push   %ebp
+     c63:	89 e5                	mov    %esp,%ebp
+     c65:	83 ec 10             	sub    $0x10,%esp
+  struct chunk **b;
+
+  b = &bins[binof(CSIZE(c))];
+     c68:	8b 45 08             	mov    0x8(%ebp),%eax
+     c6b:	8b 00                	mov    (%eax),%eax
+     c6d:	83 e0 f8             	and    $0xfffffff8,%eax
+     c70:	50                   	push   %eax
+     c71:	e8 c1 ff ff ff       	call   c37 <binof>
+     c76:	83 c4 04             	add    $0x4,%esp
+     c79:	c1 e0 02             	shl    $0x2,%eax
+     c7c:	05 60 28 00 00       	add    $0x2860,%eax
+     c81:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c->prev = 0;
+     c84:	8b 45 08             	mov    0x8(%ebp),%eax
+     c87:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  c->next = *b;
+     c8e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c91:	8b 10                	mov    (%eax),%edx
+     c93:	8b 45 08             	mov    0x8(%ebp),%eax
+     c96:	89 50 08             	mov    %edx,0x8(%eax)
+  if(*b)
+     c99:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c9c:	8b 00                	mov    (%eax),%eax
+     c9e:	85 c0                	test   %eax,%eax
+     ca0:	74 0b                	je     cad <bininsert+0x4b>
+    (*b)->prev = c;
+     ca2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ca5:	8b 00                	mov    (%eax),%eax
+     ca7:	8b 55 08             	mov    0x8(%ebp),%edx
+     caa:	89 50 0c             	mov    %edx,0xc(%eax)
+  *b = c;
+     cad:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     cb0:	8b 55 08             	mov    0x8(%ebp),%edx
+     cb3:	89 10                	mov    %edx,(%eax)
+}
+     cb5:	90                   	nop
+     cb6:	c9                   	leave
+     cb7:	c3                   	ret
+
+00000cb8 <binremove>:
+
+static void
+binremove(struct chunk *c)
+{
+     cb8:	55                   	push   %ebp
+     cb9:	89 e5                	mov    %esp,%ebp
+  if(c->prev)
+     cbb:	8b 45 08             	mov    0x8(%ebp),%eax
+     cbe:	8b 40 0c             	mov    0xc(%eax),%eax
+     cc1:	85 c0                	test   %eax,%eax
+     cc3:	74 11                	je     cd6 <binremove+0x1e>
+    c->prev->next = c->next;
+     cc5:	8b 45 08             	mov    0x8(%ebp),%eax
+     cc8:	8b 40 0c             	mov    0xc(%eax),%eax
+     ccb:	8b 55 08             	mov    0x8(%ebp),%edx
+     cce:	8b 52 08             	mov    0x8(%edx),%edx
+     cd1:	89 50 08             	mov    %edx,0x8(%eax)
+     cd4:	eb 1e                	jmp    cf4 <binremove+0x3c>
+  else
+    bins[binof(CSIZE(c))] = c->next;
+     cd6:	8b 45 08             	mov    0x8(%ebp),%eax
+     cd9:	8b 00                	mov    (%eax),%eax
+     cdb:	83 e0 f8             	and    $0xfffffff8,%eax
+     cde:	50                   	push   %eax
+     cdf:	e8 53 ff ff ff       	call   c37 <binof>
+     ce4:	83 c4 04             	add    $0x4,%esp
+     ce7:	8b 55 08             	mov    0x8(%ebp),%edx
+     cea:	8b 52 08             	mov    0x8(%edx),%edx
+     ced:	89 14 85 60 28 00 00 	mov    %edx,0x2860(,%eax,4)
+  if(c->next)
+     cf4:	8b 45 08             	mov    0x8(%ebp),%eax
+     cf7:	8b 40 08             	mov    0x8(%eax),%eax
+     cfa:	85 c0                	test   %eax,%eax
+     cfc:	74 0f                	je     d0d <binremove+0x55>
+    c->next->prev = c->prev;
+     cfe:	8b 45 08             	mov    0x8(%ebp),%eax
+     d01:	8b 40 08             	mov    0x8(%eax),%eax
+     d04:	8b 55 08             	mov    0x8(%ebp),%edx
+     d07:	8b 52 0c             	mov    0xc(%edx),%edx
+     d0a:	89 50 0c             	mov    %edx,0xc(%eax)
+}
+     d0d:	90                   	nop
+     d0e:	c9                   	leave
+     d0f:	c3                   	ret
+
+00000d10 <freechunk>:
+
+// Free chunk c, merging it with free neighbors.  If trim is
+// set and the result is big and at the break, give it back.
+static void
+freechunk(struct chunk *c, int trim)
+{
+     d10:	55                   	push   %ebp
+     d11:	89 e5                	mov    %esp,%ebp
+     d13:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *p, *n;
+  uint size;
+
+  size = CSIZE(c);
+     d16:	8b 45 08             	mov    0x8(%ebp),%eax
+     d19:	8b 00                	mov    (%eax),%eax
+     d1b:	83 e0 f8             	and    $0xfffffff8,%eax
+     d1e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  n = NEXTC(c);
+     d21:	8b 45 08             	mov    0x8(%ebp),%eax
+     d24:	8b 00                	mov    (%eax),%eax
+     d26:	83 e0 f8             	and    $0xfffffff8,%eax
+     d29:	89 c2                	mov    %eax,%edx
+     d2b:	8b 45 08             	mov    0x8(%ebp),%eax
+     d2e:	01 d0                	add    %edx,%eax
+     d30:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(!(c->size & PREVUSED)){
+     d33:	8b 45 08             	mov    0x8(%ebp),%eax
+     d36:	8b 00                	mov    (%eax),%eax
+     d38:	83 e0 02             	and    $0x2,%eax
+     d3b:	85 c0                	test   %eax,%eax
+     d3d:	75 30                	jne    d6f <freechunk+0x5f>
+    p = (struct chunk*)((char*)c - *((uint*)c - 1));
+     d3f:	8b 45 08             	mov    0x8(%ebp),%eax
+     d42:	83 e8 04             	sub    $0x4,%eax
+     d45:	8b 00                	mov    (%eax),%eax
+     d47:	f7 d8                	neg    %eax
+     d49:	89 c2                	mov    %eax,%edx
+     d4b:	8b 45 08             	mov    0x8(%ebp),%eax
+     d4e:	01 d0                	add    %edx,%eax
+     d50:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    binremove(p);
+     d53:	ff 75 ec             	push   -0x14(%ebp)
+     d56:	e8 5d ff ff ff       	call   cb8 <binremove>
+     d5b:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(p);
+     d5e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     d61:	8b 00                	mov    (%eax),%eax
+     d63:	83 e0 f8             	and    $0xfffffff8,%eax
+     d66:	01 45 f4             	add    %eax,-0xc(%ebp)
+    c = p;
+     d69:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     d6c:	89 45 08             	mov    %eax,0x8(%ebp)
+  }
+  if(!(n->size & USED)){
+     d6f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d72:	8b 00                	mov    (%eax),%eax
+     d74:	83 e0 01             	and    $0x1,%eax
+     d77:	85 c0                	test   %eax,%eax
+     d79:	75 16                	jne    d91 <freechunk+0x81>
+    binremove(n);
+     d7b:	ff 75 f0             	push   -0x10(%ebp)
+     d7e:	e8 35 ff ff ff       	call   cb8 <binremove>
+     d83:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(n);
+     d86:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d89:	8b 00                	mov    (%eax),%eax
+     d8b:	83 e0 f8             	and    $0xfffffff8,%eax
+     d8e:	01 45 f4             	add    %eax,-0xc(%ebp)
+  }
+  // Free chunks are never adjacent, so the one below is in use.
+  c->size = size | PREVUSED;
+     d91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d94:	83 c8 02             	or     $0x2,%eax
+     d97:	89 c2                	mov    %eax,%edx
+     d99:	8b 45 08             	mov    0x8(%ebp),%eax
+     d9c:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+     d9e:	8b 45 08             	mov    0x8(%ebp),%eax
+     da1:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  FOOTER(c) = size;
+     da8:	8b 45 08             	mov    0x8(%ebp),%eax
+     dab:	8b 00                	mov    (%eax),%eax
+     dad:	83 e0 f8             	and    $0xfffffff8,%eax
+     db0:	8d 50 fc             	lea    -0x4(%eax),%edx
+     db3:	8b 45 08             	mov    0x8(%ebp),%eax
+     db6:	01 c2                	add    %eax,%edx
+     db8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     dbb:	89 02                	mov    %eax,(%edx)
+  n = NEXTC(c);
+     dbd:	8b 45 08             	mov    0x8(%ebp),%eax
+     dc0:	8b 00                	mov    (%eax),%eax
+     dc2:	83 e0 f8             	and    $0xfffffff8,%eax
+     dc5:	89 c2                	mov    %eax,%edx
+     dc7:	8b 45 08             	mov    0x8(%ebp),%eax
+     dca:	01 d0                	add    %edx,%eax
+     dcc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  n->size &= ~PREVUSED;
+     dcf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     dd2:	8b 00                	mov    (%eax),%eax
+     dd4:	83 e0 fd             	and    $0xfffffffd,%eax
+     dd7:	89 c2                	mov    %eax,%edx
+     dd9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ddc:	89 10                	mov    %edx,(%eax)
+
+  if(trim && n == top && size >= TRIMSIZE && sbrk(0) == (char*)top + HDRSIZE){
+     dde:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     de2:	74 51                	je     e35 <freechunk+0x125>
+     de4:	a1 cc 28 00 00       	mov    0x28cc,%eax
+     de9:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     dec:	75 47                	jne    e35 <freechunk+0x125>
+     dee:	81 7d f4 ff 7f 00 00 	cmpl   $0x7fff,-0xc(%ebp)
+     df5:	76 3e                	jbe    e35 <freechunk+0x125>
+     df7:	83 ec 0c             	sub    $0xc,%esp
+     dfa:	6a 00                	push   $0x0
+     dfc:	e8 30 fb ff ff       	call   931 <sbrk>
+     e01:	83 c4 10             	add    $0x10,%esp
+     e04:	8b 15 cc 28 00 00    	mov    0x28cc,%edx
+     e0a:	83 c2 08             	add    $0x8,%edx
+     e0d:	39 d0                	cmp    %edx,%eax
+     e0f:	75 24                	jne    e35 <freechunk+0x125>
+    c->size = USED | PREVUSED;
+     e11:	8b 45 08             	mov    0x8(%ebp),%eax
+     e14:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+    top = c;
+     e1a:	8b 45 08             	mov    0x8(%ebp),%eax
+     e1d:	a3 cc 28 00 00       	mov    %eax,0x28cc
+    sbrk(-size);
+     e22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e25:	f7 d8                	neg    %eax
+     e27:	83 ec 0c             	sub    $0xc,%esp
+     e2a:	50                   	push   %eax
+     e2b:	e8 01 fb ff ff       	call   931 <sbrk>
+     e30:	83 c4 10             	add    $0x10,%esp
+    return;
+     e33:	eb 0e                	jmp    e43 <freechunk+0x133>
+  }
+  bininsert(c);
+     e35:	83 ec 0c             	sub    $0xc,%esp
+     e38:	ff 75 08             	push   0x8(%ebp)
+     e3b:	e8 22 fe ff ff       	call   c62 <bininsert>
+     e40:	83 c4 10             	add    $0x10,%esp
+}
+     e43:	c9                   	leave
+     e44:	c3                   	ret
+
+00000e45 <morecore>:
+
+// Grow the heap by at least need bytes.
+static int
+morecore(uint need)
+{
+     e45:	55                   	push   %ebp
+     e46:	89 e5                	mov    %esp,%ebp
+     e48:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+  char *p;
+  uint n, pad;
+
+  n = need + MINCHUNK;
+     e4b:	8b 45 08             	mov    0x8(%ebp),%eax
+     e4e:	83 c0 18             	add    $0x18,%eax
+     e51:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(n < MINCORE)
+     e54:	81 7d ec ff 3f 00 00 	cmpl   $0x3fff,-0x14(%ebp)
+     e5b:	77 07                	ja     e64 <morecore+0x1f>
+    n = MINCORE;
+     e5d:	c7 45 ec 00 40 00 00 	movl   $0x4000,-0x14(%ebp)
+  // Keep the break 8-aligned, with the end marker just below it.
+  pad = (8 - ((uint)sbrk(0) & 7)) & 7;
+     e64:	83 ec 0c             	sub    $0xc,%esp
+     e67:	6a 00                	push   $0x0
+     e69:	e8 c3 fa ff ff       	call   931 <sbrk>
+     e6e:	83 c4 10             	add    $0x10,%esp
+     e71:	83 e0 07             	and    $0x7,%eax
+     e74:	ba 08 00 00 00       	mov    $0x8,%edx
+     e79:	29 c2                	sub    %eax,%edx
+     e7b:	89 d0                	mov    %edx,%eax
+     e7d:	83 e0 07             	and    $0x7,%eax
+     e80:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if((p = sbrk(pad + n)) == (char*)-1){
+     e83:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     e86:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     e89:	01 d0                	add    %edx,%eax
+     e8b:	83 ec 0c             	sub    $0xc,%esp
+     e8e:	50                   	push   %eax
+     e8f:	e8 9d fa ff ff       	call   931 <sbrk>
+     e94:	83 c4 10             	add    $0x10,%esp
+     e97:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     e9a:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     e9e:	75 30                	jne    ed0 <morecore+0x8b>
+    n = need + MINCHUNK;
+     ea0:	8b 45 08             	mov    0x8(%ebp),%eax
+     ea3:	83 c0 18             	add    $0x18,%eax
+     ea6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((p = sbrk(pad + n)) == (char*)-1)
+     ea9:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     eac:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     eaf:	01 d0                	add    %edx,%eax
+     eb1:	83 ec 0c             	sub    $0xc,%esp
+     eb4:	50                   	push   %eax
+     eb5:	e8 77 fa ff ff       	call   931 <sbrk>
+     eba:	83 c4 10             	add    $0x10,%esp
+     ebd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     ec0:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     ec4:	75 0a                	jne    ed0 <morecore+0x8b>
+      return -1;
+     ec6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     ecb:	e9 8e 00 00 00       	jmp    f5e <morecore+0x119>
+  }
+  p += pad;
+     ed0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     ed3:	01 45 f0             	add    %eax,-0x10(%ebp)
+  if(top && p == (char*)top + HDRSIZE){
+     ed6:	a1 cc 28 00 00       	mov    0x28cc,%eax
+     edb:	85 c0                	test   %eax,%eax
+     edd:	74 29                	je     f08 <morecore+0xc3>
+     edf:	a1 cc 28 00 00       	mov    0x28cc,%eax
+     ee4:	83 c0 08             	add    $0x8,%eax
+     ee7:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     eea:	75 1c                	jne    f08 <morecore+0xc3>
+    // Contiguous: the old end marker heads the new chunk.
+    c = top;
+     eec:	a1 cc 28 00 00       	mov    0x28cc,%eax
+     ef1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = n | (c->size & PREVUSED);
+     ef4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ef7:	8b 00                	mov    (%eax),%eax
+     ef9:	83 e0 02             	and    $0x2,%eax
+     efc:	0b 45 ec             	or     -0x14(%ebp),%eax
+     eff:	89 c2                	mov    %eax,%edx
+     f01:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f04:	89 10                	mov    %edx,(%eax)
+     f06:	eb 16                	jmp    f1e <morecore+0xd9>
+  } else {
+    // Someone else moved the break: start a new segment.
+    c = (struct chunk*)p;
+     f08:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f0b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = (n - HDRSIZE) | PREVUSED;
+     f0e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f11:	83 e8 08             	sub    $0x8,%eax
+     f14:	83 c8 02             	or     $0x2,%eax
+     f17:	89 c2                	mov    %eax,%edx
+     f19:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f1c:	89 10                	mov    %edx,(%eax)
+  }
+  top = NEXTC(c);
+     f1e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f21:	8b 00                	mov    (%eax),%eax
+     f23:	83 e0 f8             	and    $0xfffffff8,%eax
+     f26:	89 c2                	mov    %eax,%edx
+     f28:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f2b:	01 d0                	add    %edx,%eax
+     f2d:	a3 cc 28 00 00       	mov    %eax,0x28cc
+  top->size = USED;
+     f32:	a1 cc 28 00 00       	mov    0x28cc,%eax
+     f37:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  top->tag = LARGE;
+     f3d:	a1 cc 28 00 00       	mov    0x28cc,%eax
+     f42:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  freechunk(c, 0);
+     f49:	83 ec 08             	sub    $0x8,%esp
+     f4c:	6a 00                	push   $0x0
+     f4e:	ff 75 f4             	push   -0xc(%ebp)
+     f51:	e8 ba fd ff ff       	call   d10 <freechunk>
+     f56:	83 c4 10             	add    $0x10,%esp
+  return 0;
+     f59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     f5e:	c9                   	leave
+     f5f:	c3                   	ret
+
+00000f60 <largealloc>:
+
+static void*
+largealloc(uint nbytes)
+{
+     f60:	55                   	push   %ebp
+     f61:	89 e5                	mov    %esp,%ebp
+     f63:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c, *r;
+  uint need;
+  int i;
+
+  if(nbytes > 0x7fffffff)
+     f66:	8b 45 08             	mov    0x8(%ebp),%eax
+     f69:	85 c0                	test   %eax,%eax
+     f6b:	79 0a                	jns    f77 <largealloc+0x17>
+    return 0;
+     f6d:	b8 00 00 00 00       	mov    $0x0,%eax
+     f72:	e9 43 01 00 00       	jmp    10ba <largealloc+0x15a>
+  need = (nbytes + HDRSIZE + 7) & ~7;
+     f77:	8b 45 08             	mov    0x8(%ebp),%eax
+     f7a:	83 c0 0f             	add    $0xf,%eax
+     f7d:	83 e0 f8             	and    $0xfffffff8,%eax
+     f80:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(need < MINCHUNK)
+     f83:	83 7d f0 17          	cmpl   $0x17,-0x10(%ebp)
+     f87:	77 07                	ja     f90 <largealloc+0x30>
+    need = MINCHUNK;
+     f89:	c7 45 f0 18 00 00 00 	movl   $0x18,-0x10(%ebp)
+  for(;;){
+    for(i = binof(need); i < NBIN; i++)
+     f90:	ff 75 f0             	push   -0x10(%ebp)
+     f93:	e8 9f fc ff ff       	call   c37 <binof>
+     f98:	83 c4 04             	add    $0x4,%esp
+     f9b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     f9e:	eb 2f                	jmp    fcf <largealloc+0x6f>
+      for(c = bins[i]; c; c = c->next)
+     fa0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fa3:	8b 04 85 60 28 00 00 	mov    0x2860(,%eax,4),%eax
+     faa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     fad:	eb 16                	jmp    fc5 <largealloc+0x65>
+        if(CSIZE(c) >= need)
+     faf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fb2:	8b 00                	mov    (%eax),%eax
+     fb4:	83 e0 f8             	and    $0xfffffff8,%eax
+     fb7:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     fba:	73 35                	jae    ff1 <largealloc+0x91>
+      for(c = bins[i]; c; c = c->next)
+     fbc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fbf:	8b 40 08             	mov    0x8(%eax),%eax
+     fc2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     fc5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     fc9:	75 e4                	jne    faf <largealloc+0x4f>
+    for(i = binof(need); i < NBIN; i++)
+     fcb:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     fcf:	83 7d ec 1a          	cmpl   $0x1a,-0x14(%ebp)
+     fd3:	7e cb                	jle    fa0 <largealloc+0x40>
+          goto found;
+    if(morecore(need) < 0)
+     fd5:	83 ec 0c             	sub    $0xc,%esp
+     fd8:	ff 75 f0             	push   -0x10(%ebp)
+     fdb:	e8 65 fe ff ff       	call   e45 <morecore>
+     fe0:	83 c4 10             	add    $0x10,%esp
+     fe3:	85 c0                	test   %eax,%eax
+     fe5:	79 a9                	jns    f90 <largealloc+0x30>
+      return 0;
+     fe7:	b8 00 00 00 00       	mov    $0x0,%eax
+     fec:	e9 c9 00 00 00       	jmp    10ba <largealloc+0x15a>
+          goto found;
+     ff1:	90                   	nop
+  }
+
+found:
+  binremove(c);
+     ff2:	83 ec 0c             	sub    $0xc,%esp
+     ff5:	ff 75 f4             	push   -0xc(%ebp)
+     ff8:	e8 bb fc ff ff       	call   cb8 <binremove>
+     ffd:	83 c4 10             	add    $0x10,%esp
+  if(CSIZE(c) - need >= MINCHUNK){
+    1000:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1003:	8b 00                	mov    (%eax),%eax
+    1005:	83 e0 f8             	and    $0xfffffff8,%eax
+    1008:	2b 45 f0             	sub    -0x10(%ebp),%eax
+    100b:	83 f8 17             	cmp    $0x17,%eax
+    100e:	76 66                	jbe    1076 <largealloc+0x116>
+    r = (struct chunk*)((char*)c + need);
+    1010:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1013:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1016:	01 d0                	add    %edx,%eax
+    1018:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    r->size = (CSIZE(c) - need) | PREVUSED;
+    101b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    101e:	8b 00                	mov    (%eax),%eax
+    1020:	83 e0 f8             	and    $0xfffffff8,%eax
+    1023:	2b 45 f0             	sub    -0x10(%ebp),%eax
+    1026:	83 c8 02             	or     $0x2,%eax
+    1029:	89 c2                	mov    %eax,%edx
+    102b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    102e:	89 10                	mov    %edx,(%eax)
+    r->tag = LARGE;
+    1030:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1033:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+    FOOTER(r) = CSIZE(r);
+    103a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    103d:	8b 10                	mov    (%eax),%edx
+    103f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1042:	8b 00                	mov    (%eax),%eax
+    1044:	83 e0 f8             	and    $0xfffffff8,%eax
+    1047:	8d 48 fc             	lea    -0x4(%eax),%ecx
+    104a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    104d:	01 c8                	add    %ecx,%eax
+    104f:	83 e2 f8             	and    $0xfffffff8,%edx
+    1052:	89 10                	mov    %edx,(%eax)
+    bininsert(r);
+    1054:	83 ec 0c             	sub    $0xc,%esp
+    1057:	ff 75 e8             	push   -0x18(%ebp)
+    105a:	e8 03 fc ff ff       	call   c62 <bininsert>
+    105f:	83 c4 10             	add    $0x10,%esp
+    c->size = need | (c->size & PREVUSED);
+    1062:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1065:	8b 00                	mov    (%eax),%eax
+    1067:	83 e0 02             	and    $0x2,%eax
+    106a:	0b 45 f0             	or     -0x10(%ebp),%eax
+    106d:	89 c2                	mov    %eax,%edx
+    106f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1072:	89 10                	mov    %edx,(%eax)
+    1074:	eb 25                	jmp    109b <largealloc+0x13b>
+  } else
+    NEXTC(c)->size |= PREVUSED;
+    1076:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1079:	8b 00                	mov    (%eax),%eax
+    107b:	83 e0 f8             	and    $0xfffffff8,%eax
+    107e:	89 c2                	mov    %eax,%edx
+    1080:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1083:	01 d0                	add    %edx,%eax
+    1085:	8b 10                	mov    (%eax),%edx
+    1087:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    108a:	8b 00                	mov    (%eax),%eax
+    108c:	83 e0 f8             	and    $0xfffffff8,%eax
+    108f:	89 c1                	mov    %eax,%ecx
+    1091:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1094:	01 c8                	add    %ecx,%eax
+    1096:	83 ca 02             	or     $0x2,%edx
+    1099:	89 10                	mov    %edx,(%eax)
+  c->size |= USED;
+    109b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    109e:	8b 00                	mov    (%eax),%eax
+    10a0:	83 c8 01             	or     $0x1,%eax
+    10a3:	89 c2                	mov    %eax,%edx
+    10a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10a8:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+    10aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10ad:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  return (char*)c + HDRSIZE;
+    10b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10b7:	83 c0 08             	add    $0x8,%eax
+}
+    10ba:	c9                   	leave
+    10bb:	c3                   	ret
+
+000010bc <refill>:
+
+// Carve a slab into free blocks of class k.
+static int
+refill(int k)
+{
+    10bc:	55                   	push   %ebp
+    10bd:	89 e5                	mov    %esp,%ebp
+    10bf:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  char *p;
+  uint bs, i;
+
+  if((p = largealloc(SLABSIZE)) == 0)
+    10c2:	83 ec 0c             	sub    $0xc,%esp
+    10c5:	68 00 20 00 00       	push   $0x2000
+    10ca:	e8 91 fe ff ff       	call   f60 <largealloc>
+    10cf:	83 c4 10             	add    $0x10,%esp
+    10d2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    10d5:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    10d9:	75 07                	jne    10e2 <refill+0x26>
+    return -1;
+    10db:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    10e0:	eb 75                	jmp    1157 <refill+0x9b>
+  bs = HDRSIZE + (MINSMALL << k);
+    10e2:	8b 45 08             	mov    0x8(%ebp),%eax
+    10e5:	ba 10 00 00 00       	mov    $0x10,%edx
+    10ea:	89 c1                	mov    %eax,%ecx
+    10ec:	d3 e2                	shl    %cl,%edx
+    10ee:	89 d0                	mov    %edx,%eax
+    10f0:	83 c0 08             	add    $0x8,%eax
+    10f3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+    10f6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    10fd:	eb 44                	jmp    1143 <refill+0x87>
+    b = (struct chunk*)(p + i);
+    10ff:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    1102:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1105:	01 d0                	add    %edx,%eax
+    1107:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    b->size = bs | USED;
+    110a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    110d:	83 c8 01             	or     $0x1,%eax
+    1110:	89 c2                	mov    %eax,%edx
+    1112:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1115:	89 10                	mov    %edx,(%eax)
+    b->tag = k;
+    1117:	8b 55 08             	mov    0x8(%ebp),%edx
+    111a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    111d:	89 50 04             	mov    %edx,0x4(%eax)
+    b->next = classes[k];
+    1120:	8b 45 08             	mov    0x8(%ebp),%eax
+    1123:	8b 14 85 40 28 00 00 	mov    0x2840(,%eax,4),%edx
+    112a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    112d:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[k] = b;
+    1130:	8b 45 08             	mov    0x8(%ebp),%eax
+    1133:	8b 55 e8             	mov    -0x18(%ebp),%edx
+    1136:	89 14 85 40 28 00 00 	mov    %edx,0x2840(,%eax,4)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+    113d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1140:	01 45 f4             	add    %eax,-0xc(%ebp)
+    1143:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1146:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1149:	01 d0                	add    %edx,%eax
+    114b:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    1150:	76 ad                	jbe    10ff <refill+0x43>
+  }
+  return 0;
+    1152:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1157:	c9                   	leave
+    1158:	c3                   	ret
+
+00001159 <free>:
+
+void
+free(void *ap)
+{
+    1159:	55                   	push   %ebp
+    115a:	89 e5                	mov    %esp,%ebp
+    115c:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+
+  if(ap == 0)
+    115f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1163:	74 4b                	je     11b0 <free+0x57>
+    return;
+  c = (struct chunk*)((char*)ap - HDRSIZE);
+    1165:	8b 45 08             	mov    0x8(%ebp),%eax
+    1168:	83 e8 08             	sub    $0x8,%eax
+    116b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(c->tag != LARGE){
+    116e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1171:	8b 40 04             	mov    0x4(%eax),%eax
+    1174:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1177:	74 25                	je     119e <free+0x45>
+    c->next = classes[c->tag];
+    1179:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    117c:	8b 40 04             	mov    0x4(%eax),%eax
+    117f:	8b 14 85 40 28 00 00 	mov    0x2840(,%eax,4),%edx
+    1186:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1189:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[c->tag] = c;
+    118c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    118f:	8b 40 04             	mov    0x4(%eax),%eax
+    1192:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1195:	89 14 85 40 28 00 00 	mov    %edx,0x2840(,%eax,4)
+    return;
+    119c:	eb 13                	jmp    11b1 <free+0x58>
+  }
+  freechunk(c, 1);
+    119e:	83 ec 08             	sub    $0x8,%esp
+    11a1:	6a 01                	push   $0x1
+    11a3:	ff 75 f4             	push   -0xc(%ebp)
+    11a6:	e8 65 fb ff ff       	call   d10 <freechunk>
+    11ab:	83 c4 10             	add    $0x10,%esp
+    11ae:	eb 01                	jmp    11b1 <free+0x58>
+    return;
+    11b0:	90                   	nop
+}
+    11b1:	c9                   	leave
+    11b2:	c3                   	ret
+
+000011b3 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    11b3:	55                   	push   %ebp
+    11b4:	89 e5                	mov    %esp,%ebp
+    11b6:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  int k;
+
+  if(nbytes > MAXSMALL)
+    11b9:	81 7d 08 00 08 00 00 	cmpl   $0x800,0x8(%ebp)
+    11c0:	76 10                	jbe    11d2 <malloc+0x1f>
+    return largealloc(nbytes);
+    11c2:	83 ec 0c             	sub    $0xc,%esp
+    11c5:	ff 75 08             	push   0x8(%ebp)
+    11c8:	e8 93 fd ff ff       	call   f60 <largealloc>
+    11cd:	83 c4 10             	add    $0x10,%esp
+    11d0:	eb 6a                	jmp    123c <malloc+0x89>
+  for(k = 0; (MINSMALL << k) < nbytes; k++)
+    11d2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    11d9:	eb 04                	jmp    11df <malloc+0x2c>
+    11db:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    11df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11e2:	ba 10 00 00 00       	mov    $0x10,%edx
+    11e7:	89 c1                	mov    %eax,%ecx
+    11e9:	d3 e2                	shl    %cl,%edx
+    11eb:	89 d0                	mov    %edx,%eax
+    11ed:	3b 45 08             	cmp    0x8(%ebp),%eax
+    11f0:	72 e9                	jb     11db <malloc+0x28>
+    ;
+  if(classes[k] == 0 && refill(k) < 0)
+    11f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11f5:	8b 04 85 40 28 00 00 	mov    0x2840(,%eax,4),%eax
+    11fc:	85 c0                	test   %eax,%eax
+    11fe:	75 19                	jne    1219 <malloc+0x66>
+    1200:	83 ec 0c             	sub    $0xc,%esp
+    1203:	ff 75 f4             	push   -0xc(%ebp)
+    1206:	e8 b1 fe ff ff       	call   10bc <refill>
+    120b:	83 c4 10             	add    $0x10,%esp
+    120e:	85 c0                	test   %eax,%eax
+    1210:	79 07                	jns    1219 <malloc+0x66>
+    return 0;
+    1212:	b8 00 00 00 00       	mov    $0x0,%eax
+    1217:	eb 23                	jmp    123c <malloc+0x89>
+  b = classes[k];
+    1219:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    121c:	8b 04 85 40 28 00 00 	mov    0x2840(,%eax,4),%eax
+    1223:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  classes[k] = b->next;
+    1226:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1229:	8b 50 08             	mov    0x8(%eax),%edx
+    122c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    122f:	89 14 85 40 28 00 00 	mov    %edx,0x2840(,%eax,4)
+  return (char*)b + HDRSIZE;
+    1236:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1239:	83 c0 08             	add    $0x8,%eax
+}
+    123c:	c9                   	leave
+    123d:	c3                   	ret
+
+0000123e <stream>:
+
+// Return the stream for fd, deciding on first use how
+// its output is buffered.  Returns 0 if fd is not open.
+static struct stream*
+stream(int fd)
+{
+    123e:	55                   	push   %ebp
+    123f:	89 e5                	mov    %esp,%ebp
+    1241:	83 ec 28             	sub    $0x28,%esp
+  struct stream *s;
+  struct stat st;
+
+  if(fd < 0 || fd >= NOFILE)
+    1244:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1248:	78 06                	js     1250 <stream+0x12>
+    124a:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    124e:	7e 07                	jle    1257 <stream+0x19>
+    return 0;
+    1250:	b8 00 00 00 00       	mov    $0x0,%eax
+    1255:	eb 55                	jmp    12ac <stream+0x6e>
+  s = &streams[fd];
+    1257:	8b 45 08             	mov    0x8(%ebp),%eax
+    125a:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1260:	05 e0 28 00 00       	add    $0x28e0,%eax
+    1265:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(s->mode == UNKNOWN){
+    1268:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    126b:	8b 00                	mov    (%eax),%eax
+    126d:	85 c0                	test   %eax,%eax
+    126f:	75 38                	jne    12a9 <stream+0x6b>
+    if(fstat(fd, &st) < 0)
+    1271:	83 ec 08             	sub    $0x8,%esp
+    1274:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1277:	50                   	push   %eax
+    1278:	ff 75 08             	push   0x8(%ebp)
+    127b:	e8 57 f6 ff ff       	call   8d7 <fstat>
+    1280:	83 c4 10             	add    $0x10,%esp
+    1283:	85 c0                	test   %eax,%eax
+    1285:	79 07                	jns    128e <stream+0x50>
+      return 0;
+    1287:	b8 00 00 00 00       	mov    $0x0,%eax
+    128c:	eb 1e                	jmp    12ac <stream+0x6e>
+    s->mode = st.type == T_DEV ? LINEBUF : FULLBUF;
+    128e:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+    1292:	66 83 f8 03          	cmp    $0x3,%ax
+    1296:	75 07                	jne    129f <stream+0x61>
+    1298:	ba 01 00 00 00       	mov    $0x1,%edx
+    129d:	eb 05                	jmp    12a4 <stream+0x66>
+    129f:	ba 02 00 00 00       	mov    $0x2,%edx
+    12a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12a7:	89 10                	mov    %edx,(%eax)
+  }
+  return s;
+    12a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    12ac:	c9                   	leave
+    12ad:	c3                   	ret
+
+000012ae <fflush>:
+
+int
+fflush(int fd)
+{
+    12ae:	55                   	push   %ebp
+    12af:	89 e5                	mov    %esp,%ebp
+    12b1:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  int i, n;
+
+  if(fd < 0 || fd >= NOFILE)
+    12b4:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    12b8:	78 06                	js     12c0 <fflush+0x12>
+    12ba:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    12be:	7e 07                	jle    12c7 <fflush+0x19>
+    return -1;
+    12c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12c5:	eb 78                	jmp    133f <fflush+0x91>
+  s = &streams[fd];
+    12c7:	8b 45 08             	mov    0x8(%ebp),%eax
+    12ca:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    12d0:	05 e0 28 00 00       	add    $0x28e0,%eax
+    12d5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < s->nout; i += n){
+    12d8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    12df:	eb 44                	jmp    1325 <fflush+0x77>
+    if((n = write(fd, s->out + i, s->nout - i)) <= 0){
+    12e1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    12e4:	8b 40 04             	mov    0x4(%eax),%eax
+    12e7:	2b 45 f4             	sub    -0xc(%ebp),%eax
+    12ea:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    12ed:	8d 4a 10             	lea    0x10(%edx),%ecx
+    12f0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    12f3:	01 ca                	add    %ecx,%edx
+    12f5:	83 ec 04             	sub    $0x4,%esp
+    12f8:	50                   	push   %eax
+    12f9:	52                   	push   %edx
+    12fa:	ff 75 08             	push   0x8(%ebp)
+    12fd:	e8 6c f5 ff ff       	call   86e <write>
+    1302:	83 c4 10             	add    $0x10,%esp
+    1305:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1308:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    130c:	7f 11                	jg     131f <fflush+0x71>
+      s->nout = 0;
+    130e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1311:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+      return -1;
+    1318:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    131d:	eb 20                	jmp    133f <fflush+0x91>
+  for(i = 0; i < s->nout; i += n){
+    131f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1322:	01 45 f4             	add    %eax,-0xc(%ebp)
+    1325:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1328:	8b 40 04             	mov    0x4(%eax),%eax
+    132b:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    132e:	7c b1                	jl     12e1 <fflush+0x33>
+    }
+  }
+  s->nout = 0;
+    1330:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1333:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  return 0;
+    133a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    133f:	c9                   	leave
+    1340:	c3                   	ret
+
+00001341 <flushall>:
+
+// Flush every stream, or only line-buffered ones.
+static void
+flushall(int lineonly)
+{
+    1341:	55                   	push   %ebp
+    1342:	89 e5                	mov    %esp,%ebp
+    1344:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+    1347:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    134e:	eb 41                	jmp    1391 <flushall+0x50>
+    if(streams[fd].nout > 0 && (!lineonly || streams[fd].mode == LINEBUF))
+    1350:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1353:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1359:	05 e4 28 00 00       	add    $0x28e4,%eax
+    135e:	8b 00                	mov    (%eax),%eax
+    1360:	85 c0                	test   %eax,%eax
+    1362:	7e 29                	jle    138d <flushall+0x4c>
+    1364:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1368:	74 15                	je     137f <flushall+0x3e>
+    136a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    136d:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1373:	05 e0 28 00 00       	add    $0x28e0,%eax
+    1378:	8b 00                	mov    (%eax),%eax
+    137a:	83 f8 01             	cmp    $0x1,%eax
+    137d:	75 0e                	jne    138d <flushall+0x4c>
+      fflush(fd);
+    137f:	83 ec 0c             	sub    $0xc,%esp
+    1382:	ff 75 f4             	push   -0xc(%ebp)
+    1385:	e8 24 ff ff ff       	call   12ae <fflush>
+    138a:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++)
+    138d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1391:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+    1395:	7e b9                	jle    1350 <flushall+0xf>
+}
+    1397:	90                   	nop
+    1398:	90                   	nop
+    1399:	c9                   	leave
+    139a:	c3                   	ret
+
+0000139b <fputc>:
+
+int
+fputc(int fd, int c)
+{
+    139b:	55                   	push   %ebp
+    139c:	89 e5                	mov    %esp,%ebp
+    139e:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  char ch;
+
+  if((s = stream(fd)) == 0){
+    13a1:	83 ec 0c             	sub    $0xc,%esp
+    13a4:	ff 75 08             	push   0x8(%ebp)
+    13a7:	e8 92 fe ff ff       	call   123e <stream>
+    13ac:	83 c4 10             	add    $0x10,%esp
+    13af:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    13b2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    13b6:	75 2e                	jne    13e6 <fputc+0x4b>
+    ch = c;
+    13b8:	8b 45 0c             	mov    0xc(%ebp),%eax
+    13bb:	88 45 f3             	mov    %al,-0xd(%ebp)
+    return write(fd, &ch, 1) == 1 ? (uchar)c : -1;
+    13be:	83 ec 04             	sub    $0x4,%esp
+    13c1:	6a 01                	push   $0x1
+    13c3:	8d 45 f3             	lea    -0xd(%ebp),%eax
+    13c6:	50                   	push   %eax
+    13c7:	ff 75 08             	push   0x8(%ebp)
+    13ca:	e8 9f f4 ff ff       	call   86e <write>
+    13cf:	83 c4 10             	add    $0x10,%esp
+    13d2:	83 f8 01             	cmp    $0x1,%eax
+    13d5:	75 08                	jne    13df <fputc+0x44>
+    13d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+    13da:	0f b6 c0             	movzbl %al,%eax
+    13dd:	eb 5e                	jmp    143d <fputc+0xa2>
+    13df:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    13e4:	eb 57                	jmp    143d <fputc+0xa2>
+  }
+  s->out[s->nout++] = c;
+    13e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13e9:	8b 40 04             	mov    0x4(%eax),%eax
+    13ec:	8d 48 01             	lea    0x1(%eax),%ecx
+    13ef:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    13f2:	89 4a 04             	mov    %ecx,0x4(%edx)
+    13f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+    13f8:	89 d1                	mov    %edx,%ecx
+    13fa:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    13fd:	88 4c 02 10          	mov    %cl,0x10(%edx,%eax,1)
+  if(s->nout == BUFSZ || (s->mode == LINEBUF && c == '\n'))
+    1401:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1404:	8b 40 04             	mov    0x4(%eax),%eax
+    1407:	3d 00 02 00 00       	cmp    $0x200,%eax
+    140c:	74 10                	je     141e <fputc+0x83>
+    140e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1411:	8b 00                	mov    (%eax),%eax
+    1413:	83 f8 01             	cmp    $0x1,%eax
+    1416:	75 1f                	jne    1437 <fputc+0x9c>
+    1418:	83 7d 0c 0a          	cmpl   $0xa,0xc(%ebp)
+    141c:	75 19                	jne    1437 <fputc+0x9c>
+    if(fflush(fd) < 0)
+    141e:	83 ec 0c             	sub    $0xc,%esp
+    1421:	ff 75 08             	push   0x8(%ebp)
+    1424:	e8 85 fe ff ff       	call   12ae <fflush>
+    1429:	83 c4 10             	add    $0x10,%esp
+    142c:	85 c0                	test   %eax,%eax
+    142e:	79 07                	jns    1437 <fputc+0x9c>
+      return -1;
+    1430:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1435:	eb 06                	jmp    143d <fputc+0xa2>
+  return (uchar)c;
+    1437:	8b 45 0c             	mov    0xc(%ebp),%eax
+    143a:	0f b6 c0             	movzbl %al,%eax
+}
+    143d:	c9                   	leave
+    143e:	c3                   	ret
+
+0000143f <fgetc>:
+
+// Return the next byte read from fd, or -1 at end of file.
+int
+fgetc(int fd)
+{
+    143f:	55                   	push   %ebp
+    1440:	89 e5                	mov    %esp,%ebp
+    1442:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  uchar c;
+  int n;
+
+  if((s = stream(fd)) == 0){
+    1445:	83 ec 0c             	sub    $0xc,%esp
+    1448:	ff 75 08             	push   0x8(%ebp)
+    144b:	e8 ee fd ff ff       	call   123e <stream>
+    1450:	83 c4 10             	add    $0x10,%esp
+    1453:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1456:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    145a:	75 39                	jne    1495 <fgetc+0x56>
+    flushall(1);
+    145c:	83 ec 0c             	sub    $0xc,%esp
+    145f:	6a 01                	push   $0x1
+    1461:	e8 db fe ff ff       	call   1341 <flushall>
+    1466:	83 c4 10             	add    $0x10,%esp
+    return read(fd, &c, 1) == 1 ? c : -1;
+    1469:	83 ec 04             	sub    $0x4,%esp
+    146c:	6a 01                	push   $0x1
+    146e:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    1471:	50                   	push   %eax
+    1472:	ff 75 08             	push   0x8(%ebp)
+    1475:	e8 e5 f3 ff ff       	call   85f <read>
+    147a:	83 c4 10             	add    $0x10,%esp
+    147d:	83 f8 01             	cmp    $0x1,%eax
+    1480:	75 0c                	jne    148e <fgetc+0x4f>
+    1482:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    1486:	0f b6 c0             	movzbl %al,%eax
+    1489:	e9 80 00 00 00       	jmp    150e <fgetc+0xcf>
+    148e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1493:	eb 79                	jmp    150e <fgetc+0xcf>
+  }
+  if(s->rpos == s->rend){
+    1495:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1498:	8b 50 08             	mov    0x8(%eax),%edx
+    149b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    149e:	8b 40 0c             	mov    0xc(%eax),%eax
+    14a1:	39 c2                	cmp    %eax,%edx
+    14a3:	75 4c                	jne    14f1 <fgetc+0xb2>
+    flushall(1);
+    14a5:	83 ec 0c             	sub    $0xc,%esp
+    14a8:	6a 01                	push   $0x1
+    14aa:	e8 92 fe ff ff       	call   1341 <flushall>
+    14af:	83 c4 10             	add    $0x10,%esp
+    if((n = read(fd, s->in, BUFSZ)) <= 0)
+    14b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14b5:	05 10 02 00 00       	add    $0x210,%eax
+    14ba:	83 ec 04             	sub    $0x4,%esp
+    14bd:	68 00 02 00 00       	push   $0x200
+    14c2:	50                   	push   %eax
+    14c3:	ff 75 08             	push   0x8(%ebp)
+    14c6:	e8 94 f3 ff ff       	call   85f <read>
+    14cb:	83 c4 10             	add    $0x10,%esp
+    14ce:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    14d1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    14d5:	7f 07                	jg     14de <fgetc+0x9f>
+      return -1;
+    14d7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    14dc:	eb 30                	jmp    150e <fgetc+0xcf>
+    s->rpos = 0;
+    14de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14e1:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+    s->rend = n;
+    14e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14eb:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    14ee:	89 50 0c             	mov    %edx,0xc(%eax)
+  }
+  return (uchar)s->in[s->rpos++];
+    14f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14f4:	8b 40 08             	mov    0x8(%eax),%eax
+    14f7:	8d 48 01             	lea    0x1(%eax),%ecx
+    14fa:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    14fd:	89 4a 08             	mov    %ecx,0x8(%edx)
+    1500:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1503:	0f b6 84 02 10 02 00 	movzbl 0x210(%edx,%eax,1),%eax
+    150a:	00 
+    150b:	0f b6 c0             	movzbl %al,%eax
+}
+    150e:	c9                   	leave
+    150f:	c3                   	ret
+
+00001510 <fork>:
+
+int
+fork(void)
+{
+    1510:	55                   	push   %ebp
+    1511:	89 e5                	mov    %esp,%ebp
+    1513:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1516:	83 ec 0c             	sub    $0xc,%esp
+    1519:	6a 00                	push   $0x0
+    151b:	e8 21 fe ff ff       	call   1341 <flushall>
+    1520:	83 c4 10             	add    $0x10,%esp
+  return _fork();
+    1523:	e8 fb f2 ff ff       	call   823 <_fork>
+}
+    1528:	c9                   	leave
+    1529:	c3                   	ret
+
+0000152a <exec>:
+
+int
+exec(char *path, char **argv)
+{
+    152a:	55                   	push   %ebp
+    152b:	89 e5                	mov    %esp,%ebp
+    152d:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1530:	83 ec 0c             	sub    $0xc,%esp
+    1533:	6a 00                	push   $0x0
+    1535:	e8 07 fe ff ff       	call   1341 <flushall>
+    153a:	83 c4 10             	add    $0x10,%esp
+  return _exec(path, argv);
+    153d:	83 ec 08             	sub    $0x8,%esp
+    1540:	ff 75 0c             	push   0xc(%ebp)
+    1543:	ff 75 08             	push   0x8(%ebp)
+    1546:	e8 50 f3 ff ff       	call   89b <_exec>
+    154b:	83 c4 10             	add    $0x10,%esp
+}
+    154e:	c9                   	leave
+    154f:	c3                   	ret
+
+00001550 <exit>:
+
+int
+exit(void)
+{
+    1550:	55                   	push   %ebp
+    1551:	89 e5                	mov    %esp,%ebp
+    1553:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1556:	83 ec 0c             	sub    $0xc,%esp
+    1559:	6a 00                	push   $0x0
+    155b:	e8 e1 fd ff ff       	call   1341 <flushall>
+    1560:	83 c4 10             	add    $0x10,%esp
+  _exit();
+    1563:	e8 ca f2 ff ff       	call   832 <_exit>
+
+00001568 <close>:
+}
+
+int
+close(int fd)
+{
+    1568:	55                   	push   %ebp
+    1569:	89 e5                	mov    %esp,%ebp
+    156b:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+
+  if(fd >= 0 && fd < NOFILE){
+    156e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1572:	78 44                	js     15b8 <close+0x50>
+    1574:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    1578:	7f 3e                	jg     15b8 <close+0x50>
+    fflush(fd);
+    157a:	83 ec 0c             	sub    $0xc,%esp
+    157d:	ff 75 08             	push   0x8(%ebp)
+    1580:	e8 29 fd ff ff       	call   12ae <fflush>
+    1585:	83 c4 10             	add    $0x10,%esp
+    s = &streams[fd];
+    1588:	8b 45 08             	mov    0x8(%ebp),%eax
+    158b:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1591:	05 e0 28 00 00       	add    $0x28e0,%eax
+    1596:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    s->mode = UNKNOWN;
+    1599:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    159c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    s->rpos = s->rend = 0;
+    15a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15a5:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    15ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15af:	8b 50 0c             	mov    0xc(%eax),%edx
+    15b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15b5:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  return _close(fd);
+    15b8:	83 ec 0c             	sub    $0xc,%esp
+    15bb:	ff 75 08             	push   0x8(%ebp)
+    15be:	e8 ba f2 ff ff       	call   87d <_close>
+    15c3:	83 c4 10             	add    $0x10,%esp
+}
+    15c6:	c9                   	leave
+    15c7:	c3                   	ret
@@ -0,0 +1,89 @@
+// Print per-system-call counts and average latencies.
+// sysstat -h also prints each call's latency histogram.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "syscall.h"
+#include "sysstat.h"
+
+#define NELEM(x) (sizeof(x)/sizeof((x)[0]))
+
+static char *names[] = {
+[SYS_fork]     "fork",
+[SYS_exit]     "exit",
+[SYS_wait]     "wait",
+[SYS_pipe]     "pipe",
+[SYS_read]     "read",
+[SYS_kill]     "kill",
+[SYS_exec]     "exec",
+[SYS_fstat]    "fstat",
+[SYS_chdir]    "chdir",
+[SYS_dup]      "dup",
+[SYS_getpid]   "getpid",
+[SYS_sbrk]     "sbrk",
+[SYS_sleep]    "sleep",
+[SYS_uptime]   "uptime",
+[SYS_open]     "open",
+[SYS_write]    "write",
+[SYS_mknod]    "mknod",
+[SYS_unlink]   "unlink",
+[SYS_link]     "link",
+[SYS_mkdir]    "mkdir",
+[SYS_close]    "close",
+[SYS_getproc]  "getproc",
+[SYS_getpgs]   "getpgs",
+[SYS_loadproc] "loadproc",
+[SYS_iosubmit] "iosubmit",
+[SYS_sysstat]  "sysstat",
+[SYS_splice]   "splice",
+[SYS_fsync]    "fsync",
+[SYS_fdatasync] "fdatasync",
+[SYS_lseek]    "lseek",
+[SYS_dmesg]    "dmesg",
+[SYS_lockstat] "lockstat",
+};
+
+struct sysstat st;
+
+// Average of total over n, without 64-bit division.
+uint
+average(uint64 total, uint n)
+{
+  int shift;
+
+  for(shift = 0; total >> 32; shift++)
+    total >>= 1;
+  return ((uint)total / n) << shift;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, b, hflag;
+  uint timed;
+
+  hflag = argc > 1 && strcmp(argv[1], "-h") == 0;
+  if(sysstat(&st) < 0){
+    printf(2, "sysstat: failed\n");
+    exit();
+  }
+
+  printf(1, "call count avg-cycles\n");
+  for(i = 0; i < NSYSCALL; i++){
+    if(st.count[i] == 0)
+      continue;
+    timed = 0;
+    for(b = 0; b < NSYSHIST; b++)
+      timed += st.hist[i][b];
+    printf(1, "%s %d %d\n", i < NELEM(names) && names[i] ? names[i] : "?",
+           st.count[i], timed ? average(st.cycles[i], timed) : 0);
+    if(!hflag)
+      continue;
+    for(b = 0; b < NSYSHIST; b++)
+      if(st.hist[i][b])
+        printf(1, "  %s2^%d: %d\n", b == NSYSHIST-1 ? ">=" : "<",
+               b == NSYSHIST-1 ? SYSHIST0+b : SYSHIST0+b+1, st.hist[i][b]);
+  }
+  exit();
+}
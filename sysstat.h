@@ -0,0 +1,12 @@
+// System call statistics, kept per CPU by syscall()
+// and summed over CPUs by the sysstat system call.
+
+#define NSYSCALL  40  // size of the per-call tables; > largest SYS_ number
+#define NSYSHIST  16  // latency histogram buckets
+#define SYSHIST0   8  // bucket 0 holds calls under 2^(SYSHIST0+1) cycles
+
+struct sysstat {
+  uint count[NSYSCALL];             // calls made
+  uint64 cycles[NSYSCALL];          // total TSC cycles in completed calls
+  uint hist[NSYSCALL][NSYSHIST];    // bucket i: under 2^(SYSHIST0+i+1) cycles
+};
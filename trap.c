@@ -11,8 +11,10 @@
 // Interrupt descriptor table (shared by all CPUs).
 struct gatedesc idt[256];
 extern uint vectors[];  // in vectors.S: array of 256 entry pointers
+extern void sysenter_entry(void);  // in trapasm.S
 struct spinlock tickslock;
 uint ticks;
+int havesysenter;  // does this machine have sysenter/sysexit?
 
 void
 tvinit(void)
@@ -32,11 +34,59 @@ idtinit(void)
   lidt(idt, sizeof(idt));
 }
 
+// Point this CPU's sysenter at sysenter_entry.
+// The kernel stack is filled in by switchuvm.
+// Run once on entry on each CPU.
+void
+sysenterinit(void)
+{
+  uint edx;
+
+  cpuid(1, 0, 0, 0, &edx);
+  if(!(edx & CPUID_SEP))
+    return;
+  wrmsr(MSR_SYSENTER_CS, SEG_KCODE<<3, 0);
+  wrmsr(MSR_SYSENTER_EIP, (uint)sysenter_entry, 0);
+  havesysenter = 1;
+}
+
+// System call made with sysenter; see sysenter_entry in trapasm.S.
+void
+sysentertrap(struct trapframe *tf)
+{
+  if(proc->killed)
+    exit();
+  proc->tf = tf;
+  syscall();
+  if(proc->killed)
+    exit();
+}
+
+// Is the user instruction at tf->eip a sysenter that the
+// CPU refused (no sysenter support)?  If so, rewrite tf
+// to look like an int $T_SYSCALL from the same place.
+static int
+sysenterfault(struct trapframe *tf)
+{
+  if(tf->trapno != T_ILLOP && tf->trapno != T_GPFLT)
+    return 0;
+  if(proc == 0 || (tf->cs&3) != DPL_USER)
+    return 0;
+  if(tf->eip >= proc->sz || tf->eip+2 > proc->sz)
+    return 0;
+  if(*(ushort*)tf->eip != 0x340f)  // 0f 34 = sysenter
+    return 0;
+  tf->eip = tf->edx;
+  tf->esp = tf->ecx;
+  tf->trapno = T_SYSCALL;
+  return 1;
+}
+
 //PAGEBREAK: 41
 void
 trap(struct trapframe *tf)
 {
-  if(tf->trapno == T_SYSCALL){
+  if(tf->trapno == T_SYSCALL || sysenterfault(tf)){
     if(proc->killed)
       exit();
     proc->tf = tf;
@@ -5,6 +5,7 @@
 #include "param.h"
 #include "traps.h"
 #include "spinlock.h"
+#include "sleeplock.h"
 #include "fs.h"
 #include "file.h"
 #include "mmu.h"
@@ -13,23 +14,41 @@
 
 #define COM1    0x3f8
 
+#define TXBUF   1024    // transmit ring size
+#define FIFOSZ  16      // 16550 transmit FIFO depth
+#define CHARUS  87      // microseconds to send one char at 115200 8N1
+// A working transmitter empties its FIFO every FIFOSZ*CHARUS (~1.4ms).
+// Give up only after several of those pass with nothing sent.
+#define STUCKUS (8*FIFOSZ*CHARUS)
+
 static int uart;    // is there a uart?
 
+// Characters waiting to be sent.  Writers append and return;
+// the transmit-empty interrupt moves them into the FIFO.
+static struct {
+  struct spinlock lock;
+  char buf[TXBUF];
+  uint r;  // next to send
+  uint w;  // next free slot
+} tx;
+
 void
 uartinit(void)
 {
   char *p;
 
-  // Turn off the FIFO
-  outb(COM1+2, 0);
-  
-  // 9600 baud, 8 data bits, 1 stop bit, parity off.
+  initlock(&tx.lock, "uart");
+
+  // Turn on and clear the FIFOs.
+  outb(COM1+2, 0x07);
+
+  // 115200 baud, 8 data bits, 1 stop bit, parity off.
   outb(COM1+3, 0x80);    // Unlock divisor
-  outb(COM1+0, 115200/9600);
+  outb(COM1+0, 115200/115200);
   outb(COM1+1, 0);
   outb(COM1+3, 0x03);    // Lock divisor, 8 data bits.
   outb(COM1+4, 0);
-  outb(COM1+1, 0x01);    // Enable receive interrupts.
+  outb(COM1+1, 0x03);    // Enable receive and transmit-empty interrupts.
 
   // If status is 0xFF, no serial port.
   if(inb(COM1+5) == 0xFF)
@@ -48,16 +67,65 @@ uartinit(void)
     uartputc(*p);
 }
 
+// If the transmitter is idle, fill its FIFO from the ring.
+// Caller holds tx.lock, or is panicking.
+static void
+uartstart(void)
+{
+  int i;
+
+  if(!(inb(COM1+5) & 0x20))
+    return;
+  for(i = 0; i < FIFOSZ && tx.r != tx.w; i++)
+    outb(COM1+0, tx.buf[tx.r++ % TXBUF]);
+}
+
+// Poll until at most n chars are queued.  Returns 0 if the
+// transmitter stops taking chars for STUCKUS before that.
+// Caller holds tx.lock, or is panicking.
+static int
+uartdrain(uint n)
+{
+  uint r;
+  int idle;
+
+  for(idle = 0; tx.w - tx.r > n; ){
+    r = tx.r;
+    uartstart();
+    if(tx.r != r){
+      idle = 0;
+      continue;
+    }
+    if(idle >= STUCKUS)
+      return 0;
+    microdelay(10);
+    idle += 10;
+  }
+  return 1;
+}
+
 void
 uartputc(int c)
 {
-  int i;
+  if(!uart)
+    return;
+  acquire(&tx.lock);
+  // Ring full: interrupts may be off here, so drain by polling.
+  if(!uartdrain(TXBUF-1))
+    tx.r++;  // transmitter is stuck; drop the oldest
+  tx.buf[tx.w++ % TXBUF] = c;
+  uartstart();
+  release(&tx.lock);
+}
 
+// Send everything queued, polling.  Used by panic,
+// which spins with interrupts off; takes no lock.
+void
+uartflush(void)
+{
   if(!uart)
     return;
-  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
-    microdelay(10);
-  outb(COM1+0, c);
+  uartdrain(0);
 }
 
 static int
@@ -73,5 +141,9 @@ uartgetc(void)
 void
 uartintr(void)
 {
+  inb(COM1+2);  // acknowledge transmit-empty
   consoleintr(uartgetc);
+  acquire(&tx.lock);
+  uartstart();
+  release(&tx.lock);
 }
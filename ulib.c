@@ -4,6 +4,11 @@
 #include "user.h"
 #include "x86.h"
 
+// Like the kernel's string.c, these work a word at a time
+// where they can.  A word x has a zero byte iff HASZERO(x).
+#define ONES        0x01010101
+#define HASZERO(x)  (((x) - ONES) & ~(x) & (ONES << 7))
+
 char*
 strcpy(char *s, char *t)
 {
@@ -18,6 +23,11 @@ strcpy(char *s, char *t)
 int
 strcmp(const char *p, const char *q)
 {
+  // Aligned words never straddle a page, so reading
+  // whole ones past the end of a string is safe.
+  if((((uint)p | (uint)q) & 3) == 0)
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+      p += 4, q += 4;
   while(*p && *p == *q)
     p++, q++;
   return (uchar)*p - (uchar)*q;
@@ -28,7 +38,12 @@ strlen(char *s)
 {
   int n;
 
-  for(n = 0; s[n]; n++)
+  for(n = 0; ((uint)(s+n) & 3) && s[n]; n++)
+    ;
+  if(s[n])
+    while(!HASZERO(*(uint*)(s+n)))
+      n += 4;
+  for(; s[n]; n++)
     ;
   return n;
 }
@@ -36,13 +51,54 @@ strlen(char *s)
 void*
 memset(void *dst, int c, uint n)
 {
-  stosb(dst, c, n);
+  char *d;
+  uint k;
+
+  d = dst;
+  c &= 0xFF;
+  if(n >= 16){
+    k = -(uint)d & 3;  // bytes up to a word boundary
+    stosb(d, c, k);
+    d += k;
+    n -= k;
+    stosl(d, c*ONES, n/4);
+    d += n & ~3;
+    n &= 3;
+  }
+  stosb(d, c, n);
   return dst;
 }
 
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+    s1 += 4, s2 += 4, n -= 4;
+  while(n-- > 0){
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+  }
+  return 0;
+}
+
 char*
 strchr(const char *s, char c)
 {
+  uint w, cc;
+
+  // Skip whole words holding neither c nor the terminator.
+  for(; ((uint)s & 3) && *s; s++)
+    if(*s == c)
+      return (char*)s;
+  cc = (uchar)c * ONES;
+  if(*s)
+    for(; w = *(uint*)s, !HASZERO(w) && !HASZERO(w ^ cc); s += 4)
+      ;
   for(; *s; s++)
     if(*s == c)
       return (char*)s;
@@ -52,12 +108,11 @@ strchr(const char *s, char c)
 char*
 gets(char *buf, int max)
 {
-  int i, cc;
-  char c;
+  int i, c;
 
   for(i=0; i+1 < max; ){
-    cc = read(0, &c, 1);
-    if(cc < 1)
+    c = fgetc(0);
+    if(c < 0)
       break;
     buf[i++] = c;
     if(c == '\n' || c == '\r')
@@ -95,11 +150,38 @@ atoi(const char *s)
 void*
 memmove(void *vdst, void *vsrc, int n)
 {
-  char *dst, *src;
-  
-  dst = vdst;
-  src = vsrc;
-  while(n-- > 0)
-    *dst++ = *src++;
+  char *d, *s;
+  int k;
+
+  if(n <= 0)
+    return vdst;
+  d = vdst;
+  s = vsrc;
+  if(s < d && s + n > d){
+    s += n;
+    d += n;
+    while(n > 0 && ((uint)d & 3))
+      *--d = *--s, n--;
+    for(; n >= 4; n -= 4){
+      d -= 4;
+      s -= 4;
+      *(uint*)d = *(uint*)s;
+    }
+    while(n-- > 0)
+      *--d = *--s;
+  } else {
+    if(n >= 16){
+      k = -(uint)d & 3;
+      movsb(d, s, k);
+      d += k;
+      s += k;
+      n -= k;
+      movsl(d, s, n/4);
+      d += n & ~3;
+      s += n & ~3;
+      n &= 3;
+    }
+    movsb(d, s, n);
+  }
   return vdst;
 }
@@ -3,88 +3,244 @@
 #include "user.h"
 #include "param.h"
 
-// Memory allocator by Kernighan and Ritchie,
-// The C programming Language, 2nd ed.  Section 8.7.
+// Memory allocator.
+//
+// Requests of up to MAXSMALL bytes are served from one free
+// list per power-of-two size class, refilled a slab at a time,
+// so malloc and free of them are a list pop and push.
+//
+// Larger requests are served from chunks with boundary tags,
+// kept in free lists binned by power of two.  free() merges a
+// chunk with free neighbors at once, and a large free chunk at
+// the top of the heap is given back with a negative sbrk.
+//
+// Every block starts with an 8-byte header, so memory handed
+// out is 8-byte aligned.  The header's second word is the size
+// class of a small block, or LARGE.
 
-typedef long Align;
+#define NCLASS    8       // small sizes 16, 32, ..., 2048
+#define MINSMALL  16
+#define MAXSMALL  (MINSMALL << (NCLASS-1))
+#define SLABSIZE  8192    // bytes carved into small blocks at a time
+#define NBIN      27      // bin i: free chunks of 2^(i+4) up to 2^(i+5) bytes
+#define MINCHUNK  24      // header, list links and footer
+#define MINCORE   16384   // least heap growth per sbrk
+#define TRIMSIZE  32768   // give back a free top chunk this big
 
-union header {
-  struct {
-    union header *ptr;
-    uint size;
-  } s;
-  Align x;
+#define HDRSIZE   8       // size and tag words
+#define USED      1       // in size: this chunk is allocated
+#define PREVUSED  2       // in size: the chunk below is allocated
+#define LARGE     0xffffffff
+
+struct chunk {
+  uint size;           // bytes including header, | USED | PREVUSED
+  uint tag;            // LARGE, or the class of a small block
+  struct chunk *next;  // free only: list links
+  struct chunk *prev;
+  // A free large chunk's last word repeats its size.
 };
 
-typedef union header Header;
+#define CSIZE(c)   ((c)->size & ~7)
+#define NEXTC(c)   ((struct chunk*)((char*)(c) + CSIZE(c)))
+#define FOOTER(c)  (*(uint*)((char*)(c) + CSIZE(c) - 4))
 
-static Header base;
-static Header *freep;
+static struct chunk *classes[NCLASS];  // free small blocks
+static struct chunk *bins[NBIN];       // free large chunks
+static struct chunk *top;              // end marker of newest heap segment
 
-void
-free(void *ap)
+static int
+binof(uint size)
 {
-  Header *bp, *p;
-
-  bp = (Header*)ap - 1;
-  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
-    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
-      break;
-  if(bp + bp->s.size == p->s.ptr){
-    bp->s.size += p->s.ptr->s.size;
-    bp->s.ptr = p->s.ptr->s.ptr;
-  } else
-    bp->s.ptr = p->s.ptr;
-  if(p + p->s.size == bp){
-    p->s.size += bp->s.size;
-    p->s.ptr = bp->s.ptr;
-  } else
-    p->s.ptr = bp;
-  freep = p;
+  int i;
+
+  i = 0;
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+    i++;
+  return i;
 }
 
-static Header*
-morecore(uint nu)
+static void
+bininsert(struct chunk *c)
 {
+  struct chunk **b;
+
+  b = &bins[binof(CSIZE(c))];
+  c->prev = 0;
+  c->next = *b;
+  if(*b)
+    (*b)->prev = c;
+  *b = c;
+}
+
+static void
+binremove(struct chunk *c)
+{
+  if(c->prev)
+    c->prev->next = c->next;
+  else
+    bins[binof(CSIZE(c))] = c->next;
+  if(c->next)
+    c->next->prev = c->prev;
+}
+
+// Free chunk c, merging it with free neighbors.  If trim is
+// set and the result is big and at the break, give it back.
+static void
+freechunk(struct chunk *c, int trim)
+{
+  struct chunk *p, *n;
+  uint size;
+
+  size = CSIZE(c);
+  n = NEXTC(c);
+  if(!(c->size & PREVUSED)){
+    p = (struct chunk*)((char*)c - *((uint*)c - 1));
+    binremove(p);
+    size += CSIZE(p);
+    c = p;
+  }
+  if(!(n->size & USED)){
+    binremove(n);
+    size += CSIZE(n);
+  }
+  // Free chunks are never adjacent, so the one below is in use.
+  c->size = size | PREVUSED;
+  c->tag = LARGE;
+  FOOTER(c) = size;
+  n = NEXTC(c);
+  n->size &= ~PREVUSED;
+
+  if(trim && n == top && size >= TRIMSIZE && sbrk(0) == (char*)top + HDRSIZE){
+    c->size = USED | PREVUSED;
+    top = c;
+    sbrk(-size);
+    return;
+  }
+  bininsert(c);
+}
+
+// Grow the heap by at least need bytes.
+static int
+morecore(uint need)
+{
+  struct chunk *c;
   char *p;
-  Header *hp;
+  uint n, pad;
+
+  n = need + MINCHUNK;
+  if(n < MINCORE)
+    n = MINCORE;
+  // Keep the break 8-aligned, with the end marker just below it.
+  pad = (8 - ((uint)sbrk(0) & 7)) & 7;
+  if((p = sbrk(pad + n)) == (char*)-1){
+    n = need + MINCHUNK;
+    if((p = sbrk(pad + n)) == (char*)-1)
+      return -1;
+  }
+  p += pad;
+  if(top && p == (char*)top + HDRSIZE){
+    // Contiguous: the old end marker heads the new chunk.
+    c = top;
+    c->size = n | (c->size & PREVUSED);
+  } else {
+    // Someone else moved the break: start a new segment.
+    c = (struct chunk*)p;
+    c->size = (n - HDRSIZE) | PREVUSED;
+  }
+  top = NEXTC(c);
+  top->size = USED;
+  top->tag = LARGE;
+  freechunk(c, 0);
+  return 0;
+}
+
+static void*
+largealloc(uint nbytes)
+{
+  struct chunk *c, *r;
+  uint need;
+  int i;
 
-  if(nu < 4096)
-    nu = 4096;
-  p = sbrk(nu * sizeof(Header));
-  if(p == (char*)-1)
+  if(nbytes > 0x7fffffff)
     return 0;
-  hp = (Header*)p;
-  hp->s.size = nu;
-  free((void*)(hp + 1));
-  return freep;
+  need = (nbytes + HDRSIZE + 7) & ~7;
+  if(need < MINCHUNK)
+    need = MINCHUNK;
+  for(;;){
+    for(i = binof(need); i < NBIN; i++)
+      for(c = bins[i]; c; c = c->next)
+        if(CSIZE(c) >= need)
+          goto found;
+    if(morecore(need) < 0)
+      return 0;
+  }
+
+found:
+  binremove(c);
+  if(CSIZE(c) - need >= MINCHUNK){
+    r = (struct chunk*)((char*)c + need);
+    r->size = (CSIZE(c) - need) | PREVUSED;
+    r->tag = LARGE;
+    FOOTER(r) = CSIZE(r);
+    bininsert(r);
+    c->size = need | (c->size & PREVUSED);
+  } else
+    NEXTC(c)->size |= PREVUSED;
+  c->size |= USED;
+  c->tag = LARGE;
+  return (char*)c + HDRSIZE;
 }
 
-void*
-malloc(uint nbytes)
+// Carve a slab into free blocks of class k.
+static int
+refill(int k)
 {
-  Header *p, *prevp;
-  uint nunits;
+  struct chunk *b;
+  char *p;
+  uint bs, i;
 
-  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
-  if((prevp = freep) == 0){
-    base.s.ptr = freep = prevp = &base;
-    base.s.size = 0;
+  if((p = largealloc(SLABSIZE)) == 0)
+    return -1;
+  bs = HDRSIZE + (MINSMALL << k);
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+    b = (struct chunk*)(p + i);
+    b->size = bs | USED;
+    b->tag = k;
+    b->next = classes[k];
+    classes[k] = b;
   }
-  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
-    if(p->s.size >= nunits){
-      if(p->s.size == nunits)
-        prevp->s.ptr = p->s.ptr;
-      else {
-        p->s.size -= nunits;
-        p += p->s.size;
-        p->s.size = nunits;
-      }
-      freep = prevp;
-      return (void*)(p + 1);
-    }
-    if(p == freep)
-      if((p = morecore(nunits)) == 0)
-        return 0;
+  return 0;
+}
+
+void
+free(void *ap)
+{
+  struct chunk *c;
+
+  if(ap == 0)
+    return;
+  c = (struct chunk*)((char*)ap - HDRSIZE);
+  if(c->tag != LARGE){
+    c->next = classes[c->tag];
+    classes[c->tag] = c;
+    return;
   }
+  freechunk(c, 1);
+}
+
+void*
+malloc(uint nbytes)
+{
+  struct chunk *b;
+  int k;
+
+  if(nbytes > MAXSMALL)
+    return largealloc(nbytes);
+  for(k = 0; (MINSMALL << k) < nbytes; k++)
+    ;
+  if(classes[k] == 0 && refill(k) < 0)
+    return 0;
+  b = classes[k];
+  classes[k] = b->next;
+  return (char*)b + HDRSIZE;
 }
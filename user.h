@@ -1,5 +1,8 @@
 struct stat;
 struct rtcdate;
+struct ioring;
+struct sysstat;
+struct lockstat;
 
 // system calls
 int fork(void);
@@ -26,6 +29,18 @@ int uptime(void);
 int getproc(void*);
 int getpgs(void*);
 int loadproc(void*, void*);
+int iosubmit(struct ioring*);
+int sysstat(struct sysstat*);
+int splice(int, int, int);
+int fsync(int);
+int fdatasync(int);
+int lseek(int, int, int);
+int dmesg(char*, int);
+int lockstat(struct lockstat*, int);
+int _fork(void);
+int _exit(void) __attribute__((noreturn));
+int _close(int);
+int _exec(char*, char**);
 
 // ulib.c
 int stat(char*, struct stat*);
@@ -37,6 +52,12 @@ void printf(int, char*, ...);
 char* gets(char*, int max);
 uint strlen(char*);
 void* memset(void*, int, uint);
+int memcmp(const void*, const void*, uint);
 void* malloc(uint);
 void free(void*);
 int atoi(const char*);
+
+// stdio.c
+int fputc(int, int);
+int fgetc(int);
+int fflush(int);
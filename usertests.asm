@@ -0,0 +1,12402 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <dirhash>:
+// directory to a hash table takes fewer.
+#define DIRGROWBLOCKS (2*SPLITCHAIN + 1 + 1 + 2 + 1 + 2 + 2*NLEVEL)
+
+static inline uint
+dirhash(const char *name)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 10             	sub    $0x10,%esp
+  uint h;
+  int i;
+
+  h = 0;
+       6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+       d:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+      14:	eb 23                	jmp    39 <dirhash+0x39>
+    h = h*31 + (uchar)name[i];
+      16:	8b 55 fc             	mov    -0x4(%ebp),%edx
+      19:	89 d0                	mov    %edx,%eax
+      1b:	c1 e0 05             	shl    $0x5,%eax
+      1e:	29 d0                	sub    %edx,%eax
+      20:	89 c1                	mov    %eax,%ecx
+      22:	8b 55 f8             	mov    -0x8(%ebp),%edx
+      25:	8b 45 08             	mov    0x8(%ebp),%eax
+      28:	01 d0                	add    %edx,%eax
+      2a:	0f b6 00             	movzbl (%eax),%eax
+      2d:	0f b6 c0             	movzbl %al,%eax
+      30:	01 c8                	add    %ecx,%eax
+      32:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+      35:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+      39:	83 7d f8 0d          	cmpl   $0xd,-0x8(%ebp)
+      3d:	7f 0f                	jg     4e <dirhash+0x4e>
+      3f:	8b 55 f8             	mov    -0x8(%ebp),%edx
+      42:	8b 45 08             	mov    0x8(%ebp),%eax
+      45:	01 d0                	add    %edx,%eax
+      47:	0f b6 00             	movzbl (%eax),%eax
+      4a:	84 c0                	test   %al,%al
+      4c:	75 c8                	jne    16 <dirhash+0x16>
+  // Mix the high bits into the low ones dirbucket() uses.
+  h ^= h >> 16;
+      4e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+      51:	c1 e8 10             	shr    $0x10,%eax
+      54:	31 45 fc             	xor    %eax,-0x4(%ebp)
+  h *= 0x45d9f3b;
+      57:	8b 45 fc             	mov    -0x4(%ebp),%eax
+      5a:	69 c0 3b 9f 5d 04    	imul   $0x45d9f3b,%eax,%eax
+      60:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  h ^= h >> 16;
+      63:	8b 45 fc             	mov    -0x4(%ebp),%eax
+      66:	c1 e8 10             	shr    $0x10,%eax
+      69:	31 45 fc             	xor    %eax,-0x4(%ebp)
+  return h;
+      6c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+      6f:	c9                   	leave
+      70:	c3                   	ret
+
+00000071 <iputtest>:
+int stdout = 1;
+
+// does chdir() call iput(p->cwd) in a transaction?
+void
+iputtest(void)
+{
+      71:	55                   	push   %ebp
+      72:	89 e5                	mov    %esp,%ebp
+      74:	83 ec 08             	sub    $0x8,%esp
+  printf(stdout, "iput test\n");
+      77:	a1 48 9e 00 00       	mov    0x9e48,%eax
+      7c:	83 ec 08             	sub    $0x8,%esp
+      7f:	68 ea 72 00 00       	push   $0x72ea
+      84:	50                   	push   %eax
+      85:	e8 33 67 00 00       	call   67bd <printf>
+      8a:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("iputdir") < 0){
+      8d:	83 ec 0c             	sub    $0xc,%esp
+      90:	68 f5 72 00 00       	push   $0x72f5
+      95:	e8 64 65 00 00       	call   65fe <mkdir>
+      9a:	83 c4 10             	add    $0x10,%esp
+      9d:	85 c0                	test   %eax,%eax
+      9f:	79 1b                	jns    bc <iputtest+0x4b>
+    printf(stdout, "mkdir failed\n");
+      a1:	a1 48 9e 00 00       	mov    0x9e48,%eax
+      a6:	83 ec 08             	sub    $0x8,%esp
+      a9:	68 fd 72 00 00       	push   $0x72fd
+      ae:	50                   	push   %eax
+      af:	e8 09 67 00 00       	call   67bd <printf>
+      b4:	83 c4 10             	add    $0x10,%esp
+    exit();
+      b7:	e8 9d 71 00 00       	call   7259 <exit>
+  }
+  if(chdir("iputdir") < 0){
+      bc:	83 ec 0c             	sub    $0xc,%esp
+      bf:	68 f5 72 00 00       	push   $0x72f5
+      c4:	e8 44 65 00 00       	call   660d <chdir>
+      c9:	83 c4 10             	add    $0x10,%esp
+      cc:	85 c0                	test   %eax,%eax
+      ce:	79 1b                	jns    eb <iputtest+0x7a>
+    printf(stdout, "chdir iputdir failed\n");
+      d0:	a1 48 9e 00 00       	mov    0x9e48,%eax
+      d5:	83 ec 08             	sub    $0x8,%esp
+      d8:	68 0b 73 00 00       	push   $0x730b
+      dd:	50                   	push   %eax
+      de:	e8 da 66 00 00       	call   67bd <printf>
+      e3:	83 c4 10             	add    $0x10,%esp
+    exit();
+      e6:	e8 6e 71 00 00       	call   7259 <exit>
+  }
+  if(unlink("../iputdir") < 0){
+      eb:	83 ec 0c             	sub    $0xc,%esp
+      ee:	68 21 73 00 00       	push   $0x7321
+      f3:	e8 d9 64 00 00       	call   65d1 <unlink>
+      f8:	83 c4 10             	add    $0x10,%esp
+      fb:	85 c0                	test   %eax,%eax
+      fd:	79 1b                	jns    11a <iputtest+0xa9>
+    printf(stdout, "unlink ../iputdir failed\n");
+      ff:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     104:	83 ec 08             	sub    $0x8,%esp
+     107:	68 2c 73 00 00       	push   $0x732c
+     10c:	50                   	push   %eax
+     10d:	e8 ab 66 00 00       	call   67bd <printf>
+     112:	83 c4 10             	add    $0x10,%esp
+    exit();
+     115:	e8 3f 71 00 00       	call   7259 <exit>
+  }
+  if(chdir("/") < 0){
+     11a:	83 ec 0c             	sub    $0xc,%esp
+     11d:	68 46 73 00 00       	push   $0x7346
+     122:	e8 e6 64 00 00       	call   660d <chdir>
+     127:	83 c4 10             	add    $0x10,%esp
+     12a:	85 c0                	test   %eax,%eax
+     12c:	79 1b                	jns    149 <iputtest+0xd8>
+    printf(stdout, "chdir / failed\n");
+     12e:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     133:	83 ec 08             	sub    $0x8,%esp
+     136:	68 48 73 00 00       	push   $0x7348
+     13b:	50                   	push   %eax
+     13c:	e8 7c 66 00 00       	call   67bd <printf>
+     141:	83 c4 10             	add    $0x10,%esp
+    exit();
+     144:	e8 10 71 00 00       	call   7259 <exit>
+  }
+  printf(stdout, "iput test ok\n");
+     149:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     14e:	83 ec 08             	sub    $0x8,%esp
+     151:	68 58 73 00 00       	push   $0x7358
+     156:	50                   	push   %eax
+     157:	e8 61 66 00 00       	call   67bd <printf>
+     15c:	83 c4 10             	add    $0x10,%esp
+}
+     15f:	90                   	nop
+     160:	c9                   	leave
+     161:	c3                   	ret
+
+00000162 <exitiputtest>:
+
+// does exit() call iput(p->cwd) in a transaction?
+void
+exitiputtest(void)
+{
+     162:	55                   	push   %ebp
+     163:	89 e5                	mov    %esp,%ebp
+     165:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  printf(stdout, "exitiput test\n");
+     168:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     16d:	83 ec 08             	sub    $0x8,%esp
+     170:	68 66 73 00 00       	push   $0x7366
+     175:	50                   	push   %eax
+     176:	e8 42 66 00 00       	call   67bd <printf>
+     17b:	83 c4 10             	add    $0x10,%esp
+
+  pid = fork();
+     17e:	e8 96 70 00 00       	call   7219 <fork>
+     183:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid < 0){
+     186:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     18a:	79 1b                	jns    1a7 <exitiputtest+0x45>
+    printf(stdout, "fork failed\n");
+     18c:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     191:	83 ec 08             	sub    $0x8,%esp
+     194:	68 75 73 00 00       	push   $0x7375
+     199:	50                   	push   %eax
+     19a:	e8 1e 66 00 00       	call   67bd <printf>
+     19f:	83 c4 10             	add    $0x10,%esp
+    exit();
+     1a2:	e8 b2 70 00 00       	call   7259 <exit>
+  }
+  if(pid == 0){
+     1a7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     1ab:	0f 85 92 00 00 00    	jne    243 <exitiputtest+0xe1>
+    if(mkdir("iputdir") < 0){
+     1b1:	83 ec 0c             	sub    $0xc,%esp
+     1b4:	68 f5 72 00 00       	push   $0x72f5
+     1b9:	e8 40 64 00 00       	call   65fe <mkdir>
+     1be:	83 c4 10             	add    $0x10,%esp
+     1c1:	85 c0                	test   %eax,%eax
+     1c3:	79 1b                	jns    1e0 <exitiputtest+0x7e>
+      printf(stdout, "mkdir failed\n");
+     1c5:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     1ca:	83 ec 08             	sub    $0x8,%esp
+     1cd:	68 fd 72 00 00       	push   $0x72fd
+     1d2:	50                   	push   %eax
+     1d3:	e8 e5 65 00 00       	call   67bd <printf>
+     1d8:	83 c4 10             	add    $0x10,%esp
+      exit();
+     1db:	e8 79 70 00 00       	call   7259 <exit>
+    }
+    if(chdir("iputdir") < 0){
+     1e0:	83 ec 0c             	sub    $0xc,%esp
+     1e3:	68 f5 72 00 00       	push   $0x72f5
+     1e8:	e8 20 64 00 00       	call   660d <chdir>
+     1ed:	83 c4 10             	add    $0x10,%esp
+     1f0:	85 c0                	test   %eax,%eax
+     1f2:	79 1b                	jns    20f <exitiputtest+0xad>
+      printf(stdout, "child chdir failed\n");
+     1f4:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     1f9:	83 ec 08             	sub    $0x8,%esp
+     1fc:	68 82 73 00 00       	push   $0x7382
+     201:	50                   	push   %eax
+     202:	e8 b6 65 00 00       	call   67bd <printf>
+     207:	83 c4 10             	add    $0x10,%esp
+      exit();
+     20a:	e8 4a 70 00 00       	call   7259 <exit>
+    }
+    if(unlink("../iputdir") < 0){
+     20f:	83 ec 0c             	sub    $0xc,%esp
+     212:	68 21 73 00 00       	push   $0x7321
+     217:	e8 b5 63 00 00       	call   65d1 <unlink>
+     21c:	83 c4 10             	add    $0x10,%esp
+     21f:	85 c0                	test   %eax,%eax
+     221:	79 1b                	jns    23e <exitiputtest+0xdc>
+      printf(stdout, "unlink ../iputdir failed\n");
+     223:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     228:	83 ec 08             	sub    $0x8,%esp
+     22b:	68 2c 73 00 00       	push   $0x732c
+     230:	50                   	push   %eax
+     231:	e8 87 65 00 00       	call   67bd <printf>
+     236:	83 c4 10             	add    $0x10,%esp
+      exit();
+     239:	e8 1b 70 00 00       	call   7259 <exit>
+    }
+    exit();
+     23e:	e8 16 70 00 00       	call   7259 <exit>
+  }
+  wait();
+     243:	e8 02 63 00 00       	call   654a <wait>
+  printf(stdout, "exitiput test ok\n");
+     248:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     24d:	83 ec 08             	sub    $0x8,%esp
+     250:	68 96 73 00 00       	push   $0x7396
+     255:	50                   	push   %eax
+     256:	e8 62 65 00 00       	call   67bd <printf>
+     25b:	83 c4 10             	add    $0x10,%esp
+}
+     25e:	90                   	nop
+     25f:	c9                   	leave
+     260:	c3                   	ret
+
+00000261 <openiputtest>:
+//      for(i = 0; i < 10000; i++)
+//        yield();
+//    }
+void
+openiputtest(void)
+{
+     261:	55                   	push   %ebp
+     262:	89 e5                	mov    %esp,%ebp
+     264:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  printf(stdout, "openiput test\n");
+     267:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     26c:	83 ec 08             	sub    $0x8,%esp
+     26f:	68 a8 73 00 00       	push   $0x73a8
+     274:	50                   	push   %eax
+     275:	e8 43 65 00 00       	call   67bd <printf>
+     27a:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("oidir") < 0){
+     27d:	83 ec 0c             	sub    $0xc,%esp
+     280:	68 b7 73 00 00       	push   $0x73b7
+     285:	e8 74 63 00 00       	call   65fe <mkdir>
+     28a:	83 c4 10             	add    $0x10,%esp
+     28d:	85 c0                	test   %eax,%eax
+     28f:	79 1b                	jns    2ac <openiputtest+0x4b>
+    printf(stdout, "mkdir oidir failed\n");
+     291:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     296:	83 ec 08             	sub    $0x8,%esp
+     299:	68 bd 73 00 00       	push   $0x73bd
+     29e:	50                   	push   %eax
+     29f:	e8 19 65 00 00       	call   67bd <printf>
+     2a4:	83 c4 10             	add    $0x10,%esp
+    exit();
+     2a7:	e8 ad 6f 00 00       	call   7259 <exit>
+  }
+  pid = fork();
+     2ac:	e8 68 6f 00 00       	call   7219 <fork>
+     2b1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid < 0){
+     2b4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     2b8:	79 1b                	jns    2d5 <openiputtest+0x74>
+    printf(stdout, "fork failed\n");
+     2ba:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     2bf:	83 ec 08             	sub    $0x8,%esp
+     2c2:	68 75 73 00 00       	push   $0x7375
+     2c7:	50                   	push   %eax
+     2c8:	e8 f0 64 00 00       	call   67bd <printf>
+     2cd:	83 c4 10             	add    $0x10,%esp
+    exit();
+     2d0:	e8 84 6f 00 00       	call   7259 <exit>
+  }
+  if(pid == 0){
+     2d5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     2d9:	75 3b                	jne    316 <openiputtest+0xb5>
+    int fd = open("oidir", O_RDWR);
+     2db:	83 ec 08             	sub    $0x8,%esp
+     2de:	6a 02                	push   $0x2
+     2e0:	68 b7 73 00 00       	push   $0x73b7
+     2e5:	e8 c9 62 00 00       	call   65b3 <open>
+     2ea:	83 c4 10             	add    $0x10,%esp
+     2ed:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0){
+     2f0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     2f4:	78 1b                	js     311 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     2f6:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     2fb:	83 ec 08             	sub    $0x8,%esp
+     2fe:	68 d4 73 00 00       	push   $0x73d4
+     303:	50                   	push   %eax
+     304:	e8 b4 64 00 00       	call   67bd <printf>
+     309:	83 c4 10             	add    $0x10,%esp
+      exit();
+     30c:	e8 48 6f 00 00       	call   7259 <exit>
+    }
+    exit();
+     311:	e8 43 6f 00 00       	call   7259 <exit>
+  }
+  sleep(1);
+     316:	83 ec 0c             	sub    $0xc,%esp
+     319:	6a 01                	push   $0x1
+     31b:	e8 29 63 00 00       	call   6649 <sleep>
+     320:	83 c4 10             	add    $0x10,%esp
+  if(unlink("oidir") != 0){
+     323:	83 ec 0c             	sub    $0xc,%esp
+     326:	68 b7 73 00 00       	push   $0x73b7
+     32b:	e8 a1 62 00 00       	call   65d1 <unlink>
+     330:	83 c4 10             	add    $0x10,%esp
+     333:	85 c0                	test   %eax,%eax
+     335:	74 1b                	je     352 <openiputtest+0xf1>
+    printf(stdout, "unlink failed\n");
+     337:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     33c:	83 ec 08             	sub    $0x8,%esp
+     33f:	68 f8 73 00 00       	push   $0x73f8
+     344:	50                   	push   %eax
+     345:	e8 73 64 00 00       	call   67bd <printf>
+     34a:	83 c4 10             	add    $0x10,%esp
+    exit();
+     34d:	e8 07 6f 00 00       	call   7259 <exit>
+  }
+  wait();
+     352:	e8 f3 61 00 00       	call   654a <wait>
+  printf(stdout, "openiput test ok\n");
+     357:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     35c:	83 ec 08             	sub    $0x8,%esp
+     35f:	68 07 74 00 00       	push   $0x7407
+     364:	50                   	push   %eax
+     365:	e8 53 64 00 00       	call   67bd <printf>
+     36a:	83 c4 10             	add    $0x10,%esp
+}
+     36d:	90                   	nop
+     36e:	c9                   	leave
+     36f:	c3                   	ret
+
+00000370 <opentest>:
+
+// simple file system tests
+
+void
+opentest(void)
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  printf(stdout, "open test\n");
+     376:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     37b:	83 ec 08             	sub    $0x8,%esp
+     37e:	68 19 74 00 00       	push   $0x7419
+     383:	50                   	push   %eax
+     384:	e8 34 64 00 00       	call   67bd <printf>
+     389:	83 c4 10             	add    $0x10,%esp
+  fd = open("echo", 0);
+     38c:	83 ec 08             	sub    $0x8,%esp
+     38f:	6a 00                	push   $0x0
+     391:	68 d4 72 00 00       	push   $0x72d4
+     396:	e8 18 62 00 00       	call   65b3 <open>
+     39b:	83 c4 10             	add    $0x10,%esp
+     39e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+     3a1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     3a5:	79 1b                	jns    3c2 <opentest+0x52>
+    printf(stdout, "open echo failed!\n");
+     3a7:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     3ac:	83 ec 08             	sub    $0x8,%esp
+     3af:	68 24 74 00 00       	push   $0x7424
+     3b4:	50                   	push   %eax
+     3b5:	e8 03 64 00 00       	call   67bd <printf>
+     3ba:	83 c4 10             	add    $0x10,%esp
+    exit();
+     3bd:	e8 97 6e 00 00       	call   7259 <exit>
+  }
+  close(fd);
+     3c2:	83 ec 0c             	sub    $0xc,%esp
+     3c5:	ff 75 f4             	push   -0xc(%ebp)
+     3c8:	e8 a4 6e 00 00       	call   7271 <close>
+     3cd:	83 c4 10             	add    $0x10,%esp
+  fd = open("doesnotexist", 0);
+     3d0:	83 ec 08             	sub    $0x8,%esp
+     3d3:	6a 00                	push   $0x0
+     3d5:	68 37 74 00 00       	push   $0x7437
+     3da:	e8 d4 61 00 00       	call   65b3 <open>
+     3df:	83 c4 10             	add    $0x10,%esp
+     3e2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+     3e5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     3e9:	78 1b                	js     406 <opentest+0x96>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     3eb:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     3f0:	83 ec 08             	sub    $0x8,%esp
+     3f3:	68 44 74 00 00       	push   $0x7444
+     3f8:	50                   	push   %eax
+     3f9:	e8 bf 63 00 00       	call   67bd <printf>
+     3fe:	83 c4 10             	add    $0x10,%esp
+    exit();
+     401:	e8 53 6e 00 00       	call   7259 <exit>
+  }
+  printf(stdout, "open test ok\n");
+     406:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     40b:	83 ec 08             	sub    $0x8,%esp
+     40e:	68 62 74 00 00       	push   $0x7462
+     413:	50                   	push   %eax
+     414:	e8 a4 63 00 00       	call   67bd <printf>
+     419:	83 c4 10             	add    $0x10,%esp
+}
+     41c:	90                   	nop
+     41d:	c9                   	leave
+     41e:	c3                   	ret
+
+0000041f <writetest>:
+
+void
+writetest(void)
+{
+     41f:	55                   	push   %ebp
+     420:	89 e5                	mov    %esp,%ebp
+     422:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int i;
+
+  printf(stdout, "small file test\n");
+     425:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     42a:	83 ec 08             	sub    $0x8,%esp
+     42d:	68 70 74 00 00       	push   $0x7470
+     432:	50                   	push   %eax
+     433:	e8 85 63 00 00       	call   67bd <printf>
+     438:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_CREATE|O_RDWR);
+     43b:	83 ec 08             	sub    $0x8,%esp
+     43e:	68 02 02 00 00       	push   $0x202
+     443:	68 81 74 00 00       	push   $0x7481
+     448:	e8 66 61 00 00       	call   65b3 <open>
+     44d:	83 c4 10             	add    $0x10,%esp
+     450:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd >= 0){
+     453:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     457:	78 22                	js     47b <writetest+0x5c>
+    printf(stdout, "creat small succeeded; ok\n");
+     459:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     45e:	83 ec 08             	sub    $0x8,%esp
+     461:	68 87 74 00 00       	push   $0x7487
+     466:	50                   	push   %eax
+     467:	e8 51 63 00 00       	call   67bd <printf>
+     46c:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "error: creat small failed!\n");
+    exit();
+  }
+  for(i = 0; i < 100; i++){
+     46f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     476:	e9 8f 00 00 00       	jmp    50a <writetest+0xeb>
+    printf(stdout, "error: creat small failed!\n");
+     47b:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     480:	83 ec 08             	sub    $0x8,%esp
+     483:	68 a2 74 00 00       	push   $0x74a2
+     488:	50                   	push   %eax
+     489:	e8 2f 63 00 00       	call   67bd <printf>
+     48e:	83 c4 10             	add    $0x10,%esp
+    exit();
+     491:	e8 c3 6d 00 00       	call   7259 <exit>
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     496:	83 ec 04             	sub    $0x4,%esp
+     499:	6a 0a                	push   $0xa
+     49b:	68 be 74 00 00       	push   $0x74be
+     4a0:	ff 75 f0             	push   -0x10(%ebp)
+     4a3:	e8 cf 60 00 00       	call   6577 <write>
+     4a8:	83 c4 10             	add    $0x10,%esp
+     4ab:	83 f8 0a             	cmp    $0xa,%eax
+     4ae:	74 1e                	je     4ce <writetest+0xaf>
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     4b0:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     4b5:	83 ec 04             	sub    $0x4,%esp
+     4b8:	ff 75 f4             	push   -0xc(%ebp)
+     4bb:	68 cc 74 00 00       	push   $0x74cc
+     4c0:	50                   	push   %eax
+     4c1:	e8 f7 62 00 00       	call   67bd <printf>
+     4c6:	83 c4 10             	add    $0x10,%esp
+      exit();
+     4c9:	e8 8b 6d 00 00       	call   7259 <exit>
+    }
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     4ce:	83 ec 04             	sub    $0x4,%esp
+     4d1:	6a 0a                	push   $0xa
+     4d3:	68 f0 74 00 00       	push   $0x74f0
+     4d8:	ff 75 f0             	push   -0x10(%ebp)
+     4db:	e8 97 60 00 00       	call   6577 <write>
+     4e0:	83 c4 10             	add    $0x10,%esp
+     4e3:	83 f8 0a             	cmp    $0xa,%eax
+     4e6:	74 1e                	je     506 <writetest+0xe7>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     4e8:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     4ed:	83 ec 04             	sub    $0x4,%esp
+     4f0:	ff 75 f4             	push   -0xc(%ebp)
+     4f3:	68 fc 74 00 00       	push   $0x74fc
+     4f8:	50                   	push   %eax
+     4f9:	e8 bf 62 00 00       	call   67bd <printf>
+     4fe:	83 c4 10             	add    $0x10,%esp
+      exit();
+     501:	e8 53 6d 00 00       	call   7259 <exit>
+  for(i = 0; i < 100; i++){
+     506:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     50a:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+     50e:	7e 86                	jle    496 <writetest+0x77>
+    }
+  }
+  printf(stdout, "writes ok\n");
+     510:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     515:	83 ec 08             	sub    $0x8,%esp
+     518:	68 20 75 00 00       	push   $0x7520
+     51d:	50                   	push   %eax
+     51e:	e8 9a 62 00 00       	call   67bd <printf>
+     523:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+     526:	83 ec 0c             	sub    $0xc,%esp
+     529:	ff 75 f0             	push   -0x10(%ebp)
+     52c:	e8 40 6d 00 00       	call   7271 <close>
+     531:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     534:	83 ec 08             	sub    $0x8,%esp
+     537:	6a 00                	push   $0x0
+     539:	68 81 74 00 00       	push   $0x7481
+     53e:	e8 70 60 00 00       	call   65b3 <open>
+     543:	83 c4 10             	add    $0x10,%esp
+     546:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd >= 0){
+     549:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     54d:	78 3c                	js     58b <writetest+0x16c>
+    printf(stdout, "open small succeeded ok\n");
+     54f:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     554:	83 ec 08             	sub    $0x8,%esp
+     557:	68 2b 75 00 00       	push   $0x752b
+     55c:	50                   	push   %eax
+     55d:	e8 5b 62 00 00       	call   67bd <printf>
+     562:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "error: open small failed!\n");
+    exit();
+  }
+  i = read(fd, buf, 2000);
+     565:	83 ec 04             	sub    $0x4,%esp
+     568:	68 d0 07 00 00       	push   $0x7d0
+     56d:	68 80 9e 00 00       	push   $0x9e80
+     572:	ff 75 f0             	push   -0x10(%ebp)
+     575:	e8 ee 5f 00 00       	call   6568 <read>
+     57a:	83 c4 10             	add    $0x10,%esp
+     57d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(i == 2000){
+     580:	81 7d f4 d0 07 00 00 	cmpl   $0x7d0,-0xc(%ebp)
+     587:	75 57                	jne    5e0 <writetest+0x1c1>
+     589:	eb 1b                	jmp    5a6 <writetest+0x187>
+    printf(stdout, "error: open small failed!\n");
+     58b:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     590:	83 ec 08             	sub    $0x8,%esp
+     593:	68 44 75 00 00       	push   $0x7544
+     598:	50                   	push   %eax
+     599:	e8 1f 62 00 00       	call   67bd <printf>
+     59e:	83 c4 10             	add    $0x10,%esp
+    exit();
+     5a1:	e8 b3 6c 00 00       	call   7259 <exit>
+    printf(stdout, "read succeeded ok\n");
+     5a6:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     5ab:	83 ec 08             	sub    $0x8,%esp
+     5ae:	68 5f 75 00 00       	push   $0x755f
+     5b3:	50                   	push   %eax
+     5b4:	e8 04 62 00 00       	call   67bd <printf>
+     5b9:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "read failed\n");
+    exit();
+  }
+  close(fd);
+     5bc:	83 ec 0c             	sub    $0xc,%esp
+     5bf:	ff 75 f0             	push   -0x10(%ebp)
+     5c2:	e8 aa 6c 00 00       	call   7271 <close>
+     5c7:	83 c4 10             	add    $0x10,%esp
+
+  if(unlink("small") < 0){
+     5ca:	83 ec 0c             	sub    $0xc,%esp
+     5cd:	68 81 74 00 00       	push   $0x7481
+     5d2:	e8 fa 5f 00 00       	call   65d1 <unlink>
+     5d7:	83 c4 10             	add    $0x10,%esp
+     5da:	85 c0                	test   %eax,%eax
+     5dc:	79 38                	jns    616 <writetest+0x1f7>
+     5de:	eb 1b                	jmp    5fb <writetest+0x1dc>
+    printf(stdout, "read failed\n");
+     5e0:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     5e5:	83 ec 08             	sub    $0x8,%esp
+     5e8:	68 72 75 00 00       	push   $0x7572
+     5ed:	50                   	push   %eax
+     5ee:	e8 ca 61 00 00       	call   67bd <printf>
+     5f3:	83 c4 10             	add    $0x10,%esp
+    exit();
+     5f6:	e8 5e 6c 00 00       	call   7259 <exit>
+    printf(stdout, "unlink small failed\n");
+     5fb:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     600:	83 ec 08             	sub    $0x8,%esp
+     603:	68 7f 75 00 00       	push   $0x757f
+     608:	50                   	push   %eax
+     609:	e8 af 61 00 00       	call   67bd <printf>
+     60e:	83 c4 10             	add    $0x10,%esp
+    exit();
+     611:	e8 43 6c 00 00       	call   7259 <exit>
+  }
+  printf(stdout, "small file test ok\n");
+     616:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     61b:	83 ec 08             	sub    $0x8,%esp
+     61e:	68 94 75 00 00       	push   $0x7594
+     623:	50                   	push   %eax
+     624:	e8 94 61 00 00       	call   67bd <printf>
+     629:	83 c4 10             	add    $0x10,%esp
+}
+     62c:	90                   	nop
+     62d:	c9                   	leave
+     62e:	c3                   	ret
+
+0000062f <writetest1>:
+// Blocks in "big": enough to need a double indirect block.
+#define BIGBLOCKS (NDIRECT + NINDIRECT + 20)
+
+void
+writetest1(void)
+{
+     62f:	55                   	push   %ebp
+     630:	89 e5                	mov    %esp,%ebp
+     632:	83 ec 18             	sub    $0x18,%esp
+  int i, fd, n;
+
+  printf(stdout, "big files test\n");
+     635:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     63a:	83 ec 08             	sub    $0x8,%esp
+     63d:	68 a8 75 00 00       	push   $0x75a8
+     642:	50                   	push   %eax
+     643:	e8 75 61 00 00       	call   67bd <printf>
+     648:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("big", O_CREATE|O_RDWR);
+     64b:	83 ec 08             	sub    $0x8,%esp
+     64e:	68 02 02 00 00       	push   $0x202
+     653:	68 b8 75 00 00       	push   $0x75b8
+     658:	e8 56 5f 00 00       	call   65b3 <open>
+     65d:	83 c4 10             	add    $0x10,%esp
+     660:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+     663:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     667:	79 1b                	jns    684 <writetest1+0x55>
+    printf(stdout, "error: creat big failed!\n");
+     669:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     66e:	83 ec 08             	sub    $0x8,%esp
+     671:	68 bc 75 00 00       	push   $0x75bc
+     676:	50                   	push   %eax
+     677:	e8 41 61 00 00       	call   67bd <printf>
+     67c:	83 c4 10             	add    $0x10,%esp
+    exit();
+     67f:	e8 d5 6b 00 00       	call   7259 <exit>
+  }
+
+  for(i = 0; i < BIGBLOCKS; i++){
+     684:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     68b:	eb 4b                	jmp    6d8 <writetest1+0xa9>
+    ((int*)buf)[0] = i;
+     68d:	ba 80 9e 00 00       	mov    $0x9e80,%edx
+     692:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     695:	89 02                	mov    %eax,(%edx)
+    if(write(fd, buf, 512) != 512){
+     697:	83 ec 04             	sub    $0x4,%esp
+     69a:	68 00 02 00 00       	push   $0x200
+     69f:	68 80 9e 00 00       	push   $0x9e80
+     6a4:	ff 75 ec             	push   -0x14(%ebp)
+     6a7:	e8 cb 5e 00 00       	call   6577 <write>
+     6ac:	83 c4 10             	add    $0x10,%esp
+     6af:	3d 00 02 00 00       	cmp    $0x200,%eax
+     6b4:	74 1e                	je     6d4 <writetest1+0xa5>
+      printf(stdout, "error: write big file failed\n", i);
+     6b6:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     6bb:	83 ec 04             	sub    $0x4,%esp
+     6be:	ff 75 f4             	push   -0xc(%ebp)
+     6c1:	68 d6 75 00 00       	push   $0x75d6
+     6c6:	50                   	push   %eax
+     6c7:	e8 f1 60 00 00       	call   67bd <printf>
+     6cc:	83 c4 10             	add    $0x10,%esp
+      exit();
+     6cf:	e8 85 6b 00 00       	call   7259 <exit>
+  for(i = 0; i < BIGBLOCKS; i++){
+     6d4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     6d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6db:	3d 9c 00 00 00       	cmp    $0x9c,%eax
+     6e0:	76 ab                	jbe    68d <writetest1+0x5e>
+    }
+  }
+
+  close(fd);
+     6e2:	83 ec 0c             	sub    $0xc,%esp
+     6e5:	ff 75 ec             	push   -0x14(%ebp)
+     6e8:	e8 84 6b 00 00       	call   7271 <close>
+     6ed:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("big", O_RDONLY);
+     6f0:	83 ec 08             	sub    $0x8,%esp
+     6f3:	6a 00                	push   $0x0
+     6f5:	68 b8 75 00 00       	push   $0x75b8
+     6fa:	e8 b4 5e 00 00       	call   65b3 <open>
+     6ff:	83 c4 10             	add    $0x10,%esp
+     702:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+     705:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     709:	79 1b                	jns    726 <writetest1+0xf7>
+    printf(stdout, "error: open big failed!\n");
+     70b:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     710:	83 ec 08             	sub    $0x8,%esp
+     713:	68 f4 75 00 00       	push   $0x75f4
+     718:	50                   	push   %eax
+     719:	e8 9f 60 00 00       	call   67bd <printf>
+     71e:	83 c4 10             	add    $0x10,%esp
+    exit();
+     721:	e8 33 6b 00 00       	call   7259 <exit>
+  }
+
+  n = 0;
+     726:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  for(;;){
+    i = read(fd, buf, 512);
+     72d:	83 ec 04             	sub    $0x4,%esp
+     730:	68 00 02 00 00       	push   $0x200
+     735:	68 80 9e 00 00       	push   $0x9e80
+     73a:	ff 75 ec             	push   -0x14(%ebp)
+     73d:	e8 26 5e 00 00       	call   6568 <read>
+     742:	83 c4 10             	add    $0x10,%esp
+     745:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(i == 0){
+     748:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     74c:	75 27                	jne    775 <writetest1+0x146>
+      if(n != BIGBLOCKS){
+     74e:	81 7d f0 9d 00 00 00 	cmpl   $0x9d,-0x10(%ebp)
+     755:	74 7d                	je     7d4 <writetest1+0x1a5>
+        printf(stdout, "read only %d blocks from big", n);
+     757:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     75c:	83 ec 04             	sub    $0x4,%esp
+     75f:	ff 75 f0             	push   -0x10(%ebp)
+     762:	68 0d 76 00 00       	push   $0x760d
+     767:	50                   	push   %eax
+     768:	e8 50 60 00 00       	call   67bd <printf>
+     76d:	83 c4 10             	add    $0x10,%esp
+        exit();
+     770:	e8 e4 6a 00 00       	call   7259 <exit>
+      }
+      break;
+    } else if(i != 512){
+     775:	81 7d f4 00 02 00 00 	cmpl   $0x200,-0xc(%ebp)
+     77c:	74 1e                	je     79c <writetest1+0x16d>
+      printf(stdout, "read failed %d\n", i);
+     77e:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     783:	83 ec 04             	sub    $0x4,%esp
+     786:	ff 75 f4             	push   -0xc(%ebp)
+     789:	68 2a 76 00 00       	push   $0x762a
+     78e:	50                   	push   %eax
+     78f:	e8 29 60 00 00       	call   67bd <printf>
+     794:	83 c4 10             	add    $0x10,%esp
+      exit();
+     797:	e8 bd 6a 00 00       	call   7259 <exit>
+    }
+    if(((int*)buf)[0] != n){
+     79c:	b8 80 9e 00 00       	mov    $0x9e80,%eax
+     7a1:	8b 00                	mov    (%eax),%eax
+     7a3:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     7a6:	74 23                	je     7cb <writetest1+0x19c>
+      printf(stdout, "read content of block %d is %d\n",
+             n, ((int*)buf)[0]);
+     7a8:	b8 80 9e 00 00       	mov    $0x9e80,%eax
+      printf(stdout, "read content of block %d is %d\n",
+     7ad:	8b 10                	mov    (%eax),%edx
+     7af:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     7b4:	52                   	push   %edx
+     7b5:	ff 75 f0             	push   -0x10(%ebp)
+     7b8:	68 3c 76 00 00       	push   $0x763c
+     7bd:	50                   	push   %eax
+     7be:	e8 fa 5f 00 00       	call   67bd <printf>
+     7c3:	83 c4 10             	add    $0x10,%esp
+      exit();
+     7c6:	e8 8e 6a 00 00       	call   7259 <exit>
+    }
+    n++;
+     7cb:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    i = read(fd, buf, 512);
+     7cf:	e9 59 ff ff ff       	jmp    72d <writetest1+0xfe>
+      break;
+     7d4:	90                   	nop
+  }
+  close(fd);
+     7d5:	83 ec 0c             	sub    $0xc,%esp
+     7d8:	ff 75 ec             	push   -0x14(%ebp)
+     7db:	e8 91 6a 00 00       	call   7271 <close>
+     7e0:	83 c4 10             	add    $0x10,%esp
+  if(unlink("big") < 0){
+     7e3:	83 ec 0c             	sub    $0xc,%esp
+     7e6:	68 b8 75 00 00       	push   $0x75b8
+     7eb:	e8 e1 5d 00 00       	call   65d1 <unlink>
+     7f0:	83 c4 10             	add    $0x10,%esp
+     7f3:	85 c0                	test   %eax,%eax
+     7f5:	79 1b                	jns    812 <writetest1+0x1e3>
+    printf(stdout, "unlink big failed\n");
+     7f7:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     7fc:	83 ec 08             	sub    $0x8,%esp
+     7ff:	68 5c 76 00 00       	push   $0x765c
+     804:	50                   	push   %eax
+     805:	e8 b3 5f 00 00       	call   67bd <printf>
+     80a:	83 c4 10             	add    $0x10,%esp
+    exit();
+     80d:	e8 47 6a 00 00       	call   7259 <exit>
+  }
+  printf(stdout, "big files ok\n");
+     812:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     817:	83 ec 08             	sub    $0x8,%esp
+     81a:	68 6f 76 00 00       	push   $0x766f
+     81f:	50                   	push   %eax
+     820:	e8 98 5f 00 00       	call   67bd <printf>
+     825:	83 c4 10             	add    $0x10,%esp
+}
+     828:	90                   	nop
+     829:	c9                   	leave
+     82a:	c3                   	ret
+
+0000082b <createtest>:
+
+void
+createtest(void)
+{
+     82b:	55                   	push   %ebp
+     82c:	89 e5                	mov    %esp,%ebp
+     82e:	83 ec 18             	sub    $0x18,%esp
+  int i, fd;
+
+  printf(stdout, "many creates, followed by unlink test\n");
+     831:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     836:	83 ec 08             	sub    $0x8,%esp
+     839:	68 80 76 00 00       	push   $0x7680
+     83e:	50                   	push   %eax
+     83f:	e8 79 5f 00 00       	call   67bd <printf>
+     844:	83 c4 10             	add    $0x10,%esp
+
+  name[0] = 'a';
+     847:	c6 05 80 be 00 00 61 	movb   $0x61,0xbe80
+  name[2] = '\0';
+     84e:	c6 05 82 be 00 00 00 	movb   $0x0,0xbe82
+  for(i = 0; i < 52; i++){
+     855:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     85c:	eb 35                	jmp    893 <createtest+0x68>
+    name[1] = '0' + i;
+     85e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     861:	83 c0 30             	add    $0x30,%eax
+     864:	a2 81 be 00 00       	mov    %al,0xbe81
+    fd = open(name, O_CREATE|O_RDWR);
+     869:	83 ec 08             	sub    $0x8,%esp
+     86c:	68 02 02 00 00       	push   $0x202
+     871:	68 80 be 00 00       	push   $0xbe80
+     876:	e8 38 5d 00 00       	call   65b3 <open>
+     87b:	83 c4 10             	add    $0x10,%esp
+     87e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+     881:	83 ec 0c             	sub    $0xc,%esp
+     884:	ff 75 f0             	push   -0x10(%ebp)
+     887:	e8 e5 69 00 00       	call   7271 <close>
+     88c:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 52; i++){
+     88f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     893:	83 7d f4 33          	cmpl   $0x33,-0xc(%ebp)
+     897:	7e c5                	jle    85e <createtest+0x33>
+  }
+  name[0] = 'a';
+     899:	c6 05 80 be 00 00 61 	movb   $0x61,0xbe80
+  name[2] = '\0';
+     8a0:	c6 05 82 be 00 00 00 	movb   $0x0,0xbe82
+  for(i = 0; i < 52; i++){
+     8a7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     8ae:	eb 1f                	jmp    8cf <createtest+0xa4>
+    name[1] = '0' + i;
+     8b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8b3:	83 c0 30             	add    $0x30,%eax
+     8b6:	a2 81 be 00 00       	mov    %al,0xbe81
+    unlink(name);
+     8bb:	83 ec 0c             	sub    $0xc,%esp
+     8be:	68 80 be 00 00       	push   $0xbe80
+     8c3:	e8 09 5d 00 00       	call   65d1 <unlink>
+     8c8:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 52; i++){
+     8cb:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     8cf:	83 7d f4 33          	cmpl   $0x33,-0xc(%ebp)
+     8d3:	7e db                	jle    8b0 <createtest+0x85>
+  }
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     8d5:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     8da:	83 ec 08             	sub    $0x8,%esp
+     8dd:	68 a8 76 00 00       	push   $0x76a8
+     8e2:	50                   	push   %eax
+     8e3:	e8 d5 5e 00 00       	call   67bd <printf>
+     8e8:	83 c4 10             	add    $0x10,%esp
+}
+     8eb:	90                   	nop
+     8ec:	c9                   	leave
+     8ed:	c3                   	ret
+
+000008ee <dirtest>:
+
+void dirtest(void)
+{
+     8ee:	55                   	push   %ebp
+     8ef:	89 e5                	mov    %esp,%ebp
+     8f1:	83 ec 08             	sub    $0x8,%esp
+  printf(stdout, "mkdir test\n");
+     8f4:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     8f9:	83 ec 08             	sub    $0x8,%esp
+     8fc:	68 ce 76 00 00       	push   $0x76ce
+     901:	50                   	push   %eax
+     902:	e8 b6 5e 00 00       	call   67bd <printf>
+     907:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("dir0") < 0){
+     90a:	83 ec 0c             	sub    $0xc,%esp
+     90d:	68 da 76 00 00       	push   $0x76da
+     912:	e8 e7 5c 00 00       	call   65fe <mkdir>
+     917:	83 c4 10             	add    $0x10,%esp
+     91a:	85 c0                	test   %eax,%eax
+     91c:	79 1b                	jns    939 <dirtest+0x4b>
+    printf(stdout, "mkdir failed\n");
+     91e:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     923:	83 ec 08             	sub    $0x8,%esp
+     926:	68 fd 72 00 00       	push   $0x72fd
+     92b:	50                   	push   %eax
+     92c:	e8 8c 5e 00 00       	call   67bd <printf>
+     931:	83 c4 10             	add    $0x10,%esp
+    exit();
+     934:	e8 20 69 00 00       	call   7259 <exit>
+  }
+
+  if(chdir("dir0") < 0){
+     939:	83 ec 0c             	sub    $0xc,%esp
+     93c:	68 da 76 00 00       	push   $0x76da
+     941:	e8 c7 5c 00 00       	call   660d <chdir>
+     946:	83 c4 10             	add    $0x10,%esp
+     949:	85 c0                	test   %eax,%eax
+     94b:	79 1b                	jns    968 <dirtest+0x7a>
+    printf(stdout, "chdir dir0 failed\n");
+     94d:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     952:	83 ec 08             	sub    $0x8,%esp
+     955:	68 df 76 00 00       	push   $0x76df
+     95a:	50                   	push   %eax
+     95b:	e8 5d 5e 00 00       	call   67bd <printf>
+     960:	83 c4 10             	add    $0x10,%esp
+    exit();
+     963:	e8 f1 68 00 00       	call   7259 <exit>
+  }
+
+  if(chdir("..") < 0){
+     968:	83 ec 0c             	sub    $0xc,%esp
+     96b:	68 f2 76 00 00       	push   $0x76f2
+     970:	e8 98 5c 00 00       	call   660d <chdir>
+     975:	83 c4 10             	add    $0x10,%esp
+     978:	85 c0                	test   %eax,%eax
+     97a:	79 1b                	jns    997 <dirtest+0xa9>
+    printf(stdout, "chdir .. failed\n");
+     97c:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     981:	83 ec 08             	sub    $0x8,%esp
+     984:	68 f5 76 00 00       	push   $0x76f5
+     989:	50                   	push   %eax
+     98a:	e8 2e 5e 00 00       	call   67bd <printf>
+     98f:	83 c4 10             	add    $0x10,%esp
+    exit();
+     992:	e8 c2 68 00 00       	call   7259 <exit>
+  }
+
+  if(unlink("dir0") < 0){
+     997:	83 ec 0c             	sub    $0xc,%esp
+     99a:	68 da 76 00 00       	push   $0x76da
+     99f:	e8 2d 5c 00 00       	call   65d1 <unlink>
+     9a4:	83 c4 10             	add    $0x10,%esp
+     9a7:	85 c0                	test   %eax,%eax
+     9a9:	79 1b                	jns    9c6 <dirtest+0xd8>
+    printf(stdout, "unlink dir0 failed\n");
+     9ab:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     9b0:	83 ec 08             	sub    $0x8,%esp
+     9b3:	68 06 77 00 00       	push   $0x7706
+     9b8:	50                   	push   %eax
+     9b9:	e8 ff 5d 00 00       	call   67bd <printf>
+     9be:	83 c4 10             	add    $0x10,%esp
+    exit();
+     9c1:	e8 93 68 00 00       	call   7259 <exit>
+  }
+  printf(stdout, "mkdir test ok\n");
+     9c6:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     9cb:	83 ec 08             	sub    $0x8,%esp
+     9ce:	68 1a 77 00 00       	push   $0x771a
+     9d3:	50                   	push   %eax
+     9d4:	e8 e4 5d 00 00       	call   67bd <printf>
+     9d9:	83 c4 10             	add    $0x10,%esp
+}
+     9dc:	90                   	nop
+     9dd:	c9                   	leave
+     9de:	c3                   	ret
+
+000009df <exectest>:
+
+void
+exectest(void)
+{
+     9df:	55                   	push   %ebp
+     9e0:	89 e5                	mov    %esp,%ebp
+     9e2:	83 ec 08             	sub    $0x8,%esp
+  printf(stdout, "exec test\n");
+     9e5:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     9ea:	83 ec 08             	sub    $0x8,%esp
+     9ed:	68 29 77 00 00       	push   $0x7729
+     9f2:	50                   	push   %eax
+     9f3:	e8 c5 5d 00 00       	call   67bd <printf>
+     9f8:	83 c4 10             	add    $0x10,%esp
+  if(exec("echo", echoargv) < 0){
+     9fb:	83 ec 08             	sub    $0x8,%esp
+     9fe:	68 34 9e 00 00       	push   $0x9e34
+     a03:	68 d4 72 00 00       	push   $0x72d4
+     a08:	e8 26 68 00 00       	call   7233 <exec>
+     a0d:	83 c4 10             	add    $0x10,%esp
+     a10:	85 c0                	test   %eax,%eax
+     a12:	79 1b                	jns    a2f <exectest+0x50>
+    printf(stdout, "exec echo failed\n");
+     a14:	a1 48 9e 00 00       	mov    0x9e48,%eax
+     a19:	83 ec 08             	sub    $0x8,%esp
+     a1c:	68 34 77 00 00       	push   $0x7734
+     a21:	50                   	push   %eax
+     a22:	e8 96 5d 00 00       	call   67bd <printf>
+     a27:	83 c4 10             	add    $0x10,%esp
+    exit();
+     a2a:	e8 2a 68 00 00       	call   7259 <exit>
+  }
+}
+     a2f:	90                   	nop
+     a30:	c9                   	leave
+     a31:	c3                   	ret
+
+00000a32 <pipe1>:
+
+// simple fork and pipe read/write
+
+void
+pipe1(void)
+{
+     a32:	55                   	push   %ebp
+     a33:	89 e5                	mov    %esp,%ebp
+     a35:	83 ec 28             	sub    $0x28,%esp
+  int fds[2], pid;
+  int seq, i, n, cc, total;
+
+  if(pipe(fds) != 0){
+     a38:	83 ec 0c             	sub    $0xc,%esp
+     a3b:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     a3e:	50                   	push   %eax
+     a3f:	e8 15 5b 00 00       	call   6559 <pipe>
+     a44:	83 c4 10             	add    $0x10,%esp
+     a47:	85 c0                	test   %eax,%eax
+     a49:	74 17                	je     a62 <pipe1+0x30>
+    printf(1, "pipe() failed\n");
+     a4b:	83 ec 08             	sub    $0x8,%esp
+     a4e:	68 46 77 00 00       	push   $0x7746
+     a53:	6a 01                	push   $0x1
+     a55:	e8 63 5d 00 00       	call   67bd <printf>
+     a5a:	83 c4 10             	add    $0x10,%esp
+    exit();
+     a5d:	e8 f7 67 00 00       	call   7259 <exit>
+  }
+  pid = fork();
+     a62:	e8 b2 67 00 00       	call   7219 <fork>
+     a67:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  seq = 0;
+     a6a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  if(pid == 0){
+     a71:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+     a75:	0f 85 89 00 00 00    	jne    b04 <pipe1+0xd2>
+    close(fds[0]);
+     a7b:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     a7e:	83 ec 0c             	sub    $0xc,%esp
+     a81:	50                   	push   %eax
+     a82:	e8 ea 67 00 00       	call   7271 <close>
+     a87:	83 c4 10             	add    $0x10,%esp
+    for(n = 0; n < 5; n++){
+     a8a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+     a91:	eb 66                	jmp    af9 <pipe1+0xc7>
+      for(i = 0; i < 1033; i++)
+     a93:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     a9a:	eb 19                	jmp    ab5 <pipe1+0x83>
+        buf[i] = seq++;
+     a9c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a9f:	8d 50 01             	lea    0x1(%eax),%edx
+     aa2:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     aa5:	89 c2                	mov    %eax,%edx
+     aa7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     aaa:	05 80 9e 00 00       	add    $0x9e80,%eax
+     aaf:	88 10                	mov    %dl,(%eax)
+      for(i = 0; i < 1033; i++)
+     ab1:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     ab5:	81 7d f0 08 04 00 00 	cmpl   $0x408,-0x10(%ebp)
+     abc:	7e de                	jle    a9c <pipe1+0x6a>
+      if(write(fds[1], buf, 1033) != 1033){
+     abe:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     ac1:	83 ec 04             	sub    $0x4,%esp
+     ac4:	68 09 04 00 00       	push   $0x409
+     ac9:	68 80 9e 00 00       	push   $0x9e80
+     ace:	50                   	push   %eax
+     acf:	e8 a3 5a 00 00       	call   6577 <write>
+     ad4:	83 c4 10             	add    $0x10,%esp
+     ad7:	3d 09 04 00 00       	cmp    $0x409,%eax
+     adc:	74 17                	je     af5 <pipe1+0xc3>
+        printf(1, "pipe1 oops 1\n");
+     ade:	83 ec 08             	sub    $0x8,%esp
+     ae1:	68 55 77 00 00       	push   $0x7755
+     ae6:	6a 01                	push   $0x1
+     ae8:	e8 d0 5c 00 00       	call   67bd <printf>
+     aed:	83 c4 10             	add    $0x10,%esp
+        exit();
+     af0:	e8 64 67 00 00       	call   7259 <exit>
+    for(n = 0; n < 5; n++){
+     af5:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     af9:	83 7d ec 04          	cmpl   $0x4,-0x14(%ebp)
+     afd:	7e 94                	jle    a93 <pipe1+0x61>
+      }
+    }
+    exit();
+     aff:	e8 55 67 00 00       	call   7259 <exit>
+  } else if(pid > 0){
+     b04:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+     b08:	0f 8e f4 00 00 00    	jle    c02 <pipe1+0x1d0>
+    close(fds[1]);
+     b0e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     b11:	83 ec 0c             	sub    $0xc,%esp
+     b14:	50                   	push   %eax
+     b15:	e8 57 67 00 00       	call   7271 <close>
+     b1a:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+     b1d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    cc = 1;
+     b24:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+    while((n = read(fds[0], buf, cc)) > 0){
+     b2b:	eb 66                	jmp    b93 <pipe1+0x161>
+      for(i = 0; i < n; i++){
+     b2d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     b34:	eb 3b                	jmp    b71 <pipe1+0x13f>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     b36:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b39:	05 80 9e 00 00       	add    $0x9e80,%eax
+     b3e:	0f b6 00             	movzbl (%eax),%eax
+     b41:	0f be c8             	movsbl %al,%ecx
+     b44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b47:	8d 50 01             	lea    0x1(%eax),%edx
+     b4a:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     b4d:	31 c8                	xor    %ecx,%eax
+     b4f:	0f b6 c0             	movzbl %al,%eax
+     b52:	85 c0                	test   %eax,%eax
+     b54:	74 17                	je     b6d <pipe1+0x13b>
+          printf(1, "pipe1 oops 2\n");
+     b56:	83 ec 08             	sub    $0x8,%esp
+     b59:	68 63 77 00 00       	push   $0x7763
+     b5e:	6a 01                	push   $0x1
+     b60:	e8 58 5c 00 00       	call   67bd <printf>
+     b65:	83 c4 10             	add    $0x10,%esp
+     b68:	e9 ac 00 00 00       	jmp    c19 <pipe1+0x1e7>
+      for(i = 0; i < n; i++){
+     b6d:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     b71:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b74:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+     b77:	7c bd                	jl     b36 <pipe1+0x104>
+          return;
+        }
+      }
+      total += n;
+     b79:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b7c:	01 45 e4             	add    %eax,-0x1c(%ebp)
+      cc = cc * 2;
+     b7f:	d1 65 e8             	shll   -0x18(%ebp)
+      if(cc > sizeof(buf))
+     b82:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     b85:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     b8a:	76 07                	jbe    b93 <pipe1+0x161>
+        cc = sizeof(buf);
+     b8c:	c7 45 e8 00 20 00 00 	movl   $0x2000,-0x18(%ebp)
+    while((n = read(fds[0], buf, cc)) > 0){
+     b93:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     b96:	83 ec 04             	sub    $0x4,%esp
+     b99:	ff 75 e8             	push   -0x18(%ebp)
+     b9c:	68 80 9e 00 00       	push   $0x9e80
+     ba1:	50                   	push   %eax
+     ba2:	e8 c1 59 00 00       	call   6568 <read>
+     ba7:	83 c4 10             	add    $0x10,%esp
+     baa:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     bad:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     bb1:	0f 8f 76 ff ff ff    	jg     b2d <pipe1+0xfb>
+    }
+    if(total != 5 * 1033){
+     bb7:	81 7d e4 2d 14 00 00 	cmpl   $0x142d,-0x1c(%ebp)
+     bbe:	74 1a                	je     bda <pipe1+0x1a8>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     bc0:	83 ec 04             	sub    $0x4,%esp
+     bc3:	ff 75 e4             	push   -0x1c(%ebp)
+     bc6:	68 71 77 00 00       	push   $0x7771
+     bcb:	6a 01                	push   $0x1
+     bcd:	e8 eb 5b 00 00       	call   67bd <printf>
+     bd2:	83 c4 10             	add    $0x10,%esp
+      exit();
+     bd5:	e8 7f 66 00 00       	call   7259 <exit>
+    }
+    close(fds[0]);
+     bda:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     bdd:	83 ec 0c             	sub    $0xc,%esp
+     be0:	50                   	push   %eax
+     be1:	e8 8b 66 00 00       	call   7271 <close>
+     be6:	83 c4 10             	add    $0x10,%esp
+    wait();
+     be9:	e8 5c 59 00 00       	call   654a <wait>
+  } else {
+    printf(1, "fork() failed\n");
+    exit();
+  }
+  printf(1, "pipe1 ok\n");
+     bee:	83 ec 08             	sub    $0x8,%esp
+     bf1:	68 97 77 00 00       	push   $0x7797
+     bf6:	6a 01                	push   $0x1
+     bf8:	e8 c0 5b 00 00       	call   67bd <printf>
+     bfd:	83 c4 10             	add    $0x10,%esp
+     c00:	eb 17                	jmp    c19 <pipe1+0x1e7>
+    printf(1, "fork() failed\n");
+     c02:	83 ec 08             	sub    $0x8,%esp
+     c05:	68 88 77 00 00       	push   $0x7788
+     c0a:	6a 01                	push   $0x1
+     c0c:	e8 ac 5b 00 00       	call   67bd <printf>
+     c11:	83 c4 10             	add    $0x10,%esp
+    exit();
+     c14:	e8 40 66 00 00       	call   7259 <exit>
+}
+     c19:	c9                   	leave
+     c1a:	c3                   	ret
+
+00000c1b <splicetest>:
+
+// splice a file into a pipe and the pipe into another file.
+void
+splicetest(void)
+{
+     c1b:	55                   	push   %ebp
+     c1c:	89 e5                	mov    %esp,%ebp
+     c1e:	53                   	push   %ebx
+     c1f:	83 ec 24             	sub    $0x24,%esp
+  int fd, fds[2], pid, i, n;
+
+  printf(1, "splice test\n");
+     c22:	83 ec 08             	sub    $0x8,%esp
+     c25:	68 a1 77 00 00       	push   $0x77a1
+     c2a:	6a 01                	push   $0x1
+     c2c:	e8 8c 5b 00 00       	call   67bd <printf>
+     c31:	83 c4 10             	add    $0x10,%esp
+
+  unlink("splicein");
+     c34:	83 ec 0c             	sub    $0xc,%esp
+     c37:	68 ae 77 00 00       	push   $0x77ae
+     c3c:	e8 90 59 00 00       	call   65d1 <unlink>
+     c41:	83 c4 10             	add    $0x10,%esp
+  unlink("spliceout");
+     c44:	83 ec 0c             	sub    $0xc,%esp
+     c47:	68 b7 77 00 00       	push   $0x77b7
+     c4c:	e8 80 59 00 00       	call   65d1 <unlink>
+     c51:	83 c4 10             	add    $0x10,%esp
+  fd = open("splicein", O_CREATE | O_RDWR);
+     c54:	83 ec 08             	sub    $0x8,%esp
+     c57:	68 02 02 00 00       	push   $0x202
+     c5c:	68 ae 77 00 00       	push   $0x77ae
+     c61:	e8 4d 59 00 00       	call   65b3 <open>
+     c66:	83 c4 10             	add    $0x10,%esp
+     c69:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < 3000; i++)
+     c6c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     c73:	eb 33                	jmp    ca8 <splicetest+0x8d>
+    buf[i] = i % 251;
+     c75:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+     c78:	ba bf bf 8c 82       	mov    $0x828cbfbf,%edx
+     c7d:	89 c8                	mov    %ecx,%eax
+     c7f:	f7 ea                	imul   %edx
+     c81:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+     c84:	c1 f8 07             	sar    $0x7,%eax
+     c87:	89 ca                	mov    %ecx,%edx
+     c89:	c1 fa 1f             	sar    $0x1f,%edx
+     c8c:	29 d0                	sub    %edx,%eax
+     c8e:	69 d0 fb 00 00 00    	imul   $0xfb,%eax,%edx
+     c94:	89 c8                	mov    %ecx,%eax
+     c96:	29 d0                	sub    %edx,%eax
+     c98:	89 c2                	mov    %eax,%edx
+     c9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c9d:	05 80 9e 00 00       	add    $0x9e80,%eax
+     ca2:	88 10                	mov    %dl,(%eax)
+  for(i = 0; i < 3000; i++)
+     ca4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     ca8:	81 7d f4 b7 0b 00 00 	cmpl   $0xbb7,-0xc(%ebp)
+     caf:	7e c4                	jle    c75 <splicetest+0x5a>
+  if(fd < 0 || write(fd, buf, 3000) != 3000){
+     cb1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     cb5:	78 1f                	js     cd6 <splicetest+0xbb>
+     cb7:	83 ec 04             	sub    $0x4,%esp
+     cba:	68 b8 0b 00 00       	push   $0xbb8
+     cbf:	68 80 9e 00 00       	push   $0x9e80
+     cc4:	ff 75 f0             	push   -0x10(%ebp)
+     cc7:	e8 ab 58 00 00       	call   6577 <write>
+     ccc:	83 c4 10             	add    $0x10,%esp
+     ccf:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+     cd4:	74 17                	je     ced <splicetest+0xd2>
+    printf(1, "splice create failed\n");
+     cd6:	83 ec 08             	sub    $0x8,%esp
+     cd9:	68 c1 77 00 00       	push   $0x77c1
+     cde:	6a 01                	push   $0x1
+     ce0:	e8 d8 5a 00 00       	call   67bd <printf>
+     ce5:	83 c4 10             	add    $0x10,%esp
+    exit();
+     ce8:	e8 6c 65 00 00       	call   7259 <exit>
+  }
+  close(fd);
+     ced:	83 ec 0c             	sub    $0xc,%esp
+     cf0:	ff 75 f0             	push   -0x10(%ebp)
+     cf3:	e8 79 65 00 00       	call   7271 <close>
+     cf8:	83 c4 10             	add    $0x10,%esp
+
+  if(pipe(fds) != 0){
+     cfb:	83 ec 0c             	sub    $0xc,%esp
+     cfe:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     d01:	50                   	push   %eax
+     d02:	e8 52 58 00 00       	call   6559 <pipe>
+     d07:	83 c4 10             	add    $0x10,%esp
+     d0a:	85 c0                	test   %eax,%eax
+     d0c:	74 17                	je     d25 <splicetest+0x10a>
+    printf(1, "pipe() failed\n");
+     d0e:	83 ec 08             	sub    $0x8,%esp
+     d11:	68 46 77 00 00       	push   $0x7746
+     d16:	6a 01                	push   $0x1
+     d18:	e8 a0 5a 00 00       	call   67bd <printf>
+     d1d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     d20:	e8 34 65 00 00       	call   7259 <exit>
+  }
+  pid = fork();
+     d25:	e8 ef 64 00 00       	call   7219 <fork>
+     d2a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(pid < 0){
+     d2d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     d31:	79 17                	jns    d4a <splicetest+0x12f>
+    printf(1, "fork failed\n");
+     d33:	83 ec 08             	sub    $0x8,%esp
+     d36:	68 75 73 00 00       	push   $0x7375
+     d3b:	6a 01                	push   $0x1
+     d3d:	e8 7b 5a 00 00       	call   67bd <printf>
+     d42:	83 c4 10             	add    $0x10,%esp
+    exit();
+     d45:	e8 0f 65 00 00       	call   7259 <exit>
+  }
+  if(pid == 0){
+     d4a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     d4e:	75 66                	jne    db6 <splicetest+0x19b>
+    close(fds[0]);
+     d50:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     d53:	83 ec 0c             	sub    $0xc,%esp
+     d56:	50                   	push   %eax
+     d57:	e8 15 65 00 00       	call   7271 <close>
+     d5c:	83 c4 10             	add    $0x10,%esp
+    fd = open("splicein", O_RDONLY);
+     d5f:	83 ec 08             	sub    $0x8,%esp
+     d62:	6a 00                	push   $0x0
+     d64:	68 ae 77 00 00       	push   $0x77ae
+     d69:	e8 45 58 00 00       	call   65b3 <open>
+     d6e:	83 c4 10             	add    $0x10,%esp
+     d71:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if((n = splice(fd, fds[1], 5000)) != 3000){
+     d74:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     d77:	83 ec 04             	sub    $0x4,%esp
+     d7a:	68 88 13 00 00       	push   $0x1388
+     d7f:	50                   	push   %eax
+     d80:	ff 75 f0             	push   -0x10(%ebp)
+     d83:	e8 2a 59 00 00       	call   66b2 <splice>
+     d88:	83 c4 10             	add    $0x10,%esp
+     d8b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     d8e:	81 7d e8 b8 0b 00 00 	cmpl   $0xbb8,-0x18(%ebp)
+     d95:	74 1a                	je     db1 <splicetest+0x196>
+      printf(1, "splice to pipe returned %d\n", n);
+     d97:	83 ec 04             	sub    $0x4,%esp
+     d9a:	ff 75 e8             	push   -0x18(%ebp)
+     d9d:	68 d7 77 00 00       	push   $0x77d7
+     da2:	6a 01                	push   $0x1
+     da4:	e8 14 5a 00 00       	call   67bd <printf>
+     da9:	83 c4 10             	add    $0x10,%esp
+      exit();
+     dac:	e8 a8 64 00 00       	call   7259 <exit>
+    }
+    exit();
+     db1:	e8 a3 64 00 00       	call   7259 <exit>
+  }
+  close(fds[1]);
+     db6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     db9:	83 ec 0c             	sub    $0xc,%esp
+     dbc:	50                   	push   %eax
+     dbd:	e8 af 64 00 00       	call   7271 <close>
+     dc2:	83 c4 10             	add    $0x10,%esp
+  fd = open("spliceout", O_CREATE | O_RDWR);
+     dc5:	83 ec 08             	sub    $0x8,%esp
+     dc8:	68 02 02 00 00       	push   $0x202
+     dcd:	68 b7 77 00 00       	push   $0x77b7
+     dd2:	e8 dc 57 00 00       	call   65b3 <open>
+     dd7:	83 c4 10             	add    $0x10,%esp
+     dda:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((n = splice(fds[0], fd, 5000)) != 3000){
+     ddd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     de0:	83 ec 04             	sub    $0x4,%esp
+     de3:	68 88 13 00 00       	push   $0x1388
+     de8:	ff 75 f0             	push   -0x10(%ebp)
+     deb:	50                   	push   %eax
+     dec:	e8 c1 58 00 00       	call   66b2 <splice>
+     df1:	83 c4 10             	add    $0x10,%esp
+     df4:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     df7:	81 7d e8 b8 0b 00 00 	cmpl   $0xbb8,-0x18(%ebp)
+     dfe:	74 1a                	je     e1a <splicetest+0x1ff>
+    printf(1, "splice from pipe returned %d\n", n);
+     e00:	83 ec 04             	sub    $0x4,%esp
+     e03:	ff 75 e8             	push   -0x18(%ebp)
+     e06:	68 f3 77 00 00       	push   $0x77f3
+     e0b:	6a 01                	push   $0x1
+     e0d:	e8 ab 59 00 00       	call   67bd <printf>
+     e12:	83 c4 10             	add    $0x10,%esp
+    exit();
+     e15:	e8 3f 64 00 00       	call   7259 <exit>
+  }
+  close(fds[0]);
+     e1a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     e1d:	83 ec 0c             	sub    $0xc,%esp
+     e20:	50                   	push   %eax
+     e21:	e8 4b 64 00 00       	call   7271 <close>
+     e26:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+     e29:	83 ec 0c             	sub    $0xc,%esp
+     e2c:	ff 75 f0             	push   -0x10(%ebp)
+     e2f:	e8 3d 64 00 00       	call   7271 <close>
+     e34:	83 c4 10             	add    $0x10,%esp
+  wait();
+     e37:	e8 0e 57 00 00       	call   654a <wait>
+
+  fd = open("spliceout", O_RDONLY);
+     e3c:	83 ec 08             	sub    $0x8,%esp
+     e3f:	6a 00                	push   $0x0
+     e41:	68 b7 77 00 00       	push   $0x77b7
+     e46:	e8 68 57 00 00       	call   65b3 <open>
+     e4b:	83 c4 10             	add    $0x10,%esp
+     e4e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  memset(buf, 0, 3000);
+     e51:	83 ec 04             	sub    $0x4,%esp
+     e54:	68 b8 0b 00 00       	push   $0xbb8
+     e59:	6a 00                	push   $0x0
+     e5b:	68 80 9e 00 00       	push   $0x9e80
+     e60:	e8 ce 52 00 00       	call   6133 <memset>
+     e65:	83 c4 10             	add    $0x10,%esp
+  if(read(fd, buf, 4000) != 3000){
+     e68:	83 ec 04             	sub    $0x4,%esp
+     e6b:	68 a0 0f 00 00       	push   $0xfa0
+     e70:	68 80 9e 00 00       	push   $0x9e80
+     e75:	ff 75 f0             	push   -0x10(%ebp)
+     e78:	e8 eb 56 00 00       	call   6568 <read>
+     e7d:	83 c4 10             	add    $0x10,%esp
+     e80:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+     e85:	74 17                	je     e9e <splicetest+0x283>
+    printf(1, "splice short file\n");
+     e87:	83 ec 08             	sub    $0x8,%esp
+     e8a:	68 11 78 00 00       	push   $0x7811
+     e8f:	6a 01                	push   $0x1
+     e91:	e8 27 59 00 00       	call   67bd <printf>
+     e96:	83 c4 10             	add    $0x10,%esp
+    exit();
+     e99:	e8 bb 63 00 00       	call   7259 <exit>
+  }
+  for(i = 0; i < 3000; i++){
+     e9e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     ea5:	eb 56                	jmp    efd <splicetest+0x2e2>
+    if((buf[i] & 0xff) != i % 251){
+     ea7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eaa:	05 80 9e 00 00       	add    $0x9e80,%eax
+     eaf:	0f b6 00             	movzbl (%eax),%eax
+     eb2:	0f be c0             	movsbl %al,%eax
+     eb5:	0f b6 d8             	movzbl %al,%ebx
+     eb8:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+     ebb:	ba bf bf 8c 82       	mov    $0x828cbfbf,%edx
+     ec0:	89 c8                	mov    %ecx,%eax
+     ec2:	f7 ea                	imul   %edx
+     ec4:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+     ec7:	c1 f8 07             	sar    $0x7,%eax
+     eca:	89 ca                	mov    %ecx,%edx
+     ecc:	c1 fa 1f             	sar    $0x1f,%edx
+     ecf:	29 d0                	sub    %edx,%eax
+     ed1:	69 d0 fb 00 00 00    	imul   $0xfb,%eax,%edx
+     ed7:	89 c8                	mov    %ecx,%eax
+     ed9:	29 d0                	sub    %edx,%eax
+     edb:	39 c3                	cmp    %eax,%ebx
+     edd:	74 1a                	je     ef9 <splicetest+0x2de>
+      printf(1, "splice wrong data at %d\n", i);
+     edf:	83 ec 04             	sub    $0x4,%esp
+     ee2:	ff 75 f4             	push   -0xc(%ebp)
+     ee5:	68 24 78 00 00       	push   $0x7824
+     eea:	6a 01                	push   $0x1
+     eec:	e8 cc 58 00 00       	call   67bd <printf>
+     ef1:	83 c4 10             	add    $0x10,%esp
+      exit();
+     ef4:	e8 60 63 00 00       	call   7259 <exit>
+  for(i = 0; i < 3000; i++){
+     ef9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     efd:	81 7d f4 b7 0b 00 00 	cmpl   $0xbb7,-0xc(%ebp)
+     f04:	7e a1                	jle    ea7 <splicetest+0x28c>
+    }
+  }
+  close(fd);
+     f06:	83 ec 0c             	sub    $0xc,%esp
+     f09:	ff 75 f0             	push   -0x10(%ebp)
+     f0c:	e8 60 63 00 00       	call   7271 <close>
+     f11:	83 c4 10             	add    $0x10,%esp
+  unlink("splicein");
+     f14:	83 ec 0c             	sub    $0xc,%esp
+     f17:	68 ae 77 00 00       	push   $0x77ae
+     f1c:	e8 b0 56 00 00       	call   65d1 <unlink>
+     f21:	83 c4 10             	add    $0x10,%esp
+  unlink("spliceout");
+     f24:	83 ec 0c             	sub    $0xc,%esp
+     f27:	68 b7 77 00 00       	push   $0x77b7
+     f2c:	e8 a0 56 00 00       	call   65d1 <unlink>
+     f31:	83 c4 10             	add    $0x10,%esp
+
+  // A device can't be spliced from, so cat falls back to read().
+  if(pipe(fds) != 0 || (fd = open("console", O_RDONLY)) < 0){
+     f34:	83 ec 0c             	sub    $0xc,%esp
+     f37:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     f3a:	50                   	push   %eax
+     f3b:	e8 19 56 00 00       	call   6559 <pipe>
+     f40:	83 c4 10             	add    $0x10,%esp
+     f43:	85 c0                	test   %eax,%eax
+     f45:	75 1b                	jne    f62 <splicetest+0x347>
+     f47:	83 ec 08             	sub    $0x8,%esp
+     f4a:	6a 00                	push   $0x0
+     f4c:	68 3d 78 00 00       	push   $0x783d
+     f51:	e8 5d 56 00 00       	call   65b3 <open>
+     f56:	83 c4 10             	add    $0x10,%esp
+     f59:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f5c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     f60:	79 17                	jns    f79 <splicetest+0x35e>
+    printf(1, "splice console setup failed\n");
+     f62:	83 ec 08             	sub    $0x8,%esp
+     f65:	68 45 78 00 00       	push   $0x7845
+     f6a:	6a 01                	push   $0x1
+     f6c:	e8 4c 58 00 00       	call   67bd <printf>
+     f71:	83 c4 10             	add    $0x10,%esp
+    exit();
+     f74:	e8 e0 62 00 00       	call   7259 <exit>
+  }
+  if((n = splice(fd, fds[1], 10)) != -1){
+     f79:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     f7c:	83 ec 04             	sub    $0x4,%esp
+     f7f:	6a 0a                	push   $0xa
+     f81:	50                   	push   %eax
+     f82:	ff 75 f0             	push   -0x10(%ebp)
+     f85:	e8 28 57 00 00       	call   66b2 <splice>
+     f8a:	83 c4 10             	add    $0x10,%esp
+     f8d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     f90:	83 7d e8 ff          	cmpl   $0xffffffff,-0x18(%ebp)
+     f94:	74 1a                	je     fb0 <splicetest+0x395>
+    printf(1, "splice from console returned %d\n", n);
+     f96:	83 ec 04             	sub    $0x4,%esp
+     f99:	ff 75 e8             	push   -0x18(%ebp)
+     f9c:	68 64 78 00 00       	push   $0x7864
+     fa1:	6a 01                	push   $0x1
+     fa3:	e8 15 58 00 00       	call   67bd <printf>
+     fa8:	83 c4 10             	add    $0x10,%esp
+    exit();
+     fab:	e8 a9 62 00 00       	call   7259 <exit>
+  }
+  close(fd);
+     fb0:	83 ec 0c             	sub    $0xc,%esp
+     fb3:	ff 75 f0             	push   -0x10(%ebp)
+     fb6:	e8 b6 62 00 00       	call   7271 <close>
+     fbb:	83 c4 10             	add    $0x10,%esp
+  close(fds[0]);
+     fbe:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     fc1:	83 ec 0c             	sub    $0xc,%esp
+     fc4:	50                   	push   %eax
+     fc5:	e8 a7 62 00 00       	call   7271 <close>
+     fca:	83 c4 10             	add    $0x10,%esp
+  close(fds[1]);
+     fcd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     fd0:	83 ec 0c             	sub    $0xc,%esp
+     fd3:	50                   	push   %eax
+     fd4:	e8 98 62 00 00       	call   7271 <close>
+     fd9:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "splice ok\n");
+     fdc:	83 ec 08             	sub    $0x8,%esp
+     fdf:	68 85 78 00 00       	push   $0x7885
+     fe4:	6a 01                	push   $0x1
+     fe6:	e8 d2 57 00 00       	call   67bd <printf>
+     feb:	83 c4 10             	add    $0x10,%esp
+}
+     fee:	90                   	nop
+     fef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ff2:	c9                   	leave
+     ff3:	c3                   	ret
+
+00000ff4 <preempt>:
+
+// meant to be run w/ at most two CPUs
+void
+preempt(void)
+{
+     ff4:	55                   	push   %ebp
+     ff5:	89 e5                	mov    %esp,%ebp
+     ff7:	83 ec 28             	sub    $0x28,%esp
+  int pid1, pid2, pid3;
+  int pfds[2];
+
+  printf(1, "preempt: ");
+     ffa:	83 ec 08             	sub    $0x8,%esp
+     ffd:	68 90 78 00 00       	push   $0x7890
+    1002:	6a 01                	push   $0x1
+    1004:	e8 b4 57 00 00       	call   67bd <printf>
+    1009:	83 c4 10             	add    $0x10,%esp
+  pid1 = fork();
+    100c:	e8 08 62 00 00       	call   7219 <fork>
+    1011:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid1 == 0)
+    1014:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1018:	75 03                	jne    101d <preempt+0x29>
+    for(;;)
+    101a:	90                   	nop
+    101b:	eb fd                	jmp    101a <preempt+0x26>
+      ;
+
+  pid2 = fork();
+    101d:	e8 f7 61 00 00       	call   7219 <fork>
+    1022:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid2 == 0)
+    1025:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1029:	75 03                	jne    102e <preempt+0x3a>
+    for(;;)
+    102b:	90                   	nop
+    102c:	eb fd                	jmp    102b <preempt+0x37>
+      ;
+
+  pipe(pfds);
+    102e:	83 ec 0c             	sub    $0xc,%esp
+    1031:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    1034:	50                   	push   %eax
+    1035:	e8 1f 55 00 00       	call   6559 <pipe>
+    103a:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+    103d:	e8 d7 61 00 00       	call   7219 <fork>
+    1042:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(pid3 == 0){
+    1045:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1049:	75 4e                	jne    1099 <preempt+0xa5>
+    close(pfds[0]);
+    104b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    104e:	83 ec 0c             	sub    $0xc,%esp
+    1051:	50                   	push   %eax
+    1052:	e8 1a 62 00 00       	call   7271 <close>
+    1057:	83 c4 10             	add    $0x10,%esp
+    if(write(pfds[1], "x", 1) != 1)
+    105a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    105d:	83 ec 04             	sub    $0x4,%esp
+    1060:	6a 01                	push   $0x1
+    1062:	68 9a 78 00 00       	push   $0x789a
+    1067:	50                   	push   %eax
+    1068:	e8 0a 55 00 00       	call   6577 <write>
+    106d:	83 c4 10             	add    $0x10,%esp
+    1070:	83 f8 01             	cmp    $0x1,%eax
+    1073:	74 12                	je     1087 <preempt+0x93>
+      printf(1, "preempt write error");
+    1075:	83 ec 08             	sub    $0x8,%esp
+    1078:	68 9c 78 00 00       	push   $0x789c
+    107d:	6a 01                	push   $0x1
+    107f:	e8 39 57 00 00       	call   67bd <printf>
+    1084:	83 c4 10             	add    $0x10,%esp
+    close(pfds[1]);
+    1087:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    108a:	83 ec 0c             	sub    $0xc,%esp
+    108d:	50                   	push   %eax
+    108e:	e8 de 61 00 00       	call   7271 <close>
+    1093:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+    1096:	90                   	nop
+    1097:	eb fd                	jmp    1096 <preempt+0xa2>
+      ;
+  }
+
+  close(pfds[1]);
+    1099:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    109c:	83 ec 0c             	sub    $0xc,%esp
+    109f:	50                   	push   %eax
+    10a0:	e8 cc 61 00 00       	call   7271 <close>
+    10a5:	83 c4 10             	add    $0x10,%esp
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+    10a8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    10ab:	83 ec 04             	sub    $0x4,%esp
+    10ae:	68 00 20 00 00       	push   $0x2000
+    10b3:	68 80 9e 00 00       	push   $0x9e80
+    10b8:	50                   	push   %eax
+    10b9:	e8 aa 54 00 00       	call   6568 <read>
+    10be:	83 c4 10             	add    $0x10,%esp
+    10c1:	83 f8 01             	cmp    $0x1,%eax
+    10c4:	74 14                	je     10da <preempt+0xe6>
+    printf(1, "preempt read error");
+    10c6:	83 ec 08             	sub    $0x8,%esp
+    10c9:	68 b0 78 00 00       	push   $0x78b0
+    10ce:	6a 01                	push   $0x1
+    10d0:	e8 e8 56 00 00       	call   67bd <printf>
+    10d5:	83 c4 10             	add    $0x10,%esp
+    10d8:	eb 7e                	jmp    1158 <preempt+0x164>
+    return;
+  }
+  close(pfds[0]);
+    10da:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    10dd:	83 ec 0c             	sub    $0xc,%esp
+    10e0:	50                   	push   %eax
+    10e1:	e8 8b 61 00 00       	call   7271 <close>
+    10e6:	83 c4 10             	add    $0x10,%esp
+  printf(1, "kill... ");
+    10e9:	83 ec 08             	sub    $0x8,%esp
+    10ec:	68 c3 78 00 00       	push   $0x78c3
+    10f1:	6a 01                	push   $0x1
+    10f3:	e8 c5 56 00 00       	call   67bd <printf>
+    10f8:	83 c4 10             	add    $0x10,%esp
+  kill(pid1);
+    10fb:	83 ec 0c             	sub    $0xc,%esp
+    10fe:	ff 75 f4             	push   -0xc(%ebp)
+    1101:	e8 8f 54 00 00       	call   6595 <kill>
+    1106:	83 c4 10             	add    $0x10,%esp
+  kill(pid2);
+    1109:	83 ec 0c             	sub    $0xc,%esp
+    110c:	ff 75 f0             	push   -0x10(%ebp)
+    110f:	e8 81 54 00 00       	call   6595 <kill>
+    1114:	83 c4 10             	add    $0x10,%esp
+  kill(pid3);
+    1117:	83 ec 0c             	sub    $0xc,%esp
+    111a:	ff 75 ec             	push   -0x14(%ebp)
+    111d:	e8 73 54 00 00       	call   6595 <kill>
+    1122:	83 c4 10             	add    $0x10,%esp
+  printf(1, "wait... ");
+    1125:	83 ec 08             	sub    $0x8,%esp
+    1128:	68 cc 78 00 00       	push   $0x78cc
+    112d:	6a 01                	push   $0x1
+    112f:	e8 89 56 00 00       	call   67bd <printf>
+    1134:	83 c4 10             	add    $0x10,%esp
+  wait();
+    1137:	e8 0e 54 00 00       	call   654a <wait>
+  wait();
+    113c:	e8 09 54 00 00       	call   654a <wait>
+  wait();
+    1141:	e8 04 54 00 00       	call   654a <wait>
+  printf(1, "preempt ok\n");
+    1146:	83 ec 08             	sub    $0x8,%esp
+    1149:	68 d5 78 00 00       	push   $0x78d5
+    114e:	6a 01                	push   $0x1
+    1150:	e8 68 56 00 00       	call   67bd <printf>
+    1155:	83 c4 10             	add    $0x10,%esp
+}
+    1158:	c9                   	leave
+    1159:	c3                   	ret
+
+0000115a <exitwait>:
+
+// try to find any races between exit and wait
+void
+exitwait(void)
+{
+    115a:	55                   	push   %ebp
+    115b:	89 e5                	mov    %esp,%ebp
+    115d:	83 ec 18             	sub    $0x18,%esp
+  int i, pid;
+
+  for(i = 0; i < 100; i++){
+    1160:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1167:	eb 4f                	jmp    11b8 <exitwait+0x5e>
+    pid = fork();
+    1169:	e8 ab 60 00 00       	call   7219 <fork>
+    116e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pid < 0){
+    1171:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1175:	79 14                	jns    118b <exitwait+0x31>
+      printf(1, "fork failed\n");
+    1177:	83 ec 08             	sub    $0x8,%esp
+    117a:	68 75 73 00 00       	push   $0x7375
+    117f:	6a 01                	push   $0x1
+    1181:	e8 37 56 00 00       	call   67bd <printf>
+    1186:	83 c4 10             	add    $0x10,%esp
+      return;
+    1189:	eb 45                	jmp    11d0 <exitwait+0x76>
+    }
+    if(pid){
+    118b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    118f:	74 1e                	je     11af <exitwait+0x55>
+      if(wait() != pid){
+    1191:	e8 b4 53 00 00       	call   654a <wait>
+    1196:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+    1199:	74 19                	je     11b4 <exitwait+0x5a>
+        printf(1, "wait wrong pid\n");
+    119b:	83 ec 08             	sub    $0x8,%esp
+    119e:	68 e1 78 00 00       	push   $0x78e1
+    11a3:	6a 01                	push   $0x1
+    11a5:	e8 13 56 00 00       	call   67bd <printf>
+    11aa:	83 c4 10             	add    $0x10,%esp
+        return;
+    11ad:	eb 21                	jmp    11d0 <exitwait+0x76>
+      }
+    } else {
+      exit();
+    11af:	e8 a5 60 00 00       	call   7259 <exit>
+  for(i = 0; i < 100; i++){
+    11b4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    11b8:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+    11bc:	7e ab                	jle    1169 <exitwait+0xf>
+    }
+  }
+  printf(1, "exitwait ok\n");
+    11be:	83 ec 08             	sub    $0x8,%esp
+    11c1:	68 f1 78 00 00       	push   $0x78f1
+    11c6:	6a 01                	push   $0x1
+    11c8:	e8 f0 55 00 00       	call   67bd <printf>
+    11cd:	83 c4 10             	add    $0x10,%esp
+}
+    11d0:	c9                   	leave
+    11d1:	c3                   	ret
+
+000011d2 <lockstattest>:
+
+// lockstat reports the process table lock as used.
+void
+lockstattest(void)
+{
+    11d2:	55                   	push   %ebp
+    11d3:	89 e5                	mov    %esp,%ebp
+    11d5:	83 ec 18             	sub    $0x18,%esp
+  static struct lockstat st[NLOCKSTAT];
+  int i, n;
+
+  printf(1, "lockstat test\n");
+    11d8:	83 ec 08             	sub    $0x8,%esp
+    11db:	68 fe 78 00 00       	push   $0x78fe
+    11e0:	6a 01                	push   $0x1
+    11e2:	e8 d6 55 00 00       	call   67bd <printf>
+    11e7:	83 c4 10             	add    $0x10,%esp
+
+  n = lockstat(st, NLOCKSTAT);
+    11ea:	83 ec 08             	sub    $0x8,%esp
+    11ed:	6a 40                	push   $0x40
+    11ef:	68 c0 e5 00 00       	push   $0xe5c0
+    11f4:	e8 04 55 00 00       	call   66fd <lockstat>
+    11f9:	83 c4 10             	add    $0x10,%esp
+    11fc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(n <= 0 || n > NLOCKSTAT){
+    11ff:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1203:	7e 06                	jle    120b <lockstattest+0x39>
+    1205:	83 7d f0 40          	cmpl   $0x40,-0x10(%ebp)
+    1209:	7e 1a                	jle    1225 <lockstattest+0x53>
+    printf(1, "lockstat returned %d\n", n);
+    120b:	83 ec 04             	sub    $0x4,%esp
+    120e:	ff 75 f0             	push   -0x10(%ebp)
+    1211:	68 0d 79 00 00       	push   $0x790d
+    1216:	6a 01                	push   $0x1
+    1218:	e8 a0 55 00 00       	call   67bd <printf>
+    121d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1220:	e8 34 60 00 00       	call   7259 <exit>
+  }
+  for(i = 0; i < n; i++)
+    1225:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    122c:	eb 24                	jmp    1252 <lockstattest+0x80>
+    if(strcmp(st[i].name, "ptable") == 0)
+    122e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1231:	6b c0 2c             	imul   $0x2c,%eax,%eax
+    1234:	05 c0 e5 00 00       	add    $0xe5c0,%eax
+    1239:	83 ec 08             	sub    $0x8,%esp
+    123c:	68 23 79 00 00       	push   $0x7923
+    1241:	50                   	push   %eax
+    1242:	e8 e2 4d 00 00       	call   6029 <strcmp>
+    1247:	83 c4 10             	add    $0x10,%esp
+    124a:	85 c0                	test   %eax,%eax
+    124c:	74 0e                	je     125c <lockstattest+0x8a>
+  for(i = 0; i < n; i++)
+    124e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1252:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1255:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+    1258:	7c d4                	jl     122e <lockstattest+0x5c>
+    125a:	eb 01                	jmp    125d <lockstattest+0x8b>
+      break;
+    125c:	90                   	nop
+  if(i == n || st[i].nacquire == 0){
+    125d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1260:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+    1263:	74 11                	je     1276 <lockstattest+0xa4>
+    1265:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1268:	6b c0 2c             	imul   $0x2c,%eax,%eax
+    126b:	05 d0 e5 00 00       	add    $0xe5d0,%eax
+    1270:	8b 00                	mov    (%eax),%eax
+    1272:	85 c0                	test   %eax,%eax
+    1274:	75 17                	jne    128d <lockstattest+0xbb>
+    printf(1, "lockstat has no ptable\n");
+    1276:	83 ec 08             	sub    $0x8,%esp
+    1279:	68 2a 79 00 00       	push   $0x792a
+    127e:	6a 01                	push   $0x1
+    1280:	e8 38 55 00 00       	call   67bd <printf>
+    1285:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1288:	e8 cc 5f 00 00       	call   7259 <exit>
+  }
+  if(lockstat(st, 1) > 1){
+    128d:	83 ec 08             	sub    $0x8,%esp
+    1290:	6a 01                	push   $0x1
+    1292:	68 c0 e5 00 00       	push   $0xe5c0
+    1297:	e8 61 54 00 00       	call   66fd <lockstat>
+    129c:	83 c4 10             	add    $0x10,%esp
+    129f:	83 f8 01             	cmp    $0x1,%eax
+    12a2:	7e 17                	jle    12bb <lockstattest+0xe9>
+    printf(1, "lockstat overran its buffer\n");
+    12a4:	83 ec 08             	sub    $0x8,%esp
+    12a7:	68 42 79 00 00       	push   $0x7942
+    12ac:	6a 01                	push   $0x1
+    12ae:	e8 0a 55 00 00       	call   67bd <printf>
+    12b3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    12b6:	e8 9e 5f 00 00       	call   7259 <exit>
+  }
+
+  printf(1, "lockstat ok\n");
+    12bb:	83 ec 08             	sub    $0x8,%esp
+    12be:	68 5f 79 00 00       	push   $0x795f
+    12c3:	6a 01                	push   $0x1
+    12c5:	e8 f3 54 00 00       	call   67bd <printf>
+    12ca:	83 c4 10             	add    $0x10,%esp
+}
+    12cd:	90                   	nop
+    12ce:	c9                   	leave
+    12cf:	c3                   	ret
+
+000012d0 <manyproctest>:
+
+// more processes than the old fixed table held can
+// be alive at once, and wait() finds every one.
+void
+manyproctest(void)
+{
+    12d0:	55                   	push   %ebp
+    12d1:	89 e5                	mov    %esp,%ebp
+    12d3:	83 ec 28             	sub    $0x28,%esp
+  int fds[2], i, n, pid;
+  char c;
+
+  printf(1, "many proc test\n");
+    12d6:	83 ec 08             	sub    $0x8,%esp
+    12d9:	68 6c 79 00 00       	push   $0x796c
+    12de:	6a 01                	push   $0x1
+    12e0:	e8 d8 54 00 00       	call   67bd <printf>
+    12e5:	83 c4 10             	add    $0x10,%esp
+
+  if(pipe(fds) != 0){
+    12e8:	83 ec 0c             	sub    $0xc,%esp
+    12eb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    12ee:	50                   	push   %eax
+    12ef:	e8 65 52 00 00       	call   6559 <pipe>
+    12f4:	83 c4 10             	add    $0x10,%esp
+    12f7:	85 c0                	test   %eax,%eax
+    12f9:	74 17                	je     1312 <manyproctest+0x42>
+    printf(1, "pipe failed\n");
+    12fb:	83 ec 08             	sub    $0x8,%esp
+    12fe:	68 7c 79 00 00       	push   $0x797c
+    1303:	6a 01                	push   $0x1
+    1305:	e8 b3 54 00 00       	call   67bd <printf>
+    130a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    130d:	e8 47 5f 00 00       	call   7259 <exit>
+  }
+  for(n = 0; n < 100; n++){
+    1312:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    1319:	eb 41                	jmp    135c <manyproctest+0x8c>
+    pid = fork();
+    131b:	e8 f9 5e 00 00       	call   7219 <fork>
+    1320:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(pid < 0)
+    1323:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1327:	78 3b                	js     1364 <manyproctest+0x94>
+      break;
+    if(pid == 0){
+    1329:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    132d:	75 29                	jne    1358 <manyproctest+0x88>
+      close(fds[1]);
+    132f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1332:	83 ec 0c             	sub    $0xc,%esp
+    1335:	50                   	push   %eax
+    1336:	e8 36 5f 00 00       	call   7271 <close>
+    133b:	83 c4 10             	add    $0x10,%esp
+      read(fds[0], &c, 1);  // returns once the parent closes fds[1]
+    133e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1341:	83 ec 04             	sub    $0x4,%esp
+    1344:	6a 01                	push   $0x1
+    1346:	8d 55 e3             	lea    -0x1d(%ebp),%edx
+    1349:	52                   	push   %edx
+    134a:	50                   	push   %eax
+    134b:	e8 18 52 00 00       	call   6568 <read>
+    1350:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1353:	e8 01 5f 00 00       	call   7259 <exit>
+  for(n = 0; n < 100; n++){
+    1358:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    135c:	83 7d f0 63          	cmpl   $0x63,-0x10(%ebp)
+    1360:	7e b9                	jle    131b <manyproctest+0x4b>
+    1362:	eb 01                	jmp    1365 <manyproctest+0x95>
+      break;
+    1364:	90                   	nop
+    }
+  }
+  close(fds[0]);
+    1365:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1368:	83 ec 0c             	sub    $0xc,%esp
+    136b:	50                   	push   %eax
+    136c:	e8 00 5f 00 00       	call   7271 <close>
+    1371:	83 c4 10             	add    $0x10,%esp
+  close(fds[1]);
+    1374:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1377:	83 ec 0c             	sub    $0xc,%esp
+    137a:	50                   	push   %eax
+    137b:	e8 f1 5e 00 00       	call   7271 <close>
+    1380:	83 c4 10             	add    $0x10,%esp
+  if(n < 100){
+    1383:	83 7d f0 63          	cmpl   $0x63,-0x10(%ebp)
+    1387:	7f 1a                	jg     13a3 <manyproctest+0xd3>
+    printf(1, "only %d procs\n", n);
+    1389:	83 ec 04             	sub    $0x4,%esp
+    138c:	ff 75 f0             	push   -0x10(%ebp)
+    138f:	68 89 79 00 00       	push   $0x7989
+    1394:	6a 01                	push   $0x1
+    1396:	e8 22 54 00 00       	call   67bd <printf>
+    139b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    139e:	e8 b6 5e 00 00       	call   7259 <exit>
+  }
+  for(i = 0; i < n; i++){
+    13a3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    13aa:	eb 24                	jmp    13d0 <manyproctest+0x100>
+    if(wait() < 0){
+    13ac:	e8 99 51 00 00       	call   654a <wait>
+    13b1:	85 c0                	test   %eax,%eax
+    13b3:	79 17                	jns    13cc <manyproctest+0xfc>
+      printf(1, "wait stopped early\n");
+    13b5:	83 ec 08             	sub    $0x8,%esp
+    13b8:	68 98 79 00 00       	push   $0x7998
+    13bd:	6a 01                	push   $0x1
+    13bf:	e8 f9 53 00 00       	call   67bd <printf>
+    13c4:	83 c4 10             	add    $0x10,%esp
+      exit();
+    13c7:	e8 8d 5e 00 00       	call   7259 <exit>
+  for(i = 0; i < n; i++){
+    13cc:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    13d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13d3:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+    13d6:	7c d4                	jl     13ac <manyproctest+0xdc>
+    }
+  }
+  if(wait() != -1){
+    13d8:	e8 6d 51 00 00       	call   654a <wait>
+    13dd:	83 f8 ff             	cmp    $0xffffffff,%eax
+    13e0:	74 17                	je     13f9 <manyproctest+0x129>
+    printf(1, "wait got too many\n");
+    13e2:	83 ec 08             	sub    $0x8,%esp
+    13e5:	68 ac 79 00 00       	push   $0x79ac
+    13ea:	6a 01                	push   $0x1
+    13ec:	e8 cc 53 00 00       	call   67bd <printf>
+    13f1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    13f4:	e8 60 5e 00 00       	call   7259 <exit>
+  }
+
+  printf(1, "many proc ok\n");
+    13f9:	83 ec 08             	sub    $0x8,%esp
+    13fc:	68 bf 79 00 00       	push   $0x79bf
+    1401:	6a 01                	push   $0x1
+    1403:	e8 b5 53 00 00       	call   67bd <printf>
+    1408:	83 c4 10             	add    $0x10,%esp
+}
+    140b:	90                   	nop
+    140c:	c9                   	leave
+    140d:	c3                   	ret
+
+0000140e <malloctest>:
+
+// small and large blocks keep their contents, and freeing a
+// big block at the top of the heap shrinks the process.
+void
+malloctest(void)
+{
+    140e:	55                   	push   %ebp
+    140f:	89 e5                	mov    %esp,%ebp
+    1411:	81 ec 28 01 00 00    	sub    $0x128,%esp
+  char *p[64], *big, *brk0;
+  int i, j, n;
+
+  printf(1, "malloc test\n");
+    1417:	83 ec 08             	sub    $0x8,%esp
+    141a:	68 cd 79 00 00       	push   $0x79cd
+    141f:	6a 01                	push   $0x1
+    1421:	e8 97 53 00 00       	call   67bd <printf>
+    1426:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < 64; i++){
+    1429:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1430:	e9 9e 00 00 00       	jmp    14d3 <malloctest+0xc5>
+    n = 1 + (i * 97) % 3000;
+    1435:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1438:	6b c8 61             	imul   $0x61,%eax,%ecx
+    143b:	ba f1 19 76 05       	mov    $0x57619f1,%edx
+    1440:	89 c8                	mov    %ecx,%eax
+    1442:	f7 ea                	imul   %edx
+    1444:	89 d0                	mov    %edx,%eax
+    1446:	c1 f8 06             	sar    $0x6,%eax
+    1449:	89 ca                	mov    %ecx,%edx
+    144b:	c1 fa 1f             	sar    $0x1f,%edx
+    144e:	29 d0                	sub    %edx,%eax
+    1450:	69 d0 b8 0b 00 00    	imul   $0xbb8,%eax,%edx
+    1456:	89 c8                	mov    %ecx,%eax
+    1458:	29 d0                	sub    %edx,%eax
+    145a:	83 c0 01             	add    $0x1,%eax
+    145d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if((p[i] = malloc(n)) == 0 || ((uint)p[i] & 7) != 0){
+    1460:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1463:	83 ec 0c             	sub    $0xc,%esp
+    1466:	50                   	push   %eax
+    1467:	e8 50 5a 00 00       	call   6ebc <malloc>
+    146c:	83 c4 10             	add    $0x10,%esp
+    146f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1472:	89 84 95 e4 fe ff ff 	mov    %eax,-0x11c(%ebp,%edx,4)
+    1479:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    147c:	8b 84 85 e4 fe ff ff 	mov    -0x11c(%ebp,%eax,4),%eax
+    1483:	85 c0                	test   %eax,%eax
+    1485:	74 11                	je     1498 <malloctest+0x8a>
+    1487:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    148a:	8b 84 85 e4 fe ff ff 	mov    -0x11c(%ebp,%eax,4),%eax
+    1491:	83 e0 07             	and    $0x7,%eax
+    1494:	85 c0                	test   %eax,%eax
+    1496:	74 1a                	je     14b2 <malloctest+0xa4>
+      printf(1, "malloc %d failed\n", n);
+    1498:	83 ec 04             	sub    $0x4,%esp
+    149b:	ff 75 e4             	push   -0x1c(%ebp)
+    149e:	68 da 79 00 00       	push   $0x79da
+    14a3:	6a 01                	push   $0x1
+    14a5:	e8 13 53 00 00       	call   67bd <printf>
+    14aa:	83 c4 10             	add    $0x10,%esp
+      exit();
+    14ad:	e8 a7 5d 00 00       	call   7259 <exit>
+    }
+    memset(p[i], i, n);
+    14b2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    14b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14b8:	8b 84 85 e4 fe ff ff 	mov    -0x11c(%ebp,%eax,4),%eax
+    14bf:	83 ec 04             	sub    $0x4,%esp
+    14c2:	52                   	push   %edx
+    14c3:	ff 75 f4             	push   -0xc(%ebp)
+    14c6:	50                   	push   %eax
+    14c7:	e8 67 4c 00 00       	call   6133 <memset>
+    14cc:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 64; i++){
+    14cf:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    14d3:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%ebp)
+    14d7:	0f 8e 58 ff ff ff    	jle    1435 <malloctest+0x27>
+  }
+  for(i = 0; i < 64; i += 2)
+    14dd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    14e4:	eb 1a                	jmp    1500 <malloctest+0xf2>
+    free(p[i]);
+    14e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14e9:	8b 84 85 e4 fe ff ff 	mov    -0x11c(%ebp,%eax,4),%eax
+    14f0:	83 ec 0c             	sub    $0xc,%esp
+    14f3:	50                   	push   %eax
+    14f4:	e8 69 59 00 00       	call   6e62 <free>
+    14f9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 64; i += 2)
+    14fc:	83 45 f4 02          	addl   $0x2,-0xc(%ebp)
+    1500:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%ebp)
+    1504:	7e e0                	jle    14e6 <malloctest+0xd8>
+  for(i = 1; i < 64; i += 2){
+    1506:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+    150d:	e9 8e 00 00 00       	jmp    15a0 <malloctest+0x192>
+    n = 1 + (i * 97) % 3000;
+    1512:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1515:	6b c8 61             	imul   $0x61,%eax,%ecx
+    1518:	ba f1 19 76 05       	mov    $0x57619f1,%edx
+    151d:	89 c8                	mov    %ecx,%eax
+    151f:	f7 ea                	imul   %edx
+    1521:	89 d0                	mov    %edx,%eax
+    1523:	c1 f8 06             	sar    $0x6,%eax
+    1526:	89 ca                	mov    %ecx,%edx
+    1528:	c1 fa 1f             	sar    $0x1f,%edx
+    152b:	29 d0                	sub    %edx,%eax
+    152d:	69 d0 b8 0b 00 00    	imul   $0xbb8,%eax,%edx
+    1533:	89 c8                	mov    %ecx,%eax
+    1535:	29 d0                	sub    %edx,%eax
+    1537:	83 c0 01             	add    $0x1,%eax
+    153a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    for(j = 0; j < n; j++)
+    153d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    1544:	eb 38                	jmp    157e <malloctest+0x170>
+      if(p[i][j] != i){
+    1546:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1549:	8b 94 85 e4 fe ff ff 	mov    -0x11c(%ebp,%eax,4),%edx
+    1550:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1553:	01 d0                	add    %edx,%eax
+    1555:	0f b6 00             	movzbl (%eax),%eax
+    1558:	0f be c0             	movsbl %al,%eax
+    155b:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    155e:	74 1a                	je     157a <malloctest+0x16c>
+        printf(1, "malloc block %d corrupted\n", i);
+    1560:	83 ec 04             	sub    $0x4,%esp
+    1563:	ff 75 f4             	push   -0xc(%ebp)
+    1566:	68 ec 79 00 00       	push   $0x79ec
+    156b:	6a 01                	push   $0x1
+    156d:	e8 4b 52 00 00       	call   67bd <printf>
+    1572:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1575:	e8 df 5c 00 00       	call   7259 <exit>
+    for(j = 0; j < n; j++)
+    157a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    157e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1581:	3b 45 e4             	cmp    -0x1c(%ebp),%eax
+    1584:	7c c0                	jl     1546 <malloctest+0x138>
+      }
+    free(p[i]);
+    1586:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1589:	8b 84 85 e4 fe ff ff 	mov    -0x11c(%ebp,%eax,4),%eax
+    1590:	83 ec 0c             	sub    $0xc,%esp
+    1593:	50                   	push   %eax
+    1594:	e8 c9 58 00 00       	call   6e62 <free>
+    1599:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < 64; i += 2){
+    159c:	83 45 f4 02          	addl   $0x2,-0xc(%ebp)
+    15a0:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%ebp)
+    15a4:	0f 8e 68 ff ff ff    	jle    1512 <malloctest+0x104>
+  }
+
+  brk0 = sbrk(0);
+    15aa:	83 ec 0c             	sub    $0xc,%esp
+    15ad:	6a 00                	push   $0x0
+    15af:	e8 86 50 00 00       	call   663a <sbrk>
+    15b4:	83 c4 10             	add    $0x10,%esp
+    15b7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((big = malloc(200000)) == 0){
+    15ba:	83 ec 0c             	sub    $0xc,%esp
+    15bd:	68 40 0d 03 00       	push   $0x30d40
+    15c2:	e8 f5 58 00 00       	call   6ebc <malloc>
+    15c7:	83 c4 10             	add    $0x10,%esp
+    15ca:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    15cd:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    15d1:	75 17                	jne    15ea <malloctest+0x1dc>
+    printf(1, "malloc big failed\n");
+    15d3:	83 ec 08             	sub    $0x8,%esp
+    15d6:	68 07 7a 00 00       	push   $0x7a07
+    15db:	6a 01                	push   $0x1
+    15dd:	e8 db 51 00 00       	call   67bd <printf>
+    15e2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    15e5:	e8 6f 5c 00 00       	call   7259 <exit>
+  }
+  memset(big, 1, 200000);
+    15ea:	83 ec 04             	sub    $0x4,%esp
+    15ed:	68 40 0d 03 00       	push   $0x30d40
+    15f2:	6a 01                	push   $0x1
+    15f4:	ff 75 e8             	push   -0x18(%ebp)
+    15f7:	e8 37 4b 00 00       	call   6133 <memset>
+    15fc:	83 c4 10             	add    $0x10,%esp
+  free(big);
+    15ff:	83 ec 0c             	sub    $0xc,%esp
+    1602:	ff 75 e8             	push   -0x18(%ebp)
+    1605:	e8 58 58 00 00       	call   6e62 <free>
+    160a:	83 c4 10             	add    $0x10,%esp
+  if(sbrk(0) >= brk0 + 200000){
+    160d:	83 ec 0c             	sub    $0xc,%esp
+    1610:	6a 00                	push   $0x0
+    1612:	e8 23 50 00 00       	call   663a <sbrk>
+    1617:	83 c4 10             	add    $0x10,%esp
+    161a:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    161d:	81 c2 40 0d 03 00    	add    $0x30d40,%edx
+    1623:	39 d0                	cmp    %edx,%eax
+    1625:	72 17                	jb     163e <malloctest+0x230>
+    printf(1, "free did not shrink the heap\n");
+    1627:	83 ec 08             	sub    $0x8,%esp
+    162a:	68 1a 7a 00 00       	push   $0x7a1a
+    162f:	6a 01                	push   $0x1
+    1631:	e8 87 51 00 00       	call   67bd <printf>
+    1636:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1639:	e8 1b 5c 00 00       	call   7259 <exit>
+  }
+
+  printf(1, "malloc ok\n");
+    163e:	83 ec 08             	sub    $0x8,%esp
+    1641:	68 38 7a 00 00       	push   $0x7a38
+    1646:	6a 01                	push   $0x1
+    1648:	e8 70 51 00 00       	call   67bd <printf>
+    164d:	83 c4 10             	add    $0x10,%esp
+}
+    1650:	90                   	nop
+    1651:	c9                   	leave
+    1652:	c3                   	ret
+
+00001653 <mem>:
+
+void
+mem(void)
+{
+    1653:	55                   	push   %ebp
+    1654:	89 e5                	mov    %esp,%ebp
+    1656:	83 ec 18             	sub    $0x18,%esp
+  void *m1, *m2;
+  int pid, ppid;
+
+  printf(1, "mem test\n");
+    1659:	83 ec 08             	sub    $0x8,%esp
+    165c:	68 43 7a 00 00       	push   $0x7a43
+    1661:	6a 01                	push   $0x1
+    1663:	e8 55 51 00 00       	call   67bd <printf>
+    1668:	83 c4 10             	add    $0x10,%esp
+  ppid = getpid();
+    166b:	e8 bb 4f 00 00       	call   662b <getpid>
+    1670:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((pid = fork()) == 0){
+    1673:	e8 a1 5b 00 00       	call   7219 <fork>
+    1678:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    167b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    167f:	0f 85 b7 00 00 00    	jne    173c <mem+0xe9>
+    m1 = 0;
+    1685:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    while((m2 = malloc(10001)) != 0){
+    168c:	eb 0e                	jmp    169c <mem+0x49>
+      *(char**)m2 = m1;
+    168e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1691:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1694:	89 10                	mov    %edx,(%eax)
+      m1 = m2;
+    1696:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1699:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    while((m2 = malloc(10001)) != 0){
+    169c:	83 ec 0c             	sub    $0xc,%esp
+    169f:	68 11 27 00 00       	push   $0x2711
+    16a4:	e8 13 58 00 00       	call   6ebc <malloc>
+    16a9:	83 c4 10             	add    $0x10,%esp
+    16ac:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    16af:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    16b3:	75 d9                	jne    168e <mem+0x3b>
+    }
+    while(m1){
+    16b5:	eb 1c                	jmp    16d3 <mem+0x80>
+      m2 = *(char**)m1;
+    16b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    16ba:	8b 00                	mov    (%eax),%eax
+    16bc:	89 45 e8             	mov    %eax,-0x18(%ebp)
+      free(m1);
+    16bf:	83 ec 0c             	sub    $0xc,%esp
+    16c2:	ff 75 f4             	push   -0xc(%ebp)
+    16c5:	e8 98 57 00 00       	call   6e62 <free>
+    16ca:	83 c4 10             	add    $0x10,%esp
+      m1 = m2;
+    16cd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    16d0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    while(m1){
+    16d3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    16d7:	75 de                	jne    16b7 <mem+0x64>
+    }
+    m1 = malloc(1024*20);
+    16d9:	83 ec 0c             	sub    $0xc,%esp
+    16dc:	68 00 50 00 00       	push   $0x5000
+    16e1:	e8 d6 57 00 00       	call   6ebc <malloc>
+    16e6:	83 c4 10             	add    $0x10,%esp
+    16e9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(m1 == 0){
+    16ec:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    16f0:	75 25                	jne    1717 <mem+0xc4>
+      printf(1, "couldn't allocate mem?!!\n");
+    16f2:	83 ec 08             	sub    $0x8,%esp
+    16f5:	68 4d 7a 00 00       	push   $0x7a4d
+    16fa:	6a 01                	push   $0x1
+    16fc:	e8 bc 50 00 00       	call   67bd <printf>
+    1701:	83 c4 10             	add    $0x10,%esp
+      kill(ppid);
+    1704:	83 ec 0c             	sub    $0xc,%esp
+    1707:	ff 75 f0             	push   -0x10(%ebp)
+    170a:	e8 86 4e 00 00       	call   6595 <kill>
+    170f:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1712:	e8 42 5b 00 00       	call   7259 <exit>
+    }
+    free(m1);
+    1717:	83 ec 0c             	sub    $0xc,%esp
+    171a:	ff 75 f4             	push   -0xc(%ebp)
+    171d:	e8 40 57 00 00       	call   6e62 <free>
+    1722:	83 c4 10             	add    $0x10,%esp
+    printf(1, "mem ok\n");
+    1725:	83 ec 08             	sub    $0x8,%esp
+    1728:	68 67 7a 00 00       	push   $0x7a67
+    172d:	6a 01                	push   $0x1
+    172f:	e8 89 50 00 00       	call   67bd <printf>
+    1734:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1737:	e8 1d 5b 00 00       	call   7259 <exit>
+  } else {
+    wait();
+    173c:	e8 09 4e 00 00       	call   654a <wait>
+  }
+}
+    1741:	90                   	nop
+    1742:	c9                   	leave
+    1743:	c3                   	ret
+
+00001744 <sharedfd>:
+
+// two processes write to the same file descriptor
+// is the offset shared? does inode locking work?
+void
+sharedfd(void)
+{
+    1744:	55                   	push   %ebp
+    1745:	89 e5                	mov    %esp,%ebp
+    1747:	83 ec 38             	sub    $0x38,%esp
+  int fd, pid, i, n, nc, np;
+  char buf[10];
+
+  printf(1, "sharedfd test\n");
+    174a:	83 ec 08             	sub    $0x8,%esp
+    174d:	68 6f 7a 00 00       	push   $0x7a6f
+    1752:	6a 01                	push   $0x1
+    1754:	e8 64 50 00 00       	call   67bd <printf>
+    1759:	83 c4 10             	add    $0x10,%esp
+
+  unlink("sharedfd");
+    175c:	83 ec 0c             	sub    $0xc,%esp
+    175f:	68 7e 7a 00 00       	push   $0x7a7e
+    1764:	e8 68 4e 00 00       	call   65d1 <unlink>
+    1769:	83 c4 10             	add    $0x10,%esp
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    176c:	83 ec 08             	sub    $0x8,%esp
+    176f:	68 02 02 00 00       	push   $0x202
+    1774:	68 7e 7a 00 00       	push   $0x7a7e
+    1779:	e8 35 4e 00 00       	call   65b3 <open>
+    177e:	83 c4 10             	add    $0x10,%esp
+    1781:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(fd < 0){
+    1784:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1788:	79 17                	jns    17a1 <sharedfd+0x5d>
+    printf(1, "fstests: cannot open sharedfd for writing");
+    178a:	83 ec 08             	sub    $0x8,%esp
+    178d:	68 88 7a 00 00       	push   $0x7a88
+    1792:	6a 01                	push   $0x1
+    1794:	e8 24 50 00 00       	call   67bd <printf>
+    1799:	83 c4 10             	add    $0x10,%esp
+    return;
+    179c:	e9 84 01 00 00       	jmp    1925 <sharedfd+0x1e1>
+  }
+  pid = fork();
+    17a1:	e8 73 5a 00 00       	call   7219 <fork>
+    17a6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    17a9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    17ad:	75 07                	jne    17b6 <sharedfd+0x72>
+    17af:	b8 63 00 00 00       	mov    $0x63,%eax
+    17b4:	eb 05                	jmp    17bb <sharedfd+0x77>
+    17b6:	b8 70 00 00 00       	mov    $0x70,%eax
+    17bb:	83 ec 04             	sub    $0x4,%esp
+    17be:	6a 0a                	push   $0xa
+    17c0:	50                   	push   %eax
+    17c1:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+    17c4:	50                   	push   %eax
+    17c5:	e8 69 49 00 00       	call   6133 <memset>
+    17ca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 1000; i++){
+    17cd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    17d4:	eb 31                	jmp    1807 <sharedfd+0xc3>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    17d6:	83 ec 04             	sub    $0x4,%esp
+    17d9:	6a 0a                	push   $0xa
+    17db:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+    17de:	50                   	push   %eax
+    17df:	ff 75 e8             	push   -0x18(%ebp)
+    17e2:	e8 90 4d 00 00       	call   6577 <write>
+    17e7:	83 c4 10             	add    $0x10,%esp
+    17ea:	83 f8 0a             	cmp    $0xa,%eax
+    17ed:	74 14                	je     1803 <sharedfd+0xbf>
+      printf(1, "fstests: write sharedfd failed\n");
+    17ef:	83 ec 08             	sub    $0x8,%esp
+    17f2:	68 b4 7a 00 00       	push   $0x7ab4
+    17f7:	6a 01                	push   $0x1
+    17f9:	e8 bf 4f 00 00       	call   67bd <printf>
+    17fe:	83 c4 10             	add    $0x10,%esp
+      break;
+    1801:	eb 0d                	jmp    1810 <sharedfd+0xcc>
+  for(i = 0; i < 1000; i++){
+    1803:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1807:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+    180e:	7e c6                	jle    17d6 <sharedfd+0x92>
+    }
+  }
+  if(pid == 0)
+    1810:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    1814:	75 05                	jne    181b <sharedfd+0xd7>
+    exit();
+    1816:	e8 3e 5a 00 00       	call   7259 <exit>
+  else
+    wait();
+    181b:	e8 2a 4d 00 00       	call   654a <wait>
+  close(fd);
+    1820:	83 ec 0c             	sub    $0xc,%esp
+    1823:	ff 75 e8             	push   -0x18(%ebp)
+    1826:	e8 46 5a 00 00       	call   7271 <close>
+    182b:	83 c4 10             	add    $0x10,%esp
+  fd = open("sharedfd", 0);
+    182e:	83 ec 08             	sub    $0x8,%esp
+    1831:	6a 00                	push   $0x0
+    1833:	68 7e 7a 00 00       	push   $0x7a7e
+    1838:	e8 76 4d 00 00       	call   65b3 <open>
+    183d:	83 c4 10             	add    $0x10,%esp
+    1840:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(fd < 0){
+    1843:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1847:	79 17                	jns    1860 <sharedfd+0x11c>
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    1849:	83 ec 08             	sub    $0x8,%esp
+    184c:	68 d4 7a 00 00       	push   $0x7ad4
+    1851:	6a 01                	push   $0x1
+    1853:	e8 65 4f 00 00       	call   67bd <printf>
+    1858:	83 c4 10             	add    $0x10,%esp
+    return;
+    185b:	e9 c5 00 00 00       	jmp    1925 <sharedfd+0x1e1>
+  }
+  nc = np = 0;
+    1860:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    1867:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    186a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    186d:	eb 3b                	jmp    18aa <sharedfd+0x166>
+    for(i = 0; i < sizeof(buf); i++){
+    186f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1876:	eb 2a                	jmp    18a2 <sharedfd+0x15e>
+      if(buf[i] == 'c')
+    1878:	8d 55 d6             	lea    -0x2a(%ebp),%edx
+    187b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    187e:	01 d0                	add    %edx,%eax
+    1880:	0f b6 00             	movzbl (%eax),%eax
+    1883:	3c 63                	cmp    $0x63,%al
+    1885:	75 04                	jne    188b <sharedfd+0x147>
+        nc++;
+    1887:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+      if(buf[i] == 'p')
+    188b:	8d 55 d6             	lea    -0x2a(%ebp),%edx
+    188e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1891:	01 d0                	add    %edx,%eax
+    1893:	0f b6 00             	movzbl (%eax),%eax
+    1896:	3c 70                	cmp    $0x70,%al
+    1898:	75 04                	jne    189e <sharedfd+0x15a>
+        np++;
+    189a:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    for(i = 0; i < sizeof(buf); i++){
+    189e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    18a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    18a5:	83 f8 09             	cmp    $0x9,%eax
+    18a8:	76 ce                	jbe    1878 <sharedfd+0x134>
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    18aa:	83 ec 04             	sub    $0x4,%esp
+    18ad:	6a 0a                	push   $0xa
+    18af:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+    18b2:	50                   	push   %eax
+    18b3:	ff 75 e8             	push   -0x18(%ebp)
+    18b6:	e8 ad 4c 00 00       	call   6568 <read>
+    18bb:	83 c4 10             	add    $0x10,%esp
+    18be:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    18c1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    18c5:	7f a8                	jg     186f <sharedfd+0x12b>
+    }
+  }
+  close(fd);
+    18c7:	83 ec 0c             	sub    $0xc,%esp
+    18ca:	ff 75 e8             	push   -0x18(%ebp)
+    18cd:	e8 9f 59 00 00       	call   7271 <close>
+    18d2:	83 c4 10             	add    $0x10,%esp
+  unlink("sharedfd");
+    18d5:	83 ec 0c             	sub    $0xc,%esp
+    18d8:	68 7e 7a 00 00       	push   $0x7a7e
+    18dd:	e8 ef 4c 00 00       	call   65d1 <unlink>
+    18e2:	83 c4 10             	add    $0x10,%esp
+  if(nc == 10000 && np == 10000){
+    18e5:	81 7d f0 10 27 00 00 	cmpl   $0x2710,-0x10(%ebp)
+    18ec:	75 1d                	jne    190b <sharedfd+0x1c7>
+    18ee:	81 7d ec 10 27 00 00 	cmpl   $0x2710,-0x14(%ebp)
+    18f5:	75 14                	jne    190b <sharedfd+0x1c7>
+    printf(1, "sharedfd ok\n");
+    18f7:	83 ec 08             	sub    $0x8,%esp
+    18fa:	68 ff 7a 00 00       	push   $0x7aff
+    18ff:	6a 01                	push   $0x1
+    1901:	e8 b7 4e 00 00       	call   67bd <printf>
+    1906:	83 c4 10             	add    $0x10,%esp
+    1909:	eb 1a                	jmp    1925 <sharedfd+0x1e1>
+  } else {
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    190b:	ff 75 ec             	push   -0x14(%ebp)
+    190e:	ff 75 f0             	push   -0x10(%ebp)
+    1911:	68 0c 7b 00 00       	push   $0x7b0c
+    1916:	6a 01                	push   $0x1
+    1918:	e8 a0 4e 00 00       	call   67bd <printf>
+    191d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1920:	e8 34 59 00 00       	call   7259 <exit>
+  }
+}
+    1925:	c9                   	leave
+    1926:	c3                   	ret
+
+00001927 <fourfiles>:
+
+// four processes write different files at the same
+// time, to test block allocation.
+void
+fourfiles(void)
+{
+    1927:	55                   	push   %ebp
+    1928:	89 e5                	mov    %esp,%ebp
+    192a:	83 ec 38             	sub    $0x38,%esp
+  int fd, pid, i, j, n, total, pi;
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    192d:	c7 45 c8 21 7b 00 00 	movl   $0x7b21,-0x38(%ebp)
+    1934:	c7 45 cc 24 7b 00 00 	movl   $0x7b24,-0x34(%ebp)
+    193b:	c7 45 d0 27 7b 00 00 	movl   $0x7b27,-0x30(%ebp)
+    1942:	c7 45 d4 2a 7b 00 00 	movl   $0x7b2a,-0x2c(%ebp)
+  char *fname;
+
+  printf(1, "fourfiles test\n");
+    1949:	83 ec 08             	sub    $0x8,%esp
+    194c:	68 2d 7b 00 00       	push   $0x7b2d
+    1951:	6a 01                	push   $0x1
+    1953:	e8 65 4e 00 00       	call   67bd <printf>
+    1958:	83 c4 10             	add    $0x10,%esp
+
+  for(pi = 0; pi < 4; pi++){
+    195b:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+    1962:	e9 f0 00 00 00       	jmp    1a57 <fourfiles+0x130>
+    fname = names[pi];
+    1967:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    196a:	8b 44 85 c8          	mov    -0x38(%ebp,%eax,4),%eax
+    196e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    unlink(fname);
+    1971:	83 ec 0c             	sub    $0xc,%esp
+    1974:	ff 75 e4             	push   -0x1c(%ebp)
+    1977:	e8 55 4c 00 00       	call   65d1 <unlink>
+    197c:	83 c4 10             	add    $0x10,%esp
+
+    pid = fork();
+    197f:	e8 95 58 00 00       	call   7219 <fork>
+    1984:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    if(pid < 0){
+    1987:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+    198b:	79 17                	jns    19a4 <fourfiles+0x7d>
+      printf(1, "fork failed\n");
+    198d:	83 ec 08             	sub    $0x8,%esp
+    1990:	68 75 73 00 00       	push   $0x7375
+    1995:	6a 01                	push   $0x1
+    1997:	e8 21 4e 00 00       	call   67bd <printf>
+    199c:	83 c4 10             	add    $0x10,%esp
+      exit();
+    199f:	e8 b5 58 00 00       	call   7259 <exit>
+    }
+
+    if(pid == 0){
+    19a4:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+    19a8:	0f 85 a5 00 00 00    	jne    1a53 <fourfiles+0x12c>
+      fd = open(fname, O_CREATE | O_RDWR);
+    19ae:	83 ec 08             	sub    $0x8,%esp
+    19b1:	68 02 02 00 00       	push   $0x202
+    19b6:	ff 75 e4             	push   -0x1c(%ebp)
+    19b9:	e8 f5 4b 00 00       	call   65b3 <open>
+    19be:	83 c4 10             	add    $0x10,%esp
+    19c1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      if(fd < 0){
+    19c4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    19c8:	79 17                	jns    19e1 <fourfiles+0xba>
+        printf(1, "create failed\n");
+    19ca:	83 ec 08             	sub    $0x8,%esp
+    19cd:	68 3d 7b 00 00       	push   $0x7b3d
+    19d2:	6a 01                	push   $0x1
+    19d4:	e8 e4 4d 00 00       	call   67bd <printf>
+    19d9:	83 c4 10             	add    $0x10,%esp
+        exit();
+    19dc:	e8 78 58 00 00       	call   7259 <exit>
+      }
+      
+      memset(buf, '0'+pi, 512);
+    19e1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    19e4:	83 c0 30             	add    $0x30,%eax
+    19e7:	83 ec 04             	sub    $0x4,%esp
+    19ea:	68 00 02 00 00       	push   $0x200
+    19ef:	50                   	push   %eax
+    19f0:	68 80 9e 00 00       	push   $0x9e80
+    19f5:	e8 39 47 00 00       	call   6133 <memset>
+    19fa:	83 c4 10             	add    $0x10,%esp
+      for(i = 0; i < 12; i++){
+    19fd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1a04:	eb 42                	jmp    1a48 <fourfiles+0x121>
+        if((n = write(fd, buf, 500)) != 500){
+    1a06:	83 ec 04             	sub    $0x4,%esp
+    1a09:	68 f4 01 00 00       	push   $0x1f4
+    1a0e:	68 80 9e 00 00       	push   $0x9e80
+    1a13:	ff 75 e0             	push   -0x20(%ebp)
+    1a16:	e8 5c 4b 00 00       	call   6577 <write>
+    1a1b:	83 c4 10             	add    $0x10,%esp
+    1a1e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    1a21:	81 7d dc f4 01 00 00 	cmpl   $0x1f4,-0x24(%ebp)
+    1a28:	74 1a                	je     1a44 <fourfiles+0x11d>
+          printf(1, "write failed %d\n", n);
+    1a2a:	83 ec 04             	sub    $0x4,%esp
+    1a2d:	ff 75 dc             	push   -0x24(%ebp)
+    1a30:	68 4c 7b 00 00       	push   $0x7b4c
+    1a35:	6a 01                	push   $0x1
+    1a37:	e8 81 4d 00 00       	call   67bd <printf>
+    1a3c:	83 c4 10             	add    $0x10,%esp
+          exit();
+    1a3f:	e8 15 58 00 00       	call   7259 <exit>
+      for(i = 0; i < 12; i++){
+    1a44:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1a48:	83 7d f4 0b          	cmpl   $0xb,-0xc(%ebp)
+    1a4c:	7e b8                	jle    1a06 <fourfiles+0xdf>
+        }
+      }
+      exit();
+    1a4e:	e8 06 58 00 00       	call   7259 <exit>
+  for(pi = 0; pi < 4; pi++){
+    1a53:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+    1a57:	83 7d e8 03          	cmpl   $0x3,-0x18(%ebp)
+    1a5b:	0f 8e 06 ff ff ff    	jle    1967 <fourfiles+0x40>
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+    1a61:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+    1a68:	eb 09                	jmp    1a73 <fourfiles+0x14c>
+    wait();
+    1a6a:	e8 db 4a 00 00       	call   654a <wait>
+  for(pi = 0; pi < 4; pi++){
+    1a6f:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+    1a73:	83 7d e8 03          	cmpl   $0x3,-0x18(%ebp)
+    1a77:	7e f1                	jle    1a6a <fourfiles+0x143>
+  }
+
+  for(i = 0; i < 2; i++){
+    1a79:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1a80:	e9 d4 00 00 00       	jmp    1b59 <fourfiles+0x232>
+    fname = names[i];
+    1a85:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1a88:	8b 44 85 c8          	mov    -0x38(%ebp,%eax,4),%eax
+    1a8c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    fd = open(fname, 0);
+    1a8f:	83 ec 08             	sub    $0x8,%esp
+    1a92:	6a 00                	push   $0x0
+    1a94:	ff 75 e4             	push   -0x1c(%ebp)
+    1a97:	e8 17 4b 00 00       	call   65b3 <open>
+    1a9c:	83 c4 10             	add    $0x10,%esp
+    1a9f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    total = 0;
+    1aa2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    1aa9:	eb 4a                	jmp    1af5 <fourfiles+0x1ce>
+      for(j = 0; j < n; j++){
+    1aab:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    1ab2:	eb 33                	jmp    1ae7 <fourfiles+0x1c0>
+        if(buf[j] != '0'+i){
+    1ab4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1ab7:	05 80 9e 00 00       	add    $0x9e80,%eax
+    1abc:	0f b6 00             	movzbl (%eax),%eax
+    1abf:	0f be d0             	movsbl %al,%edx
+    1ac2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ac5:	83 c0 30             	add    $0x30,%eax
+    1ac8:	39 c2                	cmp    %eax,%edx
+    1aca:	74 17                	je     1ae3 <fourfiles+0x1bc>
+          printf(1, "wrong char\n");
+    1acc:	83 ec 08             	sub    $0x8,%esp
+    1acf:	68 5d 7b 00 00       	push   $0x7b5d
+    1ad4:	6a 01                	push   $0x1
+    1ad6:	e8 e2 4c 00 00       	call   67bd <printf>
+    1adb:	83 c4 10             	add    $0x10,%esp
+          exit();
+    1ade:	e8 76 57 00 00       	call   7259 <exit>
+      for(j = 0; j < n; j++){
+    1ae3:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    1ae7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1aea:	3b 45 dc             	cmp    -0x24(%ebp),%eax
+    1aed:	7c c5                	jl     1ab4 <fourfiles+0x18d>
+        }
+      }
+      total += n;
+    1aef:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    1af2:	01 45 ec             	add    %eax,-0x14(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    1af5:	83 ec 04             	sub    $0x4,%esp
+    1af8:	68 00 20 00 00       	push   $0x2000
+    1afd:	68 80 9e 00 00       	push   $0x9e80
+    1b02:	ff 75 e0             	push   -0x20(%ebp)
+    1b05:	e8 5e 4a 00 00       	call   6568 <read>
+    1b0a:	83 c4 10             	add    $0x10,%esp
+    1b0d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    1b10:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+    1b14:	7f 95                	jg     1aab <fourfiles+0x184>
+    }
+    close(fd);
+    1b16:	83 ec 0c             	sub    $0xc,%esp
+    1b19:	ff 75 e0             	push   -0x20(%ebp)
+    1b1c:	e8 50 57 00 00       	call   7271 <close>
+    1b21:	83 c4 10             	add    $0x10,%esp
+    if(total != 12*500){
+    1b24:	81 7d ec 70 17 00 00 	cmpl   $0x1770,-0x14(%ebp)
+    1b2b:	74 1a                	je     1b47 <fourfiles+0x220>
+      printf(1, "wrong length %d\n", total);
+    1b2d:	83 ec 04             	sub    $0x4,%esp
+    1b30:	ff 75 ec             	push   -0x14(%ebp)
+    1b33:	68 69 7b 00 00       	push   $0x7b69
+    1b38:	6a 01                	push   $0x1
+    1b3a:	e8 7e 4c 00 00       	call   67bd <printf>
+    1b3f:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1b42:	e8 12 57 00 00       	call   7259 <exit>
+    }
+    unlink(fname);
+    1b47:	83 ec 0c             	sub    $0xc,%esp
+    1b4a:	ff 75 e4             	push   -0x1c(%ebp)
+    1b4d:	e8 7f 4a 00 00       	call   65d1 <unlink>
+    1b52:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 2; i++){
+    1b55:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1b59:	83 7d f4 01          	cmpl   $0x1,-0xc(%ebp)
+    1b5d:	0f 8e 22 ff ff ff    	jle    1a85 <fourfiles+0x15e>
+  }
+
+  printf(1, "fourfiles ok\n");
+    1b63:	83 ec 08             	sub    $0x8,%esp
+    1b66:	68 7a 7b 00 00       	push   $0x7b7a
+    1b6b:	6a 01                	push   $0x1
+    1b6d:	e8 4b 4c 00 00       	call   67bd <printf>
+    1b72:	83 c4 10             	add    $0x10,%esp
+}
+    1b75:	90                   	nop
+    1b76:	c9                   	leave
+    1b77:	c3                   	ret
+
+00001b78 <sharedread>:
+
+// four processes read one file at the same time, holding
+// its inode shared, while another appends to it.
+void
+sharedread(void)
+{
+    1b78:	55                   	push   %ebp
+    1b79:	89 e5                	mov    %esp,%ebp
+    1b7b:	83 ec 28             	sub    $0x28,%esp
+  int fd, pid, i, j, n, off, pi;
+  char c;
+
+  printf(1, "shared read test\n");
+    1b7e:	83 ec 08             	sub    $0x8,%esp
+    1b81:	68 88 7b 00 00       	push   $0x7b88
+    1b86:	6a 01                	push   $0x1
+    1b88:	e8 30 4c 00 00       	call   67bd <printf>
+    1b8d:	83 c4 10             	add    $0x10,%esp
+
+  unlink("sr");
+    1b90:	83 ec 0c             	sub    $0xc,%esp
+    1b93:	68 9a 7b 00 00       	push   $0x7b9a
+    1b98:	e8 34 4a 00 00       	call   65d1 <unlink>
+    1b9d:	83 c4 10             	add    $0x10,%esp
+  fd = open("sr", O_CREATE | O_RDWR);
+    1ba0:	83 ec 08             	sub    $0x8,%esp
+    1ba3:	68 02 02 00 00       	push   $0x202
+    1ba8:	68 9a 7b 00 00       	push   $0x7b9a
+    1bad:	e8 01 4a 00 00       	call   65b3 <open>
+    1bb2:	83 c4 10             	add    $0x10,%esp
+    1bb5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(fd < 0){
+    1bb8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    1bbc:	79 17                	jns    1bd5 <sharedread+0x5d>
+    printf(1, "create sr failed\n");
+    1bbe:	83 ec 08             	sub    $0x8,%esp
+    1bc1:	68 9d 7b 00 00       	push   $0x7b9d
+    1bc6:	6a 01                	push   $0x1
+    1bc8:	e8 f0 4b 00 00       	call   67bd <printf>
+    1bcd:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1bd0:	e8 84 56 00 00       	call   7259 <exit>
+  }
+  for(i = 0; i < 40; i++){
+    1bd5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1bdc:	eb 72                	jmp    1c50 <sharedread+0xd8>
+    memset(buf, 'a' + i%26, 512);
+    1bde:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    1be1:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+    1be6:	89 c8                	mov    %ecx,%eax
+    1be8:	f7 ea                	imul   %edx
+    1bea:	89 d0                	mov    %edx,%eax
+    1bec:	c1 f8 03             	sar    $0x3,%eax
+    1bef:	89 ca                	mov    %ecx,%edx
+    1bf1:	c1 fa 1f             	sar    $0x1f,%edx
+    1bf4:	29 d0                	sub    %edx,%eax
+    1bf6:	6b d0 1a             	imul   $0x1a,%eax,%edx
+    1bf9:	89 c8                	mov    %ecx,%eax
+    1bfb:	29 d0                	sub    %edx,%eax
+    1bfd:	83 c0 61             	add    $0x61,%eax
+    1c00:	83 ec 04             	sub    $0x4,%esp
+    1c03:	68 00 02 00 00       	push   $0x200
+    1c08:	50                   	push   %eax
+    1c09:	68 80 9e 00 00       	push   $0x9e80
+    1c0e:	e8 20 45 00 00       	call   6133 <memset>
+    1c13:	83 c4 10             	add    $0x10,%esp
+    if(write(fd, buf, 512) != 512){
+    1c16:	83 ec 04             	sub    $0x4,%esp
+    1c19:	68 00 02 00 00       	push   $0x200
+    1c1e:	68 80 9e 00 00       	push   $0x9e80
+    1c23:	ff 75 e4             	push   -0x1c(%ebp)
+    1c26:	e8 4c 49 00 00       	call   6577 <write>
+    1c2b:	83 c4 10             	add    $0x10,%esp
+    1c2e:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1c33:	74 17                	je     1c4c <sharedread+0xd4>
+      printf(1, "write sr failed\n");
+    1c35:	83 ec 08             	sub    $0x8,%esp
+    1c38:	68 af 7b 00 00       	push   $0x7baf
+    1c3d:	6a 01                	push   $0x1
+    1c3f:	e8 79 4b 00 00       	call   67bd <printf>
+    1c44:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1c47:	e8 0d 56 00 00       	call   7259 <exit>
+  for(i = 0; i < 40; i++){
+    1c4c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1c50:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+    1c54:	7e 88                	jle    1bde <sharedread+0x66>
+    }
+  }
+  close(fd);
+    1c56:	83 ec 0c             	sub    $0xc,%esp
+    1c59:	ff 75 e4             	push   -0x1c(%ebp)
+    1c5c:	e8 10 56 00 00       	call   7271 <close>
+    1c61:	83 c4 10             	add    $0x10,%esp
+
+  for(pi = 0; pi < 5; pi++){
+    1c64:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+    1c6b:	e9 0d 02 00 00       	jmp    1e7d <sharedread+0x305>
+    pid = fork();
+    1c70:	e8 a4 55 00 00       	call   7219 <fork>
+    1c75:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(pid < 0){
+    1c78:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    1c7c:	79 17                	jns    1c95 <sharedread+0x11d>
+      printf(1, "fork failed\n");
+    1c7e:	83 ec 08             	sub    $0x8,%esp
+    1c81:	68 75 73 00 00       	push   $0x7375
+    1c86:	6a 01                	push   $0x1
+    1c88:	e8 30 4b 00 00       	call   67bd <printf>
+    1c8d:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1c90:	e8 c4 55 00 00       	call   7259 <exit>
+    }
+    if(pid == 0 && pi == 4){
+    1c95:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    1c99:	0f 85 c5 00 00 00    	jne    1d64 <sharedread+0x1ec>
+    1c9f:	83 7d e8 04          	cmpl   $0x4,-0x18(%ebp)
+    1ca3:	0f 85 bb 00 00 00    	jne    1d64 <sharedread+0x1ec>
+      fd = open("sr", O_WRONLY);
+    1ca9:	83 ec 08             	sub    $0x8,%esp
+    1cac:	6a 01                	push   $0x1
+    1cae:	68 9a 7b 00 00       	push   $0x7b9a
+    1cb3:	e8 fb 48 00 00       	call   65b3 <open>
+    1cb8:	83 c4 10             	add    $0x10,%esp
+    1cbb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      lseek(fd, 0, SEEK_END);
+    1cbe:	83 ec 04             	sub    $0x4,%esp
+    1cc1:	6a 02                	push   $0x2
+    1cc3:	6a 00                	push   $0x0
+    1cc5:	ff 75 e4             	push   -0x1c(%ebp)
+    1cc8:	e8 12 4a 00 00       	call   66df <lseek>
+    1ccd:	83 c4 10             	add    $0x10,%esp
+      for(i = 40; i < 80; i++){
+    1cd0:	c7 45 f4 28 00 00 00 	movl   $0x28,-0xc(%ebp)
+    1cd7:	eb 72                	jmp    1d4b <sharedread+0x1d3>
+        memset(buf, 'a' + i%26, 512);
+    1cd9:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    1cdc:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+    1ce1:	89 c8                	mov    %ecx,%eax
+    1ce3:	f7 ea                	imul   %edx
+    1ce5:	89 d0                	mov    %edx,%eax
+    1ce7:	c1 f8 03             	sar    $0x3,%eax
+    1cea:	89 ca                	mov    %ecx,%edx
+    1cec:	c1 fa 1f             	sar    $0x1f,%edx
+    1cef:	29 d0                	sub    %edx,%eax
+    1cf1:	6b d0 1a             	imul   $0x1a,%eax,%edx
+    1cf4:	89 c8                	mov    %ecx,%eax
+    1cf6:	29 d0                	sub    %edx,%eax
+    1cf8:	83 c0 61             	add    $0x61,%eax
+    1cfb:	83 ec 04             	sub    $0x4,%esp
+    1cfe:	68 00 02 00 00       	push   $0x200
+    1d03:	50                   	push   %eax
+    1d04:	68 80 9e 00 00       	push   $0x9e80
+    1d09:	e8 25 44 00 00       	call   6133 <memset>
+    1d0e:	83 c4 10             	add    $0x10,%esp
+        if(write(fd, buf, 512) != 512){
+    1d11:	83 ec 04             	sub    $0x4,%esp
+    1d14:	68 00 02 00 00       	push   $0x200
+    1d19:	68 80 9e 00 00       	push   $0x9e80
+    1d1e:	ff 75 e4             	push   -0x1c(%ebp)
+    1d21:	e8 51 48 00 00       	call   6577 <write>
+    1d26:	83 c4 10             	add    $0x10,%esp
+    1d29:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1d2e:	74 17                	je     1d47 <sharedread+0x1cf>
+          printf(1, "append sr failed\n");
+    1d30:	83 ec 08             	sub    $0x8,%esp
+    1d33:	68 c0 7b 00 00       	push   $0x7bc0
+    1d38:	6a 01                	push   $0x1
+    1d3a:	e8 7e 4a 00 00       	call   67bd <printf>
+    1d3f:	83 c4 10             	add    $0x10,%esp
+          exit();
+    1d42:	e8 12 55 00 00       	call   7259 <exit>
+      for(i = 40; i < 80; i++){
+    1d47:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1d4b:	83 7d f4 4f          	cmpl   $0x4f,-0xc(%ebp)
+    1d4f:	7e 88                	jle    1cd9 <sharedread+0x161>
+        }
+      }
+      close(fd);
+    1d51:	83 ec 0c             	sub    $0xc,%esp
+    1d54:	ff 75 e4             	push   -0x1c(%ebp)
+    1d57:	e8 15 55 00 00       	call   7271 <close>
+    1d5c:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1d5f:	e8 f5 54 00 00       	call   7259 <exit>
+    }
+    if(pid == 0){
+    1d64:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    1d68:	0f 85 0b 01 00 00    	jne    1e79 <sharedread+0x301>
+      for(j = 0; j < 4; j++){
+    1d6e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    1d75:	e9 f0 00 00 00       	jmp    1e6a <sharedread+0x2f2>
+        fd = open("sr", 0);
+    1d7a:	83 ec 08             	sub    $0x8,%esp
+    1d7d:	6a 00                	push   $0x0
+    1d7f:	68 9a 7b 00 00       	push   $0x7b9a
+    1d84:	e8 2a 48 00 00       	call   65b3 <open>
+    1d89:	83 c4 10             	add    $0x10,%esp
+    1d8c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        off = 0;
+    1d8f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+        while((n = read(fd, buf, 700)) > 0){
+    1d96:	eb 78                	jmp    1e10 <sharedread+0x298>
+          for(i = 0; i < n; i++, off++){
+    1d98:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1d9f:	eb 67                	jmp    1e08 <sharedread+0x290>
+            c = 'a' + (off/512)%26;
+    1da1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1da4:	8d 90 ff 01 00 00    	lea    0x1ff(%eax),%edx
+    1daa:	85 c0                	test   %eax,%eax
+    1dac:	0f 48 c2             	cmovs  %edx,%eax
+    1daf:	c1 f8 09             	sar    $0x9,%eax
+    1db2:	89 c1                	mov    %eax,%ecx
+    1db4:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+    1db9:	89 c8                	mov    %ecx,%eax
+    1dbb:	f7 ea                	imul   %edx
+    1dbd:	89 d0                	mov    %edx,%eax
+    1dbf:	c1 f8 03             	sar    $0x3,%eax
+    1dc2:	89 ca                	mov    %ecx,%edx
+    1dc4:	c1 fa 1f             	sar    $0x1f,%edx
+    1dc7:	29 d0                	sub    %edx,%eax
+    1dc9:	6b d0 1a             	imul   $0x1a,%eax,%edx
+    1dcc:	89 c8                	mov    %ecx,%eax
+    1dce:	29 d0                	sub    %edx,%eax
+    1dd0:	83 c0 61             	add    $0x61,%eax
+    1dd3:	88 45 db             	mov    %al,-0x25(%ebp)
+            if(buf[i] != c){
+    1dd6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1dd9:	05 80 9e 00 00       	add    $0x9e80,%eax
+    1dde:	0f b6 00             	movzbl (%eax),%eax
+    1de1:	38 45 db             	cmp    %al,-0x25(%ebp)
+    1de4:	74 1a                	je     1e00 <sharedread+0x288>
+              printf(1, "shared read: wrong byte at %d\n", off);
+    1de6:	83 ec 04             	sub    $0x4,%esp
+    1de9:	ff 75 ec             	push   -0x14(%ebp)
+    1dec:	68 d4 7b 00 00       	push   $0x7bd4
+    1df1:	6a 01                	push   $0x1
+    1df3:	e8 c5 49 00 00       	call   67bd <printf>
+    1df8:	83 c4 10             	add    $0x10,%esp
+              exit();
+    1dfb:	e8 59 54 00 00       	call   7259 <exit>
+          for(i = 0; i < n; i++, off++){
+    1e00:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1e04:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    1e08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1e0b:	3b 45 dc             	cmp    -0x24(%ebp),%eax
+    1e0e:	7c 91                	jl     1da1 <sharedread+0x229>
+        while((n = read(fd, buf, 700)) > 0){
+    1e10:	83 ec 04             	sub    $0x4,%esp
+    1e13:	68 bc 02 00 00       	push   $0x2bc
+    1e18:	68 80 9e 00 00       	push   $0x9e80
+    1e1d:	ff 75 e4             	push   -0x1c(%ebp)
+    1e20:	e8 43 47 00 00       	call   6568 <read>
+    1e25:	83 c4 10             	add    $0x10,%esp
+    1e28:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    1e2b:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+    1e2f:	0f 8f 63 ff ff ff    	jg     1d98 <sharedread+0x220>
+            }
+          }
+        }
+        close(fd);
+    1e35:	83 ec 0c             	sub    $0xc,%esp
+    1e38:	ff 75 e4             	push   -0x1c(%ebp)
+    1e3b:	e8 31 54 00 00       	call   7271 <close>
+    1e40:	83 c4 10             	add    $0x10,%esp
+        if(off < 40*512){
+    1e43:	81 7d ec ff 4f 00 00 	cmpl   $0x4fff,-0x14(%ebp)
+    1e4a:	7f 1a                	jg     1e66 <sharedread+0x2ee>
+          printf(1, "shared read: short file %d\n", off);
+    1e4c:	83 ec 04             	sub    $0x4,%esp
+    1e4f:	ff 75 ec             	push   -0x14(%ebp)
+    1e52:	68 f3 7b 00 00       	push   $0x7bf3
+    1e57:	6a 01                	push   $0x1
+    1e59:	e8 5f 49 00 00       	call   67bd <printf>
+    1e5e:	83 c4 10             	add    $0x10,%esp
+          exit();
+    1e61:	e8 f3 53 00 00       	call   7259 <exit>
+      for(j = 0; j < 4; j++){
+    1e66:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    1e6a:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    1e6e:	0f 8e 06 ff ff ff    	jle    1d7a <sharedread+0x202>
+        }
+      }
+      exit();
+    1e74:	e8 e0 53 00 00       	call   7259 <exit>
+  for(pi = 0; pi < 5; pi++){
+    1e79:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+    1e7d:	83 7d e8 04          	cmpl   $0x4,-0x18(%ebp)
+    1e81:	0f 8e e9 fd ff ff    	jle    1c70 <sharedread+0xf8>
+    }
+  }
+  for(pi = 0; pi < 5; pi++)
+    1e87:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+    1e8e:	eb 09                	jmp    1e99 <sharedread+0x321>
+    wait();
+    1e90:	e8 b5 46 00 00       	call   654a <wait>
+  for(pi = 0; pi < 5; pi++)
+    1e95:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+    1e99:	83 7d e8 04          	cmpl   $0x4,-0x18(%ebp)
+    1e9d:	7e f1                	jle    1e90 <sharedread+0x318>
+  unlink("sr");
+    1e9f:	83 ec 0c             	sub    $0xc,%esp
+    1ea2:	68 9a 7b 00 00       	push   $0x7b9a
+    1ea7:	e8 25 47 00 00       	call   65d1 <unlink>
+    1eac:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "shared read ok\n");
+    1eaf:	83 ec 08             	sub    $0x8,%esp
+    1eb2:	68 0f 7c 00 00       	push   $0x7c0f
+    1eb7:	6a 01                	push   $0x1
+    1eb9:	e8 ff 48 00 00       	call   67bd <printf>
+    1ebe:	83 c4 10             	add    $0x10,%esp
+}
+    1ec1:	90                   	nop
+    1ec2:	c9                   	leave
+    1ec3:	c3                   	ret
+
+00001ec4 <createdelete>:
+
+// four processes create and delete different files in same directory
+void
+createdelete(void)
+{
+    1ec4:	55                   	push   %ebp
+    1ec5:	89 e5                	mov    %esp,%ebp
+    1ec7:	83 ec 38             	sub    $0x38,%esp
+  enum { N = 20 };
+  int pid, i, fd, pi;
+  char name[32];
+
+  printf(1, "createdelete test\n");
+    1eca:	83 ec 08             	sub    $0x8,%esp
+    1ecd:	68 1f 7c 00 00       	push   $0x7c1f
+    1ed2:	6a 01                	push   $0x1
+    1ed4:	e8 e4 48 00 00       	call   67bd <printf>
+    1ed9:	83 c4 10             	add    $0x10,%esp
+
+  for(pi = 0; pi < 4; pi++){
+    1edc:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    1ee3:	e9 f6 00 00 00       	jmp    1fde <createdelete+0x11a>
+    pid = fork();
+    1ee8:	e8 2c 53 00 00       	call   7219 <fork>
+    1eed:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    1ef0:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1ef4:	79 17                	jns    1f0d <createdelete+0x49>
+      printf(1, "fork failed\n");
+    1ef6:	83 ec 08             	sub    $0x8,%esp
+    1ef9:	68 75 73 00 00       	push   $0x7375
+    1efe:	6a 01                	push   $0x1
+    1f00:	e8 b8 48 00 00       	call   67bd <printf>
+    1f05:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1f08:	e8 4c 53 00 00       	call   7259 <exit>
+    }
+
+    if(pid == 0){
+    1f0d:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1f11:	0f 85 c3 00 00 00    	jne    1fda <createdelete+0x116>
+      name[0] = 'p' + pi;
+    1f17:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1f1a:	83 c0 70             	add    $0x70,%eax
+    1f1d:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[2] = '\0';
+    1f20:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+      for(i = 0; i < N; i++){
+    1f24:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1f2b:	e9 9b 00 00 00       	jmp    1fcb <createdelete+0x107>
+        name[1] = '0' + i;
+    1f30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1f33:	83 c0 30             	add    $0x30,%eax
+    1f36:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    1f39:	83 ec 08             	sub    $0x8,%esp
+    1f3c:	68 02 02 00 00       	push   $0x202
+    1f41:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1f44:	50                   	push   %eax
+    1f45:	e8 69 46 00 00       	call   65b3 <open>
+    1f4a:	83 c4 10             	add    $0x10,%esp
+    1f4d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+        if(fd < 0){
+    1f50:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1f54:	79 17                	jns    1f6d <createdelete+0xa9>
+          printf(1, "create failed\n");
+    1f56:	83 ec 08             	sub    $0x8,%esp
+    1f59:	68 3d 7b 00 00       	push   $0x7b3d
+    1f5e:	6a 01                	push   $0x1
+    1f60:	e8 58 48 00 00       	call   67bd <printf>
+    1f65:	83 c4 10             	add    $0x10,%esp
+          exit();
+    1f68:	e8 ec 52 00 00       	call   7259 <exit>
+        }
+        close(fd);
+    1f6d:	83 ec 0c             	sub    $0xc,%esp
+    1f70:	ff 75 ec             	push   -0x14(%ebp)
+    1f73:	e8 f9 52 00 00       	call   7271 <close>
+    1f78:	83 c4 10             	add    $0x10,%esp
+        if(i > 0 && (i % 2 ) == 0){
+    1f7b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1f7f:	7e 46                	jle    1fc7 <createdelete+0x103>
+    1f81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1f84:	83 e0 01             	and    $0x1,%eax
+    1f87:	85 c0                	test   %eax,%eax
+    1f89:	75 3c                	jne    1fc7 <createdelete+0x103>
+          name[1] = '0' + (i / 2);
+    1f8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1f8e:	89 c2                	mov    %eax,%edx
+    1f90:	c1 ea 1f             	shr    $0x1f,%edx
+    1f93:	01 d0                	add    %edx,%eax
+    1f95:	d1 f8                	sar    %eax
+    1f97:	83 c0 30             	add    $0x30,%eax
+    1f9a:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    1f9d:	83 ec 0c             	sub    $0xc,%esp
+    1fa0:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1fa3:	50                   	push   %eax
+    1fa4:	e8 28 46 00 00       	call   65d1 <unlink>
+    1fa9:	83 c4 10             	add    $0x10,%esp
+    1fac:	85 c0                	test   %eax,%eax
+    1fae:	79 17                	jns    1fc7 <createdelete+0x103>
+            printf(1, "unlink failed\n");
+    1fb0:	83 ec 08             	sub    $0x8,%esp
+    1fb3:	68 f8 73 00 00       	push   $0x73f8
+    1fb8:	6a 01                	push   $0x1
+    1fba:	e8 fe 47 00 00       	call   67bd <printf>
+    1fbf:	83 c4 10             	add    $0x10,%esp
+            exit();
+    1fc2:	e8 92 52 00 00       	call   7259 <exit>
+      for(i = 0; i < N; i++){
+    1fc7:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1fcb:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    1fcf:	0f 8e 5b ff ff ff    	jle    1f30 <createdelete+0x6c>
+          }
+        }
+      }
+      exit();
+    1fd5:	e8 7f 52 00 00       	call   7259 <exit>
+  for(pi = 0; pi < 4; pi++){
+    1fda:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    1fde:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    1fe2:	0f 8e 00 ff ff ff    	jle    1ee8 <createdelete+0x24>
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+    1fe8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    1fef:	eb 09                	jmp    1ffa <createdelete+0x136>
+    wait();
+    1ff1:	e8 54 45 00 00       	call   654a <wait>
+  for(pi = 0; pi < 4; pi++){
+    1ff6:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    1ffa:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    1ffe:	7e f1                	jle    1ff1 <createdelete+0x12d>
+  }
+
+  name[0] = name[1] = name[2] = 0;
+    2000:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    2004:	0f b6 45 ca          	movzbl -0x36(%ebp),%eax
+    2008:	88 45 c9             	mov    %al,-0x37(%ebp)
+    200b:	0f b6 45 c9          	movzbl -0x37(%ebp),%eax
+    200f:	88 45 c8             	mov    %al,-0x38(%ebp)
+  for(i = 0; i < N; i++){
+    2012:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2019:	e9 b2 00 00 00       	jmp    20d0 <createdelete+0x20c>
+    for(pi = 0; pi < 4; pi++){
+    201e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    2025:	e9 98 00 00 00       	jmp    20c2 <createdelete+0x1fe>
+      name[0] = 'p' + pi;
+    202a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    202d:	83 c0 70             	add    $0x70,%eax
+    2030:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    2033:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2036:	83 c0 30             	add    $0x30,%eax
+    2039:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    203c:	83 ec 08             	sub    $0x8,%esp
+    203f:	6a 00                	push   $0x0
+    2041:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    2044:	50                   	push   %eax
+    2045:	e8 69 45 00 00       	call   65b3 <open>
+    204a:	83 c4 10             	add    $0x10,%esp
+    204d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    2050:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2054:	74 06                	je     205c <createdelete+0x198>
+    2056:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    205a:	7e 21                	jle    207d <createdelete+0x1b9>
+    205c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2060:	79 1b                	jns    207d <createdelete+0x1b9>
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    2062:	83 ec 04             	sub    $0x4,%esp
+    2065:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    2068:	50                   	push   %eax
+    2069:	68 34 7c 00 00       	push   $0x7c34
+    206e:	6a 01                	push   $0x1
+    2070:	e8 48 47 00 00       	call   67bd <printf>
+    2075:	83 c4 10             	add    $0x10,%esp
+        exit();
+    2078:	e8 dc 51 00 00       	call   7259 <exit>
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    207d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2081:	7e 27                	jle    20aa <createdelete+0x1e6>
+    2083:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    2087:	7f 21                	jg     20aa <createdelete+0x1e6>
+    2089:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    208d:	78 1b                	js     20aa <createdelete+0x1e6>
+        printf(1, "oops createdelete %s did exist\n", name);
+    208f:	83 ec 04             	sub    $0x4,%esp
+    2092:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    2095:	50                   	push   %eax
+    2096:	68 58 7c 00 00       	push   $0x7c58
+    209b:	6a 01                	push   $0x1
+    209d:	e8 1b 47 00 00       	call   67bd <printf>
+    20a2:	83 c4 10             	add    $0x10,%esp
+        exit();
+    20a5:	e8 af 51 00 00       	call   7259 <exit>
+      }
+      if(fd >= 0)
+    20aa:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    20ae:	78 0e                	js     20be <createdelete+0x1fa>
+        close(fd);
+    20b0:	83 ec 0c             	sub    $0xc,%esp
+    20b3:	ff 75 ec             	push   -0x14(%ebp)
+    20b6:	e8 b6 51 00 00       	call   7271 <close>
+    20bb:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    20be:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    20c2:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    20c6:	0f 8e 5e ff ff ff    	jle    202a <createdelete+0x166>
+  for(i = 0; i < N; i++){
+    20cc:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    20d0:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    20d4:	0f 8e 44 ff ff ff    	jle    201e <createdelete+0x15a>
+    }
+  }
+
+  for(i = 0; i < N; i++){
+    20da:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    20e1:	eb 38                	jmp    211b <createdelete+0x257>
+    for(pi = 0; pi < 4; pi++){
+    20e3:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    20ea:	eb 25                	jmp    2111 <createdelete+0x24d>
+      name[0] = 'p' + i;
+    20ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    20ef:	83 c0 70             	add    $0x70,%eax
+    20f2:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    20f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    20f8:	83 c0 30             	add    $0x30,%eax
+    20fb:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    20fe:	83 ec 0c             	sub    $0xc,%esp
+    2101:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    2104:	50                   	push   %eax
+    2105:	e8 c7 44 00 00       	call   65d1 <unlink>
+    210a:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    210d:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    2111:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    2115:	7e d5                	jle    20ec <createdelete+0x228>
+  for(i = 0; i < N; i++){
+    2117:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    211b:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    211f:	7e c2                	jle    20e3 <createdelete+0x21f>
+    }
+  }
+
+  printf(1, "createdelete ok\n");
+    2121:	83 ec 08             	sub    $0x8,%esp
+    2124:	68 78 7c 00 00       	push   $0x7c78
+    2129:	6a 01                	push   $0x1
+    212b:	e8 8d 46 00 00       	call   67bd <printf>
+    2130:	83 c4 10             	add    $0x10,%esp
+}
+    2133:	90                   	nop
+    2134:	c9                   	leave
+    2135:	c3                   	ret
+
+00002136 <unlinkread>:
+
+// can I unlink a file and still read it?
+void
+unlinkread(void)
+{
+    2136:	55                   	push   %ebp
+    2137:	89 e5                	mov    %esp,%ebp
+    2139:	83 ec 18             	sub    $0x18,%esp
+  int fd, fd1;
+
+  printf(1, "unlinkread test\n");
+    213c:	83 ec 08             	sub    $0x8,%esp
+    213f:	68 89 7c 00 00       	push   $0x7c89
+    2144:	6a 01                	push   $0x1
+    2146:	e8 72 46 00 00       	call   67bd <printf>
+    214b:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    214e:	83 ec 08             	sub    $0x8,%esp
+    2151:	68 02 02 00 00       	push   $0x202
+    2156:	68 9a 7c 00 00       	push   $0x7c9a
+    215b:	e8 53 44 00 00       	call   65b3 <open>
+    2160:	83 c4 10             	add    $0x10,%esp
+    2163:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    2166:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    216a:	79 17                	jns    2183 <unlinkread+0x4d>
+    printf(1, "create unlinkread failed\n");
+    216c:	83 ec 08             	sub    $0x8,%esp
+    216f:	68 a5 7c 00 00       	push   $0x7ca5
+    2174:	6a 01                	push   $0x1
+    2176:	e8 42 46 00 00       	call   67bd <printf>
+    217b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    217e:	e8 d6 50 00 00       	call   7259 <exit>
+  }
+  write(fd, "hello", 5);
+    2183:	83 ec 04             	sub    $0x4,%esp
+    2186:	6a 05                	push   $0x5
+    2188:	68 bf 7c 00 00       	push   $0x7cbf
+    218d:	ff 75 f4             	push   -0xc(%ebp)
+    2190:	e8 e2 43 00 00       	call   6577 <write>
+    2195:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    2198:	83 ec 0c             	sub    $0xc,%esp
+    219b:	ff 75 f4             	push   -0xc(%ebp)
+    219e:	e8 ce 50 00 00       	call   7271 <close>
+    21a3:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("unlinkread", O_RDWR);
+    21a6:	83 ec 08             	sub    $0x8,%esp
+    21a9:	6a 02                	push   $0x2
+    21ab:	68 9a 7c 00 00       	push   $0x7c9a
+    21b0:	e8 fe 43 00 00       	call   65b3 <open>
+    21b5:	83 c4 10             	add    $0x10,%esp
+    21b8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    21bb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    21bf:	79 17                	jns    21d8 <unlinkread+0xa2>
+    printf(1, "open unlinkread failed\n");
+    21c1:	83 ec 08             	sub    $0x8,%esp
+    21c4:	68 c5 7c 00 00       	push   $0x7cc5
+    21c9:	6a 01                	push   $0x1
+    21cb:	e8 ed 45 00 00       	call   67bd <printf>
+    21d0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    21d3:	e8 81 50 00 00       	call   7259 <exit>
+  }
+  if(unlink("unlinkread") != 0){
+    21d8:	83 ec 0c             	sub    $0xc,%esp
+    21db:	68 9a 7c 00 00       	push   $0x7c9a
+    21e0:	e8 ec 43 00 00       	call   65d1 <unlink>
+    21e5:	83 c4 10             	add    $0x10,%esp
+    21e8:	85 c0                	test   %eax,%eax
+    21ea:	74 17                	je     2203 <unlinkread+0xcd>
+    printf(1, "unlink unlinkread failed\n");
+    21ec:	83 ec 08             	sub    $0x8,%esp
+    21ef:	68 dd 7c 00 00       	push   $0x7cdd
+    21f4:	6a 01                	push   $0x1
+    21f6:	e8 c2 45 00 00       	call   67bd <printf>
+    21fb:	83 c4 10             	add    $0x10,%esp
+    exit();
+    21fe:	e8 56 50 00 00       	call   7259 <exit>
+  }
+
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    2203:	83 ec 08             	sub    $0x8,%esp
+    2206:	68 02 02 00 00       	push   $0x202
+    220b:	68 9a 7c 00 00       	push   $0x7c9a
+    2210:	e8 9e 43 00 00       	call   65b3 <open>
+    2215:	83 c4 10             	add    $0x10,%esp
+    2218:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  write(fd1, "yyy", 3);
+    221b:	83 ec 04             	sub    $0x4,%esp
+    221e:	6a 03                	push   $0x3
+    2220:	68 f7 7c 00 00       	push   $0x7cf7
+    2225:	ff 75 f0             	push   -0x10(%ebp)
+    2228:	e8 4a 43 00 00       	call   6577 <write>
+    222d:	83 c4 10             	add    $0x10,%esp
+  close(fd1);
+    2230:	83 ec 0c             	sub    $0xc,%esp
+    2233:	ff 75 f0             	push   -0x10(%ebp)
+    2236:	e8 36 50 00 00       	call   7271 <close>
+    223b:	83 c4 10             	add    $0x10,%esp
+
+  if(read(fd, buf, sizeof(buf)) != 5){
+    223e:	83 ec 04             	sub    $0x4,%esp
+    2241:	68 00 20 00 00       	push   $0x2000
+    2246:	68 80 9e 00 00       	push   $0x9e80
+    224b:	ff 75 f4             	push   -0xc(%ebp)
+    224e:	e8 15 43 00 00       	call   6568 <read>
+    2253:	83 c4 10             	add    $0x10,%esp
+    2256:	83 f8 05             	cmp    $0x5,%eax
+    2259:	74 17                	je     2272 <unlinkread+0x13c>
+    printf(1, "unlinkread read failed");
+    225b:	83 ec 08             	sub    $0x8,%esp
+    225e:	68 fb 7c 00 00       	push   $0x7cfb
+    2263:	6a 01                	push   $0x1
+    2265:	e8 53 45 00 00       	call   67bd <printf>
+    226a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    226d:	e8 e7 4f 00 00       	call   7259 <exit>
+  }
+  if(buf[0] != 'h'){
+    2272:	0f b6 05 80 9e 00 00 	movzbl 0x9e80,%eax
+    2279:	3c 68                	cmp    $0x68,%al
+    227b:	74 17                	je     2294 <unlinkread+0x15e>
+    printf(1, "unlinkread wrong data\n");
+    227d:	83 ec 08             	sub    $0x8,%esp
+    2280:	68 12 7d 00 00       	push   $0x7d12
+    2285:	6a 01                	push   $0x1
+    2287:	e8 31 45 00 00       	call   67bd <printf>
+    228c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    228f:	e8 c5 4f 00 00       	call   7259 <exit>
+  }
+  if(write(fd, buf, 10) != 10){
+    2294:	83 ec 04             	sub    $0x4,%esp
+    2297:	6a 0a                	push   $0xa
+    2299:	68 80 9e 00 00       	push   $0x9e80
+    229e:	ff 75 f4             	push   -0xc(%ebp)
+    22a1:	e8 d1 42 00 00       	call   6577 <write>
+    22a6:	83 c4 10             	add    $0x10,%esp
+    22a9:	83 f8 0a             	cmp    $0xa,%eax
+    22ac:	74 17                	je     22c5 <unlinkread+0x18f>
+    printf(1, "unlinkread write failed\n");
+    22ae:	83 ec 08             	sub    $0x8,%esp
+    22b1:	68 29 7d 00 00       	push   $0x7d29
+    22b6:	6a 01                	push   $0x1
+    22b8:	e8 00 45 00 00       	call   67bd <printf>
+    22bd:	83 c4 10             	add    $0x10,%esp
+    exit();
+    22c0:	e8 94 4f 00 00       	call   7259 <exit>
+  }
+  close(fd);
+    22c5:	83 ec 0c             	sub    $0xc,%esp
+    22c8:	ff 75 f4             	push   -0xc(%ebp)
+    22cb:	e8 a1 4f 00 00       	call   7271 <close>
+    22d0:	83 c4 10             	add    $0x10,%esp
+  unlink("unlinkread");
+    22d3:	83 ec 0c             	sub    $0xc,%esp
+    22d6:	68 9a 7c 00 00       	push   $0x7c9a
+    22db:	e8 f1 42 00 00       	call   65d1 <unlink>
+    22e0:	83 c4 10             	add    $0x10,%esp
+  printf(1, "unlinkread ok\n");
+    22e3:	83 ec 08             	sub    $0x8,%esp
+    22e6:	68 42 7d 00 00       	push   $0x7d42
+    22eb:	6a 01                	push   $0x1
+    22ed:	e8 cb 44 00 00       	call   67bd <printf>
+    22f2:	83 c4 10             	add    $0x10,%esp
+}
+    22f5:	90                   	nop
+    22f6:	c9                   	leave
+    22f7:	c3                   	ret
+
+000022f8 <linktest>:
+
+void
+linktest(void)
+{
+    22f8:	55                   	push   %ebp
+    22f9:	89 e5                	mov    %esp,%ebp
+    22fb:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  printf(1, "linktest\n");
+    22fe:	83 ec 08             	sub    $0x8,%esp
+    2301:	68 51 7d 00 00       	push   $0x7d51
+    2306:	6a 01                	push   $0x1
+    2308:	e8 b0 44 00 00       	call   67bd <printf>
+    230d:	83 c4 10             	add    $0x10,%esp
+
+  unlink("lf1");
+    2310:	83 ec 0c             	sub    $0xc,%esp
+    2313:	68 5b 7d 00 00       	push   $0x7d5b
+    2318:	e8 b4 42 00 00       	call   65d1 <unlink>
+    231d:	83 c4 10             	add    $0x10,%esp
+  unlink("lf2");
+    2320:	83 ec 0c             	sub    $0xc,%esp
+    2323:	68 5f 7d 00 00       	push   $0x7d5f
+    2328:	e8 a4 42 00 00       	call   65d1 <unlink>
+    232d:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("lf1", O_CREATE|O_RDWR);
+    2330:	83 ec 08             	sub    $0x8,%esp
+    2333:	68 02 02 00 00       	push   $0x202
+    2338:	68 5b 7d 00 00       	push   $0x7d5b
+    233d:	e8 71 42 00 00       	call   65b3 <open>
+    2342:	83 c4 10             	add    $0x10,%esp
+    2345:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    2348:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    234c:	79 17                	jns    2365 <linktest+0x6d>
+    printf(1, "create lf1 failed\n");
+    234e:	83 ec 08             	sub    $0x8,%esp
+    2351:	68 63 7d 00 00       	push   $0x7d63
+    2356:	6a 01                	push   $0x1
+    2358:	e8 60 44 00 00       	call   67bd <printf>
+    235d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2360:	e8 f4 4e 00 00       	call   7259 <exit>
+  }
+  if(write(fd, "hello", 5) != 5){
+    2365:	83 ec 04             	sub    $0x4,%esp
+    2368:	6a 05                	push   $0x5
+    236a:	68 bf 7c 00 00       	push   $0x7cbf
+    236f:	ff 75 f4             	push   -0xc(%ebp)
+    2372:	e8 00 42 00 00       	call   6577 <write>
+    2377:	83 c4 10             	add    $0x10,%esp
+    237a:	83 f8 05             	cmp    $0x5,%eax
+    237d:	74 17                	je     2396 <linktest+0x9e>
+    printf(1, "write lf1 failed\n");
+    237f:	83 ec 08             	sub    $0x8,%esp
+    2382:	68 76 7d 00 00       	push   $0x7d76
+    2387:	6a 01                	push   $0x1
+    2389:	e8 2f 44 00 00       	call   67bd <printf>
+    238e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2391:	e8 c3 4e 00 00       	call   7259 <exit>
+  }
+  close(fd);
+    2396:	83 ec 0c             	sub    $0xc,%esp
+    2399:	ff 75 f4             	push   -0xc(%ebp)
+    239c:	e8 d0 4e 00 00       	call   7271 <close>
+    23a1:	83 c4 10             	add    $0x10,%esp
+
+  if(link("lf1", "lf2") < 0){
+    23a4:	83 ec 08             	sub    $0x8,%esp
+    23a7:	68 5f 7d 00 00       	push   $0x7d5f
+    23ac:	68 5b 7d 00 00       	push   $0x7d5b
+    23b1:	e8 39 42 00 00       	call   65ef <link>
+    23b6:	83 c4 10             	add    $0x10,%esp
+    23b9:	85 c0                	test   %eax,%eax
+    23bb:	79 17                	jns    23d4 <linktest+0xdc>
+    printf(1, "link lf1 lf2 failed\n");
+    23bd:	83 ec 08             	sub    $0x8,%esp
+    23c0:	68 88 7d 00 00       	push   $0x7d88
+    23c5:	6a 01                	push   $0x1
+    23c7:	e8 f1 43 00 00       	call   67bd <printf>
+    23cc:	83 c4 10             	add    $0x10,%esp
+    exit();
+    23cf:	e8 85 4e 00 00       	call   7259 <exit>
+  }
+  unlink("lf1");
+    23d4:	83 ec 0c             	sub    $0xc,%esp
+    23d7:	68 5b 7d 00 00       	push   $0x7d5b
+    23dc:	e8 f0 41 00 00       	call   65d1 <unlink>
+    23e1:	83 c4 10             	add    $0x10,%esp
+
+  if(open("lf1", 0) >= 0){
+    23e4:	83 ec 08             	sub    $0x8,%esp
+    23e7:	6a 00                	push   $0x0
+    23e9:	68 5b 7d 00 00       	push   $0x7d5b
+    23ee:	e8 c0 41 00 00       	call   65b3 <open>
+    23f3:	83 c4 10             	add    $0x10,%esp
+    23f6:	85 c0                	test   %eax,%eax
+    23f8:	78 17                	js     2411 <linktest+0x119>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    23fa:	83 ec 08             	sub    $0x8,%esp
+    23fd:	68 a0 7d 00 00       	push   $0x7da0
+    2402:	6a 01                	push   $0x1
+    2404:	e8 b4 43 00 00       	call   67bd <printf>
+    2409:	83 c4 10             	add    $0x10,%esp
+    exit();
+    240c:	e8 48 4e 00 00       	call   7259 <exit>
+  }
+
+  fd = open("lf2", 0);
+    2411:	83 ec 08             	sub    $0x8,%esp
+    2414:	6a 00                	push   $0x0
+    2416:	68 5f 7d 00 00       	push   $0x7d5f
+    241b:	e8 93 41 00 00       	call   65b3 <open>
+    2420:	83 c4 10             	add    $0x10,%esp
+    2423:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    2426:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    242a:	79 17                	jns    2443 <linktest+0x14b>
+    printf(1, "open lf2 failed\n");
+    242c:	83 ec 08             	sub    $0x8,%esp
+    242f:	68 c5 7d 00 00       	push   $0x7dc5
+    2434:	6a 01                	push   $0x1
+    2436:	e8 82 43 00 00       	call   67bd <printf>
+    243b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    243e:	e8 16 4e 00 00       	call   7259 <exit>
+  }
+  if(read(fd, buf, sizeof(buf)) != 5){
+    2443:	83 ec 04             	sub    $0x4,%esp
+    2446:	68 00 20 00 00       	push   $0x2000
+    244b:	68 80 9e 00 00       	push   $0x9e80
+    2450:	ff 75 f4             	push   -0xc(%ebp)
+    2453:	e8 10 41 00 00       	call   6568 <read>
+    2458:	83 c4 10             	add    $0x10,%esp
+    245b:	83 f8 05             	cmp    $0x5,%eax
+    245e:	74 17                	je     2477 <linktest+0x17f>
+    printf(1, "read lf2 failed\n");
+    2460:	83 ec 08             	sub    $0x8,%esp
+    2463:	68 d6 7d 00 00       	push   $0x7dd6
+    2468:	6a 01                	push   $0x1
+    246a:	e8 4e 43 00 00       	call   67bd <printf>
+    246f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2472:	e8 e2 4d 00 00       	call   7259 <exit>
+  }
+  close(fd);
+    2477:	83 ec 0c             	sub    $0xc,%esp
+    247a:	ff 75 f4             	push   -0xc(%ebp)
+    247d:	e8 ef 4d 00 00       	call   7271 <close>
+    2482:	83 c4 10             	add    $0x10,%esp
+
+  if(link("lf2", "lf2") >= 0){
+    2485:	83 ec 08             	sub    $0x8,%esp
+    2488:	68 5f 7d 00 00       	push   $0x7d5f
+    248d:	68 5f 7d 00 00       	push   $0x7d5f
+    2492:	e8 58 41 00 00       	call   65ef <link>
+    2497:	83 c4 10             	add    $0x10,%esp
+    249a:	85 c0                	test   %eax,%eax
+    249c:	78 17                	js     24b5 <linktest+0x1bd>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    249e:	83 ec 08             	sub    $0x8,%esp
+    24a1:	68 e7 7d 00 00       	push   $0x7de7
+    24a6:	6a 01                	push   $0x1
+    24a8:	e8 10 43 00 00       	call   67bd <printf>
+    24ad:	83 c4 10             	add    $0x10,%esp
+    exit();
+    24b0:	e8 a4 4d 00 00       	call   7259 <exit>
+  }
+
+  unlink("lf2");
+    24b5:	83 ec 0c             	sub    $0xc,%esp
+    24b8:	68 5f 7d 00 00       	push   $0x7d5f
+    24bd:	e8 0f 41 00 00       	call   65d1 <unlink>
+    24c2:	83 c4 10             	add    $0x10,%esp
+  if(link("lf2", "lf1") >= 0){
+    24c5:	83 ec 08             	sub    $0x8,%esp
+    24c8:	68 5b 7d 00 00       	push   $0x7d5b
+    24cd:	68 5f 7d 00 00       	push   $0x7d5f
+    24d2:	e8 18 41 00 00       	call   65ef <link>
+    24d7:	83 c4 10             	add    $0x10,%esp
+    24da:	85 c0                	test   %eax,%eax
+    24dc:	78 17                	js     24f5 <linktest+0x1fd>
+    printf(1, "link non-existant succeeded! oops\n");
+    24de:	83 ec 08             	sub    $0x8,%esp
+    24e1:	68 08 7e 00 00       	push   $0x7e08
+    24e6:	6a 01                	push   $0x1
+    24e8:	e8 d0 42 00 00       	call   67bd <printf>
+    24ed:	83 c4 10             	add    $0x10,%esp
+    exit();
+    24f0:	e8 64 4d 00 00       	call   7259 <exit>
+  }
+
+  if(link(".", "lf1") >= 0){
+    24f5:	83 ec 08             	sub    $0x8,%esp
+    24f8:	68 5b 7d 00 00       	push   $0x7d5b
+    24fd:	68 2b 7e 00 00       	push   $0x7e2b
+    2502:	e8 e8 40 00 00       	call   65ef <link>
+    2507:	83 c4 10             	add    $0x10,%esp
+    250a:	85 c0                	test   %eax,%eax
+    250c:	78 17                	js     2525 <linktest+0x22d>
+    printf(1, "link . lf1 succeeded! oops\n");
+    250e:	83 ec 08             	sub    $0x8,%esp
+    2511:	68 2d 7e 00 00       	push   $0x7e2d
+    2516:	6a 01                	push   $0x1
+    2518:	e8 a0 42 00 00       	call   67bd <printf>
+    251d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2520:	e8 34 4d 00 00       	call   7259 <exit>
+  }
+
+  printf(1, "linktest ok\n");
+    2525:	83 ec 08             	sub    $0x8,%esp
+    2528:	68 49 7e 00 00       	push   $0x7e49
+    252d:	6a 01                	push   $0x1
+    252f:	e8 89 42 00 00       	call   67bd <printf>
+    2534:	83 c4 10             	add    $0x10,%esp
+}
+    2537:	90                   	nop
+    2538:	c9                   	leave
+    2539:	c3                   	ret
+
+0000253a <concreate>:
+
+// test concurrent create/link/unlink of the same file
+void
+concreate(void)
+{
+    253a:	55                   	push   %ebp
+    253b:	89 e5                	mov    %esp,%ebp
+    253d:	83 ec 58             	sub    $0x58,%esp
+  struct {
+    ushort inum;
+    char name[14];
+  } de;
+
+  printf(1, "concreate test\n");
+    2540:	83 ec 08             	sub    $0x8,%esp
+    2543:	68 56 7e 00 00       	push   $0x7e56
+    2548:	6a 01                	push   $0x1
+    254a:	e8 6e 42 00 00       	call   67bd <printf>
+    254f:	83 c4 10             	add    $0x10,%esp
+  file[0] = 'C';
+    2552:	c6 45 e5 43          	movb   $0x43,-0x1b(%ebp)
+  file[2] = '\0';
+    2556:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  for(i = 0; i < 40; i++){
+    255a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2561:	e9 fc 00 00 00       	jmp    2662 <concreate+0x128>
+    file[1] = '0' + i;
+    2566:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2569:	83 c0 30             	add    $0x30,%eax
+    256c:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    unlink(file);
+    256f:	83 ec 0c             	sub    $0xc,%esp
+    2572:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2575:	50                   	push   %eax
+    2576:	e8 56 40 00 00       	call   65d1 <unlink>
+    257b:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    257e:	e8 96 4c 00 00       	call   7219 <fork>
+    2583:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid && (i % 3) == 1){
+    2586:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    258a:	74 3b                	je     25c7 <concreate+0x8d>
+    258c:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    258f:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    2594:	89 c8                	mov    %ecx,%eax
+    2596:	f7 ea                	imul   %edx
+    2598:	89 c8                	mov    %ecx,%eax
+    259a:	c1 f8 1f             	sar    $0x1f,%eax
+    259d:	29 c2                	sub    %eax,%edx
+    259f:	89 d0                	mov    %edx,%eax
+    25a1:	01 c0                	add    %eax,%eax
+    25a3:	01 d0                	add    %edx,%eax
+    25a5:	29 c1                	sub    %eax,%ecx
+    25a7:	89 ca                	mov    %ecx,%edx
+    25a9:	83 fa 01             	cmp    $0x1,%edx
+    25ac:	75 19                	jne    25c7 <concreate+0x8d>
+      link("C0", file);
+    25ae:	83 ec 08             	sub    $0x8,%esp
+    25b1:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    25b4:	50                   	push   %eax
+    25b5:	68 66 7e 00 00       	push   $0x7e66
+    25ba:	e8 30 40 00 00       	call   65ef <link>
+    25bf:	83 c4 10             	add    $0x10,%esp
+    25c2:	e9 87 00 00 00       	jmp    264e <concreate+0x114>
+    } else if(pid == 0 && (i % 5) == 1){
+    25c7:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    25cb:	75 3b                	jne    2608 <concreate+0xce>
+    25cd:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    25d0:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    25d5:	89 c8                	mov    %ecx,%eax
+    25d7:	f7 ea                	imul   %edx
+    25d9:	d1 fa                	sar    %edx
+    25db:	89 c8                	mov    %ecx,%eax
+    25dd:	c1 f8 1f             	sar    $0x1f,%eax
+    25e0:	29 c2                	sub    %eax,%edx
+    25e2:	89 d0                	mov    %edx,%eax
+    25e4:	c1 e0 02             	shl    $0x2,%eax
+    25e7:	01 d0                	add    %edx,%eax
+    25e9:	29 c1                	sub    %eax,%ecx
+    25eb:	89 ca                	mov    %ecx,%edx
+    25ed:	83 fa 01             	cmp    $0x1,%edx
+    25f0:	75 16                	jne    2608 <concreate+0xce>
+      link("C0", file);
+    25f2:	83 ec 08             	sub    $0x8,%esp
+    25f5:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    25f8:	50                   	push   %eax
+    25f9:	68 66 7e 00 00       	push   $0x7e66
+    25fe:	e8 ec 3f 00 00       	call   65ef <link>
+    2603:	83 c4 10             	add    $0x10,%esp
+    2606:	eb 46                	jmp    264e <concreate+0x114>
+    } else {
+      fd = open(file, O_CREATE | O_RDWR);
+    2608:	83 ec 08             	sub    $0x8,%esp
+    260b:	68 02 02 00 00       	push   $0x202
+    2610:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2613:	50                   	push   %eax
+    2614:	e8 9a 3f 00 00       	call   65b3 <open>
+    2619:	83 c4 10             	add    $0x10,%esp
+    261c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      if(fd < 0){
+    261f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2623:	79 1b                	jns    2640 <concreate+0x106>
+        printf(1, "concreate create %s failed\n", file);
+    2625:	83 ec 04             	sub    $0x4,%esp
+    2628:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    262b:	50                   	push   %eax
+    262c:	68 69 7e 00 00       	push   $0x7e69
+    2631:	6a 01                	push   $0x1
+    2633:	e8 85 41 00 00       	call   67bd <printf>
+    2638:	83 c4 10             	add    $0x10,%esp
+        exit();
+    263b:	e8 19 4c 00 00       	call   7259 <exit>
+      }
+      close(fd);
+    2640:	83 ec 0c             	sub    $0xc,%esp
+    2643:	ff 75 ec             	push   -0x14(%ebp)
+    2646:	e8 26 4c 00 00       	call   7271 <close>
+    264b:	83 c4 10             	add    $0x10,%esp
+    }
+    if(pid == 0)
+    264e:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    2652:	75 05                	jne    2659 <concreate+0x11f>
+      exit();
+    2654:	e8 00 4c 00 00       	call   7259 <exit>
+    else
+      wait();
+    2659:	e8 ec 3e 00 00       	call   654a <wait>
+  for(i = 0; i < 40; i++){
+    265e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2662:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+    2666:	0f 8e fa fe ff ff    	jle    2566 <concreate+0x2c>
+  }
+
+  memset(fa, 0, sizeof(fa));
+    266c:	83 ec 04             	sub    $0x4,%esp
+    266f:	6a 28                	push   $0x28
+    2671:	6a 00                	push   $0x0
+    2673:	8d 45 bd             	lea    -0x43(%ebp),%eax
+    2676:	50                   	push   %eax
+    2677:	e8 b7 3a 00 00       	call   6133 <memset>
+    267c:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    267f:	83 ec 08             	sub    $0x8,%esp
+    2682:	6a 00                	push   $0x0
+    2684:	68 2b 7e 00 00       	push   $0x7e2b
+    2689:	e8 25 3f 00 00       	call   65b3 <open>
+    268e:	83 c4 10             	add    $0x10,%esp
+    2691:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  n = 0;
+    2694:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    269b:	e9 99 00 00 00       	jmp    2739 <concreate+0x1ff>
+    if(de.inum == 0)
+    26a0:	0f b7 45 ac          	movzwl -0x54(%ebp),%eax
+    26a4:	66 85 c0             	test   %ax,%ax
+    26a7:	0f 84 8b 00 00 00    	je     2738 <concreate+0x1fe>
+      continue;
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    26ad:	0f b6 45 ae          	movzbl -0x52(%ebp),%eax
+    26b1:	3c 43                	cmp    $0x43,%al
+    26b3:	0f 85 80 00 00 00    	jne    2739 <concreate+0x1ff>
+    26b9:	0f b6 45 b0          	movzbl -0x50(%ebp),%eax
+    26bd:	84 c0                	test   %al,%al
+    26bf:	75 78                	jne    2739 <concreate+0x1ff>
+      i = de.name[1] - '0';
+    26c1:	0f b6 45 af          	movzbl -0x51(%ebp),%eax
+    26c5:	0f be c0             	movsbl %al,%eax
+    26c8:	83 e8 30             	sub    $0x30,%eax
+    26cb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      if(i < 0 || i >= sizeof(fa)){
+    26ce:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    26d2:	78 08                	js     26dc <concreate+0x1a2>
+    26d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    26d7:	83 f8 27             	cmp    $0x27,%eax
+    26da:	76 1e                	jbe    26fa <concreate+0x1c0>
+        printf(1, "concreate weird file %s\n", de.name);
+    26dc:	83 ec 04             	sub    $0x4,%esp
+    26df:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    26e2:	83 c0 02             	add    $0x2,%eax
+    26e5:	50                   	push   %eax
+    26e6:	68 85 7e 00 00       	push   $0x7e85
+    26eb:	6a 01                	push   $0x1
+    26ed:	e8 cb 40 00 00       	call   67bd <printf>
+    26f2:	83 c4 10             	add    $0x10,%esp
+        exit();
+    26f5:	e8 5f 4b 00 00       	call   7259 <exit>
+      }
+      if(fa[i]){
+    26fa:	8d 55 bd             	lea    -0x43(%ebp),%edx
+    26fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2700:	01 d0                	add    %edx,%eax
+    2702:	0f b6 00             	movzbl (%eax),%eax
+    2705:	84 c0                	test   %al,%al
+    2707:	74 1e                	je     2727 <concreate+0x1ed>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    2709:	83 ec 04             	sub    $0x4,%esp
+    270c:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    270f:	83 c0 02             	add    $0x2,%eax
+    2712:	50                   	push   %eax
+    2713:	68 9e 7e 00 00       	push   $0x7e9e
+    2718:	6a 01                	push   $0x1
+    271a:	e8 9e 40 00 00       	call   67bd <printf>
+    271f:	83 c4 10             	add    $0x10,%esp
+        exit();
+    2722:	e8 32 4b 00 00       	call   7259 <exit>
+      }
+      fa[i] = 1;
+    2727:	8d 55 bd             	lea    -0x43(%ebp),%edx
+    272a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    272d:	01 d0                	add    %edx,%eax
+    272f:	c6 00 01             	movb   $0x1,(%eax)
+      n++;
+    2732:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    2736:	eb 01                	jmp    2739 <concreate+0x1ff>
+      continue;
+    2738:	90                   	nop
+  while(read(fd, &de, sizeof(de)) > 0){
+    2739:	83 ec 04             	sub    $0x4,%esp
+    273c:	6a 10                	push   $0x10
+    273e:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    2741:	50                   	push   %eax
+    2742:	ff 75 ec             	push   -0x14(%ebp)
+    2745:	e8 1e 3e 00 00       	call   6568 <read>
+    274a:	83 c4 10             	add    $0x10,%esp
+    274d:	85 c0                	test   %eax,%eax
+    274f:	0f 8f 4b ff ff ff    	jg     26a0 <concreate+0x166>
+    }
+  }
+  close(fd);
+    2755:	83 ec 0c             	sub    $0xc,%esp
+    2758:	ff 75 ec             	push   -0x14(%ebp)
+    275b:	e8 11 4b 00 00       	call   7271 <close>
+    2760:	83 c4 10             	add    $0x10,%esp
+
+  if(n != 40){
+    2763:	83 7d f0 28          	cmpl   $0x28,-0x10(%ebp)
+    2767:	74 17                	je     2780 <concreate+0x246>
+    printf(1, "concreate not enough files in directory listing\n");
+    2769:	83 ec 08             	sub    $0x8,%esp
+    276c:	68 bc 7e 00 00       	push   $0x7ebc
+    2771:	6a 01                	push   $0x1
+    2773:	e8 45 40 00 00       	call   67bd <printf>
+    2778:	83 c4 10             	add    $0x10,%esp
+    exit();
+    277b:	e8 d9 4a 00 00       	call   7259 <exit>
+  }
+
+  for(i = 0; i < 40; i++){
+    2780:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2787:	e9 43 01 00 00       	jmp    28cf <concreate+0x395>
+    file[1] = '0' + i;
+    278c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    278f:	83 c0 30             	add    $0x30,%eax
+    2792:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    pid = fork();
+    2795:	e8 7f 4a 00 00       	call   7219 <fork>
+    279a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    279d:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    27a1:	79 17                	jns    27ba <concreate+0x280>
+      printf(1, "fork failed\n");
+    27a3:	83 ec 08             	sub    $0x8,%esp
+    27a6:	68 75 73 00 00       	push   $0x7375
+    27ab:	6a 01                	push   $0x1
+    27ad:	e8 0b 40 00 00       	call   67bd <printf>
+    27b2:	83 c4 10             	add    $0x10,%esp
+      exit();
+    27b5:	e8 9f 4a 00 00       	call   7259 <exit>
+    }
+    if(((i % 3) == 0 && pid == 0) ||
+    27ba:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    27bd:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    27c2:	89 c8                	mov    %ecx,%eax
+    27c4:	f7 ea                	imul   %edx
+    27c6:	89 c8                	mov    %ecx,%eax
+    27c8:	c1 f8 1f             	sar    $0x1f,%eax
+    27cb:	29 c2                	sub    %eax,%edx
+    27cd:	89 d0                	mov    %edx,%eax
+    27cf:	01 c0                	add    %eax,%eax
+    27d1:	01 d0                	add    %edx,%eax
+    27d3:	29 c1                	sub    %eax,%ecx
+    27d5:	89 ca                	mov    %ecx,%edx
+    27d7:	85 d2                	test   %edx,%edx
+    27d9:	75 06                	jne    27e1 <concreate+0x2a7>
+    27db:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    27df:	74 28                	je     2809 <concreate+0x2cf>
+       ((i % 3) == 1 && pid != 0)){
+    27e1:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    27e4:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    27e9:	89 c8                	mov    %ecx,%eax
+    27eb:	f7 ea                	imul   %edx
+    27ed:	89 c8                	mov    %ecx,%eax
+    27ef:	c1 f8 1f             	sar    $0x1f,%eax
+    27f2:	29 c2                	sub    %eax,%edx
+    27f4:	89 d0                	mov    %edx,%eax
+    27f6:	01 c0                	add    %eax,%eax
+    27f8:	01 d0                	add    %edx,%eax
+    27fa:	29 c1                	sub    %eax,%ecx
+    27fc:	89 ca                	mov    %ecx,%edx
+    if(((i % 3) == 0 && pid == 0) ||
+    27fe:	83 fa 01             	cmp    $0x1,%edx
+    2801:	75 7c                	jne    287f <concreate+0x345>
+       ((i % 3) == 1 && pid != 0)){
+    2803:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    2807:	74 76                	je     287f <concreate+0x345>
+      close(open(file, 0));
+    2809:	83 ec 08             	sub    $0x8,%esp
+    280c:	6a 00                	push   $0x0
+    280e:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2811:	50                   	push   %eax
+    2812:	e8 9c 3d 00 00       	call   65b3 <open>
+    2817:	83 c4 10             	add    $0x10,%esp
+    281a:	83 ec 0c             	sub    $0xc,%esp
+    281d:	50                   	push   %eax
+    281e:	e8 4e 4a 00 00       	call   7271 <close>
+    2823:	83 c4 10             	add    $0x10,%esp
+      close(open(file, 0));
+    2826:	83 ec 08             	sub    $0x8,%esp
+    2829:	6a 00                	push   $0x0
+    282b:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    282e:	50                   	push   %eax
+    282f:	e8 7f 3d 00 00       	call   65b3 <open>
+    2834:	83 c4 10             	add    $0x10,%esp
+    2837:	83 ec 0c             	sub    $0xc,%esp
+    283a:	50                   	push   %eax
+    283b:	e8 31 4a 00 00       	call   7271 <close>
+    2840:	83 c4 10             	add    $0x10,%esp
+      close(open(file, 0));
+    2843:	83 ec 08             	sub    $0x8,%esp
+    2846:	6a 00                	push   $0x0
+    2848:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    284b:	50                   	push   %eax
+    284c:	e8 62 3d 00 00       	call   65b3 <open>
+    2851:	83 c4 10             	add    $0x10,%esp
+    2854:	83 ec 0c             	sub    $0xc,%esp
+    2857:	50                   	push   %eax
+    2858:	e8 14 4a 00 00       	call   7271 <close>
+    285d:	83 c4 10             	add    $0x10,%esp
+      close(open(file, 0));
+    2860:	83 ec 08             	sub    $0x8,%esp
+    2863:	6a 00                	push   $0x0
+    2865:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2868:	50                   	push   %eax
+    2869:	e8 45 3d 00 00       	call   65b3 <open>
+    286e:	83 c4 10             	add    $0x10,%esp
+    2871:	83 ec 0c             	sub    $0xc,%esp
+    2874:	50                   	push   %eax
+    2875:	e8 f7 49 00 00       	call   7271 <close>
+    287a:	83 c4 10             	add    $0x10,%esp
+    287d:	eb 3c                	jmp    28bb <concreate+0x381>
+    } else {
+      unlink(file);
+    287f:	83 ec 0c             	sub    $0xc,%esp
+    2882:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2885:	50                   	push   %eax
+    2886:	e8 46 3d 00 00       	call   65d1 <unlink>
+    288b:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+    288e:	83 ec 0c             	sub    $0xc,%esp
+    2891:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2894:	50                   	push   %eax
+    2895:	e8 37 3d 00 00       	call   65d1 <unlink>
+    289a:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+    289d:	83 ec 0c             	sub    $0xc,%esp
+    28a0:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    28a3:	50                   	push   %eax
+    28a4:	e8 28 3d 00 00       	call   65d1 <unlink>
+    28a9:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+    28ac:	83 ec 0c             	sub    $0xc,%esp
+    28af:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    28b2:	50                   	push   %eax
+    28b3:	e8 19 3d 00 00       	call   65d1 <unlink>
+    28b8:	83 c4 10             	add    $0x10,%esp
+    }
+    if(pid == 0)
+    28bb:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    28bf:	75 05                	jne    28c6 <concreate+0x38c>
+      exit();
+    28c1:	e8 93 49 00 00       	call   7259 <exit>
+    else
+      wait();
+    28c6:	e8 7f 3c 00 00       	call   654a <wait>
+  for(i = 0; i < 40; i++){
+    28cb:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    28cf:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+    28d3:	0f 8e b3 fe ff ff    	jle    278c <concreate+0x252>
+  }
+
+  printf(1, "concreate ok\n");
+    28d9:	83 ec 08             	sub    $0x8,%esp
+    28dc:	68 ed 7e 00 00       	push   $0x7eed
+    28e1:	6a 01                	push   $0x1
+    28e3:	e8 d5 3e 00 00       	call   67bd <printf>
+    28e8:	83 c4 10             	add    $0x10,%esp
+}
+    28eb:	90                   	nop
+    28ec:	c9                   	leave
+    28ed:	c3                   	ret
+
+000028ee <linkunlink>:
+
+// another concurrent link/unlink/create test,
+// to look for deadlocks.
+void
+linkunlink()
+{
+    28ee:	55                   	push   %ebp
+    28ef:	89 e5                	mov    %esp,%ebp
+    28f1:	83 ec 18             	sub    $0x18,%esp
+  int pid, i;
+
+  printf(1, "linkunlink test\n");
+    28f4:	83 ec 08             	sub    $0x8,%esp
+    28f7:	68 fb 7e 00 00       	push   $0x7efb
+    28fc:	6a 01                	push   $0x1
+    28fe:	e8 ba 3e 00 00       	call   67bd <printf>
+    2903:	83 c4 10             	add    $0x10,%esp
+
+  unlink("x");
+    2906:	83 ec 0c             	sub    $0xc,%esp
+    2909:	68 9a 78 00 00       	push   $0x789a
+    290e:	e8 be 3c 00 00       	call   65d1 <unlink>
+    2913:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    2916:	e8 fe 48 00 00       	call   7219 <fork>
+    291b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(pid < 0){
+    291e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2922:	79 17                	jns    293b <linkunlink+0x4d>
+    printf(1, "fork failed\n");
+    2924:	83 ec 08             	sub    $0x8,%esp
+    2927:	68 75 73 00 00       	push   $0x7375
+    292c:	6a 01                	push   $0x1
+    292e:	e8 8a 3e 00 00       	call   67bd <printf>
+    2933:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2936:	e8 1e 49 00 00       	call   7259 <exit>
+  }
+
+  unsigned int x = (pid ? 1 : 97);
+    293b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    293f:	74 07                	je     2948 <linkunlink+0x5a>
+    2941:	b8 01 00 00 00       	mov    $0x1,%eax
+    2946:	eb 05                	jmp    294d <linkunlink+0x5f>
+    2948:	b8 61 00 00 00       	mov    $0x61,%eax
+    294d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < 100; i++){
+    2950:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2957:	e9 98 00 00 00       	jmp    29f4 <linkunlink+0x106>
+    x = x * 1103515245 + 12345;
+    295c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    295f:	69 c0 6d 4e c6 41    	imul   $0x41c64e6d,%eax,%eax
+    2965:	05 39 30 00 00       	add    $0x3039,%eax
+    296a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if((x % 3) == 0){
+    296d:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+    2970:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+    2975:	89 c8                	mov    %ecx,%eax
+    2977:	f7 e2                	mul    %edx
+    2979:	d1 ea                	shr    %edx
+    297b:	89 d0                	mov    %edx,%eax
+    297d:	01 c0                	add    %eax,%eax
+    297f:	01 d0                	add    %edx,%eax
+    2981:	29 c1                	sub    %eax,%ecx
+    2983:	89 ca                	mov    %ecx,%edx
+    2985:	85 d2                	test   %edx,%edx
+    2987:	75 23                	jne    29ac <linkunlink+0xbe>
+      close(open("x", O_RDWR | O_CREATE));
+    2989:	83 ec 08             	sub    $0x8,%esp
+    298c:	68 02 02 00 00       	push   $0x202
+    2991:	68 9a 78 00 00       	push   $0x789a
+    2996:	e8 18 3c 00 00       	call   65b3 <open>
+    299b:	83 c4 10             	add    $0x10,%esp
+    299e:	83 ec 0c             	sub    $0xc,%esp
+    29a1:	50                   	push   %eax
+    29a2:	e8 ca 48 00 00       	call   7271 <close>
+    29a7:	83 c4 10             	add    $0x10,%esp
+    29aa:	eb 44                	jmp    29f0 <linkunlink+0x102>
+    } else if((x % 3) == 1){
+    29ac:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+    29af:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+    29b4:	89 c8                	mov    %ecx,%eax
+    29b6:	f7 e2                	mul    %edx
+    29b8:	d1 ea                	shr    %edx
+    29ba:	89 d0                	mov    %edx,%eax
+    29bc:	01 c0                	add    %eax,%eax
+    29be:	01 d0                	add    %edx,%eax
+    29c0:	29 c1                	sub    %eax,%ecx
+    29c2:	89 ca                	mov    %ecx,%edx
+    29c4:	83 fa 01             	cmp    $0x1,%edx
+    29c7:	75 17                	jne    29e0 <linkunlink+0xf2>
+      link("cat", "x");
+    29c9:	83 ec 08             	sub    $0x8,%esp
+    29cc:	68 9a 78 00 00       	push   $0x789a
+    29d1:	68 0c 7f 00 00       	push   $0x7f0c
+    29d6:	e8 14 3c 00 00       	call   65ef <link>
+    29db:	83 c4 10             	add    $0x10,%esp
+    29de:	eb 10                	jmp    29f0 <linkunlink+0x102>
+    } else {
+      unlink("x");
+    29e0:	83 ec 0c             	sub    $0xc,%esp
+    29e3:	68 9a 78 00 00       	push   $0x789a
+    29e8:	e8 e4 3b 00 00       	call   65d1 <unlink>
+    29ed:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    29f0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    29f4:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+    29f8:	0f 8e 5e ff ff ff    	jle    295c <linkunlink+0x6e>
+    }
+  }
+
+  if(pid)
+    29fe:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2a02:	74 07                	je     2a0b <linkunlink+0x11d>
+    wait();
+    2a04:	e8 41 3b 00 00       	call   654a <wait>
+    2a09:	eb 05                	jmp    2a10 <linkunlink+0x122>
+  else 
+    exit();
+    2a0b:	e8 49 48 00 00       	call   7259 <exit>
+
+  printf(1, "linkunlink ok\n");
+    2a10:	83 ec 08             	sub    $0x8,%esp
+    2a13:	68 10 7f 00 00       	push   $0x7f10
+    2a18:	6a 01                	push   $0x1
+    2a1a:	e8 9e 3d 00 00       	call   67bd <printf>
+    2a1f:	83 c4 10             	add    $0x10,%esp
+}
+    2a22:	90                   	nop
+    2a23:	c9                   	leave
+    2a24:	c3                   	ret
+
+00002a25 <bigdir>:
+
+// directory that uses indirect blocks
+void
+bigdir(void)
+{
+    2a25:	55                   	push   %ebp
+    2a26:	89 e5                	mov    %esp,%ebp
+    2a28:	83 ec 38             	sub    $0x38,%esp
+  int i, fd, n;
+  char name[10];
+  struct dirent de;
+
+  printf(1, "bigdir test\n");
+    2a2b:	83 ec 08             	sub    $0x8,%esp
+    2a2e:	68 1f 7f 00 00       	push   $0x7f1f
+    2a33:	6a 01                	push   $0x1
+    2a35:	e8 83 3d 00 00       	call   67bd <printf>
+    2a3a:	83 c4 10             	add    $0x10,%esp
+
+  // A directory made by mkdir turns into a hash table as it grows.
+  if(mkdir("bigd") != 0 || chdir("bigd") != 0){
+    2a3d:	83 ec 0c             	sub    $0xc,%esp
+    2a40:	68 2c 7f 00 00       	push   $0x7f2c
+    2a45:	e8 b4 3b 00 00       	call   65fe <mkdir>
+    2a4a:	83 c4 10             	add    $0x10,%esp
+    2a4d:	85 c0                	test   %eax,%eax
+    2a4f:	75 14                	jne    2a65 <bigdir+0x40>
+    2a51:	83 ec 0c             	sub    $0xc,%esp
+    2a54:	68 2c 7f 00 00       	push   $0x7f2c
+    2a59:	e8 af 3b 00 00       	call   660d <chdir>
+    2a5e:	83 c4 10             	add    $0x10,%esp
+    2a61:	85 c0                	test   %eax,%eax
+    2a63:	74 17                	je     2a7c <bigdir+0x57>
+    printf(1, "bigdir mkdir failed\n");
+    2a65:	83 ec 08             	sub    $0x8,%esp
+    2a68:	68 31 7f 00 00       	push   $0x7f31
+    2a6d:	6a 01                	push   $0x1
+    2a6f:	e8 49 3d 00 00       	call   67bd <printf>
+    2a74:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2a77:	e8 dd 47 00 00       	call   7259 <exit>
+  }
+  fd = open("bd", O_CREATE);
+    2a7c:	83 ec 08             	sub    $0x8,%esp
+    2a7f:	68 00 02 00 00       	push   $0x200
+    2a84:	68 46 7f 00 00       	push   $0x7f46
+    2a89:	e8 25 3b 00 00       	call   65b3 <open>
+    2a8e:	83 c4 10             	add    $0x10,%esp
+    2a91:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    2a94:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2a98:	79 17                	jns    2ab1 <bigdir+0x8c>
+    printf(1, "bigdir create failed\n");
+    2a9a:	83 ec 08             	sub    $0x8,%esp
+    2a9d:	68 49 7f 00 00       	push   $0x7f49
+    2aa2:	6a 01                	push   $0x1
+    2aa4:	e8 14 3d 00 00       	call   67bd <printf>
+    2aa9:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2aac:	e8 a8 47 00 00       	call   7259 <exit>
+  }
+  close(fd);
+    2ab1:	83 ec 0c             	sub    $0xc,%esp
+    2ab4:	ff 75 ec             	push   -0x14(%ebp)
+    2ab7:	e8 b5 47 00 00       	call   7271 <close>
+    2abc:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < 500; i++){
+    2abf:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2ac6:	eb 69                	jmp    2b31 <bigdir+0x10c>
+    name[0] = 'x';
+    2ac8:	c6 45 e2 78          	movb   $0x78,-0x1e(%ebp)
+    name[1] = '0' + (i / 64);
+    2acc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2acf:	8d 50 3f             	lea    0x3f(%eax),%edx
+    2ad2:	85 c0                	test   %eax,%eax
+    2ad4:	0f 48 c2             	cmovs  %edx,%eax
+    2ad7:	c1 f8 06             	sar    $0x6,%eax
+    2ada:	83 c0 30             	add    $0x30,%eax
+    2add:	88 45 e3             	mov    %al,-0x1d(%ebp)
+    name[2] = '0' + (i % 64);
+    2ae0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    2ae3:	89 d0                	mov    %edx,%eax
+    2ae5:	c1 f8 1f             	sar    $0x1f,%eax
+    2ae8:	c1 e8 1a             	shr    $0x1a,%eax
+    2aeb:	01 c2                	add    %eax,%edx
+    2aed:	83 e2 3f             	and    $0x3f,%edx
+    2af0:	29 c2                	sub    %eax,%edx
+    2af2:	89 d0                	mov    %edx,%eax
+    2af4:	83 c0 30             	add    $0x30,%eax
+    2af7:	88 45 e4             	mov    %al,-0x1c(%ebp)
+    name[3] = '\0';
+    2afa:	c6 45 e5 00          	movb   $0x0,-0x1b(%ebp)
+    if(link("bd", name) != 0){
+    2afe:	83 ec 08             	sub    $0x8,%esp
+    2b01:	8d 45 e2             	lea    -0x1e(%ebp),%eax
+    2b04:	50                   	push   %eax
+    2b05:	68 46 7f 00 00       	push   $0x7f46
+    2b0a:	e8 e0 3a 00 00       	call   65ef <link>
+    2b0f:	83 c4 10             	add    $0x10,%esp
+    2b12:	85 c0                	test   %eax,%eax
+    2b14:	74 17                	je     2b2d <bigdir+0x108>
+      printf(1, "bigdir link failed\n");
+    2b16:	83 ec 08             	sub    $0x8,%esp
+    2b19:	68 5f 7f 00 00       	push   $0x7f5f
+    2b1e:	6a 01                	push   $0x1
+    2b20:	e8 98 3c 00 00       	call   67bd <printf>
+    2b25:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2b28:	e8 2c 47 00 00       	call   7259 <exit>
+  for(i = 0; i < 500; i++){
+    2b2d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2b31:	81 7d f4 f3 01 00 00 	cmpl   $0x1f3,-0xc(%ebp)
+    2b38:	7e 8e                	jle    2ac8 <bigdir+0xa3>
+    }
+  }
+
+  // Reading it as a plain file shows each entry once.
+  fd = open(".", 0);
+    2b3a:	83 ec 08             	sub    $0x8,%esp
+    2b3d:	6a 00                	push   $0x0
+    2b3f:	68 2b 7e 00 00       	push   $0x7e2b
+    2b44:	e8 6a 3a 00 00       	call   65b3 <open>
+    2b49:	83 c4 10             	add    $0x10,%esp
+    2b4c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  n = 0;
+    2b4f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  while(read(fd, &de, sizeof(de)) == sizeof(de))
+    2b56:	eb 15                	jmp    2b6d <bigdir+0x148>
+    if(de.inum != 0 && de.name[0] == 'x')
+    2b58:	0f b7 45 d2          	movzwl -0x2e(%ebp),%eax
+    2b5c:	66 85 c0             	test   %ax,%ax
+    2b5f:	74 0c                	je     2b6d <bigdir+0x148>
+    2b61:	0f b6 45 d4          	movzbl -0x2c(%ebp),%eax
+    2b65:	3c 78                	cmp    $0x78,%al
+    2b67:	75 04                	jne    2b6d <bigdir+0x148>
+      n++;
+    2b69:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+  while(read(fd, &de, sizeof(de)) == sizeof(de))
+    2b6d:	83 ec 04             	sub    $0x4,%esp
+    2b70:	6a 10                	push   $0x10
+    2b72:	8d 45 d2             	lea    -0x2e(%ebp),%eax
+    2b75:	50                   	push   %eax
+    2b76:	ff 75 ec             	push   -0x14(%ebp)
+    2b79:	e8 ea 39 00 00       	call   6568 <read>
+    2b7e:	83 c4 10             	add    $0x10,%esp
+    2b81:	83 f8 10             	cmp    $0x10,%eax
+    2b84:	74 d2                	je     2b58 <bigdir+0x133>
+  close(fd);
+    2b86:	83 ec 0c             	sub    $0xc,%esp
+    2b89:	ff 75 ec             	push   -0x14(%ebp)
+    2b8c:	e8 e0 46 00 00       	call   7271 <close>
+    2b91:	83 c4 10             	add    $0x10,%esp
+  if(n != 500){
+    2b94:	81 7d f0 f4 01 00 00 	cmpl   $0x1f4,-0x10(%ebp)
+    2b9b:	74 1a                	je     2bb7 <bigdir+0x192>
+    printf(1, "bigdir read %d entries\n", n);
+    2b9d:	83 ec 04             	sub    $0x4,%esp
+    2ba0:	ff 75 f0             	push   -0x10(%ebp)
+    2ba3:	68 73 7f 00 00       	push   $0x7f73
+    2ba8:	6a 01                	push   $0x1
+    2baa:	e8 0e 3c 00 00       	call   67bd <printf>
+    2baf:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2bb2:	e8 a2 46 00 00       	call   7259 <exit>
+  }
+
+  unlink("bd");
+    2bb7:	83 ec 0c             	sub    $0xc,%esp
+    2bba:	68 46 7f 00 00       	push   $0x7f46
+    2bbf:	e8 0d 3a 00 00       	call   65d1 <unlink>
+    2bc4:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 500; i++){
+    2bc7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2bce:	eb 64                	jmp    2c34 <bigdir+0x20f>
+    name[0] = 'x';
+    2bd0:	c6 45 e2 78          	movb   $0x78,-0x1e(%ebp)
+    name[1] = '0' + (i / 64);
+    2bd4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2bd7:	8d 50 3f             	lea    0x3f(%eax),%edx
+    2bda:	85 c0                	test   %eax,%eax
+    2bdc:	0f 48 c2             	cmovs  %edx,%eax
+    2bdf:	c1 f8 06             	sar    $0x6,%eax
+    2be2:	83 c0 30             	add    $0x30,%eax
+    2be5:	88 45 e3             	mov    %al,-0x1d(%ebp)
+    name[2] = '0' + (i % 64);
+    2be8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    2beb:	89 d0                	mov    %edx,%eax
+    2bed:	c1 f8 1f             	sar    $0x1f,%eax
+    2bf0:	c1 e8 1a             	shr    $0x1a,%eax
+    2bf3:	01 c2                	add    %eax,%edx
+    2bf5:	83 e2 3f             	and    $0x3f,%edx
+    2bf8:	29 c2                	sub    %eax,%edx
+    2bfa:	89 d0                	mov    %edx,%eax
+    2bfc:	83 c0 30             	add    $0x30,%eax
+    2bff:	88 45 e4             	mov    %al,-0x1c(%ebp)
+    name[3] = '\0';
+    2c02:	c6 45 e5 00          	movb   $0x0,-0x1b(%ebp)
+    if(unlink(name) != 0){
+    2c06:	83 ec 0c             	sub    $0xc,%esp
+    2c09:	8d 45 e2             	lea    -0x1e(%ebp),%eax
+    2c0c:	50                   	push   %eax
+    2c0d:	e8 bf 39 00 00       	call   65d1 <unlink>
+    2c12:	83 c4 10             	add    $0x10,%esp
+    2c15:	85 c0                	test   %eax,%eax
+    2c17:	74 17                	je     2c30 <bigdir+0x20b>
+      printf(1, "bigdir unlink failed");
+    2c19:	83 ec 08             	sub    $0x8,%esp
+    2c1c:	68 8b 7f 00 00       	push   $0x7f8b
+    2c21:	6a 01                	push   $0x1
+    2c23:	e8 95 3b 00 00       	call   67bd <printf>
+    2c28:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2c2b:	e8 29 46 00 00       	call   7259 <exit>
+  for(i = 0; i < 500; i++){
+    2c30:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2c34:	81 7d f4 f3 01 00 00 	cmpl   $0x1f3,-0xc(%ebp)
+    2c3b:	7e 93                	jle    2bd0 <bigdir+0x1ab>
+    }
+  }
+  if(chdir("..") != 0 || unlink("bigd") != 0){
+    2c3d:	83 ec 0c             	sub    $0xc,%esp
+    2c40:	68 f2 76 00 00       	push   $0x76f2
+    2c45:	e8 c3 39 00 00       	call   660d <chdir>
+    2c4a:	83 c4 10             	add    $0x10,%esp
+    2c4d:	85 c0                	test   %eax,%eax
+    2c4f:	75 14                	jne    2c65 <bigdir+0x240>
+    2c51:	83 ec 0c             	sub    $0xc,%esp
+    2c54:	68 2c 7f 00 00       	push   $0x7f2c
+    2c59:	e8 73 39 00 00       	call   65d1 <unlink>
+    2c5e:	83 c4 10             	add    $0x10,%esp
+    2c61:	85 c0                	test   %eax,%eax
+    2c63:	74 17                	je     2c7c <bigdir+0x257>
+    printf(1, "bigdir unlink bigd failed\n");
+    2c65:	83 ec 08             	sub    $0x8,%esp
+    2c68:	68 a0 7f 00 00       	push   $0x7fa0
+    2c6d:	6a 01                	push   $0x1
+    2c6f:	e8 49 3b 00 00       	call   67bd <printf>
+    2c74:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2c77:	e8 dd 45 00 00       	call   7259 <exit>
+  }
+
+  printf(1, "bigdir ok\n");
+    2c7c:	83 ec 08             	sub    $0x8,%esp
+    2c7f:	68 bb 7f 00 00       	push   $0x7fbb
+    2c84:	6a 01                	push   $0x1
+    2c86:	e8 32 3b 00 00       	call   67bd <printf>
+    2c8b:	83 c4 10             	add    $0x10,%esp
+}
+    2c8e:	90                   	nop
+    2c8f:	c9                   	leave
+    2c90:	c3                   	ret
+
+00002c91 <hsname>:
+
+// Name i of the hashsplit test, with prefix c.
+static void
+hsname(char *name, char c, int i)
+{
+    2c91:	55                   	push   %ebp
+    2c92:	89 e5                	mov    %esp,%ebp
+    2c94:	83 ec 04             	sub    $0x4,%esp
+    2c97:	8b 45 0c             	mov    0xc(%ebp),%eax
+    2c9a:	88 45 fc             	mov    %al,-0x4(%ebp)
+  name[0] = c;
+    2c9d:	8b 45 08             	mov    0x8(%ebp),%eax
+    2ca0:	0f b6 55 fc          	movzbl -0x4(%ebp),%edx
+    2ca4:	88 10                	mov    %dl,(%eax)
+  name[1] = '0' + i/1000;
+    2ca6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    2ca9:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    2cae:	89 c8                	mov    %ecx,%eax
+    2cb0:	f7 ea                	imul   %edx
+    2cb2:	c1 fa 06             	sar    $0x6,%edx
+    2cb5:	89 c8                	mov    %ecx,%eax
+    2cb7:	c1 f8 1f             	sar    $0x1f,%eax
+    2cba:	29 c2                	sub    %eax,%edx
+    2cbc:	89 d0                	mov    %edx,%eax
+    2cbe:	8d 50 30             	lea    0x30(%eax),%edx
+    2cc1:	8b 45 08             	mov    0x8(%ebp),%eax
+    2cc4:	83 c0 01             	add    $0x1,%eax
+    2cc7:	88 10                	mov    %dl,(%eax)
+  name[2] = '0' + i/100%10;
+    2cc9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    2ccc:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    2cd1:	89 c8                	mov    %ecx,%eax
+    2cd3:	f7 ea                	imul   %edx
+    2cd5:	c1 fa 05             	sar    $0x5,%edx
+    2cd8:	89 c8                	mov    %ecx,%eax
+    2cda:	c1 f8 1f             	sar    $0x1f,%eax
+    2cdd:	89 d1                	mov    %edx,%ecx
+    2cdf:	29 c1                	sub    %eax,%ecx
+    2ce1:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    2ce6:	89 c8                	mov    %ecx,%eax
+    2ce8:	f7 ea                	imul   %edx
+    2cea:	c1 fa 02             	sar    $0x2,%edx
+    2ced:	89 c8                	mov    %ecx,%eax
+    2cef:	c1 f8 1f             	sar    $0x1f,%eax
+    2cf2:	29 c2                	sub    %eax,%edx
+    2cf4:	89 d0                	mov    %edx,%eax
+    2cf6:	c1 e0 02             	shl    $0x2,%eax
+    2cf9:	01 d0                	add    %edx,%eax
+    2cfb:	01 c0                	add    %eax,%eax
+    2cfd:	29 c1                	sub    %eax,%ecx
+    2cff:	89 ca                	mov    %ecx,%edx
+    2d01:	89 d0                	mov    %edx,%eax
+    2d03:	8d 50 30             	lea    0x30(%eax),%edx
+    2d06:	8b 45 08             	mov    0x8(%ebp),%eax
+    2d09:	83 c0 02             	add    $0x2,%eax
+    2d0c:	88 10                	mov    %dl,(%eax)
+  name[3] = '0' + i/10%10;
+    2d0e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    2d11:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    2d16:	89 c8                	mov    %ecx,%eax
+    2d18:	f7 ea                	imul   %edx
+    2d1a:	c1 fa 02             	sar    $0x2,%edx
+    2d1d:	89 c8                	mov    %ecx,%eax
+    2d1f:	c1 f8 1f             	sar    $0x1f,%eax
+    2d22:	89 d1                	mov    %edx,%ecx
+    2d24:	29 c1                	sub    %eax,%ecx
+    2d26:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    2d2b:	89 c8                	mov    %ecx,%eax
+    2d2d:	f7 ea                	imul   %edx
+    2d2f:	c1 fa 02             	sar    $0x2,%edx
+    2d32:	89 c8                	mov    %ecx,%eax
+    2d34:	c1 f8 1f             	sar    $0x1f,%eax
+    2d37:	29 c2                	sub    %eax,%edx
+    2d39:	89 d0                	mov    %edx,%eax
+    2d3b:	c1 e0 02             	shl    $0x2,%eax
+    2d3e:	01 d0                	add    %edx,%eax
+    2d40:	01 c0                	add    %eax,%eax
+    2d42:	29 c1                	sub    %eax,%ecx
+    2d44:	89 ca                	mov    %ecx,%edx
+    2d46:	89 d0                	mov    %edx,%eax
+    2d48:	8d 50 30             	lea    0x30(%eax),%edx
+    2d4b:	8b 45 08             	mov    0x8(%ebp),%eax
+    2d4e:	83 c0 03             	add    $0x3,%eax
+    2d51:	88 10                	mov    %dl,(%eax)
+  name[4] = '0' + i%10;
+    2d53:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    2d56:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    2d5b:	89 c8                	mov    %ecx,%eax
+    2d5d:	f7 ea                	imul   %edx
+    2d5f:	c1 fa 02             	sar    $0x2,%edx
+    2d62:	89 c8                	mov    %ecx,%eax
+    2d64:	c1 f8 1f             	sar    $0x1f,%eax
+    2d67:	29 c2                	sub    %eax,%edx
+    2d69:	89 d0                	mov    %edx,%eax
+    2d6b:	c1 e0 02             	shl    $0x2,%eax
+    2d6e:	01 d0                	add    %edx,%eax
+    2d70:	01 c0                	add    %eax,%eax
+    2d72:	29 c1                	sub    %eax,%ecx
+    2d74:	89 ca                	mov    %ecx,%edx
+    2d76:	89 d0                	mov    %edx,%eax
+    2d78:	8d 50 30             	lea    0x30(%eax),%edx
+    2d7b:	8b 45 08             	mov    0x8(%ebp),%eax
+    2d7e:	83 c0 04             	add    $0x4,%eax
+    2d81:	88 10                	mov    %dl,(%eax)
+  name[5] = '\0';
+    2d83:	8b 45 08             	mov    0x8(%ebp),%eax
+    2d86:	83 c0 05             	add    $0x5,%eax
+    2d89:	c6 00 00             	movb   $0x0,(%eax)
+}
+    2d8c:	90                   	nop
+    2d8d:	c9                   	leave
+    2d8e:	c3                   	ret
+
+00002d8f <hashsplit>:
+// Crowd one bucket of a hashed directory so its chain is
+// longer than a split can rewrite at once before its turn to
+// be split comes; the table must still keep growing.
+void
+hashsplit(void)
+{
+    2d8f:	55                   	push   %ebp
+    2d90:	89 e5                	mov    %esp,%ebp
+    2d92:	81 ec 28 02 00 00    	sub    $0x228,%esp
+  struct dirhdr hdr[DPB];
+  char name[DIRSIZ];
+  int i, k, fd, n;
+
+  printf(1, "hashsplit test\n");
+    2d98:	83 ec 08             	sub    $0x8,%esp
+    2d9b:	68 c6 7f 00 00       	push   $0x7fc6
+    2da0:	6a 01                	push   $0x1
+    2da2:	e8 16 3a 00 00       	call   67bd <printf>
+    2da7:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("hsd") != 0 || chdir("hsd") != 0){
+    2daa:	83 ec 0c             	sub    $0xc,%esp
+    2dad:	68 d6 7f 00 00       	push   $0x7fd6
+    2db2:	e8 47 38 00 00       	call   65fe <mkdir>
+    2db7:	83 c4 10             	add    $0x10,%esp
+    2dba:	85 c0                	test   %eax,%eax
+    2dbc:	75 14                	jne    2dd2 <hashsplit+0x43>
+    2dbe:	83 ec 0c             	sub    $0xc,%esp
+    2dc1:	68 d6 7f 00 00       	push   $0x7fd6
+    2dc6:	e8 42 38 00 00       	call   660d <chdir>
+    2dcb:	83 c4 10             	add    $0x10,%esp
+    2dce:	85 c0                	test   %eax,%eax
+    2dd0:	74 17                	je     2de9 <hashsplit+0x5a>
+    printf(1, "hashsplit mkdir failed\n");
+    2dd2:	83 ec 08             	sub    $0x8,%esp
+    2dd5:	68 da 7f 00 00       	push   $0x7fda
+    2dda:	6a 01                	push   $0x1
+    2ddc:	e8 dc 39 00 00       	call   67bd <printf>
+    2de1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2de4:	e8 70 44 00 00       	call   7259 <exit>
+  }
+  fd = open("f", O_CREATE);
+    2de9:	83 ec 08             	sub    $0x8,%esp
+    2dec:	68 00 02 00 00       	push   $0x200
+    2df1:	68 f2 7f 00 00       	push   $0x7ff2
+    2df6:	e8 b8 37 00 00       	call   65b3 <open>
+    2dfb:	83 c4 10             	add    $0x10,%esp
+    2dfe:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    2e01:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2e05:	79 17                	jns    2e1e <hashsplit+0x8f>
+    printf(1, "hashsplit create failed\n");
+    2e07:	83 ec 08             	sub    $0x8,%esp
+    2e0a:	68 f4 7f 00 00       	push   $0x7ff4
+    2e0f:	6a 01                	push   $0x1
+    2e11:	e8 a7 39 00 00       	call   67bd <printf>
+    2e16:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2e19:	e8 3b 44 00 00       	call   7259 <exit>
+  }
+  close(fd);
+    2e1e:	83 ec 0c             	sub    $0xc,%esp
+    2e21:	ff 75 ec             	push   -0x14(%ebp)
+    2e24:	e8 48 44 00 00       	call   7271 <close>
+    2e29:	83 c4 10             	add    $0x10,%esp
+
+  // Enough names to make it a hash table, then 300 that all
+  // fall in bucket 0 until the table has 8 buckets, when
+  // bucket 0's turn to be split comes round again.
+  for(i = 0; i < 100; i++){
+    2e2c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2e33:	eb 4d                	jmp    2e82 <hashsplit+0xf3>
+    hsname(name, 'a', i);
+    2e35:	83 ec 04             	sub    $0x4,%esp
+    2e38:	ff 75 f4             	push   -0xc(%ebp)
+    2e3b:	6a 61                	push   $0x61
+    2e3d:	8d 85 da fd ff ff    	lea    -0x226(%ebp),%eax
+    2e43:	50                   	push   %eax
+    2e44:	e8 48 fe ff ff       	call   2c91 <hsname>
+    2e49:	83 c4 10             	add    $0x10,%esp
+    if(link("f", name) != 0){
+    2e4c:	83 ec 08             	sub    $0x8,%esp
+    2e4f:	8d 85 da fd ff ff    	lea    -0x226(%ebp),%eax
+    2e55:	50                   	push   %eax
+    2e56:	68 f2 7f 00 00       	push   $0x7ff2
+    2e5b:	e8 8f 37 00 00       	call   65ef <link>
+    2e60:	83 c4 10             	add    $0x10,%esp
+    2e63:	85 c0                	test   %eax,%eax
+    2e65:	74 17                	je     2e7e <hashsplit+0xef>
+      printf(1, "hashsplit link failed\n");
+    2e67:	83 ec 08             	sub    $0x8,%esp
+    2e6a:	68 0d 80 00 00       	push   $0x800d
+    2e6f:	6a 01                	push   $0x1
+    2e71:	e8 47 39 00 00       	call   67bd <printf>
+    2e76:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2e79:	e8 db 43 00 00       	call   7259 <exit>
+  for(i = 0; i < 100; i++){
+    2e7e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2e82:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+    2e86:	7e ad                	jle    2e35 <hashsplit+0xa6>
+    }
+  }
+  for(i = 0, k = 0; k < 300; i++){
+    2e88:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2e8f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    2e96:	eb 6d                	jmp    2f05 <hashsplit+0x176>
+    hsname(name, 'c', i);
+    2e98:	83 ec 04             	sub    $0x4,%esp
+    2e9b:	ff 75 f4             	push   -0xc(%ebp)
+    2e9e:	6a 63                	push   $0x63
+    2ea0:	8d 85 da fd ff ff    	lea    -0x226(%ebp),%eax
+    2ea6:	50                   	push   %eax
+    2ea7:	e8 e5 fd ff ff       	call   2c91 <hsname>
+    2eac:	83 c4 10             	add    $0x10,%esp
+    if(dirhash(name) % 8 != 0)
+    2eaf:	83 ec 0c             	sub    $0xc,%esp
+    2eb2:	8d 85 da fd ff ff    	lea    -0x226(%ebp),%eax
+    2eb8:	50                   	push   %eax
+    2eb9:	e8 42 d1 ff ff       	call   0 <dirhash>
+    2ebe:	83 c4 10             	add    $0x10,%esp
+    2ec1:	83 e0 07             	and    $0x7,%eax
+    2ec4:	85 c0                	test   %eax,%eax
+    2ec6:	75 38                	jne    2f00 <hashsplit+0x171>
+      continue;
+    if(link("f", name) != 0){
+    2ec8:	83 ec 08             	sub    $0x8,%esp
+    2ecb:	8d 85 da fd ff ff    	lea    -0x226(%ebp),%eax
+    2ed1:	50                   	push   %eax
+    2ed2:	68 f2 7f 00 00       	push   $0x7ff2
+    2ed7:	e8 13 37 00 00       	call   65ef <link>
+    2edc:	83 c4 10             	add    $0x10,%esp
+    2edf:	85 c0                	test   %eax,%eax
+    2ee1:	74 17                	je     2efa <hashsplit+0x16b>
+      printf(1, "hashsplit link failed\n");
+    2ee3:	83 ec 08             	sub    $0x8,%esp
+    2ee6:	68 0d 80 00 00       	push   $0x800d
+    2eeb:	6a 01                	push   $0x1
+    2eed:	e8 cb 38 00 00       	call   67bd <printf>
+    2ef2:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2ef5:	e8 5f 43 00 00       	call   7259 <exit>
+    }
+    k++;
+    2efa:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    2efe:	eb 01                	jmp    2f01 <hashsplit+0x172>
+      continue;
+    2f00:	90                   	nop
+  for(i = 0, k = 0; k < 300; i++){
+    2f01:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2f05:	81 7d f0 2b 01 00 00 	cmpl   $0x12b,-0x10(%ebp)
+    2f0c:	7e 8a                	jle    2e98 <hashsplit+0x109>
+  }
+
+  fd = open(".", 0);
+    2f0e:	83 ec 08             	sub    $0x8,%esp
+    2f11:	6a 00                	push   $0x0
+    2f13:	68 2b 7e 00 00       	push   $0x7e2b
+    2f18:	e8 96 36 00 00       	call   65b3 <open>
+    2f1d:	83 c4 10             	add    $0x10,%esp
+    2f20:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(read(fd, hdr, sizeof(hdr)) != sizeof(hdr)){
+    2f23:	83 ec 04             	sub    $0x4,%esp
+    2f26:	68 00 02 00 00       	push   $0x200
+    2f2b:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    2f31:	50                   	push   %eax
+    2f32:	ff 75 ec             	push   -0x14(%ebp)
+    2f35:	e8 2e 36 00 00       	call   6568 <read>
+    2f3a:	83 c4 10             	add    $0x10,%esp
+    2f3d:	3d 00 02 00 00       	cmp    $0x200,%eax
+    2f42:	74 17                	je     2f5b <hashsplit+0x1cc>
+    printf(1, "hashsplit read failed\n");
+    2f44:	83 ec 08             	sub    $0x8,%esp
+    2f47:	68 24 80 00 00       	push   $0x8024
+    2f4c:	6a 01                	push   $0x1
+    2f4e:	e8 6a 38 00 00       	call   67bd <printf>
+    2f53:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2f56:	e8 fe 42 00 00       	call   7259 <exit>
+  }
+  close(fd);
+    2f5b:	83 ec 0c             	sub    $0xc,%esp
+    2f5e:	ff 75 ec             	push   -0x14(%ebp)
+    2f61:	e8 0b 43 00 00       	call   7271 <close>
+    2f66:	83 c4 10             	add    $0x10,%esp
+  n = HDRWORD(hdr, HDRNBUCKET);
+    2f69:	0f b7 85 ea fd ff ff 	movzwl -0x216(%ebp),%eax
+    2f70:	0f b7 c0             	movzwl %ax,%eax
+    2f73:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(n <= 8){
+    2f76:	83 7d e8 08          	cmpl   $0x8,-0x18(%ebp)
+    2f7a:	7f 1a                	jg     2f96 <hashsplit+0x207>
+    printf(1, "hashsplit: table stuck at %d buckets\n", n);
+    2f7c:	83 ec 04             	sub    $0x4,%esp
+    2f7f:	ff 75 e8             	push   -0x18(%ebp)
+    2f82:	68 3c 80 00 00       	push   $0x803c
+    2f87:	6a 01                	push   $0x1
+    2f89:	e8 2f 38 00 00       	call   67bd <printf>
+    2f8e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2f91:	e8 c3 42 00 00       	call   7259 <exit>
+  }
+
+  unlink("f");
+    2f96:	83 ec 0c             	sub    $0xc,%esp
+    2f99:	68 f2 7f 00 00       	push   $0x7ff2
+    2f9e:	e8 2e 36 00 00       	call   65d1 <unlink>
+    2fa3:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    2fa6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2fad:	eb 48                	jmp    2ff7 <hashsplit+0x268>
+    hsname(name, 'a', i);
+    2faf:	83 ec 04             	sub    $0x4,%esp
+    2fb2:	ff 75 f4             	push   -0xc(%ebp)
+    2fb5:	6a 61                	push   $0x61
+    2fb7:	8d 85 da fd ff ff    	lea    -0x226(%ebp),%eax
+    2fbd:	50                   	push   %eax
+    2fbe:	e8 ce fc ff ff       	call   2c91 <hsname>
+    2fc3:	83 c4 10             	add    $0x10,%esp
+    if(unlink(name) != 0){
+    2fc6:	83 ec 0c             	sub    $0xc,%esp
+    2fc9:	8d 85 da fd ff ff    	lea    -0x226(%ebp),%eax
+    2fcf:	50                   	push   %eax
+    2fd0:	e8 fc 35 00 00       	call   65d1 <unlink>
+    2fd5:	83 c4 10             	add    $0x10,%esp
+    2fd8:	85 c0                	test   %eax,%eax
+    2fda:	74 17                	je     2ff3 <hashsplit+0x264>
+      printf(1, "hashsplit unlink failed\n");
+    2fdc:	83 ec 08             	sub    $0x8,%esp
+    2fdf:	68 62 80 00 00       	push   $0x8062
+    2fe4:	6a 01                	push   $0x1
+    2fe6:	e8 d2 37 00 00       	call   67bd <printf>
+    2feb:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2fee:	e8 66 42 00 00       	call   7259 <exit>
+  for(i = 0; i < 100; i++){
+    2ff3:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2ff7:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+    2ffb:	7e b2                	jle    2faf <hashsplit+0x220>
+    }
+  }
+  for(i = 0, k = 0; k < 300; i++){
+    2ffd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3004:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    300b:	eb 68                	jmp    3075 <hashsplit+0x2e6>
+    hsname(name, 'c', i);
+    300d:	83 ec 04             	sub    $0x4,%esp
+    3010:	ff 75 f4             	push   -0xc(%ebp)
+    3013:	6a 63                	push   $0x63
+    3015:	8d 85 da fd ff ff    	lea    -0x226(%ebp),%eax
+    301b:	50                   	push   %eax
+    301c:	e8 70 fc ff ff       	call   2c91 <hsname>
+    3021:	83 c4 10             	add    $0x10,%esp
+    if(dirhash(name) % 8 != 0)
+    3024:	83 ec 0c             	sub    $0xc,%esp
+    3027:	8d 85 da fd ff ff    	lea    -0x226(%ebp),%eax
+    302d:	50                   	push   %eax
+    302e:	e8 cd cf ff ff       	call   0 <dirhash>
+    3033:	83 c4 10             	add    $0x10,%esp
+    3036:	83 e0 07             	and    $0x7,%eax
+    3039:	85 c0                	test   %eax,%eax
+    303b:	75 33                	jne    3070 <hashsplit+0x2e1>
+      continue;
+    if(unlink(name) != 0){
+    303d:	83 ec 0c             	sub    $0xc,%esp
+    3040:	8d 85 da fd ff ff    	lea    -0x226(%ebp),%eax
+    3046:	50                   	push   %eax
+    3047:	e8 85 35 00 00       	call   65d1 <unlink>
+    304c:	83 c4 10             	add    $0x10,%esp
+    304f:	85 c0                	test   %eax,%eax
+    3051:	74 17                	je     306a <hashsplit+0x2db>
+      printf(1, "hashsplit unlink failed\n");
+    3053:	83 ec 08             	sub    $0x8,%esp
+    3056:	68 62 80 00 00       	push   $0x8062
+    305b:	6a 01                	push   $0x1
+    305d:	e8 5b 37 00 00       	call   67bd <printf>
+    3062:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3065:	e8 ef 41 00 00       	call   7259 <exit>
+    }
+    k++;
+    306a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    306e:	eb 01                	jmp    3071 <hashsplit+0x2e2>
+      continue;
+    3070:	90                   	nop
+  for(i = 0, k = 0; k < 300; i++){
+    3071:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3075:	81 7d f0 2b 01 00 00 	cmpl   $0x12b,-0x10(%ebp)
+    307c:	7e 8f                	jle    300d <hashsplit+0x27e>
+  }
+  if(chdir("..") != 0 || unlink("hsd") != 0){
+    307e:	83 ec 0c             	sub    $0xc,%esp
+    3081:	68 f2 76 00 00       	push   $0x76f2
+    3086:	e8 82 35 00 00       	call   660d <chdir>
+    308b:	83 c4 10             	add    $0x10,%esp
+    308e:	85 c0                	test   %eax,%eax
+    3090:	75 14                	jne    30a6 <hashsplit+0x317>
+    3092:	83 ec 0c             	sub    $0xc,%esp
+    3095:	68 d6 7f 00 00       	push   $0x7fd6
+    309a:	e8 32 35 00 00       	call   65d1 <unlink>
+    309f:	83 c4 10             	add    $0x10,%esp
+    30a2:	85 c0                	test   %eax,%eax
+    30a4:	74 17                	je     30bd <hashsplit+0x32e>
+    printf(1, "hashsplit unlink hsd failed\n");
+    30a6:	83 ec 08             	sub    $0x8,%esp
+    30a9:	68 7b 80 00 00       	push   $0x807b
+    30ae:	6a 01                	push   $0x1
+    30b0:	e8 08 37 00 00       	call   67bd <printf>
+    30b5:	83 c4 10             	add    $0x10,%esp
+    exit();
+    30b8:	e8 9c 41 00 00       	call   7259 <exit>
+  }
+
+  printf(1, "hashsplit ok\n");
+    30bd:	83 ec 08             	sub    $0x8,%esp
+    30c0:	68 98 80 00 00       	push   $0x8098
+    30c5:	6a 01                	push   $0x1
+    30c7:	e8 f1 36 00 00       	call   67bd <printf>
+    30cc:	83 c4 10             	add    $0x10,%esp
+}
+    30cf:	90                   	nop
+    30d0:	c9                   	leave
+    30d1:	c3                   	ret
+
+000030d2 <subdir>:
+
+void
+subdir(void)
+{
+    30d2:	55                   	push   %ebp
+    30d3:	89 e5                	mov    %esp,%ebp
+    30d5:	83 ec 18             	sub    $0x18,%esp
+  int fd, cc;
+
+  printf(1, "subdir test\n");
+    30d8:	83 ec 08             	sub    $0x8,%esp
+    30db:	68 a6 80 00 00       	push   $0x80a6
+    30e0:	6a 01                	push   $0x1
+    30e2:	e8 d6 36 00 00       	call   67bd <printf>
+    30e7:	83 c4 10             	add    $0x10,%esp
+
+  unlink("ff");
+    30ea:	83 ec 0c             	sub    $0xc,%esp
+    30ed:	68 b3 80 00 00       	push   $0x80b3
+    30f2:	e8 da 34 00 00       	call   65d1 <unlink>
+    30f7:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("dd") != 0){
+    30fa:	83 ec 0c             	sub    $0xc,%esp
+    30fd:	68 b6 80 00 00       	push   $0x80b6
+    3102:	e8 f7 34 00 00       	call   65fe <mkdir>
+    3107:	83 c4 10             	add    $0x10,%esp
+    310a:	85 c0                	test   %eax,%eax
+    310c:	74 17                	je     3125 <subdir+0x53>
+    printf(1, "subdir mkdir dd failed\n");
+    310e:	83 ec 08             	sub    $0x8,%esp
+    3111:	68 b9 80 00 00       	push   $0x80b9
+    3116:	6a 01                	push   $0x1
+    3118:	e8 a0 36 00 00       	call   67bd <printf>
+    311d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3120:	e8 34 41 00 00       	call   7259 <exit>
+  }
+
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    3125:	83 ec 08             	sub    $0x8,%esp
+    3128:	68 02 02 00 00       	push   $0x202
+    312d:	68 d1 80 00 00       	push   $0x80d1
+    3132:	e8 7c 34 00 00       	call   65b3 <open>
+    3137:	83 c4 10             	add    $0x10,%esp
+    313a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    313d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3141:	79 17                	jns    315a <subdir+0x88>
+    printf(1, "create dd/ff failed\n");
+    3143:	83 ec 08             	sub    $0x8,%esp
+    3146:	68 d7 80 00 00       	push   $0x80d7
+    314b:	6a 01                	push   $0x1
+    314d:	e8 6b 36 00 00       	call   67bd <printf>
+    3152:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3155:	e8 ff 40 00 00       	call   7259 <exit>
+  }
+  write(fd, "ff", 2);
+    315a:	83 ec 04             	sub    $0x4,%esp
+    315d:	6a 02                	push   $0x2
+    315f:	68 b3 80 00 00       	push   $0x80b3
+    3164:	ff 75 f4             	push   -0xc(%ebp)
+    3167:	e8 0b 34 00 00       	call   6577 <write>
+    316c:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    316f:	83 ec 0c             	sub    $0xc,%esp
+    3172:	ff 75 f4             	push   -0xc(%ebp)
+    3175:	e8 f7 40 00 00       	call   7271 <close>
+    317a:	83 c4 10             	add    $0x10,%esp
+  
+  if(unlink("dd") >= 0){
+    317d:	83 ec 0c             	sub    $0xc,%esp
+    3180:	68 b6 80 00 00       	push   $0x80b6
+    3185:	e8 47 34 00 00       	call   65d1 <unlink>
+    318a:	83 c4 10             	add    $0x10,%esp
+    318d:	85 c0                	test   %eax,%eax
+    318f:	78 17                	js     31a8 <subdir+0xd6>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    3191:	83 ec 08             	sub    $0x8,%esp
+    3194:	68 ec 80 00 00       	push   $0x80ec
+    3199:	6a 01                	push   $0x1
+    319b:	e8 1d 36 00 00       	call   67bd <printf>
+    31a0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    31a3:	e8 b1 40 00 00       	call   7259 <exit>
+  }
+
+  if(mkdir("/dd/dd") != 0){
+    31a8:	83 ec 0c             	sub    $0xc,%esp
+    31ab:	68 12 81 00 00       	push   $0x8112
+    31b0:	e8 49 34 00 00       	call   65fe <mkdir>
+    31b5:	83 c4 10             	add    $0x10,%esp
+    31b8:	85 c0                	test   %eax,%eax
+    31ba:	74 17                	je     31d3 <subdir+0x101>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    31bc:	83 ec 08             	sub    $0x8,%esp
+    31bf:	68 19 81 00 00       	push   $0x8119
+    31c4:	6a 01                	push   $0x1
+    31c6:	e8 f2 35 00 00       	call   67bd <printf>
+    31cb:	83 c4 10             	add    $0x10,%esp
+    exit();
+    31ce:	e8 86 40 00 00       	call   7259 <exit>
+  }
+
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    31d3:	83 ec 08             	sub    $0x8,%esp
+    31d6:	68 02 02 00 00       	push   $0x202
+    31db:	68 34 81 00 00       	push   $0x8134
+    31e0:	e8 ce 33 00 00       	call   65b3 <open>
+    31e5:	83 c4 10             	add    $0x10,%esp
+    31e8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    31eb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    31ef:	79 17                	jns    3208 <subdir+0x136>
+    printf(1, "create dd/dd/ff failed\n");
+    31f1:	83 ec 08             	sub    $0x8,%esp
+    31f4:	68 3d 81 00 00       	push   $0x813d
+    31f9:	6a 01                	push   $0x1
+    31fb:	e8 bd 35 00 00       	call   67bd <printf>
+    3200:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3203:	e8 51 40 00 00       	call   7259 <exit>
+  }
+  write(fd, "FF", 2);
+    3208:	83 ec 04             	sub    $0x4,%esp
+    320b:	6a 02                	push   $0x2
+    320d:	68 55 81 00 00       	push   $0x8155
+    3212:	ff 75 f4             	push   -0xc(%ebp)
+    3215:	e8 5d 33 00 00       	call   6577 <write>
+    321a:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    321d:	83 ec 0c             	sub    $0xc,%esp
+    3220:	ff 75 f4             	push   -0xc(%ebp)
+    3223:	e8 49 40 00 00       	call   7271 <close>
+    3228:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("dd/dd/../ff", 0);
+    322b:	83 ec 08             	sub    $0x8,%esp
+    322e:	6a 00                	push   $0x0
+    3230:	68 58 81 00 00       	push   $0x8158
+    3235:	e8 79 33 00 00       	call   65b3 <open>
+    323a:	83 c4 10             	add    $0x10,%esp
+    323d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    3240:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3244:	79 17                	jns    325d <subdir+0x18b>
+    printf(1, "open dd/dd/../ff failed\n");
+    3246:	83 ec 08             	sub    $0x8,%esp
+    3249:	68 64 81 00 00       	push   $0x8164
+    324e:	6a 01                	push   $0x1
+    3250:	e8 68 35 00 00       	call   67bd <printf>
+    3255:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3258:	e8 fc 3f 00 00       	call   7259 <exit>
+  }
+  cc = read(fd, buf, sizeof(buf));
+    325d:	83 ec 04             	sub    $0x4,%esp
+    3260:	68 00 20 00 00       	push   $0x2000
+    3265:	68 80 9e 00 00       	push   $0x9e80
+    326a:	ff 75 f4             	push   -0xc(%ebp)
+    326d:	e8 f6 32 00 00       	call   6568 <read>
+    3272:	83 c4 10             	add    $0x10,%esp
+    3275:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(cc != 2 || buf[0] != 'f'){
+    3278:	83 7d f0 02          	cmpl   $0x2,-0x10(%ebp)
+    327c:	75 0b                	jne    3289 <subdir+0x1b7>
+    327e:	0f b6 05 80 9e 00 00 	movzbl 0x9e80,%eax
+    3285:	3c 66                	cmp    $0x66,%al
+    3287:	74 17                	je     32a0 <subdir+0x1ce>
+    printf(1, "dd/dd/../ff wrong content\n");
+    3289:	83 ec 08             	sub    $0x8,%esp
+    328c:	68 7d 81 00 00       	push   $0x817d
+    3291:	6a 01                	push   $0x1
+    3293:	e8 25 35 00 00       	call   67bd <printf>
+    3298:	83 c4 10             	add    $0x10,%esp
+    exit();
+    329b:	e8 b9 3f 00 00       	call   7259 <exit>
+  }
+  close(fd);
+    32a0:	83 ec 0c             	sub    $0xc,%esp
+    32a3:	ff 75 f4             	push   -0xc(%ebp)
+    32a6:	e8 c6 3f 00 00       	call   7271 <close>
+    32ab:	83 c4 10             	add    $0x10,%esp
+
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    32ae:	83 ec 08             	sub    $0x8,%esp
+    32b1:	68 98 81 00 00       	push   $0x8198
+    32b6:	68 34 81 00 00       	push   $0x8134
+    32bb:	e8 2f 33 00 00       	call   65ef <link>
+    32c0:	83 c4 10             	add    $0x10,%esp
+    32c3:	85 c0                	test   %eax,%eax
+    32c5:	74 17                	je     32de <subdir+0x20c>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    32c7:	83 ec 08             	sub    $0x8,%esp
+    32ca:	68 a4 81 00 00       	push   $0x81a4
+    32cf:	6a 01                	push   $0x1
+    32d1:	e8 e7 34 00 00       	call   67bd <printf>
+    32d6:	83 c4 10             	add    $0x10,%esp
+    exit();
+    32d9:	e8 7b 3f 00 00       	call   7259 <exit>
+  }
+
+  if(unlink("dd/dd/ff") != 0){
+    32de:	83 ec 0c             	sub    $0xc,%esp
+    32e1:	68 34 81 00 00       	push   $0x8134
+    32e6:	e8 e6 32 00 00       	call   65d1 <unlink>
+    32eb:	83 c4 10             	add    $0x10,%esp
+    32ee:	85 c0                	test   %eax,%eax
+    32f0:	74 17                	je     3309 <subdir+0x237>
+    printf(1, "unlink dd/dd/ff failed\n");
+    32f2:	83 ec 08             	sub    $0x8,%esp
+    32f5:	68 c5 81 00 00       	push   $0x81c5
+    32fa:	6a 01                	push   $0x1
+    32fc:	e8 bc 34 00 00       	call   67bd <printf>
+    3301:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3304:	e8 50 3f 00 00       	call   7259 <exit>
+  }
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    3309:	83 ec 08             	sub    $0x8,%esp
+    330c:	6a 00                	push   $0x0
+    330e:	68 34 81 00 00       	push   $0x8134
+    3313:	e8 9b 32 00 00       	call   65b3 <open>
+    3318:	83 c4 10             	add    $0x10,%esp
+    331b:	85 c0                	test   %eax,%eax
+    331d:	78 17                	js     3336 <subdir+0x264>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    331f:	83 ec 08             	sub    $0x8,%esp
+    3322:	68 e0 81 00 00       	push   $0x81e0
+    3327:	6a 01                	push   $0x1
+    3329:	e8 8f 34 00 00       	call   67bd <printf>
+    332e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3331:	e8 23 3f 00 00       	call   7259 <exit>
+  }
+
+  if(chdir("dd") != 0){
+    3336:	83 ec 0c             	sub    $0xc,%esp
+    3339:	68 b6 80 00 00       	push   $0x80b6
+    333e:	e8 ca 32 00 00       	call   660d <chdir>
+    3343:	83 c4 10             	add    $0x10,%esp
+    3346:	85 c0                	test   %eax,%eax
+    3348:	74 17                	je     3361 <subdir+0x28f>
+    printf(1, "chdir dd failed\n");
+    334a:	83 ec 08             	sub    $0x8,%esp
+    334d:	68 04 82 00 00       	push   $0x8204
+    3352:	6a 01                	push   $0x1
+    3354:	e8 64 34 00 00       	call   67bd <printf>
+    3359:	83 c4 10             	add    $0x10,%esp
+    exit();
+    335c:	e8 f8 3e 00 00       	call   7259 <exit>
+  }
+  if(chdir("dd/../../dd") != 0){
+    3361:	83 ec 0c             	sub    $0xc,%esp
+    3364:	68 15 82 00 00       	push   $0x8215
+    3369:	e8 9f 32 00 00       	call   660d <chdir>
+    336e:	83 c4 10             	add    $0x10,%esp
+    3371:	85 c0                	test   %eax,%eax
+    3373:	74 17                	je     338c <subdir+0x2ba>
+    printf(1, "chdir dd/../../dd failed\n");
+    3375:	83 ec 08             	sub    $0x8,%esp
+    3378:	68 21 82 00 00       	push   $0x8221
+    337d:	6a 01                	push   $0x1
+    337f:	e8 39 34 00 00       	call   67bd <printf>
+    3384:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3387:	e8 cd 3e 00 00       	call   7259 <exit>
+  }
+  if(chdir("dd/../../../dd") != 0){
+    338c:	83 ec 0c             	sub    $0xc,%esp
+    338f:	68 3b 82 00 00       	push   $0x823b
+    3394:	e8 74 32 00 00       	call   660d <chdir>
+    3399:	83 c4 10             	add    $0x10,%esp
+    339c:	85 c0                	test   %eax,%eax
+    339e:	74 17                	je     33b7 <subdir+0x2e5>
+    printf(1, "chdir dd/../../dd failed\n");
+    33a0:	83 ec 08             	sub    $0x8,%esp
+    33a3:	68 21 82 00 00       	push   $0x8221
+    33a8:	6a 01                	push   $0x1
+    33aa:	e8 0e 34 00 00       	call   67bd <printf>
+    33af:	83 c4 10             	add    $0x10,%esp
+    exit();
+    33b2:	e8 a2 3e 00 00       	call   7259 <exit>
+  }
+  if(chdir("./..") != 0){
+    33b7:	83 ec 0c             	sub    $0xc,%esp
+    33ba:	68 4a 82 00 00       	push   $0x824a
+    33bf:	e8 49 32 00 00       	call   660d <chdir>
+    33c4:	83 c4 10             	add    $0x10,%esp
+    33c7:	85 c0                	test   %eax,%eax
+    33c9:	74 17                	je     33e2 <subdir+0x310>
+    printf(1, "chdir ./.. failed\n");
+    33cb:	83 ec 08             	sub    $0x8,%esp
+    33ce:	68 4f 82 00 00       	push   $0x824f
+    33d3:	6a 01                	push   $0x1
+    33d5:	e8 e3 33 00 00       	call   67bd <printf>
+    33da:	83 c4 10             	add    $0x10,%esp
+    exit();
+    33dd:	e8 77 3e 00 00       	call   7259 <exit>
+  }
+
+  fd = open("dd/dd/ffff", 0);
+    33e2:	83 ec 08             	sub    $0x8,%esp
+    33e5:	6a 00                	push   $0x0
+    33e7:	68 98 81 00 00       	push   $0x8198
+    33ec:	e8 c2 31 00 00       	call   65b3 <open>
+    33f1:	83 c4 10             	add    $0x10,%esp
+    33f4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    33f7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    33fb:	79 17                	jns    3414 <subdir+0x342>
+    printf(1, "open dd/dd/ffff failed\n");
+    33fd:	83 ec 08             	sub    $0x8,%esp
+    3400:	68 62 82 00 00       	push   $0x8262
+    3405:	6a 01                	push   $0x1
+    3407:	e8 b1 33 00 00       	call   67bd <printf>
+    340c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    340f:	e8 45 3e 00 00       	call   7259 <exit>
+  }
+  if(read(fd, buf, sizeof(buf)) != 2){
+    3414:	83 ec 04             	sub    $0x4,%esp
+    3417:	68 00 20 00 00       	push   $0x2000
+    341c:	68 80 9e 00 00       	push   $0x9e80
+    3421:	ff 75 f4             	push   -0xc(%ebp)
+    3424:	e8 3f 31 00 00       	call   6568 <read>
+    3429:	83 c4 10             	add    $0x10,%esp
+    342c:	83 f8 02             	cmp    $0x2,%eax
+    342f:	74 17                	je     3448 <subdir+0x376>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    3431:	83 ec 08             	sub    $0x8,%esp
+    3434:	68 7a 82 00 00       	push   $0x827a
+    3439:	6a 01                	push   $0x1
+    343b:	e8 7d 33 00 00       	call   67bd <printf>
+    3440:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3443:	e8 11 3e 00 00       	call   7259 <exit>
+  }
+  close(fd);
+    3448:	83 ec 0c             	sub    $0xc,%esp
+    344b:	ff 75 f4             	push   -0xc(%ebp)
+    344e:	e8 1e 3e 00 00       	call   7271 <close>
+    3453:	83 c4 10             	add    $0x10,%esp
+
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    3456:	83 ec 08             	sub    $0x8,%esp
+    3459:	6a 00                	push   $0x0
+    345b:	68 34 81 00 00       	push   $0x8134
+    3460:	e8 4e 31 00 00       	call   65b3 <open>
+    3465:	83 c4 10             	add    $0x10,%esp
+    3468:	85 c0                	test   %eax,%eax
+    346a:	78 17                	js     3483 <subdir+0x3b1>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    346c:	83 ec 08             	sub    $0x8,%esp
+    346f:	68 98 82 00 00       	push   $0x8298
+    3474:	6a 01                	push   $0x1
+    3476:	e8 42 33 00 00       	call   67bd <printf>
+    347b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    347e:	e8 d6 3d 00 00       	call   7259 <exit>
+  }
+
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    3483:	83 ec 08             	sub    $0x8,%esp
+    3486:	68 02 02 00 00       	push   $0x202
+    348b:	68 bd 82 00 00       	push   $0x82bd
+    3490:	e8 1e 31 00 00       	call   65b3 <open>
+    3495:	83 c4 10             	add    $0x10,%esp
+    3498:	85 c0                	test   %eax,%eax
+    349a:	78 17                	js     34b3 <subdir+0x3e1>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    349c:	83 ec 08             	sub    $0x8,%esp
+    349f:	68 c6 82 00 00       	push   $0x82c6
+    34a4:	6a 01                	push   $0x1
+    34a6:	e8 12 33 00 00       	call   67bd <printf>
+    34ab:	83 c4 10             	add    $0x10,%esp
+    exit();
+    34ae:	e8 a6 3d 00 00       	call   7259 <exit>
+  }
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    34b3:	83 ec 08             	sub    $0x8,%esp
+    34b6:	68 02 02 00 00       	push   $0x202
+    34bb:	68 e2 82 00 00       	push   $0x82e2
+    34c0:	e8 ee 30 00 00       	call   65b3 <open>
+    34c5:	83 c4 10             	add    $0x10,%esp
+    34c8:	85 c0                	test   %eax,%eax
+    34ca:	78 17                	js     34e3 <subdir+0x411>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    34cc:	83 ec 08             	sub    $0x8,%esp
+    34cf:	68 eb 82 00 00       	push   $0x82eb
+    34d4:	6a 01                	push   $0x1
+    34d6:	e8 e2 32 00 00       	call   67bd <printf>
+    34db:	83 c4 10             	add    $0x10,%esp
+    exit();
+    34de:	e8 76 3d 00 00       	call   7259 <exit>
+  }
+  if(open("dd", O_CREATE) >= 0){
+    34e3:	83 ec 08             	sub    $0x8,%esp
+    34e6:	68 00 02 00 00       	push   $0x200
+    34eb:	68 b6 80 00 00       	push   $0x80b6
+    34f0:	e8 be 30 00 00       	call   65b3 <open>
+    34f5:	83 c4 10             	add    $0x10,%esp
+    34f8:	85 c0                	test   %eax,%eax
+    34fa:	78 17                	js     3513 <subdir+0x441>
+    printf(1, "create dd succeeded!\n");
+    34fc:	83 ec 08             	sub    $0x8,%esp
+    34ff:	68 07 83 00 00       	push   $0x8307
+    3504:	6a 01                	push   $0x1
+    3506:	e8 b2 32 00 00       	call   67bd <printf>
+    350b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    350e:	e8 46 3d 00 00       	call   7259 <exit>
+  }
+  if(open("dd", O_RDWR) >= 0){
+    3513:	83 ec 08             	sub    $0x8,%esp
+    3516:	6a 02                	push   $0x2
+    3518:	68 b6 80 00 00       	push   $0x80b6
+    351d:	e8 91 30 00 00       	call   65b3 <open>
+    3522:	83 c4 10             	add    $0x10,%esp
+    3525:	85 c0                	test   %eax,%eax
+    3527:	78 17                	js     3540 <subdir+0x46e>
+    printf(1, "open dd rdwr succeeded!\n");
+    3529:	83 ec 08             	sub    $0x8,%esp
+    352c:	68 1d 83 00 00       	push   $0x831d
+    3531:	6a 01                	push   $0x1
+    3533:	e8 85 32 00 00       	call   67bd <printf>
+    3538:	83 c4 10             	add    $0x10,%esp
+    exit();
+    353b:	e8 19 3d 00 00       	call   7259 <exit>
+  }
+  if(open("dd", O_WRONLY) >= 0){
+    3540:	83 ec 08             	sub    $0x8,%esp
+    3543:	6a 01                	push   $0x1
+    3545:	68 b6 80 00 00       	push   $0x80b6
+    354a:	e8 64 30 00 00       	call   65b3 <open>
+    354f:	83 c4 10             	add    $0x10,%esp
+    3552:	85 c0                	test   %eax,%eax
+    3554:	78 17                	js     356d <subdir+0x49b>
+    printf(1, "open dd wronly succeeded!\n");
+    3556:	83 ec 08             	sub    $0x8,%esp
+    3559:	68 36 83 00 00       	push   $0x8336
+    355e:	6a 01                	push   $0x1
+    3560:	e8 58 32 00 00       	call   67bd <printf>
+    3565:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3568:	e8 ec 3c 00 00       	call   7259 <exit>
+  }
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    356d:	83 ec 08             	sub    $0x8,%esp
+    3570:	68 51 83 00 00       	push   $0x8351
+    3575:	68 bd 82 00 00       	push   $0x82bd
+    357a:	e8 70 30 00 00       	call   65ef <link>
+    357f:	83 c4 10             	add    $0x10,%esp
+    3582:	85 c0                	test   %eax,%eax
+    3584:	75 17                	jne    359d <subdir+0x4cb>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    3586:	83 ec 08             	sub    $0x8,%esp
+    3589:	68 5c 83 00 00       	push   $0x835c
+    358e:	6a 01                	push   $0x1
+    3590:	e8 28 32 00 00       	call   67bd <printf>
+    3595:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3598:	e8 bc 3c 00 00       	call   7259 <exit>
+  }
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    359d:	83 ec 08             	sub    $0x8,%esp
+    35a0:	68 51 83 00 00       	push   $0x8351
+    35a5:	68 e2 82 00 00       	push   $0x82e2
+    35aa:	e8 40 30 00 00       	call   65ef <link>
+    35af:	83 c4 10             	add    $0x10,%esp
+    35b2:	85 c0                	test   %eax,%eax
+    35b4:	75 17                	jne    35cd <subdir+0x4fb>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    35b6:	83 ec 08             	sub    $0x8,%esp
+    35b9:	68 80 83 00 00       	push   $0x8380
+    35be:	6a 01                	push   $0x1
+    35c0:	e8 f8 31 00 00       	call   67bd <printf>
+    35c5:	83 c4 10             	add    $0x10,%esp
+    exit();
+    35c8:	e8 8c 3c 00 00       	call   7259 <exit>
+  }
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    35cd:	83 ec 08             	sub    $0x8,%esp
+    35d0:	68 98 81 00 00       	push   $0x8198
+    35d5:	68 d1 80 00 00       	push   $0x80d1
+    35da:	e8 10 30 00 00       	call   65ef <link>
+    35df:	83 c4 10             	add    $0x10,%esp
+    35e2:	85 c0                	test   %eax,%eax
+    35e4:	75 17                	jne    35fd <subdir+0x52b>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    35e6:	83 ec 08             	sub    $0x8,%esp
+    35e9:	68 a4 83 00 00       	push   $0x83a4
+    35ee:	6a 01                	push   $0x1
+    35f0:	e8 c8 31 00 00       	call   67bd <printf>
+    35f5:	83 c4 10             	add    $0x10,%esp
+    exit();
+    35f8:	e8 5c 3c 00 00       	call   7259 <exit>
+  }
+  if(mkdir("dd/ff/ff") == 0){
+    35fd:	83 ec 0c             	sub    $0xc,%esp
+    3600:	68 bd 82 00 00       	push   $0x82bd
+    3605:	e8 f4 2f 00 00       	call   65fe <mkdir>
+    360a:	83 c4 10             	add    $0x10,%esp
+    360d:	85 c0                	test   %eax,%eax
+    360f:	75 17                	jne    3628 <subdir+0x556>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    3611:	83 ec 08             	sub    $0x8,%esp
+    3614:	68 c6 83 00 00       	push   $0x83c6
+    3619:	6a 01                	push   $0x1
+    361b:	e8 9d 31 00 00       	call   67bd <printf>
+    3620:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3623:	e8 31 3c 00 00       	call   7259 <exit>
+  }
+  if(mkdir("dd/xx/ff") == 0){
+    3628:	83 ec 0c             	sub    $0xc,%esp
+    362b:	68 e2 82 00 00       	push   $0x82e2
+    3630:	e8 c9 2f 00 00       	call   65fe <mkdir>
+    3635:	83 c4 10             	add    $0x10,%esp
+    3638:	85 c0                	test   %eax,%eax
+    363a:	75 17                	jne    3653 <subdir+0x581>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    363c:	83 ec 08             	sub    $0x8,%esp
+    363f:	68 e1 83 00 00       	push   $0x83e1
+    3644:	6a 01                	push   $0x1
+    3646:	e8 72 31 00 00       	call   67bd <printf>
+    364b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    364e:	e8 06 3c 00 00       	call   7259 <exit>
+  }
+  if(mkdir("dd/dd/ffff") == 0){
+    3653:	83 ec 0c             	sub    $0xc,%esp
+    3656:	68 98 81 00 00       	push   $0x8198
+    365b:	e8 9e 2f 00 00       	call   65fe <mkdir>
+    3660:	83 c4 10             	add    $0x10,%esp
+    3663:	85 c0                	test   %eax,%eax
+    3665:	75 17                	jne    367e <subdir+0x5ac>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    3667:	83 ec 08             	sub    $0x8,%esp
+    366a:	68 fc 83 00 00       	push   $0x83fc
+    366f:	6a 01                	push   $0x1
+    3671:	e8 47 31 00 00       	call   67bd <printf>
+    3676:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3679:	e8 db 3b 00 00       	call   7259 <exit>
+  }
+  if(unlink("dd/xx/ff") == 0){
+    367e:	83 ec 0c             	sub    $0xc,%esp
+    3681:	68 e2 82 00 00       	push   $0x82e2
+    3686:	e8 46 2f 00 00       	call   65d1 <unlink>
+    368b:	83 c4 10             	add    $0x10,%esp
+    368e:	85 c0                	test   %eax,%eax
+    3690:	75 17                	jne    36a9 <subdir+0x5d7>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    3692:	83 ec 08             	sub    $0x8,%esp
+    3695:	68 19 84 00 00       	push   $0x8419
+    369a:	6a 01                	push   $0x1
+    369c:	e8 1c 31 00 00       	call   67bd <printf>
+    36a1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    36a4:	e8 b0 3b 00 00       	call   7259 <exit>
+  }
+  if(unlink("dd/ff/ff") == 0){
+    36a9:	83 ec 0c             	sub    $0xc,%esp
+    36ac:	68 bd 82 00 00       	push   $0x82bd
+    36b1:	e8 1b 2f 00 00       	call   65d1 <unlink>
+    36b6:	83 c4 10             	add    $0x10,%esp
+    36b9:	85 c0                	test   %eax,%eax
+    36bb:	75 17                	jne    36d4 <subdir+0x602>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    36bd:	83 ec 08             	sub    $0x8,%esp
+    36c0:	68 35 84 00 00       	push   $0x8435
+    36c5:	6a 01                	push   $0x1
+    36c7:	e8 f1 30 00 00       	call   67bd <printf>
+    36cc:	83 c4 10             	add    $0x10,%esp
+    exit();
+    36cf:	e8 85 3b 00 00       	call   7259 <exit>
+  }
+  if(chdir("dd/ff") == 0){
+    36d4:	83 ec 0c             	sub    $0xc,%esp
+    36d7:	68 d1 80 00 00       	push   $0x80d1
+    36dc:	e8 2c 2f 00 00       	call   660d <chdir>
+    36e1:	83 c4 10             	add    $0x10,%esp
+    36e4:	85 c0                	test   %eax,%eax
+    36e6:	75 17                	jne    36ff <subdir+0x62d>
+    printf(1, "chdir dd/ff succeeded!\n");
+    36e8:	83 ec 08             	sub    $0x8,%esp
+    36eb:	68 51 84 00 00       	push   $0x8451
+    36f0:	6a 01                	push   $0x1
+    36f2:	e8 c6 30 00 00       	call   67bd <printf>
+    36f7:	83 c4 10             	add    $0x10,%esp
+    exit();
+    36fa:	e8 5a 3b 00 00       	call   7259 <exit>
+  }
+  if(chdir("dd/xx") == 0){
+    36ff:	83 ec 0c             	sub    $0xc,%esp
+    3702:	68 69 84 00 00       	push   $0x8469
+    3707:	e8 01 2f 00 00       	call   660d <chdir>
+    370c:	83 c4 10             	add    $0x10,%esp
+    370f:	85 c0                	test   %eax,%eax
+    3711:	75 17                	jne    372a <subdir+0x658>
+    printf(1, "chdir dd/xx succeeded!\n");
+    3713:	83 ec 08             	sub    $0x8,%esp
+    3716:	68 6f 84 00 00       	push   $0x846f
+    371b:	6a 01                	push   $0x1
+    371d:	e8 9b 30 00 00       	call   67bd <printf>
+    3722:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3725:	e8 2f 3b 00 00       	call   7259 <exit>
+  }
+
+  if(unlink("dd/dd/ffff") != 0){
+    372a:	83 ec 0c             	sub    $0xc,%esp
+    372d:	68 98 81 00 00       	push   $0x8198
+    3732:	e8 9a 2e 00 00       	call   65d1 <unlink>
+    3737:	83 c4 10             	add    $0x10,%esp
+    373a:	85 c0                	test   %eax,%eax
+    373c:	74 17                	je     3755 <subdir+0x683>
+    printf(1, "unlink dd/dd/ff failed\n");
+    373e:	83 ec 08             	sub    $0x8,%esp
+    3741:	68 c5 81 00 00       	push   $0x81c5
+    3746:	6a 01                	push   $0x1
+    3748:	e8 70 30 00 00       	call   67bd <printf>
+    374d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3750:	e8 04 3b 00 00       	call   7259 <exit>
+  }
+  if(unlink("dd/ff") != 0){
+    3755:	83 ec 0c             	sub    $0xc,%esp
+    3758:	68 d1 80 00 00       	push   $0x80d1
+    375d:	e8 6f 2e 00 00       	call   65d1 <unlink>
+    3762:	83 c4 10             	add    $0x10,%esp
+    3765:	85 c0                	test   %eax,%eax
+    3767:	74 17                	je     3780 <subdir+0x6ae>
+    printf(1, "unlink dd/ff failed\n");
+    3769:	83 ec 08             	sub    $0x8,%esp
+    376c:	68 87 84 00 00       	push   $0x8487
+    3771:	6a 01                	push   $0x1
+    3773:	e8 45 30 00 00       	call   67bd <printf>
+    3778:	83 c4 10             	add    $0x10,%esp
+    exit();
+    377b:	e8 d9 3a 00 00       	call   7259 <exit>
+  }
+  if(unlink("dd") == 0){
+    3780:	83 ec 0c             	sub    $0xc,%esp
+    3783:	68 b6 80 00 00       	push   $0x80b6
+    3788:	e8 44 2e 00 00       	call   65d1 <unlink>
+    378d:	83 c4 10             	add    $0x10,%esp
+    3790:	85 c0                	test   %eax,%eax
+    3792:	75 17                	jne    37ab <subdir+0x6d9>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    3794:	83 ec 08             	sub    $0x8,%esp
+    3797:	68 9c 84 00 00       	push   $0x849c
+    379c:	6a 01                	push   $0x1
+    379e:	e8 1a 30 00 00       	call   67bd <printf>
+    37a3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    37a6:	e8 ae 3a 00 00       	call   7259 <exit>
+  }
+  if(unlink("dd/dd") < 0){
+    37ab:	83 ec 0c             	sub    $0xc,%esp
+    37ae:	68 bc 84 00 00       	push   $0x84bc
+    37b3:	e8 19 2e 00 00       	call   65d1 <unlink>
+    37b8:	83 c4 10             	add    $0x10,%esp
+    37bb:	85 c0                	test   %eax,%eax
+    37bd:	79 17                	jns    37d6 <subdir+0x704>
+    printf(1, "unlink dd/dd failed\n");
+    37bf:	83 ec 08             	sub    $0x8,%esp
+    37c2:	68 c2 84 00 00       	push   $0x84c2
+    37c7:	6a 01                	push   $0x1
+    37c9:	e8 ef 2f 00 00       	call   67bd <printf>
+    37ce:	83 c4 10             	add    $0x10,%esp
+    exit();
+    37d1:	e8 83 3a 00 00       	call   7259 <exit>
+  }
+  if(unlink("dd") < 0){
+    37d6:	83 ec 0c             	sub    $0xc,%esp
+    37d9:	68 b6 80 00 00       	push   $0x80b6
+    37de:	e8 ee 2d 00 00       	call   65d1 <unlink>
+    37e3:	83 c4 10             	add    $0x10,%esp
+    37e6:	85 c0                	test   %eax,%eax
+    37e8:	79 17                	jns    3801 <subdir+0x72f>
+    printf(1, "unlink dd failed\n");
+    37ea:	83 ec 08             	sub    $0x8,%esp
+    37ed:	68 d7 84 00 00       	push   $0x84d7
+    37f2:	6a 01                	push   $0x1
+    37f4:	e8 c4 2f 00 00       	call   67bd <printf>
+    37f9:	83 c4 10             	add    $0x10,%esp
+    exit();
+    37fc:	e8 58 3a 00 00       	call   7259 <exit>
+  }
+
+  printf(1, "subdir ok\n");
+    3801:	83 ec 08             	sub    $0x8,%esp
+    3804:	68 e9 84 00 00       	push   $0x84e9
+    3809:	6a 01                	push   $0x1
+    380b:	e8 ad 2f 00 00       	call   67bd <printf>
+    3810:	83 c4 10             	add    $0x10,%esp
+}
+    3813:	90                   	nop
+    3814:	c9                   	leave
+    3815:	c3                   	ret
+
+00003816 <sparsetest>:
+
+// writes far apart leave holes that read as zeros.
+void
+sparsetest(void)
+{
+    3816:	55                   	push   %ebp
+    3817:	89 e5                	mov    %esp,%ebp
+    3819:	83 ec 28             	sub    $0x28,%esp
+  struct stat st;
+  int fd, i;
+  uint off;
+
+  printf(1, "sparse test\n");
+    381c:	83 ec 08             	sub    $0x8,%esp
+    381f:	68 f4 84 00 00       	push   $0x84f4
+    3824:	6a 01                	push   $0x1
+    3826:	e8 92 2f 00 00       	call   67bd <printf>
+    382b:	83 c4 10             	add    $0x10,%esp
+
+  unlink("sparse");
+    382e:	83 ec 0c             	sub    $0xc,%esp
+    3831:	68 01 85 00 00       	push   $0x8501
+    3836:	e8 96 2d 00 00       	call   65d1 <unlink>
+    383b:	83 c4 10             	add    $0x10,%esp
+  fd = open("sparse", O_CREATE|O_RDWR);
+    383e:	83 ec 08             	sub    $0x8,%esp
+    3841:	68 02 02 00 00       	push   $0x202
+    3846:	68 01 85 00 00       	push   $0x8501
+    384b:	e8 63 2d 00 00       	call   65b3 <open>
+    3850:	83 c4 10             	add    $0x10,%esp
+    3853:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd < 0){
+    3856:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    385a:	79 17                	jns    3873 <sparsetest+0x5d>
+    printf(1, "create sparse failed\n");
+    385c:	83 ec 08             	sub    $0x8,%esp
+    385f:	68 08 85 00 00       	push   $0x8508
+    3864:	6a 01                	push   $0x1
+    3866:	e8 52 2f 00 00       	call   67bd <printf>
+    386b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    386e:	e8 e6 39 00 00       	call   7259 <exit>
+  }
+  // Past the direct blocks, then into the double indirect range.
+  off = (NDIRECT + NINDIRECT + 5) * BSIZE;
+    3873:	c7 45 ec 00 1c 01 00 	movl   $0x11c00,-0x14(%ebp)
+  if(lseek(fd, 2*BSIZE, SEEK_SET) != 2*BSIZE || write(fd, "x", 1) != 1 ||
+    387a:	83 ec 04             	sub    $0x4,%esp
+    387d:	6a 00                	push   $0x0
+    387f:	68 00 04 00 00       	push   $0x400
+    3884:	ff 75 f0             	push   -0x10(%ebp)
+    3887:	e8 53 2e 00 00       	call   66df <lseek>
+    388c:	83 c4 10             	add    $0x10,%esp
+    388f:	3d 00 04 00 00       	cmp    $0x400,%eax
+    3894:	75 4d                	jne    38e3 <sparsetest+0xcd>
+    3896:	83 ec 04             	sub    $0x4,%esp
+    3899:	6a 01                	push   $0x1
+    389b:	68 9a 78 00 00       	push   $0x789a
+    38a0:	ff 75 f0             	push   -0x10(%ebp)
+    38a3:	e8 cf 2c 00 00       	call   6577 <write>
+    38a8:	83 c4 10             	add    $0x10,%esp
+    38ab:	83 f8 01             	cmp    $0x1,%eax
+    38ae:	75 33                	jne    38e3 <sparsetest+0xcd>
+     lseek(fd, off, SEEK_SET) != off || write(fd, "y", 1) != 1){
+    38b0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    38b3:	83 ec 04             	sub    $0x4,%esp
+    38b6:	6a 00                	push   $0x0
+    38b8:	50                   	push   %eax
+    38b9:	ff 75 f0             	push   -0x10(%ebp)
+    38bc:	e8 1e 2e 00 00       	call   66df <lseek>
+    38c1:	83 c4 10             	add    $0x10,%esp
+  if(lseek(fd, 2*BSIZE, SEEK_SET) != 2*BSIZE || write(fd, "x", 1) != 1 ||
+    38c4:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    38c7:	75 1a                	jne    38e3 <sparsetest+0xcd>
+     lseek(fd, off, SEEK_SET) != off || write(fd, "y", 1) != 1){
+    38c9:	83 ec 04             	sub    $0x4,%esp
+    38cc:	6a 01                	push   $0x1
+    38ce:	68 1e 85 00 00       	push   $0x851e
+    38d3:	ff 75 f0             	push   -0x10(%ebp)
+    38d6:	e8 9c 2c 00 00       	call   6577 <write>
+    38db:	83 c4 10             	add    $0x10,%esp
+    38de:	83 f8 01             	cmp    $0x1,%eax
+    38e1:	74 17                	je     38fa <sparsetest+0xe4>
+    printf(1, "sparse write failed\n");
+    38e3:	83 ec 08             	sub    $0x8,%esp
+    38e6:	68 20 85 00 00       	push   $0x8520
+    38eb:	6a 01                	push   $0x1
+    38ed:	e8 cb 2e 00 00       	call   67bd <printf>
+    38f2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    38f5:	e8 5f 39 00 00       	call   7259 <exit>
+  }
+  if(fstat(fd, &st) < 0 || st.size != off + 1){
+    38fa:	83 ec 08             	sub    $0x8,%esp
+    38fd:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    3900:	50                   	push   %eax
+    3901:	ff 75 f0             	push   -0x10(%ebp)
+    3904:	e8 d7 2c 00 00       	call   65e0 <fstat>
+    3909:	83 c4 10             	add    $0x10,%esp
+    390c:	85 c0                	test   %eax,%eax
+    390e:	78 0d                	js     391d <sparsetest+0x107>
+    3910:	8b 55 e8             	mov    -0x18(%ebp),%edx
+    3913:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    3916:	83 c0 01             	add    $0x1,%eax
+    3919:	39 c2                	cmp    %eax,%edx
+    391b:	74 17                	je     3934 <sparsetest+0x11e>
+    printf(1, "sparse size wrong\n");
+    391d:	83 ec 08             	sub    $0x8,%esp
+    3920:	68 35 85 00 00       	push   $0x8535
+    3925:	6a 01                	push   $0x1
+    3927:	e8 91 2e 00 00       	call   67bd <printf>
+    392c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    392f:	e8 25 39 00 00       	call   7259 <exit>
+  }
+  if(lseek(fd, 0, SEEK_SET) != 0 || read(fd, buf, BSIZE) != BSIZE){
+    3934:	83 ec 04             	sub    $0x4,%esp
+    3937:	6a 00                	push   $0x0
+    3939:	6a 00                	push   $0x0
+    393b:	ff 75 f0             	push   -0x10(%ebp)
+    393e:	e8 9c 2d 00 00       	call   66df <lseek>
+    3943:	83 c4 10             	add    $0x10,%esp
+    3946:	85 c0                	test   %eax,%eax
+    3948:	75 1f                	jne    3969 <sparsetest+0x153>
+    394a:	83 ec 04             	sub    $0x4,%esp
+    394d:	68 00 02 00 00       	push   $0x200
+    3952:	68 80 9e 00 00       	push   $0x9e80
+    3957:	ff 75 f0             	push   -0x10(%ebp)
+    395a:	e8 09 2c 00 00       	call   6568 <read>
+    395f:	83 c4 10             	add    $0x10,%esp
+    3962:	3d 00 02 00 00       	cmp    $0x200,%eax
+    3967:	74 17                	je     3980 <sparsetest+0x16a>
+    printf(1, "sparse read failed\n");
+    3969:	83 ec 08             	sub    $0x8,%esp
+    396c:	68 48 85 00 00       	push   $0x8548
+    3971:	6a 01                	push   $0x1
+    3973:	e8 45 2e 00 00       	call   67bd <printf>
+    3978:	83 c4 10             	add    $0x10,%esp
+    exit();
+    397b:	e8 d9 38 00 00       	call   7259 <exit>
+  }
+  for(i = 0; i < BSIZE; i++){
+    3980:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3987:	eb 2a                	jmp    39b3 <sparsetest+0x19d>
+    if(buf[i] != 0){
+    3989:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    398c:	05 80 9e 00 00       	add    $0x9e80,%eax
+    3991:	0f b6 00             	movzbl (%eax),%eax
+    3994:	84 c0                	test   %al,%al
+    3996:	74 17                	je     39af <sparsetest+0x199>
+      printf(1, "hole not zero\n");
+    3998:	83 ec 08             	sub    $0x8,%esp
+    399b:	68 5c 85 00 00       	push   $0x855c
+    39a0:	6a 01                	push   $0x1
+    39a2:	e8 16 2e 00 00       	call   67bd <printf>
+    39a7:	83 c4 10             	add    $0x10,%esp
+      exit();
+    39aa:	e8 aa 38 00 00       	call   7259 <exit>
+  for(i = 0; i < BSIZE; i++){
+    39af:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    39b3:	81 7d f4 ff 01 00 00 	cmpl   $0x1ff,-0xc(%ebp)
+    39ba:	7e cd                	jle    3989 <sparsetest+0x173>
+    }
+  }
+  if(lseek(fd, -1, SEEK_END) != off || read(fd, buf, 2) != 1 || buf[0] != 'y' ||
+    39bc:	83 ec 04             	sub    $0x4,%esp
+    39bf:	6a 02                	push   $0x2
+    39c1:	6a ff                	push   $0xffffffff
+    39c3:	ff 75 f0             	push   -0x10(%ebp)
+    39c6:	e8 14 2d 00 00       	call   66df <lseek>
+    39cb:	83 c4 10             	add    $0x10,%esp
+    39ce:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    39d1:	75 66                	jne    3a39 <sparsetest+0x223>
+    39d3:	83 ec 04             	sub    $0x4,%esp
+    39d6:	6a 02                	push   $0x2
+    39d8:	68 80 9e 00 00       	push   $0x9e80
+    39dd:	ff 75 f0             	push   -0x10(%ebp)
+    39e0:	e8 83 2b 00 00       	call   6568 <read>
+    39e5:	83 c4 10             	add    $0x10,%esp
+    39e8:	83 f8 01             	cmp    $0x1,%eax
+    39eb:	75 4c                	jne    3a39 <sparsetest+0x223>
+    39ed:	0f b6 05 80 9e 00 00 	movzbl 0x9e80,%eax
+    39f4:	3c 79                	cmp    $0x79,%al
+    39f6:	75 41                	jne    3a39 <sparsetest+0x223>
+     lseek(fd, 2*BSIZE, SEEK_SET) != 2*BSIZE || read(fd, buf, 1) != 1 || buf[0] != 'x'){
+    39f8:	83 ec 04             	sub    $0x4,%esp
+    39fb:	6a 00                	push   $0x0
+    39fd:	68 00 04 00 00       	push   $0x400
+    3a02:	ff 75 f0             	push   -0x10(%ebp)
+    3a05:	e8 d5 2c 00 00       	call   66df <lseek>
+    3a0a:	83 c4 10             	add    $0x10,%esp
+  if(lseek(fd, -1, SEEK_END) != off || read(fd, buf, 2) != 1 || buf[0] != 'y' ||
+    3a0d:	3d 00 04 00 00       	cmp    $0x400,%eax
+    3a12:	75 25                	jne    3a39 <sparsetest+0x223>
+     lseek(fd, 2*BSIZE, SEEK_SET) != 2*BSIZE || read(fd, buf, 1) != 1 || buf[0] != 'x'){
+    3a14:	83 ec 04             	sub    $0x4,%esp
+    3a17:	6a 01                	push   $0x1
+    3a19:	68 80 9e 00 00       	push   $0x9e80
+    3a1e:	ff 75 f0             	push   -0x10(%ebp)
+    3a21:	e8 42 2b 00 00       	call   6568 <read>
+    3a26:	83 c4 10             	add    $0x10,%esp
+    3a29:	83 f8 01             	cmp    $0x1,%eax
+    3a2c:	75 0b                	jne    3a39 <sparsetest+0x223>
+    3a2e:	0f b6 05 80 9e 00 00 	movzbl 0x9e80,%eax
+    3a35:	3c 78                	cmp    $0x78,%al
+    3a37:	74 17                	je     3a50 <sparsetest+0x23a>
+    printf(1, "sparse data wrong\n");
+    3a39:	83 ec 08             	sub    $0x8,%esp
+    3a3c:	68 6b 85 00 00       	push   $0x856b
+    3a41:	6a 01                	push   $0x1
+    3a43:	e8 75 2d 00 00       	call   67bd <printf>
+    3a48:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3a4b:	e8 09 38 00 00       	call   7259 <exit>
+  }
+  if(read(fd, buf, 1) != 1 || buf[0] != 0){
+    3a50:	83 ec 04             	sub    $0x4,%esp
+    3a53:	6a 01                	push   $0x1
+    3a55:	68 80 9e 00 00       	push   $0x9e80
+    3a5a:	ff 75 f0             	push   -0x10(%ebp)
+    3a5d:	e8 06 2b 00 00       	call   6568 <read>
+    3a62:	83 c4 10             	add    $0x10,%esp
+    3a65:	83 f8 01             	cmp    $0x1,%eax
+    3a68:	75 0b                	jne    3a75 <sparsetest+0x25f>
+    3a6a:	0f b6 05 80 9e 00 00 	movzbl 0x9e80,%eax
+    3a71:	84 c0                	test   %al,%al
+    3a73:	74 17                	je     3a8c <sparsetest+0x276>
+    printf(1, "sparse tail of block not zero\n");
+    3a75:	83 ec 08             	sub    $0x8,%esp
+    3a78:	68 80 85 00 00       	push   $0x8580
+    3a7d:	6a 01                	push   $0x1
+    3a7f:	e8 39 2d 00 00       	call   67bd <printf>
+    3a84:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3a87:	e8 cd 37 00 00       	call   7259 <exit>
+  }
+  close(fd);
+    3a8c:	83 ec 0c             	sub    $0xc,%esp
+    3a8f:	ff 75 f0             	push   -0x10(%ebp)
+    3a92:	e8 da 37 00 00       	call   7271 <close>
+    3a97:	83 c4 10             	add    $0x10,%esp
+  unlink("sparse");
+    3a9a:	83 ec 0c             	sub    $0xc,%esp
+    3a9d:	68 01 85 00 00       	push   $0x8501
+    3aa2:	e8 2a 2b 00 00       	call   65d1 <unlink>
+    3aa7:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "sparse ok\n");
+    3aaa:	83 ec 08             	sub    $0x8,%esp
+    3aad:	68 9f 85 00 00       	push   $0x859f
+    3ab2:	6a 01                	push   $0x1
+    3ab4:	e8 04 2d 00 00       	call   67bd <printf>
+    3ab9:	83 c4 10             	add    $0x10,%esp
+}
+    3abc:	90                   	nop
+    3abd:	c9                   	leave
+    3abe:	c3                   	ret
+
+00003abf <inlinetest>:
+
+// a small file lives in its inode until it grows
+// past the inline area; its data must survive the move.
+void
+inlinetest(void)
+{
+    3abf:	55                   	push   %ebp
+    3ac0:	89 e5                	mov    %esp,%ebp
+    3ac2:	53                   	push   %ebx
+    3ac3:	83 ec 14             	sub    $0x14,%esp
+  int fd, i, n;
+
+  printf(1, "inline test\n");
+    3ac6:	83 ec 08             	sub    $0x8,%esp
+    3ac9:	68 aa 85 00 00       	push   $0x85aa
+    3ace:	6a 01                	push   $0x1
+    3ad0:	e8 e8 2c 00 00       	call   67bd <printf>
+    3ad5:	83 c4 10             	add    $0x10,%esp
+
+  unlink("inline");
+    3ad8:	83 ec 0c             	sub    $0xc,%esp
+    3adb:	68 b7 85 00 00       	push   $0x85b7
+    3ae0:	e8 ec 2a 00 00       	call   65d1 <unlink>
+    3ae5:	83 c4 10             	add    $0x10,%esp
+  fd = open("inline", O_CREATE|O_RDWR);
+    3ae8:	83 ec 08             	sub    $0x8,%esp
+    3aeb:	68 02 02 00 00       	push   $0x202
+    3af0:	68 b7 85 00 00       	push   $0x85b7
+    3af5:	e8 b9 2a 00 00       	call   65b3 <open>
+    3afa:	83 c4 10             	add    $0x10,%esp
+    3afd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd < 0){
+    3b00:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3b04:	79 17                	jns    3b1d <inlinetest+0x5e>
+    printf(1, "create inline failed\n");
+    3b06:	83 ec 08             	sub    $0x8,%esp
+    3b09:	68 be 85 00 00       	push   $0x85be
+    3b0e:	6a 01                	push   $0x1
+    3b10:	e8 a8 2c 00 00       	call   67bd <printf>
+    3b15:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3b18:	e8 3c 37 00 00       	call   7259 <exit>
+  }
+  for(i = 0; i < 100; i++){
+    3b1d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3b24:	eb 5c                	jmp    3b82 <inlinetest+0xc3>
+    buf[0] = 'a' + i%26;
+    3b26:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    3b29:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+    3b2e:	89 c8                	mov    %ecx,%eax
+    3b30:	f7 ea                	imul   %edx
+    3b32:	89 d0                	mov    %edx,%eax
+    3b34:	c1 f8 03             	sar    $0x3,%eax
+    3b37:	89 ca                	mov    %ecx,%edx
+    3b39:	c1 fa 1f             	sar    $0x1f,%edx
+    3b3c:	29 d0                	sub    %edx,%eax
+    3b3e:	6b d0 1a             	imul   $0x1a,%eax,%edx
+    3b41:	89 c8                	mov    %ecx,%eax
+    3b43:	29 d0                	sub    %edx,%eax
+    3b45:	83 c0 61             	add    $0x61,%eax
+    3b48:	a2 80 9e 00 00       	mov    %al,0x9e80
+    if(write(fd, buf, 1) != 1){
+    3b4d:	83 ec 04             	sub    $0x4,%esp
+    3b50:	6a 01                	push   $0x1
+    3b52:	68 80 9e 00 00       	push   $0x9e80
+    3b57:	ff 75 f0             	push   -0x10(%ebp)
+    3b5a:	e8 18 2a 00 00       	call   6577 <write>
+    3b5f:	83 c4 10             	add    $0x10,%esp
+    3b62:	83 f8 01             	cmp    $0x1,%eax
+    3b65:	74 17                	je     3b7e <inlinetest+0xbf>
+      printf(1, "write inline failed\n");
+    3b67:	83 ec 08             	sub    $0x8,%esp
+    3b6a:	68 d4 85 00 00       	push   $0x85d4
+    3b6f:	6a 01                	push   $0x1
+    3b71:	e8 47 2c 00 00       	call   67bd <printf>
+    3b76:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3b79:	e8 db 36 00 00       	call   7259 <exit>
+  for(i = 0; i < 100; i++){
+    3b7e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3b82:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+    3b86:	7e 9e                	jle    3b26 <inlinetest+0x67>
+    }
+  }
+  close(fd);
+    3b88:	83 ec 0c             	sub    $0xc,%esp
+    3b8b:	ff 75 f0             	push   -0x10(%ebp)
+    3b8e:	e8 de 36 00 00       	call   7271 <close>
+    3b93:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("inline", O_RDONLY);
+    3b96:	83 ec 08             	sub    $0x8,%esp
+    3b99:	6a 00                	push   $0x0
+    3b9b:	68 b7 85 00 00       	push   $0x85b7
+    3ba0:	e8 0e 2a 00 00       	call   65b3 <open>
+    3ba5:	83 c4 10             	add    $0x10,%esp
+    3ba8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  n = read(fd, buf, sizeof(buf));
+    3bab:	83 ec 04             	sub    $0x4,%esp
+    3bae:	68 00 20 00 00       	push   $0x2000
+    3bb3:	68 80 9e 00 00       	push   $0x9e80
+    3bb8:	ff 75 f0             	push   -0x10(%ebp)
+    3bbb:	e8 a8 29 00 00       	call   6568 <read>
+    3bc0:	83 c4 10             	add    $0x10,%esp
+    3bc3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  close(fd);
+    3bc6:	83 ec 0c             	sub    $0xc,%esp
+    3bc9:	ff 75 f0             	push   -0x10(%ebp)
+    3bcc:	e8 a0 36 00 00       	call   7271 <close>
+    3bd1:	83 c4 10             	add    $0x10,%esp
+  if(n != 100){
+    3bd4:	83 7d ec 64          	cmpl   $0x64,-0x14(%ebp)
+    3bd8:	74 1a                	je     3bf4 <inlinetest+0x135>
+    printf(1, "inline read %d bytes\n", n);
+    3bda:	83 ec 04             	sub    $0x4,%esp
+    3bdd:	ff 75 ec             	push   -0x14(%ebp)
+    3be0:	68 e9 85 00 00       	push   $0x85e9
+    3be5:	6a 01                	push   $0x1
+    3be7:	e8 d1 2b 00 00       	call   67bd <printf>
+    3bec:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3bef:	e8 65 36 00 00       	call   7259 <exit>
+  }
+  for(i = 0; i < 100; i++){
+    3bf4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3bfb:	eb 52                	jmp    3c4f <inlinetest+0x190>
+    if(buf[i] != 'a' + i%26){
+    3bfd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3c00:	05 80 9e 00 00       	add    $0x9e80,%eax
+    3c05:	0f b6 00             	movzbl (%eax),%eax
+    3c08:	0f be d8             	movsbl %al,%ebx
+    3c0b:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    3c0e:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+    3c13:	89 c8                	mov    %ecx,%eax
+    3c15:	f7 ea                	imul   %edx
+    3c17:	89 d0                	mov    %edx,%eax
+    3c19:	c1 f8 03             	sar    $0x3,%eax
+    3c1c:	89 ca                	mov    %ecx,%edx
+    3c1e:	c1 fa 1f             	sar    $0x1f,%edx
+    3c21:	29 d0                	sub    %edx,%eax
+    3c23:	6b d0 1a             	imul   $0x1a,%eax,%edx
+    3c26:	89 c8                	mov    %ecx,%eax
+    3c28:	29 d0                	sub    %edx,%eax
+    3c2a:	83 c0 61             	add    $0x61,%eax
+    3c2d:	39 c3                	cmp    %eax,%ebx
+    3c2f:	74 1a                	je     3c4b <inlinetest+0x18c>
+      printf(1, "inline wrong data at %d\n", i);
+    3c31:	83 ec 04             	sub    $0x4,%esp
+    3c34:	ff 75 f4             	push   -0xc(%ebp)
+    3c37:	68 ff 85 00 00       	push   $0x85ff
+    3c3c:	6a 01                	push   $0x1
+    3c3e:	e8 7a 2b 00 00       	call   67bd <printf>
+    3c43:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3c46:	e8 0e 36 00 00       	call   7259 <exit>
+  for(i = 0; i < 100; i++){
+    3c4b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3c4f:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+    3c53:	7e a8                	jle    3bfd <inlinetest+0x13e>
+    }
+  }
+  unlink("inline");
+    3c55:	83 ec 0c             	sub    $0xc,%esp
+    3c58:	68 b7 85 00 00       	push   $0x85b7
+    3c5d:	e8 6f 29 00 00       	call   65d1 <unlink>
+    3c62:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "inline ok\n");
+    3c65:	83 ec 08             	sub    $0x8,%esp
+    3c68:	68 18 86 00 00       	push   $0x8618
+    3c6d:	6a 01                	push   $0x1
+    3c6f:	e8 49 2b 00 00       	call   67bd <printf>
+    3c74:	83 c4 10             	add    $0x10,%esp
+}
+    3c77:	90                   	nop
+    3c78:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3c7b:	c9                   	leave
+    3c7c:	c3                   	ret
+
+00003c7d <dmesgtest>:
+
+// a user fault is reported by the kernel, and dmesg
+// can read the report back.
+void
+dmesgtest(void)
+{
+    3c7d:	55                   	push   %ebp
+    3c7e:	89 e5                	mov    %esp,%ebp
+    3c80:	83 ec 18             	sub    $0x18,%esp
+  int i, n, pid;
+
+  printf(1, "dmesg test\n");
+    3c83:	83 ec 08             	sub    $0x8,%esp
+    3c86:	68 23 86 00 00       	push   $0x8623
+    3c8b:	6a 01                	push   $0x1
+    3c8d:	e8 2b 2b 00 00       	call   67bd <printf>
+    3c92:	83 c4 10             	add    $0x10,%esp
+
+  pid = fork();
+    3c95:	e8 7f 35 00 00       	call   7219 <fork>
+    3c9a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid < 0){
+    3c9d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3ca1:	79 17                	jns    3cba <dmesgtest+0x3d>
+    printf(1, "fork failed\n");
+    3ca3:	83 ec 08             	sub    $0x8,%esp
+    3ca6:	68 75 73 00 00       	push   $0x7375
+    3cab:	6a 01                	push   $0x1
+    3cad:	e8 0b 2b 00 00       	call   67bd <printf>
+    3cb2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3cb5:	e8 9f 35 00 00       	call   7259 <exit>
+  }
+  if(pid == 0){
+    3cba:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3cbe:	75 0d                	jne    3ccd <dmesgtest+0x50>
+    *(char*)0x80000000 = 1;  // kernel memory: killed with a report
+    3cc0:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    3cc5:	c6 00 01             	movb   $0x1,(%eax)
+    exit();
+    3cc8:	e8 8c 35 00 00       	call   7259 <exit>
+  }
+  wait();
+    3ccd:	e8 78 28 00 00       	call   654a <wait>
+  sleep(2);
+    3cd2:	83 ec 0c             	sub    $0xc,%esp
+    3cd5:	6a 02                	push   $0x2
+    3cd7:	e8 6d 29 00 00       	call   6649 <sleep>
+    3cdc:	83 c4 10             	add    $0x10,%esp
+
+  n = dmesg(buf, sizeof(buf));
+    3cdf:	83 ec 08             	sub    $0x8,%esp
+    3ce2:	68 00 20 00 00       	push   $0x2000
+    3ce7:	68 80 9e 00 00       	push   $0x9e80
+    3cec:	e8 fd 29 00 00       	call   66ee <dmesg>
+    3cf1:	83 c4 10             	add    $0x10,%esp
+    3cf4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(n <= 0 || n > sizeof(buf)){
+    3cf7:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    3cfb:	7e 0a                	jle    3d07 <dmesgtest+0x8a>
+    3cfd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    3d00:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    3d05:	76 1a                	jbe    3d21 <dmesgtest+0xa4>
+    printf(1, "dmesg returned %d\n", n);
+    3d07:	83 ec 04             	sub    $0x4,%esp
+    3d0a:	ff 75 ec             	push   -0x14(%ebp)
+    3d0d:	68 2f 86 00 00       	push   $0x862f
+    3d12:	6a 01                	push   $0x1
+    3d14:	e8 a4 2a 00 00       	call   67bd <printf>
+    3d19:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3d1c:	e8 38 35 00 00       	call   7259 <exit>
+  }
+  for(i = 0; i + 4 <= n; i++)
+    3d21:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3d28:	eb 46                	jmp    3d70 <dmesgtest+0xf3>
+    if(buf[i] == 't' && buf[i+1] == 'r' && buf[i+2] == 'a' && buf[i+3] == 'p')
+    3d2a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3d2d:	05 80 9e 00 00       	add    $0x9e80,%eax
+    3d32:	0f b6 00             	movzbl (%eax),%eax
+    3d35:	3c 74                	cmp    $0x74,%al
+    3d37:	75 33                	jne    3d6c <dmesgtest+0xef>
+    3d39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3d3c:	83 c0 01             	add    $0x1,%eax
+    3d3f:	0f b6 80 80 9e 00 00 	movzbl 0x9e80(%eax),%eax
+    3d46:	3c 72                	cmp    $0x72,%al
+    3d48:	75 22                	jne    3d6c <dmesgtest+0xef>
+    3d4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3d4d:	83 c0 02             	add    $0x2,%eax
+    3d50:	0f b6 80 80 9e 00 00 	movzbl 0x9e80(%eax),%eax
+    3d57:	3c 61                	cmp    $0x61,%al
+    3d59:	75 11                	jne    3d6c <dmesgtest+0xef>
+    3d5b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3d5e:	83 c0 03             	add    $0x3,%eax
+    3d61:	0f b6 80 80 9e 00 00 	movzbl 0x9e80(%eax),%eax
+    3d68:	3c 70                	cmp    $0x70,%al
+    3d6a:	74 11                	je     3d7d <dmesgtest+0x100>
+  for(i = 0; i + 4 <= n; i++)
+    3d6c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3d70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3d73:	83 c0 03             	add    $0x3,%eax
+    3d76:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    3d79:	7f af                	jg     3d2a <dmesgtest+0xad>
+    3d7b:	eb 01                	jmp    3d7e <dmesgtest+0x101>
+      break;
+    3d7d:	90                   	nop
+  if(i + 4 > n){
+    3d7e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3d81:	83 c0 03             	add    $0x3,%eax
+    3d84:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    3d87:	7f 17                	jg     3da0 <dmesgtest+0x123>
+    printf(1, "dmesg has no trap report\n");
+    3d89:	83 ec 08             	sub    $0x8,%esp
+    3d8c:	68 42 86 00 00       	push   $0x8642
+    3d91:	6a 01                	push   $0x1
+    3d93:	e8 25 2a 00 00       	call   67bd <printf>
+    3d98:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3d9b:	e8 b9 34 00 00       	call   7259 <exit>
+  }
+  if(dmesg(buf, 4) > 4){
+    3da0:	83 ec 08             	sub    $0x8,%esp
+    3da3:	6a 04                	push   $0x4
+    3da5:	68 80 9e 00 00       	push   $0x9e80
+    3daa:	e8 3f 29 00 00       	call   66ee <dmesg>
+    3daf:	83 c4 10             	add    $0x10,%esp
+    3db2:	83 f8 04             	cmp    $0x4,%eax
+    3db5:	7e 17                	jle    3dce <dmesgtest+0x151>
+    printf(1, "dmesg overran its buffer\n");
+    3db7:	83 ec 08             	sub    $0x8,%esp
+    3dba:	68 5c 86 00 00       	push   $0x865c
+    3dbf:	6a 01                	push   $0x1
+    3dc1:	e8 f7 29 00 00       	call   67bd <printf>
+    3dc6:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3dc9:	e8 8b 34 00 00       	call   7259 <exit>
+  }
+
+  printf(1, "dmesg ok\n");
+    3dce:	83 ec 08             	sub    $0x8,%esp
+    3dd1:	68 76 86 00 00       	push   $0x8676
+    3dd6:	6a 01                	push   $0x1
+    3dd8:	e8 e0 29 00 00       	call   67bd <printf>
+    3ddd:	83 c4 10             	add    $0x10,%esp
+}
+    3de0:	90                   	nop
+    3de1:	c9                   	leave
+    3de2:	c3                   	ret
+
+00003de3 <stdiotest>:
+
+// buffered printf output to a file reaches it once,
+// in order, even across fork.
+void
+stdiotest(void)
+{
+    3de3:	55                   	push   %ebp
+    3de4:	89 e5                	mov    %esp,%ebp
+    3de6:	83 ec 38             	sub    $0x38,%esp
+  int fd, n, pid, fds[2];
+  struct stat st;
+
+  printf(1, "stdio test\n");
+    3de9:	83 ec 08             	sub    $0x8,%esp
+    3dec:	68 80 86 00 00       	push   $0x8680
+    3df1:	6a 01                	push   $0x1
+    3df3:	e8 c5 29 00 00       	call   67bd <printf>
+    3df8:	83 c4 10             	add    $0x10,%esp
+
+  unlink("stdio");
+    3dfb:	83 ec 0c             	sub    $0xc,%esp
+    3dfe:	68 8c 86 00 00       	push   $0x868c
+    3e03:	e8 c9 27 00 00       	call   65d1 <unlink>
+    3e08:	83 c4 10             	add    $0x10,%esp
+  fd = open("stdio", O_CREATE|O_RDWR);
+    3e0b:	83 ec 08             	sub    $0x8,%esp
+    3e0e:	68 02 02 00 00       	push   $0x202
+    3e13:	68 8c 86 00 00       	push   $0x868c
+    3e18:	e8 96 27 00 00       	call   65b3 <open>
+    3e1d:	83 c4 10             	add    $0x10,%esp
+    3e20:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    3e23:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3e27:	79 17                	jns    3e40 <stdiotest+0x5d>
+    printf(1, "create stdio failed\n");
+    3e29:	83 ec 08             	sub    $0x8,%esp
+    3e2c:	68 92 86 00 00       	push   $0x8692
+    3e31:	6a 01                	push   $0x1
+    3e33:	e8 85 29 00 00       	call   67bd <printf>
+    3e38:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3e3b:	e8 19 34 00 00       	call   7259 <exit>
+  }
+  printf(fd, "ab");
+    3e40:	83 ec 08             	sub    $0x8,%esp
+    3e43:	68 a7 86 00 00       	push   $0x86a7
+    3e48:	ff 75 f4             	push   -0xc(%ebp)
+    3e4b:	e8 6d 29 00 00       	call   67bd <printf>
+    3e50:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    3e53:	e8 c1 33 00 00       	call   7219 <fork>
+    3e58:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid < 0){
+    3e5b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3e5f:	79 17                	jns    3e78 <stdiotest+0x95>
+    printf(1, "fork failed\n");
+    3e61:	83 ec 08             	sub    $0x8,%esp
+    3e64:	68 75 73 00 00       	push   $0x7375
+    3e69:	6a 01                	push   $0x1
+    3e6b:	e8 4d 29 00 00       	call   67bd <printf>
+    3e70:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3e73:	e8 e1 33 00 00       	call   7259 <exit>
+  }
+  if(pid == 0){
+    3e78:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3e7c:	75 18                	jne    3e96 <stdiotest+0xb3>
+    printf(fd, "c");
+    3e7e:	83 ec 08             	sub    $0x8,%esp
+    3e81:	68 aa 86 00 00       	push   $0x86aa
+    3e86:	ff 75 f4             	push   -0xc(%ebp)
+    3e89:	e8 2f 29 00 00       	call   67bd <printf>
+    3e8e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3e91:	e8 c3 33 00 00       	call   7259 <exit>
+  }
+  wait();
+    3e96:	e8 af 26 00 00       	call   654a <wait>
+  printf(fd, "%d", 12);
+    3e9b:	83 ec 04             	sub    $0x4,%esp
+    3e9e:	6a 0c                	push   $0xc
+    3ea0:	68 ac 86 00 00       	push   $0x86ac
+    3ea5:	ff 75 f4             	push   -0xc(%ebp)
+    3ea8:	e8 10 29 00 00       	call   67bd <printf>
+    3ead:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    3eb0:	83 ec 0c             	sub    $0xc,%esp
+    3eb3:	ff 75 f4             	push   -0xc(%ebp)
+    3eb6:	e8 b6 33 00 00       	call   7271 <close>
+    3ebb:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("stdio", O_RDONLY);
+    3ebe:	83 ec 08             	sub    $0x8,%esp
+    3ec1:	6a 00                	push   $0x0
+    3ec3:	68 8c 86 00 00       	push   $0x868c
+    3ec8:	e8 e6 26 00 00       	call   65b3 <open>
+    3ecd:	83 c4 10             	add    $0x10,%esp
+    3ed0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  n = read(fd, buf, sizeof(buf));
+    3ed3:	83 ec 04             	sub    $0x4,%esp
+    3ed6:	68 00 20 00 00       	push   $0x2000
+    3edb:	68 80 9e 00 00       	push   $0x9e80
+    3ee0:	ff 75 f4             	push   -0xc(%ebp)
+    3ee3:	e8 80 26 00 00       	call   6568 <read>
+    3ee8:	83 c4 10             	add    $0x10,%esp
+    3eeb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  close(fd);
+    3eee:	83 ec 0c             	sub    $0xc,%esp
+    3ef1:	ff 75 f4             	push   -0xc(%ebp)
+    3ef4:	e8 78 33 00 00       	call   7271 <close>
+    3ef9:	83 c4 10             	add    $0x10,%esp
+  if(n != 5 || buf[0] != 'a' || buf[1] != 'b' || buf[2] != 'c' ||
+    3efc:	83 7d ec 05          	cmpl   $0x5,-0x14(%ebp)
+    3f00:	75 37                	jne    3f39 <stdiotest+0x156>
+    3f02:	0f b6 05 80 9e 00 00 	movzbl 0x9e80,%eax
+    3f09:	3c 61                	cmp    $0x61,%al
+    3f0b:	75 2c                	jne    3f39 <stdiotest+0x156>
+    3f0d:	0f b6 05 81 9e 00 00 	movzbl 0x9e81,%eax
+    3f14:	3c 62                	cmp    $0x62,%al
+    3f16:	75 21                	jne    3f39 <stdiotest+0x156>
+    3f18:	0f b6 05 82 9e 00 00 	movzbl 0x9e82,%eax
+    3f1f:	3c 63                	cmp    $0x63,%al
+    3f21:	75 16                	jne    3f39 <stdiotest+0x156>
+     buf[3] != '1' || buf[4] != '2'){
+    3f23:	0f b6 05 83 9e 00 00 	movzbl 0x9e83,%eax
+  if(n != 5 || buf[0] != 'a' || buf[1] != 'b' || buf[2] != 'c' ||
+    3f2a:	3c 31                	cmp    $0x31,%al
+    3f2c:	75 0b                	jne    3f39 <stdiotest+0x156>
+     buf[3] != '1' || buf[4] != '2'){
+    3f2e:	0f b6 05 84 9e 00 00 	movzbl 0x9e84,%eax
+    3f35:	3c 32                	cmp    $0x32,%al
+    3f37:	74 1a                	je     3f53 <stdiotest+0x170>
+    printf(1, "stdio wrong data, %d bytes\n", n);
+    3f39:	83 ec 04             	sub    $0x4,%esp
+    3f3c:	ff 75 ec             	push   -0x14(%ebp)
+    3f3f:	68 af 86 00 00       	push   $0x86af
+    3f44:	6a 01                	push   $0x1
+    3f46:	e8 72 28 00 00       	call   67bd <printf>
+    3f4b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3f4e:	e8 06 33 00 00       	call   7259 <exit>
+  }
+  unlink("stdio");
+    3f53:	83 ec 0c             	sub    $0xc,%esp
+    3f56:	68 8c 86 00 00       	push   $0x868c
+    3f5b:	e8 71 26 00 00       	call   65d1 <unlink>
+    3f60:	83 c4 10             	add    $0x10,%esp
+
+  // Output to a pipe is buffered too: nothing reaches the
+  // pipe until the buffer is flushed.
+  if(pipe(fds) != 0){
+    3f63:	83 ec 0c             	sub    $0xc,%esp
+    3f66:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    3f69:	50                   	push   %eax
+    3f6a:	e8 ea 25 00 00       	call   6559 <pipe>
+    3f6f:	83 c4 10             	add    $0x10,%esp
+    3f72:	85 c0                	test   %eax,%eax
+    3f74:	74 17                	je     3f8d <stdiotest+0x1aa>
+    printf(1, "pipe() failed\n");
+    3f76:	83 ec 08             	sub    $0x8,%esp
+    3f79:	68 46 77 00 00       	push   $0x7746
+    3f7e:	6a 01                	push   $0x1
+    3f80:	e8 38 28 00 00       	call   67bd <printf>
+    3f85:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3f88:	e8 cc 32 00 00       	call   7259 <exit>
+  }
+  printf(fds[1], "xyz");
+    3f8d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    3f90:	83 ec 08             	sub    $0x8,%esp
+    3f93:	68 cb 86 00 00       	push   $0x86cb
+    3f98:	50                   	push   %eax
+    3f99:	e8 1f 28 00 00       	call   67bd <printf>
+    3f9e:	83 c4 10             	add    $0x10,%esp
+  if(fstat(fds[0], &st) < 0 || st.type != T_PIPE || st.size != 0){
+    3fa1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    3fa4:	83 ec 08             	sub    $0x8,%esp
+    3fa7:	8d 55 d0             	lea    -0x30(%ebp),%edx
+    3faa:	52                   	push   %edx
+    3fab:	50                   	push   %eax
+    3fac:	e8 2f 26 00 00       	call   65e0 <fstat>
+    3fb1:	83 c4 10             	add    $0x10,%esp
+    3fb4:	85 c0                	test   %eax,%eax
+    3fb6:	78 11                	js     3fc9 <stdiotest+0x1e6>
+    3fb8:	0f b7 45 d0          	movzwl -0x30(%ebp),%eax
+    3fbc:	66 83 f8 04          	cmp    $0x4,%ax
+    3fc0:	75 07                	jne    3fc9 <stdiotest+0x1e6>
+    3fc2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    3fc5:	85 c0                	test   %eax,%eax
+    3fc7:	74 17                	je     3fe0 <stdiotest+0x1fd>
+    printf(1, "stdio pipe not buffered\n");
+    3fc9:	83 ec 08             	sub    $0x8,%esp
+    3fcc:	68 cf 86 00 00       	push   $0x86cf
+    3fd1:	6a 01                	push   $0x1
+    3fd3:	e8 e5 27 00 00       	call   67bd <printf>
+    3fd8:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3fdb:	e8 79 32 00 00       	call   7259 <exit>
+  }
+  fflush(fds[1]);
+    3fe0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    3fe3:	83 ec 0c             	sub    $0xc,%esp
+    3fe6:	50                   	push   %eax
+    3fe7:	e8 cb 2f 00 00       	call   6fb7 <fflush>
+    3fec:	83 c4 10             	add    $0x10,%esp
+  if(fstat(fds[0], &st) < 0 || st.size != 3 ||
+    3fef:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    3ff2:	83 ec 08             	sub    $0x8,%esp
+    3ff5:	8d 55 d0             	lea    -0x30(%ebp),%edx
+    3ff8:	52                   	push   %edx
+    3ff9:	50                   	push   %eax
+    3ffa:	e8 e1 25 00 00       	call   65e0 <fstat>
+    3fff:	83 c4 10             	add    $0x10,%esp
+    4002:	85 c0                	test   %eax,%eax
+    4004:	78 3c                	js     4042 <stdiotest+0x25f>
+    4006:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    4009:	83 f8 03             	cmp    $0x3,%eax
+    400c:	75 34                	jne    4042 <stdiotest+0x25f>
+     read(fds[0], buf, sizeof(buf)) != 3 || buf[0] != 'x' || buf[2] != 'z'){
+    400e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    4011:	83 ec 04             	sub    $0x4,%esp
+    4014:	68 00 20 00 00       	push   $0x2000
+    4019:	68 80 9e 00 00       	push   $0x9e80
+    401e:	50                   	push   %eax
+    401f:	e8 44 25 00 00       	call   6568 <read>
+    4024:	83 c4 10             	add    $0x10,%esp
+  if(fstat(fds[0], &st) < 0 || st.size != 3 ||
+    4027:	83 f8 03             	cmp    $0x3,%eax
+    402a:	75 16                	jne    4042 <stdiotest+0x25f>
+     read(fds[0], buf, sizeof(buf)) != 3 || buf[0] != 'x' || buf[2] != 'z'){
+    402c:	0f b6 05 80 9e 00 00 	movzbl 0x9e80,%eax
+    4033:	3c 78                	cmp    $0x78,%al
+    4035:	75 0b                	jne    4042 <stdiotest+0x25f>
+    4037:	0f b6 05 82 9e 00 00 	movzbl 0x9e82,%eax
+    403e:	3c 7a                	cmp    $0x7a,%al
+    4040:	74 17                	je     4059 <stdiotest+0x276>
+    printf(1, "stdio pipe wrong data\n");
+    4042:	83 ec 08             	sub    $0x8,%esp
+    4045:	68 e8 86 00 00       	push   $0x86e8
+    404a:	6a 01                	push   $0x1
+    404c:	e8 6c 27 00 00       	call   67bd <printf>
+    4051:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4054:	e8 00 32 00 00       	call   7259 <exit>
+  }
+  close(fds[0]);
+    4059:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    405c:	83 ec 0c             	sub    $0xc,%esp
+    405f:	50                   	push   %eax
+    4060:	e8 0c 32 00 00       	call   7271 <close>
+    4065:	83 c4 10             	add    $0x10,%esp
+  close(fds[1]);
+    4068:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    406b:	83 ec 0c             	sub    $0xc,%esp
+    406e:	50                   	push   %eax
+    406f:	e8 fd 31 00 00       	call   7271 <close>
+    4074:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "stdio ok\n");
+    4077:	83 ec 08             	sub    $0x8,%esp
+    407a:	68 ff 86 00 00       	push   $0x86ff
+    407f:	6a 01                	push   $0x1
+    4081:	e8 37 27 00 00       	call   67bd <printf>
+    4086:	83 c4 10             	add    $0x10,%esp
+}
+    4089:	90                   	nop
+    408a:	c9                   	leave
+    408b:	c3                   	ret
+
+0000408c <fsynctest>:
+
+// fsync and fdatasync return once earlier writes are durable;
+// they reject bad fds.
+void
+fsynctest(void)
+{
+    408c:	55                   	push   %ebp
+    408d:	89 e5                	mov    %esp,%ebp
+    408f:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  printf(1, "fsync test\n");
+    4092:	83 ec 08             	sub    $0x8,%esp
+    4095:	68 09 87 00 00       	push   $0x8709
+    409a:	6a 01                	push   $0x1
+    409c:	e8 1c 27 00 00       	call   67bd <printf>
+    40a1:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("fsync", O_CREATE|O_RDWR);
+    40a4:	83 ec 08             	sub    $0x8,%esp
+    40a7:	68 02 02 00 00       	push   $0x202
+    40ac:	68 15 87 00 00       	push   $0x8715
+    40b1:	e8 fd 24 00 00       	call   65b3 <open>
+    40b6:	83 c4 10             	add    $0x10,%esp
+    40b9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    40bc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    40c0:	79 17                	jns    40d9 <fsynctest+0x4d>
+    printf(1, "create fsync failed\n");
+    40c2:	83 ec 08             	sub    $0x8,%esp
+    40c5:	68 1b 87 00 00       	push   $0x871b
+    40ca:	6a 01                	push   $0x1
+    40cc:	e8 ec 26 00 00       	call   67bd <printf>
+    40d1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    40d4:	e8 80 31 00 00       	call   7259 <exit>
+  }
+  if(write(fd, "aaaaaaaaaa", 10) != 10 || fsync(fd) != 0){
+    40d9:	83 ec 04             	sub    $0x4,%esp
+    40dc:	6a 0a                	push   $0xa
+    40de:	68 be 74 00 00       	push   $0x74be
+    40e3:	ff 75 f4             	push   -0xc(%ebp)
+    40e6:	e8 8c 24 00 00       	call   6577 <write>
+    40eb:	83 c4 10             	add    $0x10,%esp
+    40ee:	83 f8 0a             	cmp    $0xa,%eax
+    40f1:	75 12                	jne    4105 <fsynctest+0x79>
+    40f3:	83 ec 0c             	sub    $0xc,%esp
+    40f6:	ff 75 f4             	push   -0xc(%ebp)
+    40f9:	e8 c3 25 00 00       	call   66c1 <fsync>
+    40fe:	83 c4 10             	add    $0x10,%esp
+    4101:	85 c0                	test   %eax,%eax
+    4103:	74 17                	je     411c <fsynctest+0x90>
+    printf(1, "fsync failed\n");
+    4105:	83 ec 08             	sub    $0x8,%esp
+    4108:	68 30 87 00 00       	push   $0x8730
+    410d:	6a 01                	push   $0x1
+    410f:	e8 a9 26 00 00       	call   67bd <printf>
+    4114:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4117:	e8 3d 31 00 00       	call   7259 <exit>
+  }
+  // Nothing new to commit: must not wait.
+  if(fsync(fd) != 0){
+    411c:	83 ec 0c             	sub    $0xc,%esp
+    411f:	ff 75 f4             	push   -0xc(%ebp)
+    4122:	e8 9a 25 00 00       	call   66c1 <fsync>
+    4127:	83 c4 10             	add    $0x10,%esp
+    412a:	85 c0                	test   %eax,%eax
+    412c:	74 17                	je     4145 <fsynctest+0xb9>
+    printf(1, "second fsync failed\n");
+    412e:	83 ec 08             	sub    $0x8,%esp
+    4131:	68 3e 87 00 00       	push   $0x873e
+    4136:	6a 01                	push   $0x1
+    4138:	e8 80 26 00 00       	call   67bd <printf>
+    413d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4140:	e8 14 31 00 00       	call   7259 <exit>
+  }
+  close(fd);
+    4145:	83 ec 0c             	sub    $0xc,%esp
+    4148:	ff 75 f4             	push   -0xc(%ebp)
+    414b:	e8 21 31 00 00       	call   7271 <close>
+    4150:	83 c4 10             	add    $0x10,%esp
+
+  // Overwrite in place: only data to write back.
+  fd = open("fsync", O_RDWR);
+    4153:	83 ec 08             	sub    $0x8,%esp
+    4156:	6a 02                	push   $0x2
+    4158:	68 15 87 00 00       	push   $0x8715
+    415d:	e8 51 24 00 00       	call   65b3 <open>
+    4162:	83 c4 10             	add    $0x10,%esp
+    4165:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0 || write(fd, "bbbbb", 5) != 5 || fdatasync(fd) != 0){
+    4168:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    416c:	78 2c                	js     419a <fsynctest+0x10e>
+    416e:	83 ec 04             	sub    $0x4,%esp
+    4171:	6a 05                	push   $0x5
+    4173:	68 53 87 00 00       	push   $0x8753
+    4178:	ff 75 f4             	push   -0xc(%ebp)
+    417b:	e8 f7 23 00 00       	call   6577 <write>
+    4180:	83 c4 10             	add    $0x10,%esp
+    4183:	83 f8 05             	cmp    $0x5,%eax
+    4186:	75 12                	jne    419a <fsynctest+0x10e>
+    4188:	83 ec 0c             	sub    $0xc,%esp
+    418b:	ff 75 f4             	push   -0xc(%ebp)
+    418e:	e8 3d 25 00 00       	call   66d0 <fdatasync>
+    4193:	83 c4 10             	add    $0x10,%esp
+    4196:	85 c0                	test   %eax,%eax
+    4198:	74 17                	je     41b1 <fsynctest+0x125>
+    printf(1, "fdatasync failed\n");
+    419a:	83 ec 08             	sub    $0x8,%esp
+    419d:	68 59 87 00 00       	push   $0x8759
+    41a2:	6a 01                	push   $0x1
+    41a4:	e8 14 26 00 00       	call   67bd <printf>
+    41a9:	83 c4 10             	add    $0x10,%esp
+    exit();
+    41ac:	e8 a8 30 00 00       	call   7259 <exit>
+  }
+  close(fd);
+    41b1:	83 ec 0c             	sub    $0xc,%esp
+    41b4:	ff 75 f4             	push   -0xc(%ebp)
+    41b7:	e8 b5 30 00 00       	call   7271 <close>
+    41bc:	83 c4 10             	add    $0x10,%esp
+  fd = open("fsync", O_RDONLY);
+    41bf:	83 ec 08             	sub    $0x8,%esp
+    41c2:	6a 00                	push   $0x0
+    41c4:	68 15 87 00 00       	push   $0x8715
+    41c9:	e8 e5 23 00 00       	call   65b3 <open>
+    41ce:	83 c4 10             	add    $0x10,%esp
+    41d1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(read(fd, buf, sizeof(buf)) != 10 || buf[4] != 'b' || buf[5] != 'a'){
+    41d4:	83 ec 04             	sub    $0x4,%esp
+    41d7:	68 00 20 00 00       	push   $0x2000
+    41dc:	68 80 9e 00 00       	push   $0x9e80
+    41e1:	ff 75 f4             	push   -0xc(%ebp)
+    41e4:	e8 7f 23 00 00       	call   6568 <read>
+    41e9:	83 c4 10             	add    $0x10,%esp
+    41ec:	83 f8 0a             	cmp    $0xa,%eax
+    41ef:	75 16                	jne    4207 <fsynctest+0x17b>
+    41f1:	0f b6 05 84 9e 00 00 	movzbl 0x9e84,%eax
+    41f8:	3c 62                	cmp    $0x62,%al
+    41fa:	75 0b                	jne    4207 <fsynctest+0x17b>
+    41fc:	0f b6 05 85 9e 00 00 	movzbl 0x9e85,%eax
+    4203:	3c 61                	cmp    $0x61,%al
+    4205:	74 17                	je     421e <fsynctest+0x192>
+    printf(1, "fsync read back wrong\n");
+    4207:	83 ec 08             	sub    $0x8,%esp
+    420a:	68 6b 87 00 00       	push   $0x876b
+    420f:	6a 01                	push   $0x1
+    4211:	e8 a7 25 00 00       	call   67bd <printf>
+    4216:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4219:	e8 3b 30 00 00       	call   7259 <exit>
+  }
+  close(fd);
+    421e:	83 ec 0c             	sub    $0xc,%esp
+    4221:	ff 75 f4             	push   -0xc(%ebp)
+    4224:	e8 48 30 00 00       	call   7271 <close>
+    4229:	83 c4 10             	add    $0x10,%esp
+  if(fsync(fd) != -1 || fsync(-1) != -1){
+    422c:	83 ec 0c             	sub    $0xc,%esp
+    422f:	ff 75 f4             	push   -0xc(%ebp)
+    4232:	e8 8a 24 00 00       	call   66c1 <fsync>
+    4237:	83 c4 10             	add    $0x10,%esp
+    423a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    423d:	75 12                	jne    4251 <fsynctest+0x1c5>
+    423f:	83 ec 0c             	sub    $0xc,%esp
+    4242:	6a ff                	push   $0xffffffff
+    4244:	e8 78 24 00 00       	call   66c1 <fsync>
+    4249:	83 c4 10             	add    $0x10,%esp
+    424c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    424f:	74 17                	je     4268 <fsynctest+0x1dc>
+    printf(1, "fsync of bad fd succeeded\n");
+    4251:	83 ec 08             	sub    $0x8,%esp
+    4254:	68 82 87 00 00       	push   $0x8782
+    4259:	6a 01                	push   $0x1
+    425b:	e8 5d 25 00 00       	call   67bd <printf>
+    4260:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4263:	e8 f1 2f 00 00       	call   7259 <exit>
+  }
+  unlink("fsync");
+    4268:	83 ec 0c             	sub    $0xc,%esp
+    426b:	68 15 87 00 00       	push   $0x8715
+    4270:	e8 5c 23 00 00       	call   65d1 <unlink>
+    4275:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "fsync ok\n");
+    4278:	83 ec 08             	sub    $0x8,%esp
+    427b:	68 9d 87 00 00       	push   $0x879d
+    4280:	6a 01                	push   $0x1
+    4282:	e8 36 25 00 00       	call   67bd <printf>
+    4287:	83 c4 10             	add    $0x10,%esp
+}
+    428a:	90                   	nop
+    428b:	c9                   	leave
+    428c:	c3                   	ret
+
+0000428d <ioringtest>:
+
+// open, write, close and read back through one submission ring.
+void
+ioringtest(void)
+{
+    428d:	55                   	push   %ebp
+    428e:	89 e5                	mov    %esp,%ebp
+    4290:	83 ec 18             	sub    $0x18,%esp
+  static struct ioring r;
+  struct iosqe *e;
+  int i, fd;
+
+  printf(1, "ioring test\n");
+    4293:	83 ec 08             	sub    $0x8,%esp
+    4296:	68 a7 87 00 00       	push   $0x87a7
+    429b:	6a 01                	push   $0x1
+    429d:	e8 1b 25 00 00       	call   67bd <printf>
+    42a2:	83 c4 10             	add    $0x10,%esp
+
+  unlink("ioring");
+    42a5:	83 ec 0c             	sub    $0xc,%esp
+    42a8:	68 b4 87 00 00       	push   $0x87b4
+    42ad:	e8 1f 23 00 00       	call   65d1 <unlink>
+    42b2:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 10; i++)
+    42b5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    42bc:	eb 16                	jmp    42d4 <ioringtest+0x47>
+    buf[i] = 'a' + i;
+    42be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    42c1:	83 c0 61             	add    $0x61,%eax
+    42c4:	89 c2                	mov    %eax,%edx
+    42c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    42c9:	05 80 9e 00 00       	add    $0x9e80,%eax
+    42ce:	88 10                	mov    %dl,(%eax)
+  for(i = 0; i < 10; i++)
+    42d0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    42d4:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    42d8:	7e e4                	jle    42be <ioringtest+0x31>
+
+  e = &r.sq[r.sqtail++ % IORING_SIZE];
+    42da:	a1 c4 f0 00 00       	mov    0xf0c4,%eax
+    42df:	8d 50 01             	lea    0x1(%eax),%edx
+    42e2:	89 15 c4 f0 00 00    	mov    %edx,0xf0c4
+    42e8:	83 e0 1f             	and    $0x1f,%eax
+    42eb:	89 c2                	mov    %eax,%edx
+    42ed:	89 d0                	mov    %edx,%eax
+    42ef:	c1 e0 02             	shl    $0x2,%eax
+    42f2:	01 d0                	add    %edx,%eax
+    42f4:	c1 e0 02             	shl    $0x2,%eax
+    42f7:	83 c0 10             	add    $0x10,%eax
+    42fa:	05 c0 f0 00 00       	add    $0xf0c0,%eax
+    42ff:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  e->op = IO_OPEN;
+    4302:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4305:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+  e->addr = (uint)"ioring";
+    430b:	ba b4 87 00 00       	mov    $0x87b4,%edx
+    4310:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4313:	89 50 08             	mov    %edx,0x8(%eax)
+  e->n = O_CREATE | O_RDWR;
+    4316:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4319:	c7 40 0c 02 02 00 00 	movl   $0x202,0xc(%eax)
+  if(iosubmit(&r) != 1 || r.cqtail != 1 || (fd = r.cq[0].res) < 0){
+    4320:	83 ec 0c             	sub    $0xc,%esp
+    4323:	68 c0 f0 00 00       	push   $0xf0c0
+    4328:	e8 67 23 00 00       	call   6694 <iosubmit>
+    432d:	83 c4 10             	add    $0x10,%esp
+    4330:	83 f8 01             	cmp    $0x1,%eax
+    4333:	75 18                	jne    434d <ioringtest+0xc0>
+    4335:	a1 cc f0 00 00       	mov    0xf0cc,%eax
+    433a:	83 f8 01             	cmp    $0x1,%eax
+    433d:	75 0e                	jne    434d <ioringtest+0xc0>
+    433f:	a1 50 f3 00 00       	mov    0xf350,%eax
+    4344:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    4347:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    434b:	79 17                	jns    4364 <ioringtest+0xd7>
+    printf(1, "ioring open failed\n");
+    434d:	83 ec 08             	sub    $0x8,%esp
+    4350:	68 bb 87 00 00       	push   $0x87bb
+    4355:	6a 01                	push   $0x1
+    4357:	e8 61 24 00 00       	call   67bd <printf>
+    435c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    435f:	e8 f5 2e 00 00       	call   7259 <exit>
+  }
+  r.cqhead = r.cqtail;
+    4364:	a1 cc f0 00 00       	mov    0xf0cc,%eax
+    4369:	a3 c8 f0 00 00       	mov    %eax,0xf0c8
+
+  for(i = 0; i < 10; i++){
+    436e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    4375:	eb 61                	jmp    43d8 <ioringtest+0x14b>
+    e = &r.sq[r.sqtail++ % IORING_SIZE];
+    4377:	a1 c4 f0 00 00       	mov    0xf0c4,%eax
+    437c:	8d 50 01             	lea    0x1(%eax),%edx
+    437f:	89 15 c4 f0 00 00    	mov    %edx,0xf0c4
+    4385:	83 e0 1f             	and    $0x1f,%eax
+    4388:	89 c2                	mov    %eax,%edx
+    438a:	89 d0                	mov    %edx,%eax
+    438c:	c1 e0 02             	shl    $0x2,%eax
+    438f:	01 d0                	add    %edx,%eax
+    4391:	c1 e0 02             	shl    $0x2,%eax
+    4394:	83 c0 10             	add    $0x10,%eax
+    4397:	05 c0 f0 00 00       	add    $0xf0c0,%eax
+    439c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    e->op = IO_WRITE;
+    439f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    43a2:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+    e->fd = fd;
+    43a8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    43ab:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    43ae:	89 50 04             	mov    %edx,0x4(%eax)
+    e->addr = (uint)(buf + i);
+    43b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    43b4:	05 80 9e 00 00       	add    $0x9e80,%eax
+    43b9:	89 c2                	mov    %eax,%edx
+    43bb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    43be:	89 50 08             	mov    %edx,0x8(%eax)
+    e->n = 1;
+    43c1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    43c4:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+    e->data = i;
+    43cb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    43ce:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    43d1:	89 50 10             	mov    %edx,0x10(%eax)
+  for(i = 0; i < 10; i++){
+    43d4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    43d8:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    43dc:	7e 99                	jle    4377 <ioringtest+0xea>
+  }
+  e = &r.sq[r.sqtail++ % IORING_SIZE];
+    43de:	a1 c4 f0 00 00       	mov    0xf0c4,%eax
+    43e3:	8d 50 01             	lea    0x1(%eax),%edx
+    43e6:	89 15 c4 f0 00 00    	mov    %edx,0xf0c4
+    43ec:	83 e0 1f             	and    $0x1f,%eax
+    43ef:	89 c2                	mov    %eax,%edx
+    43f1:	89 d0                	mov    %edx,%eax
+    43f3:	c1 e0 02             	shl    $0x2,%eax
+    43f6:	01 d0                	add    %edx,%eax
+    43f8:	c1 e0 02             	shl    $0x2,%eax
+    43fb:	83 c0 10             	add    $0x10,%eax
+    43fe:	05 c0 f0 00 00       	add    $0xf0c0,%eax
+    4403:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  e->op = IO_CLOSE;
+    4406:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4409:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+  e->fd = fd;
+    440f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4412:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    4415:	89 50 04             	mov    %edx,0x4(%eax)
+  e->data = 10;
+    4418:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    441b:	c7 40 10 0a 00 00 00 	movl   $0xa,0x10(%eax)
+  if(iosubmit(&r) != 11){
+    4422:	83 ec 0c             	sub    $0xc,%esp
+    4425:	68 c0 f0 00 00       	push   $0xf0c0
+    442a:	e8 65 22 00 00       	call   6694 <iosubmit>
+    442f:	83 c4 10             	add    $0x10,%esp
+    4432:	83 f8 0b             	cmp    $0xb,%eax
+    4435:	74 17                	je     444e <ioringtest+0x1c1>
+    printf(1, "ioring submit failed\n");
+    4437:	83 ec 08             	sub    $0x8,%esp
+    443a:	68 cf 87 00 00       	push   $0x87cf
+    443f:	6a 01                	push   $0x1
+    4441:	e8 77 23 00 00       	call   67bd <printf>
+    4446:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4449:	e8 0b 2e 00 00       	call   7259 <exit>
+  }
+  for(i = 0; i < 11; i++){
+    444e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    4455:	eb 63                	jmp    44ba <ioringtest+0x22d>
+    if(r.cq[(r.cqhead + i) % IORING_SIZE].data != i ||
+    4457:	8b 15 c8 f0 00 00    	mov    0xf0c8,%edx
+    445d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4460:	01 d0                	add    %edx,%eax
+    4462:	83 e0 1f             	and    $0x1f,%eax
+    4465:	83 c0 52             	add    $0x52,%eax
+    4468:	8b 14 c5 c4 f0 00 00 	mov    0xf0c4(,%eax,8),%edx
+    446f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4472:	39 c2                	cmp    %eax,%edx
+    4474:	75 26                	jne    449c <ioringtest+0x20f>
+       r.cq[(r.cqhead + i) % IORING_SIZE].res != (i < 10 ? 1 : 0)){
+    4476:	8b 15 c8 f0 00 00    	mov    0xf0c8,%edx
+    447c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    447f:	01 d0                	add    %edx,%eax
+    4481:	83 e0 1f             	and    $0x1f,%eax
+    4484:	83 c0 52             	add    $0x52,%eax
+    4487:	8b 14 c5 c0 f0 00 00 	mov    0xf0c0(,%eax,8),%edx
+    448e:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    4492:	0f 9e c0             	setle  %al
+    4495:	0f b6 c0             	movzbl %al,%eax
+    if(r.cq[(r.cqhead + i) % IORING_SIZE].data != i ||
+    4498:	39 c2                	cmp    %eax,%edx
+    449a:	74 1a                	je     44b6 <ioringtest+0x229>
+      printf(1, "ioring completion %d wrong\n", i);
+    449c:	83 ec 04             	sub    $0x4,%esp
+    449f:	ff 75 f4             	push   -0xc(%ebp)
+    44a2:	68 e5 87 00 00       	push   $0x87e5
+    44a7:	6a 01                	push   $0x1
+    44a9:	e8 0f 23 00 00       	call   67bd <printf>
+    44ae:	83 c4 10             	add    $0x10,%esp
+      exit();
+    44b1:	e8 a3 2d 00 00       	call   7259 <exit>
+  for(i = 0; i < 11; i++){
+    44b6:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    44ba:	83 7d f4 0a          	cmpl   $0xa,-0xc(%ebp)
+    44be:	7e 97                	jle    4457 <ioringtest+0x1ca>
+    }
+  }
+  r.cqhead = r.cqtail;
+    44c0:	a1 cc f0 00 00       	mov    0xf0cc,%eax
+    44c5:	a3 c8 f0 00 00       	mov    %eax,0xf0c8
+
+  fd = open("ioring", O_RDONLY);
+    44ca:	83 ec 08             	sub    $0x8,%esp
+    44cd:	6a 00                	push   $0x0
+    44cf:	68 b4 87 00 00       	push   $0x87b4
+    44d4:	e8 da 20 00 00       	call   65b3 <open>
+    44d9:	83 c4 10             	add    $0x10,%esp
+    44dc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0 || read(fd, buf + 100, 20) != 10){
+    44df:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    44e3:	78 1b                	js     4500 <ioringtest+0x273>
+    44e5:	b8 e4 9e 00 00       	mov    $0x9ee4,%eax
+    44ea:	83 ec 04             	sub    $0x4,%esp
+    44ed:	6a 14                	push   $0x14
+    44ef:	50                   	push   %eax
+    44f0:	ff 75 ec             	push   -0x14(%ebp)
+    44f3:	e8 70 20 00 00       	call   6568 <read>
+    44f8:	83 c4 10             	add    $0x10,%esp
+    44fb:	83 f8 0a             	cmp    $0xa,%eax
+    44fe:	74 17                	je     4517 <ioringtest+0x28a>
+    printf(1, "ioring read back failed\n");
+    4500:	83 ec 08             	sub    $0x8,%esp
+    4503:	68 01 88 00 00       	push   $0x8801
+    4508:	6a 01                	push   $0x1
+    450a:	e8 ae 22 00 00       	call   67bd <printf>
+    450f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4512:	e8 42 2d 00 00       	call   7259 <exit>
+  }
+  for(i = 0; i < 10; i++){
+    4517:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    451e:	eb 35                	jmp    4555 <ioringtest+0x2c8>
+    if(buf[100 + i] != 'a' + i){
+    4520:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4523:	83 c0 64             	add    $0x64,%eax
+    4526:	0f b6 80 80 9e 00 00 	movzbl 0x9e80(%eax),%eax
+    452d:	0f be d0             	movsbl %al,%edx
+    4530:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4533:	83 c0 61             	add    $0x61,%eax
+    4536:	39 c2                	cmp    %eax,%edx
+    4538:	74 17                	je     4551 <ioringtest+0x2c4>
+      printf(1, "ioring wrong data\n");
+    453a:	83 ec 08             	sub    $0x8,%esp
+    453d:	68 1a 88 00 00       	push   $0x881a
+    4542:	6a 01                	push   $0x1
+    4544:	e8 74 22 00 00       	call   67bd <printf>
+    4549:	83 c4 10             	add    $0x10,%esp
+      exit();
+    454c:	e8 08 2d 00 00       	call   7259 <exit>
+  for(i = 0; i < 10; i++){
+    4551:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    4555:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    4559:	7e c5                	jle    4520 <ioringtest+0x293>
+    }
+  }
+  close(fd);
+    455b:	83 ec 0c             	sub    $0xc,%esp
+    455e:	ff 75 ec             	push   -0x14(%ebp)
+    4561:	e8 0b 2d 00 00       	call   7271 <close>
+    4566:	83 c4 10             	add    $0x10,%esp
+  unlink("ioring");
+    4569:	83 ec 0c             	sub    $0xc,%esp
+    456c:	68 b4 87 00 00       	push   $0x87b4
+    4571:	e8 5b 20 00 00       	call   65d1 <unlink>
+    4576:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "ioring ok\n");
+    4579:	83 ec 08             	sub    $0x8,%esp
+    457c:	68 2d 88 00 00       	push   $0x882d
+    4581:	6a 01                	push   $0x1
+    4583:	e8 35 22 00 00       	call   67bd <printf>
+    4588:	83 c4 10             	add    $0x10,%esp
+}
+    458b:	90                   	nop
+    458c:	c9                   	leave
+    458d:	c3                   	ret
+
+0000458e <bigwrite>:
+
+// test writes that are larger than the log.
+void
+bigwrite(void)
+{
+    458e:	55                   	push   %ebp
+    458f:	89 e5                	mov    %esp,%ebp
+    4591:	83 ec 18             	sub    $0x18,%esp
+  int fd, sz;
+
+  printf(1, "bigwrite test\n");
+    4594:	83 ec 08             	sub    $0x8,%esp
+    4597:	68 38 88 00 00       	push   $0x8838
+    459c:	6a 01                	push   $0x1
+    459e:	e8 1a 22 00 00       	call   67bd <printf>
+    45a3:	83 c4 10             	add    $0x10,%esp
+
+  unlink("bigwrite");
+    45a6:	83 ec 0c             	sub    $0xc,%esp
+    45a9:	68 47 88 00 00       	push   $0x8847
+    45ae:	e8 1e 20 00 00       	call   65d1 <unlink>
+    45b3:	83 c4 10             	add    $0x10,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    45b6:	c7 45 f4 f3 01 00 00 	movl   $0x1f3,-0xc(%ebp)
+    45bd:	e9 a8 00 00 00       	jmp    466a <bigwrite+0xdc>
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    45c2:	83 ec 08             	sub    $0x8,%esp
+    45c5:	68 02 02 00 00       	push   $0x202
+    45ca:	68 47 88 00 00       	push   $0x8847
+    45cf:	e8 df 1f 00 00       	call   65b3 <open>
+    45d4:	83 c4 10             	add    $0x10,%esp
+    45d7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(fd < 0){
+    45da:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    45de:	79 17                	jns    45f7 <bigwrite+0x69>
+      printf(1, "cannot create bigwrite\n");
+    45e0:	83 ec 08             	sub    $0x8,%esp
+    45e3:	68 50 88 00 00       	push   $0x8850
+    45e8:	6a 01                	push   $0x1
+    45ea:	e8 ce 21 00 00       	call   67bd <printf>
+    45ef:	83 c4 10             	add    $0x10,%esp
+      exit();
+    45f2:	e8 62 2c 00 00       	call   7259 <exit>
+    }
+    int i;
+    for(i = 0; i < 2; i++){
+    45f7:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    45fe:	eb 3f                	jmp    463f <bigwrite+0xb1>
+      int cc = write(fd, buf, sz);
+    4600:	83 ec 04             	sub    $0x4,%esp
+    4603:	ff 75 f4             	push   -0xc(%ebp)
+    4606:	68 80 9e 00 00       	push   $0x9e80
+    460b:	ff 75 ec             	push   -0x14(%ebp)
+    460e:	e8 64 1f 00 00       	call   6577 <write>
+    4613:	83 c4 10             	add    $0x10,%esp
+    4616:	89 45 e8             	mov    %eax,-0x18(%ebp)
+      if(cc != sz){
+    4619:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    461c:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    461f:	74 1a                	je     463b <bigwrite+0xad>
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    4621:	ff 75 e8             	push   -0x18(%ebp)
+    4624:	ff 75 f4             	push   -0xc(%ebp)
+    4627:	68 68 88 00 00       	push   $0x8868
+    462c:	6a 01                	push   $0x1
+    462e:	e8 8a 21 00 00       	call   67bd <printf>
+    4633:	83 c4 10             	add    $0x10,%esp
+        exit();
+    4636:	e8 1e 2c 00 00       	call   7259 <exit>
+    for(i = 0; i < 2; i++){
+    463b:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    463f:	83 7d f0 01          	cmpl   $0x1,-0x10(%ebp)
+    4643:	7e bb                	jle    4600 <bigwrite+0x72>
+      }
+    }
+    close(fd);
+    4645:	83 ec 0c             	sub    $0xc,%esp
+    4648:	ff 75 ec             	push   -0x14(%ebp)
+    464b:	e8 21 2c 00 00       	call   7271 <close>
+    4650:	83 c4 10             	add    $0x10,%esp
+    unlink("bigwrite");
+    4653:	83 ec 0c             	sub    $0xc,%esp
+    4656:	68 47 88 00 00       	push   $0x8847
+    465b:	e8 71 1f 00 00       	call   65d1 <unlink>
+    4660:	83 c4 10             	add    $0x10,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    4663:	81 45 f4 d7 01 00 00 	addl   $0x1d7,-0xc(%ebp)
+    466a:	81 7d f4 ff 17 00 00 	cmpl   $0x17ff,-0xc(%ebp)
+    4671:	0f 8e 4b ff ff ff    	jle    45c2 <bigwrite+0x34>
+  }
+
+  printf(1, "bigwrite ok\n");
+    4677:	83 ec 08             	sub    $0x8,%esp
+    467a:	68 7a 88 00 00       	push   $0x887a
+    467f:	6a 01                	push   $0x1
+    4681:	e8 37 21 00 00       	call   67bd <printf>
+    4686:	83 c4 10             	add    $0x10,%esp
+}
+    4689:	90                   	nop
+    468a:	c9                   	leave
+    468b:	c3                   	ret
+
+0000468c <bigfile>:
+
+void
+bigfile(void)
+{
+    468c:	55                   	push   %ebp
+    468d:	89 e5                	mov    %esp,%ebp
+    468f:	83 ec 18             	sub    $0x18,%esp
+  int fd, i, total, cc;
+
+  printf(1, "bigfile test\n");
+    4692:	83 ec 08             	sub    $0x8,%esp
+    4695:	68 87 88 00 00       	push   $0x8887
+    469a:	6a 01                	push   $0x1
+    469c:	e8 1c 21 00 00       	call   67bd <printf>
+    46a1:	83 c4 10             	add    $0x10,%esp
+
+  unlink("bigfile");
+    46a4:	83 ec 0c             	sub    $0xc,%esp
+    46a7:	68 95 88 00 00       	push   $0x8895
+    46ac:	e8 20 1f 00 00       	call   65d1 <unlink>
+    46b1:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    46b4:	83 ec 08             	sub    $0x8,%esp
+    46b7:	68 02 02 00 00       	push   $0x202
+    46bc:	68 95 88 00 00       	push   $0x8895
+    46c1:	e8 ed 1e 00 00       	call   65b3 <open>
+    46c6:	83 c4 10             	add    $0x10,%esp
+    46c9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    46cc:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    46d0:	79 17                	jns    46e9 <bigfile+0x5d>
+    printf(1, "cannot create bigfile");
+    46d2:	83 ec 08             	sub    $0x8,%esp
+    46d5:	68 9d 88 00 00       	push   $0x889d
+    46da:	6a 01                	push   $0x1
+    46dc:	e8 dc 20 00 00       	call   67bd <printf>
+    46e1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    46e4:	e8 70 2b 00 00       	call   7259 <exit>
+  }
+  for(i = 0; i < 20; i++){
+    46e9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    46f0:	eb 52                	jmp    4744 <bigfile+0xb8>
+    memset(buf, i, 600);
+    46f2:	83 ec 04             	sub    $0x4,%esp
+    46f5:	68 58 02 00 00       	push   $0x258
+    46fa:	ff 75 f4             	push   -0xc(%ebp)
+    46fd:	68 80 9e 00 00       	push   $0x9e80
+    4702:	e8 2c 1a 00 00       	call   6133 <memset>
+    4707:	83 c4 10             	add    $0x10,%esp
+    if(write(fd, buf, 600) != 600){
+    470a:	83 ec 04             	sub    $0x4,%esp
+    470d:	68 58 02 00 00       	push   $0x258
+    4712:	68 80 9e 00 00       	push   $0x9e80
+    4717:	ff 75 ec             	push   -0x14(%ebp)
+    471a:	e8 58 1e 00 00       	call   6577 <write>
+    471f:	83 c4 10             	add    $0x10,%esp
+    4722:	3d 58 02 00 00       	cmp    $0x258,%eax
+    4727:	74 17                	je     4740 <bigfile+0xb4>
+      printf(1, "write bigfile failed\n");
+    4729:	83 ec 08             	sub    $0x8,%esp
+    472c:	68 b3 88 00 00       	push   $0x88b3
+    4731:	6a 01                	push   $0x1
+    4733:	e8 85 20 00 00       	call   67bd <printf>
+    4738:	83 c4 10             	add    $0x10,%esp
+      exit();
+    473b:	e8 19 2b 00 00       	call   7259 <exit>
+  for(i = 0; i < 20; i++){
+    4740:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    4744:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    4748:	7e a8                	jle    46f2 <bigfile+0x66>
+    }
+  }
+  close(fd);
+    474a:	83 ec 0c             	sub    $0xc,%esp
+    474d:	ff 75 ec             	push   -0x14(%ebp)
+    4750:	e8 1c 2b 00 00       	call   7271 <close>
+    4755:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("bigfile", 0);
+    4758:	83 ec 08             	sub    $0x8,%esp
+    475b:	6a 00                	push   $0x0
+    475d:	68 95 88 00 00       	push   $0x8895
+    4762:	e8 4c 1e 00 00       	call   65b3 <open>
+    4767:	83 c4 10             	add    $0x10,%esp
+    476a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    476d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    4771:	79 17                	jns    478a <bigfile+0xfe>
+    printf(1, "cannot open bigfile\n");
+    4773:	83 ec 08             	sub    $0x8,%esp
+    4776:	68 c9 88 00 00       	push   $0x88c9
+    477b:	6a 01                	push   $0x1
+    477d:	e8 3b 20 00 00       	call   67bd <printf>
+    4782:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4785:	e8 cf 2a 00 00       	call   7259 <exit>
+  }
+  total = 0;
+    478a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  for(i = 0; ; i++){
+    4791:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    cc = read(fd, buf, 300);
+    4798:	83 ec 04             	sub    $0x4,%esp
+    479b:	68 2c 01 00 00       	push   $0x12c
+    47a0:	68 80 9e 00 00       	push   $0x9e80
+    47a5:	ff 75 ec             	push   -0x14(%ebp)
+    47a8:	e8 bb 1d 00 00       	call   6568 <read>
+    47ad:	83 c4 10             	add    $0x10,%esp
+    47b0:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(cc < 0){
+    47b3:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    47b7:	79 17                	jns    47d0 <bigfile+0x144>
+      printf(1, "read bigfile failed\n");
+    47b9:	83 ec 08             	sub    $0x8,%esp
+    47bc:	68 de 88 00 00       	push   $0x88de
+    47c1:	6a 01                	push   $0x1
+    47c3:	e8 f5 1f 00 00       	call   67bd <printf>
+    47c8:	83 c4 10             	add    $0x10,%esp
+      exit();
+    47cb:	e8 89 2a 00 00       	call   7259 <exit>
+    }
+    if(cc == 0)
+    47d0:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    47d4:	74 7a                	je     4850 <bigfile+0x1c4>
+      break;
+    if(cc != 300){
+    47d6:	81 7d e8 2c 01 00 00 	cmpl   $0x12c,-0x18(%ebp)
+    47dd:	74 17                	je     47f6 <bigfile+0x16a>
+      printf(1, "short read bigfile\n");
+    47df:	83 ec 08             	sub    $0x8,%esp
+    47e2:	68 f3 88 00 00       	push   $0x88f3
+    47e7:	6a 01                	push   $0x1
+    47e9:	e8 cf 1f 00 00       	call   67bd <printf>
+    47ee:	83 c4 10             	add    $0x10,%esp
+      exit();
+    47f1:	e8 63 2a 00 00       	call   7259 <exit>
+    }
+    if(buf[0] != i/2 || buf[299] != i/2){
+    47f6:	0f b6 05 80 9e 00 00 	movzbl 0x9e80,%eax
+    47fd:	0f be d0             	movsbl %al,%edx
+    4800:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4803:	89 c1                	mov    %eax,%ecx
+    4805:	c1 e9 1f             	shr    $0x1f,%ecx
+    4808:	01 c8                	add    %ecx,%eax
+    480a:	d1 f8                	sar    %eax
+    480c:	39 c2                	cmp    %eax,%edx
+    480e:	75 1a                	jne    482a <bigfile+0x19e>
+    4810:	0f b6 05 ab 9f 00 00 	movzbl 0x9fab,%eax
+    4817:	0f be d0             	movsbl %al,%edx
+    481a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    481d:	89 c1                	mov    %eax,%ecx
+    481f:	c1 e9 1f             	shr    $0x1f,%ecx
+    4822:	01 c8                	add    %ecx,%eax
+    4824:	d1 f8                	sar    %eax
+    4826:	39 c2                	cmp    %eax,%edx
+    4828:	74 17                	je     4841 <bigfile+0x1b5>
+      printf(1, "read bigfile wrong data\n");
+    482a:	83 ec 08             	sub    $0x8,%esp
+    482d:	68 07 89 00 00       	push   $0x8907
+    4832:	6a 01                	push   $0x1
+    4834:	e8 84 1f 00 00       	call   67bd <printf>
+    4839:	83 c4 10             	add    $0x10,%esp
+      exit();
+    483c:	e8 18 2a 00 00       	call   7259 <exit>
+    }
+    total += cc;
+    4841:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    4844:	01 45 f0             	add    %eax,-0x10(%ebp)
+  for(i = 0; ; i++){
+    4847:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    cc = read(fd, buf, 300);
+    484b:	e9 48 ff ff ff       	jmp    4798 <bigfile+0x10c>
+      break;
+    4850:	90                   	nop
+  }
+  close(fd);
+    4851:	83 ec 0c             	sub    $0xc,%esp
+    4854:	ff 75 ec             	push   -0x14(%ebp)
+    4857:	e8 15 2a 00 00       	call   7271 <close>
+    485c:	83 c4 10             	add    $0x10,%esp
+  if(total != 20*600){
+    485f:	81 7d f0 e0 2e 00 00 	cmpl   $0x2ee0,-0x10(%ebp)
+    4866:	74 17                	je     487f <bigfile+0x1f3>
+    printf(1, "read bigfile wrong total\n");
+    4868:	83 ec 08             	sub    $0x8,%esp
+    486b:	68 20 89 00 00       	push   $0x8920
+    4870:	6a 01                	push   $0x1
+    4872:	e8 46 1f 00 00       	call   67bd <printf>
+    4877:	83 c4 10             	add    $0x10,%esp
+    exit();
+    487a:	e8 da 29 00 00       	call   7259 <exit>
+  }
+  unlink("bigfile");
+    487f:	83 ec 0c             	sub    $0xc,%esp
+    4882:	68 95 88 00 00       	push   $0x8895
+    4887:	e8 45 1d 00 00       	call   65d1 <unlink>
+    488c:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "bigfile test ok\n");
+    488f:	83 ec 08             	sub    $0x8,%esp
+    4892:	68 3a 89 00 00       	push   $0x893a
+    4897:	6a 01                	push   $0x1
+    4899:	e8 1f 1f 00 00       	call   67bd <printf>
+    489e:	83 c4 10             	add    $0x10,%esp
+}
+    48a1:	90                   	nop
+    48a2:	c9                   	leave
+    48a3:	c3                   	ret
+
+000048a4 <fourteen>:
+
+void
+fourteen(void)
+{
+    48a4:	55                   	push   %ebp
+    48a5:	89 e5                	mov    %esp,%ebp
+    48a7:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  // DIRSIZ is 14.
+  printf(1, "fourteen test\n");
+    48aa:	83 ec 08             	sub    $0x8,%esp
+    48ad:	68 4b 89 00 00       	push   $0x894b
+    48b2:	6a 01                	push   $0x1
+    48b4:	e8 04 1f 00 00       	call   67bd <printf>
+    48b9:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("12345678901234") != 0){
+    48bc:	83 ec 0c             	sub    $0xc,%esp
+    48bf:	68 5a 89 00 00       	push   $0x895a
+    48c4:	e8 35 1d 00 00       	call   65fe <mkdir>
+    48c9:	83 c4 10             	add    $0x10,%esp
+    48cc:	85 c0                	test   %eax,%eax
+    48ce:	74 17                	je     48e7 <fourteen+0x43>
+    printf(1, "mkdir 12345678901234 failed\n");
+    48d0:	83 ec 08             	sub    $0x8,%esp
+    48d3:	68 69 89 00 00       	push   $0x8969
+    48d8:	6a 01                	push   $0x1
+    48da:	e8 de 1e 00 00       	call   67bd <printf>
+    48df:	83 c4 10             	add    $0x10,%esp
+    exit();
+    48e2:	e8 72 29 00 00       	call   7259 <exit>
+  }
+  if(mkdir("12345678901234/123456789012345") != 0){
+    48e7:	83 ec 0c             	sub    $0xc,%esp
+    48ea:	68 88 89 00 00       	push   $0x8988
+    48ef:	e8 0a 1d 00 00       	call   65fe <mkdir>
+    48f4:	83 c4 10             	add    $0x10,%esp
+    48f7:	85 c0                	test   %eax,%eax
+    48f9:	74 17                	je     4912 <fourteen+0x6e>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    48fb:	83 ec 08             	sub    $0x8,%esp
+    48fe:	68 a8 89 00 00       	push   $0x89a8
+    4903:	6a 01                	push   $0x1
+    4905:	e8 b3 1e 00 00       	call   67bd <printf>
+    490a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    490d:	e8 47 29 00 00       	call   7259 <exit>
+  }
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    4912:	83 ec 08             	sub    $0x8,%esp
+    4915:	68 00 02 00 00       	push   $0x200
+    491a:	68 d8 89 00 00       	push   $0x89d8
+    491f:	e8 8f 1c 00 00       	call   65b3 <open>
+    4924:	83 c4 10             	add    $0x10,%esp
+    4927:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    492a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    492e:	79 17                	jns    4947 <fourteen+0xa3>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    4930:	83 ec 08             	sub    $0x8,%esp
+    4933:	68 08 8a 00 00       	push   $0x8a08
+    4938:	6a 01                	push   $0x1
+    493a:	e8 7e 1e 00 00       	call   67bd <printf>
+    493f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4942:	e8 12 29 00 00       	call   7259 <exit>
+  }
+  close(fd);
+    4947:	83 ec 0c             	sub    $0xc,%esp
+    494a:	ff 75 f4             	push   -0xc(%ebp)
+    494d:	e8 1f 29 00 00       	call   7271 <close>
+    4952:	83 c4 10             	add    $0x10,%esp
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    4955:	83 ec 08             	sub    $0x8,%esp
+    4958:	6a 00                	push   $0x0
+    495a:	68 48 8a 00 00       	push   $0x8a48
+    495f:	e8 4f 1c 00 00       	call   65b3 <open>
+    4964:	83 c4 10             	add    $0x10,%esp
+    4967:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    496a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    496e:	79 17                	jns    4987 <fourteen+0xe3>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    4970:	83 ec 08             	sub    $0x8,%esp
+    4973:	68 78 8a 00 00       	push   $0x8a78
+    4978:	6a 01                	push   $0x1
+    497a:	e8 3e 1e 00 00       	call   67bd <printf>
+    497f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4982:	e8 d2 28 00 00       	call   7259 <exit>
+  }
+  close(fd);
+    4987:	83 ec 0c             	sub    $0xc,%esp
+    498a:	ff 75 f4             	push   -0xc(%ebp)
+    498d:	e8 df 28 00 00       	call   7271 <close>
+    4992:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("12345678901234/12345678901234") == 0){
+    4995:	83 ec 0c             	sub    $0xc,%esp
+    4998:	68 b2 8a 00 00       	push   $0x8ab2
+    499d:	e8 5c 1c 00 00       	call   65fe <mkdir>
+    49a2:	83 c4 10             	add    $0x10,%esp
+    49a5:	85 c0                	test   %eax,%eax
+    49a7:	75 17                	jne    49c0 <fourteen+0x11c>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    49a9:	83 ec 08             	sub    $0x8,%esp
+    49ac:	68 d0 8a 00 00       	push   $0x8ad0
+    49b1:	6a 01                	push   $0x1
+    49b3:	e8 05 1e 00 00       	call   67bd <printf>
+    49b8:	83 c4 10             	add    $0x10,%esp
+    exit();
+    49bb:	e8 99 28 00 00       	call   7259 <exit>
+  }
+  if(mkdir("123456789012345/12345678901234") == 0){
+    49c0:	83 ec 0c             	sub    $0xc,%esp
+    49c3:	68 00 8b 00 00       	push   $0x8b00
+    49c8:	e8 31 1c 00 00       	call   65fe <mkdir>
+    49cd:	83 c4 10             	add    $0x10,%esp
+    49d0:	85 c0                	test   %eax,%eax
+    49d2:	75 17                	jne    49eb <fourteen+0x147>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    49d4:	83 ec 08             	sub    $0x8,%esp
+    49d7:	68 20 8b 00 00       	push   $0x8b20
+    49dc:	6a 01                	push   $0x1
+    49de:	e8 da 1d 00 00       	call   67bd <printf>
+    49e3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    49e6:	e8 6e 28 00 00       	call   7259 <exit>
+  }
+
+  printf(1, "fourteen ok\n");
+    49eb:	83 ec 08             	sub    $0x8,%esp
+    49ee:	68 51 8b 00 00       	push   $0x8b51
+    49f3:	6a 01                	push   $0x1
+    49f5:	e8 c3 1d 00 00       	call   67bd <printf>
+    49fa:	83 c4 10             	add    $0x10,%esp
+}
+    49fd:	90                   	nop
+    49fe:	c9                   	leave
+    49ff:	c3                   	ret
+
+00004a00 <rmdot>:
+
+void
+rmdot(void)
+{
+    4a00:	55                   	push   %ebp
+    4a01:	89 e5                	mov    %esp,%ebp
+    4a03:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "rmdot test\n");
+    4a06:	83 ec 08             	sub    $0x8,%esp
+    4a09:	68 5e 8b 00 00       	push   $0x8b5e
+    4a0e:	6a 01                	push   $0x1
+    4a10:	e8 a8 1d 00 00       	call   67bd <printf>
+    4a15:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("dots") != 0){
+    4a18:	83 ec 0c             	sub    $0xc,%esp
+    4a1b:	68 6a 8b 00 00       	push   $0x8b6a
+    4a20:	e8 d9 1b 00 00       	call   65fe <mkdir>
+    4a25:	83 c4 10             	add    $0x10,%esp
+    4a28:	85 c0                	test   %eax,%eax
+    4a2a:	74 17                	je     4a43 <rmdot+0x43>
+    printf(1, "mkdir dots failed\n");
+    4a2c:	83 ec 08             	sub    $0x8,%esp
+    4a2f:	68 6f 8b 00 00       	push   $0x8b6f
+    4a34:	6a 01                	push   $0x1
+    4a36:	e8 82 1d 00 00       	call   67bd <printf>
+    4a3b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4a3e:	e8 16 28 00 00       	call   7259 <exit>
+  }
+  if(chdir("dots") != 0){
+    4a43:	83 ec 0c             	sub    $0xc,%esp
+    4a46:	68 6a 8b 00 00       	push   $0x8b6a
+    4a4b:	e8 bd 1b 00 00       	call   660d <chdir>
+    4a50:	83 c4 10             	add    $0x10,%esp
+    4a53:	85 c0                	test   %eax,%eax
+    4a55:	74 17                	je     4a6e <rmdot+0x6e>
+    printf(1, "chdir dots failed\n");
+    4a57:	83 ec 08             	sub    $0x8,%esp
+    4a5a:	68 82 8b 00 00       	push   $0x8b82
+    4a5f:	6a 01                	push   $0x1
+    4a61:	e8 57 1d 00 00       	call   67bd <printf>
+    4a66:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4a69:	e8 eb 27 00 00       	call   7259 <exit>
+  }
+  if(unlink(".") == 0){
+    4a6e:	83 ec 0c             	sub    $0xc,%esp
+    4a71:	68 2b 7e 00 00       	push   $0x7e2b
+    4a76:	e8 56 1b 00 00       	call   65d1 <unlink>
+    4a7b:	83 c4 10             	add    $0x10,%esp
+    4a7e:	85 c0                	test   %eax,%eax
+    4a80:	75 17                	jne    4a99 <rmdot+0x99>
+    printf(1, "rm . worked!\n");
+    4a82:	83 ec 08             	sub    $0x8,%esp
+    4a85:	68 95 8b 00 00       	push   $0x8b95
+    4a8a:	6a 01                	push   $0x1
+    4a8c:	e8 2c 1d 00 00       	call   67bd <printf>
+    4a91:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4a94:	e8 c0 27 00 00       	call   7259 <exit>
+  }
+  if(unlink("..") == 0){
+    4a99:	83 ec 0c             	sub    $0xc,%esp
+    4a9c:	68 f2 76 00 00       	push   $0x76f2
+    4aa1:	e8 2b 1b 00 00       	call   65d1 <unlink>
+    4aa6:	83 c4 10             	add    $0x10,%esp
+    4aa9:	85 c0                	test   %eax,%eax
+    4aab:	75 17                	jne    4ac4 <rmdot+0xc4>
+    printf(1, "rm .. worked!\n");
+    4aad:	83 ec 08             	sub    $0x8,%esp
+    4ab0:	68 a3 8b 00 00       	push   $0x8ba3
+    4ab5:	6a 01                	push   $0x1
+    4ab7:	e8 01 1d 00 00       	call   67bd <printf>
+    4abc:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4abf:	e8 95 27 00 00       	call   7259 <exit>
+  }
+  if(chdir("/") != 0){
+    4ac4:	83 ec 0c             	sub    $0xc,%esp
+    4ac7:	68 46 73 00 00       	push   $0x7346
+    4acc:	e8 3c 1b 00 00       	call   660d <chdir>
+    4ad1:	83 c4 10             	add    $0x10,%esp
+    4ad4:	85 c0                	test   %eax,%eax
+    4ad6:	74 17                	je     4aef <rmdot+0xef>
+    printf(1, "chdir / failed\n");
+    4ad8:	83 ec 08             	sub    $0x8,%esp
+    4adb:	68 48 73 00 00       	push   $0x7348
+    4ae0:	6a 01                	push   $0x1
+    4ae2:	e8 d6 1c 00 00       	call   67bd <printf>
+    4ae7:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4aea:	e8 6a 27 00 00       	call   7259 <exit>
+  }
+  if(unlink("dots/.") == 0){
+    4aef:	83 ec 0c             	sub    $0xc,%esp
+    4af2:	68 b2 8b 00 00       	push   $0x8bb2
+    4af7:	e8 d5 1a 00 00       	call   65d1 <unlink>
+    4afc:	83 c4 10             	add    $0x10,%esp
+    4aff:	85 c0                	test   %eax,%eax
+    4b01:	75 17                	jne    4b1a <rmdot+0x11a>
+    printf(1, "unlink dots/. worked!\n");
+    4b03:	83 ec 08             	sub    $0x8,%esp
+    4b06:	68 b9 8b 00 00       	push   $0x8bb9
+    4b0b:	6a 01                	push   $0x1
+    4b0d:	e8 ab 1c 00 00       	call   67bd <printf>
+    4b12:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4b15:	e8 3f 27 00 00       	call   7259 <exit>
+  }
+  if(unlink("dots/..") == 0){
+    4b1a:	83 ec 0c             	sub    $0xc,%esp
+    4b1d:	68 d0 8b 00 00       	push   $0x8bd0
+    4b22:	e8 aa 1a 00 00       	call   65d1 <unlink>
+    4b27:	83 c4 10             	add    $0x10,%esp
+    4b2a:	85 c0                	test   %eax,%eax
+    4b2c:	75 17                	jne    4b45 <rmdot+0x145>
+    printf(1, "unlink dots/.. worked!\n");
+    4b2e:	83 ec 08             	sub    $0x8,%esp
+    4b31:	68 d8 8b 00 00       	push   $0x8bd8
+    4b36:	6a 01                	push   $0x1
+    4b38:	e8 80 1c 00 00       	call   67bd <printf>
+    4b3d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4b40:	e8 14 27 00 00       	call   7259 <exit>
+  }
+  if(unlink("dots") != 0){
+    4b45:	83 ec 0c             	sub    $0xc,%esp
+    4b48:	68 6a 8b 00 00       	push   $0x8b6a
+    4b4d:	e8 7f 1a 00 00       	call   65d1 <unlink>
+    4b52:	83 c4 10             	add    $0x10,%esp
+    4b55:	85 c0                	test   %eax,%eax
+    4b57:	74 17                	je     4b70 <rmdot+0x170>
+    printf(1, "unlink dots failed!\n");
+    4b59:	83 ec 08             	sub    $0x8,%esp
+    4b5c:	68 f0 8b 00 00       	push   $0x8bf0
+    4b61:	6a 01                	push   $0x1
+    4b63:	e8 55 1c 00 00       	call   67bd <printf>
+    4b68:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4b6b:	e8 e9 26 00 00       	call   7259 <exit>
+  }
+  printf(1, "rmdot ok\n");
+    4b70:	83 ec 08             	sub    $0x8,%esp
+    4b73:	68 05 8c 00 00       	push   $0x8c05
+    4b78:	6a 01                	push   $0x1
+    4b7a:	e8 3e 1c 00 00       	call   67bd <printf>
+    4b7f:	83 c4 10             	add    $0x10,%esp
+}
+    4b82:	90                   	nop
+    4b83:	c9                   	leave
+    4b84:	c3                   	ret
+
+00004b85 <dirfile>:
+
+void
+dirfile(void)
+{
+    4b85:	55                   	push   %ebp
+    4b86:	89 e5                	mov    %esp,%ebp
+    4b88:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  printf(1, "dir vs file\n");
+    4b8b:	83 ec 08             	sub    $0x8,%esp
+    4b8e:	68 0f 8c 00 00       	push   $0x8c0f
+    4b93:	6a 01                	push   $0x1
+    4b95:	e8 23 1c 00 00       	call   67bd <printf>
+    4b9a:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("dirfile", O_CREATE);
+    4b9d:	83 ec 08             	sub    $0x8,%esp
+    4ba0:	68 00 02 00 00       	push   $0x200
+    4ba5:	68 1c 8c 00 00       	push   $0x8c1c
+    4baa:	e8 04 1a 00 00       	call   65b3 <open>
+    4baf:	83 c4 10             	add    $0x10,%esp
+    4bb2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    4bb5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4bb9:	79 17                	jns    4bd2 <dirfile+0x4d>
+    printf(1, "create dirfile failed\n");
+    4bbb:	83 ec 08             	sub    $0x8,%esp
+    4bbe:	68 24 8c 00 00       	push   $0x8c24
+    4bc3:	6a 01                	push   $0x1
+    4bc5:	e8 f3 1b 00 00       	call   67bd <printf>
+    4bca:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4bcd:	e8 87 26 00 00       	call   7259 <exit>
+  }
+  close(fd);
+    4bd2:	83 ec 0c             	sub    $0xc,%esp
+    4bd5:	ff 75 f4             	push   -0xc(%ebp)
+    4bd8:	e8 94 26 00 00       	call   7271 <close>
+    4bdd:	83 c4 10             	add    $0x10,%esp
+  if(chdir("dirfile") == 0){
+    4be0:	83 ec 0c             	sub    $0xc,%esp
+    4be3:	68 1c 8c 00 00       	push   $0x8c1c
+    4be8:	e8 20 1a 00 00       	call   660d <chdir>
+    4bed:	83 c4 10             	add    $0x10,%esp
+    4bf0:	85 c0                	test   %eax,%eax
+    4bf2:	75 17                	jne    4c0b <dirfile+0x86>
+    printf(1, "chdir dirfile succeeded!\n");
+    4bf4:	83 ec 08             	sub    $0x8,%esp
+    4bf7:	68 3b 8c 00 00       	push   $0x8c3b
+    4bfc:	6a 01                	push   $0x1
+    4bfe:	e8 ba 1b 00 00       	call   67bd <printf>
+    4c03:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4c06:	e8 4e 26 00 00       	call   7259 <exit>
+  }
+  fd = open("dirfile/xx", 0);
+    4c0b:	83 ec 08             	sub    $0x8,%esp
+    4c0e:	6a 00                	push   $0x0
+    4c10:	68 55 8c 00 00       	push   $0x8c55
+    4c15:	e8 99 19 00 00       	call   65b3 <open>
+    4c1a:	83 c4 10             	add    $0x10,%esp
+    4c1d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+    4c20:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4c24:	78 17                	js     4c3d <dirfile+0xb8>
+    printf(1, "create dirfile/xx succeeded!\n");
+    4c26:	83 ec 08             	sub    $0x8,%esp
+    4c29:	68 60 8c 00 00       	push   $0x8c60
+    4c2e:	6a 01                	push   $0x1
+    4c30:	e8 88 1b 00 00       	call   67bd <printf>
+    4c35:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4c38:	e8 1c 26 00 00       	call   7259 <exit>
+  }
+  fd = open("dirfile/xx", O_CREATE);
+    4c3d:	83 ec 08             	sub    $0x8,%esp
+    4c40:	68 00 02 00 00       	push   $0x200
+    4c45:	68 55 8c 00 00       	push   $0x8c55
+    4c4a:	e8 64 19 00 00       	call   65b3 <open>
+    4c4f:	83 c4 10             	add    $0x10,%esp
+    4c52:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+    4c55:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4c59:	78 17                	js     4c72 <dirfile+0xed>
+    printf(1, "create dirfile/xx succeeded!\n");
+    4c5b:	83 ec 08             	sub    $0x8,%esp
+    4c5e:	68 60 8c 00 00       	push   $0x8c60
+    4c63:	6a 01                	push   $0x1
+    4c65:	e8 53 1b 00 00       	call   67bd <printf>
+    4c6a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4c6d:	e8 e7 25 00 00       	call   7259 <exit>
+  }
+  if(mkdir("dirfile/xx") == 0){
+    4c72:	83 ec 0c             	sub    $0xc,%esp
+    4c75:	68 55 8c 00 00       	push   $0x8c55
+    4c7a:	e8 7f 19 00 00       	call   65fe <mkdir>
+    4c7f:	83 c4 10             	add    $0x10,%esp
+    4c82:	85 c0                	test   %eax,%eax
+    4c84:	75 17                	jne    4c9d <dirfile+0x118>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    4c86:	83 ec 08             	sub    $0x8,%esp
+    4c89:	68 7e 8c 00 00       	push   $0x8c7e
+    4c8e:	6a 01                	push   $0x1
+    4c90:	e8 28 1b 00 00       	call   67bd <printf>
+    4c95:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4c98:	e8 bc 25 00 00       	call   7259 <exit>
+  }
+  if(unlink("dirfile/xx") == 0){
+    4c9d:	83 ec 0c             	sub    $0xc,%esp
+    4ca0:	68 55 8c 00 00       	push   $0x8c55
+    4ca5:	e8 27 19 00 00       	call   65d1 <unlink>
+    4caa:	83 c4 10             	add    $0x10,%esp
+    4cad:	85 c0                	test   %eax,%eax
+    4caf:	75 17                	jne    4cc8 <dirfile+0x143>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    4cb1:	83 ec 08             	sub    $0x8,%esp
+    4cb4:	68 9b 8c 00 00       	push   $0x8c9b
+    4cb9:	6a 01                	push   $0x1
+    4cbb:	e8 fd 1a 00 00       	call   67bd <printf>
+    4cc0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4cc3:	e8 91 25 00 00       	call   7259 <exit>
+  }
+  if(link("README", "dirfile/xx") == 0){
+    4cc8:	83 ec 08             	sub    $0x8,%esp
+    4ccb:	68 55 8c 00 00       	push   $0x8c55
+    4cd0:	68 b9 8c 00 00       	push   $0x8cb9
+    4cd5:	e8 15 19 00 00       	call   65ef <link>
+    4cda:	83 c4 10             	add    $0x10,%esp
+    4cdd:	85 c0                	test   %eax,%eax
+    4cdf:	75 17                	jne    4cf8 <dirfile+0x173>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    4ce1:	83 ec 08             	sub    $0x8,%esp
+    4ce4:	68 c0 8c 00 00       	push   $0x8cc0
+    4ce9:	6a 01                	push   $0x1
+    4ceb:	e8 cd 1a 00 00       	call   67bd <printf>
+    4cf0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4cf3:	e8 61 25 00 00       	call   7259 <exit>
+  }
+  if(unlink("dirfile") != 0){
+    4cf8:	83 ec 0c             	sub    $0xc,%esp
+    4cfb:	68 1c 8c 00 00       	push   $0x8c1c
+    4d00:	e8 cc 18 00 00       	call   65d1 <unlink>
+    4d05:	83 c4 10             	add    $0x10,%esp
+    4d08:	85 c0                	test   %eax,%eax
+    4d0a:	74 17                	je     4d23 <dirfile+0x19e>
+    printf(1, "unlink dirfile failed!\n");
+    4d0c:	83 ec 08             	sub    $0x8,%esp
+    4d0f:	68 df 8c 00 00       	push   $0x8cdf
+    4d14:	6a 01                	push   $0x1
+    4d16:	e8 a2 1a 00 00       	call   67bd <printf>
+    4d1b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4d1e:	e8 36 25 00 00       	call   7259 <exit>
+  }
+
+  fd = open(".", O_RDWR);
+    4d23:	83 ec 08             	sub    $0x8,%esp
+    4d26:	6a 02                	push   $0x2
+    4d28:	68 2b 7e 00 00       	push   $0x7e2b
+    4d2d:	e8 81 18 00 00       	call   65b3 <open>
+    4d32:	83 c4 10             	add    $0x10,%esp
+    4d35:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+    4d38:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4d3c:	78 17                	js     4d55 <dirfile+0x1d0>
+    printf(1, "open . for writing succeeded!\n");
+    4d3e:	83 ec 08             	sub    $0x8,%esp
+    4d41:	68 f8 8c 00 00       	push   $0x8cf8
+    4d46:	6a 01                	push   $0x1
+    4d48:	e8 70 1a 00 00       	call   67bd <printf>
+    4d4d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4d50:	e8 04 25 00 00       	call   7259 <exit>
+  }
+  fd = open(".", 0);
+    4d55:	83 ec 08             	sub    $0x8,%esp
+    4d58:	6a 00                	push   $0x0
+    4d5a:	68 2b 7e 00 00       	push   $0x7e2b
+    4d5f:	e8 4f 18 00 00       	call   65b3 <open>
+    4d64:	83 c4 10             	add    $0x10,%esp
+    4d67:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(write(fd, "x", 1) > 0){
+    4d6a:	83 ec 04             	sub    $0x4,%esp
+    4d6d:	6a 01                	push   $0x1
+    4d6f:	68 9a 78 00 00       	push   $0x789a
+    4d74:	ff 75 f4             	push   -0xc(%ebp)
+    4d77:	e8 fb 17 00 00       	call   6577 <write>
+    4d7c:	83 c4 10             	add    $0x10,%esp
+    4d7f:	85 c0                	test   %eax,%eax
+    4d81:	7e 17                	jle    4d9a <dirfile+0x215>
+    printf(1, "write . succeeded!\n");
+    4d83:	83 ec 08             	sub    $0x8,%esp
+    4d86:	68 17 8d 00 00       	push   $0x8d17
+    4d8b:	6a 01                	push   $0x1
+    4d8d:	e8 2b 1a 00 00       	call   67bd <printf>
+    4d92:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4d95:	e8 bf 24 00 00       	call   7259 <exit>
+  }
+  close(fd);
+    4d9a:	83 ec 0c             	sub    $0xc,%esp
+    4d9d:	ff 75 f4             	push   -0xc(%ebp)
+    4da0:	e8 cc 24 00 00       	call   7271 <close>
+    4da5:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "dir vs file OK\n");
+    4da8:	83 ec 08             	sub    $0x8,%esp
+    4dab:	68 2b 8d 00 00       	push   $0x8d2b
+    4db0:	6a 01                	push   $0x1
+    4db2:	e8 06 1a 00 00       	call   67bd <printf>
+    4db7:	83 c4 10             	add    $0x10,%esp
+}
+    4dba:	90                   	nop
+    4dbb:	c9                   	leave
+    4dbc:	c3                   	ret
+
+00004dbd <cachedpath>:
+// path lookups answered from the directory name cache
+// without inode locks agree with the locked walk, while
+// other processes change the same directory.
+void
+cachedpath(void)
+{
+    4dbd:	55                   	push   %ebp
+    4dbe:	89 e5                	mov    %esp,%ebp
+    4dc0:	83 ec 28             	sub    $0x28,%esp
+  int fd, i, pi, pid;
+  char c;
+
+  printf(1, "cached path test\n");
+    4dc3:	83 ec 08             	sub    $0x8,%esp
+    4dc6:	68 3b 8d 00 00       	push   $0x8d3b
+    4dcb:	6a 01                	push   $0x1
+    4dcd:	e8 eb 19 00 00       	call   67bd <printf>
+    4dd2:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("cp") < 0 || mkdir("cp/a") < 0 || mkdir("cp/a/b") < 0){
+    4dd5:	83 ec 0c             	sub    $0xc,%esp
+    4dd8:	68 4d 8d 00 00       	push   $0x8d4d
+    4ddd:	e8 1c 18 00 00       	call   65fe <mkdir>
+    4de2:	83 c4 10             	add    $0x10,%esp
+    4de5:	85 c0                	test   %eax,%eax
+    4de7:	78 28                	js     4e11 <cachedpath+0x54>
+    4de9:	83 ec 0c             	sub    $0xc,%esp
+    4dec:	68 50 8d 00 00       	push   $0x8d50
+    4df1:	e8 08 18 00 00       	call   65fe <mkdir>
+    4df6:	83 c4 10             	add    $0x10,%esp
+    4df9:	85 c0                	test   %eax,%eax
+    4dfb:	78 14                	js     4e11 <cachedpath+0x54>
+    4dfd:	83 ec 0c             	sub    $0xc,%esp
+    4e00:	68 55 8d 00 00       	push   $0x8d55
+    4e05:	e8 f4 17 00 00       	call   65fe <mkdir>
+    4e0a:	83 c4 10             	add    $0x10,%esp
+    4e0d:	85 c0                	test   %eax,%eax
+    4e0f:	79 17                	jns    4e28 <cachedpath+0x6b>
+    printf(1, "mkdir cp failed\n");
+    4e11:	83 ec 08             	sub    $0x8,%esp
+    4e14:	68 5c 8d 00 00       	push   $0x8d5c
+    4e19:	6a 01                	push   $0x1
+    4e1b:	e8 9d 19 00 00       	call   67bd <printf>
+    4e20:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4e23:	e8 31 24 00 00       	call   7259 <exit>
+  }
+  fd = open("cp/a/b/f", O_CREATE | O_RDWR);
+    4e28:	83 ec 08             	sub    $0x8,%esp
+    4e2b:	68 02 02 00 00       	push   $0x202
+    4e30:	68 6d 8d 00 00       	push   $0x8d6d
+    4e35:	e8 79 17 00 00       	call   65b3 <open>
+    4e3a:	83 c4 10             	add    $0x10,%esp
+    4e3d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0 || write(fd, "x", 1) != 1){
+    4e40:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    4e44:	78 1a                	js     4e60 <cachedpath+0xa3>
+    4e46:	83 ec 04             	sub    $0x4,%esp
+    4e49:	6a 01                	push   $0x1
+    4e4b:	68 9a 78 00 00       	push   $0x789a
+    4e50:	ff 75 ec             	push   -0x14(%ebp)
+    4e53:	e8 1f 17 00 00       	call   6577 <write>
+    4e58:	83 c4 10             	add    $0x10,%esp
+    4e5b:	83 f8 01             	cmp    $0x1,%eax
+    4e5e:	74 17                	je     4e77 <cachedpath+0xba>
+    printf(1, "create cp/a/b/f failed\n");
+    4e60:	83 ec 08             	sub    $0x8,%esp
+    4e63:	68 76 8d 00 00       	push   $0x8d76
+    4e68:	6a 01                	push   $0x1
+    4e6a:	e8 4e 19 00 00       	call   67bd <printf>
+    4e6f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4e72:	e8 e2 23 00 00       	call   7259 <exit>
+  }
+  close(fd);
+    4e77:	83 ec 0c             	sub    $0xc,%esp
+    4e7a:	ff 75 ec             	push   -0x14(%ebp)
+    4e7d:	e8 ef 23 00 00       	call   7271 <close>
+    4e82:	83 c4 10             	add    $0x10,%esp
+
+  for(pi = 0; pi < 4; pi++){
+    4e85:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    4e8c:	e9 35 01 00 00       	jmp    4fc6 <cachedpath+0x209>
+    pid = fork();
+    4e91:	e8 83 23 00 00       	call   7219 <fork>
+    4e96:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    4e99:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    4e9d:	79 17                	jns    4eb6 <cachedpath+0xf9>
+      printf(1, "fork failed\n");
+    4e9f:	83 ec 08             	sub    $0x8,%esp
+    4ea2:	68 75 73 00 00       	push   $0x7375
+    4ea7:	6a 01                	push   $0x1
+    4ea9:	e8 0f 19 00 00       	call   67bd <printf>
+    4eae:	83 c4 10             	add    $0x10,%esp
+      exit();
+    4eb1:	e8 a3 23 00 00       	call   7259 <exit>
+    }
+    if(pid == 0 && pi == 3){
+    4eb6:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    4eba:	75 4f                	jne    4f0b <cachedpath+0x14e>
+    4ebc:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    4ec0:	75 49                	jne    4f0b <cachedpath+0x14e>
+      for(i = 0; i < 50; i++){
+    4ec2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    4ec9:	eb 35                	jmp    4f00 <cachedpath+0x143>
+        close(open("cp/a/b/g", O_CREATE | O_RDWR));
+    4ecb:	83 ec 08             	sub    $0x8,%esp
+    4ece:	68 02 02 00 00       	push   $0x202
+    4ed3:	68 8e 8d 00 00       	push   $0x8d8e
+    4ed8:	e8 d6 16 00 00       	call   65b3 <open>
+    4edd:	83 c4 10             	add    $0x10,%esp
+    4ee0:	83 ec 0c             	sub    $0xc,%esp
+    4ee3:	50                   	push   %eax
+    4ee4:	e8 88 23 00 00       	call   7271 <close>
+    4ee9:	83 c4 10             	add    $0x10,%esp
+        unlink("cp/a/b/g");
+    4eec:	83 ec 0c             	sub    $0xc,%esp
+    4eef:	68 8e 8d 00 00       	push   $0x8d8e
+    4ef4:	e8 d8 16 00 00       	call   65d1 <unlink>
+    4ef9:	83 c4 10             	add    $0x10,%esp
+      for(i = 0; i < 50; i++){
+    4efc:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    4f00:	83 7d f4 31          	cmpl   $0x31,-0xc(%ebp)
+    4f04:	7e c5                	jle    4ecb <cachedpath+0x10e>
+      }
+      exit();
+    4f06:	e8 4e 23 00 00       	call   7259 <exit>
+    }
+    if(pid == 0){
+    4f0b:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    4f0f:	0f 85 ad 00 00 00    	jne    4fc2 <cachedpath+0x205>
+      for(i = 0; i < 100; i++){
+    4f15:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    4f1c:	e9 92 00 00 00       	jmp    4fb3 <cachedpath+0x1f6>
+        fd = open("cp/a/b/f", 0);
+    4f21:	83 ec 08             	sub    $0x8,%esp
+    4f24:	6a 00                	push   $0x0
+    4f26:	68 6d 8d 00 00       	push   $0x8d6d
+    4f2b:	e8 83 16 00 00       	call   65b3 <open>
+    4f30:	83 c4 10             	add    $0x10,%esp
+    4f33:	89 45 ec             	mov    %eax,-0x14(%ebp)
+        if(fd < 0 || read(fd, &c, 1) != 1 || c != 'x'){
+    4f36:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    4f3a:	78 21                	js     4f5d <cachedpath+0x1a0>
+    4f3c:	83 ec 04             	sub    $0x4,%esp
+    4f3f:	6a 01                	push   $0x1
+    4f41:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    4f44:	50                   	push   %eax
+    4f45:	ff 75 ec             	push   -0x14(%ebp)
+    4f48:	e8 1b 16 00 00       	call   6568 <read>
+    4f4d:	83 c4 10             	add    $0x10,%esp
+    4f50:	83 f8 01             	cmp    $0x1,%eax
+    4f53:	75 08                	jne    4f5d <cachedpath+0x1a0>
+    4f55:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    4f59:	3c 78                	cmp    $0x78,%al
+    4f5b:	74 17                	je     4f74 <cachedpath+0x1b7>
+          printf(1, "open cp/a/b/f failed\n");
+    4f5d:	83 ec 08             	sub    $0x8,%esp
+    4f60:	68 97 8d 00 00       	push   $0x8d97
+    4f65:	6a 01                	push   $0x1
+    4f67:	e8 51 18 00 00       	call   67bd <printf>
+    4f6c:	83 c4 10             	add    $0x10,%esp
+          exit();
+    4f6f:	e8 e5 22 00 00       	call   7259 <exit>
+        }
+        close(fd);
+    4f74:	83 ec 0c             	sub    $0xc,%esp
+    4f77:	ff 75 ec             	push   -0x14(%ebp)
+    4f7a:	e8 f2 22 00 00       	call   7271 <close>
+    4f7f:	83 c4 10             	add    $0x10,%esp
+        if(open("cp/a/b/f/x", 0) >= 0){
+    4f82:	83 ec 08             	sub    $0x8,%esp
+    4f85:	6a 00                	push   $0x0
+    4f87:	68 ad 8d 00 00       	push   $0x8dad
+    4f8c:	e8 22 16 00 00       	call   65b3 <open>
+    4f91:	83 c4 10             	add    $0x10,%esp
+    4f94:	85 c0                	test   %eax,%eax
+    4f96:	78 17                	js     4faf <cachedpath+0x1f2>
+          printf(1, "opened a file as a directory\n");
+    4f98:	83 ec 08             	sub    $0x8,%esp
+    4f9b:	68 b8 8d 00 00       	push   $0x8db8
+    4fa0:	6a 01                	push   $0x1
+    4fa2:	e8 16 18 00 00       	call   67bd <printf>
+    4fa7:	83 c4 10             	add    $0x10,%esp
+          exit();
+    4faa:	e8 aa 22 00 00       	call   7259 <exit>
+      for(i = 0; i < 100; i++){
+    4faf:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    4fb3:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+    4fb7:	0f 8e 64 ff ff ff    	jle    4f21 <cachedpath+0x164>
+        }
+      }
+      exit();
+    4fbd:	e8 97 22 00 00       	call   7259 <exit>
+  for(pi = 0; pi < 4; pi++){
+    4fc2:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    4fc6:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    4fca:	0f 8e c1 fe ff ff    	jle    4e91 <cachedpath+0xd4>
+    }
+  }
+  for(pi = 0; pi < 4; pi++)
+    4fd0:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    4fd7:	eb 09                	jmp    4fe2 <cachedpath+0x225>
+    wait();
+    4fd9:	e8 6c 15 00 00       	call   654a <wait>
+  for(pi = 0; pi < 4; pi++)
+    4fde:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    4fe2:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    4fe6:	7e f1                	jle    4fd9 <cachedpath+0x21c>
+
+  if(mkdir("cp/a/b/f/x") == 0){
+    4fe8:	83 ec 0c             	sub    $0xc,%esp
+    4feb:	68 ad 8d 00 00       	push   $0x8dad
+    4ff0:	e8 09 16 00 00       	call   65fe <mkdir>
+    4ff5:	83 c4 10             	add    $0x10,%esp
+    4ff8:	85 c0                	test   %eax,%eax
+    4ffa:	75 17                	jne    5013 <cachedpath+0x256>
+    printf(1, "mkdir under a file succeeded\n");
+    4ffc:	83 ec 08             	sub    $0x8,%esp
+    4fff:	68 d6 8d 00 00       	push   $0x8dd6
+    5004:	6a 01                	push   $0x1
+    5006:	e8 b2 17 00 00       	call   67bd <printf>
+    500b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    500e:	e8 46 22 00 00       	call   7259 <exit>
+  }
+  if(chdir("cp/a") < 0 || (fd = open("b/f", 0)) < 0){
+    5013:	83 ec 0c             	sub    $0xc,%esp
+    5016:	68 50 8d 00 00       	push   $0x8d50
+    501b:	e8 ed 15 00 00       	call   660d <chdir>
+    5020:	83 c4 10             	add    $0x10,%esp
+    5023:	85 c0                	test   %eax,%eax
+    5025:	78 1b                	js     5042 <cachedpath+0x285>
+    5027:	83 ec 08             	sub    $0x8,%esp
+    502a:	6a 00                	push   $0x0
+    502c:	68 f4 8d 00 00       	push   $0x8df4
+    5031:	e8 7d 15 00 00       	call   65b3 <open>
+    5036:	83 c4 10             	add    $0x10,%esp
+    5039:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    503c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    5040:	79 17                	jns    5059 <cachedpath+0x29c>
+    printf(1, "relative open of b/f failed\n");
+    5042:	83 ec 08             	sub    $0x8,%esp
+    5045:	68 f8 8d 00 00       	push   $0x8df8
+    504a:	6a 01                	push   $0x1
+    504c:	e8 6c 17 00 00       	call   67bd <printf>
+    5051:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5054:	e8 00 22 00 00       	call   7259 <exit>
+  }
+  close(fd);
+    5059:	83 ec 0c             	sub    $0xc,%esp
+    505c:	ff 75 ec             	push   -0x14(%ebp)
+    505f:	e8 0d 22 00 00       	call   7271 <close>
+    5064:	83 c4 10             	add    $0x10,%esp
+  if(chdir("../..") < 0){
+    5067:	83 ec 0c             	sub    $0xc,%esp
+    506a:	68 15 8e 00 00       	push   $0x8e15
+    506f:	e8 99 15 00 00       	call   660d <chdir>
+    5074:	83 c4 10             	add    $0x10,%esp
+    5077:	85 c0                	test   %eax,%eax
+    5079:	79 17                	jns    5092 <cachedpath+0x2d5>
+    printf(1, "chdir ../.. failed\n");
+    507b:	83 ec 08             	sub    $0x8,%esp
+    507e:	68 1b 8e 00 00       	push   $0x8e1b
+    5083:	6a 01                	push   $0x1
+    5085:	e8 33 17 00 00       	call   67bd <printf>
+    508a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    508d:	e8 c7 21 00 00       	call   7259 <exit>
+  }
+  if(unlink("cp/a/b/f") < 0){
+    5092:	83 ec 0c             	sub    $0xc,%esp
+    5095:	68 6d 8d 00 00       	push   $0x8d6d
+    509a:	e8 32 15 00 00       	call   65d1 <unlink>
+    509f:	83 c4 10             	add    $0x10,%esp
+    50a2:	85 c0                	test   %eax,%eax
+    50a4:	79 17                	jns    50bd <cachedpath+0x300>
+    printf(1, "unlink cp/a/b/f failed\n");
+    50a6:	83 ec 08             	sub    $0x8,%esp
+    50a9:	68 2f 8e 00 00       	push   $0x8e2f
+    50ae:	6a 01                	push   $0x1
+    50b0:	e8 08 17 00 00       	call   67bd <printf>
+    50b5:	83 c4 10             	add    $0x10,%esp
+    exit();
+    50b8:	e8 9c 21 00 00       	call   7259 <exit>
+  }
+  if(open("cp/a/b/f", 0) >= 0){
+    50bd:	83 ec 08             	sub    $0x8,%esp
+    50c0:	6a 00                	push   $0x0
+    50c2:	68 6d 8d 00 00       	push   $0x8d6d
+    50c7:	e8 e7 14 00 00       	call   65b3 <open>
+    50cc:	83 c4 10             	add    $0x10,%esp
+    50cf:	85 c0                	test   %eax,%eax
+    50d1:	78 17                	js     50ea <cachedpath+0x32d>
+    printf(1, "opened cp/a/b/f after unlink\n");
+    50d3:	83 ec 08             	sub    $0x8,%esp
+    50d6:	68 47 8e 00 00       	push   $0x8e47
+    50db:	6a 01                	push   $0x1
+    50dd:	e8 db 16 00 00       	call   67bd <printf>
+    50e2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    50e5:	e8 6f 21 00 00       	call   7259 <exit>
+  }
+  if(unlink("cp/a/b") < 0 || unlink("cp/a") < 0 || unlink("cp") < 0){
+    50ea:	83 ec 0c             	sub    $0xc,%esp
+    50ed:	68 55 8d 00 00       	push   $0x8d55
+    50f2:	e8 da 14 00 00       	call   65d1 <unlink>
+    50f7:	83 c4 10             	add    $0x10,%esp
+    50fa:	85 c0                	test   %eax,%eax
+    50fc:	78 28                	js     5126 <cachedpath+0x369>
+    50fe:	83 ec 0c             	sub    $0xc,%esp
+    5101:	68 50 8d 00 00       	push   $0x8d50
+    5106:	e8 c6 14 00 00       	call   65d1 <unlink>
+    510b:	83 c4 10             	add    $0x10,%esp
+    510e:	85 c0                	test   %eax,%eax
+    5110:	78 14                	js     5126 <cachedpath+0x369>
+    5112:	83 ec 0c             	sub    $0xc,%esp
+    5115:	68 4d 8d 00 00       	push   $0x8d4d
+    511a:	e8 b2 14 00 00       	call   65d1 <unlink>
+    511f:	83 c4 10             	add    $0x10,%esp
+    5122:	85 c0                	test   %eax,%eax
+    5124:	79 17                	jns    513d <cachedpath+0x380>
+    printf(1, "unlink cp failed\n");
+    5126:	83 ec 08             	sub    $0x8,%esp
+    5129:	68 65 8e 00 00       	push   $0x8e65
+    512e:	6a 01                	push   $0x1
+    5130:	e8 88 16 00 00       	call   67bd <printf>
+    5135:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5138:	e8 1c 21 00 00       	call   7259 <exit>
+  }
+  if(open("cp/a/b/f", 0) >= 0 || open("cp", 0) >= 0){
+    513d:	83 ec 08             	sub    $0x8,%esp
+    5140:	6a 00                	push   $0x0
+    5142:	68 6d 8d 00 00       	push   $0x8d6d
+    5147:	e8 67 14 00 00       	call   65b3 <open>
+    514c:	83 c4 10             	add    $0x10,%esp
+    514f:	85 c0                	test   %eax,%eax
+    5151:	79 16                	jns    5169 <cachedpath+0x3ac>
+    5153:	83 ec 08             	sub    $0x8,%esp
+    5156:	6a 00                	push   $0x0
+    5158:	68 4d 8d 00 00       	push   $0x8d4d
+    515d:	e8 51 14 00 00       	call   65b3 <open>
+    5162:	83 c4 10             	add    $0x10,%esp
+    5165:	85 c0                	test   %eax,%eax
+    5167:	78 17                	js     5180 <cachedpath+0x3c3>
+    printf(1, "opened cp after unlink\n");
+    5169:	83 ec 08             	sub    $0x8,%esp
+    516c:	68 77 8e 00 00       	push   $0x8e77
+    5171:	6a 01                	push   $0x1
+    5173:	e8 45 16 00 00       	call   67bd <printf>
+    5178:	83 c4 10             	add    $0x10,%esp
+    exit();
+    517b:	e8 d9 20 00 00       	call   7259 <exit>
+  }
+
+  printf(1, "cached path ok\n");
+    5180:	83 ec 08             	sub    $0x8,%esp
+    5183:	68 8f 8e 00 00       	push   $0x8e8f
+    5188:	6a 01                	push   $0x1
+    518a:	e8 2e 16 00 00       	call   67bd <printf>
+    518f:	83 c4 10             	add    $0x10,%esp
+}
+    5192:	90                   	nop
+    5193:	c9                   	leave
+    5194:	c3                   	ret
+
+00005195 <iref>:
+
+// test that iput() is called at the end of _namei()
+void
+iref(void)
+{
+    5195:	55                   	push   %ebp
+    5196:	89 e5                	mov    %esp,%ebp
+    5198:	83 ec 18             	sub    $0x18,%esp
+  int i, fd;
+
+  printf(1, "empty file name\n");
+    519b:	83 ec 08             	sub    $0x8,%esp
+    519e:	68 9f 8e 00 00       	push   $0x8e9f
+    51a3:	6a 01                	push   $0x1
+    51a5:	e8 13 16 00 00       	call   67bd <printf>
+    51aa:	83 c4 10             	add    $0x10,%esp
+
+  // the 50 is NINODE
+  for(i = 0; i < 50 + 1; i++){
+    51ad:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    51b4:	e9 e7 00 00 00       	jmp    52a0 <iref+0x10b>
+    if(mkdir("irefd") != 0){
+    51b9:	83 ec 0c             	sub    $0xc,%esp
+    51bc:	68 b0 8e 00 00       	push   $0x8eb0
+    51c1:	e8 38 14 00 00       	call   65fe <mkdir>
+    51c6:	83 c4 10             	add    $0x10,%esp
+    51c9:	85 c0                	test   %eax,%eax
+    51cb:	74 17                	je     51e4 <iref+0x4f>
+      printf(1, "mkdir irefd failed\n");
+    51cd:	83 ec 08             	sub    $0x8,%esp
+    51d0:	68 b6 8e 00 00       	push   $0x8eb6
+    51d5:	6a 01                	push   $0x1
+    51d7:	e8 e1 15 00 00       	call   67bd <printf>
+    51dc:	83 c4 10             	add    $0x10,%esp
+      exit();
+    51df:	e8 75 20 00 00       	call   7259 <exit>
+    }
+    if(chdir("irefd") != 0){
+    51e4:	83 ec 0c             	sub    $0xc,%esp
+    51e7:	68 b0 8e 00 00       	push   $0x8eb0
+    51ec:	e8 1c 14 00 00       	call   660d <chdir>
+    51f1:	83 c4 10             	add    $0x10,%esp
+    51f4:	85 c0                	test   %eax,%eax
+    51f6:	74 17                	je     520f <iref+0x7a>
+      printf(1, "chdir irefd failed\n");
+    51f8:	83 ec 08             	sub    $0x8,%esp
+    51fb:	68 ca 8e 00 00       	push   $0x8eca
+    5200:	6a 01                	push   $0x1
+    5202:	e8 b6 15 00 00       	call   67bd <printf>
+    5207:	83 c4 10             	add    $0x10,%esp
+      exit();
+    520a:	e8 4a 20 00 00       	call   7259 <exit>
+    }
+
+    mkdir("");
+    520f:	83 ec 0c             	sub    $0xc,%esp
+    5212:	68 de 8e 00 00       	push   $0x8ede
+    5217:	e8 e2 13 00 00       	call   65fe <mkdir>
+    521c:	83 c4 10             	add    $0x10,%esp
+    link("README", "");
+    521f:	83 ec 08             	sub    $0x8,%esp
+    5222:	68 de 8e 00 00       	push   $0x8ede
+    5227:	68 b9 8c 00 00       	push   $0x8cb9
+    522c:	e8 be 13 00 00       	call   65ef <link>
+    5231:	83 c4 10             	add    $0x10,%esp
+    fd = open("", O_CREATE);
+    5234:	83 ec 08             	sub    $0x8,%esp
+    5237:	68 00 02 00 00       	push   $0x200
+    523c:	68 de 8e 00 00       	push   $0x8ede
+    5241:	e8 6d 13 00 00       	call   65b3 <open>
+    5246:	83 c4 10             	add    $0x10,%esp
+    5249:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0)
+    524c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    5250:	78 0e                	js     5260 <iref+0xcb>
+      close(fd);
+    5252:	83 ec 0c             	sub    $0xc,%esp
+    5255:	ff 75 f0             	push   -0x10(%ebp)
+    5258:	e8 14 20 00 00       	call   7271 <close>
+    525d:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    5260:	83 ec 08             	sub    $0x8,%esp
+    5263:	68 00 02 00 00       	push   $0x200
+    5268:	68 df 8e 00 00       	push   $0x8edf
+    526d:	e8 41 13 00 00       	call   65b3 <open>
+    5272:	83 c4 10             	add    $0x10,%esp
+    5275:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0)
+    5278:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    527c:	78 0e                	js     528c <iref+0xf7>
+      close(fd);
+    527e:	83 ec 0c             	sub    $0xc,%esp
+    5281:	ff 75 f0             	push   -0x10(%ebp)
+    5284:	e8 e8 1f 00 00       	call   7271 <close>
+    5289:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    528c:	83 ec 0c             	sub    $0xc,%esp
+    528f:	68 df 8e 00 00       	push   $0x8edf
+    5294:	e8 38 13 00 00       	call   65d1 <unlink>
+    5299:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 50 + 1; i++){
+    529c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    52a0:	83 7d f4 32          	cmpl   $0x32,-0xc(%ebp)
+    52a4:	0f 8e 0f ff ff ff    	jle    51b9 <iref+0x24>
+  }
+
+  chdir("/");
+    52aa:	83 ec 0c             	sub    $0xc,%esp
+    52ad:	68 46 73 00 00       	push   $0x7346
+    52b2:	e8 56 13 00 00       	call   660d <chdir>
+    52b7:	83 c4 10             	add    $0x10,%esp
+  printf(1, "empty file name OK\n");
+    52ba:	83 ec 08             	sub    $0x8,%esp
+    52bd:	68 e2 8e 00 00       	push   $0x8ee2
+    52c2:	6a 01                	push   $0x1
+    52c4:	e8 f4 14 00 00       	call   67bd <printf>
+    52c9:	83 c4 10             	add    $0x10,%esp
+}
+    52cc:	90                   	nop
+    52cd:	c9                   	leave
+    52ce:	c3                   	ret
+
+000052cf <forktest>:
+// test that fork fails gracefully
+// the forktest binary also does this, but it runs out of proc entries first.
+// inside the bigger usertests binary, we run out of memory first.
+void
+forktest(void)
+{
+    52cf:	55                   	push   %ebp
+    52d0:	89 e5                	mov    %esp,%ebp
+    52d2:	83 ec 18             	sub    $0x18,%esp
+  int n, pid;
+
+  printf(1, "fork test\n");
+    52d5:	83 ec 08             	sub    $0x8,%esp
+    52d8:	68 f6 8e 00 00       	push   $0x8ef6
+    52dd:	6a 01                	push   $0x1
+    52df:	e8 d9 14 00 00       	call   67bd <printf>
+    52e4:	83 c4 10             	add    $0x10,%esp
+
+  for(n=0; n<1000; n++){
+    52e7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    52ee:	eb 1d                	jmp    530d <forktest+0x3e>
+    pid = fork();
+    52f0:	e8 24 1f 00 00       	call   7219 <fork>
+    52f5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pid < 0)
+    52f8:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    52fc:	78 1a                	js     5318 <forktest+0x49>
+      break;
+    if(pid == 0)
+    52fe:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    5302:	75 05                	jne    5309 <forktest+0x3a>
+      exit();
+    5304:	e8 50 1f 00 00       	call   7259 <exit>
+  for(n=0; n<1000; n++){
+    5309:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    530d:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+    5314:	7e da                	jle    52f0 <forktest+0x21>
+    5316:	eb 01                	jmp    5319 <forktest+0x4a>
+      break;
+    5318:	90                   	nop
+  }
+  
+  if(n == 1000){
+    5319:	81 7d f4 e8 03 00 00 	cmpl   $0x3e8,-0xc(%ebp)
+    5320:	75 3b                	jne    535d <forktest+0x8e>
+    printf(1, "fork claimed to work 1000 times!\n");
+    5322:	83 ec 08             	sub    $0x8,%esp
+    5325:	68 04 8f 00 00       	push   $0x8f04
+    532a:	6a 01                	push   $0x1
+    532c:	e8 8c 14 00 00       	call   67bd <printf>
+    5331:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5334:	e8 20 1f 00 00       	call   7259 <exit>
+  }
+  
+  for(; n > 0; n--){
+    if(wait() < 0){
+    5339:	e8 0c 12 00 00       	call   654a <wait>
+    533e:	85 c0                	test   %eax,%eax
+    5340:	79 17                	jns    5359 <forktest+0x8a>
+      printf(1, "wait stopped early\n");
+    5342:	83 ec 08             	sub    $0x8,%esp
+    5345:	68 98 79 00 00       	push   $0x7998
+    534a:	6a 01                	push   $0x1
+    534c:	e8 6c 14 00 00       	call   67bd <printf>
+    5351:	83 c4 10             	add    $0x10,%esp
+      exit();
+    5354:	e8 00 1f 00 00       	call   7259 <exit>
+  for(; n > 0; n--){
+    5359:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    535d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    5361:	7f d6                	jg     5339 <forktest+0x6a>
+    }
+  }
+  
+  if(wait() != -1){
+    5363:	e8 e2 11 00 00       	call   654a <wait>
+    5368:	83 f8 ff             	cmp    $0xffffffff,%eax
+    536b:	74 17                	je     5384 <forktest+0xb5>
+    printf(1, "wait got too many\n");
+    536d:	83 ec 08             	sub    $0x8,%esp
+    5370:	68 ac 79 00 00       	push   $0x79ac
+    5375:	6a 01                	push   $0x1
+    5377:	e8 41 14 00 00       	call   67bd <printf>
+    537c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    537f:	e8 d5 1e 00 00       	call   7259 <exit>
+  }
+  
+  printf(1, "fork test OK\n");
+    5384:	83 ec 08             	sub    $0x8,%esp
+    5387:	68 26 8f 00 00       	push   $0x8f26
+    538c:	6a 01                	push   $0x1
+    538e:	e8 2a 14 00 00       	call   67bd <printf>
+    5393:	83 c4 10             	add    $0x10,%esp
+}
+    5396:	90                   	nop
+    5397:	c9                   	leave
+    5398:	c3                   	ret
+
+00005399 <sbrktest>:
+
+void
+sbrktest(void)
+{
+    5399:	55                   	push   %ebp
+    539a:	89 e5                	mov    %esp,%ebp
+    539c:	83 ec 68             	sub    $0x68,%esp
+  int fds[2], pid, pids[10], ppid;
+  char *a, *b, *c, *lastaddr, *oldbrk, *p, scratch;
+  uint amt;
+
+  printf(stdout, "sbrk test\n");
+    539f:	a1 48 9e 00 00       	mov    0x9e48,%eax
+    53a4:	83 ec 08             	sub    $0x8,%esp
+    53a7:	68 34 8f 00 00       	push   $0x8f34
+    53ac:	50                   	push   %eax
+    53ad:	e8 0b 14 00 00       	call   67bd <printf>
+    53b2:	83 c4 10             	add    $0x10,%esp
+  oldbrk = sbrk(0);
+    53b5:	83 ec 0c             	sub    $0xc,%esp
+    53b8:	6a 00                	push   $0x0
+    53ba:	e8 7b 12 00 00       	call   663a <sbrk>
+    53bf:	83 c4 10             	add    $0x10,%esp
+    53c2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+
+  // can one sbrk() less than a page?
+  a = sbrk(0);
+    53c5:	83 ec 0c             	sub    $0xc,%esp
+    53c8:	6a 00                	push   $0x0
+    53ca:	e8 6b 12 00 00       	call   663a <sbrk>
+    53cf:	83 c4 10             	add    $0x10,%esp
+    53d2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  int i;
+  for(i = 0; i < 5000; i++){ 
+    53d5:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    53dc:	eb 4f                	jmp    542d <sbrktest+0x94>
+    b = sbrk(1);
+    53de:	83 ec 0c             	sub    $0xc,%esp
+    53e1:	6a 01                	push   $0x1
+    53e3:	e8 52 12 00 00       	call   663a <sbrk>
+    53e8:	83 c4 10             	add    $0x10,%esp
+    53eb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    if(b != a){
+    53ee:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    53f1:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    53f4:	74 24                	je     541a <sbrktest+0x81>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    53f6:	a1 48 9e 00 00       	mov    0x9e48,%eax
+    53fb:	83 ec 0c             	sub    $0xc,%esp
+    53fe:	ff 75 d0             	push   -0x30(%ebp)
+    5401:	ff 75 f4             	push   -0xc(%ebp)
+    5404:	ff 75 f0             	push   -0x10(%ebp)
+    5407:	68 3f 8f 00 00       	push   $0x8f3f
+    540c:	50                   	push   %eax
+    540d:	e8 ab 13 00 00       	call   67bd <printf>
+    5412:	83 c4 20             	add    $0x20,%esp
+      exit();
+    5415:	e8 3f 1e 00 00       	call   7259 <exit>
+    }
+    *b = 1;
+    541a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    541d:	c6 00 01             	movb   $0x1,(%eax)
+    a = b + 1;
+    5420:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    5423:	83 c0 01             	add    $0x1,%eax
+    5426:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  for(i = 0; i < 5000; i++){ 
+    5429:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    542d:	81 7d f0 87 13 00 00 	cmpl   $0x1387,-0x10(%ebp)
+    5434:	7e a8                	jle    53de <sbrktest+0x45>
+  }
+  pid = fork();
+    5436:	e8 de 1d 00 00       	call   7219 <fork>
+    543b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(pid < 0){
+    543e:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    5442:	79 1b                	jns    545f <sbrktest+0xc6>
+    printf(stdout, "sbrk test fork failed\n");
+    5444:	a1 48 9e 00 00       	mov    0x9e48,%eax
+    5449:	83 ec 08             	sub    $0x8,%esp
+    544c:	68 5a 8f 00 00       	push   $0x8f5a
+    5451:	50                   	push   %eax
+    5452:	e8 66 13 00 00       	call   67bd <printf>
+    5457:	83 c4 10             	add    $0x10,%esp
+    exit();
+    545a:	e8 fa 1d 00 00       	call   7259 <exit>
+  }
+  c = sbrk(1);
+    545f:	83 ec 0c             	sub    $0xc,%esp
+    5462:	6a 01                	push   $0x1
+    5464:	e8 d1 11 00 00       	call   663a <sbrk>
+    5469:	83 c4 10             	add    $0x10,%esp
+    546c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  c = sbrk(1);
+    546f:	83 ec 0c             	sub    $0xc,%esp
+    5472:	6a 01                	push   $0x1
+    5474:	e8 c1 11 00 00       	call   663a <sbrk>
+    5479:	83 c4 10             	add    $0x10,%esp
+    547c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a + 1){
+    547f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5482:	83 c0 01             	add    $0x1,%eax
+    5485:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    5488:	74 1b                	je     54a5 <sbrktest+0x10c>
+    printf(stdout, "sbrk test failed post-fork\n");
+    548a:	a1 48 9e 00 00       	mov    0x9e48,%eax
+    548f:	83 ec 08             	sub    $0x8,%esp
+    5492:	68 71 8f 00 00       	push   $0x8f71
+    5497:	50                   	push   %eax
+    5498:	e8 20 13 00 00       	call   67bd <printf>
+    549d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    54a0:	e8 b4 1d 00 00       	call   7259 <exit>
+  }
+  if(pid == 0)
+    54a5:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    54a9:	75 05                	jne    54b0 <sbrktest+0x117>
+    exit();
+    54ab:	e8 a9 1d 00 00       	call   7259 <exit>
+  wait();
+    54b0:	e8 95 10 00 00       	call   654a <wait>
+
+  // can one grow address space to something big?
+#define BIG (100*1024*1024)
+  a = sbrk(0);
+    54b5:	83 ec 0c             	sub    $0xc,%esp
+    54b8:	6a 00                	push   $0x0
+    54ba:	e8 7b 11 00 00       	call   663a <sbrk>
+    54bf:	83 c4 10             	add    $0x10,%esp
+    54c2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  amt = (BIG) - (uint)a;
+    54c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    54c8:	ba 00 00 40 06       	mov    $0x6400000,%edx
+    54cd:	29 c2                	sub    %eax,%edx
+    54cf:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  p = sbrk(amt);
+    54d2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    54d5:	83 ec 0c             	sub    $0xc,%esp
+    54d8:	50                   	push   %eax
+    54d9:	e8 5c 11 00 00       	call   663a <sbrk>
+    54de:	83 c4 10             	add    $0x10,%esp
+    54e1:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  if (p != a) { 
+    54e4:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    54e7:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    54ea:	74 1b                	je     5507 <sbrktest+0x16e>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    54ec:	a1 48 9e 00 00       	mov    0x9e48,%eax
+    54f1:	83 ec 08             	sub    $0x8,%esp
+    54f4:	68 90 8f 00 00       	push   $0x8f90
+    54f9:	50                   	push   %eax
+    54fa:	e8 be 12 00 00       	call   67bd <printf>
+    54ff:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5502:	e8 52 1d 00 00       	call   7259 <exit>
+  }
+  lastaddr = (char*) (BIG-1);
+    5507:	c7 45 d8 ff ff 3f 06 	movl   $0x63fffff,-0x28(%ebp)
+  *lastaddr = 99;
+    550e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    5511:	c6 00 63             	movb   $0x63,(%eax)
+
+  // can one de-allocate?
+  a = sbrk(0);
+    5514:	83 ec 0c             	sub    $0xc,%esp
+    5517:	6a 00                	push   $0x0
+    5519:	e8 1c 11 00 00       	call   663a <sbrk>
+    551e:	83 c4 10             	add    $0x10,%esp
+    5521:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  c = sbrk(-4096);
+    5524:	83 ec 0c             	sub    $0xc,%esp
+    5527:	68 00 f0 ff ff       	push   $0xfffff000
+    552c:	e8 09 11 00 00       	call   663a <sbrk>
+    5531:	83 c4 10             	add    $0x10,%esp
+    5534:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c == (char*)0xffffffff){
+    5537:	83 7d e4 ff          	cmpl   $0xffffffff,-0x1c(%ebp)
+    553b:	75 1b                	jne    5558 <sbrktest+0x1bf>
+    printf(stdout, "sbrk could not deallocate\n");
+    553d:	a1 48 9e 00 00       	mov    0x9e48,%eax
+    5542:	83 ec 08             	sub    $0x8,%esp
+    5545:	68 ce 8f 00 00       	push   $0x8fce
+    554a:	50                   	push   %eax
+    554b:	e8 6d 12 00 00       	call   67bd <printf>
+    5550:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5553:	e8 01 1d 00 00       	call   7259 <exit>
+  }
+  c = sbrk(0);
+    5558:	83 ec 0c             	sub    $0xc,%esp
+    555b:	6a 00                	push   $0x0
+    555d:	e8 d8 10 00 00       	call   663a <sbrk>
+    5562:	83 c4 10             	add    $0x10,%esp
+    5565:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a - 4096){
+    5568:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    556b:	2d 00 10 00 00       	sub    $0x1000,%eax
+    5570:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    5573:	74 1e                	je     5593 <sbrktest+0x1fa>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    5575:	a1 48 9e 00 00       	mov    0x9e48,%eax
+    557a:	ff 75 e4             	push   -0x1c(%ebp)
+    557d:	ff 75 f4             	push   -0xc(%ebp)
+    5580:	68 ec 8f 00 00       	push   $0x8fec
+    5585:	50                   	push   %eax
+    5586:	e8 32 12 00 00       	call   67bd <printf>
+    558b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    558e:	e8 c6 1c 00 00       	call   7259 <exit>
+  }
+
+  // can one re-allocate that page?
+  a = sbrk(0);
+    5593:	83 ec 0c             	sub    $0xc,%esp
+    5596:	6a 00                	push   $0x0
+    5598:	e8 9d 10 00 00       	call   663a <sbrk>
+    559d:	83 c4 10             	add    $0x10,%esp
+    55a0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  c = sbrk(4096);
+    55a3:	83 ec 0c             	sub    $0xc,%esp
+    55a6:	68 00 10 00 00       	push   $0x1000
+    55ab:	e8 8a 10 00 00       	call   663a <sbrk>
+    55b0:	83 c4 10             	add    $0x10,%esp
+    55b3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a || sbrk(0) != a + 4096){
+    55b6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    55b9:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    55bc:	75 1a                	jne    55d8 <sbrktest+0x23f>
+    55be:	83 ec 0c             	sub    $0xc,%esp
+    55c1:	6a 00                	push   $0x0
+    55c3:	e8 72 10 00 00       	call   663a <sbrk>
+    55c8:	83 c4 10             	add    $0x10,%esp
+    55cb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    55ce:	81 c2 00 10 00 00    	add    $0x1000,%edx
+    55d4:	39 d0                	cmp    %edx,%eax
+    55d6:	74 1e                	je     55f6 <sbrktest+0x25d>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    55d8:	a1 48 9e 00 00       	mov    0x9e48,%eax
+    55dd:	ff 75 e4             	push   -0x1c(%ebp)
+    55e0:	ff 75 f4             	push   -0xc(%ebp)
+    55e3:	68 24 90 00 00       	push   $0x9024
+    55e8:	50                   	push   %eax
+    55e9:	e8 cf 11 00 00       	call   67bd <printf>
+    55ee:	83 c4 10             	add    $0x10,%esp
+    exit();
+    55f1:	e8 63 1c 00 00       	call   7259 <exit>
+  }
+  if(*lastaddr == 99){
+    55f6:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    55f9:	0f b6 00             	movzbl (%eax),%eax
+    55fc:	3c 63                	cmp    $0x63,%al
+    55fe:	75 1b                	jne    561b <sbrktest+0x282>
+    // should be zero
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    5600:	a1 48 9e 00 00       	mov    0x9e48,%eax
+    5605:	83 ec 08             	sub    $0x8,%esp
+    5608:	68 4c 90 00 00       	push   $0x904c
+    560d:	50                   	push   %eax
+    560e:	e8 aa 11 00 00       	call   67bd <printf>
+    5613:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5616:	e8 3e 1c 00 00       	call   7259 <exit>
+  }
+
+  a = sbrk(0);
+    561b:	83 ec 0c             	sub    $0xc,%esp
+    561e:	6a 00                	push   $0x0
+    5620:	e8 15 10 00 00       	call   663a <sbrk>
+    5625:	83 c4 10             	add    $0x10,%esp
+    5628:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  c = sbrk(-(sbrk(0) - oldbrk));
+    562b:	83 ec 0c             	sub    $0xc,%esp
+    562e:	6a 00                	push   $0x0
+    5630:	e8 05 10 00 00       	call   663a <sbrk>
+    5635:	83 c4 10             	add    $0x10,%esp
+    5638:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    563b:	29 c2                	sub    %eax,%edx
+    563d:	83 ec 0c             	sub    $0xc,%esp
+    5640:	52                   	push   %edx
+    5641:	e8 f4 0f 00 00       	call   663a <sbrk>
+    5646:	83 c4 10             	add    $0x10,%esp
+    5649:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a){
+    564c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    564f:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    5652:	74 1e                	je     5672 <sbrktest+0x2d9>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    5654:	a1 48 9e 00 00       	mov    0x9e48,%eax
+    5659:	ff 75 e4             	push   -0x1c(%ebp)
+    565c:	ff 75 f4             	push   -0xc(%ebp)
+    565f:	68 7c 90 00 00       	push   $0x907c
+    5664:	50                   	push   %eax
+    5665:	e8 53 11 00 00       	call   67bd <printf>
+    566a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    566d:	e8 e7 1b 00 00       	call   7259 <exit>
+  }
+  
+  // can we read the kernel's memory?
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    5672:	c7 45 f4 00 00 00 80 	movl   $0x80000000,-0xc(%ebp)
+    5679:	eb 76                	jmp    56f1 <sbrktest+0x358>
+    ppid = getpid();
+    567b:	e8 ab 0f 00 00       	call   662b <getpid>
+    5680:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    pid = fork();
+    5683:	e8 91 1b 00 00       	call   7219 <fork>
+    5688:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    568b:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    568f:	79 1b                	jns    56ac <sbrktest+0x313>
+      printf(stdout, "fork failed\n");
+    5691:	a1 48 9e 00 00       	mov    0x9e48,%eax
+    5696:	83 ec 08             	sub    $0x8,%esp
+    5699:	68 75 73 00 00       	push   $0x7375
+    569e:	50                   	push   %eax
+    569f:	e8 19 11 00 00       	call   67bd <printf>
+    56a4:	83 c4 10             	add    $0x10,%esp
+      exit();
+    56a7:	e8 ad 1b 00 00       	call   7259 <exit>
+    }
+    if(pid == 0){
+    56ac:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    56b0:	75 33                	jne    56e5 <sbrktest+0x34c>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    56b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    56b5:	0f b6 00             	movzbl (%eax),%eax
+    56b8:	0f be d0             	movsbl %al,%edx
+    56bb:	a1 48 9e 00 00       	mov    0x9e48,%eax
+    56c0:	52                   	push   %edx
+    56c1:	ff 75 f4             	push   -0xc(%ebp)
+    56c4:	68 9d 90 00 00       	push   $0x909d
+    56c9:	50                   	push   %eax
+    56ca:	e8 ee 10 00 00       	call   67bd <printf>
+    56cf:	83 c4 10             	add    $0x10,%esp
+      kill(ppid);
+    56d2:	83 ec 0c             	sub    $0xc,%esp
+    56d5:	ff 75 d4             	push   -0x2c(%ebp)
+    56d8:	e8 b8 0e 00 00       	call   6595 <kill>
+    56dd:	83 c4 10             	add    $0x10,%esp
+      exit();
+    56e0:	e8 74 1b 00 00       	call   7259 <exit>
+    }
+    wait();
+    56e5:	e8 60 0e 00 00       	call   654a <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    56ea:	81 45 f4 50 c3 00 00 	addl   $0xc350,-0xc(%ebp)
+    56f1:	81 7d f4 7f 84 1e 80 	cmpl   $0x801e847f,-0xc(%ebp)
+    56f8:	76 81                	jbe    567b <sbrktest+0x2e2>
+  }
+
+  // if we run the system out of memory, does it clean up the last
+  // failed allocation?
+  if(pipe(fds) != 0){
+    56fa:	83 ec 0c             	sub    $0xc,%esp
+    56fd:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    5700:	50                   	push   %eax
+    5701:	e8 53 0e 00 00       	call   6559 <pipe>
+    5706:	83 c4 10             	add    $0x10,%esp
+    5709:	85 c0                	test   %eax,%eax
+    570b:	74 17                	je     5724 <sbrktest+0x38b>
+    printf(1, "pipe() failed\n");
+    570d:	83 ec 08             	sub    $0x8,%esp
+    5710:	68 46 77 00 00       	push   $0x7746
+    5715:	6a 01                	push   $0x1
+    5717:	e8 a1 10 00 00       	call   67bd <printf>
+    571c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    571f:	e8 35 1b 00 00       	call   7259 <exit>
+  }
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    5724:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    572b:	e9 86 00 00 00       	jmp    57b6 <sbrktest+0x41d>
+    if((pids[i] = fork()) == 0){
+    5730:	e8 e4 1a 00 00       	call   7219 <fork>
+    5735:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    5738:	89 44 95 a0          	mov    %eax,-0x60(%ebp,%edx,4)
+    573c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    573f:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    5743:	85 c0                	test   %eax,%eax
+    5745:	75 4a                	jne    5791 <sbrktest+0x3f8>
+      // allocate a lot of memory
+      sbrk(BIG - (uint)sbrk(0));
+    5747:	83 ec 0c             	sub    $0xc,%esp
+    574a:	6a 00                	push   $0x0
+    574c:	e8 e9 0e 00 00       	call   663a <sbrk>
+    5751:	83 c4 10             	add    $0x10,%esp
+    5754:	89 c2                	mov    %eax,%edx
+    5756:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    575b:	29 d0                	sub    %edx,%eax
+    575d:	83 ec 0c             	sub    $0xc,%esp
+    5760:	50                   	push   %eax
+    5761:	e8 d4 0e 00 00       	call   663a <sbrk>
+    5766:	83 c4 10             	add    $0x10,%esp
+      write(fds[1], "x", 1);
+    5769:	8b 45 cc             	mov    -0x34(%ebp),%eax
+    576c:	83 ec 04             	sub    $0x4,%esp
+    576f:	6a 01                	push   $0x1
+    5771:	68 9a 78 00 00       	push   $0x789a
+    5776:	50                   	push   %eax
+    5777:	e8 fb 0d 00 00       	call   6577 <write>
+    577c:	83 c4 10             	add    $0x10,%esp
+      // sit around until killed
+      for(;;) sleep(1000);
+    577f:	83 ec 0c             	sub    $0xc,%esp
+    5782:	68 e8 03 00 00       	push   $0x3e8
+    5787:	e8 bd 0e 00 00       	call   6649 <sleep>
+    578c:	83 c4 10             	add    $0x10,%esp
+    578f:	eb ee                	jmp    577f <sbrktest+0x3e6>
+    }
+    if(pids[i] != -1)
+    5791:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5794:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    5798:	83 f8 ff             	cmp    $0xffffffff,%eax
+    579b:	74 15                	je     57b2 <sbrktest+0x419>
+      read(fds[0], &scratch, 1);
+    579d:	8b 45 c8             	mov    -0x38(%ebp),%eax
+    57a0:	83 ec 04             	sub    $0x4,%esp
+    57a3:	6a 01                	push   $0x1
+    57a5:	8d 55 9f             	lea    -0x61(%ebp),%edx
+    57a8:	52                   	push   %edx
+    57a9:	50                   	push   %eax
+    57aa:	e8 b9 0d 00 00       	call   6568 <read>
+    57af:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    57b2:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    57b6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    57b9:	83 f8 09             	cmp    $0x9,%eax
+    57bc:	0f 86 6e ff ff ff    	jbe    5730 <sbrktest+0x397>
+  }
+  // if those failed allocations freed up the pages they did allocate,
+  // we'll be able to allocate here
+  c = sbrk(4096);
+    57c2:	83 ec 0c             	sub    $0xc,%esp
+    57c5:	68 00 10 00 00       	push   $0x1000
+    57ca:	e8 6b 0e 00 00       	call   663a <sbrk>
+    57cf:	83 c4 10             	add    $0x10,%esp
+    57d2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    57d5:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    57dc:	eb 2b                	jmp    5809 <sbrktest+0x470>
+    if(pids[i] == -1)
+    57de:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    57e1:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    57e5:	83 f8 ff             	cmp    $0xffffffff,%eax
+    57e8:	74 1a                	je     5804 <sbrktest+0x46b>
+      continue;
+    kill(pids[i]);
+    57ea:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    57ed:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    57f1:	83 ec 0c             	sub    $0xc,%esp
+    57f4:	50                   	push   %eax
+    57f5:	e8 9b 0d 00 00       	call   6595 <kill>
+    57fa:	83 c4 10             	add    $0x10,%esp
+    wait();
+    57fd:	e8 48 0d 00 00       	call   654a <wait>
+    5802:	eb 01                	jmp    5805 <sbrktest+0x46c>
+      continue;
+    5804:	90                   	nop
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    5805:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    5809:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    580c:	83 f8 09             	cmp    $0x9,%eax
+    580f:	76 cd                	jbe    57de <sbrktest+0x445>
+  }
+  if(c == (char*)0xffffffff){
+    5811:	83 7d e4 ff          	cmpl   $0xffffffff,-0x1c(%ebp)
+    5815:	75 1b                	jne    5832 <sbrktest+0x499>
+    printf(stdout, "failed sbrk leaked memory\n");
+    5817:	a1 48 9e 00 00       	mov    0x9e48,%eax
+    581c:	83 ec 08             	sub    $0x8,%esp
+    581f:	68 b6 90 00 00       	push   $0x90b6
+    5824:	50                   	push   %eax
+    5825:	e8 93 0f 00 00       	call   67bd <printf>
+    582a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    582d:	e8 27 1a 00 00       	call   7259 <exit>
+  }
+
+  if(sbrk(0) > oldbrk)
+    5832:	83 ec 0c             	sub    $0xc,%esp
+    5835:	6a 00                	push   $0x0
+    5837:	e8 fe 0d 00 00       	call   663a <sbrk>
+    583c:	83 c4 10             	add    $0x10,%esp
+    583f:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    5842:	73 1e                	jae    5862 <sbrktest+0x4c9>
+    sbrk(-(sbrk(0) - oldbrk));
+    5844:	83 ec 0c             	sub    $0xc,%esp
+    5847:	6a 00                	push   $0x0
+    5849:	e8 ec 0d 00 00       	call   663a <sbrk>
+    584e:	83 c4 10             	add    $0x10,%esp
+    5851:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    5854:	29 c2                	sub    %eax,%edx
+    5856:	83 ec 0c             	sub    $0xc,%esp
+    5859:	52                   	push   %edx
+    585a:	e8 db 0d 00 00       	call   663a <sbrk>
+    585f:	83 c4 10             	add    $0x10,%esp
+
+  printf(stdout, "sbrk test OK\n");
+    5862:	a1 48 9e 00 00       	mov    0x9e48,%eax
+    5867:	83 ec 08             	sub    $0x8,%esp
+    586a:	68 d1 90 00 00       	push   $0x90d1
+    586f:	50                   	push   %eax
+    5870:	e8 48 0f 00 00       	call   67bd <printf>
+    5875:	83 c4 10             	add    $0x10,%esp
+}
+    5878:	90                   	nop
+    5879:	c9                   	leave
+    587a:	c3                   	ret
+
+0000587b <validateint>:
+
+void
+validateint(int *p)
+{
+    587b:	55                   	push   %ebp
+    587c:	89 e5                	mov    %esp,%ebp
+    587e:	53                   	push   %ebx
+    587f:	83 ec 10             	sub    $0x10,%esp
+  int res;
+  asm("mov %%esp, %%ebx\n\t"
+    5882:	b8 0d 00 00 00       	mov    $0xd,%eax
+    5887:	8b 55 08             	mov    0x8(%ebp),%edx
+    588a:	89 d1                	mov    %edx,%ecx
+    588c:	89 e3                	mov    %esp,%ebx
+    588e:	89 cc                	mov    %ecx,%esp
+    5890:	cd 40                	int    $0x40
+    5892:	89 dc                	mov    %ebx,%esp
+    5894:	89 45 f8             	mov    %eax,-0x8(%ebp)
+      "int %2\n\t"
+      "mov %%ebx, %%esp" :
+      "=a" (res) :
+      "a" (SYS_sleep), "n" (T_SYSCALL), "c" (p) :
+      "ebx");
+}
+    5897:	90                   	nop
+    5898:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    589b:	c9                   	leave
+    589c:	c3                   	ret
+
+0000589d <validatetest>:
+
+void
+validatetest(void)
+{
+    589d:	55                   	push   %ebp
+    589e:	89 e5                	mov    %esp,%ebp
+    58a0:	83 ec 18             	sub    $0x18,%esp
+  int hi, pid;
+  uint p;
+
+  printf(stdout, "validate test\n");
+    58a3:	a1 48 9e 00 00       	mov    0x9e48,%eax
+    58a8:	83 ec 08             	sub    $0x8,%esp
+    58ab:	68 df 90 00 00       	push   $0x90df
+    58b0:	50                   	push   %eax
+    58b1:	e8 07 0f 00 00       	call   67bd <printf>
+    58b6:	83 c4 10             	add    $0x10,%esp
+  hi = 1100*1024;
+    58b9:	c7 45 f0 00 30 11 00 	movl   $0x113000,-0x10(%ebp)
+
+  for(p = 0; p <= (uint)hi; p += 4096){
+    58c0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    58c7:	e9 8a 00 00 00       	jmp    5956 <validatetest+0xb9>
+    if((pid = fork()) == 0){
+    58cc:	e8 48 19 00 00       	call   7219 <fork>
+    58d1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    58d4:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    58d8:	75 14                	jne    58ee <validatetest+0x51>
+      // try to crash the kernel by passing in a badly placed integer
+      validateint((int*)p);
+    58da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    58dd:	83 ec 0c             	sub    $0xc,%esp
+    58e0:	50                   	push   %eax
+    58e1:	e8 95 ff ff ff       	call   587b <validateint>
+    58e6:	83 c4 10             	add    $0x10,%esp
+      exit();
+    58e9:	e8 6b 19 00 00       	call   7259 <exit>
+    }
+    sleep(0);
+    58ee:	83 ec 0c             	sub    $0xc,%esp
+    58f1:	6a 00                	push   $0x0
+    58f3:	e8 51 0d 00 00       	call   6649 <sleep>
+    58f8:	83 c4 10             	add    $0x10,%esp
+    sleep(0);
+    58fb:	83 ec 0c             	sub    $0xc,%esp
+    58fe:	6a 00                	push   $0x0
+    5900:	e8 44 0d 00 00       	call   6649 <sleep>
+    5905:	83 c4 10             	add    $0x10,%esp
+    kill(pid);
+    5908:	83 ec 0c             	sub    $0xc,%esp
+    590b:	ff 75 ec             	push   -0x14(%ebp)
+    590e:	e8 82 0c 00 00       	call   6595 <kill>
+    5913:	83 c4 10             	add    $0x10,%esp
+    wait();
+    5916:	e8 2f 0c 00 00       	call   654a <wait>
+
+    // try to crash the kernel by passing in a bad string pointer
+    if(link("nosuchfile", (char*)p) != -1){
+    591b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    591e:	83 ec 08             	sub    $0x8,%esp
+    5921:	50                   	push   %eax
+    5922:	68 ee 90 00 00       	push   $0x90ee
+    5927:	e8 c3 0c 00 00       	call   65ef <link>
+    592c:	83 c4 10             	add    $0x10,%esp
+    592f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    5932:	74 1b                	je     594f <validatetest+0xb2>
+      printf(stdout, "link should not succeed\n");
+    5934:	a1 48 9e 00 00       	mov    0x9e48,%eax
+    5939:	83 ec 08             	sub    $0x8,%esp
+    593c:	68 f9 90 00 00       	push   $0x90f9
+    5941:	50                   	push   %eax
+    5942:	e8 76 0e 00 00       	call   67bd <printf>
+    5947:	83 c4 10             	add    $0x10,%esp
+      exit();
+    594a:	e8 0a 19 00 00       	call   7259 <exit>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    594f:	81 45 f4 00 10 00 00 	addl   $0x1000,-0xc(%ebp)
+    5956:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5959:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    595c:	0f 83 6a ff ff ff    	jae    58cc <validatetest+0x2f>
+    }
+  }
+
+  printf(stdout, "validate ok\n");
+    5962:	a1 48 9e 00 00       	mov    0x9e48,%eax
+    5967:	83 ec 08             	sub    $0x8,%esp
+    596a:	68 12 91 00 00       	push   $0x9112
+    596f:	50                   	push   %eax
+    5970:	e8 48 0e 00 00       	call   67bd <printf>
+    5975:	83 c4 10             	add    $0x10,%esp
+}
+    5978:	90                   	nop
+    5979:	c9                   	leave
+    597a:	c3                   	ret
+
+0000597b <bsstest>:
+
+// does unintialized data start out zero?
+char uninit[10000];
+void
+bsstest(void)
+{
+    597b:	55                   	push   %ebp
+    597c:	89 e5                	mov    %esp,%ebp
+    597e:	83 ec 18             	sub    $0x18,%esp
+  int i;
+
+  printf(stdout, "bss test\n");
+    5981:	a1 48 9e 00 00       	mov    0x9e48,%eax
+    5986:	83 ec 08             	sub    $0x8,%esp
+    5989:	68 1f 91 00 00       	push   $0x911f
+    598e:	50                   	push   %eax
+    598f:	e8 29 0e 00 00       	call   67bd <printf>
+    5994:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    5997:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    599e:	eb 2e                	jmp    59ce <bsstest+0x53>
+    if(uninit[i] != '\0'){
+    59a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    59a3:	05 a0 be 00 00       	add    $0xbea0,%eax
+    59a8:	0f b6 00             	movzbl (%eax),%eax
+    59ab:	84 c0                	test   %al,%al
+    59ad:	74 1b                	je     59ca <bsstest+0x4f>
+      printf(stdout, "bss test failed\n");
+    59af:	a1 48 9e 00 00       	mov    0x9e48,%eax
+    59b4:	83 ec 08             	sub    $0x8,%esp
+    59b7:	68 29 91 00 00       	push   $0x9129
+    59bc:	50                   	push   %eax
+    59bd:	e8 fb 0d 00 00       	call   67bd <printf>
+    59c2:	83 c4 10             	add    $0x10,%esp
+      exit();
+    59c5:	e8 8f 18 00 00       	call   7259 <exit>
+  for(i = 0; i < sizeof(uninit); i++){
+    59ca:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    59ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    59d1:	3d 0f 27 00 00       	cmp    $0x270f,%eax
+    59d6:	76 c8                	jbe    59a0 <bsstest+0x25>
+    }
+  }
+  printf(stdout, "bss test ok\n");
+    59d8:	a1 48 9e 00 00       	mov    0x9e48,%eax
+    59dd:	83 ec 08             	sub    $0x8,%esp
+    59e0:	68 3a 91 00 00       	push   $0x913a
+    59e5:	50                   	push   %eax
+    59e6:	e8 d2 0d 00 00       	call   67bd <printf>
+    59eb:	83 c4 10             	add    $0x10,%esp
+}
+    59ee:	90                   	nop
+    59ef:	c9                   	leave
+    59f0:	c3                   	ret
+
+000059f1 <bigargtest>:
+// does exec return an error if the arguments
+// are larger than a page? or does it write
+// below the stack and wreck the instructions/data?
+void
+bigargtest(void)
+{
+    59f1:	55                   	push   %ebp
+    59f2:	89 e5                	mov    %esp,%ebp
+    59f4:	83 ec 18             	sub    $0x18,%esp
+  int pid, fd;
+
+  unlink("bigarg-ok");
+    59f7:	83 ec 0c             	sub    $0xc,%esp
+    59fa:	68 47 91 00 00       	push   $0x9147
+    59ff:	e8 cd 0b 00 00       	call   65d1 <unlink>
+    5a04:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    5a07:	e8 0d 18 00 00       	call   7219 <fork>
+    5a0c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid == 0){
+    5a0f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    5a13:	0f 85 97 00 00 00    	jne    5ab0 <bigargtest+0xbf>
+    static char *args[MAXARG];
+    int i;
+    for(i = 0; i < MAXARG-1; i++)
+    5a19:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    5a20:	eb 12                	jmp    5a34 <bigargtest+0x43>
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    5a22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5a25:	c7 04 85 60 f4 00 00 	movl   $0x9154,0xf460(,%eax,4)
+    5a2c:	54 91 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    5a30:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    5a34:	83 7d f4 1e          	cmpl   $0x1e,-0xc(%ebp)
+    5a38:	7e e8                	jle    5a22 <bigargtest+0x31>
+    args[MAXARG-1] = 0;
+    5a3a:	c7 05 dc f4 00 00 00 	movl   $0x0,0xf4dc
+    5a41:	00 00 00 
+    printf(stdout, "bigarg test\n");
+    5a44:	a1 48 9e 00 00       	mov    0x9e48,%eax
+    5a49:	83 ec 08             	sub    $0x8,%esp
+    5a4c:	68 31 92 00 00       	push   $0x9231
+    5a51:	50                   	push   %eax
+    5a52:	e8 66 0d 00 00       	call   67bd <printf>
+    5a57:	83 c4 10             	add    $0x10,%esp
+    exec("echo", args);
+    5a5a:	83 ec 08             	sub    $0x8,%esp
+    5a5d:	68 60 f4 00 00       	push   $0xf460
+    5a62:	68 d4 72 00 00       	push   $0x72d4
+    5a67:	e8 c7 17 00 00       	call   7233 <exec>
+    5a6c:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "bigarg test ok\n");
+    5a6f:	a1 48 9e 00 00       	mov    0x9e48,%eax
+    5a74:	83 ec 08             	sub    $0x8,%esp
+    5a77:	68 3e 92 00 00       	push   $0x923e
+    5a7c:	50                   	push   %eax
+    5a7d:	e8 3b 0d 00 00       	call   67bd <printf>
+    5a82:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigarg-ok", O_CREATE);
+    5a85:	83 ec 08             	sub    $0x8,%esp
+    5a88:	68 00 02 00 00       	push   $0x200
+    5a8d:	68 47 91 00 00       	push   $0x9147
+    5a92:	e8 1c 0b 00 00       	call   65b3 <open>
+    5a97:	83 c4 10             	add    $0x10,%esp
+    5a9a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    close(fd);
+    5a9d:	83 ec 0c             	sub    $0xc,%esp
+    5aa0:	ff 75 ec             	push   -0x14(%ebp)
+    5aa3:	e8 c9 17 00 00       	call   7271 <close>
+    5aa8:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5aab:	e8 a9 17 00 00       	call   7259 <exit>
+  } else if(pid < 0){
+    5ab0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    5ab4:	79 1b                	jns    5ad1 <bigargtest+0xe0>
+    printf(stdout, "bigargtest: fork failed\n");
+    5ab6:	a1 48 9e 00 00       	mov    0x9e48,%eax
+    5abb:	83 ec 08             	sub    $0x8,%esp
+    5abe:	68 4e 92 00 00       	push   $0x924e
+    5ac3:	50                   	push   %eax
+    5ac4:	e8 f4 0c 00 00       	call   67bd <printf>
+    5ac9:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5acc:	e8 88 17 00 00       	call   7259 <exit>
+  }
+  wait();
+    5ad1:	e8 74 0a 00 00       	call   654a <wait>
+  fd = open("bigarg-ok", 0);
+    5ad6:	83 ec 08             	sub    $0x8,%esp
+    5ad9:	6a 00                	push   $0x0
+    5adb:	68 47 91 00 00       	push   $0x9147
+    5ae0:	e8 ce 0a 00 00       	call   65b3 <open>
+    5ae5:	83 c4 10             	add    $0x10,%esp
+    5ae8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    5aeb:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    5aef:	79 1b                	jns    5b0c <bigargtest+0x11b>
+    printf(stdout, "bigarg test failed!\n");
+    5af1:	a1 48 9e 00 00       	mov    0x9e48,%eax
+    5af6:	83 ec 08             	sub    $0x8,%esp
+    5af9:	68 67 92 00 00       	push   $0x9267
+    5afe:	50                   	push   %eax
+    5aff:	e8 b9 0c 00 00       	call   67bd <printf>
+    5b04:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5b07:	e8 4d 17 00 00       	call   7259 <exit>
+  }
+  close(fd);
+    5b0c:	83 ec 0c             	sub    $0xc,%esp
+    5b0f:	ff 75 ec             	push   -0x14(%ebp)
+    5b12:	e8 5a 17 00 00       	call   7271 <close>
+    5b17:	83 c4 10             	add    $0x10,%esp
+  unlink("bigarg-ok");
+    5b1a:	83 ec 0c             	sub    $0xc,%esp
+    5b1d:	68 47 91 00 00       	push   $0x9147
+    5b22:	e8 aa 0a 00 00       	call   65d1 <unlink>
+    5b27:	83 c4 10             	add    $0x10,%esp
+}
+    5b2a:	90                   	nop
+    5b2b:	c9                   	leave
+    5b2c:	c3                   	ret
+
+00005b2d <fsfull>:
+
+// what happens when the file system runs out of blocks?
+// answer: balloc panics, so this test is not useful.
+void
+fsfull()
+{
+    5b2d:	55                   	push   %ebp
+    5b2e:	89 e5                	mov    %esp,%ebp
+    5b30:	53                   	push   %ebx
+    5b31:	83 ec 64             	sub    $0x64,%esp
+  int nfiles;
+  int fsblocks = 0;
+    5b34:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+
+  printf(1, "fsfull test\n");
+    5b3b:	83 ec 08             	sub    $0x8,%esp
+    5b3e:	68 7c 92 00 00       	push   $0x927c
+    5b43:	6a 01                	push   $0x1
+    5b45:	e8 73 0c 00 00       	call   67bd <printf>
+    5b4a:	83 c4 10             	add    $0x10,%esp
+
+  for(nfiles = 0; ; nfiles++){
+    5b4d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    char name[64];
+    name[0] = 'f';
+    5b54:	c6 45 a4 66          	movb   $0x66,-0x5c(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    5b58:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    5b5b:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    5b60:	89 c8                	mov    %ecx,%eax
+    5b62:	f7 ea                	imul   %edx
+    5b64:	c1 fa 06             	sar    $0x6,%edx
+    5b67:	89 c8                	mov    %ecx,%eax
+    5b69:	c1 f8 1f             	sar    $0x1f,%eax
+    5b6c:	29 c2                	sub    %eax,%edx
+    5b6e:	89 d0                	mov    %edx,%eax
+    5b70:	83 c0 30             	add    $0x30,%eax
+    5b73:	88 45 a5             	mov    %al,-0x5b(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    5b76:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    5b79:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    5b7e:	89 d8                	mov    %ebx,%eax
+    5b80:	f7 ea                	imul   %edx
+    5b82:	c1 fa 06             	sar    $0x6,%edx
+    5b85:	89 d8                	mov    %ebx,%eax
+    5b87:	c1 f8 1f             	sar    $0x1f,%eax
+    5b8a:	89 d1                	mov    %edx,%ecx
+    5b8c:	29 c1                	sub    %eax,%ecx
+    5b8e:	69 c1 e8 03 00 00    	imul   $0x3e8,%ecx,%eax
+    5b94:	29 c3                	sub    %eax,%ebx
+    5b96:	89 d9                	mov    %ebx,%ecx
+    5b98:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    5b9d:	89 c8                	mov    %ecx,%eax
+    5b9f:	f7 ea                	imul   %edx
+    5ba1:	c1 fa 05             	sar    $0x5,%edx
+    5ba4:	89 c8                	mov    %ecx,%eax
+    5ba6:	c1 f8 1f             	sar    $0x1f,%eax
+    5ba9:	29 c2                	sub    %eax,%edx
+    5bab:	89 d0                	mov    %edx,%eax
+    5bad:	83 c0 30             	add    $0x30,%eax
+    5bb0:	88 45 a6             	mov    %al,-0x5a(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    5bb3:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    5bb6:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    5bbb:	89 d8                	mov    %ebx,%eax
+    5bbd:	f7 ea                	imul   %edx
+    5bbf:	c1 fa 05             	sar    $0x5,%edx
+    5bc2:	89 d8                	mov    %ebx,%eax
+    5bc4:	c1 f8 1f             	sar    $0x1f,%eax
+    5bc7:	89 d1                	mov    %edx,%ecx
+    5bc9:	29 c1                	sub    %eax,%ecx
+    5bcb:	6b c1 64             	imul   $0x64,%ecx,%eax
+    5bce:	29 c3                	sub    %eax,%ebx
+    5bd0:	89 d9                	mov    %ebx,%ecx
+    5bd2:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    5bd7:	89 c8                	mov    %ecx,%eax
+    5bd9:	f7 ea                	imul   %edx
+    5bdb:	c1 fa 02             	sar    $0x2,%edx
+    5bde:	89 c8                	mov    %ecx,%eax
+    5be0:	c1 f8 1f             	sar    $0x1f,%eax
+    5be3:	29 c2                	sub    %eax,%edx
+    5be5:	89 d0                	mov    %edx,%eax
+    5be7:	83 c0 30             	add    $0x30,%eax
+    5bea:	88 45 a7             	mov    %al,-0x59(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    5bed:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    5bf0:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    5bf5:	89 c8                	mov    %ecx,%eax
+    5bf7:	f7 ea                	imul   %edx
+    5bf9:	c1 fa 02             	sar    $0x2,%edx
+    5bfc:	89 c8                	mov    %ecx,%eax
+    5bfe:	c1 f8 1f             	sar    $0x1f,%eax
+    5c01:	29 c2                	sub    %eax,%edx
+    5c03:	89 d0                	mov    %edx,%eax
+    5c05:	c1 e0 02             	shl    $0x2,%eax
+    5c08:	01 d0                	add    %edx,%eax
+    5c0a:	01 c0                	add    %eax,%eax
+    5c0c:	29 c1                	sub    %eax,%ecx
+    5c0e:	89 ca                	mov    %ecx,%edx
+    5c10:	89 d0                	mov    %edx,%eax
+    5c12:	83 c0 30             	add    $0x30,%eax
+    5c15:	88 45 a8             	mov    %al,-0x58(%ebp)
+    name[5] = '\0';
+    5c18:	c6 45 a9 00          	movb   $0x0,-0x57(%ebp)
+    printf(1, "writing %s\n", name);
+    5c1c:	83 ec 04             	sub    $0x4,%esp
+    5c1f:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    5c22:	50                   	push   %eax
+    5c23:	68 89 92 00 00       	push   $0x9289
+    5c28:	6a 01                	push   $0x1
+    5c2a:	e8 8e 0b 00 00       	call   67bd <printf>
+    5c2f:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    5c32:	83 ec 08             	sub    $0x8,%esp
+    5c35:	68 02 02 00 00       	push   $0x202
+    5c3a:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    5c3d:	50                   	push   %eax
+    5c3e:	e8 70 09 00 00       	call   65b3 <open>
+    5c43:	83 c4 10             	add    $0x10,%esp
+    5c46:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(fd < 0){
+    5c49:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    5c4d:	79 18                	jns    5c67 <fsfull+0x13a>
+      printf(1, "open %s failed\n", name);
+    5c4f:	83 ec 04             	sub    $0x4,%esp
+    5c52:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    5c55:	50                   	push   %eax
+    5c56:	68 95 92 00 00       	push   $0x9295
+    5c5b:	6a 01                	push   $0x1
+    5c5d:	e8 5b 0b 00 00       	call   67bd <printf>
+    5c62:	83 c4 10             	add    $0x10,%esp
+      break;
+    5c65:	eb 6b                	jmp    5cd2 <fsfull+0x1a5>
+    }
+    int total = 0;
+    5c67:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    while(1){
+      int cc = write(fd, buf, 512);
+    5c6e:	83 ec 04             	sub    $0x4,%esp
+    5c71:	68 00 02 00 00       	push   $0x200
+    5c76:	68 80 9e 00 00       	push   $0x9e80
+    5c7b:	ff 75 e8             	push   -0x18(%ebp)
+    5c7e:	e8 f4 08 00 00       	call   6577 <write>
+    5c83:	83 c4 10             	add    $0x10,%esp
+    5c86:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      if(cc < 512)
+    5c89:	81 7d e4 ff 01 00 00 	cmpl   $0x1ff,-0x1c(%ebp)
+    5c90:	7e 0c                	jle    5c9e <fsfull+0x171>
+        break;
+      total += cc;
+    5c92:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    5c95:	01 45 ec             	add    %eax,-0x14(%ebp)
+      fsblocks++;
+    5c98:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    while(1){
+    5c9c:	eb d0                	jmp    5c6e <fsfull+0x141>
+        break;
+    5c9e:	90                   	nop
+    }
+    printf(1, "wrote %d bytes\n", total);
+    5c9f:	83 ec 04             	sub    $0x4,%esp
+    5ca2:	ff 75 ec             	push   -0x14(%ebp)
+    5ca5:	68 a5 92 00 00       	push   $0x92a5
+    5caa:	6a 01                	push   $0x1
+    5cac:	e8 0c 0b 00 00       	call   67bd <printf>
+    5cb1:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+    5cb4:	83 ec 0c             	sub    $0xc,%esp
+    5cb7:	ff 75 e8             	push   -0x18(%ebp)
+    5cba:	e8 b2 15 00 00       	call   7271 <close>
+    5cbf:	83 c4 10             	add    $0x10,%esp
+    if(total == 0)
+    5cc2:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    5cc6:	74 09                	je     5cd1 <fsfull+0x1a4>
+  for(nfiles = 0; ; nfiles++){
+    5cc8:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    5ccc:	e9 83 fe ff ff       	jmp    5b54 <fsfull+0x27>
+      break;
+    5cd1:	90                   	nop
+  }
+
+  while(nfiles >= 0){
+    5cd2:	e9 db 00 00 00       	jmp    5db2 <fsfull+0x285>
+    char name[64];
+    name[0] = 'f';
+    5cd7:	c6 45 a4 66          	movb   $0x66,-0x5c(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    5cdb:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    5cde:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    5ce3:	89 c8                	mov    %ecx,%eax
+    5ce5:	f7 ea                	imul   %edx
+    5ce7:	c1 fa 06             	sar    $0x6,%edx
+    5cea:	89 c8                	mov    %ecx,%eax
+    5cec:	c1 f8 1f             	sar    $0x1f,%eax
+    5cef:	29 c2                	sub    %eax,%edx
+    5cf1:	89 d0                	mov    %edx,%eax
+    5cf3:	83 c0 30             	add    $0x30,%eax
+    5cf6:	88 45 a5             	mov    %al,-0x5b(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    5cf9:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    5cfc:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    5d01:	89 d8                	mov    %ebx,%eax
+    5d03:	f7 ea                	imul   %edx
+    5d05:	c1 fa 06             	sar    $0x6,%edx
+    5d08:	89 d8                	mov    %ebx,%eax
+    5d0a:	c1 f8 1f             	sar    $0x1f,%eax
+    5d0d:	89 d1                	mov    %edx,%ecx
+    5d0f:	29 c1                	sub    %eax,%ecx
+    5d11:	69 c1 e8 03 00 00    	imul   $0x3e8,%ecx,%eax
+    5d17:	29 c3                	sub    %eax,%ebx
+    5d19:	89 d9                	mov    %ebx,%ecx
+    5d1b:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    5d20:	89 c8                	mov    %ecx,%eax
+    5d22:	f7 ea                	imul   %edx
+    5d24:	c1 fa 05             	sar    $0x5,%edx
+    5d27:	89 c8                	mov    %ecx,%eax
+    5d29:	c1 f8 1f             	sar    $0x1f,%eax
+    5d2c:	29 c2                	sub    %eax,%edx
+    5d2e:	89 d0                	mov    %edx,%eax
+    5d30:	83 c0 30             	add    $0x30,%eax
+    5d33:	88 45 a6             	mov    %al,-0x5a(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    5d36:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    5d39:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    5d3e:	89 d8                	mov    %ebx,%eax
+    5d40:	f7 ea                	imul   %edx
+    5d42:	c1 fa 05             	sar    $0x5,%edx
+    5d45:	89 d8                	mov    %ebx,%eax
+    5d47:	c1 f8 1f             	sar    $0x1f,%eax
+    5d4a:	89 d1                	mov    %edx,%ecx
+    5d4c:	29 c1                	sub    %eax,%ecx
+    5d4e:	6b c1 64             	imul   $0x64,%ecx,%eax
+    5d51:	29 c3                	sub    %eax,%ebx
+    5d53:	89 d9                	mov    %ebx,%ecx
+    5d55:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    5d5a:	89 c8                	mov    %ecx,%eax
+    5d5c:	f7 ea                	imul   %edx
+    5d5e:	c1 fa 02             	sar    $0x2,%edx
+    5d61:	89 c8                	mov    %ecx,%eax
+    5d63:	c1 f8 1f             	sar    $0x1f,%eax
+    5d66:	29 c2                	sub    %eax,%edx
+    5d68:	89 d0                	mov    %edx,%eax
+    5d6a:	83 c0 30             	add    $0x30,%eax
+    5d6d:	88 45 a7             	mov    %al,-0x59(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    5d70:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    5d73:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    5d78:	89 c8                	mov    %ecx,%eax
+    5d7a:	f7 ea                	imul   %edx
+    5d7c:	c1 fa 02             	sar    $0x2,%edx
+    5d7f:	89 c8                	mov    %ecx,%eax
+    5d81:	c1 f8 1f             	sar    $0x1f,%eax
+    5d84:	29 c2                	sub    %eax,%edx
+    5d86:	89 d0                	mov    %edx,%eax
+    5d88:	c1 e0 02             	shl    $0x2,%eax
+    5d8b:	01 d0                	add    %edx,%eax
+    5d8d:	01 c0                	add    %eax,%eax
+    5d8f:	29 c1                	sub    %eax,%ecx
+    5d91:	89 ca                	mov    %ecx,%edx
+    5d93:	89 d0                	mov    %edx,%eax
+    5d95:	83 c0 30             	add    $0x30,%eax
+    5d98:	88 45 a8             	mov    %al,-0x58(%ebp)
+    name[5] = '\0';
+    5d9b:	c6 45 a9 00          	movb   $0x0,-0x57(%ebp)
+    unlink(name);
+    5d9f:	83 ec 0c             	sub    $0xc,%esp
+    5da2:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    5da5:	50                   	push   %eax
+    5da6:	e8 26 08 00 00       	call   65d1 <unlink>
+    5dab:	83 c4 10             	add    $0x10,%esp
+    nfiles--;
+    5dae:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+  while(nfiles >= 0){
+    5db2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    5db6:	0f 89 1b ff ff ff    	jns    5cd7 <fsfull+0x1aa>
+  }
+
+  printf(1, "fsfull test finished\n");
+    5dbc:	83 ec 08             	sub    $0x8,%esp
+    5dbf:	68 b5 92 00 00       	push   $0x92b5
+    5dc4:	6a 01                	push   $0x1
+    5dc6:	e8 f2 09 00 00       	call   67bd <printf>
+    5dcb:	83 c4 10             	add    $0x10,%esp
+}
+    5dce:	90                   	nop
+    5dcf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    5dd2:	c9                   	leave
+    5dd3:	c3                   	ret
+
+00005dd4 <rand>:
+
+unsigned long randstate = 1;
+unsigned int
+rand()
+{
+    5dd4:	55                   	push   %ebp
+    5dd5:	89 e5                	mov    %esp,%ebp
+  randstate = randstate * 1664525 + 1013904223;
+    5dd7:	a1 4c 9e 00 00       	mov    0x9e4c,%eax
+    5ddc:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+    5de2:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    5de7:	a3 4c 9e 00 00       	mov    %eax,0x9e4c
+  return randstate;
+    5dec:	a1 4c 9e 00 00       	mov    0x9e4c,%eax
+}
+    5df1:	5d                   	pop    %ebp
+    5df2:	c3                   	ret
+
+00005df3 <main>:
+
+int
+main(int argc, char *argv[])
+{
+    5df3:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    5df7:	83 e4 f0             	and    $0xfffffff0,%esp
+    5dfa:	ff 71 fc             	push   -0x4(%ecx)
+    5dfd:	55                   	push   %ebp
+    5dfe:	89 e5                	mov    %esp,%ebp
+    5e00:	51                   	push   %ecx
+    5e01:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "usertests starting\n");
+    5e04:	83 ec 08             	sub    $0x8,%esp
+    5e07:	68 cb 92 00 00       	push   $0x92cb
+    5e0c:	6a 01                	push   $0x1
+    5e0e:	e8 aa 09 00 00       	call   67bd <printf>
+    5e13:	83 c4 10             	add    $0x10,%esp
+
+  if(open("usertests.ran", 0) >= 0){
+    5e16:	83 ec 08             	sub    $0x8,%esp
+    5e19:	6a 00                	push   $0x0
+    5e1b:	68 df 92 00 00       	push   $0x92df
+    5e20:	e8 8e 07 00 00       	call   65b3 <open>
+    5e25:	83 c4 10             	add    $0x10,%esp
+    5e28:	85 c0                	test   %eax,%eax
+    5e2a:	78 17                	js     5e43 <main+0x50>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+    5e2c:	83 ec 08             	sub    $0x8,%esp
+    5e2f:	68 f0 92 00 00       	push   $0x92f0
+    5e34:	6a 01                	push   $0x1
+    5e36:	e8 82 09 00 00       	call   67bd <printf>
+    5e3b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5e3e:	e8 16 14 00 00       	call   7259 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+    5e43:	83 ec 08             	sub    $0x8,%esp
+    5e46:	68 00 02 00 00       	push   $0x200
+    5e4b:	68 df 92 00 00       	push   $0x92df
+    5e50:	e8 5e 07 00 00       	call   65b3 <open>
+    5e55:	83 c4 10             	add    $0x10,%esp
+    5e58:	83 ec 0c             	sub    $0xc,%esp
+    5e5b:	50                   	push   %eax
+    5e5c:	e8 10 14 00 00       	call   7271 <close>
+    5e61:	83 c4 10             	add    $0x10,%esp
+
+  createdelete();
+    5e64:	e8 5b c0 ff ff       	call   1ec4 <createdelete>
+  linkunlink();
+    5e69:	e8 80 ca ff ff       	call   28ee <linkunlink>
+  concreate();
+    5e6e:	e8 c7 c6 ff ff       	call   253a <concreate>
+  fourfiles();
+    5e73:	e8 af ba ff ff       	call   1927 <fourfiles>
+  sharedread();
+    5e78:	e8 fb bc ff ff       	call   1b78 <sharedread>
+  sharedfd();
+    5e7d:	e8 c2 b8 ff ff       	call   1744 <sharedfd>
+
+  bigargtest();
+    5e82:	e8 6a fb ff ff       	call   59f1 <bigargtest>
+  bigwrite();
+    5e87:	e8 02 e7 ff ff       	call   458e <bigwrite>
+  ioringtest();
+    5e8c:	e8 fc e3 ff ff       	call   428d <ioringtest>
+  fsynctest();
+    5e91:	e8 f6 e1 ff ff       	call   408c <fsynctest>
+  inlinetest();
+    5e96:	e8 24 dc ff ff       	call   3abf <inlinetest>
+  sparsetest();
+    5e9b:	e8 76 d9 ff ff       	call   3816 <sparsetest>
+  stdiotest();
+    5ea0:	e8 3e df ff ff       	call   3de3 <stdiotest>
+  dmesgtest();
+    5ea5:	e8 d3 dd ff ff       	call   3c7d <dmesgtest>
+  bigargtest();
+    5eaa:	e8 42 fb ff ff       	call   59f1 <bigargtest>
+  bsstest();
+    5eaf:	e8 c7 fa ff ff       	call   597b <bsstest>
+  sbrktest();
+    5eb4:	e8 e0 f4 ff ff       	call   5399 <sbrktest>
+  validatetest();
+    5eb9:	e8 df f9 ff ff       	call   589d <validatetest>
+
+  opentest();
+    5ebe:	e8 ad a4 ff ff       	call   370 <opentest>
+  writetest();
+    5ec3:	e8 57 a5 ff ff       	call   41f <writetest>
+  writetest1();
+    5ec8:	e8 62 a7 ff ff       	call   62f <writetest1>
+  createtest();
+    5ecd:	e8 59 a9 ff ff       	call   82b <createtest>
+
+  openiputtest();
+    5ed2:	e8 8a a3 ff ff       	call   261 <openiputtest>
+  exitiputtest();
+    5ed7:	e8 86 a2 ff ff       	call   162 <exitiputtest>
+  iputtest();
+    5edc:	e8 90 a1 ff ff       	call   71 <iputtest>
+
+  mem();
+    5ee1:	e8 6d b7 ff ff       	call   1653 <mem>
+  malloctest();
+    5ee6:	e8 23 b5 ff ff       	call   140e <malloctest>
+  manyproctest();
+    5eeb:	e8 e0 b3 ff ff       	call   12d0 <manyproctest>
+  lockstattest();
+    5ef0:	e8 dd b2 ff ff       	call   11d2 <lockstattest>
+  pipe1();
+    5ef5:	e8 38 ab ff ff       	call   a32 <pipe1>
+  splicetest();
+    5efa:	e8 1c ad ff ff       	call   c1b <splicetest>
+  preempt();
+    5eff:	e8 f0 b0 ff ff       	call   ff4 <preempt>
+  exitwait();
+    5f04:	e8 51 b2 ff ff       	call   115a <exitwait>
+
+  rmdot();
+    5f09:	e8 f2 ea ff ff       	call   4a00 <rmdot>
+  fourteen();
+    5f0e:	e8 91 e9 ff ff       	call   48a4 <fourteen>
+  bigfile();
+    5f13:	e8 74 e7 ff ff       	call   468c <bigfile>
+  subdir();
+    5f18:	e8 b5 d1 ff ff       	call   30d2 <subdir>
+  linktest();
+    5f1d:	e8 d6 c3 ff ff       	call   22f8 <linktest>
+  unlinkread();
+    5f22:	e8 0f c2 ff ff       	call   2136 <unlinkread>
+  dirfile();
+    5f27:	e8 59 ec ff ff       	call   4b85 <dirfile>
+  cachedpath();
+    5f2c:	e8 8c ee ff ff       	call   4dbd <cachedpath>
+  iref();
+    5f31:	e8 5f f2 ff ff       	call   5195 <iref>
+  forktest();
+    5f36:	e8 94 f3 ff ff       	call   52cf <forktest>
+  bigdir(); // slow
+    5f3b:	e8 e5 ca ff ff       	call   2a25 <bigdir>
+  hashsplit(); // slow
+    5f40:	e8 4a ce ff ff       	call   2d8f <hashsplit>
+  exectest();
+    5f45:	e8 95 aa ff ff       	call   9df <exectest>
+
+  exit();
+    5f4a:	e8 0a 13 00 00       	call   7259 <exit>
+
+00005f4f <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+    5f4f:	55                   	push   %ebp
+    5f50:	89 e5                	mov    %esp,%ebp
+    5f52:	57                   	push   %edi
+    5f53:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+    5f54:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    5f57:	8b 55 10             	mov    0x10(%ebp),%edx
+    5f5a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    5f5d:	89 cb                	mov    %ecx,%ebx
+    5f5f:	89 df                	mov    %ebx,%edi
+    5f61:	89 d1                	mov    %edx,%ecx
+    5f63:	fc                   	cld
+    5f64:	f3 aa                	rep stos %al,%es:(%edi)
+    5f66:	89 ca                	mov    %ecx,%edx
+    5f68:	89 fb                	mov    %edi,%ebx
+    5f6a:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    5f6d:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+    5f70:	90                   	nop
+    5f71:	5b                   	pop    %ebx
+    5f72:	5f                   	pop    %edi
+    5f73:	5d                   	pop    %ebp
+    5f74:	c3                   	ret
+
+00005f75 <stosl>:
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+    5f75:	55                   	push   %ebp
+    5f76:	89 e5                	mov    %esp,%ebp
+    5f78:	57                   	push   %edi
+    5f79:	53                   	push   %ebx
+  asm volatile("cld; rep stosl" :
+    5f7a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    5f7d:	8b 55 10             	mov    0x10(%ebp),%edx
+    5f80:	8b 45 0c             	mov    0xc(%ebp),%eax
+    5f83:	89 cb                	mov    %ecx,%ebx
+    5f85:	89 df                	mov    %ebx,%edi
+    5f87:	89 d1                	mov    %edx,%ecx
+    5f89:	fc                   	cld
+    5f8a:	f3 ab                	rep stos %eax,%es:(%edi)
+    5f8c:	89 ca                	mov    %ecx,%edx
+    5f8e:	89 fb                	mov    %edi,%ebx
+    5f90:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    5f93:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+    5f96:	90                   	nop
+    5f97:	5b                   	pop    %ebx
+    5f98:	5f                   	pop    %edi
+    5f99:	5d                   	pop    %ebp
+    5f9a:	c3                   	ret
+
+00005f9b <movsb>:
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+    5f9b:	55                   	push   %ebp
+    5f9c:	89 e5                	mov    %esp,%ebp
+    5f9e:	57                   	push   %edi
+    5f9f:	56                   	push   %esi
+    5fa0:	53                   	push   %ebx
+  asm volatile("cld; rep movsb" :
+    5fa1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    5fa4:	8b 55 0c             	mov    0xc(%ebp),%edx
+    5fa7:	8b 45 10             	mov    0x10(%ebp),%eax
+    5faa:	89 cb                	mov    %ecx,%ebx
+    5fac:	89 df                	mov    %ebx,%edi
+    5fae:	89 d6                	mov    %edx,%esi
+    5fb0:	89 c1                	mov    %eax,%ecx
+    5fb2:	fc                   	cld
+    5fb3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    5fb5:	89 c8                	mov    %ecx,%eax
+    5fb7:	89 f2                	mov    %esi,%edx
+    5fb9:	89 fb                	mov    %edi,%ebx
+    5fbb:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    5fbe:	89 55 0c             	mov    %edx,0xc(%ebp)
+    5fc1:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+    5fc4:	90                   	nop
+    5fc5:	5b                   	pop    %ebx
+    5fc6:	5e                   	pop    %esi
+    5fc7:	5f                   	pop    %edi
+    5fc8:	5d                   	pop    %ebp
+    5fc9:	c3                   	ret
+
+00005fca <movsl>:
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+    5fca:	55                   	push   %ebp
+    5fcb:	89 e5                	mov    %esp,%ebp
+    5fcd:	57                   	push   %edi
+    5fce:	56                   	push   %esi
+    5fcf:	53                   	push   %ebx
+  asm volatile("cld; rep movsl" :
+    5fd0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    5fd3:	8b 55 0c             	mov    0xc(%ebp),%edx
+    5fd6:	8b 45 10             	mov    0x10(%ebp),%eax
+    5fd9:	89 cb                	mov    %ecx,%ebx
+    5fdb:	89 df                	mov    %ebx,%edi
+    5fdd:	89 d6                	mov    %edx,%esi
+    5fdf:	89 c1                	mov    %eax,%ecx
+    5fe1:	fc                   	cld
+    5fe2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    5fe4:	89 c8                	mov    %ecx,%eax
+    5fe6:	89 f2                	mov    %esi,%edx
+    5fe8:	89 fb                	mov    %edi,%ebx
+    5fea:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    5fed:	89 55 0c             	mov    %edx,0xc(%ebp)
+    5ff0:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+    5ff3:	90                   	nop
+    5ff4:	5b                   	pop    %ebx
+    5ff5:	5e                   	pop    %esi
+    5ff6:	5f                   	pop    %edi
+    5ff7:	5d                   	pop    %ebp
+    5ff8:	c3                   	ret
+
+00005ff9 <strcpy>:
+#define ONES        0x01010101
+#define HASZERO(x)  (((x) - ONES) & ~(x) & (ONES << 7))
+
+char*
+strcpy(char *s, char *t)
+{
+    5ff9:	55                   	push   %ebp
+    5ffa:	89 e5                	mov    %esp,%ebp
+    5ffc:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+    5fff:	8b 45 08             	mov    0x8(%ebp),%eax
+    6002:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+    6005:	90                   	nop
+    6006:	8b 55 0c             	mov    0xc(%ebp),%edx
+    6009:	8d 42 01             	lea    0x1(%edx),%eax
+    600c:	89 45 0c             	mov    %eax,0xc(%ebp)
+    600f:	8b 45 08             	mov    0x8(%ebp),%eax
+    6012:	8d 48 01             	lea    0x1(%eax),%ecx
+    6015:	89 4d 08             	mov    %ecx,0x8(%ebp)
+    6018:	0f b6 12             	movzbl (%edx),%edx
+    601b:	88 10                	mov    %dl,(%eax)
+    601d:	0f b6 00             	movzbl (%eax),%eax
+    6020:	84 c0                	test   %al,%al
+    6022:	75 e2                	jne    6006 <strcpy+0xd>
+    ;
+  return os;
+    6024:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    6027:	c9                   	leave
+    6028:	c3                   	ret
+
+00006029 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    6029:	55                   	push   %ebp
+    602a:	89 e5                	mov    %esp,%ebp
+  // Aligned words never straddle a page, so reading
+  // whole ones past the end of a string is safe.
+  if((((uint)p | (uint)q) & 3) == 0)
+    602c:	8b 55 08             	mov    0x8(%ebp),%edx
+    602f:	8b 45 0c             	mov    0xc(%ebp),%eax
+    6032:	09 d0                	or     %edx,%eax
+    6034:	83 e0 03             	and    $0x3,%eax
+    6037:	85 c0                	test   %eax,%eax
+    6039:	75 3f                	jne    607a <strcmp+0x51>
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+    603b:	eb 08                	jmp    6045 <strcmp+0x1c>
+      p += 4, q += 4;
+    603d:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+    6041:	83 45 0c 04          	addl   $0x4,0xc(%ebp)
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+    6045:	8b 45 08             	mov    0x8(%ebp),%eax
+    6048:	8b 10                	mov    (%eax),%edx
+    604a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    604d:	8b 00                	mov    (%eax),%eax
+    604f:	39 c2                	cmp    %eax,%edx
+    6051:	75 27                	jne    607a <strcmp+0x51>
+    6053:	8b 45 08             	mov    0x8(%ebp),%eax
+    6056:	8b 00                	mov    (%eax),%eax
+    6058:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+    605e:	8b 45 08             	mov    0x8(%ebp),%eax
+    6061:	8b 00                	mov    (%eax),%eax
+    6063:	f7 d0                	not    %eax
+    6065:	21 d0                	and    %edx,%eax
+    6067:	25 80 80 80 80       	and    $0x80808080,%eax
+    606c:	85 c0                	test   %eax,%eax
+    606e:	74 cd                	je     603d <strcmp+0x14>
+  while(*p && *p == *q)
+    6070:	eb 08                	jmp    607a <strcmp+0x51>
+    p++, q++;
+    6072:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    6076:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+    607a:	8b 45 08             	mov    0x8(%ebp),%eax
+    607d:	0f b6 00             	movzbl (%eax),%eax
+    6080:	84 c0                	test   %al,%al
+    6082:	74 10                	je     6094 <strcmp+0x6b>
+    6084:	8b 45 08             	mov    0x8(%ebp),%eax
+    6087:	0f b6 10             	movzbl (%eax),%edx
+    608a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    608d:	0f b6 00             	movzbl (%eax),%eax
+    6090:	38 c2                	cmp    %al,%dl
+    6092:	74 de                	je     6072 <strcmp+0x49>
+  return (uchar)*p - (uchar)*q;
+    6094:	8b 45 08             	mov    0x8(%ebp),%eax
+    6097:	0f b6 00             	movzbl (%eax),%eax
+    609a:	0f b6 d0             	movzbl %al,%edx
+    609d:	8b 45 0c             	mov    0xc(%ebp),%eax
+    60a0:	0f b6 00             	movzbl (%eax),%eax
+    60a3:	0f b6 c0             	movzbl %al,%eax
+    60a6:	29 c2                	sub    %eax,%edx
+    60a8:	89 d0                	mov    %edx,%eax
+}
+    60aa:	5d                   	pop    %ebp
+    60ab:	c3                   	ret
+
+000060ac <strlen>:
+
+uint
+strlen(char *s)
+{
+    60ac:	55                   	push   %ebp
+    60ad:	89 e5                	mov    %esp,%ebp
+    60af:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; ((uint)(s+n) & 3) && s[n]; n++)
+    60b2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    60b9:	eb 04                	jmp    60bf <strlen+0x13>
+    60bb:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    60bf:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    60c2:	8b 45 08             	mov    0x8(%ebp),%eax
+    60c5:	01 d0                	add    %edx,%eax
+    60c7:	83 e0 03             	and    $0x3,%eax
+    60ca:	85 c0                	test   %eax,%eax
+    60cc:	74 0f                	je     60dd <strlen+0x31>
+    60ce:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    60d1:	8b 45 08             	mov    0x8(%ebp),%eax
+    60d4:	01 d0                	add    %edx,%eax
+    60d6:	0f b6 00             	movzbl (%eax),%eax
+    60d9:	84 c0                	test   %al,%al
+    60db:	75 de                	jne    60bb <strlen+0xf>
+    ;
+  if(s[n])
+    60dd:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    60e0:	8b 45 08             	mov    0x8(%ebp),%eax
+    60e3:	01 d0                	add    %edx,%eax
+    60e5:	0f b6 00             	movzbl (%eax),%eax
+    60e8:	84 c0                	test   %al,%al
+    60ea:	74 33                	je     611f <strlen+0x73>
+    while(!HASZERO(*(uint*)(s+n)))
+    60ec:	eb 04                	jmp    60f2 <strlen+0x46>
+      n += 4;
+    60ee:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+    while(!HASZERO(*(uint*)(s+n)))
+    60f2:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    60f5:	8b 45 08             	mov    0x8(%ebp),%eax
+    60f8:	01 d0                	add    %edx,%eax
+    60fa:	8b 00                	mov    (%eax),%eax
+    60fc:	8d 88 ff fe fe fe    	lea    -0x1010101(%eax),%ecx
+    6102:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    6105:	8b 45 08             	mov    0x8(%ebp),%eax
+    6108:	01 d0                	add    %edx,%eax
+    610a:	8b 00                	mov    (%eax),%eax
+    610c:	f7 d0                	not    %eax
+    610e:	21 c8                	and    %ecx,%eax
+    6110:	25 80 80 80 80       	and    $0x80808080,%eax
+    6115:	85 c0                	test   %eax,%eax
+    6117:	74 d5                	je     60ee <strlen+0x42>
+  for(; s[n]; n++)
+    6119:	eb 04                	jmp    611f <strlen+0x73>
+    611b:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    611f:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    6122:	8b 45 08             	mov    0x8(%ebp),%eax
+    6125:	01 d0                	add    %edx,%eax
+    6127:	0f b6 00             	movzbl (%eax),%eax
+    612a:	84 c0                	test   %al,%al
+    612c:	75 ed                	jne    611b <strlen+0x6f>
+    ;
+  return n;
+    612e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    6131:	c9                   	leave
+    6132:	c3                   	ret
+
+00006133 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    6133:	55                   	push   %ebp
+    6134:	89 e5                	mov    %esp,%ebp
+    6136:	83 ec 10             	sub    $0x10,%esp
+  char *d;
+  uint k;
+
+  d = dst;
+    6139:	8b 45 08             	mov    0x8(%ebp),%eax
+    613c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c &= 0xFF;
+    613f:	81 65 0c ff 00 00 00 	andl   $0xff,0xc(%ebp)
+  if(n >= 16){
+    6146:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+    614a:	76 54                	jbe    61a0 <memset+0x6d>
+    k = -(uint)d & 3;  // bytes up to a word boundary
+    614c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    614f:	f7 d8                	neg    %eax
+    6151:	83 e0 03             	and    $0x3,%eax
+    6154:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    stosb(d, c, k);
+    6157:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    615a:	50                   	push   %eax
+    615b:	ff 75 0c             	push   0xc(%ebp)
+    615e:	ff 75 fc             	push   -0x4(%ebp)
+    6161:	e8 e9 fd ff ff       	call   5f4f <stosb>
+    6166:	83 c4 0c             	add    $0xc,%esp
+    d += k;
+    6169:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    616c:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n -= k;
+    616f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    6172:	29 45 10             	sub    %eax,0x10(%ebp)
+    stosl(d, c*ONES, n/4);
+    6175:	8b 45 10             	mov    0x10(%ebp),%eax
+    6178:	c1 e8 02             	shr    $0x2,%eax
+    617b:	89 c2                	mov    %eax,%edx
+    617d:	8b 45 0c             	mov    0xc(%ebp),%eax
+    6180:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    6186:	52                   	push   %edx
+    6187:	50                   	push   %eax
+    6188:	ff 75 fc             	push   -0x4(%ebp)
+    618b:	e8 e5 fd ff ff       	call   5f75 <stosl>
+    6190:	83 c4 0c             	add    $0xc,%esp
+    d += n & ~3;
+    6193:	8b 45 10             	mov    0x10(%ebp),%eax
+    6196:	83 e0 fc             	and    $0xfffffffc,%eax
+    6199:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n &= 3;
+    619c:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+  }
+  stosb(d, c, n);
+    61a0:	8b 45 10             	mov    0x10(%ebp),%eax
+    61a3:	50                   	push   %eax
+    61a4:	ff 75 0c             	push   0xc(%ebp)
+    61a7:	ff 75 fc             	push   -0x4(%ebp)
+    61aa:	e8 a0 fd ff ff       	call   5f4f <stosb>
+    61af:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+    61b2:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    61b5:	c9                   	leave
+    61b6:	c3                   	ret
+
+000061b7 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    61b7:	55                   	push   %ebp
+    61b8:	89 e5                	mov    %esp,%ebp
+    61ba:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s1, *s2;
+
+  s1 = v1;
+    61bd:	8b 45 08             	mov    0x8(%ebp),%eax
+    61c0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s2 = v2;
+    61c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+    61c6:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+    61c9:	eb 0c                	jmp    61d7 <memcmp+0x20>
+    s1 += 4, s2 += 4, n -= 4;
+    61cb:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+    61cf:	83 45 f8 04          	addl   $0x4,-0x8(%ebp)
+    61d3:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+    61d7:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+    61db:	76 3e                	jbe    621b <memcmp+0x64>
+    61dd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    61e0:	8b 10                	mov    (%eax),%edx
+    61e2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    61e5:	8b 00                	mov    (%eax),%eax
+    61e7:	39 c2                	cmp    %eax,%edx
+    61e9:	74 e0                	je     61cb <memcmp+0x14>
+  while(n-- > 0){
+    61eb:	eb 2e                	jmp    621b <memcmp+0x64>
+    if(*s1 != *s2)
+    61ed:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    61f0:	0f b6 10             	movzbl (%eax),%edx
+    61f3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    61f6:	0f b6 00             	movzbl (%eax),%eax
+    61f9:	38 c2                	cmp    %al,%dl
+    61fb:	74 16                	je     6213 <memcmp+0x5c>
+      return *s1 - *s2;
+    61fd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    6200:	0f b6 00             	movzbl (%eax),%eax
+    6203:	0f b6 d0             	movzbl %al,%edx
+    6206:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    6209:	0f b6 00             	movzbl (%eax),%eax
+    620c:	0f b6 c0             	movzbl %al,%eax
+    620f:	29 c2                	sub    %eax,%edx
+    6211:	eb 1a                	jmp    622d <memcmp+0x76>
+    s1++, s2++;
+    6213:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    6217:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+  while(n-- > 0){
+    621b:	8b 45 10             	mov    0x10(%ebp),%eax
+    621e:	8d 50 ff             	lea    -0x1(%eax),%edx
+    6221:	89 55 10             	mov    %edx,0x10(%ebp)
+    6224:	85 c0                	test   %eax,%eax
+    6226:	75 c5                	jne    61ed <memcmp+0x36>
+  }
+  return 0;
+    6228:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+    622d:	89 d0                	mov    %edx,%eax
+    622f:	c9                   	leave
+    6230:	c3                   	ret
+
+00006231 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    6231:	55                   	push   %ebp
+    6232:	89 e5                	mov    %esp,%ebp
+    6234:	83 ec 14             	sub    $0x14,%esp
+    6237:	8b 45 0c             	mov    0xc(%ebp),%eax
+    623a:	88 45 ec             	mov    %al,-0x14(%ebp)
+  uint w, cc;
+
+  // Skip whole words holding neither c nor the terminator.
+  for(; ((uint)s & 3) && *s; s++)
+    623d:	eb 17                	jmp    6256 <strchr+0x25>
+    if(*s == c)
+    623f:	8b 45 08             	mov    0x8(%ebp),%eax
+    6242:	0f b6 00             	movzbl (%eax),%eax
+    6245:	38 45 ec             	cmp    %al,-0x14(%ebp)
+    6248:	75 08                	jne    6252 <strchr+0x21>
+      return (char*)s;
+    624a:	8b 45 08             	mov    0x8(%ebp),%eax
+    624d:	e9 ad 00 00 00       	jmp    62ff <strchr+0xce>
+  for(; ((uint)s & 3) && *s; s++)
+    6252:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    6256:	8b 45 08             	mov    0x8(%ebp),%eax
+    6259:	83 e0 03             	and    $0x3,%eax
+    625c:	85 c0                	test   %eax,%eax
+    625e:	74 0a                	je     626a <strchr+0x39>
+    6260:	8b 45 08             	mov    0x8(%ebp),%eax
+    6263:	0f b6 00             	movzbl (%eax),%eax
+    6266:	84 c0                	test   %al,%al
+    6268:	75 d5                	jne    623f <strchr+0xe>
+  cc = (uchar)c * ONES;
+    626a:	0f b6 45 ec          	movzbl -0x14(%ebp),%eax
+    626e:	0f b6 c0             	movzbl %al,%eax
+    6271:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    6277:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(*s)
+    627a:	8b 45 08             	mov    0x8(%ebp),%eax
+    627d:	0f b6 00             	movzbl (%eax),%eax
+    6280:	84 c0                	test   %al,%al
+    6282:	74 6c                	je     62f0 <strchr+0xbf>
+    for(; w = *(uint*)s, !HASZERO(w) && !HASZERO(w ^ cc); s += 4)
+    6284:	eb 04                	jmp    628a <strchr+0x59>
+    6286:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+    628a:	8b 45 08             	mov    0x8(%ebp),%eax
+    628d:	8b 00                	mov    (%eax),%eax
+    628f:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    6292:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    6295:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+    629b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    629e:	f7 d0                	not    %eax
+    62a0:	21 d0                	and    %edx,%eax
+    62a2:	25 80 80 80 80       	and    $0x80808080,%eax
+    62a7:	85 c0                	test   %eax,%eax
+    62a9:	75 26                	jne    62d1 <strchr+0xa0>
+    62ab:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    62ae:	33 45 fc             	xor    -0x4(%ebp),%eax
+    62b1:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+    62b7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    62ba:	33 45 fc             	xor    -0x4(%ebp),%eax
+    62bd:	f7 d0                	not    %eax
+    62bf:	21 d0                	and    %edx,%eax
+    62c1:	25 80 80 80 80       	and    $0x80808080,%eax
+    62c6:	85 c0                	test   %eax,%eax
+    62c8:	75 07                	jne    62d1 <strchr+0xa0>
+    62ca:	b8 01 00 00 00       	mov    $0x1,%eax
+    62cf:	eb 05                	jmp    62d6 <strchr+0xa5>
+    62d1:	b8 00 00 00 00       	mov    $0x0,%eax
+    62d6:	85 c0                	test   %eax,%eax
+    62d8:	75 ac                	jne    6286 <strchr+0x55>
+      ;
+  for(; *s; s++)
+    62da:	eb 14                	jmp    62f0 <strchr+0xbf>
+    if(*s == c)
+    62dc:	8b 45 08             	mov    0x8(%ebp),%eax
+    62df:	0f b6 00             	movzbl (%eax),%eax
+    62e2:	38 45 ec             	cmp    %al,-0x14(%ebp)
+    62e5:	75 05                	jne    62ec <strchr+0xbb>
+      return (char*)s;
+    62e7:	8b 45 08             	mov    0x8(%ebp),%eax
+    62ea:	eb 13                	jmp    62ff <strchr+0xce>
+  for(; *s; s++)
+    62ec:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    62f0:	8b 45 08             	mov    0x8(%ebp),%eax
+    62f3:	0f b6 00             	movzbl (%eax),%eax
+    62f6:	84 c0                	test   %al,%al
+    62f8:	75 e2                	jne    62dc <strchr+0xab>
+  return 0;
+    62fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    62ff:	c9                   	leave
+    6300:	c3                   	ret
+
+00006301 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    6301:	55                   	push   %ebp
+    6302:	89 e5                	mov    %esp,%ebp
+    6304:	83 ec 18             	sub    $0x18,%esp
+  int i, c;
+
+  for(i=0; i+1 < max; ){
+    6307:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    630e:	eb 37                	jmp    6347 <gets+0x46>
+    c = fgetc(0);
+    6310:	83 ec 0c             	sub    $0xc,%esp
+    6313:	6a 00                	push   $0x0
+    6315:	e8 2e 0e 00 00       	call   7148 <fgetc>
+    631a:	83 c4 10             	add    $0x10,%esp
+    631d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(c < 0)
+    6320:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    6324:	78 2e                	js     6354 <gets+0x53>
+      break;
+    buf[i++] = c;
+    6326:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6329:	8d 50 01             	lea    0x1(%eax),%edx
+    632c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    632f:	89 c2                	mov    %eax,%edx
+    6331:	8b 45 08             	mov    0x8(%ebp),%eax
+    6334:	01 d0                	add    %edx,%eax
+    6336:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    6339:	88 10                	mov    %dl,(%eax)
+    if(c == '\n' || c == '\r')
+    633b:	83 7d f0 0a          	cmpl   $0xa,-0x10(%ebp)
+    633f:	74 14                	je     6355 <gets+0x54>
+    6341:	83 7d f0 0d          	cmpl   $0xd,-0x10(%ebp)
+    6345:	74 0e                	je     6355 <gets+0x54>
+  for(i=0; i+1 < max; ){
+    6347:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    634a:	83 c0 01             	add    $0x1,%eax
+    634d:	39 45 0c             	cmp    %eax,0xc(%ebp)
+    6350:	7f be                	jg     6310 <gets+0xf>
+    6352:	eb 01                	jmp    6355 <gets+0x54>
+      break;
+    6354:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    6355:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    6358:	8b 45 08             	mov    0x8(%ebp),%eax
+    635b:	01 d0                	add    %edx,%eax
+    635d:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+    6360:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    6363:	c9                   	leave
+    6364:	c3                   	ret
+
+00006365 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    6365:	55                   	push   %ebp
+    6366:	89 e5                	mov    %esp,%ebp
+    6368:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    636b:	83 ec 08             	sub    $0x8,%esp
+    636e:	6a 00                	push   $0x0
+    6370:	ff 75 08             	push   0x8(%ebp)
+    6373:	e8 3b 02 00 00       	call   65b3 <open>
+    6378:	83 c4 10             	add    $0x10,%esp
+    637b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+    637e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    6382:	79 07                	jns    638b <stat+0x26>
+    return -1;
+    6384:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    6389:	eb 25                	jmp    63b0 <stat+0x4b>
+  r = fstat(fd, st);
+    638b:	83 ec 08             	sub    $0x8,%esp
+    638e:	ff 75 0c             	push   0xc(%ebp)
+    6391:	ff 75 f4             	push   -0xc(%ebp)
+    6394:	e8 47 02 00 00       	call   65e0 <fstat>
+    6399:	83 c4 10             	add    $0x10,%esp
+    639c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+    639f:	83 ec 0c             	sub    $0xc,%esp
+    63a2:	ff 75 f4             	push   -0xc(%ebp)
+    63a5:	e8 c7 0e 00 00       	call   7271 <close>
+    63aa:	83 c4 10             	add    $0x10,%esp
+  return r;
+    63ad:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    63b0:	c9                   	leave
+    63b1:	c3                   	ret
+
+000063b2 <atoi>:
+
+int
+atoi(const char *s)
+{
+    63b2:	55                   	push   %ebp
+    63b3:	89 e5                	mov    %esp,%ebp
+    63b5:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+    63b8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    63bf:	eb 25                	jmp    63e6 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+    63c1:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    63c4:	89 d0                	mov    %edx,%eax
+    63c6:	c1 e0 02             	shl    $0x2,%eax
+    63c9:	01 d0                	add    %edx,%eax
+    63cb:	01 c0                	add    %eax,%eax
+    63cd:	89 c1                	mov    %eax,%ecx
+    63cf:	8b 45 08             	mov    0x8(%ebp),%eax
+    63d2:	8d 50 01             	lea    0x1(%eax),%edx
+    63d5:	89 55 08             	mov    %edx,0x8(%ebp)
+    63d8:	0f b6 00             	movzbl (%eax),%eax
+    63db:	0f be c0             	movsbl %al,%eax
+    63de:	01 c8                	add    %ecx,%eax
+    63e0:	83 e8 30             	sub    $0x30,%eax
+    63e3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    63e6:	8b 45 08             	mov    0x8(%ebp),%eax
+    63e9:	0f b6 00             	movzbl (%eax),%eax
+    63ec:	3c 2f                	cmp    $0x2f,%al
+    63ee:	7e 0a                	jle    63fa <atoi+0x48>
+    63f0:	8b 45 08             	mov    0x8(%ebp),%eax
+    63f3:	0f b6 00             	movzbl (%eax),%eax
+    63f6:	3c 39                	cmp    $0x39,%al
+    63f8:	7e c7                	jle    63c1 <atoi+0xf>
+  return n;
+    63fa:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    63fd:	c9                   	leave
+    63fe:	c3                   	ret
+
+000063ff <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    63ff:	55                   	push   %ebp
+    6400:	89 e5                	mov    %esp,%ebp
+    6402:	83 ec 10             	sub    $0x10,%esp
+  char *d, *s;
+  int k;
+
+  if(n <= 0)
+    6405:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+    6409:	7f 08                	jg     6413 <memmove+0x14>
+    return vdst;
+    640b:	8b 45 08             	mov    0x8(%ebp),%eax
+    640e:	e9 17 01 00 00       	jmp    652a <memmove+0x12b>
+  d = vdst;
+    6413:	8b 45 08             	mov    0x8(%ebp),%eax
+    6416:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s = vsrc;
+    6419:	8b 45 0c             	mov    0xc(%ebp),%eax
+    641c:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  if(s < d && s + n > d){
+    641f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    6422:	3b 45 fc             	cmp    -0x4(%ebp),%eax
+    6425:	0f 83 84 00 00 00    	jae    64af <memmove+0xb0>
+    642b:	8b 55 10             	mov    0x10(%ebp),%edx
+    642e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    6431:	01 d0                	add    %edx,%eax
+    6433:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    6436:	73 77                	jae    64af <memmove+0xb0>
+    s += n;
+    6438:	8b 45 10             	mov    0x10(%ebp),%eax
+    643b:	01 45 f8             	add    %eax,-0x8(%ebp)
+    d += n;
+    643e:	8b 45 10             	mov    0x10(%ebp),%eax
+    6441:	01 45 fc             	add    %eax,-0x4(%ebp)
+    while(n > 0 && ((uint)d & 3))
+    6444:	eb 17                	jmp    645d <memmove+0x5e>
+      *--d = *--s, n--;
+    6446:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+    644a:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+    644e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    6451:	0f b6 10             	movzbl (%eax),%edx
+    6454:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    6457:	88 10                	mov    %dl,(%eax)
+    6459:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+    while(n > 0 && ((uint)d & 3))
+    645d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+    6461:	7e 22                	jle    6485 <memmove+0x86>
+    6463:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    6466:	83 e0 03             	and    $0x3,%eax
+    6469:	85 c0                	test   %eax,%eax
+    646b:	75 d9                	jne    6446 <memmove+0x47>
+    for(; n >= 4; n -= 4){
+    646d:	eb 16                	jmp    6485 <memmove+0x86>
+      d -= 4;
+    646f:	83 6d fc 04          	subl   $0x4,-0x4(%ebp)
+      s -= 4;
+    6473:	83 6d f8 04          	subl   $0x4,-0x8(%ebp)
+      *(uint*)d = *(uint*)s;
+    6477:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    647a:	8b 10                	mov    (%eax),%edx
+    647c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    647f:	89 10                	mov    %edx,(%eax)
+    for(; n >= 4; n -= 4){
+    6481:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+    6485:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+    6489:	7f e4                	jg     646f <memmove+0x70>
+    }
+    while(n-- > 0)
+    648b:	eb 13                	jmp    64a0 <memmove+0xa1>
+      *--d = *--s;
+    648d:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+    6491:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+    6495:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    6498:	0f b6 10             	movzbl (%eax),%edx
+    649b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    649e:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+    64a0:	8b 45 10             	mov    0x10(%ebp),%eax
+    64a3:	8d 50 ff             	lea    -0x1(%eax),%edx
+    64a6:	89 55 10             	mov    %edx,0x10(%ebp)
+    64a9:	85 c0                	test   %eax,%eax
+    64ab:	7f e0                	jg     648d <memmove+0x8e>
+  if(s < d && s + n > d){
+    64ad:	eb 78                	jmp    6527 <memmove+0x128>
+  } else {
+    if(n >= 16){
+    64af:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+    64b3:	7e 61                	jle    6516 <memmove+0x117>
+      k = -(uint)d & 3;
+    64b5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    64b8:	f7 d8                	neg    %eax
+    64ba:	83 e0 03             	and    $0x3,%eax
+    64bd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      movsb(d, s, k);
+    64c0:	ff 75 f4             	push   -0xc(%ebp)
+    64c3:	ff 75 f8             	push   -0x8(%ebp)
+    64c6:	ff 75 fc             	push   -0x4(%ebp)
+    64c9:	e8 cd fa ff ff       	call   5f9b <movsb>
+    64ce:	83 c4 0c             	add    $0xc,%esp
+      d += k;
+    64d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    64d4:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += k;
+    64d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    64da:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n -= k;
+    64dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    64e0:	29 45 10             	sub    %eax,0x10(%ebp)
+      movsl(d, s, n/4);
+    64e3:	8b 45 10             	mov    0x10(%ebp),%eax
+    64e6:	8d 50 03             	lea    0x3(%eax),%edx
+    64e9:	85 c0                	test   %eax,%eax
+    64eb:	0f 48 c2             	cmovs  %edx,%eax
+    64ee:	c1 f8 02             	sar    $0x2,%eax
+    64f1:	50                   	push   %eax
+    64f2:	ff 75 f8             	push   -0x8(%ebp)
+    64f5:	ff 75 fc             	push   -0x4(%ebp)
+    64f8:	e8 cd fa ff ff       	call   5fca <movsl>
+    64fd:	83 c4 0c             	add    $0xc,%esp
+      d += n & ~3;
+    6500:	8b 45 10             	mov    0x10(%ebp),%eax
+    6503:	83 e0 fc             	and    $0xfffffffc,%eax
+    6506:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += n & ~3;
+    6509:	8b 45 10             	mov    0x10(%ebp),%eax
+    650c:	83 e0 fc             	and    $0xfffffffc,%eax
+    650f:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n &= 3;
+    6512:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+    }
+    movsb(d, s, n);
+    6516:	ff 75 10             	push   0x10(%ebp)
+    6519:	ff 75 f8             	push   -0x8(%ebp)
+    651c:	ff 75 fc             	push   -0x4(%ebp)
+    651f:	e8 77 fa ff ff       	call   5f9b <movsb>
+    6524:	83 c4 0c             	add    $0xc,%esp
+  }
+  return vdst;
+    6527:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    652a:	c9                   	leave
+    652b:	c3                   	ret
+
+0000652c <_fork>:
+    movl %esp, %ecx; \
+    movl $1f, %edx; \
+    sysenter; \
+  1: ret
+
+RAWSYSCALL(fork)
+    652c:	b8 01 00 00 00       	mov    $0x1,%eax
+    6531:	89 e1                	mov    %esp,%ecx
+    6533:	ba 3a 65 00 00       	mov    $0x653a,%edx
+    6538:	0f 34                	sysenter
+    653a:	c3                   	ret
+
+0000653b <_exit>:
+RAWSYSCALL(exit)
+    653b:	b8 02 00 00 00       	mov    $0x2,%eax
+    6540:	89 e1                	mov    %esp,%ecx
+    6542:	ba 49 65 00 00       	mov    $0x6549,%edx
+    6547:	0f 34                	sysenter
+    6549:	c3                   	ret
+
+0000654a <wait>:
+SYSCALL(wait)
+    654a:	b8 03 00 00 00       	mov    $0x3,%eax
+    654f:	89 e1                	mov    %esp,%ecx
+    6551:	ba 58 65 00 00       	mov    $0x6558,%edx
+    6556:	0f 34                	sysenter
+    6558:	c3                   	ret
+
+00006559 <pipe>:
+SYSCALL(pipe)
+    6559:	b8 04 00 00 00       	mov    $0x4,%eax
+    655e:	89 e1                	mov    %esp,%ecx
+    6560:	ba 67 65 00 00       	mov    $0x6567,%edx
+    6565:	0f 34                	sysenter
+    6567:	c3                   	ret
+
+00006568 <read>:
+SYSCALL(read)
+    6568:	b8 05 00 00 00       	mov    $0x5,%eax
+    656d:	89 e1                	mov    %esp,%ecx
+    656f:	ba 76 65 00 00       	mov    $0x6576,%edx
+    6574:	0f 34                	sysenter
+    6576:	c3                   	ret
+
+00006577 <write>:
+SYSCALL(write)
+    6577:	b8 10 00 00 00       	mov    $0x10,%eax
+    657c:	89 e1                	mov    %esp,%ecx
+    657e:	ba 85 65 00 00       	mov    $0x6585,%edx
+    6583:	0f 34                	sysenter
+    6585:	c3                   	ret
+
+00006586 <_close>:
+RAWSYSCALL(close)
+    6586:	b8 15 00 00 00       	mov    $0x15,%eax
+    658b:	89 e1                	mov    %esp,%ecx
+    658d:	ba 94 65 00 00       	mov    $0x6594,%edx
+    6592:	0f 34                	sysenter
+    6594:	c3                   	ret
+
+00006595 <kill>:
+SYSCALL(kill)
+    6595:	b8 06 00 00 00       	mov    $0x6,%eax
+    659a:	89 e1                	mov    %esp,%ecx
+    659c:	ba a3 65 00 00       	mov    $0x65a3,%edx
+    65a1:	0f 34                	sysenter
+    65a3:	c3                   	ret
+
+000065a4 <_exec>:
+RAWSYSCALL(exec)
+    65a4:	b8 07 00 00 00       	mov    $0x7,%eax
+    65a9:	89 e1                	mov    %esp,%ecx
+    65ab:	ba b2 65 00 00       	mov    $0x65b2,%edx
+    65b0:	0f 34                	sysenter
+    65b2:	c3                   	ret
+
+000065b3 <open>:
+SYSCALL(open)
+    65b3:	b8 0f 00 00 00       	mov    $0xf,%eax
+    65b8:	89 e1                	mov    %esp,%ecx
+    65ba:	ba c1 65 00 00       	mov    $0x65c1,%edx
+    65bf:	0f 34                	sysenter
+    65c1:	c3                   	ret
+
+000065c2 <mknod>:
+SYSCALL(mknod)
+    65c2:	b8 11 00 00 00       	mov    $0x11,%eax
+    65c7:	89 e1                	mov    %esp,%ecx
+    65c9:	ba d0 65 00 00       	mov    $0x65d0,%edx
+    65ce:	0f 34                	sysenter
+    65d0:	c3                   	ret
+
+000065d1 <unlink>:
+SYSCALL(unlink)
+    65d1:	b8 12 00 00 00       	mov    $0x12,%eax
+    65d6:	89 e1                	mov    %esp,%ecx
+    65d8:	ba df 65 00 00       	mov    $0x65df,%edx
+    65dd:	0f 34                	sysenter
+    65df:	c3                   	ret
+
+000065e0 <fstat>:
+SYSCALL(fstat)
+    65e0:	b8 08 00 00 00       	mov    $0x8,%eax
+    65e5:	89 e1                	mov    %esp,%ecx
+    65e7:	ba ee 65 00 00       	mov    $0x65ee,%edx
+    65ec:	0f 34                	sysenter
+    65ee:	c3                   	ret
+
+000065ef <link>:
+SYSCALL(link)
+    65ef:	b8 13 00 00 00       	mov    $0x13,%eax
+    65f4:	89 e1                	mov    %esp,%ecx
+    65f6:	ba fd 65 00 00       	mov    $0x65fd,%edx
+    65fb:	0f 34                	sysenter
+    65fd:	c3                   	ret
+
+000065fe <mkdir>:
+SYSCALL(mkdir)
+    65fe:	b8 14 00 00 00       	mov    $0x14,%eax
+    6603:	89 e1                	mov    %esp,%ecx
+    6605:	ba 0c 66 00 00       	mov    $0x660c,%edx
+    660a:	0f 34                	sysenter
+    660c:	c3                   	ret
+
+0000660d <chdir>:
+SYSCALL(chdir)
+    660d:	b8 09 00 00 00       	mov    $0x9,%eax
+    6612:	89 e1                	mov    %esp,%ecx
+    6614:	ba 1b 66 00 00       	mov    $0x661b,%edx
+    6619:	0f 34                	sysenter
+    661b:	c3                   	ret
+
+0000661c <dup>:
+SYSCALL(dup)
+    661c:	b8 0a 00 00 00       	mov    $0xa,%eax
+    6621:	89 e1                	mov    %esp,%ecx
+    6623:	ba 2a 66 00 00       	mov    $0x662a,%edx
+    6628:	0f 34                	sysenter
+    662a:	c3                   	ret
+
+0000662b <getpid>:
+SYSCALL(getpid)
+    662b:	b8 0b 00 00 00       	mov    $0xb,%eax
+    6630:	89 e1                	mov    %esp,%ecx
+    6632:	ba 39 66 00 00       	mov    $0x6639,%edx
+    6637:	0f 34                	sysenter
+    6639:	c3                   	ret
+
+0000663a <sbrk>:
+SYSCALL(sbrk)
+    663a:	b8 0c 00 00 00       	mov    $0xc,%eax
+    663f:	89 e1                	mov    %esp,%ecx
+    6641:	ba 48 66 00 00       	mov    $0x6648,%edx
+    6646:	0f 34                	sysenter
+    6648:	c3                   	ret
+
+00006649 <sleep>:
+SYSCALL(sleep)
+    6649:	b8 0d 00 00 00       	mov    $0xd,%eax
+    664e:	89 e1                	mov    %esp,%ecx
+    6650:	ba 57 66 00 00       	mov    $0x6657,%edx
+    6655:	0f 34                	sysenter
+    6657:	c3                   	ret
+
+00006658 <uptime>:
+SYSCALL(uptime)
+    6658:	b8 0e 00 00 00       	mov    $0xe,%eax
+    665d:	89 e1                	mov    %esp,%ecx
+    665f:	ba 66 66 00 00       	mov    $0x6666,%edx
+    6664:	0f 34                	sysenter
+    6666:	c3                   	ret
+
+00006667 <getproc>:
+SYSCALL(getproc)
+    6667:	b8 16 00 00 00       	mov    $0x16,%eax
+    666c:	89 e1                	mov    %esp,%ecx
+    666e:	ba 75 66 00 00       	mov    $0x6675,%edx
+    6673:	0f 34                	sysenter
+    6675:	c3                   	ret
+
+00006676 <getpgs>:
+SYSCALL(getpgs)
+    6676:	b8 17 00 00 00       	mov    $0x17,%eax
+    667b:	89 e1                	mov    %esp,%ecx
+    667d:	ba 84 66 00 00       	mov    $0x6684,%edx
+    6682:	0f 34                	sysenter
+    6684:	c3                   	ret
+
+00006685 <loadproc>:
+SYSCALL(loadproc)
+    6685:	b8 18 00 00 00       	mov    $0x18,%eax
+    668a:	89 e1                	mov    %esp,%ecx
+    668c:	ba 93 66 00 00       	mov    $0x6693,%edx
+    6691:	0f 34                	sysenter
+    6693:	c3                   	ret
+
+00006694 <iosubmit>:
+SYSCALL(iosubmit)
+    6694:	b8 19 00 00 00       	mov    $0x19,%eax
+    6699:	89 e1                	mov    %esp,%ecx
+    669b:	ba a2 66 00 00       	mov    $0x66a2,%edx
+    66a0:	0f 34                	sysenter
+    66a2:	c3                   	ret
+
+000066a3 <sysstat>:
+SYSCALL(sysstat)
+    66a3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    66a8:	89 e1                	mov    %esp,%ecx
+    66aa:	ba b1 66 00 00       	mov    $0x66b1,%edx
+    66af:	0f 34                	sysenter
+    66b1:	c3                   	ret
+
+000066b2 <splice>:
+SYSCALL(splice)
+    66b2:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    66b7:	89 e1                	mov    %esp,%ecx
+    66b9:	ba c0 66 00 00       	mov    $0x66c0,%edx
+    66be:	0f 34                	sysenter
+    66c0:	c3                   	ret
+
+000066c1 <fsync>:
+SYSCALL(fsync)
+    66c1:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    66c6:	89 e1                	mov    %esp,%ecx
+    66c8:	ba cf 66 00 00       	mov    $0x66cf,%edx
+    66cd:	0f 34                	sysenter
+    66cf:	c3                   	ret
+
+000066d0 <fdatasync>:
+SYSCALL(fdatasync)
+    66d0:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    66d5:	89 e1                	mov    %esp,%ecx
+    66d7:	ba de 66 00 00       	mov    $0x66de,%edx
+    66dc:	0f 34                	sysenter
+    66de:	c3                   	ret
+
+000066df <lseek>:
+SYSCALL(lseek)
+    66df:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    66e4:	89 e1                	mov    %esp,%ecx
+    66e6:	ba ed 66 00 00       	mov    $0x66ed,%edx
+    66eb:	0f 34                	sysenter
+    66ed:	c3                   	ret
+
+000066ee <dmesg>:
+SYSCALL(dmesg)
+    66ee:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    66f3:	89 e1                	mov    %esp,%ecx
+    66f5:	ba fc 66 00 00       	mov    $0x66fc,%edx
+    66fa:	0f 34                	sysenter
+    66fc:	c3                   	ret
+
+000066fd <lockstat>:
+SYSCALL(lockstat)
+    66fd:	b8 20 00 00 00       	mov    $0x20,%eax
+    6702:	89 e1                	mov    %esp,%ecx
+    6704:	ba 0b 67 00 00       	mov    $0x670b,%edx
+    6709:	0f 34                	sysenter
+    670b:	c3                   	ret
+
+0000670c <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    670c:	55                   	push   %ebp
+    670d:	89 e5                	mov    %esp,%ebp
+    670f:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    6712:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+    6719:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+    671d:	74 17                	je     6736 <printint+0x2a>
+    671f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    6723:	79 11                	jns    6736 <printint+0x2a>
+    neg = 1;
+    6725:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+    672c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    672f:	f7 d8                	neg    %eax
+    6731:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    6734:	eb 06                	jmp    673c <printint+0x30>
+  } else {
+    x = xx;
+    6736:	8b 45 0c             	mov    0xc(%ebp),%eax
+    6739:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+    673c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+    6743:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    6746:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    6749:	ba 00 00 00 00       	mov    $0x0,%edx
+    674e:	f7 f1                	div    %ecx
+    6750:	89 d1                	mov    %edx,%ecx
+    6752:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6755:	8d 50 01             	lea    0x1(%eax),%edx
+    6758:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    675b:	0f b6 91 50 9e 00 00 	movzbl 0x9e50(%ecx),%edx
+    6762:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+    6766:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    6769:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    676c:	ba 00 00 00 00       	mov    $0x0,%edx
+    6771:	f7 f1                	div    %ecx
+    6773:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    6776:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    677a:	75 c7                	jne    6743 <printint+0x37>
+  if(neg)
+    677c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    6780:	74 2d                	je     67af <printint+0xa3>
+    buf[i++] = '-';
+    6782:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6785:	8d 50 01             	lea    0x1(%eax),%edx
+    6788:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    678b:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+    6790:	eb 1d                	jmp    67af <printint+0xa3>
+    fputc(fd, buf[i]);
+    6792:	8d 55 dc             	lea    -0x24(%ebp),%edx
+    6795:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6798:	01 d0                	add    %edx,%eax
+    679a:	0f b6 00             	movzbl (%eax),%eax
+    679d:	0f be c0             	movsbl %al,%eax
+    67a0:	83 ec 08             	sub    $0x8,%esp
+    67a3:	50                   	push   %eax
+    67a4:	ff 75 08             	push   0x8(%ebp)
+    67a7:	e8 f8 08 00 00       	call   70a4 <fputc>
+    67ac:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+    67af:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    67b3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    67b7:	79 d9                	jns    6792 <printint+0x86>
+}
+    67b9:	90                   	nop
+    67ba:	90                   	nop
+    67bb:	c9                   	leave
+    67bc:	c3                   	ret
+
+000067bd <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    67bd:	55                   	push   %ebp
+    67be:	89 e5                	mov    %esp,%ebp
+    67c0:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+    67c3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+    67ca:	8d 45 0c             	lea    0xc(%ebp),%eax
+    67cd:	83 c0 04             	add    $0x4,%eax
+    67d0:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+    67d3:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    67da:	e9 4a 01 00 00       	jmp    6929 <printf+0x16c>
+    c = fmt[i] & 0xff;
+    67df:	8b 55 0c             	mov    0xc(%ebp),%edx
+    67e2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    67e5:	01 d0                	add    %edx,%eax
+    67e7:	0f b6 00             	movzbl (%eax),%eax
+    67ea:	0f be c0             	movsbl %al,%eax
+    67ed:	25 ff 00 00 00       	and    $0xff,%eax
+    67f2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+    67f5:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    67f9:	75 28                	jne    6823 <printf+0x66>
+      if(c == '%'){
+    67fb:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    67ff:	75 0c                	jne    680d <printf+0x50>
+        state = '%';
+    6801:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+    6808:	e9 18 01 00 00       	jmp    6925 <printf+0x168>
+      } else {
+        fputc(fd, c);
+    680d:	83 ec 08             	sub    $0x8,%esp
+    6810:	ff 75 e4             	push   -0x1c(%ebp)
+    6813:	ff 75 08             	push   0x8(%ebp)
+    6816:	e8 89 08 00 00       	call   70a4 <fputc>
+    681b:	83 c4 10             	add    $0x10,%esp
+    681e:	e9 02 01 00 00       	jmp    6925 <printf+0x168>
+      }
+    } else if(state == '%'){
+    6823:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+    6827:	0f 85 f8 00 00 00    	jne    6925 <printf+0x168>
+      if(c == 'd'){
+    682d:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+    6831:	75 1e                	jne    6851 <printf+0x94>
+        printint(fd, *ap, 10, 1);
+    6833:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    6836:	8b 00                	mov    (%eax),%eax
+    6838:	6a 01                	push   $0x1
+    683a:	6a 0a                	push   $0xa
+    683c:	50                   	push   %eax
+    683d:	ff 75 08             	push   0x8(%ebp)
+    6840:	e8 c7 fe ff ff       	call   670c <printint>
+    6845:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    6848:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    684c:	e9 cd 00 00 00       	jmp    691e <printf+0x161>
+      } else if(c == 'x' || c == 'p'){
+    6851:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+    6855:	74 06                	je     685d <printf+0xa0>
+    6857:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+    685b:	75 1e                	jne    687b <printf+0xbe>
+        printint(fd, *ap, 16, 0);
+    685d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    6860:	8b 00                	mov    (%eax),%eax
+    6862:	6a 00                	push   $0x0
+    6864:	6a 10                	push   $0x10
+    6866:	50                   	push   %eax
+    6867:	ff 75 08             	push   0x8(%ebp)
+    686a:	e8 9d fe ff ff       	call   670c <printint>
+    686f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    6872:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    6876:	e9 a3 00 00 00       	jmp    691e <printf+0x161>
+      } else if(c == 's'){
+    687b:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+    687f:	75 43                	jne    68c4 <printf+0x107>
+        s = (char*)*ap;
+    6881:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    6884:	8b 00                	mov    (%eax),%eax
+    6886:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+    6889:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+    688d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    6891:	75 25                	jne    68b8 <printf+0xfb>
+          s = "(null)";
+    6893:	c7 45 f4 1a 93 00 00 	movl   $0x931a,-0xc(%ebp)
+        while(*s != 0){
+    689a:	eb 1c                	jmp    68b8 <printf+0xfb>
+          fputc(fd, *s);
+    689c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    689f:	0f b6 00             	movzbl (%eax),%eax
+    68a2:	0f be c0             	movsbl %al,%eax
+    68a5:	83 ec 08             	sub    $0x8,%esp
+    68a8:	50                   	push   %eax
+    68a9:	ff 75 08             	push   0x8(%ebp)
+    68ac:	e8 f3 07 00 00       	call   70a4 <fputc>
+    68b1:	83 c4 10             	add    $0x10,%esp
+          s++;
+    68b4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+    68b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    68bb:	0f b6 00             	movzbl (%eax),%eax
+    68be:	84 c0                	test   %al,%al
+    68c0:	75 da                	jne    689c <printf+0xdf>
+    68c2:	eb 5a                	jmp    691e <printf+0x161>
+        }
+      } else if(c == 'c'){
+    68c4:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+    68c8:	75 1a                	jne    68e4 <printf+0x127>
+        fputc(fd, *ap);
+    68ca:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    68cd:	8b 00                	mov    (%eax),%eax
+    68cf:	83 ec 08             	sub    $0x8,%esp
+    68d2:	50                   	push   %eax
+    68d3:	ff 75 08             	push   0x8(%ebp)
+    68d6:	e8 c9 07 00 00       	call   70a4 <fputc>
+    68db:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    68de:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    68e2:	eb 3a                	jmp    691e <printf+0x161>
+      } else if(c == '%'){
+    68e4:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    68e8:	75 13                	jne    68fd <printf+0x140>
+        fputc(fd, c);
+    68ea:	83 ec 08             	sub    $0x8,%esp
+    68ed:	ff 75 e4             	push   -0x1c(%ebp)
+    68f0:	ff 75 08             	push   0x8(%ebp)
+    68f3:	e8 ac 07 00 00       	call   70a4 <fputc>
+    68f8:	83 c4 10             	add    $0x10,%esp
+    68fb:	eb 21                	jmp    691e <printf+0x161>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        fputc(fd, '%');
+    68fd:	83 ec 08             	sub    $0x8,%esp
+    6900:	6a 25                	push   $0x25
+    6902:	ff 75 08             	push   0x8(%ebp)
+    6905:	e8 9a 07 00 00       	call   70a4 <fputc>
+    690a:	83 c4 10             	add    $0x10,%esp
+        fputc(fd, c);
+    690d:	83 ec 08             	sub    $0x8,%esp
+    6910:	ff 75 e4             	push   -0x1c(%ebp)
+    6913:	ff 75 08             	push   0x8(%ebp)
+    6916:	e8 89 07 00 00       	call   70a4 <fputc>
+    691b:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+    691e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+    6925:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    6929:	8b 55 0c             	mov    0xc(%ebp),%edx
+    692c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    692f:	01 d0                	add    %edx,%eax
+    6931:	0f b6 00             	movzbl (%eax),%eax
+    6934:	84 c0                	test   %al,%al
+    6936:	0f 85 a3 fe ff ff    	jne    67df <printf+0x22>
+    }
+  }
+}
+    693c:	90                   	nop
+    693d:	90                   	nop
+    693e:	c9                   	leave
+    693f:	c3                   	ret
+
+00006940 <binof>:
+static struct chunk *bins[NBIN];       // free large chunks
+static struct chunk *top;              // end marker of newest heap segment
+
+static int
+binof(uint size)
+{
+    6940:	55                   	push   %ebp
+    6941:	89 e5                	mov    %esp,%ebp
+    6943:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  i = 0;
+    6946:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+    694d:	c1 6d 08 05          	shrl   $0x5,0x8(%ebp)
+    6951:	eb 07                	jmp    695a <binof+0x1a>
+    i++;
+    6953:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+    6957:	d1 6d 08             	shrl   0x8(%ebp)
+    695a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    695e:	74 06                	je     6966 <binof+0x26>
+    6960:	83 7d fc 19          	cmpl   $0x19,-0x4(%ebp)
+    6964:	7e ed                	jle    6953 <binof+0x13>
+  return i;
+    6966:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    6969:	c9                   	leave
+    696a:	c3                   	ret
+
+0000696b <bininsert>:
+
+static void
+bininsert(struct chunk *c)
+{
+    696b:	55                   	push   %ebp
+    696c:	89 e5                	mov    %esp,%ebp
+    696e:	83 ec 10             	sub    $0x10,%esp
+  struct chunk **b;
+
+  b = &bins[binof(CSIZE(c))];
+    6971:	8b 45 08             	mov    0x8(%ebp),%eax
+    6974:	8b 00                	mov    (%eax),%eax
+    6976:	83 e0 f8             	and    $0xfffffff8,%eax
+    6979:	50                   	push   %eax
+    697a:	e8 c1 ff ff ff       	call   6940 <binof>
+    697f:	83 c4 04             	add    $0x4,%esp
+    6982:	c1 e0 02             	shl    $0x2,%eax
+    6985:	05 00 f5 00 00       	add    $0xf500,%eax
+    698a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c->prev = 0;
+    698d:	8b 45 08             	mov    0x8(%ebp),%eax
+    6990:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  c->next = *b;
+    6997:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    699a:	8b 10                	mov    (%eax),%edx
+    699c:	8b 45 08             	mov    0x8(%ebp),%eax
+    699f:	89 50 08             	mov    %edx,0x8(%eax)
+  if(*b)
+    69a2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    69a5:	8b 00                	mov    (%eax),%eax
+    69a7:	85 c0                	test   %eax,%eax
+    69a9:	74 0b                	je     69b6 <bininsert+0x4b>
+    (*b)->prev = c;
+    69ab:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    69ae:	8b 00                	mov    (%eax),%eax
+    69b0:	8b 55 08             	mov    0x8(%ebp),%edx
+    69b3:	89 50 0c             	mov    %edx,0xc(%eax)
+  *b = c;
+    69b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    69b9:	8b 55 08             	mov    0x8(%ebp),%edx
+    69bc:	89 10                	mov    %edx,(%eax)
+}
+    69be:	90                   	nop
+    69bf:	c9                   	leave
+    69c0:	c3                   	ret
+
+000069c1 <binremove>:
+
+static void
+binremove(struct chunk *c)
+{
+    69c1:	55                   	push   %ebp
+    69c2:	89 e5                	mov    %esp,%ebp
+  if(c->prev)
+    69c4:	8b 45 08             	mov    0x8(%ebp),%eax
+    69c7:	8b 40 0c             	mov    0xc(%eax),%eax
+    69ca:	85 c0                	test   %eax,%eax
+    69cc:	74 11                	je     69df <binremove+0x1e>
+    c->prev->next = c->next;
+    69ce:	8b 45 08             	mov    0x8(%ebp),%eax
+    69d1:	8b 40 0c             	mov    0xc(%eax),%eax
+    69d4:	8b 55 08             	mov    0x8(%ebp),%edx
+    69d7:	8b 52 08             	mov    0x8(%edx),%edx
+    69da:	89 50 08             	mov    %edx,0x8(%eax)
+    69dd:	eb 1e                	jmp    69fd <binremove+0x3c>
+  else
+    bins[binof(CSIZE(c))] = c->next;
+    69df:	8b 45 08             	mov    0x8(%ebp),%eax
+    69e2:	8b 00                	mov    (%eax),%eax
+    69e4:	83 e0 f8             	and    $0xfffffff8,%eax
+    69e7:	50                   	push   %eax
+    69e8:	e8 53 ff ff ff       	call   6940 <binof>
+    69ed:	83 c4 04             	add    $0x4,%esp
+    69f0:	8b 55 08             	mov    0x8(%ebp),%edx
+    69f3:	8b 52 08             	mov    0x8(%edx),%edx
+    69f6:	89 14 85 00 f5 00 00 	mov    %edx,0xf500(,%eax,4)
+  if(c->next)
+    69fd:	8b 45 08             	mov    0x8(%ebp),%eax
+    6a00:	8b 40 08             	mov    0x8(%eax),%eax
+    6a03:	85 c0                	test   %eax,%eax
+    6a05:	74 0f                	je     6a16 <binremove+0x55>
+    c->next->prev = c->prev;
+    6a07:	8b 45 08             	mov    0x8(%ebp),%eax
+    6a0a:	8b 40 08             	mov    0x8(%eax),%eax
+    6a0d:	8b 55 08             	mov    0x8(%ebp),%edx
+    6a10:	8b 52 0c             	mov    0xc(%edx),%edx
+    6a13:	89 50 0c             	mov    %edx,0xc(%eax)
+}
+    6a16:	90                   	nop
+    6a17:	c9                   	leave
+    6a18:	c3                   	ret
+
+00006a19 <freechunk>:
+
+// Free chunk c, merging it with free neighbors.  If trim is
+// set and the result is big and at the break, give it back.
+static void
+freechunk(struct chunk *c, int trim)
+{
+    6a19:	55                   	push   %ebp
+    6a1a:	89 e5                	mov    %esp,%ebp
+    6a1c:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *p, *n;
+  uint size;
+
+  size = CSIZE(c);
+    6a1f:	8b 45 08             	mov    0x8(%ebp),%eax
+    6a22:	8b 00                	mov    (%eax),%eax
+    6a24:	83 e0 f8             	and    $0xfffffff8,%eax
+    6a27:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  n = NEXTC(c);
+    6a2a:	8b 45 08             	mov    0x8(%ebp),%eax
+    6a2d:	8b 00                	mov    (%eax),%eax
+    6a2f:	83 e0 f8             	and    $0xfffffff8,%eax
+    6a32:	89 c2                	mov    %eax,%edx
+    6a34:	8b 45 08             	mov    0x8(%ebp),%eax
+    6a37:	01 d0                	add    %edx,%eax
+    6a39:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(!(c->size & PREVUSED)){
+    6a3c:	8b 45 08             	mov    0x8(%ebp),%eax
+    6a3f:	8b 00                	mov    (%eax),%eax
+    6a41:	83 e0 02             	and    $0x2,%eax
+    6a44:	85 c0                	test   %eax,%eax
+    6a46:	75 30                	jne    6a78 <freechunk+0x5f>
+    p = (struct chunk*)((char*)c - *((uint*)c - 1));
+    6a48:	8b 45 08             	mov    0x8(%ebp),%eax
+    6a4b:	83 e8 04             	sub    $0x4,%eax
+    6a4e:	8b 00                	mov    (%eax),%eax
+    6a50:	f7 d8                	neg    %eax
+    6a52:	89 c2                	mov    %eax,%edx
+    6a54:	8b 45 08             	mov    0x8(%ebp),%eax
+    6a57:	01 d0                	add    %edx,%eax
+    6a59:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    binremove(p);
+    6a5c:	ff 75 ec             	push   -0x14(%ebp)
+    6a5f:	e8 5d ff ff ff       	call   69c1 <binremove>
+    6a64:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(p);
+    6a67:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    6a6a:	8b 00                	mov    (%eax),%eax
+    6a6c:	83 e0 f8             	and    $0xfffffff8,%eax
+    6a6f:	01 45 f4             	add    %eax,-0xc(%ebp)
+    c = p;
+    6a72:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    6a75:	89 45 08             	mov    %eax,0x8(%ebp)
+  }
+  if(!(n->size & USED)){
+    6a78:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    6a7b:	8b 00                	mov    (%eax),%eax
+    6a7d:	83 e0 01             	and    $0x1,%eax
+    6a80:	85 c0                	test   %eax,%eax
+    6a82:	75 16                	jne    6a9a <freechunk+0x81>
+    binremove(n);
+    6a84:	ff 75 f0             	push   -0x10(%ebp)
+    6a87:	e8 35 ff ff ff       	call   69c1 <binremove>
+    6a8c:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(n);
+    6a8f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    6a92:	8b 00                	mov    (%eax),%eax
+    6a94:	83 e0 f8             	and    $0xfffffff8,%eax
+    6a97:	01 45 f4             	add    %eax,-0xc(%ebp)
+  }
+  // Free chunks are never adjacent, so the one below is in use.
+  c->size = size | PREVUSED;
+    6a9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6a9d:	83 c8 02             	or     $0x2,%eax
+    6aa0:	89 c2                	mov    %eax,%edx
+    6aa2:	8b 45 08             	mov    0x8(%ebp),%eax
+    6aa5:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+    6aa7:	8b 45 08             	mov    0x8(%ebp),%eax
+    6aaa:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  FOOTER(c) = size;
+    6ab1:	8b 45 08             	mov    0x8(%ebp),%eax
+    6ab4:	8b 00                	mov    (%eax),%eax
+    6ab6:	83 e0 f8             	and    $0xfffffff8,%eax
+    6ab9:	8d 50 fc             	lea    -0x4(%eax),%edx
+    6abc:	8b 45 08             	mov    0x8(%ebp),%eax
+    6abf:	01 c2                	add    %eax,%edx
+    6ac1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6ac4:	89 02                	mov    %eax,(%edx)
+  n = NEXTC(c);
+    6ac6:	8b 45 08             	mov    0x8(%ebp),%eax
+    6ac9:	8b 00                	mov    (%eax),%eax
+    6acb:	83 e0 f8             	and    $0xfffffff8,%eax
+    6ace:	89 c2                	mov    %eax,%edx
+    6ad0:	8b 45 08             	mov    0x8(%ebp),%eax
+    6ad3:	01 d0                	add    %edx,%eax
+    6ad5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  n->size &= ~PREVUSED;
+    6ad8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    6adb:	8b 00                	mov    (%eax),%eax
+    6add:	83 e0 fd             	and    $0xfffffffd,%eax
+    6ae0:	89 c2                	mov    %eax,%edx
+    6ae2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    6ae5:	89 10                	mov    %edx,(%eax)
+
+  if(trim && n == top && size >= TRIMSIZE && sbrk(0) == (char*)top + HDRSIZE){
+    6ae7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    6aeb:	74 51                	je     6b3e <freechunk+0x125>
+    6aed:	a1 6c f5 00 00       	mov    0xf56c,%eax
+    6af2:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+    6af5:	75 47                	jne    6b3e <freechunk+0x125>
+    6af7:	81 7d f4 ff 7f 00 00 	cmpl   $0x7fff,-0xc(%ebp)
+    6afe:	76 3e                	jbe    6b3e <freechunk+0x125>
+    6b00:	83 ec 0c             	sub    $0xc,%esp
+    6b03:	6a 00                	push   $0x0
+    6b05:	e8 30 fb ff ff       	call   663a <sbrk>
+    6b0a:	83 c4 10             	add    $0x10,%esp
+    6b0d:	8b 15 6c f5 00 00    	mov    0xf56c,%edx
+    6b13:	83 c2 08             	add    $0x8,%edx
+    6b16:	39 d0                	cmp    %edx,%eax
+    6b18:	75 24                	jne    6b3e <freechunk+0x125>
+    c->size = USED | PREVUSED;
+    6b1a:	8b 45 08             	mov    0x8(%ebp),%eax
+    6b1d:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+    top = c;
+    6b23:	8b 45 08             	mov    0x8(%ebp),%eax
+    6b26:	a3 6c f5 00 00       	mov    %eax,0xf56c
+    sbrk(-size);
+    6b2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6b2e:	f7 d8                	neg    %eax
+    6b30:	83 ec 0c             	sub    $0xc,%esp
+    6b33:	50                   	push   %eax
+    6b34:	e8 01 fb ff ff       	call   663a <sbrk>
+    6b39:	83 c4 10             	add    $0x10,%esp
+    return;
+    6b3c:	eb 0e                	jmp    6b4c <freechunk+0x133>
+  }
+  bininsert(c);
+    6b3e:	83 ec 0c             	sub    $0xc,%esp
+    6b41:	ff 75 08             	push   0x8(%ebp)
+    6b44:	e8 22 fe ff ff       	call   696b <bininsert>
+    6b49:	83 c4 10             	add    $0x10,%esp
+}
+    6b4c:	c9                   	leave
+    6b4d:	c3                   	ret
+
+00006b4e <morecore>:
+
+// Grow the heap by at least need bytes.
+static int
+morecore(uint need)
+{
+    6b4e:	55                   	push   %ebp
+    6b4f:	89 e5                	mov    %esp,%ebp
+    6b51:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+  char *p;
+  uint n, pad;
+
+  n = need + MINCHUNK;
+    6b54:	8b 45 08             	mov    0x8(%ebp),%eax
+    6b57:	83 c0 18             	add    $0x18,%eax
+    6b5a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(n < MINCORE)
+    6b5d:	81 7d ec ff 3f 00 00 	cmpl   $0x3fff,-0x14(%ebp)
+    6b64:	77 07                	ja     6b6d <morecore+0x1f>
+    n = MINCORE;
+    6b66:	c7 45 ec 00 40 00 00 	movl   $0x4000,-0x14(%ebp)
+  // Keep the break 8-aligned, with the end marker just below it.
+  pad = (8 - ((uint)sbrk(0) & 7)) & 7;
+    6b6d:	83 ec 0c             	sub    $0xc,%esp
+    6b70:	6a 00                	push   $0x0
+    6b72:	e8 c3 fa ff ff       	call   663a <sbrk>
+    6b77:	83 c4 10             	add    $0x10,%esp
+    6b7a:	83 e0 07             	and    $0x7,%eax
+    6b7d:	ba 08 00 00 00       	mov    $0x8,%edx
+    6b82:	29 c2                	sub    %eax,%edx
+    6b84:	89 d0                	mov    %edx,%eax
+    6b86:	83 e0 07             	and    $0x7,%eax
+    6b89:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if((p = sbrk(pad + n)) == (char*)-1){
+    6b8c:	8b 55 e8             	mov    -0x18(%ebp),%edx
+    6b8f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    6b92:	01 d0                	add    %edx,%eax
+    6b94:	83 ec 0c             	sub    $0xc,%esp
+    6b97:	50                   	push   %eax
+    6b98:	e8 9d fa ff ff       	call   663a <sbrk>
+    6b9d:	83 c4 10             	add    $0x10,%esp
+    6ba0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    6ba3:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+    6ba7:	75 30                	jne    6bd9 <morecore+0x8b>
+    n = need + MINCHUNK;
+    6ba9:	8b 45 08             	mov    0x8(%ebp),%eax
+    6bac:	83 c0 18             	add    $0x18,%eax
+    6baf:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((p = sbrk(pad + n)) == (char*)-1)
+    6bb2:	8b 55 e8             	mov    -0x18(%ebp),%edx
+    6bb5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    6bb8:	01 d0                	add    %edx,%eax
+    6bba:	83 ec 0c             	sub    $0xc,%esp
+    6bbd:	50                   	push   %eax
+    6bbe:	e8 77 fa ff ff       	call   663a <sbrk>
+    6bc3:	83 c4 10             	add    $0x10,%esp
+    6bc6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    6bc9:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+    6bcd:	75 0a                	jne    6bd9 <morecore+0x8b>
+      return -1;
+    6bcf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    6bd4:	e9 8e 00 00 00       	jmp    6c67 <morecore+0x119>
+  }
+  p += pad;
+    6bd9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    6bdc:	01 45 f0             	add    %eax,-0x10(%ebp)
+  if(top && p == (char*)top + HDRSIZE){
+    6bdf:	a1 6c f5 00 00       	mov    0xf56c,%eax
+    6be4:	85 c0                	test   %eax,%eax
+    6be6:	74 29                	je     6c11 <morecore+0xc3>
+    6be8:	a1 6c f5 00 00       	mov    0xf56c,%eax
+    6bed:	83 c0 08             	add    $0x8,%eax
+    6bf0:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+    6bf3:	75 1c                	jne    6c11 <morecore+0xc3>
+    // Contiguous: the old end marker heads the new chunk.
+    c = top;
+    6bf5:	a1 6c f5 00 00       	mov    0xf56c,%eax
+    6bfa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = n | (c->size & PREVUSED);
+    6bfd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6c00:	8b 00                	mov    (%eax),%eax
+    6c02:	83 e0 02             	and    $0x2,%eax
+    6c05:	0b 45 ec             	or     -0x14(%ebp),%eax
+    6c08:	89 c2                	mov    %eax,%edx
+    6c0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6c0d:	89 10                	mov    %edx,(%eax)
+    6c0f:	eb 16                	jmp    6c27 <morecore+0xd9>
+  } else {
+    // Someone else moved the break: start a new segment.
+    c = (struct chunk*)p;
+    6c11:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    6c14:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = (n - HDRSIZE) | PREVUSED;
+    6c17:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    6c1a:	83 e8 08             	sub    $0x8,%eax
+    6c1d:	83 c8 02             	or     $0x2,%eax
+    6c20:	89 c2                	mov    %eax,%edx
+    6c22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6c25:	89 10                	mov    %edx,(%eax)
+  }
+  top = NEXTC(c);
+    6c27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6c2a:	8b 00                	mov    (%eax),%eax
+    6c2c:	83 e0 f8             	and    $0xfffffff8,%eax
+    6c2f:	89 c2                	mov    %eax,%edx
+    6c31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6c34:	01 d0                	add    %edx,%eax
+    6c36:	a3 6c f5 00 00       	mov    %eax,0xf56c
+  top->size = USED;
+    6c3b:	a1 6c f5 00 00       	mov    0xf56c,%eax
+    6c40:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  top->tag = LARGE;
+    6c46:	a1 6c f5 00 00       	mov    0xf56c,%eax
+    6c4b:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  freechunk(c, 0);
+    6c52:	83 ec 08             	sub    $0x8,%esp
+    6c55:	6a 00                	push   $0x0
+    6c57:	ff 75 f4             	push   -0xc(%ebp)
+    6c5a:	e8 ba fd ff ff       	call   6a19 <freechunk>
+    6c5f:	83 c4 10             	add    $0x10,%esp
+  return 0;
+    6c62:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    6c67:	c9                   	leave
+    6c68:	c3                   	ret
+
+00006c69 <largealloc>:
+
+static void*
+largealloc(uint nbytes)
+{
+    6c69:	55                   	push   %ebp
+    6c6a:	89 e5                	mov    %esp,%ebp
+    6c6c:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c, *r;
+  uint need;
+  int i;
+
+  if(nbytes > 0x7fffffff)
+    6c6f:	8b 45 08             	mov    0x8(%ebp),%eax
+    6c72:	85 c0                	test   %eax,%eax
+    6c74:	79 0a                	jns    6c80 <largealloc+0x17>
+    return 0;
+    6c76:	b8 00 00 00 00       	mov    $0x0,%eax
+    6c7b:	e9 43 01 00 00       	jmp    6dc3 <largealloc+0x15a>
+  need = (nbytes + HDRSIZE + 7) & ~7;
+    6c80:	8b 45 08             	mov    0x8(%ebp),%eax
+    6c83:	83 c0 0f             	add    $0xf,%eax
+    6c86:	83 e0 f8             	and    $0xfffffff8,%eax
+    6c89:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(need < MINCHUNK)
+    6c8c:	83 7d f0 17          	cmpl   $0x17,-0x10(%ebp)
+    6c90:	77 07                	ja     6c99 <largealloc+0x30>
+    need = MINCHUNK;
+    6c92:	c7 45 f0 18 00 00 00 	movl   $0x18,-0x10(%ebp)
+  for(;;){
+    for(i = binof(need); i < NBIN; i++)
+    6c99:	ff 75 f0             	push   -0x10(%ebp)
+    6c9c:	e8 9f fc ff ff       	call   6940 <binof>
+    6ca1:	83 c4 04             	add    $0x4,%esp
+    6ca4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    6ca7:	eb 2f                	jmp    6cd8 <largealloc+0x6f>
+      for(c = bins[i]; c; c = c->next)
+    6ca9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    6cac:	8b 04 85 00 f5 00 00 	mov    0xf500(,%eax,4),%eax
+    6cb3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    6cb6:	eb 16                	jmp    6cce <largealloc+0x65>
+        if(CSIZE(c) >= need)
+    6cb8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6cbb:	8b 00                	mov    (%eax),%eax
+    6cbd:	83 e0 f8             	and    $0xfffffff8,%eax
+    6cc0:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+    6cc3:	73 35                	jae    6cfa <largealloc+0x91>
+      for(c = bins[i]; c; c = c->next)
+    6cc5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6cc8:	8b 40 08             	mov    0x8(%eax),%eax
+    6ccb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    6cce:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    6cd2:	75 e4                	jne    6cb8 <largealloc+0x4f>
+    for(i = binof(need); i < NBIN; i++)
+    6cd4:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    6cd8:	83 7d ec 1a          	cmpl   $0x1a,-0x14(%ebp)
+    6cdc:	7e cb                	jle    6ca9 <largealloc+0x40>
+          goto found;
+    if(morecore(need) < 0)
+    6cde:	83 ec 0c             	sub    $0xc,%esp
+    6ce1:	ff 75 f0             	push   -0x10(%ebp)
+    6ce4:	e8 65 fe ff ff       	call   6b4e <morecore>
+    6ce9:	83 c4 10             	add    $0x10,%esp
+    6cec:	85 c0                	test   %eax,%eax
+    6cee:	79 a9                	jns    6c99 <largealloc+0x30>
+      return 0;
+    6cf0:	b8 00 00 00 00       	mov    $0x0,%eax
+    6cf5:	e9 c9 00 00 00       	jmp    6dc3 <largealloc+0x15a>
+          goto found;
+    6cfa:	90                   	nop
+  }
+
+found:
+  binremove(c);
+    6cfb:	83 ec 0c             	sub    $0xc,%esp
+    6cfe:	ff 75 f4             	push   -0xc(%ebp)
+    6d01:	e8 bb fc ff ff       	call   69c1 <binremove>
+    6d06:	83 c4 10             	add    $0x10,%esp
+  if(CSIZE(c) - need >= MINCHUNK){
+    6d09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6d0c:	8b 00                	mov    (%eax),%eax
+    6d0e:	83 e0 f8             	and    $0xfffffff8,%eax
+    6d11:	2b 45 f0             	sub    -0x10(%ebp),%eax
+    6d14:	83 f8 17             	cmp    $0x17,%eax
+    6d17:	76 66                	jbe    6d7f <largealloc+0x116>
+    r = (struct chunk*)((char*)c + need);
+    6d19:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    6d1c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    6d1f:	01 d0                	add    %edx,%eax
+    6d21:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    r->size = (CSIZE(c) - need) | PREVUSED;
+    6d24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6d27:	8b 00                	mov    (%eax),%eax
+    6d29:	83 e0 f8             	and    $0xfffffff8,%eax
+    6d2c:	2b 45 f0             	sub    -0x10(%ebp),%eax
+    6d2f:	83 c8 02             	or     $0x2,%eax
+    6d32:	89 c2                	mov    %eax,%edx
+    6d34:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    6d37:	89 10                	mov    %edx,(%eax)
+    r->tag = LARGE;
+    6d39:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    6d3c:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+    FOOTER(r) = CSIZE(r);
+    6d43:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    6d46:	8b 10                	mov    (%eax),%edx
+    6d48:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    6d4b:	8b 00                	mov    (%eax),%eax
+    6d4d:	83 e0 f8             	and    $0xfffffff8,%eax
+    6d50:	8d 48 fc             	lea    -0x4(%eax),%ecx
+    6d53:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    6d56:	01 c8                	add    %ecx,%eax
+    6d58:	83 e2 f8             	and    $0xfffffff8,%edx
+    6d5b:	89 10                	mov    %edx,(%eax)
+    bininsert(r);
+    6d5d:	83 ec 0c             	sub    $0xc,%esp
+    6d60:	ff 75 e8             	push   -0x18(%ebp)
+    6d63:	e8 03 fc ff ff       	call   696b <bininsert>
+    6d68:	83 c4 10             	add    $0x10,%esp
+    c->size = need | (c->size & PREVUSED);
+    6d6b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6d6e:	8b 00                	mov    (%eax),%eax
+    6d70:	83 e0 02             	and    $0x2,%eax
+    6d73:	0b 45 f0             	or     -0x10(%ebp),%eax
+    6d76:	89 c2                	mov    %eax,%edx
+    6d78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6d7b:	89 10                	mov    %edx,(%eax)
+    6d7d:	eb 25                	jmp    6da4 <largealloc+0x13b>
+  } else
+    NEXTC(c)->size |= PREVUSED;
+    6d7f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6d82:	8b 00                	mov    (%eax),%eax
+    6d84:	83 e0 f8             	and    $0xfffffff8,%eax
+    6d87:	89 c2                	mov    %eax,%edx
+    6d89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6d8c:	01 d0                	add    %edx,%eax
+    6d8e:	8b 10                	mov    (%eax),%edx
+    6d90:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6d93:	8b 00                	mov    (%eax),%eax
+    6d95:	83 e0 f8             	and    $0xfffffff8,%eax
+    6d98:	89 c1                	mov    %eax,%ecx
+    6d9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6d9d:	01 c8                	add    %ecx,%eax
+    6d9f:	83 ca 02             	or     $0x2,%edx
+    6da2:	89 10                	mov    %edx,(%eax)
+  c->size |= USED;
+    6da4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6da7:	8b 00                	mov    (%eax),%eax
+    6da9:	83 c8 01             	or     $0x1,%eax
+    6dac:	89 c2                	mov    %eax,%edx
+    6dae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6db1:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+    6db3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6db6:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  return (char*)c + HDRSIZE;
+    6dbd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6dc0:	83 c0 08             	add    $0x8,%eax
+}
+    6dc3:	c9                   	leave
+    6dc4:	c3                   	ret
+
+00006dc5 <refill>:
+
+// Carve a slab into free blocks of class k.
+static int
+refill(int k)
+{
+    6dc5:	55                   	push   %ebp
+    6dc6:	89 e5                	mov    %esp,%ebp
+    6dc8:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  char *p;
+  uint bs, i;
+
+  if((p = largealloc(SLABSIZE)) == 0)
+    6dcb:	83 ec 0c             	sub    $0xc,%esp
+    6dce:	68 00 20 00 00       	push   $0x2000
+    6dd3:	e8 91 fe ff ff       	call   6c69 <largealloc>
+    6dd8:	83 c4 10             	add    $0x10,%esp
+    6ddb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    6dde:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    6de2:	75 07                	jne    6deb <refill+0x26>
+    return -1;
+    6de4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    6de9:	eb 75                	jmp    6e60 <refill+0x9b>
+  bs = HDRSIZE + (MINSMALL << k);
+    6deb:	8b 45 08             	mov    0x8(%ebp),%eax
+    6dee:	ba 10 00 00 00       	mov    $0x10,%edx
+    6df3:	89 c1                	mov    %eax,%ecx
+    6df5:	d3 e2                	shl    %cl,%edx
+    6df7:	89 d0                	mov    %edx,%eax
+    6df9:	83 c0 08             	add    $0x8,%eax
+    6dfc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+    6dff:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    6e06:	eb 44                	jmp    6e4c <refill+0x87>
+    b = (struct chunk*)(p + i);
+    6e08:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    6e0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6e0e:	01 d0                	add    %edx,%eax
+    6e10:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    b->size = bs | USED;
+    6e13:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    6e16:	83 c8 01             	or     $0x1,%eax
+    6e19:	89 c2                	mov    %eax,%edx
+    6e1b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    6e1e:	89 10                	mov    %edx,(%eax)
+    b->tag = k;
+    6e20:	8b 55 08             	mov    0x8(%ebp),%edx
+    6e23:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    6e26:	89 50 04             	mov    %edx,0x4(%eax)
+    b->next = classes[k];
+    6e29:	8b 45 08             	mov    0x8(%ebp),%eax
+    6e2c:	8b 14 85 e0 f4 00 00 	mov    0xf4e0(,%eax,4),%edx
+    6e33:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    6e36:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[k] = b;
+    6e39:	8b 45 08             	mov    0x8(%ebp),%eax
+    6e3c:	8b 55 e8             	mov    -0x18(%ebp),%edx
+    6e3f:	89 14 85 e0 f4 00 00 	mov    %edx,0xf4e0(,%eax,4)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+    6e46:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    6e49:	01 45 f4             	add    %eax,-0xc(%ebp)
+    6e4c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    6e4f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    6e52:	01 d0                	add    %edx,%eax
+    6e54:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    6e59:	76 ad                	jbe    6e08 <refill+0x43>
+  }
+  return 0;
+    6e5b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    6e60:	c9                   	leave
+    6e61:	c3                   	ret
+
+00006e62 <free>:
+
+void
+free(void *ap)
+{
+    6e62:	55                   	push   %ebp
+    6e63:	89 e5                	mov    %esp,%ebp
+    6e65:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+
+  if(ap == 0)
+    6e68:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    6e6c:	74 4b                	je     6eb9 <free+0x57>
+    return;
+  c = (struct chunk*)((char*)ap - HDRSIZE);
+    6e6e:	8b 45 08             	mov    0x8(%ebp),%eax
+    6e71:	83 e8 08             	sub    $0x8,%eax
+    6e74:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(c->tag != LARGE){
+    6e77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6e7a:	8b 40 04             	mov    0x4(%eax),%eax
+    6e7d:	83 f8 ff             	cmp    $0xffffffff,%eax
+    6e80:	74 25                	je     6ea7 <free+0x45>
+    c->next = classes[c->tag];
+    6e82:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6e85:	8b 40 04             	mov    0x4(%eax),%eax
+    6e88:	8b 14 85 e0 f4 00 00 	mov    0xf4e0(,%eax,4),%edx
+    6e8f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6e92:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[c->tag] = c;
+    6e95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6e98:	8b 40 04             	mov    0x4(%eax),%eax
+    6e9b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    6e9e:	89 14 85 e0 f4 00 00 	mov    %edx,0xf4e0(,%eax,4)
+    return;
+    6ea5:	eb 13                	jmp    6eba <free+0x58>
+  }
+  freechunk(c, 1);
+    6ea7:	83 ec 08             	sub    $0x8,%esp
+    6eaa:	6a 01                	push   $0x1
+    6eac:	ff 75 f4             	push   -0xc(%ebp)
+    6eaf:	e8 65 fb ff ff       	call   6a19 <freechunk>
+    6eb4:	83 c4 10             	add    $0x10,%esp
+    6eb7:	eb 01                	jmp    6eba <free+0x58>
+    return;
+    6eb9:	90                   	nop
+}
+    6eba:	c9                   	leave
+    6ebb:	c3                   	ret
+
+00006ebc <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    6ebc:	55                   	push   %ebp
+    6ebd:	89 e5                	mov    %esp,%ebp
+    6ebf:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  int k;
+
+  if(nbytes > MAXSMALL)
+    6ec2:	81 7d 08 00 08 00 00 	cmpl   $0x800,0x8(%ebp)
+    6ec9:	76 10                	jbe    6edb <malloc+0x1f>
+    return largealloc(nbytes);
+    6ecb:	83 ec 0c             	sub    $0xc,%esp
+    6ece:	ff 75 08             	push   0x8(%ebp)
+    6ed1:	e8 93 fd ff ff       	call   6c69 <largealloc>
+    6ed6:	83 c4 10             	add    $0x10,%esp
+    6ed9:	eb 6a                	jmp    6f45 <malloc+0x89>
+  for(k = 0; (MINSMALL << k) < nbytes; k++)
+    6edb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    6ee2:	eb 04                	jmp    6ee8 <malloc+0x2c>
+    6ee4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    6ee8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6eeb:	ba 10 00 00 00       	mov    $0x10,%edx
+    6ef0:	89 c1                	mov    %eax,%ecx
+    6ef2:	d3 e2                	shl    %cl,%edx
+    6ef4:	89 d0                	mov    %edx,%eax
+    6ef6:	3b 45 08             	cmp    0x8(%ebp),%eax
+    6ef9:	72 e9                	jb     6ee4 <malloc+0x28>
+    ;
+  if(classes[k] == 0 && refill(k) < 0)
+    6efb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6efe:	8b 04 85 e0 f4 00 00 	mov    0xf4e0(,%eax,4),%eax
+    6f05:	85 c0                	test   %eax,%eax
+    6f07:	75 19                	jne    6f22 <malloc+0x66>
+    6f09:	83 ec 0c             	sub    $0xc,%esp
+    6f0c:	ff 75 f4             	push   -0xc(%ebp)
+    6f0f:	e8 b1 fe ff ff       	call   6dc5 <refill>
+    6f14:	83 c4 10             	add    $0x10,%esp
+    6f17:	85 c0                	test   %eax,%eax
+    6f19:	79 07                	jns    6f22 <malloc+0x66>
+    return 0;
+    6f1b:	b8 00 00 00 00       	mov    $0x0,%eax
+    6f20:	eb 23                	jmp    6f45 <malloc+0x89>
+  b = classes[k];
+    6f22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6f25:	8b 04 85 e0 f4 00 00 	mov    0xf4e0(,%eax,4),%eax
+    6f2c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  classes[k] = b->next;
+    6f2f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    6f32:	8b 50 08             	mov    0x8(%eax),%edx
+    6f35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6f38:	89 14 85 e0 f4 00 00 	mov    %edx,0xf4e0(,%eax,4)
+  return (char*)b + HDRSIZE;
+    6f3f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    6f42:	83 c0 08             	add    $0x8,%eax
+}
+    6f45:	c9                   	leave
+    6f46:	c3                   	ret
+
+00006f47 <stream>:
+
+// Return the stream for fd, deciding on first use how
+// its output is buffered.  Returns 0 if fd is not open.
+static struct stream*
+stream(int fd)
+{
+    6f47:	55                   	push   %ebp
+    6f48:	89 e5                	mov    %esp,%ebp
+    6f4a:	83 ec 28             	sub    $0x28,%esp
+  struct stream *s;
+  struct stat st;
+
+  if(fd < 0 || fd >= NOFILE)
+    6f4d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    6f51:	78 06                	js     6f59 <stream+0x12>
+    6f53:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    6f57:	7e 07                	jle    6f60 <stream+0x19>
+    return 0;
+    6f59:	b8 00 00 00 00       	mov    $0x0,%eax
+    6f5e:	eb 55                	jmp    6fb5 <stream+0x6e>
+  s = &streams[fd];
+    6f60:	8b 45 08             	mov    0x8(%ebp),%eax
+    6f63:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    6f69:	05 80 f5 00 00       	add    $0xf580,%eax
+    6f6e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(s->mode == UNKNOWN){
+    6f71:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6f74:	8b 00                	mov    (%eax),%eax
+    6f76:	85 c0                	test   %eax,%eax
+    6f78:	75 38                	jne    6fb2 <stream+0x6b>
+    if(fstat(fd, &st) < 0)
+    6f7a:	83 ec 08             	sub    $0x8,%esp
+    6f7d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    6f80:	50                   	push   %eax
+    6f81:	ff 75 08             	push   0x8(%ebp)
+    6f84:	e8 57 f6 ff ff       	call   65e0 <fstat>
+    6f89:	83 c4 10             	add    $0x10,%esp
+    6f8c:	85 c0                	test   %eax,%eax
+    6f8e:	79 07                	jns    6f97 <stream+0x50>
+      return 0;
+    6f90:	b8 00 00 00 00       	mov    $0x0,%eax
+    6f95:	eb 1e                	jmp    6fb5 <stream+0x6e>
+    s->mode = st.type == T_DEV ? LINEBUF : FULLBUF;
+    6f97:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+    6f9b:	66 83 f8 03          	cmp    $0x3,%ax
+    6f9f:	75 07                	jne    6fa8 <stream+0x61>
+    6fa1:	ba 01 00 00 00       	mov    $0x1,%edx
+    6fa6:	eb 05                	jmp    6fad <stream+0x66>
+    6fa8:	ba 02 00 00 00       	mov    $0x2,%edx
+    6fad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6fb0:	89 10                	mov    %edx,(%eax)
+  }
+  return s;
+    6fb2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    6fb5:	c9                   	leave
+    6fb6:	c3                   	ret
+
+00006fb7 <fflush>:
+
+int
+fflush(int fd)
+{
+    6fb7:	55                   	push   %ebp
+    6fb8:	89 e5                	mov    %esp,%ebp
+    6fba:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  int i, n;
+
+  if(fd < 0 || fd >= NOFILE)
+    6fbd:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    6fc1:	78 06                	js     6fc9 <fflush+0x12>
+    6fc3:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    6fc7:	7e 07                	jle    6fd0 <fflush+0x19>
+    return -1;
+    6fc9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    6fce:	eb 78                	jmp    7048 <fflush+0x91>
+  s = &streams[fd];
+    6fd0:	8b 45 08             	mov    0x8(%ebp),%eax
+    6fd3:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    6fd9:	05 80 f5 00 00       	add    $0xf580,%eax
+    6fde:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < s->nout; i += n){
+    6fe1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    6fe8:	eb 44                	jmp    702e <fflush+0x77>
+    if((n = write(fd, s->out + i, s->nout - i)) <= 0){
+    6fea:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    6fed:	8b 40 04             	mov    0x4(%eax),%eax
+    6ff0:	2b 45 f4             	sub    -0xc(%ebp),%eax
+    6ff3:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    6ff6:	8d 4a 10             	lea    0x10(%edx),%ecx
+    6ff9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    6ffc:	01 ca                	add    %ecx,%edx
+    6ffe:	83 ec 04             	sub    $0x4,%esp
+    7001:	50                   	push   %eax
+    7002:	52                   	push   %edx
+    7003:	ff 75 08             	push   0x8(%ebp)
+    7006:	e8 6c f5 ff ff       	call   6577 <write>
+    700b:	83 c4 10             	add    $0x10,%esp
+    700e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    7011:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    7015:	7f 11                	jg     7028 <fflush+0x71>
+      s->nout = 0;
+    7017:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    701a:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+      return -1;
+    7021:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    7026:	eb 20                	jmp    7048 <fflush+0x91>
+  for(i = 0; i < s->nout; i += n){
+    7028:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    702b:	01 45 f4             	add    %eax,-0xc(%ebp)
+    702e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    7031:	8b 40 04             	mov    0x4(%eax),%eax
+    7034:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    7037:	7c b1                	jl     6fea <fflush+0x33>
+    }
+  }
+  s->nout = 0;
+    7039:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    703c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  return 0;
+    7043:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    7048:	c9                   	leave
+    7049:	c3                   	ret
+
+0000704a <flushall>:
+
+// Flush every stream, or only line-buffered ones.
+static void
+flushall(int lineonly)
+{
+    704a:	55                   	push   %ebp
+    704b:	89 e5                	mov    %esp,%ebp
+    704d:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+    7050:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    7057:	eb 41                	jmp    709a <flushall+0x50>
+    if(streams[fd].nout > 0 && (!lineonly || streams[fd].mode == LINEBUF))
+    7059:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    705c:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    7062:	05 84 f5 00 00       	add    $0xf584,%eax
+    7067:	8b 00                	mov    (%eax),%eax
+    7069:	85 c0                	test   %eax,%eax
+    706b:	7e 29                	jle    7096 <flushall+0x4c>
+    706d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    7071:	74 15                	je     7088 <flushall+0x3e>
+    7073:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    7076:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    707c:	05 80 f5 00 00       	add    $0xf580,%eax
+    7081:	8b 00                	mov    (%eax),%eax
+    7083:	83 f8 01             	cmp    $0x1,%eax
+    7086:	75 0e                	jne    7096 <flushall+0x4c>
+      fflush(fd);
+    7088:	83 ec 0c             	sub    $0xc,%esp
+    708b:	ff 75 f4             	push   -0xc(%ebp)
+    708e:	e8 24 ff ff ff       	call   6fb7 <fflush>
+    7093:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++)
+    7096:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    709a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+    709e:	7e b9                	jle    7059 <flushall+0xf>
+}
+    70a0:	90                   	nop
+    70a1:	90                   	nop
+    70a2:	c9                   	leave
+    70a3:	c3                   	ret
+
+000070a4 <fputc>:
+
+int
+fputc(int fd, int c)
+{
+    70a4:	55                   	push   %ebp
+    70a5:	89 e5                	mov    %esp,%ebp
+    70a7:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  char ch;
+
+  if((s = stream(fd)) == 0){
+    70aa:	83 ec 0c             	sub    $0xc,%esp
+    70ad:	ff 75 08             	push   0x8(%ebp)
+    70b0:	e8 92 fe ff ff       	call   6f47 <stream>
+    70b5:	83 c4 10             	add    $0x10,%esp
+    70b8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    70bb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    70bf:	75 2e                	jne    70ef <fputc+0x4b>
+    ch = c;
+    70c1:	8b 45 0c             	mov    0xc(%ebp),%eax
+    70c4:	88 45 f3             	mov    %al,-0xd(%ebp)
+    return write(fd, &ch, 1) == 1 ? (uchar)c : -1;
+    70c7:	83 ec 04             	sub    $0x4,%esp
+    70ca:	6a 01                	push   $0x1
+    70cc:	8d 45 f3             	lea    -0xd(%ebp),%eax
+    70cf:	50                   	push   %eax
+    70d0:	ff 75 08             	push   0x8(%ebp)
+    70d3:	e8 9f f4 ff ff       	call   6577 <write>
+    70d8:	83 c4 10             	add    $0x10,%esp
+    70db:	83 f8 01             	cmp    $0x1,%eax
+    70de:	75 08                	jne    70e8 <fputc+0x44>
+    70e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+    70e3:	0f b6 c0             	movzbl %al,%eax
+    70e6:	eb 5e                	jmp    7146 <fputc+0xa2>
+    70e8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    70ed:	eb 57                	jmp    7146 <fputc+0xa2>
+  }
+  s->out[s->nout++] = c;
+    70ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    70f2:	8b 40 04             	mov    0x4(%eax),%eax
+    70f5:	8d 48 01             	lea    0x1(%eax),%ecx
+    70f8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    70fb:	89 4a 04             	mov    %ecx,0x4(%edx)
+    70fe:	8b 55 0c             	mov    0xc(%ebp),%edx
+    7101:	89 d1                	mov    %edx,%ecx
+    7103:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    7106:	88 4c 02 10          	mov    %cl,0x10(%edx,%eax,1)
+  if(s->nout == BUFSZ || (s->mode == LINEBUF && c == '\n'))
+    710a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    710d:	8b 40 04             	mov    0x4(%eax),%eax
+    7110:	3d 00 02 00 00       	cmp    $0x200,%eax
+    7115:	74 10                	je     7127 <fputc+0x83>
+    7117:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    711a:	8b 00                	mov    (%eax),%eax
+    711c:	83 f8 01             	cmp    $0x1,%eax
+    711f:	75 1f                	jne    7140 <fputc+0x9c>
+    7121:	83 7d 0c 0a          	cmpl   $0xa,0xc(%ebp)
+    7125:	75 19                	jne    7140 <fputc+0x9c>
+    if(fflush(fd) < 0)
+    7127:	83 ec 0c             	sub    $0xc,%esp
+    712a:	ff 75 08             	push   0x8(%ebp)
+    712d:	e8 85 fe ff ff       	call   6fb7 <fflush>
+    7132:	83 c4 10             	add    $0x10,%esp
+    7135:	85 c0                	test   %eax,%eax
+    7137:	79 07                	jns    7140 <fputc+0x9c>
+      return -1;
+    7139:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    713e:	eb 06                	jmp    7146 <fputc+0xa2>
+  return (uchar)c;
+    7140:	8b 45 0c             	mov    0xc(%ebp),%eax
+    7143:	0f b6 c0             	movzbl %al,%eax
+}
+    7146:	c9                   	leave
+    7147:	c3                   	ret
+
+00007148 <fgetc>:
+
+// Return the next byte read from fd, or -1 at end of file.
+int
+fgetc(int fd)
+{
+    7148:	55                   	push   %ebp
+    7149:	89 e5                	mov    %esp,%ebp
+    714b:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  uchar c;
+  int n;
+
+  if((s = stream(fd)) == 0){
+    714e:	83 ec 0c             	sub    $0xc,%esp
+    7151:	ff 75 08             	push   0x8(%ebp)
+    7154:	e8 ee fd ff ff       	call   6f47 <stream>
+    7159:	83 c4 10             	add    $0x10,%esp
+    715c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    715f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    7163:	75 39                	jne    719e <fgetc+0x56>
+    flushall(1);
+    7165:	83 ec 0c             	sub    $0xc,%esp
+    7168:	6a 01                	push   $0x1
+    716a:	e8 db fe ff ff       	call   704a <flushall>
+    716f:	83 c4 10             	add    $0x10,%esp
+    return read(fd, &c, 1) == 1 ? c : -1;
+    7172:	83 ec 04             	sub    $0x4,%esp
+    7175:	6a 01                	push   $0x1
+    7177:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    717a:	50                   	push   %eax
+    717b:	ff 75 08             	push   0x8(%ebp)
+    717e:	e8 e5 f3 ff ff       	call   6568 <read>
+    7183:	83 c4 10             	add    $0x10,%esp
+    7186:	83 f8 01             	cmp    $0x1,%eax
+    7189:	75 0c                	jne    7197 <fgetc+0x4f>
+    718b:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    718f:	0f b6 c0             	movzbl %al,%eax
+    7192:	e9 80 00 00 00       	jmp    7217 <fgetc+0xcf>
+    7197:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    719c:	eb 79                	jmp    7217 <fgetc+0xcf>
+  }
+  if(s->rpos == s->rend){
+    719e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    71a1:	8b 50 08             	mov    0x8(%eax),%edx
+    71a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    71a7:	8b 40 0c             	mov    0xc(%eax),%eax
+    71aa:	39 c2                	cmp    %eax,%edx
+    71ac:	75 4c                	jne    71fa <fgetc+0xb2>
+    flushall(1);
+    71ae:	83 ec 0c             	sub    $0xc,%esp
+    71b1:	6a 01                	push   $0x1
+    71b3:	e8 92 fe ff ff       	call   704a <flushall>
+    71b8:	83 c4 10             	add    $0x10,%esp
+    if((n = read(fd, s->in, BUFSZ)) <= 0)
+    71bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    71be:	05 10 02 00 00       	add    $0x210,%eax
+    71c3:	83 ec 04             	sub    $0x4,%esp
+    71c6:	68 00 02 00 00       	push   $0x200
+    71cb:	50                   	push   %eax
+    71cc:	ff 75 08             	push   0x8(%ebp)
+    71cf:	e8 94 f3 ff ff       	call   6568 <read>
+    71d4:	83 c4 10             	add    $0x10,%esp
+    71d7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    71da:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    71de:	7f 07                	jg     71e7 <fgetc+0x9f>
+      return -1;
+    71e0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    71e5:	eb 30                	jmp    7217 <fgetc+0xcf>
+    s->rpos = 0;
+    71e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    71ea:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+    s->rend = n;
+    71f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    71f4:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    71f7:	89 50 0c             	mov    %edx,0xc(%eax)
+  }
+  return (uchar)s->in[s->rpos++];
+    71fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    71fd:	8b 40 08             	mov    0x8(%eax),%eax
+    7200:	8d 48 01             	lea    0x1(%eax),%ecx
+    7203:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    7206:	89 4a 08             	mov    %ecx,0x8(%edx)
+    7209:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    720c:	0f b6 84 02 10 02 00 	movzbl 0x210(%edx,%eax,1),%eax
+    7213:	00 
+    7214:	0f b6 c0             	movzbl %al,%eax
+}
+    7217:	c9                   	leave
+    7218:	c3                   	ret
+
+00007219 <fork>:
+
+int
+fork(void)
+{
+    7219:	55                   	push   %ebp
+    721a:	89 e5                	mov    %esp,%ebp
+    721c:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    721f:	83 ec 0c             	sub    $0xc,%esp
+    7222:	6a 00                	push   $0x0
+    7224:	e8 21 fe ff ff       	call   704a <flushall>
+    7229:	83 c4 10             	add    $0x10,%esp
+  return _fork();
+    722c:	e8 fb f2 ff ff       	call   652c <_fork>
+}
+    7231:	c9                   	leave
+    7232:	c3                   	ret
+
+00007233 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+    7233:	55                   	push   %ebp
+    7234:	89 e5                	mov    %esp,%ebp
+    7236:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    7239:	83 ec 0c             	sub    $0xc,%esp
+    723c:	6a 00                	push   $0x0
+    723e:	e8 07 fe ff ff       	call   704a <flushall>
+    7243:	83 c4 10             	add    $0x10,%esp
+  return _exec(path, argv);
+    7246:	83 ec 08             	sub    $0x8,%esp
+    7249:	ff 75 0c             	push   0xc(%ebp)
+    724c:	ff 75 08             	push   0x8(%ebp)
+    724f:	e8 50 f3 ff ff       	call   65a4 <_exec>
+    7254:	83 c4 10             	add    $0x10,%esp
+}
+    7257:	c9                   	leave
+    7258:	c3                   	ret
+
+00007259 <exit>:
+
+int
+exit(void)
+{
+    7259:	55                   	push   %ebp
+    725a:	89 e5                	mov    %esp,%ebp
+    725c:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    725f:	83 ec 0c             	sub    $0xc,%esp
+    7262:	6a 00                	push   $0x0
+    7264:	e8 e1 fd ff ff       	call   704a <flushall>
+    7269:	83 c4 10             	add    $0x10,%esp
+  _exit();
+    726c:	e8 ca f2 ff ff       	call   653b <_exit>
+
+00007271 <close>:
+}
+
+int
+close(int fd)
+{
+    7271:	55                   	push   %ebp
+    7272:	89 e5                	mov    %esp,%ebp
+    7274:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+
+  if(fd >= 0 && fd < NOFILE){
+    7277:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    727b:	78 44                	js     72c1 <close+0x50>
+    727d:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    7281:	7f 3e                	jg     72c1 <close+0x50>
+    fflush(fd);
+    7283:	83 ec 0c             	sub    $0xc,%esp
+    7286:	ff 75 08             	push   0x8(%ebp)
+    7289:	e8 29 fd ff ff       	call   6fb7 <fflush>
+    728e:	83 c4 10             	add    $0x10,%esp
+    s = &streams[fd];
+    7291:	8b 45 08             	mov    0x8(%ebp),%eax
+    7294:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    729a:	05 80 f5 00 00       	add    $0xf580,%eax
+    729f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    s->mode = UNKNOWN;
+    72a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    72a5:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    s->rpos = s->rend = 0;
+    72ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    72ae:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    72b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    72b8:	8b 50 0c             	mov    0xc(%eax),%edx
+    72bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    72be:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  return _close(fd);
+    72c1:	83 ec 0c             	sub    $0xc,%esp
+    72c4:	ff 75 08             	push   0x8(%ebp)
+    72c7:	e8 ba f2 ff ff       	call   6586 <_close>
+    72cc:	83 c4 10             	add    $0x10,%esp
+}
+    72cf:	c9                   	leave
+    72d0:	c3                   	ret
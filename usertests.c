@@ -7,6 +7,8 @@
 #include "syscall.h"
 #include "traps.h"
 #include "memlayout.h"
+#include "ioring.h"
+#include "lockstat.h"
 
 char buf[8192];
 char name[3];
@@ -184,6 +186,9 @@ writetest(void)
   printf(stdout, "small file test ok\n");
 }
 
+// Blocks in "big": enough to need a double indirect block.
+#define BIGBLOCKS (NDIRECT + NINDIRECT + 20)
+
 void
 writetest1(void)
 {
@@ -197,7 +202,7 @@ writetest1(void)
     exit();
   }
 
-  for(i = 0; i < MAXFILE; i++){
+  for(i = 0; i < BIGBLOCKS; i++){
     ((int*)buf)[0] = i;
     if(write(fd, buf, 512) != 512){
       printf(stdout, "error: write big file failed\n", i);
@@ -217,7 +222,7 @@ writetest1(void)
   for(;;){
     i = read(fd, buf, 512);
     if(i == 0){
-      if(n == MAXFILE - 1){
+      if(n != BIGBLOCKS){
         printf(stdout, "read only %d blocks from big", n);
         exit();
       }
@@ -354,6 +359,85 @@ pipe1(void)
   printf(1, "pipe1 ok\n");
 }
 
+// splice a file into a pipe and the pipe into another file.
+void
+splicetest(void)
+{
+  int fd, fds[2], pid, i, n;
+
+  printf(1, "splice test\n");
+
+  unlink("splicein");
+  unlink("spliceout");
+  fd = open("splicein", O_CREATE | O_RDWR);
+  for(i = 0; i < 3000; i++)
+    buf[i] = i % 251;
+  if(fd < 0 || write(fd, buf, 3000) != 3000){
+    printf(1, "splice create failed\n");
+    exit();
+  }
+  close(fd);
+
+  if(pipe(fds) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    close(fds[0]);
+    fd = open("splicein", O_RDONLY);
+    if((n = splice(fd, fds[1], 5000)) != 3000){
+      printf(1, "splice to pipe returned %d\n", n);
+      exit();
+    }
+    exit();
+  }
+  close(fds[1]);
+  fd = open("spliceout", O_CREATE | O_RDWR);
+  if((n = splice(fds[0], fd, 5000)) != 3000){
+    printf(1, "splice from pipe returned %d\n", n);
+    exit();
+  }
+  close(fds[0]);
+  close(fd);
+  wait();
+
+  fd = open("spliceout", O_RDONLY);
+  memset(buf, 0, 3000);
+  if(read(fd, buf, 4000) != 3000){
+    printf(1, "splice short file\n");
+    exit();
+  }
+  for(i = 0; i < 3000; i++){
+    if((buf[i] & 0xff) != i % 251){
+      printf(1, "splice wrong data at %d\n", i);
+      exit();
+    }
+  }
+  close(fd);
+  unlink("splicein");
+  unlink("spliceout");
+
+  // A device can't be spliced from, so cat falls back to read().
+  if(pipe(fds) != 0 || (fd = open("console", O_RDONLY)) < 0){
+    printf(1, "splice console setup failed\n");
+    exit();
+  }
+  if((n = splice(fd, fds[1], 10)) != -1){
+    printf(1, "splice from console returned %d\n", n);
+    exit();
+  }
+  close(fd);
+  close(fds[0]);
+  close(fds[1]);
+
+  printf(1, "splice ok\n");
+}
+
 // meant to be run w/ at most two CPUs
 void
 preempt(void)
@@ -424,6 +508,124 @@ exitwait(void)
   printf(1, "exitwait ok\n");
 }
 
+// lockstat reports the process table lock as used.
+void
+lockstattest(void)
+{
+  static struct lockstat st[NLOCKSTAT];
+  int i, n;
+
+  printf(1, "lockstat test\n");
+
+  n = lockstat(st, NLOCKSTAT);
+  if(n <= 0 || n > NLOCKSTAT){
+    printf(1, "lockstat returned %d\n", n);
+    exit();
+  }
+  for(i = 0; i < n; i++)
+    if(strcmp(st[i].name, "ptable") == 0)
+      break;
+  if(i == n || st[i].nacquire == 0){
+    printf(1, "lockstat has no ptable\n");
+    exit();
+  }
+  if(lockstat(st, 1) > 1){
+    printf(1, "lockstat overran its buffer\n");
+    exit();
+  }
+
+  printf(1, "lockstat ok\n");
+}
+
+// more processes than the old fixed table held can
+// be alive at once, and wait() finds every one.
+void
+manyproctest(void)
+{
+  int fds[2], i, n, pid;
+  char c;
+
+  printf(1, "many proc test\n");
+
+  if(pipe(fds) != 0){
+    printf(1, "pipe failed\n");
+    exit();
+  }
+  for(n = 0; n < 100; n++){
+    pid = fork();
+    if(pid < 0)
+      break;
+    if(pid == 0){
+      close(fds[1]);
+      read(fds[0], &c, 1);  // returns once the parent closes fds[1]
+      exit();
+    }
+  }
+  close(fds[0]);
+  close(fds[1]);
+  if(n < 100){
+    printf(1, "only %d procs\n", n);
+    exit();
+  }
+  for(i = 0; i < n; i++){
+    if(wait() < 0){
+      printf(1, "wait stopped early\n");
+      exit();
+    }
+  }
+  if(wait() != -1){
+    printf(1, "wait got too many\n");
+    exit();
+  }
+
+  printf(1, "many proc ok\n");
+}
+
+// small and large blocks keep their contents, and freeing a
+// big block at the top of the heap shrinks the process.
+void
+malloctest(void)
+{
+  char *p[64], *big, *brk0;
+  int i, j, n;
+
+  printf(1, "malloc test\n");
+
+  for(i = 0; i < 64; i++){
+    n = 1 + (i * 97) % 3000;
+    if((p[i] = malloc(n)) == 0 || ((uint)p[i] & 7) != 0){
+      printf(1, "malloc %d failed\n", n);
+      exit();
+    }
+    memset(p[i], i, n);
+  }
+  for(i = 0; i < 64; i += 2)
+    free(p[i]);
+  for(i = 1; i < 64; i += 2){
+    n = 1 + (i * 97) % 3000;
+    for(j = 0; j < n; j++)
+      if(p[i][j] != i){
+        printf(1, "malloc block %d corrupted\n", i);
+        exit();
+      }
+    free(p[i]);
+  }
+
+  brk0 = sbrk(0);
+  if((big = malloc(200000)) == 0){
+    printf(1, "malloc big failed\n");
+    exit();
+  }
+  memset(big, 1, 200000);
+  free(big);
+  if(sbrk(0) >= brk0 + 200000){
+    printf(1, "free did not shrink the heap\n");
+    exit();
+  }
+
+  printf(1, "malloc ok\n");
+}
+
 void
 mem(void)
 {
@@ -579,6 +781,79 @@ fourfiles(void)
   printf(1, "fourfiles ok\n");
 }
 
+// four processes read one file at the same time, holding
+// its inode shared, while another appends to it.
+void
+sharedread(void)
+{
+  int fd, pid, i, j, n, off, pi;
+  char c;
+
+  printf(1, "shared read test\n");
+
+  unlink("sr");
+  fd = open("sr", O_CREATE | O_RDWR);
+  if(fd < 0){
+    printf(1, "create sr failed\n");
+    exit();
+  }
+  for(i = 0; i < 40; i++){
+    memset(buf, 'a' + i%26, 512);
+    if(write(fd, buf, 512) != 512){
+      printf(1, "write sr failed\n");
+      exit();
+    }
+  }
+  close(fd);
+
+  for(pi = 0; pi < 5; pi++){
+    pid = fork();
+    if(pid < 0){
+      printf(1, "fork failed\n");
+      exit();
+    }
+    if(pid == 0 && pi == 4){
+      fd = open("sr", O_WRONLY);
+      lseek(fd, 0, SEEK_END);
+      for(i = 40; i < 80; i++){
+        memset(buf, 'a' + i%26, 512);
+        if(write(fd, buf, 512) != 512){
+          printf(1, "append sr failed\n");
+          exit();
+        }
+      }
+      close(fd);
+      exit();
+    }
+    if(pid == 0){
+      for(j = 0; j < 4; j++){
+        fd = open("sr", 0);
+        off = 0;
+        while((n = read(fd, buf, 700)) > 0){
+          for(i = 0; i < n; i++, off++){
+            c = 'a' + (off/512)%26;
+            if(buf[i] != c){
+              printf(1, "shared read: wrong byte at %d\n", off);
+              exit();
+            }
+          }
+        }
+        close(fd);
+        if(off < 40*512){
+          printf(1, "shared read: short file %d\n", off);
+          exit();
+        }
+      }
+      exit();
+    }
+  }
+  for(pi = 0; pi < 5; pi++)
+    wait();
+  unlink("sr");
+
+  printf(1, "shared read ok\n");
+}
+
 // four processes create and delete different files in same directory
 void
 createdelete(void)
@@ -892,12 +1167,17 @@ linkunlink()
 void
 bigdir(void)
 {
-  int i, fd;
+  int i, fd, n;
   char name[10];
+  struct dirent de;
 
   printf(1, "bigdir test\n");
-  unlink("bd");
 
+  // A directory made by mkdir turns into a hash table as it grows.
+  if(mkdir("bigd") != 0 || chdir("bigd") != 0){
+    printf(1, "bigdir mkdir failed\n");
+    exit();
+  }
   fd = open("bd", O_CREATE);
   if(fd < 0){
     printf(1, "bigdir create failed\n");
@@ -916,6 +1196,18 @@ bigdir(void)
     }
   }
 
+  // Reading it as a plain file shows each entry once.
+  fd = open(".", 0);
+  n = 0;
+  while(read(fd, &de, sizeof(de)) == sizeof(de))
+    if(de.inum != 0 && de.name[0] == 'x')
+      n++;
+  close(fd);
+  if(n != 500){
+    printf(1, "bigdir read %d entries\n", n);
+    exit();
+  }
+
   unlink("bd");
   for(i = 0; i < 500; i++){
     name[0] = 'x';
@@ -927,10 +1219,108 @@ bigdir(void)
       exit();
     }
   }
+  if(chdir("..") != 0 || unlink("bigd") != 0){
+    printf(1, "bigdir unlink bigd failed\n");
+    exit();
+  }
 
   printf(1, "bigdir ok\n");
 }
 
+// Name i of the hashsplit test, with prefix c.
+static void
+hsname(char *name, char c, int i)
+{
+  name[0] = c;
+  name[1] = '0' + i/1000;
+  name[2] = '0' + i/100%10;
+  name[3] = '0' + i/10%10;
+  name[4] = '0' + i%10;
+  name[5] = '\0';
+}
+
+// Crowd one bucket of a hashed directory so its chain is
+// longer than a split can rewrite at once before its turn to
+// be split comes; the table must still keep growing.
+void
+hashsplit(void)
+{
+  struct dirhdr hdr[DPB];
+  char name[DIRSIZ];
+  int i, k, fd, n;
+
+  printf(1, "hashsplit test\n");
+
+  if(mkdir("hsd") != 0 || chdir("hsd") != 0){
+    printf(1, "hashsplit mkdir failed\n");
+    exit();
+  }
+  fd = open("f", O_CREATE);
+  if(fd < 0){
+    printf(1, "hashsplit create failed\n");
+    exit();
+  }
+  close(fd);
+
+  // Enough names to make it a hash table, then 300 that all
+  // fall in bucket 0 until the table has 8 buckets, when
+  // bucket 0's turn to be split comes round again.
+  for(i = 0; i < 100; i++){
+    hsname(name, 'a', i);
+    if(link("f", name) != 0){
+      printf(1, "hashsplit link failed\n");
+      exit();
+    }
+  }
+  for(i = 0, k = 0; k < 300; i++){
+    hsname(name, 'c', i);
+    if(dirhash(name) % 8 != 0)
+      continue;
+    if(link("f", name) != 0){
+      printf(1, "hashsplit link failed\n");
+      exit();
+    }
+    k++;
+  }
+
+  fd = open(".", 0);
+  if(read(fd, hdr, sizeof(hdr)) != sizeof(hdr)){
+    printf(1, "hashsplit read failed\n");
+    exit();
+  }
+  close(fd);
+  n = HDRWORD(hdr, HDRNBUCKET);
+  if(n <= 8){
+    printf(1, "hashsplit: table stuck at %d buckets\n", n);
+    exit();
+  }
+
+  unlink("f");
+  for(i = 0; i < 100; i++){
+    hsname(name, 'a', i);
+    if(unlink(name) != 0){
+      printf(1, "hashsplit unlink failed\n");
+      exit();
+    }
+  }
+  for(i = 0, k = 0; k < 300; i++){
+    hsname(name, 'c', i);
+    if(dirhash(name) % 8 != 0)
+      continue;
+    if(unlink(name) != 0){
+      printf(1, "hashsplit unlink failed\n");
+      exit();
+    }
+    k++;
+  }
+  if(chdir("..") != 0 || unlink("hsd") != 0){
+    printf(1, "hashsplit unlink hsd failed\n");
+    exit();
+  }
+
+  printf(1, "hashsplit ok\n");
+}
+
 void
 subdir(void)
 {
@@ -1114,6 +1504,317 @@ subdir(void)
   printf(1, "subdir ok\n");
 }
 
+// writes far apart leave holes that read as zeros.
+void
+sparsetest(void)
+{
+  struct stat st;
+  int fd, i;
+  uint off;
+
+  printf(1, "sparse test\n");
+
+  unlink("sparse");
+  fd = open("sparse", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "create sparse failed\n");
+    exit();
+  }
+  // Past the direct blocks, then into the double indirect range.
+  off = (NDIRECT + NINDIRECT + 5) * BSIZE;
+  if(lseek(fd, 2*BSIZE, SEEK_SET) != 2*BSIZE || write(fd, "x", 1) != 1 ||
+     lseek(fd, off, SEEK_SET) != off || write(fd, "y", 1) != 1){
+    printf(1, "sparse write failed\n");
+    exit();
+  }
+  if(fstat(fd, &st) < 0 || st.size != off + 1){
+    printf(1, "sparse size wrong\n");
+    exit();
+  }
+  if(lseek(fd, 0, SEEK_SET) != 0 || read(fd, buf, BSIZE) != BSIZE){
+    printf(1, "sparse read failed\n");
+    exit();
+  }
+  for(i = 0; i < BSIZE; i++){
+    if(buf[i] != 0){
+      printf(1, "hole not zero\n");
+      exit();
+    }
+  }
+  if(lseek(fd, -1, SEEK_END) != off || read(fd, buf, 2) != 1 || buf[0] != 'y' ||
+     lseek(fd, 2*BSIZE, SEEK_SET) != 2*BSIZE || read(fd, buf, 1) != 1 || buf[0] != 'x'){
+    printf(1, "sparse data wrong\n");
+    exit();
+  }
+  if(read(fd, buf, 1) != 1 || buf[0] != 0){
+    printf(1, "sparse tail of block not zero\n");
+    exit();
+  }
+  close(fd);
+  unlink("sparse");
+
+  printf(1, "sparse ok\n");
+}
+
+// a small file lives in its inode until it grows
+// past the inline area; its data must survive the move.
+void
+inlinetest(void)
+{
+  int fd, i, n;
+
+  printf(1, "inline test\n");
+
+  unlink("inline");
+  fd = open("inline", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "create inline failed\n");
+    exit();
+  }
+  for(i = 0; i < 100; i++){
+    buf[0] = 'a' + i%26;
+    if(write(fd, buf, 1) != 1){
+      printf(1, "write inline failed\n");
+      exit();
+    }
+  }
+  close(fd);
+
+  fd = open("inline", O_RDONLY);
+  n = read(fd, buf, sizeof(buf));
+  close(fd);
+  if(n != 100){
+    printf(1, "inline read %d bytes\n", n);
+    exit();
+  }
+  for(i = 0; i < 100; i++){
+    if(buf[i] != 'a' + i%26){
+      printf(1, "inline wrong data at %d\n", i);
+      exit();
+    }
+  }
+  unlink("inline");
+
+  printf(1, "inline ok\n");
+}
+
+// a user fault is reported by the kernel, and dmesg
+// can read the report back.
+void
+dmesgtest(void)
+{
+  int i, n, pid;
+
+  printf(1, "dmesg test\n");
+
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    *(char*)0x80000000 = 1;  // kernel memory: killed with a report
+    exit();
+  }
+  wait();
+  sleep(2);
+
+  n = dmesg(buf, sizeof(buf));
+  if(n <= 0 || n > sizeof(buf)){
+    printf(1, "dmesg returned %d\n", n);
+    exit();
+  }
+  for(i = 0; i + 4 <= n; i++)
+    if(buf[i] == 't' && buf[i+1] == 'r' && buf[i+2] == 'a' && buf[i+3] == 'p')
+      break;
+  if(i + 4 > n){
+    printf(1, "dmesg has no trap report\n");
+    exit();
+  }
+  if(dmesg(buf, 4) > 4){
+    printf(1, "dmesg overran its buffer\n");
+    exit();
+  }
+
+  printf(1, "dmesg ok\n");
+}
+
+// buffered printf output to a file reaches it once,
+// in order, even across fork.
+void
+stdiotest(void)
+{
+  int fd, n, pid, fds[2];
+  struct stat st;
+
+  printf(1, "stdio test\n");
+
+  unlink("stdio");
+  fd = open("stdio", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "create stdio failed\n");
+    exit();
+  }
+  printf(fd, "ab");
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    printf(fd, "c");
+    exit();
+  }
+  wait();
+  printf(fd, "%d", 12);
+  close(fd);
+
+  fd = open("stdio", O_RDONLY);
+  n = read(fd, buf, sizeof(buf));
+  close(fd);
+  if(n != 5 || buf[0] != 'a' || buf[1] != 'b' || buf[2] != 'c' ||
+     buf[3] != '1' || buf[4] != '2'){
+    printf(1, "stdio wrong data, %d bytes\n", n);
+    exit();
+  }
+  unlink("stdio");
+
+  // Output to a pipe is buffered too: nothing reaches the
+  // pipe until the buffer is flushed.
+  if(pipe(fds) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  printf(fds[1], "xyz");
+  if(fstat(fds[0], &st) < 0 || st.type != T_PIPE || st.size != 0){
+    printf(1, "stdio pipe not buffered\n");
+    exit();
+  }
+  fflush(fds[1]);
+  if(fstat(fds[0], &st) < 0 || st.size != 3 ||
+     read(fds[0], buf, sizeof(buf)) != 3 || buf[0] != 'x' || buf[2] != 'z'){
+    printf(1, "stdio pipe wrong data\n");
+    exit();
+  }
+  close(fds[0]);
+  close(fds[1]);
+
+  printf(1, "stdio ok\n");
+}
+
+// fsync and fdatasync return once earlier writes are durable;
+// they reject bad fds.
+void
+fsynctest(void)
+{
+  int fd;
+
+  printf(1, "fsync test\n");
+
+  fd = open("fsync", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "create fsync failed\n");
+    exit();
+  }
+  if(write(fd, "aaaaaaaaaa", 10) != 10 || fsync(fd) != 0){
+    printf(1, "fsync failed\n");
+    exit();
+  }
+  // Nothing new to commit: must not wait.
+  if(fsync(fd) != 0){
+    printf(1, "second fsync failed\n");
+    exit();
+  }
+  close(fd);
+
+  // Overwrite in place: only data to write back.
+  fd = open("fsync", O_RDWR);
+  if(fd < 0 || write(fd, "bbbbb", 5) != 5 || fdatasync(fd) != 0){
+    printf(1, "fdatasync failed\n");
+    exit();
+  }
+  close(fd);
+  fd = open("fsync", O_RDONLY);
+  if(read(fd, buf, sizeof(buf)) != 10 || buf[4] != 'b' || buf[5] != 'a'){
+    printf(1, "fsync read back wrong\n");
+    exit();
+  }
+  close(fd);
+  if(fsync(fd) != -1 || fsync(-1) != -1){
+    printf(1, "fsync of bad fd succeeded\n");
+    exit();
+  }
+  unlink("fsync");
+
+  printf(1, "fsync ok\n");
+}
+
+// open, write, close and read back through one submission ring.
+void
+ioringtest(void)
+{
+  static struct ioring r;
+  struct iosqe *e;
+  int i, fd;
+
+  printf(1, "ioring test\n");
+
+  unlink("ioring");
+  for(i = 0; i < 10; i++)
+    buf[i] = 'a' + i;
+
+  e = &r.sq[r.sqtail++ % IORING_SIZE];
+  e->op = IO_OPEN;
+  e->addr = (uint)"ioring";
+  e->n = O_CREATE | O_RDWR;
+  if(iosubmit(&r) != 1 || r.cqtail != 1 || (fd = r.cq[0].res) < 0){
+    printf(1, "ioring open failed\n");
+    exit();
+  }
+  r.cqhead = r.cqtail;
+
+  for(i = 0; i < 10; i++){
+    e = &r.sq[r.sqtail++ % IORING_SIZE];
+    e->op = IO_WRITE;
+    e->fd = fd;
+    e->addr = (uint)(buf + i);
+    e->n = 1;
+    e->data = i;
+  }
+  e = &r.sq[r.sqtail++ % IORING_SIZE];
+  e->op = IO_CLOSE;
+  e->fd = fd;
+  e->data = 10;
+  if(iosubmit(&r) != 11){
+    printf(1, "ioring submit failed\n");
+    exit();
+  }
+  for(i = 0; i < 11; i++){
+    if(r.cq[(r.cqhead + i) % IORING_SIZE].data != i ||
+       r.cq[(r.cqhead + i) % IORING_SIZE].res != (i < 10 ? 1 : 0)){
+      printf(1, "ioring completion %d wrong\n", i);
+      exit();
+    }
+  }
+  r.cqhead = r.cqtail;
+
+  fd = open("ioring", O_RDONLY);
+  if(fd < 0 || read(fd, buf + 100, 20) != 10){
+    printf(1, "ioring read back failed\n");
+    exit();
+  }
+  for(i = 0; i < 10; i++){
+    if(buf[100 + i] != 'a' + i){
+      printf(1, "ioring wrong data\n");
+      exit();
+    }
+  }
+  close(fd);
+  unlink("ioring");
+
+  printf(1, "ioring ok\n");
+}
+
 // test writes that are larger than the log.
 void
 bigwrite(void)
@@ -1339,6 +2040,93 @@ dirfile(void)
   printf(1, "dir vs file OK\n");
 }
 
+// path lookups answered from the directory name cache
+// without inode locks agree with the locked walk, while
+// other processes change the same directory.
+void
+cachedpath(void)
+{
+  int fd, i, pi, pid;
+  char c;
+
+  printf(1, "cached path test\n");
+
+  if(mkdir("cp") < 0 || mkdir("cp/a") < 0 || mkdir("cp/a/b") < 0){
+    printf(1, "mkdir cp failed\n");
+    exit();
+  }
+  fd = open("cp/a/b/f", O_CREATE | O_RDWR);
+  if(fd < 0 || write(fd, "x", 1) != 1){
+    printf(1, "create cp/a/b/f failed\n");
+    exit();
+  }
+  close(fd);
+
+  for(pi = 0; pi < 4; pi++){
+    pid = fork();
+    if(pid < 0){
+      printf(1, "fork failed\n");
+      exit();
+    }
+    if(pid == 0 && pi == 3){
+      for(i = 0; i < 50; i++){
+        close(open("cp/a/b/g", O_CREATE | O_RDWR));
+        unlink("cp/a/b/g");
+      }
+      exit();
+    }
+    if(pid == 0){
+      for(i = 0; i < 100; i++){
+        fd = open("cp/a/b/f", 0);
+        if(fd < 0 || read(fd, &c, 1) != 1 || c != 'x'){
+          printf(1, "open cp/a/b/f failed\n");
+          exit();
+        }
+        close(fd);
+        if(open("cp/a/b/f/x", 0) >= 0){
+          printf(1, "opened a file as a directory\n");
+          exit();
+        }
+      }
+      exit();
+    }
+  }
+  for(pi = 0; pi < 4; pi++)
+    wait();
+
+  if(mkdir("cp/a/b/f/x") == 0){
+    printf(1, "mkdir under a file succeeded\n");
+    exit();
+  }
+  if(chdir("cp/a") < 0 || (fd = open("b/f", 0)) < 0){
+    printf(1, "relative open of b/f failed\n");
+    exit();
+  }
+  close(fd);
+  if(chdir("../..") < 0){
+    printf(1, "chdir ../.. failed\n");
+    exit();
+  }
+  if(unlink("cp/a/b/f") < 0){
+    printf(1, "unlink cp/a/b/f failed\n");
+    exit();
+  }
+  if(open("cp/a/b/f", 0) >= 0){
+    printf(1, "opened cp/a/b/f after unlink\n");
+    exit();
+  }
+  if(unlink("cp/a/b") < 0 || unlink("cp/a") < 0 || unlink("cp") < 0){
+    printf(1, "unlink cp failed\n");
+    exit();
+  }
+  if(open("cp/a/b/f", 0) >= 0 || open("cp", 0) >= 0){
+    printf(1, "opened cp after unlink\n");
+    exit();
+  }
+
+  printf(1, "cached path ok\n");
+}
+
 // test that iput() is called at the end of _namei()
 void
 iref(void)
@@ -1718,10 +2506,17 @@ main(int argc, char *argv[])
   linkunlink();
   concreate();
   fourfiles();
+  sharedread();
   sharedfd();
 
   bigargtest();
   bigwrite();
+  ioringtest();
+  fsynctest();
+  inlinetest();
+  sparsetest();
+  stdiotest();
+  dmesgtest();
   bigargtest();
   bsstest();
   sbrktest();
@@ -1737,7 +2532,11 @@ main(int argc, char *argv[])
   iputtest();
 
   mem();
+  malloctest();
+  manyproctest();
+  lockstattest();
   pipe1();
+  splicetest();
   preempt();
   exitwait();
 
@@ -1748,9 +2547,11 @@ main(int argc, char *argv[])
   linktest();
   unlinkread();
   dirfile();
+  cachedpath();
   iref();
   forktest();
   bigdir(); // slow
+  hashsplit(); // slow
   exectest();
 
   exit();
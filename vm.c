@@ -170,6 +170,8 @@ switchuvm(struct proc *p)
   cpu->ts.ss0 = SEG_KDATA << 3;
   cpu->ts.esp0 = (uint)proc->kstack + KSTACKSIZE;
   ltr(SEG_TSS << 3);
+  if(havesysenter)
+    wrmsr(MSR_SYSENTER_ESP, (uint)proc->kstack + KSTACKSIZE, 0);
   if(p->pgdir == 0)
     panic("switchuvm: no pgdir");
   lcr3(v2p(p->pgdir));  // switch to new address space
@@ -0,0 +1,2735 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <wc>:
+
+char buf[512];
+
+void
+wc(int fd, char *name)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 28             	sub    $0x28,%esp
+  int i, n;
+  int l, w, c, inword;
+
+  l = w = c = 0;
+       6:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+       d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      10:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      13:	8b 45 ec             	mov    -0x14(%ebp),%eax
+      16:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  inword = 0;
+      19:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+      20:	eb 69                	jmp    8b <wc+0x8b>
+    for(i=0; i<n; i++){
+      22:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+      29:	eb 58                	jmp    83 <wc+0x83>
+      c++;
+      2b:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+      if(buf[i] == '\n')
+      2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      32:	05 60 1a 00 00       	add    $0x1a60,%eax
+      37:	0f b6 00             	movzbl (%eax),%eax
+      3a:	3c 0a                	cmp    $0xa,%al
+      3c:	75 04                	jne    42 <wc+0x42>
+        l++;
+      3e:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+      if(strchr(" \r\t\n\v", buf[i]))
+      42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      45:	05 60 1a 00 00       	add    $0x1a60,%eax
+      4a:	0f b6 00             	movzbl (%eax),%eax
+      4d:	0f be c0             	movsbl %al,%eax
+      50:	83 ec 08             	sub    $0x8,%esp
+      53:	50                   	push   %eax
+      54:	68 3f 15 00 00       	push   $0x153f
+      59:	e8 41 04 00 00       	call   49f <strchr>
+      5e:	83 c4 10             	add    $0x10,%esp
+      61:	85 c0                	test   %eax,%eax
+      63:	74 09                	je     6e <wc+0x6e>
+        inword = 0;
+      65:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+      6c:	eb 11                	jmp    7f <wc+0x7f>
+      else if(!inword){
+      6e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+      72:	75 0b                	jne    7f <wc+0x7f>
+        w++;
+      74:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+        inword = 1;
+      78:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+    for(i=0; i<n; i++){
+      7f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+      83:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      86:	3b 45 e0             	cmp    -0x20(%ebp),%eax
+      89:	7c a0                	jl     2b <wc+0x2b>
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+      8b:	83 ec 04             	sub    $0x4,%esp
+      8e:	68 00 02 00 00       	push   $0x200
+      93:	68 60 1a 00 00       	push   $0x1a60
+      98:	ff 75 08             	push   0x8(%ebp)
+      9b:	e8 36 07 00 00       	call   7d6 <read>
+      a0:	83 c4 10             	add    $0x10,%esp
+      a3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      a6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+      aa:	0f 8f 72 ff ff ff    	jg     22 <wc+0x22>
+      }
+    }
+  }
+  if(n < 0){
+      b0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+      b4:	79 17                	jns    cd <wc+0xcd>
+    printf(1, "wc: read error\n");
+      b6:	83 ec 08             	sub    $0x8,%esp
+      b9:	68 45 15 00 00       	push   $0x1545
+      be:	6a 01                	push   $0x1
+      c0:	e8 66 09 00 00       	call   a2b <printf>
+      c5:	83 c4 10             	add    $0x10,%esp
+    exit();
+      c8:	e8 fa 13 00 00       	call   14c7 <exit>
+  }
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+      cd:	83 ec 08             	sub    $0x8,%esp
+      d0:	ff 75 0c             	push   0xc(%ebp)
+      d3:	ff 75 e8             	push   -0x18(%ebp)
+      d6:	ff 75 ec             	push   -0x14(%ebp)
+      d9:	ff 75 f0             	push   -0x10(%ebp)
+      dc:	68 55 15 00 00       	push   $0x1555
+      e1:	6a 01                	push   $0x1
+      e3:	e8 43 09 00 00       	call   a2b <printf>
+      e8:	83 c4 20             	add    $0x20,%esp
+}
+      eb:	90                   	nop
+      ec:	c9                   	leave
+      ed:	c3                   	ret
+
+000000ee <main>:
+
+int
+main(int argc, char *argv[])
+{
+      ee:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+      f2:	83 e4 f0             	and    $0xfffffff0,%esp
+      f5:	ff 71 fc             	push   -0x4(%ecx)
+      f8:	55                   	push   %ebp
+      f9:	89 e5                	mov    %esp,%ebp
+      fb:	53                   	push   %ebx
+      fc:	51                   	push   %ecx
+      fd:	83 ec 10             	sub    $0x10,%esp
+     100:	89 cb                	mov    %ecx,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+     102:	83 3b 01             	cmpl   $0x1,(%ebx)
+     105:	7f 17                	jg     11e <main+0x30>
+    wc(0, "");
+     107:	83 ec 08             	sub    $0x8,%esp
+     10a:	68 62 15 00 00       	push   $0x1562
+     10f:	6a 00                	push   $0x0
+     111:	e8 ea fe ff ff       	call   0 <wc>
+     116:	83 c4 10             	add    $0x10,%esp
+    exit();
+     119:	e8 a9 13 00 00       	call   14c7 <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+     11e:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+     125:	e9 83 00 00 00       	jmp    1ad <main+0xbf>
+    if((fd = open(argv[i], 0)) < 0){
+     12a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     12d:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     134:	8b 43 04             	mov    0x4(%ebx),%eax
+     137:	01 d0                	add    %edx,%eax
+     139:	8b 00                	mov    (%eax),%eax
+     13b:	83 ec 08             	sub    $0x8,%esp
+     13e:	6a 00                	push   $0x0
+     140:	50                   	push   %eax
+     141:	e8 db 06 00 00       	call   821 <open>
+     146:	83 c4 10             	add    $0x10,%esp
+     149:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     14c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     150:	79 29                	jns    17b <main+0x8d>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+     152:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     155:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     15c:	8b 43 04             	mov    0x4(%ebx),%eax
+     15f:	01 d0                	add    %edx,%eax
+     161:	8b 00                	mov    (%eax),%eax
+     163:	83 ec 04             	sub    $0x4,%esp
+     166:	50                   	push   %eax
+     167:	68 63 15 00 00       	push   $0x1563
+     16c:	6a 01                	push   $0x1
+     16e:	e8 b8 08 00 00       	call   a2b <printf>
+     173:	83 c4 10             	add    $0x10,%esp
+      exit();
+     176:	e8 4c 13 00 00       	call   14c7 <exit>
+    }
+    wc(fd, argv[i]);
+     17b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     17e:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     185:	8b 43 04             	mov    0x4(%ebx),%eax
+     188:	01 d0                	add    %edx,%eax
+     18a:	8b 00                	mov    (%eax),%eax
+     18c:	83 ec 08             	sub    $0x8,%esp
+     18f:	50                   	push   %eax
+     190:	ff 75 f0             	push   -0x10(%ebp)
+     193:	e8 68 fe ff ff       	call   0 <wc>
+     198:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+     19b:	83 ec 0c             	sub    $0xc,%esp
+     19e:	ff 75 f0             	push   -0x10(%ebp)
+     1a1:	e8 39 13 00 00       	call   14df <close>
+     1a6:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++){
+     1a9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     1ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     1b0:	3b 03                	cmp    (%ebx),%eax
+     1b2:	0f 8c 72 ff ff ff    	jl     12a <main+0x3c>
+  }
+  exit();
+     1b8:	e8 0a 13 00 00       	call   14c7 <exit>
+
+000001bd <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+     1bd:	55                   	push   %ebp
+     1be:	89 e5                	mov    %esp,%ebp
+     1c0:	57                   	push   %edi
+     1c1:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+     1c2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     1c5:	8b 55 10             	mov    0x10(%ebp),%edx
+     1c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+     1cb:	89 cb                	mov    %ecx,%ebx
+     1cd:	89 df                	mov    %ebx,%edi
+     1cf:	89 d1                	mov    %edx,%ecx
+     1d1:	fc                   	cld
+     1d2:	f3 aa                	rep stos %al,%es:(%edi)
+     1d4:	89 ca                	mov    %ecx,%edx
+     1d6:	89 fb                	mov    %edi,%ebx
+     1d8:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     1db:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     1de:	90                   	nop
+     1df:	5b                   	pop    %ebx
+     1e0:	5f                   	pop    %edi
+     1e1:	5d                   	pop    %ebp
+     1e2:	c3                   	ret
+
+000001e3 <stosl>:
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+     1e3:	55                   	push   %ebp
+     1e4:	89 e5                	mov    %esp,%ebp
+     1e6:	57                   	push   %edi
+     1e7:	53                   	push   %ebx
+  asm volatile("cld; rep stosl" :
+     1e8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     1eb:	8b 55 10             	mov    0x10(%ebp),%edx
+     1ee:	8b 45 0c             	mov    0xc(%ebp),%eax
+     1f1:	89 cb                	mov    %ecx,%ebx
+     1f3:	89 df                	mov    %ebx,%edi
+     1f5:	89 d1                	mov    %edx,%ecx
+     1f7:	fc                   	cld
+     1f8:	f3 ab                	rep stos %eax,%es:(%edi)
+     1fa:	89 ca                	mov    %ecx,%edx
+     1fc:	89 fb                	mov    %edi,%ebx
+     1fe:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     201:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     204:	90                   	nop
+     205:	5b                   	pop    %ebx
+     206:	5f                   	pop    %edi
+     207:	5d                   	pop    %ebp
+     208:	c3                   	ret
+
+00000209 <movsb>:
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+     209:	55                   	push   %ebp
+     20a:	89 e5                	mov    %esp,%ebp
+     20c:	57                   	push   %edi
+     20d:	56                   	push   %esi
+     20e:	53                   	push   %ebx
+  asm volatile("cld; rep movsb" :
+     20f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     212:	8b 55 0c             	mov    0xc(%ebp),%edx
+     215:	8b 45 10             	mov    0x10(%ebp),%eax
+     218:	89 cb                	mov    %ecx,%ebx
+     21a:	89 df                	mov    %ebx,%edi
+     21c:	89 d6                	mov    %edx,%esi
+     21e:	89 c1                	mov    %eax,%ecx
+     220:	fc                   	cld
+     221:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     223:	89 c8                	mov    %ecx,%eax
+     225:	89 f2                	mov    %esi,%edx
+     227:	89 fb                	mov    %edi,%ebx
+     229:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     22c:	89 55 0c             	mov    %edx,0xc(%ebp)
+     22f:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     232:	90                   	nop
+     233:	5b                   	pop    %ebx
+     234:	5e                   	pop    %esi
+     235:	5f                   	pop    %edi
+     236:	5d                   	pop    %ebp
+     237:	c3                   	ret
+
+00000238 <movsl>:
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+     238:	55                   	push   %ebp
+     239:	89 e5                	mov    %esp,%ebp
+     23b:	57                   	push   %edi
+     23c:	56                   	push   %esi
+     23d:	53                   	push   %ebx
+  asm volatile("cld; rep movsl" :
+     23e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     241:	8b 55 0c             	mov    0xc(%ebp),%edx
+     244:	8b 45 10             	mov    0x10(%ebp),%eax
+     247:	89 cb                	mov    %ecx,%ebx
+     249:	89 df                	mov    %ebx,%edi
+     24b:	89 d6                	mov    %edx,%esi
+     24d:	89 c1                	mov    %eax,%ecx
+     24f:	fc                   	cld
+     250:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     252:	89 c8                	mov    %ecx,%eax
+     254:	89 f2                	mov    %esi,%edx
+     256:	89 fb                	mov    %edi,%ebx
+     258:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     25b:	89 55 0c             	mov    %edx,0xc(%ebp)
+     25e:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+     261:	90                   	nop
+     262:	5b                   	pop    %ebx
+     263:	5e                   	pop    %esi
+     264:	5f                   	pop    %edi
+     265:	5d                   	pop    %ebp
+     266:	c3                   	ret
+
+00000267 <strcpy>:
+#define ONES        0x01010101
+#define HASZERO(x)  (((x) - ONES) & ~(x) & (ONES << 7))
+
+char*
+strcpy(char *s, char *t)
+{
+     267:	55                   	push   %ebp
+     268:	89 e5                	mov    %esp,%ebp
+     26a:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+     26d:	8b 45 08             	mov    0x8(%ebp),%eax
+     270:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     273:	90                   	nop
+     274:	8b 55 0c             	mov    0xc(%ebp),%edx
+     277:	8d 42 01             	lea    0x1(%edx),%eax
+     27a:	89 45 0c             	mov    %eax,0xc(%ebp)
+     27d:	8b 45 08             	mov    0x8(%ebp),%eax
+     280:	8d 48 01             	lea    0x1(%eax),%ecx
+     283:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     286:	0f b6 12             	movzbl (%edx),%edx
+     289:	88 10                	mov    %dl,(%eax)
+     28b:	0f b6 00             	movzbl (%eax),%eax
+     28e:	84 c0                	test   %al,%al
+     290:	75 e2                	jne    274 <strcpy+0xd>
+    ;
+  return os;
+     292:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     295:	c9                   	leave
+     296:	c3                   	ret
+
+00000297 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     297:	55                   	push   %ebp
+     298:	89 e5                	mov    %esp,%ebp
+  // Aligned words never straddle a page, so reading
+  // whole ones past the end of a string is safe.
+  if((((uint)p | (uint)q) & 3) == 0)
+     29a:	8b 55 08             	mov    0x8(%ebp),%edx
+     29d:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2a0:	09 d0                	or     %edx,%eax
+     2a2:	83 e0 03             	and    $0x3,%eax
+     2a5:	85 c0                	test   %eax,%eax
+     2a7:	75 3f                	jne    2e8 <strcmp+0x51>
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     2a9:	eb 08                	jmp    2b3 <strcmp+0x1c>
+      p += 4, q += 4;
+     2ab:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     2af:	83 45 0c 04          	addl   $0x4,0xc(%ebp)
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     2b3:	8b 45 08             	mov    0x8(%ebp),%eax
+     2b6:	8b 10                	mov    (%eax),%edx
+     2b8:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2bb:	8b 00                	mov    (%eax),%eax
+     2bd:	39 c2                	cmp    %eax,%edx
+     2bf:	75 27                	jne    2e8 <strcmp+0x51>
+     2c1:	8b 45 08             	mov    0x8(%ebp),%eax
+     2c4:	8b 00                	mov    (%eax),%eax
+     2c6:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     2cc:	8b 45 08             	mov    0x8(%ebp),%eax
+     2cf:	8b 00                	mov    (%eax),%eax
+     2d1:	f7 d0                	not    %eax
+     2d3:	21 d0                	and    %edx,%eax
+     2d5:	25 80 80 80 80       	and    $0x80808080,%eax
+     2da:	85 c0                	test   %eax,%eax
+     2dc:	74 cd                	je     2ab <strcmp+0x14>
+  while(*p && *p == *q)
+     2de:	eb 08                	jmp    2e8 <strcmp+0x51>
+    p++, q++;
+     2e0:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     2e4:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     2e8:	8b 45 08             	mov    0x8(%ebp),%eax
+     2eb:	0f b6 00             	movzbl (%eax),%eax
+     2ee:	84 c0                	test   %al,%al
+     2f0:	74 10                	je     302 <strcmp+0x6b>
+     2f2:	8b 45 08             	mov    0x8(%ebp),%eax
+     2f5:	0f b6 10             	movzbl (%eax),%edx
+     2f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2fb:	0f b6 00             	movzbl (%eax),%eax
+     2fe:	38 c2                	cmp    %al,%dl
+     300:	74 de                	je     2e0 <strcmp+0x49>
+  return (uchar)*p - (uchar)*q;
+     302:	8b 45 08             	mov    0x8(%ebp),%eax
+     305:	0f b6 00             	movzbl (%eax),%eax
+     308:	0f b6 d0             	movzbl %al,%edx
+     30b:	8b 45 0c             	mov    0xc(%ebp),%eax
+     30e:	0f b6 00             	movzbl (%eax),%eax
+     311:	0f b6 c0             	movzbl %al,%eax
+     314:	29 c2                	sub    %eax,%edx
+     316:	89 d0                	mov    %edx,%eax
+}
+     318:	5d                   	pop    %ebp
+     319:	c3                   	ret
+
+0000031a <strlen>:
+
+uint
+strlen(char *s)
+{
+     31a:	55                   	push   %ebp
+     31b:	89 e5                	mov    %esp,%ebp
+     31d:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; ((uint)(s+n) & 3) && s[n]; n++)
+     320:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     327:	eb 04                	jmp    32d <strlen+0x13>
+     329:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     32d:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     330:	8b 45 08             	mov    0x8(%ebp),%eax
+     333:	01 d0                	add    %edx,%eax
+     335:	83 e0 03             	and    $0x3,%eax
+     338:	85 c0                	test   %eax,%eax
+     33a:	74 0f                	je     34b <strlen+0x31>
+     33c:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     33f:	8b 45 08             	mov    0x8(%ebp),%eax
+     342:	01 d0                	add    %edx,%eax
+     344:	0f b6 00             	movzbl (%eax),%eax
+     347:	84 c0                	test   %al,%al
+     349:	75 de                	jne    329 <strlen+0xf>
+    ;
+  if(s[n])
+     34b:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     34e:	8b 45 08             	mov    0x8(%ebp),%eax
+     351:	01 d0                	add    %edx,%eax
+     353:	0f b6 00             	movzbl (%eax),%eax
+     356:	84 c0                	test   %al,%al
+     358:	74 33                	je     38d <strlen+0x73>
+    while(!HASZERO(*(uint*)(s+n)))
+     35a:	eb 04                	jmp    360 <strlen+0x46>
+      n += 4;
+     35c:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+    while(!HASZERO(*(uint*)(s+n)))
+     360:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     363:	8b 45 08             	mov    0x8(%ebp),%eax
+     366:	01 d0                	add    %edx,%eax
+     368:	8b 00                	mov    (%eax),%eax
+     36a:	8d 88 ff fe fe fe    	lea    -0x1010101(%eax),%ecx
+     370:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     373:	8b 45 08             	mov    0x8(%ebp),%eax
+     376:	01 d0                	add    %edx,%eax
+     378:	8b 00                	mov    (%eax),%eax
+     37a:	f7 d0                	not    %eax
+     37c:	21 c8                	and    %ecx,%eax
+     37e:	25 80 80 80 80       	and    $0x80808080,%eax
+     383:	85 c0                	test   %eax,%eax
+     385:	74 d5                	je     35c <strlen+0x42>
+  for(; s[n]; n++)
+     387:	eb 04                	jmp    38d <strlen+0x73>
+     389:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     38d:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     390:	8b 45 08             	mov    0x8(%ebp),%eax
+     393:	01 d0                	add    %edx,%eax
+     395:	0f b6 00             	movzbl (%eax),%eax
+     398:	84 c0                	test   %al,%al
+     39a:	75 ed                	jne    389 <strlen+0x6f>
+    ;
+  return n;
+     39c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     39f:	c9                   	leave
+     3a0:	c3                   	ret
+
+000003a1 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     3a1:	55                   	push   %ebp
+     3a2:	89 e5                	mov    %esp,%ebp
+     3a4:	83 ec 10             	sub    $0x10,%esp
+  char *d;
+  uint k;
+
+  d = dst;
+     3a7:	8b 45 08             	mov    0x8(%ebp),%eax
+     3aa:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c &= 0xFF;
+     3ad:	81 65 0c ff 00 00 00 	andl   $0xff,0xc(%ebp)
+  if(n >= 16){
+     3b4:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     3b8:	76 54                	jbe    40e <memset+0x6d>
+    k = -(uint)d & 3;  // bytes up to a word boundary
+     3ba:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     3bd:	f7 d8                	neg    %eax
+     3bf:	83 e0 03             	and    $0x3,%eax
+     3c2:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    stosb(d, c, k);
+     3c5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3c8:	50                   	push   %eax
+     3c9:	ff 75 0c             	push   0xc(%ebp)
+     3cc:	ff 75 fc             	push   -0x4(%ebp)
+     3cf:	e8 e9 fd ff ff       	call   1bd <stosb>
+     3d4:	83 c4 0c             	add    $0xc,%esp
+    d += k;
+     3d7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3da:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n -= k;
+     3dd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     3e0:	29 45 10             	sub    %eax,0x10(%ebp)
+    stosl(d, c*ONES, n/4);
+     3e3:	8b 45 10             	mov    0x10(%ebp),%eax
+     3e6:	c1 e8 02             	shr    $0x2,%eax
+     3e9:	89 c2                	mov    %eax,%edx
+     3eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3ee:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     3f4:	52                   	push   %edx
+     3f5:	50                   	push   %eax
+     3f6:	ff 75 fc             	push   -0x4(%ebp)
+     3f9:	e8 e5 fd ff ff       	call   1e3 <stosl>
+     3fe:	83 c4 0c             	add    $0xc,%esp
+    d += n & ~3;
+     401:	8b 45 10             	mov    0x10(%ebp),%eax
+     404:	83 e0 fc             	and    $0xfffffffc,%eax
+     407:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n &= 3;
+     40a:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+  }
+  stosb(d, c, n);
+     40e:	8b 45 10             	mov    0x10(%ebp),%eax
+     411:	50                   	push   %eax
+     412:	ff 75 0c             	push   0xc(%ebp)
+     415:	ff 75 fc             	push   -0x4(%ebp)
+     418:	e8 a0 fd ff ff       	call   1bd <stosb>
+     41d:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     420:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     423:	c9                   	leave
+     424:	c3                   	ret
+
+00000425 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     425:	55                   	push   %ebp
+     426:	89 e5                	mov    %esp,%ebp
+     428:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s1, *s2;
+
+  s1 = v1;
+     42b:	8b 45 08             	mov    0x8(%ebp),%eax
+     42e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s2 = v2;
+     431:	8b 45 0c             	mov    0xc(%ebp),%eax
+     434:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     437:	eb 0c                	jmp    445 <memcmp+0x20>
+    s1 += 4, s2 += 4, n -= 4;
+     439:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+     43d:	83 45 f8 04          	addl   $0x4,-0x8(%ebp)
+     441:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     445:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     449:	76 3e                	jbe    489 <memcmp+0x64>
+     44b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     44e:	8b 10                	mov    (%eax),%edx
+     450:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     453:	8b 00                	mov    (%eax),%eax
+     455:	39 c2                	cmp    %eax,%edx
+     457:	74 e0                	je     439 <memcmp+0x14>
+  while(n-- > 0){
+     459:	eb 2e                	jmp    489 <memcmp+0x64>
+    if(*s1 != *s2)
+     45b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     45e:	0f b6 10             	movzbl (%eax),%edx
+     461:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     464:	0f b6 00             	movzbl (%eax),%eax
+     467:	38 c2                	cmp    %al,%dl
+     469:	74 16                	je     481 <memcmp+0x5c>
+      return *s1 - *s2;
+     46b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     46e:	0f b6 00             	movzbl (%eax),%eax
+     471:	0f b6 d0             	movzbl %al,%edx
+     474:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     477:	0f b6 00             	movzbl (%eax),%eax
+     47a:	0f b6 c0             	movzbl %al,%eax
+     47d:	29 c2                	sub    %eax,%edx
+     47f:	eb 1a                	jmp    49b <memcmp+0x76>
+    s1++, s2++;
+     481:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     485:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+  while(n-- > 0){
+     489:	8b 45 10             	mov    0x10(%ebp),%eax
+     48c:	8d 50 ff             	lea    -0x1(%eax),%edx
+     48f:	89 55 10             	mov    %edx,0x10(%ebp)
+     492:	85 c0                	test   %eax,%eax
+     494:	75 c5                	jne    45b <memcmp+0x36>
+  }
+  return 0;
+     496:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+     49b:	89 d0                	mov    %edx,%eax
+     49d:	c9                   	leave
+     49e:	c3                   	ret
+
+0000049f <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     49f:	55                   	push   %ebp
+     4a0:	89 e5                	mov    %esp,%ebp
+     4a2:	83 ec 14             	sub    $0x14,%esp
+     4a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4a8:	88 45 ec             	mov    %al,-0x14(%ebp)
+  uint w, cc;
+
+  // Skip whole words holding neither c nor the terminator.
+  for(; ((uint)s & 3) && *s; s++)
+     4ab:	eb 17                	jmp    4c4 <strchr+0x25>
+    if(*s == c)
+     4ad:	8b 45 08             	mov    0x8(%ebp),%eax
+     4b0:	0f b6 00             	movzbl (%eax),%eax
+     4b3:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     4b6:	75 08                	jne    4c0 <strchr+0x21>
+      return (char*)s;
+     4b8:	8b 45 08             	mov    0x8(%ebp),%eax
+     4bb:	e9 ad 00 00 00       	jmp    56d <strchr+0xce>
+  for(; ((uint)s & 3) && *s; s++)
+     4c0:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     4c4:	8b 45 08             	mov    0x8(%ebp),%eax
+     4c7:	83 e0 03             	and    $0x3,%eax
+     4ca:	85 c0                	test   %eax,%eax
+     4cc:	74 0a                	je     4d8 <strchr+0x39>
+     4ce:	8b 45 08             	mov    0x8(%ebp),%eax
+     4d1:	0f b6 00             	movzbl (%eax),%eax
+     4d4:	84 c0                	test   %al,%al
+     4d6:	75 d5                	jne    4ad <strchr+0xe>
+  cc = (uchar)c * ONES;
+     4d8:	0f b6 45 ec          	movzbl -0x14(%ebp),%eax
+     4dc:	0f b6 c0             	movzbl %al,%eax
+     4df:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     4e5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(*s)
+     4e8:	8b 45 08             	mov    0x8(%ebp),%eax
+     4eb:	0f b6 00             	movzbl (%eax),%eax
+     4ee:	84 c0                	test   %al,%al
+     4f0:	74 6c                	je     55e <strchr+0xbf>
+    for(; w = *(uint*)s, !HASZERO(w) && !HASZERO(w ^ cc); s += 4)
+     4f2:	eb 04                	jmp    4f8 <strchr+0x59>
+     4f4:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     4f8:	8b 45 08             	mov    0x8(%ebp),%eax
+     4fb:	8b 00                	mov    (%eax),%eax
+     4fd:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     500:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     503:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     509:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     50c:	f7 d0                	not    %eax
+     50e:	21 d0                	and    %edx,%eax
+     510:	25 80 80 80 80       	and    $0x80808080,%eax
+     515:	85 c0                	test   %eax,%eax
+     517:	75 26                	jne    53f <strchr+0xa0>
+     519:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     51c:	33 45 fc             	xor    -0x4(%ebp),%eax
+     51f:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     525:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     528:	33 45 fc             	xor    -0x4(%ebp),%eax
+     52b:	f7 d0                	not    %eax
+     52d:	21 d0                	and    %edx,%eax
+     52f:	25 80 80 80 80       	and    $0x80808080,%eax
+     534:	85 c0                	test   %eax,%eax
+     536:	75 07                	jne    53f <strchr+0xa0>
+     538:	b8 01 00 00 00       	mov    $0x1,%eax
+     53d:	eb 05                	jmp    544 <strchr+0xa5>
+     53f:	b8 00 00 00 00       	mov    $0x0,%eax
+     544:	85 c0                	test   %eax,%eax
+     546:	75 ac                	jne    4f4 <strchr+0x55>
+      ;
+  for(; *s; s++)
+     548:	eb 14                	jmp    55e <strchr+0xbf>
+    if(*s == c)
+     54a:	8b 45 08             	mov    0x8(%ebp),%eax
+     54d:	0f b6 00             	movzbl (%eax),%eax
+     550:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     553:	75 05                	jne    55a <strchr+0xbb>
+      return (char*)s;
+     555:	8b 45 08             	mov    0x8(%ebp),%eax
+     558:	eb 13                	jmp    56d <strchr+0xce>
+  for(; *s; s++)
+     55a:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     55e:	8b 45 08             	mov    0x8(%ebp),%eax
+     561:	0f b6 00             	movzbl (%eax),%eax
+     564:	84 c0                	test   %al,%al
+     566:	75 e2                	jne    54a <strchr+0xab>
+  return 0;
+     568:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     56d:	c9                   	leave
+     56e:	c3                   	ret
+
+0000056f <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     56f:	55                   	push   %ebp
+     570:	89 e5                	mov    %esp,%ebp
+     572:	83 ec 18             	sub    $0x18,%esp
+  int i, c;
+
+  for(i=0; i+1 < max; ){
+     575:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     57c:	eb 37                	jmp    5b5 <gets+0x46>
+    c = fgetc(0);
+     57e:	83 ec 0c             	sub    $0xc,%esp
+     581:	6a 00                	push   $0x0
+     583:	e8 2e 0e 00 00       	call   13b6 <fgetc>
+     588:	83 c4 10             	add    $0x10,%esp
+     58b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(c < 0)
+     58e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     592:	78 2e                	js     5c2 <gets+0x53>
+      break;
+    buf[i++] = c;
+     594:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     597:	8d 50 01             	lea    0x1(%eax),%edx
+     59a:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     59d:	89 c2                	mov    %eax,%edx
+     59f:	8b 45 08             	mov    0x8(%ebp),%eax
+     5a2:	01 d0                	add    %edx,%eax
+     5a4:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     5a7:	88 10                	mov    %dl,(%eax)
+    if(c == '\n' || c == '\r')
+     5a9:	83 7d f0 0a          	cmpl   $0xa,-0x10(%ebp)
+     5ad:	74 14                	je     5c3 <gets+0x54>
+     5af:	83 7d f0 0d          	cmpl   $0xd,-0x10(%ebp)
+     5b3:	74 0e                	je     5c3 <gets+0x54>
+  for(i=0; i+1 < max; ){
+     5b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5b8:	83 c0 01             	add    $0x1,%eax
+     5bb:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     5be:	7f be                	jg     57e <gets+0xf>
+     5c0:	eb 01                	jmp    5c3 <gets+0x54>
+      break;
+     5c2:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     5c3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     5c6:	8b 45 08             	mov    0x8(%ebp),%eax
+     5c9:	01 d0                	add    %edx,%eax
+     5cb:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     5ce:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     5d1:	c9                   	leave
+     5d2:	c3                   	ret
+
+000005d3 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     5d3:	55                   	push   %ebp
+     5d4:	89 e5                	mov    %esp,%ebp
+     5d6:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     5d9:	83 ec 08             	sub    $0x8,%esp
+     5dc:	6a 00                	push   $0x0
+     5de:	ff 75 08             	push   0x8(%ebp)
+     5e1:	e8 3b 02 00 00       	call   821 <open>
+     5e6:	83 c4 10             	add    $0x10,%esp
+     5e9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     5ec:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     5f0:	79 07                	jns    5f9 <stat+0x26>
+    return -1;
+     5f2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     5f7:	eb 25                	jmp    61e <stat+0x4b>
+  r = fstat(fd, st);
+     5f9:	83 ec 08             	sub    $0x8,%esp
+     5fc:	ff 75 0c             	push   0xc(%ebp)
+     5ff:	ff 75 f4             	push   -0xc(%ebp)
+     602:	e8 47 02 00 00       	call   84e <fstat>
+     607:	83 c4 10             	add    $0x10,%esp
+     60a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     60d:	83 ec 0c             	sub    $0xc,%esp
+     610:	ff 75 f4             	push   -0xc(%ebp)
+     613:	e8 c7 0e 00 00       	call   14df <close>
+     618:	83 c4 10             	add    $0x10,%esp
+  return r;
+     61b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     61e:	c9                   	leave
+     61f:	c3                   	ret
+
+00000620 <atoi>:
+
+int
+atoi(const char *s)
+{
+     620:	55                   	push   %ebp
+     621:	89 e5                	mov    %esp,%ebp
+     623:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     626:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     62d:	eb 25                	jmp    654 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     62f:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     632:	89 d0                	mov    %edx,%eax
+     634:	c1 e0 02             	shl    $0x2,%eax
+     637:	01 d0                	add    %edx,%eax
+     639:	01 c0                	add    %eax,%eax
+     63b:	89 c1                	mov    %eax,%ecx
+     63d:	8b 45 08             	mov    0x8(%ebp),%eax
+     640:	8d 50 01             	lea    0x1(%eax),%edx
+     643:	89 55 08             	mov    %edx,0x8(%ebp)
+     646:	0f b6 00             	movzbl (%eax),%eax
+     649:	0f be c0             	movsbl %al,%eax
+     64c:	01 c8                	add    %ecx,%eax
+     64e:	83 e8 30             	sub    $0x30,%eax
+     651:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     654:	8b 45 08             	mov    0x8(%ebp),%eax
+     657:	0f b6 00             	movzbl (%eax),%eax
+     65a:	3c 2f                	cmp    $0x2f,%al
+     65c:	7e 0a                	jle    668 <atoi+0x48>
+     65e:	8b 45 08             	mov    0x8(%ebp),%eax
+     661:	0f b6 00             	movzbl (%eax),%eax
+     664:	3c 39                	cmp    $0x39,%al
+     666:	7e c7                	jle    62f <atoi+0xf>
+  return n;
+     668:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     66b:	c9                   	leave
+     66c:	c3                   	ret
+
+0000066d <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     66d:	55                   	push   %ebp
+     66e:	89 e5                	mov    %esp,%ebp
+     670:	83 ec 10             	sub    $0x10,%esp
+  char *d, *s;
+  int k;
+
+  if(n <= 0)
+     673:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     677:	7f 08                	jg     681 <memmove+0x14>
+    return vdst;
+     679:	8b 45 08             	mov    0x8(%ebp),%eax
+     67c:	e9 17 01 00 00       	jmp    798 <memmove+0x12b>
+  d = vdst;
+     681:	8b 45 08             	mov    0x8(%ebp),%eax
+     684:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s = vsrc;
+     687:	8b 45 0c             	mov    0xc(%ebp),%eax
+     68a:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  if(s < d && s + n > d){
+     68d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     690:	3b 45 fc             	cmp    -0x4(%ebp),%eax
+     693:	0f 83 84 00 00 00    	jae    71d <memmove+0xb0>
+     699:	8b 55 10             	mov    0x10(%ebp),%edx
+     69c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     69f:	01 d0                	add    %edx,%eax
+     6a1:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     6a4:	73 77                	jae    71d <memmove+0xb0>
+    s += n;
+     6a6:	8b 45 10             	mov    0x10(%ebp),%eax
+     6a9:	01 45 f8             	add    %eax,-0x8(%ebp)
+    d += n;
+     6ac:	8b 45 10             	mov    0x10(%ebp),%eax
+     6af:	01 45 fc             	add    %eax,-0x4(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     6b2:	eb 17                	jmp    6cb <memmove+0x5e>
+      *--d = *--s, n--;
+     6b4:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     6b8:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     6bc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     6bf:	0f b6 10             	movzbl (%eax),%edx
+     6c2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     6c5:	88 10                	mov    %dl,(%eax)
+     6c7:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     6cb:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     6cf:	7e 22                	jle    6f3 <memmove+0x86>
+     6d1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     6d4:	83 e0 03             	and    $0x3,%eax
+     6d7:	85 c0                	test   %eax,%eax
+     6d9:	75 d9                	jne    6b4 <memmove+0x47>
+    for(; n >= 4; n -= 4){
+     6db:	eb 16                	jmp    6f3 <memmove+0x86>
+      d -= 4;
+     6dd:	83 6d fc 04          	subl   $0x4,-0x4(%ebp)
+      s -= 4;
+     6e1:	83 6d f8 04          	subl   $0x4,-0x8(%ebp)
+      *(uint*)d = *(uint*)s;
+     6e5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     6e8:	8b 10                	mov    (%eax),%edx
+     6ea:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     6ed:	89 10                	mov    %edx,(%eax)
+    for(; n >= 4; n -= 4){
+     6ef:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+     6f3:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     6f7:	7f e4                	jg     6dd <memmove+0x70>
+    }
+    while(n-- > 0)
+     6f9:	eb 13                	jmp    70e <memmove+0xa1>
+      *--d = *--s;
+     6fb:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     6ff:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     703:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     706:	0f b6 10             	movzbl (%eax),%edx
+     709:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     70c:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+     70e:	8b 45 10             	mov    0x10(%ebp),%eax
+     711:	8d 50 ff             	lea    -0x1(%eax),%edx
+     714:	89 55 10             	mov    %edx,0x10(%ebp)
+     717:	85 c0                	test   %eax,%eax
+     719:	7f e0                	jg     6fb <memmove+0x8e>
+  if(s < d && s + n > d){
+     71b:	eb 78                	jmp    795 <memmove+0x128>
+  } else {
+    if(n >= 16){
+     71d:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     721:	7e 61                	jle    784 <memmove+0x117>
+      k = -(uint)d & 3;
+     723:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     726:	f7 d8                	neg    %eax
+     728:	83 e0 03             	and    $0x3,%eax
+     72b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      movsb(d, s, k);
+     72e:	ff 75 f4             	push   -0xc(%ebp)
+     731:	ff 75 f8             	push   -0x8(%ebp)
+     734:	ff 75 fc             	push   -0x4(%ebp)
+     737:	e8 cd fa ff ff       	call   209 <movsb>
+     73c:	83 c4 0c             	add    $0xc,%esp
+      d += k;
+     73f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     742:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += k;
+     745:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     748:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n -= k;
+     74b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     74e:	29 45 10             	sub    %eax,0x10(%ebp)
+      movsl(d, s, n/4);
+     751:	8b 45 10             	mov    0x10(%ebp),%eax
+     754:	8d 50 03             	lea    0x3(%eax),%edx
+     757:	85 c0                	test   %eax,%eax
+     759:	0f 48 c2             	cmovs  %edx,%eax
+     75c:	c1 f8 02             	sar    $0x2,%eax
+     75f:	50                   	push   %eax
+     760:	ff 75 f8             	push   -0x8(%ebp)
+     763:	ff 75 fc             	push   -0x4(%ebp)
+     766:	e8 cd fa ff ff       	call   238 <movsl>
+     76b:	83 c4 0c             	add    $0xc,%esp
+      d += n & ~3;
+     76e:	8b 45 10             	mov    0x10(%ebp),%eax
+     771:	83 e0 fc             	and    $0xfffffffc,%eax
+     774:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += n & ~3;
+     777:	8b 45 10             	mov    0x10(%ebp),%eax
+     77a:	83 e0 fc             	and    $0xfffffffc,%eax
+     77d:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n &= 3;
+     780:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+    }
+    movsb(d, s, n);
+     784:	ff 75 10             	push   0x10(%ebp)
+     787:	ff 75 f8             	push   -0x8(%ebp)
+     78a:	ff 75 fc             	push   -0x4(%ebp)
+     78d:	e8 77 fa ff ff       	call   209 <movsb>
+     792:	83 c4 0c             	add    $0xc,%esp
+  }
+  return vdst;
+     795:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     798:	c9                   	leave
+     799:	c3                   	ret
+
+0000079a <_fork>:
+    movl %esp, %ecx; \
+    movl $1f, %edx; \
+    sysenter; \
+  1: ret
+
+RAWSYSCALL(fork)
+     79a:	b8 01 00 00 00       	mov    $0x1,%eax
+     79f:	89 e1                	mov    %esp,%ecx
+     7a1:	ba a8 07 00 00       	mov    $0x7a8,%edx
+     7a6:	0f 34                	sysenter
+     7a8:	c3                   	ret
+
+000007a9 <_exit>:
+RAWSYSCALL(exit)
+     7a9:	b8 02 00 00 00       	mov    $0x2,%eax
+     7ae:	89 e1                	mov    %esp,%ecx
+     7b0:	ba b7 07 00 00       	mov    $0x7b7,%edx
+     7b5:	0f 34                	sysenter
+     7b7:	c3                   	ret
+
+000007b8 <wait>:
+SYSCALL(wait)
+     7b8:	b8 03 00 00 00       	mov    $0x3,%eax
+     7bd:	89 e1                	mov    %esp,%ecx
+     7bf:	ba c6 07 00 00       	mov    $0x7c6,%edx
+     7c4:	0f 34                	sysenter
+     7c6:	c3                   	ret
+
+000007c7 <pipe>:
+SYSCALL(pipe)
+     7c7:	b8 04 00 00 00       	mov    $0x4,%eax
+     7cc:	89 e1                	mov    %esp,%ecx
+     7ce:	ba d5 07 00 00       	mov    $0x7d5,%edx
+     7d3:	0f 34                	sysenter
+     7d5:	c3                   	ret
+
+000007d6 <read>:
+SYSCALL(read)
+     7d6:	b8 05 00 00 00       	mov    $0x5,%eax
+     7db:	89 e1                	mov    %esp,%ecx
+     7dd:	ba e4 07 00 00       	mov    $0x7e4,%edx
+     7e2:	0f 34                	sysenter
+     7e4:	c3                   	ret
+
+000007e5 <write>:
+SYSCALL(write)
+     7e5:	b8 10 00 00 00       	mov    $0x10,%eax
+     7ea:	89 e1                	mov    %esp,%ecx
+     7ec:	ba f3 07 00 00       	mov    $0x7f3,%edx
+     7f1:	0f 34                	sysenter
+     7f3:	c3                   	ret
+
+000007f4 <_close>:
+RAWSYSCALL(close)
+     7f4:	b8 15 00 00 00       	mov    $0x15,%eax
+     7f9:	89 e1                	mov    %esp,%ecx
+     7fb:	ba 02 08 00 00       	mov    $0x802,%edx
+     800:	0f 34                	sysenter
+     802:	c3                   	ret
+
+00000803 <kill>:
+SYSCALL(kill)
+     803:	b8 06 00 00 00       	mov    $0x6,%eax
+     808:	89 e1                	mov    %esp,%ecx
+     80a:	ba 11 08 00 00       	mov    $0x811,%edx
+     80f:	0f 34                	sysenter
+     811:	c3                   	ret
+
+00000812 <_exec>:
+RAWSYSCALL(exec)
+     812:	b8 07 00 00 00       	mov    $0x7,%eax
+     817:	89 e1                	mov    %esp,%ecx
+     819:	ba 20 08 00 00       	mov    $0x820,%edx
+     81e:	0f 34                	sysenter
+     820:	c3                   	ret
+
+00000821 <open>:
+SYSCALL(open)
+     821:	b8 0f 00 00 00       	mov    $0xf,%eax
+     826:	89 e1                	mov    %esp,%ecx
+     828:	ba 2f 08 00 00       	mov    $0x82f,%edx
+     82d:	0f 34                	sysenter
+     82f:	c3                   	ret
+
+00000830 <mknod>:
+SYSCALL(mknod)
+     830:	b8 11 00 00 00       	mov    $0x11,%eax
+     835:	89 e1                	mov    %esp,%ecx
+     837:	ba 3e 08 00 00       	mov    $0x83e,%edx
+     83c:	0f 34                	sysenter
+     83e:	c3                   	ret
+
+0000083f <unlink>:
+SYSCALL(unlink)
+     83f:	b8 12 00 00 00       	mov    $0x12,%eax
+     844:	89 e1                	mov    %esp,%ecx
+     846:	ba 4d 08 00 00       	mov    $0x84d,%edx
+     84b:	0f 34                	sysenter
+     84d:	c3                   	ret
+
+0000084e <fstat>:
+SYSCALL(fstat)
+     84e:	b8 08 00 00 00       	mov    $0x8,%eax
+     853:	89 e1                	mov    %esp,%ecx
+     855:	ba 5c 08 00 00       	mov    $0x85c,%edx
+     85a:	0f 34                	sysenter
+     85c:	c3                   	ret
+
+0000085d <link>:
+SYSCALL(link)
+     85d:	b8 13 00 00 00       	mov    $0x13,%eax
+     862:	89 e1                	mov    %esp,%ecx
+     864:	ba 6b 08 00 00       	mov    $0x86b,%edx
+     869:	0f 34                	sysenter
+     86b:	c3                   	ret
+
+0000086c <mkdir>:
+SYSCALL(mkdir)
+     86c:	b8 14 00 00 00       	mov    $0x14,%eax
+     871:	89 e1                	mov    %esp,%ecx
+     873:	ba 7a 08 00 00       	mov    $0x87a,%edx
+     878:	0f 34                	sysenter
+     87a:	c3                   	ret
+
+0000087b <chdir>:
+SYSCALL(chdir)
+     87b:	b8 09 00 00 00       	mov    $0x9,%eax
+     880:	89 e1                	mov    %esp,%ecx
+     882:	ba 89 08 00 00       	mov    $0x889,%edx
+     887:	0f 34                	sysenter
+     889:	c3                   	ret
+
+0000088a <dup>:
+SYSCALL(dup)
+     88a:	b8 0a 00 00 00       	mov    $0xa,%eax
+     88f:	89 e1                	mov    %esp,%ecx
+     891:	ba 98 08 00 00       	mov    $0x898,%edx
+     896:	0f 34                	sysenter
+     898:	c3                   	ret
+
+00000899 <getpid>:
+SYSCALL(getpid)
+     899:	b8 0b 00 00 00       	mov    $0xb,%eax
+     89e:	89 e1                	mov    %esp,%ecx
+     8a0:	ba a7 08 00 00       	mov    $0x8a7,%edx
+     8a5:	0f 34                	sysenter
+     8a7:	c3                   	ret
+
+000008a8 <sbrk>:
+SYSCALL(sbrk)
+     8a8:	b8 0c 00 00 00       	mov    $0xc,%eax
+     8ad:	89 e1                	mov    %esp,%ecx
+     8af:	ba b6 08 00 00       	mov    $0x8b6,%edx
+     8b4:	0f 34                	sysenter
+     8b6:	c3                   	ret
+
+000008b7 <sleep>:
+SYSCALL(sleep)
+     8b7:	b8 0d 00 00 00       	mov    $0xd,%eax
+     8bc:	89 e1                	mov    %esp,%ecx
+     8be:	ba c5 08 00 00       	mov    $0x8c5,%edx
+     8c3:	0f 34                	sysenter
+     8c5:	c3                   	ret
+
+000008c6 <uptime>:
+SYSCALL(uptime)
+     8c6:	b8 0e 00 00 00       	mov    $0xe,%eax
+     8cb:	89 e1                	mov    %esp,%ecx
+     8cd:	ba d4 08 00 00       	mov    $0x8d4,%edx
+     8d2:	0f 34                	sysenter
+     8d4:	c3                   	ret
+
+000008d5 <getproc>:
+SYSCALL(getproc)
+     8d5:	b8 16 00 00 00       	mov    $0x16,%eax
+     8da:	89 e1                	mov    %esp,%ecx
+     8dc:	ba e3 08 00 00       	mov    $0x8e3,%edx
+     8e1:	0f 34                	sysenter
+     8e3:	c3                   	ret
+
+000008e4 <getpgs>:
+SYSCALL(getpgs)
+     8e4:	b8 17 00 00 00       	mov    $0x17,%eax
+     8e9:	89 e1                	mov    %esp,%ecx
+     8eb:	ba f2 08 00 00       	mov    $0x8f2,%edx
+     8f0:	0f 34                	sysenter
+     8f2:	c3                   	ret
+
+000008f3 <loadproc>:
+SYSCALL(loadproc)
+     8f3:	b8 18 00 00 00       	mov    $0x18,%eax
+     8f8:	89 e1                	mov    %esp,%ecx
+     8fa:	ba 01 09 00 00       	mov    $0x901,%edx
+     8ff:	0f 34                	sysenter
+     901:	c3                   	ret
+
+00000902 <iosubmit>:
+SYSCALL(iosubmit)
+     902:	b8 19 00 00 00       	mov    $0x19,%eax
+     907:	89 e1                	mov    %esp,%ecx
+     909:	ba 10 09 00 00       	mov    $0x910,%edx
+     90e:	0f 34                	sysenter
+     910:	c3                   	ret
+
+00000911 <sysstat>:
+SYSCALL(sysstat)
+     911:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     916:	89 e1                	mov    %esp,%ecx
+     918:	ba 1f 09 00 00       	mov    $0x91f,%edx
+     91d:	0f 34                	sysenter
+     91f:	c3                   	ret
+
+00000920 <splice>:
+SYSCALL(splice)
+     920:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     925:	89 e1                	mov    %esp,%ecx
+     927:	ba 2e 09 00 00       	mov    $0x92e,%edx
+     92c:	0f 34                	sysenter
+     92e:	c3                   	ret
+
+0000092f <fsync>:
+SYSCALL(fsync)
+     92f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     934:	89 e1                	mov    %esp,%ecx
+     936:	ba 3d 09 00 00       	mov    $0x93d,%edx
+     93b:	0f 34                	sysenter
+     93d:	c3                   	ret
+
+0000093e <fdatasync>:
+SYSCALL(fdatasync)
+     93e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     943:	89 e1                	mov    %esp,%ecx
+     945:	ba 4c 09 00 00       	mov    $0x94c,%edx
+     94a:	0f 34                	sysenter
+     94c:	c3                   	ret
+
+0000094d <lseek>:
+SYSCALL(lseek)
+     94d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     952:	89 e1                	mov    %esp,%ecx
+     954:	ba 5b 09 00 00       	mov    $0x95b,%edx
+     959:	0f 34                	sysenter
+     95b:	c3                   	ret
+
+0000095c <dmesg>:
+SYSCALL(dmesg)
+     95c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     961:	89 e1                	mov    %esp,%ecx
+     963:	ba 6a 09 00 00       	mov    $0x96a,%edx
+     968:	0f 34                	sysenter
+     96a:	c3                   	ret
+
+0000096b <lockstat>:
+SYSCALL(lockstat)
+     96b:	b8 20 00 00 00       	mov    $0x20,%eax
+     970:	89 e1                	mov    %esp,%ecx
+     972:	ba 79 09 00 00       	mov    $0x979,%edx
+     977:	0f 34                	sysenter
+     979:	c3                   	ret
+
+0000097a <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     97a:	55                   	push   %ebp
+     97b:	89 e5                	mov    %esp,%ebp
+     97d:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     980:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     987:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     98b:	74 17                	je     9a4 <printint+0x2a>
+     98d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     991:	79 11                	jns    9a4 <printint+0x2a>
+    neg = 1;
+     993:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     99a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     99d:	f7 d8                	neg    %eax
+     99f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     9a2:	eb 06                	jmp    9aa <printint+0x30>
+  } else {
+    x = xx;
+     9a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+     9a7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     9aa:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     9b1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     9b4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     9b7:	ba 00 00 00 00       	mov    $0x0,%edx
+     9bc:	f7 f1                	div    %ecx
+     9be:	89 d1                	mov    %edx,%ecx
+     9c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9c3:	8d 50 01             	lea    0x1(%eax),%edx
+     9c6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     9c9:	0f b6 91 44 1a 00 00 	movzbl 0x1a44(%ecx),%edx
+     9d0:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     9d4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     9d7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     9da:	ba 00 00 00 00       	mov    $0x0,%edx
+     9df:	f7 f1                	div    %ecx
+     9e1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     9e4:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     9e8:	75 c7                	jne    9b1 <printint+0x37>
+  if(neg)
+     9ea:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     9ee:	74 2d                	je     a1d <printint+0xa3>
+    buf[i++] = '-';
+     9f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     9f3:	8d 50 01             	lea    0x1(%eax),%edx
+     9f6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     9f9:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+     9fe:	eb 1d                	jmp    a1d <printint+0xa3>
+    fputc(fd, buf[i]);
+     a00:	8d 55 dc             	lea    -0x24(%ebp),%edx
+     a03:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a06:	01 d0                	add    %edx,%eax
+     a08:	0f b6 00             	movzbl (%eax),%eax
+     a0b:	0f be c0             	movsbl %al,%eax
+     a0e:	83 ec 08             	sub    $0x8,%esp
+     a11:	50                   	push   %eax
+     a12:	ff 75 08             	push   0x8(%ebp)
+     a15:	e8 f8 08 00 00       	call   1312 <fputc>
+     a1a:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+     a1d:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     a21:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     a25:	79 d9                	jns    a00 <printint+0x86>
+}
+     a27:	90                   	nop
+     a28:	90                   	nop
+     a29:	c9                   	leave
+     a2a:	c3                   	ret
+
+00000a2b <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     a2b:	55                   	push   %ebp
+     a2c:	89 e5                	mov    %esp,%ebp
+     a2e:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+     a31:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     a38:	8d 45 0c             	lea    0xc(%ebp),%eax
+     a3b:	83 c0 04             	add    $0x4,%eax
+     a3e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+     a41:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     a48:	e9 4a 01 00 00       	jmp    b97 <printf+0x16c>
+    c = fmt[i] & 0xff;
+     a4d:	8b 55 0c             	mov    0xc(%ebp),%edx
+     a50:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a53:	01 d0                	add    %edx,%eax
+     a55:	0f b6 00             	movzbl (%eax),%eax
+     a58:	0f be c0             	movsbl %al,%eax
+     a5b:	25 ff 00 00 00       	and    $0xff,%eax
+     a60:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+     a63:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     a67:	75 28                	jne    a91 <printf+0x66>
+      if(c == '%'){
+     a69:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     a6d:	75 0c                	jne    a7b <printf+0x50>
+        state = '%';
+     a6f:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+     a76:	e9 18 01 00 00       	jmp    b93 <printf+0x168>
+      } else {
+        fputc(fd, c);
+     a7b:	83 ec 08             	sub    $0x8,%esp
+     a7e:	ff 75 e4             	push   -0x1c(%ebp)
+     a81:	ff 75 08             	push   0x8(%ebp)
+     a84:	e8 89 08 00 00       	call   1312 <fputc>
+     a89:	83 c4 10             	add    $0x10,%esp
+     a8c:	e9 02 01 00 00       	jmp    b93 <printf+0x168>
+      }
+    } else if(state == '%'){
+     a91:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+     a95:	0f 85 f8 00 00 00    	jne    b93 <printf+0x168>
+      if(c == 'd'){
+     a9b:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+     a9f:	75 1e                	jne    abf <printf+0x94>
+        printint(fd, *ap, 10, 1);
+     aa1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     aa4:	8b 00                	mov    (%eax),%eax
+     aa6:	6a 01                	push   $0x1
+     aa8:	6a 0a                	push   $0xa
+     aaa:	50                   	push   %eax
+     aab:	ff 75 08             	push   0x8(%ebp)
+     aae:	e8 c7 fe ff ff       	call   97a <printint>
+     ab3:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     ab6:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     aba:	e9 cd 00 00 00       	jmp    b8c <printf+0x161>
+      } else if(c == 'x' || c == 'p'){
+     abf:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+     ac3:	74 06                	je     acb <printf+0xa0>
+     ac5:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+     ac9:	75 1e                	jne    ae9 <printf+0xbe>
+        printint(fd, *ap, 16, 0);
+     acb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     ace:	8b 00                	mov    (%eax),%eax
+     ad0:	6a 00                	push   $0x0
+     ad2:	6a 10                	push   $0x10
+     ad4:	50                   	push   %eax
+     ad5:	ff 75 08             	push   0x8(%ebp)
+     ad8:	e8 9d fe ff ff       	call   97a <printint>
+     add:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     ae0:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     ae4:	e9 a3 00 00 00       	jmp    b8c <printf+0x161>
+      } else if(c == 's'){
+     ae9:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+     aed:	75 43                	jne    b32 <printf+0x107>
+        s = (char*)*ap;
+     aef:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     af2:	8b 00                	mov    (%eax),%eax
+     af4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     af7:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+     afb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     aff:	75 25                	jne    b26 <printf+0xfb>
+          s = "(null)";
+     b01:	c7 45 f4 77 15 00 00 	movl   $0x1577,-0xc(%ebp)
+        while(*s != 0){
+     b08:	eb 1c                	jmp    b26 <printf+0xfb>
+          fputc(fd, *s);
+     b0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b0d:	0f b6 00             	movzbl (%eax),%eax
+     b10:	0f be c0             	movsbl %al,%eax
+     b13:	83 ec 08             	sub    $0x8,%esp
+     b16:	50                   	push   %eax
+     b17:	ff 75 08             	push   0x8(%ebp)
+     b1a:	e8 f3 07 00 00       	call   1312 <fputc>
+     b1f:	83 c4 10             	add    $0x10,%esp
+          s++;
+     b22:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+     b26:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b29:	0f b6 00             	movzbl (%eax),%eax
+     b2c:	84 c0                	test   %al,%al
+     b2e:	75 da                	jne    b0a <printf+0xdf>
+     b30:	eb 5a                	jmp    b8c <printf+0x161>
+        }
+      } else if(c == 'c'){
+     b32:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+     b36:	75 1a                	jne    b52 <printf+0x127>
+        fputc(fd, *ap);
+     b38:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     b3b:	8b 00                	mov    (%eax),%eax
+     b3d:	83 ec 08             	sub    $0x8,%esp
+     b40:	50                   	push   %eax
+     b41:	ff 75 08             	push   0x8(%ebp)
+     b44:	e8 c9 07 00 00       	call   1312 <fputc>
+     b49:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     b4c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     b50:	eb 3a                	jmp    b8c <printf+0x161>
+      } else if(c == '%'){
+     b52:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     b56:	75 13                	jne    b6b <printf+0x140>
+        fputc(fd, c);
+     b58:	83 ec 08             	sub    $0x8,%esp
+     b5b:	ff 75 e4             	push   -0x1c(%ebp)
+     b5e:	ff 75 08             	push   0x8(%ebp)
+     b61:	e8 ac 07 00 00       	call   1312 <fputc>
+     b66:	83 c4 10             	add    $0x10,%esp
+     b69:	eb 21                	jmp    b8c <printf+0x161>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        fputc(fd, '%');
+     b6b:	83 ec 08             	sub    $0x8,%esp
+     b6e:	6a 25                	push   $0x25
+     b70:	ff 75 08             	push   0x8(%ebp)
+     b73:	e8 9a 07 00 00       	call   1312 <fputc>
+     b78:	83 c4 10             	add    $0x10,%esp
+        fputc(fd, c);
+     b7b:	83 ec 08             	sub    $0x8,%esp
+     b7e:	ff 75 e4             	push   -0x1c(%ebp)
+     b81:	ff 75 08             	push   0x8(%ebp)
+     b84:	e8 89 07 00 00       	call   1312 <fputc>
+     b89:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     b8c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     b93:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     b97:	8b 55 0c             	mov    0xc(%ebp),%edx
+     b9a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b9d:	01 d0                	add    %edx,%eax
+     b9f:	0f b6 00             	movzbl (%eax),%eax
+     ba2:	84 c0                	test   %al,%al
+     ba4:	0f 85 a3 fe ff ff    	jne    a4d <printf+0x22>
+    }
+  }
+}
+     baa:	90                   	nop
+     bab:	90                   	nop
+     bac:	c9                   	leave
+     bad:	c3                   	ret
+
+00000bae <binof>:
+static struct chunk *bins[NBIN];       // free large chunks
+static struct chunk *top;              // end marker of newest heap segment
+
+static int
+binof(uint size)
+{
+     bae:	55                   	push   %ebp
+     baf:	89 e5                	mov    %esp,%ebp
+     bb1:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  i = 0;
+     bb4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     bbb:	c1 6d 08 05          	shrl   $0x5,0x8(%ebp)
+     bbf:	eb 07                	jmp    bc8 <binof+0x1a>
+    i++;
+     bc1:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     bc5:	d1 6d 08             	shrl   0x8(%ebp)
+     bc8:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     bcc:	74 06                	je     bd4 <binof+0x26>
+     bce:	83 7d fc 19          	cmpl   $0x19,-0x4(%ebp)
+     bd2:	7e ed                	jle    bc1 <binof+0x13>
+  return i;
+     bd4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     bd7:	c9                   	leave
+     bd8:	c3                   	ret
+
+00000bd9 <bininsert>:
+
+static void
+bininsert(struct chunk *c)
+{
+     bd9:	55                   	push   %ebp
+     bda:	89 e5                	mov    %esp,%ebp
+     bdc:	83 ec 10             	sub    $0x10,%esp
+  struct chunk **b;
+
+  b = &bins[binof(CSIZE(c))];
+     bdf:	8b 45 08             	mov    0x8(%ebp),%eax
+     be2:	8b 00                	mov    (%eax),%eax
+     be4:	83 e0 f8             	and    $0xfffffff8,%eax
+     be7:	50                   	push   %eax
+     be8:	e8 c1 ff ff ff       	call   bae <binof>
+     bed:	83 c4 04             	add    $0x4,%esp
+     bf0:	c1 e0 02             	shl    $0x2,%eax
+     bf3:	05 80 1c 00 00       	add    $0x1c80,%eax
+     bf8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c->prev = 0;
+     bfb:	8b 45 08             	mov    0x8(%ebp),%eax
+     bfe:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  c->next = *b;
+     c05:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c08:	8b 10                	mov    (%eax),%edx
+     c0a:	8b 45 08             	mov    0x8(%ebp),%eax
+     c0d:	89 50 08             	mov    %edx,0x8(%eax)
+  if(*b)
+     c10:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c13:	8b 00                	mov    (%eax),%eax
+     c15:	85 c0                	test   %eax,%eax
+     c17:	74 0b                	je     c24 <bininsert+0x4b>
+    (*b)->prev = c;
+     c19:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c1c:	8b 00                	mov    (%eax),%eax
+     c1e:	8b 55 08             	mov    0x8(%ebp),%edx
+     c21:	89 50 0c             	mov    %edx,0xc(%eax)
+  *b = c;
+     c24:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     c27:	8b 55 08             	mov    0x8(%ebp),%edx
+     c2a:	89 10                	mov    %edx,(%eax)
+}
+     c2c:	90                   	nop
+     c2d:	c9                   	leave
+     c2e:	c3                   	ret
+
+00000c2f <binremove>:
+
+static void
+binremove(struct chunk *c)
+{
+     c2f:	55                   	push   %ebp
+     c30:	89 e5                	mov    %esp,%ebp
+  if(c->prev)
+     c32:	8b 45 08             	mov    0x8(%ebp),%eax
+     c35:	8b 40 0c             	mov    0xc(%eax),%eax
+     c38:	85 c0                	test   %eax,%eax
+     c3a:	74 11                	je     c4d <binremove+0x1e>
+    c->prev->next = c->next;
+     c3c:	8b 45 08             	mov    0x8(%ebp),%eax
+     c3f:	8b 40 0c             	mov    0xc(%eax),%eax
+     c42:	8b 55 08             	mov    0x8(%ebp),%edx
+     c45:	8b 52 08             	mov    0x8(%edx),%edx
+     c48:	89 50 08             	mov    %edx,0x8(%eax)
+     c4b:	eb 1e                	jmp    c6b <binremove+0x3c>
+  else
+    bins[binof(CSIZE(c))] = c->next;
+     c4d:	8b 45 08             	mov    0x8(%ebp),%eax
+     c50:	8b 00                	mov    (%eax),%eax
+     c52:	83 e0 f8             	and    $0xfffffff8,%eax
+     c55:	50                   	push   %eax
+     c56:	e8 53 ff ff ff       	call   bae <binof>
+     c5b:	83 c4 04             	add    $0x4,%esp
+     c5e:	8b 55 08             	mov    0x8(%ebp),%edx
+     c61:	8b 52 08             	mov    0x8(%edx),%edx
+     c64:	89 14 85 80 1c 00 00 	mov    %edx,0x1c80(,%eax,4)
+  if(c->next)
+     c6b:	8b 45 08             	mov    0x8(%ebp),%eax
+     c6e:	8b 40 08             	mov    0x8(%eax),%eax
+     c71:	85 c0                	test   %eax,%eax
+     c73:	74 0f                	je     c84 <binremove+0x55>
+    c->next->prev = c->prev;
+     c75:	8b 45 08             	mov    0x8(%ebp),%eax
+     c78:	8b 40 08             	mov    0x8(%eax),%eax
+     c7b:	8b 55 08             	mov    0x8(%ebp),%edx
+     c7e:	8b 52 0c             	mov    0xc(%edx),%edx
+     c81:	89 50 0c             	mov    %edx,0xc(%eax)
+}
+     c84:	90                   	nop
+     c85:	c9                   	leave
+     c86:	c3                   	ret
+
+00000c87 <freechunk>:
+
+// Free chunk c, merging it with free neighbors.  If trim is
+// set and the result is big and at the break, give it back.
+static void
+freechunk(struct chunk *c, int trim)
+{
+     c87:	55                   	push   %ebp
+     c88:	89 e5                	mov    %esp,%ebp
+     c8a:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *p, *n;
+  uint size;
+
+  size = CSIZE(c);
+     c8d:	8b 45 08             	mov    0x8(%ebp),%eax
+     c90:	8b 00                	mov    (%eax),%eax
+     c92:	83 e0 f8             	and    $0xfffffff8,%eax
+     c95:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  n = NEXTC(c);
+     c98:	8b 45 08             	mov    0x8(%ebp),%eax
+     c9b:	8b 00                	mov    (%eax),%eax
+     c9d:	83 e0 f8             	and    $0xfffffff8,%eax
+     ca0:	89 c2                	mov    %eax,%edx
+     ca2:	8b 45 08             	mov    0x8(%ebp),%eax
+     ca5:	01 d0                	add    %edx,%eax
+     ca7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(!(c->size & PREVUSED)){
+     caa:	8b 45 08             	mov    0x8(%ebp),%eax
+     cad:	8b 00                	mov    (%eax),%eax
+     caf:	83 e0 02             	and    $0x2,%eax
+     cb2:	85 c0                	test   %eax,%eax
+     cb4:	75 30                	jne    ce6 <freechunk+0x5f>
+    p = (struct chunk*)((char*)c - *((uint*)c - 1));
+     cb6:	8b 45 08             	mov    0x8(%ebp),%eax
+     cb9:	83 e8 04             	sub    $0x4,%eax
+     cbc:	8b 00                	mov    (%eax),%eax
+     cbe:	f7 d8                	neg    %eax
+     cc0:	89 c2                	mov    %eax,%edx
+     cc2:	8b 45 08             	mov    0x8(%ebp),%eax
+     cc5:	01 d0                	add    %edx,%eax
+     cc7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    binremove(p);
+     cca:	ff 75 ec             	push   -0x14(%ebp)
+     ccd:	e8 5d ff ff ff       	call   c2f <binremove>
+     cd2:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(p);
+     cd5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     cd8:	8b 00                	mov    (%eax),%eax
+     cda:	83 e0 f8             	and    $0xfffffff8,%eax
+     cdd:	01 45 f4             	add    %eax,-0xc(%ebp)
+    c = p;
+     ce0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     ce3:	89 45 08             	mov    %eax,0x8(%ebp)
+  }
+  if(!(n->size & USED)){
+     ce6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ce9:	8b 00                	mov    (%eax),%eax
+     ceb:	83 e0 01             	and    $0x1,%eax
+     cee:	85 c0                	test   %eax,%eax
+     cf0:	75 16                	jne    d08 <freechunk+0x81>
+    binremove(n);
+     cf2:	ff 75 f0             	push   -0x10(%ebp)
+     cf5:	e8 35 ff ff ff       	call   c2f <binremove>
+     cfa:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(n);
+     cfd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d00:	8b 00                	mov    (%eax),%eax
+     d02:	83 e0 f8             	and    $0xfffffff8,%eax
+     d05:	01 45 f4             	add    %eax,-0xc(%ebp)
+  }
+  // Free chunks are never adjacent, so the one below is in use.
+  c->size = size | PREVUSED;
+     d08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d0b:	83 c8 02             	or     $0x2,%eax
+     d0e:	89 c2                	mov    %eax,%edx
+     d10:	8b 45 08             	mov    0x8(%ebp),%eax
+     d13:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+     d15:	8b 45 08             	mov    0x8(%ebp),%eax
+     d18:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  FOOTER(c) = size;
+     d1f:	8b 45 08             	mov    0x8(%ebp),%eax
+     d22:	8b 00                	mov    (%eax),%eax
+     d24:	83 e0 f8             	and    $0xfffffff8,%eax
+     d27:	8d 50 fc             	lea    -0x4(%eax),%edx
+     d2a:	8b 45 08             	mov    0x8(%ebp),%eax
+     d2d:	01 c2                	add    %eax,%edx
+     d2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d32:	89 02                	mov    %eax,(%edx)
+  n = NEXTC(c);
+     d34:	8b 45 08             	mov    0x8(%ebp),%eax
+     d37:	8b 00                	mov    (%eax),%eax
+     d39:	83 e0 f8             	and    $0xfffffff8,%eax
+     d3c:	89 c2                	mov    %eax,%edx
+     d3e:	8b 45 08             	mov    0x8(%ebp),%eax
+     d41:	01 d0                	add    %edx,%eax
+     d43:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  n->size &= ~PREVUSED;
+     d46:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d49:	8b 00                	mov    (%eax),%eax
+     d4b:	83 e0 fd             	and    $0xfffffffd,%eax
+     d4e:	89 c2                	mov    %eax,%edx
+     d50:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d53:	89 10                	mov    %edx,(%eax)
+
+  if(trim && n == top && size >= TRIMSIZE && sbrk(0) == (char*)top + HDRSIZE){
+     d55:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     d59:	74 51                	je     dac <freechunk+0x125>
+     d5b:	a1 ec 1c 00 00       	mov    0x1cec,%eax
+     d60:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     d63:	75 47                	jne    dac <freechunk+0x125>
+     d65:	81 7d f4 ff 7f 00 00 	cmpl   $0x7fff,-0xc(%ebp)
+     d6c:	76 3e                	jbe    dac <freechunk+0x125>
+     d6e:	83 ec 0c             	sub    $0xc,%esp
+     d71:	6a 00                	push   $0x0
+     d73:	e8 30 fb ff ff       	call   8a8 <sbrk>
+     d78:	83 c4 10             	add    $0x10,%esp
+     d7b:	8b 15 ec 1c 00 00    	mov    0x1cec,%edx
+     d81:	83 c2 08             	add    $0x8,%edx
+     d84:	39 d0                	cmp    %edx,%eax
+     d86:	75 24                	jne    dac <freechunk+0x125>
+    c->size = USED | PREVUSED;
+     d88:	8b 45 08             	mov    0x8(%ebp),%eax
+     d8b:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+    top = c;
+     d91:	8b 45 08             	mov    0x8(%ebp),%eax
+     d94:	a3 ec 1c 00 00       	mov    %eax,0x1cec
+    sbrk(-size);
+     d99:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d9c:	f7 d8                	neg    %eax
+     d9e:	83 ec 0c             	sub    $0xc,%esp
+     da1:	50                   	push   %eax
+     da2:	e8 01 fb ff ff       	call   8a8 <sbrk>
+     da7:	83 c4 10             	add    $0x10,%esp
+    return;
+     daa:	eb 0e                	jmp    dba <freechunk+0x133>
+  }
+  bininsert(c);
+     dac:	83 ec 0c             	sub    $0xc,%esp
+     daf:	ff 75 08             	push   0x8(%ebp)
+     db2:	e8 22 fe ff ff       	call   bd9 <bininsert>
+     db7:	83 c4 10             	add    $0x10,%esp
+}
+     dba:	c9                   	leave
+     dbb:	c3                   	ret
+
+00000dbc <morecore>:
+
+// Grow the heap by at least need bytes.
+static int
+morecore(uint need)
+{
+     dbc:	55                   	push   %ebp
+     dbd:	89 e5                	mov    %esp,%ebp
+     dbf:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+  char *p;
+  uint n, pad;
+
+  n = need + MINCHUNK;
+     dc2:	8b 45 08             	mov    0x8(%ebp),%eax
+     dc5:	83 c0 18             	add    $0x18,%eax
+     dc8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(n < MINCORE)
+     dcb:	81 7d ec ff 3f 00 00 	cmpl   $0x3fff,-0x14(%ebp)
+     dd2:	77 07                	ja     ddb <morecore+0x1f>
+    n = MINCORE;
+     dd4:	c7 45 ec 00 40 00 00 	movl   $0x4000,-0x14(%ebp)
+  // Keep the break 8-aligned, with the end marker just below it.
+  pad = (8 - ((uint)sbrk(0) & 7)) & 7;
+     ddb:	83 ec 0c             	sub    $0xc,%esp
+     dde:	6a 00                	push   $0x0
+     de0:	e8 c3 fa ff ff       	call   8a8 <sbrk>
+     de5:	83 c4 10             	add    $0x10,%esp
+     de8:	83 e0 07             	and    $0x7,%eax
+     deb:	ba 08 00 00 00       	mov    $0x8,%edx
+     df0:	29 c2                	sub    %eax,%edx
+     df2:	89 d0                	mov    %edx,%eax
+     df4:	83 e0 07             	and    $0x7,%eax
+     df7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if((p = sbrk(pad + n)) == (char*)-1){
+     dfa:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     dfd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     e00:	01 d0                	add    %edx,%eax
+     e02:	83 ec 0c             	sub    $0xc,%esp
+     e05:	50                   	push   %eax
+     e06:	e8 9d fa ff ff       	call   8a8 <sbrk>
+     e0b:	83 c4 10             	add    $0x10,%esp
+     e0e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     e11:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     e15:	75 30                	jne    e47 <morecore+0x8b>
+    n = need + MINCHUNK;
+     e17:	8b 45 08             	mov    0x8(%ebp),%eax
+     e1a:	83 c0 18             	add    $0x18,%eax
+     e1d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((p = sbrk(pad + n)) == (char*)-1)
+     e20:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     e23:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     e26:	01 d0                	add    %edx,%eax
+     e28:	83 ec 0c             	sub    $0xc,%esp
+     e2b:	50                   	push   %eax
+     e2c:	e8 77 fa ff ff       	call   8a8 <sbrk>
+     e31:	83 c4 10             	add    $0x10,%esp
+     e34:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     e37:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     e3b:	75 0a                	jne    e47 <morecore+0x8b>
+      return -1;
+     e3d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     e42:	e9 8e 00 00 00       	jmp    ed5 <morecore+0x119>
+  }
+  p += pad;
+     e47:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e4a:	01 45 f0             	add    %eax,-0x10(%ebp)
+  if(top && p == (char*)top + HDRSIZE){
+     e4d:	a1 ec 1c 00 00       	mov    0x1cec,%eax
+     e52:	85 c0                	test   %eax,%eax
+     e54:	74 29                	je     e7f <morecore+0xc3>
+     e56:	a1 ec 1c 00 00       	mov    0x1cec,%eax
+     e5b:	83 c0 08             	add    $0x8,%eax
+     e5e:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     e61:	75 1c                	jne    e7f <morecore+0xc3>
+    // Contiguous: the old end marker heads the new chunk.
+    c = top;
+     e63:	a1 ec 1c 00 00       	mov    0x1cec,%eax
+     e68:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = n | (c->size & PREVUSED);
+     e6b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e6e:	8b 00                	mov    (%eax),%eax
+     e70:	83 e0 02             	and    $0x2,%eax
+     e73:	0b 45 ec             	or     -0x14(%ebp),%eax
+     e76:	89 c2                	mov    %eax,%edx
+     e78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e7b:	89 10                	mov    %edx,(%eax)
+     e7d:	eb 16                	jmp    e95 <morecore+0xd9>
+  } else {
+    // Someone else moved the break: start a new segment.
+    c = (struct chunk*)p;
+     e7f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e82:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = (n - HDRSIZE) | PREVUSED;
+     e85:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     e88:	83 e8 08             	sub    $0x8,%eax
+     e8b:	83 c8 02             	or     $0x2,%eax
+     e8e:	89 c2                	mov    %eax,%edx
+     e90:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e93:	89 10                	mov    %edx,(%eax)
+  }
+  top = NEXTC(c);
+     e95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e98:	8b 00                	mov    (%eax),%eax
+     e9a:	83 e0 f8             	and    $0xfffffff8,%eax
+     e9d:	89 c2                	mov    %eax,%edx
+     e9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ea2:	01 d0                	add    %edx,%eax
+     ea4:	a3 ec 1c 00 00       	mov    %eax,0x1cec
+  top->size = USED;
+     ea9:	a1 ec 1c 00 00       	mov    0x1cec,%eax
+     eae:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  top->tag = LARGE;
+     eb4:	a1 ec 1c 00 00       	mov    0x1cec,%eax
+     eb9:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  freechunk(c, 0);
+     ec0:	83 ec 08             	sub    $0x8,%esp
+     ec3:	6a 00                	push   $0x0
+     ec5:	ff 75 f4             	push   -0xc(%ebp)
+     ec8:	e8 ba fd ff ff       	call   c87 <freechunk>
+     ecd:	83 c4 10             	add    $0x10,%esp
+  return 0;
+     ed0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     ed5:	c9                   	leave
+     ed6:	c3                   	ret
+
+00000ed7 <largealloc>:
+
+static void*
+largealloc(uint nbytes)
+{
+     ed7:	55                   	push   %ebp
+     ed8:	89 e5                	mov    %esp,%ebp
+     eda:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c, *r;
+  uint need;
+  int i;
+
+  if(nbytes > 0x7fffffff)
+     edd:	8b 45 08             	mov    0x8(%ebp),%eax
+     ee0:	85 c0                	test   %eax,%eax
+     ee2:	79 0a                	jns    eee <largealloc+0x17>
+    return 0;
+     ee4:	b8 00 00 00 00       	mov    $0x0,%eax
+     ee9:	e9 43 01 00 00       	jmp    1031 <largealloc+0x15a>
+  need = (nbytes + HDRSIZE + 7) & ~7;
+     eee:	8b 45 08             	mov    0x8(%ebp),%eax
+     ef1:	83 c0 0f             	add    $0xf,%eax
+     ef4:	83 e0 f8             	and    $0xfffffff8,%eax
+     ef7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(need < MINCHUNK)
+     efa:	83 7d f0 17          	cmpl   $0x17,-0x10(%ebp)
+     efe:	77 07                	ja     f07 <largealloc+0x30>
+    need = MINCHUNK;
+     f00:	c7 45 f0 18 00 00 00 	movl   $0x18,-0x10(%ebp)
+  for(;;){
+    for(i = binof(need); i < NBIN; i++)
+     f07:	ff 75 f0             	push   -0x10(%ebp)
+     f0a:	e8 9f fc ff ff       	call   bae <binof>
+     f0f:	83 c4 04             	add    $0x4,%esp
+     f12:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     f15:	eb 2f                	jmp    f46 <largealloc+0x6f>
+      for(c = bins[i]; c; c = c->next)
+     f17:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f1a:	8b 04 85 80 1c 00 00 	mov    0x1c80(,%eax,4),%eax
+     f21:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     f24:	eb 16                	jmp    f3c <largealloc+0x65>
+        if(CSIZE(c) >= need)
+     f26:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f29:	8b 00                	mov    (%eax),%eax
+     f2b:	83 e0 f8             	and    $0xfffffff8,%eax
+     f2e:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     f31:	73 35                	jae    f68 <largealloc+0x91>
+      for(c = bins[i]; c; c = c->next)
+     f33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f36:	8b 40 08             	mov    0x8(%eax),%eax
+     f39:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     f3c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     f40:	75 e4                	jne    f26 <largealloc+0x4f>
+    for(i = binof(need); i < NBIN; i++)
+     f42:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     f46:	83 7d ec 1a          	cmpl   $0x1a,-0x14(%ebp)
+     f4a:	7e cb                	jle    f17 <largealloc+0x40>
+          goto found;
+    if(morecore(need) < 0)
+     f4c:	83 ec 0c             	sub    $0xc,%esp
+     f4f:	ff 75 f0             	push   -0x10(%ebp)
+     f52:	e8 65 fe ff ff       	call   dbc <morecore>
+     f57:	83 c4 10             	add    $0x10,%esp
+     f5a:	85 c0                	test   %eax,%eax
+     f5c:	79 a9                	jns    f07 <largealloc+0x30>
+      return 0;
+     f5e:	b8 00 00 00 00       	mov    $0x0,%eax
+     f63:	e9 c9 00 00 00       	jmp    1031 <largealloc+0x15a>
+          goto found;
+     f68:	90                   	nop
+  }
+
+found:
+  binremove(c);
+     f69:	83 ec 0c             	sub    $0xc,%esp
+     f6c:	ff 75 f4             	push   -0xc(%ebp)
+     f6f:	e8 bb fc ff ff       	call   c2f <binremove>
+     f74:	83 c4 10             	add    $0x10,%esp
+  if(CSIZE(c) - need >= MINCHUNK){
+     f77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f7a:	8b 00                	mov    (%eax),%eax
+     f7c:	83 e0 f8             	and    $0xfffffff8,%eax
+     f7f:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     f82:	83 f8 17             	cmp    $0x17,%eax
+     f85:	76 66                	jbe    fed <largealloc+0x116>
+    r = (struct chunk*)((char*)c + need);
+     f87:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     f8a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f8d:	01 d0                	add    %edx,%eax
+     f8f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    r->size = (CSIZE(c) - need) | PREVUSED;
+     f92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f95:	8b 00                	mov    (%eax),%eax
+     f97:	83 e0 f8             	and    $0xfffffff8,%eax
+     f9a:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     f9d:	83 c8 02             	or     $0x2,%eax
+     fa0:	89 c2                	mov    %eax,%edx
+     fa2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     fa5:	89 10                	mov    %edx,(%eax)
+    r->tag = LARGE;
+     fa7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     faa:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+    FOOTER(r) = CSIZE(r);
+     fb1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     fb4:	8b 10                	mov    (%eax),%edx
+     fb6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     fb9:	8b 00                	mov    (%eax),%eax
+     fbb:	83 e0 f8             	and    $0xfffffff8,%eax
+     fbe:	8d 48 fc             	lea    -0x4(%eax),%ecx
+     fc1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     fc4:	01 c8                	add    %ecx,%eax
+     fc6:	83 e2 f8             	and    $0xfffffff8,%edx
+     fc9:	89 10                	mov    %edx,(%eax)
+    bininsert(r);
+     fcb:	83 ec 0c             	sub    $0xc,%esp
+     fce:	ff 75 e8             	push   -0x18(%ebp)
+     fd1:	e8 03 fc ff ff       	call   bd9 <bininsert>
+     fd6:	83 c4 10             	add    $0x10,%esp
+    c->size = need | (c->size & PREVUSED);
+     fd9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fdc:	8b 00                	mov    (%eax),%eax
+     fde:	83 e0 02             	and    $0x2,%eax
+     fe1:	0b 45 f0             	or     -0x10(%ebp),%eax
+     fe4:	89 c2                	mov    %eax,%edx
+     fe6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fe9:	89 10                	mov    %edx,(%eax)
+     feb:	eb 25                	jmp    1012 <largealloc+0x13b>
+  } else
+    NEXTC(c)->size |= PREVUSED;
+     fed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ff0:	8b 00                	mov    (%eax),%eax
+     ff2:	83 e0 f8             	and    $0xfffffff8,%eax
+     ff5:	89 c2                	mov    %eax,%edx
+     ff7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ffa:	01 d0                	add    %edx,%eax
+     ffc:	8b 10                	mov    (%eax),%edx
+     ffe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1001:	8b 00                	mov    (%eax),%eax
+    1003:	83 e0 f8             	and    $0xfffffff8,%eax
+    1006:	89 c1                	mov    %eax,%ecx
+    1008:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    100b:	01 c8                	add    %ecx,%eax
+    100d:	83 ca 02             	or     $0x2,%edx
+    1010:	89 10                	mov    %edx,(%eax)
+  c->size |= USED;
+    1012:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1015:	8b 00                	mov    (%eax),%eax
+    1017:	83 c8 01             	or     $0x1,%eax
+    101a:	89 c2                	mov    %eax,%edx
+    101c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    101f:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+    1021:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1024:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  return (char*)c + HDRSIZE;
+    102b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    102e:	83 c0 08             	add    $0x8,%eax
+}
+    1031:	c9                   	leave
+    1032:	c3                   	ret
+
+00001033 <refill>:
+
+// Carve a slab into free blocks of class k.
+static int
+refill(int k)
+{
+    1033:	55                   	push   %ebp
+    1034:	89 e5                	mov    %esp,%ebp
+    1036:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  char *p;
+  uint bs, i;
+
+  if((p = largealloc(SLABSIZE)) == 0)
+    1039:	83 ec 0c             	sub    $0xc,%esp
+    103c:	68 00 20 00 00       	push   $0x2000
+    1041:	e8 91 fe ff ff       	call   ed7 <largealloc>
+    1046:	83 c4 10             	add    $0x10,%esp
+    1049:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    104c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1050:	75 07                	jne    1059 <refill+0x26>
+    return -1;
+    1052:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1057:	eb 75                	jmp    10ce <refill+0x9b>
+  bs = HDRSIZE + (MINSMALL << k);
+    1059:	8b 45 08             	mov    0x8(%ebp),%eax
+    105c:	ba 10 00 00 00       	mov    $0x10,%edx
+    1061:	89 c1                	mov    %eax,%ecx
+    1063:	d3 e2                	shl    %cl,%edx
+    1065:	89 d0                	mov    %edx,%eax
+    1067:	83 c0 08             	add    $0x8,%eax
+    106a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+    106d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1074:	eb 44                	jmp    10ba <refill+0x87>
+    b = (struct chunk*)(p + i);
+    1076:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    1079:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    107c:	01 d0                	add    %edx,%eax
+    107e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    b->size = bs | USED;
+    1081:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1084:	83 c8 01             	or     $0x1,%eax
+    1087:	89 c2                	mov    %eax,%edx
+    1089:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    108c:	89 10                	mov    %edx,(%eax)
+    b->tag = k;
+    108e:	8b 55 08             	mov    0x8(%ebp),%edx
+    1091:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1094:	89 50 04             	mov    %edx,0x4(%eax)
+    b->next = classes[k];
+    1097:	8b 45 08             	mov    0x8(%ebp),%eax
+    109a:	8b 14 85 60 1c 00 00 	mov    0x1c60(,%eax,4),%edx
+    10a1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    10a4:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[k] = b;
+    10a7:	8b 45 08             	mov    0x8(%ebp),%eax
+    10aa:	8b 55 e8             	mov    -0x18(%ebp),%edx
+    10ad:	89 14 85 60 1c 00 00 	mov    %edx,0x1c60(,%eax,4)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+    10b4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    10b7:	01 45 f4             	add    %eax,-0xc(%ebp)
+    10ba:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    10bd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    10c0:	01 d0                	add    %edx,%eax
+    10c2:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    10c7:	76 ad                	jbe    1076 <refill+0x43>
+  }
+  return 0;
+    10c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    10ce:	c9                   	leave
+    10cf:	c3                   	ret
+
+000010d0 <free>:
+
+void
+free(void *ap)
+{
+    10d0:	55                   	push   %ebp
+    10d1:	89 e5                	mov    %esp,%ebp
+    10d3:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+
+  if(ap == 0)
+    10d6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    10da:	74 4b                	je     1127 <free+0x57>
+    return;
+  c = (struct chunk*)((char*)ap - HDRSIZE);
+    10dc:	8b 45 08             	mov    0x8(%ebp),%eax
+    10df:	83 e8 08             	sub    $0x8,%eax
+    10e2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(c->tag != LARGE){
+    10e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10e8:	8b 40 04             	mov    0x4(%eax),%eax
+    10eb:	83 f8 ff             	cmp    $0xffffffff,%eax
+    10ee:	74 25                	je     1115 <free+0x45>
+    c->next = classes[c->tag];
+    10f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10f3:	8b 40 04             	mov    0x4(%eax),%eax
+    10f6:	8b 14 85 60 1c 00 00 	mov    0x1c60(,%eax,4),%edx
+    10fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1100:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[c->tag] = c;
+    1103:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1106:	8b 40 04             	mov    0x4(%eax),%eax
+    1109:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    110c:	89 14 85 60 1c 00 00 	mov    %edx,0x1c60(,%eax,4)
+    return;
+    1113:	eb 13                	jmp    1128 <free+0x58>
+  }
+  freechunk(c, 1);
+    1115:	83 ec 08             	sub    $0x8,%esp
+    1118:	6a 01                	push   $0x1
+    111a:	ff 75 f4             	push   -0xc(%ebp)
+    111d:	e8 65 fb ff ff       	call   c87 <freechunk>
+    1122:	83 c4 10             	add    $0x10,%esp
+    1125:	eb 01                	jmp    1128 <free+0x58>
+    return;
+    1127:	90                   	nop
+}
+    1128:	c9                   	leave
+    1129:	c3                   	ret
+
+0000112a <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    112a:	55                   	push   %ebp
+    112b:	89 e5                	mov    %esp,%ebp
+    112d:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  int k;
+
+  if(nbytes > MAXSMALL)
+    1130:	81 7d 08 00 08 00 00 	cmpl   $0x800,0x8(%ebp)
+    1137:	76 10                	jbe    1149 <malloc+0x1f>
+    return largealloc(nbytes);
+    1139:	83 ec 0c             	sub    $0xc,%esp
+    113c:	ff 75 08             	push   0x8(%ebp)
+    113f:	e8 93 fd ff ff       	call   ed7 <largealloc>
+    1144:	83 c4 10             	add    $0x10,%esp
+    1147:	eb 6a                	jmp    11b3 <malloc+0x89>
+  for(k = 0; (MINSMALL << k) < nbytes; k++)
+    1149:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1150:	eb 04                	jmp    1156 <malloc+0x2c>
+    1152:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1156:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1159:	ba 10 00 00 00       	mov    $0x10,%edx
+    115e:	89 c1                	mov    %eax,%ecx
+    1160:	d3 e2                	shl    %cl,%edx
+    1162:	89 d0                	mov    %edx,%eax
+    1164:	3b 45 08             	cmp    0x8(%ebp),%eax
+    1167:	72 e9                	jb     1152 <malloc+0x28>
+    ;
+  if(classes[k] == 0 && refill(k) < 0)
+    1169:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    116c:	8b 04 85 60 1c 00 00 	mov    0x1c60(,%eax,4),%eax
+    1173:	85 c0                	test   %eax,%eax
+    1175:	75 19                	jne    1190 <malloc+0x66>
+    1177:	83 ec 0c             	sub    $0xc,%esp
+    117a:	ff 75 f4             	push   -0xc(%ebp)
+    117d:	e8 b1 fe ff ff       	call   1033 <refill>
+    1182:	83 c4 10             	add    $0x10,%esp
+    1185:	85 c0                	test   %eax,%eax
+    1187:	79 07                	jns    1190 <malloc+0x66>
+    return 0;
+    1189:	b8 00 00 00 00       	mov    $0x0,%eax
+    118e:	eb 23                	jmp    11b3 <malloc+0x89>
+  b = classes[k];
+    1190:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1193:	8b 04 85 60 1c 00 00 	mov    0x1c60(,%eax,4),%eax
+    119a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  classes[k] = b->next;
+    119d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    11a0:	8b 50 08             	mov    0x8(%eax),%edx
+    11a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11a6:	89 14 85 60 1c 00 00 	mov    %edx,0x1c60(,%eax,4)
+  return (char*)b + HDRSIZE;
+    11ad:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    11b0:	83 c0 08             	add    $0x8,%eax
+}
+    11b3:	c9                   	leave
+    11b4:	c3                   	ret
+
+000011b5 <stream>:
+
+// Return the stream for fd, deciding on first use how
+// its output is buffered.  Returns 0 if fd is not open.
+static struct stream*
+stream(int fd)
+{
+    11b5:	55                   	push   %ebp
+    11b6:	89 e5                	mov    %esp,%ebp
+    11b8:	83 ec 28             	sub    $0x28,%esp
+  struct stream *s;
+  struct stat st;
+
+  if(fd < 0 || fd >= NOFILE)
+    11bb:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    11bf:	78 06                	js     11c7 <stream+0x12>
+    11c1:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    11c5:	7e 07                	jle    11ce <stream+0x19>
+    return 0;
+    11c7:	b8 00 00 00 00       	mov    $0x0,%eax
+    11cc:	eb 55                	jmp    1223 <stream+0x6e>
+  s = &streams[fd];
+    11ce:	8b 45 08             	mov    0x8(%ebp),%eax
+    11d1:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    11d7:	05 00 1d 00 00       	add    $0x1d00,%eax
+    11dc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(s->mode == UNKNOWN){
+    11df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11e2:	8b 00                	mov    (%eax),%eax
+    11e4:	85 c0                	test   %eax,%eax
+    11e6:	75 38                	jne    1220 <stream+0x6b>
+    if(fstat(fd, &st) < 0)
+    11e8:	83 ec 08             	sub    $0x8,%esp
+    11eb:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    11ee:	50                   	push   %eax
+    11ef:	ff 75 08             	push   0x8(%ebp)
+    11f2:	e8 57 f6 ff ff       	call   84e <fstat>
+    11f7:	83 c4 10             	add    $0x10,%esp
+    11fa:	85 c0                	test   %eax,%eax
+    11fc:	79 07                	jns    1205 <stream+0x50>
+      return 0;
+    11fe:	b8 00 00 00 00       	mov    $0x0,%eax
+    1203:	eb 1e                	jmp    1223 <stream+0x6e>
+    s->mode = st.type == T_DEV ? LINEBUF : FULLBUF;
+    1205:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+    1209:	66 83 f8 03          	cmp    $0x3,%ax
+    120d:	75 07                	jne    1216 <stream+0x61>
+    120f:	ba 01 00 00 00       	mov    $0x1,%edx
+    1214:	eb 05                	jmp    121b <stream+0x66>
+    1216:	ba 02 00 00 00       	mov    $0x2,%edx
+    121b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    121e:	89 10                	mov    %edx,(%eax)
+  }
+  return s;
+    1220:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1223:	c9                   	leave
+    1224:	c3                   	ret
+
+00001225 <fflush>:
+
+int
+fflush(int fd)
+{
+    1225:	55                   	push   %ebp
+    1226:	89 e5                	mov    %esp,%ebp
+    1228:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  int i, n;
+
+  if(fd < 0 || fd >= NOFILE)
+    122b:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    122f:	78 06                	js     1237 <fflush+0x12>
+    1231:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    1235:	7e 07                	jle    123e <fflush+0x19>
+    return -1;
+    1237:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    123c:	eb 78                	jmp    12b6 <fflush+0x91>
+  s = &streams[fd];
+    123e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1241:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1247:	05 00 1d 00 00       	add    $0x1d00,%eax
+    124c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < s->nout; i += n){
+    124f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1256:	eb 44                	jmp    129c <fflush+0x77>
+    if((n = write(fd, s->out + i, s->nout - i)) <= 0){
+    1258:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    125b:	8b 40 04             	mov    0x4(%eax),%eax
+    125e:	2b 45 f4             	sub    -0xc(%ebp),%eax
+    1261:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    1264:	8d 4a 10             	lea    0x10(%edx),%ecx
+    1267:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    126a:	01 ca                	add    %ecx,%edx
+    126c:	83 ec 04             	sub    $0x4,%esp
+    126f:	50                   	push   %eax
+    1270:	52                   	push   %edx
+    1271:	ff 75 08             	push   0x8(%ebp)
+    1274:	e8 6c f5 ff ff       	call   7e5 <write>
+    1279:	83 c4 10             	add    $0x10,%esp
+    127c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    127f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1283:	7f 11                	jg     1296 <fflush+0x71>
+      s->nout = 0;
+    1285:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1288:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+      return -1;
+    128f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1294:	eb 20                	jmp    12b6 <fflush+0x91>
+  for(i = 0; i < s->nout; i += n){
+    1296:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1299:	01 45 f4             	add    %eax,-0xc(%ebp)
+    129c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    129f:	8b 40 04             	mov    0x4(%eax),%eax
+    12a2:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    12a5:	7c b1                	jl     1258 <fflush+0x33>
+    }
+  }
+  s->nout = 0;
+    12a7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    12aa:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  return 0;
+    12b1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    12b6:	c9                   	leave
+    12b7:	c3                   	ret
+
+000012b8 <flushall>:
+
+// Flush every stream, or only line-buffered ones.
+static void
+flushall(int lineonly)
+{
+    12b8:	55                   	push   %ebp
+    12b9:	89 e5                	mov    %esp,%ebp
+    12bb:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+    12be:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    12c5:	eb 41                	jmp    1308 <flushall+0x50>
+    if(streams[fd].nout > 0 && (!lineonly || streams[fd].mode == LINEBUF))
+    12c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12ca:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    12d0:	05 04 1d 00 00       	add    $0x1d04,%eax
+    12d5:	8b 00                	mov    (%eax),%eax
+    12d7:	85 c0                	test   %eax,%eax
+    12d9:	7e 29                	jle    1304 <flushall+0x4c>
+    12db:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    12df:	74 15                	je     12f6 <flushall+0x3e>
+    12e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12e4:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    12ea:	05 00 1d 00 00       	add    $0x1d00,%eax
+    12ef:	8b 00                	mov    (%eax),%eax
+    12f1:	83 f8 01             	cmp    $0x1,%eax
+    12f4:	75 0e                	jne    1304 <flushall+0x4c>
+      fflush(fd);
+    12f6:	83 ec 0c             	sub    $0xc,%esp
+    12f9:	ff 75 f4             	push   -0xc(%ebp)
+    12fc:	e8 24 ff ff ff       	call   1225 <fflush>
+    1301:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++)
+    1304:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1308:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+    130c:	7e b9                	jle    12c7 <flushall+0xf>
+}
+    130e:	90                   	nop
+    130f:	90                   	nop
+    1310:	c9                   	leave
+    1311:	c3                   	ret
+
+00001312 <fputc>:
+
+int
+fputc(int fd, int c)
+{
+    1312:	55                   	push   %ebp
+    1313:	89 e5                	mov    %esp,%ebp
+    1315:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  char ch;
+
+  if((s = stream(fd)) == 0){
+    1318:	83 ec 0c             	sub    $0xc,%esp
+    131b:	ff 75 08             	push   0x8(%ebp)
+    131e:	e8 92 fe ff ff       	call   11b5 <stream>
+    1323:	83 c4 10             	add    $0x10,%esp
+    1326:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1329:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    132d:	75 2e                	jne    135d <fputc+0x4b>
+    ch = c;
+    132f:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1332:	88 45 f3             	mov    %al,-0xd(%ebp)
+    return write(fd, &ch, 1) == 1 ? (uchar)c : -1;
+    1335:	83 ec 04             	sub    $0x4,%esp
+    1338:	6a 01                	push   $0x1
+    133a:	8d 45 f3             	lea    -0xd(%ebp),%eax
+    133d:	50                   	push   %eax
+    133e:	ff 75 08             	push   0x8(%ebp)
+    1341:	e8 9f f4 ff ff       	call   7e5 <write>
+    1346:	83 c4 10             	add    $0x10,%esp
+    1349:	83 f8 01             	cmp    $0x1,%eax
+    134c:	75 08                	jne    1356 <fputc+0x44>
+    134e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1351:	0f b6 c0             	movzbl %al,%eax
+    1354:	eb 5e                	jmp    13b4 <fputc+0xa2>
+    1356:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    135b:	eb 57                	jmp    13b4 <fputc+0xa2>
+  }
+  s->out[s->nout++] = c;
+    135d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1360:	8b 40 04             	mov    0x4(%eax),%eax
+    1363:	8d 48 01             	lea    0x1(%eax),%ecx
+    1366:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1369:	89 4a 04             	mov    %ecx,0x4(%edx)
+    136c:	8b 55 0c             	mov    0xc(%ebp),%edx
+    136f:	89 d1                	mov    %edx,%ecx
+    1371:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1374:	88 4c 02 10          	mov    %cl,0x10(%edx,%eax,1)
+  if(s->nout == BUFSZ || (s->mode == LINEBUF && c == '\n'))
+    1378:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    137b:	8b 40 04             	mov    0x4(%eax),%eax
+    137e:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1383:	74 10                	je     1395 <fputc+0x83>
+    1385:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1388:	8b 00                	mov    (%eax),%eax
+    138a:	83 f8 01             	cmp    $0x1,%eax
+    138d:	75 1f                	jne    13ae <fputc+0x9c>
+    138f:	83 7d 0c 0a          	cmpl   $0xa,0xc(%ebp)
+    1393:	75 19                	jne    13ae <fputc+0x9c>
+    if(fflush(fd) < 0)
+    1395:	83 ec 0c             	sub    $0xc,%esp
+    1398:	ff 75 08             	push   0x8(%ebp)
+    139b:	e8 85 fe ff ff       	call   1225 <fflush>
+    13a0:	83 c4 10             	add    $0x10,%esp
+    13a3:	85 c0                	test   %eax,%eax
+    13a5:	79 07                	jns    13ae <fputc+0x9c>
+      return -1;
+    13a7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    13ac:	eb 06                	jmp    13b4 <fputc+0xa2>
+  return (uchar)c;
+    13ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+    13b1:	0f b6 c0             	movzbl %al,%eax
+}
+    13b4:	c9                   	leave
+    13b5:	c3                   	ret
+
+000013b6 <fgetc>:
+
+// Return the next byte read from fd, or -1 at end of file.
+int
+fgetc(int fd)
+{
+    13b6:	55                   	push   %ebp
+    13b7:	89 e5                	mov    %esp,%ebp
+    13b9:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  uchar c;
+  int n;
+
+  if((s = stream(fd)) == 0){
+    13bc:	83 ec 0c             	sub    $0xc,%esp
+    13bf:	ff 75 08             	push   0x8(%ebp)
+    13c2:	e8 ee fd ff ff       	call   11b5 <stream>
+    13c7:	83 c4 10             	add    $0x10,%esp
+    13ca:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    13cd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    13d1:	75 39                	jne    140c <fgetc+0x56>
+    flushall(1);
+    13d3:	83 ec 0c             	sub    $0xc,%esp
+    13d6:	6a 01                	push   $0x1
+    13d8:	e8 db fe ff ff       	call   12b8 <flushall>
+    13dd:	83 c4 10             	add    $0x10,%esp
+    return read(fd, &c, 1) == 1 ? c : -1;
+    13e0:	83 ec 04             	sub    $0x4,%esp
+    13e3:	6a 01                	push   $0x1
+    13e5:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    13e8:	50                   	push   %eax
+    13e9:	ff 75 08             	push   0x8(%ebp)
+    13ec:	e8 e5 f3 ff ff       	call   7d6 <read>
+    13f1:	83 c4 10             	add    $0x10,%esp
+    13f4:	83 f8 01             	cmp    $0x1,%eax
+    13f7:	75 0c                	jne    1405 <fgetc+0x4f>
+    13f9:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    13fd:	0f b6 c0             	movzbl %al,%eax
+    1400:	e9 80 00 00 00       	jmp    1485 <fgetc+0xcf>
+    1405:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    140a:	eb 79                	jmp    1485 <fgetc+0xcf>
+  }
+  if(s->rpos == s->rend){
+    140c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    140f:	8b 50 08             	mov    0x8(%eax),%edx
+    1412:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1415:	8b 40 0c             	mov    0xc(%eax),%eax
+    1418:	39 c2                	cmp    %eax,%edx
+    141a:	75 4c                	jne    1468 <fgetc+0xb2>
+    flushall(1);
+    141c:	83 ec 0c             	sub    $0xc,%esp
+    141f:	6a 01                	push   $0x1
+    1421:	e8 92 fe ff ff       	call   12b8 <flushall>
+    1426:	83 c4 10             	add    $0x10,%esp
+    if((n = read(fd, s->in, BUFSZ)) <= 0)
+    1429:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    142c:	05 10 02 00 00       	add    $0x210,%eax
+    1431:	83 ec 04             	sub    $0x4,%esp
+    1434:	68 00 02 00 00       	push   $0x200
+    1439:	50                   	push   %eax
+    143a:	ff 75 08             	push   0x8(%ebp)
+    143d:	e8 94 f3 ff ff       	call   7d6 <read>
+    1442:	83 c4 10             	add    $0x10,%esp
+    1445:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1448:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    144c:	7f 07                	jg     1455 <fgetc+0x9f>
+      return -1;
+    144e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1453:	eb 30                	jmp    1485 <fgetc+0xcf>
+    s->rpos = 0;
+    1455:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1458:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+    s->rend = n;
+    145f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1462:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    1465:	89 50 0c             	mov    %edx,0xc(%eax)
+  }
+  return (uchar)s->in[s->rpos++];
+    1468:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    146b:	8b 40 08             	mov    0x8(%eax),%eax
+    146e:	8d 48 01             	lea    0x1(%eax),%ecx
+    1471:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1474:	89 4a 08             	mov    %ecx,0x8(%edx)
+    1477:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    147a:	0f b6 84 02 10 02 00 	movzbl 0x210(%edx,%eax,1),%eax
+    1481:	00 
+    1482:	0f b6 c0             	movzbl %al,%eax
+}
+    1485:	c9                   	leave
+    1486:	c3                   	ret
+
+00001487 <fork>:
+
+int
+fork(void)
+{
+    1487:	55                   	push   %ebp
+    1488:	89 e5                	mov    %esp,%ebp
+    148a:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    148d:	83 ec 0c             	sub    $0xc,%esp
+    1490:	6a 00                	push   $0x0
+    1492:	e8 21 fe ff ff       	call   12b8 <flushall>
+    1497:	83 c4 10             	add    $0x10,%esp
+  return _fork();
+    149a:	e8 fb f2 ff ff       	call   79a <_fork>
+}
+    149f:	c9                   	leave
+    14a0:	c3                   	ret
+
+000014a1 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+    14a1:	55                   	push   %ebp
+    14a2:	89 e5                	mov    %esp,%ebp
+    14a4:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    14a7:	83 ec 0c             	sub    $0xc,%esp
+    14aa:	6a 00                	push   $0x0
+    14ac:	e8 07 fe ff ff       	call   12b8 <flushall>
+    14b1:	83 c4 10             	add    $0x10,%esp
+  return _exec(path, argv);
+    14b4:	83 ec 08             	sub    $0x8,%esp
+    14b7:	ff 75 0c             	push   0xc(%ebp)
+    14ba:	ff 75 08             	push   0x8(%ebp)
+    14bd:	e8 50 f3 ff ff       	call   812 <_exec>
+    14c2:	83 c4 10             	add    $0x10,%esp
+}
+    14c5:	c9                   	leave
+    14c6:	c3                   	ret
+
+000014c7 <exit>:
+
+int
+exit(void)
+{
+    14c7:	55                   	push   %ebp
+    14c8:	89 e5                	mov    %esp,%ebp
+    14ca:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    14cd:	83 ec 0c             	sub    $0xc,%esp
+    14d0:	6a 00                	push   $0x0
+    14d2:	e8 e1 fd ff ff       	call   12b8 <flushall>
+    14d7:	83 c4 10             	add    $0x10,%esp
+  _exit();
+    14da:	e8 ca f2 ff ff       	call   7a9 <_exit>
+
+000014df <close>:
+}
+
+int
+close(int fd)
+{
+    14df:	55                   	push   %ebp
+    14e0:	89 e5                	mov    %esp,%ebp
+    14e2:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+
+  if(fd >= 0 && fd < NOFILE){
+    14e5:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    14e9:	78 44                	js     152f <close+0x50>
+    14eb:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    14ef:	7f 3e                	jg     152f <close+0x50>
+    fflush(fd);
+    14f1:	83 ec 0c             	sub    $0xc,%esp
+    14f4:	ff 75 08             	push   0x8(%ebp)
+    14f7:	e8 29 fd ff ff       	call   1225 <fflush>
+    14fc:	83 c4 10             	add    $0x10,%esp
+    s = &streams[fd];
+    14ff:	8b 45 08             	mov    0x8(%ebp),%eax
+    1502:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1508:	05 00 1d 00 00       	add    $0x1d00,%eax
+    150d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    s->mode = UNKNOWN;
+    1510:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1513:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    s->rpos = s->rend = 0;
+    1519:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    151c:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    1523:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1526:	8b 50 0c             	mov    0xc(%eax),%edx
+    1529:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    152c:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  return _close(fd);
+    152f:	83 ec 0c             	sub    $0xc,%esp
+    1532:	ff 75 08             	push   0x8(%ebp)
+    1535:	e8 ba f2 ff ff       	call   7f4 <_close>
+    153a:	83 c4 10             	add    $0x10,%esp
+}
+    153d:	c9                   	leave
+    153e:	c3                   	ret
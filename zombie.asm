@@ -0,0 +1,2572 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+      11:	e8 e0 12 00 00       	call   12f6 <fork>
+      16:	85 c0                	test   %eax,%eax
+      18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+      1a:	83 ec 0c             	sub    $0xc,%esp
+      1d:	6a 05                	push   $0x5
+      1f:	e8 02 07 00 00       	call   726 <sleep>
+      24:	83 c4 10             	add    $0x10,%esp
+  exit();
+      27:	e8 0a 13 00 00       	call   1336 <exit>
+
+0000002c <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+      2c:	55                   	push   %ebp
+      2d:	89 e5                	mov    %esp,%ebp
+      2f:	57                   	push   %edi
+      30:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+      31:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      34:	8b 55 10             	mov    0x10(%ebp),%edx
+      37:	8b 45 0c             	mov    0xc(%ebp),%eax
+      3a:	89 cb                	mov    %ecx,%ebx
+      3c:	89 df                	mov    %ebx,%edi
+      3e:	89 d1                	mov    %edx,%ecx
+      40:	fc                   	cld
+      41:	f3 aa                	rep stos %al,%es:(%edi)
+      43:	89 ca                	mov    %ecx,%edx
+      45:	89 fb                	mov    %edi,%ebx
+      47:	89 5d 08             	mov    %ebx,0x8(%ebp)
+      4a:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+      4d:	90                   	nop
+      4e:	5b                   	pop    %ebx
+      4f:	5f                   	pop    %edi
+      50:	5d                   	pop    %ebp
+      51:	c3                   	ret
+
+00000052 <stosl>:
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+      52:	55                   	push   %ebp
+      53:	89 e5                	mov    %esp,%ebp
+      55:	57                   	push   %edi
+      56:	53                   	push   %ebx
+  asm volatile("cld; rep stosl" :
+      57:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      5a:	8b 55 10             	mov    0x10(%ebp),%edx
+      5d:	8b 45 0c             	mov    0xc(%ebp),%eax
+      60:	89 cb                	mov    %ecx,%ebx
+      62:	89 df                	mov    %ebx,%edi
+      64:	89 d1                	mov    %edx,%ecx
+      66:	fc                   	cld
+      67:	f3 ab                	rep stos %eax,%es:(%edi)
+      69:	89 ca                	mov    %ecx,%edx
+      6b:	89 fb                	mov    %edi,%ebx
+      6d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+      70:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+      73:	90                   	nop
+      74:	5b                   	pop    %ebx
+      75:	5f                   	pop    %edi
+      76:	5d                   	pop    %ebp
+      77:	c3                   	ret
+
+00000078 <movsb>:
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+      78:	55                   	push   %ebp
+      79:	89 e5                	mov    %esp,%ebp
+      7b:	57                   	push   %edi
+      7c:	56                   	push   %esi
+      7d:	53                   	push   %ebx
+  asm volatile("cld; rep movsb" :
+      7e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      81:	8b 55 0c             	mov    0xc(%ebp),%edx
+      84:	8b 45 10             	mov    0x10(%ebp),%eax
+      87:	89 cb                	mov    %ecx,%ebx
+      89:	89 df                	mov    %ebx,%edi
+      8b:	89 d6                	mov    %edx,%esi
+      8d:	89 c1                	mov    %eax,%ecx
+      8f:	fc                   	cld
+      90:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+      92:	89 c8                	mov    %ecx,%eax
+      94:	89 f2                	mov    %esi,%edx
+      96:	89 fb                	mov    %edi,%ebx
+      98:	89 5d 08             	mov    %ebx,0x8(%ebp)
+      9b:	89 55 0c             	mov    %edx,0xc(%ebp)
+      9e:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+      a1:	90                   	nop
+      a2:	5b                   	pop    %ebx
+      a3:	5e                   	pop    %esi
+      a4:	5f                   	pop    %edi
+      a5:	5d                   	pop    %ebp
+      a6:	c3                   	ret
+
+000000a7 <movsl>:
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+      a7:	55                   	push   %ebp
+      a8:	89 e5                	mov    %esp,%ebp
+      aa:	57                   	push   %edi
+      ab:	56                   	push   %esi
+      ac:	53                   	push   %ebx
+  asm volatile("cld; rep movsl" :
+      ad:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+      b3:	8b 45 10             	mov    0x10(%ebp),%eax
+      b6:	89 cb                	mov    %ecx,%ebx
+      b8:	89 df                	mov    %ebx,%edi
+      ba:	89 d6                	mov    %edx,%esi
+      bc:	89 c1                	mov    %eax,%ecx
+      be:	fc                   	cld
+      bf:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+      c1:	89 c8                	mov    %ecx,%eax
+      c3:	89 f2                	mov    %esi,%edx
+      c5:	89 fb                	mov    %edi,%ebx
+      c7:	89 5d 08             	mov    %ebx,0x8(%ebp)
+      ca:	89 55 0c             	mov    %edx,0xc(%ebp)
+      cd:	89 45 10             	mov    %eax,0x10(%ebp)
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+      d0:	90                   	nop
+      d1:	5b                   	pop    %ebx
+      d2:	5e                   	pop    %esi
+      d3:	5f                   	pop    %edi
+      d4:	5d                   	pop    %ebp
+      d5:	c3                   	ret
+
+000000d6 <strcpy>:
+#define ONES        0x01010101
+#define HASZERO(x)  (((x) - ONES) & ~(x) & (ONES << 7))
+
+char*
+strcpy(char *s, char *t)
+{
+      d6:	55                   	push   %ebp
+      d7:	89 e5                	mov    %esp,%ebp
+      d9:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+      dc:	8b 45 08             	mov    0x8(%ebp),%eax
+      df:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+      e2:	90                   	nop
+      e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+      e6:	8d 42 01             	lea    0x1(%edx),%eax
+      e9:	89 45 0c             	mov    %eax,0xc(%ebp)
+      ec:	8b 45 08             	mov    0x8(%ebp),%eax
+      ef:	8d 48 01             	lea    0x1(%eax),%ecx
+      f2:	89 4d 08             	mov    %ecx,0x8(%ebp)
+      f5:	0f b6 12             	movzbl (%edx),%edx
+      f8:	88 10                	mov    %dl,(%eax)
+      fa:	0f b6 00             	movzbl (%eax),%eax
+      fd:	84 c0                	test   %al,%al
+      ff:	75 e2                	jne    e3 <strcpy+0xd>
+    ;
+  return os;
+     101:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     104:	c9                   	leave
+     105:	c3                   	ret
+
+00000106 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     106:	55                   	push   %ebp
+     107:	89 e5                	mov    %esp,%ebp
+  // Aligned words never straddle a page, so reading
+  // whole ones past the end of a string is safe.
+  if((((uint)p | (uint)q) & 3) == 0)
+     109:	8b 55 08             	mov    0x8(%ebp),%edx
+     10c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     10f:	09 d0                	or     %edx,%eax
+     111:	83 e0 03             	and    $0x3,%eax
+     114:	85 c0                	test   %eax,%eax
+     116:	75 3f                	jne    157 <strcmp+0x51>
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     118:	eb 08                	jmp    122 <strcmp+0x1c>
+      p += 4, q += 4;
+     11a:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     11e:	83 45 0c 04          	addl   $0x4,0xc(%ebp)
+    while(*(uint*)p == *(uint*)q && !HASZERO(*(uint*)p))
+     122:	8b 45 08             	mov    0x8(%ebp),%eax
+     125:	8b 10                	mov    (%eax),%edx
+     127:	8b 45 0c             	mov    0xc(%ebp),%eax
+     12a:	8b 00                	mov    (%eax),%eax
+     12c:	39 c2                	cmp    %eax,%edx
+     12e:	75 27                	jne    157 <strcmp+0x51>
+     130:	8b 45 08             	mov    0x8(%ebp),%eax
+     133:	8b 00                	mov    (%eax),%eax
+     135:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     13b:	8b 45 08             	mov    0x8(%ebp),%eax
+     13e:	8b 00                	mov    (%eax),%eax
+     140:	f7 d0                	not    %eax
+     142:	21 d0                	and    %edx,%eax
+     144:	25 80 80 80 80       	and    $0x80808080,%eax
+     149:	85 c0                	test   %eax,%eax
+     14b:	74 cd                	je     11a <strcmp+0x14>
+  while(*p && *p == *q)
+     14d:	eb 08                	jmp    157 <strcmp+0x51>
+    p++, q++;
+     14f:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     153:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     157:	8b 45 08             	mov    0x8(%ebp),%eax
+     15a:	0f b6 00             	movzbl (%eax),%eax
+     15d:	84 c0                	test   %al,%al
+     15f:	74 10                	je     171 <strcmp+0x6b>
+     161:	8b 45 08             	mov    0x8(%ebp),%eax
+     164:	0f b6 10             	movzbl (%eax),%edx
+     167:	8b 45 0c             	mov    0xc(%ebp),%eax
+     16a:	0f b6 00             	movzbl (%eax),%eax
+     16d:	38 c2                	cmp    %al,%dl
+     16f:	74 de                	je     14f <strcmp+0x49>
+  return (uchar)*p - (uchar)*q;
+     171:	8b 45 08             	mov    0x8(%ebp),%eax
+     174:	0f b6 00             	movzbl (%eax),%eax
+     177:	0f b6 d0             	movzbl %al,%edx
+     17a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     17d:	0f b6 00             	movzbl (%eax),%eax
+     180:	0f b6 c0             	movzbl %al,%eax
+     183:	29 c2                	sub    %eax,%edx
+     185:	89 d0                	mov    %edx,%eax
+}
+     187:	5d                   	pop    %ebp
+     188:	c3                   	ret
+
+00000189 <strlen>:
+
+uint
+strlen(char *s)
+{
+     189:	55                   	push   %ebp
+     18a:	89 e5                	mov    %esp,%ebp
+     18c:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; ((uint)(s+n) & 3) && s[n]; n++)
+     18f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     196:	eb 04                	jmp    19c <strlen+0x13>
+     198:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     19c:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     19f:	8b 45 08             	mov    0x8(%ebp),%eax
+     1a2:	01 d0                	add    %edx,%eax
+     1a4:	83 e0 03             	and    $0x3,%eax
+     1a7:	85 c0                	test   %eax,%eax
+     1a9:	74 0f                	je     1ba <strlen+0x31>
+     1ab:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     1ae:	8b 45 08             	mov    0x8(%ebp),%eax
+     1b1:	01 d0                	add    %edx,%eax
+     1b3:	0f b6 00             	movzbl (%eax),%eax
+     1b6:	84 c0                	test   %al,%al
+     1b8:	75 de                	jne    198 <strlen+0xf>
+    ;
+  if(s[n])
+     1ba:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     1bd:	8b 45 08             	mov    0x8(%ebp),%eax
+     1c0:	01 d0                	add    %edx,%eax
+     1c2:	0f b6 00             	movzbl (%eax),%eax
+     1c5:	84 c0                	test   %al,%al
+     1c7:	74 33                	je     1fc <strlen+0x73>
+    while(!HASZERO(*(uint*)(s+n)))
+     1c9:	eb 04                	jmp    1cf <strlen+0x46>
+      n += 4;
+     1cb:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+    while(!HASZERO(*(uint*)(s+n)))
+     1cf:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     1d2:	8b 45 08             	mov    0x8(%ebp),%eax
+     1d5:	01 d0                	add    %edx,%eax
+     1d7:	8b 00                	mov    (%eax),%eax
+     1d9:	8d 88 ff fe fe fe    	lea    -0x1010101(%eax),%ecx
+     1df:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     1e2:	8b 45 08             	mov    0x8(%ebp),%eax
+     1e5:	01 d0                	add    %edx,%eax
+     1e7:	8b 00                	mov    (%eax),%eax
+     1e9:	f7 d0                	not    %eax
+     1eb:	21 c8                	and    %ecx,%eax
+     1ed:	25 80 80 80 80       	and    $0x80808080,%eax
+     1f2:	85 c0                	test   %eax,%eax
+     1f4:	74 d5                	je     1cb <strlen+0x42>
+  for(; s[n]; n++)
+     1f6:	eb 04                	jmp    1fc <strlen+0x73>
+     1f8:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     1fc:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     1ff:	8b 45 08             	mov    0x8(%ebp),%eax
+     202:	01 d0                	add    %edx,%eax
+     204:	0f b6 00             	movzbl (%eax),%eax
+     207:	84 c0                	test   %al,%al
+     209:	75 ed                	jne    1f8 <strlen+0x6f>
+    ;
+  return n;
+     20b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     20e:	c9                   	leave
+     20f:	c3                   	ret
+
+00000210 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     210:	55                   	push   %ebp
+     211:	89 e5                	mov    %esp,%ebp
+     213:	83 ec 10             	sub    $0x10,%esp
+  char *d;
+  uint k;
+
+  d = dst;
+     216:	8b 45 08             	mov    0x8(%ebp),%eax
+     219:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c &= 0xFF;
+     21c:	81 65 0c ff 00 00 00 	andl   $0xff,0xc(%ebp)
+  if(n >= 16){
+     223:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     227:	76 54                	jbe    27d <memset+0x6d>
+    k = -(uint)d & 3;  // bytes up to a word boundary
+     229:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     22c:	f7 d8                	neg    %eax
+     22e:	83 e0 03             	and    $0x3,%eax
+     231:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    stosb(d, c, k);
+     234:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     237:	50                   	push   %eax
+     238:	ff 75 0c             	push   0xc(%ebp)
+     23b:	ff 75 fc             	push   -0x4(%ebp)
+     23e:	e8 e9 fd ff ff       	call   2c <stosb>
+     243:	83 c4 0c             	add    $0xc,%esp
+    d += k;
+     246:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     249:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n -= k;
+     24c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     24f:	29 45 10             	sub    %eax,0x10(%ebp)
+    stosl(d, c*ONES, n/4);
+     252:	8b 45 10             	mov    0x10(%ebp),%eax
+     255:	c1 e8 02             	shr    $0x2,%eax
+     258:	89 c2                	mov    %eax,%edx
+     25a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     25d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     263:	52                   	push   %edx
+     264:	50                   	push   %eax
+     265:	ff 75 fc             	push   -0x4(%ebp)
+     268:	e8 e5 fd ff ff       	call   52 <stosl>
+     26d:	83 c4 0c             	add    $0xc,%esp
+    d += n & ~3;
+     270:	8b 45 10             	mov    0x10(%ebp),%eax
+     273:	83 e0 fc             	and    $0xfffffffc,%eax
+     276:	01 45 fc             	add    %eax,-0x4(%ebp)
+    n &= 3;
+     279:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+  }
+  stosb(d, c, n);
+     27d:	8b 45 10             	mov    0x10(%ebp),%eax
+     280:	50                   	push   %eax
+     281:	ff 75 0c             	push   0xc(%ebp)
+     284:	ff 75 fc             	push   -0x4(%ebp)
+     287:	e8 a0 fd ff ff       	call   2c <stosb>
+     28c:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     28f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     292:	c9                   	leave
+     293:	c3                   	ret
+
+00000294 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     294:	55                   	push   %ebp
+     295:	89 e5                	mov    %esp,%ebp
+     297:	83 ec 10             	sub    $0x10,%esp
+  const uchar *s1, *s2;
+
+  s1 = v1;
+     29a:	8b 45 08             	mov    0x8(%ebp),%eax
+     29d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s2 = v2;
+     2a0:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2a3:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     2a6:	eb 0c                	jmp    2b4 <memcmp+0x20>
+    s1 += 4, s2 += 4, n -= 4;
+     2a8:	83 45 fc 04          	addl   $0x4,-0x4(%ebp)
+     2ac:	83 45 f8 04          	addl   $0x4,-0x8(%ebp)
+     2b0:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+  while(n >= 4 && *(uint*)s1 == *(uint*)s2)
+     2b4:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     2b8:	76 3e                	jbe    2f8 <memcmp+0x64>
+     2ba:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     2bd:	8b 10                	mov    (%eax),%edx
+     2bf:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     2c2:	8b 00                	mov    (%eax),%eax
+     2c4:	39 c2                	cmp    %eax,%edx
+     2c6:	74 e0                	je     2a8 <memcmp+0x14>
+  while(n-- > 0){
+     2c8:	eb 2e                	jmp    2f8 <memcmp+0x64>
+    if(*s1 != *s2)
+     2ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     2cd:	0f b6 10             	movzbl (%eax),%edx
+     2d0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     2d3:	0f b6 00             	movzbl (%eax),%eax
+     2d6:	38 c2                	cmp    %al,%dl
+     2d8:	74 16                	je     2f0 <memcmp+0x5c>
+      return *s1 - *s2;
+     2da:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     2dd:	0f b6 00             	movzbl (%eax),%eax
+     2e0:	0f b6 d0             	movzbl %al,%edx
+     2e3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     2e6:	0f b6 00             	movzbl (%eax),%eax
+     2e9:	0f b6 c0             	movzbl %al,%eax
+     2ec:	29 c2                	sub    %eax,%edx
+     2ee:	eb 1a                	jmp    30a <memcmp+0x76>
+    s1++, s2++;
+     2f0:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     2f4:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+  while(n-- > 0){
+     2f8:	8b 45 10             	mov    0x10(%ebp),%eax
+     2fb:	8d 50 ff             	lea    -0x1(%eax),%edx
+     2fe:	89 55 10             	mov    %edx,0x10(%ebp)
+     301:	85 c0                	test   %eax,%eax
+     303:	75 c5                	jne    2ca <memcmp+0x36>
+  }
+  return 0;
+     305:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+     30a:	89 d0                	mov    %edx,%eax
+     30c:	c9                   	leave
+     30d:	c3                   	ret
+
+0000030e <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     30e:	55                   	push   %ebp
+     30f:	89 e5                	mov    %esp,%ebp
+     311:	83 ec 14             	sub    $0x14,%esp
+     314:	8b 45 0c             	mov    0xc(%ebp),%eax
+     317:	88 45 ec             	mov    %al,-0x14(%ebp)
+  uint w, cc;
+
+  // Skip whole words holding neither c nor the terminator.
+  for(; ((uint)s & 3) && *s; s++)
+     31a:	eb 17                	jmp    333 <strchr+0x25>
+    if(*s == c)
+     31c:	8b 45 08             	mov    0x8(%ebp),%eax
+     31f:	0f b6 00             	movzbl (%eax),%eax
+     322:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     325:	75 08                	jne    32f <strchr+0x21>
+      return (char*)s;
+     327:	8b 45 08             	mov    0x8(%ebp),%eax
+     32a:	e9 ad 00 00 00       	jmp    3dc <strchr+0xce>
+  for(; ((uint)s & 3) && *s; s++)
+     32f:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     333:	8b 45 08             	mov    0x8(%ebp),%eax
+     336:	83 e0 03             	and    $0x3,%eax
+     339:	85 c0                	test   %eax,%eax
+     33b:	74 0a                	je     347 <strchr+0x39>
+     33d:	8b 45 08             	mov    0x8(%ebp),%eax
+     340:	0f b6 00             	movzbl (%eax),%eax
+     343:	84 c0                	test   %al,%al
+     345:	75 d5                	jne    31c <strchr+0xe>
+  cc = (uchar)c * ONES;
+     347:	0f b6 45 ec          	movzbl -0x14(%ebp),%eax
+     34b:	0f b6 c0             	movzbl %al,%eax
+     34e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     354:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(*s)
+     357:	8b 45 08             	mov    0x8(%ebp),%eax
+     35a:	0f b6 00             	movzbl (%eax),%eax
+     35d:	84 c0                	test   %al,%al
+     35f:	74 6c                	je     3cd <strchr+0xbf>
+    for(; w = *(uint*)s, !HASZERO(w) && !HASZERO(w ^ cc); s += 4)
+     361:	eb 04                	jmp    367 <strchr+0x59>
+     363:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     367:	8b 45 08             	mov    0x8(%ebp),%eax
+     36a:	8b 00                	mov    (%eax),%eax
+     36c:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     36f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     372:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     378:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     37b:	f7 d0                	not    %eax
+     37d:	21 d0                	and    %edx,%eax
+     37f:	25 80 80 80 80       	and    $0x80808080,%eax
+     384:	85 c0                	test   %eax,%eax
+     386:	75 26                	jne    3ae <strchr+0xa0>
+     388:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     38b:	33 45 fc             	xor    -0x4(%ebp),%eax
+     38e:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     394:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     397:	33 45 fc             	xor    -0x4(%ebp),%eax
+     39a:	f7 d0                	not    %eax
+     39c:	21 d0                	and    %edx,%eax
+     39e:	25 80 80 80 80       	and    $0x80808080,%eax
+     3a3:	85 c0                	test   %eax,%eax
+     3a5:	75 07                	jne    3ae <strchr+0xa0>
+     3a7:	b8 01 00 00 00       	mov    $0x1,%eax
+     3ac:	eb 05                	jmp    3b3 <strchr+0xa5>
+     3ae:	b8 00 00 00 00       	mov    $0x0,%eax
+     3b3:	85 c0                	test   %eax,%eax
+     3b5:	75 ac                	jne    363 <strchr+0x55>
+      ;
+  for(; *s; s++)
+     3b7:	eb 14                	jmp    3cd <strchr+0xbf>
+    if(*s == c)
+     3b9:	8b 45 08             	mov    0x8(%ebp),%eax
+     3bc:	0f b6 00             	movzbl (%eax),%eax
+     3bf:	38 45 ec             	cmp    %al,-0x14(%ebp)
+     3c2:	75 05                	jne    3c9 <strchr+0xbb>
+      return (char*)s;
+     3c4:	8b 45 08             	mov    0x8(%ebp),%eax
+     3c7:	eb 13                	jmp    3dc <strchr+0xce>
+  for(; *s; s++)
+     3c9:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     3cd:	8b 45 08             	mov    0x8(%ebp),%eax
+     3d0:	0f b6 00             	movzbl (%eax),%eax
+     3d3:	84 c0                	test   %al,%al
+     3d5:	75 e2                	jne    3b9 <strchr+0xab>
+  return 0;
+     3d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     3dc:	c9                   	leave
+     3dd:	c3                   	ret
+
+000003de <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     3de:	55                   	push   %ebp
+     3df:	89 e5                	mov    %esp,%ebp
+     3e1:	83 ec 18             	sub    $0x18,%esp
+  int i, c;
+
+  for(i=0; i+1 < max; ){
+     3e4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     3eb:	eb 37                	jmp    424 <gets+0x46>
+    c = fgetc(0);
+     3ed:	83 ec 0c             	sub    $0xc,%esp
+     3f0:	6a 00                	push   $0x0
+     3f2:	e8 2e 0e 00 00       	call   1225 <fgetc>
+     3f7:	83 c4 10             	add    $0x10,%esp
+     3fa:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(c < 0)
+     3fd:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     401:	78 2e                	js     431 <gets+0x53>
+      break;
+    buf[i++] = c;
+     403:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     406:	8d 50 01             	lea    0x1(%eax),%edx
+     409:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     40c:	89 c2                	mov    %eax,%edx
+     40e:	8b 45 08             	mov    0x8(%ebp),%eax
+     411:	01 d0                	add    %edx,%eax
+     413:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     416:	88 10                	mov    %dl,(%eax)
+    if(c == '\n' || c == '\r')
+     418:	83 7d f0 0a          	cmpl   $0xa,-0x10(%ebp)
+     41c:	74 14                	je     432 <gets+0x54>
+     41e:	83 7d f0 0d          	cmpl   $0xd,-0x10(%ebp)
+     422:	74 0e                	je     432 <gets+0x54>
+  for(i=0; i+1 < max; ){
+     424:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     427:	83 c0 01             	add    $0x1,%eax
+     42a:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     42d:	7f be                	jg     3ed <gets+0xf>
+     42f:	eb 01                	jmp    432 <gets+0x54>
+      break;
+     431:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     432:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     435:	8b 45 08             	mov    0x8(%ebp),%eax
+     438:	01 d0                	add    %edx,%eax
+     43a:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     43d:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     440:	c9                   	leave
+     441:	c3                   	ret
+
+00000442 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     442:	55                   	push   %ebp
+     443:	89 e5                	mov    %esp,%ebp
+     445:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     448:	83 ec 08             	sub    $0x8,%esp
+     44b:	6a 00                	push   $0x0
+     44d:	ff 75 08             	push   0x8(%ebp)
+     450:	e8 3b 02 00 00       	call   690 <open>
+     455:	83 c4 10             	add    $0x10,%esp
+     458:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     45b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     45f:	79 07                	jns    468 <stat+0x26>
+    return -1;
+     461:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     466:	eb 25                	jmp    48d <stat+0x4b>
+  r = fstat(fd, st);
+     468:	83 ec 08             	sub    $0x8,%esp
+     46b:	ff 75 0c             	push   0xc(%ebp)
+     46e:	ff 75 f4             	push   -0xc(%ebp)
+     471:	e8 47 02 00 00       	call   6bd <fstat>
+     476:	83 c4 10             	add    $0x10,%esp
+     479:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     47c:	83 ec 0c             	sub    $0xc,%esp
+     47f:	ff 75 f4             	push   -0xc(%ebp)
+     482:	e8 c7 0e 00 00       	call   134e <close>
+     487:	83 c4 10             	add    $0x10,%esp
+  return r;
+     48a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     48d:	c9                   	leave
+     48e:	c3                   	ret
+
+0000048f <atoi>:
+
+int
+atoi(const char *s)
+{
+     48f:	55                   	push   %ebp
+     490:	89 e5                	mov    %esp,%ebp
+     492:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     495:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     49c:	eb 25                	jmp    4c3 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     49e:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     4a1:	89 d0                	mov    %edx,%eax
+     4a3:	c1 e0 02             	shl    $0x2,%eax
+     4a6:	01 d0                	add    %edx,%eax
+     4a8:	01 c0                	add    %eax,%eax
+     4aa:	89 c1                	mov    %eax,%ecx
+     4ac:	8b 45 08             	mov    0x8(%ebp),%eax
+     4af:	8d 50 01             	lea    0x1(%eax),%edx
+     4b2:	89 55 08             	mov    %edx,0x8(%ebp)
+     4b5:	0f b6 00             	movzbl (%eax),%eax
+     4b8:	0f be c0             	movsbl %al,%eax
+     4bb:	01 c8                	add    %ecx,%eax
+     4bd:	83 e8 30             	sub    $0x30,%eax
+     4c0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     4c3:	8b 45 08             	mov    0x8(%ebp),%eax
+     4c6:	0f b6 00             	movzbl (%eax),%eax
+     4c9:	3c 2f                	cmp    $0x2f,%al
+     4cb:	7e 0a                	jle    4d7 <atoi+0x48>
+     4cd:	8b 45 08             	mov    0x8(%ebp),%eax
+     4d0:	0f b6 00             	movzbl (%eax),%eax
+     4d3:	3c 39                	cmp    $0x39,%al
+     4d5:	7e c7                	jle    49e <atoi+0xf>
+  return n;
+     4d7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     4da:	c9                   	leave
+     4db:	c3                   	ret
+
+000004dc <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     4dc:	55                   	push   %ebp
+     4dd:	89 e5                	mov    %esp,%ebp
+     4df:	83 ec 10             	sub    $0x10,%esp
+  char *d, *s;
+  int k;
+
+  if(n <= 0)
+     4e2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     4e6:	7f 08                	jg     4f0 <memmove+0x14>
+    return vdst;
+     4e8:	8b 45 08             	mov    0x8(%ebp),%eax
+     4eb:	e9 17 01 00 00       	jmp    607 <memmove+0x12b>
+  d = vdst;
+     4f0:	8b 45 08             	mov    0x8(%ebp),%eax
+     4f3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  s = vsrc;
+     4f6:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4f9:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  if(s < d && s + n > d){
+     4fc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     4ff:	3b 45 fc             	cmp    -0x4(%ebp),%eax
+     502:	0f 83 84 00 00 00    	jae    58c <memmove+0xb0>
+     508:	8b 55 10             	mov    0x10(%ebp),%edx
+     50b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     50e:	01 d0                	add    %edx,%eax
+     510:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     513:	73 77                	jae    58c <memmove+0xb0>
+    s += n;
+     515:	8b 45 10             	mov    0x10(%ebp),%eax
+     518:	01 45 f8             	add    %eax,-0x8(%ebp)
+    d += n;
+     51b:	8b 45 10             	mov    0x10(%ebp),%eax
+     51e:	01 45 fc             	add    %eax,-0x4(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     521:	eb 17                	jmp    53a <memmove+0x5e>
+      *--d = *--s, n--;
+     523:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     527:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     52b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     52e:	0f b6 10             	movzbl (%eax),%edx
+     531:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     534:	88 10                	mov    %dl,(%eax)
+     536:	83 6d 10 01          	subl   $0x1,0x10(%ebp)
+    while(n > 0 && ((uint)d & 3))
+     53a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     53e:	7e 22                	jle    562 <memmove+0x86>
+     540:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     543:	83 e0 03             	and    $0x3,%eax
+     546:	85 c0                	test   %eax,%eax
+     548:	75 d9                	jne    523 <memmove+0x47>
+    for(; n >= 4; n -= 4){
+     54a:	eb 16                	jmp    562 <memmove+0x86>
+      d -= 4;
+     54c:	83 6d fc 04          	subl   $0x4,-0x4(%ebp)
+      s -= 4;
+     550:	83 6d f8 04          	subl   $0x4,-0x8(%ebp)
+      *(uint*)d = *(uint*)s;
+     554:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     557:	8b 10                	mov    (%eax),%edx
+     559:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     55c:	89 10                	mov    %edx,(%eax)
+    for(; n >= 4; n -= 4){
+     55e:	83 6d 10 04          	subl   $0x4,0x10(%ebp)
+     562:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+     566:	7f e4                	jg     54c <memmove+0x70>
+    }
+    while(n-- > 0)
+     568:	eb 13                	jmp    57d <memmove+0xa1>
+      *--d = *--s;
+     56a:	83 6d f8 01          	subl   $0x1,-0x8(%ebp)
+     56e:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     572:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     575:	0f b6 10             	movzbl (%eax),%edx
+     578:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     57b:	88 10                	mov    %dl,(%eax)
+    while(n-- > 0)
+     57d:	8b 45 10             	mov    0x10(%ebp),%eax
+     580:	8d 50 ff             	lea    -0x1(%eax),%edx
+     583:	89 55 10             	mov    %edx,0x10(%ebp)
+     586:	85 c0                	test   %eax,%eax
+     588:	7f e0                	jg     56a <memmove+0x8e>
+  if(s < d && s + n > d){
+     58a:	eb 78                	jmp    604 <memmove+0x128>
+  } else {
+    if(n >= 16){
+     58c:	83 7d 10 0f          	cmpl   $0xf,0x10(%ebp)
+     590:	7e 61                	jle    5f3 <memmove+0x117>
+      k = -(uint)d & 3;
+     592:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     595:	f7 d8                	neg    %eax
+     597:	83 e0 03             	and    $0x3,%eax
+     59a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      movsb(d, s, k);
+     59d:	ff 75 f4             	push   -0xc(%ebp)
+     5a0:	ff 75 f8             	push   -0x8(%ebp)
+     5a3:	ff 75 fc             	push   -0x4(%ebp)
+     5a6:	e8 cd fa ff ff       	call   78 <movsb>
+     5ab:	83 c4 0c             	add    $0xc,%esp
+      d += k;
+     5ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5b1:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += k;
+     5b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5b7:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n -= k;
+     5ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5bd:	29 45 10             	sub    %eax,0x10(%ebp)
+      movsl(d, s, n/4);
+     5c0:	8b 45 10             	mov    0x10(%ebp),%eax
+     5c3:	8d 50 03             	lea    0x3(%eax),%edx
+     5c6:	85 c0                	test   %eax,%eax
+     5c8:	0f 48 c2             	cmovs  %edx,%eax
+     5cb:	c1 f8 02             	sar    $0x2,%eax
+     5ce:	50                   	push   %eax
+     5cf:	ff 75 f8             	push   -0x8(%ebp)
+     5d2:	ff 75 fc             	push   -0x4(%ebp)
+     5d5:	e8 cd fa ff ff       	call   a7 <movsl>
+     5da:	83 c4 0c             	add    $0xc,%esp
+      d += n & ~3;
+     5dd:	8b 45 10             	mov    0x10(%ebp),%eax
+     5e0:	83 e0 fc             	and    $0xfffffffc,%eax
+     5e3:	01 45 fc             	add    %eax,-0x4(%ebp)
+      s += n & ~3;
+     5e6:	8b 45 10             	mov    0x10(%ebp),%eax
+     5e9:	83 e0 fc             	and    $0xfffffffc,%eax
+     5ec:	01 45 f8             	add    %eax,-0x8(%ebp)
+      n &= 3;
+     5ef:	83 65 10 03          	andl   $0x3,0x10(%ebp)
+    }
+    movsb(d, s, n);
+     5f3:	ff 75 10             	push   0x10(%ebp)
+     5f6:	ff 75 f8             	push   -0x8(%ebp)
+     5f9:	ff 75 fc             	push   -0x4(%ebp)
+     5fc:	e8 77 fa ff ff       	call   78 <movsb>
+     601:	83 c4 0c             	add    $0xc,%esp
+  }
+  return vdst;
+     604:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     607:	c9                   	leave
+     608:	c3                   	ret
+
+00000609 <_fork>:
+    movl %esp, %ecx; \
+    movl $1f, %edx; \
+    sysenter; \
+  1: ret
+
+RAWSYSCALL(fork)
+     609:	b8 01 00 00 00       	mov    $0x1,%eax
+     60e:	89 e1                	mov    %esp,%ecx
+     610:	ba 17 06 00 00       	mov    $0x617,%edx
+     615:	0f 34                	sysenter
+     617:	c3                   	ret
+
+00000618 <_exit>:
+RAWSYSCALL(exit)
+     618:	b8 02 00 00 00       	mov    $0x2,%eax
+     61d:	89 e1                	mov    %esp,%ecx
+     61f:	ba 26 06 00 00       	mov    $0x626,%edx
+     624:	0f 34                	sysenter
+     626:	c3                   	ret
+
+00000627 <wait>:
+SYSCALL(wait)
+     627:	b8 03 00 00 00       	mov    $0x3,%eax
+     62c:	89 e1                	mov    %esp,%ecx
+     62e:	ba 35 06 00 00       	mov    $0x635,%edx
+     633:	0f 34                	sysenter
+     635:	c3                   	ret
+
+00000636 <pipe>:
+SYSCALL(pipe)
+     636:	b8 04 00 00 00       	mov    $0x4,%eax
+     63b:	89 e1                	mov    %esp,%ecx
+     63d:	ba 44 06 00 00       	mov    $0x644,%edx
+     642:	0f 34                	sysenter
+     644:	c3                   	ret
+
+00000645 <read>:
+SYSCALL(read)
+     645:	b8 05 00 00 00       	mov    $0x5,%eax
+     64a:	89 e1                	mov    %esp,%ecx
+     64c:	ba 53 06 00 00       	mov    $0x653,%edx
+     651:	0f 34                	sysenter
+     653:	c3                   	ret
+
+00000654 <write>:
+SYSCALL(write)
+     654:	b8 10 00 00 00       	mov    $0x10,%eax
+     659:	89 e1                	mov    %esp,%ecx
+     65b:	ba 62 06 00 00       	mov    $0x662,%edx
+     660:	0f 34                	sysenter
+     662:	c3                   	ret
+
+00000663 <_close>:
+RAWSYSCALL(close)
+     663:	b8 15 00 00 00       	mov    $0x15,%eax
+     668:	89 e1                	mov    %esp,%ecx
+     66a:	ba 71 06 00 00       	mov    $0x671,%edx
+     66f:	0f 34                	sysenter
+     671:	c3                   	ret
+
+00000672 <kill>:
+SYSCALL(kill)
+     672:	b8 06 00 00 00       	mov    $0x6,%eax
+     677:	89 e1                	mov    %esp,%ecx
+     679:	ba 80 06 00 00       	mov    $0x680,%edx
+     67e:	0f 34                	sysenter
+     680:	c3                   	ret
+
+00000681 <_exec>:
+RAWSYSCALL(exec)
+     681:	b8 07 00 00 00       	mov    $0x7,%eax
+     686:	89 e1                	mov    %esp,%ecx
+     688:	ba 8f 06 00 00       	mov    $0x68f,%edx
+     68d:	0f 34                	sysenter
+     68f:	c3                   	ret
+
+00000690 <open>:
+SYSCALL(open)
+     690:	b8 0f 00 00 00       	mov    $0xf,%eax
+     695:	89 e1                	mov    %esp,%ecx
+     697:	ba 9e 06 00 00       	mov    $0x69e,%edx
+     69c:	0f 34                	sysenter
+     69e:	c3                   	ret
+
+0000069f <mknod>:
+SYSCALL(mknod)
+     69f:	b8 11 00 00 00       	mov    $0x11,%eax
+     6a4:	89 e1                	mov    %esp,%ecx
+     6a6:	ba ad 06 00 00       	mov    $0x6ad,%edx
+     6ab:	0f 34                	sysenter
+     6ad:	c3                   	ret
+
+000006ae <unlink>:
+SYSCALL(unlink)
+     6ae:	b8 12 00 00 00       	mov    $0x12,%eax
+     6b3:	89 e1                	mov    %esp,%ecx
+     6b5:	ba bc 06 00 00       	mov    $0x6bc,%edx
+     6ba:	0f 34                	sysenter
+     6bc:	c3                   	ret
+
+000006bd <fstat>:
+SYSCALL(fstat)
+     6bd:	b8 08 00 00 00       	mov    $0x8,%eax
+     6c2:	89 e1                	mov    %esp,%ecx
+     6c4:	ba cb 06 00 00       	mov    $0x6cb,%edx
+     6c9:	0f 34                	sysenter
+     6cb:	c3                   	ret
+
+000006cc <link>:
+SYSCALL(link)
+     6cc:	b8 13 00 00 00       	mov    $0x13,%eax
+     6d1:	89 e1                	mov    %esp,%ecx
+     6d3:	ba da 06 00 00       	mov    $0x6da,%edx
+     6d8:	0f 34                	sysenter
+     6da:	c3                   	ret
+
+000006db <mkdir>:
+SYSCALL(mkdir)
+     6db:	b8 14 00 00 00       	mov    $0x14,%eax
+     6e0:	89 e1                	mov    %esp,%ecx
+     6e2:	ba e9 06 00 00       	mov    $0x6e9,%edx
+     6e7:	0f 34                	sysenter
+     6e9:	c3                   	ret
+
+000006ea <chdir>:
+SYSCALL(chdir)
+     6ea:	b8 09 00 00 00       	mov    $0x9,%eax
+     6ef:	89 e1                	mov    %esp,%ecx
+     6f1:	ba f8 06 00 00       	mov    $0x6f8,%edx
+     6f6:	0f 34                	sysenter
+     6f8:	c3                   	ret
+
+000006f9 <dup>:
+SYSCALL(dup)
+     6f9:	b8 0a 00 00 00       	mov    $0xa,%eax
+     6fe:	89 e1                	mov    %esp,%ecx
+     700:	ba 07 07 00 00       	mov    $0x707,%edx
+     705:	0f 34                	sysenter
+     707:	c3                   	ret
+
+00000708 <getpid>:
+SYSCALL(getpid)
+     708:	b8 0b 00 00 00       	mov    $0xb,%eax
+     70d:	89 e1                	mov    %esp,%ecx
+     70f:	ba 16 07 00 00       	mov    $0x716,%edx
+     714:	0f 34                	sysenter
+     716:	c3                   	ret
+
+00000717 <sbrk>:
+SYSCALL(sbrk)
+     717:	b8 0c 00 00 00       	mov    $0xc,%eax
+     71c:	89 e1                	mov    %esp,%ecx
+     71e:	ba 25 07 00 00       	mov    $0x725,%edx
+     723:	0f 34                	sysenter
+     725:	c3                   	ret
+
+00000726 <sleep>:
+SYSCALL(sleep)
+     726:	b8 0d 00 00 00       	mov    $0xd,%eax
+     72b:	89 e1                	mov    %esp,%ecx
+     72d:	ba 34 07 00 00       	mov    $0x734,%edx
+     732:	0f 34                	sysenter
+     734:	c3                   	ret
+
+00000735 <uptime>:
+SYSCALL(uptime)
+     735:	b8 0e 00 00 00       	mov    $0xe,%eax
+     73a:	89 e1                	mov    %esp,%ecx
+     73c:	ba 43 07 00 00       	mov    $0x743,%edx
+     741:	0f 34                	sysenter
+     743:	c3                   	ret
+
+00000744 <getproc>:
+SYSCALL(getproc)
+     744:	b8 16 00 00 00       	mov    $0x16,%eax
+     749:	89 e1                	mov    %esp,%ecx
+     74b:	ba 52 07 00 00       	mov    $0x752,%edx
+     750:	0f 34                	sysenter
+     752:	c3                   	ret
+
+00000753 <getpgs>:
+SYSCALL(getpgs)
+     753:	b8 17 00 00 00       	mov    $0x17,%eax
+     758:	89 e1                	mov    %esp,%ecx
+     75a:	ba 61 07 00 00       	mov    $0x761,%edx
+     75f:	0f 34                	sysenter
+     761:	c3                   	ret
+
+00000762 <loadproc>:
+SYSCALL(loadproc)
+     762:	b8 18 00 00 00       	mov    $0x18,%eax
+     767:	89 e1                	mov    %esp,%ecx
+     769:	ba 70 07 00 00       	mov    $0x770,%edx
+     76e:	0f 34                	sysenter
+     770:	c3                   	ret
+
+00000771 <iosubmit>:
+SYSCALL(iosubmit)
+     771:	b8 19 00 00 00       	mov    $0x19,%eax
+     776:	89 e1                	mov    %esp,%ecx
+     778:	ba 7f 07 00 00       	mov    $0x77f,%edx
+     77d:	0f 34                	sysenter
+     77f:	c3                   	ret
+
+00000780 <sysstat>:
+SYSCALL(sysstat)
+     780:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     785:	89 e1                	mov    %esp,%ecx
+     787:	ba 8e 07 00 00       	mov    $0x78e,%edx
+     78c:	0f 34                	sysenter
+     78e:	c3                   	ret
+
+0000078f <splice>:
+SYSCALL(splice)
+     78f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     794:	89 e1                	mov    %esp,%ecx
+     796:	ba 9d 07 00 00       	mov    $0x79d,%edx
+     79b:	0f 34                	sysenter
+     79d:	c3                   	ret
+
+0000079e <fsync>:
+SYSCALL(fsync)
+     79e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     7a3:	89 e1                	mov    %esp,%ecx
+     7a5:	ba ac 07 00 00       	mov    $0x7ac,%edx
+     7aa:	0f 34                	sysenter
+     7ac:	c3                   	ret
+
+000007ad <fdatasync>:
+SYSCALL(fdatasync)
+     7ad:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     7b2:	89 e1                	mov    %esp,%ecx
+     7b4:	ba bb 07 00 00       	mov    $0x7bb,%edx
+     7b9:	0f 34                	sysenter
+     7bb:	c3                   	ret
+
+000007bc <lseek>:
+SYSCALL(lseek)
+     7bc:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     7c1:	89 e1                	mov    %esp,%ecx
+     7c3:	ba ca 07 00 00       	mov    $0x7ca,%edx
+     7c8:	0f 34                	sysenter
+     7ca:	c3                   	ret
+
+000007cb <dmesg>:
+SYSCALL(dmesg)
+     7cb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     7d0:	89 e1                	mov    %esp,%ecx
+     7d2:	ba d9 07 00 00       	mov    $0x7d9,%edx
+     7d7:	0f 34                	sysenter
+     7d9:	c3                   	ret
+
+000007da <lockstat>:
+SYSCALL(lockstat)
+     7da:	b8 20 00 00 00       	mov    $0x20,%eax
+     7df:	89 e1                	mov    %esp,%ecx
+     7e1:	ba e8 07 00 00       	mov    $0x7e8,%edx
+     7e6:	0f 34                	sysenter
+     7e8:	c3                   	ret
+
+000007e9 <printint>:
+#include "stat.h"
+#include "user.h"
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     7e9:	55                   	push   %ebp
+     7ea:	89 e5                	mov    %esp,%ebp
+     7ec:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     7ef:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     7f6:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     7fa:	74 17                	je     813 <printint+0x2a>
+     7fc:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     800:	79 11                	jns    813 <printint+0x2a>
+    neg = 1;
+     802:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     809:	8b 45 0c             	mov    0xc(%ebp),%eax
+     80c:	f7 d8                	neg    %eax
+     80e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     811:	eb 06                	jmp    819 <printint+0x30>
+  } else {
+    x = xx;
+     813:	8b 45 0c             	mov    0xc(%ebp),%eax
+     816:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     819:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     820:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     823:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     826:	ba 00 00 00 00       	mov    $0x0,%edx
+     82b:	f7 f1                	div    %ecx
+     82d:	89 d1                	mov    %edx,%ecx
+     82f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     832:	8d 50 01             	lea    0x1(%eax),%edx
+     835:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     838:	0f b6 91 58 18 00 00 	movzbl 0x1858(%ecx),%edx
+     83f:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     843:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     846:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     849:	ba 00 00 00 00       	mov    $0x0,%edx
+     84e:	f7 f1                	div    %ecx
+     850:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     853:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     857:	75 c7                	jne    820 <printint+0x37>
+  if(neg)
+     859:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     85d:	74 2d                	je     88c <printint+0xa3>
+    buf[i++] = '-';
+     85f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     862:	8d 50 01             	lea    0x1(%eax),%edx
+     865:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     868:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+     86d:	eb 1d                	jmp    88c <printint+0xa3>
+    fputc(fd, buf[i]);
+     86f:	8d 55 dc             	lea    -0x24(%ebp),%edx
+     872:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     875:	01 d0                	add    %edx,%eax
+     877:	0f b6 00             	movzbl (%eax),%eax
+     87a:	0f be c0             	movsbl %al,%eax
+     87d:	83 ec 08             	sub    $0x8,%esp
+     880:	50                   	push   %eax
+     881:	ff 75 08             	push   0x8(%ebp)
+     884:	e8 f8 08 00 00       	call   1181 <fputc>
+     889:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+     88c:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     890:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     894:	79 d9                	jns    86f <printint+0x86>
+}
+     896:	90                   	nop
+     897:	90                   	nop
+     898:	c9                   	leave
+     899:	c3                   	ret
+
+0000089a <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     89a:	55                   	push   %ebp
+     89b:	89 e5                	mov    %esp,%ebp
+     89d:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+     8a0:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     8a7:	8d 45 0c             	lea    0xc(%ebp),%eax
+     8aa:	83 c0 04             	add    $0x4,%eax
+     8ad:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+     8b0:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     8b7:	e9 4a 01 00 00       	jmp    a06 <printf+0x16c>
+    c = fmt[i] & 0xff;
+     8bc:	8b 55 0c             	mov    0xc(%ebp),%edx
+     8bf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     8c2:	01 d0                	add    %edx,%eax
+     8c4:	0f b6 00             	movzbl (%eax),%eax
+     8c7:	0f be c0             	movsbl %al,%eax
+     8ca:	25 ff 00 00 00       	and    $0xff,%eax
+     8cf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+     8d2:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     8d6:	75 28                	jne    900 <printf+0x66>
+      if(c == '%'){
+     8d8:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     8dc:	75 0c                	jne    8ea <printf+0x50>
+        state = '%';
+     8de:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+     8e5:	e9 18 01 00 00       	jmp    a02 <printf+0x168>
+      } else {
+        fputc(fd, c);
+     8ea:	83 ec 08             	sub    $0x8,%esp
+     8ed:	ff 75 e4             	push   -0x1c(%ebp)
+     8f0:	ff 75 08             	push   0x8(%ebp)
+     8f3:	e8 89 08 00 00       	call   1181 <fputc>
+     8f8:	83 c4 10             	add    $0x10,%esp
+     8fb:	e9 02 01 00 00       	jmp    a02 <printf+0x168>
+      }
+    } else if(state == '%'){
+     900:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+     904:	0f 85 f8 00 00 00    	jne    a02 <printf+0x168>
+      if(c == 'd'){
+     90a:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+     90e:	75 1e                	jne    92e <printf+0x94>
+        printint(fd, *ap, 10, 1);
+     910:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     913:	8b 00                	mov    (%eax),%eax
+     915:	6a 01                	push   $0x1
+     917:	6a 0a                	push   $0xa
+     919:	50                   	push   %eax
+     91a:	ff 75 08             	push   0x8(%ebp)
+     91d:	e8 c7 fe ff ff       	call   7e9 <printint>
+     922:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     925:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     929:	e9 cd 00 00 00       	jmp    9fb <printf+0x161>
+      } else if(c == 'x' || c == 'p'){
+     92e:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+     932:	74 06                	je     93a <printf+0xa0>
+     934:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+     938:	75 1e                	jne    958 <printf+0xbe>
+        printint(fd, *ap, 16, 0);
+     93a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     93d:	8b 00                	mov    (%eax),%eax
+     93f:	6a 00                	push   $0x0
+     941:	6a 10                	push   $0x10
+     943:	50                   	push   %eax
+     944:	ff 75 08             	push   0x8(%ebp)
+     947:	e8 9d fe ff ff       	call   7e9 <printint>
+     94c:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     94f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     953:	e9 a3 00 00 00       	jmp    9fb <printf+0x161>
+      } else if(c == 's'){
+     958:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+     95c:	75 43                	jne    9a1 <printf+0x107>
+        s = (char*)*ap;
+     95e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     961:	8b 00                	mov    (%eax),%eax
+     963:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     966:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+     96a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     96e:	75 25                	jne    995 <printf+0xfb>
+          s = "(null)";
+     970:	c7 45 f4 ae 13 00 00 	movl   $0x13ae,-0xc(%ebp)
+        while(*s != 0){
+     977:	eb 1c                	jmp    995 <printf+0xfb>
+          fputc(fd, *s);
+     979:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     97c:	0f b6 00             	movzbl (%eax),%eax
+     97f:	0f be c0             	movsbl %al,%eax
+     982:	83 ec 08             	sub    $0x8,%esp
+     985:	50                   	push   %eax
+     986:	ff 75 08             	push   0x8(%ebp)
+     989:	e8 f3 07 00 00       	call   1181 <fputc>
+     98e:	83 c4 10             	add    $0x10,%esp
+          s++;
+     991:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+     995:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     998:	0f b6 00             	movzbl (%eax),%eax
+     99b:	84 c0                	test   %al,%al
+     99d:	75 da                	jne    979 <printf+0xdf>
+     99f:	eb 5a                	jmp    9fb <printf+0x161>
+        }
+      } else if(c == 'c'){
+     9a1:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+     9a5:	75 1a                	jne    9c1 <printf+0x127>
+        fputc(fd, *ap);
+     9a7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     9aa:	8b 00                	mov    (%eax),%eax
+     9ac:	83 ec 08             	sub    $0x8,%esp
+     9af:	50                   	push   %eax
+     9b0:	ff 75 08             	push   0x8(%ebp)
+     9b3:	e8 c9 07 00 00       	call   1181 <fputc>
+     9b8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     9bb:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     9bf:	eb 3a                	jmp    9fb <printf+0x161>
+      } else if(c == '%'){
+     9c1:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     9c5:	75 13                	jne    9da <printf+0x140>
+        fputc(fd, c);
+     9c7:	83 ec 08             	sub    $0x8,%esp
+     9ca:	ff 75 e4             	push   -0x1c(%ebp)
+     9cd:	ff 75 08             	push   0x8(%ebp)
+     9d0:	e8 ac 07 00 00       	call   1181 <fputc>
+     9d5:	83 c4 10             	add    $0x10,%esp
+     9d8:	eb 21                	jmp    9fb <printf+0x161>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        fputc(fd, '%');
+     9da:	83 ec 08             	sub    $0x8,%esp
+     9dd:	6a 25                	push   $0x25
+     9df:	ff 75 08             	push   0x8(%ebp)
+     9e2:	e8 9a 07 00 00       	call   1181 <fputc>
+     9e7:	83 c4 10             	add    $0x10,%esp
+        fputc(fd, c);
+     9ea:	83 ec 08             	sub    $0x8,%esp
+     9ed:	ff 75 e4             	push   -0x1c(%ebp)
+     9f0:	ff 75 08             	push   0x8(%ebp)
+     9f3:	e8 89 07 00 00       	call   1181 <fputc>
+     9f8:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     9fb:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     a02:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     a06:	8b 55 0c             	mov    0xc(%ebp),%edx
+     a09:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a0c:	01 d0                	add    %edx,%eax
+     a0e:	0f b6 00             	movzbl (%eax),%eax
+     a11:	84 c0                	test   %al,%al
+     a13:	0f 85 a3 fe ff ff    	jne    8bc <printf+0x22>
+    }
+  }
+}
+     a19:	90                   	nop
+     a1a:	90                   	nop
+     a1b:	c9                   	leave
+     a1c:	c3                   	ret
+
+00000a1d <binof>:
+static struct chunk *bins[NBIN];       // free large chunks
+static struct chunk *top;              // end marker of newest heap segment
+
+static int
+binof(uint size)
+{
+     a1d:	55                   	push   %ebp
+     a1e:	89 e5                	mov    %esp,%ebp
+     a20:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  i = 0;
+     a23:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     a2a:	c1 6d 08 05          	shrl   $0x5,0x8(%ebp)
+     a2e:	eb 07                	jmp    a37 <binof+0x1a>
+    i++;
+     a30:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  for(size >>= 5; size && i < NBIN-1; size >>= 1)
+     a34:	d1 6d 08             	shrl   0x8(%ebp)
+     a37:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     a3b:	74 06                	je     a43 <binof+0x26>
+     a3d:	83 7d fc 19          	cmpl   $0x19,-0x4(%ebp)
+     a41:	7e ed                	jle    a30 <binof+0x13>
+  return i;
+     a43:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     a46:	c9                   	leave
+     a47:	c3                   	ret
+
+00000a48 <bininsert>:
+
+static void
+bininsert(struct chunk *c)
+{
+     a48:	55                   	push   %ebp
+     a49:	89 e5                	mov    %esp,%ebp
+     a4b:	83 ec 10             	sub    $0x10,%esp
+  struct chunk **b;
+
+  b = &bins[binof(CSIZE(c))];
+     a4e:	8b 45 08             	mov    0x8(%ebp),%eax
+     a51:	8b 00                	mov    (%eax),%eax
+     a53:	83 e0 f8             	and    $0xfffffff8,%eax
+     a56:	50                   	push   %eax
+     a57:	e8 c1 ff ff ff       	call   a1d <binof>
+     a5c:	83 c4 04             	add    $0x4,%esp
+     a5f:	c1 e0 02             	shl    $0x2,%eax
+     a62:	05 a0 18 00 00       	add    $0x18a0,%eax
+     a67:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  c->prev = 0;
+     a6a:	8b 45 08             	mov    0x8(%ebp),%eax
+     a6d:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  c->next = *b;
+     a74:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     a77:	8b 10                	mov    (%eax),%edx
+     a79:	8b 45 08             	mov    0x8(%ebp),%eax
+     a7c:	89 50 08             	mov    %edx,0x8(%eax)
+  if(*b)
+     a7f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     a82:	8b 00                	mov    (%eax),%eax
+     a84:	85 c0                	test   %eax,%eax
+     a86:	74 0b                	je     a93 <bininsert+0x4b>
+    (*b)->prev = c;
+     a88:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     a8b:	8b 00                	mov    (%eax),%eax
+     a8d:	8b 55 08             	mov    0x8(%ebp),%edx
+     a90:	89 50 0c             	mov    %edx,0xc(%eax)
+  *b = c;
+     a93:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     a96:	8b 55 08             	mov    0x8(%ebp),%edx
+     a99:	89 10                	mov    %edx,(%eax)
+}
+     a9b:	90                   	nop
+     a9c:	c9                   	leave
+     a9d:	c3                   	ret
+
+00000a9e <binremove>:
+
+static void
+binremove(struct chunk *c)
+{
+     a9e:	55                   	push   %ebp
+     a9f:	89 e5                	mov    %esp,%ebp
+  if(c->prev)
+     aa1:	8b 45 08             	mov    0x8(%ebp),%eax
+     aa4:	8b 40 0c             	mov    0xc(%eax),%eax
+     aa7:	85 c0                	test   %eax,%eax
+     aa9:	74 11                	je     abc <binremove+0x1e>
+    c->prev->next = c->next;
+     aab:	8b 45 08             	mov    0x8(%ebp),%eax
+     aae:	8b 40 0c             	mov    0xc(%eax),%eax
+     ab1:	8b 55 08             	mov    0x8(%ebp),%edx
+     ab4:	8b 52 08             	mov    0x8(%edx),%edx
+     ab7:	89 50 08             	mov    %edx,0x8(%eax)
+     aba:	eb 1e                	jmp    ada <binremove+0x3c>
+  else
+    bins[binof(CSIZE(c))] = c->next;
+     abc:	8b 45 08             	mov    0x8(%ebp),%eax
+     abf:	8b 00                	mov    (%eax),%eax
+     ac1:	83 e0 f8             	and    $0xfffffff8,%eax
+     ac4:	50                   	push   %eax
+     ac5:	e8 53 ff ff ff       	call   a1d <binof>
+     aca:	83 c4 04             	add    $0x4,%esp
+     acd:	8b 55 08             	mov    0x8(%ebp),%edx
+     ad0:	8b 52 08             	mov    0x8(%edx),%edx
+     ad3:	89 14 85 a0 18 00 00 	mov    %edx,0x18a0(,%eax,4)
+  if(c->next)
+     ada:	8b 45 08             	mov    0x8(%ebp),%eax
+     add:	8b 40 08             	mov    0x8(%eax),%eax
+     ae0:	85 c0                	test   %eax,%eax
+     ae2:	74 0f                	je     af3 <binremove+0x55>
+    c->next->prev = c->prev;
+     ae4:	8b 45 08             	mov    0x8(%ebp),%eax
+     ae7:	8b 40 08             	mov    0x8(%eax),%eax
+     aea:	8b 55 08             	mov    0x8(%ebp),%edx
+     aed:	8b 52 0c             	mov    0xc(%edx),%edx
+     af0:	89 50 0c             	mov    %edx,0xc(%eax)
+}
+     af3:	90                   	nop
+     af4:	c9                   	leave
+     af5:	c3                   	ret
+
+00000af6 <freechunk>:
+
+// Free chunk c, merging it with free neighbors.  If trim is
+// set and the result is big and at the break, give it back.
+static void
+freechunk(struct chunk *c, int trim)
+{
+     af6:	55                   	push   %ebp
+     af7:	89 e5                	mov    %esp,%ebp
+     af9:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *p, *n;
+  uint size;
+
+  size = CSIZE(c);
+     afc:	8b 45 08             	mov    0x8(%ebp),%eax
+     aff:	8b 00                	mov    (%eax),%eax
+     b01:	83 e0 f8             	and    $0xfffffff8,%eax
+     b04:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  n = NEXTC(c);
+     b07:	8b 45 08             	mov    0x8(%ebp),%eax
+     b0a:	8b 00                	mov    (%eax),%eax
+     b0c:	83 e0 f8             	and    $0xfffffff8,%eax
+     b0f:	89 c2                	mov    %eax,%edx
+     b11:	8b 45 08             	mov    0x8(%ebp),%eax
+     b14:	01 d0                	add    %edx,%eax
+     b16:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(!(c->size & PREVUSED)){
+     b19:	8b 45 08             	mov    0x8(%ebp),%eax
+     b1c:	8b 00                	mov    (%eax),%eax
+     b1e:	83 e0 02             	and    $0x2,%eax
+     b21:	85 c0                	test   %eax,%eax
+     b23:	75 30                	jne    b55 <freechunk+0x5f>
+    p = (struct chunk*)((char*)c - *((uint*)c - 1));
+     b25:	8b 45 08             	mov    0x8(%ebp),%eax
+     b28:	83 e8 04             	sub    $0x4,%eax
+     b2b:	8b 00                	mov    (%eax),%eax
+     b2d:	f7 d8                	neg    %eax
+     b2f:	89 c2                	mov    %eax,%edx
+     b31:	8b 45 08             	mov    0x8(%ebp),%eax
+     b34:	01 d0                	add    %edx,%eax
+     b36:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    binremove(p);
+     b39:	ff 75 ec             	push   -0x14(%ebp)
+     b3c:	e8 5d ff ff ff       	call   a9e <binremove>
+     b41:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(p);
+     b44:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b47:	8b 00                	mov    (%eax),%eax
+     b49:	83 e0 f8             	and    $0xfffffff8,%eax
+     b4c:	01 45 f4             	add    %eax,-0xc(%ebp)
+    c = p;
+     b4f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b52:	89 45 08             	mov    %eax,0x8(%ebp)
+  }
+  if(!(n->size & USED)){
+     b55:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b58:	8b 00                	mov    (%eax),%eax
+     b5a:	83 e0 01             	and    $0x1,%eax
+     b5d:	85 c0                	test   %eax,%eax
+     b5f:	75 16                	jne    b77 <freechunk+0x81>
+    binremove(n);
+     b61:	ff 75 f0             	push   -0x10(%ebp)
+     b64:	e8 35 ff ff ff       	call   a9e <binremove>
+     b69:	83 c4 04             	add    $0x4,%esp
+    size += CSIZE(n);
+     b6c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b6f:	8b 00                	mov    (%eax),%eax
+     b71:	83 e0 f8             	and    $0xfffffff8,%eax
+     b74:	01 45 f4             	add    %eax,-0xc(%ebp)
+  }
+  // Free chunks are never adjacent, so the one below is in use.
+  c->size = size | PREVUSED;
+     b77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b7a:	83 c8 02             	or     $0x2,%eax
+     b7d:	89 c2                	mov    %eax,%edx
+     b7f:	8b 45 08             	mov    0x8(%ebp),%eax
+     b82:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+     b84:	8b 45 08             	mov    0x8(%ebp),%eax
+     b87:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  FOOTER(c) = size;
+     b8e:	8b 45 08             	mov    0x8(%ebp),%eax
+     b91:	8b 00                	mov    (%eax),%eax
+     b93:	83 e0 f8             	and    $0xfffffff8,%eax
+     b96:	8d 50 fc             	lea    -0x4(%eax),%edx
+     b99:	8b 45 08             	mov    0x8(%ebp),%eax
+     b9c:	01 c2                	add    %eax,%edx
+     b9e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ba1:	89 02                	mov    %eax,(%edx)
+  n = NEXTC(c);
+     ba3:	8b 45 08             	mov    0x8(%ebp),%eax
+     ba6:	8b 00                	mov    (%eax),%eax
+     ba8:	83 e0 f8             	and    $0xfffffff8,%eax
+     bab:	89 c2                	mov    %eax,%edx
+     bad:	8b 45 08             	mov    0x8(%ebp),%eax
+     bb0:	01 d0                	add    %edx,%eax
+     bb2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  n->size &= ~PREVUSED;
+     bb5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bb8:	8b 00                	mov    (%eax),%eax
+     bba:	83 e0 fd             	and    $0xfffffffd,%eax
+     bbd:	89 c2                	mov    %eax,%edx
+     bbf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     bc2:	89 10                	mov    %edx,(%eax)
+
+  if(trim && n == top && size >= TRIMSIZE && sbrk(0) == (char*)top + HDRSIZE){
+     bc4:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     bc8:	74 51                	je     c1b <freechunk+0x125>
+     bca:	a1 0c 19 00 00       	mov    0x190c,%eax
+     bcf:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     bd2:	75 47                	jne    c1b <freechunk+0x125>
+     bd4:	81 7d f4 ff 7f 00 00 	cmpl   $0x7fff,-0xc(%ebp)
+     bdb:	76 3e                	jbe    c1b <freechunk+0x125>
+     bdd:	83 ec 0c             	sub    $0xc,%esp
+     be0:	6a 00                	push   $0x0
+     be2:	e8 30 fb ff ff       	call   717 <sbrk>
+     be7:	83 c4 10             	add    $0x10,%esp
+     bea:	8b 15 0c 19 00 00    	mov    0x190c,%edx
+     bf0:	83 c2 08             	add    $0x8,%edx
+     bf3:	39 d0                	cmp    %edx,%eax
+     bf5:	75 24                	jne    c1b <freechunk+0x125>
+    c->size = USED | PREVUSED;
+     bf7:	8b 45 08             	mov    0x8(%ebp),%eax
+     bfa:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+    top = c;
+     c00:	8b 45 08             	mov    0x8(%ebp),%eax
+     c03:	a3 0c 19 00 00       	mov    %eax,0x190c
+    sbrk(-size);
+     c08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c0b:	f7 d8                	neg    %eax
+     c0d:	83 ec 0c             	sub    $0xc,%esp
+     c10:	50                   	push   %eax
+     c11:	e8 01 fb ff ff       	call   717 <sbrk>
+     c16:	83 c4 10             	add    $0x10,%esp
+    return;
+     c19:	eb 0e                	jmp    c29 <freechunk+0x133>
+  }
+  bininsert(c);
+     c1b:	83 ec 0c             	sub    $0xc,%esp
+     c1e:	ff 75 08             	push   0x8(%ebp)
+     c21:	e8 22 fe ff ff       	call   a48 <bininsert>
+     c26:	83 c4 10             	add    $0x10,%esp
+}
+     c29:	c9                   	leave
+     c2a:	c3                   	ret
+
+00000c2b <morecore>:
+
+// Grow the heap by at least need bytes.
+static int
+morecore(uint need)
+{
+     c2b:	55                   	push   %ebp
+     c2c:	89 e5                	mov    %esp,%ebp
+     c2e:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+  char *p;
+  uint n, pad;
+
+  n = need + MINCHUNK;
+     c31:	8b 45 08             	mov    0x8(%ebp),%eax
+     c34:	83 c0 18             	add    $0x18,%eax
+     c37:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(n < MINCORE)
+     c3a:	81 7d ec ff 3f 00 00 	cmpl   $0x3fff,-0x14(%ebp)
+     c41:	77 07                	ja     c4a <morecore+0x1f>
+    n = MINCORE;
+     c43:	c7 45 ec 00 40 00 00 	movl   $0x4000,-0x14(%ebp)
+  // Keep the break 8-aligned, with the end marker just below it.
+  pad = (8 - ((uint)sbrk(0) & 7)) & 7;
+     c4a:	83 ec 0c             	sub    $0xc,%esp
+     c4d:	6a 00                	push   $0x0
+     c4f:	e8 c3 fa ff ff       	call   717 <sbrk>
+     c54:	83 c4 10             	add    $0x10,%esp
+     c57:	83 e0 07             	and    $0x7,%eax
+     c5a:	ba 08 00 00 00       	mov    $0x8,%edx
+     c5f:	29 c2                	sub    %eax,%edx
+     c61:	89 d0                	mov    %edx,%eax
+     c63:	83 e0 07             	and    $0x7,%eax
+     c66:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if((p = sbrk(pad + n)) == (char*)-1){
+     c69:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     c6c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     c6f:	01 d0                	add    %edx,%eax
+     c71:	83 ec 0c             	sub    $0xc,%esp
+     c74:	50                   	push   %eax
+     c75:	e8 9d fa ff ff       	call   717 <sbrk>
+     c7a:	83 c4 10             	add    $0x10,%esp
+     c7d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     c80:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     c84:	75 30                	jne    cb6 <morecore+0x8b>
+    n = need + MINCHUNK;
+     c86:	8b 45 08             	mov    0x8(%ebp),%eax
+     c89:	83 c0 18             	add    $0x18,%eax
+     c8c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((p = sbrk(pad + n)) == (char*)-1)
+     c8f:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     c92:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     c95:	01 d0                	add    %edx,%eax
+     c97:	83 ec 0c             	sub    $0xc,%esp
+     c9a:	50                   	push   %eax
+     c9b:	e8 77 fa ff ff       	call   717 <sbrk>
+     ca0:	83 c4 10             	add    $0x10,%esp
+     ca3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     ca6:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+     caa:	75 0a                	jne    cb6 <morecore+0x8b>
+      return -1;
+     cac:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     cb1:	e9 8e 00 00 00       	jmp    d44 <morecore+0x119>
+  }
+  p += pad;
+     cb6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     cb9:	01 45 f0             	add    %eax,-0x10(%ebp)
+  if(top && p == (char*)top + HDRSIZE){
+     cbc:	a1 0c 19 00 00       	mov    0x190c,%eax
+     cc1:	85 c0                	test   %eax,%eax
+     cc3:	74 29                	je     cee <morecore+0xc3>
+     cc5:	a1 0c 19 00 00       	mov    0x190c,%eax
+     cca:	83 c0 08             	add    $0x8,%eax
+     ccd:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     cd0:	75 1c                	jne    cee <morecore+0xc3>
+    // Contiguous: the old end marker heads the new chunk.
+    c = top;
+     cd2:	a1 0c 19 00 00       	mov    0x190c,%eax
+     cd7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = n | (c->size & PREVUSED);
+     cda:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     cdd:	8b 00                	mov    (%eax),%eax
+     cdf:	83 e0 02             	and    $0x2,%eax
+     ce2:	0b 45 ec             	or     -0x14(%ebp),%eax
+     ce5:	89 c2                	mov    %eax,%edx
+     ce7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     cea:	89 10                	mov    %edx,(%eax)
+     cec:	eb 16                	jmp    d04 <morecore+0xd9>
+  } else {
+    // Someone else moved the break: start a new segment.
+    c = (struct chunk*)p;
+     cee:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     cf1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    c->size = (n - HDRSIZE) | PREVUSED;
+     cf4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     cf7:	83 e8 08             	sub    $0x8,%eax
+     cfa:	83 c8 02             	or     $0x2,%eax
+     cfd:	89 c2                	mov    %eax,%edx
+     cff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d02:	89 10                	mov    %edx,(%eax)
+  }
+  top = NEXTC(c);
+     d04:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d07:	8b 00                	mov    (%eax),%eax
+     d09:	83 e0 f8             	and    $0xfffffff8,%eax
+     d0c:	89 c2                	mov    %eax,%edx
+     d0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d11:	01 d0                	add    %edx,%eax
+     d13:	a3 0c 19 00 00       	mov    %eax,0x190c
+  top->size = USED;
+     d18:	a1 0c 19 00 00       	mov    0x190c,%eax
+     d1d:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  top->tag = LARGE;
+     d23:	a1 0c 19 00 00       	mov    0x190c,%eax
+     d28:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  freechunk(c, 0);
+     d2f:	83 ec 08             	sub    $0x8,%esp
+     d32:	6a 00                	push   $0x0
+     d34:	ff 75 f4             	push   -0xc(%ebp)
+     d37:	e8 ba fd ff ff       	call   af6 <freechunk>
+     d3c:	83 c4 10             	add    $0x10,%esp
+  return 0;
+     d3f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     d44:	c9                   	leave
+     d45:	c3                   	ret
+
+00000d46 <largealloc>:
+
+static void*
+largealloc(uint nbytes)
+{
+     d46:	55                   	push   %ebp
+     d47:	89 e5                	mov    %esp,%ebp
+     d49:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c, *r;
+  uint need;
+  int i;
+
+  if(nbytes > 0x7fffffff)
+     d4c:	8b 45 08             	mov    0x8(%ebp),%eax
+     d4f:	85 c0                	test   %eax,%eax
+     d51:	79 0a                	jns    d5d <largealloc+0x17>
+    return 0;
+     d53:	b8 00 00 00 00       	mov    $0x0,%eax
+     d58:	e9 43 01 00 00       	jmp    ea0 <largealloc+0x15a>
+  need = (nbytes + HDRSIZE + 7) & ~7;
+     d5d:	8b 45 08             	mov    0x8(%ebp),%eax
+     d60:	83 c0 0f             	add    $0xf,%eax
+     d63:	83 e0 f8             	and    $0xfffffff8,%eax
+     d66:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(need < MINCHUNK)
+     d69:	83 7d f0 17          	cmpl   $0x17,-0x10(%ebp)
+     d6d:	77 07                	ja     d76 <largealloc+0x30>
+    need = MINCHUNK;
+     d6f:	c7 45 f0 18 00 00 00 	movl   $0x18,-0x10(%ebp)
+  for(;;){
+    for(i = binof(need); i < NBIN; i++)
+     d76:	ff 75 f0             	push   -0x10(%ebp)
+     d79:	e8 9f fc ff ff       	call   a1d <binof>
+     d7e:	83 c4 04             	add    $0x4,%esp
+     d81:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     d84:	eb 2f                	jmp    db5 <largealloc+0x6f>
+      for(c = bins[i]; c; c = c->next)
+     d86:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     d89:	8b 04 85 a0 18 00 00 	mov    0x18a0(,%eax,4),%eax
+     d90:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     d93:	eb 16                	jmp    dab <largealloc+0x65>
+        if(CSIZE(c) >= need)
+     d95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d98:	8b 00                	mov    (%eax),%eax
+     d9a:	83 e0 f8             	and    $0xfffffff8,%eax
+     d9d:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     da0:	73 35                	jae    dd7 <largealloc+0x91>
+      for(c = bins[i]; c; c = c->next)
+     da2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     da5:	8b 40 08             	mov    0x8(%eax),%eax
+     da8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     dab:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     daf:	75 e4                	jne    d95 <largealloc+0x4f>
+    for(i = binof(need); i < NBIN; i++)
+     db1:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     db5:	83 7d ec 1a          	cmpl   $0x1a,-0x14(%ebp)
+     db9:	7e cb                	jle    d86 <largealloc+0x40>
+          goto found;
+    if(morecore(need) < 0)
+     dbb:	83 ec 0c             	sub    $0xc,%esp
+     dbe:	ff 75 f0             	push   -0x10(%ebp)
+     dc1:	e8 65 fe ff ff       	call   c2b <morecore>
+     dc6:	83 c4 10             	add    $0x10,%esp
+     dc9:	85 c0                	test   %eax,%eax
+     dcb:	79 a9                	jns    d76 <largealloc+0x30>
+      return 0;
+     dcd:	b8 00 00 00 00       	mov    $0x0,%eax
+     dd2:	e9 c9 00 00 00       	jmp    ea0 <largealloc+0x15a>
+          goto found;
+     dd7:	90                   	nop
+  }
+
+found:
+  binremove(c);
+     dd8:	83 ec 0c             	sub    $0xc,%esp
+     ddb:	ff 75 f4             	push   -0xc(%ebp)
+     dde:	e8 bb fc ff ff       	call   a9e <binremove>
+     de3:	83 c4 10             	add    $0x10,%esp
+  if(CSIZE(c) - need >= MINCHUNK){
+     de6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     de9:	8b 00                	mov    (%eax),%eax
+     deb:	83 e0 f8             	and    $0xfffffff8,%eax
+     dee:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     df1:	83 f8 17             	cmp    $0x17,%eax
+     df4:	76 66                	jbe    e5c <largealloc+0x116>
+    r = (struct chunk*)((char*)c + need);
+     df6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     df9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     dfc:	01 d0                	add    %edx,%eax
+     dfe:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    r->size = (CSIZE(c) - need) | PREVUSED;
+     e01:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e04:	8b 00                	mov    (%eax),%eax
+     e06:	83 e0 f8             	and    $0xfffffff8,%eax
+     e09:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     e0c:	83 c8 02             	or     $0x2,%eax
+     e0f:	89 c2                	mov    %eax,%edx
+     e11:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e14:	89 10                	mov    %edx,(%eax)
+    r->tag = LARGE;
+     e16:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e19:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+    FOOTER(r) = CSIZE(r);
+     e20:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e23:	8b 10                	mov    (%eax),%edx
+     e25:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e28:	8b 00                	mov    (%eax),%eax
+     e2a:	83 e0 f8             	and    $0xfffffff8,%eax
+     e2d:	8d 48 fc             	lea    -0x4(%eax),%ecx
+     e30:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e33:	01 c8                	add    %ecx,%eax
+     e35:	83 e2 f8             	and    $0xfffffff8,%edx
+     e38:	89 10                	mov    %edx,(%eax)
+    bininsert(r);
+     e3a:	83 ec 0c             	sub    $0xc,%esp
+     e3d:	ff 75 e8             	push   -0x18(%ebp)
+     e40:	e8 03 fc ff ff       	call   a48 <bininsert>
+     e45:	83 c4 10             	add    $0x10,%esp
+    c->size = need | (c->size & PREVUSED);
+     e48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e4b:	8b 00                	mov    (%eax),%eax
+     e4d:	83 e0 02             	and    $0x2,%eax
+     e50:	0b 45 f0             	or     -0x10(%ebp),%eax
+     e53:	89 c2                	mov    %eax,%edx
+     e55:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e58:	89 10                	mov    %edx,(%eax)
+     e5a:	eb 25                	jmp    e81 <largealloc+0x13b>
+  } else
+    NEXTC(c)->size |= PREVUSED;
+     e5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e5f:	8b 00                	mov    (%eax),%eax
+     e61:	83 e0 f8             	and    $0xfffffff8,%eax
+     e64:	89 c2                	mov    %eax,%edx
+     e66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e69:	01 d0                	add    %edx,%eax
+     e6b:	8b 10                	mov    (%eax),%edx
+     e6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e70:	8b 00                	mov    (%eax),%eax
+     e72:	83 e0 f8             	and    $0xfffffff8,%eax
+     e75:	89 c1                	mov    %eax,%ecx
+     e77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e7a:	01 c8                	add    %ecx,%eax
+     e7c:	83 ca 02             	or     $0x2,%edx
+     e7f:	89 10                	mov    %edx,(%eax)
+  c->size |= USED;
+     e81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e84:	8b 00                	mov    (%eax),%eax
+     e86:	83 c8 01             	or     $0x1,%eax
+     e89:	89 c2                	mov    %eax,%edx
+     e8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e8e:	89 10                	mov    %edx,(%eax)
+  c->tag = LARGE;
+     e90:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e93:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+  return (char*)c + HDRSIZE;
+     e9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e9d:	83 c0 08             	add    $0x8,%eax
+}
+     ea0:	c9                   	leave
+     ea1:	c3                   	ret
+
+00000ea2 <refill>:
+
+// Carve a slab into free blocks of class k.
+static int
+refill(int k)
+{
+     ea2:	55                   	push   %ebp
+     ea3:	89 e5                	mov    %esp,%ebp
+     ea5:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  char *p;
+  uint bs, i;
+
+  if((p = largealloc(SLABSIZE)) == 0)
+     ea8:	83 ec 0c             	sub    $0xc,%esp
+     eab:	68 00 20 00 00       	push   $0x2000
+     eb0:	e8 91 fe ff ff       	call   d46 <largealloc>
+     eb5:	83 c4 10             	add    $0x10,%esp
+     eb8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     ebb:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     ebf:	75 07                	jne    ec8 <refill+0x26>
+    return -1;
+     ec1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     ec6:	eb 75                	jmp    f3d <refill+0x9b>
+  bs = HDRSIZE + (MINSMALL << k);
+     ec8:	8b 45 08             	mov    0x8(%ebp),%eax
+     ecb:	ba 10 00 00 00       	mov    $0x10,%edx
+     ed0:	89 c1                	mov    %eax,%ecx
+     ed2:	d3 e2                	shl    %cl,%edx
+     ed4:	89 d0                	mov    %edx,%eax
+     ed6:	83 c0 08             	add    $0x8,%eax
+     ed9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+     edc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     ee3:	eb 44                	jmp    f29 <refill+0x87>
+    b = (struct chunk*)(p + i);
+     ee5:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     ee8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eeb:	01 d0                	add    %edx,%eax
+     eed:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    b->size = bs | USED;
+     ef0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     ef3:	83 c8 01             	or     $0x1,%eax
+     ef6:	89 c2                	mov    %eax,%edx
+     ef8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     efb:	89 10                	mov    %edx,(%eax)
+    b->tag = k;
+     efd:	8b 55 08             	mov    0x8(%ebp),%edx
+     f00:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f03:	89 50 04             	mov    %edx,0x4(%eax)
+    b->next = classes[k];
+     f06:	8b 45 08             	mov    0x8(%ebp),%eax
+     f09:	8b 14 85 80 18 00 00 	mov    0x1880(,%eax,4),%edx
+     f10:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f13:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[k] = b;
+     f16:	8b 45 08             	mov    0x8(%ebp),%eax
+     f19:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     f1c:	89 14 85 80 18 00 00 	mov    %edx,0x1880(,%eax,4)
+  for(i = 0; i + bs <= SLABSIZE; i += bs){
+     f23:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f26:	01 45 f4             	add    %eax,-0xc(%ebp)
+     f29:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     f2c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f2f:	01 d0                	add    %edx,%eax
+     f31:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     f36:	76 ad                	jbe    ee5 <refill+0x43>
+  }
+  return 0;
+     f38:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     f3d:	c9                   	leave
+     f3e:	c3                   	ret
+
+00000f3f <free>:
+
+void
+free(void *ap)
+{
+     f3f:	55                   	push   %ebp
+     f40:	89 e5                	mov    %esp,%ebp
+     f42:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *c;
+
+  if(ap == 0)
+     f45:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     f49:	74 4b                	je     f96 <free+0x57>
+    return;
+  c = (struct chunk*)((char*)ap - HDRSIZE);
+     f4b:	8b 45 08             	mov    0x8(%ebp),%eax
+     f4e:	83 e8 08             	sub    $0x8,%eax
+     f51:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(c->tag != LARGE){
+     f54:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f57:	8b 40 04             	mov    0x4(%eax),%eax
+     f5a:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f5d:	74 25                	je     f84 <free+0x45>
+    c->next = classes[c->tag];
+     f5f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f62:	8b 40 04             	mov    0x4(%eax),%eax
+     f65:	8b 14 85 80 18 00 00 	mov    0x1880(,%eax,4),%edx
+     f6c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f6f:	89 50 08             	mov    %edx,0x8(%eax)
+    classes[c->tag] = c;
+     f72:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f75:	8b 40 04             	mov    0x4(%eax),%eax
+     f78:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     f7b:	89 14 85 80 18 00 00 	mov    %edx,0x1880(,%eax,4)
+    return;
+     f82:	eb 13                	jmp    f97 <free+0x58>
+  }
+  freechunk(c, 1);
+     f84:	83 ec 08             	sub    $0x8,%esp
+     f87:	6a 01                	push   $0x1
+     f89:	ff 75 f4             	push   -0xc(%ebp)
+     f8c:	e8 65 fb ff ff       	call   af6 <freechunk>
+     f91:	83 c4 10             	add    $0x10,%esp
+     f94:	eb 01                	jmp    f97 <free+0x58>
+    return;
+     f96:	90                   	nop
+}
+     f97:	c9                   	leave
+     f98:	c3                   	ret
+
+00000f99 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     f99:	55                   	push   %ebp
+     f9a:	89 e5                	mov    %esp,%ebp
+     f9c:	83 ec 18             	sub    $0x18,%esp
+  struct chunk *b;
+  int k;
+
+  if(nbytes > MAXSMALL)
+     f9f:	81 7d 08 00 08 00 00 	cmpl   $0x800,0x8(%ebp)
+     fa6:	76 10                	jbe    fb8 <malloc+0x1f>
+    return largealloc(nbytes);
+     fa8:	83 ec 0c             	sub    $0xc,%esp
+     fab:	ff 75 08             	push   0x8(%ebp)
+     fae:	e8 93 fd ff ff       	call   d46 <largealloc>
+     fb3:	83 c4 10             	add    $0x10,%esp
+     fb6:	eb 6a                	jmp    1022 <malloc+0x89>
+  for(k = 0; (MINSMALL << k) < nbytes; k++)
+     fb8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     fbf:	eb 04                	jmp    fc5 <malloc+0x2c>
+     fc1:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     fc5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fc8:	ba 10 00 00 00       	mov    $0x10,%edx
+     fcd:	89 c1                	mov    %eax,%ecx
+     fcf:	d3 e2                	shl    %cl,%edx
+     fd1:	89 d0                	mov    %edx,%eax
+     fd3:	3b 45 08             	cmp    0x8(%ebp),%eax
+     fd6:	72 e9                	jb     fc1 <malloc+0x28>
+    ;
+  if(classes[k] == 0 && refill(k) < 0)
+     fd8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fdb:	8b 04 85 80 18 00 00 	mov    0x1880(,%eax,4),%eax
+     fe2:	85 c0                	test   %eax,%eax
+     fe4:	75 19                	jne    fff <malloc+0x66>
+     fe6:	83 ec 0c             	sub    $0xc,%esp
+     fe9:	ff 75 f4             	push   -0xc(%ebp)
+     fec:	e8 b1 fe ff ff       	call   ea2 <refill>
+     ff1:	83 c4 10             	add    $0x10,%esp
+     ff4:	85 c0                	test   %eax,%eax
+     ff6:	79 07                	jns    fff <malloc+0x66>
+    return 0;
+     ff8:	b8 00 00 00 00       	mov    $0x0,%eax
+     ffd:	eb 23                	jmp    1022 <malloc+0x89>
+  b = classes[k];
+     fff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1002:	8b 04 85 80 18 00 00 	mov    0x1880(,%eax,4),%eax
+    1009:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  classes[k] = b->next;
+    100c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    100f:	8b 50 08             	mov    0x8(%eax),%edx
+    1012:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1015:	89 14 85 80 18 00 00 	mov    %edx,0x1880(,%eax,4)
+  return (char*)b + HDRSIZE;
+    101c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    101f:	83 c0 08             	add    $0x8,%eax
+}
+    1022:	c9                   	leave
+    1023:	c3                   	ret
+
+00001024 <stream>:
+
+// Return the stream for fd, deciding on first use how
+// its output is buffered.  Returns 0 if fd is not open.
+static struct stream*
+stream(int fd)
+{
+    1024:	55                   	push   %ebp
+    1025:	89 e5                	mov    %esp,%ebp
+    1027:	83 ec 28             	sub    $0x28,%esp
+  struct stream *s;
+  struct stat st;
+
+  if(fd < 0 || fd >= NOFILE)
+    102a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    102e:	78 06                	js     1036 <stream+0x12>
+    1030:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    1034:	7e 07                	jle    103d <stream+0x19>
+    return 0;
+    1036:	b8 00 00 00 00       	mov    $0x0,%eax
+    103b:	eb 55                	jmp    1092 <stream+0x6e>
+  s = &streams[fd];
+    103d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1040:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1046:	05 20 19 00 00       	add    $0x1920,%eax
+    104b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(s->mode == UNKNOWN){
+    104e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1051:	8b 00                	mov    (%eax),%eax
+    1053:	85 c0                	test   %eax,%eax
+    1055:	75 38                	jne    108f <stream+0x6b>
+    if(fstat(fd, &st) < 0)
+    1057:	83 ec 08             	sub    $0x8,%esp
+    105a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    105d:	50                   	push   %eax
+    105e:	ff 75 08             	push   0x8(%ebp)
+    1061:	e8 57 f6 ff ff       	call   6bd <fstat>
+    1066:	83 c4 10             	add    $0x10,%esp
+    1069:	85 c0                	test   %eax,%eax
+    106b:	79 07                	jns    1074 <stream+0x50>
+      return 0;
+    106d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1072:	eb 1e                	jmp    1092 <stream+0x6e>
+    s->mode = st.type == T_DEV ? LINEBUF : FULLBUF;
+    1074:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+    1078:	66 83 f8 03          	cmp    $0x3,%ax
+    107c:	75 07                	jne    1085 <stream+0x61>
+    107e:	ba 01 00 00 00       	mov    $0x1,%edx
+    1083:	eb 05                	jmp    108a <stream+0x66>
+    1085:	ba 02 00 00 00       	mov    $0x2,%edx
+    108a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    108d:	89 10                	mov    %edx,(%eax)
+  }
+  return s;
+    108f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1092:	c9                   	leave
+    1093:	c3                   	ret
+
+00001094 <fflush>:
+
+int
+fflush(int fd)
+{
+    1094:	55                   	push   %ebp
+    1095:	89 e5                	mov    %esp,%ebp
+    1097:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  int i, n;
+
+  if(fd < 0 || fd >= NOFILE)
+    109a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    109e:	78 06                	js     10a6 <fflush+0x12>
+    10a0:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    10a4:	7e 07                	jle    10ad <fflush+0x19>
+    return -1;
+    10a6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    10ab:	eb 78                	jmp    1125 <fflush+0x91>
+  s = &streams[fd];
+    10ad:	8b 45 08             	mov    0x8(%ebp),%eax
+    10b0:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    10b6:	05 20 19 00 00       	add    $0x1920,%eax
+    10bb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < s->nout; i += n){
+    10be:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    10c5:	eb 44                	jmp    110b <fflush+0x77>
+    if((n = write(fd, s->out + i, s->nout - i)) <= 0){
+    10c7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    10ca:	8b 40 04             	mov    0x4(%eax),%eax
+    10cd:	2b 45 f4             	sub    -0xc(%ebp),%eax
+    10d0:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    10d3:	8d 4a 10             	lea    0x10(%edx),%ecx
+    10d6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    10d9:	01 ca                	add    %ecx,%edx
+    10db:	83 ec 04             	sub    $0x4,%esp
+    10de:	50                   	push   %eax
+    10df:	52                   	push   %edx
+    10e0:	ff 75 08             	push   0x8(%ebp)
+    10e3:	e8 6c f5 ff ff       	call   654 <write>
+    10e8:	83 c4 10             	add    $0x10,%esp
+    10eb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    10ee:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    10f2:	7f 11                	jg     1105 <fflush+0x71>
+      s->nout = 0;
+    10f4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    10f7:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+      return -1;
+    10fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1103:	eb 20                	jmp    1125 <fflush+0x91>
+  for(i = 0; i < s->nout; i += n){
+    1105:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1108:	01 45 f4             	add    %eax,-0xc(%ebp)
+    110b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    110e:	8b 40 04             	mov    0x4(%eax),%eax
+    1111:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    1114:	7c b1                	jl     10c7 <fflush+0x33>
+    }
+  }
+  s->nout = 0;
+    1116:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1119:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  return 0;
+    1120:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1125:	c9                   	leave
+    1126:	c3                   	ret
+
+00001127 <flushall>:
+
+// Flush every stream, or only line-buffered ones.
+static void
+flushall(int lineonly)
+{
+    1127:	55                   	push   %ebp
+    1128:	89 e5                	mov    %esp,%ebp
+    112a:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++)
+    112d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1134:	eb 41                	jmp    1177 <flushall+0x50>
+    if(streams[fd].nout > 0 && (!lineonly || streams[fd].mode == LINEBUF))
+    1136:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1139:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    113f:	05 24 19 00 00       	add    $0x1924,%eax
+    1144:	8b 00                	mov    (%eax),%eax
+    1146:	85 c0                	test   %eax,%eax
+    1148:	7e 29                	jle    1173 <flushall+0x4c>
+    114a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    114e:	74 15                	je     1165 <flushall+0x3e>
+    1150:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1153:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1159:	05 20 19 00 00       	add    $0x1920,%eax
+    115e:	8b 00                	mov    (%eax),%eax
+    1160:	83 f8 01             	cmp    $0x1,%eax
+    1163:	75 0e                	jne    1173 <flushall+0x4c>
+      fflush(fd);
+    1165:	83 ec 0c             	sub    $0xc,%esp
+    1168:	ff 75 f4             	push   -0xc(%ebp)
+    116b:	e8 24 ff ff ff       	call   1094 <fflush>
+    1170:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++)
+    1173:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1177:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+    117b:	7e b9                	jle    1136 <flushall+0xf>
+}
+    117d:	90                   	nop
+    117e:	90                   	nop
+    117f:	c9                   	leave
+    1180:	c3                   	ret
+
+00001181 <fputc>:
+
+int
+fputc(int fd, int c)
+{
+    1181:	55                   	push   %ebp
+    1182:	89 e5                	mov    %esp,%ebp
+    1184:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  char ch;
+
+  if((s = stream(fd)) == 0){
+    1187:	83 ec 0c             	sub    $0xc,%esp
+    118a:	ff 75 08             	push   0x8(%ebp)
+    118d:	e8 92 fe ff ff       	call   1024 <stream>
+    1192:	83 c4 10             	add    $0x10,%esp
+    1195:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1198:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    119c:	75 2e                	jne    11cc <fputc+0x4b>
+    ch = c;
+    119e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11a1:	88 45 f3             	mov    %al,-0xd(%ebp)
+    return write(fd, &ch, 1) == 1 ? (uchar)c : -1;
+    11a4:	83 ec 04             	sub    $0x4,%esp
+    11a7:	6a 01                	push   $0x1
+    11a9:	8d 45 f3             	lea    -0xd(%ebp),%eax
+    11ac:	50                   	push   %eax
+    11ad:	ff 75 08             	push   0x8(%ebp)
+    11b0:	e8 9f f4 ff ff       	call   654 <write>
+    11b5:	83 c4 10             	add    $0x10,%esp
+    11b8:	83 f8 01             	cmp    $0x1,%eax
+    11bb:	75 08                	jne    11c5 <fputc+0x44>
+    11bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11c0:	0f b6 c0             	movzbl %al,%eax
+    11c3:	eb 5e                	jmp    1223 <fputc+0xa2>
+    11c5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    11ca:	eb 57                	jmp    1223 <fputc+0xa2>
+  }
+  s->out[s->nout++] = c;
+    11cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11cf:	8b 40 04             	mov    0x4(%eax),%eax
+    11d2:	8d 48 01             	lea    0x1(%eax),%ecx
+    11d5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    11d8:	89 4a 04             	mov    %ecx,0x4(%edx)
+    11db:	8b 55 0c             	mov    0xc(%ebp),%edx
+    11de:	89 d1                	mov    %edx,%ecx
+    11e0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    11e3:	88 4c 02 10          	mov    %cl,0x10(%edx,%eax,1)
+  if(s->nout == BUFSZ || (s->mode == LINEBUF && c == '\n'))
+    11e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11ea:	8b 40 04             	mov    0x4(%eax),%eax
+    11ed:	3d 00 02 00 00       	cmp    $0x200,%eax
+    11f2:	74 10                	je     1204 <fputc+0x83>
+    11f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11f7:	8b 00                	mov    (%eax),%eax
+    11f9:	83 f8 01             	cmp    $0x1,%eax
+    11fc:	75 1f                	jne    121d <fputc+0x9c>
+    11fe:	83 7d 0c 0a          	cmpl   $0xa,0xc(%ebp)
+    1202:	75 19                	jne    121d <fputc+0x9c>
+    if(fflush(fd) < 0)
+    1204:	83 ec 0c             	sub    $0xc,%esp
+    1207:	ff 75 08             	push   0x8(%ebp)
+    120a:	e8 85 fe ff ff       	call   1094 <fflush>
+    120f:	83 c4 10             	add    $0x10,%esp
+    1212:	85 c0                	test   %eax,%eax
+    1214:	79 07                	jns    121d <fputc+0x9c>
+      return -1;
+    1216:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    121b:	eb 06                	jmp    1223 <fputc+0xa2>
+  return (uchar)c;
+    121d:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1220:	0f b6 c0             	movzbl %al,%eax
+}
+    1223:	c9                   	leave
+    1224:	c3                   	ret
+
+00001225 <fgetc>:
+
+// Return the next byte read from fd, or -1 at end of file.
+int
+fgetc(int fd)
+{
+    1225:	55                   	push   %ebp
+    1226:	89 e5                	mov    %esp,%ebp
+    1228:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+  uchar c;
+  int n;
+
+  if((s = stream(fd)) == 0){
+    122b:	83 ec 0c             	sub    $0xc,%esp
+    122e:	ff 75 08             	push   0x8(%ebp)
+    1231:	e8 ee fd ff ff       	call   1024 <stream>
+    1236:	83 c4 10             	add    $0x10,%esp
+    1239:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    123c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1240:	75 39                	jne    127b <fgetc+0x56>
+    flushall(1);
+    1242:	83 ec 0c             	sub    $0xc,%esp
+    1245:	6a 01                	push   $0x1
+    1247:	e8 db fe ff ff       	call   1127 <flushall>
+    124c:	83 c4 10             	add    $0x10,%esp
+    return read(fd, &c, 1) == 1 ? c : -1;
+    124f:	83 ec 04             	sub    $0x4,%esp
+    1252:	6a 01                	push   $0x1
+    1254:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    1257:	50                   	push   %eax
+    1258:	ff 75 08             	push   0x8(%ebp)
+    125b:	e8 e5 f3 ff ff       	call   645 <read>
+    1260:	83 c4 10             	add    $0x10,%esp
+    1263:	83 f8 01             	cmp    $0x1,%eax
+    1266:	75 0c                	jne    1274 <fgetc+0x4f>
+    1268:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    126c:	0f b6 c0             	movzbl %al,%eax
+    126f:	e9 80 00 00 00       	jmp    12f4 <fgetc+0xcf>
+    1274:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1279:	eb 79                	jmp    12f4 <fgetc+0xcf>
+  }
+  if(s->rpos == s->rend){
+    127b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    127e:	8b 50 08             	mov    0x8(%eax),%edx
+    1281:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1284:	8b 40 0c             	mov    0xc(%eax),%eax
+    1287:	39 c2                	cmp    %eax,%edx
+    1289:	75 4c                	jne    12d7 <fgetc+0xb2>
+    flushall(1);
+    128b:	83 ec 0c             	sub    $0xc,%esp
+    128e:	6a 01                	push   $0x1
+    1290:	e8 92 fe ff ff       	call   1127 <flushall>
+    1295:	83 c4 10             	add    $0x10,%esp
+    if((n = read(fd, s->in, BUFSZ)) <= 0)
+    1298:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    129b:	05 10 02 00 00       	add    $0x210,%eax
+    12a0:	83 ec 04             	sub    $0x4,%esp
+    12a3:	68 00 02 00 00       	push   $0x200
+    12a8:	50                   	push   %eax
+    12a9:	ff 75 08             	push   0x8(%ebp)
+    12ac:	e8 94 f3 ff ff       	call   645 <read>
+    12b1:	83 c4 10             	add    $0x10,%esp
+    12b4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    12b7:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    12bb:	7f 07                	jg     12c4 <fgetc+0x9f>
+      return -1;
+    12bd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12c2:	eb 30                	jmp    12f4 <fgetc+0xcf>
+    s->rpos = 0;
+    12c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12c7:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+    s->rend = n;
+    12ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12d1:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    12d4:	89 50 0c             	mov    %edx,0xc(%eax)
+  }
+  return (uchar)s->in[s->rpos++];
+    12d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12da:	8b 40 08             	mov    0x8(%eax),%eax
+    12dd:	8d 48 01             	lea    0x1(%eax),%ecx
+    12e0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    12e3:	89 4a 08             	mov    %ecx,0x8(%edx)
+    12e6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    12e9:	0f b6 84 02 10 02 00 	movzbl 0x210(%edx,%eax,1),%eax
+    12f0:	00 
+    12f1:	0f b6 c0             	movzbl %al,%eax
+}
+    12f4:	c9                   	leave
+    12f5:	c3                   	ret
+
+000012f6 <fork>:
+
+int
+fork(void)
+{
+    12f6:	55                   	push   %ebp
+    12f7:	89 e5                	mov    %esp,%ebp
+    12f9:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    12fc:	83 ec 0c             	sub    $0xc,%esp
+    12ff:	6a 00                	push   $0x0
+    1301:	e8 21 fe ff ff       	call   1127 <flushall>
+    1306:	83 c4 10             	add    $0x10,%esp
+  return _fork();
+    1309:	e8 fb f2 ff ff       	call   609 <_fork>
+}
+    130e:	c9                   	leave
+    130f:	c3                   	ret
+
+00001310 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+    1310:	55                   	push   %ebp
+    1311:	89 e5                	mov    %esp,%ebp
+    1313:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    1316:	83 ec 0c             	sub    $0xc,%esp
+    1319:	6a 00                	push   $0x0
+    131b:	e8 07 fe ff ff       	call   1127 <flushall>
+    1320:	83 c4 10             	add    $0x10,%esp
+  return _exec(path, argv);
+    1323:	83 ec 08             	sub    $0x8,%esp
+    1326:	ff 75 0c             	push   0xc(%ebp)
+    1329:	ff 75 08             	push   0x8(%ebp)
+    132c:	e8 50 f3 ff ff       	call   681 <_exec>
+    1331:	83 c4 10             	add    $0x10,%esp
+}
+    1334:	c9                   	leave
+    1335:	c3                   	ret
+
+00001336 <exit>:
+
+int
+exit(void)
+{
+    1336:	55                   	push   %ebp
+    1337:	89 e5                	mov    %esp,%ebp
+    1339:	83 ec 08             	sub    $0x8,%esp
+  flushall(0);
+    133c:	83 ec 0c             	sub    $0xc,%esp
+    133f:	6a 00                	push   $0x0
+    1341:	e8 e1 fd ff ff       	call   1127 <flushall>
+    1346:	83 c4 10             	add    $0x10,%esp
+  _exit();
+    1349:	e8 ca f2 ff ff       	call   618 <_exit>
+
+0000134e <close>:
+}
+
+int
+close(int fd)
+{
+    134e:	55                   	push   %ebp
+    134f:	89 e5                	mov    %esp,%ebp
+    1351:	83 ec 18             	sub    $0x18,%esp
+  struct stream *s;
+
+  if(fd >= 0 && fd < NOFILE){
+    1354:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1358:	78 44                	js     139e <close+0x50>
+    135a:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+    135e:	7f 3e                	jg     139e <close+0x50>
+    fflush(fd);
+    1360:	83 ec 0c             	sub    $0xc,%esp
+    1363:	ff 75 08             	push   0x8(%ebp)
+    1366:	e8 29 fd ff ff       	call   1094 <fflush>
+    136b:	83 c4 10             	add    $0x10,%esp
+    s = &streams[fd];
+    136e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1371:	69 c0 10 04 00 00    	imul   $0x410,%eax,%eax
+    1377:	05 20 19 00 00       	add    $0x1920,%eax
+    137c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    s->mode = UNKNOWN;
+    137f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1382:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    s->rpos = s->rend = 0;
+    1388:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    138b:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    1392:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1395:	8b 50 0c             	mov    0xc(%eax),%edx
+    1398:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    139b:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  return _close(fd);
+    139e:	83 ec 0c             	sub    $0xc,%esp
+    13a1:	ff 75 08             	push   0x8(%ebp)
+    13a4:	e8 ba f2 ff ff       	call   663 <_close>
+    13a9:	83 c4 10             	add    $0x10,%esp
+}
+    13ac:	c9                   	leave
+    13ad:	c3                   	ret